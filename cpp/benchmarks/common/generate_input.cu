@@ -396,22 +396,90 @@ auto create_run_length_dist(cudf::size_type avg_run_len)
 }
 
 /**
- * @brief Generate indices within range [0 , cardinality) repeating with average run length
- * `avg_run_len`
+ * @brief Index generator in range [0, cardinality) with a Zipf distribution, where a given
+ * fraction of the indices is the most frequent index, zero.
+ */
+struct skewed_index_generator {
+  thrust::minstd_rand engine;
+  thrust::uniform_real_distribution<double> dist;
+  double exponent;
+  double heavy_hitter_fraction;
+  cudf::size_type cardinality;
+
+  skewed_index_generator(thrust::minstd_rand engine,
+                         double exponent,
+                         double heavy_hitter_fraction,
+                         cudf::size_type cardinality)
+    : engine(engine),
+      dist{0, 1},
+      exponent{exponent},
+      heavy_hitter_fraction{heavy_hitter_fraction},
+      cardinality{cardinality}
+  {
+  }
+
+  __device__ cudf::size_type operator()(size_t n)
+  {
+    engine.discard(2 * n);
+    if (dist(engine) < heavy_hitter_fraction) { return 0; }
+    auto const u = dist(engine);
+    // inverse of the CDF of the continuous power law on [1, cardinality + 1)
+    auto const rank = [&] {
+      if (exponent == 0.) { return 1. + u * cardinality; }
+      if (exponent == 1.) { return pow(cardinality + 1., u); }
+      auto const e = 1. - exponent;
+      return pow(1. + u * (pow(cardinality + 1., e) - 1.), 1. / e);
+    }();
+    return min(static_cast<cudf::size_type>(rank) - 1, cardinality - 1);
+  }
+};
+
+/**
+ * @brief Generate indices within range [0 , cardinality), with the skew set in the profile
+ *
+ * @param profile      Parameters for the random generator
+ * @param cardinality  Number of unique values in the output vector
+ * @param num_rows     Number of indices to generate
+ * @param engine       Random engine
+ * @return Generated indices of type `cudf::size_type`
+ */
+rmm::device_uvector<cudf::size_type> sample_indices(data_profile const& profile,
+                                                    cudf::size_type cardinality,
+                                                    cudf::size_type num_rows,
+                                                    thrust::minstd_rand& engine)
+{
+  if (not profile.is_skewed()) {
+    auto sample_dist = random_value_fn<cudf::size_type>{
+      distribution_params<cudf::size_type>{distribution_id::UNIFORM, 0, cardinality - 1}};
+    return sample_dist(engine, num_rows);
+  }
+  rmm::device_uvector<cudf::size_type> result(num_rows, cudf::get_default_stream());
+  thrust::tabulate(thrust::device,
+                   result.begin(),
+                   result.end(),
+                   skewed_index_generator{engine,
+                                          profile.get_zipf_exponent(),
+                                          profile.get_heavy_hitter_fraction(),
+                                          cardinality});
+  return result;
+}
+
+/**
+ * @brief Generate indices within range [0 , cardinality) repeating with the average run length
+ * and the skew set in the profile
  *
- * @param avg_run_len  Average run length of the generated indices
+ * @param profile      Parameters for the random generator
  * @param cardinality  Number of unique values in the output vector
  * @param num_rows     Number of indices to generate
  * @param engine       Random engine
  * @return Generated indices of type `cudf::size_type`
  */
-rmm::device_uvector<cudf::size_type> sample_indices_with_run_length(cudf::size_type avg_run_len,
+rmm::device_uvector<cudf::size_type> sample_indices_with_run_length(data_profile const& profile,
                                                                     cudf::size_type cardinality,
                                                                     cudf::size_type num_rows,
                                                                     thrust::minstd_rand& engine)
 {
-  auto sample_dist = random_value_fn<cudf::size_type>{
-    distribution_params<cudf::size_type>{distribution_id::UNIFORM, 0, cardinality - 1}};
+  auto const avg_run_len = profile.get_avg_run_length();
   if (avg_run_len > 1) {
     auto avglen_dist =
       random_value_fn<int>{distribution_params<int>{distribution_id::UNIFORM, 1, 2 * avg_run_len}};
@@ -419,7 +487,7 @@ rmm::device_uvector<cudf::size_type> sample_indices_with_run_length(cudf::size_t
     auto run_lens             = avglen_dist(engine, approx_run_len);
     thrust::inclusive_scan(
       thrust::device, run_lens.begin(), run_lens.end(), run_lens.begin(), std::plus<int>{});
-    auto const samples_indices = sample_dist(engine, approx_run_len + 1);
+    auto const samples_indices = sample_indices(profile, cardinality, approx_run_len + 1, engine);
     // This is gather.
     auto avg_repeated_sample_indices_iterator = thrust::make_transform_iterator(
       thrust::make_counting_iterator(0),
@@ -439,7 +507,7 @@ rmm::device_uvector<cudf::size_type> sample_indices_with_run_length(cudf::size_t
     return repeated_sample_indices;
   } else {
     // generate n samples.
-    return sample_dist(engine, num_rows);
+    return sample_indices(profile, cardinality, num_rows, engine);
   }
 }
 
@@ -476,7 +544,7 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
   rmm::device_uvector<DeviceType> data(0, cudf::get_default_stream());
   rmm::device_uvector<bool> null_mask(0, cudf::get_default_stream());
 
-  if (profile.get_cardinality() == 0 and avg_run_len == 1) {
+  if (profile.get_cardinality() == 0 and avg_run_len == 1 and not profile.is_skewed()) {
     data      = value_dist(engine, num_rows);
     null_mask = valid_dist(engine, num_rows);
   } else {
@@ -488,15 +556,13 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
     rmm::device_uvector<DeviceType> samples     = value_dist(engine, cardinality);
 
     // generate n samples and gather.
-    auto const sample_indices =
-      sample_indices_with_run_length(avg_run_len, cardinality, num_rows, engine);
-    data      = rmm::device_uvector<DeviceType>(num_rows, cudf::get_default_stream());
-    null_mask = rmm::device_uvector<bool>(num_rows, cudf::get_default_stream());
-    thrust::gather(
-      thrust::device, sample_indices.begin(), sample_indices.end(), samples.begin(), data.begin());
+    auto const indices = sample_indices_with_run_length(profile, cardinality, num_rows, engine);
+    data               = rmm::device_uvector<DeviceType>(num_rows, cudf::get_default_stream());
+    null_mask          = rmm::device_uvector<bool>(num_rows, cudf::get_default_stream());
+    thrust::gather(thrust::device, indices.begin(), indices.end(), samples.begin(), data.begin());
     thrust::gather(thrust::device,
-                   sample_indices.begin(),
-                   sample_indices.end(),
+                   indices.begin(),
+                   indices.end(),
                    samples_null_mask.begin(),
                    null_mask.begin());
   }
@@ -614,14 +680,14 @@ std::unique_ptr<cudf::column> create_random_column<cudf::string_view>(data_profi
                                                                       cudf::size_type num_rows)
 {
   auto const cardinality = std::min(profile.get_cardinality(), num_rows);
-  auto const avg_run_len = profile.get_avg_run_length();
 
   auto sample_strings =
     create_random_utf8_string_column(profile, engine, cardinality == 0 ? num_rows : cardinality);
-  if (cardinality == 0) { return sample_strings; }
-  auto sample_indices = sample_indices_with_run_length(avg_run_len, cardinality, num_rows, engine);
-  auto str_table      = cudf::detail::gather(cudf::table_view{{sample_strings->view()}},
-                                        sample_indices,
+  if (cardinality == 0 and not profile.is_skewed()) { return sample_strings; }
+  auto const indices = sample_indices_with_run_length(
+    profile, cardinality == 0 ? num_rows : cardinality, num_rows, engine);
+  auto str_table = cudf::detail::gather(cudf::table_view{{sample_strings->view()}},
+                                        indices,
                                         cudf::out_of_bounds_policy::DONT_CHECK,
                                         cudf::detail::negative_index_policy::NOT_ALLOWED,
                                         cudf::get_default_stream(),
@@ -232,6 +232,8 @@ class data_profile {
   std::optional<double> null_probability = 0.01;
   cudf::size_type cardinality            = 2000;
   cudf::size_type avg_run_length         = 4;
+  double zipf_exponent                   = 0.;
+  double heavy_hitter_fraction           = 0.;
 
  public:
   template <typename T,
@@ -318,6 +320,9 @@ class data_profile {
   [[nodiscard]] auto get_valid_probability() const { return 1. - null_probability.value_or(0.); };
   [[nodiscard]] auto get_cardinality() const { return cardinality; };
   [[nodiscard]] auto get_avg_run_length() const { return avg_run_length; };
+  [[nodiscard]] auto get_zipf_exponent() const { return zipf_exponent; };
+  [[nodiscard]] auto get_heavy_hitter_fraction() const { return heavy_hitter_fraction; };
+  [[nodiscard]] bool is_skewed() const { return zipf_exponent > 0. or heavy_hitter_fraction > 0.; }
 
   // Users should pass integral values for bounds when setting the parameters for types that have
   // discrete distributions (integers, strings, lists). Otherwise the call with have no effect.
@@ -384,6 +389,16 @@ class data_profile {
   }
   void set_cardinality(cudf::size_type c) { cardinality = c; }
   void set_avg_run_length(cudf::size_type avg_rl) { avg_run_length = avg_rl; }
+  void set_zipf_exponent(double s)
+  {
+    CUDF_EXPECTS(s >= 0., "Zipf exponent must not be negative");
+    zipf_exponent = s;
+  }
+  void set_heavy_hitter_fraction(double f)
+  {
+    CUDF_EXPECTS(f >= 0. and f <= 1., "fraction must be in range [0...1]");
+    heavy_hitter_fraction = f;
+  }
 
   void set_list_depth(cudf::size_type max_depth)
   {
@@ -531,6 +546,37 @@ class data_profile_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the skew of the frequencies of the unique values in output columns.
+   *
+   * With exponent `s`, the k-th most frequent unique value is picked with a probability
+   * proportional to `1 / k^s`; `0` picks all unique values with the same probability. Applies to
+   * columns of fixed-width types and strings.
+   *
+   * @param s Non-negative Zipf exponent
+   * @return this for chaining
+   */
+  data_profile_builder& zipf_exponent(double s)
+  {
+    profile.set_zipf_exponent(s);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the fraction of rows that hold the single most frequent value of the column.
+   *
+   * The remaining rows follow the regular (uniform or Zipf) selection of unique values. Applies to
+   * columns of fixed-width types and strings.
+   *
+   * @param f Fraction of rows with the heavy hitter, in range [0..1]
+   * @return this for chaining
+   */
+  data_profile_builder& heavy_hitter_fraction(double f)
+  {
+    profile.set_heavy_hitter_fraction(f);
+    return *this;
+  }
+
   /**
    * @brief Sets the maximum nesting depth of generated list columns.
    *
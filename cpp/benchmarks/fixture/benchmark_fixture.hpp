@@ -119,6 +119,16 @@ class memory_stats_logger {
     return statistics_mr.get_bytes_counter().peak;
   }
 
+  [[nodiscard]] size_t total_allocated_bytes() const noexcept
+  {
+    return statistics_mr.get_bytes_counter().total;
+  }
+
+  [[nodiscard]] size_t allocation_count() const noexcept
+  {
+    return statistics_mr.get_allocations_counter().total;
+  }
+
  private:
   rmm::mr::device_memory_resource* existing_mr;
   rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> statistics_mr;
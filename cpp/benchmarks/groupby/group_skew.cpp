@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
+#include <cudf/groupby.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+void bench_groupby_sum_skew(nvbench::state& state)
+{
+  auto const num_rows     = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const cardinality  = static_cast<cudf::size_type>(state.get_int64("cardinality"));
+  auto const zipf         = state.get_float64("zipf_exponent");
+  auto const heavy_hitter = state.get_float64("heavy_hitter_fraction");
+
+  auto const keys = [&] {
+    data_profile const profile =
+      data_profile_builder()
+        .cardinality(cardinality)
+        .avg_run_length(1)
+        .zipf_exponent(zipf)
+        .heavy_hitter_fraction(heavy_hitter)
+        .no_validity()
+        .distribution(cudf::type_to_id<int32_t>(), distribution_id::UNIFORM, 0, num_rows);
+    return create_random_column(cudf::type_to_id<int32_t>(), row_count{num_rows}, profile);
+  }();
+  auto const vals = [&] {
+    data_profile const profile =
+      data_profile_builder().cardinality(0).no_validity().distribution(
+        cudf::type_to_id<int64_t>(), distribution_id::UNIFORM, 0, 1000);
+    return create_random_column(cudf::type_to_id<int64_t>(), row_count{num_rows}, profile);
+  }();
+
+  auto gb_obj = cudf::groupby::groupby(cudf::table_view({keys->view()}));
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = vals->view();
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+
+  auto const mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch) { auto const result = gb_obj.aggregate(requests); });
+  auto const elapsed_time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(num_rows) / elapsed_time / 1'000'000., "Mrows/s");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+}
+
+NVBENCH_BENCH(bench_groupby_sum_skew)
+  .set_name("groupby_sum_skew")
+  .add_int64_axis("num_rows", {10'000'000})
+  .add_int64_axis("cardinality", {1'000, 1'000'000})
+  .add_float64_axis("zipf_exponent", {0, 0.5, 1, 1.5})
+  .add_float64_axis("heavy_hitter_fraction", {0, 0.5});
@@ -61,8 +61,7 @@ void csv_read_common(DataType const& data_types,
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(source_sink.size(), "encoded_file_size", "encoded_file_size");
 }
 
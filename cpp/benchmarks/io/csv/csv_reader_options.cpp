@@ -109,8 +109,7 @@ void BM_csv_read_varying_options(
   auto const elapsed_time   = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   auto const data_processed = data_size * cols_to_read.size() / view.num_columns();
   state.add_element_count(static_cast<double>(data_processed) / elapsed_time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(source_sink.size(), "encoded_file_size", "encoded_file_size");
 }
 
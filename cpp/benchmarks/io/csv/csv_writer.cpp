@@ -58,8 +58,7 @@ void BM_csv_write_dtype_io(nvbench::state& state,
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
 }
 
@@ -100,8 +99,7 @@ void BM_csv_write_varying_options(nvbench::state& state)
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
 }
 
@@ -21,10 +21,13 @@
 
 #include <unistd.h>
 
+#include <chrono>
 #include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <numeric>
 #include <string>
+#include <thread>
 
 temp_directory const cuio_source_sink_pair::tmpdir{"cudf_gbench"};
 
@@ -39,6 +42,59 @@ std::string random_file_in_dir(std::string const& dir_path)
   return filename;
 }
 
+namespace {
+
+// Reads a non-negative numeric setting from the environment
+double env_or_default(char const* name, double default_value)
+{
+  auto const value = std::getenv(name);
+  return value == nullptr ? default_value : std::stod(value);
+}
+
+/**
+ * @brief Datasource over a host buffer that mimics an object store.
+ *
+ * Each read request waits for a fixed latency plus the time to transfer the requested bytes at a
+ * capped bandwidth, so that the number and the size of the reads both show in the timings.
+ */
+class remote_datasource : public cudf::io::datasource {
+ public:
+  explicit remote_datasource(cudf::host_span<std::byte const> buffer)
+    : source{cudf::io::datasource::create(buffer)},
+      latency{env_or_default("CUDF_BENCHMARK_REMOTE_LATENCY_US", 10'000.)},
+      bandwidth{env_or_default("CUDF_BENCHMARK_REMOTE_BANDWIDTH_MBPS", 1'000.)}
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    wait_for_transfer(size);
+    return source->host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    wait_for_transfer(size);
+    return source->host_read(offset, size, dst);
+  }
+
+  [[nodiscard]] size_t size() const override { return source->size(); }
+
+ private:
+  void wait_for_transfer(size_t size) const
+  {
+    // bandwidth is in MB/s, i.e. bytes per microsecond
+    auto const transfer_time = latency + static_cast<double>(size) / bandwidth;
+    std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(transfer_time));
+  }
+
+  std::unique_ptr<cudf::io::datasource> source;
+  double latency;    ///< Time to first byte of each request, in microseconds
+  double bandwidth;  ///< Bandwidth of each request, in MB/s
+};
+
+}  // namespace
+
 cuio_source_sink_pair::cuio_source_sink_pair(io_type type)
   : type{type},
     d_buffer{0, cudf::get_default_stream()},
@@ -62,6 +118,11 @@ cudf::io::source_info cuio_source_sink_pair::make_source_info()
 
       return cudf::io::source_info(d_buffer);
     }
+    case io_type::USER_IMPLEMENTED: {
+      remote_source = std::make_unique<remote_datasource>(cudf::host_span<std::byte const>(
+        reinterpret_cast<std::byte const*>(h_buffer.data()), h_buffer.size()));
+      return cudf::io::source_info(remote_source.get());
+    }
     default: CUDF_FAIL("invalid input type");
   }
 }
@@ -72,7 +133,8 @@ cudf::io::sink_info cuio_source_sink_pair::make_sink_info()
     case io_type::VOID: return cudf::io::sink_info(void_sink.get());
     case io_type::FILEPATH: return cudf::io::sink_info(file_name);
     case io_type::HOST_BUFFER: [[fallthrough]];
-    case io_type::DEVICE_BUFFER: return cudf::io::sink_info(&h_buffer);
+    case io_type::DEVICE_BUFFER: [[fallthrough]];
+    case io_type::USER_IMPLEMENTED: return cudf::io::sink_info(&h_buffer);
     default: CUDF_FAIL("invalid output type");
   }
 }
@@ -85,7 +147,8 @@ size_t cuio_source_sink_pair::size()
       return static_cast<size_t>(
         std::ifstream(file_name, std::ifstream::ate | std::ifstream::binary).tellg());
     case io_type::HOST_BUFFER: [[fallthrough]];
-    case io_type::DEVICE_BUFFER: return h_buffer.size();
+    case io_type::DEVICE_BUFFER: [[fallthrough]];
+    case io_type::USER_IMPLEMENTED: return h_buffer.size();
     default: CUDF_FAIL("invalid output type");
   }
 }
@@ -230,3 +293,11 @@ cudf::io::compression_type retrieve_compression_type_enum(std::string_view compr
   if (compression_string == "ZSTD") { return cudf::io::compression_type::ZSTD; }
   CUDF_FAIL("Unsupported compression_type.");
 }
+
+void add_memory_stats(nvbench::state& state, cudf::memory_stats_logger const& logger)
+{
+  state.add_buffer_size(logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(
+    logger.total_allocated_bytes(), "total_allocated_bytes", "total_allocated_bytes");
+  state.add_element_count(logger.allocation_count(), "allocation_count");
+}
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
 #include <cudf_test/file_utilities.hpp>
 
 #include <cudf/io/data_sink.hpp>
@@ -24,6 +26,8 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <nvbench/nvbench.cuh>
+
 using cudf::io::io_type;
 
 std::string random_file_in_dir(std::string const& dir_path);
@@ -45,6 +49,11 @@ class cuio_source_sink_pair {
    * The `datasource` created using the returned `source_info` will read data from the same location
    * that the result of a @ref `make_sink_info` call writes to.
    *
+   * `io_type::USER_IMPLEMENTED` reads the data like a remote object store, with a latency for each
+   * read request and a capped bandwidth. These are set in microseconds and MB/s with the
+   * `CUDF_BENCHMARK_REMOTE_LATENCY_US` and `CUDF_BENCHMARK_REMOTE_BANDWIDTH_MBPS` environment
+   * variables, and default to 10ms and 1000MB/s.
+   *
    * @return The description of the data source
    */
   cudf::io::source_info make_source_info();
@@ -56,6 +65,7 @@ class cuio_source_sink_pair {
    * that the result of a @ref `make_source_info` call reads from.
    *
    * `io_type::DEVICE_BUFFER` source/sink is an exception where a host buffer sink will be created.
+   * `io_type::USER_IMPLEMENTED` also writes to a host buffer.
    *
    * @return The description of the data sink
    */
@@ -71,6 +81,7 @@ class cuio_source_sink_pair {
   rmm::device_uvector<std::byte> d_buffer;
   std::string const file_name;
   std::unique_ptr<cudf::io::data_sink> void_sink;
+  std::unique_ptr<cudf::io::datasource> remote_source;
 };
 
 /**
@@ -153,3 +164,14 @@ cudf::io::io_type retrieve_io_type_enum(std::string_view io_string);
  * @return The compression_type enum value
  */
 cudf::io::compression_type retrieve_compression_type_enum(std::string_view compression_string);
+
+/**
+ * @brief Adds the device memory statistics recorded by a logger to the summaries of a benchmark.
+ *
+ * Reports the peak memory usage, the total number of allocated bytes and the number of
+ * allocations, so memory regressions and allocation churn show up next to the timings.
+ *
+ * @param state The benchmark state to add the summaries to
+ * @param logger The logger that tracked the device allocations of the benchmark
+ */
+void add_memory_stats(nvbench::state& state, cudf::memory_stats_logger const& logger);
@@ -15,11 +15,13 @@
  */
 
 #include "io/fst/lookup_tables.cuh"
+#include "io/json/nested_json.hpp"
 #include "io/utilities/hostdevice_vector.hpp"  //TODO find better replacement
 
 #include <benchmarks/common/generate_input.hpp>
 #include <tests/io/fst/common.hpp>
 
+#include <cudf/io/detail/json.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/repeat_strings.hpp>
 #include <cudf/types.hpp>
@@ -225,6 +227,71 @@ void BM_FST_JSON_no_str(nvbench::state& state)
   });
 }
 
+void BM_FST_JSON_stack_context(nvbench::state& state)
+{
+  CUDF_EXPECTS(state.get_int64("string_size") <= std::numeric_limits<cudf::size_type>::max(),
+               "Benchmarks only support up to size_type's maximum number of items");
+  // Prepare cuda stream for data transfers & kernels
+  rmm::cuda_stream stream{};
+  rmm::cuda_stream_view stream_view(stream);
+
+  auto input_string = make_test_json_data(state);
+  auto& d_input     = static_cast<cudf::scalar_type_t<std::string>&>(*input_string);
+
+  state.add_element_count(d_input.size());
+
+  rmm::device_uvector<SymbolT> stack_context(d_input.size(), stream_view);
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    cudf::io::json::detail::get_stack_context(
+      cudf::device_span<SymbolT const>{d_input.data(), static_cast<std::size_t>(d_input.size())},
+      stack_context.data(),
+      cudf::io::json::stack_behavior_t::ResetOnDelimiter,
+      stream_view);
+  });
+}
+
+void fst_json_normalize(nvbench::state& state, bool normalize_quotes)
+{
+  CUDF_EXPECTS(state.get_int64("string_size") <= std::numeric_limits<cudf::size_type>::max(),
+               "Benchmarks only support up to size_type's maximum number of items");
+  // Prepare cuda stream for data transfers & kernels
+  rmm::cuda_stream stream{};
+  rmm::cuda_stream_view stream_view(stream);
+
+  auto input_string = make_test_json_data(state);
+  auto& d_input     = static_cast<cudf::scalar_type_t<std::string>&>(*input_string);
+
+  state.add_element_count(d_input.size());
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(
+    nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
+      // The normalization consumes its input, so a fresh copy is made outside of the timed region
+      rmm::device_uvector<char> input(d_input.size(), stream_view);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        input.data(), d_input.data(), d_input.size(), cudaMemcpyDefault, stream.value()));
+      stream_view.synchronize();
+
+      timer.start();
+      auto const output =
+        normalize_quotes
+          ? cudf::io::json::detail::normalize_single_quotes(
+              std::move(input), stream_view, rmm::mr::get_current_device_resource())
+          : cudf::io::json::detail::normalize_whitespace(
+              std::move(input), stream_view, rmm::mr::get_current_device_resource());
+      timer.stop();
+    });
+}
+
+void BM_FST_JSON_normalize_single_quotes(nvbench::state& state)
+{
+  fst_json_normalize(state, true);
+}
+
+void BM_FST_JSON_normalize_whitespace(nvbench::state& state) { fst_json_normalize(state, false); }
+
 NVBENCH_BENCH(BM_FST_JSON)
   .set_name("FST_JSON")
   .add_int64_power_of_two_axis("string_size", nvbench::range(20, 30, 1));
@@ -240,3 +307,15 @@ NVBENCH_BENCH(BM_FST_JSON_no_out)
 NVBENCH_BENCH(BM_FST_JSON_no_str)
   .set_name("FST_JSON_no_str")
   .add_int64_power_of_two_axis("string_size", nvbench::range(20, 30, 1));
+
+NVBENCH_BENCH(BM_FST_JSON_stack_context)
+  .set_name("FST_JSON_stack_context")
+  .add_int64_power_of_two_axis("string_size", nvbench::range(20, 30, 1));
+
+NVBENCH_BENCH(BM_FST_JSON_normalize_single_quotes)
+  .set_name("FST_JSON_normalize_single_quotes")
+  .add_int64_power_of_two_axis("string_size", nvbench::range(20, 30, 1));
+
+NVBENCH_BENCH(BM_FST_JSON_normalize_whitespace)
+  .set_name("FST_JSON_normalize_whitespace")
+  .add_int64_power_of_two_axis("string_size", nvbench::range(20, 30, 1));
@@ -52,8 +52,7 @@ void json_read_common(cuio_source_sink_pair& source_sink,
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(source_sink.size(), "encoded_file_size", "encoded_file_size");
 }
 
@@ -109,7 +108,8 @@ using d_type_list = nvbench::enum_type_list<data_type::INTEGRAL,
 
 using io_list = nvbench::enum_type_list<cudf::io::io_type::FILEPATH,
                                         cudf::io::io_type::HOST_BUFFER,
-                                        cudf::io::io_type::DEVICE_BUFFER>;
+                                        cudf::io::io_type::DEVICE_BUFFER,
+                                        cudf::io::io_type::USER_IMPLEMENTED>;
 
 using compression_list =
   nvbench::enum_type_list<cudf::io::compression_type::SNAPPY, cudf::io::compression_type::NONE>;
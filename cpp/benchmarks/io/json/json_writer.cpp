@@ -47,8 +47,7 @@ void json_write_common(cudf::io::json_writer_options const& write_opts,
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(source_sink.size(), "encoded_file_size", "encoded_file_size");
 }
 
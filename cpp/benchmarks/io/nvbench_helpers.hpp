@@ -63,6 +63,7 @@ NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
       case cudf::io::io_type::HOST_BUFFER: return "HOST_BUFFER";
       case cudf::io::io_type::DEVICE_BUFFER: return "DEVICE_BUFFER";
       case cudf::io::io_type::VOID: return "VOID";
+      case cudf::io::io_type::USER_IMPLEMENTED: return "USER_IMPLEMENTED";
       default: return "Unknown";
     }
   },
@@ -77,8 +77,7 @@ void BM_orc_write_encode(nvbench::state& state, nvbench::type_list<nvbench::enum
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
 }
 
@@ -126,8 +125,7 @@ void BM_orc_write_io_compression(
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
 }
 
@@ -170,8 +168,7 @@ void BM_orc_write_statistics(
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
 }
 
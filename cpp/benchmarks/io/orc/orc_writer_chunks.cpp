@@ -69,7 +69,7 @@ void nvbench_orc_write(nvbench::state& state)
                encoded_file_size = source_sink.size();
              });
 
-  state.add_buffer_size(mem_stats_logger.peak_memory_usage(), "pmu", "Peak Memory Usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "efs", "Encoded File Size");
   state.add_element_count(view.num_rows(), "Total Rows");
 }
@@ -125,7 +125,7 @@ void nvbench_orc_chunked_write(nvbench::state& state)
       encoded_file_size = source_sink.size();
     });
 
-  state.add_buffer_size(mem_stats_logger.peak_memory_usage(), "pmu", "Peak Memory Usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "efs", "Encoded File Size");
   state.add_element_count(total_rows, "Total Rows");
 }
@@ -77,8 +77,7 @@ void BM_parq_write_encode(nvbench::state& state, nvbench::type_list<nvbench::enu
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
 }
 
@@ -127,8 +126,7 @@ void BM_parq_write_io_compression(
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
 }
 
@@ -174,8 +172,7 @@ void BM_parq_write_varying_options(
 
   auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
   state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
-  state.add_buffer_size(
-    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  add_memory_stats(state, mem_stats_logger);
   state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
 }
 
@@ -193,7 +193,7 @@ static void bench_multibyte_split(nvbench::state& state,
     output = cudf::io::text::multibyte_split(*source, delim, options);
   });
 
-  state.add_buffer_size(mem_stats_logger.peak_memory_usage(), "pmu", "Peak Memory Usage");
+  add_memory_stats(state, mem_stats_logger);
   // TODO adapt to consistent naming scheme once established
   state.add_buffer_size(range_size, "efs", "Encoded file size");
 }
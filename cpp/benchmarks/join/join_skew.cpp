@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
+#include <cudf/join.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+/**
+ * @brief Joins a table of unique keys with a table of foreign keys whose frequencies are skewed,
+ * like a fact table joined with a dimension table.
+ */
+void bench_inner_join_skew(nvbench::state& state)
+{
+  auto const build_size   = static_cast<cudf::size_type>(state.get_int64("build_size"));
+  auto const probe_size   = static_cast<cudf::size_type>(state.get_int64("probe_size"));
+  auto const zipf         = state.get_float64("zipf_exponent");
+  auto const heavy_hitter = state.get_float64("heavy_hitter_fraction");
+
+  // every probe key matches exactly one build key, so skew does not change the output size
+  auto const build = create_sequence_table({cudf::type_id::INT32}, row_count{build_size});
+  data_profile const profile =
+    data_profile_builder()
+      .cardinality(build_size)
+      .avg_run_length(1)
+      .zipf_exponent(zipf)
+      .heavy_hitter_fraction(heavy_hitter)
+      .no_validity()
+      .distribution(cudf::type_id::INT32, distribution_id::UNIFORM, 0, build_size - 1);
+  auto const probe = create_random_table({cudf::type_id::INT32}, row_count{probe_size}, profile);
+
+  auto const mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    cudf::hash_join hj_obj(build->view(), cudf::null_equality::EQUAL);
+    auto const result = hj_obj.inner_join(probe->view());
+  });
+  auto const elapsed_time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(probe_size) / elapsed_time / 1'000'000., "Mrows/s");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+}
+
+NVBENCH_BENCH(bench_inner_join_skew)
+  .set_name("inner_join_skew")
+  .add_int64_axis("build_size", {100'000, 10'000'000})
+  .add_int64_axis("probe_size", {100'000'000})
+  .add_float64_axis("zipf_exponent", {0, 0.5, 1, 1.5})
+  .add_float64_axis("heavy_hitter_fraction", {0, 0.5});
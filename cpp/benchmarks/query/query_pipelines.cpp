@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+/**
+ * Multi-operator pipelines modeled on TPC-H queries, run over generated tables stored as Parquet.
+ *
+ * Each pipeline reads its input with column selection, filters, computes expressions, joins,
+ * aggregates and orders the result, so the allocations, synchronizations and intermediate tables
+ * between the operators are measured along with the operators themselves.
+ */
+
+namespace {
+
+// Rows of each table per unit of scale factor, as in TPC-H
+constexpr double lineitem_rows_per_sf = 6'000'000;
+constexpr double orders_rows_per_sf   = 1'500'000;
+// Dates are stored as days since the first order date, spanning about seven years
+constexpr int32_t num_days = 2557;
+
+/**
+ * @brief Generates a column of uniformly distributed values in `[lower, upper]` without nulls.
+ */
+template <typename T>
+std::unique_ptr<cudf::column> uniform_column(cudf::size_type num_rows,
+                                             T lower,
+                                             T upper,
+                                             unsigned seed)
+{
+  data_profile const profile =
+    data_profile_builder().cardinality(0).no_validity().distribution(
+      cudf::type_to_id<T>(), distribution_id::UNIFORM, lower, upper);
+  return create_random_column(cudf::type_to_id<T>(), row_count{num_rows}, profile, seed);
+}
+
+/**
+ * @brief Writes a table to the sink of `source_sink` as Parquet.
+ */
+void write_table(std::vector<std::unique_ptr<cudf::column>>&& columns,
+                 std::vector<std::string> const& names,
+                 cuio_source_sink_pair& source_sink)
+{
+  auto const table = cudf::table(std::move(columns));
+  cudf::io::table_input_metadata metadata(table.view());
+  for (std::size_t i = 0; i < names.size(); ++i) {
+    metadata.column_metadata[i].set_name(names[i]);
+  }
+  cudf::io::parquet_writer_options const write_opts =
+    cudf::io::parquet_writer_options::builder(source_sink.make_sink_info(), table.view())
+      .metadata(metadata)
+      .compression(cudf::io::compression_type::SNAPPY);
+  cudf::io::write_parquet(write_opts);
+}
+
+/**
+ * @brief Generates the `lineitem` table and returns its number of rows.
+ */
+cudf::size_type write_lineitem(double scale_factor, cuio_source_sink_pair& source_sink)
+{
+  auto const num_rows   = static_cast<cudf::size_type>(lineitem_rows_per_sf * scale_factor);
+  auto const num_orders = static_cast<cudf::size_type>(orders_rows_per_sf * scale_factor);
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(uniform_column<int32_t>(num_rows, 0, num_orders - 1, 1));
+  columns.push_back(uniform_column<double>(num_rows, 1., 50., 2));
+  columns.push_back(uniform_column<double>(num_rows, 900., 105'000., 3));
+  columns.push_back(uniform_column<double>(num_rows, 0., 0.1, 4));
+  columns.push_back(uniform_column<int32_t>(num_rows, 0, 2, 5));
+  columns.push_back(uniform_column<int32_t>(num_rows, 0, 1, 6));
+  columns.push_back(uniform_column<int32_t>(num_rows, 0, num_days, 7));
+  write_table(std::move(columns),
+              {"l_orderkey",
+               "l_quantity",
+               "l_extendedprice",
+               "l_discount",
+               "l_returnflag",
+               "l_linestatus",
+               "l_shipdate"},
+              source_sink);
+  return num_rows;
+}
+
+/**
+ * @brief Generates the `orders` table and returns its number of rows.
+ */
+cudf::size_type write_orders(double scale_factor, cuio_source_sink_pair& source_sink)
+{
+  auto const num_rows = static_cast<cudf::size_type>(orders_rows_per_sf * scale_factor);
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(std::move(
+    create_sequence_table({cudf::type_id::INT32}, row_count{num_rows})->release().front()));
+  columns.push_back(uniform_column<int32_t>(num_rows, 0, num_days, 8));
+  write_table(std::move(columns), {"o_orderkey", "o_orderdate"}, source_sink);
+  return num_rows;
+}
+
+/**
+ * @brief Reads the given columns of a Parquet table.
+ */
+std::unique_ptr<cudf::table> scan(cudf::io::source_info const& source,
+                                  std::vector<std::string> const& columns)
+{
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(source).columns(columns).build();
+  return cudf::io::read_parquet(read_opts).tbl;
+}
+
+/**
+ * @brief Returns the rows of `table` whose column `column_index` compares to `value` with `op`.
+ */
+std::unique_ptr<cudf::table> filter(cudf::table_view const& table,
+                                    cudf::size_type column_index,
+                                    cudf::ast::ast_operator op,
+                                    int32_t value)
+{
+  auto const scalar    = cudf::numeric_scalar<int32_t>(value);
+  auto const column    = cudf::ast::column_reference(column_index);
+  auto const literal   = cudf::ast::literal(scalar);
+  auto const predicate = cudf::ast::operation(op, column, literal);
+  auto const mask      = cudf::compute_column(table, predicate);
+  return cudf::apply_boolean_mask(table, mask->view());
+}
+
+/**
+ * @brief Computes `price * (1 - discount)` for the given price and discount columns.
+ */
+std::unique_ptr<cudf::column> discounted_price(cudf::table_view const& table,
+                                               cudf::size_type price_index,
+                                               cudf::size_type discount_index)
+{
+  auto const one_scalar = cudf::numeric_scalar<double>(1.);
+  auto const one        = cudf::ast::literal(one_scalar);
+  auto const price      = cudf::ast::column_reference(price_index);
+  auto const discount   = cudf::ast::column_reference(discount_index);
+  auto const factor     = cudf::ast::operation(cudf::ast::ast_operator::SUB, one, discount);
+  auto const revenue    = cudf::ast::operation(cudf::ast::ast_operator::MUL, price, factor);
+  return cudf::compute_column(table, revenue);
+}
+
+/**
+ * @brief Pricing summary pipeline, after TPC-H Q1: scan, filter, project, aggregate and sort.
+ */
+std::unique_ptr<cudf::table> pricing_summary(cudf::io::source_info const& lineitem)
+{
+  auto const scanned = scan(lineitem,
+                            {"l_quantity",
+                             "l_extendedprice",
+                             "l_discount",
+                             "l_returnflag",
+                             "l_linestatus",
+                             "l_shipdate"});
+  auto const filtered =
+    filter(scanned->view(), 5, cudf::ast::ast_operator::LESS_EQUAL, num_days - 90);
+  auto const items      = filtered->view();
+  auto const disc_price = discounted_price(items, 1, 2);
+
+  cudf::groupby::groupby grouper(cudf::table_view({items.column(3), items.column(4)}));
+  std::vector<cudf::groupby::aggregation_request> requests(4);
+  requests[0].values = items.column(0);
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  requests[1].values = items.column(1);
+  requests[1].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[1].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  requests[2].values = items.column(2);
+  requests[2].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  requests[3].values = disc_price->view();
+  requests[3].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  auto const [keys, results] = grouper.aggregate(requests);
+
+  std::vector<cudf::column_view> columns;
+  for (auto const& key : keys->view()) {
+    columns.push_back(key);
+  }
+  for (auto const& result : results) {
+    for (auto const& aggregate : result.results) {
+      columns.push_back(aggregate->view());
+    }
+  }
+  return cudf::sort_by_key(cudf::table_view(columns), keys->view());
+}
+
+/**
+ * @brief Shipping priority pipeline, after TPC-H Q3: scan two tables, filter, join, aggregate and
+ * keep the top rows.
+ */
+std::unique_ptr<cudf::table> shipping_priority(cudf::io::source_info const& orders,
+                                               cudf::io::source_info const& lineitem)
+{
+  constexpr int32_t cutoff_date   = num_days / 2;
+  constexpr cudf::size_type top_k = 10;
+
+  auto const scanned_orders = scan(orders, {"o_orderkey", "o_orderdate"});
+  auto const filtered_orders =
+    filter(scanned_orders->view(), 1, cudf::ast::ast_operator::LESS, cutoff_date);
+  auto const scanned_items =
+    scan(lineitem, {"l_orderkey", "l_extendedprice", "l_discount", "l_shipdate"});
+  auto const filtered_items =
+    filter(scanned_items->view(), 3, cudf::ast::ast_operator::GREATER, cutoff_date);
+
+  auto const [order_indices, item_indices] =
+    cudf::inner_join(filtered_orders->view().select({0}), filtered_items->view().select({0}));
+  auto const joined_orders =
+    cudf::gather(filtered_orders->view(),
+                 cudf::column_view{cudf::device_span<cudf::size_type const>{*order_indices}});
+  auto const joined_items =
+    cudf::gather(filtered_items->view(),
+                 cudf::column_view{cudf::device_span<cudf::size_type const>{*item_indices}});
+  auto const revenue = discounted_price(joined_items->view(), 1, 2);
+
+  cudf::groupby::groupby grouper(cudf::table_view(
+    {joined_orders->view().column(0), joined_orders->view().column(1)}));
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = revenue->view();
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  auto const [keys, results] = grouper.aggregate(requests);
+
+  // the orders with the highest revenue, the earliest first
+  auto const order_keys = keys->view().column(0);
+  auto const order_date = keys->view().column(1);
+  auto const sums       = results[0].results[0]->view();
+  return cudf::top_k_by_key(cudf::table_view({order_keys, order_date, sums}),
+                            cudf::table_view({sums, order_date}),
+                            top_k,
+                            {cudf::order::DESCENDING, cudf::order::ASCENDING});
+}
+
+}  // namespace
+
+void BM_pricing_summary(nvbench::state& state)
+{
+  auto const scale_factor = state.get_float64("scale_factor");
+  cuio_source_sink_pair lineitem(io_type::HOST_BUFFER);
+  auto const num_rows = write_lineitem(scale_factor, lineitem);
+
+  auto const mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto const result = pricing_summary(lineitem.make_source_info());
+  });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(num_rows) / time, "rows_per_second");
+  state.add_element_count(static_cast<double>(lineitem.size()) / time, "bytes_per_second");
+  add_memory_stats(state, mem_stats_logger);
+  state.add_buffer_size(lineitem.size(), "encoded_file_size", "encoded_file_size");
+}
+
+void BM_shipping_priority(nvbench::state& state)
+{
+  auto const scale_factor = state.get_float64("scale_factor");
+  cuio_source_sink_pair orders(io_type::HOST_BUFFER);
+  cuio_source_sink_pair lineitem(io_type::HOST_BUFFER);
+  auto const num_rows =
+    write_orders(scale_factor, orders) + write_lineitem(scale_factor, lineitem);
+  auto const input_size = orders.size() + lineitem.size();
+
+  auto const mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto const result = shipping_priority(orders.make_source_info(), lineitem.make_source_info());
+  });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(num_rows) / time, "rows_per_second");
+  state.add_element_count(static_cast<double>(input_size) / time, "bytes_per_second");
+  add_memory_stats(state, mem_stats_logger);
+  state.add_buffer_size(input_size, "encoded_file_size", "encoded_file_size");
+}
+
+NVBENCH_BENCH(BM_pricing_summary)
+  .set_name("pricing_summary")
+  .set_min_samples(4)
+  .add_float64_axis("scale_factor", {0.1, 0.5, 1});
+
+NVBENCH_BENCH(BM_shipping_priority)
+  .set_name("shipping_priority")
+  .set_min_samples(4)
+  .add_float64_axis("scale_factor", {0.1, 0.5, 1});
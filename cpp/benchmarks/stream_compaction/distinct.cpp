@@ -94,3 +94,37 @@ NVBENCH_BENCH_TYPES(nvbench_distinct_list,
   .set_type_axes_names({"Type"})
   .add_float64_axis("null_probability", {0.0, 0.1})
   .add_int64_axis("ColumnSize", {100'000'000});
+
+void nvbench_distinct_skew(nvbench::state& state)
+{
+  auto const num_rows     = static_cast<cudf::size_type>(state.get_int64("NumRows"));
+  auto const cardinality  = static_cast<cudf::size_type>(state.get_int64("cardinality"));
+  auto const zipf         = state.get_float64("zipf_exponent");
+  auto const heavy_hitter = state.get_float64("heavy_hitter_fraction");
+
+  data_profile const profile =
+    data_profile_builder()
+      .cardinality(cardinality)
+      .avg_run_length(1)
+      .zipf_exponent(zipf)
+      .heavy_hitter_fraction(heavy_hitter)
+      .no_validity()
+      .distribution(cudf::type_id::INT64, distribution_id::UNIFORM, 0, num_rows);
+  auto const table = create_random_table({cudf::type_id::INT64}, row_count{num_rows}, profile);
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto result = cudf::distinct(*table,
+                                 {0},
+                                 cudf::duplicate_keep_option::KEEP_ANY,
+                                 cudf::null_equality::EQUAL,
+                                 cudf::nan_equality::ALL_EQUAL);
+  });
+}
+
+NVBENCH_BENCH(nvbench_distinct_skew)
+  .set_name("distinct_skew")
+  .add_int64_axis("NumRows", {10'000'000})
+  .add_int64_axis("cardinality", {1'000, 1'000'000})
+  .add_float64_axis("zipf_exponent", {0, 0.5, 1, 1.5})
+  .add_float64_axis("heavy_hitter_fraction", {0, 0.5});
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -83,42 +83,45 @@ class aggregation {
    * @brief Possible aggregation operations
    */
   enum Kind {
-    SUM,             ///< sum reduction
-    PRODUCT,         ///< product reduction
-    MIN,             ///< min reduction
-    MAX,             ///< max reduction
-    COUNT_VALID,     ///< count number of valid elements
-    COUNT_ALL,       ///< count number of elements
-    ANY,             ///< any reduction
-    ALL,             ///< all reduction
-    SUM_OF_SQUARES,  ///< sum of squares reduction
-    MEAN,            ///< arithmetic mean reduction
-    M2,              ///< sum of squares of differences from the mean
-    VARIANCE,        ///< variance
-    STD,             ///< standard deviation
-    MEDIAN,          ///< median reduction
-    QUANTILE,        ///< compute specified quantile(s)
-    ARGMAX,          ///< Index of max element
-    ARGMIN,          ///< Index of min element
-    NUNIQUE,         ///< count number of unique elements
-    NTH_ELEMENT,     ///< get the nth element
-    ROW_NUMBER,      ///< get row-number of current index (relative to rolling window)
-    RANK,            ///< get rank of current index
-    COLLECT_LIST,    ///< collect values into a list
-    COLLECT_SET,     ///< collect values into a list without duplicate entries
-    LEAD,            ///< window function, accesses row at specified offset following current row
-    LAG,             ///< window function, accesses row at specified offset preceding current row
-    PTX,             ///< PTX  UDF based reduction
-    CUDA,            ///< CUDA UDF based reduction
-    MERGE_LISTS,     ///< merge multiple lists values into one list
-    MERGE_SETS,      ///< merge multiple lists values into one list then drop duplicate entries
-    MERGE_M2,        ///< merge partial values of M2 aggregation,
-    COVARIANCE,      ///< covariance between two sets of elements
-    CORRELATION,     ///< correlation between two sets of elements
-    TDIGEST,         ///< create a tdigest from a set of input values
-    MERGE_TDIGEST,   ///< create a tdigest by merging multiple tdigests together
-    HISTOGRAM,       ///< compute frequency of each element
-    MERGE_HISTOGRAM  ///< merge partial values of HISTOGRAM aggregation,
+    SUM,              ///< sum reduction
+    PRODUCT,          ///< product reduction
+    MIN,              ///< min reduction
+    MAX,              ///< max reduction
+    COUNT_VALID,      ///< count number of valid elements
+    COUNT_ALL,        ///< count number of elements
+    ANY,              ///< any reduction
+    ALL,              ///< all reduction
+    SUM_OF_SQUARES,   ///< sum of squares reduction
+    MEAN,             ///< arithmetic mean reduction
+    M2,               ///< sum of squares of differences from the mean
+    VARIANCE,         ///< variance
+    STD,              ///< standard deviation
+    MEDIAN,           ///< median reduction
+    QUANTILE,         ///< compute specified quantile(s)
+    ARGMAX,           ///< Index of max element
+    ARGMIN,           ///< Index of min element
+    NUNIQUE,          ///< count number of unique elements
+    NTH_ELEMENT,      ///< get the nth element
+    ROW_NUMBER,       ///< get row-number of current index (relative to rolling window)
+    RANK,             ///< get rank of current index
+    COLLECT_LIST,     ///< collect values into a list
+    COLLECT_SET,      ///< collect values into a list without duplicate entries
+    LEAD,             ///< window function, accesses row at specified offset following current row
+    LAG,              ///< window function, accesses row at specified offset preceding current row
+    PTX,              ///< PTX  UDF based reduction
+    CUDA,             ///< CUDA UDF based reduction
+    MERGE_LISTS,      ///< merge multiple lists values into one list
+    MERGE_SETS,       ///< merge multiple lists values into one list then drop duplicate entries
+    MERGE_M2,         ///< merge partial values of M2 aggregation,
+    COVARIANCE,       ///< covariance between two sets of elements
+    CORRELATION,      ///< correlation between two sets of elements
+    TDIGEST,          ///< create a tdigest from a set of input values
+    MERGE_TDIGEST,    ///< create a tdigest by merging multiple tdigests together
+    HISTOGRAM,        ///< compute frequency of each element
+    MERGE_HISTOGRAM,  ///< merge partial values of HISTOGRAM aggregation,
+    HLLPP,            ///< create a HyperLogLog++ sketch from a set of input values
+    MERGE_HLLPP,      ///< create a HyperLogLog++ sketch by merging multiple sketches together
+    TOP_K             ///< collect the k first values in sorted order into a list
   };
 
   aggregation() = delete;
@@ -551,13 +554,19 @@ std::unique_ptr<Base> make_lead_aggregation(size_type offset);
  * @param[in] type: either udf_type::PTX or udf_type::CUDA
  * @param[in] user_defined_aggregator A string containing the aggregator code
  * @param[in] output_type expected output type
+ * @param[in] is_associative Whether the aggregator is associative, i.e. aggregating its results
+ * over consecutive ranges of rows gives its result over the union of the ranges. This requires
+ * `output_type` to be the type of the aggregated column. The rolling windows of fixed size of an
+ * associative aggregator are computed from partial results, in constant time per row instead of
+ * aggregating every row of their window
  *
  * @return An aggregation containing a user-defined aggregator string
  */
 template <typename Base = aggregation>
 std::unique_ptr<Base> make_udf_aggregation(udf_type type,
                                            std::string const& user_defined_aggregator,
-                                           data_type output_type);
+                                           data_type output_type,
+                                           bool is_associative = false);
 
 /**
  * @brief Factory to create a MERGE_LISTS aggregation.
@@ -730,5 +739,66 @@ std::unique_ptr<Base> make_tdigest_aggregation(int max_centroids = 1000);
 template <typename Base>
 std::unique_ptr<Base> make_merge_tdigest_aggregation(int max_centroids = 1000);
 
+/**
+ * @brief Factory to create a HLLPP aggregation
+ *
+ * Produces a HyperLogLog++ sketch (https://research.google/pubs/pub40671/) of the input values,
+ * from which `cudf::estimate_distinct_count` approximates the number of their distinct values.
+ * Null values are ignored. The values are hashed with `cudf::hashing::xxhash_64`.
+ *
+ * Each output row is a single sketch of `2^precision` registers, packed 10 registers of 6 bits
+ * to an int64 field:
+ *
+ * struct {
+ *   int64    // registers 0 to 9
+ *   int64    // registers 10 to 19
+ *   ...
+ * }
+ *
+ * @param precision Number of bits of the hashes indexing the registers, in the range [4, 18].
+ * The relative standard error of the estimates is about `1.04 / sqrt(2^precision)`.
+ *
+ * @return A HLLPP aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_hllpp_aggregation(int precision = 9);
+
+/**
+ * @brief Factory to create a MERGE_HLLPP aggregation
+ *
+ * Merges the sketches produced by a previous `make_hllpp_aggregation` or
+ * `make_merge_hllpp_aggregation` into a sketch of all their values. Null sketches are ignored.
+ *
+ * @param precision The precision of the input sketches, in the range [4, 18]
+ *
+ * @return A MERGE_HLLPP aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_merge_hllpp_aggregation(int precision = 9);
+
+/**
+ * @brief Factory to create a TOP_K aggregation
+ *
+ * `TOP_K` collects the `k` largest, or with `order::ASCENDING` the `k` smallest, non-null values
+ * of each group into a list in sorted order. Groups with fewer than `k` non-null values get all
+ * of them. Unlike sorting all the values of each group, only the values that may be among the
+ * `k` first of their group are sorted.
+ *
+ * @code{.pseudo}
+ * keys   = {1, 2, 1, 1, 2, 1}
+ * values = {5, 3, 9, null, 4, 7}
+ * TOP_K(k = 2)                   = {{9, 7}, {4, 3}}
+ * TOP_K(k = 2, order::ASCENDING) = {{5, 7}, {3, 4}}
+ * @endcode
+ *
+ * @throw std::invalid_argument if `k` is negative
+ *
+ * @param k The number of values to collect from each group
+ * @param sort_order `DESCENDING` to collect the largest values, `ASCENDING` the smallest
+ * @return A TOP_K aggregation object
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_top_k_aggregation(size_type k, order sort_order = order::DESCENDING);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -75,6 +75,27 @@ struct expression_result {
     subclass().template set_value<Element>(index, result);
   }
 
+  /**
+   * @brief Sets the value of an output of an expression evaluating several outputs.
+   *
+   * Containers of a single output ignore `output_index`, which is then always zero.
+   *
+   * @param output_index Index of the output, given by the output data reference
+   * @param index Row index of the value
+   * @param result Value to set
+   */
+  template <typename Element>
+  __device__ inline void set_output_value(cudf::size_type output_index,
+                                          cudf::size_type index,
+                                          possibly_null_value_t<Element, has_nulls> const& result)
+  {
+    if constexpr (Subclass::has_multiple_outputs) {
+      subclass().template set_output_value<Element>(output_index, index, result);
+    } else {
+      subclass().template set_value<Element>(index, result);
+    }
+  }
+
   [[nodiscard]] __device__ inline bool is_valid() const { return subclass().is_valid(); }
 
   __device__ inline T value() const { return subclass().value(); }
@@ -130,6 +151,8 @@ struct value_expression_result
     if constexpr (!has_nulls) { return _obj; }
   }
 
+  static constexpr bool has_multiple_outputs = false;
+
   possibly_null_value_t<T, has_nulls>
     _obj;  ///< The underlying data value, or a nullable version of it.
 };
@@ -190,9 +213,78 @@ struct mutable_column_expression_result
     CUDF_UNREACHABLE("This method is not implemented.");
   }
 
+  static constexpr bool has_multiple_outputs = false;
+
   mutable_column_device_view& _obj;  ///< The column to which the data is written.
 };
 
+/**
+ * @brief A container for capturing the outputs of several evaluated expressions in columns.
+ *
+ * This subclass of `expression_result` is a non-owning container writing each output of an
+ * expression parsed from several expressions to its own column.
+ *
+ * @tparam has_nulls Whether or not the result data is nullable.
+ */
+template <bool has_nulls>
+struct mutable_table_expression_result
+  : public expression_result<mutable_table_expression_result<has_nulls>,
+                             mutable_column_device_view,
+                             has_nulls> {
+  __device__ inline mutable_table_expression_result(mutable_column_device_view* columns)
+    : _columns(columns)
+  {
+  }
+
+  template <typename Element>
+  __device__ inline void set_output_value(cudf::size_type output_index,
+                                          cudf::size_type index,
+                                          possibly_null_value_t<Element, has_nulls> const& result)
+  {
+    auto& column = _columns[output_index];
+    if constexpr (has_nulls) {
+      if (result.has_value()) {
+        column.template element<Element>(index) = *result;
+        column.set_valid(index);
+      } else {
+        column.set_null(index);
+      }
+    } else {
+      column.template element<Element>(index) = result;
+    }
+  }
+
+  /**
+   * @brief Not implemented for this specialization.
+   */
+  template <typename Element>
+  __device__ inline void set_value(cudf::size_type index,
+                                   possibly_null_value_t<Element, has_nulls> const& result)
+  {
+    CUDF_UNREACHABLE("This method is not implemented.");
+  }
+
+  /**
+   * @brief Not implemented for this specialization.
+   */
+  [[nodiscard]] __device__ inline bool is_valid() const
+  {
+    CUDF_UNREACHABLE("This method is not implemented.");
+  }
+
+  /**
+   * @brief Not implemented for this specialization.
+   */
+  [[nodiscard]] __device__ inline mutable_column_device_view value() const
+  {
+    CUDF_UNREACHABLE("This method is not implemented.");
+  }
+
+  static constexpr bool has_multiple_outputs = true;
+
+  mutable_column_device_view* _columns;  ///< The columns to which the data is written.
+};
+
 /**
  * @brief Dispatch to a binary operator based on a single data type.
  *
@@ -452,6 +544,21 @@ struct expression_evaluator {
     cudf::size_type operator_source_index{0};
     for (cudf::size_type operator_index = 0; operator_index < plan.operators.size();
          ++operator_index) {
+      // Skip the right operand of a logical operator whose result is known from its left operand
+      if (!plan.short_circuits.empty()) {
+        auto const& jump = plan.short_circuits[operator_index];
+        if (jump.operator_index != 0 &&
+            short_circuit_logical_operator(output_object,
+                                           left_row_index,
+                                           right_row_index,
+                                           output_row_index,
+                                           jump,
+                                           thread_intermediate_storage)) {
+          operator_index        = jump.operator_index;
+          operator_source_index = jump.source_index_end;
+          continue;
+        }
+      }
       // Execute operator
       auto const op    = plan.operators[operator_index];
       auto const arity = ast_operator_arity(op);
@@ -499,6 +606,52 @@ struct expression_evaluator {
   }
 
  private:
+  /**
+   * @brief Writes the result of a logical operator if its boolean left operand determines it.
+   *
+   * Without nulls, false for an AND and true for an OR determine the result. With nulls, a null
+   * operand determines the result of LOGICAL_AND and LOGICAL_OR, while NULL_LOGICAL_AND and
+   * NULL_LOGICAL_OR follow Kleene logic and are determined by a valid false and a valid true.
+   *
+   * @return Whether the result was written and the right operand can be skipped
+   */
+  template <typename ResultSubclass, typename T, bool result_has_nulls>
+  __device__ __forceinline__ bool short_circuit_logical_operator(
+    expression_result<ResultSubclass, T, result_has_nulls>& output_object,
+    cudf::size_type const left_row_index,
+    cudf::size_type const right_row_index,
+    cudf::size_type const output_row_index,
+    detail::short_circuit const& jump,
+    IntermediateDataType<has_nulls>* thread_intermediate_storage) const
+  {
+    using ReturnType  = possibly_null_value_t<bool, has_nulls>;
+    auto const op     = plan.operators[jump.operator_index];
+    auto const is_and = op == ast_operator::LOGICAL_AND || op == ast_operator::NULL_LOGICAL_AND;
+    // The operands and the output of the logical operator end its source indices
+    auto const& lhs =
+      plan.data_references[plan.operator_source_indices[jump.source_index_end - 3]];
+    auto const value =
+      resolve_input<bool>(lhs, thread_intermediate_storage, left_row_index, right_row_index);
+
+    auto result = ReturnType{};
+    if constexpr (has_nulls) {
+      if (op == ast_operator::LOGICAL_AND || op == ast_operator::LOGICAL_OR) {
+        if (value.has_value()) { return false; }
+      } else {
+        if (!value.has_value() || *value == is_and) { return false; }
+        result = ReturnType{!is_and};
+      }
+    } else {
+      if (value == is_and) { return false; }
+      result = !is_and;
+    }
+    auto const& output =
+      plan.data_references[plan.operator_source_indices[jump.source_index_end - 1]];
+    expression_output_handler{}.template resolve_output<bool>(
+      output_object, output, output_row_index, thread_intermediate_storage, result);
+    return true;
+  }
+
   /**
    * @brief Helper struct for type dispatch on the result of an expression.
    *
@@ -539,7 +692,8 @@ struct expression_evaluator {
       possibly_null_value_t<Element, has_nulls> const& result) const
     {
       if (device_data_reference.reference_type == detail::device_data_reference_type::COLUMN) {
-        output_object.template set_value<Element>(row_index, result);
+        output_object.template set_output_value<Element>(
+          device_data_reference.data_index, row_index, result);
       } else {  // Assumes device_data_reference.reference_type ==
                 // detail::device_data_reference_type::INTERMEDIATE
         // Using memcpy instead of reinterpret_cast<Element*> for safe type aliasing.
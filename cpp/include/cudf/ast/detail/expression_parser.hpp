@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -24,8 +25,13 @@
 #include <thrust/scan.h>
 
 #include <functional>
+#include <map>
+#include <memory>
 #include <numeric>
 #include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace ast {
@@ -76,6 +82,20 @@ struct alignas(8) device_data_reference {
 template <bool has_nulls>
 using IntermediateDataType = possibly_null_value_t<std::int64_t, has_nulls>;
 
+/**
+ * @brief The operators of a plan skipped when the left operand of a logical operator determines
+ * its result.
+ *
+ * The operators evaluating the right operand of a logical operator are linearized right before
+ * it. When their results are only read by the logical operator, the evaluator checks the left
+ * operand before the first of them, and jumps past the logical operator if the right operand
+ * cannot change the result.
+ */
+struct short_circuit {
+  cudf::size_type operator_index;    ///< Index of the logical operator, or 0 if there is none
+  cudf::size_type source_index_end;  ///< Source index position of the next operator
+};
+
 /**
  * @brief A container of all device data required to evaluate an expression on tables.
  *
@@ -89,6 +109,7 @@ struct expression_device_view {
   device_span<generic_scalar_device_view const> literals;
   device_span<ast_operator const> operators;
   device_span<cudf::size_type const> operator_source_indices;
+  device_span<short_circuit const> short_circuits;  ///< Per operator, or empty if there are none
   cudf::size_type num_intermediates;
 };
 
@@ -103,6 +124,10 @@ struct expression_device_view {
  * the expressions and constructing vectors of information that are later used by the device for
  * evaluating the abstract syntax tree as a "linear" list of operators whose input dependencies are
  * resolved into intermediate data storage in shared memory.
+ *
+ * Identical subexpressions are linearized once and their result is shared by all their uses, and
+ * subexpressions of only literals are evaluated once while parsing and replaced by their value, so
+ * the device evaluates each distinct value of a row once.
  */
 class expression_parser {
  public:
@@ -123,9 +148,12 @@ class expression_parser {
       _right{right},
       _expression_count{0},
       _intermediate_counter{},
-      _has_nulls(has_nulls)
+      _has_nulls(has_nulls),
+      _stream{stream},
+      _mr{mr}
   {
     expr.accept(*this);
+    allocate_intermediates();
     move_to_device(stream, mr);
   }
 
@@ -144,6 +172,39 @@ class expression_parser {
   {
   }
 
+  /**
+   * @brief Construct a new expression_parser object evaluating several expressions at once
+   *
+   * The expressions are linearized into a single plan, in which the root of the expression at
+   * index `i` writes to the output column of data index `i`. Subexpressions shared by several
+   * expressions are evaluated once.
+   *
+   * @param exprs The expressions to create an evaluable expression_parser for.
+   * @param table The table used for evaluating the abstract syntax trees.
+   */
+  expression_parser(std::vector<std::reference_wrapper<expression const>> const& exprs,
+                    cudf::table_view const& table,
+                    bool has_nulls,
+                    rmm::cuda_stream_view stream,
+                    rmm::mr::device_memory_resource* mr)
+    : _left{table},
+      _right{},
+      _expression_count{0},
+      _intermediate_counter{},
+      _has_nulls(has_nulls),
+      _stream{stream},
+      _mr{mr}
+  {
+    for (auto const& expr : exprs) {
+      _expression_count = 0;
+      _fold_constants   = true;
+      expr.get().accept(*this);
+      ++_output_index;
+    }
+    allocate_intermediates();
+    move_to_device(stream, mr);
+  }
+
   /**
    * @brief Get the root data type of the abstract syntax tree.
    *
@@ -151,6 +212,53 @@ class expression_parser {
    */
   [[nodiscard]] cudf::data_type output_type() const;
 
+  /**
+   * @brief Get the data types of the roots of the parsed expressions.
+   *
+   * @return The data type of each output, in the order of the expressions
+   */
+  [[nodiscard]] std::vector<cudf::data_type> const& output_types() const
+  {
+    return _output_types;
+  }
+
+  /**
+   * @brief Get the data references of the linearized expression.
+   *
+   * @return The data references indexed by `operator_source_indices()`
+   */
+  [[nodiscard]] std::vector<detail::device_data_reference> const& data_references() const
+  {
+    return _data_references;
+  }
+
+  /**
+   * @brief Get the operators of the linearized expression in evaluation order.
+   *
+   * @return The operators
+   */
+  [[nodiscard]] std::vector<ast_operator> const& operators() const { return _operators; }
+
+  /**
+   * @brief Get the data reference indices of the operands and output of each operator.
+   *
+   * @return The operand indices of each operator followed by the index of its output
+   */
+  [[nodiscard]] std::vector<cudf::size_type> const& operator_source_indices() const
+  {
+    return _operator_source_indices;
+  }
+
+  /**
+   * @brief Get the literals referenced by the linearized expression.
+   *
+   * @return The literals indexed by the literal data references
+   */
+  [[nodiscard]] std::vector<generic_scalar_device_view> const& literals() const
+  {
+    return _literals;
+  }
+
   /**
    * @brief Visit a literal expression.
    *
@@ -249,6 +357,7 @@ class expression_parser {
     extract_size_and_pointer(_literals, sizes, data_pointers);
     extract_size_and_pointer(_operators, sizes, data_pointers);
     extract_size_and_pointer(_operator_source_indices, sizes, data_pointers);
+    extract_size_and_pointer(_short_circuits, sizes, data_pointers);
 
     // Create device buffer
     auto const buffer_size = std::accumulate(sizes.cbegin(), sizes.cend(), 0);
@@ -280,6 +389,9 @@ class expression_parser {
     device_expression_data.operator_source_indices = device_span<cudf::size_type const>(
       reinterpret_cast<cudf::size_type const*>(device_data_buffer_ptr + buffer_offsets[3]),
       _operator_source_indices.size());
+    device_expression_data.short_circuits = device_span<short_circuit const>(
+      reinterpret_cast<short_circuit const*>(device_data_buffer_ptr + buffer_offsets[4]),
+      _short_circuits.size());
     device_expression_data.num_intermediates = _intermediate_counter.get_max_used();
     shmem_per_thread                         = static_cast<int>(
       (_has_nulls ? sizeof(IntermediateDataType<true>) : sizeof(IntermediateDataType<false>)) *
@@ -296,11 +408,14 @@ class expression_parser {
    * descend deeper into an expression tree).
    *
    * @param  operands  The operands to visit.
+   * @param  last_operand_begin  Set to the index of the first operator linearized for the last
+   * operand.
    *
    * @return The indices of the operands stored in the data references.
    */
   std::vector<cudf::size_type> visit_operands(
-    std::vector<std::reference_wrapper<expression const>> operands);
+    std::vector<std::reference_wrapper<expression const>> operands,
+    cudf::size_type& last_operand_begin);
 
   /**
    * @brief Add a data reference to the internal list.
@@ -311,6 +426,40 @@ class expression_parser {
    */
   cudf::size_type add_data_reference(detail::device_data_reference data_ref);
 
+  /**
+   * @brief Add the data reference of a literal, shared by all the uses of its scalar.
+   *
+   * @param  expr  The literal to add.
+   *
+   * @return The index of the data reference of the literal.
+   */
+  cudf::size_type add_literal(literal const& expr);
+
+  /**
+   * @brief Evaluate an operation of only literals and add its value as a literal.
+   *
+   * @param  expr  The operation to evaluate.
+   *
+   * @return The index of the data reference of the value.
+   */
+  cudf::size_type fold_constant(operation const& expr);
+
+  /**
+   * @brief Assign the intermediate storage locations of the linearized expression.
+   *
+   * Each intermediate value is first given its own location so it can be shared by several
+   * operators. The locations are then reassigned so that a location is reused once the last
+   * operator reading its value has run.
+   */
+  void allocate_intermediates();
+
+  /**
+   * @brief Find the logical operators whose right operand may be skipped by the evaluator.
+   *
+   * @param  last_uses  Index of the last operator reading each data reference
+   */
+  void find_short_circuits(std::vector<cudf::size_type> const& last_uses);
+
   rmm::device_buffer
     _device_data_buffer;  ///< The device-side data buffer containing the plan information, which is
                           ///< owned by this class and persists until it is destroyed.
@@ -324,6 +473,19 @@ class expression_parser {
   std::vector<ast_operator> _operators;
   std::vector<cudf::size_type> _operator_source_indices;
   std::vector<generic_scalar_device_view> _literals;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+  bool _fold_constants{true};                  ///< Whether literal-only operations are folded
+  cudf::size_type _output_index{0};            ///< Output written by the root being parsed
+  std::vector<cudf::data_type> _output_types;  ///< Data type of each output
+  std::map<std::vector<cudf::size_type>, cudf::size_type>
+    _subexpressions;  ///< Data reference index of each operator and operands already linearized
+  std::unordered_map<cudf::scalar const*, cudf::size_type>
+    _literal_references;  ///< Data reference index of each scalar already referenced
+  std::vector<std::unique_ptr<cudf::scalar>> _folded_literals;  ///< Values of folded operations
+  std::vector<std::pair<cudf::size_type, cudf::size_type>>
+    _logical_operators;  ///< First operator of the right operand and index of each logical operator
+  std::vector<short_circuit> _short_circuits;  ///< Jump taken before each operator, if any
 };
 
 }  // namespace detail
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -221,6 +222,12 @@ CUDF_HOST_DEVICE inline constexpr void ast_operator_dispatcher(ast_operator op,
     case ast_operator::CAST_TO_FLOAT64:
       f.template operator()<ast_operator::CAST_TO_FLOAT64>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::STARTS_WITH:
+      f.template operator()<ast_operator::STARTS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::ENDS_WITH:
+      f.template operator()<ast_operator::ENDS_WITH>(std::forward<Ts>(args)...);
+      break;
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Invalid operator.");
@@ -833,6 +840,48 @@ struct operator_functor<ast_operator::CAST_TO_UINT64, false> : cast<uint64_t> {}
 template <>
 struct operator_functor<ast_operator::CAST_TO_FLOAT64, false> : cast<double> {};
 
+/**
+ * @brief Returns whether the bytes of `rhs` appear in `lhs` from byte `offset` of `lhs`.
+ */
+CUDF_HOST_DEVICE inline bool matches_at(cudf::string_view lhs,
+                                        cudf::string_view rhs,
+                                        size_type offset)
+{
+  if (offset < 0 || offset + rhs.size_bytes() > lhs.size_bytes()) { return false; }
+  for (size_type idx = 0; idx < rhs.size_bytes(); ++idx) {
+    if (lhs.data()[offset + idx] != rhs.data()[idx]) { return false; }
+  }
+  return true;
+}
+
+template <>
+struct operator_functor<ast_operator::STARTS_WITH, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS,
+            typename RHS,
+            std::enable_if_t<std::is_same_v<LHS, cudf::string_view> and
+                             std::is_same_v<RHS, cudf::string_view>>* = nullptr>
+  __device__ inline bool operator()(LHS lhs, RHS rhs)
+  {
+    return matches_at(lhs, rhs, 0);
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::ENDS_WITH, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS,
+            typename RHS,
+            std::enable_if_t<std::is_same_v<LHS, cudf::string_view> and
+                             std::is_same_v<RHS, cudf::string_view>>* = nullptr>
+  __device__ inline bool operator()(LHS lhs, RHS rhs)
+  {
+    return matches_at(lhs, rhs, lhs.size_bytes() - rhs.size_bytes());
+  }
+};
+
 /*
  * The default specialization of nullable operators is to fall back to the non-nullable
  * implementation
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -152,7 +152,10 @@ enum class ast_operator : int32_t {
   NOT,             ///< Logical Not (!)
   CAST_TO_INT64,   ///< Cast value to int64_t
   CAST_TO_UINT64,  ///< Cast value to uint64_t
-  CAST_TO_FLOAT64  ///< Cast value to double
+  CAST_TO_FLOAT64,  ///< Cast value to double
+  // Binary string operators
+  STARTS_WITH,  ///< Whether the lhs string begins with the rhs string
+  ENDS_WITH     ///< Whether the lhs string ends with the rhs string
 };
 
 /**
@@ -186,6 +189,13 @@ class generic_scalar_device_view : public cudf::detail::scalar_device_view_base
     return *static_cast<T const*>(_data);
   }
 
+  /**
+   * @brief Returns a raw pointer to the stored value in device memory.
+   *
+   * @returns Raw pointer to the stored value in device memory
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE void const* data() const noexcept { return _data; }
+
   /** @brief Construct a new generic scalar device view object from a numeric scalar
    *
    * @param s The numeric scalar to construct from
@@ -315,6 +325,13 @@ class literal : public expression {
    */
   [[nodiscard]] generic_scalar_device_view get_value() const { return value; }
 
+  /**
+   * @brief Get the underlying scalar.
+   *
+   * @return The scalar object
+   */
+  [[nodiscard]] cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @copydoc expression::accept
    */
@@ -16,9 +16,17 @@
 
 #pragma once
 
+#include <cudf/io/types.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -268,6 +276,116 @@ class chunked_pack {
   std::unique_ptr<detail::contiguous_split_state> state;
 };
 
+/**
+ * @brief Reassembles in device memory a table packed chunk by chunk, e.g. by `chunked_pack`.
+ *
+ * This is the inverse of `chunked_pack`: the packed data is handed over in chunks, from host or
+ * device memory, and copied asynchronously into a single device buffer of
+ * `total_contiguous_size` bytes. Once all the chunks have been copied, `finish` returns the
+ * `packed_columns`, which can be viewed with `cudf::unpack`.
+ *
+ * Since the chunks are copied asynchronously on `stream`, a chunk must stay alive and
+ * unmodified until the work of `stream` up to its `next` call has completed. Chunks in pageable
+ * host memory are copied synchronously by the CUDA runtime, so pinned host memory should be used
+ * to overlap the copies with other work.
+ *
+ * The following code reassembles a table from pinned host chunks, where
+ * `pinned_chunks` are the chunks of bytes produced by a `chunked_pack`:
+ * @code{.pseudo}
+ * auto unpacker = cudf::chunked_unpack::create(std::move(metadata), total_size, stream);
+ * for (auto const& chunk : pinned_chunks) {
+ *   unpacker->next(cudf::host_span<uint8_t const>(chunk.data(), chunk.size()));
+ * }
+ * auto packed = unpacker->finish();
+ * auto table  = cudf::unpack(packed);
+ * @endcode
+ */
+class chunked_unpack {
+ public:
+  /**
+   * @brief Construct a `chunked_unpack` class.
+   *
+   * @param metadata The metadata of the packed table, e.g. from `chunked_pack::build_metadata`
+   * @param total_contiguous_size Total size in bytes of the packed data, e.g. from
+   *                              `chunked_pack::get_total_contiguous_size`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the packed data
+   */
+  chunked_unpack(std::unique_ptr<std::vector<uint8_t>> metadata,
+                 std::size_t total_contiguous_size,
+                 rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+                 rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Obtain the total size of the contiguously packed table.
+   *
+   * @return total size (in bytes) of all the chunks
+   */
+  [[nodiscard]] std::size_t get_total_contiguous_size() const;
+
+  /**
+   * @brief Function to check if there are chunks left to be copied.
+   *
+   * @return true if fewer than `total_contiguous_size` bytes have been copied, and false
+   * otherwise
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Copies the next chunk of packed data from device memory.
+   *
+   * @throws cudf::logic_error If the chunk does not fit in the bytes left to be copied
+   *
+   * @param chunk device span of the next bytes of the packed data
+   */
+  void next(cudf::device_span<uint8_t const> chunk);
+
+  /**
+   * @brief Copies the next chunk of packed data from host memory.
+   *
+   * @throws cudf::logic_error If the chunk does not fit in the bytes left to be copied
+   *
+   * @param chunk host span of the next bytes of the packed data
+   */
+  void next(cudf::host_span<uint8_t const> chunk);
+
+  /**
+   * @brief Returns the reassembled packed table.
+   *
+   * @throws cudf::logic_error If not all the chunks have been copied
+   *
+   * @return The packed table in device memory
+   */
+  [[nodiscard]] packed_columns finish();
+
+  /**
+   * @brief Creates a `chunked_unpack` instance to reassemble a table packed by `chunked_pack`.
+   *
+   * @param metadata The metadata of the packed table, e.g. from `chunked_pack::build_metadata`
+   * @param total_contiguous_size Total size in bytes of the packed data, e.g. from
+   *                              `chunked_pack::get_total_contiguous_size`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the packed data
+   * @return a unique_ptr of chunked_unpack
+   */
+  [[nodiscard]] static std::unique_ptr<chunked_unpack> create(
+    std::unique_ptr<std::vector<uint8_t>> metadata,
+    std::size_t total_contiguous_size,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  /**
+   * @brief Copies `size` bytes from `src` at the current offset of the packed data.
+   */
+  void copy_next(void const* src, std::size_t size);
+
+  std::unique_ptr<std::vector<uint8_t>> _metadata;  ///< Metadata of the packed table
+  std::unique_ptr<rmm::device_buffer> _data;        ///< Packed data of the table
+  std::size_t _offset{0};                           ///< Number of bytes copied so far
+  rmm::cuda_stream_view _stream;                    ///< Stream of the copies
+};
+
 /**
  * @brief Deep-copy a `table_view` into a serialized contiguous memory format.
  *
@@ -335,5 +453,93 @@ table_view unpack(packed_columns const& input);
  */
 table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
+/**
+ * @brief Packed table data compressed in blocks, in a serialized format
+ *
+ * Like `packed_columns`, made of a host buffer and a device buffer. The host buffer holds the
+ * metadata of the packed table along with the layout of the compressed blocks; the device buffer
+ * holds the blocks. Both buffers are needed by `decompress_packed`.
+ */
+struct compressed_packed_columns {
+  compressed_packed_columns()
+    : metadata(std::make_unique<std::vector<uint8_t>>()),
+      gpu_data(std::make_unique<rmm::device_buffer>())
+  {
+  }
+
+  /**
+   * @brief Construct a new compressed packed columns object
+   *
+   * @param md Host-side metadata buffer
+   * @param gd Device-side compressed data buffer
+   */
+  compressed_packed_columns(std::unique_ptr<std::vector<uint8_t>>&& md,
+                            std::unique_ptr<rmm::device_buffer>&& gd)
+    : metadata(std::move(md)), gpu_data(std::move(gd))
+  {
+  }
+
+  std::unique_ptr<std::vector<uint8_t>> metadata;  ///< Host-side metadata buffer
+  std::unique_ptr<rmm::device_buffer> gpu_data;    ///< Device-side compressed data buffer
+};
+
+/**
+ * @brief Performs a `contiguous_split` of a table and compresses the data of every partition.
+ *
+ * The data of each partition is compressed in fixed-size blocks, and the blocks of all the
+ * partitions are compressed in a single batch. Blocks that do not shrink are stored
+ * uncompressed. Pass each output to `decompress_packed` and then `cudf::unpack` to deserialize
+ * it.
+ *
+ * @throws std::invalid_argument If `compression` is not one of `NONE`, `SNAPPY`, `LZ4` or `ZSTD`
+ * @throws cudf::logic_error If the compression is disabled in nvCOMP
+ * @throws std::out_of_range If `splits` has end index > size of `input`
+ * @throws std::invalid_argument When the values in the `splits` are 'strictly decreasing'
+ *
+ * @param input View of a table to split
+ * @param splits A vector of indices where the view will be split
+ * @param compression Codec compressing the partitions
+ * @param mr An optional memory resource to use for all returned device allocations
+ * @return The compressed packed partitions of `input`
+ */
+std::vector<compressed_packed_columns> contiguous_split_compressed(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  io::compression_type compression,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compresses the result of `cudf::pack` in blocks.
+ *
+ * @throws std::invalid_argument If `compression` is not one of `NONE`, `SNAPPY`, `LZ4` or `ZSTD`
+ * @throws cudf::logic_error If the compression is disabled in nvCOMP
+ *
+ * @param input The packed columns to compress
+ * @param compression Codec compressing the data
+ * @param mr An optional memory resource to use for all returned device allocations
+ * @return The compressed packed columns
+ */
+compressed_packed_columns compress_packed(
+  packed_columns const& input,
+  io::compression_type compression,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Decompresses the result of `compress_packed` or `contiguous_split_compressed`.
+ *
+ * The result can be deserialized with `cudf::unpack`.
+ *
+ * @throws cudf::logic_error If the metadata of `input` is malformed or a block fails to
+ * decompress
+ * @throws cudf::logic_error If the decompression is disabled in nvCOMP
+ *
+ * @param input The compressed packed columns
+ * @param mr An optional memory resource to use for all returned device allocations
+ * @return The packed columns
+ */
+packed_columns decompress_packed(
+  compressed_packed_columns const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
@@ -967,5 +967,27 @@ std::unique_ptr<column> purge_nonempty_nulls(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Purges any non-empty null rows in a column or its descendants, without copying the column
+ * if there are none.
+ *
+ * Unlike `purge_nonempty_nulls(column_view const&, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)`, `input` itself is returned if it has no non-empty nulls, so
+ * that purging defensively costs only the check of the levels of `input` that have nulls.
+ * Otherwise, a purged copy is returned and `input` is released.
+ *
+ * @throw std::invalid_argument if `input` is null
+ *
+ * @param input The column whose null rows are to be checked and purged
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return `input` if it has no non-empty nulls, or a new column with equivalent contents to
+ * `input` but with null rows purged
+ */
+std::unique_ptr<column> purge_nonempty_nulls(
+  std::unique_ptr<column> input,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
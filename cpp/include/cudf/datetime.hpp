@@ -17,10 +17,12 @@
 #pragma once
 
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -184,6 +186,42 @@ std::unique_ptr<cudf::column> extract_nanosecond_fraction(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Components of a datetime that can be extracted with `extract_datetime_components`.
+ */
+enum class datetime_component : uint8_t {
+  YEAR,         ///< Year
+  MONTH,        ///< Month of the year, from 1 to 12
+  DAY,          ///< Day of the month, from 1 to 31
+  WEEKDAY,      ///< ISO day of the week, from 1 (Monday) to 7 (Sunday)
+  HOUR,         ///< Hour of the day
+  MINUTE,       ///< Minute of the hour
+  SECOND,       ///< Second of the minute
+  MILLISECOND,  ///< Millisecond fraction of the second
+  MICROSECOND,  ///< Microsecond fraction of the millisecond
+  NANOSECOND    ///< Nanosecond fraction of the microsecond
+};
+
+/**
+ * @brief  Extracts several components from any datetime type and returns an int16_t
+ * cudf::column for each of them.
+ *
+ * The timestamps are read once and the calendar date of each is computed once, regardless of the
+ * number of requested components. Each output column holds the same values as the column returned
+ * by the corresponding `extract_*` function.
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param components The components to extract
+ * @param mr Device memory resource used to allocate device memory of the returned columns
+ *
+ * @returns cudf::column of the extracted int16_t values for each of `components`, in order
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::vector<std::unique_ptr<cudf::column>> extract_datetime_components(
+  cudf::column_view const& column,
+  host_span<datetime_component const> components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
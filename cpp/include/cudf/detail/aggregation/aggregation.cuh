@@ -96,6 +96,10 @@ struct corresponding_operator<aggregation::MEAN> {
   using type = DeviceSum;
 };
 template <>
+struct corresponding_operator<aggregation::M2> {
+  using type = DeviceSum;
+};
+template <>
 struct corresponding_operator<aggregation::COUNT_VALID> {
   using type = DeviceCount;
 };
@@ -275,6 +279,31 @@ struct update_target_element<
   }
 };
 
+/**
+ * @brief SUM of decimal128 values, with the 128-bit `atomic_add` built from two 64-bit atomics
+ */
+template <typename Source, bool target_has_nulls, bool source_has_nulls>
+struct update_target_element<
+  Source,
+  aggregation::SUM,
+  target_has_nulls,
+  source_has_nulls,
+  std::enable_if_t<is_fixed_point<Source>() &&
+                   std::is_same_v<device_storage_type_t<Source>, __int128_t>>> {
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             column_device_view source,
+                             size_type source_index) const noexcept
+  {
+    if (source_has_nulls and source.is_null(source_index)) { return; }
+
+    cudf::detail::atomic_add(&target.element<__int128_t>(target_index),
+                             source.element<__int128_t>(source_index));
+
+    if (target_has_nulls and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+};
+
 /**
  * @brief Function object to update a single element in a target column using
  * the dictionary key addressed by the specific index.
@@ -601,7 +630,7 @@ struct identity_initializer {
             k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL or
             k == aggregation::ARGMAX or k == aggregation::ARGMIN or
             k == aggregation::SUM_OF_SQUARES or k == aggregation::STD or
-            k == aggregation::VARIANCE or
+            k == aggregation::VARIANCE or k == aggregation::M2 or
             (k == aggregation::PRODUCT and is_product_supported<T>()));
   }
 
@@ -101,6 +101,12 @@ class simple_aggregations_collector {  // Declares the interface for the simple
                                                           class tdigest_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(
     data_type col_type, class merge_tdigest_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class hllpp_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class merge_hllpp_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class top_k_aggregation const& agg);
 };
 
 class aggregation_finalizer {  // Declares the interface for the finalizer
@@ -140,6 +146,9 @@ class aggregation_finalizer {  // Declares the interface for the finalizer
   virtual void visit(class correlation_aggregation const& agg);
   virtual void visit(class tdigest_aggregation const& agg);
   virtual void visit(class merge_tdigest_aggregation const& agg);
+  virtual void visit(class hllpp_aggregation const& agg);
+  virtual void visit(class merge_hllpp_aggregation const& agg);
+  virtual void visit(class top_k_aggregation const& agg);
 };
 
 /**
@@ -867,12 +876,14 @@ class udf_aggregation final : public rolling_aggregation {
  public:
   udf_aggregation(aggregation::Kind type,
                   std::string const& user_defined_aggregator,
-                  data_type output_type)
+                  data_type output_type,
+                  bool is_associative = false)
     : aggregation{type},
       _source{user_defined_aggregator},
       _operator_name{(type == aggregation::PTX) ? "rolling_udf_ptx" : "rolling_udf_cuda"},
       _function_name{"rolling_udf"},
-      _output_type{output_type}
+      _output_type{output_type},
+      _is_associative{is_associative}
   {
     CUDF_EXPECTS(type == aggregation::PTX or type == aggregation::CUDA,
                  "udf_aggregation can accept only PTX, CUDA");
@@ -883,7 +894,8 @@ class udf_aggregation final : public rolling_aggregation {
     if (!this->aggregation::is_equal(_other)) { return false; }
     auto const& other = dynamic_cast<udf_aggregation const&>(_other);
     return (_source == other._source and _operator_name == other._operator_name and
-            _function_name == other._function_name and _output_type == other._output_type);
+            _function_name == other._function_name and _output_type == other._output_type and
+            _is_associative == other._is_associative);
   }
 
   [[nodiscard]] size_t do_hash() const override
@@ -906,13 +918,15 @@ class udf_aggregation final : public rolling_aggregation {
   std::string const _operator_name;
   std::string const _function_name;
   data_type _output_type;
+  bool _is_associative;
 
  protected:
   [[nodiscard]] size_t hash_impl() const
   {
     return std::hash<std::string>{}(_source) ^ std::hash<std::string>{}(_operator_name) ^
            std::hash<std::string>{}(_function_name) ^
-           std::hash<int>{}(static_cast<int32_t>(_output_type.id()));
+           std::hash<int>{}(static_cast<int32_t>(_output_type.id())) ^
+           std::hash<bool>{}(_is_associative);
   }
 };
 
@@ -1142,6 +1156,118 @@ class merge_tdigest_aggregation final : public groupby_aggregation, public reduc
   void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
 };
 
+/**
+ * @brief Derived aggregation class for specifying HLLPP aggregation
+ */
+class hllpp_aggregation final : public groupby_aggregation, public reduce_aggregation {
+ public:
+  explicit hllpp_aggregation(int precision_) : aggregation{HLLPP}, precision{precision_} {}
+
+  int const precision;  ///< Number of bits of the hashes indexing the registers
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<hllpp_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<hllpp_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying MERGE_HLLPP aggregation
+ */
+class merge_hllpp_aggregation final : public groupby_aggregation, public reduce_aggregation {
+ public:
+  explicit merge_hllpp_aggregation(int precision_)
+    : aggregation{MERGE_HLLPP}, precision{precision_}
+  {
+  }
+
+  int const precision;  ///< Number of bits of the hashes indexing the registers
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<merge_hllpp_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<merge_hllpp_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying TOP_K aggregation
+ */
+class top_k_aggregation final : public groupby_aggregation {
+ public:
+  top_k_aggregation(size_type k, order sort_order)
+    : aggregation{TOP_K}, _k{k}, _sort_order{sort_order}
+  {
+  }
+
+  size_type _k;       ///< number of values to collect from each group
+  order _sort_order;  ///< whether to collect the largest or the smallest values
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<top_k_aggregation const&>(_other);
+    return _k == other._k and _sort_order == other._sort_order;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ hash_impl();
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<top_k_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+
+ private:
+  size_t hash_impl() const
+  {
+    return std::hash<size_type>{}(_k) ^ std::hash<int>{}(static_cast<int>(_sort_order));
+  }
+};
+
 /**
  * @brief Sentinel value used for `ARGMAX` aggregation.
  *
@@ -1413,6 +1539,26 @@ struct target_type_impl<Source,
   using type = struct_view;
 };
 
+// Always use struct for HLLPP, the values of any type are hashed
+template <typename Source>
+struct target_type_impl<Source, aggregation::HLLPP> {
+  using type = struct_view;
+};
+
+// MERGE_HLLPP. The sketches are struct columns of int64 fields.
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_HLLPP,
+                        std::enable_if_t<std::is_same_v<Source, cudf::struct_view>>> {
+  using type = struct_view;
+};
+
+// Always use list for TOP_K
+template <typename Source>
+struct target_type_impl<Source, aggregation::TOP_K> {
+  using type = list_view;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -1529,6 +1675,12 @@ CUDF_HOST_DEVICE inline decltype(auto) aggregation_dispatcher(aggregation::Kind
       return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
     case aggregation::MERGE_TDIGEST:
       return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::HLLPP:
+      return f.template operator()<aggregation::HLLPP>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_HLLPP:
+      return f.template operator()<aggregation::MERGE_HLLPP>(std::forward<Ts>(args)...);
+    case aggregation::TOP_K:
+      return f.template operator()<aggregation::TOP_K>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
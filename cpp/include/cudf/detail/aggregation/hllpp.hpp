@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Create a HyperLogLog++ sketch of the values of each group.
+ *
+ * The sketches are struct columns of `ceil(2^precision / 10)` int64 fields, each of which packs
+ * 10 registers of 6 bits. Null values are ignored.
+ *
+ * @param values The grouped values
+ * @param group_labels The group index of each value
+ * @param num_groups The number of groups
+ * @param precision Number of bits of the hashes indexing the registers
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return One sketch per group
+ */
+std::unique_ptr<column> group_hllpp(column_view const& values,
+                                    device_span<size_type const> group_labels,
+                                    size_type num_groups,
+                                    int precision,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Merge the HyperLogLog++ sketches of each group into a single sketch.
+ *
+ * Null sketches are ignored.
+ *
+ * @param sketches The grouped sketches
+ * @param group_labels The group index of each sketch
+ * @param num_groups The number of groups
+ * @param precision The precision of the sketches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return One sketch per group
+ */
+std::unique_ptr<column> group_merge_hllpp(column_view const& sketches,
+                                          device_span<size_type const> group_labels,
+                                          size_type num_groups,
+                                          int precision,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Create a HyperLogLog++ sketch of all the values of a column.
+ *
+ * @param values The values to sketch
+ * @param precision Number of bits of the hashes indexing the registers
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return The sketch as a struct scalar
+ */
+std::unique_ptr<scalar> reduce_hllpp(column_view const& values,
+                                     int precision,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Merge all the HyperLogLog++ sketches of a column into a single sketch.
+ *
+ * @param sketches The sketches to merge
+ * @param precision The precision of the sketches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return The merged sketch as a struct scalar
+ */
+std::unique_ptr<scalar> reduce_merge_hllpp(column_view const& sketches,
+                                           int precision,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::estimate_distinct_count(column_view const&, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> estimate_distinct_count(column_view const& sketches,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,8 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
+#include <cudf/utilities/span.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 
 namespace cudf {
@@ -44,6 +46,44 @@ packed_columns pack(cudf::table_view const& input,
                     rmm::cuda_stream_view stream,
                     rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::contiguous_split_compressed
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::vector<compressed_packed_columns> contiguous_split_compressed(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  io::compression_type compression,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Compresses the results of `cudf::pack` in blocks, in a single batch.
+ *
+ * @throws std::invalid_argument If `compression` is not one of `NONE`, `SNAPPY`, `LZ4` or `ZSTD`
+ * @throws cudf::logic_error If the compression is disabled in nvCOMP
+ *
+ * @param inputs The packed columns to compress
+ * @param compression Codec compressing the data
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned device memory
+ * @return The compressed packed columns, one per input
+ */
+std::vector<compressed_packed_columns> compress_packed(host_span<packed_columns const> inputs,
+                                                       io::compression_type compression,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::decompress_packed
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_columns decompress_packed(compressed_packed_columns const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr);
+
 // opaque implementation of `metadata_builder` since it needs to use
 // `serialized_column`, which is only defined in pack.cpp
 class metadata_builder_impl;
@@ -278,5 +278,13 @@ std::unique_ptr<column> purge_nonempty_nulls(column_view const& input,
                                              rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::purge_nonempty_nulls(std::unique_ptr<column>, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> purge_nonempty_nulls(std::unique_ptr<column> input,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace cudf
@@ -23,6 +23,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/null_mask.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -40,8 +41,6 @@
 
 #include <cub/cub.cuh>
 #include <cuda/atomic>
-#include <thrust/copy.h>
-#include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
 
@@ -229,7 +228,45 @@ struct DeviceType<T, std::enable_if_t<cudf::is_fixed_point<T>()>> {
   using type = typename cudf::device_storage_type_t<T>;
 };
 
-// Dispatch functor which performs the scatter for fixed column types and gather for other
+// Scatters the rows of a fixed-width column passing `filter` to `output`, adding the number of
+// nulls scattered to `output_null_count`
+template <typename T, typename Filter, int block_size>
+void scatter_fixed_width(cudf::column_view const& input,
+                         cudf::mutable_column_view const& output,
+                         cudf::size_type* output_null_count,
+                         cudf::size_type const* block_offsets,
+                         Filter filter,
+                         cudf::size_type per_thread,
+                         rmm::cuda_stream_view stream)
+{
+  using Type = typename DeviceType<T>::type;
+
+  auto scatter = (input.nullable()) ? scatter_kernel<Type, Filter, block_size, true>
+                                    : scatter_kernel<Type, Filter, block_size, false>;
+
+  cudf::detail::grid_1d grid{input.size(), block_size, per_thread};
+
+  if (output.nullable()) {
+    // Have to initialize the output mask to all zeros because we may update
+    // it with atomicOr().
+    CUDF_CUDA_TRY(cudaMemsetAsync(static_cast<void*>(output.null_mask()),
+                                  0,
+                                  cudf::bitmask_allocation_size_bytes(output.size()),
+                                  stream.value()));
+  }
+
+  auto output_device_view = cudf::mutable_column_device_view::create(output, stream);
+  auto input_device_view  = cudf::column_device_view::create(input, stream);
+  scatter<<<grid.num_blocks, block_size, 0, stream.value()>>>(*output_device_view,
+                                                              output_null_count,
+                                                              *input_device_view,
+                                                              block_offsets,
+                                                              input.size(),
+                                                              per_thread,
+                                                              filter);
+}
+
+// Dispatch functor which performs the scatter for fixed-width column types
 template <typename Filter, int block_size>
 struct scatter_gather_functor {
   template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
@@ -243,98 +280,60 @@ struct scatter_gather_functor {
   {
     auto output_column = cudf::detail::allocate_like(
       input, output_size, cudf::mask_allocation_policy::RETAIN, stream, mr);
-    auto output = output_column->mutable_view();
-
-    bool has_valid = input.nullable();
-
-    using Type = typename DeviceType<T>::type;
-
-    auto scatter = (has_valid) ? scatter_kernel<Type, Filter, block_size, true>
-                               : scatter_kernel<Type, Filter, block_size, false>;
-
-    cudf::detail::grid_1d grid{input.size(), block_size, per_thread};
 
     rmm::device_scalar<cudf::size_type> null_count{0, stream};
-    if (output.nullable()) {
-      // Have to initialize the output mask to all zeros because we may update
-      // it with atomicOr().
-      CUDF_CUDA_TRY(cudaMemsetAsync(static_cast<void*>(output.null_mask()),
-                                    0,
-                                    cudf::bitmask_allocation_size_bytes(output.size()),
-                                    stream.value()));
-    }
-
-    auto output_device_view = cudf::mutable_column_device_view::create(output, stream);
-    auto input_device_view  = cudf::column_device_view::create(input, stream);
-    scatter<<<grid.num_blocks, block_size, 0, stream.value()>>>(*output_device_view,
-                                                                null_count.data(),
-                                                                *input_device_view,
-                                                                block_offsets,
-                                                                input.size(),
-                                                                per_thread,
-                                                                filter);
-
-    if (has_valid) { output_column->set_null_count(null_count.value(stream)); }
+    scatter_fixed_width<T, Filter, block_size>(input,
+                                               output_column->mutable_view(),
+                                               null_count.data(),
+                                               block_offsets,
+                                               filter,
+                                               per_thread,
+                                               stream);
+
+    if (input.nullable()) { output_column->set_null_count(null_count.value(stream)); }
     return output_column;
   }
 
-  template <typename T,
-            std::enable_if_t<!cudf::is_fixed_width<T>() and !cudf::is_fixed_point<T>()>* = nullptr>
-  std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
-                                           cudf::size_type const& output_size,
-                                           cudf::size_type const*,
-                                           Filter filter,
-                                           cudf::size_type,
-                                           rmm::cuda_stream_view stream,
-                                           rmm::mr::device_memory_resource* mr)
+  template <typename T, typename... Args>
+  std::enable_if_t<!cudf::is_fixed_width<T>(), std::unique_ptr<cudf::column>> operator()(Args&&...)
   {
-    rmm::device_uvector<cudf::size_type> indices(output_size, stream);
+    CUDF_FAIL("Only fixed-width columns are scattered", cudf::data_type_error);
+  }
+};
 
-    thrust::copy_if(rmm::exec_policy(stream),
-                    thrust::counting_iterator<cudf::size_type>(0),
-                    thrust::counting_iterator<cudf::size_type>(input.size()),
-                    indices.begin(),
-                    filter);
-
-    auto output_table = cudf::detail::gather(cudf::table_view{{input}},
-                                             indices,
-                                             cudf::out_of_bounds_policy::DONT_CHECK,
-                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                             stream,
-                                             mr);
-
-    // There will be only one column
-    return std::make_unique<cudf::column>(std::move(output_table->get_column(0)));
+/**
+ * @brief Per-block output offsets of the rows passing a filter
+ */
+struct filter_block_offsets {
+  cudf::size_type per_thread;                           ///< Rows processed by each thread
+  rmm::device_uvector<cudf::size_type> block_counts;   ///< Rows passing the filter per block
+  rmm::device_uvector<cudf::size_type> block_offsets;  ///< Output offset of each block
+
+  /**
+   * @brief Returns the device pointer to the number of rows passing the filter.
+   *
+   * As the offsets are an inclusive scan, the last offset is the output size, unless there is a
+   * single block, in which case the scan is skipped and the output size is its count.
+   */
+  [[nodiscard]] cudf::size_type const* output_size() const
+  {
+    return block_counts.size() > 1 ? block_offsets.data() + block_counts.size()
+                                   : block_counts.data();
   }
 };
 
 /**
- * @brief Filters `input` using a Filter function object
- *
- * @p filter must be a functor or lambda with the following signature:
- * __device__ bool operator()(cudf::size_type i);
- * It will return true if element i of @p input should be copied,
- * false otherwise.
- *
- * @tparam Filter the filter functor type
- * @param[in] input The table_view to filter
- * @param[in] filter A function object that takes an index and returns a bool
- * @return unique_ptr<table> The table generated from filtered `input`.
+ * @brief Computes the output offset of each block of rows of `num_rows` rows passing `filter`,
+ * without synchronizing `stream`.
  */
-template <typename Filter>
-std::unique_ptr<table> copy_if(table_view const& input,
-                               Filter filter,
-                               rmm::cuda_stream_view stream,
-                               rmm::mr::device_memory_resource* mr)
+template <typename Filter, int block_size>
+filter_block_offsets compute_filter_block_offsets(cudf::size_type num_rows,
+                                                  Filter filter,
+                                                  rmm::cuda_stream_view stream)
 {
-  CUDF_FUNC_RANGE();
-
-  if (0 == input.num_rows() || 0 == input.num_columns()) { return empty_like(input); }
-
-  constexpr int block_size = 256;
   cudf::size_type per_thread =
-    elements_per_thread(compute_block_counts<Filter, block_size>, input.num_rows(), block_size);
-  cudf::detail::grid_1d grid{input.num_rows(), block_size, per_thread};
+    elements_per_thread(compute_block_counts<Filter, block_size>, num_rows, block_size);
+  cudf::detail::grid_1d grid{num_rows, block_size, per_thread};
 
   // temp storage for block counts and offsets
   rmm::device_uvector<cudf::size_type> block_counts(grid.num_blocks, stream);
@@ -342,7 +341,7 @@ std::unique_ptr<table> copy_if(table_view const& input,
 
   // 1. Find the count of elements in each block that "pass" the mask
   compute_block_counts<Filter, block_size><<<grid.num_blocks, block_size, 0, stream.value()>>>(
-    block_counts.begin(), input.num_rows(), per_thread, filter);
+    block_counts.begin(), num_rows, per_thread, filter);
 
   // initialize just the first element of block_offsets to 0 since the InclusiveSum below
   // starts at the second element.
@@ -369,39 +368,236 @@ std::unique_ptr<table> copy_if(table_view const& input,
                                   stream.value());
   }
 
-  // As it is InclusiveSum, last value in block_offsets will be output_size
-  // unless num_blocks == 1, in which case output_size is just block_counts[0]
+  return {per_thread, std::move(block_counts), std::move(block_offsets)};
+}
+
+/**
+ * @brief Writes the index of each row passing `filter` to its output position.
+ *
+ * Each warp ballots its rows' filter results, so a row's position within its warp is the
+ * population count of the ballot below its lane, and the warp counts are scanned once per block
+ * iteration. The block offsets are those computed by `compute_filter_block_offsets`.
+ *
+ * @param[out] indices The indices of the rows passing `filter`, in ascending order
+ * @param block_offsets The output offset of each block
+ * @param size The number of rows
+ * @param per_thread The number of rows processed by each thread
+ * @param filter A function object that takes an index and returns a bool
+ */
+template <typename Filter, int block_size>
+__launch_bounds__(block_size) CUDF_KERNEL
+  void compute_filter_indices(cudf::size_type* __restrict__ indices,
+                              cudf::size_type const* __restrict__ block_offsets,
+                              cudf::size_type size,
+                              cudf::size_type per_thread,
+                              Filter filter)
+{
+  constexpr int num_warps = block_size / cudf::detail::warp_size;
+  static_assert(num_warps <= cudf::detail::warp_size, "Maximum thread block size exceeded");
+
+  using WarpScan = cub::WarpScan<cudf::size_type>;
+  __shared__ typename WarpScan::TempStorage scan_storage;
+  __shared__ cudf::size_type warp_offsets[num_warps];
+
+  int const wid  = threadIdx.x / cudf::detail::warp_size;
+  int const lane = threadIdx.x % cudf::detail::warp_size;
+
+  int tid                      = threadIdx.x + per_thread * block_size * blockIdx.x;
+  cudf::size_type block_offset = block_offsets[blockIdx.x];
+
+  for (int i = 0; i < per_thread; i++) {
+    bool const mask_true = (tid < size) && filter(tid);
+    auto const ballot    = __ballot_sync(0xffff'ffffu, mask_true);
+    if (lane == 0) { warp_offsets[wid] = __popc(ballot); }
+    __syncthreads();
+
+    // inclusive scan of the warp counts, so the last one is the block count
+    if (wid == 0) {
+      cudf::size_type count = lane < num_warps ? warp_offsets[lane] : 0;
+      WarpScan(scan_storage).InclusiveSum(count, count);
+      if (lane < num_warps) { warp_offsets[lane] = count; }
+    }
+    __syncthreads();
+
+    if (mask_true) {
+      auto const warp_offset = wid > 0 ? warp_offsets[wid - 1] : 0;
+      indices[block_offset + warp_offset + __popc(ballot & ((1u << lane) - 1))] = tid;
+    }
+    block_offset += warp_offsets[num_warps - 1];
+    __syncthreads();  // the warp offsets are overwritten by the next iteration
+    tid += block_size;
+  }
+}
+
+/**
+ * @brief Filters `input` using a Filter function object
+ *
+ * A single fixed-width column is scattered directly. Otherwise the indices of the rows passing
+ * `filter` are computed once and all the columns are gathered with them, which copies the
+ * fixed-width columns of each element size together and the strings of all rows at once.
+ *
+ * @p filter must be a functor or lambda with the following signature:
+ * __device__ bool operator()(cudf::size_type i);
+ * It will return true if element i of @p input should be copied,
+ * false otherwise.
+ *
+ * @tparam Filter the filter functor type
+ * @param[in] input The table_view to filter
+ * @param[in] filter A function object that takes an index and returns a bool
+ * @return unique_ptr<table> The table generated from filtered `input`.
+ */
+template <typename Filter>
+std::unique_ptr<table> copy_if(table_view const& input,
+                               Filter filter,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  if (0 == input.num_rows() || 0 == input.num_columns()) { return empty_like(input); }
+
+  constexpr int block_size = 256;
+  auto const offsets =
+    compute_filter_block_offsets<Filter, block_size>(input.num_rows(), filter, stream);
+
   cudf::size_type output_size{0};
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    &output_size,
-    grid.num_blocks > 1 ? block_offsets.begin() + grid.num_blocks : block_counts.begin(),
-    sizeof(cudf::size_type),
-    cudaMemcpyDefault,
-    stream.value()));
+  CUDF_CUDA_TRY(cudaMemcpyAsync(&output_size,
+                                offsets.output_size(),
+                                sizeof(cudf::size_type),
+                                cudaMemcpyDefault,
+                                stream.value()));
 
   stream.synchronize();
 
   if (output_size == input.num_rows()) {
     return std::make_unique<table>(input, stream, mr);
-  } else if (output_size > 0) {
-    std::vector<std::unique_ptr<column>> out_columns(input.num_columns());
-    std::transform(input.begin(), input.end(), out_columns.begin(), [&](auto col_view) {
-      return cudf::type_dispatcher(col_view.type(),
-                                   scatter_gather_functor<Filter, block_size>{},
-                                   col_view,
-                                   output_size,
-                                   block_offsets.begin(),
-                                   filter,
-                                   per_thread,
-                                   stream,
-                                   mr);
-    });
-
+  } else if (output_size > 0 && input.num_columns() == 1 &&
+             is_fixed_width(input.column(0).type())) {
+    std::vector<std::unique_ptr<column>> out_columns;
+    out_columns.push_back(cudf::type_dispatcher(input.column(0).type(),
+                                                scatter_gather_functor<Filter, block_size>{},
+                                                input.column(0),
+                                                output_size,
+                                                offsets.block_offsets.begin(),
+                                                filter,
+                                                offsets.per_thread,
+                                                stream,
+                                                mr));
     return std::make_unique<table>(std::move(out_columns));
+  } else if (output_size > 0) {
+    rmm::device_uvector<cudf::size_type> indices(output_size, stream);
+    cudf::detail::grid_1d grid{input.num_rows(), block_size, offsets.per_thread};
+    compute_filter_indices<Filter, block_size>
+      <<<grid.num_blocks, block_size, 0, stream.value()>>>(indices.data(),
+                                                           offsets.block_offsets.data(),
+                                                           input.num_rows(),
+                                                           offsets.per_thread,
+                                                           filter);
+    CUDF_CHECK_CUDA(stream.value());
+    return cudf::detail::gather(input,
+                                indices,
+                                cudf::out_of_bounds_policy::DONT_CHECK,
+                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                stream,
+                                mr);
   } else {
     return empty_like(input);
   }
 }
 
+// Dispatch functor scattering the rows of a fixed-width column into an output of the input size
+template <typename Filter, int block_size>
+struct deferred_scatter_functor {
+  template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
+                                           cudf::size_type* output_null_count,
+                                           filter_block_offsets const& offsets,
+                                           Filter filter,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+  {
+    auto output_column = cudf::detail::allocate_like(
+      input, input.size(), cudf::mask_allocation_policy::RETAIN, stream, mr);
+    scatter_fixed_width<T, Filter, block_size>(input,
+                                               output_column->mutable_view(),
+                                               output_null_count,
+                                               offsets.block_offsets.data(),
+                                               filter,
+                                               offsets.per_thread,
+                                               stream);
+    return output_column;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!cudf::is_fixed_width<T>(), std::unique_ptr<cudf::column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Deferred-size filtering only supports fixed-width columns", cudf::data_type_error);
+  }
+};
+
+/**
+ * @brief Filters `input` using a Filter function object without reading the output size back
+ * to the host.
+ *
+ * The output columns are allocated with the size of `input`, and the number of rows passing
+ * `filter` and the null count of each output column are left on the device.
+ *
+ * @throws cudf::data_type_error if a column of `input` is not fixed-width
+ *
+ * @tparam Filter the filter functor type
+ * @param[in] input The table_view to filter
+ * @param[in] filter A function object that takes an index and returns a bool
+ * @return The filtered table, whose size is known on the device only
+ */
+template <typename Filter>
+deferred_table copy_if_deferred(table_view const& input,
+                                Filter filter,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [](auto const& col_view) { return is_fixed_width(col_view.type()); }),
+               "Deferred-size filtering only supports fixed-width columns",
+               cudf::data_type_error);
+
+  // the output size followed by the null count of each column
+  rmm::device_uvector<cudf::size_type> counts(input.num_columns() + 1, stream);
+  CUDF_CUDA_TRY(cudaMemsetAsync(
+    counts.data(), 0, counts.size() * sizeof(cudf::size_type), stream.value()));
+
+  std::vector<std::unique_ptr<column>> out_columns(input.num_columns());
+  if (input.num_rows() == 0) {
+    std::transform(input.begin(), input.end(), out_columns.begin(), [](auto col_view) {
+      return make_empty_column(col_view.type());
+    });
+    return deferred_table{std::move(out_columns), std::move(counts)};
+  }
+
+  constexpr int block_size = 256;
+  auto const offsets =
+    compute_filter_block_offsets<Filter, block_size>(input.num_rows(), filter, stream);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(counts.data(),
+                                offsets.output_size(),
+                                sizeof(cudf::size_type),
+                                cudaMemcpyDefault,
+                                stream.value()));
+
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    out_columns[i] = cudf::type_dispatcher(input.column(i).type(),
+                                           deferred_scatter_functor<Filter, block_size>{},
+                                           input.column(i),
+                                           counts.data() + i + 1,
+                                           offsets,
+                                           filter,
+                                           stream,
+                                           mr);
+  }
+
+  return deferred_table{std::move(out_columns), std::move(counts)};
+}
+
 }  // namespace detail
 }  // namespace cudf
@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <cudf/datetime.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace datetime {
@@ -117,6 +120,18 @@ std::unique_ptr<cudf::column> extract_nanosecond_fraction(cudf::column_view cons
                                                           rmm::cuda_stream_view stream,
                                                           rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::extract_datetime_components(cudf::column_view const&,
+ * host_span<datetime_component const>, rmm::mr::device_memory_resource *)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<cudf::column>> extract_datetime_components(
+  cudf::column_view const& column,
+  host_span<datetime_component const> components,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::last_day_of_month(cudf::column_view const&, rmm::mr::device_memory_resource *)
  *
@@ -17,6 +17,8 @@
 
 #include <cuda/std/chrono>
 
+#include <cstdint>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
@@ -37,6 +39,49 @@ __device__ Timestamp add_calendrical_months_with_scale_back(Timestamp time_val,
   return sys_days{date} + time;
 }
 
+/**
+ * @brief Proleptic Gregorian calendar date
+ */
+struct civil_date {
+  int32_t year;
+  uint32_t month;  ///< 1-based month of the year
+  uint32_t day;    ///< 1-based day of the month
+};
+
+/**
+ * @brief Converts a number of days since the UNIX epoch to a calendar date.
+ *
+ * Howard Hinnant's `civil_from_days` algorithm: the date is computed within a 400-year era
+ * with years starting in March, so that the leap day is the last day of the year. Only the era
+ * needs 64-bit arithmetic; everything within an era is computed without branches in 32 bits.
+ *
+ * @param days_since_epoch Number of days since 1970-01-01
+ * @return The calendar date
+ */
+__device__ inline civil_date civil_from_days(int64_t days_since_epoch)
+{
+  constexpr int64_t days_per_era = 146097;
+  // Shift the epoch from 1970-01-01 to 0000-03-01
+  auto const z     = days_since_epoch + 719468;
+  auto const era   = (z >= 0 ? z : z - (days_per_era - 1)) / days_per_era;
+  auto const doe   = static_cast<uint32_t>(z - era * days_per_era);          // [0, 146096]
+  auto const yoe   = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;  // [0, 399]
+  auto const doy   = doe - (365 * yoe + yoe / 4 - yoe / 100);                // [0, 365]
+  auto const mp    = (5 * doy + 2) / 153;                                    // [0, 11]
+  auto const day   = doy - (153 * mp + 2) / 5 + 1;                           // [1, 31]
+  auto const month = mp < 10 ? mp + 3 : mp - 9;                              // [1, 12]
+  auto const year  = static_cast<int32_t>(era * 400 + yoe) + static_cast<int32_t>(month <= 2);
+  return {year, month, day};
+}
+
+/**
+ * @brief Returns whether the given year of the proleptic Gregorian calendar is a leap year
+ */
+__device__ inline bool is_leap(int32_t year)
+{
+  return (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
+}
+
 }  // namespace detail
 }  // namespace datetime
 }  // namespace cudf
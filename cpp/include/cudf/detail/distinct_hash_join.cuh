@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/detail/join.hpp>
 #include <cudf/hashing/detail/helper_functions.cuh>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/types.hpp>
@@ -25,6 +26,7 @@
 #include <cuco/static_set.cuh>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -34,6 +36,10 @@ namespace cudf::detail {
 using cudf::experimental::row::lhs_index_type;
 using cudf::experimental::row::rhs_index_type;
 
+/// Type of the row hashes stored in the hash table. With 64 bits, distinct keys with equal hashes,
+/// each of which costs a full row comparison, stay rare even for billions of build rows.
+using distinct_hash_value_type = uint64_t;
+
 /**
  * @brief An comparator adapter wrapping both self comparator and two table comparator
  */
@@ -42,16 +48,16 @@ struct comparator_adapter {
   comparator_adapter(Equal const& d_equal) : _d_equal{d_equal} {}
 
   __device__ constexpr auto operator()(
-    cuco::pair<hash_value_type, lhs_index_type> const&,
-    cuco::pair<hash_value_type, lhs_index_type> const&) const noexcept
+    cuco::pair<distinct_hash_value_type, lhs_index_type> const&,
+    cuco::pair<distinct_hash_value_type, lhs_index_type> const&) const noexcept
   {
     // All build table keys are distinct thus `false` no matter what
     return false;
   }
 
   __device__ constexpr auto operator()(
-    cuco::pair<hash_value_type, lhs_index_type> const& lhs,
-    cuco::pair<hash_value_type, rhs_index_type> const& rhs) const noexcept
+    cuco::pair<distinct_hash_value_type, lhs_index_type> const& lhs,
+    cuco::pair<distinct_hash_value_type, rhs_index_type> const& rhs) const noexcept
   {
     if (lhs.first != rhs.first) { return false; }
     return _d_equal(lhs.second, rhs.second);
@@ -66,7 +72,8 @@ struct hasher_adapter {
   hasher_adapter(Hasher const& d_hasher = {}) : _d_hasher{d_hasher} {}
 
   template <typename T>
-  __device__ constexpr auto operator()(cuco::pair<hash_value_type, T> const& key) const noexcept
+  __device__ constexpr auto operator()(
+    cuco::pair<distinct_hash_value_type, T> const& key) const noexcept
   {
     return _d_hasher(key.first);
   }
@@ -94,12 +101,12 @@ struct distinct_hash_join {
   /// Device row equal type
   using d_equal_type =
     std::conditional_t<HasNested == cudf::has_nested::YES, nested_row_equal, flat_row_equal>;
-  using hasher              = hasher_adapter<thrust::identity<hash_value_type>>;
+  using hasher              = hasher_adapter<thrust::identity<distinct_hash_value_type>>;
   using probing_scheme_type = cuco::linear_probing<1, hasher>;
   using cuco_storage_type   = cuco::storage<1>;
 
   /// Hash table type
-  using hash_table_type = cuco::static_set<cuco::pair<hash_value_type, lhs_index_type>,
+  using hash_table_type = cuco::static_set<cuco::pair<distinct_hash_value_type, lhs_index_type>,
                                            cuco::extent<size_type>,
                                            cuda::thread_scope_device,
                                            comparator_adapter<d_equal_type>,
@@ -155,5 +162,24 @@ struct distinct_hash_join {
    */
   std::unique_ptr<rmm::device_uvector<size_type>> left_join(
     rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const;
+
+  /**
+   * @copydoc cudf::distinct_hash_join::left_join_indices
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join_indices(rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const;
+
+  /**
+   * @brief Returns the probe row indices of a left semi or left anti join.
+   *
+   * @param kind The kind of join, `LEFT_SEMI_JOIN` or `LEFT_ANTI_JOIN`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory
+   *
+   * @return The indices of the probe rows with a match for a semi join, without for an anti join
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> semi_anti_join(
+    join_kind kind, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const;
 };
 }  // namespace cudf::detail
@@ -618,6 +618,150 @@ void gather_bitmask(table_view const& source,
   }
 }
 
+/**
+ * @brief Gathers the rows of a batch of fixed-width columns of the same element size.
+ *
+ * Each gather map index is read once and used for every column of the batch, so a table with many
+ * columns takes one launch and one pass over the gather map per element size.
+ *
+ * @tparam Element Type with the size of the elements of every column of the batch
+ * @tparam MapIterator Iterator type for the gather map
+ *
+ * @param sources Data of the source columns, offsets applied
+ * @param destinations Data of the destination columns
+ * @param gather_map Start of the gather map
+ * @param num_rows Number of rows to gather
+ * @param source_rows Number of rows of the source columns
+ * @param nullify_out_of_bounds True if map values are checked against `source_rows`
+ */
+template <typename Element, typename MapIterator>
+CUDF_KERNEL void gather_fixed_width_batch_kernel(device_span<Element const* const> sources,
+                                                 device_span<Element* const> destinations,
+                                                 MapIterator gather_map,
+                                                 size_type num_rows,
+                                                 size_type source_rows,
+                                                 bool nullify_out_of_bounds)
+{
+  using map_type    = typename std::iterator_traits<MapIterator>::value_type;
+  auto in_bounds    = bounds_checker<map_type>{0, source_rows};
+  auto const stride = grid_1d::grid_stride();
+  for (auto row = grid_1d::global_thread_id(); row < num_rows; row += stride) {
+    map_type const index = gather_map[row];
+    if (nullify_out_of_bounds and not in_bounds(index)) { continue; }
+    for (std::size_t c = 0; c < sources.size(); ++c) {
+      destinations[c][row] = sources[c][index];
+    }
+  }
+}
+
+/**
+ * @brief Gathers the fixed-width columns of `source_table` with one kernel per element size.
+ *
+ * Dictionary columns and columns of other types are left to the per-column gather, as are all
+ * columns if the table has fewer than two fixed-width columns. The gathered columns are stored at
+ * their index in `destination_columns` and have no null mask.
+ *
+ * @param source_table View into the table containing the columns to gather
+ * @param gather_map_begin Beginning of iterator range of integer indices of the rows to gather
+ * @param gather_map_end End of iterator range of integer indices of the rows to gather
+ * @param nullify_out_of_bounds True if map values are checked against the number of rows
+ * @param destination_columns Gathered columns, one slot per column of `source_table`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the gathered columns' device memory
+ */
+template <typename MapIterator>
+void gather_fixed_width_columns(table_view const& source_table,
+                                MapIterator gather_map_begin,
+                                MapIterator gather_map_end,
+                                bool nullify_out_of_bounds,
+                                std::vector<std::unique_ptr<column>>& destination_columns,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  auto const is_batched = [](column_view const& col) {
+    return is_fixed_width(col.type()) and col.type().id() != type_id::DICTIONARY32;
+  };
+  if (std::count_if(source_table.begin(), source_table.end(), is_batched) < 2) { return; }
+
+  auto const num_rows    = cudf::distance(gather_map_begin, gather_map_end);
+  auto const source_rows = source_table.num_rows();
+
+  auto const gather_batch = [&](auto element) {
+    using Element = decltype(element);
+    std::vector<Element const*> sources;
+    std::vector<Element*> destinations;
+    for (size_type i = 0; i < source_table.num_columns(); ++i) {
+      auto const& col = source_table.column(i);
+      if (not is_batched(col) or size_of(col.type()) != sizeof(Element)) { continue; }
+      destination_columns[i] =
+        allocate_like(col, num_rows, mask_allocation_policy::NEVER, stream, mr);
+      sources.push_back(col.data<Element>());
+      destinations.push_back(destination_columns[i]->mutable_view().template data<Element>());
+    }
+    if (sources.empty() or num_rows == 0) { return; }
+
+    auto const d_sources =
+      make_device_uvector_async(sources, stream, rmm::mr::get_current_device_resource());
+    auto const d_destinations =
+      make_device_uvector_async(destinations, stream, rmm::mr::get_current_device_resource());
+    constexpr size_type block_size = 256;
+    cudf::detail::grid_1d const grid{num_rows, block_size};
+    gather_fixed_width_batch_kernel<Element>
+      <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+        d_sources, d_destinations, gather_map_begin, num_rows, source_rows, nullify_out_of_bounds);
+    CUDF_CHECK_CUDA(stream.value());
+  };
+  gather_batch(uint8_t{});
+  gather_batch(uint16_t{});
+  gather_batch(uint32_t{});
+  gather_batch(uint64_t{});
+  gather_batch(__int128_t{});
+}
+
+/**
+ * @brief Gathers the strings columns of `source_table` with one pass for the sizes of the gathered
+ * strings and one kernel for their characters.
+ *
+ * All columns are left to the per-column gather if the table has fewer than two strings columns.
+ * The gathered columns are stored at their index in `destination_columns` and have no null mask.
+ *
+ * @param source_table View into the table containing the columns to gather
+ * @param gather_map_begin Beginning of iterator range of integer indices of the rows to gather
+ * @param gather_map_end End of iterator range of integer indices of the rows to gather
+ * @param nullify_out_of_bounds True if map values are checked against the number of rows
+ * @param destination_columns Gathered columns, one slot per column of `source_table`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the gathered columns' device memory
+ */
+template <typename MapIterator>
+void gather_strings_columns(table_view const& source_table,
+                            MapIterator gather_map_begin,
+                            MapIterator gather_map_end,
+                            bool nullify_out_of_bounds,
+                            std::vector<std::unique_ptr<column>>& destination_columns,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  std::vector<size_type> indices;
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (source_table.column(i).type().id() == type_id::STRING) { indices.push_back(i); }
+  }
+  if (indices.size() < 2) { return; }
+
+  auto const strings_columns = source_table.select(indices);
+  std::vector<std::unique_ptr<column>> gathered;
+  if (nullify_out_of_bounds) {
+    gathered = cudf::strings::detail::gather_columns<true>(
+      strings_columns, gather_map_begin, gather_map_end, stream, mr);
+  } else {
+    gathered = cudf::strings::detail::gather_columns<false>(
+      strings_columns, gather_map_begin, gather_map_end, stream, mr);
+  }
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    destination_columns[indices[i]] = std::move(gathered[i]);
+  }
+}
+
 /**
  * @brief Gathers the specified rows of a set of columns according to a gather map.
  *
@@ -654,13 +798,29 @@ std::unique_ptr<table> gather(table_view const& source_table,
                               rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
 {
-  std::vector<std::unique_ptr<column>> destination_columns;
-
-  // TODO: Could be beneficial to use streams internally here
-
-  for (auto const& source_column : source_table) {
-    // The data gather for n columns will be put on the first n streams
-    destination_columns.push_back(
+  std::vector<std::unique_ptr<column>> destination_columns(source_table.num_columns());
+
+  // Fixed-width columns share a kernel per element size and strings columns share their kernels,
+  // the others are gathered one by one
+  gather_fixed_width_columns(source_table,
+                             gather_map_begin,
+                             gather_map_end,
+                             bounds_policy == out_of_bounds_policy::NULLIFY,
+                             destination_columns,
+                             stream,
+                             mr);
+  gather_strings_columns(source_table,
+                         gather_map_begin,
+                         gather_map_end,
+                         bounds_policy == out_of_bounds_policy::NULLIFY,
+                         destination_columns,
+                         stream,
+                         mr);
+
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (destination_columns[i]) { continue; }
+    auto const& source_column = source_table.column(i);
+    destination_columns[i] =
       cudf::type_dispatcher<dispatch_storage_type>(source_column.type(),
                                                    column_gatherer{},
                                                    source_column,
@@ -668,7 +828,7 @@ std::unique_ptr<table> gather(table_view const& source_table,
                                                    gather_map_end,
                                                    bounds_policy == out_of_bounds_policy::NULLIFY,
                                                    stream,
-                                                   mr));
+                                                   mr);
   }
 
   auto needs_new_bitmask = bounds_policy == out_of_bounds_policy::NULLIFY ||
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
 #include <memory>
 #include <utility>
@@ -39,6 +40,17 @@ namespace hash {
  */
 bool can_use_hash_groupby(host_span<aggregation_request const> requests);
 
+/**
+ * @brief The groups of the rows of a set of keys, found by a hash-based groupby.
+ *
+ * Each group has a slot of its own, and some slots may be empty. The groupbys reusing the slots
+ * of the rows index their results with them, without hashing the keys.
+ */
+struct key_groups {
+  rmm::device_uvector<size_type> row_slots;  ///< Slot of the group of each row
+  size_type num_slots;                       ///< Number of slots, at least the number of groups
+};
+
 // Hash-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
@@ -46,6 +58,51 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   null_policy include_null_keys,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Hash-based groupby of the rows set in `row_filter` only.
+ *
+ * The other rows are skipped by the aggregation kernels, like the rows with null keys when
+ * `include_null_keys` excludes them, so the filtered keys and values are never materialized.
+ *
+ * @param keys Table whose rows act as the groupby keys
+ * @param requests The set of columns to aggregate and the aggregations to perform
+ * @param include_null_keys Indicates whether rows in `keys` that contain NULL values are included
+ * @param row_filter Bitmask of `keys.num_rows()` bits where bit `i` indicates that row `i` is
+ * aggregated
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @return The unique keys of the aggregated rows and the results of the aggregations
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  bitmask_type const* row_filter,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Hash-based groupby that reuses or caches the groups of the rows of `keys`.
+ *
+ * If `groups` holds the groups of the rows of the same `keys` and `include_null_keys`, they are
+ * reused instead of hashing the keys. Otherwise, `groups` is set to the groups found by this call.
+ *
+ * @param keys Table whose rows act as the groupby keys
+ * @param requests The set of columns to aggregate and the aggregations to perform
+ * @param include_null_keys Indicates whether rows in `keys` that contain NULL values are included
+ * @param groups The cached groups of the rows, or null to compute and cache them
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @return The unique keys and the results of the aggregations
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  std::unique_ptr<key_groups>& groups,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
 }  // namespace hash
 
 }  // namespace detail
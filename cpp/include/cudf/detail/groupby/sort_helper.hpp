@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -55,8 +55,9 @@ struct sort_groupby_helper {
    *
    * @param keys table to group by
    * @param include_null_keys Include rows in keys with nulls
-   * @param keys_pre_sorted Indicate if the keys are already sorted. Enables
-   *                        optimizations to help skip re-sorting keys.
+   * @param keys_pre_sorted Indicate if the keys are already sorted, or only clustered
+   *                        with equal rows contiguous. Enables optimizations to help
+   *                        skip re-sorting keys.
    * @param null_precedence Indicates the ordering of nulls in each column.
    *                        Default behavior for each column is
    *                        `null_order::AFTER`
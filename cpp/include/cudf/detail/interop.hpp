@@ -35,6 +35,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <future>
 #include <string>
 
 namespace cudf {
@@ -58,6 +59,15 @@ DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::cuda_stream_view stream,
                            rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::to_dlpack_row_major
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+DLManagedTensor* to_dlpack_row_major(table_view const& input,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr);
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
@@ -117,6 +127,15 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
                                        rmm::cuda_stream_view stream,
                                        arrow::MemoryPool* ar_mr);
 
+/**
+ * @copydoc cudf::to_arrow_async
+ */
+std::future<std::shared_ptr<arrow::Table>> to_arrow_async(
+  table_view input,
+  std::vector<column_metadata> const& metadata,
+  rmm::cuda_stream_view stream,
+  arrow::MemoryPool* ar_mr);
+
 /**
  * @copydoc cudf::to_arrow(cudf::scalar const& input, column_metadata const& metadata,
  * rmm::cuda_stream_view stream, arrow::MemoryPool* ar_mr)
@@ -37,6 +37,10 @@ class preprocessed_table;
 }
 
 namespace cudf {
+// Forward declaration
+struct join_size_estimate;
+struct packed_hash_join;
+
 namespace detail {
 
 // Forward declaration
@@ -79,6 +83,11 @@ struct hash_join {
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table>
     _preprocessed_build;  ///< input table preprocssed for row operators
   map_type _hash_table;   ///< hash table built on `_build`
+  // The rows of the heavy-hitter build keys are not in `_hash_table` but grouped by row hash, so
+  // that their matches are expanded one candidate pair per thread instead of along a probe chain
+  rmm::device_uvector<hash_value_type> _heavy_hashes;  ///< sorted row hashes of the heavy hitters
+  rmm::device_uvector<size_type> _heavy_offsets;  ///< offsets of the rows of each heavy hash
+  rmm::device_uvector<size_type> _heavy_rows;     ///< build rows of the heavy hitters, by hash
 
  public:
   /**
@@ -97,6 +106,20 @@ struct hash_join {
             cudf::null_equality compare_nulls,
             rmm::cuda_stream_view stream);
 
+  /**
+   * @copydoc cudf::hash_join::hash_join(cudf::table_view const&, packed_hash_join const&,
+   * rmm::cuda_stream_view)
+   */
+  hash_join(cudf::table_view const& build,
+            cudf::packed_hash_join const& packed,
+            rmm::cuda_stream_view stream);
+
+  /**
+   * @copydoc cudf::hash_join::pack
+   */
+  [[nodiscard]] cudf::packed_hash_join pack(rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr) const;
+
   /**
    * @copydoc cudf::hash_join::inner_join
    */
@@ -133,6 +156,12 @@ struct hash_join {
   [[nodiscard]] std::size_t inner_join_size(cudf::table_view const& probe,
                                             rmm::cuda_stream_view stream) const;
 
+  /**
+   * @copydoc cudf::hash_join::estimate_inner_join_size
+   */
+  [[nodiscard]] cudf::join_size_estimate estimate_inner_join_size(
+    cudf::table_view const& probe, size_type sample_size, rmm::cuda_stream_view stream) const;
+
   /**
    * @copydoc cudf::hash_join::left_join_size
    */
@@ -52,6 +52,30 @@ std::unique_ptr<column> label_bins(column_view const& input,
                                    rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::label_bins_uniform
+ *
+ * @param stream Stream view on which to allocate resources and queue execution.
+ */
+std::unique_ptr<column> label_bins_uniform(column_view const& input,
+                                           double lower,
+                                           double upper,
+                                           size_type num_bins,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::histogram_uniform
+ *
+ * @param stream Stream view on which to allocate resources and queue execution.
+ */
+std::unique_ptr<column> histogram_uniform(column_view const& input,
+                                          double lower,
+                                          double upper,
+                                          size_type num_bins,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr);
+
 /** @} */  // end of group
 }  // namespace detail
 }  // namespace cudf
@@ -274,6 +274,67 @@ struct popc {
   __device__ inline size_type operator()(bitmask_type word) const { return __popc(word); }
 };
 
+/**
+ * @brief Ranges spanning at most this many words are counted by `count_bits_per_range_kernel`
+ * rather than by a segmented reduction over words.
+ */
+constexpr size_type max_words_per_short_range = 8;
+
+/**
+ * @brief Counts the set or unset bits of each range `[first_bit_indices[i], last_bit_indices[i])`
+ * with one thread per range.
+ *
+ * The edge words of a range are masked in place, so a single pass over the words replaces the
+ * segmented reduction and the boundary correction of `segmented_count_bits`. This is faster when
+ * every range spans only a few words, e.g. the rows of a lists column with short lists.
+ *
+ * @param[in] bitmask The bitmask whose bits will be counted
+ * @param[in] num_ranges The number of ranges
+ * @param[in] first_bit_indices Random-access input iterator to the sequence of indices (inclusive)
+ * of the first bit in each range
+ * @param[in] last_bit_indices Random-access input iterator to the sequence of indices (exclusive)
+ * of the last bit in each range
+ * @param[in] count_bits If SET_BITS, count set (1) bits. If UNSET_BITS, count unset (0) bits.
+ * @param[out] bit_counts Random-access output iterator where the count of each range is written
+ */
+template <typename OffsetIterator, typename OutputIterator>
+CUDF_KERNEL void count_bits_per_range_kernel(bitmask_type const* bitmask,
+                                             size_type num_ranges,
+                                             OffsetIterator first_bit_indices,
+                                             OffsetIterator last_bit_indices,
+                                             count_bits_policy count_bits,
+                                             OutputIterator bit_counts)
+{
+  constexpr size_type word_size_in_bits{detail::size_in_bits<bitmask_type>()};
+
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  for (thread_index_type range_id = cudf::detail::grid_1d::global_thread_id();
+       range_id < num_ranges;
+       range_id += stride) {
+    size_type const first_bit_index = first_bit_indices[range_id];
+    size_type const last_bit_index  = last_bit_indices[range_id];
+    size_type set_bits              = 0;
+    if (first_bit_index < last_bit_index) {
+      auto const first_word_index = word_index(first_bit_index);
+      auto const last_word_index  = word_index(last_bit_index - 1);
+      auto const num_last_bits    = intra_word_index(last_bit_index - 1) + 1;
+      for (auto w = first_word_index; w <= last_word_index; ++w) {
+        auto word = bitmask[w];
+        if (w == first_word_index) {
+          word &= ~set_least_significant_bits(intra_word_index(first_bit_index));
+        }
+        if (w == last_word_index and num_last_bits < word_size_in_bits) {
+          word &= set_least_significant_bits(num_last_bits);
+        }
+        set_bits += __popc(word);
+      }
+    }
+    bit_counts[range_id] = count_bits == count_bits_policy::SET_BITS
+                             ? set_bits
+                             : (last_bit_index - first_bit_index) - set_bits;
+  }
+}
+
 // Count set/unset bits in a segmented null mask, using offset iterators accessible by the device.
 template <typename OffsetIterator>
 rmm::device_uvector<size_type> segmented_count_bits(bitmask_type const* bitmask,
@@ -439,6 +500,36 @@ std::vector<size_type> segmented_count_bits(bitmask_type const* bitmask,
   auto const first_bit_indices_end = first_bit_indices_begin + num_segments;
   auto last_bit_indices_begin      = thrust::make_transform_iterator(
     thrust::make_counting_iterator(0), index_alternator{true, d_indices.data()});
+
+  // The segment bounds are on the host, so short segments can be detected without a sync.
+  auto const max_words_per_segment = [&] {
+    size_type max_words = 0;
+    for (size_type i = 0; i < num_segments; i++) {
+      auto const begin = h_indices[2 * i];
+      auto const end   = h_indices[2 * i + 1];
+      if (begin < end) {
+        max_words = std::max(max_words, word_index(end - 1) - word_index(begin) + 1);
+      }
+    }
+    return max_words;
+  }();
+  if (max_words_per_segment <= max_words_per_short_range) {
+    rmm::device_uvector<size_type> d_bit_counts(num_segments, stream);
+    constexpr size_type block_size{256};
+    cudf::detail::grid_1d grid(num_segments, block_size);
+    count_bits_per_range_kernel<<<grid.num_blocks,
+                                  grid.num_threads_per_block,
+                                  0,
+                                  stream.value()>>>(bitmask,
+                                                    num_segments,
+                                                    first_bit_indices_begin,
+                                                    last_bit_indices_begin,
+                                                    count_bits,
+                                                    d_bit_counts.begin());
+    CUDF_CHECK_CUDA(stream.value());
+    return make_std_vector_sync(d_bit_counts, stream);
+  }
+
   rmm::device_uvector<size_type> d_bit_counts =
     cudf::detail::segmented_count_bits(bitmask,
                                        first_bit_indices_begin,
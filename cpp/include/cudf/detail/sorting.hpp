@@ -19,13 +19,20 @@
 #include <cudf/sorting.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace cudf {
+namespace experimental::row::lexicographic {
+// forward declaration
+struct preprocessed_table;
+}  // namespace experimental::row::lexicographic
+
 namespace detail {
 
 /**
@@ -50,6 +57,41 @@ std::unique_ptr<column> stable_sorted_order(table_view const& input,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Computes the row indices that would produce `input` in a lexicographical sorted order,
+ * with the table already preprocessed for lexicographical comparison.
+ *
+ * Preprocessing flattens struct columns and ranks nested children, which dominates sorting
+ * tables with nested columns. A table sorted or searched several times with the same orders can
+ * be preprocessed once with
+ * `cudf::experimental::row::lexicographic::preprocessed_table::create` and passed to each call.
+ *
+ * @param input The table to sort
+ * @param preprocessed_input The preprocessed `input`, holding the column orders and null
+ *        precedences
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of elements containing the permuted row indices of `input`
+ */
+std::unique_ptr<column> sorted_order(
+  table_view const& input,
+  std::shared_ptr<cudf::experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc sorted_order(table_view const&,
+ * std::shared_ptr<cudf::experimental::row::lexicographic::preprocessed_table>,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ *
+ * Equivalent elements are guaranteed to keep their original relative order.
+ */
+std::unique_ptr<column> stable_sorted_order(
+  table_view const& input,
+  std::shared_ptr<cudf::experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::sort_by_key
  *
@@ -76,6 +118,18 @@ std::unique_ptr<column> rank(column_view const& input,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::rank(column_view const&, column_view const&, rank_method, null_policy, bool,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> rank(column_view const& input,
+                             column_view const& sorted_order,
+                             rank_method method,
+                             null_policy null_handling,
+                             bool percentage,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::stable_sort_by_key
  *
@@ -150,6 +204,17 @@ std::unique_ptr<table> sort(table_view const& values,
                             rmm::cuda_stream_view stream,
                             rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::is_sorted
+ *
+ * The table must have at least one column, and `column_order` and `null_precedence` must be
+ * empty or have one entry per column.
+ */
+bool is_sorted(table_view const& table,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream);
+
 /**
  * @copydoc cudf::stable_sort
  *
@@ -161,5 +226,72 @@ std::unique_ptr<table> stable_sort(table_view const& values,
                                    rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Computes the indices of the `k` first non-null elements of each segment of a column in
+ * sorted order.
+ *
+ * Each thread keeps a bounded heap of the best rows of a chunk of a segment, and only these
+ * candidates are sorted. Columns that are not fixed-width, or `k` too large for the heaps, sort
+ * all the non-null rows instead.
+ *
+ * @param values The column to select the elements from
+ * @param segment_offsets The offsets of the segments of `values`
+ * @param segment_labels The segment index of each row of `values`
+ * @param k The number of elements to select from each segment
+ * @param sort_order `DESCENDING` to select the largest elements, `ASCENDING` the smallest
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The indices of the selected rows, grouped by segment, and the offsets of the selected
+ * rows of each segment
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> segmented_top_k_order(
+  column_view const& values,
+  device_span<size_type const> segment_offsets,
+  device_span<size_type const> segment_labels,
+  size_type k,
+  order sort_order,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::top_k_order
+ */
+std::unique_ptr<column> top_k_order(column_view const& col,
+                                    size_type k,
+                                    order sort_order,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::top_k
+ */
+std::unique_ptr<column> top_k(column_view const& col,
+                              size_type k,
+                              order sort_order,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::top_k_order(table_view const&, size_type, std::vector<order> const&,
+ * std::vector<null_order> const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::top_k_by_key
+ */
+std::unique_ptr<table> top_k_by_key(table_view const& values,
+                                    table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace cudf
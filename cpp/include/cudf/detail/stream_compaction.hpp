@@ -24,7 +24,14 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <memory>
+
 namespace cudf {
+namespace experimental::row::equality {
+// forward declaration
+struct preprocessed_table;
+}  // namespace experimental::row::equality
+
 namespace detail {
 /**
  * @copydoc cudf::drop_nulls(table_view const&, std::vector<size_type> const&,
@@ -60,6 +67,37 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::apply_boolean_mask_deferred
+ */
+deferred_table apply_boolean_mask_deferred(table_view const& input,
+                                           column_view const& boolean_mask,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::make_selection_vector
+ */
+selection_vector make_selection_vector(column_view const& boolean_mask,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::materialize
+ */
+std::unique_ptr<table> materialize(table_view const& input,
+                                   selection_vector const& selection,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::to_source_rows
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> to_source_rows(device_span<size_type const> rows,
+                                                               selection_vector const& selection,
+                                                               rmm::cuda_stream_view stream,
+                                                               rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::unique
  *
@@ -110,6 +148,37 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
                                                 rmm::cuda_stream_view stream,
                                                 rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::distinct_indices
+ *
+ * The table is already preprocessed for row equality comparison and hashing. A table whose
+ * duplicates are looked up several times can be preprocessed once with
+ * `cudf::experimental::row::equality::preprocessed_table::create` and passed to each call.
+ *
+ * @param preprocessed_input The preprocessed `input`
+ * @return A device_uvector containing the result indices
+ */
+rmm::device_uvector<size_type> distinct_indices(
+  table_view const& input,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> preprocessed_input,
+  duplicate_keep_option keep,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::distinct_indices_by_hash
+ *
+ * @return A device_uvector containing the result indices
+ */
+rmm::device_uvector<size_type> distinct_indices_by_hash(table_view const& input,
+                                                        duplicate_keep_option keep,
+                                                        row_hash_width width,
+                                                        bool verify,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::unique_count(column_view const&, null_policy, nan_policy)
  *
@@ -33,4 +33,17 @@ std::unique_ptr<table> make_timezone_transition_table(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::convert_timezone(column_view const&, std::optional<std::string_view>,
+ * std::string_view, std::string_view, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::optional<std::string_view> tzif_dir,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr);
+
 }  // namespace cudf::detail
@@ -25,7 +25,8 @@
 namespace cudf {
 namespace detail {
 /**
- * @copydoc cudf::transform
+ * @copydoc cudf::transform(column_view const&, std::string const&, data_type, bool,
+ * rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -36,6 +37,20 @@ std::unique_ptr<column> transform(column_view const& input,
                                   rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::transform(table_view const&, std::string const&, data_type, bool, bool,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  bool null_aware,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::compute_column
  *
@@ -46,6 +61,39 @@ std::unique_ptr<column> compute_column(table_view const& table,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::compute_column(table_view const&, ast::expression const&,
+ * selection_vector const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       selection_vector const& selection,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::compute_column_jit
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::compute_columns
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& exprs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::nans_to_nulls
  *
@@ -80,6 +128,17 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const&
                                                               rmm::cuda_stream_view stream,
                                                               rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::sparse_one_hot_encode
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sparse_one_hot_encode(
+  column_view const& input,
+  column_view const& categories,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::mask_to_bools
  *
@@ -110,5 +169,15 @@ std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
                                                 rmm::cuda_stream_view stream,
                                                 rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::segmented_row_byte_count
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_row_byte_count(table_view const& t,
+                                                 device_span<size_type const> segment_offsets,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace cudf
@@ -32,5 +32,20 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
                                                          rmm::cuda_stream_view stream,
                                                          rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Copies a table to a dense row-major matrix.
+ *
+ * Element `(i, j)` of the table is written at index `i * input.num_columns() + j` of `output`.
+ * The columns are read and the matrix is written by tiles staged in shared memory, so that both
+ * are accessed contiguously.
+ *
+ * @throw cudf::logic_error if column types are non-homogeneous or non-fixed-width
+ *
+ * @param input A table of a single fixed-width type; its null masks are ignored
+ * @param output Device memory for `input.num_rows() * input.num_columns()` elements
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void copy_to_row_major(table_view const& input, void* output, rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace cudf
@@ -483,6 +483,30 @@ __forceinline__ __device__ T atomic_add(T* address, T val)
   return cudf::detail::genericAtomicOperation(address, val, cudf::DeviceSum{});
 }
 
+/**
+ * @brief Overload of `atomic_add` for 128-bit integers
+ *
+ * The addition is done with two 64-bit atomic adds instead of a 128-bit compare-and-swap loop:
+ * the low words are added first, and the carry out of the low word is added to the high word
+ * along with the high word of `val`. Since additions commute, the value at `address` is exact once
+ * all concurrent additions complete, but it can be inconsistent in between, so the old value is
+ * not returned.
+ *
+ * @param address The address of the value in global or shared memory, aligned to 16 bytes
+ * @param val The value to be added
+ */
+__forceinline__ __device__ void atomic_add(__int128_t* address, __int128_t val)
+{
+  using T_int      = unsigned long long int;
+  auto const words = reinterpret_cast<T_int*>(address);
+  auto const low   = static_cast<T_int>(val);
+  auto const high  = static_cast<T_int>(static_cast<unsigned __int128>(val) >> 64);
+
+  auto const old_low = atomicAdd(words, low);
+  auto const carry   = static_cast<T_int>(old_low + low < old_low);
+  if (high + carry != 0) { atomicAdd(words + 1, high + carry); }
+}
+
 /**
  * @brief Overloads for `atomic_mul`
  *
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cudf::detail {
+
+/**
+ * @brief A table packed by `cudf::pack` and copied to host memory.
+ */
+struct spilled_table {
+  std::vector<uint8_t> metadata;  ///< Metadata of the packed table
+  std::vector<uint8_t> data;      ///< Contiguous device data of the packed table
+  size_type num_rows;             ///< Number of rows of the table
+};
+
+/**
+ * @brief Size in bytes of the bounce buffers through which tables are spilled and restored.
+ */
+constexpr std::size_t default_spill_bounce_buffer_size = 32 * 1024 * 1024;
+
+/**
+ * @brief Packs a table and copies it to host memory.
+ *
+ * A table larger than `bounce_buffer_size` is packed chunk by chunk with `cudf::chunked_pack`,
+ * through two device and two pinned host bounce buffers: while a chunk is packed, the previous
+ * one is copied to pinned memory on a separate stream, and the one before it is copied from
+ * pinned memory to the spilled table on the host. The device memory needed on top of the table
+ * is therefore bounded by the bounce buffers rather than the size of the table.
+ *
+ * @throws cudf::logic_error If `bounce_buffer_size` is less than 1MB
+ *
+ * @param input The table to spill
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param bounce_buffer_size Size in bytes of each bounce buffer
+ * @return The spilled table
+ */
+spilled_table spill(table_view const& input,
+                    rmm::cuda_stream_view stream,
+                    std::size_t bounce_buffer_size = default_spill_bounce_buffer_size);
+
+/**
+ * @brief Copies a spilled table back to device memory.
+ *
+ * The table can be viewed with `cudf::unpack` as long as the returned columns are alive.
+ *
+ * A table larger than `bounce_buffer_size` is copied chunk by chunk with `cudf::chunked_unpack`
+ * through two pinned host bounce buffers, so that a chunk is staged while the previous one is
+ * copied to the device.
+ *
+ * @throws cudf::logic_error If `bounce_buffer_size` is zero
+ *
+ * @param input The spilled table
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param bounce_buffer_size Size in bytes of each bounce buffer
+ * @return The packed table in device memory
+ */
+packed_columns unspill(spilled_table const& input,
+                       rmm::cuda_stream_view stream,
+                       std::size_t bounce_buffer_size = default_spill_bounce_buffer_size);
+
+/**
+ * @brief Estimates the device memory size in bytes of a table from the bit count of its rows.
+ *
+ * @param input The table to measure
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The estimated size of `input`
+ */
+std::size_t estimated_table_size(table_view const& input, rmm::cuda_stream_view stream);
+
+}  // namespace cudf::detail
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/instrumentation.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf::detail {
+
+/// Whether any callback is registered, checked before doing any instrumentation work
+extern std::atomic<bool> api_instrumentation_enabled;
+
+/**
+ * @brief Instruments the lifetime of a public API call, reporting an `api_event` on destruction.
+ *
+ * Does nothing unless an event callback is registered.
+ */
+class api_event_scope {
+ public:
+  /**
+   * @brief Starts instrumenting a call reading `input` on `stream`.
+   *
+   * @param name Name of the API, which must outlive the delivery of the event
+   * @param stream Stream the work of the call is enqueued on
+   * @param input Input of the call
+   */
+  api_event_scope(char const* name, rmm::cuda_stream_view stream, table_view const& input)
+  {
+    if (api_instrumentation_enabled.load(std::memory_order_relaxed)) { start(name, stream, input); }
+  }
+
+  /**
+   * @copydoc api_event_scope(char const*, rmm::cuda_stream_view, table_view const&)
+   */
+  api_event_scope(char const* name, rmm::cuda_stream_view stream, column_view const& input)
+    : api_event_scope(name, stream, table_view{{input}})
+  {
+  }
+
+  api_event_scope(api_event_scope const&)            = delete;
+  api_event_scope& operator=(api_event_scope const&) = delete;
+  api_event_scope(api_event_scope&&)                 = delete;
+  api_event_scope& operator=(api_event_scope&&)      = delete;
+
+  ~api_event_scope()
+  {
+    if (_start != nullptr) { finish(); }
+  }
+
+ private:
+  void start(char const* name, rmm::cuda_stream_view stream, table_view const& input);
+  void finish() noexcept;
+
+  api_event _event{};                  ///< Event reported by the scope
+  cudaEvent_t _start{nullptr};         ///< Recorded on the stream when the call starts
+  std::int64_t _allocated_at_start{0};  ///< Bytes allocated by the thread when the call starts
+  std::int64_t _outer_peak{0};          ///< Peak of the enclosing scope when the call starts
+};
+
+}  // namespace cudf::detail
+
+/**
+ * @brief Convenience macro instrumenting the lifetime of a public API function reading `input`
+ * on `stream`, named by `__func__`.
+ *
+ * Example:
+ * ```
+ * std::unique_ptr<table> some_function(table_view const& input, rmm::cuda_stream_view stream){
+ *    CUDF_FUNC_RANGE();
+ *    CUDF_API_EVENT(stream, input);
+ *    ...
+ * }
+ * ```
+ */
+#define CUDF_API_EVENT(stream, input) \
+  cudf::detail::api_event_scope const cudf_api_event_scope_ { __func__, stream, input }
@@ -18,10 +18,62 @@
 
 #include <cudf/utilities/logger.hpp>
 
-// Log messages that require computation should only be used at level TRACE and DEBUG
-#define CUDF_LOG_TRACE(...)    SPDLOG_LOGGER_TRACE(&cudf::logger(), __VA_ARGS__)
-#define CUDF_LOG_DEBUG(...)    SPDLOG_LOGGER_DEBUG(&cudf::logger(), __VA_ARGS__)
-#define CUDF_LOG_INFO(...)     SPDLOG_LOGGER_INFO(&cudf::logger(), __VA_ARGS__)
-#define CUDF_LOG_WARN(...)     SPDLOG_LOGGER_WARN(&cudf::logger(), __VA_ARGS__)
-#define CUDF_LOG_ERROR(...)    SPDLOG_LOGGER_ERROR(&cudf::logger(), __VA_ARGS__)
-#define CUDF_LOG_CRITICAL(...) SPDLOG_LOGGER_CRITICAL(&cudf::logger(), __VA_ARGS__)
+// Log messages that require computation should only be used at level TRACE and DEBUG.
+// The arguments of a message are only evaluated when its level is enabled at runtime, and the
+// levels below SPDLOG_ACTIVE_LEVEL are compiled out.
+#define CUDF_LOG_CALL(logger, level, ...)                \
+  do {                                                   \
+    if ((logger).should_log(level)) {                    \
+      SPDLOG_LOGGER_CALL(&(logger), level, __VA_ARGS__); \
+    }                                                    \
+  } while (0)
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define CUDF_LOG_TRACE(...) CUDF_LOG_CALL(cudf::logger(), spdlog::level::trace, __VA_ARGS__)
+#else
+#define CUDF_LOG_TRACE(...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define CUDF_LOG_DEBUG(...) CUDF_LOG_CALL(cudf::logger(), spdlog::level::debug, __VA_ARGS__)
+#else
+#define CUDF_LOG_DEBUG(...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+#define CUDF_LOG_INFO(...) CUDF_LOG_CALL(cudf::logger(), spdlog::level::info, __VA_ARGS__)
+#else
+#define CUDF_LOG_INFO(...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+#define CUDF_LOG_WARN(...) CUDF_LOG_CALL(cudf::logger(), spdlog::level::warn, __VA_ARGS__)
+#else
+#define CUDF_LOG_WARN(...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
+#define CUDF_LOG_ERROR(...) CUDF_LOG_CALL(cudf::logger(), spdlog::level::err, __VA_ARGS__)
+#else
+#define CUDF_LOG_ERROR(...) (void)0
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_CRITICAL
+#define CUDF_LOG_CRITICAL(...) CUDF_LOG_CALL(cudf::logger(), spdlog::level::critical, __VA_ARGS__)
+#else
+#define CUDF_LOG_CRITICAL(...) (void)0
+#endif
+
+// Structured performance event `event=<event> <format>`, e.g.
+// CUDF_LOG_PERF("parquet_read", "bytes={}", bytes) logs "event=parquet_read bytes=1024"
+#define CUDF_LOG_PERF(event, format, ...) \
+  CUDF_LOG_CALL(cudf::perf_logger(), spdlog::level::info, "event=" event " " format, __VA_ARGS__)
+
+namespace cudf::detail {
+
+/**
+ * @brief Returns whether performance events are logged, e.g. to only measure them when they are.
+ */
+inline bool perf_logging_enabled() { return perf_logger().should_log(spdlog::level::info); }
+
+}  // namespace cudf::detail
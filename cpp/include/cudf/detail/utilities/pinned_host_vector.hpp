@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <cudf/io/memory_resource.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/aligned.hpp>
+#include <rmm/resource_ref.hpp>
+
 #include <thrust/host_vector.h>
 
 #include <cstddef>
@@ -27,7 +31,8 @@
 namespace cudf::detail {
 
 /*! \p pinned_allocator is a CUDA-specific host memory allocator
- *  that employs \c cudaMallocHost for allocation.
+ *  that allocates from the pinned host memory resource returned by
+ *  \c cudf::io::get_host_memory_resource().
  *
  * This implementation is ported from the experimental/pinned_allocator
  * that Thrust used to provide.
@@ -38,7 +43,8 @@ template <typename T>
 class pinned_allocator;
 
 /*! \p pinned_allocator is a CUDA-specific host memory allocator
- *  that employs \c cudaMallocHost for allocation.
+ *  that allocates from the pinned host memory resource returned by
+ *  \c cudf::io::get_host_memory_resource().
  *
  * This implementation is ported from the experimental/pinned_allocator
  * that Thrust used to provide.
@@ -64,7 +70,8 @@ class pinned_allocator<void> {
 };
 
 /*! \p pinned_allocator is a CUDA-specific host memory allocator
- *  that employs \c cudaMallocHost for allocation.
+ *  that allocates from the pinned host memory resource returned by
+ *  \c cudf::io::get_host_memory_resource().
  *
  * This implementation is ported from the experimental/pinned_allocator
  * that Thrust used to provide.
@@ -91,33 +98,42 @@ class pinned_allocator {
   };
 
   /**
-   * @brief pinned_allocator's null constructor does nothing.
+   * @brief pinned_allocator's null constructor captures the current host memory resource.
+   *
+   * Memory is returned to the resource it was allocated from, even if the host memory resource
+   * is replaced while the allocation is alive.
    */
-  __host__ __device__ inline pinned_allocator() {}
+  __host__ inline pinned_allocator() : mr{cudf::io::get_host_memory_resource()} {}
 
   /**
    * @brief pinned_allocator's null destructor does nothing.
    */
-  __host__ __device__ inline ~pinned_allocator() {}
+  __host__ inline ~pinned_allocator() {}
 
   /**
-   * @brief pinned_allocator's copy constructor does nothing.
+   * @brief pinned_allocator's copy constructor copies the memory resource.
    */
-  __host__ __device__ inline pinned_allocator(pinned_allocator const&) {}
+  __host__ inline pinned_allocator(pinned_allocator const&) = default;
 
   /**
-   * @brief  pinned_allocator's copy constructor does nothing.
+   * @brief  pinned_allocator's copy constructor copies the memory resource.
    *
    *  This version of pinned_allocator's copy constructor
    *  is templated on the \c value_type of the pinned_allocator
-   *  to copy from.  It is provided merely for convenience; it
-   *  does nothing.
+   *  to copy from.
    */
   template <typename U>
-  __host__ __device__ inline pinned_allocator(pinned_allocator<U> const&)
+  __host__ inline pinned_allocator(pinned_allocator<U> const& other) : mr{other.mr}
   {
   }
 
+  /**
+   * @brief pinned_allocator's copy assignment copies the memory resource.
+   *
+   * @return Reference to this allocator
+   */
+  __host__ inline pinned_allocator& operator=(pinned_allocator const&) = default;
+
   /**
    * @brief This method returns the address of a \c reference of
    *  interest.
@@ -153,9 +169,8 @@ class pinned_allocator {
   {
     if (cnt > this->max_size()) { throw std::bad_alloc(); }  // end if
 
-    pointer result(0);
-    CUDF_CUDA_TRY(cudaMallocHost(reinterpret_cast<void**>(&result), cnt * sizeof(value_type)));
-    return result;
+    return static_cast<pointer>(
+      mr.allocate(cnt * sizeof(value_type), rmm::RMM_DEFAULT_HOST_ALIGNMENT));
   }
 
   /**
@@ -163,17 +178,14 @@ class pinned_allocator {
    *  with this \c pinned_allocator.
    *
    *  @param p A \c pointer to the previously allocated memory.
-   *  @note The second parameter is the number of objects previously allocated
-   *        but is ignored by this allocator.
+   *  @param cnt The number of objects previously allocated.
    *  @note This method does not invoke \p value_type's destructor.
    *        It is the responsibility of the caller to destroy
    *        the objects stored at \p p.
    */
-  __host__ inline void deallocate(pointer p, size_type /*cnt*/)
+  __host__ inline void deallocate(pointer p, size_type cnt)
   {
-    auto dealloc_worked = cudaFreeHost(p);
-    (void)dealloc_worked;
-    assert(dealloc_worked == cudaSuccess);
+    mr.deallocate(p, cnt * sizeof(value_type), rmm::RMM_DEFAULT_HOST_ALIGNMENT);
   }
 
   /**
@@ -190,21 +202,24 @@ class pinned_allocator {
    *  another.
    *
    *  @param x The other \p pinned_allocator of interest.
-   *  @return This method always returns \c true.
+   *  @return true if both allocators use the same memory resource.
    */
-  __host__ __device__ inline bool operator==(pinned_allocator const& x) const { return true; }
+  __host__ inline bool operator==(pinned_allocator const& x) const { return x.mr == mr; }
 
   /**
    * @brief This method tests this \p pinned_allocator for inequality
    *  to another.
    *
    *  @param x The other \p pinned_allocator of interest.
-   *  @return This method always returns \c false.
+   *  @return true if the allocators use different memory resources.
    */
-  __host__ __device__ inline bool operator!=(pinned_allocator const& x) const
-  {
-    return !operator==(x);
-  }
+  __host__ inline bool operator!=(pinned_allocator const& x) const { return !operator==(x); }
+
+ private:
+  template <typename U>
+  friend class pinned_allocator;
+
+  rmm::host_async_resource_ref mr;
 };
 
 /**
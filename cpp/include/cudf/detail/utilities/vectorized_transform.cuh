@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+
+/// Size in bytes of the widest vectorized load or store
+constexpr std::size_t vector_access_size = 16;
+
+/**
+ * @brief Number of elements processed together by a vectorized transform, such that the accesses
+ * to the widest of the output and input types are `vector_access_size` bytes wide
+ */
+template <typename Out, typename... In>
+constexpr int vector_width()
+{
+  return static_cast<int>(vector_access_size / std::max({sizeof(Out), sizeof(In)...}));
+}
+
+/**
+ * @brief `N` consecutive elements of type `T`, aligned so they are loaded and stored with a single
+ * vector access
+ */
+template <typename T, int N>
+struct alignas(sizeof(T) * N) aligned_vector {
+  T data[N];
+};
+
+/**
+ * @brief Returns whether the data of a vectorized transform of `N` elements per vector may be
+ * accessed through `aligned_vector`s
+ */
+template <int N, typename T>
+bool is_vector_aligned(T const* data)
+{
+  return reinterpret_cast<std::uintptr_t>(data) % sizeof(aligned_vector<T, N>) == 0;
+}
+
+/**
+ * @brief Returns whether `vectorized_transform` may process the given arrays.
+ *
+ * A transform is vectorized when several elements of its widest type fit in one vector access and
+ * every array is aligned to its vector size. Columns with an offset that breaks the alignment are
+ * processed element by element instead.
+ *
+ * @param out Output array
+ * @param in Input arrays
+ */
+template <typename Out, typename... In>
+bool can_vectorize(Out const* out, In const*... in)
+{
+  constexpr auto N = vector_width<Out, In...>();
+  if constexpr (N < 2) {
+    return false;
+  } else {
+    return is_vector_aligned<N>(out) && (is_vector_aligned<N>(in) && ...);
+  }
+}
+
+/**
+ * @brief Kernel applying `f` to the elements of the input arrays, `N` elements at a time
+ *
+ * Each thread loads a vector of `N` elements from every input and stores a vector of `N` results.
+ * The elements following the last complete vector are processed one by one.
+ */
+template <int N, typename Functor, typename Out, typename... In>
+CUDF_KERNEL void vectorized_transform_kernel(size_type size,
+                                             Functor f,
+                                             Out* __restrict__ out,
+                                             In const* __restrict__... in)
+{
+  auto const start       = grid_1d::global_thread_id();
+  auto const stride      = grid_1d::grid_stride();
+  auto const num_vectors = static_cast<thread_index_type>(size / N);
+
+  for (auto idx = start; idx < num_vectors; idx += stride) {
+    auto store = [&](aligned_vector<In, N> const&... values) {
+      aligned_vector<Out, N> result;
+#pragma unroll
+      for (int k = 0; k < N; ++k) {
+        result.data[k] = f(values.data[k]...);
+      }
+      reinterpret_cast<aligned_vector<Out, N>*>(out)[idx] = result;
+    };
+    store(reinterpret_cast<aligned_vector<In, N> const*>(in)[idx]...);
+  }
+  for (auto idx = num_vectors * N + start; idx < size; idx += stride) {
+    out[idx] = f(in[idx]...);
+  }
+}
+
+/**
+ * @brief Computes `out[i] = f(in[i]...)` for every row with vectorized loads and stores.
+ *
+ * The arrays must satisfy `can_vectorize`. Only the data is written; the caller computes the
+ * null mask of the output, usually with a word-level bitmask operation.
+ *
+ * @param size Number of elements
+ * @param f Device functor computing an output element from one element of each input
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param out Output array
+ * @param in Input arrays
+ */
+template <typename Functor, typename Out, typename... In>
+void vectorized_transform(
+  size_type size, Functor f, rmm::cuda_stream_view stream, Out* out, In const*... in)
+{
+  if (size == 0) { return; }
+  constexpr auto N          = vector_width<Out, In...>();
+  constexpr auto block_size = 256;
+  auto const config         = grid_1d{size, block_size, N};
+  vectorized_transform_kernel<N>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(size, f, out, in...);
+  CUDF_CHECK_CUDA(stream.value());
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -75,6 +75,15 @@ std::unique_ptr<column> decode(dictionary_column_view const& dictionary_column,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::dictionary::decode(dictionary_column_view const&,column_view const&,
+ * rmm::cuda_stream_view,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> decode(dictionary_column_view const& dictionary_column,
+                               column_view const& keys,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Return minimal integer type for the given number of elements.
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -83,6 +83,38 @@ std::unique_ptr<column> decode(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a column by gathering the rows of `keys` into a new column
+ * using the indices of the provided dictionary_column.
+ *
+ * The `keys` column is usually the result of an operation applied to the keys of the
+ * dictionary. This runs the operation once per key instead of once per row, for example:
+ *
+ * @code{.pseudo}
+ * d1 = {["abc", "bcd", "def"], [2, 0, 1, 0]}
+ * k = strings::contains_re(d1.keys(), regex_program::create("^[ab]"))
+ * k is now [true, true, false]
+ * s = decode(d1, k)
+ * s is now [false, true, true, true]
+ * @endcode
+ *
+ * The null mask of the output combines the nulls of the dictionary rows and of the
+ * gathered `keys` rows.
+ *
+ * @throw std::invalid_argument if `keys.size() != dictionary_column.keys_size()`
+ *
+ * @param dictionary_column Existing dictionary column
+ * @param keys Column with one row for each key of the dictionary
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New column with type matching `keys`
+ */
+std::unique_ptr<column> decode(
+  dictionary_column_view const& dictionary_column,
+  column_view const& keys,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace dictionary
 }  // namespace cudf
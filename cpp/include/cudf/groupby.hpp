@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,20 +17,29 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/ast/expressions.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/replace.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
 namespace cudf {
+namespace detail {
+struct spilled_table;
+
+}  // namespace detail
+
 //! `groupby` APIs
 namespace groupby {
 namespace detail {
@@ -38,6 +47,10 @@ namespace sort {
 class sort_groupby_helper;
 
 }  // namespace sort
+namespace hash {
+struct key_groups;
+
+}  // namespace hash
 }  // namespace detail
 
 /**
@@ -108,6 +121,16 @@ class groupby {
    * order of each column and null order in  `column_order` and
    * `null_precedence`, respectively.
    *
+   * With `keys_are_sorted == YES`, group boundaries are found by comparing adjacent rows, so it is
+   * sufficient for the keys to be clustered: equal rows are contiguous, but the groups themselves
+   * may appear in any order. The groups are then aggregated in place, without sorting or
+   * gathering the keys and values. The groups are returned in the order they appear in `keys`.
+   * If null keys are excluded and `keys` contains nulls, the keys are sorted regardless.
+   *
+   * If the same object runs several hash-based aggregations, passing
+   * `cache_key_groups == true` keeps the group of each row found by the first of them, so the
+   * later ones skip hashing the keys. The cache holds one index per row in device memory.
+   *
    * @note This object does *not* maintain the lifetime of `keys`. It is the
    * user's responsibility to ensure the `groupby` object does not outlive the
    * data viewed by the `keys` `table_view`.
@@ -115,19 +138,22 @@ class groupby {
    * @param keys Table whose rows act as the groupby keys
    * @param null_handling Indicates whether rows in `keys` that contain
    * NULL values should be included
-   * @param keys_are_sorted Indicates whether rows in `keys` are already sorted
+   * @param keys_are_sorted Indicates whether rows in `keys` are already sorted or clustered
    * @param column_order If `keys_are_sorted == YES`, indicates whether each
    * column is ascending/descending. If empty, assumes all  columns are
    * ascending. Ignored if `keys_are_sorted == false`.
    * @param null_precedence If `keys_are_sorted == YES`, indicates the ordering
    * of null values in each column. Else, ignored. If empty, assumes all columns
    * use `null_order::AFTER`. Ignored if `keys_are_sorted == false`.
+   * @param cache_key_groups Whether hash-based aggregations reuse the groups of the rows found by
+   * the first of them
    */
   explicit groupby(table_view const& keys,
                    null_policy null_handling                      = null_policy::EXCLUDE,
                    sorted keys_are_sorted                         = sorted::NO,
                    std::vector<order> const& column_order         = {},
-                   std::vector<null_order> const& null_precedence = {});
+                   std::vector<null_order> const& null_precedence = {},
+                   bool cache_key_groups                          = false);
 
   /**
    * @brief Performs grouped aggregations on the specified values.
@@ -195,6 +221,79 @@ class groupby {
     host_span<aggregation_request const> requests,
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Estimates the device memory used by `aggregate` on the requests.
+   *
+   * The estimate assumes that every key is distinct, which bounds the number of groups, and
+   * accounts for the hash-based or the sort-based implementation, whichever `aggregate` would
+   * use. Sizes of strings and nested columns are measured on the device, which synchronizes
+   * `stream`.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() != keys.num_rows()`.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to perform
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The estimated device memory of the aggregation
+   */
+  [[nodiscard]] memory_estimate estimate_memory(
+    host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * @brief Performs grouped aggregations on the rows for which a predicate is true.
+   *
+   * Same as `aggregate`, except that only the rows `i` for which `filter` evaluates to true on
+   * row `i` of `filter_table` are aggregated. The rows for which it is false or null are skipped,
+   * and the groups without any aggregated row are not returned.
+   *
+   * The hash-based implementation skips the filtered rows in its aggregation kernels, so the
+   * pipeline `apply_boolean_mask` -> `compute_column` -> `aggregate` runs without materializing
+   * the filtered table: the values to aggregate may be computed from all the rows, e.g. with
+   * `cudf::compute_column`, and are only read for the rows that pass the filter. The
+   * sort-based implementation aggregates the filtered copy of the keys and values instead.
+   *
+   * The groups of the rows cached with `cache_key_groups` are neither used nor updated.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() != keys.num_rows()`.
+   * @throws std::invalid_argument If `filter_table.num_rows() != keys.num_rows()`.
+   * @throws cudf::logic_error If `filter` does not evaluate to a BOOL8 column.
+   *
+   * Example:
+   * ```
+   * Input:
+   * keys:     {1 2 1 3 1}
+   * filter_table:
+   *   column 0: {5 1 7 2 8}
+   * filter:   column 0 > 4
+   * request:
+   *   values: {3 1 4 9 2}
+   *   aggregations: {{SUM}}
+   *
+   * result:
+   *
+   * keys:  {1}
+   * values:
+   *   SUM: {9}
+   * ```
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param filter_table The table the column references of `filter` refer to
+   * @param filter The predicate selecting the rows to aggregate
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
+    host_span<aggregation_request const> requests,
+    table_view const& filter_table,
+    ast::expression const& filter,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
   /**
    * @brief Performs grouped scans on the specified values.
    *
@@ -388,6 +487,10 @@ class groupby {
   std::unique_ptr<detail::sort::sort_groupby_helper>
     _helper;  ///< Helper object
               ///< used by sort based implementation
+  bool _cache_key_groups{false};  ///< Whether the hash-based implementation caches the groups
+  std::unique_ptr<detail::hash::key_groups>
+    _key_groups;  ///< Groups of the rows cached by
+                  ///< the hash based implementation
 
   /**
    * @brief Get the sort helper object
@@ -417,6 +520,240 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Groups values by keys and computes aggregations on those groups, for keys and values
+ * delivered in batches.
+ *
+ * Each batch is first reduced to the partial aggregation states of its own groups, e.g. a SUM and
+ * a COUNT_VALID for a MEAN, or the (COUNT_VALID, MEAN, M2) structs of a VARIANCE. The unique keys
+ * and their states are kept between batches, one slot per group, along with a device hash map from
+ * the keys to their slot. The groups of a batch are looked up in the map: the states of the groups
+ * seen before are merged into their slot in place, and the new groups are appended. The groups
+ * seen so far are never regrouped. Fixed-width states (SUM, PRODUCT, MIN, MAX, COUNT and the
+ * MERGE_M2 structs) are updated in place; the other states (MERGE_LISTS, MERGE_SETS,
+ * MERGE_TDIGEST...) are merged for the slots of the batch only and scattered back. `finalize`
+ * computes the requested aggregations from the merged states.
+ *
+ * The supported aggregations are SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, MEAN, M2,
+ * VARIANCE, STD, COLLECT_LIST, COLLECT_SET, TDIGEST and HLLPP.
+ *
+ * Example:
+ * ```
+ * aggregations: {{SUM, MEAN}}
+ *
+ * add_batch(keys: {1 2 1}, values: {{1 2 3}})
+ * add_batch(keys: {2 3},   values: {{4 5}})
+ *
+ * finalize():
+ * keys:  {1 2 3}
+ * values:
+ *   SUM:  {4 6 5}
+ *   MEAN: {2 3 5}
+ * ```
+ */
+class streaming_aggregator {
+ public:
+  streaming_aggregator() = delete;
+  ~streaming_aggregator();
+  streaming_aggregator(streaming_aggregator const&) = delete;
+  streaming_aggregator(streaming_aggregator&&);
+  streaming_aggregator& operator=(streaming_aggregator const&) = delete;
+  streaming_aggregator& operator=(streaming_aggregator&&);
+
+  /**
+   * @brief Constructs an aggregator with the aggregations to compute on each column of values.
+   *
+   * @throws cudf::logic_error If an aggregation is not supported
+   *
+   * @param aggregations The aggregations of each column of values, in the order of the values
+   * given to `add_batch`
+   * @param null_handling Indicates whether rows in the keys that contain NULL values should be
+   * included
+   */
+  explicit streaming_aggregator(
+    std::vector<std::vector<std::unique_ptr<groupby_aggregation>>> aggregations,
+    null_policy null_handling = null_policy::EXCLUDE);
+
+  /**
+   * @brief Aggregates a batch of keys and values into the groups of the previous batches.
+   *
+   * @throws cudf::logic_error If the number of value columns differs from the number of
+   * aggregation lists, or any of them has a different number of rows than `keys`
+   * @throws cudf::logic_error If the types of the keys or values differ from the previous batches
+   *
+   * @param keys The keys of the batch
+   * @param values The columns of values of the batch
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add_batch(table_view const& keys,
+                 host_span<column_view const> values,
+                 rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Computes the aggregations of the groups of all the batches added so far.
+   *
+   * More batches can be added afterwards.
+   *
+   * @throws cudf::logic_error If no batch was added
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and an `aggregation_result` for
+   * each column of values, with the results in the order of its aggregations
+   */
+  [[nodiscard]] std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the number of groups of the batches added so far.
+   *
+   * @return The number of groups
+   */
+  [[nodiscard]] size_type num_groups() const;
+
+ private:
+  null_policy _include_null_keys;                ///< Whether to include rows in keys with NULLs
+  std::vector<std::vector<std::unique_ptr<groupby_aggregation>>>
+    _aggregations;                               ///< Aggregations of each column of values
+  std::vector<data_type> _value_types;           ///< Types of the values of the first batch
+  std::unique_ptr<table> _keys;                  ///< Unique keys of the batches added so far
+  std::vector<std::unique_ptr<column>> _states;  ///< Partial states of all the aggregations
+
+  struct slot_map;
+  std::unique_ptr<slot_map> _slot_map;  ///< Map from the unique keys to their row, i.e. slot
+};
+
+/**
+ * @brief Groups values by keys and computes aggregations on those groups, for keys and values
+ * delivered in batches that do not fit in device memory together.
+ *
+ * The rows of each batch are hash-partitioned on their keys into `num_partitions` buckets, which
+ * are copied to host memory. All the rows of a group are thus in the same bucket, and every
+ * bucket is aggregated independently of the others: its batches are copied back to the device,
+ * concatenated, and aggregated with a regular `groupby`. Buckets whose rows and hash table are
+ * estimated to exceed `memory_budget` bytes, e.g. because of skewed keys, are partitioned again
+ * with a different hash seed, up to a fixed depth.
+ *
+ * Unlike `streaming_aggregator`, whose state grows with the number of groups, the device memory
+ * used here is bounded by the size of the batches and of the buckets, so this also supports
+ * aggregations with about as many groups as rows. The results of each partition can be consumed
+ * one at a time with `aggregate_partition`, or all at once with `finalize`. The results are
+ * those of a `groupby` of all the batches, in an unspecified order of the groups, and any
+ * aggregation supported by `groupby::aggregate` may be requested. The rows of a group are not
+ * aggregated in the order of the batches, e.g. for COLLECT_LIST.
+ *
+ * Example:
+ * ```
+ * aggregations: {{SUM, MEAN}}, num_partitions: 2
+ *
+ * add_batch(keys: {1 2 1}, values: {{1 2 3}})
+ * add_batch(keys: {2 3},   values: {{4 5}})
+ *
+ * finalize(), e.g. with the key 2 in the first partition and the keys 1 and 3 in the second one:
+ * keys:  {2 1 3}
+ * values:
+ *   SUM:  {6 4 5}
+ *   MEAN: {3 2 5}
+ * ```
+ */
+class partitioned_groupby {
+ public:
+  partitioned_groupby() = delete;
+  ~partitioned_groupby();
+  partitioned_groupby(partitioned_groupby const&) = delete;
+  partitioned_groupby(partitioned_groupby&&);
+  partitioned_groupby& operator=(partitioned_groupby const&) = delete;
+  partitioned_groupby& operator=(partitioned_groupby&&);
+
+  /**
+   * @brief Constructs a partitioned groupby with the aggregations to compute on each column of
+   * values.
+   *
+   * @throws cudf::logic_error If `num_partitions` or `memory_budget` is not positive
+   *
+   * @param aggregations The aggregations of each column of values, in the order of the values
+   * given to `add_batch`
+   * @param num_partitions The number of partitions the rows of the batches are hashed into
+   * @param memory_budget Device memory in bytes that the aggregation of a partition may use
+   * @param null_handling Indicates whether rows in the keys that contain NULL values should be
+   * included
+   */
+  partitioned_groupby(std::vector<std::vector<std::unique_ptr<groupby_aggregation>>> aggregations,
+                      size_type num_partitions,
+                      std::size_t memory_budget,
+                      null_policy null_handling = null_policy::EXCLUDE);
+
+  /**
+   * @brief Partitions a batch of keys and values and spills its partitions to host memory.
+   *
+   * @throws cudf::logic_error If the number of value columns differs from the number of
+   * aggregation lists, or any of them has a different number of rows than `keys`
+   * @throws cudf::logic_error If the types of the keys or values differ from the previous batches
+   *
+   * @param keys The keys of the batch
+   * @param values The columns of values of the batch
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add_batch(table_view const& keys,
+                 host_span<column_view const> values,
+                 rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Computes the aggregations of the groups of one partition of the batches added so far.
+   *
+   * @throws std::out_of_range If `partition` is not in `[0, num_partitions())`
+   * @throws cudf::logic_error If no batch was added
+   *
+   * @param partition The index of the partition to aggregate
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with the unique keys of the partition's groups and an
+   * `aggregation_result` for each column of values, with the results in the order of its
+   * aggregations
+   */
+  [[nodiscard]] std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+  aggregate_partition(
+    size_type partition,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Computes the aggregations of the groups of all the batches added so far.
+   *
+   * The results of the partitions are concatenated in the order of the partitions. More batches
+   * can be added afterwards.
+   *
+   * @throws cudf::logic_error If no batch was added
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and an `aggregation_result` for
+   * each column of values, with the results in the order of its aggregations
+   */
+  [[nodiscard]] std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the number of partitions the rows of the batches are hashed into.
+   *
+   * @return The number of partitions
+   */
+  [[nodiscard]] size_type num_partitions() const { return _num_partitions; }
+
+ private:
+  null_policy _include_null_keys;  ///< Whether to include rows in keys with NULLs
+  std::vector<std::vector<std::unique_ptr<groupby_aggregation>>>
+    _aggregations;                ///< Aggregations of each column of values
+  size_type _num_partitions;      ///< Number of partitions of the batches
+  std::size_t _memory_budget;     ///< Device memory that the aggregation of a partition may use
+  size_type _num_keys{0};         ///< Number of key columns of the batches
+  std::vector<data_type> _types;  ///< Types of the keys and values of the first batch
+  std::vector<std::vector<cudf::detail::spilled_table>>
+    _partitions;  ///< Spilled tables of each partition, one per batch
+};
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
@@ -42,7 +42,8 @@ enum class hash_id {
   HASH_IDENTITY = 0,   ///< Identity hash function that simply returns the key to be hashed
   HASH_MURMUR3,        ///< Murmur3 hash function
   HASH_SPARK_MURMUR3,  ///< Spark Murmur3 hash function
-  HASH_MD5             ///< MD5 hash function
+  HASH_MD5,            ///< MD5 hash function
+  HASH_XXHASH64        ///< xxHash64 hash function
 };
 
 /**
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/hashing.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda/std/array>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace cudf::hashing::detail {
+
+/**
+ * @brief Computes the hash values of the rows of a table, specialized for small tables of
+ * non-nullable integer columns of a single type.
+ *
+ * Rows of such tables are hashed with the column type known at compile time, without dispatching
+ * on the type and checking for nested columns and nulls per element. The hash values are the ones
+ * of `RowHasher`, which hashes the rows of any other table.
+ *
+ * @tparam hash_function Hash functor to use for hashing elements, as used by `RowHasher`
+ * @tparam RowHasher Device row hasher of the generic row hashing path
+ */
+template <template <typename> class hash_function, typename RowHasher>
+class fixed_width_row_hasher {
+ public:
+  /// The maximum number of columns of the specialized path
+  static constexpr size_type max_columns = 4;
+
+  /**
+   * @brief Constructs a row hasher for the rows of `input`.
+   *
+   * @param input The table to hash
+   * @param row_hasher The generic device row hasher of `input`, used for the tables that are not
+   *        specialized
+   * @param seed The seed used by `row_hasher`
+   */
+  fixed_width_row_hasher(table_view const& input, RowHasher row_hasher, uint32_t seed)
+    : _row_hasher{row_hasher}, _seed{seed}
+  {
+    if (input.num_columns() == 0 or input.num_columns() > max_columns or has_nulls(input)) {
+      return;
+    }
+    auto const type = input.column(0).type().id();
+    if (type != type_id::INT32 and type != type_id::INT64 and type != type_id::UINT32 and
+        type != type_id::UINT64) {
+      return;
+    }
+    if (std::any_of(input.begin(), input.end(), [type](auto const& col) {
+          return col.type().id() != type;
+        })) {
+      return;
+    }
+    auto const size = size_of(input.column(0).type());
+    _type           = type;
+    _num_columns    = input.num_columns();
+    for (size_type i = 0; i < _num_columns; ++i) {
+      auto const& col = input.column(i);
+      _columns[i]     = col.head<char>() + static_cast<std::size_t>(col.offset()) * size;
+    }
+  }
+
+  /**
+   * @brief Returns the hash value of a row.
+   *
+   * @param row_index The row index to compute the hash value of
+   * @return The hash value of the row
+   */
+  __device__ hash_value_type operator()(size_type row_index) const noexcept
+  {
+    switch (_type) {
+      case type_id::INT32: return hash_row<int32_t>(row_index);
+      case type_id::INT64: return hash_row<int64_t>(row_index);
+      case type_id::UINT32: return hash_row<uint32_t>(row_index);
+      case type_id::UINT64: return hash_row<uint64_t>(row_index);
+      default: return _row_hasher(row_index);
+    }
+  }
+
+ private:
+  template <typename T>
+  __device__ hash_value_type hash_row(size_type row_index) const noexcept
+  {
+    auto hash = hash_value_type{_seed};
+#pragma unroll
+    for (size_type i = 0; i < max_columns; ++i) {
+      if (i < _num_columns) {
+        auto const value = static_cast<T const*>(_columns[i])[row_index];
+        hash             = hash_combine(hash, hash_function<T>{_seed}(value));
+      }
+    }
+    return hash;
+  }
+
+  RowHasher _row_hasher;
+  uint32_t _seed;
+  type_id _type{type_id::EMPTY};
+  size_type _num_columns{0};
+  cuda::std::array<void const*, max_columns> _columns{};
+};
+
+/**
+ * @brief Creates a `fixed_width_row_hasher` for the rows of `input`.
+ *
+ * @tparam hash_function Hash functor to use for hashing elements, as used by `row_hasher`
+ * @param input The table to hash
+ * @param row_hasher The generic device row hasher of `input`
+ * @param seed The seed used by `row_hasher`
+ * @return The row hasher
+ */
+template <template <typename> class hash_function, typename RowHasher>
+auto make_fixed_width_row_hasher(table_view const& input,
+                                 RowHasher row_hasher,
+                                 uint32_t seed = DEFAULT_HASH_SEED)
+{
+  return fixed_width_row_hasher<hash_function, RowHasher>{input, row_hasher, seed};
+}
+
+}  // namespace cudf::hashing::detail
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #pragma nv_diag_suppress 2810
 #endif
 #include <arrow/api.h>
+#include <arrow/c/abi.h>
 #ifdef __CUDACC__
 #pragma nv_diag_default 611
 #pragma nv_diag_default 2810
@@ -34,9 +35,14 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <future>
+#include <memory>
+#include <vector>
+
 struct DLManagedTensor;
 
 namespace cudf {
@@ -89,6 +95,28 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Convert a cudf table into a row-major (C order) DLPack DLTensor
+ *
+ * Same as `cudf::to_dlpack`, except that the rows of the table are contiguous in the tensor.
+ * The tensor is written by a tiled transpose of the columns, e.g. to pass a wide table as a
+ * dense matrix to libraries that expect row-major data.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the memory allocated for the tensor.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric,
+ * or if any of columns have non-zero null count
+ *
+ * @param input Table to convert to DLPack
+ * @param mr Device memory resource used to allocate the returned DLPack tensor's device memory
+ *
+ * @return 1D or 2D DLPack tensor with a copy of the table data, or nullptr
+ */
+DLManagedTensor* to_dlpack_row_major(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 /**
@@ -141,6 +169,30 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
                                        rmm::cuda_stream_view stream = cudf::get_default_stream(),
                                        arrow::MemoryPool* ar_mr     = arrow::default_memory_pool());
 
+/**
+ * @brief Asynchronously create `arrow::Table` from cudf table `input`
+ *
+ * Like `to_arrow`, except that the function returns once the device-to-host copies are issued
+ * on `stream`. The buffers of all the columns are copied together through one pinned transfer,
+ * staged in memory from `cudf::io::get_host_memory_resource()`.
+ *
+ * The device memory of `input` must not be modified or freed until the returned future is
+ * ready, unless in stream order on `stream`.
+ *
+ * @throws cudf::logic_error if `column_names` size doesn't match with number of columns.
+ *
+ * @param input table_view that needs to be converted to arrow Table
+ * @param metadata Contains hierarchy of names of columns and children
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param ar_mr arrow memory pool to allocate memory for arrow Table
+ * @return Future of the arrow Table generated from `input`, ready once its data is copied
+ */
+std::future<std::shared_ptr<arrow::Table>> to_arrow_async(
+  table_view input,
+  std::vector<column_metadata> const& metadata = {},
+  rmm::cuda_stream_view stream                 = cudf::get_default_stream(),
+  arrow::MemoryPool* ar_mr                     = arrow::default_memory_pool());
+
 /**
  * @brief Create `arrow::Scalar` from cudf scalar `input`
  *
@@ -190,5 +242,131 @@ std::unique_ptr<cudf::scalar> from_arrow(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Owning pointer to an `ArrowSchema`, released with its `release` callback
+ */
+using unique_schema_t = std::unique_ptr<ArrowSchema, void (*)(ArrowSchema*)>;
+
+/**
+ * @brief Owning pointer to an `ArrowDeviceArray`, released with its `release` callback
+ */
+using unique_device_array_t = std::unique_ptr<ArrowDeviceArray, void (*)(ArrowDeviceArray*)>;
+
+/**
+ * @brief Deleter of a view that owns the device memory of the columns it was converted into.
+ *
+ * @tparam ViewType The type of the view
+ */
+template <typename ViewType>
+struct custom_view_deleter {
+  /**
+   * @brief Construct a new custom view deleter object
+   *
+   * @param owned Columns backing the view
+   */
+  explicit custom_view_deleter(std::vector<std::unique_ptr<column>>&& owned)
+    : owned_mem_{std::move(owned)}
+  {
+  }
+
+  /**
+   * @brief Deletes the view, along with the columns backing it
+   *
+   * @param ptr The view to delete
+   */
+  void operator()(ViewType* ptr) const { delete ptr; }
+
+  std::vector<std::unique_ptr<column>> owned_mem_;  ///< Columns backing the view
+};
+
+/**
+ * @brief A `table_view` of Arrow device data, along with the columns converted for it
+ */
+using unique_table_view_t = std::unique_ptr<table_view, custom_view_deleter<table_view>>;
+
+/**
+ * @brief Create an `ArrowSchema` describing the columns of `input`.
+ *
+ * The schema describes the arrays produced by `to_arrow_device` for `input`: a struct whose
+ * children are the columns of `input`.
+ *
+ * @throws cudf::logic_error If `metadata` is not empty and does not have one entry per column
+ * @throws cudf::logic_error If a column type has no Arrow device equivalent, i.e. a dictionary
+ * or a duration in days
+ *
+ * @param input The table to describe
+ * @param metadata Names of the columns and their children, may be empty
+ * @return The Arrow schema of `input`
+ */
+unique_schema_t to_arrow_schema(cudf::table_view const& input,
+                                cudf::host_span<column_metadata const> metadata);
+
+/**
+ * @brief Create an `ArrowDeviceArray` sharing the device memory of `table`.
+ *
+ * The array is a struct whose children are the columns of `table`, described by
+ * `to_arrow_schema`. The device buffers of the columns are handed over without copies; the
+ * table is owned by the array and freed by its `release` callback.
+ *
+ * Booleans are converted to Arrow bitmaps, and 32 and 64-bit decimals to 128-bit decimals,
+ * since their layout is different in Arrow. Only these columns are copied.
+ *
+ * The `sync_event` of the array is recorded on `stream` after the conversions.
+ *
+ * @throws cudf::logic_error If a column type has no Arrow device equivalent, i.e. a dictionary
+ * or a duration in days
+ *
+ * @param table The table to export
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the converted columns
+ * @return The Arrow device array of `table`
+ */
+unique_device_array_t to_arrow_device(
+  cudf::table&& table,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create an `ArrowDeviceArray` viewing the device memory of `table`.
+ *
+ * Like `to_arrow_device(cudf::table&&)`, except that the data of `table` is not owned by the
+ * array: it must outlive the array and any Arrow consumer of it.
+ *
+ * @throws cudf::logic_error If a column type has no Arrow device equivalent, i.e. a dictionary
+ * or a duration in days
+ *
+ * @param table The table to export
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the converted columns
+ * @return The Arrow device array of `table`
+ */
+unique_device_array_t to_arrow_device(
+  cudf::table_view const& table,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a `table_view` of the device memory of an Arrow struct array.
+ *
+ * The columns of the view are the children of `input`, and point into its buffers without
+ * copies: `input` must outlive the view. Arrow booleans are converted to BOOL8 columns, which
+ * are owned by the returned view. `stream` waits on the `sync_event` of `input`, if any.
+ *
+ * @throws cudf::logic_error If `input` is not in CUDA device, pinned or managed memory of the
+ * current device
+ * @throws cudf::logic_error If `schema` is not a struct or a child type is not supported
+ *
+ * @param schema The Arrow schema of `input`
+ * @param input The Arrow device array to view
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the converted columns
+ * @return A view of the columns of `input`
+ */
+unique_table_view_t from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -132,6 +132,8 @@ class csv_reader_options {
   bool _dayfirst = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
+  // Number of rows sampled for type inference; all rows are used if zero
+  size_type _type_inference_sample_rows = 0;
 
   /**
    * @brief Constructor from source info.
@@ -470,6 +472,16 @@ class csv_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns the number of rows sampled to infer column types.
+   *
+   * @return Number of sampled rows; zero if all rows are used
+   */
+  [[nodiscard]] size_type get_type_inference_sample_rows() const
+  {
+    return _type_inference_sample_rows;
+  }
+
   /**
    * @brief Sets compression format of the source.
    *
@@ -813,6 +825,20 @@ class csv_reader_options {
    * @param type Dtype to which all timestamp column will be cast
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets the number of rows sampled to infer column types.
+   *
+   * The sampled rows are taken from several ranges spread through the data. If a sampled type
+   * turns out not to fit a value that is not null, the types are inferred again from all rows.
+   *
+   * @param rows Number of sampled rows; zero to use all rows
+   */
+  void set_type_inference_sample_rows(size_type rows)
+  {
+    CUDF_EXPECTS(rows >= 0, "Number of sampled rows cannot be negative");
+    _type_inference_sample_rows = rows;
+  }
 };
 
 /**
@@ -1281,6 +1307,18 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the number of rows sampled to infer column types.
+   *
+   * @param rows Number of sampled rows; zero to use all rows
+   * @return this for chaining
+   */
+  csv_reader_options_builder& type_inference_sample_rows(size_type rows)
+  {
+    options.set_type_inference_sample_rows(rows);
+    return *this;
+  }
+
   /**
    * @brief move csv_reader_options member once it's built.
    */
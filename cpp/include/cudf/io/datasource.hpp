@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 
 #include <future>
 #include <memory>
+#include <utility>
 
 namespace cudf {
 //! IO interfaces
@@ -85,6 +86,10 @@ class datasource {
   /**
    * @brief Creates a source from a file path.
    *
+   * `http://` and `https://` URLs, as well as `s3://` and `gs://` object paths, are read with
+   * parallel HTTP range requests when libcudf is built with `CUDF_ENABLE_REMOTE_IO`. The `offset`
+   * and `size` parameters are ignored for these sources.
+   *
    * @param[in] filepath Path to the file to use
    * @param[in] offset Bytes from the start of the file (the default is zero)
    * @param[in] size Bytes from the offset; use zero for entire file (the default is zero)
@@ -128,6 +133,26 @@ class datasource {
    */
   static std::unique_ptr<datasource> create(datasource* source);
 
+  /**
+   * @brief Creates a source that coalesces and prefetches reads from another source.
+   *
+   * Byte ranges passed to `prefetch()` are sorted and merged when they are at most `max_gap` bytes
+   * apart, then read from `source` concurrently on a pool of `num_threads` threads. At most
+   * `window_size` bytes are read ahead at any time; the remaining ranges are issued as the
+   * prefetched ranges are read, a merged read being released once every range merged into it has
+   * been read. Reads that are not covered by a prefetched range are forwarded to `source`.
+   *
+   * @param[in] source The source to read from (ownership is transferred)
+   * @param[in] max_gap Largest gap in bytes between two ranges that are merged into one read
+   * @param[in] window_size Maximum number of bytes read ahead of the consumer
+   * @param[in] num_threads Number of threads used to issue the reads
+   * @return Constructed datasource object
+   */
+  static std::unique_ptr<datasource> create_prefetching(std::unique_ptr<datasource> source,
+                                                        size_t max_gap     = 1ul << 20,
+                                                        size_t window_size = 256ul << 20,
+                                                        int num_threads    = 8);
+
   /**
    * @brief Creates a vector of datasources, one per element in the input vector.
    *
@@ -171,6 +196,16 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Hints that the given byte ranges will be read soon.
+   *
+   * Sources that prefetch data can use the hint to start reading the ranges ahead of the calls to
+   * `host_read()`/`device_read()`. The default implementation ignores the hint.
+   *
+   * @param ranges Offset and size of each byte range that is expected to be read
+   */
+  virtual void prefetch(cudf::host_span<std::pair<size_t, size_t> const> ranges) {}
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
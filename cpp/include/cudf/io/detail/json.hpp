@@ -16,10 +16,15 @@
 
 #pragma once
 
+#include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/table/table.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace cudf::io::json::detail {
 
 /**
@@ -37,6 +42,66 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
                               rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief The reader class that reads JSON Lines sources iteratively, one byte range at a time.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from a byte range size and an array of data sources with reader options.
+   *
+   * @param chunk_read_limit Number of input bytes to parse per read, or `0` to read each source
+   * at once
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_reader(std::size_t chunk_read_limit,
+                 std::vector<std::unique_ptr<datasource>>&& sources,
+                 json_reader_options options,
+                 rmm::cuda_stream_view stream,
+                 rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @copydoc cudf::io::chunked_json_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_json_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  /**
+   * @brief Move to the next byte range, skipping empty sources.
+   */
+  void advance();
+
+  /**
+   * @brief Reorder the columns of a chunk to match the schema of the first chunk.
+   *
+   * The first chunk read fixes the schema, and its column types are used to parse later chunks.
+   *
+   * @param chunk Table and metadata parsed from a byte range
+   * @return The chunk with the columns of the schema, in order
+   */
+  table_with_metadata conform_to_schema(table_with_metadata&& chunk);
+
+  std::size_t const _chunk_read_limit;
+  std::vector<std::unique_ptr<datasource>> _sources;
+  json_reader_options _options;
+  rmm::cuda_stream_view const _stream;
+  rmm::mr::device_memory_resource* const _mr;
+
+  std::size_t _source_idx{0};  // Index of the source of the next byte range
+  std::size_t _offset{0};      // Offset of the next byte range in its source
+
+  std::unique_ptr<table> _schema_columns;  // Empty columns with the types of the schema
+  table_metadata _schema_metadata;         // Names of the columns of the schema
+};
+
 /**
  * @brief Write an entire dataset to JSON format.
  *
@@ -73,4 +138,15 @@ rmm::device_uvector<char> normalize_single_quotes(rmm::device_uvector<char>&& in
 rmm::device_uvector<char> normalize_whitespace(rmm::device_uvector<char>&& inbuf,
                                                rmm::cuda_stream_view stream,
                                                rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Normalize empty values, e.g. the ones of `{"a":}` or `[1,,2]`, to `null` using FST
+ *
+ * @param inbuf Input device buffer
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation
+ */
+rmm::device_uvector<char> normalize_empty_values(rmm::device_uvector<char>&& inbuf,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr);
 }  // namespace cudf::io::json::detail
@@ -24,6 +24,7 @@
 #include <cudf/io/parquet_metadata.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -250,5 +251,34 @@ class writer {
  * metadata.
  */
 parquet_metadata read_parquet_metadata(host_span<std::unique_ptr<datasource> const> sources);
+
+/**
+ * @brief Reads the column chunk statistics of the row groups of parquet sources into a table.
+ *
+ * @param sources Dataset sources to read from
+ * @param options Settings for selecting the columns and row groups
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the returned table
+ * @return The statistics table along with its column names
+ */
+table_with_metadata read_statistics(host_span<std::unique_ptr<datasource> const> sources,
+                                    parquet_reader_options const& options,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Estimates the device memory used to read parquet sources.
+ *
+ * @param sources Dataset sources to read from
+ * @param options Settings for controlling reading behavior
+ * @return The estimated device memory of the read
+ */
+memory_estimate estimate_read_memory(host_span<std::unique_ptr<datasource> const> sources,
+                                     parquet_reader_options const& options);
+
+/**
+ * @copydoc cudf::io::clear_parquet_metadata_cache
+ */
+void clear_metadata_cache();
 }  // namespace parquet::detail
 }  // namespace cudf::io
@@ -24,12 +24,19 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
 
 namespace cudf {
 namespace io {
+
+// Forward declaration
+namespace json::detail {
+class chunked_reader;
+}  // namespace json::detail
+
 /**
  * @addtogroup io_readers
  * @{
@@ -100,6 +107,8 @@ class json_reader_options {
   bool _lines = false;
   // Parse mixed types as a string column
   bool _mixed_types_as_string = false;
+  // Read only the columns specified in dtypes
+  bool _prune_columns = false;
 
   // Bytes to skip from the start
   size_t _byte_range_offset = 0;
@@ -109,7 +118,7 @@ class json_reader_options {
   // Whether to parse dates as DD/MM versus MM/DD
   bool _dayfirst = false;
 
-  // Whether to use the legacy reader
+  // Whether to parse with the compatibility behaviors of the retired legacy reader
   bool _legacy = false;
 
   // Whether to keep the quote characters of string values
@@ -240,6 +249,17 @@ class json_reader_options {
    */
   bool is_enabled_mixed_types_as_string() const { return _mixed_types_as_string; }
 
+  /**
+   * @brief Whether to read only the columns specified in dtypes.
+   *
+   * Columns that are not specified in dtypes are not materialized, which lowers the memory
+   * footprint of reading wide records. For records, the nodes of unselected fields are dropped
+   * from the parsed tree before any column is built. Only applies to the nested JSON reader.
+   *
+   * @return `true` if the columns not specified in dtypes are skipped
+   */
+  bool is_enabled_prune_columns() const { return _prune_columns; }
+
   /**
    * @brief Whether to parse dates as DD/MM versus MM/DD.
    *
@@ -248,9 +268,15 @@ class json_reader_options {
   bool is_enabled_dayfirst() const { return _dayfirst; }
 
   /**
-   * @brief Whether the legacy reader should be used.
+   * @brief Whether the reader parses with the behaviors of the retired legacy reader.
    *
-   * @returns true if the legacy reader will be used, false otherwise
+   * The legacy reader has been retired and all inputs are read by the nested JSON reader. With
+   * this option, the reader keeps these behaviors of the legacy reader:
+   * - empty values, e.g. the ones of `{"a":}` or `[1,,2]`, are read as nulls
+   * - unquoted date-like values, e.g. `2020-01-01`, are inferred as timestamps
+   * - dtypes, if any, must be given for all columns
+   *
+   * @returns true if the legacy behaviors are enabled, false otherwise
    */
   bool is_enabled_legacy() const { return _legacy; }
 
@@ -315,14 +341,14 @@ class json_reader_options {
    *
    * @param offset Number of bytes of offset
    */
-  void set_byte_range_offset(size_type offset) { _byte_range_offset = offset; }
+  void set_byte_range_offset(size_t offset) { _byte_range_offset = offset; }
 
   /**
    * @brief Set number of bytes to read.
    *
    * @param size Number of bytes to read
    */
-  void set_byte_range_size(size_type size) { _byte_range_size = size; }
+  void set_byte_range_size(size_t size) { _byte_range_size = size; }
 
   /**
    * @brief Set whether to read the file as a json object per line.
@@ -339,6 +365,13 @@ class json_reader_options {
    */
   void enable_mixed_types_as_string(bool val) { _mixed_types_as_string = val; }
 
+  /**
+   * @brief Set whether to read only the columns specified in dtypes.
+   *
+   * @param val Boolean value to enable/disable column pruning
+   */
+  void enable_prune_columns(bool val) { _prune_columns = val; }
+
   /**
    * @brief Set whether to parse dates as DD/MM versus MM/DD.
    *
@@ -347,9 +380,11 @@ class json_reader_options {
   void enable_dayfirst(bool val) { _dayfirst = val; }
 
   /**
-   * @brief Set whether to use the legacy reader.
+   * @brief Set whether the reader parses with the behaviors of the retired legacy reader.
+   *
+   * @see is_enabled_legacy()
    *
-   * @param val Boolean value to enable/disable the legacy reader
+   * @param val Boolean value to enable/disable the legacy behaviors
    */
   void enable_legacy(bool val) { _legacy = val; }
 
@@ -460,7 +495,7 @@ class json_reader_options_builder {
    * @param offset Number of bytes of offset
    * @return this for chaining
    */
-  json_reader_options_builder& byte_range_offset(size_type offset)
+  json_reader_options_builder& byte_range_offset(size_t offset)
   {
     options._byte_range_offset = offset;
     return *this;
@@ -472,7 +507,7 @@ class json_reader_options_builder {
    * @param size Number of bytes to read
    * @return this for chaining
    */
-  json_reader_options_builder& byte_range_size(size_type size)
+  json_reader_options_builder& byte_range_size(size_t size)
   {
     options._byte_range_size = size;
     return *this;
@@ -503,6 +538,18 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Set whether to read only the columns specified in dtypes.
+   *
+   * @param val Boolean value to enable/disable column pruning
+   * @return this for chaining
+   */
+  json_reader_options_builder& prune_columns(bool val)
+  {
+    options._prune_columns = val;
+    return *this;
+  }
+
   /**
    * @brief Set whether to parse dates as DD/MM versus MM/DD.
    *
@@ -516,9 +563,11 @@ class json_reader_options_builder {
   }
 
   /**
-   * @brief Set whether to use the legacy reader.
+   * @brief Set whether the reader parses with the behaviors of the retired legacy reader.
    *
-   * @param val Boolean value to enable/disable legacy parsing
+   * @see json_reader_options::is_enabled_legacy()
+   *
+   * @param val Boolean value to enable/disable the legacy behaviors
    * @return this for chaining
    */
   json_reader_options_builder& legacy(bool val)
@@ -615,6 +664,84 @@ table_with_metadata read_json(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked JSON reader class to read a JSON Lines dataset iteratively into a series of
+ * tables, chunk by chunk.
+ *
+ * Each source is split into byte ranges of the given size, and each call to `read_chunk()` parses
+ * the records that start in the next non-empty byte range. A record that crosses the end of a
+ * range is read completely as part of that range, so memory use stays proportional to the chunk
+ * size instead of the source size.
+ *
+ * The columns of the first chunk fix the schema of all chunks: later chunks are parsed with the
+ * column types of the first chunk (unless `dtypes` are set in the options), columns missing from
+ * a chunk are returned as all nulls, and columns that first appear in a later chunk are not
+ * returned.
+ */
+class chunked_json_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_json_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `json_reader_options` parameter as in
+   * `cudf::read_json()`, and an additional parameter to specify the size of the byte range of
+   * the input parsed for each reading.
+   *
+   * @throw cudf::logic_error if the options are not for JSON Lines, set a byte range, or set a
+   * compression type
+   *
+   * @param chunk_read_limit Number of input bytes to parse per read, or `0` to read each source
+   * at once
+   * @param options The options used to read the JSON Lines sources
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_json_reader(
+    std::size_t chunk_read_limit,
+    json_reader_options options,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_json_reader();
+
+  /**
+   * @brief Check if there is any data in the given sources has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of records from the given sources.
+   *
+   * The sequence of returned tables, if concatenated by their order, contains all records of the
+   * sources, with the schema of the first chunk.
+   *
+   * An empty table will be returned if the given sources are empty, or all the data in the
+   * sources has been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::json::detail::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 
 /**
@@ -18,11 +18,14 @@
 
 #include <rmm/resource_ref.hpp>
 
+#include <cstddef>
+#include <optional>
+
 namespace cudf::io {
 
 /**
  * @brief Set the rmm resource to be used for host memory allocations by
- * cudf::detail::hostdevice_vector
+ * cudf::detail::hostdevice_vector and the other host staging buffers of libcudf
  *
  * hostdevice_vector is a utility class that uses a pair of host and device-side buffers for
  * bouncing state between the cpu and the gpu. The resource set with this function (typically a
@@ -41,4 +44,26 @@ rmm::host_async_resource_ref set_host_memory_resource(rmm::host_async_resource_r
  */
 rmm::host_async_resource_ref get_host_memory_resource();
 
+/**
+ * @brief Options to configure the default host memory resource
+ */
+struct host_mr_options {
+  std::optional<std::size_t> pool_size;  ///< Size of the pinned pool; defaults to 0.5% of the
+                                         ///< device memory, up to 100MB
+};
+
+/**
+ * @brief Configure the default host memory resource used by all host staging buffers.
+ *
+ * By default, staging buffers are allocated from a fixed-size pool of pinned memory created on
+ * first use; allocations that do not fit in the pool fall back to `cudaHostAlloc`. The
+ * `LIBCUDF_PINNED_POOL_SIZE` environment variable takes precedence over `opts.pool_size`, and a
+ * size of zero disables the pool.
+ *
+ * @param opts Options to configure the default host memory resource
+ * @return true if this call configured the default resource, false if a resource had already
+ * been created or set with `set_host_memory_resource`
+ */
+bool config_default_host_memory_resource(host_mr_options const& opts);
+
 }  // namespace cudf::io
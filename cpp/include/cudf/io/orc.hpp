@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -23,6 +24,7 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -40,6 +42,7 @@ namespace io {
 constexpr size_t default_stripe_size_bytes   = 64 * 1024 * 1024;  ///< 64MB default orc stripe size
 constexpr size_type default_stripe_size_rows = 1000000;  ///< 1M rows default orc stripe rows
 constexpr size_type default_row_index_stride = 10000;    ///< 10K rows default orc row index stride
+constexpr double default_bloom_filter_fpp    = 0.05;     ///< 5% default Bloom filter FPP
 
 /**
  * @brief Builds settings to use for `read_orc()`.
@@ -62,6 +65,9 @@ class orc_reader_options {
   // Rows to read; `nullopt` is all
   std::optional<size_type> _num_rows;
 
+  // Predicate filter as AST to filter output rows
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   // Whether to use row index to speed-up reading
   bool _use_index = true;
 
@@ -134,6 +140,13 @@ class orc_reader_options {
    */
   std::optional<size_type> const& get_num_rows() const { return _num_rows; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Whether to use row index to speed-up reading.
    *
@@ -219,6 +232,17 @@ class orc_reader_options {
     _num_rows = nrows;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * Column references in the filter refer to the columns of the output table. Stripes whose
+   * statistics show that no row can satisfy the filter are not read, and the filter is applied to
+   * the rows of the remaining stripes. Stripes are only pruned when no row range is set.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
   /**
    * @brief Enable/Disable use of row index to speed-up reading.
    *
@@ -320,6 +344,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * @param filter AST expression to use as filter
+   * @return this for chaining
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Enable/Disable use of row index to speed-up reading.
    *
@@ -405,6 +441,100 @@ table_with_metadata read_orc(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked ORC reader class to read an ORC dataset iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * This class is designed to address the reading issue when reading very large ORC datasets that
+ * would not fit in device memory at once. The dataset is split into chunks of whole stripes so
+ * that both the size of each output table and the amount of stripe data loaded at a time stay
+ * within the given limits where possible.
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_orc_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `orc_reader_options` parameter as in
+   * `cudf::read_orc()`, and an additional parameter to specify the size byte limit of the
+   * output table for each reading.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param options The options used to read ORC file
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    orc_reader_options const& options,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `orc_reader_options` parameter as in
+   * `cudf::read_orc()`, with additional parameters to specify the size byte limit of the
+   * output table for each reading, and a byte limit on the amount of stripe data loaded into
+   * device memory for each reading. Both limits are hints, not absolute limits - if a single
+   * stripe cannot fit within the limits given, it will still be read as a whole.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   * or `0` if there is no limit
+   * @param pass_read_limit Limit on the amount of stripe data loaded per read, or `0` if there is
+   * no limit
+   * @param options The options used to read ORC file
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    std::size_t pass_read_limit,
+    orc_reader_options const& options,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Check if there is any data in the given dataset has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given ORC dataset.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given dataset at once.
+   *
+   * An empty table will be returned if the given dataset is empty, or all the data in the dataset
+   * has been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::orc::detail::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -455,6 +585,10 @@ class orc_writer_options {
   std::shared_ptr<writer_compression_statistics> _compression_stats;
   // Specify whether string dictionaries should be alphabetically sorted
   bool _enable_dictionary_sort = true;
+  // Names of the columns to write Bloom filters for
+  std::vector<std::string> _bloom_filter_columns;
+  // False positive probability of the Bloom filters
+  double _bloom_filter_fpp = default_bloom_filter_fpp;
 
   friend orc_writer_options_builder;
 
@@ -584,6 +718,23 @@ class orc_writer_options {
    */
   [[nodiscard]] bool get_enable_dictionary_sort() const { return _enable_dictionary_sort; }
 
+  /**
+   * @brief Returns the names of the columns to write Bloom filters for.
+   *
+   * @return Names of the Bloom filter columns
+   */
+  [[nodiscard]] std::vector<std::string> const& get_bloom_filter_columns() const
+  {
+    return _bloom_filter_columns;
+  }
+
+  /**
+   * @brief Returns the false positive probability of the Bloom filters.
+   *
+   * @return Bloom filter false positive probability
+   */
+  [[nodiscard]] double get_bloom_filter_fpp() const { return _bloom_filter_fpp; }
+
   // Setters
 
   /**
@@ -689,6 +840,33 @@ class orc_writer_options {
    * @param val Boolean value to enable/disable
    */
   void set_enable_dictionary_sort(bool val) { _enable_dictionary_sort = val; }
+
+  /**
+   * @brief Sets the names of the columns to write Bloom filters for.
+   *
+   * A Bloom filter is written for each row group of the listed columns, in a BLOOM_FILTER_UTF8
+   * stream. Nested columns are named by their full path, with the names of the levels separated
+   * by '.'. Only integral, floating-point, date and string columns support Bloom filters.
+   *
+   * @param columns Names of the Bloom filter columns
+   */
+  void set_bloom_filter_columns(std::vector<std::string> columns)
+  {
+    _bloom_filter_columns = std::move(columns);
+  }
+
+  /**
+   * @brief Sets the false positive probability of the Bloom filters.
+   *
+   * @param fpp Bloom filter false positive probability
+   *
+   * @throw cudf::logic_error if the probability is not in the (0, 1) range
+   */
+  void set_bloom_filter_fpp(double fpp)
+  {
+    CUDF_EXPECTS(fpp > 0 and fpp < 1, "Bloom filter false positive probability must be in (0, 1)");
+    _bloom_filter_fpp = fpp;
+  }
 };
 
 /**
@@ -841,6 +1019,30 @@ class orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the names of the columns to write Bloom filters for.
+   *
+   * @param columns Names of the Bloom filter columns
+   * @return this for chaining
+   */
+  orc_writer_options_builder& bloom_filter_columns(std::vector<std::string> columns)
+  {
+    options.set_bloom_filter_columns(std::move(columns));
+    return *this;
+  }
+
+  /**
+   * @brief Sets the false positive probability of the Bloom filters.
+   *
+   * @param fpp Bloom filter false positive probability
+   * @return this for chaining
+   */
+  orc_writer_options_builder& bloom_filter_fpp(double fpp)
+  {
+    options.set_bloom_filter_fpp(fpp);
+    return *this;
+  }
+
   /**
    * @brief move orc_writer_options member once it's built.
    */
@@ -901,6 +1103,10 @@ class chunked_orc_writer_options {
   std::shared_ptr<writer_compression_statistics> _compression_stats;
   // Specify whether string dictionaries should be alphabetically sorted
   bool _enable_dictionary_sort = true;
+  // Names of the columns to write Bloom filters for
+  std::vector<std::string> _bloom_filter_columns;
+  // False positive probability of the Bloom filters
+  double _bloom_filter_fpp = default_bloom_filter_fpp;
 
   friend chunked_orc_writer_options_builder;
 
@@ -1008,6 +1214,23 @@ class chunked_orc_writer_options {
    */
   [[nodiscard]] bool get_enable_dictionary_sort() const { return _enable_dictionary_sort; }
 
+  /**
+   * @brief Returns the names of the columns to write Bloom filters for.
+   *
+   * @return Names of the Bloom filter columns
+   */
+  [[nodiscard]] std::vector<std::string> const& get_bloom_filter_columns() const
+  {
+    return _bloom_filter_columns;
+  }
+
+  /**
+   * @brief Returns the false positive probability of the Bloom filters.
+   *
+   * @return Bloom filter false positive probability
+   */
+  [[nodiscard]] double get_bloom_filter_fpp() const { return _bloom_filter_fpp; }
+
   // Setters
 
   /**
@@ -1106,6 +1329,33 @@ class chunked_orc_writer_options {
    * @param val Boolean value to enable/disable
    */
   void set_enable_dictionary_sort(bool val) { _enable_dictionary_sort = val; }
+
+  /**
+   * @brief Sets the names of the columns to write Bloom filters for.
+   *
+   * A Bloom filter is written for each row group of the listed columns, in a BLOOM_FILTER_UTF8
+   * stream. Nested columns are named by their full path, with the names of the levels separated
+   * by '.'. Only integral, floating-point, date and string columns support Bloom filters.
+   *
+   * @param columns Names of the Bloom filter columns
+   */
+  void set_bloom_filter_columns(std::vector<std::string> columns)
+  {
+    _bloom_filter_columns = std::move(columns);
+  }
+
+  /**
+   * @brief Sets the false positive probability of the Bloom filters.
+   *
+   * @param fpp Bloom filter false positive probability
+   *
+   * @throw cudf::logic_error if the probability is not in the (0, 1) range
+   */
+  void set_bloom_filter_fpp(double fpp)
+  {
+    CUDF_EXPECTS(fpp > 0 and fpp < 1, "Bloom filter false positive probability must be in (0, 1)");
+    _bloom_filter_fpp = fpp;
+  }
 };
 
 /**
@@ -1244,6 +1494,30 @@ class chunked_orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the names of the columns to write Bloom filters for.
+   *
+   * @param columns Names of the Bloom filter columns
+   * @return this for chaining
+   */
+  chunked_orc_writer_options_builder& bloom_filter_columns(std::vector<std::string> columns)
+  {
+    options.set_bloom_filter_columns(std::move(columns));
+    return *this;
+  }
+
+  /**
+   * @brief Sets the false positive probability of the Bloom filters.
+   *
+   * @param fpp Bloom filter false positive probability
+   * @return this for chaining
+   */
+  chunked_orc_writer_options_builder& bloom_filter_fpp(double fpp)
+  {
+    options.set_bloom_filter_fpp(fpp);
+    return *this;
+  }
+
   /**
    * @brief move chunked_orc_writer_options member once it's built.
    */
@@ -23,6 +23,9 @@
 
 #include <cudf/io/orc_types.hpp>
 #include <cudf/io/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <optional>
 #include <variant>
@@ -216,6 +219,34 @@ struct parsed_orc_statistics {
 parsed_orc_statistics read_parsed_orc_statistics(
   source_info const& src_info, rmm::cuda_stream_view stream = cudf::get_default_stream());
 
+/**
+ * @brief Reads the stripe-level statistics of an ORC dataset into a table, without reading the
+ * column data.
+ *
+ * @ingroup io_readers
+ *
+ * The table has a row per stripe. Its first column is the number of rows of the stripe, as
+ * `INT64`. Then each top-level column has three columns:
+ * - `<name>.min` and `<name>.max`, the minimum and maximum values: `INT64` for integers, `FLOAT64`
+ *   for floating point numbers, `STRING` for strings and decimals, `TIMESTAMP_DAYS` for dates and
+ *   `TIMESTAMP_MILLISECONDS` for timestamps, in UTC; all null `BOOL8` columns for the other types
+ * - `<name>.null_count`, the number of nulls, as `INT64`
+ *
+ * Statistics that are not in the file are null. The table can be used to prune files and stripes
+ * with `cudf::compute_column`.
+ *
+ * @param src_info Dataset source
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ *
+ * @return The statistics table along with its column names
+ */
+table_with_metadata read_orc_statistics(
+  source_info const& src_info,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Schema of an ORC column, including the nested columns.
  */
@@ -21,6 +21,7 @@
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
@@ -30,6 +31,12 @@
 #include <string>
 #include <vector>
 
+namespace cudf {
+// forward declaration
+class join_bloom_filter;
+class membership_index;
+}  // namespace cudf
+
 namespace cudf::io {
 /**
  * @addtogroup io_readers
@@ -62,9 +69,18 @@ class parquet_reader_options {
   int64_t _skip_rows = 0;
   // Number of rows to read; `nullopt` is all
   std::optional<size_type> _num_rows;
+  // Byte range of each source whose row groups are read; a size of 0 is the rest of the source
+  std::size_t _byte_range_offset = 0;
+  std::size_t _byte_range_size   = 0;
 
   // Predicate filter as AST to filter output rows.
   std::optional<std::reference_wrapper<ast::expression const>> _filter;
+  // Bloom filter of join keys to filter output rows, and the names of the key columns
+  std::optional<std::reference_wrapper<join_bloom_filter const>> _join_filter;
+  std::vector<std::string> _join_filter_columns;
+  // Membership index of the values to keep, and the name of the column holding them
+  std::optional<std::reference_wrapper<membership_index const>> _membership_filter;
+  std::string _membership_filter_column;
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
@@ -75,6 +91,17 @@ class parquet_reader_options {
 
   std::optional<std::vector<reader_column_schema>> _reader_column_schema;
 
+  // Whether to decode the filter columns before the other columns
+  bool _late_materialization = false;
+
+  // Whether to look up and store the parsed footers in the process-wide metadata cache
+  bool _use_metadata_cache = false;
+  // Metadata cache key of each source; file paths are keyed by their size and mtime if empty
+  std::vector<std::string> _metadata_cache_keys;
+
+  // Whether to read dictionary-encoded string columns as dictionary columns
+  bool _keep_dictionaries = false;
+
   /**
    * @brief Constructor from source info.
    *
@@ -164,6 +191,20 @@ class parquet_reader_options {
    */
   [[nodiscard]] auto const& get_row_groups() const { return _row_groups; }
 
+  /**
+   * @brief Returns the offset of the byte range whose row groups are read.
+   *
+   * @return Byte offset from the start of each source
+   */
+  [[nodiscard]] std::size_t get_byte_range_offset() const { return _byte_range_offset; }
+
+  /**
+   * @brief Returns the size of the byte range whose row groups are read.
+   *
+   * @return Number of bytes in the range, or `0` for the rest of each source
+   */
+  [[nodiscard]] std::size_t get_byte_range_size() const { return _byte_range_size; }
+
   /**
    * @brief Returns AST based filter for predicate pushdown.
    *
@@ -171,6 +212,37 @@ class parquet_reader_options {
    */
   [[nodiscard]] auto const& get_filter() const { return _filter; }
 
+  /**
+   * @brief Returns the join Bloom filter used to filter the output rows.
+   *
+   * @return Join Bloom filter to use as filter
+   */
+  [[nodiscard]] auto const& get_join_filter() const { return _join_filter; }
+
+  /**
+   * @brief Returns the names of the columns holding the keys checked against the join filter.
+   *
+   * @return Names of the join filter key columns
+   */
+  [[nodiscard]] auto const& get_join_filter_columns() const { return _join_filter_columns; }
+
+  /**
+   * @brief Returns the membership index used to filter the output rows.
+   *
+   * @return Membership index to use as filter
+   */
+  [[nodiscard]] auto const& get_membership_filter() const { return _membership_filter; }
+
+  /**
+   * @brief Returns the name of the column checked against the membership filter.
+   *
+   * @return Name of the membership filter column
+   */
+  [[nodiscard]] auto const& get_membership_filter_column() const
+  {
+    return _membership_filter_column;
+  }
+
   /**
    * @brief Returns timestamp type used to cast timestamp columns.
    *
@@ -178,6 +250,35 @@ class parquet_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns true/false depending on whether the filter columns are decoded first.
+   *
+   * @return `true` if late materialization is enabled
+   */
+  [[nodiscard]] bool is_enabled_late_materialization() const { return _late_materialization; }
+
+  /**
+   * @brief Returns true/false depending on whether the process-wide metadata cache is used.
+   *
+   * @return `true` if the metadata cache is used
+   */
+  [[nodiscard]] bool is_enabled_use_metadata_cache() const { return _use_metadata_cache; }
+
+  /**
+   * @brief Returns the user-supplied metadata cache keys.
+   *
+   * @return Metadata cache key of each source; empty if the keys are derived from the file paths
+   */
+  [[nodiscard]] auto const& get_metadata_cache_keys() const { return _metadata_cache_keys; }
+
+  /**
+   * @brief Returns true/false depending on whether dictionary-encoded string columns are read as
+   * dictionary columns.
+   *
+   * @return `true` if dictionary-encoded string columns are read as dictionary columns
+   */
+  [[nodiscard]] bool is_enabled_keep_dictionaries() const { return _keep_dictionaries; }
+
   /**
    * @brief Sets names of the columns to be read.
    *
@@ -192,6 +293,19 @@ class parquet_reader_options {
    */
   void set_row_groups(std::vector<std::vector<size_type>> row_groups);
 
+  /**
+   * @brief Sets the byte range of each source whose row groups are read.
+   *
+   * A row group is read if the midpoint of its column chunks lies within
+   * `[offset, offset + size)`, so consecutive byte ranges that cover a file read each of its row
+   * groups exactly once. This lets distributed readers split a file by bytes without reading its
+   * footer first. Can't be combined with `row_groups`, `skip_rows` or `num_rows`.
+   *
+   * @param offset Byte offset from the start of each source
+   * @param size Number of bytes in the range, or `0` for the rest of each source
+   */
+  void set_byte_range(std::size_t offset, std::size_t size);
+
   /**
    * @brief Sets AST based filter for predicate pushdown.
    *
@@ -199,6 +313,42 @@ class parquet_reader_options {
    */
   void set_filter(ast::expression const& filter) { _filter = filter; }
 
+  /**
+   * @brief Sets a join Bloom filter of the build keys of a later join, to only return the rows
+   * that may have a match.
+   *
+   * The key columns of the output rows are checked against the filter after decoding, like with
+   * `filter_by_bloom`. The key columns must be read and must have the types of the build keys. To
+   * also prune the row groups with their statistics, set a `filter` for the range of the build
+   * keys from `join_bloom_filter::min_key()` and `join_bloom_filter::max_key()`.
+   *
+   * @param filter Join Bloom filter; it must outlive the read
+   * @param key_columns Names of the output columns holding the keys, in the order of the build keys
+   */
+  void set_join_filter(join_bloom_filter const& filter, std::vector<std::string> key_columns)
+  {
+    _join_filter         = filter;
+    _join_filter_columns = std::move(key_columns);
+  }
+
+  /**
+   * @brief Sets a membership index of the values to keep, to only return the rows whose value of
+   * `column` is one of its keys.
+   *
+   * The row groups are pruned with the min/max statistics of `column` first: a row group is not
+   * read when none of the keys lie within its range. The rows of the remaining row groups are
+   * checked with `membership_index::contains` after decoding. The column must be read and must
+   * have the type of the keys.
+   *
+   * @param filter Membership index; it must outlive the read
+   * @param column Name of the output column holding the values
+   */
+  void set_membership_filter(membership_index const& filter, std::string column)
+  {
+    _membership_filter        = filter;
+    _membership_filter_column = std::move(column);
+  }
+
   /**
    * @brief Sets to enable/disable conversion of strings to categories.
    *
@@ -244,6 +394,57 @@ class parquet_reader_options {
    * @param type The timestamp data_type to which all timestamp columns need to be cast
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets to enable/disable late materialization of the non-filter columns.
+   *
+   * When enabled and a filter is set, the columns referenced by the filter are read and the filter
+   * is evaluated first. The remaining columns are then only read from the row groups that contain
+   * at least one matching row, skipping the pages of fixed-width columns that hold no matching
+   * row when page indexes are present. The decoded filter columns are reused for the output. This
+   * saves decoding wide payload columns for selective filters. Ignored when a custom row range is
+   * set or when the filter references all columns to be read.
+   *
+   * @param val Boolean value to enable/disable late materialization
+   */
+  void enable_late_materialization(bool val) { _late_materialization = val; }
+
+  /**
+   * @brief Sets to enable/disable the process-wide metadata cache.
+   *
+   * When enabled, the parsed footer of each source is looked up in a process-wide cache, and stored
+   * there on a miss; a hit skips both the footer read and its decoding. File paths are keyed by
+   * path, size and modification time. Other sources are only cached if keys are set with
+   * `set_metadata_cache_keys`.
+   *
+   * @param val Boolean value to enable/disable the metadata cache
+   */
+  void enable_use_metadata_cache(bool val) { _use_metadata_cache = val; }
+
+  /**
+   * @brief Sets the metadata cache keys of the sources.
+   *
+   * The key must change whenever the contents of the source change; an empty key disables caching
+   * for that source.
+   *
+   * @param keys Metadata cache key of each source
+   */
+  void set_metadata_cache_keys(std::vector<std::string> keys)
+  {
+    _metadata_cache_keys = std::move(keys);
+  }
+
+  /**
+   * @brief Sets to enable/disable reading dictionary-encoded string columns as dictionary columns.
+   *
+   * When enabled, a top-level string column whose pages are dictionary-encoded in every row group
+   * is read as a `DICTIONARY32` column instead of a `STRING` column. Only the dictionary pages are
+   * turned into strings; the rows are decoded as indices into the sorted, unique keys of all the
+   * row groups of the column. Other columns are read as usual.
+   *
+   * @param val Boolean value to enable/disable reading dictionary columns
+   */
+  void enable_keep_dictionaries(bool val) { _keep_dictionaries = val; }
 };
 
 /**
@@ -291,6 +492,19 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the byte range of each source whose row groups are read.
+   *
+   * @param offset Byte offset from the start of each source
+   * @param size Number of bytes in the range, or `0` for the rest of each source
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& byte_range(std::size_t offset, std::size_t size)
+  {
+    options.set_byte_range(offset, size);
+    return *this;
+  }
+
   /**
    * @brief Sets vector of individual row groups to read.
    *
@@ -303,6 +517,34 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets a join Bloom filter to only return the rows that may have a match in a later join.
+   *
+   * @param filter Join Bloom filter; it must outlive the read
+   * @param key_columns Names of the output columns holding the keys, in the order of the build keys
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& join_filter(join_bloom_filter const& filter,
+                                              std::vector<std::string> key_columns)
+  {
+    options.set_join_filter(filter, std::move(key_columns));
+    return *this;
+  }
+
+  /**
+   * @brief Sets a membership index to only return the rows whose value of `column` is a key.
+   *
+   * @param filter Membership index; it must outlive the read
+   * @param column Name of the output column holding the values
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& membership_filter(membership_index const& filter,
+                                                    std::string column)
+  {
+    options.set_membership_filter(filter, std::move(column));
+    return *this;
+  }
+
   /**
    * @brief Sets enable/disable conversion of strings to categories.
    *
@@ -375,6 +617,54 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable late materialization of the non-filter columns.
+   *
+   * @param val Boolean value to enable/disable late materialization
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& late_materialization(bool val)
+  {
+    options._late_materialization = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets to enable/disable the process-wide metadata cache.
+   *
+   * @param val Boolean value to enable/disable the metadata cache
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& use_metadata_cache(bool val)
+  {
+    options._use_metadata_cache = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the metadata cache keys of the sources.
+   *
+   * @param keys Metadata cache key of each source
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& metadata_cache_keys(std::vector<std::string> keys)
+  {
+    options._metadata_cache_keys = std::move(keys);
+    return *this;
+  }
+
+  /**
+   * @brief Sets to enable/disable reading dictionary-encoded string columns as dictionary columns.
+   *
+   * @param val Boolean value to enable/disable reading dictionary columns
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& keep_dictionaries(bool val)
+  {
+    options._keep_dictionaries = val;
+    return *this;
+  }
+
   /**
    * @brief move parquet_reader_options member once it's built.
    */
@@ -412,6 +702,54 @@ table_with_metadata read_parquet(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Estimates the device memory used by `read_parquet` with `options`, from the metadata of
+ * the sources.
+ *
+ * The temporary bytes cover the raw column chunks of the selected columns and row groups, and
+ * their decompressed pages. The output bytes are the larger of the uncompressed size of the
+ * column chunks and the decoded width of their values, so strings decoded from dictionaries may
+ * exceed them. Row groups pruned by the filter of `options` are still counted.
+ *
+ * @param options Settings for controlling reading behavior
+ * @return The estimated device memory of the read
+ */
+memory_estimate estimate_read_parquet_memory(parquet_reader_options const& options);
+
+/**
+ * @brief Reads the column chunk statistics of the row groups of a Parquet dataset into a table,
+ * without reading the column data.
+ *
+ * The table has a row per row group selected by `options`, in the order of the sources. Its first
+ * column is the number of rows of the row group, as `INT64`. Then each selected leaf column has
+ * four columns:
+ * - `<path>.min` and `<path>.max`, the minimum and maximum values in the type of the column in the
+ *   file; all null `BOOL8` columns for the types without statistics
+ * - `<path>.null_count`, the number of nulls, as `INT64`
+ * - `<path>.size`, the compressed size of the column chunk in bytes, as `INT64`
+ *
+ * `<path>` is the dot-separated path of the column in the Parquet schema. Statistics that are not
+ * in the file are null. The filter, type conversions and row bounds of `options` are not applied.
+ * The table can be used to prune files and row groups with `cudf::compute_column`.
+ *
+ * @param options Settings for selecting the columns and row groups
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ * @return The statistics table along with its column names
+ */
+table_with_metadata read_parquet_statistics(
+  parquet_reader_options const& options,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Removes all entries from the process-wide Parquet metadata cache.
+ *
+ * @see parquet_reader_options::enable_use_metadata_cache
+ */
+void clear_parquet_metadata_cache();
+
 /**
  * @brief The chunked parquet reader class to read Parquet file iteratively in to a series of
  * tables, chunk by chunk.
@@ -515,6 +853,15 @@ class chunked_parquet_reader {
  * @file
  */
 
+/**
+ * @brief A column by which the writer sorts the rows of each file before they are encoded.
+ */
+struct sorting_column {
+  size_type column_idx{};     //!< Index of the column in the input table
+  bool is_descending{false};  //!< True to sort in descending order
+  bool is_nulls_first{true};  //!< True to place the nulls first, whatever the order
+};
+
 class parquet_writer_options_builder;
 
 /**
@@ -563,6 +910,8 @@ class parquet_writer_options {
   std::shared_ptr<writer_compression_statistics> _compression_stats;
   // write V2 page headers?
   bool _v2_page_headers = false;
+  // Columns by which the rows of each file are sorted before they are encoded
+  std::vector<sorting_column> _sorting_columns;
 
   /**
    * @brief Constructor from sink and table.
@@ -761,6 +1110,13 @@ class parquet_writer_options {
    */
   [[nodiscard]] auto is_enabled_write_v2_headers() const { return _v2_page_headers; }
 
+  /**
+   * @brief Returns the columns by which the rows of each file are sorted.
+   *
+   * @return Columns by which the rows of each file are sorted
+   */
+  [[nodiscard]] auto const& get_sorting_columns() const { return _sorting_columns; }
+
   /**
    * @brief Sets partitions.
    *
@@ -892,6 +1248,20 @@ class parquet_writer_options {
    * @param val Boolean value to enable/disable writing of V2 page headers.
    */
   void enable_write_v2_headers(bool val) { _v2_page_headers = val; }
+
+  /**
+   * @brief Sets the columns by which the rows of each file are sorted before they are encoded.
+   *
+   * Clustering equal and close values makes the encoding more compact and narrows the
+   * statistics of the row groups and pages, so that readers skip more of them. The rows of each
+   * call to `write()` are sorted separately.
+   *
+   * @param sorting_columns Columns by which the rows are sorted, in order of precedence
+   */
+  void set_sorting_columns(std::vector<sorting_column> sorting_columns)
+  {
+    _sorting_columns = std::move(sorting_columns);
+  }
 };
 
 /**
@@ -1143,6 +1513,18 @@ class parquet_writer_options_builder {
    */
   parquet_writer_options_builder& write_v2_headers(bool enabled);
 
+  /**
+   * @brief Sets the columns by which the rows of each file are sorted before they are encoded.
+   *
+   * @param sorting_columns Columns by which the rows are sorted, in order of precedence
+   * @return this for chaining
+   */
+  parquet_writer_options_builder& sorting_columns(std::vector<sorting_column> sorting_columns)
+  {
+    options.set_sorting_columns(std::move(sorting_columns));
+    return *this;
+  }
+
   /**
    * @brief move parquet_writer_options member once it's built.
    */
@@ -1189,6 +1571,40 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(
 std::unique_ptr<std::vector<uint8_t>> merge_row_group_metadata(
   std::vector<std::unique_ptr<std::vector<uint8_t>>> const& metadata_list);
 
+/**
+ * @brief Writes a table as a Hive-partitioned dataset of Parquet files.
+ *
+ * The rows are grouped on the device by the values of the `partition_by` columns, and the rows of
+ * each distinct key are written to `base_path/name1=value1/.../nameN=valueN/part-0.parquet`, where
+ * the names are those of the columns in the metadata of `options`. The partition columns are only
+ * encoded in the paths, not in the files. All the files are encoded by a single writer, so the
+ * encoding kernels of all partitions run together. The directories and files of a partition are
+ * created when its first bytes are written.
+ *
+ * The values are formatted as their string representations, with days timestamps as
+ * `YYYY-MM-DD`, null values as `__HIVE_DEFAULT_PARTITION__`, and the characters that are not
+ * valid in paths escaped as `%XX`.
+ *
+ * The table, metadata and settings of `options` are used, but not its sink, partitions or column
+ * chunk file paths. Key-value metadata, when set, must be a single map, written to every file.
+ *
+ * @throws cudf::data_type_error if a partition column is not a boolean, integer, floating-point,
+ * days timestamp or string column
+ * @throws std::invalid_argument if all the columns are partition columns
+ * @throws std::out_of_range if an index of `partition_by` is invalid
+ *
+ * @param options Settings for controlling writing behavior
+ * @param base_path The directory of the dataset
+ * @param partition_by Indices of the columns of the table to partition the rows by
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The paths of the written files, in the order of their partition keys
+ */
+std::vector<std::string> write_parquet_dataset(
+  parquet_writer_options const& options,
+  std::string const& base_path,
+  std::vector<size_type> const& partition_by,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 class chunked_parquet_writer_options_builder;
 
 /**
@@ -1230,6 +1646,8 @@ class chunked_parquet_writer_options {
   std::shared_ptr<writer_compression_statistics> _compression_stats;
   // write V2 page headers?
   bool _v2_page_headers = false;
+  // Columns by which the rows of each file are sorted before they are encoded
+  std::vector<sorting_column> _sorting_columns;
 
   /**
    * @brief Constructor from sink.
@@ -1384,6 +1802,13 @@ class chunked_parquet_writer_options {
    */
   [[nodiscard]] auto is_enabled_write_v2_headers() const { return _v2_page_headers; }
 
+  /**
+   * @brief Returns the columns by which the rows of each file are sorted.
+   *
+   * @return Columns by which the rows of each file are sorted
+   */
+  [[nodiscard]] auto const& get_sorting_columns() const { return _sorting_columns; }
+
   /**
    * @brief Sets metadata.
    *
@@ -1501,6 +1926,20 @@ class chunked_parquet_writer_options {
    */
   void enable_write_v2_headers(bool val) { _v2_page_headers = val; }
 
+  /**
+   * @brief Sets the columns by which the rows of each file are sorted before they are encoded.
+   *
+   * Clustering equal and close values makes the encoding more compact and narrows the
+   * statistics of the row groups and pages, so that readers skip more of them. The rows of each
+   * call to `write()` are sorted separately.
+   *
+   * @param sorting_columns Columns by which the rows are sorted, in order of precedence
+   */
+  void set_sorting_columns(std::vector<sorting_column> sorting_columns)
+  {
+    _sorting_columns = std::move(sorting_columns);
+  }
+
   /**
    * @brief creates builder to build chunked_parquet_writer_options.
    *
@@ -1612,6 +2051,19 @@ class chunked_parquet_writer_options_builder {
    */
   chunked_parquet_writer_options_builder& write_v2_headers(bool enabled);
 
+  /**
+   * @brief Sets the columns by which the rows of each file are sorted before they are encoded.
+   *
+   * @param sorting_columns Columns by which the rows are sorted, in order of precedence
+   * @return this for chaining
+   */
+  chunked_parquet_writer_options_builder& sorting_columns(
+    std::vector<sorting_column> sorting_columns)
+  {
+    options.set_sorting_columns(std::move(sorting_columns));
+    return *this;
+  }
+
   /**
    * @brief Sets the maximum row group size, in bytes.
    *
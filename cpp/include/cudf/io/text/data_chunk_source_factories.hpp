@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -76,6 +76,33 @@ std::unique_ptr<data_chunk_source> make_source_from_bgzip_file(std::string_view
                                                                uint64_t virtual_begin,
                                                                uint64_t virtual_end);
 
+/**
+ * @brief Creates a data source capable of producing device-buffered views of a BGZIP compressed
+ *        file with a `.gzi` block index.
+ *
+ * The index lets readers of the source skip to any decompressed offset by seeking directly to the
+ * block containing it, instead of decompressing all blocks before it.
+ *
+ * @param filename the filename of the BGZIP-compressed file to be exposed as a data chunk source.
+ * @param index_filename the filename of the `.gzi` index of the file, as written by
+ *                       `bgzip --index` or `build_bgzip_index`.
+ * @return the data chunk source for the provided filename. It reads data from the file and copies
+ *         it to the device, where it will be decompressed.
+ */
+std::unique_ptr<data_chunk_source> make_source_from_bgzip_file(std::string_view filename,
+                                                               std::string_view index_filename);
+
+/**
+ * @brief Builds the `.gzi` block index of a BGZIP compressed file.
+ *
+ * Only the block headers and footers are read, so building the index is much cheaper than
+ * decompressing the file. The index only needs to be built once per file.
+ *
+ * @param filename the filename of the BGZIP-compressed file
+ * @param index_filename the filename the index will be written to
+ */
+void build_bgzip_index(std::string_view filename, std::string_view index_filename);
+
 /**
  * @brief Creates a data source capable of producing views of the given device string scalar
  * @param data the device data to be exposed as a data chunk source. Its lifetime must be at least
@@ -25,6 +25,7 @@
 #include <array>
 #include <fstream>
 #include <limits>
+#include <vector>
 
 namespace cudf::io::text::detail::bgzip {
 
@@ -39,6 +40,45 @@ struct footer {
   uint32_t decompressed_size;
 };
 
+/**
+ * @brief The start of a BGZIP block in the compressed and decompressed data, as stored in a
+ *        `.gzi` index.
+ */
+struct index_entry {
+  uint64_t compressed_offset;    ///< Offset of the block header in the compressed file
+  uint64_t decompressed_offset;  ///< Offset of the first byte of the block in the decompressed data
+};
+
+/**
+ * @brief Reads a BGZIP `.gzi` index from the given input stream.
+ *
+ * The index consists of the number of entries followed by the offset pairs, all stored as
+ * little-endian uint64 values. Like the files written by `bgzip --index`, it does not contain an
+ * entry for the first block, which implicitly starts at offset 0 in both the compressed and the
+ * decompressed data.
+ *
+ * @param input_stream The input stream
+ * @return The index entries, sorted by offset
+ */
+std::vector<index_entry> read_index(std::istream& input_stream);
+
+/**
+ * @brief Writes a BGZIP `.gzi` index to the given output stream.
+ *
+ * @param output_stream The output stream
+ * @param index The index entries, sorted by offset and without an entry for the first block
+ */
+void write_index(std::ostream& output_stream, host_span<index_entry const> index);
+
+/**
+ * @brief Builds the `.gzi` index of the BGZIP blocks in the given input stream by reading the
+ *        header and footer of every block, skipping over the compressed data.
+ *
+ * @param input_stream The input stream, positioned at the first block header
+ * @return The index entries for all blocks but the first
+ */
+std::vector<index_entry> build_index(std::istream& input_stream);
+
 /**
  * @brief Reads the full BGZIP header from the given input stream. Afterwards, the stream position
  *        is at the first data byte.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,6 +25,8 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -88,6 +90,37 @@ std::unique_ptr<cudf::column> multibyte_split(
   parse_options options               = {},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Splits the source text into a strings column using any of several delimiters.
+ *
+ * All delimiters are matched in a single pass over the source, and each row ends at the end of
+ * the first delimiter match found after its beginning. When delimiters are stripped, the longest
+ * delimiter that the row ends with is removed. The byte range is handled as in the
+ * single-delimiter `multibyte_split`.
+ *
+ * @code{.pseudo}
+ * Examples:
+ *  source:     "abc\r\ndef\nghi"
+ *  delimiters: ["\n", "\r\n"]
+ *  return:     ["abc\r\n", "def\n", "ghi"]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `delimiters` is empty or if one of them is empty
+ * @throw cudf::logic_error if the delimiters have too many tokens in total to be matched
+ *
+ * @param source The source string
+ * @param delimiters UTF-8 encoded strings for which to find offsets in the source
+ * @param options the parsing options to use (including byte range)
+ * @param mr Memory resource to use for the device memory allocation
+ * @return The strings found by splitting the source by the delimiters within the relevant byte
+ * range.
+ */
+std::unique_ptr<cudf::column> multibyte_split(
+  data_chunk_source const& source,
+  std::vector<std::string> const& delimiters,
+  parse_options options               = {},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 std::unique_ptr<cudf::column> multibyte_split(
   data_chunk_source const& source,
   std::string const& delimiter,
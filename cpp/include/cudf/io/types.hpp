@@ -113,10 +113,14 @@ enum class column_encoding {
                             ///< valid for BYTE_ARRAY columns)
   DELTA_BYTE_ARRAY,         ///< Use DELTA_BYTE_ARRAY encoding (only valid for
                             ///< BYTE_ARRAY and FIXED_LEN_BYTE_ARRAY columns)
+  BYTE_STREAM_SPLIT,        ///< Use BYTE_STREAM_SPLIT encoding (only valid for FLOAT and
+                            ///< DOUBLE columns)
   // ORC encodings:
   DIRECT,         ///< Use DIRECT encoding
   DIRECT_V2,      ///< Use DIRECT_V2 encoding
   DICTIONARY_V2,  ///< Use DICTIONARY_V2 encoding
+  // Parquet writer-selected encoding:
+  AUTO,  ///< Pick the smallest of PLAIN, DICTIONARY and the applicable DELTA encoding per chunk
 };
 
 /**
@@ -592,6 +596,8 @@ struct sink_info {
 
 class table_input_metadata;
 
+constexpr size_t default_bloom_filter_max_bytes = 1024 * 1024;  ///< 1MB Bloom filter per chunk
+
 /**
  * @brief Metadata for a column
  */
@@ -606,6 +612,9 @@ class column_in_metadata {
   std::optional<int32_t> _parquet_field_id;
   std::vector<column_in_metadata> children;
   column_encoding _encoding = column_encoding::USE_DEFAULT;
+  std::optional<double> _bloom_filter_fpp;
+  size_t _bloom_filter_max_bytes = default_bloom_filter_max_bytes;
+  std::optional<compression_type> _compression;
 
  public:
   column_in_metadata() = default;
@@ -738,6 +747,53 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Enables a split-block Bloom filter for this column, sized for the target false
+   * positive probability of each column chunk.
+   *
+   * Only used for leaf columns of integral, floating point and string types; the request is
+   * ignored for other columns.
+   *
+   * @param fpp Target false positive probability, in the range (0, 1)
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter_fpp(double fpp) noexcept
+  {
+    _bloom_filter_fpp = fpp;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum size of the Bloom filter of each column chunk of this column.
+   *
+   * Filters that would need more bytes to reach the target false positive probability are capped
+   * at this size, with a higher false positive probability.
+   *
+   * @param max_bytes Maximum size of a Bloom filter bitset, in bytes
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter_max_bytes(size_t max_bytes) noexcept
+  {
+    _bloom_filter_max_bytes = max_bytes;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the compression codec of this column, overriding the codec of the writer options.
+   *
+   * Only used by the Parquet writer, for leaf columns. `compression_type::AUTO` picks a codec for
+   * each column chunk by compressing a sample page with each available codec; the fastest codec
+   * whose output is close to the smallest one is used.
+   *
+   * @param compression The compression codec to use for this column
+   * @return this for chaining
+   */
+  column_in_metadata& set_compression(compression_type compression) noexcept
+  {
+    _compression = compression;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -850,6 +906,45 @@ class column_in_metadata {
    * @return The encoding that was set for this column
    */
   [[nodiscard]] column_encoding get_encoding() const { return _encoding; }
+
+  /**
+   * @brief Get whether a Bloom filter has been requested for this column.
+   *
+   * @return Boolean indicating whether a Bloom filter has been requested for this column
+   */
+  [[nodiscard]] bool is_bloom_filter_enabled() const noexcept
+  {
+    return _bloom_filter_fpp.has_value();
+  }
+
+  /**
+   * @brief Get the target false positive probability of the Bloom filter of this column.
+   *
+   * @throws std::bad_optional_access If no Bloom filter was requested for this column. Check
+   *         using `is_bloom_filter_enabled()` first.
+   * @return The target false positive probability of the Bloom filter
+   */
+  [[nodiscard]] double get_bloom_filter_fpp() const { return _bloom_filter_fpp.value(); }
+
+  /**
+   * @brief Get the maximum size of the Bloom filter of each column chunk of this column.
+   *
+   * @return The maximum size of a Bloom filter bitset, in bytes
+   */
+  [[nodiscard]] size_t get_bloom_filter_max_bytes() const noexcept
+  {
+    return _bloom_filter_max_bytes;
+  }
+
+  /**
+   * @brief Get the compression codec that was set for this column, if any.
+   *
+   * @return The compression codec of this column, or `std::nullopt` to use the writer's codec
+   */
+  [[nodiscard]] std::optional<compression_type> get_compression() const noexcept
+  {
+    return _compression;
+  }
 };
 
 /**
@@ -21,12 +21,17 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -51,6 +56,8 @@ class hash_join;
 
 template <cudf::has_nested HasNested>
 class distinct_hash_join;
+
+class mixed_hash_join;
 }  // namespace detail
 
 /**
@@ -177,6 +184,264 @@ full_join(cudf::table_view const& left_keys,
           null_equality compare_nulls         = null_equality::EQUAL,
           rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the
+ * specified tables, computed one hash partition at a time to bound its device memory usage.
+ *
+ * The results are the same as the results of `inner_join`. If the join would use more than
+ * `memory_budget` bytes of device memory, both tables are hash-partitioned on their keys and the
+ * partitions are spilled to host memory. The partitions holding the same hash values are then
+ * copied back to the device and joined one pair at a time. Pairs of partitions that still exceed
+ * the budget, e.g. because of skewed keys, are partitioned again with a different hash seed, up to
+ * a fixed depth.
+ *
+ * The memory budget is an estimate that covers the keys of a pair of partitions and the hash table
+ * built from one of them, but not the join result.
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw cudf::logic_error if `memory_budget` is zero.
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param memory_budget Device memory in bytes that the join of a pair of partitions may use
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::size_t memory_budget,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the specified
+ * tables, computed one hash partition at a time to bound its device memory usage.
+ *
+ * The results are the same as the results of `left_join`. The hash table is always built from the
+ * partitions of `right_keys`. See `partitioned_inner_join` for how the tables are partitioned.
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw cudf::logic_error if `memory_budget` is zero.
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param memory_budget Device memory in bytes that the join of a pair of partitions may use
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::size_t memory_budget,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the specified
+ * tables, both sorted on their keys.
+ *
+ * No hash table is built: the run of equal rows of `right_keys` matching each row of `left_keys`
+ * is found by a binary search of the sorted right table. Both tables must be sorted with the same
+ * `column_order` and `null_precedence`, otherwise the result is undefined.
+ *
+ * The results are the matches of `inner_join`, ordered by left row index and then by right row
+ * index. The joined rows therefore keep the sort order of the inputs.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{1, 1, 2, 2, 3}, {0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw cudf::logic_error if the sizes of `column_order` or `null_precedence` do not match the
+ * number of key columns.
+ * @throw std::overflow_error if the result has more rows than the size_type limit.
+ *
+ * @param left_keys The left table, sorted on its keys
+ * @param right_keys The right table, sorted on its keys
+ * @param column_order The sort order of each key column, ascending if empty
+ * @param null_precedence The sort position of the nulls of each key column, before the valid
+ * keys if empty
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the specified
+ * tables, both sorted on their keys.
+ *
+ * See `sorted_inner_join` for how the matches are found. Every row of `left_keys` is in the
+ * result, in order. Like with `left_join`, the rows without a match have an out-of-bounds right
+ * index.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{0, 1, 1, 2}, {None, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw cudf::logic_error if the sizes of `column_order` or `null_precedence` do not match the
+ * number of key columns.
+ * @throw std::overflow_error if the result has more rows than the size_type limit.
+ *
+ * @param left_keys The left table, sorted on its keys
+ * @param right_keys The right table, sorted on its keys
+ * @param column_order The sort order of each key column, ascending if empty
+ * @param null_precedence The sort position of the nulls of each key column, before the valid
+ * keys if empty
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief The direction of the search of an as-of join match.
+ */
+enum class asof_direction : int32_t {
+  BACKWARD,  ///< The right row with the largest `on` value at or before the left `on` value
+  FORWARD,   ///< The right row with the smallest `on` value at or after the left `on` value
+  NEAREST    ///< The nearest of the backward and forward matches, the backward one on ties
+};
+
+/**
+ * @brief Returns the row index of the right table matching each row of the left table in an as-of
+ * join between the specified tables.
+ *
+ * An as-of join matches each left row with the right row of equal `keys` whose `on` value is the
+ * nearest to the left `on` value in the given direction, like "the latest quote at or before each
+ * trade time, per symbol". The right table must be sorted on `right_keys` then `right_on`, in
+ * ascending order with nulls before the valid values; the left table does not have to be sorted.
+ * The matches are found with binary searches of the right table, in O(n log m) time.
+ *
+ * Rows with a null `on` value never match. If there are several right rows with the matched `on`
+ * value, the last one is matched backward and the first one forward.
+ *
+ * @code{.pseudo}
+ * Left keys: {{"a", "a", "b"}}, left on: {2, 5, 4}
+ * Right keys: {{"a", "a", "b"}}, right on: {1, 4, 6}
+ * BACKWARD: {0, 1, None}
+ * FORWARD: {1, None, 2}
+ * NEAREST with tolerance 1: {0, 1, None}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys` mismatch.
+ * @throw cudf::logic_error if `left_on` and `right_on` have different types, or a type that is not
+ * numeric or timestamp.
+ * @throw cudf::logic_error if the `tolerance` type is not the type of `left_on`, or the duration
+ * type of the same resolution for a timestamp `left_on`.
+ *
+ * @param left_keys The keys of the left table that must be equal, may have no columns
+ * @param right_keys The keys of the right table that must be equal, may have no columns
+ * @param left_on The values of the left table to match to the nearest right value
+ * @param right_on The values of the right table to match to the nearest left value
+ * @param direction The direction of the search of the match
+ * @param tolerance Largest distance between the matched `on` values, unbounded by default
+ * @param compare_nulls Controls whether null values of the `keys` should match or not
+ * @param mr Device memory resource used to allocate the returned vector's device memory
+ *
+ * @return A vector of the matching right row index of each left row, or an out-of-bounds value if
+ * there is no match
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  column_view const& left_on,
+  column_view const& right_on,
+  asof_direction direction                                      = asof_direction::BACKWARD,
+  std::optional<std::reference_wrapper<scalar const>> tolerance = std::nullopt,
+  null_equality compare_nulls                                   = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of rows between the
+ * specified tables whose keys are equal and whose floating-point `on` values differ by less than a
+ * tolerance.
+ *
+ * The `on` values are quantized into buckets as wide as the tolerance, so that matching values are
+ * in the same or adjacent buckets. The join probes a hash table of the right keys and buckets with
+ * the left keys and each of the three buckets around the left value, then verifies the distance of
+ * the candidates, instead of comparing all pairs of rows as a conditional join would.
+ *
+ * Rows with a null or NaN `on` value never match.
+ *
+ * @code{.pseudo}
+ * Left keys: {{"a", "a", "b"}}, left on: {1.0, 2.05, 3.0}
+ * Right keys: {{"a", "b", "a"}}, right on: {1.04, 3.01, 2.1}
+ * Tolerance: 0.1
+ * Result: {{0, 1, 2}, {0, 2, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys` mismatch.
+ * @throw cudf::data_type_error if `left_on` and `right_on` have different types, or a type that is
+ * not floating-point.
+ * @throw std::invalid_argument if `tolerance` is not positive and finite.
+ *
+ * @param left_keys The keys of the left table that must be equal, may have no columns
+ * @param right_keys The keys of the right table that must be equal, may have no columns
+ * @param left_on The values of the left table to match to the right values within the tolerance
+ * @param right_on The values of the right table to match to the left values within the tolerance
+ * @param tolerance The distance between matching `on` values is less than this
+ * @param compare_nulls Controls whether null values of the `keys` should match or not
+ * @param mr Device memory resource used to allocate the returned vectors' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] of the matching rows, in unspecified
+ * order
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+tolerance_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  column_view const& left_on,
+  column_view const& right_on,
+  double tolerance,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a vector of row indices corresponding to a left semi-join
  * between the specified tables.
@@ -273,6 +538,45 @@ std::unique_ptr<cudf::table> cross_join(
  */
 enum class nullable_join : bool { YES, NO };
 
+/**
+ * @brief Estimate of the output size of a join, with its approximate 95% confidence interval.
+ */
+struct join_size_estimate {
+  std::size_t estimate;     ///< Estimated number of output rows
+  std::size_t lower_bound;  ///< Lower bound of the number of output rows
+  std::size_t upper_bound;  ///< Upper bound of the number of output rows
+};
+
+/**
+ * @brief The hash table of a `hash_join`, packed in a host metadata buffer and a single device
+ * buffer, in the style of `cudf::packed_columns`.
+ *
+ * The buffers hold no pointers, so they can be copied to files, to other devices or to other
+ * processes, e.g. with CUDA IPC, and unpacked there with the same build table.
+ */
+struct packed_hash_join {
+  packed_hash_join()
+    : metadata(std::make_unique<std::vector<uint8_t>>()),
+      gpu_data(std::make_unique<rmm::device_buffer>())
+  {
+  }
+
+  /**
+   * @brief Construct a new packed hash join object
+   *
+   * @param md Host-side metadata buffer
+   * @param gd Device-side data buffer
+   */
+  packed_hash_join(std::unique_ptr<std::vector<uint8_t>>&& md,
+                   std::unique_ptr<rmm::device_buffer>&& gd)
+    : metadata(std::move(md)), gpu_data(std::move(gd))
+  {
+  }
+
+  std::unique_ptr<std::vector<uint8_t>> metadata;  ///< Host-side metadata buffer
+  std::unique_ptr<rmm::device_buffer> gpu_data;    ///< Device-side data buffer
+};
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
@@ -317,6 +621,38 @@ class hash_join {
             null_equality compare_nulls,
             rmm::cuda_stream_view stream = cudf::get_default_stream());
 
+  /**
+   * @brief Construct a hash join object from a hash table packed by `hash_join::pack`, without
+   * building the hash table again.
+   *
+   * @note `build` must have the same rows as the build table of the packed hash join, else
+   * behavior is undefined. The `hash_join` object must not outlive the table viewed by `build`.
+   *
+   * @throw cudf::logic_error if `packed` is not a packed hash join
+   * @throw cudf::logic_error if the number of rows or the column types of `build` do not match
+   * those of the packed hash join
+   *
+   * @param build The build table of the packed hash join
+   * @param packed The packed hash table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(cudf::table_view const& build,
+            packed_hash_join const& packed,
+            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Packs the hash table of this object, to construct an equal `hash_join` later without
+   * building it again.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the device buffer of the result
+   *
+   * @return The packed hash table
+   */
+  [[nodiscard]] packed_hash_join pack(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
   /**
    * Returns the row indices that can be used to construct the result of performing
    * an inner join between two tables. @see cudf::inner_join(). Behavior is undefined if the
@@ -408,6 +744,46 @@ class hash_join {
   [[nodiscard]] std::size_t inner_join_size(
     cudf::table_view const& probe, rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
 
+  /**
+   * @brief Estimates the device memory used to build a hash join on `build` and to probe it.
+   *
+   * The estimate only depends on the number of rows and the nullability of `build`. Its output
+   * bytes are the hash table kept by the `hash_join` object, plus the row index vectors of a join
+   * returning `output_rows` rows, e.g. as estimated by `estimate_inner_join_size`. Its temporary
+   * bytes are an upper bound of the memory used while building the hash table. Nested columns
+   * need additional memory for their row operators, which is not included.
+   *
+   * @param build The build table
+   * @param output_rows Number of rows of the join results
+   * @return The estimated device memory of the hash join
+   */
+  [[nodiscard]] static memory_estimate estimate_memory(cudf::table_view const& build,
+                                                       std::size_t output_rows = 0);
+
+  /**
+   * Returns an estimate of the number of matches (rows) when performing an inner join with the
+   * specified probe table, from the matches of a sample of its rows.
+   *
+   * The sample rows are spread evenly over the probe table and split into groups, and the spread
+   * of the matches of the groups gives the confidence interval of the estimate. The estimate is
+   * exact if the sample holds every probe row.
+   *
+   * @throw cudf::logic_error If the input probe table has nulls while this hash_join object was not
+   * constructed with null check.
+   * @throw cudf::logic_error If `sample_size` is not positive
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param sample_size Number of probe rows to sample
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The estimated number of output rows of an inner join between two tables with `build`
+   * and `probe` as the join keys, with its confidence interval
+   */
+  [[nodiscard]] join_size_estimate estimate_inner_join_size(
+    cudf::table_view const& probe,
+    size_type sample_size        = 8192,
+    rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
   /**
    * Returns the exact number of matches (rows) when performing a left join with the specified probe
    * table.
@@ -448,6 +824,78 @@ class hash_join {
   const std::unique_ptr<impl_type const> _impl;
 };
 
+/**
+ * @brief Inner join of a probe table with a `hash_join`, returned in chunks of gather maps of
+ * bounded size.
+ *
+ * Each chunk joins the next range of probe rows whose number of matches does not exceed the output
+ * row budget, so that a many-to-many join can be consumed without materializing all of its gather
+ * maps at once. The size of each range adapts to the number of matches of the previous ones.
+ *
+ * The `hash_join` object and the probe table must outlive this object.
+ *
+ * @code{.cpp}
+ * cudf::hash_join hash_join(build);
+ * cudf::chunked_inner_join join(hash_join, probe, 1'000'000);
+ * while (join.has_next()) {
+ *   auto const [left_indices, right_indices] = join.next();
+ *   ...
+ * }
+ * @endcode
+ */
+class chunked_inner_join {
+ public:
+  chunked_inner_join() = delete;
+
+  /**
+   * @brief Constructs an inner join of `probe` with `hash_join` returned in chunks.
+   *
+   * @throw cudf::logic_error if `max_output_rows` is 0
+   *
+   * @param hash_join The hash join built on the right table
+   * @param probe The probe table, from which the tuples are probed
+   * @param max_output_rows Largest number of rows of the gather maps of each chunk
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned gather maps
+   */
+  chunked_inner_join(hash_join const& hash_join,
+                     cudf::table_view const& probe,
+                     std::size_t max_output_rows,
+                     rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Checks if there are probe rows that are not joined yet.
+   *
+   * @return A boolean value indicating if there is any chunk left to return
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Returns the gather maps of the next chunk of the join.
+   *
+   * The concatenation of the chunks, in order, is the result of `hash_join::inner_join`. The left
+   * indices are row indices of the whole probe table.
+   *
+   * @throw cudf::logic_error if there is no chunk left
+   * @throw std::overflow_error if a single probe row has more matches than `max_output_rows`
+   *
+   * @return A pair of vectors [`left_indices`, `right_indices`] of at most `max_output_rows` rows
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  next();
+
+ private:
+  hash_join const& _hash_join;           ///< Hash join built on the right table
+  cudf::table_view _probe;               ///< Probe table
+  std::size_t _max_output_rows;          ///< Output row budget of each chunk
+  size_type _next_row{0};                ///< First probe row of the next chunk
+  size_type _chunk_rows;                 ///< Number of probe rows first tried for the next chunk
+  rmm::cuda_stream_view _stream;         ///< CUDA stream of the join
+  rmm::mr::device_memory_resource* _mr;  ///< Device memory resource of the gather maps
+};
+
 /**
  * @brief Distinct hash join that builds hash table in creation and probes results in subsequent
  * `*_join` member functions
@@ -518,12 +966,176 @@ class distinct_hash_join {
     rmm::cuda_stream_view stream        = cudf::get_default_stream(),
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Returns both gather maps of a left join between two tables. @see cudf::left_join().
+   *
+   * The probe rows without a match are paired with `JoinNoneValue`, as in `left_join`.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory.
+   *
+   * @return A pair of columns [`build_indices`, `probe_indices`] that can be used to construct
+   * the result of performing a left join between two tables with `build` and `probe` as the join
+   * keys.
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join_indices(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the indices of the probe rows with a match in the build table.
+   * @see cudf::left_semi_join().
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory.
+   *
+   * @return A vector `probe_indices` that can be used to construct the result of performing a
+   * left semi join between two tables with `build` and `probe` as the join keys.
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the indices of the probe rows without a match in the build table.
+   * @see cudf::left_anti_join().
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory.
+   *
+   * @return A vector `probe_indices` that can be used to construct the result of performing a
+   * left anti join between two tables with `build` and `probe` as the join keys.
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
  private:
   using impl_type = typename cudf::detail::distinct_hash_join<HasNested>;  ///< Implementation type
 
   std::unique_ptr<impl_type> _impl;  ///< Distinct hash join implementation
 };
 
+/**
+ * @brief A split-block Bloom filter over the join keys of a build table.
+ *
+ * The filter is built from the row hashes of the build keys, so the rows of a probe table can be
+ * checked for a possible match before they are joined. Every probe row with a matching build row
+ * passes, while probe rows without a match pass with a probability close to the requested false
+ * positive rate. This lets callers drop most of the probe rows that a selective join would
+ * discard, before they are read, shuffled or joined.
+ *
+ * For a single key column of a numeric, timestamp or duration type, the filter also keeps the
+ * minimum and maximum build keys, e.g. to prune file row groups by their statistics.
+ */
+class join_bloom_filter {
+ public:
+  join_bloom_filter() = delete;
+  ~join_bloom_filter();
+  join_bloom_filter(join_bloom_filter const&)            = delete;
+  join_bloom_filter(join_bloom_filter&&);
+  join_bloom_filter& operator=(join_bloom_filter const&) = delete;
+  join_bloom_filter& operator=(join_bloom_filter&&);
+
+  /**
+   * @brief Builds a Bloom filter from the keys of a build table.
+   *
+   * @throw cudf::logic_error if `build` has no columns
+   * @throw cudf::logic_error if `false_positive_rate` is not in the range (0, 1)
+   *
+   * @param build The build table keys
+   * @param false_positive_rate Target probability of a probe row without a match passing the filter
+   * @param compare_nulls Controls whether null join-key values should match or not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  join_bloom_filter(cudf::table_view const& build,
+                    double false_positive_rate   = 0.01,
+                    null_equality compare_nulls  = null_equality::EQUAL,
+                    rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Checks which rows of a probe table may have a match in the build table.
+   *
+   * @throw cudf::logic_error if the number of columns of `probe` differs from the build table
+   *
+   * @param probe The probe table keys, with the same column types as the build table keys
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL8 column that is `false` for the probe rows that cannot have a match
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the bitset of the filter, made of blocks of eight 32-bit words.
+   *
+   * @return The device bitset of the filter
+   */
+  [[nodiscard]] device_span<uint32_t const> bitset() const { return _bitset; }
+
+  /**
+   * @brief Returns the smallest build key, if the filter keeps the range of the build keys.
+   *
+   * The range is only kept for a single key column of a numeric, timestamp or duration type, when
+   * null keys cannot match or the build keys have no nulls. Probe rows outside of the range,
+   * including null keys, cannot have a match.
+   *
+   * @return The smallest build key, or `nullptr` if the filter does not keep the key range
+   */
+  [[nodiscard]] scalar const* min_key() const { return _min_key.get(); }
+
+  /**
+   * @brief Returns the largest build key, if the filter keeps the range of the build keys.
+   *
+   * @return The largest build key, or `nullptr` if the filter does not keep the key range
+   */
+  [[nodiscard]] scalar const* max_key() const { return _max_key.get(); }
+
+  /**
+   * @brief Returns whether null join-key values match.
+   *
+   * @return The null equality the filter was built with
+   */
+  [[nodiscard]] null_equality compare_nulls() const { return _compare_nulls; }
+
+ private:
+  null_equality _compare_nulls;           ///< Whether null keys match
+  size_type _num_columns;                 ///< Number of key columns
+  rmm::device_uvector<uint32_t> _bitset;  ///< Split-block Bloom filter bitset
+  std::unique_ptr<scalar> _min_key;       ///< Smallest build key, if the range is kept
+  std::unique_ptr<scalar> _max_key;       ///< Largest build key, if the range is kept
+};
+
+/**
+ * @brief Filters a table by the possible matches of its join keys in a join Bloom filter.
+ *
+ * @code{.pseudo}
+ * Build keys: {{1, 2, 3}}
+ * Input: {{10, 11, 12, 13}, {"a", "b", "c", "d"}}
+ * Keys: {{0, 1, 2, 5}}
+ * Result: {{11, 12}, {"b", "c"}} // and possibly some false positives
+ * @endcode
+ *
+ * @throw cudf::logic_error if `keys` and `input` have different numbers of rows
+ *
+ * @param input The table to filter
+ * @param keys The join keys of the rows of `input`
+ * @param filter The Bloom filter of the build table keys
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The rows of `input` whose keys may have a match in the build table
+ */
+std::unique_ptr<table> filter_by_bloom(
+  cudf::table_view const& input,
+  cudf::table_view const& keys,
+  join_bloom_filter const& filter,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a pair of row index vectors corresponding to all pairs
  * of rows between the specified tables where the predicate evaluates to true.
@@ -568,6 +1180,81 @@ conditional_inner_join(
   std::optional<std::size_t> output_size = {},
   rmm::mr::device_memory_resource* mr    = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Conditional inner join of two tables, returned in chunks of gather maps of bounded size.
+ *
+ * Each chunk joins the next range of left rows whose number of matches does not exceed the output
+ * row budget, so that a join with many matches can be consumed without materializing all of its
+ * gather maps at once. The size of each range adapts to the number of matches of the previous
+ * ones.
+ *
+ * The tables and the predicate must outlive this object.
+ *
+ * @code{.cpp}
+ * cudf::chunked_conditional_inner_join join(left, right, predicate, 1'000'000);
+ * while (join.has_next()) {
+ *   auto const [left_indices, right_indices] = join.next();
+ *   ...
+ * }
+ * @endcode
+ */
+class chunked_conditional_inner_join {
+ public:
+  chunked_conditional_inner_join() = delete;
+
+  /**
+   * @brief Constructs a conditional inner join of `left` and `right` returned in chunks.
+   *
+   * @throw cudf::logic_error if `max_output_rows` is 0
+   *
+   * @param left The left table
+   * @param right The right table
+   * @param binary_predicate The condition on which to join
+   * @param max_output_rows Largest number of rows of the gather maps of each chunk
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned gather maps
+   */
+  chunked_conditional_inner_join(
+    table_view const& left,
+    table_view const& right,
+    ast::expression const& binary_predicate,
+    std::size_t max_output_rows,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Checks if there are left rows that are not joined yet.
+   *
+   * @return A boolean value indicating if there is any chunk left to return
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Returns the gather maps of the next chunk of the join.
+   *
+   * The concatenation of the chunks is the result of `conditional_inner_join`, up to order. The
+   * left indices are row indices of the whole left table.
+   *
+   * @throw cudf::logic_error if there is no chunk left
+   * @throw std::overflow_error if a single left row has more matches than `max_output_rows`
+   *
+   * @return A pair of vectors [`left_indices`, `right_indices`] of at most `max_output_rows` rows
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  next();
+
+ private:
+  table_view _left;                          ///< Left table
+  table_view _right;                         ///< Right table
+  ast::expression const& _binary_predicate;  ///< Condition on which to join
+  std::size_t _max_output_rows;              ///< Output row budget of each chunk
+  size_type _next_row{0};                    ///< First left row of the next chunk
+  size_type _chunk_rows;                     ///< Number of left rows first tried for the next chunk
+  rmm::cuda_stream_view _stream;             ///< CUDA stream of the join
+  rmm::mr::device_memory_resource* _mr;      ///< Device memory resource of the gather maps
+};
+
 /**
  * @brief Returns a pair of row index vectors corresponding to all pairs
  * of rows between the specified tables where the predicate evaluates to true,
@@ -911,6 +1598,164 @@ mixed_full_join(
   std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data = {},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hash table of the right equality table of a mixed join, for joining many left tables to
+ * the same right tables.
+ *
+ * The mixed join functions build the hash table of the equality table of one side on every call.
+ * This object builds the one of the right side once and probes it with each pair of left tables,
+ * which are always the probe side. The number of matches per row returned by its size functions
+ * is therefore indexed by the left rows.
+ *
+ * The right tables must outlive this object.
+ *
+ * @code{.cpp}
+ * cudf::mixed_hash_join right(right_equality, right_conditional);
+ * for (auto const& [left_equality, left_conditional] : batches) {
+ *   auto const [left_indices, right_indices] =
+ *     right.inner_join(left_equality, left_conditional, predicate);
+ *   ...
+ * }
+ * @endcode
+ */
+class mixed_hash_join {
+ public:
+  mixed_hash_join() = delete;
+  ~mixed_hash_join();
+  mixed_hash_join(mixed_hash_join const&)            = delete;
+  mixed_hash_join(mixed_hash_join&&)                 = delete;
+  mixed_hash_join& operator=(mixed_hash_join const&) = delete;
+  mixed_hash_join& operator=(mixed_hash_join&&)      = delete;
+
+  /**
+   * @brief Builds the hash table of the right equality table.
+   *
+   * @throw cudf::logic_error If the number of rows in right_equality and right_conditional do not
+   * match.
+   *
+   * @param right_equality The right table used for the equality join
+   * @param right_conditional The right table used for the conditional join
+   * @param compare_nulls Whether or not null values join to each other or not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  mixed_hash_join(table_view const& right_equality,
+                  table_view const& right_conditional,
+                  null_equality compare_nulls  = null_equality::EQUAL,
+                  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns the row indices of the mixed inner join of the left tables with the right
+   * tables.
+   *
+   * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+   * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+   * match.
+   *
+   * @param left_equality The left table used for the equality join
+   * @param left_conditional The left table used for the conditional join
+   * @param binary_predicate The condition on which to join
+   * @param output_size_data An optional pair of the exact output size and the number of matches
+   * of each left row, as returned by `inner_join_size`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory
+   *
+   * @return A pair of vectors [`left_indices`, `right_indices`] of the matching rows
+   */
+  [[nodiscard]] std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                          std::unique_ptr<rmm::device_uvector<size_type>>>
+  inner_join(
+    table_view const& left_equality,
+    table_view const& left_conditional,
+    ast::expression const& binary_predicate,
+    std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data = {},
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the row indices of the mixed left join of the left tables with the right
+   * tables.
+   *
+   * @copydetails inner_join
+   */
+  [[nodiscard]] std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                          std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join(
+    table_view const& left_equality,
+    table_view const& left_conditional,
+    ast::expression const& binary_predicate,
+    std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data = {},
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the row indices of the mixed full join of the left tables with the right
+   * tables.
+   *
+   * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+   * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+   * match.
+   *
+   * @param left_equality The left table used for the equality join
+   * @param left_conditional The left table used for the conditional join
+   * @param binary_predicate The condition on which to join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory
+   *
+   * @return A pair of vectors [`left_indices`, `right_indices`] of the matching rows
+   */
+  [[nodiscard]] std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                          std::unique_ptr<rmm::device_uvector<size_type>>>
+  full_join(table_view const& left_equality,
+            table_view const& left_conditional,
+            ast::expression const& binary_predicate,
+            rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the size of the mixed inner join of the left tables with the right tables and
+   * the number of matches of each left row.
+   *
+   * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+   * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+   * match.
+   *
+   * @param left_equality The left table used for the equality join
+   * @param left_conditional The left table used for the conditional join
+   * @param binary_predicate The condition on which to join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned matches' device memory
+   *
+   * @return A pair of the size of the join and the number of matches of each left row
+   */
+  [[nodiscard]] std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
+  inner_join_size(
+    table_view const& left_equality,
+    table_view const& left_conditional,
+    ast::expression const& binary_predicate,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the size of the mixed left join of the left tables with the right tables and
+   * the number of matches of each left row.
+   *
+   * @copydetails inner_join_size
+   */
+  [[nodiscard]] std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join_size(
+    table_view const& left_equality,
+    table_view const& left_conditional,
+    ast::expression const& binary_predicate,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  table_view _right_equality;     ///< Right table used for the equality join
+  table_view _right_conditional;  ///< Right table used for the conditional join
+  null_equality _compare_nulls;   ///< Whether or not null values join to each other or not
+  std::unique_ptr<detail::mixed_hash_join const> _impl;
+};
+
 /**
  * @brief Returns an index vector corresponding to all rows in the left tables
  * where the columns of the equality table are equal and the predicate
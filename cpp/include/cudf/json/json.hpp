@@ -15,13 +15,18 @@
  */
 #pragma once
 
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/optional.h>
 
+#include <memory>
+#include <vector>
+
 namespace cudf {
 
 /**
@@ -171,5 +176,28 @@ std::unique_ptr<cudf::column> get_json_object(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply several JSONPath strings to all rows in an input strings column.
+ *
+ * Equivalent to calling `get_json_object()` once per JSONPath string, but each row is read once
+ * for all of the queries and the output sizes and contents of all queries are each computed in a
+ * single pass over the column.
+ *
+ * @throw std::invalid_argument if any of the paths has an invalid operator or an empty name
+ *
+ * @param col The input strings column. Each row must contain a valid json string
+ * @param json_paths The JSONPath strings to be applied to each row
+ * @param options Options for controlling the behavior of the function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Resource for allocating device memory
+ * @return New strings columns containing the retrieved json object strings, one per JSONPath
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options     = get_json_object_options{},
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace cudf
@@ -77,5 +77,62 @@ std::unique_ptr<column> label_bins(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Labels elements by membership in `num_bins` bins of equal width between `lower` and
+ * `upper`.
+ *
+ * Bin `i` covers `[lower + i * width, lower + (i + 1) * width)` with
+ * `width = (upper - lower) / num_bins`, and the last bin also includes `upper`. The bin of a value
+ * is computed directly from the value instead of searching the bin edges.
+ *
+ * NULL and NaN elements, and elements outside `[lower, upper]`, belong to no bin and their label
+ * is NULL.
+ *
+ * @throws cudf::data_type_error if `input` is not a numeric, non-boolean column
+ * @throws std::invalid_argument if `num_bins` is not positive or `lower` is not below `upper`
+ *
+ * @param input The input elements to label
+ * @param lower The left edge of the first bin
+ * @param upper The right edge of the last bin
+ * @param num_bins The number of bins
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The integer labels of the elements in `input`
+ */
+std::unique_ptr<column> label_bins_uniform(
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the elements in each of `num_bins` bins of equal width between `lower` and
+ * `upper`.
+ *
+ * The bins are those of `label_bins_uniform`, and the counts are accumulated while the bins are
+ * computed, without materializing the labels. Elements labeled NULL by `label_bins_uniform` are
+ * not counted.
+ *
+ * @throws cudf::data_type_error if `input` is not a numeric, non-boolean column
+ * @throws std::invalid_argument if `num_bins` is not positive or `lower` is not below `upper`
+ *
+ * @param input The input elements to count
+ * @param lower The left edge of the first bin
+ * @param upper The right edge of the last bin
+ * @param num_bins The number of bins
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return An INT64 column of the `num_bins` counts, without nulls
+ */
+std::unique_ptr<column> histogram_uniform(
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
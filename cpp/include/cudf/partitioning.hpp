@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/contiguous_split.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -101,6 +102,77 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hash partitions the rows of a table directly into packed per-partition buffers.
+ *
+ * Equivalent to a `hash_partition` followed by a `contiguous_split` at the partition offsets,
+ * and assigns the same rows to each partition. When all the columns of `input` are fixed-width,
+ * the rows are copied once, straight from `input` into the contiguous buffer of their partition,
+ * without materializing the partitioned table. Other tables are partitioned and then split.
+ *
+ * The order of the rows within each partition is undefined.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ * @throw std::invalid_argument if `num_partitions` is not positive
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device memory
+ *
+ * @returns One packed table per partition
+ */
+std::vector<packed_table> hash_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions the rows of a table into ranges of the sort order of its key columns.
+ *
+ * A random sample of `sample_fraction` of the rows, and at least `num_partitions` rows, is
+ * sorted and its quantiles become the `num_partitions - 1` boundaries between the partitions.
+ * Every row is placed in the partition of the first boundary greater than its keys, so that all
+ * the rows of partition `i` sort before those of partition `i + 1`. Equal keys are always placed
+ * in the same partition, and skewed keys may leave partitions empty.
+ *
+ * Returns a `vector<size_type>` of `num_partitions + 1` offsets, as `cudf::partition` does. The
+ * order of the rows within each partition is undefined.
+ *
+ * @throw std::out_of_range if an index of `sort_keys` is invalid
+ * @throw std::invalid_argument if `num_partitions` is not positive
+ * @throw std::invalid_argument if `sample_fraction` is not in `(0, 1]`
+ *
+ * @param input The table to partition
+ * @param sort_keys Indices of the input columns to order the rows by
+ * @param num_partitions The number of partitions
+ * @param sample_fraction The fraction of the rows sampled to compute the partition boundaries
+ * @param column_order The order of each key column, ascending if empty
+ * @param null_precedence The order of the nulls of each key column, before others if empty
+ * @param seed Seed of the random sample of the rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Pair containing the reordered table and vector of `num_partitions + 1` offsets to each
+ * partition such that the size of partition `i` is determined by `offset[i+1] - offset[i]`
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& sort_keys,
+  size_type num_partitions,
+  double sample_fraction,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  int64_t seed                                   = 0,
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Round-robin partition.
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -61,6 +61,33 @@ std::unique_ptr<column> quantile(
   bool exact                          = true,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes quantiles with interpolation of the valid values of an unsorted column.
+ *
+ * Returns the values of `quantile` given the sorted order of the valid values of `input` as
+ * `ordered_indices`, without sorting `input`. The values at the few ranks needed by the quantiles
+ * are found together with a radix select, which builds a histogram of the next 8 bits of the
+ * values matching the bits selected so far in each pass over `input`. When the quantiles need
+ * more than 8 distinct ranks, or `input` is a dictionary column, `input` is sorted instead.
+ *
+ * NaNs are greater than all the other values, as in `sorted_order`.
+ *
+ * @throws cudf::logic_error if `input` is not a numeric, fixed-point or dictionary column
+ *
+ * @param input  Column from which to compute quantile values
+ * @param q      Specified quantiles in range [0, 1]
+ * @param interp Strategy used to select between values adjacent to a specified quantile
+ * @param exact  If true, returns doubles. If false, returns same type as input.
+ * @param mr     Device memory resource used to allocate the returned column's device memory
+ * @returns Column of specified quantiles, all null if `input` has no valid value
+ */
+std::unique_ptr<column> quantile_unsorted(
+  column_view const& input,
+  std::vector<double> const& q,
+  interpolation interp                = interpolation::LINEAR,
+  bool exact                          = true,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns the rows of the input corresponding to the requested quantiles.
  *
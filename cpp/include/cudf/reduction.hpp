@@ -18,10 +18,15 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/scalar/scalar_batch.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 namespace cudf {
 /**
@@ -105,6 +110,88 @@ std::unique_ptr<scalar> reduce(
   std::optional<std::reference_wrapper<scalar const>> init,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes several reductions of the values in all rows of a column.
+ *
+ * Element `i` of the result is equal to `reduce(col, *aggs[i], output_dtypes[i])`. The SUM,
+ * PRODUCT, SUM_OF_SQUARES, MIN, MAX, MEAN, VARIANCE, STD, ANY and ALL reductions of a numeric
+ * column are computed together in a single pass over the column, the other reductions with one
+ * pass each. Sums and products are accumulated in `int64_t` for integral columns and in `double`
+ * for floating-point columns before being cast to the output type. The number of valid and null
+ * elements are known from the column without any reduction.
+ *
+ * @throw std::invalid_argument if `aggs` and `output_dtypes` have different sizes, or if any
+ * aggregation is null
+ * @throw cudf::logic_error if any reduction is invalid for `reduce()`
+ *
+ * @param col Input column view
+ * @param aggs Aggregation operators applied by the reductions
+ * @param output_dtypes Output scalar type of every reduction
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns Output scalars with the results of the reductions, in the order of `aggs`
+ */
+std::vector<std::unique_ptr<scalar>> reduce_multiple(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes several reductions of every column of a table, e.g. to profile it.
+ *
+ * Every column is reduced as with the column `reduce_multiple()`. The output type of each
+ * reduction is BOOL8 for ANY and ALL, FLOAT64 for MEAN, VARIANCE and STD, INT64 or FLOAT64 for
+ * SUM, PRODUCT and SUM_OF_SQUARES of integral or floating-point columns, and the column type
+ * otherwise.
+ *
+ * @throw std::invalid_argument if any aggregation is null
+ * @throw cudf::logic_error if any reduction is invalid for `reduce()` with its column
+ *
+ * @param table Input table view
+ * @param aggs Aggregation operators applied by the reductions of every column
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns For every column, the scalars with the results of the reductions in the order of
+ * `aggs`
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_multiple(
+  table_view const& table,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes several reductions of the values in all rows of a column into a single
+ * `scalar_batch`.
+ *
+ * Value `i` of the result is equal to `reduce(col, *aggs[i], output_dtypes[i])`, with the
+ * reductions computed as by `reduce_multiple()`. The results are written to the single device
+ * allocation of the batch without synchronizing the stream, so that the results of many
+ * reductions are read on the host with one `scalar_batch::copy_to_host_async()`.
+ *
+ * @code{.pseudo}
+ * auto const batch = cudf::reduce_batch(col, aggs, output_dtypes);
+ * std::vector<uint8_t> host(batch.size_bytes());  // preferably pinned memory
+ * batch.copy_to_host_async(host);
+ * cudf::get_default_stream().synchronize();
+ * auto const sum = batch.is_valid(host, 0) ? batch.value<int64_t>(host, 0) : 0;
+ * @endcode
+ *
+ * @throw std::invalid_argument if `aggs` and `output_dtypes` have different sizes, or if any
+ * aggregation is null
+ * @throw cudf::data_type_error if any output type is not fixed-width
+ * @throw cudf::logic_error if any reduction is invalid for `reduce()`
+ *
+ * @param col Input column view
+ * @param aggs Aggregation operators applied by the reductions
+ * @param output_dtypes Output type of every reduction
+ * @param mr Device memory resource used to allocate the returned batch's device memory
+ * @returns Batch with the results of the reductions, in the order of `aggs`
+ */
+scalar_batch reduce_batch(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Compute reduction of each segment in the input column
  *
@@ -18,9 +18,14 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/scalar/scalar_batch.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 namespace cudf::reduction::detail {
 
@@ -37,4 +42,43 @@ std::unique_ptr<scalar> reduce(column_view const& col,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::reduce_multiple(column_view const&,
+ * host_span<std::unique_ptr<reduce_aggregation> const>, host_span<data_type const>,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<scalar>> reduce_multiple(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::reduce_multiple(table_view const&,
+ * host_span<std::unique_ptr<reduce_aggregation> const>, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_multiple(
+  table_view const& table,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::reduce_batch(column_view const&,
+ * host_span<std::unique_ptr<reduce_aggregation> const>, host_span<data_type const>,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+scalar_batch reduce_batch(column_view const& col,
+                          host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+                          host_span<data_type const> output_dtypes,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
 }  // namespace cudf::reduction::detail
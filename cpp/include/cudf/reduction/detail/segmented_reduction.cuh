@@ -19,19 +19,267 @@
 #include "reduction_operators.cuh"
 
 #include <cudf/detail/utilities/cast_functor.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
-#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <cub/device/device_segmented_reduce.cuh>
+#include <cub/block/block_scan.cuh>
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
 #include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstdint>
 
 namespace cudf {
 namespace reduction {
 namespace detail {
 
+/// Number of threads per block of the load-balanced segmented reduction
+constexpr int segmented_reduce_block_size = 256;
+/// Number of consecutive input elements reduced by each thread of the load-balanced reduction
+constexpr int segmented_reduce_items_per_thread = 4;
+/// Number of input elements reduced by each block of the load-balanced reduction
+constexpr int segmented_reduce_tile_size =
+  segmented_reduce_block_size * segmented_reduce_items_per_thread;
+
+/**
+ * @brief Binary operator of a segmented inclusive scan over (segment, value) pairs
+ *
+ * The values are combined only within the same segment, so the scan restarts at every segment.
+ */
+template <typename OutputType, typename BinaryOp>
+struct segmented_scan_op {
+  BinaryOp op;
+
+  __device__ thrust::pair<size_type, OutputType> operator()(
+    thrust::pair<size_type, OutputType> const& lhs,
+    thrust::pair<size_type, OutputType> const& rhs) const
+  {
+    return {rhs.first, lhs.first == rhs.first ? op(lhs.second, rhs.second) : rhs.second};
+  }
+};
+
+/**
+ * @brief Kernel reducing one tile of `segmented_reduce_tile_size` consecutive input elements per
+ * block, irrespective of the segment sizes
+ *
+ * Each thread finds the segments of its elements by binary search over the offsets, and the block
+ * reduces the elements of each segment with a segmented scan. Segments lying entirely inside the
+ * tile are written to `d_out`. The pieces of the at most two segments crossing the tile boundaries
+ * are written to `piece_keys`/`piece_values` at `2 * tile` for the segment starting before the
+ * tile, and at `2 * tile + 1` for the segment starting inside it and continuing after it.
+ *
+ * @param d_in Input data iterator
+ * @param d_offsets Begin iterator to segment indices
+ * @param num_segments Number of segments
+ * @param input_begin Index of the first element of the first segment
+ * @param input_end Index one past the last element of the last segment
+ * @param d_out Output data iterator
+ * @param op The reduction operator
+ * @param initial_value Initial value of the reduction
+ * @param piece_keys Segment of every piece of a segment crossing a tile boundary, or -1
+ * @param piece_values Reduced value of every piece of a segment crossing a tile boundary
+ */
+template <typename InputIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename BinaryOp,
+          typename OutputType>
+CUDF_KERNEL void __launch_bounds__(segmented_reduce_block_size)
+  load_balanced_segmented_reduce_kernel(InputIterator d_in,
+                                        OffsetIterator d_offsets,
+                                        size_type num_segments,
+                                        int64_t input_begin,
+                                        int64_t input_end,
+                                        OutputIterator d_out,
+                                        BinaryOp op,
+                                        OutputType initial_value,
+                                        size_type* piece_keys,
+                                        OutputType* piece_values)
+{
+  using scan_item  = thrust::pair<size_type, OutputType>;
+  using block_scan = cub::BlockScan<scan_item, segmented_reduce_block_size>;
+  __shared__ typename block_scan::TempStorage temp_storage;
+
+  auto const tile         = static_cast<int64_t>(blockIdx.x);
+  auto const tile_begin   = input_begin + tile * segmented_reduce_tile_size;
+  auto const tile_end     = std::min(tile_begin + segmented_reduce_tile_size, input_end);
+  auto const thread_begin = tile_begin + threadIdx.x * segmented_reduce_items_per_thread;
+  auto const offsets_end  = d_offsets + num_segments + 1;
+
+  // Locate the segment of every element; a new search is only needed past the end of a segment.
+  scan_item items[segmented_reduce_items_per_thread];
+  size_type segment   = -1;
+  int64_t segment_end = 0;
+#pragma unroll
+  for (int k = 0; k < segmented_reduce_items_per_thread; ++k) {
+    auto const idx = thread_begin + k;
+    if (idx < tile_end) {
+      if (segment < 0 || idx >= segment_end) {
+        auto const next = thrust::upper_bound(thrust::seq, d_offsets, offsets_end, idx);
+        segment         = static_cast<size_type>(thrust::distance(d_offsets, next) - 1);
+        segment_end = d_offsets[segment + 1];
+      }
+      items[k] = {segment, static_cast<OutputType>(d_in[idx])};
+    } else {
+      items[k] = {num_segments, initial_value};
+    }
+  }
+
+  block_scan(temp_storage).InclusiveScan(items, items, segmented_scan_op<OutputType, BinaryOp>{op});
+
+  // The last element of every segment of the tile holds the reduction of its piece of the segment.
+#pragma unroll
+  for (int k = 0; k < segmented_reduce_items_per_thread; ++k) {
+    auto const idx = thread_begin + k;
+    if (idx >= tile_end) { break; }
+    auto const [item_segment, value] = items[k];
+    int64_t const begin              = d_offsets[item_segment];
+    int64_t const end                = d_offsets[item_segment + 1];
+    if (idx + 1 != std::min(end, tile_end)) { continue; }
+
+    if (begin < tile_begin) {
+      piece_keys[2 * tile]   = item_segment;
+      piece_values[2 * tile] = value;
+    } else if (end > tile_end) {
+      piece_keys[2 * tile + 1]   = item_segment;
+      piece_values[2 * tile + 1] = value;
+    } else {
+      d_out[item_segment] = op(initial_value, value);
+    }
+  }
+}
+
+/**
+ * @brief Compute the specified simple reduction over each of the segments in the input range of
+ * elements, balancing the work by element count instead of by segment
+ *
+ * The input is split into tiles of `segmented_reduce_tile_size` elements, each reduced by one
+ * block, so many short segments are reduced together by a single block and a long segment is
+ * reduced by as many blocks as it has tiles. The pieces of the segments crossing tile boundaries
+ * are then combined with a reduce-by-key over the tiles.
+ *
+ * @tparam InputIterator    Input iterator type
+ * @tparam OffsetIterator   Offset iterator type
+ * @tparam OutputIterator   Output iterator type
+ * @tparam BinaryOp         Binary operator used for reduce
+ * @tparam OutputType       The output type of the reduction
+ *
+ * @param d_in           Input data iterator
+ * @param d_offset_begin Begin iterator to segment indices
+ * @param num_segments   Number of segments
+ * @param d_out          Output data iterator
+ * @param op             The reduction operator
+ * @param initial_value  Initial value of the reduction
+ * @param stream         CUDA stream used for device memory operations and kernel launches
+ */
+template <typename InputIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename BinaryOp,
+          typename OutputType>
+void load_balanced_segmented_reduce(InputIterator d_in,
+                                    OffsetIterator d_offset_begin,
+                                    size_type num_segments,
+                                    OutputIterator d_out,
+                                    BinaryOp op,
+                                    OutputType initial_value,
+                                    rmm::cuda_stream_view stream)
+{
+  if (num_segments <= 0) { return; }
+
+  // Empty segments reduce to the initial value
+  thrust::fill_n(rmm::exec_policy_nosync(stream), d_out, num_segments, initial_value);
+
+  auto const input_bounds = [&] {
+    auto bounds = rmm::device_uvector<int64_t>(2, stream);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(2),
+                      bounds.begin(),
+                      cuda::proclaim_return_type<int64_t>(
+                        [d_offset_begin, num_segments] __device__(int i) -> int64_t {
+                          return d_offset_begin[i * num_segments];
+                        }));
+    return cudf::detail::make_std_vector_sync(bounds, stream);
+  }();
+  auto const num_elements = input_bounds[1] - input_bounds[0];
+  if (num_elements <= 0) { return; }
+
+  auto const num_tiles = static_cast<size_type>(
+    cudf::util::div_rounding_up_safe<int64_t>(num_elements, segmented_reduce_tile_size));
+
+  auto piece_keys   = rmm::device_uvector<size_type>(2 * num_tiles, stream);
+  auto piece_values = rmm::device_uvector<OutputType>(2 * num_tiles, stream);
+  thrust::fill(rmm::exec_policy_nosync(stream), piece_keys.begin(), piece_keys.end(), -1);
+
+  load_balanced_segmented_reduce_kernel<<<num_tiles,
+                                          segmented_reduce_block_size,
+                                          0,
+                                          stream.value()>>>(d_in,
+                                                            d_offset_begin,
+                                                            num_segments,
+                                                            input_bounds[0],
+                                                            input_bounds[1],
+                                                            d_out,
+                                                            op,
+                                                            initial_value,
+                                                            piece_keys.data(),
+                                                            piece_values.data());
+  CUDF_CHECK_CUDA(stream.value());
+
+  // The pieces of every segment crossing tile boundaries are consecutive and in input order.
+  auto const pieces_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(piece_keys.begin(), piece_values.begin()));
+  auto const pieces_end   = thrust::remove_if(
+    rmm::exec_policy_nosync(stream),
+    pieces_begin,
+    pieces_begin + piece_keys.size(),
+    cuda::proclaim_return_type<bool>([] __device__(thrust::tuple<size_type, OutputType> piece) {
+      return thrust::get<0>(piece) < 0;
+    }));
+  auto const num_pieces = thrust::distance(pieces_begin, pieces_end);
+  if (num_pieces == 0) { return; }
+
+  auto segments   = rmm::device_uvector<size_type>(num_pieces, stream);
+  auto values     = rmm::device_uvector<OutputType>(num_pieces, stream);
+  auto const ends = thrust::reduce_by_key(rmm::exec_policy_nosync(stream),
+                                          piece_keys.begin(),
+                                          piece_keys.begin() + num_pieces,
+                                          piece_values.begin(),
+                                          segments.begin(),
+                                          values.begin(),
+                                          thrust::equal_to<size_type>{},
+                                          op);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::make_counting_iterator<std::size_t>(0),
+                     thrust::distance(segments.begin(), ends.first),
+                     [d_out,
+                      op,
+                      initial_value,
+                      d_segments = segments.data(),
+                      d_values   = values.data()] __device__(std::size_t i) {
+                       d_out[d_segments[i]] = op(initial_value, d_values[i]);
+                     });
+}
+
 /**
  * @brief Compute the specified simple reduction over each of the segments in the
  * input range of elements
@@ -68,31 +316,8 @@ void segmented_reduce(InputIterator d_in,
 {
   auto const num_segments = static_cast<size_type>(std::distance(d_offset_begin, d_offset_end)) - 1;
   auto const binary_op    = cudf::detail::cast_functor<OutputType>(op);
-  // Allocate temporary storage
-  size_t temp_storage_bytes = 0;
-  cub::DeviceSegmentedReduce::Reduce(nullptr,
-                                     temp_storage_bytes,
-                                     d_in,
-                                     d_out,
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
-  auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
-
-  // Run reduction
-  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
-                                     temp_storage_bytes,
-                                     d_in,
-                                     d_out,
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
+  load_balanced_segmented_reduce(
+    d_in, d_offset_begin, num_segments, d_out, binary_op, initial_value, stream);
 }
 
 template <typename InputIterator,
@@ -155,31 +380,13 @@ void segmented_reduce(InputIterator d_in,
   rmm::device_uvector<IntermediateType> intermediate_result{static_cast<std::size_t>(num_segments),
                                                             stream};
 
-  // Allocate temporary storage
-  size_t temp_storage_bytes = 0;
-  cub::DeviceSegmentedReduce::Reduce(nullptr,
-                                     temp_storage_bytes,
-                                     d_in,
-                                     intermediate_result.data(),
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
-  auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
-
-  // Run reduction
-  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
-                                     temp_storage_bytes,
-                                     d_in,
-                                     intermediate_result.data(),
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
+  load_balanced_segmented_reduce(d_in,
+                                 d_offset_begin,
+                                 num_segments,
+                                 intermediate_result.data(),
+                                 binary_op,
+                                 initial_value,
+                                 stream);
 
   // compute the result value from intermediate value in device
   thrust::transform(
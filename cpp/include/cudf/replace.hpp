@@ -24,6 +24,9 @@
 #include <memory>
 
 namespace cudf {
+
+class hash_join;
+
 /**
  * @addtogroup transformation_replace
  * @{
@@ -170,6 +173,70 @@ std::unique_ptr<column> find_and_replace_all(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Mapping of old values to new values that replaces the values of several columns.
+ *
+ * The old values are inserted in a hash table once, when the map is constructed, so that each
+ * call to `replace` only probes the table with the rows of its input. This makes replacing with
+ * many old values, or replacing the values of many batches with the same mapping, linear in the
+ * number of rows.
+ *
+ * @code{.pseudo}
+ * values_to_replace  = {1, 3}
+ * replacement_values = {10, 30}
+ * map = replacement_map(values_to_replace, replacement_values)
+ * map.replace({1, 2, 3, 1}) = {10, 2, 30, 10}
+ * map.replace({3, 3})       = {30, 30}
+ * @endcode
+ */
+class replacement_map {
+ public:
+  replacement_map()                                  = delete;
+  replacement_map(replacement_map const&)            = delete;
+  replacement_map(replacement_map&&)                 = delete;
+  replacement_map& operator=(replacement_map const&) = delete;
+  replacement_map& operator=(replacement_map&&)      = delete;
+  ~replacement_map();
+
+  /**
+   * @brief Constructs the mapping of each `values_to_replace[i]` to `replacement_values[i]`.
+   *
+   * If an old value appears several times in `values_to_replace`, it is replaced with the
+   * replacement value of its first occurrence.
+   *
+   * @throws cudf::logic_error If `values_to_replace` and `replacement_values` have different sizes
+   * or types
+   * @throws cudf::logic_error If `values_to_replace` has nulls
+   * @throws cudf::logic_error If the values are neither of a fixed-width type nor strings
+   *
+   * @param values_to_replace The values to replace
+   * @param replacement_values The values to replace with
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  replacement_map(column_view const& values_to_replace,
+                  column_view const& replacement_values,
+                  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns a copy of `input` with the old values of the map replaced by their new values.
+   *
+   * @throws cudf::logic_error If `input` is not of the type of the values of the map
+   *
+   * @param input The column to find and replace values in
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return Copy of `input` with the values of the map replaced
+   */
+  [[nodiscard]] std::unique_ptr<column> replace(
+    column_view const& input,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<table> _values;      ///< The distinct old values and their new values
+  std::unique_ptr<hash_join> _lookup;  ///< Hash table of the distinct old values
+};
+
 /**
  * @brief Replaces values less than `lo` in `input` with `lo_replace`,
  * and values greater than `hi` with `hi_replace`.
@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_view.hpp>
 #include <cudf/rolling/range_window_bounds.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
@@ -550,6 +554,54 @@ std::unique_ptr<column> grouped_range_rolling_window(
   rolling_aggregation const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Request for a rolling window aggregation of a column.
+ *
+ * Used with the multi-aggregation `grouped_range_rolling_window()`, which evaluates every request
+ * over the same windows.
+ */
+struct rolling_request {
+  column_view values;                                ///< Column to aggregate
+  size_type min_periods{1};                          ///< Minimum observations for a non-null result
+  std::unique_ptr<rolling_aggregation> aggregation;  ///< Aggregation to apply to `values`
+};
+
+/**
+ * @brief Applies several grouping-aware, value range-based rolling window functions over the same
+ * windows.
+ *
+ * The windows are defined as in the single aggregation `grouped_range_rolling_window()`. The group
+ * boundaries of `group_keys` and the preceding/following extent of every row's window in the
+ * `orderby_column` are computed once, and each request is then aggregated against them, like
+ * `rolling_window()` with precomputed window columns. This is much cheaper than one call per
+ * aggregation when many aggregations share the same partitioning, ordering and bounds.
+ *
+ * Element `i` of the returned table is the result of `requests[i]`, identical to the column
+ * returned by the single aggregation `grouped_range_rolling_window()` for that request.
+ *
+ * @throws std::invalid_argument if the size of `group_keys` or of the values of any request does
+ * not match the size of `orderby_column`
+ * @throws std::invalid_argument if any request has no aggregation or a non-positive `min_periods`
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] orderby_column The (pre-sorted) order-by column, for range comparisons
+ * @param[in] order  The order (ASCENDING/DESCENDING) in which the order-by column is sorted
+ * @param[in] preceding The interval value in the backward direction
+ * @param[in] following The interval value in the forward direction
+ * @param[in] requests The columns to aggregate, with their aggregations and minimum periods
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns   A table of one nullable column per request, containing the rolling window results
+ */
+std::unique_ptr<table> grouped_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  host_span<rolling_request const> requests,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
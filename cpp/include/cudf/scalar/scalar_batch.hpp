@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @file
+ * @brief Class definition for cudf::scalar_batch
+ */
+
+namespace cudf {
+/**
+ * @addtogroup scalar_classes
+ * @{
+ */
+
+/**
+ * @brief An owning class holding many fixed-width scalar values in a single device allocation.
+ *
+ * The values and their validities are packed in one device buffer: every value is at an offset
+ * aligned to 16 bytes, followed by one validity byte per value. Unlike a vector of `scalar`s, which
+ * allocates two device buffers per value, the whole batch is allocated at once, written on the
+ * device without synchronizing, and copied to the host with a single `copy_to_host_async()`.
+ *
+ * All values are null on construction.
+ */
+class scalar_batch {
+ public:
+  scalar_batch(scalar_batch const&)            = delete;
+  scalar_batch& operator=(scalar_batch const&) = delete;
+  scalar_batch(scalar_batch&&)                 = default;
+  scalar_batch& operator=(scalar_batch&&)      = default;
+  ~scalar_batch()                              = default;
+
+  /**
+   * @brief Construct a batch of null values of the given types.
+   *
+   * @throw cudf::data_type_error if any type is not fixed-width
+   *
+   * @param types Data type of every value of the batch
+   * @param stream CUDA stream used for device memory operations
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit scalar_batch(
+    std::vector<data_type> types,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the number of values in the batch.
+   *
+   * @return The number of values in the batch
+   */
+  [[nodiscard]] size_type size() const noexcept { return static_cast<size_type>(_types.size()); }
+
+  /**
+   * @brief Returns the data type of a value of the batch.
+   *
+   * @param i Index of the value
+   * @return The data type of the value
+   */
+  [[nodiscard]] data_type type(size_type i) const { return _types.at(i); }
+
+  /**
+   * @brief Returns the size in bytes of the packed buffer of the batch.
+   *
+   * @return The size in bytes of the values and validities
+   */
+  [[nodiscard]] std::size_t size_bytes() const noexcept { return _data.size(); }
+
+  /**
+   * @brief Returns a raw pointer to a value in device memory.
+   *
+   * @param i Index of the value
+   * @return Raw pointer to the value in device memory
+   */
+  void* data(size_type i) { return static_cast<uint8_t*>(_data.data()) + _offsets.at(i); }
+
+  /**
+   * @brief Returns a const raw pointer to a value in device memory.
+   *
+   * @param i Index of the value
+   * @return Raw pointer to the value in device memory
+   */
+  [[nodiscard]] void const* data(size_type i) const
+  {
+    return static_cast<uint8_t const*>(_data.data()) + _offsets.at(i);
+  }
+
+  /**
+   * @brief Returns a raw pointer to the validity bool of a value in device memory.
+   *
+   * @param i Index of the value
+   * @return Raw pointer to the validity bool in device memory
+   */
+  bool* validity_data(size_type i)
+  {
+    return reinterpret_cast<bool*>(static_cast<uint8_t*>(_data.data()) + validity_offset(i));
+  }
+
+  /**
+   * @brief Returns a const raw pointer to the validity bool of a value in device memory.
+   *
+   * @param i Index of the value
+   * @return Raw pointer to the validity bool in device memory
+   */
+  [[nodiscard]] bool const* validity_data(size_type i) const
+  {
+    return reinterpret_cast<bool const*>(static_cast<uint8_t const*>(_data.data()) +
+                                         validity_offset(i));
+  }
+
+  /**
+   * @brief Copies the packed buffer of the batch to host memory, asynchronously on `stream`.
+   *
+   * The copy is complete once `stream` is synchronized; the values are then read from `host` with
+   * `is_valid()` and `value()`. Copies to pageable host memory are synchronous, so pinned host
+   * memory should be used to keep the copy asynchronous.
+   *
+   * @throw std::invalid_argument if `host` is smaller than `size_bytes()`
+   *
+   * @param host Host memory receiving the packed buffer
+   * @param stream CUDA stream used for the copy
+   */
+  void copy_to_host_async(host_span<uint8_t> host,
+                          rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * @brief Returns whether a value is valid in a host copy of the batch.
+   *
+   * @param host Host copy of the packed buffer, made by `copy_to_host_async()`
+   * @param i Index of the value
+   * @return true if the value is valid
+   */
+  [[nodiscard]] bool is_valid(host_span<uint8_t const> host, size_type i) const
+  {
+    return host[validity_offset(i)] != 0;
+  }
+
+  /**
+   * @brief Returns a value from a host copy of the batch.
+   *
+   * @throw cudf::data_type_error if `T` does not have the size of the value's type
+   *
+   * @tparam T Type of the value, e.g. the storage type of its data type
+   * @param host Host copy of the packed buffer, made by `copy_to_host_async()`
+   * @param i Index of the value
+   * @return The value, undefined if it is null
+   */
+  template <typename T>
+  [[nodiscard]] T value(host_span<uint8_t const> host, size_type i) const
+  {
+    CUDF_EXPECTS(sizeof(T) == size_of(type(i)),
+                 "The value type does not match the size of the scalar type",
+                 cudf::data_type_error);
+    T result;
+    std::memcpy(&result, host.data() + _offsets.at(i), sizeof(T));
+    return result;
+  }
+
+ private:
+  [[nodiscard]] std::size_t validity_offset(size_type i) const
+  {
+    CUDF_EXPECTS(i >= 0 && i < size(), "Scalar index out of bounds", std::out_of_range);
+    return _validity_offset + static_cast<std::size_t>(i);
+  }
+
+  std::vector<data_type> _types;      ///< Data type of every value
+  std::vector<std::size_t> _offsets;  ///< Offset of every value in the buffer
+  std::size_t _validity_offset{0};    ///< Offset of the validity of the first value
+  rmm::device_buffer _data;           ///< Packed values and validities
+};
+
+/** @} */  // end of group
+}  // namespace cudf
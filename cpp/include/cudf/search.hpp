@@ -20,7 +20,9 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <vector>
@@ -166,5 +168,99 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A set of values built once from a column, for checking many needle columns against it.
+ *
+ * `contains(column_view const&, column_view const&)` builds a hash set of the haystack on every
+ * call. A membership index instead keeps the distinct non-null values of the haystack sorted,
+ * so each probe is only a binary search per needle. The sorted values also answer whether any of
+ * them lies within a range, which prunes the row groups of a Parquet file with the min/max
+ * statistics of a column; see `parquet_reader_options::set_membership_filter`.
+ *
+ * Nulls are never members and NaNs are equal to each other.
+ *
+ * @code{.pseudo}
+ *   index    = membership_index({ 30, 10, null, 10, 50 })
+ *   index.contains({ 10, 20, null, 50 })    = { true, false, null, true }
+ *   index.intersects({ 0, 11, 40 }, { 10, 29, 60 }) = { true, false, true }
+ * @endcode
+ */
+class membership_index {
+ public:
+  membership_index()                                   = delete;
+  ~membership_index()                                  = default;
+  membership_index(membership_index const&)            = delete;
+  membership_index& operator=(membership_index const&) = delete;
+  membership_index(membership_index&&)                 = default;  ///< Move constructor
+  /**
+   * @brief Move assignment
+   *
+   * @return Reference to this membership index
+   */
+  membership_index& operator=(membership_index&&) = default;
+
+  /**
+   * @brief Builds the index of the values of a column.
+   *
+   * @throws cudf::data_type_error if `haystack` is a dictionary column
+   *
+   * @param haystack The column containing the search space
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the index's device memory
+   */
+  explicit membership_index(
+    column_view const& haystack,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Checks which `needles` are values of the haystack.
+   *
+   * The result has the null mask of `needles`, as with `contains`.
+   *
+   * @throws cudf::data_type_error if `needles` does not have the type of the haystack
+   *
+   * @param needles A column of values to check for existence in the haystack
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL column indicating if each element in `needles` exists in the haystack
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    column_view const& needles,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Checks which ranges `[lower[i], upper[i]]` contain a value of the haystack.
+   *
+   * A range with a null bound is unbounded on that side, as with missing statistics, and so
+   * contains a value of any non-empty haystack.
+   *
+   * @throws cudf::data_type_error if `lower` or `upper` do not have the type of the haystack
+   * @throws std::invalid_argument if `lower` and `upper` have different sizes
+   *
+   * @param lower The lower bounds of the ranges
+   * @param upper The upper bounds of the ranges
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL column without nulls indicating if each range contains a value
+   */
+  [[nodiscard]] std::unique_ptr<column> intersects(
+    column_view const& lower,
+    column_view const& upper,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the distinct non-null values of the haystack in ascending order.
+   *
+   * @return The sorted values
+   */
+  [[nodiscard]] column_view keys() const { return _keys->view(); }
+
+ private:
+  std::unique_ptr<column> _keys;  ///< Sorted distinct non-null values of the haystack
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -19,13 +19,18 @@
 #include <cudf/aggregation.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
 namespace cudf {
+namespace detail {
+struct spilled_table;
+}  // namespace detail
 
 /**
  * @addtogroup column_sort
@@ -115,6 +120,18 @@ std::unique_ptr<table> sort(
   rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Estimates the device memory used by `sort` on `input`.
+ *
+ * Sizes of strings and nested columns are measured on the device, which synchronizes `stream`.
+ *
+ * @param input The table to sort
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The estimated device memory of the sort
+ */
+memory_estimate estimate_sort_memory(table_view const& input,
+                                     rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /**
  * @brief Performs a stable lexicographic sort of the rows of a table
  *
@@ -210,6 +227,48 @@ std::unique_ptr<column> rank(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the ranks of input column from its already known sorted order.
+ *
+ * Computes the same ranks as `rank()` without sorting `input`, given the indices of its rows
+ * in the sorted order of the ranking, for example the result of `sorted_order()` or
+ * `stable_sorted_order()` of `input` shared by several rank computations. The ranks of a
+ * column that is already sorted are computed from a sequence of indices.
+ *
+ * `rank_method::FIRST` ranks equal elements by their position in `sorted_order`, so the
+ * order of a stable sort gives the same ranks as `rank()`.
+ *
+ * @code{.pseudo}
+ * input        = { 1, 2, 2, 4, 5 }
+ * sorted_order = { 0, 1, 2, 3, 4 }
+ * MIN          = { 1, 2, 2, 4, 5 }
+ * DENSE        = { 1, 2, 2, 3, 4 }
+ * @endcode
+ *
+ * @throws cudf::data_type_error if `sorted_order` is not a `size_type` column
+ * @throws cudf::logic_error if `sorted_order` has nulls or a size different from `input`
+ *
+ * @param input The column to rank
+ * @param sorted_order The indices of the rows of `input` in sorted order
+ * @param method The ranking method used for tie breaking (same values)
+ * @param null_handling  flag to include nulls during ranking. If nulls are not
+ * included, corresponding rank will be null.
+ * @param percentage flag to convert ranks to percentage in range (0,1]
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A column of containing the rank of the each element of the column of `input`. The output
+ * column type will be `size_type`column by default or else `double` when
+ * `method=rank_method::AVERAGE` or `percentage=True`
+ */
+std::unique_ptr<column> rank(
+  column_view const& input,
+  column_view const& sorted_order,
+  rank_method method,
+  null_policy null_handling,
+  bool percentage,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns sorted order after sorting each segment in the table.
  *
@@ -344,5 +403,232 @@ std::unique_ptr<table> stable_segmented_sort_by_key(
   rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the indices of the `k` first non-null elements of a column in sorted order.
+ *
+ * Unlike `sorted_order`, only the candidates for the `k` first positions are sorted, so the cost
+ * is close to a single pass over `col` when `k` is small.
+ *
+ * @code{.pseudo}
+ * col = {4, 1, null, 7, 3, 7}
+ * top_k_order(col, 3, order::DESCENDING) = {3, 5, 0}
+ * top_k_order(col, 3, order::ASCENDING)  = {1, 4, 0}
+ * @endcode
+ *
+ * @throw std::invalid_argument if `k` is negative
+ *
+ * @param col The column to select the elements from
+ * @param k The number of elements to select
+ * @param sort_order `DESCENDING` to select the largest elements, `ASCENDING` the smallest
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The indices of the selected elements in sorted order, fewer than `k` if `col` has
+ * fewer than `k` non-null elements
+ */
+std::unique_ptr<column> top_k_order(
+  column_view const& col,
+  size_type k,
+  order sort_order                    = order::DESCENDING,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the `k` first non-null elements of a column in sorted order.
+ *
+ * @code{.pseudo}
+ * col = {4, 1, null, 7, 3, 7}
+ * top_k(col, 3, order::DESCENDING) = {7, 7, 4}
+ * @endcode
+ *
+ * @throw std::invalid_argument if `k` is negative
+ *
+ * @param col The column to select the elements from
+ * @param k The number of elements to select
+ * @param sort_order `DESCENDING` to select the largest elements, `ASCENDING` the smallest
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The selected elements in sorted order
+ */
+std::unique_ptr<column> top_k(
+  column_view const& col,
+  size_type k,
+  order sort_order                    = order::DESCENDING,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the indices of the `k` first rows of a table in lexicographic sorted order.
+ *
+ * The result is the `k` first indices of `stable_sorted_order(keys, column_order,
+ * null_precedence)`, so nulls are ordered by `null_precedence` rather than excluded. Instead of
+ * sorting all the rows, a radix select finds the leading bytes of the `k`-th row's normalized key,
+ * and only the rows that do not start after it are sorted. Tables with nested or dictionary
+ * columns, or too many columns for their keys to be normalized, are fully sorted.
+ *
+ * @code{.pseudo}
+ * keys = {{1, 3, 1, 2, 1}, {5, 0, 4, 9, 4}}
+ * top_k_order(keys, 3) = {2, 4, 0}
+ * @endcode
+ *
+ * @throw std::invalid_argument if `k` is negative
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is not empty and its size
+ * differs from the number of columns of `keys`
+ *
+ * @param keys The table to select the rows from
+ * @param k The number of rows to select
+ * @param column_order The desired order of each column, ascending if empty
+ * @param null_precedence The desired order of nulls compared to other elements of each column,
+ * `null_order::BEFORE` if empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The indices of the `min(k, keys.num_rows())` first rows of `keys` in sorted order
+ */
+std::unique_ptr<column> top_k_order(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the rows of a table of values for the `k` first rows of a table of keys in
+ * lexicographic sorted order.
+ *
+ * Like `sort_by_key` restricted to the `k` first rows, see `top_k_order`.
+ *
+ * @code{.pseudo}
+ * keys   = {{1, 3, 1, 2, 1}, {5, 0, 4, 9, 4}}
+ * values = {{'a', 'b', 'c', 'd', 'e'}}
+ * top_k_by_key(values, keys, 3) = {{'c', 'e', 'a'}}
+ * @endcode
+ *
+ * @throw std::invalid_argument if `k` is negative
+ * @throw cudf::logic_error if `values` and `keys` have different numbers of rows
+ *
+ * @param values The table to gather the rows from
+ * @param keys The table that determines the order of the rows
+ * @param k The number of rows to select
+ * @param column_order The desired order of each column of `keys`, ascending if empty
+ * @param null_precedence The desired order of nulls compared to other elements of each column of
+ * `keys`, `null_order::BEFORE` if empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The rows of `values` of the `min(k, keys.num_rows())` first rows of `keys`
+ */
+std::unique_ptr<table> top_k_by_key(
+  table_view const& values,
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Sorts tables larger than device memory by spilling sorted runs to host memory and
+ * merging them back in chunks.
+ *
+ * Each batch given to `add_batch` is sorted on the device into a run, which is split into blocks
+ * of about `chunk_size` bytes that are copied to host memory. `next_chunk` then merges the runs
+ * with a k-way merge that keeps at most one block of each run on the device: every call emits
+ * the rows of the loaded blocks not greater than the smallest last row of those blocks, which
+ * are merged with `cudf::merge`, and loads the next block of the runs it exhausted. The chunks
+ * are thus in sorted order and a chunk has at most the rows of one block of each run.
+ *
+ * The order of rows with equal keys is unspecified, as for `cudf::sort`.
+ *
+ * Example:
+ * ```
+ * key_cols: {0}, column_order: {ASCENDING}
+ *
+ * add_batch({{4 1 7}, {'a' 'b' 'c'}})
+ * add_batch({{3 8 2}, {'d' 'e' 'f'}})
+ *
+ * next_chunk() until has_next() is false, concatenated:
+ * {{1 2 3 4 7 8}, {'b' 'f' 'd' 'a' 'c' 'e'}}
+ * ```
+ */
+class external_sorter {
+ public:
+  external_sorter() = delete;
+  ~external_sorter();
+  external_sorter(external_sorter const&) = delete;
+  external_sorter(external_sorter&&);
+  external_sorter& operator=(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter&&);
+
+  /**
+   * @brief Constructs an external sorter of the rows of tables by some of their columns.
+   *
+   * @throws cudf::logic_error If `column_order` and `key_cols` have different sizes, or
+   * `null_precedence` is not empty and has a different size than `key_cols`
+   * @throws cudf::logic_error If `chunk_size` is not positive
+   *
+   * @param key_cols Indices of the key columns of the tables
+   * @param column_order The desired order of each key column
+   * @param null_precedence The desired order of nulls compared to other elements of each key
+   * column, `null_order::BEFORE` if empty
+   * @param chunk_size Approximate size in bytes of the blocks the sorted runs are spilled in
+   */
+  external_sorter(std::vector<size_type> key_cols,
+                  std::vector<order> column_order,
+                  std::vector<null_order> null_precedence,
+                  std::size_t chunk_size);
+
+  /**
+   * @brief Sorts a batch of rows into a run and spills it to host memory.
+   *
+   * @throws cudf::logic_error If a key column index is out of bounds of `input`
+   * @throws cudf::logic_error If the types of the columns of `input` differ from the previous
+   * batches
+   * @throws cudf::logic_error If `next_chunk` was already called
+   *
+   * @param input The batch of rows to sort
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add_batch(table_view const& input,
+                 rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Merges the next chunk of rows of the sorted runs.
+   *
+   * @throws cudf::logic_error If `has_next()` is false
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The next rows of the batches in sorted order
+   */
+  [[nodiscard]] std::unique_ptr<table> next_chunk(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns whether some rows of the batches were not returned by `next_chunk` yet.
+   *
+   * @return true if `next_chunk` can be called
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Returns the number of sorted runs, one per non-empty batch.
+   *
+   * @return The number of runs
+   */
+  [[nodiscard]] size_type num_runs() const { return static_cast<size_type>(_runs.size()); }
+
+ private:
+  std::vector<size_type> _key_cols;            ///< Indices of the key columns
+  std::vector<order> _column_order;            ///< Order of each key column
+  std::vector<null_order> _null_precedence;    ///< Order of nulls of each key column
+  std::size_t _chunk_size;                     ///< Approximate size of the blocks of the runs
+  std::vector<data_type> _types;               ///< Types of the columns of the first batch
+  bool _merging{false};                        ///< Whether `next_chunk` was called
+  std::vector<std::vector<cudf::detail::spilled_table>>
+    _runs;                                     ///< Spilled blocks of each run
+  std::vector<std::size_t> _next_blocks;       ///< Index of the next block to load of each run
+  std::vector<std::unique_ptr<table>> _heads;  ///< Loaded rows of each run not merged yet
+};
+
 /** @} */  // end of group
 }  // namespace cudf
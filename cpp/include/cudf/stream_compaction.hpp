@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,15 +16,26 @@
 
 #pragma once
 
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
 #include <vector>
 
 namespace cudf {
+// forward declaration
+namespace detail {
+class streaming_distinct;
+}  // namespace detail
+
 /**
  * @addtogroup reorder_compact
  * @{
@@ -207,6 +218,246 @@ std::unique_ptr<table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A table whose number of rows is known on the device only.
+ *
+ * Returned by the deferred-size variants of operations whose output size depends on the data,
+ * such as `apply_boolean_mask_deferred`. Those operations allocate their output with an upper
+ * bound of its size, and leave the actual size on the device rather than synchronizing the
+ * stream to read it, so that the host can keep enqueuing work ahead of the device.
+ *
+ * `release` reads the sizes back with a single synchronization, and frees the slack of the
+ * upper-bound allocations.
+ */
+class deferred_table {
+ public:
+  deferred_table()                                 = delete;
+  deferred_table(deferred_table const&)            = delete;
+  deferred_table& operator=(deferred_table const&) = delete;
+  deferred_table(deferred_table&&)                 = default;  ///< Move constructor
+  /**
+   * @brief Move assignment
+   *
+   * @return Reference to this table
+   */
+  deferred_table& operator=(deferred_table&&) = default;
+  ~deferred_table()                           = default;
+
+  /**
+   * @brief Constructs a deferred table from columns allocated with an upper bound of their size.
+   *
+   * @param columns The output columns, all of the same upper-bound size
+   * @param counts Device array holding the number of rows followed by the null count of each
+   * column
+   */
+  deferred_table(std::vector<std::unique_ptr<column>>&& columns,
+                 rmm::device_uvector<size_type>&& counts);
+
+  /**
+   * @brief Returns the device pointer to the number of rows of the table.
+   *
+   * The value is only valid after the work of the producing operation completed, which kernels
+   * enqueued on its stream are ordered after.
+   *
+   * @return Device pointer to the number of rows
+   */
+  [[nodiscard]] size_type const* num_rows() const { return _counts.data(); }
+
+  /**
+   * @brief Returns the upper bound of the number of rows the columns are allocated with.
+   *
+   * @return The allocated number of rows
+   */
+  [[nodiscard]] size_type capacity() const
+  {
+    return _columns.empty() ? 0 : _columns.front()->size();
+  }
+
+  /**
+   * @brief Returns a view of the columns with `capacity()` rows.
+   *
+   * Only the first `*num_rows()` rows hold data, and the null counts of the columns are not
+   * known, so the view must only be read by kernels bounded by `num_rows()`.
+   *
+   * @return View of the allocated rows
+   */
+  [[nodiscard]] table_view capacity_view() const;
+
+  /**
+   * @brief Reads the number of rows and null counts back, and returns the resulting table.
+   *
+   * Synchronizes `stream`. Columns using less than half of their capacity are copied into
+   * buffers of their actual size, allocated with `mr`, to free the slack; other columns keep
+   * their buffers. The deferred table is left empty.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the shrunk buffers
+   * @return The table with its actual number of rows
+   */
+  std::unique_ptr<table> release(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  std::vector<std::unique_ptr<column>> _columns;  ///< Columns of the upper-bound size
+  rmm::device_uvector<size_type> _counts;         ///< Number of rows, then null counts
+};
+
+/**
+ * @brief Filters `input` using `boolean_mask`, without reading the output size back to the host.
+ *
+ * Same as `apply_boolean_mask`, except that the stream is not synchronized: the output columns
+ * are allocated with `input.num_rows()` rows, and the number of rows passing the mask is left on
+ * the device until `deferred_table::release` is called.
+ *
+ * @throws cudf::logic_error if `input.num_rows() != boolean_mask.size()`.
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ * @throws cudf::data_type_error if a column of `input` is not fixed-width.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used
+ * as a mask to filter the `input`.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table of the rows of @p input passing the filter, sized on the device
+ */
+deferred_table apply_boolean_mask_deferred(
+  table_view const& input,
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief The rows of a table passing a filter, as a list of row indices.
+ *
+ * Filtering a table with `apply_boolean_mask` copies every column, even when the following
+ * operations read only a few of them. A selection vector instead records which rows passed, so
+ * that a pipeline can defer copying rows to its end:
+ * - `compute_column` evaluates an expression over the selected rows only, reading the unfiltered
+ *   table directly;
+ * - `materialize` copies the selected rows of only the columns an operation needs, e.g. the keys
+ *   and values of a groupby, or the input column of a reduction;
+ * - `to_source_rows` converts row indices into the selected rows, such as the gather maps of a
+ *   join computed on materialized keys, back to rows of the unfiltered table, so the remaining
+ *   columns are gathered once, at the end of the pipeline.
+ */
+class selection_vector {
+ public:
+  selection_vector()                                   = delete;
+  selection_vector(selection_vector const&)            = delete;
+  selection_vector& operator=(selection_vector const&) = delete;
+  selection_vector(selection_vector&&)                 = default;  ///< Move constructor
+  /**
+   * @brief Move assignment
+   *
+   * @return Reference to this selection vector
+   */
+  selection_vector& operator=(selection_vector&&) = default;
+  ~selection_vector()                             = default;
+
+  /**
+   * @brief Constructs a selection vector from the indices of the selected rows.
+   *
+   * @throws std::invalid_argument if `source_rows` is negative
+   *
+   * @param indices Indices of the selected rows, in `[0, source_rows)`
+   * @param source_rows Number of rows of the table the rows are selected from
+   */
+  selection_vector(rmm::device_uvector<size_type>&& indices, size_type source_rows);
+
+  /**
+   * @brief Returns the number of selected rows.
+   *
+   * @return The number of selected rows
+   */
+  [[nodiscard]] size_type size() const { return static_cast<size_type>(_indices.size()); }
+
+  /**
+   * @brief Returns the number of rows of the table the rows are selected from.
+   *
+   * @return The number of source rows
+   */
+  [[nodiscard]] size_type source_rows() const { return _source_rows; }
+
+  /**
+   * @brief Returns the indices of the selected rows.
+   *
+   * @return Device span of the indices, in ascending order if produced by
+   * `make_selection_vector`
+   */
+  [[nodiscard]] device_span<size_type const> indices() const
+  {
+    return device_span<size_type const>{_indices.data(), _indices.size()};
+  }
+
+  /**
+   * @brief Returns the indices of the selected rows as an INT32 column, for use as a gather map.
+   *
+   * @return Non-owning view of the indices
+   */
+  [[nodiscard]] column_view gather_map() const;
+
+ private:
+  rmm::device_uvector<size_type> _indices;  ///< Indices of the selected rows
+  size_type _source_rows;                   ///< Number of rows of the source table
+};
+
+/**
+ * @brief Returns the rows for which `boolean_mask` is true and not null, without copying any
+ * column.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param boolean_mask A nullable column_view of type type_id::BOOL8 selecting rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned selection vector
+ * @return Selection vector of the rows passing `boolean_mask`, in ascending order
+ */
+selection_vector make_selection_vector(
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Copies the selected rows of `input`.
+ *
+ * Equivalent to `apply_boolean_mask` with the mask the selection was made from. Pass a
+ * `table_view::select` of `input` to copy only the columns that are read next.
+ *
+ * @throws std::invalid_argument if `input.num_rows() != selection.source_rows()`
+ *
+ * @param input The table to copy rows from
+ * @param selection The rows to copy
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table of the selected rows of `input`
+ */
+std::unique_ptr<table> materialize(
+  table_view const& input,
+  selection_vector const& selection,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts indices of selected rows into indices of the rows of the source table.
+ *
+ * `rows[i]` indexes the table materialized from `selection`, e.g. `rows` is a gather map
+ * returned by a join of materialized keys. The result indexes the source table instead, so
+ * other columns can be gathered from it directly. Indices outside `[0, selection.size())`, such
+ * as the out-of-bounds markers of outer joins, are passed through unchanged.
+ *
+ * @param rows Indices into the selected rows
+ * @param selection The selection the rows are relative to
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices
+ * @return Indices into the source table
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> to_source_rows(
+  device_span<size_type const> rows,
+  selection_vector const& selection,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
@@ -300,6 +551,102 @@ std::unique_ptr<column> distinct_indices(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Width of the row hashes compared by hash-only distinct operations.
+ */
+enum class row_hash_width : int32_t {
+  BITS_64,  ///< 64-bit hashes, suited to tables of up to millions of distinct rows
+  BITS_128  ///< 128-bit hashes, for which a collision is negligible at any table size
+};
+
+/**
+ * @brief Create a column of indices of the distinct rows of a table, comparing row hashes only.
+ *
+ * The rows are hashed once and two rows are considered equal if their hashes are equal, so no
+ * row is compared with another row. This is much cheaper than `distinct_indices` for wide or
+ * nested rows, but is probabilistic: two distinct rows whose hashes collide are deduplicated as
+ * if they were equal. Nulls are equal to each other and NaNs are equal to each other.
+ *
+ * If `verify` is true, the number of distinct rows is counted with full row comparisons and, if
+ * any two distinct rows share a hash, the result is computed by `distinct_indices` instead. The
+ * result is then exact, at the cost of a hash set build over the full rows.
+ *
+ * @param input The input table
+ * @param keep Get index of any, first, last, or none of the found duplicates
+ * @param width The width of the row hashes
+ * @param verify Whether to check the result for hash collisions
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector
+ * @return Column containing the result indices
+ */
+std::unique_ptr<column> distinct_indices_by_hash(
+  table_view const& input,
+  duplicate_keep_option keep          = duplicate_keep_option::KEEP_ANY,
+  row_hash_width width                = row_hash_width::BITS_64,
+  bool verify                         = false,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Deduplicates rows across a stream of tables.
+ *
+ * The 64-bit hashes of the distinct rows inserted so far are kept in a device hash set, so each
+ * batch only returns the rows that were not seen in this or any earlier batch. As with
+ * `distinct_indices_by_hash`, rows are compared by hash only, nulls are equal to each other and
+ * NaNs are equal to each other. The set grows as rows are inserted.
+ *
+ * All batches must have the same schema.
+ *
+ * @code{.pseudo}
+ * streaming_distinct events;
+ * events.insert({{1, 2, 1}})  = [0, 1]
+ * events.insert({{2, 3, 3}})  = [1]
+ * events.size()               = 3
+ * @endcode
+ */
+class streaming_distinct {
+ public:
+  ~streaming_distinct();
+  streaming_distinct(streaming_distinct const&)            = delete;
+  streaming_distinct(streaming_distinct&&)                 = delete;
+  streaming_distinct& operator=(streaming_distinct const&) = delete;
+  streaming_distinct& operator=(streaming_distinct&&)      = delete;
+
+  /**
+   * @brief Constructs an empty set of rows.
+   *
+   * @param expected_rows The expected number of distinct rows, used to size the set
+   * @param stream CUDA stream used to allocate the set
+   */
+  explicit streaming_distinct(std::size_t expected_rows    = 0,
+                              rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Inserts the rows of a batch and returns the indices of those not seen before.
+   *
+   * Of several equal rows of `batch`, only the first is returned.
+   *
+   * @param batch The rows to insert
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column
+   * @return Ascending indices of the rows of `batch` not inserted before
+   */
+  std::unique_ptr<column> insert(
+    table_view const& batch,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the number of distinct rows inserted so far.
+   *
+   * @return The number of distinct rows
+   */
+  [[nodiscard]] std::size_t size() const;
+
+ private:
+  std::unique_ptr<detail::streaming_distinct> _impl;
+};
+
 /**
  * @brief Create a new table without duplicate rows, preserving input order.
  *
@@ -397,5 +744,23 @@ cudf::size_type distinct_count(column_view const& input,
 cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal = null_equality::EQUAL);
 
+/**
+ * @brief Estimate the number of distinct values summarized by each HyperLogLog++ sketch.
+ *
+ * The sketches are produced by the `HLLPP` and `MERGE_HLLPP` aggregations, whose precision is
+ * inferred from the number of fields of the sketches. The estimate of a null sketch is null.
+ *
+ * @throw cudf::logic_error if `sketches` is not a column of HyperLogLog++ sketches
+ *
+ * @param sketches The HyperLogLog++ sketches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT64 column of the estimated distinct counts
+ */
+std::unique_ptr<column> estimate_distinct_count(
+  column_view const& sketches,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
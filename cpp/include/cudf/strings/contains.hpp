@@ -206,6 +206,49 @@ std::unique_ptr<column> like(
   rmm::cuda_stream_view stream          = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr   = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a boolean column identifying rows which
+ * match any of the given like patterns
+ *
+ * The like pattern expects only 2 wildcard special characters:
+ * - `%` zero or more of any character
+ * - `_` any single character
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["azaa", "ababaabba", "bbb", "xyz"]
+ * p = ["%a", "b%"]
+ * r = like_any(s, p)
+ * r is now [1, 1, 1, 0]
+ * @endcode
+ *
+ * The patterns are compiled once for all the rows, which is faster than
+ * computing `like` for each pattern and combining the results.
+ *
+ * Specify an escape character to include either `%` or `_` in the search.
+ * The `escape_character` is expected to be either 0 or 1 characters.
+ * If more than one character is specified only the first character is used.
+ * The escape character is applied to all patterns.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @throw cudf::logic_error if `patterns` contains nulls or `escape_character` is invalid
+ *
+ * @param input Strings instance for this operation
+ * @param patterns Like patterns to match within each string
+ * @param escape_character Optional character specifies the escape prefix.
+ *                         Default is no escape character.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New boolean column
+ */
+std::unique_ptr<column> like_any(
+  strings_column_view const& input,
+  strings_column_view const& patterns,
+  string_scalar const& escape_character = string_scalar(""),
+  rmm::cuda_stream_view stream          = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr   = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <thrust/optional.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Parses exactly two decimal digits.
+ *
+ * @param str Pointer to the two characters to parse
+ * @param[out] value The parsed value, set only when both characters are digits
+ * @return true if both characters are digits
+ */
+__device__ inline bool parse_two_digits(char const* str, int32_t& value)
+{
+  auto const d0 = static_cast<uint32_t>(str[0] - '0');
+  auto const d1 = static_cast<uint32_t>(str[1] - '0');
+  if (d0 > 9 || d1 > 9) { return false; }
+  value = static_cast<int32_t>(d0 * 10 + d1);
+  return true;
+}
+
+/**
+ * @brief Parses exactly four decimal digits with a single 32-bit word.
+ *
+ * The characters are validated and combined in pairs within the word (SWAR) instead of being
+ * converted one at a time.
+ *
+ * @param str Pointer to the four characters to parse; no alignment is required
+ * @param[out] value The parsed value, set only when all characters are digits
+ * @return true if all four characters are digits
+ */
+__device__ inline bool parse_four_digits(char const* str, int32_t& value)
+{
+  uint32_t chars;
+  memcpy(&chars, str, sizeof(chars));
+  // the first character is in the low byte
+  auto const digits = chars - 0x3030'3030u;
+  // a byte is above 9 (or wrapped below 0) if it or its sum with 0x76 has the high bit set
+  if (((digits | (digits + 0x7676'7676u)) & 0x8080'8080u) != 0) { return false; }
+  auto const pairs = (digits * 10 + (digits >> 8)) & 0x00ff'00ffu;
+  value            = static_cast<int32_t>((pairs * (1 + (100u << 16))) >> 16);
+  return true;
+}
+
+/**
+ * @brief Calendar and time of day fields of an ISO-8601 timestamp
+ */
+struct iso_datetime {
+  int32_t year;
+  int32_t month;
+  int32_t day;
+  int32_t hour;
+  int32_t minute;
+  int32_t second;
+};
+
+/**
+ * @brief Parses `YYYY-MM-DD` or `YYYY-MM-DDTHH:MM:SS` into its fields.
+ *
+ * A space is also accepted between the date and the time of day. Any other input, including
+ * other lengths, returns an empty optional so the caller can fall back to a general parser.
+ *
+ * @param str Pointer to the first character of the string
+ * @param bytes Number of bytes in the string
+ * @return The parsed fields if the string has one of the two fixed-width layouts
+ */
+__device__ inline thrust::optional<iso_datetime> parse_iso_datetime(char const* str,
+                                                                    size_type bytes)
+{
+  constexpr size_type date_width     = 10;
+  constexpr size_type datetime_width = 19;
+  if (bytes != date_width && bytes != datetime_width) { return thrust::nullopt; }
+
+  iso_datetime result{0, 0, 0, 0, 0, 0};
+  if (str[4] != '-' || str[7] != '-' || !parse_four_digits(str, result.year) ||
+      !parse_two_digits(str + 5, result.month) || !parse_two_digits(str + 8, result.day)) {
+    return thrust::nullopt;
+  }
+  if (bytes == date_width) { return result; }
+
+  if ((str[10] != 'T' && str[10] != ' ') || str[13] != ':' || str[16] != ':' ||
+      !parse_two_digits(str + 11, result.hour) || !parse_two_digits(str + 14, result.minute) ||
+      !parse_two_digits(str + 17, result.second)) {
+    return thrust::nullopt;
+  }
+  return result;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
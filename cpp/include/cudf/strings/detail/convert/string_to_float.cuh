@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/strings/detail/convert/decimal_to_binary.cuh>
 #include <cudf/strings/detail/convert/is_float.cuh>
 #include <cudf/strings/string_view.cuh>
 
@@ -32,6 +33,7 @@ namespace detail {
  * to the appropriate float values.
  *
  * This function will also handle scientific notation format.
+ * The result is the double nearest to the decimal value for up to 19 significant digits.
  */
 __device__ inline double stod(string_view const& d_str)
 {
@@ -45,11 +47,9 @@ __device__ inline double stod(string_view const& d_str)
   }
 
 #ifndef CUDF_JIT_UDF
-  constexpr double infinity      = std::numeric_limits<double>::infinity();
-  constexpr uint64_t max_holding = (std::numeric_limits<uint64_t>::max() - 9L) / 10L;
+  constexpr double infinity = std::numeric_limits<double>::infinity();
 #else
-  constexpr double infinity      = (1.0 / 0.0);
-  constexpr uint64_t max_holding = (18446744073709551615UL - 9UL) / 10UL;
+  constexpr double infinity = (1.0 / 0.0);
 #endif
 
   // special strings: NaN, Inf
@@ -59,11 +59,13 @@ __device__ inline double stod(string_view const& d_str)
     if (is_inf_str(inf_nan)) return sign * infinity;
   }
 
-  // Parse and store the mantissa as much as we can,
-  // until we are about to exceed the limit of uint64_t
+  // Parse and store the significant digits of the mantissa as long as
+  // they are exact in uint64_t; the exponent offset accounts for the rest
   uint64_t digits = 0;
+  int num_digits  = 0;
   int exp_off     = 0;
   bool decimal    = false;
+  bool truncated  = false;
   while (in_ptr < end) {
     char ch = *in_ptr;
     if (ch == '.') {
@@ -72,15 +74,13 @@ __device__ inline double stod(string_view const& d_str)
       continue;
     }
     if (ch < '0' || ch > '9') break;
-    if (digits > max_holding)
-      exp_off += (int)!decimal;
-    else {
+    if (num_digits < max_exact_decimal_digits) {
       digits = (digits * 10L) + static_cast<uint64_t>(ch - '0');
-      if (digits > max_holding) {
-        digits = digits / 10L;
-        exp_off += (int)!decimal;
-      } else
-        exp_off -= (int)decimal;
+      num_digits += (int)(digits > 0);  // leading zeros are not significant
+      exp_off -= (int)decimal;
+    } else {
+      truncated = truncated || (ch != '0');
+      exp_off += (int)!decimal;
     }
     ++in_ptr;
   }
@@ -101,37 +101,14 @@ __device__ inline double stod(string_view const& d_str)
         while (in_ptr < end) {
           ch = *in_ptr++;
           if (ch < '0' || ch > '9') break;
-          exp_ten = (exp_ten * 10) + (int)(ch - '0');
+          // large enough to overflow or underflow any mantissa
+          if (exp_ten < 100'000) { exp_ten = (exp_ten * 10) + (int)(ch - '0'); }
         }
       }
     }
   }
 
-  int const num_digits = static_cast<int>(log10(static_cast<double>(digits))) + 1;
-  exp_ten *= exp_sign;
-  exp_ten += exp_off;
-  exp_ten += num_digits - 1;
-  if (exp_ten > std::numeric_limits<double>::max_exponent10) {
-    return sign > 0 ? infinity : -infinity;
-  }
-
-  double base = sign * static_cast<double>(digits);
-
-  exp_ten += 1 - num_digits;
-  // If 10^exp_ten would result in a subnormal value, the base and
-  // exponent should be adjusted so that 10^exp_ten is a normal value
-  auto const subnormal_shift = std::numeric_limits<double>::min_exponent10 - exp_ten;
-  if (subnormal_shift > 0) {
-    // Handle subnormal values. Ensure that both base and exponent are
-    // normal values before computing their product.
-    base = base / exp10(static_cast<double>(num_digits - 1 + subnormal_shift));
-    exp_ten += num_digits - 1;  // adjust exponent
-    auto const exponent = exp10(static_cast<double>(exp_ten + subnormal_shift));
-    return base * exponent;
-  }
-
-  double const exponent = exp10(static_cast<double>(std::abs(exp_ten)));
-  return exp_ten < 0 ? base / exponent : base * exponent;
+  return sign * decimal_to_double(digits, exp_sign * exp_ten + exp_off, truncated);
 }
 
 }  // namespace detail
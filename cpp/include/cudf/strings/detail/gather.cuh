@@ -21,8 +21,11 @@
 #include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -36,6 +39,10 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace cudf {
 namespace strings {
@@ -77,24 +84,24 @@ __forceinline__ __device__ uint4 load_uint4(char const* ptr)
  * @param total_out_strings Number of output strings to be gathered.
  */
 template <typename StringIterator, typename MapIterator>
-CUDF_KERNEL void gather_chars_fn_string_parallel(StringIterator strings_begin,
-                                                 char* out_chars,
-                                                 cudf::detail::input_offsetalator const out_offsets,
-                                                 MapIterator string_indices,
-                                                 size_type total_out_strings)
+__device__ void gather_chars_string_parallel(StringIterator strings_begin,
+                                             char* out_chars,
+                                             cudf::detail::input_offsetalator const out_offsets,
+                                             MapIterator string_indices,
+                                             size_type total_out_strings)
 {
   constexpr size_t out_datatype_size = sizeof(uint4);
   constexpr size_t in_datatype_size  = sizeof(uint);
 
-  int global_thread_id = blockIdx.x * blockDim.x + threadIdx.x;
-  int global_warp_id   = global_thread_id / cudf::detail::warp_size;
-  int warp_lane        = global_thread_id % cudf::detail::warp_size;
-  int nwarps           = gridDim.x * blockDim.x / cudf::detail::warp_size;
+  auto const global_thread_id = cudf::detail::grid_1d::global_thread_id();
+  auto const global_warp_id   = global_thread_id / cudf::detail::warp_size;
+  int const warp_lane         = global_thread_id % cudf::detail::warp_size;
+  auto const nwarps           = cudf::detail::grid_1d::grid_stride() / cudf::detail::warp_size;
 
   auto const alignment_offset = reinterpret_cast<std::uintptr_t>(out_chars) % out_datatype_size;
   uint4* out_chars_aligned    = reinterpret_cast<uint4*>(out_chars - alignment_offset);
 
-  for (size_type istring = global_warp_id; istring < total_out_strings; istring += nwarps) {
+  for (auto istring = global_warp_id; istring < total_out_strings; istring += nwarps) {
     auto const out_start = out_offsets[istring];
     auto const out_end   = out_offsets[istring + 1];
 
@@ -142,6 +149,20 @@ CUDF_KERNEL void gather_chars_fn_string_parallel(StringIterator strings_begin,
   }
 }
 
+/**
+ * @brief Gather characters from the input iterator with `gather_chars_string_parallel`.
+ */
+template <typename StringIterator, typename MapIterator>
+CUDF_KERNEL void gather_chars_fn_string_parallel(StringIterator strings_begin,
+                                                 char* out_chars,
+                                                 cudf::detail::input_offsetalator const out_offsets,
+                                                 MapIterator string_indices,
+                                                 size_type total_out_strings)
+{
+  gather_chars_string_parallel(
+    strings_begin, out_chars, out_offsets, string_indices, total_out_strings);
+}
+
 /**
  * @brief Gather characters from the input iterator, with char parallel strategy.
  *
@@ -159,11 +180,11 @@ CUDF_KERNEL void gather_chars_fn_string_parallel(StringIterator strings_begin,
  * @param total_out_strings Number of output strings to be gathered.
  */
 template <int strings_per_threadblock, typename StringIterator, typename MapIterator>
-CUDF_KERNEL void gather_chars_fn_char_parallel(StringIterator strings_begin,
-                                               char* out_chars,
-                                               cudf::detail::input_offsetalator const out_offsets,
-                                               MapIterator string_indices,
-                                               size_type total_out_strings)
+__device__ void gather_chars_char_parallel(StringIterator strings_begin,
+                                           char* out_chars,
+                                           cudf::detail::input_offsetalator const out_offsets,
+                                           MapIterator string_indices,
+                                           size_type total_out_strings)
 {
   __shared__ int64_t out_offsets_threadblock[strings_per_threadblock + 1];
 
@@ -201,6 +222,66 @@ CUDF_KERNEL void gather_chars_fn_char_parallel(StringIterator strings_begin,
   }
 }
 
+/**
+ * @brief Gather characters from the input iterator with `gather_chars_char_parallel`.
+ */
+template <int strings_per_threadblock, typename StringIterator, typename MapIterator>
+CUDF_KERNEL void gather_chars_fn_char_parallel(StringIterator strings_begin,
+                                               char* out_chars,
+                                               cudf::detail::input_offsetalator const out_offsets,
+                                               MapIterator string_indices,
+                                               size_type total_out_strings)
+{
+  gather_chars_char_parallel<strings_per_threadblock>(
+    strings_begin, out_chars, out_offsets, string_indices, total_out_strings);
+}
+
+// Threads per block of the gather kernels, in warps
+constexpr int gather_warps_per_threadblock = 4;
+// The string parallel strategy is used if the average string length is above this threshold,
+// otherwise the char parallel strategy is used
+constexpr size_type gather_string_parallel_threshold = 32;
+// Strings per block of the char parallel strategy
+constexpr int gather_strings_per_threadblock = 32;
+
+/**
+ * @brief Gather characters of several strings columns with the same indices, with a row of blocks
+ * per column.
+ *
+ * Each column is gathered with the strategy `gather_chars` picks from its average string length.
+ * The grid has a block per `gather_strings_per_threadblock` output strings in its x dimension.
+ *
+ * @tparam MapIterator Iterator for retrieving integer indices of the strings columns.
+ *
+ * @param sources The strings columns to gather from.
+ * @param out_chars Output buffer for the gathered characters of each column.
+ * @param out_offsets The offset values associated with each output buffer.
+ * @param string_indices Start of index iterator.
+ * @param total_out_strings Number of output strings to be gathered per column.
+ */
+template <typename MapIterator>
+CUDF_KERNEL void gather_chars_batch_fn(table_device_view const sources,
+                                       char* const* out_chars,
+                                       cudf::detail::input_offsetalator const* out_offsets,
+                                       MapIterator string_indices,
+                                       size_type total_out_strings)
+{
+  for (auto c = static_cast<size_type>(blockIdx.y); c < sources.num_columns(); c += gridDim.y) {
+    auto const strings_begin  = sources.column(c).begin<string_view>();
+    auto const offsets        = out_offsets[c];
+    auto const average_length = (offsets[total_out_strings] - offsets[0]) / total_out_strings;
+    if (average_length > gather_string_parallel_threshold) {
+      gather_chars_string_parallel(
+        strings_begin, out_chars[c], offsets, string_indices, total_out_strings);
+    } else {
+      gather_chars_char_parallel<gather_strings_per_threadblock>(
+        strings_begin, out_chars[c], offsets, string_indices, total_out_strings);
+    }
+    // The char parallel strategy reuses its shared memory for the next column
+    __syncthreads();
+  }
+}
+
 /**
  * @brief Returns a new chars column using the specified indices to select
  * strings from the input iterator.
@@ -235,14 +316,11 @@ rmm::device_uvector<char> gather_chars(StringIterator strings_begin,
   auto chars_data = rmm::device_uvector<char>(chars_bytes, stream, mr);
   auto d_chars    = chars_data.data();
 
-  constexpr int warps_per_threadblock = 4;
-  // String parallel strategy will be used if average string length is above this threshold.
-  // Otherwise, char parallel strategy will be used.
-  constexpr size_type string_parallel_threshold = 32;
+  constexpr int warps_per_threadblock = gather_warps_per_threadblock;
 
   size_type average_string_length = chars_bytes / output_count;
 
-  if (average_string_length > string_parallel_threshold) {
+  if (average_string_length > gather_string_parallel_threshold) {
     constexpr int max_threadblocks = 65536;
     gather_chars_fn_string_parallel<<<
       min((static_cast<int>(output_count) + warps_per_threadblock - 1) / warps_per_threadblock,
@@ -251,7 +329,7 @@ rmm::device_uvector<char> gather_chars(StringIterator strings_begin,
       0,
       stream.value()>>>(strings_begin, d_chars, offsets, map_begin, output_count);
   } else {
-    constexpr int strings_per_threadblock = 32;
+    constexpr int strings_per_threadblock = gather_strings_per_threadblock;
     gather_chars_fn_char_parallel<strings_per_threadblock>
       <<<(output_count + strings_per_threadblock - 1) / strings_per_threadblock,
          warps_per_threadblock * cudf::detail::warp_size,
@@ -325,6 +403,101 @@ std::unique_ptr<cudf::column> gather(strings_column_view const& strings,
                              rmm::device_buffer{});
 }
 
+/**
+ * @brief Returns new strings columns using the specified indices to select
+ * elements from each of the `strings_columns`.
+ *
+ * The sizes of the output strings of all the columns are computed by a single
+ * pass and their characters are copied by a single kernel, instead of a pass
+ * and a kernel per column.
+ *
+ * Caller must update the validity masks in the output columns.
+ *
+ * @tparam NullifyOutOfBounds If true, indices outside the columns' range are nullified.
+ * @tparam MapIterator Iterator for retrieving integer indices of the columns.
+ *
+ * @param strings_columns Strings columns to gather from.
+ * @param begin Start of index iterator.
+ * @param end End of index iterator.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @return New strings columns containing the gathered strings, one per input column.
+ */
+template <bool NullifyOutOfBounds, typename MapIterator>
+std::vector<std::unique_ptr<cudf::column>> gather_columns(table_view const& strings_columns,
+                                                          MapIterator begin,
+                                                          MapIterator end,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const num_columns  = strings_columns.num_columns();
+  auto const output_count = static_cast<size_type>(std::distance(begin, end));
+  std::vector<std::unique_ptr<cudf::column>> results;
+  if (output_count == 0) {
+    for (size_type c = 0; c < num_columns; ++c) {
+      results.push_back(make_empty_column(type_id::STRING));
+    }
+    return results;
+  }
+
+  // sizes of the output strings, column after column
+  auto const temp_mr   = rmm::mr::get_current_device_resource();
+  auto const d_strings = table_device_view::create(strings_columns, stream);
+  auto const num_sizes = static_cast<int64_t>(num_columns) * output_count;
+  rmm::device_uvector<size_type> sizes(num_sizes, stream, temp_mr);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_counting_iterator<int64_t>(0),
+    thrust::make_counting_iterator<int64_t>(num_sizes),
+    sizes.begin(),
+    cuda::proclaim_return_type<size_type>(
+      [d_strings = *d_strings, begin, output_count] __device__(int64_t i) {
+        auto const& d_column = d_strings.column(i / output_count);
+        size_type const idx  = begin[i % output_count];
+        if (NullifyOutOfBounds && (idx < 0 || idx >= d_column.size())) { return 0; }
+        if (not d_column.is_valid(idx)) { return 0; }
+        return d_column.element<string_view>(idx).size_bytes();
+      }));
+
+  std::vector<std::unique_ptr<column>> offsets_columns;
+  std::vector<rmm::device_uvector<char>> chars_data;
+  std::vector<char*> chars;
+  std::vector<cudf::detail::input_offsetalator> offsets;
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const column_sizes            = sizes.begin() + static_cast<int64_t>(c) * output_count;
+    auto [offsets_column, total_bytes] = cudf::detail::make_offsets_child_column(
+      column_sizes, column_sizes + output_count, stream, mr);
+    offsets.push_back(
+      cudf::detail::offsetalator_factory::make_input_iterator(offsets_column->view()));
+    offsets_columns.push_back(std::move(offsets_column));
+    chars_data.emplace_back(total_bytes, stream, mr);
+    chars.push_back(chars_data.back().data());
+  }
+
+  // copy the characters of all the columns
+  auto const d_chars   = cudf::detail::make_device_uvector_async(chars, stream, temp_mr);
+  auto const d_offsets = cudf::detail::make_device_uvector_async(offsets, stream, temp_mr);
+
+  constexpr int max_column_blocks = 65535;
+  dim3 const grid(
+    (output_count + gather_strings_per_threadblock - 1) / gather_strings_per_threadblock,
+    std::min(num_columns, max_column_blocks));
+  gather_chars_batch_fn<<<grid,
+                          gather_warps_per_threadblock * cudf::detail::warp_size,
+                          0,
+                          stream.value()>>>(
+    *d_strings, d_chars.data(), d_offsets.data(), begin, output_count);
+
+  for (size_type c = 0; c < num_columns; ++c) {
+    results.push_back(make_strings_column(output_count,
+                                          std::move(offsets_columns[c]),
+                                          chars_data[c].release(),
+                                          0,  // caller sets these
+                                          rmm::device_buffer{}));
+  }
+  return results;
+}
+
 /**
  * @brief Returns a new strings column using the specified indices to select
  * elements from the `strings` column.
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <thrust/optional.h>
+
+#include <cstdint>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Size and leading bytes of a string, loaded by a single 16-byte read.
+ *
+ * Two strings are mostly ordered or told apart by their prefixes alone, without loading their
+ * offsets and characters.
+ */
+struct alignas(16) string_prefix {
+  static constexpr int num_words      = 3;
+  static constexpr size_type capacity = num_words * sizeof(uint32_t);
+  uint32_t words[num_words];  ///< Leading bytes of the string as big-endian words, zero padded
+  size_type size_bytes;       ///< Size of the string in bytes
+};
+
+/**
+ * @brief Returns the prefix of a string.
+ */
+__device__ inline string_prefix make_string_prefix(string_view const& d_str)
+{
+  string_prefix result{{0, 0, 0}, d_str.size_bytes()};
+  auto const bytes = reinterpret_cast<uint8_t const*>(d_str.data());
+  auto const size  = min(d_str.size_bytes(), string_prefix::capacity);
+  for (size_type idx = 0; idx < size; ++idx) {
+    result.words[idx / 4] |= static_cast<uint32_t>(bytes[idx]) << (8 * (3 - idx % 4));
+  }
+  return result;
+}
+
+/**
+ * @brief Compares two strings by their prefixes.
+ *
+ * The zero padding orders a string before the longer strings it is a prefix of, so the
+ * prefixes decide unless both strings are longer than the prefix capacity and their prefixes
+ * are equal.
+ *
+ * @return Negative, zero or positive like `string_view::compare`, or nullopt if the
+ * characters after the prefixes must be compared
+ */
+__device__ inline thrust::optional<int> compare_prefixes(string_prefix const& lhs,
+                                                         string_prefix const& rhs)
+{
+  for (int w = 0; w < string_prefix::num_words; ++w) {
+    if (lhs.words[w] != rhs.words[w]) { return lhs.words[w] < rhs.words[w] ? -1 : 1; }
+  }
+  if (min(lhs.size_bytes, rhs.size_bytes) > string_prefix::capacity) { return thrust::nullopt; }
+  return (lhs.size_bytes > rhs.size_bytes) - (lhs.size_bytes < rhs.size_bytes);
+}
+
+/**
+ * @brief Checks two strings for equality by their prefixes.
+ *
+ * @return Whether the strings are equal, or nullopt if the characters after the prefixes must
+ * be compared
+ */
+__device__ inline thrust::optional<bool> equal_prefixes(string_prefix const& lhs,
+                                                        string_prefix const& rhs)
+{
+  if (lhs.size_bytes != rhs.size_bytes) { return false; }
+  for (int w = 0; w < string_prefix::num_words; ++w) {
+    if (lhs.words[w] != rhs.words[w]) { return false; }
+  }
+  if (lhs.size_bytes > string_prefix::capacity) { return thrust::nullopt; }
+  return true;
+}
+
+/**
+ * @brief Builds the prefix of each string of a column.
+ *
+ * The index is built once by reading the beginning of each string, and then lets the many
+ * comparisons of a sort or search skip the characters of most strings. The prefixes of null
+ * rows are empty.
+ *
+ * @param input Strings column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector's device memory
+ * @return The prefix of each row of `input`
+ */
+rmm::device_uvector<string_prefix> make_string_prefixes(strings_column_view const& input,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
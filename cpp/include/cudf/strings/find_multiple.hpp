@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
@@ -60,6 +61,74 @@ std::unique_ptr<column> find_multiple(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a table of boolean columns indicating where each of the target strings is found
+ * in each string.
+ *
+ * The output table has a column for each of the `targets`, each of size `input.size()`.
+ * `output[j][i]` is true if `targets[j]` is found in `input[i]`. An empty target is found in
+ * every string. The output columns have the null mask of `input`.
+ *
+ * The targets are combined into a single automaton, so each string is searched only once
+ * whatever the number of targets.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc", "def", null]
+ * t = ["a", "c", "e"]
+ * r = contains_multiple(s, t)
+ * r is now {[true, false, null],   // "a" found in "abc"
+ *           [true, false, null],   // "c" found in "abc"
+ *           [false, true, null]}   // "e" found in "def"
+ * @endcode
+ *
+ * @throw cudf::logic_error if `targets` is empty or contains nulls
+ *
+ * @param input Strings instance for this operation
+ * @param targets Strings to search for in each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table of BOOL8 columns, one for each target
+ */
+std::unique_ptr<table> contains_multiple(
+  strings_column_view const& input,
+  strings_column_view const& targets,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a lists column with the indices of the target strings found in each string.
+ *
+ * The size of the output column is `input.size()`.
+ * Row `i` of the output column lists, in ascending order and once each, the indices `j` of the
+ * `targets` found in `input[i]`. An empty target is found in every string, and null strings
+ * produce null rows.
+ *
+ * The targets are combined into a single automaton, so each string is searched only once
+ * whatever the number of targets.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["she sells", "hello", "", null]
+ * t = ["he", "she", "his", "hers", "sell"]
+ * r = contains_multiple_indices(s, t)
+ * r is now {[0, 1, 4], [0], [], null}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `targets` is empty or contains nulls
+ *
+ * @param input Strings instance for this operation
+ * @param targets Strings to search for in each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of INT32 target indices
+ */
+std::unique_ptr<column> contains_multiple_indices(
+  strings_column_view const& input,
+  strings_column_view const& targets,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
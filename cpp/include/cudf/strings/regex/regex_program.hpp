@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,9 +17,16 @@
 
 #include <cudf/strings/regex/flags.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <tuple>
 
 namespace cudf {
 namespace strings {
@@ -35,6 +42,11 @@ namespace strings {
  * Create an instance from a regex pattern and use it to call the appropriate
  * strings APIs. An instance can be reused.
  *
+ * The first strings API call using an instance on a device uploads its compiled program to
+ * that device, and the later calls with the instance reuse the uploaded program from any
+ * thread and on any stream. The uploaded program is freed when the instance is destroyed or
+ * by `release_device_program()`.
+ *
  * See the @ref md_regex "Regex Features" page for details on patterns and APIs that support regex.
  */
 struct regex_program {
@@ -112,6 +124,16 @@ struct regex_program {
    */
   std::size_t compute_working_memory_size(int32_t num_strings) const;
 
+  /**
+   * @brief Free the device copies of this program once the work queued on `stream` is complete
+   *
+   * The work using this program on other streams must be complete. A later strings API call
+   * with this instance uploads the program again.
+   *
+   * @param stream CUDA stream of the last work using this program
+   */
+  void release_device_program(rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
   ~regex_program();
 
  private:
@@ -133,6 +155,59 @@ struct regex_program {
   friend struct regex_device_builder;
 };
 
+/**
+ * @brief Thread-safe cache of regex programs keyed by their pattern, flags and capture groups
+ *
+ * A pattern is compiled once by the first `get()` for it, and its device program is uploaded
+ * once by the first strings API call using it. The later calls reuse both.
+ *
+ * @code{.cpp}
+ * cudf::strings::regex_program_cache cache;
+ * // in each micro-batch, and from any thread
+ * auto const prog = cache.get("[a-z]+\\d");
+ * auto results    = cudf::strings::contains_re(input, *prog);
+ * @endcode
+ */
+class regex_program_cache {
+ public:
+  /**
+   * @brief Return the program of the given pattern, creating it on first use
+   *
+   * @throw cudf::logic_error If pattern is invalid or contains unsupported features
+   *
+   * @param pattern Regex pattern
+   * @param flags Regex flags for interpreting special characters in the pattern
+   * @param capture Controls how capture groups in the pattern are used
+   * @return The cached program
+   */
+  std::shared_ptr<regex_program const> get(std::string_view pattern,
+                                           regex_flags flags      = regex_flags::DEFAULT,
+                                           capture_groups capture = capture_groups::EXTRACT);
+
+  /**
+   * @brief Return the number of cached programs
+   *
+   * @return Number of programs
+   */
+  [[nodiscard]] std::size_t size() const;
+
+  /**
+   * @brief Remove all the programs once the work queued on `stream` is complete
+   *
+   * The programs still referenced by the callers of `get()` are freed when released by them.
+   * The work using the programs on other streams must be complete.
+   *
+   * @param stream CUDA stream of the last work using the programs
+   */
+  void clear(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+ private:
+  mutable std::mutex _mutex;
+  std::map<std::tuple<std::string, regex_flags, capture_groups>,
+           std::shared_ptr<regex_program const>>
+    _programs;
+};
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
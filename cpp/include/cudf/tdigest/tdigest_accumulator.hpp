@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/tdigest/tdigest_column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace tdigest {
+/**
+ * @addtogroup tdigest
+ * @{
+ * @file
+ * @brief Incremental tdigest APIs
+ */
+
+/**
+ * @brief Maintains one tdigest per group over values delivered in batches.
+ *
+ * Each batch is compressed to a tdigest per group on its own, which is buffered rather than
+ * merged right away. The buffered digests are merged with the running digests once
+ * `max_pending_batches` of them accumulate, or when the digests are queried, so that the
+ * centroids of the running digests are re-sorted once per flush instead of once per batch.
+ *
+ * Groups are identified by 0-based INT32 labels in `[0, num_groups)`. Groups that have no valid
+ * value yet have an empty digest, and a null row in the output of `percentile_approx`.
+ *
+ * Example:
+ * ```
+ * num_groups: 2
+ *
+ * add(labels: {0 1 0}, values: {1 10 3})
+ * add(labels: {0 1},   values: {2 20})
+ *
+ * percentile_approx({0.5}): {{2} {15}}
+ * ```
+ */
+class tdigest_accumulator {
+ public:
+  tdigest_accumulator() = delete;
+  ~tdigest_accumulator();
+  tdigest_accumulator(tdigest_accumulator const&) = delete;
+  tdigest_accumulator(tdigest_accumulator&&);
+  tdigest_accumulator& operator=(tdigest_accumulator const&) = delete;
+  tdigest_accumulator& operator=(tdigest_accumulator&&);
+
+  /**
+   * @brief Constructs an accumulator of `num_groups` empty digests.
+   *
+   * @throws std::invalid_argument If `num_groups`, `max_centroids` or `max_pending_batches` is
+   * not positive
+   *
+   * @param num_groups Number of groups
+   * @param max_centroids Parameter controlling the level of compression of the tdigests. Higher
+   * values result in larger, more precise tdigests.
+   * @param max_pending_batches Number of batch digests buffered before they are merged with the
+   * running digests
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  tdigest_accumulator(size_type num_groups,
+                      int max_centroids,
+                      size_type max_pending_batches = 8,
+                      rmm::cuda_stream_view stream  = cudf::get_default_stream());
+
+  /**
+   * @brief Adds a batch of values to the digests of their groups.
+   *
+   * Null values are ignored.
+   *
+   * @throws std::invalid_argument If `group_labels` is not a non-nullable INT32 column with as
+   * many rows as `values`, or any of its labels is not in `[0, num_groups())`
+   * @throws std::invalid_argument If `values` is not a numeric or fixed-point column
+   *
+   * @param group_labels Group of each value
+   * @param values The values of the batch
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add(column_view const& group_labels,
+           column_view const& values,
+           rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Merges a column of tdigests, e.g. computed by a TDIGEST aggregation, into the digests.
+   *
+   * Row `i` of `tdigests` is merged into the digest of group `i`.
+   *
+   * @throws std::invalid_argument If `tdigests` does not have `num_groups()` rows
+   *
+   * @param tdigests One tdigest per group
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void merge(tdigest_column_view const& tdigests,
+             rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Merges the buffered batch digests into the running digests.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void flush(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns the digests of all the values added so far, one per group.
+   *
+   * The buffered batch digests are merged first. The view is invalidated by the next call to a
+   * non-const member function.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The tdigest of each group
+   */
+  [[nodiscard]] tdigest_column_view digests(
+    rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Computes approximate percentiles of the values added so far in each group.
+   *
+   * The buffered batch digests are merged first. More values can be added afterwards.
+   *
+   * @throws cudf::logic_error If `percentiles` is not a FLOAT64 column
+   *
+   * @param percentiles Desired percentiles in range [0, 1]
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return LIST column with the requested percentiles of each group, as FLOAT64
+   */
+  [[nodiscard]] std::unique_ptr<column> percentile_approx(
+    column_view const& percentiles,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the number of groups.
+   *
+   * @return The number of groups
+   */
+  [[nodiscard]] size_type num_groups() const { return _num_groups; }
+
+  /**
+   * @brief Returns the number of batch digests not yet merged with the running digests.
+   *
+   * @return The number of buffered batch digests
+   */
+  [[nodiscard]] size_type num_pending_batches() const
+  {
+    return static_cast<size_type>(_pending.size());
+  }
+
+ private:
+  size_type _num_groups;                          ///< Number of groups
+  int _max_centroids;                             ///< Compression of the digests
+  size_type _max_pending_batches;                 ///< Batch digests buffered before a flush
+  std::unique_ptr<column> _digests;               ///< Running digests, one per group
+  std::vector<std::unique_ptr<column>> _pending;  ///< Buffered batch digests
+};
+
+/** @} */  // end of group
+}  // namespace tdigest
+}  // namespace cudf
@@ -15,6 +15,9 @@
  */
 #pragma once
 
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
@@ -40,6 +43,9 @@ static constexpr uint32_t solar_cycle_entry_count = 2 * solar_cycle_years;
  * transitions per year from Daylight Saving Time. If the timezone does not have DST, the table will
  * still include the future entries, which will all have the same offset.
  *
+ * The TZif file of a timezone is only read the first time its table is created; later calls reuse
+ * the parsed table for the lifetime of the process.
+ *
  * @param tzif_dir The directory where the TZif files are located
  * @param timezone_name standard timezone name (for example, "America/Los_Angeles")
  * @param mr Device memory resource used to allocate the returned table's device memory.
@@ -51,4 +57,51 @@ std::unique_ptr<table> make_timezone_transition_table(
   std::string_view timezone_name,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Converts local times of one timezone to the local times of another timezone.
+ *
+ * Each timestamp is read as a local time in `from_timezone`, converted to UTC, and then to the
+ * local time in `to_timezone`. Either timezone may be "UTC". Both conversions are done in a single
+ * pass over the column using the transition tables of `make_timezone_transition_table`.
+ *
+ * Local times that are skipped or repeated by a transition are resolved with one of the two
+ * offsets around the transition.
+ *
+ * @throw cudf::logic_error if `timestamps` is not a timestamp column or has a resolution of days
+ *
+ * @param timestamps Column of timestamps to convert
+ * @param tzif_dir The directory where the TZif files are located
+ * @param from_timezone Standard name of the timezone of the input timestamps
+ * @param to_timezone Standard name of the timezone of the output timestamps
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return Column of the converted timestamps, of the same type as `timestamps`
+ */
+std::unique_ptr<column> convert_timezone(
+  column_view const& timestamps,
+  std::optional<std::string_view> tzif_dir,
+  std::string_view from_timezone,
+  std::string_view to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts UTC timestamps to the local times of a timezone.
+ *
+ * Equivalent to `convert_timezone(timestamps, tzif_dir, "UTC", timezone_name, mr)`.
+ *
+ * @throw cudf::logic_error if `timestamps` is not a timestamp column or has a resolution of days
+ *
+ * @param timestamps Column of UTC timestamps
+ * @param tzif_dir The directory where the TZif files are located
+ * @param timezone_name Standard name of the timezone of the output timestamps
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return Column of local times, of the same type as `timestamps`
+ */
+std::unique_ptr<column> to_local_time(
+  column_view const& timestamps,
+  std::optional<std::string_view> tzif_dir,
+  std::string_view timezone_name,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace cudf
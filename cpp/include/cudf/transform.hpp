@@ -17,11 +17,16 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 /**
@@ -56,6 +61,43 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Creates a new column by applying a function against every row of a table.
+ *
+ * Computes:
+ * `out[i] = F(in_0[i], in_1[i], ..., in_n[i])`
+ *
+ * The function is compiled once for each combination of function, input types and output type,
+ * and all the inputs are read in a single pass. It is called with a pointer to the output element
+ * followed by the value of each input.
+ *
+ * If `null_aware` is false, the output null mask is the bitwise AND of the input null masks so if
+ * any input is null at row `i` then output[i] is also null. If `null_aware` is true, the function
+ * is called on every row with a pointer to the validity of the output element after the pointer
+ * to the output element, and with the validity of each input after the values:
+ * `F(&out[i], &out_valid[i], in_0[i], ..., in_n[i], in_0_valid[i], ..., in_n_valid[i])`
+ *
+ * @throws cudf::logic_error if `inputs` has no columns, or if an input or the output type is not
+ * fixed-width
+ * @throws std::invalid_argument if `null_aware` is true and the function is PTX code
+ *
+ * @param inputs        An immutable view of the input columns to transform
+ * @param udf           The PTX/CUDA string of the function to apply
+ * @param output_type   The output type that is compatible with the output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param null_aware    Whether the function computes the validity of the output from the validity
+ *                      of the inputs
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ * @return              The column resulting from applying the function to every row of the inputs
+ */
+std::unique_ptr<column> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  data_type output_type,
+  bool is_ptx,
+  bool null_aware                     = false,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
@@ -89,6 +131,70 @@ std::unique_ptr<column> compute_column(
   ast::expression const& expr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute a new column by evaluating an expression tree on the selected rows of a table.
+ *
+ * Row `i` of the output is the expression evaluated on row `selection.indices()[i]` of `table`,
+ * so the result equals `compute_column(materialize(table, selection), expr)` without copying
+ * the selected rows of `table` first.
+ *
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ * @throws std::invalid_argument if `table.num_rows() != selection.source_rows()`
+ *
+ * @param table The table used for expression evaluation
+ * @param expr The root of the expression tree
+ * @param selection The rows of `table` to evaluate the expression on
+ * @param mr Device memory resource
+ * @return Output column with one row per selected row
+ */
+std::unique_ptr<column> compute_column(
+  table_view const& table,
+  ast::expression const& expr,
+  selection_vector const& selection,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compute a new column by evaluating an expression tree on a table with a kernel
+ * compiled for the expression.
+ *
+ * The expression is compiled at runtime into a single fused kernel that keeps its intermediate
+ * values in registers, instead of being interpreted row by row as by `compute_column`. The
+ * compiled kernel is cached so evaluating the same expression again only pays for the launch.
+ * Expressions that may evaluate to null or that reference non-numeric types are evaluated by
+ * `compute_column`.
+ *
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ *
+ * @param table The table used for expression evaluation
+ * @param expr The root of the expression tree
+ * @param mr Device memory resource
+ * @return Output column, equal to the result of `compute_column`
+ */
+std::unique_ptr<column> compute_column_jit(
+  table_view const& table,
+  ast::expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compute new columns by evaluating several expression trees on a table in one pass.
+ *
+ * All the expressions are evaluated by one kernel, which reads each row of the table once and
+ * computes the subexpressions shared by several expressions once. Output `i` is equal to the
+ * result of `compute_column` for `exprs[i]`, and only has a null mask if `exprs[i]` may evaluate
+ * to null.
+ *
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ *
+ * @param table The table used for expression evaluation
+ * @param exprs The roots of the expression trees
+ * @param mr Device memory resource
+ * @return Output columns, one per expression
+ */
+std::vector<std::unique_ptr<column>> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& exprs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a bitmask from a column of boolean elements.
  *
@@ -168,6 +274,33 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(
   column_view const& categories,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Encodes `input` by the coordinates of the true values of its one-hot encoding.
+ *
+ * Instead of one column of `input.size()` booleans per category, as `cudf::one_hot_encode`
+ * returns, this returns a pair `(i, j)` for each `input[i] == categories[j]`. The pairs are sorted
+ * by `i` then by `j`, so that they are the (row index, column index) arrays of the encoding in a
+ * compressed sparse row layout. The categories are looked up in a hash table.
+ *
+ * Examples:
+ * @code{.pseudo}
+ * input: [{'a', 'c', null, 'c', 'b'}]
+ * categories: ['c', null]
+ * output: [{1, 2, 3}, {0, 1, 0}]
+ * @endcode
+ *
+ * @throws cudf::logic_error if input and categories are of different types.
+ *
+ * @param input Column containing values to be encoded
+ * @param categories Column containing categories
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return A pair of the row indices and of the category indices of the matching values
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sparse_one_hot_encode(
+  column_view const& input,
+  column_view const& categories,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a boolean column from given bitmask.
  *
@@ -247,5 +380,27 @@ std::unique_ptr<column> segmented_row_bit_count(
   size_type segment_length,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns an approximate size in bytes of all columns in the `table_view` for each segment
+ * of rows delimited by offsets.
+ *
+ * The size of a segment is the sum of the `cudf::row_bit_count` of its rows, rounded up to a
+ * whole number of bytes. Unlike `cudf::segmented_row_bit_count`, the segments can have different
+ * lengths and the sizes do not overflow for large segments, e.g. to split a table into chunks of
+ * bounded size.
+ *
+ * Segment `i` holds rows `[segment_offsets[i], segment_offsets[i + 1])`. The offsets are expected
+ * to be non-decreasing and within `[0, t.num_rows()]`.
+ *
+ * @param t The table view to perform the computation on
+ * @param segment_offsets The offsets of the segments, one more than the number of segments
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return A 64-bit integer column containing the byte counts for each segment of rows
+ */
+std::unique_ptr<column> segmented_row_byte_count(
+  table_view const& t,
+  device_span<size_type const> segment_offsets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
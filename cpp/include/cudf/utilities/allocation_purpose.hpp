@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cudf {
+/**
+ * @addtogroup utility_types
+ * @{
+ * @file
+ * @brief Tagging of device allocations by purpose
+ */
+
+/**
+ * @brief What the device memory allocated by libcudf on the calling thread is used for.
+ *
+ * The readers and writers tag their allocations, so that a memory resource, e.g. the callback of
+ * an `rmm::mr::failure_callback_resource_adaptor`, can tell the transient memory of an operation
+ * from the memory of its results with `current_allocation_purpose`. On an allocation failure, a
+ * host framework can then spill its cold data and retry the allocation, so that the operation
+ * resumes where it stopped instead of failing.
+ */
+enum class allocation_purpose : int8_t {
+  UNSPECIFIED,    ///< Allocations not tagged by libcudf
+  OUTPUT,         ///< Results returned to the caller
+  INPUT_BUFFER,   ///< Raw data read from a source, held until it is decoded
+  DECOMPRESSION,  ///< Decompressed data and decompression scratch space
+  TEMPORARY       ///< Other scratch space, freed before the operation returns
+};
+
+/**
+ * @brief Returns whether memory of a purpose is freed before the allocating operation returns.
+ *
+ * @param purpose The purpose of the memory
+ * @return true if the memory is transient
+ */
+[[nodiscard]] constexpr bool is_transient(allocation_purpose purpose)
+{
+  return purpose != allocation_purpose::UNSPECIFIED and purpose != allocation_purpose::OUTPUT;
+}
+
+/**
+ * @brief Returns the purpose of the device allocations made by the calling thread.
+ *
+ * @return The purpose of the innermost `allocation_purpose_scope` of the thread, or
+ * `allocation_purpose::UNSPECIFIED` outside of any scope
+ */
+[[nodiscard]] allocation_purpose current_allocation_purpose() noexcept;
+
+/**
+ * @brief Tags the device allocations of the calling thread with a purpose for the lifetime of
+ * the scope.
+ *
+ * Scopes nest: the purpose of the enclosing scope is restored on destruction.
+ */
+class allocation_purpose_scope {
+ public:
+  /**
+   * @brief Tags the allocations of the calling thread with `purpose`.
+   *
+   * @param purpose The purpose of the allocations made in the scope
+   */
+  explicit allocation_purpose_scope(allocation_purpose purpose) noexcept;
+
+  allocation_purpose_scope(allocation_purpose_scope const&)            = delete;
+  allocation_purpose_scope& operator=(allocation_purpose_scope const&) = delete;
+  allocation_purpose_scope(allocation_purpose_scope&&)                 = delete;
+  allocation_purpose_scope& operator=(allocation_purpose_scope&&)      = delete;
+
+  /**
+   * @brief Restores the purpose of the enclosing scope.
+   */
+  ~allocation_purpose_scope();
+
+ private:
+  allocation_purpose _previous;  ///< Purpose of the enclosing scope
+};
+
+/** @} */  // end of group
+}  // namespace cudf
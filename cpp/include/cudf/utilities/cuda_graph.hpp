@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <functional>
+
+namespace cudf {
+/**
+ * @addtogroup utility_graphs
+ * @{
+ * @file
+ * @brief Capture and replay of fixed-shape pipelines as CUDA graphs
+ */
+
+/**
+ * @brief A pipeline of libcudf calls captured once into a CUDA graph and replayed many times.
+ *
+ * Replaying a graph launches all the kernels and copies of the pipeline at once, which saves the
+ * per-call launch overhead dominating small batches.
+ *
+ * The pipeline is a function enqueueing its work on the stream it is given, which is captured
+ * in `cudaStreamCaptureModeThreadLocal` mode. Only calls that do not synchronize the stream nor
+ * read device results on the host can be captured: APIs returning a host size or scalar value,
+ * such as `hash_join::inner_join_size`, fail the capture. Device memory allocated during the
+ * capture must come from a resource not calling `cudaMalloc`, such as a pool resource with
+ * enough capacity or `rmm::mr::cuda_async_memory_resource`. The graph reads and writes the
+ * addresses seen at capture, so the columns the pipeline reads, and those it creates and keeps,
+ * must outlive the replays.
+ *
+ * New inputs are bound by capturing the pipeline again with them. When the new capture has the
+ * topology of the previous one, the instantiated graph is updated in place rather than
+ * instantiated again, which is much cheaper.
+ *
+ * Example:
+ * @code{.cpp}
+ * cudf::cuda_graph graph;
+ * std::unique_ptr<cudf::column> result;
+ * graph.capture([&](auto s) { result = cudf::cast(batch, type, s); }, stream);
+ * graph.replay(stream);  // recomputes result from the current content of batch
+ * @endcode
+ */
+class cuda_graph {
+ public:
+  using pipeline = std::function<void(rmm::cuda_stream_view)>;  ///< Work captured in the graph
+
+  cuda_graph()                             = default;
+  cuda_graph(cuda_graph const&)            = delete;
+  cuda_graph& operator=(cuda_graph const&) = delete;
+
+  /**
+   * @brief Move constructor, leaving `other` without a captured graph.
+   *
+   * @param other The graph to move from
+   */
+  cuda_graph(cuda_graph&& other) noexcept;
+
+  /**
+   * @brief Move assignment, leaving `other` without a captured graph.
+   *
+   * @param other The graph to move from
+   * @return Reference to this graph
+   */
+  cuda_graph& operator=(cuda_graph&& other) noexcept;
+
+  /**
+   * @brief Destroys the captured graph, if any.
+   */
+  ~cuda_graph();
+
+  /**
+   * @brief Captures the work of `work` on `stream`, replacing the previous capture if any.
+   *
+   * The work is not executed by the capture: it runs on the first `replay`. If `work` throws or
+   * the capture fails, the previous capture is kept.
+   *
+   * @throws std::invalid_argument If `stream` is the legacy default stream, which cannot be
+   * captured
+   * @throws cudf::cuda_error If the capture or the instantiation of the graph fails
+   *
+   * @param work Function enqueueing the pipeline on the stream it is given
+   * @param stream Stream the pipeline is captured on
+   */
+  void capture(pipeline const& work, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Launches the captured graph on `stream`.
+   *
+   * @throws std::logic_error If no pipeline was captured
+   *
+   * @param stream Stream the graph is launched on
+   */
+  void replay(rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Returns whether a pipeline was captured.
+   *
+   * @return true if the graph can be replayed
+   */
+  [[nodiscard]] bool is_captured() const { return _exec != nullptr; }
+
+  /**
+   * @brief Returns the number of captures that were applied by updating the instantiated graph.
+   *
+   * @return The number of in-place updates
+   */
+  [[nodiscard]] std::size_t num_updates() const { return _num_updates; }
+
+ private:
+  cudaGraph_t _graph{nullptr};     ///< Last captured graph
+  cudaGraphExec_t _exec{nullptr};  ///< Executable instantiated from the captured graphs
+  std::size_t _num_updates{0};     ///< Captures applied as in-place updates
+};
+
+/** @} */  // end of group
+}  // namespace cudf
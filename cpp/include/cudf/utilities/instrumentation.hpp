@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace cudf {
+/**
+ * @addtogroup utility_instrumentation
+ * @{
+ * @file
+ * @brief Lightweight per-API instrumentation callbacks
+ */
+
+/**
+ * @brief Measurements of a call to an instrumented libcudf API.
+ */
+struct api_event {
+  char const* name;               ///< Name of the API
+  rmm::cuda_stream_view stream;   ///< Stream the work of the call was enqueued on
+  size_type input_rows;           ///< Number of rows of the input
+  std::size_t input_bytes;        ///< Bytes of the input, excluding string characters
+  std::size_t peak_memory_bytes;  ///< Peak device memory allocated by the call, outputs included
+  float elapsed_ms;               ///< GPU time between the start and the end of the call
+};
+
+/**
+ * @brief Function receiving the events of the instrumented calls.
+ */
+using api_event_callback = std::function<void(api_event const&)>;
+
+/**
+ * @brief Registers a callback receiving the event of every instrumented API call.
+ *
+ * Instrumentation costs nothing but an atomic load while no callback is registered. Once one is,
+ * each instrumented call records two CUDA events on its stream. The event of a call is delivered
+ * once its work completed, from whichever thread leaves an instrumented call next, or
+ * from `flush_api_events`, so the calling thread is never synchronized. Callbacks may be invoked
+ * concurrently and must not call instrumented APIs.
+ *
+ * Peak memory is only measured for allocations made through an `api_memory_tracker`, and is 0
+ * otherwise.
+ *
+ * @param callback The function receiving the events
+ * @return Identifier of the callback, to unregister it
+ */
+std::size_t register_api_event_callback(api_event_callback callback);
+
+/**
+ * @brief Unregisters a callback, which receives no events after this returns.
+ *
+ * @param id Identifier returned by `register_api_event_callback`
+ */
+void unregister_api_event_callback(std::size_t id);
+
+/**
+ * @brief Waits for the work of the pending instrumented calls, and delivers their events.
+ */
+void flush_api_events();
+
+/**
+ * @brief Resource adaptor measuring the device memory allocated during instrumented calls.
+ *
+ * Allocations are attributed to the instrumented calls open on the allocating thread, so the
+ * work of a call should not allocate from other threads.
+ */
+class api_memory_tracker final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructs a tracker forwarding allocations to `upstream`.
+   *
+   * @throws std::invalid_argument if `upstream` is null
+   *
+   * @param upstream The resource allocating the memory
+   */
+  explicit api_memory_tracker(rmm::mr::device_memory_resource* upstream);
+
+  api_memory_tracker()                                     = delete;
+  ~api_memory_tracker() override                           = default;
+  api_memory_tracker(api_memory_tracker const&)            = delete;
+  api_memory_tracker& operator=(api_memory_tracker const&) = delete;
+  api_memory_tracker(api_memory_tracker&&)                 = delete;
+  api_memory_tracker& operator=(api_memory_tracker&&)      = delete;
+
+  /**
+   * @brief Returns the wrapped upstream resource.
+   *
+   * @return The upstream resource
+   */
+  [[nodiscard]] rmm::mr::device_memory_resource* get_upstream() const noexcept
+  {
+    return _upstream;
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override;
+  [[nodiscard]] bool do_is_equal(device_memory_resource const& other) const noexcept override;
+
+  rmm::mr::device_memory_resource* _upstream;  ///< Resource allocating the memory
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup utility_types
+ * @{
+ * @file
+ * @brief APIs managing the cache of the kernels compiled at runtime
+ */
+
+/**
+ * @brief Operations compiling a kernel for a user-defined function at runtime
+ */
+enum class jit_operation : int32_t {
+  TRANSFORM,         ///< `cudf::transform` of a CUDA or PTX function
+  BINARY_OPERATION,  ///< `cudf::binary_operation` of a PTX function
+  ROLLING_WINDOW     ///< `cudf::rolling_window` with a fixed-size window and a UDF aggregation
+};
+
+/**
+ * @brief Entry of a warmup manifest, describing one kernel compiled at runtime
+ *
+ * A kernel is identified by its operation, its function and the types it is instantiated for, so
+ * an entry compiles the same kernel as calling the operation with these arguments.
+ */
+struct jit_kernel_spec {
+  jit_operation operation;             ///< Operation compiling the kernel
+  std::string udf;                     ///< Source of the user-defined function
+  bool is_ptx;                         ///< Whether `udf` is PTX code rather than CUDA code
+  std::vector<data_type> input_types;  ///< Types of the input columns of the operation
+  data_type output_type;               ///< Type of the output column of the operation
+};
+
+/**
+ * @brief Compiles the kernels of a manifest into the kernel cache
+ *
+ * Compiling a kernel at its first use may take seconds. Warming up the cache at startup with the
+ * kernels a process is known to use moves this cost out of the first requests: each kernel is
+ * compiled, or loaded from the on-disk cache, by evaluating its operation on a single row.
+ *
+ * `TRANSFORM` and `ROLLING_WINDOW` entries take one input type, and `BINARY_OPERATION` entries
+ * take two. `BINARY_OPERATION` entries must be PTX code.
+ *
+ * @throws std::invalid_argument if an entry has the wrong number of input types, or is a
+ * `BINARY_OPERATION` of CUDA code
+ * @throws cudf::logic_error if a function fails to compile
+ *
+ * @param manifest Kernels to compile
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void warmup_jit_cache(host_span<jit_kernel_spec const> manifest,
+                      rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Sets the maximum number of kernels kept by the kernel cache
+ *
+ * Each program, such as the transform or the binary operation kernels, has a cache holding at
+ * most `kernels_in_memory` kernels in memory and `kernels_on_disk` kernels in the cache directory.
+ * A full cache evicts its least recently used kernel, and an on-disk kernel is loaded back into
+ * memory instead of being compiled again. The limits default to the
+ * `LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS` and `LIBCUDF_KERNEL_CACHE_LIMIT_DISK` environment
+ * variables, or to 10,000 and 100,000 kernels.
+ *
+ * The limits apply to the caches created after this call, that is to the programs that have not
+ * compiled a kernel yet. They should be set before the first operation compiling a kernel, or
+ * before `warmup_jit_cache`.
+ *
+ * @throws std::invalid_argument if `kernels_in_memory` is zero
+ *
+ * @param kernels_in_memory Maximum number of kernels of a program kept in memory
+ * @param kernels_on_disk Maximum number of kernels of a program kept on disk, zero disabling the
+ * on-disk cache
+ */
+void set_jit_cache_limits(std::size_t kernels_in_memory, std::size_t kernels_on_disk);
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -43,4 +43,27 @@ namespace cudf {
  */
 spdlog::logger& logger();
 
+/**
+ * @brief Returns the global logger of performance events.
+ *
+ * libcudf emits structured performance events, e.g. the bytes read and the decompression time of
+ * the Parquet reader, as `event=<name> <key>=<value>...` messages at `info` level through this
+ * logger. Its level is `off` unless the environment variable `LIBCUDF_PERF_LOGGING` is set to
+ * `ON`, and the events are then written to the same destination as the `logger()` messages. The
+ * events are only measured and formatted when the level of this logger is `info` or lower.
+ *
+ * Examples:
+ * @code{.cpp}
+ * // Collect the performance events at runtime, in their own sink
+ * cudf::perf_logger().set_level(spdlog::level::info);
+ * cudf::perf_logger().sinks() = {std::make_shared<spdlog::sinks::basic_file_sink_mt>("perf.log")};
+ * @endcode
+ *
+ * Note: Changes to the sinks are not thread safe and should only be done during global
+ * initialization.
+ *
+ * @return spdlog::logger& The logger of performance events.
+ */
+spdlog::logger& perf_logger();
+
 }  // namespace cudf
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace cudf {
+/**
+ * @addtogroup utility_types
+ * @{
+ * @file
+ * @brief Device memory estimates of operations
+ */
+
+/**
+ * @brief Device memory an operation is estimated to use, computed before running it.
+ *
+ * Returned by the `estimate_*memory` companions of the major operations, so that a scheduler can
+ * check that an operation fits in the available device memory before running it.
+ */
+struct memory_estimate {
+  std::size_t temporary_bytes{0};  ///< Peak of the memory allocated and freed by the operation
+  std::size_t output_bytes{0};     ///< Memory of the results, or of the object being built
+
+  /**
+   * @brief Returns the peak device memory of the operation.
+   *
+   * @return The sum of the temporary and output bytes
+   */
+  [[nodiscard]] constexpr std::size_t total() const { return temporary_bytes + output_bytes; }
+};
+
+/** @} */  // end of group
+}  // namespace cudf
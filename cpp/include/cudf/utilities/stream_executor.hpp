@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup utility_streams
+ * @{
+ * @file
+ * @brief Concurrent execution of independent operations on pooled streams
+ */
+
+/**
+ * @brief Runs independent libcudf operations concurrently on streams of the libcudf stream pool.
+ *
+ * Each task submitted to the executor is a function enqueueing work on the stream it is given.
+ * The tasks are spread over `num_streams` pooled streams, which wait for the work already
+ * enqueued on the parent stream. A task waits, through CUDA events, for the tasks it depends on,
+ * and only for them, so that small independent kernels overlap on the device.
+ *
+ * Tasks are enqueued on the calling thread at submission, so a task can only depend on tasks
+ * submitted before it. `join` makes the parent stream wait for every submitted task; it is
+ * called by the destructor too.
+ *
+ * Device memory allocated by a task is allocated, and later freed, on the stream of the task.
+ * Results of the tasks must be used on the parent stream only after a `join`, or on the stream
+ * of another task depending on them.
+ *
+ * The executor is not thread-safe.
+ *
+ * Example:
+ * @code{.cpp}
+ * cudf::stream_executor executor(2, stream);
+ * std::unique_ptr<cudf::column> a, b;
+ * auto const cast = executor.submit([&](auto s) { a = cudf::cast(col_a, type, s); });
+ * executor.submit([&](auto s) { b = cudf::strings::to_upper(col_b, s); });
+ * executor.submit([&](auto s) { a = cudf::round(*a, 2, rounding_method::HALF_UP, s); }, {cast});
+ * executor.join();
+ * // a and b can be used on stream
+ * @endcode
+ */
+class stream_executor {
+ public:
+  using task_id = std::size_t;                                 ///< Identifier of a submitted task
+  using task    = std::function<void(rmm::cuda_stream_view)>;  ///< Work enqueued by a task
+
+  stream_executor()                                  = delete;
+  stream_executor(stream_executor const&)            = delete;
+  stream_executor(stream_executor&&)                 = delete;
+  stream_executor& operator=(stream_executor const&) = delete;
+  stream_executor& operator=(stream_executor&&)      = delete;
+
+  /**
+   * @brief Constructs an executor forking `num_streams` pooled streams from `stream`.
+   *
+   * @throws std::invalid_argument If `num_streams` is 0
+   *
+   * @param num_streams Number of streams the tasks are spread over
+   * @param stream Parent stream, waited on by the tasks and joined with them
+   */
+  explicit stream_executor(std::size_t num_streams,
+                           rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Joins the submitted tasks into the parent stream, and destroys the executor.
+   */
+  ~stream_executor();
+
+  /**
+   * @brief Enqueues a task after the tasks it depends on.
+   *
+   * The task is given the stream of its first dependency when no other task was submitted on
+   * that stream since, which avoids a cross-stream wait, and the next pooled stream otherwise.
+   *
+   * @throws std::invalid_argument If a dependency is not a task submitted to this executor
+   *
+   * @param work Function enqueueing the work of the task on the stream it is given
+   * @param dependencies Tasks whose work must complete before the work of this task starts
+   * @return Identifier of the task
+   */
+  task_id submit(task const& work, host_span<task_id const> dependencies = {});
+
+  /**
+   * @overload
+   */
+  task_id submit(task const& work, std::initializer_list<task_id> dependencies)
+  {
+    return submit(work, host_span<task_id const>{dependencies.begin(), dependencies.size()});
+  }
+
+  /**
+   * @brief Makes `stream` wait for the work of a task.
+   *
+   * @throws std::invalid_argument If `id` is not a task submitted to this executor
+   *
+   * @param id The task to wait for
+   * @param stream The stream that waits
+   */
+  void wait(task_id id, rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Makes the parent stream wait for the work of every submitted task.
+   */
+  void join() const;
+
+  /**
+   * @brief Returns the stream the work of a task was enqueued on.
+   *
+   * @throws std::invalid_argument If `id` is not a task submitted to this executor
+   *
+   * @param id The task
+   * @return The stream of the task
+   */
+  [[nodiscard]] rmm::cuda_stream_view task_stream(task_id id) const;
+
+  /**
+   * @brief Returns the number of tasks submitted so far.
+   *
+   * @return The number of tasks
+   */
+  [[nodiscard]] std::size_t num_tasks() const { return _events.size(); }
+
+ private:
+  rmm::cuda_stream_view _stream;                ///< Parent stream
+  std::vector<rmm::cuda_stream_view> _streams;  ///< Pooled streams of the tasks
+  std::vector<std::size_t> _task_streams;       ///< Index of the stream of each task
+  std::vector<cudaEvent_t> _events;             ///< Completion event of each task
+  std::vector<task_id> _last_tasks;             ///< Last task submitted on each stream, if any
+  std::size_t _next_stream{0};                  ///< Next stream of a task without dependencies
+};
+
+/** @} */  // end of group
+}  // namespace cudf
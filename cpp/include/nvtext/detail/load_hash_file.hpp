@@ -45,5 +45,12 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc nvtext::write_vocabulary_file
+ */
+void write_vocabulary_file(hashed_vocabulary const& vocabulary,
+                           std::string const& filename,
+                           rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace nvtext
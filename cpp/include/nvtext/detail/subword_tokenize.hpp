@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <nvtext/subword_tokenize.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstdint>
+
+namespace nvtext {
+namespace detail {
+
+/**
+ * @brief Default maximum number of character bytes normalized and tokenized at once.
+ *
+ * The tokenizer needs about 21x the bytes it tokenizes as working memory, so larger inputs are
+ * tokenized in batches of rows and only the token ids of each batch are kept.
+ */
+constexpr int64_t default_max_batch_bytes = int64_t{1} << 27;
+
+/**
+ * @copydoc nvtext::subword_tokenize(cudf::strings_column_view const&, hashed_vocabulary
+ * const&, uint32_t, uint32_t, bool, bool, rmm::mr::device_memory_resource*)
+ *
+ * @param max_batch_bytes Maximum number of character bytes tokenized at once. A batch holds at
+ *        least one row, so a longer string is tokenized in its own batch.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocabulary_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  int64_t max_batch_bytes,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace nvtext
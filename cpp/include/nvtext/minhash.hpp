@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/hashing.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/span.hpp>
@@ -148,5 +149,118 @@ std::unique_ptr<cudf::column> minhash64(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the minhash values for each string per pair of permutation parameters
+ *
+ * Each substring is hashed once with `seed` and each hash value `hv` is then permuted
+ * as `(a * hv + b) mod (2^61 - 1)` for each pair of values `a` and `b` of `parameter_a`
+ * and `parameter_b`. The minimum permuted value, truncated to 32 bits, is returned for
+ * each string per pair. This is much cheaper than hashing each substring once per seed
+ * and approximates as many independent hash functions.
+ *
+ * Each row of the list column are the results for the corresponding string in the
+ * order of the parameters.
+ *
+ * This function uses MurmurHash3_x86_32 for the hash algorithm.
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw std::invalid_argument if the width < 2
+ * @throw std::invalid_argument if parameter_a is empty
+ * @throw std::invalid_argument if parameter_a and parameter_b have different sizes
+ * @throw std::overflow_error if `parameter_a.size() * input.size()` exceeds the column
+ *        size limit
+ *
+ * @param input Strings column to compute minhash
+ * @param seed Seed value used for the hash algorithm
+ * @param parameter_a Multipliers of the permutations
+ * @param parameter_b Increments of the permutations
+ * @param width The character width used for apply substrings;
+ *              Default is 4 characters.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of minhash values for each string per pair of parameters
+ */
+std::unique_ptr<cudf::column> minhash_permuted(
+  cudf::strings_column_view const& input,
+  uint32_t seed,
+  cudf::device_span<uint32_t const> parameter_a,
+  cudf::device_span<uint32_t const> parameter_b,
+  cudf::size_type width               = 4,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the minhash values for each string per pair of permutation parameters
+ *
+ * This is the 64-bit version of `minhash_permuted`. The permuted values are below
+ * `2^61 - 1`.
+ *
+ * This function uses MurmurHash3_x64_128 for the hash algorithm.
+ * The hash function returns 2 uint64 values but only the first value
+ * is used with the minhash calculation.
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw std::invalid_argument if the width < 2
+ * @throw std::invalid_argument if parameter_a is empty
+ * @throw std::invalid_argument if parameter_a and parameter_b have different sizes
+ * @throw std::overflow_error if `parameter_a.size() * input.size()` exceeds the column
+ *        size limit
+ *
+ * @param input Strings column to compute minhash
+ * @param seed Seed value used for the hash algorithm
+ * @param parameter_a Multipliers of the permutations
+ * @param parameter_b Increments of the permutations
+ * @param width The character width used for apply substrings;
+ *              Default is 4 characters.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of minhash values for each string per pair of parameters
+ */
+std::unique_ptr<cudf::column> minhash64_permuted(
+  cudf::strings_column_view const& input,
+  uint64_t seed,
+  cudf::device_span<uint64_t const> parameter_a,
+  cudf::device_span<uint64_t const> parameter_b,
+  cudf::size_type width               = 4,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the locality-sensitive hashing band hashes of minhash values
+ *
+ * The minhash values of each row are split into bands of `band_size` consecutive values
+ * and each band is hashed to a single UINT64 value. Rows sharing a band hash at the same
+ * position are candidate near-duplicates, so the output can be grouped or joined on
+ * directly to find them.
+ *
+ * @code{.pseudo}
+ * hashes = [[1, 2, 3, 4], [1, 2, 5, 6]]
+ * b = minhash_bands(hashes, 2)
+ * b[0][0] == b[1][0] and b[0][1] != b[1][1]
+ * @endcode
+ *
+ * Trailing values of a row that do not fill a band are ignored.
+ * Any null row entries result in corresponding null output rows.
+ *
+ * This function uses MurmurHash3_x64_128 for the hash algorithm on the bytes of
+ * the values of each band.
+ *
+ * @throw std::invalid_argument if band_size is not positive
+ * @throw cudf::data_type_error if the input child type is not UINT32 or UINT64
+ *
+ * @param input Lists column of minhash values such as returned by `minhash` or `minhash64`
+ * @param band_size Number of minhash values per band
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of UINT64 band hashes for each row
+ */
+std::unique_ptr<cudf::column> minhash_bands(
+  cudf::lists_column_view const& input,
+  cudf::size_type band_size,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
 namespace nvtext {
 
@@ -55,7 +56,11 @@ struct hashed_vocabulary {
  * The object here can be used to call the subword_tokenize without
  * incurring the cost of loading the same file each time.
  *
+ * The file may also be a binary file created by @ref nvtext::write_vocabulary_file,
+ * whose tables are copied to device memory as they are instead of being parsed.
+ *
  * @throw cudf::logic_error if the `filename_hashed_vocabulary` could not be opened.
+ * @throw cudf::logic_error if a binary vocabulary file is truncated
  *
  * @param filename_hashed_vocabulary A path to the preprocessed vocab.txt file.
  *        Note that this is the file AFTER python/perfect_hash.py has been used
@@ -67,6 +72,30 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   std::string const& filename_hashed_vocabulary,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Write a hashed vocabulary to a binary file.
+ *
+ * The binary file holds the hash tables in their device layout, so
+ * @ref nvtext::load_vocabulary_file maps it and copies each table to device memory
+ * at once instead of parsing one number per line of the text file.
+ *
+ * @code{.pseudo}
+ * vocab = load_vocabulary_file("hashed_vocab.txt")
+ * write_vocabulary_file(*vocab, "hashed_vocab.bin")
+ * // later, in any process
+ * vocab = load_vocabulary_file("hashed_vocab.bin")
+ * @endcode
+ *
+ * @throw cudf::logic_error if `filename` could not be written
+ *
+ * @param vocabulary Vocabulary created by @ref nvtext::load_vocabulary_file
+ * @param filename Path of the binary file to write
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void write_vocabulary_file(hashed_vocabulary const& vocabulary,
+                           std::string const& filename,
+                           rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /**
  * @brief Result object for the subword_tokenize functions.
  */
@@ -126,8 +155,12 @@ struct tokenizer_result {
  * number of tokens resolved and the `stride` value which may repeat tokens
  * in subsequent overflow rows.
  *
- * This function requires about 21x the number of character bytes in the input
- * strings column as working memory.
+ * The characters are normalized in the same pass as the tokenization, so the strings
+ * need not be normalized with `normalize_characters` first.
+ *
+ * The strings are tokenized in batches of rows of about 128MB of characters each. This
+ * function requires about 21x the number of character bytes in a batch as working
+ * memory, besides the token-ids of the whole input.
  *
  * @throw cudf::logic_error if `stride > max_sequence_length`
  * @throw std::overflow_error if `max_sequence_length * max_rows_tensor`
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,21 +17,61 @@
 
 #include "kafka_callback.hpp"
 
+#include <cudf/column/column.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <librdkafka/rdkafkacpp.h>
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
 
+/**
+ * @brief Range of offsets to consume from a single partition of a Kafka topic
+ */
+struct partition_range {
+  int partition;         ///< partition index between `0` and `TOPIC_NUM_PARTITIONS - 1` inclusive
+  int64_t start_offset;  ///< seek position in the partition
+  int64_t end_offset;    ///< position in the partition to read to
+};
+
+/**
+ * @brief Result of polling a Kafka consumer for the next message
+ *
+ * `payload` and `key` point to memory owned by the poller that stays valid until the next poll.
+ */
+struct polled_message {
+  RdKafka::ErrorCode err;  ///< `ERR_NO_ERROR`, or `ERR__PARTITION_EOF` at a partition end
+  int32_t partition;       ///< partition the message was read from
+  int64_t offset;          ///< offset of the message in its partition
+  int64_t timestamp;       ///< message timestamp in milliseconds
+  char const* payload;     ///< message payload
+  std::size_t len;         ///< size of the payload in bytes
+  char const* key;         ///< message key, `nullptr` for a message without a key
+  std::size_t key_len;     ///< size of the key in bytes
+};
+
+/**
+ * @brief Callable that polls the next message, waiting at most the given number of milliseconds
+ */
+using message_poller = std::function<polled_message(int)>;
+
 /**
  * @brief libcudf datasource for Apache Kafka
  *
@@ -92,6 +132,86 @@ class kafka_consumer : public cudf::io::datasource {
                  int batch_timeout,
                  std::string const& delimiter);
 
+  /**
+   * @brief Instantiate a Kafka consumer object that reads from several partitions of a topic.
+   *
+   * All partitions are assigned to the consumer at once so that librdkafka fetches them
+   * concurrently. Message payloads are appended in arrival order to a pinned host buffer.
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partitions partitions and offset ranges to consume
+   * @param batch_timeout maximum (millisecond) read time allowed. If the end offsets are not
+   * reached before batch_timeout, a smaller subset will be returned
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   */
+  kafka_consumer(std::map<std::string, std::string> configs,
+                 python_callable_type python_callable,
+                 kafka_oauth_callback_wrapper_type callable_wrapper,
+                 std::string const& topic_name,
+                 std::vector<partition_range> partitions,
+                 int batch_timeout,
+                 std::string const& delimiter);
+
+  /**
+   * @brief Instantiate a Kafka consumer object that consumes the messages returned by a poller.
+   *
+   * The messages are consumed exactly as they are from a Kafka broker, which allows consuming
+   * replayed messages without a broker. Metadata and offset operations are not available.
+   *
+   * @param poller called for each message with the milliseconds left before `batch_timeout`
+   * @param partitions partitions and offset ranges to consume
+   * @param batch_timeout maximum (millisecond) read time allowed. If the end offsets are not
+   * reached before batch_timeout, a smaller subset will be returned
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   */
+  kafka_consumer(message_poller const& poller,
+                 std::vector<partition_range> partitions,
+                 int batch_timeout,
+                 std::string const& delimiter);
+
+  /**
+   * @brief Returns the number of messages consumed into the buffer
+   *
+   * @return The number of messages
+   */
+  [[nodiscard]] size_type num_messages() const;
+
+  /**
+   * @brief Copies the consumed message payloads into a strings column with one row per message
+   *
+   * The delimiter is not part of the strings.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return Strings column of the message payloads
+   */
+  std::unique_ptr<cudf::column> messages_to_strings(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Copies the consumed messages into a table with one row per message
+   *
+   * The table has the columns:
+   * - payload: STRING column of the message payloads, without the delimiter
+   * - key: STRING column of the message keys, null for messages without a key
+   * - timestamp: TIMESTAMP_MILLISECONDS column of the message timestamps
+   * - partition: INT32 column of the partitions the messages were read from
+   * - offset: INT64 column of the offsets of the messages in their partition
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return Table of the consumed messages
+   */
+  std::unique_ptr<cudf::table> read_batch_as_table(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
   /**
    * @brief Returns a buffer with a subset of data from Kafka Topic
    *
@@ -203,26 +323,38 @@ class kafka_consumer : public cudf::io::datasource {
   kafka_oauth_callback_wrapper_type callable_wrapper_;
 
   std::string topic_name;
-  int partition;
-  int64_t start_offset;
-  int64_t end_offset;
+  std::vector<partition_range> partitions;
   int batch_timeout;
   int default_timeout = 10000;  // milliseconds
   std::string delimiter;
 
-  std::string buffer;
+  // message payloads, each followed by the delimiter
+  cudf::detail::pinned_host_vector<char> buffer;
+  // offset of each message in `buffer`, followed by the buffer size
+  std::vector<size_type> message_offsets{0};
+  // message keys and the offset of each key in `key_chars`, followed by its size
+  std::vector<char> key_chars;
+  std::vector<size_type> key_offsets{0};
+  std::vector<bool> key_valid;
+  // per-message metadata
+  std::vector<int64_t> message_timestamps;
+  std::vector<int32_t> message_partitions;
+  std::vector<int64_t> partition_offsets;
 
  private:
   RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const& topic,
                                                                 int partition,
                                                                 int64_t offset);
 
+  RdKafka::ErrorCode update_consumer_topic_partition_assignment(
+    std::string const& topic, std::vector<partition_range> const& partitions);
+
   /**
    * Convenience method for getting "now()" in Kafka's standard format
    */
   int64_t now();
 
-  void consume_to_buffer();
+  void consume_to_buffer(message_poller const& poll);
 };
 
 }  // namespace kafka
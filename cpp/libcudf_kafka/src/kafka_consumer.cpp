@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,16 +15,72 @@
  */
 #include <cudf_kafka/kafka_consumer.hpp>
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
 #include <librdkafka/rdkafkacpp.h>
 
+#include <thrust/pair.h>
+
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <stdexcept>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
 
+namespace {
+
+template <typename T>
+std::unique_ptr<cudf::column> make_fixed_width_column(data_type type,
+                                                      std::vector<T> const& values,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  return std::make_unique<cudf::column>(
+    type,
+    static_cast<size_type>(values.size()),
+    rmm::device_buffer(values.data(), values.size() * sizeof(T), stream, mr),
+    rmm::device_buffer{},
+    0);
+}
+
+/**
+ * @brief Returns a poller of the messages of a librdkafka consumer
+ *
+ * The last polled message is kept until the next poll so that its payload and key stay valid.
+ */
+message_poller make_consumer_poller(RdKafka::KafkaConsumer& consumer)
+{
+  auto last = std::make_shared<std::unique_ptr<RdKafka::Message>>();
+  return [&consumer, last](int timeout_ms) {
+    last->reset(consumer.consume(timeout_ms));
+    auto const& msg = **last;
+    return polled_message{msg.err(),
+                          msg.partition(),
+                          msg.offset(),
+                          msg.timestamp().timestamp,
+                          static_cast<char const*>(msg.payload()),
+                          msg.len(),
+                          static_cast<char const*>(msg.key_pointer()),
+                          msg.key_len()};
+  };
+}
+
+}  // namespace
+
 kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
                                python_callable_type python_callable,
                                kafka_oauth_callback_wrapper_type callable_wrapper)
@@ -67,13 +123,28 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
                                int64_t end_offset,
                                int batch_timeout,
                                std::string const& delimiter)
+  : kafka_consumer(configs,
+                   python_callable,
+                   callback_wrapper,
+                   topic_name,
+                   {partition_range{partition, start_offset, end_offset}},
+                   batch_timeout,
+                   delimiter)
+{
+}
+
+kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
+                               python_callable_type python_callable,
+                               kafka_oauth_callback_wrapper_type callback_wrapper,
+                               std::string const& topic_name,
+                               std::vector<partition_range> partitions,
+                               int batch_timeout,
+                               std::string const& delimiter)
   : configs(configs),
     python_callable_(python_callable),
     callable_wrapper_(callback_wrapper),
     topic_name(topic_name),
-    partition(partition),
-    start_offset(start_offset),
-    end_offset(end_offset),
+    partitions(std::move(partitions)),
     batch_timeout(batch_timeout),
     delimiter(delimiter),
     kafka_conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL))
@@ -102,14 +173,25 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
   consumer = std::unique_ptr<RdKafka::KafkaConsumer>(
     RdKafka::KafkaConsumer::create(kafka_conf.get(), errstr));
 
+  update_consumer_topic_partition_assignment(topic_name, this->partitions);
+
   // Pre fill the local buffer with messages so the datasource->size() invocation
   // will return a valid size.
-  consume_to_buffer();
+  consume_to_buffer(make_consumer_poller(*consumer));
+}
+
+kafka_consumer::kafka_consumer(message_poller const& poller,
+                               std::vector<partition_range> partitions,
+                               int batch_timeout,
+                               std::string const& delimiter)
+  : partitions(std::move(partitions)), batch_timeout(batch_timeout), delimiter(delimiter)
+{
+  consume_to_buffer(poller);
 }
 
 std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t offset, size_t size)
 {
-  if (offset > buffer.size()) { return 0; }
+  if (offset > buffer.size()) { return nullptr; }
   size = std::min(size, buffer.size() - offset);
   return std::make_unique<non_owning_buffer>((uint8_t*)buffer.data() + offset, size);
 }
@@ -118,41 +200,156 @@ size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
 {
   if (offset > buffer.size()) { return 0; }
   auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  std::memcpy(dst, buffer.data() + offset, read_size);
   return read_size;
 }
 
 size_t kafka_consumer::size() const { return buffer.size(); }
 
+size_type kafka_consumer::num_messages() const
+{
+  return static_cast<size_type>(message_offsets.size() - 1);
+}
+
+std::unique_ptr<cudf::column> kafka_consumer::messages_to_strings(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count = num_messages();
+  // without a delimiter the buffer already is the chars of the strings column
+  if (delimiter.empty()) {
+    auto offsets = cudf::detail::make_device_uvector_async(message_offsets, stream, mr);
+    return cudf::make_strings_column(
+      strings_count,
+      std::make_unique<cudf::column>(std::move(offsets), rmm::device_buffer{}, 0),
+      rmm::device_buffer(buffer.data(), buffer.size(), stream, mr),
+      0,
+      rmm::device_buffer{});
+  }
+
+  // otherwise the strings are gathered from the buffer leaving out the delimiters
+  auto const d_buffer = rmm::device_buffer(buffer.data(), buffer.size(), stream);
+  auto const d_chars  = static_cast<char const*>(d_buffer.data());
+  std::vector<thrust::pair<char const*, size_type>> strings(strings_count);
+  for (size_type idx = 0; idx < strings_count; ++idx) {
+    auto const size = message_offsets[idx + 1] - message_offsets[idx] -
+                      static_cast<size_type>(delimiter.size());
+    strings[idx]    = {d_chars + message_offsets[idx], size};
+  }
+  auto const d_strings = cudf::detail::make_device_uvector_async(
+    strings, stream, rmm::mr::get_current_device_resource());
+  return cudf::make_strings_column(d_strings, stream, mr);
+}
+
+std::unique_ptr<cudf::table> kafka_consumer::read_batch_as_table(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = num_messages();
+
+  std::vector<bitmask_type> key_mask(cudf::num_bitmask_words(num_rows), 0);
+  for (size_type idx = 0; idx < num_rows; ++idx) {
+    if (key_valid[idx]) { cudf::set_bit_unsafe(key_mask.data(), idx); }
+  }
+  auto const key_null_count =
+    static_cast<size_type>(std::count(key_valid.begin(), key_valid.end(), false));
+  auto keys = cudf::make_strings_column(
+    num_rows,
+    make_fixed_width_column(data_type{type_id::INT32}, key_offsets, stream, mr),
+    rmm::device_buffer(key_chars.data(), key_chars.size(), stream, mr),
+    key_null_count,
+    key_null_count > 0
+      ? rmm::device_buffer(key_mask.data(), key_mask.size() * sizeof(bitmask_type), stream, mr)
+      : rmm::device_buffer{});
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(messages_to_strings(stream, mr));
+  columns.push_back(std::move(keys));
+  columns.push_back(make_fixed_width_column(
+    data_type{type_id::TIMESTAMP_MILLISECONDS}, message_timestamps, stream, mr));
+  columns.push_back(
+    make_fixed_width_column(data_type{type_id::INT32}, message_partitions, stream, mr));
+  columns.push_back(
+    make_fixed_width_column(data_type{type_id::INT64}, partition_offsets, stream, mr));
+  // the host vectors are pageable, so their copies have completed on return
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
 /**
  * Change the TOPPAR assignment for this consumer instance
  */
 RdKafka::ErrorCode kafka_consumer::update_consumer_topic_partition_assignment(
   std::string const& topic, int partition, int64_t offset)
+{
+  return update_consumer_topic_partition_assignment(topic, {{partition, offset, offset}});
+}
+
+RdKafka::ErrorCode kafka_consumer::update_consumer_topic_partition_assignment(
+  std::string const& topic, std::vector<partition_range> const& partitions)
 {
   std::vector<RdKafka::TopicPartition*> topic_partitions;
-  topic_partitions.push_back(RdKafka::TopicPartition::create(topic, partition, offset));
-  return consumer.get()->assign(topic_partitions);
+  for (auto const& range : partitions) {
+    topic_partitions.push_back(
+      RdKafka::TopicPartition::create(topic, range.partition, range.start_offset));
+  }
+  auto const err = consumer.get()->assign(topic_partitions);
+  RdKafka::TopicPartition::destroy(topic_partitions);
+  return err;
 }
 
-void kafka_consumer::consume_to_buffer()
+void kafka_consumer::consume_to_buffer(message_poller const& poll)
 {
-  update_consumer_topic_partition_assignment(topic_name, partition, start_offset);
-
-  int64_t messages_read = 0;
-  auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
-
-  while (messages_read < end_offset - start_offset && end > std::chrono::steady_clock::now()) {
-    std::unique_ptr<RdKafka::Message> msg{
-      consumer->consume((end - std::chrono::steady_clock::now()).count())};
-
-    if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char*>(msg->payload()));
-      buffer.append(delimiter);
-      messages_read++;
-    } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
-      // If there are no more messages return
-      break;
+  // messages still to be read from each partition
+  std::map<int32_t, int64_t> remaining;
+  for (auto const& range : partitions) {
+    remaining[range.partition] = range.end_offset - range.start_offset;
+  }
+  auto const total_remaining =
+    std::accumulate(remaining.begin(), remaining.end(), int64_t{0}, [](auto sum, auto const& p) {
+      return sum + std::max(p.second, int64_t{0});
+    });
+
+  // reserving for one small message per offset avoids most regrowth of the pinned buffer
+  constexpr int64_t max_reserved_messages  = 1 << 20;
+  constexpr int64_t estimated_message_size = 64;
+  auto const reserved_messages = std::min(total_remaining, max_reserved_messages);
+  buffer.reserve(reserved_messages * estimated_message_size);
+  message_offsets.reserve(reserved_messages + 1);
+
+  auto const is_done = [&] {
+    return std::all_of(
+      remaining.begin(), remaining.end(), [](auto const& p) { return p.second <= 0; });
+  };
+  auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+  constexpr auto max_size = static_cast<std::size_t>(std::numeric_limits<size_type>::max());
+
+  while (!is_done() && end > std::chrono::steady_clock::now()) {
+    auto const timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+      end - std::chrono::steady_clock::now());
+    auto const msg = poll(static_cast<int>(timeout.count()));
+
+    auto const left = remaining.find(msg.partition);
+    if (msg.err == RdKafka::ErrorCode::ERR_NO_ERROR) {
+      // messages fetched past the end offset of their partition are dropped
+      if (left == remaining.end() || left->second <= 0) { continue; }
+      CUDF_EXPECTS(buffer.size() + msg.len + delimiter.size() <= max_size,
+                   "Kafka messages exceed the size limit of a single buffer",
+                   std::overflow_error);
+      CUDF_EXPECTS(key_chars.size() + msg.key_len <= max_size,
+                   "Kafka message keys exceed the size limit of a single column",
+                   std::overflow_error);
+      buffer.insert(buffer.end(), msg.payload, msg.payload + msg.len);
+      buffer.insert(buffer.end(), delimiter.begin(), delimiter.end());
+      message_offsets.push_back(static_cast<size_type>(buffer.size()));
+
+      if (msg.key != nullptr) { key_chars.insert(key_chars.end(), msg.key, msg.key + msg.key_len); }
+      key_offsets.push_back(static_cast<size_type>(key_chars.size()));
+      key_valid.push_back(msg.key != nullptr);
+      message_timestamps.push_back(msg.timestamp);
+      message_partitions.push_back(msg.partition);
+      partition_offsets.push_back(msg.offset);
+      --left->second;
+    } else if (msg.err == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+      // If there are no more messages in the partition stop reading it
+      if (left != remaining.end()) { left->second = 0; }
     }
   }
 }
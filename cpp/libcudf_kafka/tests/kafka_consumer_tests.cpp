@@ -14,21 +14,113 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
 #include <cudf_kafka/kafka_consumer.hpp>
 
 #include <gtest/gtest.h>
 
+#include <deque>
+#include <limits>
 #include <map>
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace kafka = cudf::io::external::kafka;
 
 struct KafkaDatasourceTest : public ::testing::Test {};
 
+namespace {
+
+struct test_message {
+  int32_t partition;
+  int64_t offset;
+  std::string payload;
+  std::optional<std::string> key;
+  int64_t timestamp = 0;
+  RdKafka::ErrorCode err = RdKafka::ErrorCode::ERR_NO_ERROR;
+};
+
+test_message partition_eof(int32_t partition)
+{
+  return {partition, 0, {}, std::nullopt, 0, RdKafka::ErrorCode::ERR__PARTITION_EOF};
+}
+
+// Polls the queued messages in order, then times out like an idle broker
+struct queued_poller {
+  std::deque<test_message> queue;
+  test_message current{};
+  std::vector<int> timeouts;
+
+  kafka::message_poller poller()
+  {
+    return [this](int timeout_ms) {
+      timeouts.push_back(timeout_ms);
+      if (queue.empty()) {
+        return kafka::polled_message{
+          RdKafka::ErrorCode::ERR__TIMED_OUT, -1, 0, 0, nullptr, 0, nullptr, 0};
+      }
+      current = queue.front();
+      queue.pop_front();
+      return kafka::polled_message{current.err,
+                                   current.partition,
+                                   current.offset,
+                                   current.timestamp,
+                                   current.payload.data(),
+                                   current.payload.size(),
+                                   current.key.has_value() ? current.key->data() : nullptr,
+                                   current.key.has_value() ? current.key->size() : 0};
+    };
+  }
+};
+
+template <typename T>
+std::vector<T> to_host(cudf::column_view const& col)
+{
+  return cudf::detail::make_std_vector_sync(
+    cudf::device_span<T const>(col.data<T>(), col.size()), cudf::get_default_stream());
+}
+
+std::vector<std::optional<std::string>> to_host_strings(cudf::column_view const& col)
+{
+  auto const stream  = cudf::get_default_stream();
+  auto const strings = cudf::strings_column_view(col);
+  auto const offsets = to_host<cudf::size_type>(strings.offsets());
+  auto const chars   = cudf::detail::make_std_vector_sync(
+    cudf::device_span<char const>(strings.chars_begin(stream), strings.chars_size(stream)),
+    stream);
+  auto const mask =
+    col.nullable()
+      ? cudf::detail::make_std_vector_sync(
+          cudf::device_span<cudf::bitmask_type const>(
+            col.null_mask(), cudf::num_bitmask_words(col.size())),
+          stream)
+      : std::vector<cudf::bitmask_type>{};
+
+  std::vector<std::optional<std::string>> result;
+  for (cudf::size_type idx = 0; idx < col.size(); ++idx) {
+    if (col.nullable() && !cudf::bit_is_set(mask.data(), idx)) {
+      result.emplace_back(std::nullopt);
+    } else {
+      result.emplace_back(
+        std::string(chars.begin() + offsets[idx], chars.begin() + offsets[idx + 1]));
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
 TEST_F(KafkaDatasourceTest, MissingGroupID)
 {
   // group.id is a required configuration.
@@ -67,3 +159,148 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
       kafka_configs, python_callable, callback_wrapper, "csv-topic", 0, 0, 3, 5000, "\n"),
     cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, MultiplePartitionsMissingGroupID)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"] = "localhost:9092";
+
+  kafka::python_callable_type python_callable;
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper;
+  std::vector<kafka::partition_range> partitions{{0, 0, 3}, {1, 0, 3}};
+
+  EXPECT_THROW(
+    kafka::kafka_consumer kc(
+      kafka_configs, python_callable, callback_wrapper, "csv-topic", partitions, 5000, "\n"),
+    cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, ReadBatchAsTable)
+{
+  queued_poller source;
+  source.queue = {{0, 10, "a,1", "k0", 1000},
+                  {1, 5, "bb,2", std::nullopt, 2000},
+                  {0, 11, "", "", 3000},
+                  {1, 6, "dddd,4", "k3", 4000}};
+  kafka::kafka_consumer kc(source.poller(), {{0, 10, 12}, {1, 5, 7}}, 5000, "\n");
+  ASSERT_EQ(kc.num_messages(), 4);
+
+  auto const table = kc.read_batch_as_table();
+  ASSERT_EQ(table->num_columns(), 5);
+  ASSERT_EQ(table->num_rows(), 4);
+
+  using strings = std::vector<std::optional<std::string>>;
+  EXPECT_EQ(to_host_strings(table->get_column(0)), (strings{"a,1", "bb,2", "", "dddd,4"}));
+  EXPECT_EQ(to_host_strings(table->get_column(1)), (strings{"k0", std::nullopt, "", "k3"}));
+  EXPECT_EQ(table->get_column(1).null_count(), 1);
+  EXPECT_EQ(table->get_column(2).type().id(), cudf::type_id::TIMESTAMP_MILLISECONDS);
+  EXPECT_EQ(to_host<int64_t>(table->get_column(2)), (std::vector<int64_t>{1000, 2000, 3000, 4000}));
+  EXPECT_EQ(to_host<int32_t>(table->get_column(3)), (std::vector<int32_t>{0, 1, 0, 1}));
+  EXPECT_EQ(to_host<int64_t>(table->get_column(4)), (std::vector<int64_t>{10, 5, 11, 6}));
+}
+
+TEST_F(KafkaDatasourceTest, ReadEmptyBatchAsTable)
+{
+  queued_poller source;
+  source.queue = {partition_eof(0)};
+  kafka::kafka_consumer kc(source.poller(), {{0, 0, 3}}, 5000, "\n");
+  EXPECT_EQ(kc.num_messages(), 0);
+  EXPECT_EQ(kc.size(), 0u);
+
+  auto const table = kc.read_batch_as_table();
+  ASSERT_EQ(table->num_columns(), 5);
+  EXPECT_EQ(table->num_rows(), 0);
+  EXPECT_EQ(table->get_column(0).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(table->get_column(1).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(table->get_column(1).null_count(), 0);
+}
+
+TEST_F(KafkaDatasourceTest, BatchSizeLimits)
+{
+  // The size checks happen before any of the message bytes are copied
+  auto constexpr max_size = static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max());
+  std::string const data{"x"};
+  auto const oversized_poller = [&](bool oversized_key) {
+    return [&, oversized_key](int) {
+      return kafka::polled_message{RdKafka::ErrorCode::ERR_NO_ERROR,
+                                   0,
+                                   0,
+                                   0,
+                                   data.data(),
+                                   oversized_key ? data.size() : max_size,
+                                   data.data(),
+                                   oversized_key ? max_size + 1 : data.size()};
+    };
+  };
+
+  // The payload fits on its own, but not with the delimiter
+  EXPECT_THROW(kafka::kafka_consumer kc(oversized_poller(false), {{0, 0, 1}}, 5000, "\n"),
+               std::overflow_error);
+  EXPECT_THROW(kafka::kafka_consumer kc(oversized_poller(true), {{0, 0, 1}}, 5000, "\n"),
+               std::overflow_error);
+}
+
+TEST_F(KafkaDatasourceTest, ConsumeSeveralPartitions)
+{
+  queued_poller source;
+  source.queue = {{1, 0, "b0"},
+                  {0, 10, "a10"},
+                  {1, 1, "b1"},
+                  // partition 1 is complete, and partition 7 is not assigned
+                  {1, 2, "b2"},
+                  {7, 0, "unassigned"},
+                  // errors other than the end of a partition are skipped
+                  {0, 0, {}, std::nullopt, 0, RdKafka::ErrorCode::ERR__TRANSPORT},
+                  {0, 11, "a11"},
+                  {0, 12, "a12"}};
+  kafka::kafka_consumer kc(source.poller(), {{0, 10, 12}, {1, 0, 2}}, 5000, "\n");
+
+  // consumption stops as soon as every partition reached its end offset
+  EXPECT_EQ(source.queue.size(), 1u);
+  ASSERT_EQ(kc.num_messages(), 4);
+
+  std::string const expected{"b0\na10\nb1\na11\n"};
+  ASSERT_EQ(kc.size(), expected.size());
+  auto const buffer = kc.host_read(0, kc.size());
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(buffer->data()), buffer->size()), expected);
+
+  std::vector<uint8_t> tail(8);
+  EXPECT_EQ(kc.host_read(expected.size() - 4, tail.size(), tail.data()), 4u);
+  EXPECT_EQ(std::string(tail.begin(), tail.begin() + 4), "a11\n");
+  EXPECT_EQ(kc.host_read(expected.size() + 1, 1, tail.data()), 0u);
+}
+
+TEST_F(KafkaDatasourceTest, ConsumeUntilPartitionEof)
+{
+  queued_poller source;
+  source.queue = {{0, 0, "x"}, {1, 0, "y"}, partition_eof(0), {1, 1, "z"}, partition_eof(1)};
+  kafka::kafka_consumer kc(source.poller(), {{0, 0, 100}, {1, 0, 100}}, 60000, "");
+
+  EXPECT_TRUE(source.queue.empty());
+  EXPECT_EQ(source.timeouts.size(), 5u);
+  EXPECT_EQ(kc.num_messages(), 3);
+  EXPECT_EQ(kc.size(), 3u);
+
+  // without a delimiter the buffer holds the payloads back to back
+  using strings = std::vector<std::optional<std::string>>;
+  EXPECT_EQ(to_host_strings(kc.messages_to_strings()->view()), (strings{"x", "y", "z"}));
+}
+
+TEST_F(KafkaDatasourceTest, ConsumeUntilBatchTimeout)
+{
+  queued_poller source;
+  source.queue = {{0, 0, "first"}};
+  auto constexpr batch_timeout = 50;
+  kafka::kafka_consumer kc(source.poller(), {{0, 0, 10}}, batch_timeout, "||");
+
+  // the idle partition is polled until the batch timeout with the time left in the batch
+  EXPECT_EQ(kc.num_messages(), 1);
+  ASSERT_GT(source.timeouts.size(), 1u);
+  for (auto const timeout : source.timeouts) {
+    EXPECT_LE(timeout, batch_timeout);
+  }
+
+  using strings = std::vector<std::optional<std::string>>;
+  EXPECT_EQ(kc.size(), 7u);
+  EXPECT_EQ(to_host_strings(kc.messages_to_strings()->view()), (strings{"first"}));
+}
@@ -16,9 +16,11 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <memory>
+#include <stdexcept>
 
 namespace cudf {
 
@@ -230,6 +232,24 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, hllpp_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, merge_hllpp_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, top_k_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 // aggregation_finalizer ----------------------------------------
 
 void aggregation_finalizer::visit(aggregation const& agg) {}
@@ -398,6 +418,21 @@ void aggregation_finalizer::visit(merge_tdigest_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(hllpp_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(merge_hllpp_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(top_k_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 }  // namespace detail
 
 std::vector<std::unique_ptr<aggregation>> aggregation::get_simple_aggregations(
@@ -751,18 +786,26 @@ template std::unique_ptr<rolling_aggregation> make_lead_aggregation<rolling_aggr
 template <typename Base>
 std::unique_ptr<Base> make_udf_aggregation(udf_type type,
                                            std::string const& user_defined_aggregator,
-                                           data_type output_type)
+                                           data_type output_type,
+                                           bool is_associative)
 {
   auto* a =
     new detail::udf_aggregation{type == udf_type::PTX ? aggregation::PTX : aggregation::CUDA,
                                 user_defined_aggregator,
-                                output_type};
+                                output_type,
+                                is_associative};
   return std::unique_ptr<detail::udf_aggregation>(a);
 }
 template std::unique_ptr<aggregation> make_udf_aggregation<aggregation>(
-  udf_type type, std::string const& user_defined_aggregator, data_type output_type);
+  udf_type type,
+  std::string const& user_defined_aggregator,
+  data_type output_type,
+  bool is_associative);
 template std::unique_ptr<rolling_aggregation> make_udf_aggregation<rolling_aggregation>(
-  udf_type type, std::string const& user_defined_aggregator, data_type output_type);
+  udf_type type,
+  std::string const& user_defined_aggregator,
+  data_type output_type,
+  bool is_associative);
 
 /// Factory to create a MERGE_LISTS aggregation
 template <typename Base>
@@ -853,6 +896,45 @@ template std::unique_ptr<groupby_aggregation> make_merge_tdigest_aggregation<gro
 template std::unique_ptr<reduce_aggregation> make_merge_tdigest_aggregation<reduce_aggregation>(
   int max_centroids);
 
+template <typename Base>
+std::unique_ptr<Base> make_hllpp_aggregation(int precision)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 18,
+               "HLLPP precision must be in the range [4, 18]",
+               std::invalid_argument);
+  return std::make_unique<detail::hllpp_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_hllpp_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_hllpp_aggregation<groupby_aggregation>(
+  int precision);
+template std::unique_ptr<reduce_aggregation> make_hllpp_aggregation<reduce_aggregation>(
+  int precision);
+
+template <typename Base>
+std::unique_ptr<Base> make_merge_hllpp_aggregation(int precision)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 18,
+               "HLLPP precision must be in the range [4, 18]",
+               std::invalid_argument);
+  return std::make_unique<detail::merge_hllpp_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_merge_hllpp_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_merge_hllpp_aggregation<groupby_aggregation>(
+  int precision);
+template std::unique_ptr<reduce_aggregation> make_merge_hllpp_aggregation<reduce_aggregation>(
+  int precision);
+
+template <typename Base>
+std::unique_ptr<Base> make_top_k_aggregation(size_type k, order sort_order)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative", std::invalid_argument);
+  return std::make_unique<detail::top_k_aggregation>(k, sort_order);
+}
+template std::unique_ptr<aggregation> make_top_k_aggregation<aggregation>(size_type k,
+                                                                          order sort_order);
+template std::unique_ptr<groupby_aggregation> make_top_k_aggregation<groupby_aggregation>(
+  size_type k, order sort_order);
+
 namespace detail {
 namespace {
 struct target_type_functor {
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/hllpp.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr int min_precision       = 4;
+constexpr int max_precision       = 18;
+constexpr int registers_per_field = 10;
+constexpr int register_bits       = 6;
+constexpr uint64_t register_mask  = (uint64_t{1} << register_bits) - 1;
+
+/// Seed of the hashes of the values, shared by all the sketches so that they can be merged
+constexpr uint64_t hash_seed = 42;
+
+constexpr int num_fields(int precision)
+{
+  return cudf::util::div_rounding_up_safe(1 << precision, registers_per_field);
+}
+
+/**
+ * @brief Raises register `index` of a sketch to `value` if it is lower.
+ *
+ * @param field The int64 field of the sketch holding the register
+ * @param index The index of the register in the sketch
+ * @param value The new value of the register
+ */
+__device__ void update_register(int64_t* field, int index, uint64_t value)
+{
+  auto const shift = (index % registers_per_field) * register_bits;
+  auto expected    = *field;
+  while (((static_cast<uint64_t>(expected) >> shift) & register_mask) < value) {
+    auto const cleared = static_cast<uint64_t>(expected) & ~(register_mask << shift);
+    auto const desired = static_cast<int64_t>(cleared | (value << shift));
+    auto const old     = cudf::detail::atomic_cas(field, expected, desired);
+    if (old == expected) { return; }
+    expected = old;
+  }
+}
+
+/**
+ * @brief Updates the sketch of the group of each value with its hash.
+ *
+ * The first `precision` bits of the hash select a register, which keeps the highest position of
+ * the first set bit among the remaining bits of the hashes.
+ */
+template <typename LabelIterator>
+struct insert_values_fn {
+  uint64_t const* hashes;
+  bitmask_type const* null_mask;
+  size_type offset;
+  LabelIterator group_labels;
+  int64_t* const* fields;
+  int precision;
+
+  __device__ void operator()(size_type row) const
+  {
+    if (null_mask != nullptr and not bit_is_set(null_mask, offset + row)) { return; }
+    auto const hash  = hashes[row];
+    auto const index = static_cast<int>(hash >> (64 - precision));
+    // The sentinel bit bounds the rank of the hashes whose remaining bits are all zero
+    auto const remaining = (hash << precision) | (uint64_t{1} << (precision - 1));
+    auto const rank      = static_cast<uint64_t>(__clzll(static_cast<long long>(remaining)) + 1);
+    update_register(fields[index / registers_per_field] + group_labels[row], index, rank);
+  }
+};
+
+/**
+ * @brief Merges one field of a sketch into the same field of the sketch of its group.
+ */
+template <typename LabelIterator>
+struct merge_sketches_fn {
+  int64_t const* const* input_fields;
+  bitmask_type const* null_mask;
+  size_type offset;
+  LabelIterator group_labels;
+  int64_t* const* fields;
+  int num_fields;
+
+  __device__ void operator()(int64_t idx) const
+  {
+    auto const row   = static_cast<size_type>(idx / num_fields);
+    auto const field = static_cast<int>(idx % num_fields);
+    if (null_mask != nullptr and not bit_is_set(null_mask, offset + row)) { return; }
+    auto const packed = static_cast<uint64_t>(input_fields[field][row]);
+    for (int i = 0; i < registers_per_field; ++i) {
+      auto const value = (packed >> (i * register_bits)) & register_mask;
+      if (value > 0) {
+        update_register(fields[field] + group_labels[row], field * registers_per_field + i, value);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Estimates the number of distinct values summarized by each sketch.
+ *
+ * Uses the harmonic mean of the registers, or linear counting of the empty registers for the
+ * small cardinalities where the harmonic mean is biased.
+ */
+struct estimate_fn {
+  int64_t const* const* fields;
+  int precision;
+
+  __device__ int64_t operator()(size_type row) const
+  {
+    auto const num_registers = 1 << precision;
+    double inverse_sum       = 0;
+    int num_zeros            = 0;
+    for (int index = 0; index < num_registers; ++index) {
+      auto const packed = static_cast<uint64_t>(fields[index / registers_per_field][row]);
+      auto const value =
+        (packed >> ((index % registers_per_field) * register_bits)) & register_mask;
+      inverse_sum += ldexp(1.0, -static_cast<int>(value));
+      num_zeros += value == 0;
+    }
+
+    auto const m     = static_cast<double>(num_registers);
+    auto const alpha = precision == 4   ? 0.673
+                       : precision == 5 ? 0.697
+                       : precision == 6 ? 0.709
+                                        : 0.7213 / (1.0 + 1.079 / m);
+    auto const estimate = alpha * m * m / inverse_sum;
+    if (estimate <= 2.5 * m and num_zeros > 0) { return llround(m * log(m / num_zeros)); }
+    return llround(estimate);
+  }
+};
+
+/**
+ * @brief Returns the precision of a column of sketches from its number of fields.
+ */
+int sketch_precision(column_view const& sketches)
+{
+  CUDF_EXPECTS(sketches.type().id() == type_id::STRUCT, "HLLPP sketches must be a struct column");
+  CUDF_EXPECTS(std::all_of(sketches.child_begin(),
+                           sketches.child_end(),
+                           [](auto const& child) { return child.type().id() == type_id::INT64; }),
+               "The fields of HLLPP sketches must be INT64");
+  for (auto precision = min_precision; precision <= max_precision; ++precision) {
+    if (num_fields(precision) == sketches.num_children()) { return precision; }
+  }
+  CUDF_FAIL("The number of fields of the HLLPP sketches does not match any precision");
+}
+
+/**
+ * @brief Creates the fields of `num_groups` sketches with all their registers set to zero.
+ */
+std::vector<std::unique_ptr<column>> make_empty_sketch_fields(int precision,
+                                                              size_type num_groups,
+                                                              rmm::cuda_stream_view stream,
+                                                              rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> fields;
+  for (int i = 0; i < num_fields(precision); ++i) {
+    auto field = make_numeric_column(
+      data_type{type_id::INT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+    thrust::fill_n(rmm::exec_policy_nosync(stream),
+                   field->mutable_view().begin<int64_t>(),
+                   num_groups,
+                   int64_t{0});
+    fields.push_back(std::move(field));
+  }
+  return fields;
+}
+
+rmm::device_uvector<int64_t*> field_pointers(std::vector<std::unique_ptr<column>>& fields,
+                                             rmm::cuda_stream_view stream)
+{
+  std::vector<int64_t*> pointers;
+  std::transform(fields.begin(), fields.end(), std::back_inserter(pointers), [](auto& field) {
+    return field->mutable_view().template begin<int64_t>();
+  });
+  return cudf::detail::make_device_uvector_async(
+    pointers, stream, rmm::mr::get_current_device_resource());
+}
+
+rmm::device_uvector<int64_t const*> field_pointers(column_view const& sketches,
+                                                   rmm::cuda_stream_view stream)
+{
+  auto const structs = structs_column_view{sketches};
+  std::vector<int64_t const*> pointers;
+  for (size_type i = 0; i < sketches.num_children(); ++i) {
+    pointers.push_back(structs.get_sliced_child(i, stream).begin<int64_t>());
+  }
+  return cudf::detail::make_device_uvector_async(
+    pointers, stream, rmm::mr::get_current_device_resource());
+}
+
+template <typename LabelIterator>
+std::unique_ptr<column> compute_hllpp(column_view const& values,
+                                      LabelIterator group_labels,
+                                      size_type num_groups,
+                                      int precision,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(precision >= min_precision and precision <= max_precision,
+               "HLLPP precision must be in the range [4, 18]");
+  auto fields = make_empty_sketch_fields(precision, num_groups, stream, mr);
+  if (values.size() > values.null_count()) {
+    auto const hashes = cudf::hashing::detail::xxhash_64(
+      table_view{{values}}, hash_seed, stream, rmm::mr::get_current_device_resource());
+    auto const d_fields = field_pointers(fields, stream);
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       values.size(),
+                       insert_values_fn<LabelIterator>{hashes->view().data<uint64_t>(),
+                                                       values.null_mask(),
+                                                       values.offset(),
+                                                       group_labels,
+                                                       d_fields.data(),
+                                                       precision});
+  }
+  return make_structs_column(num_groups, std::move(fields), 0, {}, stream, mr);
+}
+
+template <typename LabelIterator>
+std::unique_ptr<column> compute_merge_hllpp(column_view const& sketches,
+                                            LabelIterator group_labels,
+                                            size_type num_groups,
+                                            int precision,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sketch_precision(sketches) == precision,
+               "The precision of the HLLPP sketches does not match the aggregation");
+  auto fields = make_empty_sketch_fields(precision, num_groups, stream, mr);
+  if (sketches.size() > sketches.null_count()) {
+    auto const d_input_fields = field_pointers(sketches, stream);
+    auto const d_fields       = field_pointers(fields, stream);
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator<int64_t>(0),
+                       int64_t{sketches.size()} * num_fields(precision),
+                       merge_sketches_fn<LabelIterator>{d_input_fields.data(),
+                                                        sketches.null_mask(),
+                                                        sketches.offset(),
+                                                        group_labels,
+                                                        d_fields.data(),
+                                                        num_fields(precision)});
+  }
+  return make_structs_column(num_groups, std::move(fields), 0, {}, stream, mr);
+}
+
+std::unique_ptr<scalar> to_sketch_scalar(std::unique_ptr<column>&& sketch,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto contents = sketch->release();
+  return std::make_unique<struct_scalar>(table(std::move(contents.children)), true, stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> group_hllpp(column_view const& values,
+                                    device_span<size_type const> group_labels,
+                                    size_type num_groups,
+                                    int precision,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return compute_hllpp(values, group_labels.begin(), num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<column> group_merge_hllpp(column_view const& sketches,
+                                          device_span<size_type const> group_labels,
+                                          size_type num_groups,
+                                          int precision,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  return compute_merge_hllpp(sketches, group_labels.begin(), num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<scalar> reduce_hllpp(column_view const& values,
+                                     int precision,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  return to_sketch_scalar(
+    compute_hllpp(values, thrust::make_constant_iterator<size_type>(0), 1, precision, stream, mr),
+    stream,
+    mr);
+}
+
+std::unique_ptr<scalar> reduce_merge_hllpp(column_view const& sketches,
+                                           int precision,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  return to_sketch_scalar(
+    compute_merge_hllpp(
+      sketches, thrust::make_constant_iterator<size_type>(0), 1, precision, stream, mr),
+    stream,
+    mr);
+}
+
+std::unique_ptr<column> estimate_distinct_count(column_view const& sketches,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  auto const precision = sketch_precision(sketches);
+
+  auto result = make_numeric_column(data_type{type_id::INT64},
+                                    sketches.size(),
+                                    cudf::detail::copy_bitmask(sketches, stream, mr),
+                                    sketches.null_count(),
+                                    stream,
+                                    mr);
+  if (sketches.is_empty()) { return result; }
+
+  auto const d_fields = field_pointers(sketches, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(sketches.size()),
+                    result->mutable_view().begin<int64_t>(),
+                    estimate_fn{d_fields.data(), precision});
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> estimate_distinct_count(column_view const& sketches,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_distinct_count(sketches, stream, mr);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,13 +16,19 @@
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
@@ -34,6 +40,54 @@ namespace cudf {
 namespace ast {
 
 namespace detail {
+namespace {
+
+/**
+ * @brief Returns whether an expression is made of literals only, so its value is the same for
+ * every row.
+ */
+bool is_constant(expression const& expr)
+{
+  if (dynamic_cast<literal const*>(&expr) != nullptr) { return true; }
+  auto const op = dynamic_cast<operation const*>(&expr);
+  if (op == nullptr) { return false; }
+  auto const operands = op->get_operands();
+  return std::all_of(
+    operands.cbegin(), operands.cend(), [](auto const& operand) { return is_constant(operand); });
+}
+
+/**
+ * @brief Makes a literal of a scalar of a type supported by literals.
+ */
+struct literal_factory {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>())>
+  literal operator()(cudf::scalar& value)
+  {
+    return literal{static_cast<cudf::numeric_scalar<T>&>(value)};
+  }
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_timestamp<T>())>
+  literal operator()(cudf::scalar& value)
+  {
+    return literal{static_cast<cudf::timestamp_scalar<T>&>(value)};
+  }
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_duration<T>())>
+  literal operator()(cudf::scalar& value)
+  {
+    return literal{static_cast<cudf::duration_scalar<T>&>(value)};
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not cudf::is_numeric<T>() and not cudf::is_timestamp<T>() and
+                           not cudf::is_duration<T>())>
+  literal operator()(cudf::scalar&)
+  {
+    CUDF_FAIL("Unsupported type for a literal.");
+  }
+};
+
+}  // namespace
 
 device_data_reference::device_data_reference(device_data_reference_type reference_type,
                                              cudf::data_type data_type,
@@ -89,15 +143,8 @@ cudf::size_type expression_parser::visit(literal const& expr)
     // Handle the trivial case of a literal as the entire expression.
     return visit(operation(ast_operator::IDENTITY, expr));
   } else {
-    _expression_count++;                                           // Increment the expression index
-    auto const data_type     = expr.get_data_type();               // Resolve expression type
-    auto device_view         = expr.get_value();                   // Construct a scalar device view
-    auto const literal_index = cudf::size_type(_literals.size());  // Push literal
-    _literals.push_back(device_view);
-    auto const source = detail::device_data_reference(detail::device_data_reference_type::LITERAL,
-                                                      data_type,
-                                                      literal_index);  // Push data reference
-    return add_data_reference(source);
+    _expression_count++;  // Increment the expression index
+    return add_literal(expr);
   }
 }
 
@@ -135,8 +182,18 @@ cudf::size_type expression_parser::visit(operation const& expr)
 {
   // Increment the expression index
   auto const expression_index = _expression_count++;
+  if (is_constant(expr)) {
+    // An expression of only literals is evaluated as is, since there is nothing to save by
+    // evaluating its subexpressions beforehand.
+    if (expression_index == 0) {
+      _fold_constants = false;
+    } else if (_fold_constants) {
+      return fold_constant(expr);
+    }
+  }
   // Visit children (operands) of this expression
-  auto const operand_data_ref_indices = visit_operands(expr.get_operands());
+  cudf::size_type right_operand_begin{};
+  auto const operand_data_ref_indices = visit_operands(expr.get_operands(), right_operand_begin);
   // Resolve operand types
   auto data_ref = [this](auto const& index) { return _data_references[index].data_type; };
   auto begin    = thrust::make_transform_iterator(operand_data_ref_indices.cbegin(), data_ref);
@@ -149,29 +206,39 @@ cudf::size_type expression_parser::visit(operation const& expr)
     CUDF_FAIL("An AST expression was provided non-matching operand types.");
   }
 
-  // Give back intermediate storage locations that are consumed by this operation
-  std::for_each(
-    operand_data_ref_indices.cbegin(),
-    operand_data_ref_indices.cend(),
-    [this](auto const& data_reference_index) {
-      auto const operand_source = _data_references[data_reference_index];
-      if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
-        auto const intermediate_index = operand_source.data_index;
-        _intermediate_counter.give(intermediate_index);
-      }
-    });
+  // An operation already linearized with the same operands shares its result
+  auto const op = expr.get_operator();
+  auto key      = std::vector<cudf::size_type>{static_cast<cudf::size_type>(op)};
+  key.insert(key.end(), operand_data_ref_indices.cbegin(), operand_data_ref_indices.cend());
+  if (expression_index != 0) {
+    auto const existing = _subexpressions.find(key);
+    if (existing != _subexpressions.end()) { return existing->second; }
+  }
+
   // Resolve expression type
-  auto const op        = expr.get_operator();
-  auto const data_type = cudf::ast::detail::ast_operator_return_type(op, operand_types);
+  auto const data_type      = cudf::ast::detail::ast_operator_return_type(op, operand_types);
+  auto const operator_index = static_cast<cudf::size_type>(_operators.size());
+  // A boolean left operand may determine the result of a logical operator on its own
+  auto const is_logical = op == ast_operator::LOGICAL_AND || op == ast_operator::LOGICAL_OR ||
+                          op == ast_operator::NULL_LOGICAL_AND ||
+                          op == ast_operator::NULL_LOGICAL_OR;
+  if (is_logical && operand_types.front().id() == type_id::BOOL8 &&
+      right_operand_begin < operator_index) {
+    _logical_operators.emplace_back(right_operand_begin, operator_index);
+  }
   _operators.push_back(op);
   // Push data reference
   auto const output = [&]() {
     if (expression_index == 0) {
       // This expression is the root. Output should be directed to the output column.
-      return detail::device_data_reference(
-        detail::device_data_reference_type::COLUMN, data_type, 0, table_reference::OUTPUT);
+      _output_types.push_back(data_type);
+      return detail::device_data_reference(detail::device_data_reference_type::COLUMN,
+                                           data_type,
+                                           _output_index,
+                                           table_reference::OUTPUT);
     } else {
-      // This expression is not the root. Output is an intermediate value.
+      // This expression is not the root. Output is an intermediate value, whose storage location
+      // is assigned by `allocate_intermediates` once all the uses of the value are known.
       // Ensure that the output type is fixed width and fits in the intermediate storage.
       if (!cudf::is_fixed_width(data_type)) {
         CUDF_FAIL(
@@ -185,6 +252,8 @@ cudf::size_type expression_parser::visit(operation const& expr)
     }
   }();
   auto const index = add_data_reference(output);
+  // An output column cannot be read, so only intermediates are shared
+  if (expression_index != 0) { _subexpressions.emplace(std::move(key), index); }
   // Insert source indices from all operands (sources) and this operator (destination)
   _operator_source_indices.insert(_operator_source_indices.end(),
                                   operand_data_ref_indices.cbegin(),
@@ -210,10 +279,12 @@ cudf::data_type expression_parser::output_type() const
 }
 
 std::vector<cudf::size_type> expression_parser::visit_operands(
-  std::vector<std::reference_wrapper<expression const>> operands)
+  std::vector<std::reference_wrapper<expression const>> operands,
+  cudf::size_type& last_operand_begin)
 {
   auto operand_data_reference_indices = std::vector<cudf::size_type>();
   for (auto const& operand : operands) {
+    last_operand_begin = static_cast<cudf::size_type>(_operators.size());
     auto const operand_data_reference_index = operand.get().accept(*this);
     operand_data_reference_indices.push_back(operand_data_reference_index);
   }
@@ -233,6 +304,124 @@ cudf::size_type expression_parser::add_data_reference(detail::device_data_refere
   }
 }
 
+cudf::size_type expression_parser::add_literal(literal const& expr)
+{
+  // The uses of a scalar share its data reference
+  auto const existing = _literal_references.find(&expr.get_scalar());
+  if (existing != _literal_references.end()) { return existing->second; }
+
+  auto const data_type     = expr.get_data_type();               // Resolve expression type
+  auto device_view         = expr.get_value();                   // Construct a scalar device view
+  auto const literal_index = cudf::size_type(_literals.size());  // Push literal
+  _literals.push_back(device_view);
+  auto const source = detail::device_data_reference(detail::device_data_reference_type::LITERAL,
+                                                    data_type,
+                                                    literal_index);  // Push data reference
+  auto const index  = add_data_reference(source);
+  _literal_references.emplace(&expr.get_scalar(), index);
+  return index;
+}
+
+cudf::size_type expression_parser::fold_constant(operation const& expr)
+{
+  // Evaluate the operation on a single row and keep its value as a literal
+  auto const row = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT8},
+                                             1,
+                                             cudf::mask_state::UNALLOCATED,
+                                             _stream,
+                                             rmm::mr::get_current_device_resource());
+  auto const value = cudf::detail::compute_column(
+    cudf::table_view{{row->view()}}, expr, _stream, rmm::mr::get_current_device_resource());
+  _folded_literals.push_back(cudf::detail::get_element(value->view(), 0, _stream, _mr));
+  auto& folded = *_folded_literals.back();
+  return add_literal(cudf::type_dispatcher(folded.type(), literal_factory{}, folded));
+}
+
+void expression_parser::allocate_intermediates()
+{
+  auto const num_operators = static_cast<cudf::size_type>(_operators.size());
+  auto is_intermediate     = [](device_data_reference const& ref) {
+    return ref.reference_type == device_data_reference_type::INTERMEDIATE;
+  };
+
+  // Find the last operator reading each data reference
+  auto last_uses = std::vector<cudf::size_type>(_data_references.size(), -1);
+  for (cudf::size_type op_idx = 0, position = 0; op_idx < num_operators; ++op_idx) {
+    auto const arity = ast_operator_arity(_operators[op_idx]);
+    for (cudf::size_type operand = 0; operand < arity; ++operand) {
+      last_uses[_operator_source_indices[position + operand]] = op_idx;
+    }
+    position += arity + 1;
+  }
+  find_short_circuits(last_uses);
+
+  // Give back the location of an intermediate after its last use, before taking the location of
+  // the output of the operator
+  auto counter   = intermediate_counter{};
+  auto locations = std::vector<cudf::size_type>(_data_references.size(), -1);
+  for (cudf::size_type op_idx = 0, position = 0; op_idx < num_operators; ++op_idx) {
+    auto const arity = ast_operator_arity(_operators[op_idx]);
+    for (cudf::size_type operand = 0; operand < arity; ++operand) {
+      auto const index = _operator_source_indices[position + operand];
+      if (is_intermediate(_data_references[index]) && last_uses[index] == op_idx) {
+        counter.give(locations[index]);
+      }
+    }
+    auto const output = _operator_source_indices[position + arity];
+    if (is_intermediate(_data_references[output])) { locations[output] = counter.take(); }
+    position += arity + 1;
+  }
+
+  // Rebuild the data references with the new locations, merging the intermediates which now share
+  // a location
+  auto const references = std::move(_data_references);
+  _data_references      = std::vector<device_data_reference>{};
+  auto new_indices      = std::vector<cudf::size_type>(references.size());
+  for (std::size_t index = 0; index < references.size(); ++index) {
+    auto const& ref     = references[index];
+    auto const location = is_intermediate(ref) ? locations[index] : ref.data_index;
+    new_indices[index]  = add_data_reference(
+      device_data_reference(ref.reference_type, ref.data_type, location, ref.table_source));
+  }
+  std::transform(_operator_source_indices.cbegin(),
+                 _operator_source_indices.cend(),
+                 _operator_source_indices.begin(),
+                 [&](auto index) { return new_indices[index]; });
+  _intermediate_counter = counter;
+}
+
+void expression_parser::find_short_circuits(std::vector<cudf::size_type> const& last_uses)
+{
+  if (_logical_operators.empty()) { return; }
+  auto const num_operators = static_cast<cudf::size_type>(_operators.size());
+  auto positions           = std::vector<cudf::size_type>(num_operators + 1, 0);
+  for (cudf::size_type op_idx = 0; op_idx < num_operators; ++op_idx) {
+    positions[op_idx + 1] = positions[op_idx] + ast_operator_arity(_operators[op_idx]) + 1;
+  }
+
+  // The right operand may be skipped only if the values it computes are not read after the
+  // logical operator, so that skipping it leaves the rest of the plan unchanged
+  auto short_circuits = std::vector<short_circuit>(num_operators, short_circuit{0, 0});
+  auto found          = false;
+  for (auto const& logical_operator : _logical_operators) {
+    auto const begin      = logical_operator.first;
+    auto const logical_op = logical_operator.second;
+    auto const is_local =
+      std::all_of(thrust::counting_iterator<cudf::size_type>(begin),
+                  thrust::counting_iterator<cudf::size_type>(logical_op),
+                  [&](auto op_idx) {
+                    auto const output = _operator_source_indices[positions[op_idx + 1] - 1];
+                    return last_uses[output] <= logical_op;
+                  });
+    // An enclosing logical operator, parsed later, skips more operators from the same start
+    if (is_local && short_circuits[begin].operator_index < logical_op) {
+      short_circuits[begin] = short_circuit{logical_op, positions[logical_op + 1]};
+      found                 = true;
+    }
+  }
+  if (found) { _short_circuits = std::move(short_circuits); }
+}
+
 }  // namespace detail
 
 }  // namespace ast
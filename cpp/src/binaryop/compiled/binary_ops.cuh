@@ -22,6 +22,9 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vectorized_transform.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -273,6 +276,85 @@ void for_each(rmm::cuda_stream_view stream, cudf::size_type size, Functor f)
   for_each_kernel<<<grid_size, block_size, 0, stream.value()>>>(size, std::forward<Functor&&>(f));
 }
 
+/**
+ * @brief Device functor applying a binary operator to elements of a single type `T`.
+ *
+ * Called with one element, it applies the operator between the element and the scalar operand.
+ */
+template <class BinaryOperator, typename T, typename Out>
+struct vectorized_binary_operation {
+  T const* scalar;     ///< The scalar operand, unused if both operands are columns
+  bool is_lhs_scalar;  ///< Whether the scalar is the left operand
+
+  __device__ inline Out operator()(T const lhs, T const rhs) const
+  {
+    return static_cast<Out>(BinaryOperator{}.template operator()<T, T>(lhs, rhs));
+  }
+
+  __device__ inline Out operator()(T const element) const
+  {
+    return is_lhs_scalar ? (*this)(*scalar, element) : (*this)(element, *scalar);
+  }
+};
+
+/**
+ * @brief Type dispatcher functor evaluating a binary operation with vectorized loads and stores.
+ *
+ * The operands must have the same numeric type, and the output must have either this type or,
+ * for a comparison, the boolean type. Operators depending on the validity of their operands are
+ * not vectorized, since the vectorized transform only writes the output data.
+ */
+template <class BinaryOperator>
+struct vectorized_binary_op_dispatcher {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    if constexpr (!cudf::is_numeric<T>() or !std::is_invocable_v<BinaryOperator, T, T> or
+                  std::is_same_v<BinaryOperator, ops::NullEquals> or
+                  std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
+                  std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
+                  std::is_same_v<BinaryOperator, ops::NullMax> or
+                  std::is_same_v<BinaryOperator, ops::NullMin>) {
+      return false;
+    } else {
+      return is_bool_result<BinaryOperator, T, T>() or
+             std::is_constructible_v<T, std::invoke_result_t<BinaryOperator, T, T>>;
+    }
+  }
+
+  /**
+   * @brief Returns whether the operation was evaluated, or has to be evaluated element by element
+   */
+  template <typename T>
+  bool operator()(mutable_column_view& out,
+                  column_view const& lhs,
+                  column_view const& rhs,
+                  bool is_lhs_scalar,
+                  bool is_rhs_scalar,
+                  rmm::cuda_stream_view stream)
+  {
+    if constexpr (is_supported<T>()) {
+      using Out = std::conditional_t<is_bool_result<BinaryOperator, T, T>(), bool, T>;
+      if (out.type().id() != type_to_id<Out>()) { return false; }
+      auto const op     = vectorized_binary_operation<BinaryOperator, T, Out>{
+        is_lhs_scalar ? lhs.data<T>() : rhs.data<T>(), is_lhs_scalar};
+      auto const output = out.data<Out>();
+      if (is_lhs_scalar or is_rhs_scalar) {
+        auto const input = is_lhs_scalar ? rhs.data<T>() : lhs.data<T>();
+        if (!cudf::detail::can_vectorize(output, input)) { return false; }
+        cudf::detail::vectorized_transform(out.size(), op, stream, output, input);
+      } else {
+        if (!cudf::detail::can_vectorize(output, lhs.data<T>(), rhs.data<T>())) { return false; }
+        cudf::detail::vectorized_transform(
+          out.size(), op, stream, output, lhs.data<T>(), rhs.data<T>());
+      }
+      return true;
+    } else {
+      return false;
+    }
+  }
+};
+
 template <class BinaryOperator>
 void apply_binary_op(mutable_column_view& out,
                      column_view const& lhs,
@@ -281,6 +363,19 @@ void apply_binary_op(mutable_column_view& out,
                      bool is_rhs_scalar,
                      rmm::cuda_stream_view stream)
 {
+  // Operands of the same numeric type are evaluated several elements at a time
+  if (lhs.type() == rhs.type() and !(is_lhs_scalar and is_rhs_scalar) and
+      type_dispatcher(lhs.type(),
+                      vectorized_binary_op_dispatcher<BinaryOperator>{},
+                      out,
+                      lhs,
+                      rhs,
+                      is_lhs_scalar,
+                      is_rhs_scalar,
+                      stream)) {
+    return;
+  }
+
   auto common_dtype = get_common_type(out.type(), lhs.type(), rhs.type());
 
   auto lhsd = column_device_view::create(lhs, stream);
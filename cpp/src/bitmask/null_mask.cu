@@ -195,8 +195,36 @@ CUDF_KERNEL void copy_offset_bitmask(bitmask_type* __restrict__ destination,
                                      size_type source_end_bit,
                                      size_type number_of_mask_words)
 {
+  // Each thread produces four consecutive words with a single 128-bit store, funnel shifting
+  // five source words instead of loading two per destination word. The destination is a fresh
+  // allocation, so it is suitably aligned.
+  constexpr size_type words_per_vector = sizeof(uint4) / sizeof(bitmask_type);
+  auto const number_of_vectors         = number_of_mask_words / words_per_vector;
+  auto const first_source_word         = word_index(source_begin_bit);
+  auto const last_source_word          = word_index(source_end_bit - 1);
+
   auto const stride = cudf::detail::grid_1d::grid_stride();
-  for (thread_index_type destination_word_index = grid_1d::global_thread_id();
+  for (thread_index_type vector_index = grid_1d::global_thread_id();
+       vector_index < number_of_vectors;
+       vector_index += stride) {
+    auto const source_word_index = first_source_word + vector_index * words_per_vector;
+    bitmask_type words[words_per_vector + 1];
+    for (size_type i = 0; i < words_per_vector; ++i) {
+      words[i] = source[source_word_index + i];
+    }
+    words[words_per_vector] = last_source_word >= source_word_index + words_per_vector
+                                ? source[source_word_index + words_per_vector]
+                                : 0;
+    reinterpret_cast<uint4*>(destination)[vector_index] =
+      uint4{__funnelshift_r(words[0], words[1], source_begin_bit),
+            __funnelshift_r(words[1], words[2], source_begin_bit),
+            __funnelshift_r(words[2], words[3], source_begin_bit),
+            __funnelshift_r(words[3], words[4], source_begin_bit)};
+  }
+
+  // the words that do not fill a whole vector
+  for (thread_index_type destination_word_index =
+         number_of_vectors * words_per_vector + grid_1d::global_thread_id();
        destination_word_index < number_of_mask_words;
        destination_word_index += stride) {
     destination[destination_word_index] = detail::get_mask_offset_word(
@@ -219,12 +247,20 @@ rmm::device_buffer copy_bitmask(bitmask_type const* mask,
   rmm::device_buffer dest_mask{};
   auto num_bytes = bitmask_allocation_size_bytes(end_bit - begin_bit);
   if ((mask == nullptr) || (num_bytes == 0)) { return dest_mask; }
-  if (begin_bit == 0) {
-    dest_mask = rmm::device_buffer{static_cast<void const*>(mask), num_bytes, stream, mr};
+  if (intra_word_index(begin_bit) == 0) {
+    // word-aligned ranges need no shifting
+    dest_mask = rmm::device_buffer{num_bytes, stream, mr};
+    CUDF_CUDA_TRY(cudaMemcpyAsync(dest_mask.data(),
+                                  mask + word_index(begin_bit),
+                                  num_bitmask_words(end_bit - begin_bit) * sizeof(bitmask_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
   } else {
     auto number_of_mask_words = num_bitmask_words(end_bit - begin_bit);
     dest_mask                 = rmm::device_buffer{num_bytes, stream, mr};
-    cudf::detail::grid_1d config(number_of_mask_words, 256);
+    auto constexpr words_per_thread = static_cast<size_type>(sizeof(uint4) / sizeof(bitmask_type));
+    cudf::detail::grid_1d config(
+      util::div_rounding_up_safe(number_of_mask_words, words_per_thread), 256);
     copy_offset_bitmask<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
       static_cast<bitmask_type*>(dest_mask.data()), mask, begin_bit, end_bit, number_of_mask_words);
     CUDF_CHECK_CUDA(stream.value());
@@ -443,6 +479,48 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(host_span<bitmask_type cons
     mr);
 }
 
+namespace {
+
+/**
+ * @brief Merges the null masks of `columns` with `op`, skipping the kernel when there are fewer
+ * than two masks to merge.
+ *
+ * @param op The binary operator used to combine the masks
+ * @param columns Columns whose null masks are merged, all of them partially null
+ * @param num_rows Number of rows of the columns
+ * @param empty_state State of the result if `columns` is empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return The merged mask and its null count
+ */
+template <typename Binop>
+std::pair<rmm::device_buffer, size_type> merge_column_masks(Binop op,
+                                                            host_span<column_view const> columns,
+                                                            size_type num_rows,
+                                                            mask_state empty_state,
+                                                            rmm::cuda_stream_view stream,
+                                                            rmm::mr::device_memory_resource* mr)
+{
+  if (columns.empty()) {
+    return std::pair(create_null_mask(num_rows, empty_state, stream, mr),
+                     empty_state == mask_state::ALL_NULL ? num_rows : 0);
+  }
+  if (columns.size() == 1) {
+    auto const& col = columns.front();
+    return std::pair(copy_bitmask(col, stream, mr), col.null_count());
+  }
+
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> offsets;
+  for (auto&& col : columns) {
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+  return cudf::detail::bitmask_binop(op, masks, offsets, num_rows, stream, mr);
+}
+
+}  // namespace
+
 // Returns the bitwise AND of the null masks of all columns in the table view
 std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
                                                      rmm::cuda_stream_view stream,
@@ -454,26 +532,27 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
     return std::pair(std::move(null_mask), 0);
   }
 
-  std::vector<bitmask_type const*> masks;
-  std::vector<size_type> offsets;
-  for (auto&& col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
-    }
+  auto const num_rows = view.num_rows();
+  if (std::none_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); })) {
+    return std::pair(std::move(null_mask), 0);
   }
 
-  if (masks.size() > 0) {
-    return cudf::detail::bitmask_binop(
-      [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
-      masks,
-      offsets,
-      view.num_rows(),
-      stream,
-      mr);
+  // The null counts of the columns tell which masks are all valid or all null without reading
+  // them: all-valid masks do not change the result and a single all-null mask decides it.
+  std::vector<column_view> masked;
+  for (auto&& col : view) {
+    if (col.null_count() == num_rows) {
+      return std::pair(create_null_mask(num_rows, mask_state::ALL_NULL, stream, mr), num_rows);
+    }
+    if (col.null_count() > 0) { masked.push_back(col); }
   }
-
-  return std::pair(std::move(null_mask), 0);
+  return merge_column_masks(
+    [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
+    masked,
+    num_rows,
+    mask_state::ALL_VALID,
+    stream,
+    mr);
 }
 
 // Returns the bitwise OR of the null masks of all columns in the table view
@@ -487,26 +566,27 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
     return std::pair(std::move(null_mask), 0);
   }
 
-  std::vector<bitmask_type const*> masks;
-  std::vector<size_type> offsets;
-  for (auto&& col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
-    }
+  auto const num_rows = view.num_rows();
+  if (not std::all_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); })) {
+    return std::pair(std::move(null_mask), 0);
   }
 
-  if (static_cast<size_type>(masks.size()) == view.num_columns()) {
-    return cudf::detail::bitmask_binop(
-      [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
-      masks,
-      offsets,
-      view.num_rows(),
-      stream,
-      mr);
+  // The null counts of the columns tell which masks are all valid or all null without reading
+  // them: all-null masks do not change the result and a single all-valid mask decides it.
+  std::vector<column_view> masked;
+  for (auto&& col : view) {
+    if (col.null_count() == 0) {
+      return std::pair(create_null_mask(num_rows, mask_state::ALL_VALID, stream, mr), 0);
+    }
+    if (col.null_count() < num_rows) { masked.push_back(col); }
   }
-
-  return std::pair(std::move(null_mask), 0);
+  return merge_column_masks(
+    [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
+    masked,
+    num_rows,
+    mask_state::ALL_NULL,
+    stream,
+    mr);
 }
 
 void set_all_valid_null_masks(column_view const& input,
@@ -34,6 +34,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/block/block_reduce.cuh>
+#include <cub/device/device_memcpy.cuh>
 #include <thrust/advance.h>
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
@@ -480,6 +482,199 @@ void bounds_and_type_check(host_span<column_view const> cols, rmm::cuda_stream_v
   cudf::type_dispatcher(cols.front().type(), traverse_children{}, cols, stream);
 }
 
+/**
+ * @brief Concatenates the null masks of a batch of columns that share the same partitions.
+ *
+ * Each thread builds one output word of one column by shifting in the bits of every partition
+ * the word overlaps, so many tiny partitions cost no more than a few word reads per output word.
+ * A missing source mask reads as all valid.
+ *
+ * @tparam block_size Number of threads in each thread block
+ *
+ * @param source_masks Null mask of partition `p` of column `c` at `c * num_partitions + p`
+ * @param source_begin_bits Offset of each mask of `source_masks`
+ * @param partition_offsets Output row of the first row of each partition, and the total row count
+ * @param num_partitions Number of partitions of every column
+ * @param dest_masks Output null mask of each column
+ * @param num_columns Number of columns
+ * @param out_valid_counts Incremented by the number of valid rows of each column
+ */
+template <size_type block_size>
+CUDF_KERNEL void batched_concatenate_masks_kernel(bitmask_type const* const* source_masks,
+                                                  size_type const* source_begin_bits,
+                                                  size_type const* partition_offsets,
+                                                  size_type num_partitions,
+                                                  bitmask_type* const* dest_masks,
+                                                  size_type num_columns,
+                                                  size_type* out_valid_counts)
+{
+  constexpr size_type word_size_in_bits{detail::size_in_bits<bitmask_type>()};
+  auto const num_rows  = partition_offsets[num_partitions];
+  auto const num_words = num_bitmask_words(num_rows);
+
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+
+  for (auto c = static_cast<size_type>(blockIdx.y); c < num_columns; c += gridDim.y) {
+    auto const* masks      = source_masks + static_cast<std::size_t>(c) * num_partitions;
+    auto const* begin_bits = source_begin_bits + static_cast<std::size_t>(c) * num_partitions;
+    size_type thread_count = 0;
+    auto const stride      = cudf::detail::grid_1d::grid_stride();
+    for (auto w = cudf::detail::grid_1d::global_thread_id(); w < num_words; w += stride) {
+      auto const word_begin = static_cast<size_type>(w) * word_size_in_bits;
+      auto const word_end   = std::min(word_begin + word_size_in_bits, num_rows);
+      // the partition holding the first bit of the word
+      auto p = static_cast<size_type>(
+        thrust::upper_bound(
+          thrust::seq, partition_offsets, partition_offsets + num_partitions, word_begin) -
+        partition_offsets - 1);
+      bitmask_type word = 0;
+      for (auto bit = word_begin; bit < word_end; ++p) {
+        auto const num_bits = std::min(word_end, partition_offsets[p + 1]) - bit;
+        if (num_bits == 0) { continue; }
+        auto bits = ~bitmask_type{0};
+        if (masks[p] != nullptr) {
+          auto const source_bit  = begin_bits[p] + (bit - partition_offsets[p]);
+          auto const first_word  = word_index(source_bit);
+          auto const last_word   = word_index(source_bit + num_bits - 1);
+          auto const next_source = last_word > first_word ? masks[p][last_word] : 0;
+          bits = __funnelshift_r(masks[p][first_word], next_source, source_bit);
+        }
+        if (num_bits < word_size_in_bits) { bits &= set_least_significant_bits(num_bits); }
+        word |= bits << (bit - word_begin);
+        bit += num_bits;
+      }
+      dest_masks[c][w] = word;
+      thread_count += __popc(word);
+    }
+    auto const block_count = BlockReduce(temp_storage).Sum(thread_count);
+    if (threadIdx.x == 0) { atomicAdd(out_valid_counts + c, block_count); }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Concatenates the fixed-width columns `columns` of `tables` together.
+ *
+ * The partition offsets are computed once for all the columns, the data of every partition of
+ * every column is copied with a single batched memcpy and the null masks of all the nullable
+ * columns are merged by a single kernel, followed by one synchronization for their null counts.
+ *
+ * @param tables Tables to concatenate
+ * @param columns Indices of the fixed-width, non-dictionary columns to concatenate
+ * @param results Concatenated columns, stored at their index
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ */
+void batched_concatenate_fixed_width(host_span<table_view const> tables,
+                                     host_span<size_type const> columns,
+                                     std::vector<std::unique_ptr<column>>& results,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  auto const num_partitions = static_cast<size_type>(tables.size());
+  std::vector<size_type> partition_offsets(num_partitions + 1, 0);
+  std::transform_inclusive_scan(tables.begin(),
+                                tables.end(),
+                                std::next(partition_offsets.begin()),
+                                std::plus{},
+                                [](auto const& t) { return t.num_rows(); });
+  auto const num_rows = partition_offsets.back();
+  if (num_rows == 0) {
+    for (auto const i : columns) {
+      results[i] = empty_like(tables.front().column(i));
+    }
+    return;
+  }
+
+  std::vector<void const*> sources;
+  std::vector<void*> destinations;
+  std::vector<std::size_t> sizes;
+  std::vector<bitmask_type const*> source_masks;
+  std::vector<size_type> source_begin_bits;
+  std::vector<bitmask_type*> dest_masks;
+  std::vector<size_type> nullable_columns;
+  for (auto const i : columns) {
+    auto const& first    = tables.front().column(i);
+    bool const has_nulls = std::any_of(
+      tables.begin(), tables.end(), [i](auto const& t) { return t.column(i).has_nulls(); });
+    auto const policy = has_nulls ? mask_allocation_policy::ALWAYS : mask_allocation_policy::NEVER;
+    auto out          = detail::allocate_like(first, num_rows, policy, stream, mr);
+
+    auto const element_size = size_of(first.type());
+    auto* out_data          = static_cast<uint8_t*>(out->mutable_view().head());
+    for (size_type p = 0; p < num_partitions; ++p) {
+      auto const& col = tables[p].column(i);
+      if (col.is_empty()) { continue; }
+      sources.push_back(static_cast<uint8_t const*>(col.head()) + col.offset() * element_size);
+      destinations.push_back(out_data + partition_offsets[p] * element_size);
+      sizes.push_back(col.size() * element_size);
+    }
+    if (has_nulls) {
+      for (size_type p = 0; p < num_partitions; ++p) {
+        auto const& col = tables[p].column(i);
+        source_masks.push_back(col.nullable() ? col.null_mask() : nullptr);
+        source_begin_bits.push_back(col.offset());
+      }
+      dest_masks.push_back(out->mutable_view().null_mask());
+      nullable_columns.push_back(i);
+    } else {
+      out->set_null_count(0);
+    }
+    results[i] = std::move(out);
+  }
+
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  if (not sources.empty()) {
+    auto const d_sources      = make_device_uvector_async(sources, stream, temp_mr);
+    auto const d_destinations = make_device_uvector_async(destinations, stream, temp_mr);
+    auto const d_sizes        = make_device_uvector_async(sizes, stream, temp_mr);
+    auto const num_buffers    = static_cast<uint32_t>(sources.size());
+    std::size_t temp_size     = 0;
+    CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(nullptr,
+                                             temp_size,
+                                             d_sources.begin(),
+                                             d_destinations.begin(),
+                                             d_sizes.begin(),
+                                             num_buffers,
+                                             stream.value()));
+    rmm::device_buffer temp(temp_size, stream, temp_mr);
+    CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(temp.data(),
+                                             temp_size,
+                                             d_sources.begin(),
+                                             d_destinations.begin(),
+                                             d_sizes.begin(),
+                                             num_buffers,
+                                             stream.value()));
+  }
+
+  if (nullable_columns.empty()) { return; }
+  auto const num_nullable   = static_cast<size_type>(nullable_columns.size());
+  auto const d_source_masks = make_device_uvector_async(source_masks, stream, temp_mr);
+  auto const d_begin_bits   = make_device_uvector_async(source_begin_bits, stream, temp_mr);
+  auto const d_offsets      = make_device_uvector_async(partition_offsets, stream, temp_mr);
+  auto const d_dest_masks   = make_device_uvector_async(dest_masks, stream, temp_mr);
+  auto d_valid_counts =
+    make_zeroed_device_uvector_async<size_type>(num_nullable, stream, temp_mr);
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d const config(num_bitmask_words(num_rows), block_size);
+  dim3 const grid(config.num_blocks, std::min(num_nullable, size_type{65535}));
+  batched_concatenate_masks_kernel<block_size><<<grid, block_size, 0, stream.value()>>>(
+    d_source_masks.data(),
+    d_begin_bits.data(),
+    d_offsets.data(),
+    num_partitions,
+    d_dest_masks.data(),
+    num_nullable,
+    d_valid_counts.data());
+  CUDF_CHECK_CUDA(stream.value());
+
+  auto const valid_counts = make_std_vector_sync(d_valid_counts, stream);
+  for (size_type c = 0; c < num_nullable; ++c) {
+    results[nullable_columns[c]]->set_null_count(num_rows - valid_counts[c]);
+  }
+}
+
 }  // anonymous namespace
 
 // Concatenates the elements from a vector of column_views
@@ -516,7 +711,8 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
                            }),
                "Mismatch in table columns to concatenate.");
 
-  std::vector<std::unique_ptr<column>> concat_columns;
+  std::vector<std::unique_ptr<column>> concat_columns(first_table.num_columns());
+  std::vector<size_type> fixed_width_columns;
   for (size_type i = 0; i < first_table.num_columns(); ++i) {
     std::vector<column_view> cols;
     std::transform(tables_to_concat.begin(),
@@ -526,7 +722,17 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
 
     // verify all types match and that we won't overflow size_type in output size
     bounds_and_type_check(cols, stream);
-    concat_columns.emplace_back(detail::concatenate(cols, stream, mr));
+    auto const type = first_table.column(i).type();
+    if (is_fixed_width(type) and type.id() != type_id::DICTIONARY32) {
+      fixed_width_columns.push_back(i);
+    } else {
+      concat_columns[i] = detail::concatenate(cols, stream, mr);
+    }
+  }
+  // the fixed-width columns share their partition offsets, data copies and null mask kernel
+  if (not fixed_width_columns.empty()) {
+    batched_concatenate_fixed_width(
+      tables_to_concat, fixed_width_columns, concat_columns, stream, mr);
   }
   return std::make_unique<table>(std::move(concat_columns));
 }
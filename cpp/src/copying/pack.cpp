@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,8 +18,10 @@
 #include <cudf/detail/contiguous_split.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 
 namespace cudf {
 namespace detail {
@@ -301,4 +303,57 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
   return detail::unpack(metadata, gpu_data);
 }
 
+chunked_unpack::chunked_unpack(std::unique_ptr<std::vector<uint8_t>> metadata,
+                               std::size_t total_contiguous_size,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _metadata{std::move(metadata)},
+    _data{std::make_unique<rmm::device_buffer>(total_contiguous_size, stream, mr)},
+    _stream{stream}
+{
+  CUDF_EXPECTS(_metadata != nullptr, "The metadata of the packed table is required");
+}
+
+std::size_t chunked_unpack::get_total_contiguous_size() const { return _data->size(); }
+
+bool chunked_unpack::has_next() const { return _offset < _data->size(); }
+
+void chunked_unpack::next(cudf::device_span<uint8_t const> chunk)
+{
+  copy_next(chunk.data(), chunk.size());
+}
+
+void chunked_unpack::next(cudf::host_span<uint8_t const> chunk)
+{
+  copy_next(chunk.data(), chunk.size());
+}
+
+void chunked_unpack::copy_next(void const* src, std::size_t size)
+{
+  CUDF_EXPECTS(size <= _data->size() - _offset, "The chunk exceeds the size of the packed data");
+  if (size == 0) { return; }
+  CUDF_CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t*>(_data->data()) + _offset,
+                                src,
+                                size,
+                                cudaMemcpyDefault,
+                                _stream.value()));
+  _offset += size;
+}
+
+packed_columns chunked_unpack::finish()
+{
+  CUDF_EXPECTS(!has_next(), "Not all the chunks of the packed data have been copied");
+  return packed_columns{std::move(_metadata), std::move(_data)};
+}
+
+std::unique_ptr<chunked_unpack> chunked_unpack::create(
+  std::unique_ptr<std::vector<uint8_t>> metadata,
+  std::size_t total_contiguous_size,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return std::make_unique<chunked_unpack>(
+    std::move(metadata), total_contiguous_size, stream, mr);
+}
+
 }  // namespace cudf
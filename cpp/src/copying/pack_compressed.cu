@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/comp/gpuinflate.hpp"
+#include "io/comp/nvcomp_adapter.hpp"
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_memcpy.cuh>
+#include <thrust/logical.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Size in bytes of the blocks the packed data is compressed in.
+ */
+constexpr std::size_t compressed_pack_block_size = 64 * 1024;
+
+/**
+ * @brief Header of the host metadata of `compressed_packed_columns`.
+ *
+ * The header is followed by `metadata_size` bytes of packed table metadata and by
+ * `num_blocks` `compressed_pack_block`s.
+ */
+struct compressed_pack_header {
+  int32_t compression;         ///< The `io::compression_type` of the blocks
+  uint64_t uncompressed_size;  ///< Size of the packed data
+  uint64_t block_size;         ///< Uncompressed size of every block but the last
+  uint64_t num_blocks;         ///< Number of blocks
+  uint64_t metadata_size;      ///< Size of the packed table metadata
+};
+
+/**
+ * @brief Location of a block of packed data in the device buffer of `compressed_packed_columns`.
+ */
+struct compressed_pack_block {
+  uint64_t offset;      ///< Offset of the block in the device buffer
+  uint64_t size;        ///< Size of the block in the device buffer
+  uint64_t compressed;  ///< Whether the block is compressed, or stored as is
+};
+
+/**
+ * @brief Returns the nvCOMP codec of `compression`, or nothing for no compression.
+ */
+std::optional<io::nvcomp::compression_type> to_nvcomp_compression(
+  io::compression_type compression)
+{
+  switch (compression) {
+    case io::compression_type::NONE: return std::nullopt;
+    case io::compression_type::SNAPPY: return io::nvcomp::compression_type::SNAPPY;
+    case io::compression_type::LZ4: return io::nvcomp::compression_type::LZ4;
+    case io::compression_type::ZSTD: return io::nvcomp::compression_type::ZSTD;
+    default: CUDF_FAIL("Unsupported compression type for packed data", std::invalid_argument);
+  }
+}
+
+/**
+ * @brief Copies each of the `sources` buffers to the matching `destinations` buffer.
+ */
+void batched_copy(std::vector<void const*> const& sources,
+                  std::vector<void*> const& destinations,
+                  std::vector<std::size_t> const& sizes,
+                  rmm::cuda_stream_view stream)
+{
+  if (sources.empty()) { return; }
+  auto const mr             = rmm::mr::get_current_device_resource();
+  auto const d_sources      = cudf::detail::make_device_uvector_async(sources, stream, mr);
+  auto const d_destinations = cudf::detail::make_device_uvector_async(destinations, stream, mr);
+  auto const d_sizes        = cudf::detail::make_device_uvector_async(sizes, stream, mr);
+  auto const num_buffers    = static_cast<uint32_t>(sources.size());
+
+  std::size_t temp_size = 0;
+  CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(nullptr,
+                                           temp_size,
+                                           d_sources.begin(),
+                                           d_destinations.begin(),
+                                           d_sizes.begin(),
+                                           num_buffers,
+                                           stream.value()));
+  rmm::device_buffer temp(temp_size, stream);
+  CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(temp.data(),
+                                           temp_size,
+                                           d_sources.begin(),
+                                           d_destinations.begin(),
+                                           d_sizes.begin(),
+                                           num_buffers,
+                                           stream.value()));
+}
+
+}  // namespace
+
+std::vector<compressed_packed_columns> compress_packed(host_span<packed_columns const> inputs,
+                                                       io::compression_type compression,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  auto const codec = to_nvcomp_compression(compression);
+  if (codec.has_value()) {
+    if (auto const reason = io::nvcomp::is_compression_disabled(*codec); reason) {
+      CUDF_FAIL("Compression error: " + reason.value());
+    }
+  }
+
+  auto const block_size =
+    codec.has_value()
+      ? std::min(compressed_pack_block_size,
+                 io::nvcomp::compress_max_allowed_chunk_size(*codec).value_or(
+                   compressed_pack_block_size))
+      : compressed_pack_block_size;
+  // compressed blocks are stored at offsets aligned for nvCOMP, both in the scratch space and in
+  // the output
+  auto const alignment = codec.has_value()
+                           ? std::max<std::size_t>(
+                               io::nvcomp::compress_output_alignment_bits(*codec) / 8, 8)
+                           : std::size_t{8};
+  auto const max_compressed_size =
+    codec.has_value() ? io::nvcomp::compress_max_output_chunk_size(*codec, block_size) : 0;
+  auto const scratch_stride = cudf::util::round_up_safe(max_compressed_size, alignment);
+
+  auto const data_size = [](packed_columns const& input) {
+    return input.gpu_data ? input.gpu_data->size() : std::size_t{0};
+  };
+  std::size_t num_blocks = 0;
+  for (auto const& input : inputs) {
+    num_blocks += cudf::util::div_rounding_up_safe(data_size(input), block_size);
+  }
+
+  // compress the blocks of all the inputs in a single batch
+  rmm::device_buffer scratch(codec.has_value() ? num_blocks * scratch_stride : 0, stream);
+  std::vector<device_span<uint8_t const>> uncompressed_blocks;
+  std::vector<device_span<uint8_t>> compressed_blocks;
+  uncompressed_blocks.reserve(num_blocks);
+  compressed_blocks.reserve(num_blocks);
+  for (auto const& input : inputs) {
+    auto const size = data_size(input);
+    auto const data = size > 0 ? static_cast<uint8_t const*>(input.gpu_data->data()) : nullptr;
+    for (std::size_t offset = 0; offset < size; offset += block_size) {
+      uncompressed_blocks.emplace_back(data + offset, std::min(block_size, size - offset));
+      if (codec.has_value()) {
+        compressed_blocks.emplace_back(
+          static_cast<uint8_t*>(scratch.data()) + compressed_blocks.size() * scratch_stride,
+          max_compressed_size);
+      }
+    }
+  }
+
+  std::vector<io::compression_result> results;
+  if (codec.has_value() && num_blocks > 0) {
+    auto const d_uncompressed_blocks = cudf::detail::make_device_uvector_async(
+      uncompressed_blocks, stream, rmm::mr::get_current_device_resource());
+    auto const d_compressed_blocks = cudf::detail::make_device_uvector_async(
+      compressed_blocks, stream, rmm::mr::get_current_device_resource());
+    rmm::device_uvector<io::compression_result> d_results(num_blocks, stream);
+    io::nvcomp::batched_compress(
+      *codec, d_uncompressed_blocks, d_compressed_blocks, d_results, stream);
+    results = cudf::detail::make_std_vector_sync<io::compression_result>(d_results, stream);
+  }
+
+  // lay out the blocks of each output, keeping the blocks that did not shrink uncompressed
+  std::vector<compressed_packed_columns> outputs;
+  outputs.reserve(inputs.size());
+  std::vector<void const*> sources;
+  std::vector<void*> destinations;
+  std::vector<std::size_t> sizes;
+  std::size_t block = 0;
+  for (auto const& input : inputs) {
+    auto const size                = data_size(input);
+    auto const input_blocks        = cudf::util::div_rounding_up_safe(size, block_size);
+    auto const input_metadata_size = input.metadata ? input.metadata->size() : std::size_t{0};
+
+    std::vector<compressed_pack_block> layout(input_blocks);
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < input_blocks; ++i) {
+      auto const uncompressed_size = uncompressed_blocks[block + i].size();
+      bool const compressed        = !results.empty() &&
+                              results[block + i].status == io::compression_status::SUCCESS &&
+                              results[block + i].bytes_written < uncompressed_size;
+      layout[i].offset     = cudf::util::round_up_safe(offset, alignment);
+      layout[i].size       = compressed ? results[block + i].bytes_written : uncompressed_size;
+      layout[i].compressed = compressed;
+      offset               = layout[i].offset + layout[i].size;
+    }
+
+    auto metadata = std::make_unique<std::vector<uint8_t>>(
+      sizeof(compressed_pack_header) + input_metadata_size +
+      input_blocks * sizeof(compressed_pack_block));
+    compressed_pack_header const header{static_cast<int32_t>(compression),
+                                        size,
+                                        block_size,
+                                        input_blocks,
+                                        input_metadata_size};
+    std::memcpy(metadata->data(), &header, sizeof(header));
+    if (input_metadata_size > 0) {
+      std::memcpy(
+        metadata->data() + sizeof(header), input.metadata->data(), input_metadata_size);
+    }
+    if (input_blocks > 0) {
+      std::memcpy(metadata->data() + sizeof(header) + input_metadata_size,
+                  layout.data(),
+                  input_blocks * sizeof(compressed_pack_block));
+    }
+
+    auto gpu_data = std::make_unique<rmm::device_buffer>(offset, stream, mr);
+    for (std::size_t i = 0; i < input_blocks; ++i) {
+      sources.push_back(layout[i].compressed ? compressed_blocks[block + i].data()
+                                             : uncompressed_blocks[block + i].data());
+      destinations.push_back(static_cast<uint8_t*>(gpu_data->data()) + layout[i].offset);
+      sizes.push_back(layout[i].size);
+    }
+    block += input_blocks;
+    outputs.emplace_back(std::move(metadata), std::move(gpu_data));
+  }
+  batched_copy(sources, destinations, sizes, stream);
+  return outputs;
+}
+
+std::vector<compressed_packed_columns> contiguous_split_compressed(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  io::compression_type compression,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  // fail on an unsupported codec before splitting
+  to_nvcomp_compression(compression);
+  auto partitions =
+    contiguous_split(input, splits, stream, rmm::mr::get_current_device_resource());
+  std::vector<packed_columns> packed;
+  packed.reserve(partitions.size());
+  std::transform(partitions.begin(),
+                 partitions.end(),
+                 std::back_inserter(packed),
+                 [](auto& partition) { return std::move(partition.data); });
+  return compress_packed(packed, compression, stream, mr);
+}
+
+packed_columns decompress_packed(compressed_packed_columns const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(
+    input.metadata != nullptr && input.metadata->size() >= sizeof(compressed_pack_header),
+    "Malformed compressed packed metadata");
+  compressed_pack_header header;
+  std::memcpy(&header, input.metadata->data(), sizeof(header));
+  auto const layout_offset = sizeof(header) + header.metadata_size;
+  CUDF_EXPECTS(input.metadata->size() ==
+                 layout_offset + header.num_blocks * sizeof(compressed_pack_block),
+               "Malformed compressed packed metadata");
+  std::vector<compressed_pack_block> layout(header.num_blocks);
+  if (header.num_blocks > 0) {
+    std::memcpy(layout.data(),
+                input.metadata->data() + layout_offset,
+                header.num_blocks * sizeof(compressed_pack_block));
+  }
+
+  auto metadata = std::make_unique<std::vector<uint8_t>>(
+    input.metadata->begin() + sizeof(header), input.metadata->begin() + layout_offset);
+  auto gpu_data = std::make_unique<rmm::device_buffer>(header.uncompressed_size, stream, mr);
+
+  // blocks stored as is are copied, the others are decompressed in a single batch
+  std::vector<void const*> sources;
+  std::vector<void*> destinations;
+  std::vector<std::size_t> sizes;
+  std::vector<device_span<uint8_t const>> compressed_blocks;
+  std::vector<device_span<uint8_t>> decompressed_blocks;
+  auto const src_size = input.gpu_data ? input.gpu_data->size() : std::size_t{0};
+  auto const src =
+    src_size > 0 ? static_cast<uint8_t const*>(input.gpu_data->data()) : nullptr;
+  auto const dst = static_cast<uint8_t*>(gpu_data->data());
+  for (std::size_t i = 0; i < header.num_blocks; ++i) {
+    auto const offset = i * header.block_size;
+    auto const size   = std::min<std::size_t>(header.block_size, header.uncompressed_size - offset);
+    CUDF_EXPECTS(layout[i].offset + layout[i].size <= src_size,
+                 "Malformed compressed packed metadata");
+    if (layout[i].compressed) {
+      compressed_blocks.emplace_back(src + layout[i].offset, layout[i].size);
+      decompressed_blocks.emplace_back(dst + offset, size);
+    } else {
+      sources.push_back(src + layout[i].offset);
+      destinations.push_back(dst + offset);
+      sizes.push_back(size);
+    }
+  }
+  batched_copy(sources, destinations, sizes, stream);
+
+  if (!compressed_blocks.empty()) {
+    auto const codec =
+      to_nvcomp_compression(static_cast<io::compression_type>(header.compression));
+    CUDF_EXPECTS(codec.has_value(), "Malformed compressed packed metadata");
+    if (auto const reason = io::nvcomp::is_decompression_disabled(*codec); reason) {
+      CUDF_FAIL("Decompression error: " + reason.value());
+    }
+    auto const d_compressed_blocks = cudf::detail::make_device_uvector_async(
+      compressed_blocks, stream, rmm::mr::get_current_device_resource());
+    auto const d_decompressed_blocks = cudf::detail::make_device_uvector_async(
+      decompressed_blocks, stream, rmm::mr::get_current_device_resource());
+    rmm::device_uvector<io::compression_result> d_results(compressed_blocks.size(), stream);
+    io::nvcomp::batched_decompress(*codec,
+                                   d_compressed_blocks,
+                                   d_decompressed_blocks,
+                                   d_results,
+                                   header.block_size,
+                                   header.uncompressed_size,
+                                   stream);
+    CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                                d_results.begin(),
+                                d_results.end(),
+                                [] __device__(io::compression_result const& result) {
+                                  return result.status == io::compression_status::SUCCESS;
+                                }),
+                 "Error during decompression of packed data");
+  }
+
+  return packed_columns{std::move(metadata), std::move(gpu_data)};
+}
+
+}  // namespace detail
+
+std::vector<compressed_packed_columns> contiguous_split_compressed(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  io::compression_type compression,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contiguous_split_compressed(
+    input, splits, compression, cudf::get_default_stream(), mr);
+}
+
+compressed_packed_columns compress_packed(packed_columns const& input,
+                                          io::compression_type compression,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto outputs = detail::compress_packed(
+    host_span<packed_columns const>(&input, 1), compression, cudf::get_default_stream(), mr);
+  return std::move(outputs.front());
+}
+
+packed_columns decompress_packed(compressed_packed_columns const& input,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decompress_packed(input, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
@@ -89,8 +89,11 @@ std::unique_ptr<column> purge_nonempty_nulls(column_view const& input,
                                              rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource* mr)
 {
-  // If not compound types (LIST/STRING/STRUCT/DICTIONARY) then just copy the input into output.
-  if (!cudf::is_compound(input.type())) { return std::make_unique<column>(input, stream, mr); }
+  // If not compound types (LIST/STRING/STRUCT/DICTIONARY), or if there is nothing to purge, then
+  // just copy the input into output; the check only scans the levels that have nulls.
+  if (!cudf::is_compound(input.type()) || !has_nonempty_nulls(input, stream)) {
+    return std::make_unique<column>(input, stream, mr);
+  }
 
   // Implement via identity gather.
   auto gathered_table = cudf::detail::gather(table_view{{input}},
@@ -102,6 +105,14 @@ std::unique_ptr<column> purge_nonempty_nulls(column_view const& input,
   return std::move(gathered_table->release().front());
 }
 
+std::unique_ptr<column> purge_nonempty_nulls(std::unique_ptr<column> input,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  if (!has_nonempty_nulls(input->view(), stream)) { return input; }
+  return purge_nonempty_nulls(input->view(), stream, mr);
+}
+
 }  // namespace detail
 
 /**
@@ -141,4 +152,16 @@ std::unique_ptr<cudf::column> purge_nonempty_nulls(column_view const& input,
   return detail::purge_nonempty_nulls(input, stream, mr);
 }
 
+/**
+ * @copydoc cudf::purge_nonempty_nulls(std::unique_ptr<column>, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::column> purge_nonempty_nulls(std::unique_ptr<column> input,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input != nullptr, "Cannot purge a null column", std::invalid_argument);
+  return detail::purge_nonempty_nulls(std::move(input), stream, mr);
+}
+
 }  // namespace cudf
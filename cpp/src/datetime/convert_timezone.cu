@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/timezone.cuh>
+#include <cudf/detail/timezone.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/timezone.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Converts a local time of one timezone to the local time of another timezone
+ */
+template <typename Timestamp>
+struct convert_timezone_fn {
+  table_device_view from_table;
+  table_device_view to_table;
+
+  __device__ Timestamp operator()(Timestamp ts) const
+  {
+    using Duration = typename Timestamp::duration;
+
+    // The transition times are UTC; the offset at the local time read as UTC is close enough to
+    // find the UTC time, whose offset is then the one in effect
+    auto const to_seconds = [](Timestamp t) {
+      return timestamp_s{cuda::std::chrono::floor<duration_s>(t.time_since_epoch())};
+    };
+    auto const local_s     = to_seconds(ts);
+    auto const utc_guess   = local_s - get_ut_offset(from_table, local_s);
+    auto const from_offset = get_ut_offset(from_table, utc_guess);
+    auto const utc         = ts - cuda::std::chrono::duration_cast<Duration>(from_offset);
+    auto const to_offset   = get_ut_offset(to_table, to_seconds(utc));
+    return utc + cuda::std::chrono::duration_cast<Duration>(to_offset);
+  }
+};
+
+struct dispatch_convert_timezone_fn {
+  template <typename Timestamp, typename... Args>
+  std::enable_if_t<not cudf::is_timestamp<Timestamp>(), std::unique_ptr<column>> operator()(
+    Args&&...) const
+  {
+    CUDF_FAIL("Column type should be timestamp");
+  }
+
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp<Timestamp>(), std::unique_ptr<column>> operator()(
+    column_view const& timestamps,
+    table_device_view from_table,
+    table_device_view to_table,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(not std::is_same_v<Timestamp, timestamp_D>,
+                 "Timezone conversion requires timestamps with a time of day");
+
+    auto output = make_fixed_width_column(timestamps.type(),
+                                          timestamps.size(),
+                                          cudf::detail::copy_bitmask(timestamps, stream, mr),
+                                          timestamps.null_count(),
+                                          stream,
+                                          mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      timestamps.begin<Timestamp>(),
+                      timestamps.end<Timestamp>(),
+                      output->mutable_view().begin<Timestamp>(),
+                      convert_timezone_fn<Timestamp>{from_table, to_table});
+    return output;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::optional<std::string_view> tzif_dir,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(timestamps.type()), "Column type should be timestamp");
+  if (timestamps.is_empty()) { return make_empty_column(timestamps.type()); }
+
+  auto const temp_mr    = rmm::mr::get_current_device_resource();
+  auto const from_table = make_timezone_transition_table(tzif_dir, from_timezone, stream, temp_mr);
+  auto const to_table   = make_timezone_transition_table(tzif_dir, to_timezone, stream, temp_mr);
+  auto const d_from     = table_device_view::create(from_table->view(), stream);
+  auto const d_to       = table_device_view::create(to_table->view(), stream);
+
+  return type_dispatcher(
+    timestamps.type(), dispatch_convert_timezone_fn{}, timestamps, *d_from, *d_to, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::optional<std::string_view> tzif_dir,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(
+    timestamps, tzif_dir, from_timezone, to_timezone, cudf::get_default_stream(), mr);
+}
+
+std::unique_ptr<column> to_local_time(column_view const& timestamps,
+                                      std::optional<std::string_view> tzif_dir,
+                                      std::string_view timezone_name,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(
+    timestamps, tzif_dir, "UTC", timezone_name, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
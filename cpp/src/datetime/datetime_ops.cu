@@ -24,11 +24,13 @@
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/wrappers/durations.hpp>
@@ -36,80 +38,78 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/transform.h>
 
 namespace cudf {
 namespace datetime {
 namespace detail {
-enum class datetime_component {
-  INVALID = 0,
-  YEAR,
-  MONTH,
-  DAY,
-  WEEKDAY,
-  HOUR,
-  MINUTE,
-  SECOND,
-  MILLISECOND,
-  MICROSECOND,
-  NANOSECOND
-};
-
 enum class rounding_function {
   CEIL,   ///< Rounds up to the next integer multiple of the provided frequency
   FLOOR,  ///< Rounds down to the next integer multiple of the provided frequency
   ROUND   ///< Rounds to the nearest integer multiple of the provided frequency
 };
 
+/**
+ * @brief Extracts a component from a timestamp, given its calendar date for the date components
+ */
+template <typename Timestamp>
+__device__ inline int16_t extract_component(datetime_component component,
+                                            Timestamp const ts,
+                                            civil_date const& date)
+{
+  using namespace cuda::std::chrono;
+
+  auto const days_since_epoch = floor<days>(ts);
+
+  auto time_since_midnight = ts - days_since_epoch;
+
+  if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+  switch (component) {
+    case datetime_component::YEAR: return date.year;
+    case datetime_component::MONTH: return date.month;
+    case datetime_component::DAY: return date.day;
+    case datetime_component::WEEKDAY: return weekday(days_since_epoch).iso_encoding();
+    case datetime_component::HOUR: return duration_cast<hours>(time_since_midnight).count();
+    case datetime_component::MINUTE:
+      return (duration_cast<minutes>(time_since_midnight) % hours(1)).count();
+    case datetime_component::SECOND:
+      return (duration_cast<seconds>(time_since_midnight) % minutes(1)).count();
+    case datetime_component::MILLISECOND:
+      return (duration_cast<milliseconds>(time_since_midnight) % seconds(1)).count();
+    case datetime_component::MICROSECOND:
+      return (duration_cast<microseconds>(time_since_midnight) % milliseconds(1)).count();
+    case datetime_component::NANOSECOND:
+      return (duration_cast<nanoseconds>(time_since_midnight) % microseconds(1)).count();
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Returns the calendar date of a timestamp
+ */
+template <typename Timestamp>
+__device__ inline civil_date to_civil_date(Timestamp const ts)
+{
+  return civil_from_days(cuda::std::chrono::floor<cuda::std::chrono::days>(ts)
+                           .time_since_epoch()
+                           .count());
+}
+
 template <datetime_component Component>
 struct extract_component_operator {
   template <typename Timestamp>
   __device__ inline int16_t operator()(Timestamp const ts) const
   {
-    using namespace cuda::std::chrono;
-
-    auto days_since_epoch = floor<days>(ts);
-
-    auto time_since_midnight = ts - days_since_epoch;
-
-    if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
-
-    auto const hrs_  = [&] { return duration_cast<hours>(time_since_midnight); };
-    auto const mins_ = [&] { return duration_cast<minutes>(time_since_midnight) - hrs_(); };
-    auto const secs_ = [&] {
-      return duration_cast<seconds>(time_since_midnight) - hrs_() - mins_();
-    };
-    auto const millisecs_ = [&] {
-      return duration_cast<milliseconds>(time_since_midnight) - hrs_() - mins_() - secs_();
-    };
-    auto const microsecs_ = [&] {
-      return duration_cast<microseconds>(time_since_midnight) - hrs_() - mins_() - secs_() -
-             millisecs_();
-    };
-    auto const nanosecs_ = [&] {
-      return duration_cast<nanoseconds>(time_since_midnight) - hrs_() - mins_() - secs_() -
-             millisecs_() - microsecs_();
-    };
-
-    switch (Component) {
-      case datetime_component::YEAR:
-        return static_cast<int>(year_month_day(days_since_epoch).year());
-      case datetime_component::MONTH:
-        return static_cast<unsigned>(year_month_day(days_since_epoch).month());
-      case datetime_component::DAY:
-        return static_cast<unsigned>(year_month_day(days_since_epoch).day());
-      case datetime_component::WEEKDAY:
-        return year_month_weekday(days_since_epoch).weekday().iso_encoding();
-      case datetime_component::HOUR: return hrs_().count();
-      case datetime_component::MINUTE: return mins_().count();
-      case datetime_component::SECOND: return secs_().count();
-      case datetime_component::MILLISECOND: return millisecs_().count();
-      case datetime_component::MICROSECOND: return microsecs_().count();
-      case datetime_component::NANOSECOND: return nanosecs_().count();
-      default: return 0;
-    }
+    constexpr bool is_date_component = Component == datetime_component::YEAR ||
+                                       Component == datetime_component::MONTH ||
+                                       Component == datetime_component::DAY;
+    auto const date = is_date_component ? to_civil_date(ts) : civil_date{};
+    return extract_component(Component, ts, date);
   }
 };
 
@@ -206,14 +206,8 @@ struct extract_day_num_of_year {
   template <typename Timestamp>
   __device__ inline int16_t operator()(Timestamp const ts) const
   {
-    using namespace cuda::std::chrono;
-
-    // Only has the days - time component is chopped off, which is what we want
-    auto const days_since_epoch = floor<days>(ts);
-    auto const date             = year_month_day(days_since_epoch);
-
-    return days_until_month[date.year().is_leap()][unsigned{date.month()} - 1] +
-           unsigned{date.day()};
+    auto const date = to_civil_date(ts);
+    return days_until_month[is_leap(date.year)][date.month - 1] + date.day;
   }
 };
 
@@ -222,12 +216,7 @@ struct extract_quarter_op {
   template <typename Timestamp>
   __device__ inline int16_t operator()(Timestamp const ts) const
   {
-    using namespace cuda::std::chrono;
-
-    // Only has the days - time component is chopped off, which is what we want
-    auto const days_since_epoch = floor<days>(ts);
-    auto const date             = year_month_day(days_since_epoch);
-    auto const month            = unsigned{date.month()};
+    auto const month = to_civil_date(ts).month;
 
     // (x + y - 1) / y = ceil(x/y), where x and y are unsigned. x = month, y = 3
     return (month + 2) / 3;
@@ -239,10 +228,7 @@ struct is_leap_year_op {
   template <typename Timestamp>
   __device__ inline bool operator()(Timestamp const ts) const
   {
-    using namespace cuda::std::chrono;
-    auto const days_since_epoch = floor<days>(ts);
-    auto const date             = year_month_day(days_since_epoch);
-    return date.year().is_leap();
+    return is_leap(to_civil_date(ts).year);
   }
 };
 
@@ -315,6 +301,39 @@ struct launch_functor {
   }
 };
 
+// Extract several components of every element from the input column in one pass
+struct extract_datetime_components_fn {
+  template <typename Element>
+  std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    column_view const&,
+    device_span<datetime_component const>,
+    device_span<int16_t* const>,
+    rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& column,
+    device_span<datetime_component const> components,
+    device_span<int16_t* const> outputs,
+    rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       column.size(),
+                       [timestamps = column.begin<Timestamp>(), components, outputs] __device__(
+                         size_type row) {
+                         auto const ts   = timestamps[row];
+                         auto const date = to_civil_date(ts);
+                         for (std::size_t i = 0; i < components.size(); ++i) {
+                           outputs[i][row] = extract_component(components[i], ts, date);
+                         }
+                       });
+  }
+};
+
 // Create an output column by applying the functor to every element from the input column
 template <typename TransformFunctor, cudf::type_id OutputColCudfT>
 std::unique_ptr<column> apply_datetime_op(column_view const& column,
@@ -453,7 +472,7 @@ std::unique_ptr<column> extract_year(column_view const& column,
                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -462,7 +481,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
                                       rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -471,7 +490,7 @@ std::unique_ptr<column> extract_day(column_view const& column,
                                     rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -480,7 +499,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
                                         rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -489,7 +508,7 @@ std::unique_ptr<column> extract_hour(column_view const& column,
                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -498,7 +517,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
                                        rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -507,7 +526,7 @@ std::unique_ptr<column> extract_second(column_view const& column,
                                        rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -516,7 +535,7 @@ std::unique_ptr<column> extract_millisecond_fraction(column_view const& column,
                                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MILLISECOND>,
+    detail::extract_component_operator<datetime_component::MILLISECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -525,7 +544,7 @@ std::unique_ptr<column> extract_microsecond_fraction(column_view const& column,
                                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MICROSECOND>,
+    detail::extract_component_operator<datetime_component::MICROSECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -534,10 +553,39 @@ std::unique_ptr<column> extract_nanosecond_fraction(column_view const& column,
                                                     rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::NANOSECOND>,
+    detail::extract_component_operator<datetime_component::NANOSECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> extract_datetime_components(
+  column_view const& column,
+  host_span<datetime_component const> components,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<int16_t*> outputs;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    results.push_back(make_fixed_width_column(data_type{type_id::INT16},
+                                              column.size(),
+                                              cudf::detail::copy_bitmask(column, stream, mr),
+                                              column.null_count(),
+                                              stream,
+                                              mr));
+    outputs.push_back(results.back()->mutable_view().data<int16_t>());
+  }
+  if (column.is_empty() or components.empty()) { return results; }
+
+  auto const temp_mr      = rmm::mr::get_current_device_resource();
+  auto const d_components = cudf::detail::make_device_uvector_async(components, stream, temp_mr);
+  auto const d_outputs    = cudf::detail::make_device_uvector_async(outputs, stream, temp_mr);
+  type_dispatcher(
+    column.type(), extract_datetime_components_fn{}, column, d_components, d_outputs, stream);
+  return results;
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
@@ -671,6 +719,15 @@ std::unique_ptr<column> extract_nanosecond_fraction(column_view const& column,
   return detail::extract_nanosecond_fraction(column, cudf::get_default_stream(), mr);
 }
 
+std::vector<std::unique_ptr<column>> extract_datetime_components(
+  column_view const& column,
+  host_span<datetime_component const> components,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_datetime_components(column, components, cudf::get_default_stream(), mr);
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::mr::device_memory_resource* mr)
 {
@@ -22,6 +22,10 @@
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace cudf {
 
@@ -387,15 +391,22 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
 }
 
 namespace detail {
+namespace {
 
-std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
-                                                      std::string_view timezone_name,
-                                                      rmm::cuda_stream_view stream,
-                                                      rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Host copy of a timezone transition table; empty if the timezone needs no conversion
+ */
+struct host_transition_table {
+  std::vector<timestamp_s> transition_times;
+  std::vector<duration_s> offsets;
+};
+
+host_transition_table build_transition_table(std::optional<std::string_view> tzif_dir,
+                                             std::string_view timezone_name)
 {
   if (timezone_name == "UTC" || timezone_name.empty()) {
     // Return an empty table for UTC
-    return std::make_unique<cudf::table>();
+    return {};
   }
 
   timezone_file const tzf(tzif_dir, timezone_name);
@@ -426,7 +437,7 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
     if (tzf.typecnt() == 0 || tzf.ttype[0].utcoff == 0) {
       // No transitions, offset is zero; Table would be a no-op.
       // Return an empty table to speed up parsing.
-      return std::make_unique<cudf::table>();
+      return {};
     }
     // No transitions to use for the time/offset - use the first offset and apply to all timestamps
     transition_times[0] = std::numeric_limits<int64_t>::max();
@@ -483,20 +494,55 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   CUDF_EXPECTS(transition_times.size() == offsets.size(),
                "Error reading TZif file for timezone " + std::string{timezone_name});
 
-  std::vector<timestamp_s> ttimes_typed;
-  ttimes_typed.reserve(transition_times.size());
+  host_transition_table table;
+  table.transition_times.reserve(transition_times.size());
   std::transform(transition_times.cbegin(),
                  transition_times.cend(),
-                 std::back_inserter(ttimes_typed),
+                 std::back_inserter(table.transition_times),
                  [](auto ts) { return timestamp_s{duration_s{ts}}; });
-  std::vector<duration_s> offsets_typed;
-  offsets_typed.reserve(offsets.size());
-  std::transform(offsets.cbegin(), offsets.cend(), std::back_inserter(offsets_typed), [](auto ts) {
-    return duration_s{ts};
-  });
+  table.offsets.reserve(offsets.size());
+  std::transform(offsets.cbegin(),
+                 offsets.cend(),
+                 std::back_inserter(table.offsets),
+                 [](auto ts) { return duration_s{ts}; });
+  return table;
+}
+
+/**
+ * @brief Returns the transition table of a timezone, reading its TZif file only on first use
+ *
+ * The tables are cached for the lifetime of the process, keyed by the path of the TZif file.
+ */
+std::shared_ptr<host_transition_table const> get_transition_table(
+  std::optional<std::string_view> tzif_dir, std::string_view timezone_name)
+{
+  static std::mutex cache_mutex;
+  static std::unordered_map<std::string, std::shared_ptr<host_transition_table const>> cache;
+
+  auto const key =
+    (std::filesystem::path{tzif_dir.value_or(tzif_system_directory)} / timezone_name).string();
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  if (auto const it = cache.find(key); it != cache.end()) { return it->second; }
+  auto table = std::make_shared<host_transition_table const>(
+    build_transition_table(tzif_dir, timezone_name));
+  cache.emplace(key, table);
+  return table;
+}
 
-  auto d_ttimes  = cudf::detail::make_device_uvector_async(ttimes_typed, stream, mr);
-  auto d_offsets = cudf::detail::make_device_uvector_async(offsets_typed, stream, mr);
+}  // namespace
+
+std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
+                                                      std::string_view timezone_name,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  auto const host_table = get_transition_table(tzif_dir, timezone_name);
+  if (host_table->transition_times.empty()) { return std::make_unique<cudf::table>(); }
+
+  // The cached host tables outlive the copies, so there is no need to synchronize
+  auto d_ttimes =
+    cudf::detail::make_device_uvector_async(host_table->transition_times, stream, mr);
+  auto d_offsets = cudf::detail::make_device_uvector_async(host_table->offsets, stream, mr);
 
   std::vector<std::unique_ptr<column>> tz_table_columns;
   tz_table_columns.emplace_back(
@@ -504,9 +550,6 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   tz_table_columns.emplace_back(
     std::make_unique<cudf::column>(std::move(d_offsets), rmm::device_buffer{}, 0));
 
-  // Need to finish copies before transition_times and offsets go out of scope
-  stream.synchronize();
-
   return std::make_unique<cudf::table>(std::move(tz_table_columns));
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -49,15 +49,30 @@ std::unique_ptr<column> decode(dictionary_column_view const& source,
                                rmm::mr::device_memory_resource* mr)
 {
   if (source.is_empty()) return make_empty_column(type_id::EMPTY);
+  return decode(source, source.keys(), stream, mr);
+}
+
+/**
+ * @brief Decode a column from a dictionary using replacement keys.
+ */
+std::unique_ptr<column> decode(dictionary_column_view const& source,
+                               column_view const& keys,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(keys.size() == source.keys_size(),
+               "keys must have one row for each key of the dictionary",
+               std::invalid_argument);
+  if (source.is_empty()) return make_empty_column(keys.type());
 
   // annotated indices include the offset, size and bitmask from it's parent
   auto const indices       = source.get_indices_annotated();
   auto const d_indices     = column_device_view::create(indices, stream);
   auto const d_iterator    = cudf::detail::indexalator_factory::make_input_iterator(indices);
   auto const indices_begin = cudf::detail::make_counting_transform_iterator(
-    0, indices_handler_fn{d_iterator, *d_indices, source.keys().size()});
+    0, indices_handler_fn{d_iterator, *d_indices, keys.size()});
 
-  auto table_column = cudf::detail::gather(table_view{{source.keys()}},
+  auto table_column = cudf::detail::gather(table_view{{keys}},
                                            indices_begin,
                                            indices_begin + source.size(),
                                            cudf::out_of_bounds_policy::NULLIFY,
@@ -67,8 +82,14 @@ std::unique_ptr<column> decode(dictionary_column_view const& source,
   auto output_column = std::unique_ptr<column>(std::move(table_column.front()));
 
   // apply any nulls to the output column
-  output_column->set_null_mask(cudf::detail::copy_bitmask(source.parent(), stream, mr),
-                               source.null_count());
+  if (keys.has_nulls()) {
+    auto [null_mask, null_count] =
+      cudf::detail::bitmask_and(table_view{{source.parent(), output_column->view()}}, stream, mr);
+    output_column->set_null_mask(std::move(null_mask), null_count);
+  } else {
+    output_column->set_null_mask(cudf::detail::copy_bitmask(source.parent(), stream, mr),
+                                 source.null_count());
+  }
 
   return output_column;
 }
@@ -83,5 +104,14 @@ std::unique_ptr<column> decode(dictionary_column_view const& source,
   return detail::decode(source, stream, mr);
 }
 
+std::unique_ptr<column> decode(dictionary_column_view const& source,
+                               column_view const& keys,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decode(source, keys, stream, mr);
+}
+
 }  // namespace dictionary
 }  // namespace cudf
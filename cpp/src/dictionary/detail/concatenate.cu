@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/sorting.hpp>
@@ -24,6 +25,7 @@
 #include <cudf/dictionary/detail/concatenate.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -40,6 +42,7 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/pair.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
@@ -202,6 +205,34 @@ struct dispatch_compute_indices {
   }
 };
 
+/**
+ * @brief Returns true if `keys` are equal to the first `keys.size()` values of `candidate`.
+ *
+ * Dictionary keys are sorted and unique so indices into `keys` are then also valid indices into
+ * `candidate`.
+ */
+bool is_keys_prefix(column_view const& keys,
+                    column_view const& candidate,
+                    rmm::cuda_stream_view stream)
+{
+  if (keys.size() > candidate.size()) { return false; }
+  if (keys.is_empty()) { return true; }
+
+  auto const prefix = cudf::detail::slice(candidate, 0, keys.size(), stream);
+  auto const comparator =
+    cudf::experimental::row::equality::two_table_comparator(table_view{{keys}},
+                                                            table_view{{prefix}},
+                                                            stream);
+  auto const d_equal = comparator.equal_to<false>(nullate::NO{});
+  return thrust::all_of(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(keys.size()),
+                        [d_equal] __device__(size_type idx) {
+                          return d_equal(cudf::experimental::row::lhs_index_type{idx},
+                                         cudf::experimental::row::rhs_index_type{idx});
+                        });
+}
+
 }  // namespace
 
 std::unique_ptr<column> concatenate(host_span<column_view const> columns,
@@ -223,6 +254,56 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
     CUDF_EXPECTS(keys.type() == keys_type, "key types of all dictionary columns must match");
     return keys;
   });
+
+  // next, concatenate the indices
+  std::vector<column_view> indices_views(columns.size());
+  std::transform(columns.begin(), columns.end(), indices_views.begin(), [](auto cv) {
+    auto dict_view = dictionary_column_view(cv);
+    if (dict_view.is_empty()) {
+      return column_view{data_type{type_id::UINT32}, 0, nullptr, nullptr, 0};
+    }
+    return dict_view.get_indices_annotated();  // nicely includes validity mask and view offset
+  });
+
+  // Columns sharing their keys, e.g. decoded from the same file, are common. When every key set
+  // is a prefix of the largest one, the largest key set is the result and no index is remapped.
+  auto const largest_keys = *std::max_element(
+    keys_views.begin(), keys_views.end(), [](auto const& lhs, auto const& rhs) {
+      return lhs.size() < rhs.size();
+    });
+  auto const first_indices = std::find_if(
+    indices_views.begin(), indices_views.end(), [](auto const& cv) { return not cv.is_empty(); });
+  auto const indices_type = first_indices == indices_views.end() ? data_type{type_id::UINT32}
+                                                                 : first_indices->type();
+  auto const is_shared_keys =
+    std::all_of(indices_views.begin(),
+                indices_views.end(),
+                [indices_type](auto const& cv) {
+                  return cv.is_empty() or cv.type() == indices_type;
+                }) and
+    std::all_of(keys_views.begin(), keys_views.end(), [&](auto const& keys) {
+      return is_keys_prefix(keys, largest_keys, stream);
+    });
+  if (is_shared_keys) {
+    std::replace_if(
+      indices_views.begin(),
+      indices_views.end(),
+      [](auto const& cv) { return cv.is_empty(); },
+      column_view{indices_type, 0, nullptr, nullptr, 0});
+    auto keys_column = std::make_unique<column>(largest_keys, stream, mr);
+    auto all_indices = cudf::detail::concatenate(indices_views, stream, mr);
+
+    auto const indices_size = all_indices->size();
+    auto const null_count   = all_indices->null_count();
+    auto contents           = all_indices->release();
+    auto indices_column     = std::make_unique<column>(
+      indices_type, indices_size, std::move(*contents.data), rmm::device_buffer{}, 0);
+    return make_dictionary_column(std::move(keys_column),
+                                  std::move(indices_column),
+                                  std::move(*(contents.null_mask.release())),
+                                  null_count);
+  }
+
   auto all_keys =
     cudf::detail::concatenate(keys_views, stream, rmm::mr::get_current_device_resource());
 
@@ -243,15 +324,6 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
                        ->release();
   std::unique_ptr<column> keys_column(std::move(sorted_keys.front()));
 
-  // next, concatenate the indices
-  std::vector<column_view> indices_views(columns.size());
-  std::transform(columns.begin(), columns.end(), indices_views.begin(), [](auto cv) {
-    auto dict_view = dictionary_column_view(cv);
-    if (dict_view.is_empty()) {
-      return column_view{data_type{type_id::UINT32}, 0, nullptr, nullptr, 0};
-    }
-    return dict_view.get_indices_annotated();  // nicely includes validity mask and view offset
-  });
   auto all_indices        = cudf::detail::concatenate(indices_views, stream, mr);
   auto const indices_size = all_indices->size();
 
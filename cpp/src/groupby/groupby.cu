@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,9 +25,15 @@
 #include <cudf/detail/groupby/group_replace_nulls.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/host_spill.hpp>
+#include <cudf/detail/utilities/instrumentation.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/hashing/detail/helper_functions.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/reduction/detail/histogram.hpp>
 #include <cudf/strings/string_view.hpp>
 #include <cudf/table/table.hpp>
@@ -42,8 +48,12 @@
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -52,12 +62,14 @@ groupby::groupby(table_view const& keys,
                  null_policy include_null_keys,
                  sorted keys_are_sorted,
                  std::vector<order> const& column_order,
-                 std::vector<null_order> const& null_precedence)
+                 std::vector<null_order> const& null_precedence,
+                 bool cache_key_groups)
   : _keys{keys},
     _include_null_keys{include_null_keys},
     _keys_are_sorted{keys_are_sorted},
     _column_order{column_order},
-    _null_precedence{null_precedence}
+    _null_precedence{null_precedence},
+    _cache_key_groups{cache_key_groups}
 {
 }
 
@@ -75,6 +87,9 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // satisfied with a hash implementation
   if (_keys_are_sorted == sorted::NO and not _helper and
       detail::hash::can_use_hash_groupby(requests)) {
+    if (_cache_key_groups) {
+      return detail::hash::groupby(_keys, requests, _include_null_keys, _key_groups, stream, mr);
+    }
     return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
   } else {
     return sort_aggregate(requests, stream, mr);
@@ -205,6 +220,7 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
+  CUDF_API_EVENT(stream, _keys);
   CUDF_EXPECTS(
     std::all_of(requests.begin(),
                 requests.end(),
@@ -218,6 +234,117 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
   return dispatch_aggregation(requests, stream, mr);
 }
 
+// Estimate the memory of aggregation requests
+memory_estimate groupby::estimate_memory(host_span<aggregation_request const> requests,
+                                         rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  auto const num_rows    = static_cast<std::size_t>(_keys.num_rows());
+  auto const index_bytes = num_rows * sizeof(size_type);
+
+  // every key may be distinct, so each result may have as many rows as the input
+  auto const keys_bytes = detail::estimated_table_size(_keys, stream);
+  auto results_bytes    = std::size_t{0};
+  for (auto const& request : requests) {
+    for (auto const& agg : request.aggregations) {
+      auto const type = detail::target_type(request.values.type(), agg->kind);
+      results_bytes +=
+        is_fixed_width(type)
+          ? num_rows * size_of(type) + bitmask_allocation_size_bytes(_keys.num_rows())
+          : detail::estimated_table_size(table_view{{request.values}}, stream) + index_bytes;
+    }
+  }
+
+  if (_keys_are_sorted == sorted::NO and not _helper and
+      detail::hash::can_use_hash_groupby(requests)) {
+    // a hash table of row indices, and the results of every row before they are gathered
+    auto const hash_table_bytes = compute_hash_table_size(_keys.num_rows()) * 2 * sizeof(size_type);
+    return {hash_table_bytes + bitmask_allocation_size_bytes(_keys.num_rows()) + results_bytes +
+              index_bytes,
+            keys_bytes + results_bytes};
+  }
+  // the sorted order and group labels and offsets, the sorted keys, and the sorted values
+  auto const values_bytes = std::accumulate(
+    requests.begin(), requests.end(), std::size_t{0}, [&](std::size_t bytes, auto const& request) {
+      return bytes + detail::estimated_table_size(table_view{{request.values}}, stream);
+    });
+  return {3 * index_bytes + keys_bytes + values_bytes, keys_bytes + results_bytes};
+}
+
+// Compute aggregation requests on the rows passing a filter
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
+  host_span<aggregation_request const> requests,
+  table_view const& filter_table,
+  ast::expression const& filter,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+  CUDF_EXPECTS(filter_table.num_rows() == _keys.num_rows(),
+               "Size mismatch between filter table and groupby keys.",
+               std::invalid_argument);
+
+  verify_valid_requests(requests);
+
+  if (_keys.num_rows() == 0) { return {empty_like(_keys), empty_results(requests)}; }
+
+  auto const predicate = cudf::detail::compute_column(
+    filter_table, filter, stream, rmm::mr::get_current_device_resource());
+  CUDF_EXPECTS(predicate->type().id() == type_id::BOOL8, "Filter must be a boolean expression.");
+
+  if (_keys_are_sorted == sorted::NO and not _helper and
+      detail::hash::can_use_hash_groupby(requests)) {
+    auto const row_filter =
+      cudf::detail::bools_to_mask(predicate->view(), stream, rmm::mr::get_current_device_resource())
+        .first;
+    return detail::hash::groupby(_keys,
+                                 requests,
+                                 _include_null_keys,
+                                 static_cast<bitmask_type const*>(row_filter->data()),
+                                 stream,
+                                 mr);
+  }
+
+  // The sort-based groupby aggregates the filtered keys and values, which keep their order
+  std::vector<column_view> columns(_keys.begin(), _keys.end());
+  std::transform(requests.begin(),
+                 requests.end(),
+                 std::back_inserter(columns),
+                 [](auto const& request) { return request.values; });
+  auto const filtered = cudf::detail::apply_boolean_mask(
+    table_view{columns}, predicate->view(), stream, rmm::mr::get_current_device_resource());
+  auto const filtered_view = filtered->view();
+
+  std::vector<aggregation_request> filtered_requests(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    filtered_requests[i].values = filtered_view.column(_keys.num_columns() + i);
+    for (auto const& agg : requests[i].aggregations) {
+      filtered_requests[i].aggregations.emplace_back(
+        dynamic_cast<groupby_aggregation*>(agg->clone().release()));
+    }
+  }
+
+  std::vector<size_type> key_indices(_keys.num_columns());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+  groupby filtered_groupby(filtered_view.select(key_indices),
+                           _include_null_keys,
+                           _keys_are_sorted,
+                           _column_order,
+                           _null_precedence);
+  return filtered_groupby.aggregate(filtered_requests, stream, mr);
+}
+
 // Compute scan requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan(
   host_span<scan_request const> requests, rmm::mr::device_memory_resource* mr)
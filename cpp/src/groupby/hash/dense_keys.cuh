@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/cuco_helpers.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/atomic>
+#include <cuda/functional>
+#include <thrust/extrema.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace hash {
+
+/// Largest number of combined key values aggregated by direct indexing instead of hashing
+constexpr int64_t max_dense_key_slots = 1 << 22;
+
+/**
+ * @brief Stand-in for the hash set of the groupby when the keys map to dense slots.
+ *
+ * Each row has the slot of its combined key value, and each slot holds the first row inserted
+ * with it. Keys are thus found without hashing nor probing, with the same interface as the hash
+ * set device refs used by the aggregation kernels.
+ */
+struct dense_key_set_ref {
+  size_type const* __restrict__ key_slots;  ///< Slot of the key of each row
+  size_type* __restrict__ slot_rows;        ///< Row of the group of each slot, or the sentinel
+
+  /**
+   * @brief Inserts a row in the slot of its key if the slot is empty.
+   *
+   * @return The row of the group of `row`, and whether `row` was inserted
+   */
+  __device__ thrust::pair<thrust::constant_iterator<size_type>, bool> insert_and_find(
+    size_type row) const
+  {
+    auto& slot_row = slot_rows[key_slots[row]];
+    auto ref       = cuda::atomic_ref<size_type, cuda::thread_scope_device>{slot_row};
+    auto expected  = ref.load(cuda::std::memory_order_relaxed);
+    if (expected == cudf::detail::CUDF_SIZE_TYPE_SENTINEL and
+        ref.compare_exchange_strong(expected, row, cuda::std::memory_order_relaxed)) {
+      return {thrust::make_constant_iterator(row), true};
+    }
+    return {thrust::make_constant_iterator(expected), false};
+  }
+
+  /**
+   * @brief Finds the row of the group of a row that was inserted before.
+   */
+  __device__ size_type const* find(size_type row) const { return slot_rows + key_slots[row]; }
+};
+
+/**
+ * @brief Range of the values of an integral key column.
+ */
+struct key_range {
+  int64_t min;    ///< The smallest key, as the bits of the key type
+  uint64_t span;  ///< Difference between the largest and the smallest key
+};
+
+/**
+ * @brief Computes the range of the non-null values of an integral key column, for use with
+ * `type_dispatcher`.
+ *
+ * @return The range of the keys, or nothing if they are not integral or span too many values
+ */
+struct key_range_fn {
+  template <typename T>
+  std::optional<key_range> operator()(column_view const& keys, rmm::cuda_stream_view stream) const
+  {
+    if constexpr (cudf::is_integral<T>()) {
+      if (keys.null_count() == keys.size()) { return key_range{0, 0}; }
+      using range_pair = thrust::pair<T, T>;
+
+      auto const init =
+        range_pair{std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest()};
+      auto const d_keys = column_device_view::create(keys, stream);
+      auto const range  = thrust::transform_reduce(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(keys.size()),
+        cuda::proclaim_return_type<range_pair>(
+          [d_keys = *d_keys, init] __device__(size_type i) {
+            if (d_keys.is_null(i)) { return init; }
+            auto const key = d_keys.element<T>(i);
+            return range_pair{key, key};
+          }),
+        init,
+        cuda::proclaim_return_type<range_pair>([] __device__(range_pair lhs, range_pair rhs) {
+          return range_pair{thrust::min(lhs.first, rhs.first), thrust::max(lhs.second, rhs.second)};
+        }));
+      auto const span = static_cast<uint64_t>(range.second) - static_cast<uint64_t>(range.first);
+      if (span < static_cast<uint64_t>(max_dense_key_slots)) {
+        return key_range{static_cast<int64_t>(range.first), span};
+      }
+    }
+    return std::nullopt;
+  }
+};
+
+/**
+ * @brief Accumulates the keys of a column into the slots of the rows, for use with
+ * `type_dispatcher`.
+ *
+ * The slot of a row is the mixed-radix number whose digits are the offsets of its keys from
+ * the smallest key of each column. A null key has the digit after the largest key.
+ */
+struct accumulate_key_slots_fn {
+  template <typename T>
+  void operator()(column_view const& keys,
+                  key_range range,
+                  size_type radix,
+                  size_type* key_slots,
+                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (cudf::is_integral<T>()) {
+      auto const d_keys     = column_device_view::create(keys, stream);
+      auto const min        = static_cast<uint64_t>(static_cast<T>(range.min));
+      auto const null_digit = static_cast<size_type>(range.span) + 1;
+      thrust::transform(
+        rmm::exec_policy_nosync(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(keys.size()),
+        key_slots,
+        key_slots,
+        cuda::proclaim_return_type<size_type>(
+          [d_keys = *d_keys, min, radix, null_digit] __device__(size_type i, size_type slot) {
+            auto const digit =
+              d_keys.is_null(i)
+                ? null_digit
+                : static_cast<size_type>(static_cast<uint64_t>(d_keys.element<T>(i)) - min);
+            return slot * radix + digit;
+          }));
+    } else {
+      CUDF_FAIL("Dense keys must be integral");
+    }
+  }
+};
+
+}  // namespace hash
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -15,7 +15,9 @@
  */
 
 #include "groupby/common/utils.hpp"
+#include "groupby/hash/dense_keys.cuh"
 #include "groupby/hash/groupby_kernels.cuh"
+#include "groupby/hash/shared_memory_kernels.cuh"
 #include "hash/concurrent_unordered_map.cuh"
 
 #include <cudf/aggregation.hpp>
@@ -46,12 +48,22 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <cuco/static_set.cuh>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
 
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -70,7 +82,7 @@ using probing_scheme_type = cuco::linear_probing<
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
+constexpr std::array<aggregation::Kind, 13> hash_aggregations{aggregation::SUM,
                                                               aggregation::PRODUCT,
                                                               aggregation::MIN,
                                                               aggregation::MAX,
@@ -80,12 +92,13 @@ constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
                                                               aggregation::ARGMAX,
                                                               aggregation::SUM_OF_SQUARES,
                                                               aggregation::MEAN,
+                                                              aggregation::M2,
                                                               aggregation::STD,
                                                               aggregation::VARIANCE};
 
 // Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, ANY, ALL,
-// Compound: MEAN(SUM, COUNT_VALID), VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
-// ARGMAX, ARGMIN
+// Compound: MEAN(SUM, COUNT_VALID), M2(SUM, COUNT_VALID), VARIANCE,
+// STD(MEAN (SUM, COUNT_VALID), COUNT_VALID), ARGMAX, ARGMIN
 
 // TODO replace with std::find in C++20 onwards.
 template <class T, size_t N>
@@ -146,6 +159,17 @@ class groupby_simple_aggregations_collector final
     return aggs;
   }
 
+  std::vector<std::unique_ptr<aggregation>> visit(data_type,
+                                                  cudf::detail::m2_aggregation const&) override
+  {
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    aggs.push_back(make_sum_aggregation());
+    // COUNT_VALID
+    aggs.push_back(make_count_aggregation());
+
+    return aggs;
+  }
+
   std::vector<std::unique_ptr<aggregation>> visit(data_type,
                                                   cudf::detail::var_aggregation const&) override
   {
@@ -305,6 +329,37 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     dense_results->add_result(col, agg, std::move(result));
   }
 
+  void visit(cudf::detail::m2_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    auto sum_agg   = make_sum_aggregation();
+    auto count_agg = make_count_aggregation();
+    this->visit(*sum_agg);
+    this->visit(*count_agg);
+    column_view sum_result   = sparse_results->get_result(col, *sum_agg);
+    column_view count_result = sparse_results->get_result(col, *count_agg);
+
+    auto values_view = column_device_view::create(col, stream);
+    auto sum_view    = column_device_view::create(sum_result, stream);
+    auto count_view  = column_device_view::create(count_result, stream);
+
+    auto m2_result = make_fixed_width_column(
+      cudf::detail::target_type(result_type, agg.kind), col.size(), mask_state::ALL_NULL, stream);
+    auto m2_result_view = mutable_column_device_view::create(m2_result->mutable_view(), stream);
+    mutable_table_view m2_table_view{{m2_result->mutable_view()}};
+    cudf::detail::initialize_with_identity(m2_table_view, {agg.kind}, stream);
+
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      col.size(),
+      ::cudf::detail::m2_hash_functor{
+        set, row_bitmask, *m2_result_view, *values_view, *sum_view, *count_view});
+    sparse_results->add_result(col, agg, std::move(m2_result));
+    dense_results->add_result(col, agg, to_dense_agg_result(agg));
+  }
+
   void visit(cudf::detail::var_aggregation const& agg) override
   {
     if (dense_results->has_result(col, agg)) return;
@@ -389,23 +444,15 @@ flatten_single_pass_aggs(host_span<aggregation_request const> requests)
  * @see groupby_null_templated()
  */
 template <typename SetType>
-void sparse_to_dense_results(table_view const& keys,
-                             host_span<aggregation_request const> requests,
+void sparse_to_dense_results(host_span<aggregation_request const> requests,
                              cudf::detail::result_cache* sparse_results,
                              cudf::detail::result_cache* dense_results,
                              device_span<size_type const> gather_map,
                              SetType set,
-                             bool keys_have_nulls,
-                             null_policy include_null_keys,
+                             bitmask_type const* row_bitmask,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
 {
-  auto row_bitmask =
-    cudf::detail::bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first;
-  bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
-  bitmask_type const* row_bitmask_ptr =
-    skip_key_rows_with_nulls ? static_cast<bitmask_type*>(row_bitmask.data()) : nullptr;
-
   for (auto const& request : requests) {
     auto const& agg_v = request.aggregations;
     auto const& col   = request.values;
@@ -413,7 +460,7 @@ void sparse_to_dense_results(table_view const& keys,
     // Given an aggregation, this will get the result from sparse_results and
     // convert and return dense, compacted result
     auto finalizer = hash_compound_agg_finalizer(
-      col, sparse_results, dense_results, gather_map, set, row_bitmask_ptr, stream, mr);
+      col, sparse_results, dense_results, gather_map, set, row_bitmask, stream, mr);
     for (auto&& agg : agg_v) {
       agg->finalize(finalizer);
     }
@@ -453,17 +500,141 @@ auto create_sparse_results_table(table_view const& flattened_values,
   return sparse_table;
 }
 
+/// Smallest number of rows for which the cardinality of the keys is sampled
+constexpr size_type shared_memory_aggs_min_rows = 64 * 1024;
+
+/// Number of rows sampled to estimate the cardinality of the keys
+constexpr size_type shared_memory_aggs_sample_size = 16 * 1024;
+
+/**
+ * @brief Indicates whether every flattened single-pass aggregation can be accumulated in
+ * shared memory.
+ */
+bool can_use_shared_memory_aggs(table_view const& flattened_values,
+                                std::vector<aggregation::Kind> const& agg_kinds)
+{
+  return std::all_of(thrust::make_counting_iterator(0),
+                     thrust::make_counting_iterator(flattened_values.num_columns()),
+                     [&](auto i) {
+                       return cudf::detail::dispatch_type_and_aggregation(
+                         flattened_values.column(i).type(),
+                         agg_kinds[i],
+                         is_shared_memory_aggregation_fn{});
+                     });
+}
+
+/**
+ * @brief Computes the single-pass aggregations of low-cardinality keys with partial results in
+ * shared memory.
+ *
+ * A strided sample of the rows is inserted in `set` first. If the sample has few distinct keys, all
+ * rows are inserted and each row gets the dense index of its group. Each block of the aggregation
+ * kernels then accumulates its rows into one partial result per group in shared memory, and merges
+ * them into `sparse_table` with a single global atomic per group, instead of one per row.
+ *
+ * @return `false` if the keys have too many groups, in which case `sparse_table` is untouched and
+ * the rows inserted in `set` are left for the regular aggregation
+ */
+template <typename SetType>
+bool compute_shared_memory_aggs(size_type num_rows,
+                                table_view const& flattened_values,
+                                std::vector<aggregation::Kind> const& agg_kinds,
+                                table& sparse_table,
+                                SetType set,
+                                bitmask_type const* row_bitmask,
+                                bool skip_rows_with_nulls,
+                                rmm::cuda_stream_view stream)
+{
+  auto const stride      = num_rows / shared_memory_aggs_sample_size;
+  auto const sample_size = num_rows / stride;
+  rmm::device_uvector<size_type> group_rows(num_rows, stream);
+  rmm::device_uvector<bool> is_new_group(sample_size, stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::make_counting_iterator(0),
+                     sample_size,
+                     find_group_rows_fn<SetType>{set,
+                                                 row_bitmask,
+                                                 skip_rows_with_nulls,
+                                                 stride,
+                                                 group_rows.data(),
+                                                 is_new_group.data()});
+  auto const sample_groups =
+    thrust::count(rmm::exec_policy(stream), is_new_group.begin(), is_new_group.end(), true);
+  if (sample_groups > max_shared_memory_groups / 2) { return false; }
+
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_counting_iterator(0),
+    num_rows,
+    find_group_rows_fn<SetType>{
+      set, row_bitmask, skip_rows_with_nulls, 1, group_rows.data(), nullptr});
+
+  // The rows stored in the set are the ones that are their own group row
+  auto const is_stored_row = [group_rows = group_rows.data()] __device__(size_type i) {
+    return group_rows[i] == i;
+  };
+  auto const num_groups = static_cast<size_type>(
+    thrust::count_if(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     thrust::make_counting_iterator(num_rows),
+                     is_stored_row));
+  if (num_groups > max_shared_memory_groups) { return false; }
+  if (num_groups == 0) { return true; }
+
+  rmm::device_uvector<size_type> stored_rows(num_groups, stream);
+  thrust::copy_if(rmm::exec_policy_nosync(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(num_rows),
+                  stored_rows.begin(),
+                  is_stored_row);
+  rmm::device_uvector<size_type> group_indices(num_rows, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    group_indices.begin(),
+                    group_index_fn{group_rows.data(), stored_rows.data(), num_groups});
+
+  // Enough blocks to fill the device, each of them does `num_groups` merges at the end
+  int device  = 0;
+  int num_sms = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+  auto const num_blocks =
+    std::min(cudf::detail::grid_1d{num_rows, shared_memory_agg_block_size}.num_blocks,
+             num_sms * (2048 / shared_memory_agg_block_size));
+
+  for (size_type i = 0; i < flattened_values.num_columns(); ++i) {
+    auto const d_source = column_device_view::create(flattened_values.column(i), stream);
+    auto const d_target =
+      mutable_column_device_view::create(sparse_table.get_column(i).mutable_view(), stream);
+    cudf::detail::dispatch_type_and_aggregation(flattened_values.column(i).type(),
+                                                agg_kinds[i],
+                                                launch_shared_memory_aggs_fn{},
+                                                *d_source,
+                                                group_indices.data(),
+                                                stored_rows.data(),
+                                                num_groups,
+                                                *d_target,
+                                                num_blocks,
+                                                stream);
+  }
+  CUDF_CHECK_CUDA(stream.value());
+  return true;
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
+ *
+ * When the keys have few groups and every aggregation supports it, the aggregations are
+ * accumulated in shared memory, see `compute_shared_memory_aggs`.
  */
 template <typename SetType>
 void compute_single_pass_aggs(table_view const& keys,
                               host_span<aggregation_request const> requests,
                               cudf::detail::result_cache* sparse_results,
                               SetType set,
-                              bool keys_have_nulls,
-                              null_policy include_null_keys,
+                              bitmask_type const* row_bitmask,
                               rmm::cuda_stream_view stream)
 {
   // flatten the aggs to a table that can be operated on by aggregate_row
@@ -476,24 +647,27 @@ void compute_single_pass_aggs(table_view const& keys,
   auto d_values       = table_device_view::create(flattened_values, stream);
   auto const d_aggs   = cudf::detail::make_device_uvector_async(
     agg_kinds, stream, rmm::mr::get_current_device_resource());
-  auto const skip_key_rows_with_nulls =
-    keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
-
-  auto row_bitmask =
-    skip_key_rows_with_nulls
-      ? cudf::detail::bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first
-      : rmm::device_buffer{};
-
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    keys.num_rows(),
-    hash::compute_single_pass_aggs_fn{set,
-                                      *d_values,
-                                      *d_sparse_table,
-                                      d_aggs.data(),
-                                      static_cast<bitmask_type*>(row_bitmask.data()),
-                                      skip_key_rows_with_nulls});
+  auto const skip_rows = row_bitmask != nullptr;
+
+  auto const use_shared_memory =
+    keys.num_rows() >= shared_memory_aggs_min_rows and
+    can_use_shared_memory_aggs(flattened_values, agg_kinds) and
+    compute_shared_memory_aggs(keys.num_rows(),
+                               flattened_values,
+                               agg_kinds,
+                               sparse_table,
+                               set,
+                               row_bitmask,
+                               skip_rows,
+                               stream);
+  if (not use_shared_memory) {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      keys.num_rows(),
+      hash::compute_single_pass_aggs_fn{
+        set, *d_values, *d_sparse_table, d_aggs.data(), row_bitmask, skip_rows});
+  }
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
   for (size_t i = 0; i < aggs.size(); i++) {
@@ -519,6 +693,160 @@ rmm::device_uvector<size_type> extract_populated_keys(SetType const& key_set,
   return populated_keys;
 }
 
+/**
+ * @brief Computes the slot of the group of each row from the populated hash set, for the later
+ * groupbys of the same keys.
+ *
+ * The slots are the groups in the order of their rows in the hash set. Rows whose keys are
+ * skipped get a negative slot, which is never read since these rows are skipped again.
+ */
+template <typename SetType>
+key_groups find_key_groups(table_view const& keys,
+                           device_span<size_type const> populated_keys,
+                           SetType set,
+                           bitmask_type const* row_bitmask,
+                           rmm::cuda_stream_view stream)
+{
+  auto const num_rows = keys.num_rows();
+
+  // Every row was inserted already, so this only finds the row of the group of each row
+  rmm::device_uvector<size_type> group_rows(num_rows, stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::make_counting_iterator(0),
+                     num_rows,
+                     find_group_rows_fn<SetType>{
+                       set, row_bitmask, row_bitmask != nullptr, 1, group_rows.data(), nullptr});
+
+  auto const num_groups = static_cast<size_type>(populated_keys.size());
+  rmm::device_uvector<size_type> sorted_rows(num_groups, stream);
+  thrust::copy(rmm::exec_policy_nosync(stream),
+               populated_keys.begin(),
+               populated_keys.end(),
+               sorted_rows.begin());
+  thrust::sort(rmm::exec_policy_nosync(stream), sorted_rows.begin(), sorted_rows.end());
+
+  rmm::device_uvector<size_type> row_slots(num_rows, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    row_slots.begin(),
+                    group_index_fn{group_rows.data(), sorted_rows.data(), num_groups});
+  return key_groups{std::move(row_slots), num_groups};
+}
+
+/// Smallest number of key slots of the dense groupby, regardless of the number of rows
+constexpr int64_t min_dense_key_slots = 1024;
+
+/**
+ * @brief Computes the dense slot of the key of each row when every key column is integral or a
+ * dictionary, and the combined key values span few enough slots.
+ *
+ * The range of each integral key column is found with a min/max pass, and dictionary keys, which
+ * are unique, are identified by their indices. The slot of a row is the mixed-radix number whose
+ * digits are its keys offset by the smallest key of their column, see `accumulate_key_slots_fn`.
+ *
+ * @return The slot of the keys of each row and the number of slots, or nothing if the keys must
+ * be hashed
+ */
+std::optional<std::pair<rmm::device_uvector<size_type>, size_type>> compute_dense_key_slots(
+  table_view const& keys, rmm::cuda_stream_view stream)
+{
+  auto const is_dense_key = [](column_view const& col) {
+    return cudf::is_integral(col.type()) or col.type().id() == type_id::DICTIONARY32;
+  };
+  auto const num_rows = keys.num_rows();
+  if (num_rows == 0 or not std::all_of(keys.begin(), keys.end(), is_dense_key)) {
+    return std::nullopt;
+  }
+
+  // Scanning many more slots than rows would be slower than hashing the rows
+  auto const max_slots = std::min(
+    max_dense_key_slots, std::max(2 * static_cast<int64_t>(num_rows), min_dense_key_slots));
+
+  std::vector<std::tuple<column_view, key_range, size_type>> digits;
+  int64_t num_slots = 1;
+  for (auto const& col : keys) {
+    auto const is_dictionary = col.type().id() == type_id::DICTIONARY32;
+    auto const digit_keys =
+      is_dictionary ? dictionary_column_view(col).get_indices_annotated() : col;
+    auto const range =
+      is_dictionary
+        ? std::optional{key_range{
+            0, static_cast<uint64_t>(std::max(dictionary_column_view(col).keys_size() - 1, 0))}}
+        : type_dispatcher(col.type(), key_range_fn{}, col, stream);
+    if (not range.has_value()) { return std::nullopt; }
+
+    // Null keys get a digit of their own
+    auto const radix = static_cast<int64_t>(range->span) + (col.has_nulls() ? 2 : 1);
+    num_slots *= radix;
+    if (num_slots > max_slots) { return std::nullopt; }
+    digits.emplace_back(digit_keys, *range, static_cast<size_type>(radix));
+  }
+
+  rmm::device_uvector<size_type> key_slots(num_rows, stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy_nosync(stream), key_slots.begin(), key_slots.end(), size_type{0});
+  for (auto const& [digit_keys, range, radix] : digits) {
+    type_dispatcher(digit_keys.type(),
+                    accumulate_key_slots_fn{},
+                    digit_keys,
+                    range,
+                    radix,
+                    key_slots.data(),
+                    stream);
+  }
+  return std::pair{std::move(key_slots), static_cast<size_type>(num_slots)};
+}
+
+/**
+ * @brief Computes groupby by indexing the groups with the dense slots of their keys.
+ *
+ * Same as the hash-based groupby below, with `dense_key_set_ref` standing in for the hash set:
+ * the row of the group of each slot is found without hashing nor probing. The groups are returned
+ * in the order of their slots.
+ */
+std::unique_ptr<table> dense_groupby(table_view const& keys,
+                                     host_span<aggregation_request const> requests,
+                                     cudf::detail::result_cache* cache,
+                                     device_span<size_type const> key_slots,
+                                     size_type num_slots,
+                                     bitmask_type const* row_bitmask,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  rmm::device_uvector<size_type> slot_rows(num_slots, stream);
+  thrust::uninitialized_fill(rmm::exec_policy_nosync(stream),
+                             slot_rows.begin(),
+                             slot_rows.end(),
+                             cudf::detail::CUDF_SIZE_TYPE_SENTINEL);
+  auto const set = dense_key_set_ref{key_slots.data(), slot_rows.data()};
+
+  cudf::detail::result_cache sparse_results(requests.size());
+  compute_single_pass_aggs(keys, requests, &sparse_results, set, row_bitmask, stream);
+
+  // The rows of the non-empty slots gather the dense results
+  rmm::device_uvector<size_type> gather_map(num_slots, stream);
+  auto const gather_map_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    slot_rows.begin(),
+                    slot_rows.end(),
+                    gather_map.begin(),
+                    [] __device__(size_type row) {
+                      return row != cudf::detail::CUDF_SIZE_TYPE_SENTINEL;
+                    });
+  gather_map.resize(thrust::distance(gather_map.begin(), gather_map_end), stream);
+
+  sparse_to_dense_results(
+    requests, &sparse_results, cache, gather_map, set, row_bitmask, stream, mr);
+
+  return cudf::detail::gather(keys,
+                              gather_map,
+                              out_of_bounds_policy::DONT_CHECK,
+                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
 /**
  * @brief Computes groupby using hash table.
  *
@@ -544,15 +872,46 @@ rmm::device_uvector<size_type> extract_populated_keys(SetType const& key_set,
  * requested in `requests`, we gather sparse results into a column of dense
  * results using the aforementioned index vector. Dense results are stored into
  * the in/out parameter `cache`.
+ *
+ * When every key column is a small-range integer or a dictionary, the keys index a dense array
+ * of groups instead of the hash set, see `dense_groupby`. The cached groups of the rows, if any,
+ * are used the same way.
+ *
+ * @param row_bitmask Bitmask of the rows to aggregate, the other rows are skipped. Null to
+ * aggregate every row
+ * @param groups Null not to cache the groups of the rows. Otherwise, the cached groups, which
+ * are set to the groups found by this call if they are null
  */
 std::unique_ptr<table> groupby(table_view const& keys,
                                host_span<aggregation_request const> requests,
                                cudf::detail::result_cache* cache,
-                               bool const keys_have_nulls,
-                               null_policy const include_null_keys,
+                               bitmask_type const* row_bitmask,
+                               std::unique_ptr<key_groups>* groups,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
+  if (groups != nullptr and *groups != nullptr) {
+    return dense_groupby(keys,
+                         requests,
+                         cache,
+                         (*groups)->row_slots,
+                         (*groups)->num_slots,
+                         row_bitmask,
+                         stream,
+                         mr);
+  }
+
+  if (auto dense_keys = compute_dense_key_slots(keys, stream)) {
+    auto& [key_slots, num_slots] = *dense_keys;
+
+    auto unique_keys =
+      dense_groupby(keys, requests, cache, key_slots, num_slots, row_bitmask, stream, mr);
+    if (groups != nullptr) {
+      *groups = std::make_unique<key_groups>(key_groups{std::move(key_slots), num_slots});
+    }
+    return unique_keys;
+  }
+
   auto const num_keys            = keys.num_rows();
   auto const null_keys_are_equal = null_equality::EQUAL;
   auto const has_null            = nullate::DYNAMIC{cudf::has_nested_nulls(keys)};
@@ -582,25 +941,23 @@ std::unique_ptr<table> groupby(table_view const& keys,
                              requests,
                              &sparse_results,
                              set.ref(cuco::insert_and_find),
-                             keys_have_nulls,
-                             include_null_keys,
+                             row_bitmask,
                              stream);
 
     // Extract the populated indices from the hash set and create a gather map.
     // Gathering using this map from sparse results will give dense results.
     auto gather_map = extract_populated_keys(set, keys.num_rows(), stream);
+    if (groups != nullptr) {
+      *groups = std::make_unique<key_groups>(find_key_groups(keys,
+                                                             gather_map,
+                                                             set.ref(cuco::insert_and_find),
+                                                             row_bitmask,
+                                                             stream));
+    }
 
     // Compact all results from sparse_results and insert into cache
-    sparse_to_dense_results(keys,
-                            requests,
-                            &sparse_results,
-                            cache,
-                            gather_map,
-                            set.ref(cuco::find),
-                            keys_have_nulls,
-                            include_null_keys,
-                            stream,
-                            mr);
+    sparse_to_dense_results(
+      requests, &sparse_results, cache, gather_map, set.ref(cuco::find), row_bitmask, stream, mr);
 
     return cudf::detail::gather(keys,
                                 gather_map,
@@ -619,6 +976,85 @@ std::unique_ptr<table> groupby(table_view const& keys,
   }
 }
 
+struct has_storage_atomic_support_fn {
+  template <typename T>
+  constexpr bool operator()() const noexcept
+  {
+    return cudf::has_atomic_support<device_storage_type_t<T>>();
+  }
+};
+
+/**
+ * @brief Indicates whether aggregation `kind` of a column of values can be computed by the
+ * hash-based groupby.
+ *
+ * Compound aggregations are supported when their SUM and COUNT_VALID partials are, and string
+ * MIN/MAX are computed as ARGMIN/ARGMAX followed by a gather.
+ *
+ * @param values_type The type of the values, or of the keys of dictionary values
+ * @param kind The aggregation to verify
+ * @param is_dictionary Whether the values are a dictionary column
+ */
+bool is_hash_supported(data_type values_type, aggregation::Kind kind, bool is_dictionary)
+{
+  if (not is_hash_aggregation(kind)) { return false; }
+  switch (kind) {
+    case aggregation::MIN:
+    case aggregation::MAX:
+      if (values_type.id() == type_id::STRING) { return not is_dictionary; }
+      break;
+    case aggregation::SUM:
+      // decimal128 sums are added with a pair of 64-bit atomics
+      if (values_type.id() == type_id::DECIMAL128) { return true; }
+      break;
+    case aggregation::M2:
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+      if (not cudf::is_numeric(values_type) or cudf::is_fixed_point(values_type)) { return false; }
+      [[fallthrough]];
+    case aggregation::MEAN:
+      return is_hash_supported(values_type, aggregation::SUM, is_dictionary) and
+             is_hash_supported(values_type, aggregation::COUNT_VALID, is_dictionary);
+    default: break;
+  }
+  // Fixed-point results are updated with atomics on their underlying integers
+  return cudf::type_dispatcher(cudf::detail::target_type(values_type, kind),
+                               has_storage_atomic_support_fn{});
+}
+
+/**
+ * @brief Computes the bitmask of the rows to aggregate.
+ *
+ * The rows to aggregate are the rows set in `row_filter`, if any, without the rows of `keys` that
+ * contain nulls if `include_null_keys` excludes them.
+ *
+ * @return The bitmask of the rows to aggregate, or an empty buffer if every row is aggregated
+ */
+rmm::device_buffer compute_row_bitmask(table_view const& keys,
+                                       null_policy include_null_keys,
+                                       bitmask_type const* row_filter,
+                                       rmm::cuda_stream_view stream)
+{
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> masks_begin_bits;
+  if (include_null_keys == null_policy::EXCLUDE) {
+    for (auto const& col : keys) {
+      if (col.has_nulls()) {
+        masks.push_back(col.null_mask());
+        masks_begin_bits.push_back(col.offset());
+      }
+    }
+  }
+  if (row_filter != nullptr) {
+    masks.push_back(row_filter);
+    masks_begin_bits.push_back(0);
+  }
+  if (masks.empty()) { return rmm::device_buffer{}; }
+  return cudf::detail::bitmask_and(
+           masks, masks_begin_bits, keys.num_rows(), stream, rmm::mr::get_current_device_resource())
+    .first;
+}
+
 }  // namespace
 
 /**
@@ -641,9 +1077,9 @@ bool can_use_hash_groupby(host_span<aggregation_request const> requests)
     // hash-based aggregations. For those situations, we fallback to sort-based aggregations.
     if (v_type.id() == type_id::STRUCT or v_type.id() == type_id::LIST) { return false; }
 
-    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [v_type](auto const& a) {
-      return cudf::has_atomic_support(cudf::detail::target_type(v_type, a->kind)) and
-             is_hash_aggregation(a->kind);
+    auto const values_are_dictionary = is_dictionary(r.values.type());
+    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [&](auto const& a) {
+      return is_hash_supported(v_type, a->kind, values_are_dictionary);
     });
   });
 }
@@ -658,8 +1094,60 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
 {
   cudf::detail::result_cache cache(requests.size());
 
-  std::unique_ptr<table> unique_keys =
-    groupby(keys, requests, &cache, cudf::has_nulls(keys), include_null_keys, stream, mr);
+  auto const row_bitmask = compute_row_bitmask(keys, include_null_keys, nullptr, stream);
+  std::unique_ptr<table> unique_keys = groupby(keys,
+                                               requests,
+                                               &cache,
+                                               static_cast<bitmask_type const*>(row_bitmask.data()),
+                                               nullptr,
+                                               stream,
+                                               mr);
+
+  return std::pair(std::move(unique_keys), extract_results(requests, cache, stream, mr));
+}
+
+// Hash-based groupby of the rows set in a filter
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  bitmask_type const* row_filter,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  cudf::detail::result_cache cache(requests.size());
+
+  auto const row_bitmask = compute_row_bitmask(keys, include_null_keys, row_filter, stream);
+  std::unique_ptr<table> unique_keys = groupby(keys,
+                                               requests,
+                                               &cache,
+                                               static_cast<bitmask_type const*>(row_bitmask.data()),
+                                               nullptr,
+                                               stream,
+                                               mr);
+
+  return std::pair(std::move(unique_keys), extract_results(requests, cache, stream, mr));
+}
+
+// Hash-based groupby reusing or caching the groups of the rows
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  std::unique_ptr<key_groups>& groups,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  cudf::detail::result_cache cache(requests.size());
+
+  auto const row_bitmask = compute_row_bitmask(keys, include_null_keys, nullptr, stream);
+  std::unique_ptr<table> unique_keys = groupby(keys,
+                                               requests,
+                                               &cache,
+                                               static_cast<bitmask_type const*>(row_bitmask.data()),
+                                               &groups,
+                                               stream,
+                                               mr);
 
   return std::pair(std::move(unique_keys), extract_results(requests, cache, stream, mr));
 }
@@ -74,11 +74,10 @@ struct compute_single_pass_aggs_fn {
    * `input_values`.
    * @param aggs The set of aggregation operations to perform across the
    * columns of the `input_values` rows
-   * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
-   * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is `true`
-   * @param skip_rows_with_nulls Indicates if rows in `input_keys` containing
-   * null values should be skipped. It `true`, it is assumed `row_bitmask` is a
-   * bitmask where bit `i` indicates the presence of a null value in row `i`.
+   * @param row_bitmask Bitmask where bit `i` indicates that row `i` is aggregated, i.e. that
+   * its keys have no nulls and that it passes the filter of the groupby, if any. Only used if
+   * `skip_rows_with_nulls` is `true`
+   * @param skip_rows_with_nulls Indicates if the rows unset in `row_bitmask` should be skipped
    */
   compute_single_pass_aggs_fn(SetType set,
                               table_device_view input_values,
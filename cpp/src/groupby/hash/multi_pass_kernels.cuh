@@ -111,5 +111,78 @@ struct var_hash_functor {
   }
 };
 
+/**
+ * @brief Accumulates the sum of the squared deviations from the group mean (M2) of each row into
+ * its group, from the SUM and COUNT_VALID results of the group.
+ */
+template <typename SetType>
+struct m2_hash_functor {
+  SetType set;
+  bitmask_type const* __restrict__ row_bitmask;
+  mutable_column_device_view target;
+  column_device_view source;
+  column_device_view sum;
+  column_device_view count;
+  m2_hash_functor(SetType set,
+                  bitmask_type const* row_bitmask,
+                  mutable_column_device_view target,
+                  column_device_view source,
+                  column_device_view sum,
+                  column_device_view count)
+    : set(set), row_bitmask(row_bitmask), target(target), source(source), sum(sum), count(count)
+  {
+  }
+
+  template <typename Source>
+  constexpr static bool is_supported()
+  {
+    return is_numeric<Source>() && !is_fixed_point<Source>();
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<!is_supported<Source>()> operator()(column_device_view const& source,
+                                                                  size_type source_index,
+                                                                  size_type target_index) noexcept
+  {
+    CUDF_UNREACHABLE("Invalid source type for M2 aggregation.");
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<is_supported<Source>()> operator()(column_device_view const& source,
+                                                                 size_type source_index,
+                                                                 size_type target_index) noexcept
+  {
+    using Target    = target_type_t<Source, aggregation::M2>;
+    using SumType   = target_type_t<Source, aggregation::SUM>;
+    using CountType = target_type_t<Source, aggregation::COUNT_VALID>;
+
+    CountType group_size = count.element<CountType>(target_index);
+
+    auto x    = static_cast<Target>(source.element<Source>(source_index));
+    auto mean = static_cast<Target>(sum.element<SumType>(target_index)) / group_size;
+    cuda::atomic_ref<Target, cuda::thread_scope_device> ref{target.element<Target>(target_index)};
+    ref.fetch_add((x - mean) * (x - mean), cuda::std::memory_order_relaxed);
+
+    if (target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+  __device__ inline void operator()(size_type source_index)
+  {
+    if ((row_bitmask == nullptr or cudf::bit_is_set(row_bitmask, source_index)) and
+        not source.is_null(source_index)) {
+      auto const target_index = *set.find(source_index);
+
+      auto col         = source;
+      auto source_type = source.type();
+      if (source_type.id() == type_id::DICTIONARY32) {
+        col          = source.child(cudf::dictionary_column_view::keys_column_index);
+        source_type  = col.type();
+        source_index = static_cast<size_type>(source.element<dictionary32>(source_index));
+      }
+
+      type_dispatcher(source_type, *this, col, source_index, target_index);
+    }
+  }
+};
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/cuco_helpers.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+
+#include <type_traits>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace hash {
+
+/// Largest number of groups whose partial results fit in the shared memory of a block
+constexpr size_type max_shared_memory_groups = 2048;
+
+/// Number of threads of the blocks aggregating into shared memory
+constexpr int shared_memory_agg_block_size = 256;
+
+/**
+ * @brief Indicates whether aggregation `k` of `Source` values can be accumulated in shared memory.
+ *
+ * Only the aggregations whose partial results merge with a single atomic are supported.
+ */
+template <typename Source, aggregation::Kind k>
+constexpr bool is_shared_memory_aggregation()
+{
+  return cudf::is_numeric<Source>() and not std::is_same_v<Source, bool> and
+         (k == aggregation::SUM or k == aggregation::SUM_OF_SQUARES or k == aggregation::MIN or
+          k == aggregation::MAX or k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL);
+}
+
+/**
+ * @brief Inserts rows into the hash set and records the row of the group of each of them.
+ *
+ * Row `i * stride` is inserted for each index `i`. Rows whose keys are skipped get the empty key
+ * sentinel as the row of their group.
+ *
+ * @tparam SetType The type of the hash set device ref
+ */
+template <typename SetType>
+struct find_group_rows_fn {
+  SetType set;
+  bitmask_type const* __restrict__ row_bitmask;
+  bool skip_rows_with_nulls;
+  size_type stride;
+  size_type* __restrict__ group_rows;  ///< Row of the group of each inserted row
+  bool* __restrict__ is_new_group;     ///< Whether each row started a group, may be null
+
+  __device__ void operator()(size_type i)
+  {
+    auto const row = i * stride;
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, row)) {
+      group_rows[i] = cudf::detail::CUDF_SIZE_TYPE_SENTINEL;
+      if (is_new_group != nullptr) { is_new_group[i] = false; }
+      return;
+    }
+    auto const result = set.insert_and_find(row);
+    group_rows[i]     = *result.first;
+    if (is_new_group != nullptr) { is_new_group[i] = result.second; }
+  }
+};
+
+/**
+ * @brief Computes the group index of each row from the row of its group in the hash set.
+ *
+ * Rows whose keys were skipped, marked by a negative target row, get a negative group index.
+ */
+struct group_index_fn {
+  size_type const* __restrict__ target_rows;
+  size_type const* __restrict__ group_rows;
+  size_type num_groups;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const target = target_rows[i];
+    if (target < 0) { return -1; }
+    return static_cast<size_type>(
+      thrust::lower_bound(thrust::seq, group_rows, group_rows + num_groups, target) - group_rows);
+  }
+};
+
+template <typename Target, aggregation::Kind k>
+__device__ Target shared_memory_identity()
+{
+  if constexpr (k == aggregation::MIN) {
+    return cudf::DeviceMin::identity<Target>();
+  } else if constexpr (k == aggregation::MAX) {
+    return cudf::DeviceMax::identity<Target>();
+  } else {
+    return Target{0};
+  }
+}
+
+template <typename Target, aggregation::Kind k>
+__device__ void shared_memory_accumulate(Target* address, Target value)
+{
+  if constexpr (k == aggregation::MIN) {
+    cudf::detail::atomic_min(address, value);
+  } else if constexpr (k == aggregation::MAX) {
+    cudf::detail::atomic_max(address, value);
+  } else {
+    cudf::detail::atomic_add(address, value);
+  }
+}
+
+/**
+ * @brief Byte offset of the partial results of a block after the flags of its non-empty groups.
+ */
+CUDF_HOST_DEVICE constexpr std::size_t shared_memory_values_offset(size_type num_groups)
+{
+  return cudf::util::round_up_unsafe(num_groups * sizeof(int), std::size_t{16});
+}
+
+/**
+ * @brief Aggregates a column of values into per-block partial results in shared memory, then
+ * merges the partial results into the sparse result column.
+ *
+ * The shared memory of each block holds one flag and one partial result per group, indexed by the
+ * dense group index of the rows. The rows of a block only contend with each other on the shared
+ * memory atomics, and each block does a single global atomic per non-empty group.
+ *
+ * @param source The values to aggregate
+ * @param group_indices The group index of each row, negative for the skipped rows
+ * @param group_rows The row of the sparse result of each group
+ * @param num_groups The number of groups
+ * @param target The sparse result column
+ */
+template <typename Source, aggregation::Kind k>
+CUDF_KERNEL void shared_memory_aggs_kernel(column_device_view source,
+                                           size_type const* __restrict__ group_indices,
+                                           size_type const* __restrict__ group_rows,
+                                           size_type num_groups,
+                                           mutable_column_device_view target)
+{
+  using Target = cudf::detail::target_type_t<Source, k>;
+
+  extern __shared__ __align__(16) unsigned char shared_memory[];
+  auto const group_has_values = reinterpret_cast<int*>(shared_memory);
+  auto const partial_results =
+    reinterpret_cast<Target*>(shared_memory + shared_memory_values_offset(num_groups));
+
+  for (auto g = static_cast<size_type>(threadIdx.x); g < num_groups; g += blockDim.x) {
+    group_has_values[g] = 0;
+    partial_results[g]  = shared_memory_identity<Target, k>();
+  }
+  __syncthreads();
+
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  for (auto i = cudf::detail::grid_1d::global_thread_id(); i < source.size(); i += stride) {
+    auto const row   = static_cast<size_type>(i);
+    auto const group = group_indices[row];
+    if (group < 0) { continue; }
+    if constexpr (k == aggregation::COUNT_ALL) {
+      cudf::detail::atomic_add(&partial_results[group], Target{1});
+    } else {
+      if (source.is_null(row)) { continue; }
+      if constexpr (k == aggregation::COUNT_VALID) {
+        cudf::detail::atomic_add(&partial_results[group], Target{1});
+      } else {
+        auto const value = static_cast<Target>(source.element<Source>(row));
+        shared_memory_accumulate<Target, k>(&partial_results[group],
+                                            k == aggregation::SUM_OF_SQUARES ? value * value
+                                                                             : value);
+      }
+    }
+    group_has_values[group] = 1;
+  }
+  __syncthreads();
+
+  for (auto g = static_cast<size_type>(threadIdx.x); g < num_groups; g += blockDim.x) {
+    if (group_has_values[g] == 0) { continue; }
+    auto const target_row = group_rows[g];
+    shared_memory_accumulate<Target, k>(&target.element<Target>(target_row), partial_results[g]);
+    if (target.is_null(target_row)) { target.set_valid(target_row); }
+  }
+}
+
+/**
+ * @brief Checks whether the aggregation of a column of values can be accumulated in shared
+ * memory, for use with `dispatch_type_and_aggregation`.
+ */
+struct is_shared_memory_aggregation_fn {
+  template <typename Source, aggregation::Kind k>
+  bool operator()() const noexcept
+  {
+    return is_shared_memory_aggregation<Source, k>();
+  }
+};
+
+/**
+ * @brief Launches `shared_memory_aggs_kernel` for the type and aggregation of a column, for use
+ * with `dispatch_type_and_aggregation`.
+ */
+struct launch_shared_memory_aggs_fn {
+  template <typename Source, aggregation::Kind k>
+  void operator()(column_device_view const& source,
+                  size_type const* group_indices,
+                  size_type const* group_rows,
+                  size_type num_groups,
+                  mutable_column_device_view const& target,
+                  int num_blocks,
+                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      using Target = cudf::detail::target_type_t<Source, k>;
+      auto const shared_memory_bytes =
+        shared_memory_values_offset(num_groups) + num_groups * sizeof(Target);
+      shared_memory_aggs_kernel<Source, k>
+        <<<num_blocks, shared_memory_agg_block_size, shared_memory_bytes, stream.value()>>>(
+          source, group_indices, group_rows, num_groups, target);
+    } else {
+      CUDF_FAIL("Unsupported shared memory aggregation");
+    }
+  }
+};
+
+}  // namespace hash
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
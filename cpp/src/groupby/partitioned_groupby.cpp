@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/host_spill.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+using cudf::detail::spilled_table;
+
+// Same limits as the partitioned joins
+constexpr std::size_t max_partitions_per_level = 256;
+constexpr int max_partition_depth              = 4;
+
+using groupby_result = std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>;
+
+std::unique_ptr<groupby_aggregation> clone_aggregation(groupby_aggregation const& agg)
+{
+  return std::unique_ptr<groupby_aggregation>(
+    dynamic_cast<groupby_aggregation*>(agg.clone().release()));
+}
+
+/**
+ * @brief Estimates the device memory used by the groupby of `num_rows` rows of `table_size` bytes.
+ *
+ * Accounts for the concatenated rows, the hash set of their row indices at a 50% load factor,
+ * and results of about the size of the rows.
+ */
+std::size_t groupby_memory_size(std::size_t table_size, std::size_t num_rows)
+{
+  return 2 * table_size + 2 * num_rows * sizeof(size_type);
+}
+
+std::size_t num_partitions_for(std::size_t memory_size, std::size_t memory_budget)
+{
+  return std::clamp<std::size_t>(cudf::util::div_rounding_up_safe(memory_size, memory_budget),
+                                 2,
+                                 max_partitions_per_level);
+}
+
+/**
+ * @brief Hash-partitions a table on its first `num_keys` columns and spills the partitions to
+ * host memory.
+ *
+ * Dictionary keys are hashed by their decoded values, since the batches of a same key column may
+ * have different dictionaries.
+ */
+std::vector<spilled_table> partition_and_spill(table_view const& input,
+                                               size_type num_keys,
+                                               std::size_t num_partitions,
+                                               int depth,
+                                               rmm::cuda_stream_view stream)
+{
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+
+  std::vector<std::unique_ptr<column>> decoded_keys;
+  std::vector<column_view> hashed_keys;
+  for (size_type i = 0; i < num_keys; ++i) {
+    auto const key = input.column(i);
+    if (cudf::is_dictionary(key.type())) {
+      decoded_keys.push_back(
+        cudf::dictionary::detail::decode(dictionary_column_view(key), stream, temp_mr));
+      hashed_keys.push_back(decoded_keys.back()->view());
+    } else {
+      hashed_keys.push_back(key);
+    }
+  }
+  // every level uses a different seed, so a bucket is not mapped again to a single partition
+  auto const seed   = DEFAULT_HASH_SEED + static_cast<uint32_t>(depth);
+  auto const hashes = cudf::hashing::detail::murmurhash3_x86_32(
+    table_view{hashed_keys}, seed, stream, temp_mr);
+  auto const divisor =
+    numeric_scalar<uint32_t>(static_cast<uint32_t>(num_partitions), true, stream, temp_mr);
+  auto const partition_map = cudf::detail::binary_operation(hashes->view(),
+                                                            divisor,
+                                                            binary_operator::MOD,
+                                                            data_type{type_id::INT32},
+                                                            stream,
+                                                            temp_mr);
+
+  auto [partitioned, offsets] = cudf::partition(
+    input, partition_map->view(), static_cast<size_type>(num_partitions), temp_mr);
+  offsets.push_back(input.num_rows());
+  std::vector<spilled_table> partitions;
+  for (std::size_t i = 0; i < num_partitions; ++i) {
+    auto const partition = cudf::slice(partitioned->view(), {offsets[i], offsets[i + 1]}, stream);
+    partitions.push_back(cudf::detail::spill(partition.front(), stream));
+  }
+  return partitions;
+}
+
+/**
+ * @brief Concatenates the spilled tables of one partition of the batches into a device table.
+ */
+std::unique_ptr<table> unspill_bucket(std::vector<spilled_table> const& bucket,
+                                      rmm::cuda_stream_view stream)
+{
+  std::vector<packed_columns> packed;
+  std::vector<table_view> tables;
+  for (auto const& spilled : bucket) {
+    packed.push_back(cudf::detail::unspill(spilled, stream));
+    tables.push_back(cudf::unpack(packed.back()));
+  }
+  return cudf::detail::concatenate(tables, stream, rmm::mr::get_current_device_resource());
+}
+
+/**
+ * @brief Aggregates the buckets of a partition, partitioning them again while they exceed the
+ * memory budget, and collects the results of each aggregated bucket.
+ */
+struct bucket_aggregator {
+  std::vector<std::vector<std::unique_ptr<groupby_aggregation>>> const& aggregations;
+  size_type num_keys;
+  null_policy include_null_keys;
+  std::size_t memory_budget;
+  std::vector<groupby_result> results{};
+
+  void aggregate(std::vector<spilled_table> const& bucket,
+                 int depth,
+                 rmm::cuda_stream_view stream,
+                 rmm::mr::device_memory_resource* mr)
+  {
+    auto const num_rows = std::accumulate(
+      bucket.begin(), bucket.end(), std::size_t{0}, [](auto acc, auto const& spilled) {
+        return acc + static_cast<std::size_t>(spilled.num_rows);
+      });
+    auto const table_size = std::accumulate(
+      bucket.begin(), bucket.end(), std::size_t{0}, [](auto acc, auto const& spilled) {
+        return acc + spilled.data.size();
+      });
+    auto const memory_size = groupby_memory_size(table_size, num_rows);
+    if (memory_size <= memory_budget || depth >= max_partition_depth || num_rows <= 1) {
+      auto const input = unspill_bucket(bucket, stream);
+      auto const view  = input->view();
+      std::vector<size_type> key_indices(num_keys);
+      std::iota(key_indices.begin(), key_indices.end(), 0);
+      std::vector<aggregation_request> requests(aggregations.size());
+      for (std::size_t i = 0; i < aggregations.size(); ++i) {
+        requests[i].values = view.column(num_keys + static_cast<size_type>(i));
+        for (auto const& agg : aggregations[i]) {
+          requests[i].aggregations.push_back(clone_aggregation(*agg));
+        }
+      }
+      results.push_back(
+        groupby(view.select(key_indices), include_null_keys).aggregate(requests, stream, mr));
+      return;
+    }
+
+    auto const num_partitions = num_partitions_for(memory_size, memory_budget);
+    std::vector<std::vector<spilled_table>> sub_buckets(num_partitions);
+    for (auto const& spilled : bucket) {
+      auto const packed   = cudf::detail::unspill(spilled, stream);
+      auto sub_partitions = partition_and_spill(
+        cudf::unpack(packed), num_keys, num_partitions, depth, stream);
+      for (std::size_t i = 0; i < num_partitions; ++i) {
+        sub_buckets[i].push_back(std::move(sub_partitions[i]));
+      }
+    }
+    // the sub-buckets are released once aggregated
+    for (auto& sub_bucket : sub_buckets) {
+      aggregate(sub_bucket, depth + 1, stream, mr);
+      sub_bucket = {};
+    }
+  }
+};
+
+/**
+ * @brief Concatenates the keys and the results of each aggregation of groupby results.
+ */
+groupby_result concatenate_results(std::vector<groupby_result> const& parts,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  std::vector<table_view> keys;
+  std::transform(parts.begin(), parts.end(), std::back_inserter(keys), [](auto const& part) {
+    return part.first->view();
+  });
+  auto result_keys = cudf::detail::concatenate(keys, stream, mr);
+
+  auto const& first = parts.front().second;
+  std::vector<aggregation_result> results(first.size());
+  for (std::size_t i = 0; i < first.size(); ++i) {
+    for (std::size_t j = 0; j < first[i].results.size(); ++j) {
+      std::vector<column_view> columns;
+      for (auto const& part : parts) {
+        columns.push_back(part.second[i].results[j]->view());
+      }
+      results[i].results.push_back(cudf::detail::concatenate(columns, stream, mr));
+    }
+  }
+  return {std::move(result_keys), std::move(results)};
+}
+
+}  // namespace
+
+partitioned_groupby::~partitioned_groupby() = default;
+
+partitioned_groupby::partitioned_groupby(partitioned_groupby&&) = default;
+
+partitioned_groupby& partitioned_groupby::operator=(partitioned_groupby&&) = default;
+
+partitioned_groupby::partitioned_groupby(
+  std::vector<std::vector<std::unique_ptr<groupby_aggregation>>> aggregations,
+  size_type num_partitions,
+  std::size_t memory_budget,
+  null_policy null_handling)
+  : _include_null_keys{null_handling},
+    _aggregations{std::move(aggregations)},
+    _num_partitions{num_partitions},
+    _memory_budget{memory_budget}
+{
+  CUDF_EXPECTS(num_partitions > 0, "The number of partitions must be positive");
+  CUDF_EXPECTS(memory_budget > 0, "The memory budget must be positive");
+  _partitions.resize(num_partitions);
+}
+
+void partitioned_groupby::add_batch(table_view const& keys,
+                                    host_span<column_view const> values,
+                                    rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(values.size() == _aggregations.size(),
+               "Mismatch in number of value columns and aggregation lists");
+  CUDF_EXPECTS(std::all_of(values.begin(),
+                           values.end(),
+                           [&](auto const& col) { return col.size() == keys.num_rows(); }),
+               "Size mismatch between keys and values");
+
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  columns.insert(columns.end(), values.begin(), values.end());
+  std::vector<data_type> types;
+  std::transform(columns.begin(), columns.end(), std::back_inserter(types), [](auto const& col) {
+    return col.type();
+  });
+  if (_types.empty()) {
+    _num_keys = keys.num_columns();
+    _types    = std::move(types);
+  } else {
+    CUDF_EXPECTS(keys.num_columns() == _num_keys and types == _types,
+                 "The types of the keys or values differ from the previous batches");
+  }
+
+  auto partitions = partition_and_spill(
+    table_view{columns}, _num_keys, static_cast<std::size_t>(_num_partitions), 0, stream);
+  for (size_type i = 0; i < _num_partitions; ++i) {
+    _partitions[i].push_back(std::move(partitions[i]));
+  }
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+partitioned_groupby::aggregate_partition(size_type partition,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(partition >= 0 and partition < _num_partitions,
+               "Partition index out of bounds",
+               std::out_of_range);
+  CUDF_EXPECTS(not _types.empty(), "No batch was added to the partitioned groupby");
+
+  bucket_aggregator aggregator{_aggregations, _num_keys, _include_null_keys, _memory_budget};
+  aggregator.aggregate(_partitions[partition], 1, stream, mr);
+  if (aggregator.results.size() == 1) { return std::move(aggregator.results.front()); }
+  return concatenate_results(aggregator.results, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> partitioned_groupby::finalize(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  if (_num_partitions == 1) { return aggregate_partition(0, stream, mr); }
+
+  std::vector<groupby_result> partitions;
+  for (size_type i = 0; i < _num_partitions; ++i) {
+    partitions.push_back(aggregate_partition(i, stream, rmm::mr::get_current_device_resource()));
+  }
+  return concatenate_results(partitions, stream, mr);
+}
+
+}  // namespace groupby
+}  // namespace cudf
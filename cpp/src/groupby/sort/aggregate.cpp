@@ -20,13 +20,16 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/aggregation/hllpp.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -791,6 +794,83 @@ void aggregate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregatio
                                                               mr));
 }
 
+/**
+ * @brief Generate a HyperLogLog++ sketch of the grouped values of each group.
+ *
+ * The sketches are struct columns of int64 fields, each of which packs 10 registers of 6 bits.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::HLLPP>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision = dynamic_cast<cudf::detail::hllpp_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   detail::group_hllpp(get_grouped_values(),
+                                       helper.group_labels(stream),
+                                       helper.num_groups(stream),
+                                       precision,
+                                       stream,
+                                       mr));
+}
+
+/**
+ * @brief Merge the grouped HyperLogLog++ sketches of each group into a single sketch.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::MERGE_HLLPP>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision = dynamic_cast<cudf::detail::merge_hllpp_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   detail::group_merge_hllpp(get_grouped_values(),
+                                             helper.group_labels(stream),
+                                             helper.num_groups(stream),
+                                             precision,
+                                             stream,
+                                             mr));
+}
+
+/**
+ * @brief Collect the `k` largest or smallest non-null values of each group into a list.
+ *
+ * Bounded heaps select the candidates among the grouped values so that only the candidates are
+ * sorted, instead of all the values of each group.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::TOP_K>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const& top_k_agg = dynamic_cast<cudf::detail::top_k_aggregation const&>(agg);
+  auto [indices, offsets] =
+    cudf::detail::segmented_top_k_order(get_grouped_values(),
+                                        helper.group_offsets(stream),
+                                        helper.group_labels(stream),
+                                        top_k_agg._k,
+                                        top_k_agg._sort_order,
+                                        stream,
+                                        mr);
+  auto top_values = cudf::detail::gather(table_view{{get_grouped_values()}},
+                                         indices->view(),
+                                         cudf::out_of_bounds_policy::DONT_CHECK,
+                                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                         stream,
+                                         mr);
+  cache.add_result(values,
+                   agg,
+                   make_lists_column(helper.num_groups(stream),
+                                     std::move(offsets),
+                                     std::move(top_values->release().front()),
+                                     0,
+                                     {},
+                                     stream,
+                                     mr));
+}
+
 }  // namespace detail
 
 // Sort-based groupby
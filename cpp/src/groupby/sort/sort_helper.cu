@@ -45,6 +45,7 @@
 #include <algorithm>
 #include <numeric>
 #include <tuple>
+#include <type_traits>
 
 namespace cudf {
 namespace groupby {
@@ -144,36 +145,44 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_offsets(
 
   auto const comparator = cudf::experimental::row::equality::self_comparator{_keys, stream};
 
-  auto const sorted_order = key_sort_order(stream).data<size_type>();
-  decltype(group_offsets->begin()) result_end;
-
-  if (cudf::detail::has_nested_columns(_keys)) {
-    auto const d_key_equal = comparator.equal_to<true>(
-      cudf::nullate::DYNAMIC{cudf::has_nested_nulls(_keys)}, null_equality::EQUAL);
-    // Using a temporary buffer for intermediate transform results from the iterator containing
-    // the comparator speeds up compile-time significantly without much degradation in
-    // runtime performance over using the comparator directly in thrust::unique_copy.
-    auto result       = rmm::device_uvector<bool>(size, stream);
-    auto const itr    = thrust::make_counting_iterator<size_type>(0);
-    auto const row_eq = permuted_row_equality_comparator(d_key_equal, sorted_order);
-    auto const ufn    = cudf::detail::unique_copy_fn<decltype(itr), decltype(row_eq)>{
-      itr, duplicate_keep_option::KEEP_FIRST, row_eq, size - 1};
-    thrust::transform(rmm::exec_policy(stream), itr, itr + size, result.begin(), ufn);
-    result_end = thrust::copy_if(rmm::exec_policy(stream),
-                                 itr,
-                                 itr + size,
-                                 result.begin(),
-                                 group_offsets->begin(),
-                                 thrust::identity<bool>{});
-  } else {
-    auto const d_key_equal = comparator.equal_to<false>(
-      cudf::nullate::DYNAMIC{cudf::has_nested_nulls(_keys)}, null_equality::EQUAL);
-    result_end = thrust::unique_copy(rmm::exec_policy(stream),
-                                     thrust::counting_iterator<size_type>(0),
-                                     thrust::counting_iterator<size_type>(size),
-                                     group_offsets->begin(),
-                                     permuted_row_equality_comparator(d_key_equal, sorted_order));
-  }
+  // Presorted (or only clustered) keys are compared in place, without the identity sort order
+  auto const find_group_offsets = [&](auto const& row_eq) {
+    if (cudf::detail::has_nested_columns(_keys)) {
+      // Using a temporary buffer for intermediate transform results from the iterator containing
+      // the comparator speeds up compile-time significantly without much degradation in
+      // runtime performance over using the comparator directly in thrust::unique_copy.
+      auto result    = rmm::device_uvector<bool>(size, stream);
+      auto const itr = thrust::make_counting_iterator<size_type>(0);
+      auto const ufn = cudf::detail::unique_copy_fn<decltype(itr), std::decay_t<decltype(row_eq)>>{
+        itr, duplicate_keep_option::KEEP_FIRST, row_eq, size - 1};
+      thrust::transform(rmm::exec_policy(stream), itr, itr + size, result.begin(), ufn);
+      return thrust::copy_if(rmm::exec_policy(stream),
+                             itr,
+                             itr + size,
+                             result.begin(),
+                             group_offsets->begin(),
+                             thrust::identity<bool>{});
+    }
+    return thrust::unique_copy(rmm::exec_policy(stream),
+                               thrust::counting_iterator<size_type>(0),
+                               thrust::counting_iterator<size_type>(size),
+                               group_offsets->begin(),
+                               row_eq);
+  };
+
+  auto const result_end = [&] {
+    auto const nullate = cudf::nullate::DYNAMIC{cudf::has_nested_nulls(_keys)};
+    if (cudf::detail::has_nested_columns(_keys)) {
+      auto const d_key_equal = comparator.equal_to<true>(nullate, null_equality::EQUAL);
+      if (is_presorted()) { return find_group_offsets(d_key_equal); }
+      return find_group_offsets(
+        permuted_row_equality_comparator(d_key_equal, key_sort_order(stream).data<size_type>()));
+    }
+    auto const d_key_equal = comparator.equal_to<false>(nullate, null_equality::EQUAL);
+    if (is_presorted()) { return find_group_offsets(d_key_equal); }
+    return find_group_offsets(
+      permuted_row_equality_comparator(d_key_equal, key_sort_order(stream).data<size_type>()));
+  }();
 
   auto const num_groups = thrust::distance(group_offsets->begin(), result_end);
   group_offsets->set_element_async(num_groups, size, stream);
@@ -206,6 +215,13 @@ column_view sort_groupby_helper::unsorted_keys_labels(rmm::cuda_stream_view stre
 {
   if (_unsorted_keys_labels) return _unsorted_keys_labels->view();
 
+  if (is_presorted()) {
+    // The keys are in group order already, so the labels need no scatter
+    auto const& labels = group_labels(stream);
+    return column_view(
+      data_type(type_to_id<size_type>()), labels.size(), labels.data(), nullptr, 0);
+  }
+
   column_ptr temp_labels = make_numeric_column(
     data_type(type_to_id<size_type>()), _keys.num_rows(), mask_state::ALL_NULL, stream);
 
@@ -250,12 +266,21 @@ column_view sort_groupby_helper::keys_bitmask_column(rmm::cuda_stream_view strea
 sort_groupby_helper::column_ptr sort_groupby_helper::sorted_values(
   column_view const& values, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
 {
-  column_ptr values_sort_order =
-    cudf::detail::stable_sorted_order(table_view({unsorted_keys_labels(stream), values}),
-                                      {},
-                                      std::vector<null_order>(2, null_order::AFTER),
-                                      stream,
-                                      mr);
+  auto const values_sort_order = [&] {
+    if (is_presorted()) {
+      // Grouped values only need to be sorted within each group
+      auto const& offsets = group_offsets(stream);
+      auto const offsets_view =
+        column_view(data_type(type_to_id<size_type>()), offsets.size(), offsets.data(), nullptr, 0);
+      return cudf::detail::stable_segmented_sorted_order(
+        table_view({values}), offsets_view, {}, {null_order::AFTER}, stream, mr);
+    }
+    return cudf::detail::stable_sorted_order(table_view({unsorted_keys_labels(stream), values}),
+                                             {},
+                                             std::vector<null_order>(2, null_order::AFTER),
+                                             stream,
+                                             mr);
+  }();
 
   // Zero-copy slice this sort order so that its new size is num_keys()
   column_view gather_map =
@@ -289,6 +314,16 @@ sort_groupby_helper::column_ptr sort_groupby_helper::grouped_values(
 std::unique_ptr<table> sort_groupby_helper::unique_keys(rmm::cuda_stream_view stream,
                                                         rmm::mr::device_memory_resource* mr)
 {
+  if (is_presorted()) {
+    auto const& offsets = group_offsets(stream);
+    return cudf::detail::gather(_keys,
+                                offsets.begin(),
+                                offsets.begin() + num_groups(stream),
+                                out_of_bounds_policy::DONT_CHECK,
+                                stream,
+                                mr);
+  }
+
   auto idx_data = key_sort_order(stream).data<size_type>();
 
   auto gather_map_it =
@@ -307,6 +342,8 @@ std::unique_ptr<table> sort_groupby_helper::unique_keys(rmm::cuda_stream_view st
 std::unique_ptr<table> sort_groupby_helper::sorted_keys(rmm::cuda_stream_view stream,
                                                         rmm::mr::device_memory_resource* mr)
 {
+  if (is_presorted()) { return std::make_unique<table>(_keys, stream, mr); }
+
   return cudf::detail::gather(_keys,
                               key_sort_order(stream),
                               cudf::out_of_bounds_policy::DONT_CHECK,
@@ -0,0 +1,917 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/hash_reduce_by_row.cuh>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/scatter.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/hashing/detail/helper_functions.cuh>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuda/functional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+using cudf::experimental::row::lhs_index_type;
+using cudf::experimental::row::rhs_index_type;
+
+// Columns of the (COUNT_VALID, MEAN, M2) structs merged by MERGE_M2
+constexpr size_type m2_count_column = 0;
+constexpr size_type m2_mean_column  = 1;
+constexpr size_type m2_column       = 2;
+
+// Empty key and value of the map from the stored keys to their slots
+constexpr size_type empty_key    = -1;
+constexpr size_type missing_slot = std::numeric_limits<size_type>::min();
+
+std::unique_ptr<groupby_aggregation> clone_aggregation(groupby_aggregation const& agg)
+{
+  return std::unique_ptr<groupby_aggregation>(
+    dynamic_cast<groupby_aggregation*>(agg.clone().release()));
+}
+
+bool is_m2_based(aggregation::Kind kind)
+{
+  return kind == aggregation::M2 or kind == aggregation::VARIANCE or kind == aggregation::STD;
+}
+
+bool is_supported(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::MEAN:
+    case aggregation::M2:
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+    case aggregation::COLLECT_LIST:
+    case aggregation::COLLECT_SET:
+    case aggregation::TDIGEST:
+    case aggregation::HLLPP: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns the aggregations computed on the values of a batch for aggregation `agg`.
+ */
+std::vector<std::unique_ptr<groupby_aggregation>> batch_aggregations(
+  groupby_aggregation const& agg)
+{
+  std::vector<std::unique_ptr<groupby_aggregation>> aggs;
+  if (agg.kind == aggregation::MEAN) {
+    aggs.push_back(make_sum_aggregation<groupby_aggregation>());
+    aggs.push_back(make_count_aggregation<groupby_aggregation>());
+  } else if (is_m2_based(agg.kind)) {
+    aggs.push_back(make_count_aggregation<groupby_aggregation>());
+    aggs.push_back(make_mean_aggregation<groupby_aggregation>());
+    aggs.push_back(make_m2_aggregation<groupby_aggregation>());
+  } else {
+    aggs.push_back(clone_aggregation(agg));
+  }
+  return aggs;
+}
+
+/**
+ * @brief Returns the aggregations that merge the partial states of aggregation `agg`.
+ */
+std::vector<std::unique_ptr<groupby_aggregation>> merge_aggregations(
+  groupby_aggregation const& agg)
+{
+  std::vector<std::unique_ptr<groupby_aggregation>> aggs;
+  switch (agg.kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: aggs.push_back(make_sum_aggregation<groupby_aggregation>()); break;
+    case aggregation::MEAN:
+      aggs.push_back(make_sum_aggregation<groupby_aggregation>());
+      aggs.push_back(make_sum_aggregation<groupby_aggregation>());
+      break;
+    case aggregation::M2:
+    case aggregation::VARIANCE:
+    case aggregation::STD: aggs.push_back(make_merge_m2_aggregation<groupby_aggregation>()); break;
+    case aggregation::COLLECT_LIST:
+      aggs.push_back(make_merge_lists_aggregation<groupby_aggregation>());
+      break;
+    case aggregation::COLLECT_SET: {
+      auto const& set_agg = dynamic_cast<cudf::detail::collect_set_aggregation const&>(agg);
+      aggs.push_back(make_merge_sets_aggregation<groupby_aggregation>(set_agg._nulls_equal,
+                                                                       set_agg._nans_equal));
+      break;
+    }
+    case aggregation::TDIGEST: {
+      auto const& tdigest_agg = dynamic_cast<cudf::detail::tdigest_aggregation const&>(agg);
+      aggs.push_back(
+        make_merge_tdigest_aggregation<groupby_aggregation>(tdigest_agg.max_centroids));
+      break;
+    }
+    case aggregation::HLLPP: {
+      auto const& hllpp_agg = dynamic_cast<cudf::detail::hllpp_aggregation const&>(agg);
+      aggs.push_back(make_merge_hllpp_aggregation<groupby_aggregation>(hllpp_agg.precision));
+      break;
+    }
+    default: aggs.push_back(clone_aggregation(agg));
+  }
+  return aggs;
+}
+
+/**
+ * @brief Converts the results of `batch_aggregations` of a batch into partial states.
+ *
+ * Counts are widened to the type of their merged SUM, and the results of M2-based aggregations
+ * are combined in the structs merged by MERGE_M2.
+ */
+std::vector<std::unique_ptr<column>> to_states(aggregation::Kind kind,
+                                               std::vector<std::unique_ptr<column>>&& results,
+                                               size_type num_groups,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto const widen_count = [&](std::unique_ptr<column>& count) {
+    count = cudf::detail::cast(
+      count->view(), cudf::detail::target_type(count->type(), aggregation::SUM), stream, mr);
+  };
+  if (kind == aggregation::COUNT_VALID or kind == aggregation::COUNT_ALL) {
+    widen_count(results.front());
+  } else if (kind == aggregation::MEAN) {
+    widen_count(results.back());
+  } else if (is_m2_based(kind)) {
+    std::vector<std::unique_ptr<column>> states;
+    states.push_back(
+      make_structs_column(num_groups, std::move(results), 0, rmm::device_buffer{}, stream, mr));
+    return states;
+  }
+  return std::move(results);
+}
+
+/**
+ * @brief Computes the result of aggregation `agg` from its merged partial states.
+ */
+std::unique_ptr<column> finalize_state(groupby_aggregation const& agg,
+                                       data_type values_type,
+                                       host_span<std::unique_ptr<column> const> states,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  switch (agg.kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+      return cudf::detail::cast(
+        states.front()->view(), cudf::detail::target_type(values_type, agg.kind), stream, mr);
+    case aggregation::MEAN:
+      return cudf::detail::binary_operation(states[0]->view(),
+                                            states[1]->view(),
+                                            binary_operator::DIV,
+                                            cudf::detail::target_type(values_type, agg.kind),
+                                            stream,
+                                            mr);
+    case aggregation::M2:
+      return std::make_unique<column>(states.front()->view().child(m2_column), stream, mr);
+    case aggregation::VARIANCE:
+    case aggregation::STD: {
+      auto const& var_agg   = dynamic_cast<cudf::detail::std_var_aggregation const&>(agg);
+      auto const temp_mr    = rmm::mr::get_current_device_resource();
+      auto const state      = states.front()->view();
+      auto const count_type = state.child(m2_count_column).type();
+      auto const ddof       = make_fixed_width_scalar(var_agg._ddof, stream, temp_mr);
+      auto const zero       = make_fixed_width_scalar(size_type{0}, stream, temp_mr);
+
+      auto const divisor = cudf::detail::binary_operation(
+        state.child(m2_count_column), *ddof, binary_operator::SUB, count_type, stream, temp_mr);
+      auto const is_valid = cudf::detail::binary_operation(divisor->view(),
+                                                           *zero,
+                                                           binary_operator::GREATER,
+                                                           data_type{type_id::BOOL8},
+                                                           stream,
+                                                           temp_mr);
+      auto const result_type = cudf::detail::target_type(values_type, agg.kind);
+      auto const variance    = cudf::detail::binary_operation(state.child(m2_column),
+                                                           divisor->view(),
+                                                           binary_operator::DIV,
+                                                           result_type,
+                                                           stream,
+                                                           temp_mr);
+      // Groups with no more valid values than the delta degrees of freedom have no variance
+      auto const null_variance = make_default_constructed_scalar(result_type, stream, temp_mr);
+      if (agg.kind == aggregation::VARIANCE) {
+        return cudf::detail::copy_if_else(
+          variance->view(), *null_variance, is_valid->view(), stream, mr);
+      }
+      auto const valid_variance = cudf::detail::copy_if_else(
+        variance->view(), *null_variance, is_valid->view(), stream, temp_mr);
+      return cudf::detail::unary_operation(
+        valid_variance->view(), unary_operator::SQRT, stream, mr);
+    }
+    default: return std::make_unique<column>(states.front()->view(), stream, mr);
+  }
+}
+
+
+/**
+ * @brief Returns the map key of row `i` of a batch of keys.
+ *
+ * Only the slots of the stored keys, which are not negative, are inserted into the map. The rows
+ * of a batch are looked up with negative keys, below the empty key, so the hasher and comparator
+ * can tell them apart.
+ */
+__device__ constexpr size_type batch_key(size_type i) { return -i - 2; }
+
+/**
+ * @brief Returns the row of a batch of keys looked up with map key `key`.
+ */
+__device__ constexpr size_type batch_row(size_type key) { return -key - 2; }
+
+struct batch_key_fn {
+  __device__ size_type operator()(size_type i) const { return batch_key(i); }
+};
+
+struct slot_pair_fn {
+  __device__ cuco::pair<size_type, size_type> operator()(size_type slot) const
+  {
+    return cuco::make_pair(slot, slot);
+  }
+};
+
+struct is_missing_slot_fn {
+  __device__ bool operator()(size_type slot) const { return slot == missing_slot; }
+};
+
+/**
+ * @brief Hasher of the map keys, hashing either a stored key or a row of a batch.
+ */
+template <typename StoredHasher, typename BatchHasher>
+struct slot_hasher {
+  slot_hasher(StoredHasher const& stored_hasher, BatchHasher const& batch_hasher)
+    : _stored_hasher{stored_hasher}, _batch_hasher{batch_hasher}
+  {
+  }
+
+  __device__ auto operator()(size_type key) const
+  {
+    return key >= 0 ? _stored_hasher(key) : _batch_hasher(batch_row(key));
+  }
+
+ private:
+  StoredHasher const _stored_hasher;
+  BatchHasher const _batch_hasher;
+};
+
+/**
+ * @brief Comparator of the map keys, comparing stored keys with each other or with a row of a
+ * batch.
+ */
+template <typename SelfEqual, typename TwoTableEqual>
+struct slot_equal {
+  slot_equal(SelfEqual const& self_equal, TwoTableEqual const& two_table_equal)
+    : _self_equal{self_equal}, _two_table_equal{two_table_equal}
+  {
+  }
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (lhs >= 0 and rhs >= 0) { return _self_equal(lhs, rhs); }
+    if (lhs >= 0) { return _two_table_equal(lhs_index_type{lhs}, rhs_index_type{batch_row(rhs)}); }
+    if (rhs >= 0) { return _two_table_equal(lhs_index_type{rhs}, rhs_index_type{batch_row(lhs)}); }
+    // Rows of a batch are never inserted into the map
+    return false;
+  }
+
+ private:
+  SelfEqual const _self_equal;
+  TwoTableEqual const _two_table_equal;
+};
+
+/**
+ * @brief Invokes `func` with the hasher and comparator of the map keys of `stored` and `batch`.
+ */
+template <typename Func>
+void with_slot_functors(table_view const& stored,
+                        table_view const& batch,
+                        rmm::cuda_stream_view stream,
+                        Func&& func)
+{
+  auto const has_nulls =
+    nullate::DYNAMIC{cudf::has_nested_nulls(stored) or cudf::has_nested_nulls(batch)};
+  auto const stored_hasher = cudf::experimental::row::hash::row_hasher(stored, stream);
+  auto const batch_hasher  = cudf::experimental::row::hash::row_hasher(batch, stream);
+  auto const hasher =
+    slot_hasher{stored_hasher.device_hasher(has_nulls), batch_hasher.device_hasher(has_nulls)};
+
+  auto const self_equal      = cudf::experimental::row::equality::self_comparator(stored, stream);
+  auto const two_table_equal =
+    cudf::experimental::row::equality::two_table_comparator(stored, batch, stream);
+  if (cudf::has_nested_columns(stored)) {
+    func(hasher,
+         slot_equal{self_equal.equal_to<true>(has_nulls, null_equality::EQUAL),
+                    two_table_equal.equal_to<true>(has_nulls, null_equality::EQUAL)});
+  } else {
+    func(hasher,
+         slot_equal{self_equal.equal_to<false>(has_nulls, null_equality::EQUAL),
+                    two_table_equal.equal_to<false>(has_nulls, null_equality::EQUAL)});
+  }
+}
+
+/**
+ * @brief Inserts the slots from `first_slot` to the last stored key into the map.
+ */
+void insert_slots(cudf::detail::hash_map_type& map,
+                  table_view const& keys,
+                  size_type first_slot,
+                  rmm::cuda_stream_view stream)
+{
+  auto const slots = cudf::detail::make_counting_transform_iterator(first_slot, slot_pair_fn{});
+  // Only stored keys are inserted, so the batch side of the functors is not used
+  with_slot_functors(keys, keys, stream, [&](auto const& hasher, auto const& key_equal) {
+    map.insert(slots, slots + (keys.num_rows() - first_slot), hasher, key_equal, stream.value());
+  });
+}
+
+/**
+ * @brief Merges the fixed-width state of each group of a batch into the stored state of its slot.
+ *
+ * The groups of a batch have distinct slots, so each stored state is updated by a single thread.
+ */
+template <typename T, aggregation::Kind k>
+struct merge_element_fn {
+  column_device_view source;
+  mutable_column_device_view target;
+  size_type const* group_slots;
+  size_type num_stored;
+
+  __device__ void operator()(size_type group) const
+  {
+    auto const slot = group_slots[group];
+    if (slot >= num_stored or source.is_null(group)) { return; }
+    auto const value = source.element<T>(group);
+    if (target.is_null(slot)) {
+      target.element<T>(slot) = value;
+      target.set_valid(slot);
+    } else {
+      target.element<T>(slot) =
+        static_cast<T>(cudf::detail::corresponding_operator_t<k>{}(target.element<T>(slot), value));
+    }
+  }
+};
+
+/**
+ * @brief Whether the stored state of the slot of a group of a batch is null and the state of the
+ * group is valid.
+ */
+struct becomes_valid_fn {
+  column_device_view source;
+  mutable_column_device_view target;
+  size_type const* group_slots;
+  size_type num_stored;
+
+  __device__ bool operator()(size_type group) const
+  {
+    auto const slot = group_slots[group];
+    return slot < num_stored and source.is_valid(group) and target.is_null(slot);
+  }
+};
+
+/**
+ * @brief Merges the states of the groups of a batch into the stored states in place, for the
+ * fixed-width states merged with aggregation `k`.
+ */
+template <aggregation::Kind k>
+struct merge_in_place_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_fixed_width<T>() and cudf::detail::is_valid_aggregation<T, k>() and
+           std::is_same_v<cudf::detail::target_type_t<T, k>, T>;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported<T>(), bool> operator()(Args&&...) const
+  {
+    return false;
+  }
+
+  /**
+   * @return true if the states were merged, false if their type is not merged in place
+   */
+  template <typename T>
+  std::enable_if_t<is_supported<T>(), bool> operator()(column_view const& batch_state,
+                                                       column& stored_state,
+                                                       device_span<size_type const> group_slots,
+                                                       rmm::cuda_stream_view stream) const
+  {
+    using storage_type = device_storage_type_t<T>;
+
+    auto const source     = column_device_view::create(batch_state, stream);
+    auto const target     = mutable_column_device_view::create(stored_state.mutable_view(), stream);
+    auto const num_stored = stored_state.size();
+
+    // Stored states that are null become valid if the state of their batch group is valid
+    auto const num_new_valid =
+      stored_state.nullable()
+        ? thrust::count_if(rmm::exec_policy(stream),
+                           thrust::make_counting_iterator<size_type>(0),
+                           thrust::make_counting_iterator<size_type>(batch_state.size()),
+                           becomes_valid_fn{*source, *target, group_slots.data(), num_stored})
+        : 0;
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       batch_state.size(),
+                       merge_element_fn<storage_type, k>{
+                         *source, *target, group_slots.data(), num_stored});
+    if (stored_state.nullable()) {
+      stored_state.set_null_count(stored_state.null_count() - num_new_valid);
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Merges the (COUNT_VALID, MEAN, M2) state of each group of a batch into the stored state
+ * of its slot, like MERGE_M2.
+ */
+struct merge_m2_element_fn {
+  column_device_view source_count;
+  column_device_view source_mean;
+  column_device_view source_m2;
+  mutable_column_device_view target_count;
+  mutable_column_device_view target_mean;
+  mutable_column_device_view target_m2;
+  size_type const* group_slots;
+  size_type num_stored;
+
+  __device__ void operator()(size_type group) const
+  {
+    auto const slot = group_slots[group];
+    if (slot >= num_stored) { return; }
+    auto const count = source_count.element<size_type>(group);
+    if (count == 0) { return; }
+    auto const stored_count = target_count.element<size_type>(slot);
+    auto const mean         = source_mean.element<double>(group);
+    auto const m2           = source_m2.element<double>(group);
+    if (stored_count == 0) {
+      target_mean.element<double>(slot) = mean;
+      target_m2.element<double>(slot)   = m2;
+      if (target_mean.nullable()) { target_mean.set_valid(slot); }
+      if (target_m2.nullable()) { target_m2.set_valid(slot); }
+    } else {
+      auto const total       = static_cast<double>(stored_count) + count;
+      auto const stored_mean = target_mean.element<double>(slot);
+      auto const delta       = mean - stored_mean;
+
+      target_mean.element<double>(slot) = stored_mean + delta * count / total;
+      target_m2.element<double>(slot) += m2 + delta * delta * stored_count * count / total;
+    }
+    target_count.element<size_type>(slot) = stored_count + count;
+  }
+};
+
+/**
+ * @brief Whether the stored state of the slot of a group of a batch has no valid value and the
+ * state of the group has some.
+ */
+struct m2_becomes_valid_fn {
+  column_device_view source_count;
+  mutable_column_device_view target_count;
+  size_type const* group_slots;
+  size_type num_stored;
+
+  __device__ bool operator()(size_type group) const
+  {
+    auto const slot = group_slots[group];
+    return slot < num_stored and source_count.element<size_type>(group) > 0 and
+           target_count.element<size_type>(slot) == 0;
+  }
+};
+
+/**
+ * @brief Merges the (COUNT_VALID, MEAN, M2) states of the groups of a batch into the stored
+ * states in place.
+ *
+ * @return true if the states were merged, false if their children do not have the types
+ * produced by the numeric M2 aggregations
+ */
+bool merge_m2_in_place(column_view const& batch_state,
+                       column& stored_state,
+                       device_span<size_type const> group_slots,
+                       rmm::cuda_stream_view stream)
+{
+  auto const is_m2_state = [](column_view const& state) {
+    return state.child(m2_count_column).type().id() == type_to_id<size_type>() and
+           state.child(m2_mean_column).type().id() == type_id::FLOAT64 and
+           state.child(m2_column).type().id() == type_id::FLOAT64;
+  };
+  if (not is_m2_state(batch_state) or not is_m2_state(stored_state.view())) { return false; }
+
+  auto const num_stored = stored_state.size();
+  auto target           = stored_state.mutable_view();
+
+  auto const source_count = column_device_view::create(batch_state.child(m2_count_column), stream);
+  auto const target_count =
+    mutable_column_device_view::create(target.child(m2_count_column), stream);
+
+  // The mean and M2 of a group are null until it has a valid value
+  auto const num_new_valid =
+    thrust::count_if(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(batch_state.size()),
+                     m2_becomes_valid_fn{
+                       *source_count, *target_count, group_slots.data(), num_stored});
+
+  auto const source_mean = column_device_view::create(batch_state.child(m2_mean_column), stream);
+  auto const source_m2   = column_device_view::create(batch_state.child(m2_column), stream);
+  auto const target_mean = mutable_column_device_view::create(target.child(m2_mean_column), stream);
+  auto const target_m2   = mutable_column_device_view::create(target.child(m2_column), stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     batch_state.size(),
+                     merge_m2_element_fn{*source_count,
+                                         *source_mean,
+                                         *source_m2,
+                                         *target_count,
+                                         *target_mean,
+                                         *target_m2,
+                                         group_slots.data(),
+                                         num_stored});
+  for (auto const child : {m2_mean_column, m2_column}) {
+    auto& stored_child = stored_state.child(child);
+    if (stored_child.nullable()) {
+      stored_child.set_null_count(stored_child.null_count() - num_new_valid);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Merges the states of the groups of a batch that are not merged in place into the
+ * stored states, with the merge aggregation `merge_agg`.
+ *
+ * Only the stored states of the slots of the batch groups are gathered and merged with the
+ * states of the batch, then scattered back.
+ */
+std::unique_ptr<column> merge_by_slot(column_view const& stored_state,
+                                      column_view const& batch_state,
+                                      groupby_aggregation const& merge_agg,
+                                      device_span<size_type const> group_slots,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto const temp_mr    = rmm::mr::get_current_device_resource();
+  auto const num_stored = stored_state.size();
+
+  rmm::device_uvector<size_type> groups(group_slots.size(), stream);
+  auto const groups_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(
+                      static_cast<size_type>(group_slots.size())),
+                    group_slots.begin(),
+                    groups.begin(),
+                    cuda::proclaim_return_type<bool>(
+                      [num_stored] __device__(size_type slot) { return slot < num_stored; }));
+  groups.resize(std::distance(groups.begin(), groups_end), stream);
+  if (groups.is_empty()) { return nullptr; }
+
+  rmm::device_uvector<size_type> slots(groups.size(), stream);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 groups.begin(),
+                 groups.end(),
+                 group_slots.begin(),
+                 slots.begin());
+  auto const slots_view = column_view{data_type{type_to_id<size_type>()},
+                                      static_cast<size_type>(slots.size()),
+                                      slots.data(),
+                                      nullptr,
+                                      0};
+
+  auto const stored_part = cudf::detail::gather(table_view{{stored_state}},
+                                                slots,
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                stream,
+                                                temp_mr);
+  auto const batch_part  = cudf::detail::gather(table_view{{batch_state}},
+                                               groups,
+                                               out_of_bounds_policy::DONT_CHECK,
+                                               cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                               stream,
+                                               temp_mr);
+  auto const values      = cudf::detail::concatenate(
+    std::vector<column_view>{stored_part->get_column(0).view(), batch_part->get_column(0).view()},
+    stream,
+    temp_mr);
+  auto const keys =
+    cudf::detail::concatenate(std::vector<column_view>{slots_view, slots_view}, stream, temp_mr);
+
+  std::vector<aggregation_request> requests(1);
+  requests.front().values = values->view();
+  requests.front().aggregations.push_back(clone_aggregation(merge_agg));
+  auto [merged_slots, results] =
+    groupby(table_view{{keys->view()}}).aggregate(requests, stream, temp_mr);
+
+  auto merged = cudf::detail::scatter(table_view{{results.front().results.front()->view()}},
+                                      merged_slots->get_column(0).view(),
+                                      table_view{{stored_state}},
+                                      stream,
+                                      mr);
+  return std::move(merged->release().front());
+}
+
+}  // namespace
+
+/**
+ * @brief Map from the stored keys to their slot, which is their row in the stored keys and states.
+ */
+struct streaming_aggregator::slot_map {
+  slot_map(size_type num_slots, rmm::cuda_stream_view stream)
+    : map{compute_hash_table_size(num_slots),
+          cuco::empty_key{empty_key},
+          cuco::empty_value{missing_slot},
+          cudf::detail::cuco_allocator{stream},
+          stream.value()}
+  {
+  }
+
+  cudf::detail::hash_map_type map;
+};
+
+streaming_aggregator::~streaming_aggregator() = default;
+
+streaming_aggregator::streaming_aggregator(streaming_aggregator&&) = default;
+
+streaming_aggregator& streaming_aggregator::operator=(streaming_aggregator&&) = default;
+
+streaming_aggregator::streaming_aggregator(
+  std::vector<std::vector<std::unique_ptr<groupby_aggregation>>> aggregations,
+  null_policy null_handling)
+  : _include_null_keys{null_handling}, _aggregations{std::move(aggregations)}
+{
+  for (auto const& aggs : _aggregations) {
+    CUDF_EXPECTS(std::all_of(aggs.begin(),
+                             aggs.end(),
+                             [](auto const& agg) { return is_supported(agg->kind); }),
+                 "Unsupported aggregation for a streaming groupby");
+  }
+}
+
+void streaming_aggregator::add_batch(table_view const& keys,
+                                     host_span<column_view const> values,
+                                     rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(values.size() == _aggregations.size(),
+               "Mismatch in number of value columns and aggregation lists");
+  CUDF_EXPECTS(std::all_of(values.begin(),
+                           values.end(),
+                           [&](auto const& col) { return col.size() == keys.num_rows(); }),
+               "Size mismatch between keys and values");
+
+  std::vector<data_type> value_types;
+  std::transform(
+    values.begin(), values.end(), std::back_inserter(value_types), [](auto const& col) {
+      return cudf::is_dictionary(col.type()) ? cudf::dictionary_column_view(col).keys().type()
+                                             : col.type();
+    });
+  if (_keys != nullptr) {
+    auto const same_type     = [](auto const& lhs, auto const& rhs) {
+      return lhs.type() == rhs.type();
+    };
+    auto const previous_keys = _keys->view();
+    CUDF_EXPECTS(keys.num_columns() == previous_keys.num_columns() and
+                   std::equal(keys.begin(), keys.end(), previous_keys.begin(), same_type),
+                 "The types of the keys differ from the previous batches");
+    CUDF_EXPECTS(value_types == _value_types,
+                 "The types of the values differ from the previous batches");
+  }
+
+  auto const mr = rmm::mr::get_current_device_resource();
+
+  // Reduce the batch to the partial states of its groups
+  std::vector<aggregation_request> requests(values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    requests[i].values = values[i];
+    for (auto const& agg : _aggregations[i]) {
+      for (auto&& batch_agg : batch_aggregations(*agg)) {
+        requests[i].aggregations.push_back(std::move(batch_agg));
+      }
+    }
+  }
+  auto [batch_keys, batch_results] =
+    groupby(keys, _include_null_keys).aggregate(requests, stream, mr);
+
+  std::vector<std::unique_ptr<column>> batch_states;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    auto result = batch_results[i].results.begin();
+    for (auto const& agg : _aggregations[i]) {
+      auto const num_results = static_cast<std::ptrdiff_t>(batch_aggregations(*agg).size());
+      std::vector<std::unique_ptr<column>> agg_results(
+        std::make_move_iterator(result), std::make_move_iterator(result + num_results));
+      result += num_results;
+      for (auto&& state :
+           to_states(agg->kind, std::move(agg_results), batch_keys->num_rows(), stream, mr)) {
+        batch_states.push_back(std::move(state));
+      }
+    }
+  }
+
+  auto const num_batch_groups = batch_keys->num_rows();
+  auto const num_stored       = num_groups();
+  auto const add_slots        = [&](size_type first_slot) {
+    if (_slot_map == nullptr or
+        compute_hash_table_size(num_groups()) > _slot_map->map.get_capacity()) {
+      // Grow the map ahead of the next groups and insert all the stored keys again
+      _slot_map  = std::make_unique<slot_map>(std::max(2 * num_groups(), size_type{1}), stream);
+      first_slot = 0;
+    }
+    insert_slots(_slot_map->map, _keys->view(), first_slot, stream);
+  };
+  if (_keys == nullptr) {
+    _keys        = std::move(batch_keys);
+    _states      = std::move(batch_states);
+    _value_types = std::move(value_types);
+    add_slots(0);
+    return;
+  }
+  if (num_batch_groups == 0) { return; }
+
+  // Look up the slots of the groups of the batch; the new groups get the slots after the stored
+  rmm::device_uvector<size_type> group_slots(num_batch_groups, stream);
+  auto const batch_keys_iter = cudf::detail::make_counting_transform_iterator(0, batch_key_fn{});
+  with_slot_functors(
+    _keys->view(), batch_keys->view(), stream, [&](auto const& hasher, auto const& key_equal) {
+      _slot_map->map.find(batch_keys_iter,
+                          batch_keys_iter + num_batch_groups,
+                          group_slots.begin(),
+                          hasher,
+                          key_equal,
+                          stream.value());
+    });
+  rmm::device_uvector<size_type> new_groups(num_batch_groups, stream);
+  auto const new_groups_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_batch_groups),
+                    group_slots.begin(),
+                    new_groups.begin(),
+                    is_missing_slot_fn{});
+  new_groups.resize(std::distance(new_groups.begin(), new_groups_end), stream);
+  thrust::scatter(rmm::exec_policy_nosync(stream),
+                  thrust::make_counting_iterator<size_type>(num_stored),
+                  thrust::make_counting_iterator<size_type>(
+                    num_stored + static_cast<size_type>(new_groups.size())),
+                  new_groups.begin(),
+                  group_slots.begin());
+
+  // Merge the states of the stored groups of the batch into the stored states
+  auto state       = _states.begin();
+  auto batch_state = batch_states.cbegin();
+  for (auto const& aggs : _aggregations) {
+    for (auto const& agg : aggs) {
+      for (auto const& merge_agg : merge_aggregations(*agg)) {
+        auto& stored              = *state++;
+        auto const source         = (*batch_state++)->view();
+        auto const merge_in_place = [&](auto merge_fn) {
+          return type_dispatcher(stored->type(), merge_fn, source, *stored, group_slots, stream);
+        };
+        auto merged_in_place = false;
+        switch (merge_agg->kind) {
+          case aggregation::SUM:
+            merged_in_place = merge_in_place(merge_in_place_fn<aggregation::SUM>{});
+            break;
+          case aggregation::PRODUCT:
+            merged_in_place = merge_in_place(merge_in_place_fn<aggregation::PRODUCT>{});
+            break;
+          case aggregation::MIN:
+            merged_in_place = merge_in_place(merge_in_place_fn<aggregation::MIN>{});
+            break;
+          case aggregation::MAX:
+            merged_in_place = merge_in_place(merge_in_place_fn<aggregation::MAX>{});
+            break;
+          case aggregation::MERGE_M2:
+            merged_in_place = merge_m2_in_place(source, *stored, group_slots, stream);
+            break;
+          default: break;
+        }
+        if (merged_in_place) { continue; }
+        // Variable-width states are merged with their merge aggregation
+        if (auto merged =
+              merge_by_slot(stored->view(), source, *merge_agg, group_slots, stream, mr)) {
+          stored = std::move(merged);
+        }
+      }
+    }
+  }
+
+  // Append the keys and states of the new groups
+  if (not new_groups.is_empty()) {
+    auto const gather_new = [&](table_view const& input) {
+      return cudf::detail::gather(input,
+                                  new_groups,
+                                  out_of_bounds_policy::DONT_CHECK,
+                                  cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                  stream,
+                                  mr);
+    };
+    auto const new_keys = gather_new(batch_keys->view());
+    _keys               = cudf::detail::concatenate(
+      std::vector<table_view>{_keys->view(), new_keys->view()}, stream, mr);
+    std::vector<column_view> batch_state_views;
+    std::transform(batch_states.begin(),
+                   batch_states.end(),
+                   std::back_inserter(batch_state_views),
+                   [](auto const& col) { return col->view(); });
+    auto const new_states = gather_new(table_view{batch_state_views});
+    for (std::size_t i = 0; i < _states.size(); ++i) {
+      _states[i] = cudf::detail::concatenate(
+        std::vector<column_view>{_states[i]->view(), new_states->get_column(i).view()},
+        stream,
+        mr);
+    }
+    add_slots(num_stored);
+  }
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> streaming_aggregator::finalize(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys != nullptr, "No batch was added to the streaming groupby");
+
+  std::vector<aggregation_result> results(_aggregations.size());
+  auto state = _states.begin();
+  for (std::size_t i = 0; i < _aggregations.size(); ++i) {
+    for (auto const& agg : _aggregations[i]) {
+      auto const num_states = merge_aggregations(*agg).size();
+      results[i].results.push_back(finalize_state(*agg,
+                                                  _value_types[i],
+                                                  host_span<std::unique_ptr<column> const>{
+                                                    &*state, num_states},
+                                                  stream,
+                                                  mr));
+      state += num_states;
+    }
+  }
+  return {std::make_unique<table>(_keys->view(), stream, mr), std::move(results)};
+}
+
+size_type streaming_aggregator::num_groups() const
+{
+  return _keys == nullptr ? 0 : _keys->num_rows();
+}
+
+}  // namespace groupby
+}  // namespace cudf
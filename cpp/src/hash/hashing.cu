@@ -33,6 +33,7 @@ std::unique_ptr<column> hash(table_view const& input,
     case (hash_id::HASH_MURMUR3): return murmurhash3_x86_32(input, seed, stream, mr);
     case (hash_id::HASH_SPARK_MURMUR3): return spark_murmurhash3_x86_32(input, seed, stream, mr);
     case (hash_id::HASH_MD5): return md5(input, stream, mr);
+    case (hash_id::HASH_XXHASH64): return xxhash_64(input, seed, stream, mr);
     default: CUDF_FAIL("Unsupported hash function.");
   }
 }
@@ -57,16 +57,22 @@ struct hash_circular_buffer {
   __device__ inline void put(uint8_t const* in, int size)
   {
     int copy_start = 0;
-    while (size >= available_space) {
+    if (available_space < capacity && size >= available_space) {
       // The buffer will be filled by this chunk of data. Copy a chunk of the
       // data to fill the buffer and trigger a hash step.
-      memcpy(cur, in + copy_start, available_space);
+      memcpy(cur, in, available_space);
       hash_step(storage);
       size -= available_space;
-      copy_start += available_space;
+      copy_start      = available_space;
       cur             = storage;
       available_space = capacity;
     }
+    // Hash each full chunk of the data in place without copying it into the buffer.
+    while (size >= capacity) {
+      hash_step(*reinterpret_cast<uint8_t const(*)[capacity]>(in + copy_start));
+      size -= capacity;
+      copy_start += capacity;
+    }
     // The buffer will not be filled by the remaining data. That is, `size >= 0
     // && size < capacity`. We copy the remaining data into the buffer but do
     // not trigger a hash step.
@@ -16,6 +16,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/hashing/detail/fixed_width_row_hasher.cuh>
 #include <cudf/hashing/detail/hashing.hpp>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
 #include <cudf/table/experimental/row_operators.cuh>
@@ -48,11 +49,13 @@ std::unique_ptr<column> murmurhash3_x86_32(table_view const& input,
   auto const row_hasher = cudf::experimental::row::hash::row_hasher(input, stream);
   auto output_view      = output->mutable_view();
 
-  // Compute the hash value for each row
+  // Compute the hash value for each row; small tables of non-nullable integer columns are hashed
+  // without dispatching on the column types
   thrust::tabulate(rmm::exec_policy(stream),
                    output_view.begin<hash_value_type>(),
                    output_view.end<hash_value_type>(),
-                   row_hasher.device_hasher<MurmurHash3_x86_32>(nullable, seed));
+                   make_fixed_width_row_hasher<MurmurHash3_x86_32>(
+                     input, row_hasher.device_hasher<MurmurHash3_x86_32>(nullable, seed), seed));
 
   return output;
 }
@@ -53,7 +53,10 @@ struct SHA1Hash : HashBase<SHA1Hash> {
   // Number of bytes used for the message length
   static constexpr uint32_t message_length_size = 8;
 
-  __device__ inline void hash_step(hash_state& state) { sha1_hash_step(state); }
+  __device__ inline void hash_step(hash_state& state, uint8_t const* chunk)
+  {
+    sha1_hash_step(state, chunk);
+  }
 
   hash_state state;
 };
@@ -54,7 +54,10 @@ struct SHA256Hash : HashBase<SHA256Hash> {
   // Number of bytes used for the message length
   static constexpr uint32_t message_length_size = 8;
 
-  __device__ inline void hash_step(hash_state& state) { sha256_hash_step(state); }
+  __device__ inline void hash_step(hash_state& state, uint8_t const* chunk)
+  {
+    sha256_hash_step(state, chunk);
+  }
 
   hash_state state;
 };
@@ -61,7 +61,10 @@ struct SHA512Hash : HashBase<SHA512Hash> {
   // Number of bytes used for the message length
   static constexpr uint32_t message_length_size = 16;
 
-  __device__ inline void hash_step(hash_state& state) { sha512_hash_step(state); }
+  __device__ inline void hash_step(hash_state& state, uint8_t const* chunk)
+  {
+    sha512_hash_step(state, chunk);
+  }
 
   hash_state state;
 };
@@ -106,37 +106,36 @@ struct HashBase : public crtp<Hasher> {
    * @brief Execute SHA on input data chunks.
    *
    * This accepts arbitrary data, handles it as bytes, and calls the hash step
-   * when the buffer is filled up to message_chunk_size bytes.
+   * for every message_chunk_size bytes. Full chunks of the input are hashed
+   * in place; only partial chunks are staged in the buffer.
    */
   __device__ inline void process(uint8_t const* data, uint32_t len)
   {
     auto& state = this->underlying().state;
     state.message_length += len;
 
-    if (state.buffer_length + len < Hasher::message_chunk_size) {
-      // The buffer will not be filled by this data. We copy the new data into
-      // the buffer but do not trigger a hash step yet.
-      memcpy(state.buffer + state.buffer_length, data, len);
-      state.buffer_length += len;
-    } else {
-      // The buffer will be filled by this data. Copy a chunk of the data to fill
-      // the buffer and trigger a hash step.
-      uint32_t copylen = Hasher::message_chunk_size - state.buffer_length;
+    if (state.buffer_length > 0) {
+      // Top up the partially filled buffer and trigger a hash step once it is full.
+      uint32_t const copylen = std::min(len, Hasher::message_chunk_size - state.buffer_length);
       memcpy(state.buffer + state.buffer_length, data, copylen);
-      this->underlying().hash_step(state);
-
-      // Take buffer-sized chunks of the data and do a hash step on each chunk.
-      while (len > Hasher::message_chunk_size + copylen) {
-        memcpy(state.buffer, data + copylen, Hasher::message_chunk_size);
-        this->underlying().hash_step(state);
-        copylen += Hasher::message_chunk_size;
-      }
+      state.buffer_length += copylen;
+      data += copylen;
+      len -= copylen;
+      if (state.buffer_length < Hasher::message_chunk_size) { return; }
+      this->underlying().hash_step(state, state.buffer);
+    }
 
-      // The remaining data chunk does not fill the buffer. We copy the data into
-      // the buffer but do not trigger a hash step yet.
-      memcpy(state.buffer, data + copylen, len - copylen);
-      state.buffer_length = len - copylen;
+    // Hash each full chunk of the data without copying it into the buffer.
+    while (len >= Hasher::message_chunk_size) {
+      this->underlying().hash_step(state, data);
+      data += Hasher::message_chunk_size;
+      len -= Hasher::message_chunk_size;
     }
+
+    // The remaining data does not fill the buffer. We copy the data into
+    // the buffer but do not trigger a hash step yet.
+    memcpy(state.buffer, data, len);
+    state.buffer_length = len;
   }
 
   template <typename T>
@@ -188,7 +187,7 @@ struct HashBase : public crtp<Hasher> {
                    state.buffer + state.buffer_length + end_of_message_size,
                    state.buffer + Hasher::message_chunk_size,
                    0x00);
-      this->underlying().hash_step(state);
+      this->underlying().hash_step(state, state.buffer);
 
       // Fill the entire message with zeros up to the final bytes reserved for
       // the message length.
@@ -203,7 +202,7 @@ struct HashBase : public crtp<Hasher> {
     memcpy(state.buffer + Hasher::message_chunk_size - message_length_supported_size,
            reinterpret_cast<uint8_t const*>(&full_length_flipped),
            message_length_supported_size);
-    this->underlying().hash_step(state);
+    this->underlying().hash_step(state, state.buffer);
 
     // Each byte in the word generates two bytes in the hexadecimal string digest.
     // SHA-224 and SHA-384 digests are truncated because their digest does not
@@ -283,15 +282,15 @@ struct HasherDispatcher {
  * @brief Core SHA-1 algorithm implementation
  *
  * Processes a single 512-bit chunk, updating the hash value so far.
- * This does not zero out the buffer contents.
+ * The chunk may be the state buffer or a chunk of the input read in place.
  */
 template <typename hash_state>
-__device__ inline void sha1_hash_step(hash_state& state)
+__device__ inline void sha1_hash_step(hash_state& state, uint8_t const* chunk)
 {
   uint32_t words[80];
 
-  // The 512-bit message buffer fills the first 16 words.
-  memcpy(&words[0], state.buffer, sizeof(words[0]) * 16);
+  // The 512-bit message chunk fills the first 16 words.
+  memcpy(&words[0], chunk, sizeof(words[0]) * 16);
   for (int i = 0; i < 16; i++) {
     // Convert word representation from little-endian to big-endian.
     words[i] = swap_endian(words[i]);
@@ -352,15 +351,15 @@ __device__ inline void sha1_hash_step(hash_state& state)
  * @brief Core SHA-256 algorithm implementation
  *
  * Processes a single 512-bit chunk, updating the hash value so far.
- * This does not zero out the buffer contents.
+ * The chunk may be the state buffer or a chunk of the input read in place.
  */
 template <typename hash_state>
-__device__ inline void sha256_hash_step(hash_state& state)
+__device__ inline void sha256_hash_step(hash_state& state, uint8_t const* chunk)
 {
   uint32_t words[64];
 
-  // The 512-bit message buffer fills the first 16 words.
-  memcpy(&words[0], state.buffer, sizeof(words[0]) * 16);
+  // The 512-bit message chunk fills the first 16 words.
+  memcpy(&words[0], chunk, sizeof(words[0]) * 16);
   for (int i = 0; i < 16; i++) {
     // Convert word representation from little-endian to big-endian.
     words[i] = swap_endian(words[i]);
@@ -420,15 +419,15 @@ __device__ inline void sha256_hash_step(hash_state& state)
  * @brief Core SHA-512 algorithm implementation
  *
  * Processes a single 1024-bit chunk, updating the hash value so far.
- * This does not zero out the buffer contents.
+ * The chunk may be the state buffer or a chunk of the input read in place.
  */
 template <typename hash_state>
-__device__ inline void sha512_hash_step(hash_state& state)
+__device__ inline void sha512_hash_step(hash_state& state, uint8_t const* chunk)
 {
   uint64_t words[80];
 
-  // The 1024-bit message buffer fills the first 16 words.
-  memcpy(&words[0], state.buffer, sizeof(words[0]) * 16);
+  // The 1024-bit message chunk fills the first 16 words.
+  memcpy(&words[0], chunk, sizeof(words[0]) * 16);
   for (int i = 0; i < 16; i++) {
     // Convert word representation from little-endian to big-endian.
     words[i] = swap_endian(words[i]);
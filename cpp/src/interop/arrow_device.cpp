@@ -0,0 +1,509 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Private data of an exported `ArrowSchema` node.
+ */
+struct exported_schema {
+  std::string format;                                 ///< Arrow format string
+  std::string name;                                   ///< Name of the field
+  std::vector<std::unique_ptr<ArrowSchema>> children;  ///< Storage of the children
+  std::vector<ArrowSchema*> child_ptrs;               ///< Children, as exposed to Arrow
+};
+
+/**
+ * @brief Private data of an exported `ArrowArray` node.
+ *
+ * Every node shares the ownership of the exported device memory, so that the children moved out
+ * of the array by a consumer keep it alive.
+ */
+struct exported_array {
+  std::vector<void const*> buffers;                   ///< Buffers, as exposed to Arrow
+  std::vector<std::unique_ptr<ArrowArray>> children;  ///< Storage of the children
+  std::vector<ArrowArray*> child_ptrs;                ///< Children, as exposed to Arrow
+  std::vector<std::shared_ptr<void>> owned;           ///< Device memory backing the buffers
+  cudaEvent_t event{nullptr};                         ///< Sync event of the device array
+};
+
+void release_schema(ArrowSchema* schema)
+{
+  auto* data = static_cast<exported_schema*>(schema->private_data);
+  for (auto& child : data->children) {
+    if (child->release != nullptr) { child->release(child.get()); }
+  }
+  delete data;
+  schema->release = nullptr;
+}
+
+void release_array(ArrowArray* array)
+{
+  auto* data = static_cast<exported_array*>(array->private_data);
+  for (auto& child : data->children) {
+    if (child->release != nullptr) { child->release(child.get()); }
+  }
+  if (data->event != nullptr) { cudaEventDestroy(data->event); }
+  delete data;
+  array->release = nullptr;
+}
+
+/**
+ * @brief Returns the Arrow format string of a column.
+ */
+std::string arrow_format(column_view const& col)
+{
+  auto const decimal_format = [&](std::size_t precision) {
+    return "d:" + std::to_string(precision) + "," + std::to_string(-col.type().scale());
+  };
+  switch (col.type().id()) {
+    case type_id::EMPTY: return "n";
+    case type_id::INT8: return "c";
+    case type_id::INT16: return "s";
+    case type_id::INT32: return "i";
+    case type_id::INT64: return "l";
+    case type_id::UINT8: return "C";
+    case type_id::UINT16: return "S";
+    case type_id::UINT32: return "I";
+    case type_id::UINT64: return "L";
+    case type_id::FLOAT32: return "f";
+    case type_id::FLOAT64: return "g";
+    case type_id::BOOL8: return "b";
+    case type_id::TIMESTAMP_DAYS: return "tdD";
+    case type_id::TIMESTAMP_SECONDS: return "tss:";
+    case type_id::TIMESTAMP_MILLISECONDS: return "tsm:";
+    case type_id::TIMESTAMP_MICROSECONDS: return "tsu:";
+    case type_id::TIMESTAMP_NANOSECONDS: return "tsn:";
+    case type_id::DURATION_SECONDS: return "tDs";
+    case type_id::DURATION_MILLISECONDS: return "tDm";
+    case type_id::DURATION_MICROSECONDS: return "tDu";
+    case type_id::DURATION_NANOSECONDS: return "tDn";
+    case type_id::DECIMAL32: return decimal_format(max_precision<int32_t>());
+    case type_id::DECIMAL64: return decimal_format(max_precision<int64_t>());
+    case type_id::DECIMAL128: return decimal_format(max_precision<__int128_t>());
+    case type_id::STRING:
+      return col.num_children() > 0 &&
+                 strings_column_view(col).offsets().type().id() == type_id::INT64
+               ? "U"
+               : "u";
+    case type_id::LIST: return "+l";
+    case type_id::STRUCT: return "+s";
+    default: CUDF_FAIL("Unsupported type for the Arrow device interface");
+  }
+}
+
+void export_schema(column_view const& col,
+                   column_metadata const* metadata,
+                   std::string format,
+                   ArrowSchema* out)
+{
+  auto data    = std::make_unique<exported_schema>();
+  data->format = std::move(format);
+  data->name   = metadata != nullptr ? metadata->name : "";
+
+  // the children of a list are its offsets and its child, only the latter is an Arrow child
+  auto const first_child = col.type().id() == type_id::LIST ? 1 : 0;
+  auto const num_children =
+    col.type().id() == type_id::LIST || col.type().id() == type_id::STRUCT
+      ? col.num_children() - first_child
+      : 0;
+  for (size_type i = 0; i < num_children; ++i) {
+    auto const& child = col.child(first_child + i);
+    auto const child_metadata =
+      metadata != nullptr && static_cast<std::size_t>(i) < metadata->children_meta.size()
+        ? &metadata->children_meta[i]
+        : nullptr;
+    data->children.push_back(std::make_unique<ArrowSchema>());
+    export_schema(child, child_metadata, arrow_format(child), data->children.back().get());
+    data->child_ptrs.push_back(data->children.back().get());
+  }
+
+  out->format       = data->format.c_str();
+  out->name         = data->name.c_str();
+  out->metadata     = nullptr;
+  out->flags        = ARROW_FLAG_NULLABLE;
+  out->n_children   = num_children;
+  out->children     = data->child_ptrs.data();
+  out->dictionary   = nullptr;
+  out->release      = release_schema;
+  out->private_data = data.release();
+}
+
+/**
+ * @brief Exports a column into `out`, sharing its device memory.
+ *
+ * Columns whose layout differs from Arrow's are converted, the converted memory is owned by the
+ * exported node.
+ */
+void export_column(column_view const& input,
+                   std::shared_ptr<void> const& owner,
+                   ArrowArray* out,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+{
+  auto data = std::make_unique<exported_array>();
+  data->owned.push_back(owner);
+
+  auto col = input;
+  // the Arrow offsets of an empty string or list column without offsets
+  auto const empty_offsets = [&] {
+    auto offsets = std::make_shared<rmm::device_buffer>(sizeof(int64_t), stream, mr);
+    CUDF_CUDA_TRY(cudaMemsetAsync(offsets->data(), 0, offsets->size(), stream.value()));
+    data->owned.push_back(offsets);
+    return offsets->data();
+  };
+
+  switch (input.type().id()) {
+    case type_id::EMPTY: break;
+    case type_id::BOOL8: {
+      // Arrow booleans are bit-packed, so the values and the validity are copied to offset 0
+      auto [values, null_count] = cudf::detail::bools_to_mask(input, stream, mr);
+      auto validity             = std::make_shared<rmm::device_buffer>(
+        input.nullable() ? cudf::detail::copy_bitmask(input, stream, mr) : rmm::device_buffer{});
+      data->buffers = {input.nullable() ? validity->data() : nullptr, values->data()};
+      data->owned.push_back(std::shared_ptr<rmm::device_buffer>(std::move(values)));
+      data->owned.push_back(validity);
+      col = column_view(input.type(),
+                        input.size(),
+                        data->buffers[1],
+                        static_cast<bitmask_type const*>(data->buffers[0]),
+                        input.null_count());
+      break;
+    }
+    case type_id::DECIMAL32:
+    case type_id::DECIMAL64: {
+      // Arrow decimals are 128-bit
+      std::shared_ptr<column> converted = cudf::detail::cast(
+        input, data_type{type_id::DECIMAL128, input.type().scale()}, stream, mr);
+      col = converted->view();
+      data->owned.push_back(converted);
+      data->buffers = {col.null_mask(), col.head()};
+      break;
+    }
+    case type_id::STRING: {
+      auto const offsets =
+        col.num_children() > 0 ? strings_column_view(col).offsets().head() : empty_offsets();
+      data->buffers = {col.null_mask(), offsets, col.head()};
+      break;
+    }
+    case type_id::LIST: {
+      data->buffers = {col.null_mask(),
+                       col.child(0).size() > 0 ? col.child(0).head() : empty_offsets()};
+      break;
+    }
+    case type_id::STRUCT: data->buffers = {col.null_mask()}; break;
+    case type_id::DICTIONARY32:
+    case type_id::DURATION_DAYS: CUDF_FAIL("Unsupported type for the Arrow device interface");
+    default: data->buffers = {col.null_mask(), col.head()}; break;
+  }
+
+  auto const first_child = col.type().id() == type_id::LIST ? 1 : 0;
+  auto const num_children =
+    col.type().id() == type_id::LIST || col.type().id() == type_id::STRUCT
+      ? col.num_children() - first_child
+      : 0;
+  for (size_type i = 0; i < num_children; ++i) {
+    data->children.push_back(std::make_unique<ArrowArray>());
+    export_column(col.child(first_child + i), owner, data->children.back().get(), stream, mr);
+    data->child_ptrs.push_back(data->children.back().get());
+  }
+
+  out->length       = col.size();
+  out->null_count   = col.type().id() == type_id::EMPTY ? col.size() : col.null_count();
+  out->offset       = col.offset();
+  out->n_buffers    = static_cast<int64_t>(data->buffers.size());
+  out->n_children   = num_children;
+  out->buffers      = data->buffers.data();
+  out->children     = data->child_ptrs.data();
+  out->dictionary   = nullptr;
+  out->release      = release_array;
+  out->private_data = data.release();
+}
+
+unique_device_array_t export_table(table_view const& input,
+                                   std::shared_ptr<void> const& owner,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  auto result = unique_device_array_t(new ArrowDeviceArray{}, [](ArrowDeviceArray* array) {
+    if (array->array.release != nullptr) { array->array.release(&array->array); }
+    delete array;
+  });
+
+  // the table is exported as a struct array of its columns
+  std::vector<column_view> columns(input.begin(), input.end());
+  auto const as_struct =
+    column_view(data_type{type_id::STRUCT}, input.num_rows(), nullptr, nullptr, 0, 0, columns);
+  export_column(as_struct, owner, &result->array, stream, mr);
+
+  int device_id = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  auto* data = static_cast<exported_array*>(result->array.private_data);
+  CUDF_CUDA_TRY(cudaEventCreateWithFlags(&data->event, cudaEventDisableTiming));
+  CUDF_CUDA_TRY(cudaEventRecord(data->event, stream.value()));
+  result->device_id   = device_id;
+  result->device_type = ARROW_DEVICE_CUDA;
+  result->sync_event  = &data->event;
+  return result;
+}
+
+/**
+ * @brief Returns the cudf type of an Arrow format string of a flat type.
+ */
+data_type arrow_format_to_type(std::string const& format)
+{
+  if (format == "n") { return data_type{type_id::EMPTY}; }
+  if (format == "c") { return data_type{type_id::INT8}; }
+  if (format == "s") { return data_type{type_id::INT16}; }
+  if (format == "i") { return data_type{type_id::INT32}; }
+  if (format == "l") { return data_type{type_id::INT64}; }
+  if (format == "C") { return data_type{type_id::UINT8}; }
+  if (format == "S") { return data_type{type_id::UINT16}; }
+  if (format == "I") { return data_type{type_id::UINT32}; }
+  if (format == "L") { return data_type{type_id::UINT64}; }
+  if (format == "f") { return data_type{type_id::FLOAT32}; }
+  if (format == "g") { return data_type{type_id::FLOAT64}; }
+  if (format == "b") { return data_type{type_id::BOOL8}; }
+  if (format == "u" || format == "U") { return data_type{type_id::STRING}; }
+  if (format == "+l") { return data_type{type_id::LIST}; }
+  if (format == "+s") { return data_type{type_id::STRUCT}; }
+  if (format == "tdD") { return data_type{type_id::TIMESTAMP_DAYS}; }
+  if (format == "tdm") { return data_type{type_id::TIMESTAMP_MILLISECONDS}; }
+  // timestamps are imported regardless of their time zone
+  if (format.rfind("tss:", 0) == 0) { return data_type{type_id::TIMESTAMP_SECONDS}; }
+  if (format.rfind("tsm:", 0) == 0) { return data_type{type_id::TIMESTAMP_MILLISECONDS}; }
+  if (format.rfind("tsu:", 0) == 0) { return data_type{type_id::TIMESTAMP_MICROSECONDS}; }
+  if (format.rfind("tsn:", 0) == 0) { return data_type{type_id::TIMESTAMP_NANOSECONDS}; }
+  if (format == "tDs") { return data_type{type_id::DURATION_SECONDS}; }
+  if (format == "tDm") { return data_type{type_id::DURATION_MILLISECONDS}; }
+  if (format == "tDu") { return data_type{type_id::DURATION_MICROSECONDS}; }
+  if (format == "tDn") { return data_type{type_id::DURATION_NANOSECONDS}; }
+  if (format.rfind("d:", 0) == 0) {
+    // "d:precision,scale" or "d:precision,scale,bitwidth"
+    auto const scale_begin = format.find(',') + 1;
+    auto const scale_end   = format.find(',', scale_begin);
+    CUDF_EXPECTS(scale_begin > 0 && (scale_end == std::string::npos ||
+                                     format.substr(scale_end + 1) == "128"),
+                 "Only 128-bit Arrow decimals are supported");
+    auto const scale = std::stoi(format.substr(scale_begin, scale_end - scale_begin));
+    return data_type{type_id::DECIMAL128, numeric::scale_type{-scale}};
+  }
+  CUDF_FAIL("Unsupported Arrow format: " + format);
+}
+
+column_view import_column(ArrowSchema const* schema,
+                          ArrowArray const* input,
+                          std::vector<std::unique_ptr<column>>& owned,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input->length + input->offset <= std::numeric_limits<size_type>::max(),
+               "Arrow array exceeds the column size limit");
+  auto const format   = std::string{schema->format};
+  auto const type     = arrow_format_to_type(format);
+  auto const size     = static_cast<size_type>(input->length);
+  auto const offset   = static_cast<size_type>(input->offset);
+  auto const validity = type.id() != type_id::EMPTY && input->n_buffers > 0
+                          ? static_cast<bitmask_type const*>(input->buffers[0])
+                          : nullptr;
+  auto const null_count =
+    validity == nullptr
+      ? (type.id() == type_id::EMPTY ? size : 0)
+      : (input->null_count >= 0
+           ? static_cast<size_type>(input->null_count)
+           : cudf::detail::null_count(validity, offset, offset + size, stream));
+
+  switch (type.id()) {
+    case type_id::EMPTY: return column_view(type, size, nullptr, nullptr, size);
+    case type_id::BOOL8: {
+      // Arrow booleans are bit-packed, so they are converted to bytes at offset 0
+      auto bools = cudf::detail::mask_to_bools(static_cast<bitmask_type const*>(input->buffers[1]),
+                                               offset,
+                                               offset + size,
+                                               stream,
+                                               mr);
+      if (validity != nullptr) {
+        bools->set_null_mask(
+          cudf::detail::copy_bitmask(validity, offset, offset + size, stream, mr), null_count);
+      }
+      owned.push_back(std::move(bools));
+      return owned.back()->view();
+    }
+    case type_id::STRING: {
+      auto const offsets_type =
+        format == "U" ? data_type{type_id::INT64} : data_type{type_id::INT32};
+      auto const offsets =
+        column_view(offsets_type, offset + size + 1, input->buffers[1], nullptr, 0);
+      return column_view(type, size, input->buffers[2], validity, null_count, offset, {offsets});
+    }
+    case type_id::LIST: {
+      auto const offsets =
+        column_view(data_type{type_id::INT32}, offset + size + 1, input->buffers[1], nullptr, 0);
+      auto const child = import_column(schema->children[0], input->children[0], owned, stream, mr);
+      return column_view(type, size, nullptr, validity, null_count, offset, {offsets, child});
+    }
+    case type_id::STRUCT: {
+      std::vector<column_view> children;
+      for (int64_t i = 0; i < input->n_children; ++i) {
+        children.push_back(
+          import_column(schema->children[i], input->children[i], owned, stream, mr));
+      }
+      return column_view(type, size, nullptr, validity, null_count, offset, children);
+    }
+    default: return column_view(type, size, input->buffers[1], validity, null_count, offset);
+  }
+}
+
+}  // namespace
+
+unique_schema_t to_arrow_schema(cudf::table_view const& input,
+                                cudf::host_span<column_metadata const> metadata)
+{
+  CUDF_EXPECTS(
+    metadata.empty() || metadata.size() == static_cast<std::size_t>(input.num_columns()),
+    "columns' metadata should be equal to the number of columns in table");
+  auto result = unique_schema_t(new ArrowSchema{}, [](ArrowSchema* schema) {
+    if (schema->release != nullptr) { schema->release(schema); }
+    delete schema;
+  });
+
+  column_metadata table_metadata{""};
+  table_metadata.children_meta.assign(metadata.begin(), metadata.end());
+  std::vector<column_view> columns(input.begin(), input.end());
+  auto const as_struct =
+    column_view(data_type{type_id::STRUCT}, input.num_rows(), nullptr, nullptr, 0, 0, columns);
+  export_schema(as_struct, &table_metadata, "+s", result.get());
+  return result;
+}
+
+unique_device_array_t to_arrow_device(cudf::table&& table,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto owner = std::make_shared<cudf::table>(std::move(table));
+  return export_table(owner->view(), owner, stream, mr);
+}
+
+unique_device_array_t to_arrow_device(cudf::table_view const& table,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  return export_table(table, nullptr, stream, mr);
+}
+
+unique_table_view_t from_arrow_device(ArrowSchema const* schema,
+                                      ArrowDeviceArray const* input,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(schema != nullptr && input != nullptr, "Arrow schema and array are required");
+  CUDF_EXPECTS(input->device_type == ARROW_DEVICE_CUDA ||
+                 input->device_type == ARROW_DEVICE_CUDA_HOST ||
+                 input->device_type == ARROW_DEVICE_CUDA_MANAGED,
+               "Arrow array must be in CUDA device, pinned or managed memory");
+  if (input->device_type == ARROW_DEVICE_CUDA) {
+    int device_id = 0;
+    CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+    CUDF_EXPECTS(input->device_id == device_id, "Arrow array must be on the current device");
+  }
+  CUDF_EXPECTS(std::string{schema->format} == "+s", "Arrow schema must be a struct");
+  CUDF_EXPECTS(schema->n_children == input->array.n_children,
+               "Arrow schema and array have different numbers of columns");
+  if (input->sync_event != nullptr) {
+    CUDF_CUDA_TRY(
+      cudaStreamWaitEvent(stream.value(), *static_cast<cudaEvent_t*>(input->sync_event)));
+  }
+
+  std::vector<std::unique_ptr<column>> owned;
+  std::vector<column_view> columns;
+  auto const& array = input->array;
+  for (int64_t i = 0; i < array.n_children; ++i) {
+    auto col = import_column(schema->children[i], array.children[i], owned, stream, mr);
+    // the offset of the struct applies to its children
+    if (array.offset != 0 || col.size() != array.length) {
+      col = cudf::slice(col, {static_cast<size_type>(array.offset),
+                              static_cast<size_type>(array.offset + array.length)})
+              .front();
+    }
+    columns.push_back(col);
+  }
+  return unique_table_view_t(new table_view(columns),
+                             custom_view_deleter<table_view>{std::move(owned)});
+}
+
+}  // namespace detail
+
+unique_schema_t to_arrow_schema(cudf::table_view const& input,
+                                cudf::host_span<column_metadata const> metadata)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_schema(input, metadata);
+}
+
+unique_device_array_t to_arrow_device(cudf::table&& table,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(std::move(table), stream, mr);
+}
+
+unique_device_array_t to_arrow_device(cudf::table_view const& table,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(table, stream, mr);
+}
+
+unique_table_view_t from_arrow_device(ArrowSchema const* schema,
+                                      ArrowDeviceArray const* input,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow_device(schema, input, stream, mr);
+}
+
+}  // namespace cudf
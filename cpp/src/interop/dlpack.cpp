@@ -16,6 +16,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/interop.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transpose.hpp>
 #include <cudf/lists/list_view.hpp>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -217,9 +218,12 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
   return std::make_unique<table>(std::move(columns));
 }
 
-DLManagedTensor* to_dlpack(table_view const& input,
-                           rmm::cuda_stream_view stream,
-                           rmm::mr::device_memory_resource* mr)
+namespace {
+
+DLManagedTensor* make_dlpack_tensor(table_view const& input,
+                                    bool row_major,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
 {
   auto const num_rows = input.num_rows();
   auto const num_cols = input.num_columns();
@@ -251,8 +255,8 @@ DLManagedTensor* to_dlpack(table_view const& input,
   if (tensor.ndim > 1) {
     tensor.shape[1]   = num_cols;
     tensor.strides    = context->strides;
-    tensor.strides[0] = num_rows > 1 ? 1 : 0;
-    tensor.strides[1] = num_rows;
+    tensor.strides[0] = row_major ? num_cols : (num_rows > 1 ? 1 : 0);
+    tensor.strides[1] = row_major ? 1 : num_rows;
   }
 
   CUDF_CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
@@ -273,14 +277,18 @@ DLManagedTensor* to_dlpack(table_view const& input,
   context->buffer = rmm::device_buffer(total_bytes, stream, mr);
   tensor.data     = context->buffer.data();
 
-  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data);
-  for (auto const& col : input) {
-    CUDF_CUDA_TRY(cudaMemcpyAsync(reinterpret_cast<void*>(tensor_data),
-                                  get_column_data(col),
-                                  stride_bytes,
-                                  cudaMemcpyDefault,
-                                  stream.value()));
-    tensor_data += stride_bytes;
+  if (row_major && tensor.ndim > 1) {
+    copy_to_row_major(input, tensor.data, stream);
+  } else {
+    auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data);
+    for (auto const& col : input) {
+      CUDF_CUDA_TRY(cudaMemcpyAsync(reinterpret_cast<void*>(tensor_data),
+                                    get_column_data(col),
+                                    stride_bytes,
+                                    cudaMemcpyDefault,
+                                    stream.value()));
+      tensor_data += stride_bytes;
+    }
   }
 
   // Defer ownership of managed tensor to caller
@@ -295,6 +303,22 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+}  // namespace
+
+DLManagedTensor* to_dlpack(table_view const& input,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  return make_dlpack_tensor(input, false, stream, mr);
+}
+
+DLManagedTensor* to_dlpack_row_major(table_view const& input,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  return make_dlpack_tensor(input, true, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
@@ -310,4 +334,10 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, cudf::get_default_stream(), mr);
 }
 
+DLManagedTensor* to_dlpack_row_major(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_dlpack_row_major(input, cudf::get_default_stream(), mr);
+}
+
 }  // namespace cudf
@@ -25,8 +25,10 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/interop.hpp>
+#include <cudf/io/memory_resource.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
@@ -36,34 +38,198 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
 
+#include <cub/device/device_memcpy.cuh>
 #include <thrust/copy.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <cstring>
+#include <future>
+#include <numeric>
+#include <optional>
+#include <utility>
+
 namespace cudf {
 namespace detail {
 namespace {
 
+/**
+ * @brief Device-to-host copies of the buffers of a conversion, issued together.
+ *
+ * The buffers are gathered into a device staging buffer by a single batched copy, which is
+ * transferred to pinned host memory from `cudf::io::get_host_memory_resource()` at once, instead
+ * of one blocking pageable transfer per buffer. The Arrow buffers are filled from the pinned
+ * staging memory by `finish`, once the transfer has completed.
+ *
+ * The temporaries of the conversion copied from are kept alive by the batch until the copies
+ * are issued.
+ */
+class host_copy_batch {
+ public:
+  host_copy_batch() = default;
+  host_copy_batch(host_copy_batch const&) = delete;
+  host_copy_batch& operator=(host_copy_batch const&) = delete;
+  host_copy_batch(host_copy_batch&& other) noexcept
+    : _destinations{std::move(other._destinations)},
+      _sources{std::move(other._sources)},
+      _sizes{std::move(other._sizes)},
+      _bitmaps{std::move(other._bitmaps)},
+      _temporaries{std::move(other._temporaries)},
+      _host_mr{other._host_mr},
+      _host_staging{std::exchange(other._host_staging, nullptr)},
+      _total_size{other._total_size},
+      _stream{other._stream},
+      _copied{std::exchange(other._copied, nullptr)}
+  {
+  }
+  host_copy_batch& operator=(host_copy_batch&&) = delete;
+  ~host_copy_batch() { release(); }
+
+  /**
+   * @brief Registers the copy of `size` bytes from device memory `src` to host memory `dst`
+   */
+  void add(uint8_t* dst, void const* src, std::size_t size)
+  {
+    if (size == 0) { return; }
+    _destinations.push_back(dst);
+    _sources.push_back(src);
+    _sizes.push_back(size);
+  }
+
+  /**
+   * @brief Registers an Arrow bitmap whose padding is reset once it is filled
+   */
+  void add_bitmap(std::shared_ptr<arrow::Buffer> bitmap) { _bitmaps.push_back(std::move(bitmap)); }
+
+  /**
+   * @brief Keeps a temporary of the conversion alive until the copies are issued
+   *
+   * @return A reference to the kept temporary
+   */
+  template <typename T>
+  T& keep(T&& temporary)
+  {
+    auto owned   = std::make_shared<T>(std::move(temporary));
+    auto& result = *owned;
+    _temporaries.push_back(std::move(owned));
+    return result;
+  }
+
+  /**
+   * @brief Issues the copies of the registered buffers to pinned host memory on `stream`
+   */
+  void stage(rmm::cuda_stream_view stream)
+  {
+    _stream     = stream;
+    _total_size = std::accumulate(_sizes.begin(), _sizes.end(), std::size_t{0});
+    if (_total_size == 0) {
+      _temporaries.clear();
+      return;
+    }
+
+    rmm::device_buffer staging(_total_size, stream);
+    std::vector<void*> staged;
+    std::size_t offset = 0;
+    for (auto const size : _sizes) {
+      staged.push_back(static_cast<uint8_t*>(staging.data()) + offset);
+      offset += size;
+    }
+
+    auto const mr             = rmm::mr::get_current_device_resource();
+    auto const d_sources      = make_device_uvector_async(_sources, stream, mr);
+    auto const d_destinations = make_device_uvector_async(staged, stream, mr);
+    auto const d_sizes        = make_device_uvector_async(_sizes, stream, mr);
+    auto const num_buffers    = static_cast<uint32_t>(_sources.size());
+    std::size_t temp_size     = 0;
+    CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(nullptr,
+                                             temp_size,
+                                             d_sources.begin(),
+                                             d_destinations.begin(),
+                                             d_sizes.begin(),
+                                             num_buffers,
+                                             stream.value()));
+    rmm::device_buffer temp(temp_size, stream);
+    CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(temp.data(),
+                                             temp_size,
+                                             d_sources.begin(),
+                                             d_destinations.begin(),
+                                             d_sizes.begin(),
+                                             num_buffers,
+                                             stream.value()));
+
+    _host_mr      = cudf::io::get_host_memory_resource();
+    _host_staging = static_cast<uint8_t*>(
+      _host_mr->allocate_async(_total_size, rmm::RMM_DEFAULT_HOST_ALIGNMENT, stream));
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      _host_staging, staging.data(), _total_size, cudaMemcpyDeviceToHost, stream.value()));
+    CUDF_CUDA_TRY(cudaEventCreateWithFlags(&_copied, cudaEventDisableTiming));
+    CUDF_CUDA_TRY(cudaEventRecord(_copied, stream.value()));
+    // the device memory is freed in stream order, after the copies
+    _temporaries.clear();
+  }
+
+  /**
+   * @brief Waits for the copies issued by `stage`, and fills the Arrow buffers from the pinned
+   * staging memory
+   */
+  void finish()
+  {
+    if (_copied != nullptr) { CUDF_CUDA_TRY(cudaEventSynchronize(_copied)); }
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < _sizes.size(); ++i) {
+      std::memcpy(_destinations[i], _host_staging + offset, _sizes[i]);
+      offset += _sizes[i];
+    }
+    // Resets all padded bits to 0
+    for (auto const& bitmap : _bitmaps) {
+      bitmap->ZeroPadding();
+    }
+    release();
+  }
+
+ private:
+  void release()
+  {
+    if (_host_staging != nullptr) {
+      _host_mr->deallocate_async(
+        _host_staging, _total_size, rmm::RMM_DEFAULT_HOST_ALIGNMENT, _stream);
+      _host_staging = nullptr;
+    }
+    if (_copied != nullptr) {
+      cudaEventDestroy(_copied);
+      _copied = nullptr;
+    }
+  }
+
+  std::vector<uint8_t*> _destinations;
+  std::vector<void const*> _sources;
+  std::vector<std::size_t> _sizes;
+  std::vector<std::shared_ptr<arrow::Buffer>> _bitmaps;
+  std::vector<std::shared_ptr<void>> _temporaries;
+  std::optional<rmm::host_async_resource_ref> _host_mr;
+  uint8_t* _host_staging{nullptr};
+  std::size_t _total_size{0};
+  rmm::cuda_stream_view _stream{cudf::get_default_stream()};
+  cudaEvent_t _copied{nullptr};
+};
+
 /**
  * @brief Create arrow data buffer from given cudf column
  */
 template <typename T>
 std::shared_ptr<arrow::Buffer> fetch_data_buffer(device_span<T const> input,
                                                  arrow::MemoryPool* ar_mr,
-                                                 rmm::cuda_stream_view stream)
+                                                 host_copy_batch& batch)
 {
   int64_t const data_size_in_bytes = sizeof(T) * input.size();
 
   auto data_buffer = allocate_arrow_buffer(data_size_in_bytes, ar_mr);
-
-  CUDF_CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                                input.data(),
-                                data_size_in_bytes,
-                                cudaMemcpyDefault,
-                                stream.value()));
+  batch.add(data_buffer->mutable_data(), input.data(), data_size_in_bytes);
 
   return std::move(data_buffer);
 }
@@ -73,24 +239,22 @@ std::shared_ptr<arrow::Buffer> fetch_data_buffer(device_span<T const> input,
  */
 std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
                                                  arrow::MemoryPool* ar_mr,
+                                                 host_copy_batch& batch,
                                                  rmm::cuda_stream_view stream)
 {
   int64_t const mask_size_in_bytes = cudf::bitmask_allocation_size_bytes(input_view.size());
 
   if (input_view.has_nulls()) {
     auto mask_buffer = allocate_arrow_bitmap(static_cast<int64_t>(input_view.size()), ar_mr);
-    CUDF_CUDA_TRY(cudaMemcpyAsync(
-      mask_buffer->mutable_data(),
-      (input_view.offset() > 0)
-        ? cudf::detail::copy_bitmask(input_view, stream, rmm::mr::get_current_device_resource())
-            .data()
-        : input_view.null_mask(),
-      mask_size_in_bytes,
-      cudaMemcpyDefault,
-      stream.value()));
-
-    // Resets all padded bits to 0
-    mask_buffer->ZeroPadding();
+    batch.add(mask_buffer->mutable_data(),
+              (input_view.offset() > 0)
+                ? batch
+                    .keep(cudf::detail::copy_bitmask(
+                      input_view, stream, rmm::mr::get_current_device_resource()))
+                    .data()
+                : input_view.null_mask(),
+              mask_size_in_bytes);
+    batch.add_bitmap(mask_buffer);
 
     return mask_buffer;
   }
@@ -102,6 +266,8 @@ std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
  * @brief Functor to convert cudf column to arrow array
  */
 struct dispatch_to_arrow {
+  host_copy_batch& batch;  ///< Device-to-host copies of the conversion
+
   /**
    * @brief Creates vector Arrays from given cudf column children
    */
@@ -117,9 +283,9 @@ struct dispatch_to_arrow {
       input_view.child_end(),
       metadata.begin(),
       std::back_inserter(child_arrays),
-      [&ar_mr, &stream](auto const& child, auto const& meta) {
+      [this, &ar_mr, &stream](auto const& child, auto const& meta) {
         return type_dispatcher(
-          child.type(), dispatch_to_arrow{}, child, child.type().id(), meta, ar_mr, stream);
+          child.type(), *this, child, child.type().id(), meta, ar_mr, stream);
       });
     return child_arrays;
   }
@@ -142,8 +308,8 @@ struct dispatch_to_arrow {
       id,
       static_cast<int64_t>(input_view.size()),
       fetch_data_buffer<T>(
-        device_span<T const>(input_view.data<T>(), input_view.size()), ar_mr, stream),
-      fetch_mask_buffer(input_view, ar_mr, stream),
+        device_span<T const>(input_view.data<T>(), input_view.size()), ar_mr, batch),
+      fetch_mask_buffer(input_view, ar_mr, batch, stream),
       static_cast<int64_t>(input_view.null_count()));
   }
 };
@@ -155,16 +321,17 @@ template <typename DeviceType>
 std::shared_ptr<arrow::Array> unsupported_decimals_to_arrow(column_view input,
                                                             int32_t precision,
                                                             arrow::MemoryPool* ar_mr,
+                                                            host_copy_batch& batch,
                                                             rmm::cuda_stream_view stream)
 {
   constexpr size_type BIT_WIDTH_RATIO = sizeof(__int128_t) / sizeof(DeviceType);
 
-  rmm::device_uvector<DeviceType> buf(input.size() * BIT_WIDTH_RATIO, stream);
+  auto& buf = batch.keep(rmm::device_uvector<DeviceType>(input.size() * BIT_WIDTH_RATIO, stream));
 
   auto count = thrust::make_counting_iterator(0);
 
   thrust::for_each(
-    rmm::exec_policy(cudf::get_default_stream()),
+    rmm::exec_policy(stream),
     count,
     count + input.size(),
     [in = input.begin<DeviceType>(), out = buf.data(), BIT_WIDTH_RATIO] __device__(auto in_idx) {
@@ -181,12 +348,10 @@ std::shared_ptr<arrow::Array> unsupported_decimals_to_arrow(column_view input,
 
   auto const buf_size_in_bytes = buf.size() * sizeof(DeviceType);
   auto data_buffer             = allocate_arrow_buffer(buf_size_in_bytes, ar_mr);
-
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    data_buffer->mutable_data(), buf.data(), buf_size_in_bytes, cudaMemcpyDefault, stream.value()));
+  batch.add(data_buffer->mutable_data(), buf.data(), buf_size_in_bytes);
 
   auto type    = arrow::decimal(precision, -input.type().scale());
-  auto mask    = fetch_mask_buffer(input, ar_mr, stream);
+  auto mask    = fetch_mask_buffer(input, ar_mr, batch, stream);
   auto buffers = std::vector<std::shared_ptr<arrow::Buffer>>{mask, std::move(data_buffer)};
   auto data    = std::make_shared<arrow::ArrayData>(type, input.size(), buffers);
 
@@ -203,7 +368,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal32>(
 {
   using DeviceType = int32_t;
   return unsupported_decimals_to_arrow<DeviceType>(
-    input, cudf::detail::max_precision<DeviceType>(), ar_mr, stream);
+    input, cudf::detail::max_precision<DeviceType>(), ar_mr, batch, stream);
 }
 
 template <>
@@ -216,7 +381,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal64>(
 {
   using DeviceType = int64_t;
   return unsupported_decimals_to_arrow<DeviceType>(
-    input, cudf::detail::max_precision<DeviceType>(), ar_mr, stream);
+    input, cudf::detail::max_precision<DeviceType>(), ar_mr, batch, stream);
 }
 
 template <>
@@ -230,7 +395,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal128>
   using DeviceType         = __int128_t;
   auto const max_precision = cudf::detail::max_precision<DeviceType>();
 
-  rmm::device_uvector<DeviceType> buf(input.size(), stream);
+  auto& buf = batch.keep(rmm::device_uvector<DeviceType>(input.size(), stream));
 
   thrust::copy(rmm::exec_policy(stream),  //
                input.begin<DeviceType>(),
@@ -239,12 +404,10 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal128>
 
   auto const buf_size_in_bytes = buf.size() * sizeof(DeviceType);
   auto data_buffer             = allocate_arrow_buffer(buf_size_in_bytes, ar_mr);
-
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    data_buffer->mutable_data(), buf.data(), buf_size_in_bytes, cudaMemcpyDefault, stream.value()));
+  batch.add(data_buffer->mutable_data(), buf.data(), buf_size_in_bytes);
 
   auto type    = arrow::decimal(max_precision, -input.type().scale());
-  auto mask    = fetch_mask_buffer(input, ar_mr, stream);
+  auto mask    = fetch_mask_buffer(input, ar_mr, batch, stream);
   auto buffers = std::vector<std::shared_ptr<arrow::Buffer>>{mask, std::move(data_buffer)};
   auto data    = std::make_shared<arrow::ArrayData>(type, input.size(), buffers);
 
@@ -258,19 +421,16 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<bool>(column_view in
                                                                   arrow::MemoryPool* ar_mr,
                                                                   rmm::cuda_stream_view stream)
 {
-  auto bitmask = bools_to_mask(input, stream, rmm::mr::get_current_device_resource());
+  auto& bitmask =
+    batch.keep(bools_to_mask(input, stream, rmm::mr::get_current_device_resource()).first);
 
-  auto data_buffer = allocate_arrow_buffer(static_cast<int64_t>(bitmask.first->size()), ar_mr);
+  auto data_buffer = allocate_arrow_buffer(static_cast<int64_t>(bitmask->size()), ar_mr);
+  batch.add(data_buffer->mutable_data(), bitmask->data(), bitmask->size());
 
-  CUDF_CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                                bitmask.first->data(),
-                                bitmask.first->size(),
-                                cudaMemcpyDefault,
-                                stream.value()));
   return to_arrow_array(id,
                         static_cast<int64_t>(input.size()),
                         std::move(data_buffer),
-                        fetch_mask_buffer(input, ar_mr, stream),
+                        fetch_mask_buffer(input, ar_mr, batch, stream),
                         static_cast<int64_t>(input.null_count()));
 }
 
@@ -282,11 +442,11 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
   arrow::MemoryPool* ar_mr,
   rmm::cuda_stream_view stream)
 {
-  std::unique_ptr<column> tmp_column =
+  auto const& tmp_column = batch.keep(
     ((input.offset() != 0) or
      ((input.num_children() == 1) and (input.child(0).size() - 1 != input.size())))
       ? std::make_unique<cudf::column>(input, stream)
-      : nullptr;
+      : std::unique_ptr<column>{});
 
   column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
   auto child_arrays      = fetch_child_array(input_view, {{}, {}}, ar_mr, stream);
@@ -305,11 +465,11 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
     device_span<char const>{sview.chars_begin(stream),
                               static_cast<std::size_t>(sview.chars_size(stream))},
     ar_mr,
-    stream);
+    batch);
   return std::make_shared<arrow::StringArray>(static_cast<int64_t>(input_view.size()),
                                               offset_buffer,
                                               data_buffer,
-                                              fetch_mask_buffer(input_view, ar_mr, stream),
+                                              fetch_mask_buffer(input_view, ar_mr, batch, stream),
                                               static_cast<int64_t>(input_view.null_count()));
 }
 
@@ -323,13 +483,13 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::struct_view>(
 {
   CUDF_EXPECTS(metadata.children_meta.size() == static_cast<std::size_t>(input.num_children()),
                "Number of field names and number of children doesn't match\n");
-  std::unique_ptr<column> tmp_column = nullptr;
-
-  if (input.offset() != 0) { tmp_column = std::make_unique<cudf::column>(input, stream); }
+  auto const& tmp_column = batch.keep(input.offset() != 0
+                                        ? std::make_unique<cudf::column>(input, stream)
+                                        : std::unique_ptr<column>{});
 
   column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
   auto child_arrays      = fetch_child_array(input_view, metadata.children_meta, ar_mr, stream);
-  auto mask              = fetch_mask_buffer(input_view, ar_mr, stream);
+  auto mask              = fetch_mask_buffer(input_view, ar_mr, batch, stream);
 
   std::vector<std::shared_ptr<arrow::Field>> fields;
   std::transform(child_arrays.cbegin(),
@@ -357,11 +517,11 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::list_view>(
   arrow::MemoryPool* ar_mr,
   rmm::cuda_stream_view stream)
 {
-  std::unique_ptr<column> tmp_column = nullptr;
-  if ((input.offset() != 0) or
-      ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size()))) {
-    tmp_column = std::make_unique<cudf::column>(input, stream);
-  }
+  auto const& tmp_column = batch.keep(
+    ((input.offset() != 0) or
+     ((input.num_children() == 2) and (input.child(0).size() - 1 != input.size())))
+      ? std::make_unique<cudf::column>(input, stream)
+      : std::unique_ptr<column>{});
 
   column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
   auto children_meta =
@@ -377,7 +537,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::list_view>(
                                             static_cast<int64_t>(input_view.size()),
                                             offset_buffer,
                                             data,
-                                            fetch_mask_buffer(input_view, ar_mr, stream),
+                                            fetch_mask_buffer(input_view, ar_mr, batch, stream),
                                             static_cast<int64_t>(input_view.null_count()));
 }
 
@@ -390,17 +550,17 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::dictionary32>(
   rmm::cuda_stream_view stream)
 {
   // Arrow dictionary requires indices to be signed integer
-  std::unique_ptr<column> dict_indices =
-    detail::cast(cudf::dictionary_column_view(input).get_indices_annotated(),
-                 cudf::data_type{type_id::INT32},
-                 stream,
-                 rmm::mr::get_current_device_resource());
-  auto indices = dispatch_to_arrow{}.operator()<int32_t>(
+  auto const& dict_indices =
+    batch.keep(detail::cast(cudf::dictionary_column_view(input).get_indices_annotated(),
+                            cudf::data_type{type_id::INT32},
+                            stream,
+                            rmm::mr::get_current_device_resource()));
+  auto indices = this->operator()<int32_t>(
     dict_indices->view(), dict_indices->type().id(), {}, ar_mr, stream);
   auto dict_keys = cudf::dictionary_column_view(input).keys();
   auto dictionary =
     type_dispatcher(dict_keys.type(),
-                    dispatch_to_arrow{},
+                    *this,
                     dict_keys,
                     dict_keys.type().id(),
                     metadata.children_meta.empty() ? column_metadata{} : metadata.children_meta[0],
@@ -410,12 +570,16 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::dictionary32>(
   return std::make_shared<arrow::DictionaryArray>(
     arrow::dictionary(indices->type(), dictionary->type()), indices, dictionary);
 }
-}  // namespace
 
-std::shared_ptr<arrow::Table> to_arrow(table_view input,
-                                       std::vector<column_metadata> const& metadata,
-                                       rmm::cuda_stream_view stream,
-                                       arrow::MemoryPool* ar_mr)
+/**
+ * @brief Converts the columns of `input` to Arrow arrays, whose buffers are filled once the copies
+ * registered in `batch` complete
+ */
+std::shared_ptr<arrow::Table> make_arrow_table(table_view input,
+                                               std::vector<column_metadata> const& metadata,
+                                               host_copy_batch& batch,
+                                               rmm::cuda_stream_view stream,
+                                               arrow::MemoryPool* ar_mr)
 {
   CUDF_EXPECTS((metadata.size() == static_cast<std::size_t>(input.num_columns())),
                "columns' metadata should be equal to number of columns in table");
@@ -431,7 +595,7 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
     [&](auto const& c, auto const& meta) {
       return c.type().id() != type_id::EMPTY
                ? type_dispatcher(
-                   c.type(), detail::dispatch_to_arrow{}, c, c.type().id(), meta, ar_mr, stream)
+                   c.type(), dispatch_to_arrow{batch}, c, c.type().id(), meta, ar_mr, stream)
                : std::make_shared<arrow::NullArray>(c.size());
     });
 
@@ -442,16 +606,39 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
     std::back_inserter(fields),
     [](auto const& array, auto const& meta) { return arrow::field(meta.name, array->type()); });
 
-  auto result = arrow::Table::Make(arrow::schema(fields), arrays);
-
-  // synchronize the stream because after the return the data may be accessed from the host before
-  // the above `cudaMemcpyAsync` calls have completed their copies (especially if pinned host
-  // memory is used).
-  stream.synchronize();
+  return arrow::Table::Make(arrow::schema(fields), arrays);
+}
+}  // namespace
 
+std::shared_ptr<arrow::Table> to_arrow(table_view input,
+                                       std::vector<column_metadata> const& metadata,
+                                       rmm::cuda_stream_view stream,
+                                       arrow::MemoryPool* ar_mr)
+{
+  host_copy_batch batch;
+  auto result = make_arrow_table(input, metadata, batch, stream, ar_mr);
+  batch.stage(stream);
+  // wait for the copies because after the return the data may be accessed from the host
+  batch.finish();
   return result;
 }
 
+std::future<std::shared_ptr<arrow::Table>> to_arrow_async(
+  table_view input,
+  std::vector<column_metadata> const& metadata,
+  rmm::cuda_stream_view stream,
+  arrow::MemoryPool* ar_mr)
+{
+  host_copy_batch batch;
+  auto result = make_arrow_table(input, metadata, batch, stream, ar_mr);
+  batch.stage(stream);
+  return std::async(std::launch::async,
+                    [batch = std::move(batch), result = std::move(result)]() mutable {
+                      batch.finish();
+                      return result;
+                    });
+}
+
 std::shared_ptr<arrow::Scalar> to_arrow(cudf::scalar const& input,
                                         column_metadata const& metadata,
                                         rmm::cuda_stream_view stream,
@@ -476,6 +663,16 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
   return detail::to_arrow(input, metadata, stream, ar_mr);
 }
 
+std::future<std::shared_ptr<arrow::Table>> to_arrow_async(
+  table_view input,
+  std::vector<column_metadata> const& metadata,
+  rmm::cuda_stream_view stream,
+  arrow::MemoryPool* ar_mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_async(input, metadata, stream, ar_mr);
+}
+
 std::shared_ptr<arrow::Scalar> to_arrow(cudf::scalar const& input,
                                         column_metadata const& metadata,
                                         rmm::cuda_stream_view stream,
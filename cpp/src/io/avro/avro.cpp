@@ -18,6 +18,7 @@
 
 #include <cstring>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace cudf {
 namespace io {
@@ -221,7 +222,8 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
     type_kind_e kind                = md->schema[i].kind;
     logicaltype_kind_e logical_kind = md->schema[i].logical_kind;
 
-    bool is_supported_kind = ((kind > type_null) && (kind < type_record));
+    // Arrays are read as list columns
+    bool is_supported_kind = ((kind > type_null) && (kind < type_record)) || (kind == type_array);
     if (is_supported_logical_type(logical_kind) || is_supported_kind) {
       column_desc col;
       int parent_idx       = md->schema[i].parent_idx;
@@ -286,6 +288,7 @@ enum attrtype_e {
   attrtype_fields,
   attrtype_symbols,
   attrtype_items,
+  attrtype_values,
   attrtype_logicaltype,
 };
 
@@ -335,11 +338,49 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, std::string const&
     {"fields", attrtype_fields},
     {"symbols", attrtype_symbols},
     {"items", attrtype_items},
+    {"values", attrtype_values},
     {"logicalType", attrtype_logicaltype}};
   attrtype_e cur_attr = attrtype_none;
-  m_base              = json_str.c_str();
-  m_cur               = m_base;
-  m_end               = m_base + json_str.length();
+
+  // Parent and current entries to restore at the end of each object or list
+  struct scope {
+    int parent_idx;
+    int entry_idx;
+    int map_value_idx;  // entry to name as a map value at the end of the scope, or -1
+  };
+  std::vector<scope> scopes;
+  auto const end_scope = [&]() {
+    if (scopes.empty()) { return false; }
+    auto const& closed = scopes.back();
+    if (closed.map_value_idx >= 0 && closed.map_value_idx < static_cast<int>(schema.size())) {
+      schema[closed.map_value_idx].name = "value";
+    }
+    parent_idx = closed.parent_idx;
+    entry_idx  = closed.entry_idx;
+    scopes.pop_back();
+    return true;
+  };
+
+  // A map is read as an array of {key, value} records: the map entry is followed by the record
+  // entry and the string entry of the key
+  std::unordered_set<int> maps;
+  auto const add_entry = [&](type_kind_e kind, int parent) {
+    auto const idx = static_cast<int>(schema.size());
+    schema.emplace_back(kind, parent);
+    if (parent >= 0) { schema[parent].num_children++; }
+    return idx;
+  };
+  // Parent of the entry of the items of an array, or of the values of a map
+  auto const items_parent = [&](int idx) {
+    if (idx < 0 || schema[idx].kind != type_array) { return -1; }
+    bool const is_map = maps.count(idx) != 0;
+    if ((cur_attr == attrtype_values) != is_map) { return -1; }
+    return is_map ? idx + 1 : idx;
+  };
+
+  m_base = json_str.c_str();
+  m_cur  = m_base;
+  m_end  = m_base + json_str.length();
   while (more_data()) {
     int c = *m_cur++;
     switch (c) {
@@ -355,13 +396,25 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, std::string const&
           auto t   = attrnames.find(str);
           cur_attr = (t == attrnames.end()) ? attrtype_none : t->second;
           state    = state_attrcolon;
+        } else if (state == state_attrvalue &&
+                   (cur_attr == attrtype_items || cur_attr == attrtype_values)) {
+          // Items or values given by their type name
+          auto const t      = typenames.find(str);
+          auto const parent = items_parent(entry_idx);
+          if (t == typenames.end() || parent < 0) return false;
+          auto const idx = add_entry(t->second, parent);
+          if (cur_attr == attrtype_values) { schema[idx].name = "value"; }
+          state    = state_nextattr;
+          cur_attr = attrtype_none;
         } else if (state == state_attrvalue || state == state_attrvalue_last) {
-          if (entry_idx < 0) {
-            entry_idx = static_cast<int>(schema.size());
-            schema.emplace_back(type_not_set, parent_idx);
-            if (parent_idx >= 0) { schema[parent_idx].num_children++; }
-          }
-          if (cur_attr == attrtype_type) {
+          if (entry_idx < 0) { entry_idx = add_entry(type_not_set, parent_idx); }
+          if (cur_attr == attrtype_type && str == "map") {
+            schema[entry_idx].kind = type_array;
+            maps.insert(entry_idx);
+            auto const record_idx = add_entry(type_record, entry_idx);
+            auto const key_idx    = add_entry(type_string, record_idx);
+            schema[key_idx].name  = "key";
+          } else if (cur_attr == attrtype_type) {
             auto t = typenames.find(str);
             if (t == typenames.end()) return false;
             schema[entry_idx].kind = t->second;
@@ -393,19 +446,23 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, std::string const&
         break;
       case '{':
         if (state == state_attrvalue && cur_attr == attrtype_type) {
-          if (entry_idx < 0) {
-            entry_idx = static_cast<int>(schema.size());
-            schema.emplace_back(type_record, parent_idx);
-            if (parent_idx >= 0) { schema[parent_idx].num_children++; }
-          }
+          if (entry_idx < 0) { entry_idx = add_entry(type_record, parent_idx); }
+          scopes.push_back({parent_idx, entry_idx, -1});
           cur_attr = attrtype_none;
           state    = state_attrname;
-        } else if (state == state_attrvalue && cur_attr == attrtype_items && entry_idx >= 0) {
-          // Treat array as a one-field record
-          parent_idx = entry_idx;
+        } else if (state == state_attrvalue &&
+                   (cur_attr == attrtype_items || cur_attr == attrtype_values)) {
+          // Items or values given by their schema
+          auto const parent = items_parent(entry_idx);
+          if (parent < 0) { return false; }
+          auto const value_idx = cur_attr == attrtype_values ? static_cast<int>(schema.size()) : -1;
+          scopes.push_back({parent_idx, entry_idx, value_idx});
+          parent_idx = parent;
           entry_idx  = -1;
           cur_attr   = attrtype_none;
           state      = state_attrname;
+        } else {
+          scopes.push_back({parent_idx, entry_idx, -1});
         }
         if (depth >= MAX_SCHEMA_DEPTH || state != state_attrname) { return false; }
         depthbuf[depth++] = '{';
@@ -413,11 +470,7 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, std::string const&
       case '}':
         if (depth == 0 || state != state_nextattr || depthbuf[depth - 1] != '{') return false;
         --depth;
-        if (entry_idx < 0) {
-          parent_idx = (parent_idx >= 0) ? schema[parent_idx].parent_idx : -1;
-        } else {
-          entry_idx = -1;
-        }
+        if (!end_scope()) return false;
         break;
       case '[':
         if (state == state_attrname && cur_attr == attrtype_none) {
@@ -431,17 +484,25 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, std::string const&
           break;
         } else if (cur_attr == attrtype_type) {
           if (entry_idx < 0 || schema[entry_idx].kind != type_not_set) {
-            entry_idx = static_cast<int>(schema.size());
-            schema.emplace_back(type_union, parent_idx);
-            if (parent_idx >= 0) { schema[parent_idx].num_children++; }
+            entry_idx = add_entry(type_union, parent_idx);
           } else {
             schema[entry_idx].kind = type_union;
           }
+          scopes.push_back({parent_idx, entry_idx, -1});
           parent_idx = entry_idx;
+        } else if (cur_attr == attrtype_items || cur_attr == attrtype_values) {
+          // Union of items or values
+          auto const parent = items_parent(entry_idx);
+          if (parent < 0) { return false; }
+          auto const union_idx = add_entry(type_union, parent);
+          if (cur_attr == attrtype_values) { schema[union_idx].name = "value"; }
+          scopes.push_back({parent_idx, entry_idx, -1});
+          parent_idx = union_idx;
         } else if (cur_attr != attrtype_fields || entry_idx < 0 ||
                    schema[entry_idx].kind < type_record) {
           return false;
         } else {
+          scopes.push_back({parent_idx, entry_idx, -1});
           parent_idx = entry_idx;
         }
         entry_idx = -1;
@@ -455,9 +516,8 @@ bool schema_parser::parse(std::vector<schema_entry>& schema, std::string const&
         --depth;
         if (state == state_nextsymbol) {
           state = state_nextattr;
-        } else if (parent_idx >= 0) {
-          entry_idx  = parent_idx;
-          parent_idx = schema[parent_idx].parent_idx;
+        } else if (!end_scope()) {
+          return false;
         }
         break;
       case ' ':
@@ -64,6 +64,9 @@ static inline int64_t __device__ avro_decode_zigzag_varint(uint8_t const*& cur,
  * @param[in] cur Current input data pointer
  * @param[in] end End of input data
  * @param[in] global_Dictionary Global dictionary entries
+ * @param[in] count_array_items Whether to only add the number of items of
+ *                              each saved array to its row in the array's
+ *                              `dataptr`, instead of saving the decoded data
  * @param[out] skipped_row Whether the row was skipped; set to false
  *                         if the row was saved (caller should ensure
  *                         this is initialized to true)
@@ -81,6 +84,7 @@ avro_decode_row(schemadesc_s const* schema,
                 uint8_t const* cur,
                 uint8_t const* end,
                 device_span<string_index_pair const> global_dictionary,
+                bool count_array_items,
                 bool* skipped_row)
 {
   // `dst_row` depicts the offset of the decoded row in the destination
@@ -109,13 +113,25 @@ avro_decode_row(schemadesc_s const* schema,
   // if we write the decoded value to the destination array).
   if (dst_row < -1) { CUDF_UNREACHABLE("dst_row should be -1 or greater"); }
   if (*skipped_row != true) { CUDF_UNREACHABLE("skipped_row should be true"); }
+  // When counting array items, the selected rows are processed as in the decoding pass even if
+  // they have no array to count, so that both passes step through the rows in the same way
+  if (count_array_items && dst_row >= 0) { *skipped_row = false; }
 
   uint32_t array_start = 0, array_repeat_count = 0;
   int array_children = 0;
+  // Whether the next array entry continues the current array with its next block of items
+  bool array_next_block = false;
+  // Offset of the current array item in the destination array of the items, or -1 if the
+  // items are not saved.  The items of the saved arrays are stored contiguously, starting at
+  // the offset of the row in the array's `dataptr` (computed from the counts of items of a
+  // prior `count_array_items` pass).
+  ptrdiff_t dst_item = -1;
   for (uint32_t i = 0; i < schema_len;) {
     type_kind_e kind                = schema[i].kind;
     logicaltype_kind_e logical_kind = schema[i].logical_kind;
     int skip                        = 0;
+    // Offset of the decoded value in the destination array: array items are stored by item
+    ptrdiff_t const dst_idx = (array_repeat_count != 0) ? dst_item : dst_row;
 
     if (is_supported_logical_type(logical_kind)) { kind = static_cast<type_kind_e>(logical_kind); }
 
@@ -142,8 +158,8 @@ avro_decode_row(schemadesc_s const* schema,
     void* dataptr = schema[i].dataptr;
     switch (kind) {
       case type_null:
-        if (dataptr != nullptr && dst_row >= 0) {
-          atomicAnd(static_cast<uint32_t*>(dataptr) + (dst_row >> 5), ~(1 << (dst_row & 0x1f)));
+        if (dataptr != nullptr && dst_idx >= 0) {
+          atomicAnd(static_cast<uint32_t*>(dataptr) + (dst_idx >> 5), ~(1 << (dst_idx & 0x1f)));
           atomicAdd(&schema_g[i].count, 1U);
           *skipped_row = false;
         }
@@ -151,16 +167,16 @@ avro_decode_row(schemadesc_s const* schema,
 
       case type_int: {
         int64_t v = avro_decode_zigzag_varint(cur, end);
-        if (dataptr != nullptr && dst_row >= 0) {
-          static_cast<int32_t*>(dataptr)[dst_row] = static_cast<int32_t>(v);
+        if (dataptr != nullptr && dst_idx >= 0) {
+          static_cast<int32_t*>(dataptr)[dst_idx] = static_cast<int32_t>(v);
           *skipped_row                            = false;
         }
       } break;
 
       case type_long: {
         int64_t v = avro_decode_zigzag_varint(cur, end);
-        if (dataptr != nullptr && dst_row >= 0) {
-          static_cast<int64_t*>(dataptr)[dst_row] = v;
+        if (dataptr != nullptr && dst_idx >= 0) {
+          static_cast<int64_t*>(dataptr)[dst_idx] = v;
           *skipped_row                            = false;
         }
       } break;
@@ -182,15 +198,15 @@ avro_decode_row(schemadesc_s const* schema,
           count = (size_t)v;
           cur += count;
         }
-        if (dataptr != nullptr && dst_row >= 0) {
-          static_cast<string_index_pair*>(dataptr)[dst_row].first  = ptr;
-          static_cast<string_index_pair*>(dataptr)[dst_row].second = count;
+        if (dataptr != nullptr && dst_idx >= 0) {
+          static_cast<string_index_pair*>(dataptr)[dst_idx].first  = ptr;
+          static_cast<string_index_pair*>(dataptr)[dst_idx].second = count;
           *skipped_row                                             = false;
         }
       } break;
 
       case type_float:
-        if (dataptr != nullptr && dst_row >= 0) {
+        if (dataptr != nullptr && dst_idx >= 0) {
           uint32_t v;
           if (cur + 3 < end) {
             v = unaligned_load32(cur);
@@ -198,7 +214,7 @@ avro_decode_row(schemadesc_s const* schema,
           } else {
             v = 0;
           }
-          static_cast<uint32_t*>(dataptr)[dst_row] = v;
+          static_cast<uint32_t*>(dataptr)[dst_idx] = v;
           *skipped_row                             = false;
         } else {
           cur += 4;
@@ -206,7 +222,7 @@ avro_decode_row(schemadesc_s const* schema,
         break;
 
       case type_double:
-        if (dataptr != nullptr && dst_row >= 0) {
+        if (dataptr != nullptr && dst_idx >= 0) {
           uint64_t v;
           if (cur + 7 < end) {
             v = unaligned_load64(cur);
@@ -214,7 +230,7 @@ avro_decode_row(schemadesc_s const* schema,
           } else {
             v = 0;
           }
-          static_cast<uint64_t*>(dataptr)[dst_row] = v;
+          static_cast<uint64_t*>(dataptr)[dst_idx] = v;
           *skipped_row                             = false;
         } else {
           cur += 8;
@@ -222,9 +238,9 @@ avro_decode_row(schemadesc_s const* schema,
         break;
 
       case type_boolean:
-        if (dataptr != nullptr && dst_row >= 0) {
+        if (dataptr != nullptr && dst_idx >= 0) {
           uint8_t v                               = (cur < end) ? *cur : 0;
-          static_cast<uint8_t*>(dataptr)[dst_row] = (v) ? 1 : 0;
+          static_cast<uint8_t*>(dataptr)[dst_idx] = (v) ? 1 : 0;
           *skipped_row                            = false;
         }
         cur++;
@@ -236,6 +252,18 @@ avro_decode_row(schemadesc_s const* schema,
           avro_decode_zigzag_varint(cur, end);  // block size in bytes, ignored
           array_block_count = -array_block_count;
         }
+        if (not array_next_block) {
+          dst_item = (dataptr != nullptr && dst_idx >= 0 && not count_array_items)
+                       ? static_cast<size_type const*>(dataptr)[dst_idx]
+                       : -1;
+        }
+        if (dataptr != nullptr && dst_idx >= 0) {
+          if (count_array_items) {
+            static_cast<size_type*>(dataptr)[dst_idx] += array_block_count;
+          }
+          *skipped_row = false;
+        }
+        array_next_block   = false;
         array_start        = i;
         array_repeat_count = array_block_count;
         array_children     = 1;
@@ -274,16 +302,16 @@ avro_decode_row(schemadesc_s const* schema,
         // be correct:
         //
         // int64_t v = avro_decode_zigzag_varint(cur, end);
-        // if (dataptr != nullptr && dst_row >= 0) {
-        //   static_cast<int64_t*>(dataptr)[dst_row] = v;
+        // if (dataptr != nullptr && dst_idx >= 0) {
+        //   static_cast<int64_t*>(dataptr)[dst_idx] = v;
         //   *skipped_row = false;
         // }
       } break;
 
       case type_date: {
         int64_t v = avro_decode_zigzag_varint(cur, end);
-        if (dataptr != nullptr && dst_row >= 0) {
-          static_cast<int32_t*>(dataptr)[dst_row] = static_cast<int32_t>(v);
+        if (dataptr != nullptr && dst_idx >= 0) {
+          static_cast<int32_t*>(dataptr)[dst_idx] = static_cast<int32_t>(v);
           *skipped_row                            = false;
         }
       } break;
@@ -301,8 +329,10 @@ avro_decode_row(schemadesc_s const* schema,
     }
     // If within an array, check if we reached the last item
     if (array_repeat_count != 0 && array_children <= 0 && cur < end) {
+      if (dst_item >= 0) { ++dst_item; }
       if (!--array_repeat_count) {
-        i = array_start;  // Restart at the array parent
+        i                = array_start;  // Restart at the array parent
+        array_next_block = true;
       } else {
         i              = array_start + 1;  // Restart after the array parent
         array_children = schema[array_start].count;
@@ -321,6 +351,7 @@ avro_decode_row(schemadesc_s const* schema,
  * @param[in] avro_data Raw block data
  * @param[in] schema_len Number of entries in schema
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in] count_array_items Whether to only count the items of the saved arrays
  */
 // blockDim {32,num_warps,1}
 CUDF_KERNEL void __launch_bounds__(num_warps * 32, 2)
@@ -329,7 +360,8 @@ CUDF_KERNEL void __launch_bounds__(num_warps * 32, 2)
                           device_span<string_index_pair const> global_dictionary,
                           uint8_t const* avro_data,
                           uint32_t schema_len,
-                          uint32_t min_row_size)
+                          uint32_t min_row_size,
+                          bool count_array_items)
 {
   __shared__ __align__(8) schemadesc_s g_shared_schema[max_shared_schema_len];
   __shared__ __align__(8) block_desc_s blk_g[num_warps];
@@ -389,6 +421,7 @@ CUDF_KERNEL void __launch_bounds__(num_warps * 32, 2)
                             cur,
                             end,
                             global_dictionary,
+                            count_array_items,
                             &skipped_row);
       if (!skipped_row) { rows_remaining -= nrows; }
     }
@@ -418,6 +451,7 @@ CUDF_KERNEL void __launch_bounds__(num_warps * 32, 2)
  * @param[in] avro_data Raw block data
  * @param[in] schema_len Number of entries in schema
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in] count_array_items Whether to only count the items of the saved arrays
  * @param[in] stream CUDA stream to use
  */
 void DecodeAvroColumnData(device_span<block_desc_s const> blocks,
@@ -426,6 +460,7 @@ void DecodeAvroColumnData(device_span<block_desc_s const> blocks,
                           uint8_t const* avro_data,
                           uint32_t schema_len,
                           uint32_t min_row_size,
+                          bool count_array_items,
                           rmm::cuda_stream_view stream)
 {
   // num_warps warps per threadblock
@@ -434,7 +469,7 @@ void DecodeAvroColumnData(device_span<block_desc_s const> blocks,
   dim3 const dim_grid((blocks.size() + num_warps - 1) / num_warps, 1);
 
   gpuDecodeAvroColumnData<<<dim_grid, dim_block, 0, stream.value()>>>(
-    blocks, schema, global_dictionary, avro_data, schema_len, min_row_size);
+    blocks, schema, global_dictionary, avro_data, schema_len, min_row_size, count_array_items);
 }
 
 }  // namespace gpu
@@ -34,7 +34,8 @@ struct schemadesc_s {
   cudf::io::avro::logicaltype_kind_e logical_kind;  // avro logicaltype kind
   uint32_t count;  // for records/unions: number of following child columns, for nulls: global
                    // null_count, for enums: dictionary ofs
-  void* dataptr;   // Ptr to column data, or null if column not selected
+  void* dataptr;   // Ptr to column data, or null if column not selected; for arrays: offsets
+                   // of the items of each row, or item counts when counting array items
 };
 
 /**
@@ -46,6 +47,8 @@ struct schemadesc_s {
  * @param[in] avro_data Raw block data
  * @param[in] schema_len Number of entries in schema
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in] count_array_items Whether to only add the number of items of each row to the
+ * `dataptr` of the saved arrays, instead of decoding the column data
  * @param[in] stream CUDA stream to use
  */
 void DecodeAvroColumnData(cudf::device_span<block_desc_s const> blocks,
@@ -54,6 +57,7 @@ void DecodeAvroColumnData(cudf::device_span<block_desc_s const> blocks,
                           uint8_t const* avro_data,
                           uint32_t schema_len,
                           uint32_t min_row_size,
+                          bool count_array_items,
                           rmm::cuda_stream_view stream);
 
 }  // namespace gpu
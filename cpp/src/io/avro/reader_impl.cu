@@ -16,11 +16,15 @@
 
 #include "avro.hpp"
 #include "avro_gpu.hpp"
+#include "io/comp/batch_scheduler.hpp"
 #include "io/comp/gpuinflate.hpp"
+#include "io/comp/nvcomp_adapter.hpp"
 #include "io/utilities/column_buffer.hpp"
+#include "io/utilities/config_utils.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/avro.hpp>
@@ -34,14 +38,11 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <thrust/equal.h>
-#include <thrust/functional.h>
-#include <thrust/iterator/constant_iterator.h>
-#include <thrust/iterator/transform_output_iterator.h>
-#include <thrust/tabulate.h>
-
-#include <nvcomp/snappy.h>
+#include <cuda/functional>
+#include <thrust/fill.h>
+#include <thrust/transform.h>
 
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -90,6 +91,9 @@ type_id to_type_id(avro::schema_entry const* col)
     case avro::type_local_timestamp_millis: return type_id::TIMESTAMP_MILLISECONDS;
     case avro::type_local_timestamp_micros: return type_id::TIMESTAMP_MICROSECONDS;
     case avro::type_enum: return (!col->symbols.empty()) ? type_id::STRING : type_id::INT32;
+    // Maps are described as arrays of {key, value} records by the schema parser
+    case avro::type_array: return type_id::LIST;
+    case avro::type_record: return type_id::STRUCT;
     // The avro time-millis and time-micros types are closest to Arrow's
     // TIME32 and TIME64.  They're single-day units, i.e. they won't exceed
     // 23:59:59.9999 (or .999999 for micros).  There's no equivalent cudf
@@ -105,6 +109,138 @@ type_id to_type_id(avro::schema_entry const* col)
   }
 }
 
+/**
+ * @brief Returns the index one past the last entry of the subtree of a schema entry
+ */
+int subtree_end(std::vector<schema_entry> const& schema, int idx)
+{
+  for (int remaining = 1; remaining > 0; ++idx) {
+    remaining += schema[idx].num_children - 1;
+  }
+  return idx;
+}
+
+/**
+ * @brief Returns whether a schema entry is nested within an array
+ */
+bool is_in_array(std::vector<schema_entry> const& schema, int idx)
+{
+  for (int parent_idx = schema[idx].parent_idx; parent_idx > 0;
+       parent_idx     = schema[parent_idx].parent_idx) {
+    if (schema[parent_idx].kind == avro::type_array) { return true; }
+  }
+  return false;
+}
+
+/**
+ * @brief Schema entries of the data and of the null of a value that is optionally nullable
+ */
+struct nullable_entry {
+  int data_idx;  ///< Schema index of the data entry
+  int null_idx;  ///< Schema index of the null entry of the value's union, or -1
+};
+
+/**
+ * @brief Returns the schema entries of a value, which is either a type or a union of null and a
+ * type
+ */
+nullable_entry nullable_value(std::vector<schema_entry> const& schema, int idx)
+{
+  if (schema[idx].kind != avro::type_union) { return {idx, -1}; }
+  CUDF_EXPECTS(schema[idx].num_children >= 1 && schema[idx].num_children <= 2,
+               "Union with non-null type not currently supported");
+  auto const first = idx + 1;
+  if (schema[idx].num_children == 1) { return {first, -1}; }
+  auto const second = subtree_end(schema, first);
+  if (schema[first].kind == avro::type_null) { return {second, first}; }
+  CUDF_EXPECTS(schema[second].kind == avro::type_null,
+               "Union with non-null type not currently supported");
+  return {first, second};
+}
+
+/**
+ * @brief Builds the unallocated buffer tree of the items of an array
+ *
+ * @param schema Avro schema
+ * @param idx Schema index of the items of the array, or of a field of an item record
+ * @param name Name of the buffer
+ */
+column_buffer make_item_buffer(std::vector<schema_entry> const& schema, int idx, std::string name)
+{
+  auto const [data_idx, null_idx] = nullable_value(schema, idx);
+  auto const& entry               = schema[data_idx];
+  CUDF_EXPECTS(entry.kind != avro::type_array, "Nested arrays are not currently supported");
+  auto const type = to_type_id(&entry);
+  CUDF_EXPECTS(type != type_id::EMPTY, "Unsupported data type");
+
+  column_buffer buffer(data_type{type}, null_idx >= 0);
+  buffer.name = std::move(name);
+  if (entry.kind == avro::type_record) {
+    auto child = data_idx + 1;
+    for (int i = 0; i < entry.num_children; ++i) {
+      buffer.children.push_back(make_item_buffer(schema, child, schema[child].name));
+      child = subtree_end(schema, child);
+    }
+  }
+  return buffer;
+}
+
+/**
+ * @brief Schema entries decoded into a buffer of array items
+ */
+struct item_target {
+  int data_idx;           ///< Schema index of the data entry
+  int null_idx;           ///< Schema index of the null entry, or -1
+  column_buffer* buffer;  ///< Destination buffer
+};
+
+/**
+ * @brief Collects the schema entries decoded into the buffer tree built by `make_item_buffer`
+ */
+void collect_item_targets(std::vector<schema_entry> const& schema,
+                          int idx,
+                          column_buffer& buffer,
+                          std::vector<item_target>& targets)
+{
+  auto const [data_idx, null_idx] = nullable_value(schema, idx);
+  targets.push_back({data_idx, null_idx, &buffer});
+  auto child = data_idx + 1;
+  for (auto& child_buffer : buffer.children) {
+    collect_item_targets(schema, child, child_buffer, targets);
+    child = subtree_end(schema, child);
+  }
+}
+
+/**
+ * @brief Allocates a buffer tree of array items, with all items valid
+ */
+void create_item_buffers(column_buffer& buffer,
+                         size_type num_items,
+                         rmm::cuda_stream_view stream,
+                         rmm::mr::device_memory_resource* mr)
+{
+  buffer.create(num_items, stream, mr);
+  if (buffer.null_mask_size()) {
+    cudf::detail::set_null_mask(buffer.null_mask(), 0, num_items, true, stream);
+  }
+  for (auto& child : buffer.children) {
+    create_item_buffers(child, num_items, stream, mr);
+  }
+}
+
+/**
+ * @brief Sets the null counts of a decoded buffer tree of array items
+ */
+void set_item_null_counts(column_buffer& buffer, rmm::cuda_stream_view stream)
+{
+  if (buffer.null_mask_size()) {
+    buffer.null_count() = cudf::detail::null_count(buffer.null_mask(), 0, buffer.size, stream);
+  }
+  for (auto& child : buffer.children) {
+    set_item_null_counts(child, stream);
+  }
+}
+
 }  // namespace
 
 /**
@@ -148,7 +284,8 @@ class metadata : public file_metadata {
         for (int i = 0; i < num_avro_columns; ++i, ++index) {
           if (index >= num_avro_columns) { index = 0; }
           if (columns[index].name == use_name &&
-              type_id::EMPTY != to_type_id(&schema[columns[index].schema_data_idx])) {
+              type_id::EMPTY != to_type_id(&schema[columns[index].schema_data_idx]) &&
+              !is_in_array(schema, columns[index].schema_data_idx)) {
             selection.emplace_back(index, columns[index].name);
             index++;
             break;
@@ -158,17 +295,8 @@ class metadata : public file_metadata {
       CUDF_EXPECTS(selection.size() > 0, "Filtered out all columns");
     } else {
       for (int i = 0; i < num_avro_columns; ++i) {
-        // Exclude array columns (unsupported)
-        bool column_in_array = false;
-        for (int parent_idx = schema[columns[i].schema_data_idx].parent_idx; parent_idx > 0;
-             parent_idx     = schema[parent_idx].parent_idx) {
-          if (schema[parent_idx].kind == avro::type_array) {
-            column_in_array = true;
-            break;
-          }
-        }
-
-        if (!column_in_array) {
+        // Exclude the items of arrays, which are read as children of the list columns
+        if (!is_in_array(schema, columns[i].schema_data_idx)) {
           auto col_type = to_type_id(&schema[columns[i].schema_data_idx]);
           CUDF_EXPECTS(col_type != type_id::EMPTY, "Unsupported data type");
           selection.emplace_back(i, columns[i].name);
@@ -188,13 +316,22 @@ rmm::device_buffer decompress_data(datasource& source,
                                    rmm::device_buffer const& comp_block_data,
                                    rmm::cuda_stream_view stream)
 {
+  size_t const num_blocks = meta.block_list.size();
+
+  // comp_block_data contains contents of the avro file starting from the first block, excluding
+  // file header. meta.block_list[i].offset refers to offset of block i in the file, including
+  // file header.
+  auto const base_offset = meta.block_list[0].offset;
+  auto const block_input = [&](auto const& block, size_t size) {
+    return device_span<uint8_t const>{
+      static_cast<uint8_t const*>(comp_block_data.data()) + (block.offset - base_offset), size};
+  };
+
   if (meta.codec == "deflate") {
-    auto inflate_in =
-      cudf::detail::hostdevice_vector<device_span<uint8_t const>>(meta.block_list.size(), stream);
-    auto inflate_out =
-      cudf::detail::hostdevice_vector<device_span<uint8_t>>(meta.block_list.size(), stream);
-    auto inflate_stats =
-      cudf::detail::hostdevice_vector<compression_result>(meta.block_list.size(), stream);
+    std::vector<device_span<uint8_t const>> inflate_in;
+    std::vector<device_span<uint8_t>> inflate_out(num_blocks);
+    inflate_in.reserve(num_blocks);
+    auto inflate_stats = cudf::detail::hostdevice_vector<compression_result>(num_blocks, stream);
     thrust::fill(rmm::exec_policy(stream),
                  inflate_stats.d_begin(),
                  inflate_stats.d_end(),
@@ -203,16 +340,12 @@ rmm::device_buffer decompress_data(datasource& source,
     // Guess an initial maximum uncompressed block size. We estimate the compression factor is two
     // and round up to the next multiple of 4096 bytes.
     uint32_t const initial_blk_len = meta.max_block_size * 2 + (meta.max_block_size * 2) % 4096;
-    size_t const uncomp_size       = initial_blk_len * meta.block_list.size();
+    size_t const uncomp_size       = initial_blk_len * num_blocks;
 
     rmm::device_buffer decomp_block_data(uncomp_size, stream);
 
-    auto const base_offset = meta.block_list[0].offset;
-    for (size_t i = 0, dst_pos = 0; i < meta.block_list.size(); i++) {
-      auto const src_pos = meta.block_list[i].offset - base_offset;
-
-      inflate_in[i]  = {static_cast<uint8_t const*>(comp_block_data.data()) + src_pos,
-                        meta.block_list[i].size};
+    for (size_t i = 0, dst_pos = 0; i < num_blocks; i++) {
+      inflate_in.push_back(block_input(meta.block_list[i], meta.block_list[i].size));
       inflate_out[i] = {static_cast<uint8_t*>(decomp_block_data.data()) + dst_pos, initial_blk_len};
 
       // Update blocks offsets & sizes to refer to uncompressed data
@@ -220,11 +353,16 @@ rmm::device_buffer decompress_data(datasource& source,
       meta.block_list[i].size   = static_cast<uint32_t>(inflate_out[i].size());
       dst_pos += meta.block_list[i].size;
     }
-    inflate_in.host_to_device_async(stream);
 
     for (int loop_cnt = 0; loop_cnt < 2; loop_cnt++) {
-      inflate_out.host_to_device_async(stream);
-      gpuinflate(inflate_in, inflate_out, inflate_stats, gzip_header_included::NO, stream);
+      schedule_batches(
+        inflate_in,
+        inflate_out,
+        inflate_stats,
+        [](auto in, auto out, auto res, batch_output_sizes, auto strm) {
+          gpuinflate(in, out, res, gzip_header_included::NO, strm);
+        },
+        stream);
       inflate_stats.device_to_host_sync(stream);
 
       // Check if larger output is required, as it's not known ahead of time
@@ -246,7 +384,7 @@ rmm::device_buffer decompress_data(datasource& source,
           std::accumulate(actual_uncomp_sizes.cbegin(), actual_uncomp_sizes.cend(), 0ul);
         if (total_actual_uncomp_size > uncomp_size) {
           decomp_block_data.resize(total_actual_uncomp_size, stream);
-          for (size_t i = 0; i < meta.block_list.size(); ++i) {
+          for (size_t i = 0; i < num_blocks; ++i) {
             meta.block_list[i].offset =
               i > 0 ? (meta.block_list[i - 1].size + meta.block_list[i - 1].offset) : 0;
             meta.block_list[i].size = static_cast<uint32_t>(actual_uncomp_sizes[i]);
@@ -263,98 +401,87 @@ rmm::device_buffer decompress_data(datasource& source,
 
     return decomp_block_data;
   } else if (meta.codec == "snappy") {
-    size_t const num_blocks = meta.block_list.size();
-
-    // comp_block_data contains contents of the avro file starting from the first block, excluding
-    // file header. meta.block_list[i].offset refers to offset of block i in the file, including
-    // file header.
-    // Find ptrs to each compressed block in comp_block_data by removing header offset.
-    cudf::detail::hostdevice_vector<void const*> compressed_data_ptrs(num_blocks, stream);
-    std::transform(meta.block_list.begin(),
-                   meta.block_list.end(),
-                   compressed_data_ptrs.host_ptr(),
-                   [&](auto const& block) {
-                     return static_cast<std::byte const*>(comp_block_data.data()) +
-                            (block.offset - meta.block_list[0].offset);
-                   });
-    compressed_data_ptrs.host_to_device_async(stream);
-
-    cudf::detail::hostdevice_vector<size_t> compressed_data_sizes(num_blocks, stream);
-    std::transform(meta.block_list.begin(),
-                   meta.block_list.end(),
-                   compressed_data_sizes.host_ptr(),
-                   [](auto const& block) { return block.size; });
-    compressed_data_sizes.host_to_device_async(stream);
+    // Each compressed block is followed by the big-endian CRC32 checksum of its uncompressed data
+    constexpr size_t snappy_checksum_size = 4;
+
+    std::vector<device_span<uint8_t const>> snappy_in;
+    snappy_in.reserve(num_blocks);
+    for (auto const& block : meta.block_list) {
+      CUDF_EXPECTS(block.size > snappy_checksum_size, "Invalid snappy compressed block");
+      snappy_in.push_back(block_input(block, block.size - snappy_checksum_size));
+    }
+    auto const d_snappy_in = cudf::detail::make_device_uvector_async(
+      snappy_in, stream, rmm::mr::get_current_device_resource());
 
+    // The uncompressed size of a block is the varint at the start of its snappy stream
     cudf::detail::hostdevice_vector<size_t> uncompressed_data_sizes(num_blocks, stream);
-    nvcompStatus_t status =
-      nvcompBatchedSnappyGetDecompressSizeAsync(compressed_data_ptrs.device_ptr(),
-                                                compressed_data_sizes.device_ptr(),
-                                                uncompressed_data_sizes.device_ptr(),
-                                                num_blocks,
-                                                stream.value());
-    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
-                 "Unable to get uncompressed sizes for snappy compressed blocks");
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      d_snappy_in.begin(),
+                      d_snappy_in.end(),
+                      uncompressed_data_sizes.d_begin(),
+                      cuda::proclaim_return_type<size_t>(
+                        [] __device__(device_span<uint8_t const> block) {
+                          size_t size = 0;
+                          for (size_t i = 0; i < block.size() && i < 5; ++i) {
+                            size |= static_cast<size_t>(block[i] & 0x7f) << (7 * i);
+                            if ((block[i] & 0x80) == 0) { break; }
+                          }
+                          return size;
+                        }));
     uncompressed_data_sizes.device_to_host_sync(stream);
 
+    std::vector<size_t> uncompressed_data_offsets(num_blocks);
+    std::exclusive_scan(uncompressed_data_sizes.begin(),
+                        uncompressed_data_sizes.end(),
+                        uncompressed_data_offsets.begin(),
+                        size_t{0});
     size_t const uncompressed_data_size =
-      std::reduce(uncompressed_data_sizes.begin(), uncompressed_data_sizes.end());
-    size_t const max_uncomp_block_size = std::reduce(
-      uncompressed_data_sizes.begin(), uncompressed_data_sizes.end(), 0, thrust::maximum<size_t>());
-
-    size_t temp_size;
-    status =
-      nvcompBatchedSnappyDecompressGetTempSize(num_blocks, max_uncomp_block_size, &temp_size);
-    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
-                 "Unable to get scratch size for snappy decompression");
+      uncompressed_data_offsets.back() + uncompressed_data_sizes[num_blocks - 1];
 
-    rmm::device_buffer scratch(temp_size, stream);
     rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
-    rmm::device_uvector<void*> uncompressed_data_ptrs(num_blocks, stream);
-    cudf::detail::hostdevice_vector<size_t> uncompressed_data_offsets(num_blocks, stream);
+    std::vector<device_span<uint8_t>> snappy_out;
+    snappy_out.reserve(num_blocks);
+    for (size_t i = 0; i < num_blocks; i++) {
+      snappy_out.emplace_back(
+        static_cast<uint8_t*>(decomp_block_data.data()) + uncompressed_data_offsets[i],
+        uncompressed_data_sizes[i]);
+    }
+
+    cudf::detail::hostdevice_vector<compression_result> snappy_stats(num_blocks, stream);
+    thrust::fill(rmm::exec_policy_nosync(stream),
+                 snappy_stats.d_begin(),
+                 snappy_stats.d_end(),
+                 compression_result{0, compression_status::FAILURE});
+    if (cudf::io::detail::nvcomp_integration::is_stable_enabled()) {
+      schedule_batches(
+        snappy_in,
+        snappy_out,
+        snappy_stats,
+        [](auto in, auto out, auto res, batch_output_sizes sizes, auto strm) {
+          nvcomp::batched_decompress(
+            nvcomp::compression_type::SNAPPY, in, out, res, sizes.max_size, sizes.total_size, strm);
+        },
+        stream);
+    } else {
+      schedule_batches(
+        snappy_in,
+        snappy_out,
+        snappy_stats,
+        [](auto in, auto out, auto res, batch_output_sizes, auto strm) {
+          gpu_unsnap(in, out, res, strm);
+        },
+        stream);
+    }
+    snappy_stats.device_to_host_sync(stream);
 
-    std::exclusive_scan(uncompressed_data_sizes.begin(),
-                        uncompressed_data_sizes.end(),
-                        uncompressed_data_offsets.begin(),
-                        0);
-    uncompressed_data_offsets.host_to_device_async(stream);
-
-    thrust::tabulate(rmm::exec_policy(stream),
-                     uncompressed_data_ptrs.begin(),
-                     uncompressed_data_ptrs.end(),
-                     [off  = uncompressed_data_offsets.device_ptr(),
-                      data = static_cast<std::byte*>(decomp_block_data.data())] __device__(int i) {
-                       return data + off[i];
-                     });
-
-    rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_blocks, stream);
-    rmm::device_uvector<nvcompStatus_t> statuses(num_blocks, stream);
-
-    status = nvcompBatchedSnappyDecompressAsync(compressed_data_ptrs.device_ptr(),
-                                                compressed_data_sizes.device_ptr(),
-                                                uncompressed_data_sizes.device_ptr(),
-                                                actual_uncompressed_data_sizes.data(),
-                                                num_blocks,
-                                                scratch.data(),
-                                                scratch.size(),
-                                                uncompressed_data_ptrs.data(),
-                                                statuses.data(),
-                                                stream);
-    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess, "unable to perform snappy decompression");
-
-    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                               uncompressed_data_sizes.d_begin(),
-                               uncompressed_data_sizes.d_end(),
-                               actual_uncompressed_data_sizes.begin()),
-                 "Mismatch in expected and actual decompressed size during snappy decompression");
-    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                               statuses.begin(),
-                               statuses.end(),
-                               thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
-                 "Error during snappy decompression");
-
-    // Update blocks offsets & sizes to refer to uncompressed data
     for (size_t i = 0; i < num_blocks; i++) {
+      CUDF_EXPECTS(snappy_stats[i].status == compression_status::SUCCESS,
+                   "Error during snappy decompression");
+      CUDF_EXPECTS(
+        snappy_stats[i].bytes_written == uncompressed_data_sizes[i],
+        "Mismatch in expected and actual decompressed size during snappy decompression");
+
+      // Update blocks offsets & sizes to refer to uncompressed data
       meta.block_list[i].offset = uncompressed_data_offsets[i];
       meta.block_list[i].size   = uncompressed_data_sizes[i];
     }
@@ -380,7 +507,20 @@ std::vector<column_buffer> decode_data(metadata& meta,
   for (size_t i = 0; i < column_types.size(); ++i) {
     auto col_idx     = selection[i].first;
     bool is_nullable = (meta.columns[col_idx].schema_null_idx >= 0);
-    out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, mr);
+    if (column_types[i].id() == type_id::LIST) {
+      // The offsets of the items are counted into the buffer before they are scanned, so the
+      // buffer has one more entry than rows
+      out_buffers.emplace_back(column_types[i], num_rows + 1, is_nullable, stream, mr);
+      auto const items_idx = meta.columns[col_idx].schema_data_idx + 1;
+      out_buffers.back().children.push_back(
+        make_item_buffer(meta.schema, items_idx, meta.schema[items_idx].name));
+      CUDF_CUDA_TRY(cudaMemsetAsync(out_buffers.back().data(),
+                                    0,
+                                    (num_rows + 1) * sizeof(size_type),
+                                    stream.value()));
+    } else {
+      out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, mr);
+    }
   }
 
   // Build gpu schema
@@ -417,7 +557,7 @@ std::vector<column_buffer> decode_data(metadata& meta,
     schema_desc[i].kind         = kind;
     schema_desc[i].logical_kind = logical_kind;
     schema_desc[i].count =
-      (kind == type_enum) ? 0 : static_cast<uint32_t>(meta.schema[i].num_children);
+      (kind == type_enum) ? dict[i].first : static_cast<uint32_t>(meta.schema[i].num_children);
     schema_desc[i].dataptr = nullptr;
     CUDF_EXPECTS(kind != type_union || meta.schema[i].num_children < 2 ||
                    (meta.schema[i].num_children == 2 &&
@@ -438,9 +578,6 @@ std::vector<column_buffer> decode_data(metadata& meta,
         valid_alias[i] = schema_desc[schema_null_idx].dataptr;
       }
     }
-    if (meta.schema[schema_data_idx].kind == type_enum) {
-      schema_desc[schema_data_idx].count = dict[i].first;
-    }
     if (out_buffers[i].null_mask_size()) {
       cudf::detail::set_null_mask(out_buffers[i].null_mask(), 0, num_rows, true, stream);
     }
@@ -449,6 +586,50 @@ std::vector<column_buffer> decode_data(metadata& meta,
   auto block_list = cudf::detail::make_device_uvector_async(
     meta.block_list, stream, rmm::mr::get_current_device_resource());
 
+  auto const has_lists = std::any_of(column_types.cbegin(), column_types.cend(), [](auto type) {
+    return type.id() == type_id::LIST;
+  });
+  if (has_lists) {
+    // Count the items of each row of the arrays, without decoding the other columns
+    auto count_desc =
+      cudf::detail::hostdevice_vector<gpu::schemadesc_s>(schema_desc.size(), stream);
+    for (size_t i = 0; i < schema_desc.size(); i++) {
+      count_desc[i] = schema_desc[i];
+      if (count_desc[i].kind != type_array) { count_desc[i].dataptr = nullptr; }
+    }
+    count_desc.host_to_device_async(stream);
+    gpu::DecodeAvroColumnData(block_list,
+                              count_desc.device_ptr(),
+                              global_dictionary,
+                              static_cast<uint8_t const*>(block_data.data()),
+                              static_cast<uint32_t>(count_desc.size()),
+                              min_row_data_size,
+                              true,
+                              stream);
+
+    // Allocate the items, and decode them along with the other columns
+    std::vector<item_target> item_targets;
+    for (size_t i = 0; i < out_buffers.size(); i++) {
+      if (column_types[i].id() != type_id::LIST) { continue; }
+      auto const d_offsets = static_cast<size_type*>(out_buffers[i].data());
+      auto const num_items =
+        cudf::detail::sizes_to_offsets(d_offsets, d_offsets + num_rows + 1, d_offsets, stream);
+      CUDF_EXPECTS(num_items <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+                   "Size of output exceeds the column size limit",
+                   std::overflow_error);
+      auto& items = out_buffers[i].children[0];
+      create_item_buffers(items, static_cast<size_type>(num_items), stream, mr);
+      collect_item_targets(
+        meta.schema, meta.columns[selection[i].first].schema_data_idx + 1, items, item_targets);
+    }
+    for (auto const& target : item_targets) {
+      schema_desc[target.data_idx].dataptr = target.buffer->data();
+      if (target.null_idx >= 0) {
+        schema_desc[target.null_idx].dataptr = target.buffer->null_mask();
+      }
+    }
+  }
+
   schema_desc.host_to_device_async(stream);
 
   gpu::DecodeAvroColumnData(block_list,
@@ -457,6 +638,7 @@ std::vector<column_buffer> decode_data(metadata& meta,
                             static_cast<uint8_t const*>(block_data.data()),
                             static_cast<uint32_t>(schema_desc.size()),
                             min_row_data_size,
+                            false,
                             stream);
 
   // Copy valid bits that are shared between columns
@@ -475,6 +657,9 @@ std::vector<column_buffer> decode_data(metadata& meta,
     auto const col_idx          = selection[i].first;
     auto const schema_null_idx  = meta.columns[col_idx].schema_null_idx;
     out_buffers[i].null_count() = (schema_null_idx >= 0) ? schema_desc[schema_null_idx].count : 0;
+    if (column_types[i].id() == type_id::LIST) {
+      set_item_null_counts(out_buffers[i].children[0], stream);
+    }
   }
 
   return out_buffers;
@@ -498,6 +683,8 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
 
   // Select only columns required by the options
   auto selected_columns = meta.select_columns(options.get_columns());
+  // Column names, along with the names of the children of the nested columns
+  metadata_out.schema_info.resize(selected_columns.size());
   if (not selected_columns.empty()) {
     // Get a list of column data types
     std::vector<data_type> column_types;
@@ -536,15 +723,16 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
       size_t total_dictionary_entries = 0;
       size_t dictionary_data_size     = 0;
 
-      auto dict = std::vector<std::pair<uint32_t, uint32_t>>(column_types.size());
+      // Dictionary of the enum symbols of each schema entry, as the enums of array items are
+      // decoded along with the selected columns
+      auto dict = std::vector<std::pair<uint32_t, uint32_t>>(meta.schema.size());
 
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col_idx     = selected_columns[i].first;
-        auto& col_schema = meta.schema[meta.columns[col_idx].schema_data_idx];
-        dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
-        dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
+      for (size_t i = 0; i < meta.schema.size(); ++i) {
+        auto const& entry = meta.schema[i];
+        dict[i].first     = static_cast<uint32_t>(total_dictionary_entries);
+        dict[i].second    = static_cast<uint32_t>(entry.symbols.size());
         total_dictionary_entries += dict[i].second;
-        for (auto const& sym : col_schema.symbols) {
+        for (auto const& sym : entry.symbols) {
           dictionary_data_size += sym.length();
         }
       }
@@ -557,17 +745,16 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
         auto h_global_dict_data = std::vector<char>(dictionary_data_size);
         size_t dict_pos         = 0;
 
-        for (size_t i = 0; i < column_types.size(); ++i) {
-          auto const col_idx          = selected_columns[i].first;
-          auto const& col_schema      = meta.schema[meta.columns[col_idx].schema_data_idx];
-          auto const col_dict_entries = &(h_global_dict[dict[i].first]);
+        for (size_t i = 0; i < meta.schema.size(); ++i) {
+          auto const& entry        = meta.schema[i];
+          auto const entry_symbols = &(h_global_dict[dict[i].first]);
           for (size_t j = 0; j < dict[i].second; j++) {
-            auto const& symbols = col_schema.symbols[j];
+            auto const& symbols = entry.symbols[j];
 
-            auto const data_dst        = h_global_dict_data.data() + dict_pos;
-            auto const len             = symbols.length();
-            col_dict_entries[j].first  = data_dst;
-            col_dict_entries[j].second = len;
+            auto const data_dst     = h_global_dict_data.data() + dict_pos;
+            auto const len          = symbols.length();
+            entry_symbols[j].first  = data_dst;
+            entry_symbols[j].second = len;
 
             std::copy(symbols.c_str(), symbols.c_str() + len, data_dst);
             dict_pos += len;
@@ -593,23 +780,26 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
                                      mr);
 
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], nullptr, std::nullopt, stream));
+        out_buffers[i].name = selected_columns[i].second;
+        out_columns.emplace_back(
+          make_column(out_buffers[i], &metadata_out.schema_info[i], std::nullopt, stream));
       }
     } else {
-      // Create empty columns
+      // Create empty columns, with the item hierarchy of the list columns
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_empty_column(column_types[i]));
+        auto const& col = meta.columns[selected_columns[i].first];
+        column_buffer buffer(column_types[i], col.schema_null_idx >= 0);
+        buffer.name = selected_columns[i].second;
+        if (column_types[i].id() == type_id::LIST) {
+          auto const items_idx = col.schema_data_idx + 1;
+          buffer.children.push_back(
+            make_item_buffer(meta.schema, items_idx, meta.schema[items_idx].name));
+        }
+        out_columns.emplace_back(empty_like(buffer, &metadata_out.schema_info[i], stream, mr));
       }
     }
   }
 
-  // Return column names
-  metadata_out.schema_info.reserve(selected_columns.size());
-  std::transform(selected_columns.cbegin(),
-                 selected_columns.cend(),
-                 std::back_inserter(metadata_out.schema_info),
-                 [](auto const& c) { return column_name_info{c.second}; });
-
   // Return user metadata
   metadata_out.user_data          = meta.user_data;
   metadata_out.per_file_user_data = {{meta.user_data.begin(), meta.user_data.end()}};
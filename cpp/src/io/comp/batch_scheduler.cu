@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "batch_scheduler.hpp"
+
+#include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/gather.h>
+#include <thrust/scatter.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace cudf::io::detail {
+
+namespace {
+
+// Smallest input size of each bucket but the last, from the largest chunks to the smallest
+constexpr std::array<std::size_t, 2> bucket_min_sizes{1024 * 1024, 64 * 1024};
+
+// Blocks larger than this are copied in multiple segments
+constexpr std::size_t max_copy_segment_size = 64 * 1024;
+
+}  // namespace
+
+void schedule_batches(host_span<device_span<uint8_t const> const> inputs,
+                      host_span<device_span<uint8_t> const> outputs,
+                      device_span<compression_result> results,
+                      batch_function const& fn,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(inputs.size() == outputs.size() and inputs.size() == results.size(),
+               "Mismatched number of inputs, outputs and results");
+  if (inputs.empty()) { return; }
+
+  std::vector<std::size_t> order(inputs.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+    return inputs[lhs].size() > inputs[rhs].size();
+  });
+
+  // Bounds of the non-empty buckets in `order`
+  std::vector<std::size_t> bucket_offsets{0};
+  for (auto const min_size : bucket_min_sizes) {
+    auto const is_in_bucket = [&](auto idx) { return inputs[idx].size() >= min_size; };
+    auto const bucket_begin = order.begin() + bucket_offsets.back();
+    auto const bucket_end   = static_cast<std::size_t>(
+      std::partition_point(bucket_begin, order.end(), is_in_bucket) - order.begin());
+    if (bucket_end > bucket_offsets.back()) { bucket_offsets.push_back(bucket_end); }
+  }
+  if (bucket_offsets.back() < order.size()) { bucket_offsets.push_back(order.size()); }
+  auto const num_buckets = bucket_offsets.size() - 1;
+
+  std::vector<device_span<uint8_t const>> sorted_inputs;
+  std::vector<device_span<uint8_t>> sorted_outputs;
+  sorted_inputs.reserve(order.size());
+  sorted_outputs.reserve(order.size());
+  for (auto const idx : order) {
+    sorted_inputs.push_back(inputs[idx]);
+    sorted_outputs.push_back(outputs[idx]);
+  }
+  auto const mr        = rmm::mr::get_current_device_resource();
+  auto const d_order   = cudf::detail::make_device_uvector_async(order, stream, mr);
+  auto const d_inputs  = cudf::detail::make_device_uvector_async(sorted_inputs, stream, mr);
+  auto const d_outputs = cudf::detail::make_device_uvector_async(sorted_outputs, stream, mr);
+  // Keeps the initial results for the chunks that the batch function skips
+  rmm::device_uvector<compression_result> sorted_results(order.size(), stream);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 d_order.begin(),
+                 d_order.end(),
+                 results.begin(),
+                 sorted_results.begin());
+
+  auto const run_bucket = [&](std::size_t bucket, rmm::cuda_stream_view bucket_stream) {
+    auto const begin = bucket_offsets[bucket];
+    auto const size  = bucket_offsets[bucket + 1] - begin;
+    batch_output_sizes sizes{0, 0};
+    for (auto i = begin; i < begin + size; ++i) {
+      sizes.max_size = std::max(sizes.max_size, sorted_outputs[i].size());
+      sizes.total_size += sorted_outputs[i].size();
+    }
+    fn(device_span<device_span<uint8_t const> const>{d_inputs.data() + begin, size},
+       device_span<device_span<uint8_t> const>{d_outputs.data() + begin, size},
+       device_span<compression_result>{sorted_results.data() + begin, size},
+       sizes,
+       bucket_stream);
+  };
+
+  if (num_buckets == 1) {
+    run_bucket(0, stream);
+  } else {
+    auto const streams = cudf::detail::fork_streams(stream, num_buckets);
+    for (std::size_t bucket = 0; bucket < num_buckets; ++bucket) {
+      run_bucket(bucket, streams[bucket]);
+    }
+    cudf::detail::join_streams(streams, stream);
+  }
+
+  thrust::scatter(rmm::exec_policy_nosync(stream),
+                  sorted_results.begin(),
+                  sorted_results.end(),
+                  d_order.begin(),
+                  results.begin());
+}
+
+void copy_uncompressed_blocks(host_span<device_span<uint8_t const> const> inputs,
+                              host_span<device_span<uint8_t> const> outputs,
+                              rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(inputs.size() == outputs.size(), "Mismatched number of inputs and outputs");
+
+  std::vector<device_span<uint8_t const>> segment_inputs;
+  std::vector<device_span<uint8_t>> segment_outputs;
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    auto const size = std::min(inputs[i].size(), outputs[i].size());
+    for (std::size_t offset = 0; offset < size; offset += max_copy_segment_size) {
+      auto const segment_size = std::min(max_copy_segment_size, size - offset);
+      segment_inputs.push_back(inputs[i].subspan(offset, segment_size));
+      segment_outputs.push_back(outputs[i].subspan(offset, segment_size));
+    }
+  }
+  if (segment_inputs.empty()) { return; }
+
+  auto const mr        = rmm::mr::get_current_device_resource();
+  auto const d_inputs  = cudf::detail::make_device_uvector_async(segment_inputs, stream, mr);
+  auto const d_outputs = cudf::detail::make_device_uvector_async(segment_outputs, stream, mr);
+  gpu_copy_uncompressed_blocks(d_inputs, d_outputs, stream);
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "gpuinflate.hpp"
+
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Output sizes of a batch of chunks, used by the codecs that size their temporary memory
+ * by them.
+ */
+struct batch_output_sizes {
+  std::size_t max_size;    ///< Size of the largest output buffer of the batch
+  std::size_t total_size;  ///< Total size of the output buffers of the batch
+};
+
+/**
+ * @brief Batched compression or decompression of a list of independent chunks.
+ */
+using batch_function = std::function<void(device_span<device_span<uint8_t const> const>,
+                                          device_span<device_span<uint8_t> const>,
+                                          device_span<compression_result>,
+                                          batch_output_sizes,
+                                          rmm::cuda_stream_view)>;
+
+/**
+ * @brief Runs a batched (de)compression over buckets of chunks with similar sizes.
+ *
+ * The chunks are ordered from the largest input to the smallest and grouped into buckets of
+ * input size classes. Each bucket is a separate batch, run concurrently with the others on a
+ * stream from the global stream pool, so that a few very large chunks do not delay the
+ * completion of many small ones. Within a bucket, the largest chunks are scheduled first.
+ *
+ * @param inputs List of input buffers
+ * @param outputs List of output buffers
+ * @param results List of output status structures, in the order of `inputs`
+ * @param fn Batched (de)compression to run for each bucket
+ * @param stream CUDA stream to use; the work of all buckets is complete in stream order
+ */
+void schedule_batches(host_span<device_span<uint8_t const> const> inputs,
+                      host_span<device_span<uint8_t> const> outputs,
+                      device_span<compression_result> results,
+                      batch_function const& fn,
+                      rmm::cuda_stream_view stream);
+
+/**
+ * @brief Copies uncompressed byte blocks, splitting the large blocks into segments that are
+ * copied in parallel.
+ *
+ * @param inputs List of input buffers
+ * @param outputs List of output buffers
+ * @param stream CUDA stream to use
+ */
+void copy_uncompressed_blocks(host_span<device_span<uint8_t const> const> inputs,
+                              host_span<device_span<uint8_t> const> outputs,
+                              rmm::cuda_stream_view stream);
+
+}  // namespace cudf::io::detail
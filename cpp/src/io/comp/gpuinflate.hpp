@@ -106,6 +106,40 @@ void gpu_unsnap(device_span<device_span<uint8_t const> const> inputs,
                 device_span<compression_result> results,
                 rmm::cuda_stream_view stream);
 
+/**
+ * @brief Interface for decompressing LZ4-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate input/output/status for each chunk. Each chunk is a single block in
+ * the LZ4 block format, without a frame header.
+ *
+ * @param[in] inputs List of input buffers
+ * @param[out] outputs List of output buffers
+ * @param[out] results List of output status structures
+ * @param[in] stream CUDA stream to use
+ */
+void gpu_unlz4(device_span<device_span<uint8_t const> const> inputs,
+               device_span<device_span<uint8_t> const> outputs,
+               device_span<compression_result> results,
+               rmm::cuda_stream_view stream);
+
+/**
+ * @brief Interface for decompressing ZSTD-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate input/output/status for each chunk. Each chunk holds one or more
+ * ZSTD frames; frames that require a dictionary are not supported.
+ *
+ * @param[in] inputs List of input buffers
+ * @param[out] outputs List of output buffers
+ * @param[out] results List of output status structures
+ * @param[in] stream CUDA stream to use
+ */
+void gpu_unzstd(device_span<device_span<uint8_t const> const> inputs,
+                device_span<device_span<uint8_t> const> outputs,
+                device_span<compression_result> results,
+                rmm::cuda_stream_view stream);
+
 /**
  * @brief Computes the size of temporary memory for Brotli decompression
  *
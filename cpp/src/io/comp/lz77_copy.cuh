@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/cuda.cuh>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Copies `len` bytes from `src` to `dst` with all lanes of a warp.
+ *
+ * Each 32-byte step is loaded by the whole warp before it is stored, so `dst` may overlap `src` as
+ * long as it does not follow it. All lanes must call this with the same arguments.
+ */
+__device__ inline void warp_copy_literals(uint8_t* dst,
+                                          uint8_t const* src,
+                                          std::size_t len,
+                                          uint32_t lane_id)
+{
+  for (std::size_t base = 0; base < len; base += cudf::detail::warp_size) {
+    auto const idx   = base + lane_id;
+    auto const value = idx < len ? src[idx] : uint8_t{0};
+    __syncwarp();
+    if (idx < len) { dst[idx] = value; }
+  }
+  __syncwarp();
+}
+
+/**
+ * @brief Copies an LZ77 match of `len` bytes, starting `offset` bytes before `dst`, with all lanes
+ * of a warp.
+ *
+ * The match repeats with a period of `offset`, so every byte is read from the already decompressed
+ * data before `dst`, even when the match overlaps its own output. All lanes must call this with the
+ * same arguments.
+ */
+__device__ inline void warp_copy_match(uint8_t* dst,
+                                       std::size_t offset,
+                                       std::size_t len,
+                                       uint32_t lane_id)
+{
+  auto const src = dst - offset;
+  for (std::size_t idx = lane_id; idx < len; idx += cudf::detail::warp_size) {
+    dst[idx] = src[idx < offset ? idx : idx % offset];
+  }
+  __syncwarp();
+}
+
+/**
+ * @brief Fills `len` bytes of `dst` with `value` with all lanes of a warp.
+ */
+__device__ inline void warp_fill(uint8_t* dst, uint8_t value, std::size_t len, uint32_t lane_id)
+{
+  for (std::size_t idx = lane_id; idx < len; idx += cudf::detail::warp_size) {
+    dst[idx] = value;
+  }
+  __syncwarp();
+}
+
+}  // namespace cudf::io::detail
@@ -502,7 +502,7 @@ size_t decompress_snappy(host_span<uint8_t const> src, host_span<uint8_t> dst)
 }
 
 /**
- * @brief ZSTD decompressor that uses nvcomp
+ * @brief ZSTD decompressor that uses nvcomp, or the cuDF kernel when nvcomp ZSTD is disabled
  */
 size_t decompress_zstd(host_span<uint8_t const> src,
                        host_span<uint8_t> dst,
@@ -525,13 +525,17 @@ size_t decompress_zstd(host_span<uint8_t const> src,
   hd_stats[0]   = compression_result{0, compression_status::FAILURE};
   hd_stats.host_to_device_async(stream);
   auto const max_uncomp_page_size = dst.size();
-  nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
-                             hd_srcs,
-                             hd_dsts,
-                             hd_stats,
-                             max_uncomp_page_size,
-                             max_uncomp_page_size,
-                             stream);
+  if (nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD)) {
+    gpu_unzstd(hd_srcs, hd_dsts, hd_stats, stream);
+  } else {
+    nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
+                               hd_srcs,
+                               hd_dsts,
+                               hd_stats,
+                               max_uncomp_page_size,
+                               max_uncomp_page_size,
+                               stream);
+  }
 
   hd_stats.device_to_host_sync(stream);
   CUDF_EXPECTS(hd_stats[0].status == compression_status::SUCCESS, "ZSTD decompression failed");
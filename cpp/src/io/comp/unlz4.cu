@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpuinflate.hpp"
+#include "lz77_copy.cuh"
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+
+namespace {
+
+constexpr int unlz4_block_size = 128;
+constexpr int unlz4_warps      = unlz4_block_size / cudf::detail::warp_size;
+
+// Size of the match offset of each sequence
+constexpr std::size_t lz4_offset_size = 2;
+constexpr std::size_t lz4_min_match   = 4;
+
+/**
+ * @brief Reads the continuation bytes of a literal or match length.
+ *
+ * @return Whether the length ended before the end of the input
+ */
+__device__ bool read_lz4_length(device_span<uint8_t const> src,
+                                std::size_t& pos,
+                                std::size_t& length)
+{
+  uint8_t byte = 0;
+  do {
+    if (pos >= src.size()) { return false; }
+    byte = src[pos++];
+    length += byte;
+  } while (byte == 0xff);
+  return true;
+}
+
+/**
+ * @brief Decodes the sequences of an LZ4 block
+ *
+ * @return Decompression status of the block
+ */
+__device__ compression_status decode_lz4_block(device_span<uint8_t const> src,
+                                               device_span<uint8_t> dst,
+                                               std::size_t& out_pos,
+                                               uint32_t lane_id)
+{
+  std::size_t in_pos = 0;
+  while (in_pos < src.size()) {
+    auto const token        = src[in_pos++];
+    std::size_t literal_len = token >> 4;
+    if (literal_len == 0xf and not read_lz4_length(src, in_pos, literal_len)) {
+      return compression_status::FAILURE;
+    }
+    if (literal_len > src.size() - in_pos) { return compression_status::FAILURE; }
+    if (literal_len > dst.size() - out_pos) { return compression_status::OUTPUT_OVERFLOW; }
+    detail::warp_copy_literals(dst.data() + out_pos, src.data() + in_pos, literal_len, lane_id);
+    in_pos += literal_len;
+    out_pos += literal_len;
+
+    // The last sequence of a block only has literals
+    if (in_pos == src.size()) { break; }
+
+    if (src.size() - in_pos < lz4_offset_size) { return compression_status::FAILURE; }
+    std::size_t const offset = src[in_pos] | (src[in_pos + 1] << 8);
+    in_pos += lz4_offset_size;
+    std::size_t match_len = token & 0xf;
+    if (match_len == 0xf and not read_lz4_length(src, in_pos, match_len)) {
+      return compression_status::FAILURE;
+    }
+    match_len += lz4_min_match;
+    if (offset == 0 or offset > out_pos) { return compression_status::FAILURE; }
+    if (match_len > dst.size() - out_pos) { return compression_status::OUTPUT_OVERFLOW; }
+    detail::warp_copy_match(dst.data() + out_pos, offset, match_len, lane_id);
+    out_pos += match_len;
+  }
+  return compression_status::SUCCESS;
+}
+
+/**
+ * @brief LZ4 block decompression kernel
+ * See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ *
+ * Each warp decompresses one block. The sequence headers are parsed redundantly by all lanes, so
+ * the control flow stays uniform and the lanes share the literal and match copies.
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source information per chunk
+ * @param[in] outputs Destination information per chunk
+ * @param[out] results Decompression status per chunk
+ */
+CUDF_KERNEL void __launch_bounds__(unlz4_block_size)
+  unlz4_kernel(device_span<device_span<uint8_t const> const> inputs,
+               device_span<device_span<uint8_t> const> outputs,
+               device_span<compression_result> results)
+{
+  auto const lane_id   = threadIdx.x % cudf::detail::warp_size;
+  auto const chunk_idx = blockIdx.x * unlz4_warps + threadIdx.x / cudf::detail::warp_size;
+  if (chunk_idx >= inputs.size()) { return; }
+
+  std::size_t out_pos = 0;
+  auto const status   = decode_lz4_block(inputs[chunk_idx], outputs[chunk_idx], out_pos, lane_id);
+  if (lane_id == 0) {
+    results[chunk_idx].bytes_written = out_pos;
+    results[chunk_idx].status        = status;
+    results[chunk_idx].reserved      = 0;
+  }
+}
+
+}  // namespace
+
+void gpu_unlz4(device_span<device_span<uint8_t const> const> inputs,
+               device_span<device_span<uint8_t> const> outputs,
+               device_span<compression_result> results,
+               rmm::cuda_stream_view stream)
+{
+  if (inputs.empty()) { return; }
+
+  auto const num_blocks = cudf::util::div_rounding_up_safe<std::size_t>(inputs.size(), unlz4_warps);
+  unlz4_kernel<<<num_blocks, unlz4_block_size, 0, stream.value()>>>(inputs, outputs, results);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,952 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file unzstd.cu
+ *
+ * GPU decoder for Zstandard frames, as specified in RFC 8878.
+ *
+ * Each compressed chunk is decoded by a single warp. Frame, block and sequence headers are parsed
+ * redundantly by all lanes, so the control flow stays uniform and every lane knows the literal and
+ * match lengths that the warp copies together. The decoding tables live in shared memory and are
+ * built by the first lane. Up to 4 Huffman literal streams are decoded in parallel.
+ *
+ * The regenerated literals of a block are staged at the end of the output buffer, and are consumed
+ * before the sequences reach them. Frames that use a dictionary are not supported.
+ */
+
+#include "gpuinflate.hpp"
+#include "lz77_copy.cuh"
+
+#include <cudf/detail/utilities/cuda.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+
+namespace {
+
+constexpr int unzstd_block_size    = cudf::detail::warp_size;  // one warp per chunk
+constexpr uint32_t full_warp_mask  = 0xffff'ffffu;
+constexpr uint32_t zstd_magic      = 0xfd2f'b528u;
+constexpr uint32_t skippable_magic = 0x184d'2a50u;
+constexpr uint32_t skippable_mask  = 0xffff'fff0u;
+
+constexpr std::size_t max_block_size = 128 * 1024;
+
+constexpr int max_huffman_bits = 11;
+constexpr int max_weights_log  = 6;
+constexpr int max_ll_log       = 9;
+constexpr int max_ml_log       = 9;
+constexpr int max_of_log       = 8;
+
+constexpr int max_weight_symbol = 12;
+constexpr int max_ll_symbol     = 35;
+constexpr int max_ml_symbol     = 52;
+constexpr int max_of_symbol     = 31;
+
+// Compression modes of the sequence decoding tables
+constexpr int mode_predefined = 0;
+constexpr int mode_rle        = 1;
+constexpr int mode_compressed = 2;
+constexpr int mode_repeat     = 3;
+
+// Offset codes above 28 are only used by the compressed tables
+constexpr int of_default_symbols = 29;
+
+// Default distributions of the literal length, match length and offset codes
+static const __device__ __constant__ int16_t ll_default_counts[max_ll_symbol + 1] = {
+  4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1};
+static const __device__ __constant__ int16_t ml_default_counts[max_ml_symbol + 1] = {
+  1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+static const __device__ __constant__ int16_t of_default_counts[of_default_symbols] = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+constexpr int ll_default_log = 6;
+constexpr int ml_default_log = 6;
+constexpr int of_default_log = 5;
+
+// Baselines and extra bits of the literal length and match length codes
+static const __device__ __constant__ uint32_t ll_base[max_ll_symbol + 1] = {
+  0,  1,  2,  3,  4,  5,   6,   7,   8,   9,   10,   11,   12,   13,   14,   15,    16,    18,
+  20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536};
+static const __device__ __constant__ uint8_t ll_bits[max_ll_symbol + 1] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+  1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static const __device__ __constant__ uint32_t ml_base[max_ml_symbol + 1] = {
+  3,   4,   5,    6,    7,    8,    9,    10,   11,    12,    13,    14,    15,    16,
+  17,  18,  19,   20,   21,   22,   23,   24,   25,    26,    27,    28,    29,    30,
+  31,  32,  33,   34,   35,   37,   39,   41,   43,    47,    51,    59,    67,    83,
+  99,  131, 259,  515,  1027, 2051, 4099, 8195, 16387, 32771, 65539};
+static const __device__ __constant__ uint8_t ml_bits[max_ml_symbol + 1] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+/**
+ * @brief Entry of an FSE decoding table
+ */
+struct fse_entry {
+  uint16_t baseline;  ///< Base of the next state
+  uint8_t symbol;     ///< Decoded symbol
+  uint8_t num_bits;   ///< Number of bits added to the baseline for the next state
+};
+
+/**
+ * @brief FSE decoding table, with up to `1 << max_log` states
+ */
+template <int max_log>
+struct fse_table {
+  fse_entry entries[1 << max_log];
+  int32_t accuracy_log;  ///< Accuracy log of the table, or -1 if the table is not initialized
+};
+
+/**
+ * @brief Entry of a Huffman decoding table
+ */
+struct huffman_entry {
+  uint8_t symbol;    ///< Decoded symbol
+  uint8_t num_bits;  ///< Length of the prefix code of the symbol
+};
+
+/**
+ * @brief ZSTD decompression state, shared by the warp
+ */
+struct unzstd_state_s {
+  fse_table<max_ll_log> ll;                      ///< Literal length codes
+  fse_table<max_of_log> of;                      ///< Offset codes
+  fse_table<max_ml_log> ml;                      ///< Match length codes
+  fse_table<max_weights_log> weights_fse;        ///< Huffman weights
+  huffman_entry huffman[1 << max_huffman_bits];  ///< Literals
+  int32_t huffman_bits;                          ///< Huffman table depth, 0 if not initialized
+  int16_t counts[max_ml_symbol + 1];             ///< Normalized symbol counts
+  uint16_t next_state[max_ml_symbol + 1];        ///< Table construction scratch
+  uint8_t weights[256];                          ///< Huffman weights
+};
+
+__device__ uint32_t read_le(uint8_t const* src, int num_bytes)
+{
+  uint32_t value = 0;
+  for (int i = num_bytes - 1; i >= 0; --i) {
+    value = (value << 8) | src[i];
+  }
+  return value;
+}
+
+__device__ int highest_bit(uint32_t value) { return 31 - __clz(value); }
+
+/**
+ * @brief Reads a little-endian bitstream from the least significant bit of the first byte
+ */
+struct forward_bit_reader {
+  uint8_t const* data;
+  std::size_t size;
+  std::size_t bit_pos;
+
+  // Up to 25 bits; bits past the end of the stream are read as zeros
+  __device__ uint32_t peek(int num_bits) const
+  {
+    auto const first = bit_pos / 8;
+    uint64_t value   = 0;
+    for (int i = 0; i < 4; ++i) {
+      if (first + i < size) { value |= uint64_t{data[first + i]} << (8 * i); }
+    }
+    return static_cast<uint32_t>((value >> (bit_pos % 8)) & ((1ull << num_bits) - 1));
+  }
+
+  __device__ void skip(int num_bits) { bit_pos += num_bits; }
+
+  __device__ uint32_t read(int num_bits)
+  {
+    auto const value = peek(num_bits);
+    skip(num_bits);
+    return value;
+  }
+};
+
+/**
+ * @brief Reads a bitstream backwards, from the highest set bit of its last byte
+ *
+ * Bits before the start of the stream are read as zeros, and `bit_pos` becomes negative once the
+ * stream is overconsumed.
+ */
+struct backward_bit_reader {
+  uint8_t const* data{};
+  int64_t bit_pos{};
+
+  __device__ bool init(uint8_t const* src, std::size_t size)
+  {
+    data = src;
+    if (size == 0 or src[size - 1] == 0) { return false; }
+    bit_pos = static_cast<int64_t>(size - 1) * 8 + highest_bit(src[size - 1]);
+    return true;
+  }
+
+  // Up to 32 bits, most significant bit first
+  __device__ uint32_t peek(int num_bits) const
+  {
+    if (num_bits == 0 or bit_pos <= 0) { return 0; }
+    auto const start = bit_pos - num_bits;
+    auto const first = start > 0 ? start : int64_t{0};
+    uint64_t value   = 0;
+    for (auto idx = (bit_pos - 1) / 8; idx >= first / 8; --idx) {
+      value = (value << 8) | data[idx];
+    }
+    value = (value >> (first % 8)) & ((1ull << (bit_pos - first)) - 1);
+    return static_cast<uint32_t>(start < 0 ? value << -start : value);
+  }
+
+  __device__ void skip(int num_bits) { bit_pos -= num_bits; }
+
+  __device__ uint32_t read(int num_bits)
+  {
+    auto const value = peek(num_bits);
+    skip(num_bits);
+    return value;
+  }
+
+  [[nodiscard]] __device__ bool overflowed() const { return bit_pos < 0; }
+};
+
+/**
+ * @brief Reads an FSE table description into normalized counts
+ *
+ * @return Size in bytes of the description, or 0 if it is invalid
+ */
+__device__ std::size_t read_fse_counts(uint8_t const* src,
+                                       std::size_t size,
+                                       int max_symbol,
+                                       int max_log,
+                                       int16_t* counts,
+                                       int& num_symbols,
+                                       int& accuracy_log)
+{
+  forward_bit_reader bits{src, size, 0};
+  accuracy_log = static_cast<int>(bits.read(4)) + 5;
+  if (accuracy_log > max_log) { return 0; }
+
+  int remaining      = (1 << accuracy_log) + 1;
+  int threshold      = 1 << accuracy_log;
+  int num_bits       = accuracy_log + 1;
+  int symbol         = 0;
+  bool previous_zero = false;
+  while (remaining > 1 and symbol <= max_symbol) {
+    if (previous_zero) {
+      // Repeat flags of zero counts: 3 means that another flag follows
+      uint32_t repeat = 0;
+      do {
+        repeat = bits.read(2);
+        for (uint32_t r = 0; r < repeat; ++r) {
+          if (symbol > max_symbol) { return 0; }
+          counts[symbol++] = 0;
+        }
+      } while (repeat == 3);
+      previous_zero = false;
+      continue;
+    }
+    auto const max_low = static_cast<uint32_t>((2 * threshold - 1) - remaining);
+    int count          = 0;
+    if (bits.peek(num_bits - 1) < max_low) {
+      count = static_cast<int>(bits.peek(num_bits - 1));
+      bits.skip(num_bits - 1);
+    } else {
+      count = static_cast<int>(bits.peek(num_bits));
+      if (count >= threshold) { count -= static_cast<int>(max_low); }
+      bits.skip(num_bits);
+    }
+    // Count of -1 means a "less than 1" probability, which occupies a single state
+    count--;
+    remaining -= count < 0 ? -count : count;
+    counts[symbol++] = static_cast<int16_t>(count);
+    previous_zero    = count == 0;
+    if (remaining < 1) { return 0; }
+    while (remaining < threshold) {
+      num_bits--;
+      threshold >>= 1;
+    }
+  }
+  auto const num_bytes = (bits.bit_pos + 7) / 8;
+  if (remaining != 1 or num_bytes > size) { return 0; }
+  num_symbols = symbol;
+  return num_bytes;
+}
+
+/**
+ * @brief Builds an FSE decoding table from normalized counts
+ */
+template <int max_log>
+__device__ bool build_fse_table(int16_t const* counts,
+                                int num_symbols,
+                                int accuracy_log,
+                                uint16_t* next_state,
+                                fse_table<max_log>& table)
+{
+  auto const table_size = 1 << accuracy_log;
+  auto high_pos         = table_size - 1;
+  for (int s = 0; s < num_symbols; ++s) {
+    if (counts[s] == -1) {
+      table.entries[high_pos--].symbol = s;
+      next_state[s]                    = 1;
+    } else {
+      next_state[s] = counts[s];
+    }
+  }
+
+  // Spread the symbols over the states that are not taken by "less than 1" probabilities
+  auto const step = (table_size >> 1) + (table_size >> 3) + 3;
+  auto const mask = table_size - 1;
+  int pos         = 0;
+  for (int s = 0; s < num_symbols; ++s) {
+    for (int i = 0; i < counts[s]; ++i) {
+      table.entries[pos].symbol = s;
+      do {
+        pos = (pos + step) & mask;
+      } while (pos > high_pos);
+    }
+  }
+  if (pos != 0) { return false; }
+
+  for (int state = 0; state < table_size; ++state) {
+    auto& entry         = table.entries[state];
+    auto const next     = next_state[entry.symbol]++;
+    auto const num_bits = accuracy_log - highest_bit(next);
+    entry.num_bits      = num_bits;
+    entry.baseline      = (next << num_bits) - table_size;
+  }
+  table.accuracy_log = accuracy_log;
+  return true;
+}
+
+/**
+ * @brief Decoding state of an FSE-encoded stream of symbols
+ */
+template <int max_log>
+struct fse_decoder {
+  fse_table<max_log> const& table;
+  uint32_t state;
+
+  __device__ fse_decoder(fse_table<max_log> const& t, backward_bit_reader& bits)
+    : table{t}, state{bits.read(t.accuracy_log)}
+  {
+  }
+
+  [[nodiscard]] __device__ uint8_t symbol() const { return table.entries[state].symbol; }
+
+  __device__ void update(backward_bit_reader& bits)
+  {
+    auto const& entry = table.entries[state];
+    state             = entry.baseline + bits.read(entry.num_bits);
+  }
+};
+
+/**
+ * @brief Reads a Huffman tree description and builds the literals decoding table
+ *
+ * Called by a single lane.
+ *
+ * @return Size in bytes of the description, or 0 if it is invalid
+ */
+__device__ std::size_t read_huffman_tree(unzstd_state_s& s, uint8_t const* src, std::size_t size)
+{
+  if (size == 0) { return 0; }
+  auto const header     = src[0];
+  int num_weights       = 0;
+  std::size_t num_bytes = 0;
+  if (header >= 128) {
+    // Weights stored directly, as 4-bit values
+    num_weights = header - 127;
+    num_bytes   = 1 + (num_weights + 1) / 2;
+    if (num_bytes > size) { return 0; }
+    for (int i = 0; i < num_weights; ++i) {
+      auto const byte = src[1 + i / 2];
+      s.weights[i]    = i % 2 == 0 ? byte >> 4 : byte & 0xf;
+    }
+  } else {
+    // FSE-compressed weights, decoded with two interleaved states
+    num_bytes = 1 + header;
+    if (num_bytes > size) { return 0; }
+    int num_symbols  = 0;
+    int accuracy_log = 0;
+    auto const table_size = read_fse_counts(src + 1,
+                                            header,
+                                            max_weight_symbol,
+                                            max_weights_log,
+                                            s.counts,
+                                            num_symbols,
+                                            accuracy_log);
+    if (table_size == 0 or
+        not build_fse_table(s.counts, num_symbols, accuracy_log, s.next_state, s.weights_fse)) {
+      return 0;
+    }
+    backward_bit_reader bits;
+    if (not bits.init(src + 1 + table_size, header - table_size)) { return 0; }
+    fse_decoder<max_weights_log> even{s.weights_fse, bits};
+    fse_decoder<max_weights_log> odd{s.weights_fse, bits};
+    while (true) {
+      if (num_weights > 252) { return 0; }
+      s.weights[num_weights++] = even.symbol();
+      even.update(bits);
+      if (bits.overflowed()) {
+        s.weights[num_weights++] = odd.symbol();
+        break;
+      }
+      s.weights[num_weights++] = odd.symbol();
+      odd.update(bits);
+      if (bits.overflowed()) {
+        s.weights[num_weights++] = even.symbol();
+        break;
+      }
+    }
+  }
+
+  // The weight of the last symbol is implied by the others
+  uint32_t total = 0;
+  for (int i = 0; i < num_weights; ++i) {
+    if (s.weights[i] > max_huffman_bits) { return 0; }
+    if (s.weights[i] > 0) { total += 1u << (s.weights[i] - 1); }
+  }
+  if (total == 0) { return 0; }
+  auto const max_bits = highest_bit(total) + 1;
+  auto const rest     = (1u << max_bits) - total;
+  if (max_bits > max_huffman_bits or (rest & (rest - 1)) != 0) { return 0; }
+  s.weights[num_weights++] = highest_bit(rest) + 1;
+
+  // The longest prefix codes take the first entries of the table
+  uint32_t rank_start[max_huffman_bits + 2] = {};
+  for (int i = 0; i < num_weights; ++i) {
+    rank_start[s.weights[i]] += (1u << s.weights[i]) >> 1;
+  }
+  uint32_t next_start = 0;
+  for (int w = 1; w <= max_bits; ++w) {
+    auto const current = next_start;
+    next_start += rank_start[w];
+    rank_start[w] = current;
+  }
+  for (int symbol = 0; symbol < num_weights; ++symbol) {
+    auto const weight = s.weights[symbol];
+    if (weight == 0) { continue; }
+    auto const entry =
+      huffman_entry{static_cast<uint8_t>(symbol), static_cast<uint8_t>(max_bits + 1 - weight)};
+    auto const length = 1u << (weight - 1);
+    for (uint32_t i = 0; i < length; ++i) {
+      s.huffman[rank_start[weight] + i] = entry;
+    }
+    rank_start[weight] += length;
+  }
+  s.huffman_bits = max_bits;
+  return num_bytes;
+}
+
+/**
+ * @brief Decodes `count` literals from a single Huffman-coded stream
+ */
+__device__ bool decode_huffman_stream(unzstd_state_s const& s,
+                                      uint8_t const* src,
+                                      std::size_t size,
+                                      uint8_t* dst,
+                                      std::size_t count)
+{
+  backward_bit_reader bits;
+  if (not bits.init(src, size)) { return false; }
+  for (std::size_t i = 0; i < count; ++i) {
+    auto const& entry = s.huffman[bits.peek(s.huffman_bits)];
+    dst[i]            = entry.symbol;
+    bits.skip(entry.num_bits);
+  }
+  return bits.bit_pos == 0;
+}
+
+/**
+ * @brief Returns the value computed by the first lane to the whole warp, once the shared memory
+ * written by the first lane is visible
+ */
+__device__ int64_t from_first_lane(int64_t value)
+{
+  __syncwarp();
+  return __shfl_sync(full_warp_mask, value, 0);
+}
+
+/**
+ * @brief Decodes the literals section of a compressed block
+ *
+ * The literals are staged at the end of the output buffer.
+ *
+ * @return Size in bytes of the section, or 0 if it is invalid
+ */
+__device__ std::size_t decode_literals(unzstd_state_s& s,
+                                       uint8_t const* src,
+                                       std::size_t size,
+                                       uint8_t* literals_end,
+                                       std::size_t max_literals,
+                                       uint8_t*& literals,
+                                       std::size_t& num_literals,
+                                       uint32_t lane_id)
+{
+  auto const block_type  = src[0] & 3;
+  auto const size_format = (src[0] >> 2) & 3;
+  // Raw and RLE literals
+  if (block_type < 2) {
+    auto const header_size = size_format == 1 ? 2 : (size_format == 3 ? 3 : 1);
+    if (size < static_cast<std::size_t>(header_size)) { return 0; }
+    auto const header = read_le(src, header_size);
+    num_literals      = header_size == 1 ? header >> 3 : header >> 4;
+    if (num_literals > max_literals) { return 0; }
+    literals = literals_end - num_literals;
+    if (block_type == 0) {
+      if (size - header_size < num_literals) { return 0; }
+      detail::warp_copy_literals(literals, src + header_size, num_literals, lane_id);
+      return header_size + num_literals;
+    }
+    if (size - header_size < 1) { return 0; }
+    detail::warp_fill(literals, src[header_size], num_literals, lane_id);
+    return header_size + 1;
+  }
+
+  // Huffman-coded literals, with a new tree, or with the tree of the previous block
+  auto const header_size = size_format < 2 ? 3 : size_format + 2;
+  auto const size_bits   = size_format < 2 ? 10 : (size_format == 2 ? 14 : 18);
+  auto const num_streams = size_format == 0 ? 1 : 4;
+  if (size < static_cast<std::size_t>(header_size)) { return 0; }
+  uint64_t header = 0;
+  for (int i = header_size - 1; i >= 0; --i) {
+    header = (header << 8) | src[i];
+  }
+  auto const size_mask           = (uint64_t{1} << size_bits) - 1;
+  num_literals                   = (header >> 4) & size_mask;
+  std::size_t const streams_size = (header >> (4 + size_bits)) & size_mask;
+  if (num_literals > max_literals or size - header_size < streams_size) { return 0; }
+  literals = literals_end - num_literals;
+
+  auto streams = src + header_size;
+  auto avail   = streams_size;
+  if (block_type == 2) {
+    int64_t tree_size = 0;
+    if (lane_id == 0) { tree_size = read_huffman_tree(s, streams, avail); }
+    tree_size = from_first_lane(tree_size);
+    if (tree_size == 0) { return 0; }
+    streams += tree_size;
+    avail -= tree_size;
+  } else if (s.huffman_bits == 0) {
+    return 0;
+  }
+
+  bool is_valid = true;
+  if (num_streams == 1) {
+    if (lane_id == 0) {
+      is_valid = decode_huffman_stream(s, streams, avail, literals, num_literals);
+    }
+  } else {
+    // Jump table with the sizes of the first 3 streams
+    if (avail < 6) { return 0; }
+    std::size_t const sizes[3] = {
+      read_le(streams, 2), read_le(streams + 2, 2), read_le(streams + 4, 2)};
+    auto const segment_size = (num_literals + 3) / 4;
+    if (sizes[0] + sizes[1] + sizes[2] > avail - 6 or 3 * segment_size > num_literals) {
+      return 0;
+    }
+    if (lane_id < 4) {
+      std::size_t offset = 6;
+      for (uint32_t i = 0; i < lane_id; ++i) {
+        offset += sizes[i];
+      }
+      auto const stream_size = lane_id < 3 ? sizes[lane_id] : avail - offset;
+      auto const count       = lane_id < 3 ? segment_size : num_literals - 3 * segment_size;
+      is_valid               = decode_huffman_stream(
+        s, streams + offset, stream_size, literals + lane_id * segment_size, count);
+    }
+  }
+  if (not __all_sync(full_warp_mask, is_valid)) { return 0; }
+  return header_size + streams_size;
+}
+
+/**
+ * @brief Loads the decoding table of literal length, match length or offset codes
+ *
+ * @return Whether the table is valid; `pos` is advanced past the table description
+ */
+template <int max_log>
+__device__ bool load_sequence_table(unzstd_state_s& s,
+                                    fse_table<max_log>& table,
+                                    int mode,
+                                    int16_t const* default_counts,
+                                    int num_default_counts,
+                                    int default_log,
+                                    int max_symbol,
+                                    uint8_t const* src,
+                                    std::size_t size,
+                                    std::size_t& pos,
+                                    uint32_t lane_id)
+{
+  int64_t used = -1;
+  if (lane_id == 0) {
+    switch (mode) {
+      case mode_predefined:
+        for (int i = 0; i < num_default_counts; ++i) {
+          s.counts[i] = default_counts[i];
+        }
+        if (build_fse_table(s.counts, num_default_counts, default_log, s.next_state, table)) {
+          used = 0;
+        }
+        break;
+      case mode_rle:
+        if (pos < size and src[pos] <= max_symbol) {
+          table.entries[0]   = fse_entry{0, src[pos], 0};
+          table.accuracy_log = 0;
+          used               = 1;
+        }
+        break;
+      case mode_compressed: {
+        int num_symbols      = 0;
+        int accuracy_log     = 0;
+        auto const num_bytes = read_fse_counts(
+          src + pos, size - pos, max_symbol, max_log, s.counts, num_symbols, accuracy_log);
+        if (num_bytes > 0 and
+            build_fse_table(s.counts, num_symbols, accuracy_log, s.next_state, table)) {
+          used = num_bytes;
+        }
+        break;
+      }
+      case mode_repeat:
+        if (table.accuracy_log >= 0) { used = 0; }
+        break;
+    }
+  }
+  used = from_first_lane(used);
+  if (used < 0) { return false; }
+  pos += used;
+  return true;
+}
+
+/**
+ * @brief Decodes a compressed block and executes its sequences
+ *
+ * @param s Shared decompression state
+ * @param src Compressed block
+ * @param size Size in bytes of the compressed block
+ * @param dst Output buffer of the chunk
+ * @param dst_size Size in bytes of the output buffer
+ * @param frame_start Output position of the current frame, the limit of the match offsets
+ * @param out_pos Output position, advanced past the block
+ * @param rep Repeated offsets of the frame
+ * @param lane_id Lane of the calling thread
+ *
+ * @return Whether the block is valid
+ */
+__device__ bool decode_compressed_block(unzstd_state_s& s,
+                                        uint8_t const* src,
+                                        std::size_t size,
+                                        uint8_t* dst,
+                                        std::size_t dst_size,
+                                        std::size_t frame_start,
+                                        std::size_t& out_pos,
+                                        uint32_t (&rep)[3],
+                                        uint32_t lane_id)
+{
+  if (size == 0) { return false; }
+  auto const max_literals =
+    dst_size - out_pos < max_block_size ? dst_size - out_pos : max_block_size;
+  uint8_t* literals        = nullptr;
+  std::size_t num_literals = 0;
+  auto const literals_size = decode_literals(
+    s, src, size, dst + dst_size, max_literals, literals, num_literals, lane_id);
+  if (literals_size == 0) { return false; }
+
+  // Number of sequences
+  auto const seq   = src + literals_size;
+  auto const avail = size - literals_size;
+  if (avail < 1) { return false; }
+  std::size_t num_sequences = seq[0];
+  std::size_t pos           = 1;
+  if (num_sequences >= 128) {
+    if (num_sequences < 255) {
+      if (avail < 2) { return false; }
+      num_sequences = ((num_sequences - 128) << 8) + seq[1];
+      pos           = 2;
+    } else {
+      if (avail < 3) { return false; }
+      num_sequences = read_le(seq + 1, 2) + 0x7f00;
+      pos           = 3;
+    }
+  }
+
+  std::size_t lit_pos = 0;
+  if (num_sequences > 0) {
+    if (avail < pos + 1) { return false; }
+    auto const modes = seq[pos++];
+    if ((modes & 3) != 0) { return false; }
+    if (not load_sequence_table(s,
+                                s.ll,
+                                modes >> 6,
+                                ll_default_counts,
+                                max_ll_symbol + 1,
+                                ll_default_log,
+                                max_ll_symbol,
+                                seq,
+                                avail,
+                                pos,
+                                lane_id)) {
+      return false;
+    }
+    if (not load_sequence_table(s,
+                                s.of,
+                                (modes >> 4) & 3,
+                                of_default_counts,
+                                of_default_symbols,
+                                of_default_log,
+                                max_of_symbol,
+                                seq,
+                                avail,
+                                pos,
+                                lane_id)) {
+      return false;
+    }
+    if (not load_sequence_table(s,
+                                s.ml,
+                                (modes >> 2) & 3,
+                                ml_default_counts,
+                                max_ml_symbol + 1,
+                                ml_default_log,
+                                max_ml_symbol,
+                                seq,
+                                avail,
+                                pos,
+                                lane_id)) {
+      return false;
+    }
+
+    backward_bit_reader bits;
+    if (not bits.init(seq + pos, avail - pos)) { return false; }
+    fse_decoder<max_ll_log> ll{s.ll, bits};
+    fse_decoder<max_of_log> of{s.of, bits};
+    fse_decoder<max_ml_log> ml{s.ml, bits};
+    for (std::size_t i = 0; i < num_sequences; ++i) {
+      auto const of_code = of.symbol();
+      auto const ll_code = ll.symbol();
+      auto const ml_code = ml.symbol();
+      // Offset bits are read first, then the match length and the literal length
+      auto const offset_value = (1u << of_code) + bits.read(of_code);
+      std::size_t const match_len   = ml_base[ml_code] + bits.read(ml_bits[ml_code]);
+      std::size_t const literal_len = ll_base[ll_code] + bits.read(ll_bits[ll_code]);
+      if (i + 1 < num_sequences) {
+        ll.update(bits);
+        ml.update(bits);
+        of.update(bits);
+      }
+      if (bits.overflowed()) { return false; }
+
+      uint32_t offset = 0;
+      if (offset_value > 3) {
+        offset = offset_value - 3;
+        rep[2] = rep[1];
+        rep[1] = rep[0];
+        rep[0] = offset;
+      } else {
+        // Repeated offsets are shifted by one when there are no literals
+        auto const rep_idx = offset_value - (literal_len == 0 ? 0 : 1);
+        if (rep_idx == 0) {
+          offset = rep[0];
+        } else {
+          offset = rep_idx == 3 ? rep[0] - 1 : rep[rep_idx];
+          if (rep_idx != 1) { rep[2] = rep[1]; }
+          rep[1] = rep[0];
+          rep[0] = offset;
+        }
+      }
+
+      // The output must not reach the literals that are still to be copied
+      if (literal_len > num_literals - lit_pos or
+          out_pos + literal_len + match_len >
+            static_cast<std::size_t>(literals - dst) + lit_pos + literal_len or
+          offset == 0 or offset > out_pos + literal_len - frame_start) {
+        return false;
+      }
+      detail::warp_copy_literals(dst + out_pos, literals + lit_pos, literal_len, lane_id);
+      out_pos += literal_len;
+      lit_pos += literal_len;
+      detail::warp_copy_match(dst + out_pos, offset, match_len, lane_id);
+      out_pos += match_len;
+    }
+    if (bits.bit_pos != 0) { return false; }
+  }
+
+  // Trailing literals
+  detail::warp_copy_literals(dst + out_pos, literals + lit_pos, num_literals - lit_pos, lane_id);
+  out_pos += num_literals - lit_pos;
+  return true;
+}
+
+/**
+ * @brief Decodes the frames of a chunk
+ *
+ * @return Decompression status of the chunk
+ */
+__device__ compression_status decode_frames(unzstd_state_s& s,
+                                            device_span<uint8_t const> src,
+                                            device_span<uint8_t> dst,
+                                            std::size_t& out_pos,
+                                            uint32_t lane_id)
+{
+  std::size_t in_pos = 0;
+  while (in_pos < src.size()) {
+    if (src.size() - in_pos < 4) { return compression_status::FAILURE; }
+    auto const magic = read_le(src.data() + in_pos, 4);
+    in_pos += 4;
+    if ((magic & skippable_mask) == skippable_magic) {
+      if (src.size() - in_pos < 4) { return compression_status::FAILURE; }
+      std::size_t const skip_size = read_le(src.data() + in_pos, 4);
+      in_pos += 4;
+      if (src.size() - in_pos < skip_size) { return compression_status::FAILURE; }
+      in_pos += skip_size;
+      continue;
+    }
+    if (magic != zstd_magic or in_pos >= src.size()) { return compression_status::FAILURE; }
+
+    // Frame header
+    auto const descriptor     = src[in_pos++];
+    auto const fcs_flag       = descriptor >> 6;
+    auto const single_segment = (descriptor >> 5) & 1;
+    auto const has_checksum   = (descriptor >> 2) & 1;
+    auto const dict_id_flag   = descriptor & 3;
+    if ((descriptor >> 3) & 1) { return compression_status::FAILURE; }
+    auto const window_size  = single_segment ? 0 : 1;
+    auto const dict_id_size = dict_id_flag == 3 ? 4 : dict_id_flag;
+    auto const fcs_size     = fcs_flag == 0 ? single_segment : 1 << fcs_flag;
+    if (src.size() - in_pos < static_cast<std::size_t>(window_size + dict_id_size + fcs_size)) {
+      return compression_status::FAILURE;
+    }
+    in_pos += window_size;
+    if (dict_id_size > 0 and read_le(src.data() + in_pos, dict_id_size) != 0) {
+      return compression_status::FAILURE;
+    }
+    in_pos += dict_id_size;
+    uint64_t content_size = 0;
+    for (int i = fcs_size - 1; i >= 0; --i) {
+      content_size = (content_size << 8) | src[in_pos + i];
+    }
+    if (fcs_size == 2) { content_size += 256; }
+    in_pos += fcs_size;
+
+    // Tables and repeated offsets are only carried over between the blocks of a frame
+    if (lane_id == 0) {
+      s.ll.accuracy_log = -1;
+      s.of.accuracy_log = -1;
+      s.ml.accuracy_log = -1;
+      s.huffman_bits    = 0;
+    }
+    __syncwarp();
+    auto const frame_start = out_pos;
+    uint32_t rep[3]        = {1, 4, 8};
+
+    bool is_last_block = false;
+    while (not is_last_block) {
+      if (src.size() - in_pos < 3) { return compression_status::FAILURE; }
+      auto const block_header = read_le(src.data() + in_pos, 3);
+      in_pos += 3;
+      is_last_block               = block_header & 1;
+      auto const block_type       = (block_header >> 1) & 3;
+      std::size_t const block_size = block_header >> 3;
+      if (block_size > max_block_size) { return compression_status::FAILURE; }
+      switch (block_type) {
+        case 0:
+          if (src.size() - in_pos < block_size) { return compression_status::FAILURE; }
+          if (dst.size() - out_pos < block_size) { return compression_status::OUTPUT_OVERFLOW; }
+          detail::warp_copy_literals(
+            dst.data() + out_pos, src.data() + in_pos, block_size, lane_id);
+          in_pos += block_size;
+          out_pos += block_size;
+          break;
+        case 1:
+          if (src.size() - in_pos < 1) { return compression_status::FAILURE; }
+          if (dst.size() - out_pos < block_size) { return compression_status::OUTPUT_OVERFLOW; }
+          detail::warp_fill(dst.data() + out_pos, src[in_pos], block_size, lane_id);
+          in_pos += 1;
+          out_pos += block_size;
+          break;
+        case 2:
+          if (src.size() - in_pos < block_size or
+              not decode_compressed_block(s,
+                                          src.data() + in_pos,
+                                          block_size,
+                                          dst.data(),
+                                          dst.size(),
+                                          frame_start,
+                                          out_pos,
+                                          rep,
+                                          lane_id)) {
+            return compression_status::FAILURE;
+          }
+          in_pos += block_size;
+          break;
+        default: return compression_status::FAILURE;
+      }
+    }
+
+    // The content checksum is not verified
+    if (has_checksum) {
+      if (src.size() - in_pos < 4) { return compression_status::FAILURE; }
+      in_pos += 4;
+    }
+    if (fcs_size > 0 and out_pos - frame_start != content_size) {
+      return compression_status::FAILURE;
+    }
+  }
+  return compression_status::SUCCESS;
+}
+
+/**
+ * @brief ZSTD decompression kernel
+ * See https://datatracker.ietf.org/doc/html/rfc8878
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source information per chunk
+ * @param[in] outputs Destination information per chunk
+ * @param[out] results Decompression status per chunk
+ */
+CUDF_KERNEL void __launch_bounds__(unzstd_block_size)
+  unzstd_kernel(device_span<device_span<uint8_t const> const> inputs,
+                device_span<device_span<uint8_t> const> outputs,
+                device_span<compression_result> results)
+{
+  __shared__ __align__(16) unzstd_state_s state_g;
+
+  auto const lane_id   = threadIdx.x;
+  auto const chunk_idx = blockIdx.x;
+
+  std::size_t out_pos = 0;
+  auto const status =
+    decode_frames(state_g, inputs[chunk_idx], outputs[chunk_idx], out_pos, lane_id);
+  if (lane_id == 0) {
+    results[chunk_idx].bytes_written = out_pos;
+    results[chunk_idx].status        = status;
+    results[chunk_idx].reserved      = 0;
+  }
+}
+
+}  // namespace
+
+void gpu_unzstd(device_span<device_span<uint8_t const> const> inputs,
+                device_span<device_span<uint8_t> const> outputs,
+                device_span<compression_result> results,
+                rmm::cuda_stream_view stream)
+{
+  if (inputs.empty()) { return; }
+
+  unzstd_kernel<<<inputs.size(), unzstd_block_size, 0, stream.value()>>>(inputs, outputs, results);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include "csv_common.hpp"
 #include "csv_gpu.hpp"
+#include "io/fst/lookup_tables.cuh"
 #include "io/utilities/block_utils.cuh"
 #include "io/utilities/parsing_utils.cuh"
 #include "io/utilities/trie.cuh"
@@ -33,14 +34,21 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/count.h>
 #include <thrust/detail/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/remove.h>
 #include <thrust/transform.h>
 
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 using namespace ::cudf::io;
 
@@ -303,6 +311,7 @@ CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
  * @param[out] columns The output column data
  * @param[out] valids The bitmaps indicating whether column fields are valid
  * @param[out] valid_counts The number of valid fields in each column
+ * @param[out] invalid_counts The number of non-null fields in each column that failed conversion
  */
 CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
   convert_csv_to_cudf(cudf::io::parse_options_view options,
@@ -312,7 +321,8 @@ CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
                       device_span<cudf::data_type const> dtypes,
                       device_span<void* const> columns,
                       device_span<cudf::bitmask_type* const> valids,
-                      device_span<size_type> valid_counts)
+                      device_span<size_type> valid_counts,
+                      device_span<size_type> invalid_counts)
 {
   auto const raw_csv = data.data();
   // thread IDs range per block, so also need the block id.
@@ -372,6 +382,8 @@ CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
             // set the valid bitmap - all bits were set to 0 to start
             set_bit(valids[actual_col], rec_id);
             atomicAdd(&valid_counts[actual_col], 1);
+          } else {
+            atomicAdd(&invalid_counts[actual_col], 1);
           }
         }
       } else if (dtypes[actual_col].id() == cudf::type_id::STRING) {
@@ -387,365 +399,158 @@ CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
   }
 }
 
-/*
- * @brief Merge two packed row contexts (each corresponding to a block of characters)
- * and return the packed row context corresponding to the merged character block
- */
-inline __device__ packed_rowctx_t merge_row_contexts(packed_rowctx_t first_ctx,
-                                                     packed_rowctx_t second_ctx)
-{
-  uint32_t id0 = get_row_context(first_ctx, ROW_CTX_NONE) & 3;
-  uint32_t id1 = get_row_context(first_ctx, ROW_CTX_QUOTE) & 3;
-  uint32_t id2 = get_row_context(first_ctx, ROW_CTX_COMMENT) & 3;
-  return (first_ctx & ~pack_row_contexts(3, 3, 3)) +
-         pack_row_contexts(get_row_context(second_ctx, id0),
-                           get_row_context(second_ctx, id1),
-                           get_row_context(second_ctx, id2));
-}
+// FST that finds the start of each row, skipping the terminators within quotes and comments
+namespace split_rows {
 
-/*
- * @brief Per-character context:
- * 1-bit count (0 or 1) per context in the lower 4 bits
- * 2-bit output context id per input context in bits 8..15
- */
-constexpr __device__ uint32_t make_char_context(uint32_t id0,
-                                                uint32_t id1,
-                                                uint32_t id2 = ROW_CTX_COMMENT,
-                                                uint32_t c0  = 0,
-                                                uint32_t c1  = 0,
-                                                uint32_t c2  = 0)
-{
-  return (id0 << 8) | (id1 << 10) | (id2 << 12) | (ROW_CTX_EOF << 14) | (c0) | (c1 << 1) |
-         (c2 << 2);
-}
+// Type used to represent an input symbol: a character or the sentinel that follows a chunk
+using SymbolT = int32_t;
 
-/*
- * @brief Merge a 1-character context to keep track of bitmasks where new rows occur
- * Merges a single-character "block" row context at position pos with the current
- * block's row context (the current block contains 32-pos characters)
- *
- * @param ctx Current block context and new rows bitmaps
- * @param char_ctx state transitions associated with new character
- * @param pos Position within the current 32-character block
- *
- * NOTE: This is probably the most performance-critical piece of the row gathering kernel.
- * The char_ctx value should be created via make_char_context, and its value should
- * have been evaluated at compile-time.
- */
-inline __device__ void merge_char_context(uint4& ctx, uint32_t char_ctx, uint32_t pos)
-{
-  uint32_t id0 = (ctx.w >> 0) & 3;
-  uint32_t id1 = (ctx.w >> 2) & 3;
-  uint32_t id2 = (ctx.w >> 4) & 3;
-  // Set the newrow bit in the bitmap at the corresponding position
-  ctx.x |= ((char_ctx >> id0) & 1) << pos;
-  ctx.y |= ((char_ctx >> id1) & 1) << pos;
-  ctx.z |= ((char_ctx >> id2) & 1) << pos;
-  // Update the output context ids
-  ctx.w = ((char_ctx >> (8 + id0 * 2)) & 0x03) | ((char_ctx >> (6 + id1 * 2)) & 0x0c) |
-          ((char_ctx >> (4 + id2 * 2)) & 0x30) | (ROW_CTX_EOF << 6);
-}
+// Type used to represent the target state in the transition table
+using StateT = char;
 
-/*
- * Convert the context-with-row-bitmaps version to a packed row context
- */
-inline __device__ packed_rowctx_t pack_rowmaps(uint4 ctx_map)
-{
-  return pack_row_contexts(make_row_context(__popc(ctx_map.x), (ctx_map.w >> 0) & 3),
-                           make_row_context(__popc(ctx_map.y), (ctx_map.w >> 2) & 3),
-                           make_row_context(__popc(ctx_map.z), (ctx_map.w >> 4) & 3));
-}
+// Type used to represent a symbol group id
+using SymbolGroupT = uint8_t;
 
-/*
- * Selects the row bitmap corresponding to the given parser state
+// Type sufficiently large to index symbols within the input and output
+using SymbolOffsetT = uint32_t;
+
+/// Sentinel that follows a chunk of characters when more data follows
+constexpr SymbolT chunk_end_symbol = 0x100;
+/// Sentinel that follows the last chunk of characters
+constexpr SymbolT data_end_symbol = 0x101;
+/// Value of an option character that is not used
+constexpr SymbolT unused_symbol = -1;
+
+/**
+ * @brief Definition of the symbol groups
  */
-inline __device__ uint32_t select_rowmap(uint4 ctx_map, uint32_t ctxid)
-{
-  return (ctxid == ROW_CTX_NONE)      ? ctx_map.x
-         : (ctxid == ROW_CTX_QUOTE)   ? ctx_map.y
-         : (ctxid == ROW_CTX_COMMENT) ? ctx_map.z
-                                      : 0;
-}
+enum class dfa_symbol_group_id : SymbolGroupT {
+  TERMINATOR,        ///< Line terminator symbol group
+  DELIMITER,         ///< Column delimiter symbol group
+  QUOTE,             ///< Quote character symbol group
+  COMMENT,           ///< Comment character symbol group
+  OTHER,             ///< Symbol group that implicitly matches all other characters
+  CHUNK_END,         ///< Sentinel at the end of a chunk followed by more data
+  DATA_END,          ///< Sentinel at the end of the data
+  NUM_SYMBOL_GROUPS  ///< Total number of symbol groups
+};
+
+constexpr auto TT_NUM_STATES     = static_cast<StateT>(row_parse_state::NUM_STATES);
+constexpr auto NUM_SYMBOL_GROUPS = static_cast<uint32_t>(dfa_symbol_group_id::NUM_SYMBOL_GROUPS);
 
 /**
- * @brief Single pair-wise 512-wide row context merge transform
+ * @brief Function object to map the characters of a chunk and its sentinel to a symbol group.
  *
- * Merge row context blocks and record the merge operation in a context
- * tree so that the transform is reversible.
- * The tree is organized such that the left and right children of node n
- * are located at indices n*2 and n*2+1, the root node starting at index 1
- *
- * @tparam lanemask mask to specify source of packed row context
- * @tparam tmask mask to specify principle thread for merging row context
- * @tparam base start location for writing into packed row context tree
- * @tparam level_scale level of the node in the tree
- * @param[out] ctxtree packed row context tree
- * @param[in] ctxb packed row context for the current character block
- * @param t thread id (leaf node id)
+ * A comment character only starts a comment at the start of a row, and a delimiter only matters
+ * as the character preceding a quote; the transition table accounts for both.
  */
-template <uint32_t lanemask, uint32_t tmask, uint32_t base, uint32_t level_scale>
-inline __device__ void ctx_merge(uint64_t* ctxtree, packed_rowctx_t* ctxb, uint32_t t)
-{
-  uint64_t tmp = shuffle_xor(*ctxb, lanemask);
-  if (!(t & tmask)) {
-    *ctxb                              = merge_row_contexts(*ctxb, tmp);
-    ctxtree[base + (t >> level_scale)] = *ctxb;
+struct SymbolToSymbolGroupId {
+  SymbolT terminator;
+  SymbolT delimiter;
+  SymbolT quotechar;
+  SymbolT comment;
+
+  CUDF_HOST_DEVICE SymbolGroupT operator()(SymbolT symbol) const
+  {
+    auto const sgid = symbol == chunk_end_symbol ? dfa_symbol_group_id::CHUNK_END
+                      : symbol == data_end_symbol ? dfa_symbol_group_id::DATA_END
+                      : symbol == terminator      ? dfa_symbol_group_id::TERMINATOR
+                      : symbol == comment         ? dfa_symbol_group_id::COMMENT
+                      : symbol == quotechar       ? dfa_symbol_group_id::QUOTE
+                      : symbol == delimiter       ? dfa_symbol_group_id::DELIMITER
+                                                  : dfa_symbol_group_id::OTHER;
+    return static_cast<SymbolGroupT>(sgid);
   }
-}
+};
 
 /**
- * @brief Single 512-wide row context inverse merge transform
- *
- * Walks the context tree starting from a root node
+ * @brief Translation function object that outputs the start of a row.
  *
- * @tparam rmask Mask to specify which threads write input row context
- * @param[in] base Start read location of the merge transform tree
- * @param[in] ctxtree Merge transform tree
- * @param[in] ctx Input context
- * @param[in] brow4 output row in block *4
- * @param[in] t thread id (leaf node id)
+ * A row starts at every character read in the ROW_START state, and at the end of the data (needed
+ * to infer the length of the last row). The chunk end sentinel outputs the state the next chunk
+ * starts in. Every output symbol is the state it was output from.
  */
-template <uint32_t rmask>
-inline __device__ void ctx_unmerge(
-  uint32_t base, uint64_t* ctxtree, uint32_t* ctx, uint32_t* brow4, uint32_t t)
-{
-  rowctx32_t ctxb_left, ctxb_right, ctxb_sum;
-  ctxb_sum   = get_row_context(ctxtree[base], *ctx);
-  ctxb_left  = get_row_context(ctxtree[(base)*2 + 0], *ctx);
-  ctxb_right = get_row_context(ctxtree[(base)*2 + 1], ctxb_left & 3);
-  if (t & (rmask)) {
-    *brow4 += (ctxb_sum & ~3) - (ctxb_right & ~3);
-    *ctx = ctxb_left & 3;
+struct TransduceToRowStarts {
+  template <typename StateIdT, typename RelativeOffsetT, typename SymbolT_>
+  constexpr CUDF_HOST_DEVICE StateT operator()(StateIdT const state_id,
+                                               SymbolGroupT const match_id,
+                                               RelativeOffsetT const relative_offset,
+                                               SymbolT_ const read_symbol) const
+  {
+    return static_cast<StateT>(state_id);
   }
-}
 
-/*
- * @brief 512-wide row context merge transform
- *
- * Repeatedly merge row context blocks, keeping track of each merge operation
- * in a context tree so that the transform is reversible
- * The tree is organized such that the left and right children of node n
- * are located at indices n*2 and n*2+1, the root node starting at index 1
- *
- * Each node contains the counts and output contexts corresponding to the
- * possible input contexts.
- * Each parent node's count is obtained by adding the corresponding counts
- * from the left child node with the right child node's count selected from
- * the left child node's output context:
- *   parent.count[k] = left.count[k] + right.count[left.outctx[k]]
- *   parent.outctx[k] = right.outctx[left.outctx[k]]
- *
- * @param[out] ctxtree packed row context tree
- * @param[in] ctxb packed row context for the current character block
- * @param t thread id (leaf node id)
- */
-static inline __device__ void rowctx_merge_transform(uint64_t ctxtree[1024],
-                                                     packed_rowctx_t ctxb,
-                                                     uint32_t t)
-{
-  ctxtree[512 + t] = ctxb;
-  ctx_merge<1, 0x1, 256, 1>(ctxtree, &ctxb, t);
-  ctx_merge<2, 0x3, 128, 2>(ctxtree, &ctxb, t);
-  ctx_merge<4, 0x7, 64, 3>(ctxtree, &ctxb, t);
-  ctx_merge<8, 0xf, 32, 4>(ctxtree, &ctxb, t);
-  __syncthreads();
-  if (t < 32) {
-    ctxb = ctxtree[32 + t];
-    ctx_merge<1, 0x1, 16, 1>(ctxtree, &ctxb, t);
-    ctx_merge<2, 0x3, 8, 2>(ctxtree, &ctxb, t);
-    ctx_merge<4, 0x7, 4, 3>(ctxtree, &ctxb, t);
-    ctx_merge<8, 0xf, 2, 4>(ctxtree, &ctxb, t);
-    // Final stage
-    uint64_t tmp = shuffle_xor(ctxb, 16);
-    if (t == 0) { ctxtree[1] = merge_row_contexts(ctxb, tmp); }
+  template <typename StateIdT, typename SymbolT_>
+  constexpr CUDF_HOST_DEVICE int32_t operator()(StateIdT const state_id,
+                                                SymbolGroupT const match_id,
+                                                SymbolT_ const read_symbol) const
+  {
+    if (state_id == static_cast<StateIdT>(row_parse_state::DATA_END)) { return 0; }
+    auto const is_match = [match_id](dfa_symbol_group_id sg) {
+      return match_id == static_cast<SymbolGroupT>(sg);
+    };
+    if (is_match(dfa_symbol_group_id::CHUNK_END) or is_match(dfa_symbol_group_id::DATA_END)) {
+      return 1;
+    }
+    return state_id == static_cast<StateIdT>(row_parse_state::ROW_START) ? 1 : 0;
   }
-}
+};
+
+// Aliases for readability of the transition table
+constexpr auto TT_ROW = row_parse_state::ROW_START;
+constexpr auto TT_DLM = row_parse_state::DELIMITED;
+constexpr auto TT_UNQ = row_parse_state::UNQUOTED;
+constexpr auto TT_QUO = row_parse_state::QUOTED;
+constexpr auto TT_CMT = row_parse_state::COMMENT;
+constexpr auto TT_END = row_parse_state::DATA_END;
+
+// Transition table. A quote opens a quoted field at the start of a row or after a delimiter or
+// another quote (doubled quote), and closes it anywhere. A comment character only starts a comment
+// at the start of a row.
+std::array<std::array<row_parse_state, NUM_SYMBOL_GROUPS>, TT_NUM_STATES> constexpr
+  transition_table{{
+    /* IN_STATE      TERM    DELIM   QUOTE  COMMENT  OTHER   CHUNK   DATA */
+    /* TT_ROW */ {{TT_ROW, TT_DLM, TT_QUO, TT_CMT, TT_UNQ, TT_ROW, TT_END}},
+    /* TT_DLM */ {{TT_ROW, TT_DLM, TT_QUO, TT_UNQ, TT_UNQ, TT_DLM, TT_END}},
+    /* TT_UNQ */ {{TT_ROW, TT_DLM, TT_DLM, TT_UNQ, TT_UNQ, TT_UNQ, TT_END}},
+    /* TT_QUO */ {{TT_QUO, TT_QUO, TT_DLM, TT_QUO, TT_QUO, TT_QUO, TT_END}},
+    /* TT_CMT */ {{TT_ROW, TT_CMT, TT_CMT, TT_CMT, TT_CMT, TT_CMT, TT_END}},
+    /* TT_END */ {{TT_END, TT_END, TT_END, TT_END, TT_END, TT_END, TT_END}},
+  }};
 
-/*
- * @brief 512-wide row context inverse merge transform
- *
- * Walks the context tree starting from the root node (index 1) using
- * the starting context in node index 0.
- * The return value is the starting row and input context for the given leaf node
- *
- * @param[in] ctxtree Merge transform tree
- * @param[in] t thread id (leaf node id)
- *
- * @return Final row context and count (row_position*4 + context_id format)
+/**
+ * @brief Returns the characters of a chunk followed by the sentinel symbol
  */
-static inline __device__ rowctx32_t rowctx_inverse_merge_transform(uint64_t ctxtree[1024],
-                                                                   uint32_t t)
-{
-  uint32_t ctx     = ctxtree[0] & 3;  // Starting input context
-  rowctx32_t brow4 = 0;               // output row in block *4
-
-  ctx_unmerge<256>(1, ctxtree, &ctx, &brow4, t);
-  ctx_unmerge<128>(2 + (t >> 8), ctxtree, &ctx, &brow4, t);
-  ctx_unmerge<64>(4 + (t >> 7), ctxtree, &ctx, &brow4, t);
-  ctx_unmerge<32>(8 + (t >> 6), ctxtree, &ctx, &brow4, t);
-  ctx_unmerge<16>(16 + (t >> 5), ctxtree, &ctx, &brow4, t);
-  ctx_unmerge<8>(32 + (t >> 4), ctxtree, &ctx, &brow4, t);
-  ctx_unmerge<4>(64 + (t >> 3), ctxtree, &ctx, &brow4, t);
-  ctx_unmerge<2>(128 + (t >> 2), ctxtree, &ctx, &brow4, t);
-  ctx_unmerge<1>(256 + (t >> 1), ctxtree, &ctx, &brow4, t);
-
-  return brow4 + ctx;
-}
+struct chunk_symbol {
+  char const* chunk;
+  SymbolOffsetT chunk_size;
+  SymbolT end_symbol;
+
+  CUDF_HOST_DEVICE SymbolT operator()(SymbolOffsetT i) const
+  {
+    return i < chunk_size ? static_cast<SymbolT>(static_cast<unsigned char>(chunk[i])) : end_symbol;
+  }
+};
 
 /**
- * @brief Gather row offsets from CSV character data split into 16KB chunks
- *
- * This is done in two phases: the first phase returns the possible row counts
- * per 16K character block for each possible parsing context at the start of the block,
- * along with the resulting parsing context at the end of the block.
- * The caller can then compute the actual parsing context at the beginning of each
- * individual block and total row count.
- * The second phase outputs the location of each row in the block, using the parsing
- * context and initial row counter accumulated from the results of the previous phase.
- * Row parsing context will be updated after phase 2 such that the value contains
- * the number of rows starting at byte_range_end or beyond.
- *
- * @param row_ctx Row parsing context (output of phase 1 or input to phase 2)
- * @param offsets_out Row offsets (nullptr for phase1, non-null indicates phase 2)
- * @param data Base pointer of character data (all row offsets are relative to this)
- * @param chunk_size Total number of characters to parse
- * @param parse_pos Current parsing position in the file
- * @param start_offset Position of the start of the character buffer in the file
- * @param data_size CSV file size
- * @param byte_range_start Ignore rows starting before this position in the file
- * @param byte_range_end In phase 2, store the number of rows beyond range in row_ctx
- * @param skip_rows Number of rows to skip (ignored in phase 1)
- * @param terminator Line terminator character
- * @param delimiter Column delimiter character
- * @param quotechar Quote character
- * @param escapechar Delimiter escape character
- * @param commentchar Comment line character (skip rows starting with this character)
+ * @brief Converts the position of a symbol in the chunk to an offset in the character data
  */
-CUDF_KERNEL void __launch_bounds__(rowofs_block_dim)
-  gather_row_offsets_gpu(uint64_t* row_ctx,
-                         device_span<uint64_t> offsets_out,
-                         device_span<char const> const data,
-                         size_t chunk_size,
-                         size_t parse_pos,
-                         size_t start_offset,
-                         size_t data_size,
-                         size_t byte_range_start,
-                         size_t byte_range_end,
-                         size_t skip_rows,
-                         int terminator,
-                         int delimiter,
-                         int quotechar,
-                         int escapechar,
-                         int commentchar)
-{
-  auto start         = data.begin();
-  using block_reduce = typename cub::BlockReduce<uint32_t, rowofs_block_dim>;
-  __shared__ union {
-    typename block_reduce::TempStorage bk_storage;
-    __align__(8) uint64_t ctxtree[rowofs_block_dim * 2];
-  } temp_storage;
-
-  char const* end = start + (min(parse_pos + chunk_size, data_size) - start_offset);
-  uint32_t t      = threadIdx.x;
-  size_t block_pos =
-    (parse_pos - start_offset) + blockIdx.x * static_cast<size_t>(rowofs_block_bytes) + t * 32;
-  char const* cur = start + block_pos;
-
-  // Initial state is neutral context (no state transitions), zero rows
-  uint4 ctx_map = {
-    .x = 0,
-    .y = 0,
-    .z = 0,
-    .w = (ROW_CTX_NONE << 0) | (ROW_CTX_QUOTE << 2) | (ROW_CTX_COMMENT << 4) | (ROW_CTX_EOF << 6)};
-  int c, c_prev = (cur > start && cur <= end) ? cur[-1] : terminator;
-  // Loop through all 32 bytes and keep a bitmask of row starts for each possible input context
-  for (uint32_t pos = 0; pos < 32; pos++, cur++, c_prev = c) {
-    uint32_t ctx;
-    if (cur < end) {
-      c = cur[0];
-      if (c_prev == terminator) {
-        if (c == commentchar) {
-          // Start of a new comment row
-          ctx = make_char_context(ROW_CTX_COMMENT, ROW_CTX_QUOTE, ROW_CTX_COMMENT, 1, 0, 1);
-        } else if (c == quotechar) {
-          // Quoted string on newrow, or quoted string ending in terminator
-          ctx = make_char_context(ROW_CTX_QUOTE, ROW_CTX_NONE, ROW_CTX_QUOTE, 1, 0, 1);
-        } else {
-          // Start of a new row unless within a quote
-          ctx = make_char_context(ROW_CTX_NONE, ROW_CTX_QUOTE, ROW_CTX_NONE, 1, 0, 1);
-        }
-      } else if (c == quotechar) {
-        if (c_prev == delimiter || c_prev == quotechar) {
-          // Quoted string after delimiter, quoted string ending in delimiter, or double-quote
-          ctx = make_char_context(ROW_CTX_QUOTE, ROW_CTX_NONE);
-        } else {
-          // Closing or ignored quote
-          ctx = make_char_context(ROW_CTX_NONE, ROW_CTX_NONE);
-        }
-      } else {
-        // Neutral character
-        ctx = make_char_context(ROW_CTX_NONE, ROW_CTX_QUOTE);
-      }
-    } else {
-      char const* data_end = start + data_size - start_offset;
-      if (cur <= end && cur == data_end) {
-        // Add a newline at data end (need the extra row offset to infer length of previous row)
-        ctx = make_char_context(ROW_CTX_EOF, ROW_CTX_EOF, ROW_CTX_EOF, 1, 1, 1);
-      } else {
-        // Pass-through context (beyond chunk_size or data_end)
-        ctx = make_char_context(ROW_CTX_NONE, ROW_CTX_QUOTE, ROW_CTX_COMMENT);
-      }
-    }
-    // Merge with current context, keeping track of where new rows occur
-    merge_char_context(ctx_map, ctx, pos);
-  }
+struct chunk_to_data_offset {
+  uint64_t chunk_offset;
 
-  // Eliminate rows that start before byte_range_start
-  if (start_offset + block_pos < byte_range_start) {
-    uint32_t dist_minus1 = min(byte_range_start - (start_offset + block_pos) - 1, UINT64_C(31));
-    uint32_t mask        = 0xffff'fffe << dist_minus1;
-    ctx_map.x &= mask;
-    ctx_map.y &= mask;
-    ctx_map.z &= mask;
-  }
+  CUDF_HOST_DEVICE uint64_t operator()(SymbolOffsetT i) const { return chunk_offset + i; }
+};
 
-  // Convert the long-form {rowmap,outctx}[inctx] version into packed version
-  // {rowcount,ouctx}[inctx], then merge the row contexts of the 32-character blocks into
-  // a single 16K-character block context
-  rowctx_merge_transform(temp_storage.ctxtree, pack_rowmaps(ctx_map), t);
-
-  // If this is the second phase, get the block's initial parser state and row counter
-  if (offsets_out.data()) {
-    if (t == 0) { temp_storage.ctxtree[0] = row_ctx[blockIdx.x]; }
-    __syncthreads();
-
-    // Walk back the transform tree with the known initial parser state
-    rowctx32_t ctx             = rowctx_inverse_merge_transform(temp_storage.ctxtree, t);
-    uint64_t row               = (temp_storage.ctxtree[0] >> 2) + (ctx >> 2);
-    uint32_t rows_out_of_range = 0;
-    uint32_t rowmap            = select_rowmap(ctx_map, ctx & 3);
-    // Output row positions
-    while (rowmap != 0) {
-      uint32_t pos = __ffs(rowmap);
-      block_pos += pos;
-      if (row >= skip_rows && row - skip_rows < offsets_out.size()) {
-        // Output byte offsets are relative to the base of the input buffer
-        offsets_out[row - skip_rows] = block_pos - 1;
-        rows_out_of_range += (start_offset + block_pos - 1 >= byte_range_end);
-      }
-      row++;
-      rowmap >>= pos;
-    }
-    __syncthreads();
-    // Return the number of rows out of range
-    rows_out_of_range = block_reduce(temp_storage.bk_storage).Sum(rows_out_of_range);
-    if (t == 0) { row_ctx[blockIdx.x] = rows_out_of_range; }
-  } else {
-    // Just store the row counts and output contexts
-    if (t == 0) { row_ctx[blockIdx.x] = temp_storage.ctxtree[1]; }
-  }
+/**
+ * @brief Returns the symbol of an option character, or `unused_symbol` for '\0'
+ */
+constexpr SymbolT option_symbol(char c)
+{
+  return c == '\0' ? unused_symbol : static_cast<SymbolT>(static_cast<unsigned char>(c));
 }
 
+}  // namespace split_rows
+
 size_t __host__ count_blank_rows(cudf::io::parse_options_view const& opts,
                                  device_span<char const> data,
                                  device_span<uint64_t const> row_offsets,
@@ -813,6 +618,7 @@ void decode_row_column_data(cudf::io::parse_options_view const& options,
                             device_span<void* const> columns,
                             device_span<cudf::bitmask_type* const> valids,
                             device_span<size_type> valid_counts,
+                            device_span<size_type> invalid_counts,
                             rmm::cuda_stream_view stream)
 {
   // Calculate actual block count to use based on records count
@@ -820,43 +626,72 @@ void decode_row_column_data(cudf::io::parse_options_view const& options,
   auto const num_rows   = row_offsets.size() - 1;
   auto const grid_size  = (num_rows + block_size - 1) / block_size;
 
-  convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_offsets, dtypes, columns, valids, valid_counts);
+  convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(options,
+                                                                    data,
+                                                                    column_flags,
+                                                                    row_offsets,
+                                                                    dtypes,
+                                                                    columns,
+                                                                    valids,
+                                                                    valid_counts,
+                                                                    invalid_counts);
 }
 
-uint32_t __host__ gather_row_offsets(parse_options_view const& options,
-                                     uint64_t* row_ctx,
-                                     device_span<uint64_t> const offsets_out,
-                                     device_span<char const> const data,
-                                     size_t chunk_size,
-                                     size_t parse_pos,
-                                     size_t start_offset,
-                                     size_t data_size,
-                                     size_t byte_range_start,
-                                     size_t byte_range_end,
-                                     size_t skip_rows,
-                                     rmm::cuda_stream_view stream)
+std::pair<rmm::device_uvector<uint64_t>, row_parse_state> __host__
+gather_row_offsets(parse_options_view const& options,
+                   device_span<char const> data,
+                   size_t chunk_offset,
+                   bool is_data_end,
+                   row_parse_state state,
+                   rmm::cuda_stream_view stream)
 {
-  uint32_t dim_grid = 1 + (chunk_size / rowofs_block_bytes);
-
-  gather_row_offsets_gpu<<<dim_grid, rowofs_block_dim, 0, stream.value()>>>(
-    row_ctx,
-    offsets_out,
-    data,
-    chunk_size,
-    parse_pos,
-    start_offset,
-    data_size,
-    byte_range_start,
-    byte_range_end,
-    skip_rows,
-    options.terminator,
-    options.delimiter,
-    (options.quotechar) ? options.quotechar : 0x100,
-    /*(options.escapechar) ? options.escapechar :*/ 0x100,
-    (options.comment) ? options.comment : 0x100);
-
-  return dim_grid;
+  using split_rows::SymbolOffsetT;
+  auto const chunk = data.subspan(chunk_offset, data.size() - chunk_offset);
+  CUDF_EXPECTS(chunk.size() < std::numeric_limits<SymbolOffsetT>::max(),
+               "CSV chunk is too large to split into rows");
+
+  auto row_fst = fst::detail::make_fst(
+    fst::detail::make_symbol_group_lookup_op(
+      split_rows::SymbolToSymbolGroupId{split_rows::option_symbol(options.terminator),
+                                        split_rows::option_symbol(options.delimiter),
+                                        split_rows::option_symbol(options.quotechar),
+                                        split_rows::option_symbol(options.comment)}),
+    fst::detail::make_transition_table(split_rows::transition_table),
+    fst::detail::make_translation_functor(split_rows::TransduceToRowStarts{}),
+    stream);
+
+  // Rows start after terminators, at the start of the chunk and at the end of the data; one more
+  // output carries the state at the end of the chunk
+  auto const num_terminators =
+    thrust::count(rmm::exec_policy(stream), chunk.begin(), chunk.end(), options.terminator);
+  auto const max_num_outputs = static_cast<size_t>(num_terminators) + 3;
+  rmm::device_uvector<split_rows::StateT> out_states(max_num_outputs, stream);
+  rmm::device_uvector<uint64_t> row_offsets(max_num_outputs, stream);
+  rmm::device_scalar<SymbolOffsetT> num_outputs(stream);
+
+  auto const symbols = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<SymbolOffsetT>(0),
+    split_rows::chunk_symbol{chunk.data(),
+                             static_cast<SymbolOffsetT>(chunk.size()),
+                             is_data_end ? split_rows::data_end_symbol
+                                         : split_rows::chunk_end_symbol});
+  row_fst.Transduce(symbols,
+                    static_cast<SymbolOffsetT>(chunk.size() + 1),
+                    out_states.data(),
+                    thrust::make_transform_output_iterator(
+                      row_offsets.begin(), split_rows::chunk_to_data_offset{chunk_offset}),
+                    num_outputs.data(),
+                    static_cast<split_rows::StateT>(state),
+                    stream);
+
+  auto num_rows   = static_cast<size_t>(num_outputs.value(stream));
+  auto next_state = row_parse_state::DATA_END;
+  if (not is_data_end) {
+    num_rows--;
+    next_state = static_cast<row_parse_state>(out_states.element(num_rows, stream));
+  }
+  row_offsets.resize(num_rows, stream);
+  return {std::move(row_offsets), next_state};
 }
 
 }  // namespace gpu
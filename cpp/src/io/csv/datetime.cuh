@@ -20,6 +20,7 @@
 #include "io/utilities/time_utils.cuh"
 
 #include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/strings/detail/convert/iso_datetime.cuh>
 
 #include <thrust/equal.h>
 #include <thrust/execution_policy.h>
@@ -220,6 +221,18 @@ __inline__ __device__ timestamp_type to_timestamp(char const* begin, char const*
 {
   using duration_type = typename timestamp_type::duration;
 
+  // Fixed-width ISO-8601 strings skip the separator search
+  if (auto const iso = strings::detail::parse_iso_datetime(begin, end - begin); iso.has_value()) {
+    using namespace cuda::std::chrono;
+    auto const ymd = year_month_day{year{iso->year},
+                                    month{static_cast<uint32_t>(iso->month)},
+                                    day{static_cast<uint32_t>(iso->day)}};
+    timestamp_type answer{sys_days{ymd}};
+    answer += duration_cast<duration_type>(duration_h{iso->hour} + duration_m{iso->minute} +
+                                           duration_s{iso->second});
+    return answer;
+  }
+
   auto sep_pos = end;
 
   // Find end of the date portion
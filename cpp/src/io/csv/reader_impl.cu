@@ -27,6 +27,7 @@
 #include "io/utilities/parsing_utils.cuh"
 
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/utilities/visitor_overload.hpp>
 #include <cudf/io/csv.hpp>
@@ -39,7 +40,9 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/count.h>
 #include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 
@@ -234,13 +237,16 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
 {
   constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
   size_t buffer_size               = std::min(max_chunk_bytes, data.size());
-  size_t max_blocks =
-    std::max<size_t>((buffer_size / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2);
-  cudf::detail::hostdevice_vector<uint64_t> row_ctx(max_blocks, stream);
   size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data.size());
   size_t pos         = std::min(range_begin, data.size());
   size_t header_rows = (reader_opts.get_header() >= 0) ? reader_opts.get_header() + 1 : 0;
-  uint64_t ctx       = 0;
+  size_t total_rows  = 0;
+
+  // Parsing starts from the character preceding the range, which sets the parser state of the
+  // first character in the range, or at the start of a row at the beginning of the data
+  size_t parse_pos = buffer_pos;
+  auto state       = (pos > buffer_pos) ? cudf::io::csv::gpu::row_parse_state::UNQUOTED
+                                        : cudf::io::csv::gpu::row_parse_state::ROW_START;
 
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
@@ -253,7 +259,6 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
   rmm::device_uvector<uint64_t> all_row_offsets{0, stream};
   do {
     size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
-    size_t chunk_size = target_pos - pos;
 
     auto const previous_data_size = d_data.size();
     d_data.resize(target_pos - buffer_pos, stream);
@@ -263,72 +268,40 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
                                   cudaMemcpyDefault,
                                   stream.value()));
 
-    // Pass 1: Count the potential number of rows in each character block for each
-    // possible parser state at the beginning of the block.
-    uint32_t num_blocks = cudf::io::csv::gpu::gather_row_offsets(parse_opts.view(),
-                                                                 row_ctx.device_ptr(),
-                                                                 device_span<uint64_t>(),
-                                                                 d_data,
-                                                                 chunk_size,
-                                                                 pos,
-                                                                 buffer_pos,
-                                                                 data.size(),
-                                                                 range_begin,
-                                                                 range_end,
-                                                                 skip_rows,
-                                                                 stream);
-    CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
-                                  row_ctx.device_ptr(),
-                                  num_blocks * sizeof(uint64_t),
-                                  cudaMemcpyDefault,
-                                  stream.value()));
-    stream.synchronize();
-
-    // Sum up the rows in each character block, selecting the row count that
-    // corresponds to the current input context. Also stores the now known input
-    // context per character block that will be needed by the second pass.
-    for (uint32_t i = 0; i < num_blocks; i++) {
-      uint64_t ctx_next = cudf::io::csv::gpu::select_row_context(ctx, row_ctx[i]);
-      row_ctx[i]        = ctx;
-      ctx               = ctx_next;
-    }
-    size_t total_rows = ctx >> 2;
+    // Find the rows starting in the chunk in a single pass, carrying the parser state over to the
+    // next chunk
+    auto [chunk_row_offsets, next_state] =
+      cudf::io::csv::gpu::gather_row_offsets(parse_opts.view(),
+                                             d_data,
+                                             parse_pos - buffer_pos,
+                                             target_pos == data.size(),
+                                             state,
+                                             stream);
+    state     = next_state;
+    parse_pos = target_pos;
+
+    auto const chunk_skip_rows = std::min(skip_rows - std::min(skip_rows, total_rows),
+                                          chunk_row_offsets.size());
+    total_rows += chunk_row_offsets.size();
     if (total_rows > skip_rows) {
       // At least one row in range in this batch
+      auto const previous_num_rows = all_row_offsets.size();
       all_row_offsets.resize(total_rows - skip_rows, stream);
-
-      CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.device_ptr(),
-                                    row_ctx.host_ptr(),
-                                    num_blocks * sizeof(uint64_t),
+      CUDF_CUDA_TRY(cudaMemcpyAsync(all_row_offsets.begin() + previous_num_rows,
+                                    chunk_row_offsets.begin() + chunk_skip_rows,
+                                    (chunk_row_offsets.size() - chunk_skip_rows) * sizeof(uint64_t),
                                     cudaMemcpyDefault,
                                     stream.value()));
 
-      // Pass 2: Output row offsets
-      cudf::io::csv::gpu::gather_row_offsets(parse_opts.view(),
-                                             row_ctx.device_ptr(),
-                                             all_row_offsets,
-                                             d_data,
-                                             chunk_size,
-                                             pos,
-                                             buffer_pos,
-                                             data.size(),
-                                             range_begin,
-                                             range_end,
-                                             skip_rows,
-                                             stream);
       // With byte range, we want to keep only one row out of the specified range
       if (range_end < data.size()) {
-        CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
-                                      row_ctx.device_ptr(),
-                                      num_blocks * sizeof(uint64_t),
-                                      cudaMemcpyDefault,
-                                      stream.value()));
-        stream.synchronize();
-
-        size_t rows_out_of_range = 0;
-        for (uint32_t i = 0; i < num_blocks; i++) {
-          rows_out_of_range += row_ctx[i];
-        }
+        size_t const rows_out_of_range =
+          thrust::count_if(rmm::exec_policy(stream),
+                           all_row_offsets.begin() + previous_num_rows,
+                           all_row_offsets.end(),
+                           [buffer_pos, range_end] __device__(uint64_t const offset) {
+                             return buffer_pos + offset >= range_end;
+                           });
         if (rows_out_of_range != 0) {
           // Keep one row out of range (used to infer length of previous row)
           auto new_row_offsets_size =
@@ -367,15 +340,11 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
   // Remove header rows and extract header
   size_t const header_row_index = std::max<size_t>(header_rows, 1) - 1;
   if (header_row_index + 1 < row_offsets.size()) {
-    CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
-                                  row_offsets.data() + header_row_index,
-                                  2 * sizeof(uint64_t),
-                                  cudaMemcpyDefault,
-                                  stream.value()));
-    stream.synchronize();
+    auto const header_offsets = cudf::detail::make_std_vector_sync(
+      device_span<uint64_t const>(row_offsets.data() + header_row_index, 2), stream);
 
-    auto const header_start = buffer_pos + row_ctx[0];
-    auto const header_end   = buffer_pos + row_ctx[1];
+    auto const header_start = buffer_pos + header_offsets[0];
+    auto const header_end   = buffer_pos + header_offsets[1];
     CUDF_EXPECTS(header_start <= header_end && header_end <= data.size(),
                  "Invalid csv header location");
     header.assign(data.begin() + header_start, data.begin() + header_end);
@@ -503,12 +472,73 @@ void get_data_types_from_column_names(std::map<std::string, data_type> const& us
   }
 }
 
+/**
+ * @brief Returns the type histograms of the inferred columns, along with the number of rows they
+ * were gathered from.
+ *
+ * All rows are used unless `sample_rows` is positive and less than `num_records`, in which case
+ * `sample_rows` rows are taken from ranges spread evenly through the data.
+ */
+std::pair<std::vector<column_type_histogram>, int32_t> gather_column_type_stats(
+  parse_options const& parse_opts,
+  host_span<column_parse::flags const> column_flags,
+  device_span<char const> data,
+  device_span<uint64_t const> row_offsets,
+  int32_t num_records,
+  size_t num_inferred_columns,
+  size_type sample_rows,
+  rmm::cuda_stream_view stream)
+{
+  auto const d_column_flags =
+    make_device_uvector_async(column_flags, stream, rmm::mr::get_current_device_resource());
+  if (sample_rows <= 0 || sample_rows >= num_records) {
+    return {cudf::io::csv::gpu::detect_column_types(
+              parse_opts.view(), data, d_column_flags, row_offsets, num_inferred_columns, stream),
+            num_records};
+  }
+
+  // Contiguous ranges keep the row offsets of each range usable as-is
+  constexpr int32_t max_sample_ranges = 8;
+
+  auto const num_ranges = std::min(max_sample_ranges, sample_rows);
+  auto const range_rows = cudf::util::div_rounding_up_safe(sample_rows, num_ranges);
+  auto const range_step = num_records / num_ranges;
+
+  std::vector<column_type_histogram> column_stats(num_inferred_columns);
+  int32_t num_sampled = 0;
+  for (int32_t range = 0; range < num_ranges; ++range) {
+    auto const first_row = range * range_step;
+    auto const num_rows  = std::min(range_rows, num_records - first_row);
+    num_sampled += num_rows;
+    auto const range_stats =
+      cudf::io::csv::gpu::detect_column_types(parse_opts.view(),
+                                              data,
+                                              d_column_flags,
+                                              row_offsets.subspan(first_row, num_rows + 1),
+                                              num_inferred_columns,
+                                              stream);
+    for (size_t col = 0; col < num_inferred_columns; ++col) {
+      auto& stats = column_stats[col];
+      stats.null_count += range_stats[col].null_count;
+      stats.float_count += range_stats[col].float_count;
+      stats.datetime_count += range_stats[col].datetime_count;
+      stats.string_count += range_stats[col].string_count;
+      stats.negative_small_int_count += range_stats[col].negative_small_int_count;
+      stats.positive_small_int_count += range_stats[col].positive_small_int_count;
+      stats.big_int_count += range_stats[col].big_int_count;
+      stats.bool_count += range_stats[col].bool_count;
+    }
+  }
+  return {std::move(column_stats), num_sampled};
+}
+
 void infer_column_types(parse_options const& parse_opts,
                         host_span<column_parse::flags const> column_flags,
                         device_span<char const> data,
                         device_span<uint64_t const> row_offsets,
                         int32_t num_records,
                         data_type timestamp_type,
+                        size_type sample_rows,
                         host_span<data_type> column_types,
                         rmm::cuda_stream_view stream)
 {
@@ -527,20 +557,20 @@ void infer_column_types(parse_options const& parse_opts,
     });
   if (num_inferred_columns == 0) { return; }
 
-  auto const column_stats = cudf::io::csv::gpu::detect_column_types(
-    parse_opts.view(),
-    data,
-    make_device_uvector_async(column_flags, stream, rmm::mr::get_current_device_resource()),
-    row_offsets,
-    num_inferred_columns,
-    stream);
-  stream.synchronize();
+  auto const [column_stats, num_sampled] = gather_column_type_stats(parse_opts,
+                                                                    column_flags,
+                                                                    data,
+                                                                    row_offsets,
+                                                                    num_records,
+                                                                    num_inferred_columns,
+                                                                    sample_rows,
+                                                                    stream);
 
   auto inf_col_idx = 0;
   for (auto col_idx = 0u; col_idx < column_flags.size(); ++col_idx) {
     if (not(column_flags[col_idx] & column_parse::inferred)) { continue; }
     auto const& stats = column_stats[inf_col_idx++];
-    if (stats.null_count == num_records or stats.total_count() == 0) {
+    if (stats.null_count == num_sampled or stats.total_count() == 0) {
       // Entire column is NULL; allocate the smallest amount of memory
       column_types[col_idx] = data_type(cudf::type_id::INT8);
     } else if (stats.string_count > 0L) {
@@ -573,6 +603,7 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
                                        int32_t num_records,
                                        int32_t num_actual_columns,
                                        int32_t num_active_columns,
+                                       std::vector<size_type>& invalid_counts,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
@@ -600,6 +631,8 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
 
   auto d_valid_counts = cudf::detail::make_zeroed_device_uvector_async<size_type>(
     num_active_columns, stream, rmm::mr::get_current_device_resource());
+  auto d_invalid_counts = cudf::detail::make_zeroed_device_uvector_async<size_type>(
+    num_active_columns, stream, rmm::mr::get_current_device_resource());
 
   cudf::io::csv::gpu::decode_row_column_data(
     parse_opts.view(),
@@ -610,8 +643,10 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
     make_device_uvector_async(h_data, stream, rmm::mr::get_current_device_resource()),
     make_device_uvector_async(h_valid, stream, rmm::mr::get_current_device_resource()),
     d_valid_counts,
+    d_invalid_counts,
     stream);
 
+  invalid_counts            = cudf::detail::make_std_vector_async(d_invalid_counts, stream);
   auto const h_valid_counts = cudf::detail::make_std_vector_sync(d_valid_counts, stream);
   for (int i = 0; i < num_active_columns; ++i) {
     out_buffers[i].null_count() = num_records - h_valid_counts[i];
@@ -627,6 +662,7 @@ std::vector<data_type> determine_column_types(csv_reader_options const& reader_o
                                               device_span<uint64_t const> row_offsets,
                                               int32_t num_records,
                                               host_span<column_parse::flags> column_flags,
+                                              size_type sample_rows,
                                               rmm::cuda_stream_view stream)
 {
   std::vector<data_type> column_types(column_flags.size());
@@ -647,6 +683,7 @@ std::vector<data_type> determine_column_types(csv_reader_options const& reader_o
                      row_offsets,
                      num_records,
                      reader_opts.get_timestamp_type(),
+                     sample_rows,
                      column_types,
                      stream);
 
@@ -839,14 +876,23 @@ table_with_metadata read_csv(cudf::io::datasource* source,
   if (num_active_columns == 0) { return {std::make_unique<table>(), {}}; }
 
   // Exclude the end-of-data row from number of rows with actual data
-  auto const num_records  = std::max(row_offsets.size(), 1ul) - 1;
-  auto const column_types = determine_column_types(
-    reader_opts, parse_opts, column_names, data, row_offsets, num_records, column_flags, stream);
+  auto const num_records = std::max(row_offsets.size(), 1ul) - 1;
+  auto const sample_rows = reader_opts.get_type_inference_sample_rows();
+  auto column_types      = determine_column_types(reader_opts,
+                                                  parse_opts,
+                                                  column_names,
+                                                  data,
+                                                  row_offsets,
+                                                  num_records,
+                                                  column_flags,
+                                                  sample_rows,
+                                                  stream);
 
   auto metadata    = table_metadata{};
   auto out_columns = std::vector<std::unique_ptr<cudf::column>>();
   out_columns.reserve(column_types.size());
   if (num_records != 0) {
+    std::vector<size_type> invalid_counts;
     auto out_buffers = decode_data(  //
       parse_opts,
       column_flags,
@@ -857,9 +903,48 @@ table_with_metadata read_csv(cudf::io::datasource* source,
       num_records,
       num_actual_columns,
       num_active_columns,
+      invalid_counts,
       stream,
       mr);
 
+    // A value that does not fit the type inferred from the sampled rows requires inferring the
+    // types from all rows instead
+    auto const is_sample_violated = [&] {
+      if (sample_rows <= 0 || sample_rows >= static_cast<size_type>(num_records)) { return false; }
+      for (int col = 0, active_col = 0; col < num_actual_columns; ++col) {
+        if (not(column_flags[col] & column_parse::enabled)) { continue; }
+        if ((column_flags[col] & column_parse::inferred) && invalid_counts[active_col] != 0) {
+          return true;
+        }
+        ++active_col;
+      }
+      return false;
+    }();
+    if (is_sample_violated) {
+      column_types = determine_column_types(reader_opts,
+                                            parse_opts,
+                                            column_names,
+                                            data,
+                                            row_offsets,
+                                            num_records,
+                                            column_flags,
+                                            0,
+                                            stream);
+
+      out_buffers = decode_data(parse_opts,
+                                column_flags,
+                                column_names,
+                                data,
+                                row_offsets,
+                                column_types,
+                                num_records,
+                                num_actual_columns,
+                                num_active_columns,
+                                invalid_counts,
+                                stream,
+                                mr);
+    }
+
     cudf::string_scalar quotechar_scalar(std::string(1, parse_opts.quotechar), true, stream);
     cudf::string_scalar dblquotechar_scalar(std::string(2, parse_opts.quotechar), true, stream);
     for (size_t i = 0; i < column_types.size(); ++i) {
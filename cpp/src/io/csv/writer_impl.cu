@@ -25,23 +25,25 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy.hpp>
-#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/assert.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/detail/csv.hpp>
-#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
-#include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/convert/fixed_point_to_string.cuh>
+#include <cudf/strings/detail/convert/int_to_string.cuh>
 #include <cudf/strings/detail/converters.hpp>
-#include <cudf/strings/detail/replace.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
-#include <cudf/strings/strings_column_view.hpp>
-#include <cudf/table/table.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <thrust/count.h>
 #include <thrust/execution_policy.h>
 #include <thrust/host_vector.h>
 #include <thrust/logical.h>
@@ -65,59 +67,232 @@ using namespace cudf::io;
 namespace {
 
 /**
- * @brief Functor to modify a string column for CSV format.
+ * @brief Returns whether the values of a column type are formatted by `row_to_csv_fn` directly.
  *
- * If a row contains specific characters, the entire row must be
+ * The other supported types are converted to strings columns before the rows are assembled.
+ */
+template <typename column_type>
+constexpr bool is_formatted_in_place()
+{
+  return std::is_same_v<column_type, cudf::string_view> || std::is_integral_v<column_type> ||
+         cudf::is_fixed_point<column_type>() || cudf::is_timestamp<column_type>();
+}
+
+/**
+ * @brief Writes the `digits` least significant decimal digits of `value`, zero-padded.
+ */
+__device__ inline char* write_padded_digits(char* ptr, int32_t digits, int64_t value)
+{
+  value = value < 0 ? 0 : value;
+  for (auto i = digits - 1; i >= 0; --i) {
+    ptr[i] = '0' + static_cast<char>(value % 10);
+    value /= 10;
+  }
+  return ptr + digits;
+}
+
+/**
+ * @brief Functor to format a non-null element of a fixed-width column for CSV format.
+ *
+ * Returns the size of the formatted element in bytes. The element is written only
+ * when `d_buffer` is not null.
+ */
+struct format_element_fn {
+  string_view const d_true;     // representation of true values
+  string_view const d_false;    // representation of false values
+  bool const quote_timestamps;  // delimiter or line terminator may appear in timestamps
+
+  // bools:
+  //
+  template <typename column_type, std::enable_if_t<std::is_same_v<column_type, bool>>* = nullptr>
+  __device__ size_type operator()(column_device_view const& d_column,
+                                  size_type idx,
+                                  char* d_buffer) const
+  {
+    auto const d_str = d_column.element<bool>(idx) ? d_true : d_false;
+    if (d_buffer) { cudf::strings::detail::copy_string(d_buffer, d_str); }
+    return d_str.size_bytes();
+  }
+
+  // ints:
+  //
+  template <typename column_type,
+            std::enable_if_t<std::is_integral_v<column_type> &&
+                             !std::is_same_v<column_type, bool>>* = nullptr>
+  __device__ size_type operator()(column_device_view const& d_column,
+                                  size_type idx,
+                                  char* d_buffer) const
+  {
+    auto const value = d_column.element<column_type>(idx);
+    return d_buffer ? cudf::strings::detail::integer_to_string(value, d_buffer)
+                    : cudf::strings::detail::count_digits(value);
+  }
+
+  // fixed point:
+  //
+  template <typename column_type,
+            std::enable_if_t<cudf::is_fixed_point<column_type>()>* = nullptr>
+  __device__ size_type operator()(column_device_view const& d_column,
+                                  size_type idx,
+                                  char* d_buffer) const
+  {
+    auto const value = d_column.element<device_storage_type_t<column_type>>(idx);
+    auto const scale = d_column.type().scale();
+    if (d_buffer) { cudf::strings::detail::fixed_point_to_string(value, scale, d_buffer); }
+    return cudf::strings::detail::fixed_point_string_size(value, scale);
+  }
+
+  // timestamps: ISO 8601 in UTC, "%Y-%m-%d" for days and "%Y-%m-%dT%H:%M:%S[.%nf]Z" otherwise
+  // with the sub-second digits of the timestamp resolution
+  //
+  template <typename column_type, std::enable_if_t<cudf::is_timestamp<column_type>()>* = nullptr>
+  __device__ size_type operator()(column_device_view const& d_column,
+                                  size_type idx,
+                                  char* d_buffer) const
+  {
+    constexpr bool is_date    = std::is_same_v<column_type, cudf::timestamp_D>;
+    constexpr int64_t base    = column_type::duration::period::den;  // 1000=ms, 1000000=us, etc
+    constexpr int32_t digits  = base == 1 ? 0 : (base == 1000 ? 3 : (base == 1000000 ? 6 : 9));
+    constexpr size_type bytes = is_date ? 10 : 20 + (digits > 0 ? digits + 1 : 0);
+    auto const quote_bytes    = quote_timestamps ? 2 : 0;
+    if (!d_buffer) { return bytes + quote_bytes; }
+
+    auto const count = d_column.element<column_type>(idx).time_since_epoch().count();
+    auto const days  = cuda::std::chrono::sys_days(
+      static_cast<cudf::timestamp_D::duration>(cuda::std::chrono::floor<cuda::std::chrono::days>(
+        typename column_type::duration(count))));
+    auto const ymd = cuda::std::chrono::year_month_day(days);
+
+    char* ptr = d_buffer;
+    if (quote_timestamps) { *ptr++ = '\"'; }
+    ptr    = write_padded_digits(ptr, 4, static_cast<int32_t>(ymd.year()));
+    *ptr++ = '-';
+    ptr    = write_padded_digits(ptr, 2, static_cast<uint32_t>(ymd.month()));
+    *ptr++ = '-';
+    ptr    = write_padded_digits(ptr, 2, static_cast<uint32_t>(ymd.day()));
+    if constexpr (not is_date) {
+      // floor the timestamp to seconds, so that negative timestamps have positive components
+      auto const subsecond   = ((count % base) + base) % base;
+      auto const seconds     = (count - subsecond) / base;
+      auto const day_seconds = ((seconds % 86400) + 86400) % 86400;
+      *ptr++                 = 'T';
+      ptr                    = write_padded_digits(ptr, 2, day_seconds / 3600);
+      *ptr++                 = ':';
+      ptr                    = write_padded_digits(ptr, 2, (day_seconds / 60) % 60);
+      *ptr++                 = ':';
+      ptr                    = write_padded_digits(ptr, 2, day_seconds % 60);
+      if constexpr (digits > 0) {
+        *ptr++ = '.';
+        ptr    = write_padded_digits(ptr, digits, subsecond);
+      }
+      *ptr++ = 'Z';
+    }
+    if (quote_timestamps) { *ptr = '\"'; }
+    return bytes + quote_bytes;
+  }
+
+  // strings and the types converted to strings before formatting are handled by the caller
+  //
+  template <typename column_type,
+            std::enable_if_t<not is_formatted_in_place<column_type>() or
+                             std::is_same_v<column_type, cudf::string_view>>* = nullptr>
+  __device__ size_type operator()(column_device_view const&, size_type, char*) const
+  {
+    CUDF_UNREACHABLE("Unexpected column type in CSV row formatting.");
+  }
+};
+
+/**
+ * @brief Functor to format the rows of a table into CSV format.
+ *
+ * The columns of each row are separated by the delimiter and the row is followed by the
+ * line terminator; null elements are written as `na_rep`. The fixed-width values are formatted
+ * straight into the output, so no intermediate strings column is created for them.
+ *
+ * If a string contains specific characters, the entire string must be
  * output in double-quotes. Also, if a double-quote appears it
  * must be escaped using a 2nd double-quote.
  */
-struct escape_strings_fn {
-  column_device_view const d_column;
-  string_view const d_delimiter;  // check for column delimiter
+struct row_to_csv_fn {
+  table_device_view const d_table;
+  bool const* d_escape_strings;  // per column, whether the strings must be escaped
+  string_view const d_delimiter;
+  string_view const d_terminator;
+  string_view const d_na_rep;
+  format_element_fn const format_element;
   size_type* d_offsets{};
   char* d_chars{};
 
-  __device__ void write_char(char_utf8 chr, char*& d_buffer, size_type& bytes)
+  __device__ size_type write_string(string_view const& d_str, char* d_buffer) const
   {
-    if (d_buffer)
-      d_buffer += cudf::strings::detail::from_char_utf8(chr, d_buffer);
-    else
-      bytes += cudf::strings::detail::bytes_in_char_utf8(chr);
+    if (d_buffer) { cudf::strings::detail::copy_string(d_buffer, d_str); }
+    return d_str.size_bytes();
   }
 
-  __device__ void operator()(size_type idx)
+  __device__ size_type write_escaped_string(string_view const& d_str, char* d_buffer) const
   {
-    if (d_column.is_null(idx)) {
-      if (!d_chars) d_offsets[idx] = 0;
-      return;
-    }
-
-    constexpr char_utf8 const quote    = '\"';  // check for quote
-    constexpr char_utf8 const new_line = '\n';  // and for new-line
-
-    auto const d_str = d_column.element<string_view>(idx);
+    constexpr char quote    = '\"';  // check for quote
+    constexpr char new_line = '\n';  // and for new-line
 
     // if quote, new-line or a column delimiter appear in the string
-    // the entire string must be double-quoted.
-    bool const quote_row = thrust::any_of(
-      thrust::seq, d_str.begin(), d_str.end(), [d_delimiter = d_delimiter](auto chr) {
-        return chr == quote || chr == new_line || chr == d_delimiter[0];
+    // the entire string must be double-quoted; the checked characters
+    // are single bytes, which never appear within a multi-byte character
+    auto const d_begin   = d_str.data();
+    auto const d_end     = d_begin + d_str.size_bytes();
+    auto const delimiter = d_delimiter.data()[0];
+    auto const num_quotes =
+      static_cast<size_type>(thrust::count(thrust::seq, d_begin, d_end, quote));
+    bool const quote_row =
+      num_quotes > 0 || thrust::any_of(thrust::seq, d_begin, d_end, [=](auto chr) {
+        return chr == new_line || chr == delimiter;
       });
 
+    auto const bytes = d_str.size_bytes() + num_quotes + (quote_row ? 2 : 0);
+    if (!d_buffer) { return bytes; }
+
+    if (quote_row) { *d_buffer++ = quote; }
+    for (auto itr = d_begin; itr < d_end; ++itr) {
+      if (*itr == quote) { *d_buffer++ = quote; }
+      *d_buffer++ = *itr;
+    }
+    if (quote_row) { *d_buffer = quote; }
+    return bytes;
+  }
+
+  __device__ void operator()(size_type idx)
+  {
     char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
     size_type bytes = 0;
-
-    if (quote_row) write_char(quote, d_buffer, bytes);
-    for (auto chr : d_str) {
-      if (chr == quote) write_char(quote, d_buffer, bytes);
-      write_char(chr, d_buffer, bytes);
+    auto const advance = [&](size_type size) {
+      bytes += size;
+      if (d_buffer) { d_buffer += size; }
+    };
+
+    for (size_type col_idx = 0; col_idx < d_table.num_columns(); ++col_idx) {
+      if (col_idx > 0) { advance(write_string(d_delimiter, d_buffer)); }
+      auto const& d_column = d_table.column(col_idx);
+      if (d_column.is_null(idx)) {
+        advance(write_string(d_na_rep, d_buffer));
+      } else if (d_column.type().id() == type_id::STRING) {
+        auto const d_str = d_column.element<string_view>(idx);
+        advance(d_escape_strings[col_idx] ? write_escaped_string(d_str, d_buffer)
+                                          : write_string(d_str, d_buffer));
+      } else {
+        advance(cudf::type_dispatcher(d_column.type(), format_element, d_column, idx, d_buffer));
+      }
     }
-    if (quote_row) write_char(quote, d_buffer, bytes);
+    advance(write_string(d_terminator, d_buffer));
 
-    if (!d_chars) d_offsets[idx] = bytes;
+    if (!d_chars) { d_offsets[idx] = bytes; }
   }
 };
 
+/**
+ * @brief Functor to convert the columns that are not formatted by `row_to_csv_fn` directly
+ * into strings columns.
+ *
+ * Returns null for the columns that `row_to_csv_fn` formats directly.
+ */
 struct column_to_strings_fn {
   // compile-time predicate that defines unsupported column types;
   // based on the conditions used for instantiations of individual
@@ -129,19 +304,12 @@ struct column_to_strings_fn {
   template <typename column_type>
   constexpr static bool is_not_handled()
   {
-    // Note: the case (not std::is_same_v<column_type, bool>)
-    // is already covered by is_integral)
-    //
-    return not((std::is_same_v<column_type, cudf::string_view>) ||
-               (std::is_integral_v<column_type>) || (std::is_floating_point_v<column_type>) ||
-               (cudf::is_fixed_point<column_type>()) || (cudf::is_timestamp<column_type>()) ||
+    return not(is_formatted_in_place<column_type>() || (std::is_floating_point_v<column_type>) ||
                (cudf::is_duration<column_type>()));
   }
 
-  explicit column_to_strings_fn(csv_writer_options const& options,
-                                rmm::cuda_stream_view stream,
-                                rmm::mr::device_memory_resource* mr)
-    : options_(options), stream_(stream), mr_(mr)
+  explicit column_to_strings_fn(rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+    : stream_(stream), mr_(mr)
   {
   }
 
@@ -151,53 +319,15 @@ struct column_to_strings_fn {
   column_to_strings_fn(column_to_strings_fn&&)                 = delete;
   column_to_strings_fn& operator=(column_to_strings_fn&&)      = delete;
 
-  // Note: `null` replacement with `na_rep` deferred to `concatenate()`
-  // instead of column-wise; might be faster
+  // Note: `null` replacement with `na_rep` deferred to `row_to_csv_fn`
 
-  // bools:
+  // strings, bools, ints, fixed point and timestamps are formatted in place:
   //
   template <typename column_type>
-  std::enable_if_t<std::is_same_v<column_type, bool>, std::unique_ptr<column>> operator()(
-    column_view const& column) const
-  {
-    string_scalar true_string{options_.get_true_value(), true, stream_};
-    string_scalar false_string{options_.get_false_value(), true, stream_};
-    return cudf::strings::detail::from_booleans(column, true_string, false_string, stream_, mr_);
-  }
-
-  // strings:
-  //
-  template <typename column_type>
-  std::enable_if_t<std::is_same_v<column_type, cudf::string_view>, std::unique_ptr<column>>
-  operator()(column_view const& column_v) const
-  {
-    if (options_.get_quoting() == cudf::io::quote_style::NONE) {
-      return std::make_unique<column>(column_v, stream_, mr_);
-    }
-
-    // handle special characters: {delimiter, '\n', "} in row:
-    string_scalar delimiter{std::string{options_.get_inter_column_delimiter()}, true, stream_};
-
-    auto d_column = column_device_view::create(column_v, stream_);
-    escape_strings_fn fn{*d_column, delimiter.value(stream_)};
-    auto [offsets_column, chars] =
-      cudf::strings::detail::make_strings_children(fn, column_v.size(), stream_, mr_);
-
-    return make_strings_column(column_v.size(),
-                               std::move(offsets_column),
-                               chars.release(),
-                               column_v.null_count(),
-                               cudf::detail::copy_bitmask(column_v, stream_, mr_));
-  }
-
-  // ints:
-  //
-  template <typename column_type>
-  std::enable_if_t<std::is_integral_v<column_type> && !std::is_same_v<column_type, bool>,
-                   std::unique_ptr<column>>
-  operator()(column_view const& column) const
+  std::enable_if_t<is_formatted_in_place<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const&) const
   {
-    return cudf::strings::detail::from_integers(column, stream_, mr_);
+    return nullptr;
   }
 
   // floats:
@@ -209,55 +339,6 @@ struct column_to_strings_fn {
     return cudf::strings::detail::from_floats(column, stream_, mr_);
   }
 
-  // fixed point:
-  //
-  template <typename column_type>
-  std::enable_if_t<cudf::is_fixed_point<column_type>(), std::unique_ptr<column>> operator()(
-    column_view const& column) const
-  {
-    return cudf::strings::detail::from_fixed_point(column, stream_, mr_);
-  }
-
-  // timestamps:
-  //
-  template <typename column_type>
-  std::enable_if_t<cudf::is_timestamp<column_type>(), std::unique_ptr<column>> operator()(
-    column_view const& column) const
-  {
-    std::string format = [&]() {
-      if (std::is_same_v<cudf::timestamp_s, column_type>) {
-        return std::string{"%Y-%m-%dT%H:%M:%SZ"};
-      } else if (std::is_same_v<cudf::timestamp_ms, column_type>) {
-        return std::string{"%Y-%m-%dT%H:%M:%S.%3fZ"};
-      } else if (std::is_same_v<cudf::timestamp_us, column_type>) {
-        return std::string{"%Y-%m-%dT%H:%M:%S.%6fZ"};
-      } else if (std::is_same_v<cudf::timestamp_ns, column_type>) {
-        return std::string{"%Y-%m-%dT%H:%M:%S.%9fZ"};
-      } else {
-        return std::string{"%Y-%m-%d"};
-      }
-    }();
-
-    // handle the cases where delimiter / line-terminator can be
-    // "-" or ":", in which case we need to add quotes to the format
-    //
-    std::string delimiter{options_.get_inter_column_delimiter()};
-    std::string newline{options_.get_line_terminator()};
-
-    constexpr char const* dash{"-"};
-    constexpr char const* colon{":"};
-    if (delimiter == dash || newline == dash || delimiter == colon || newline == colon) {
-      format = "\"" + format + "\"";
-    }
-
-    return cudf::strings::detail::from_timestamps(
-      column,
-      format,
-      strings_column_view(make_empty_column(type_id::STRING)->view()),
-      stream_,
-      mr_);
-  }
-
   template <typename column_type>
   std::enable_if_t<cudf::is_duration<column_type>(), std::unique_ptr<column>> operator()(
     column_view const& column) const
@@ -275,7 +356,6 @@ struct column_to_strings_fn {
   }
 
  private:
-  csv_writer_options const& options_;
   rmm::cuda_stream_view stream_;
   rmm::mr::device_memory_resource* mr_;
 };
@@ -351,57 +431,26 @@ void write_chunked_begin(data_sink* out_sink,
 }
 
 void write_chunked(data_sink* out_sink,
-                   strings_column_view const& str_column_view,
-                   csv_writer_options const& options,
+                   device_span<char const> bytes,
                    rmm::cuda_stream_view stream,
                    rmm::mr::device_memory_resource* mr)
 {
-  // algorithm outline:
-  //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
-  //
-  // added line_terminator functionality
-  //
-
-  CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
-
-  cudf::string_scalar newline{options.get_line_terminator(), true, stream};
-  auto p_str_col_w_nl = cudf::strings::detail::join_strings(str_column_view,
-                                                            newline,
-                                                            string_scalar{"", false, stream},
-                                                            stream,
-                                                            rmm::mr::get_current_device_resource());
-  strings_column_view strings_column{p_str_col_w_nl->view()};
+  if (bytes.empty()) { return; }
 
-  auto total_num_bytes      = strings_column.chars_size(stream);
-  char const* ptr_all_bytes = strings_column.chars_begin(stream);
-
-  if (out_sink->is_device_write_preferred(total_num_bytes)) {
+  if (out_sink->is_device_write_preferred(bytes.size())) {
     // Direct write from device memory
-    out_sink->device_write(ptr_all_bytes, total_num_bytes, stream);
+    out_sink->device_write(bytes.data(), bytes.size(), stream);
   } else {
     // copy the bytes to host to write them out
-    thrust::host_vector<char> h_bytes(total_num_bytes);
+    thrust::host_vector<char> h_bytes(bytes.size());
     CUDF_CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
-                                  ptr_all_bytes,
-                                  total_num_bytes * sizeof(char),
+                                  bytes.data(),
+                                  bytes.size() * sizeof(char),
                                   cudaMemcpyDefault,
                                   stream.value()));
     stream.synchronize();
 
-    out_sink->host_write(h_bytes.data(), total_num_bytes);
-  }
-
-  // Needs newline at the end, to separate from next chunk
-  if (out_sink->is_device_write_preferred(newline.size())) {
-    out_sink->device_write(newline.data(), newline.size(), stream);
-  } else {
-    out_sink->host_write(options.get_line_terminator().data(),
-                         options.get_line_terminator().size());
+    out_sink->host_write(h_bytes.data(), h_bytes.size());
   }
 }
 
@@ -447,49 +496,69 @@ void write_csv(data_sink* out_sink,
       vector_views = cudf::detail::split(table, splits, stream);
     }
 
+    // strings are escaped unless quoting is disabled; the strings converted
+    // from floats and durations never need escaping
+    bool const escape_strings = options.get_quoting() != cudf::io::quote_style::NONE;
+    thrust::host_vector<bool> h_escape_strings(table.num_columns());
+    std::transform(table.begin(), table.end(), h_escape_strings.begin(), [&](auto const& col) {
+      return escape_strings && col.type().id() == type_id::STRING;
+    });
+    auto const d_escape_strings = cudf::detail::make_device_uvector_async(
+      host_span<bool const>{h_escape_strings.data(), h_escape_strings.size()},
+      stream,
+      rmm::mr::get_current_device_resource());
+
+    // handle the cases where delimiter / line-terminator can be
+    // "-" or ":", in which case the timestamps must be quoted
+    //
+    std::string delimiter{options.get_inter_column_delimiter()};
+    std::string newline{options.get_line_terminator()};
+    constexpr char const* dash{"-"};
+    constexpr char const* colon{":"};
+    bool const quote_timestamps =
+      delimiter == dash || newline == dash || delimiter == colon || newline == colon;
+
+    cudf::string_scalar delimiter_str{delimiter, true, stream};
+    cudf::string_scalar newline_str{newline, true, stream};
+    cudf::string_scalar na_rep_str{options.get_na_rep(), true, stream};
+    cudf::string_scalar true_str{options.get_true_value(), true, stream};
+    cudf::string_scalar false_str{options.get_false_value(), true, stream};
+    format_element_fn const format_element{
+      true_str.value(stream), false_str.value(stream), quote_timestamps};
+
     // convert each chunk to CSV:
     //
-    column_to_strings_fn converter{options, stream, rmm::mr::get_current_device_resource()};
+    column_to_strings_fn converter{stream, rmm::mr::get_current_device_resource()};
     for (auto&& sub_view : vector_views) {
       // Skip if the table has no rows
       if (sub_view.num_rows() == 0) continue;
-      std::vector<std::unique_ptr<column>> str_column_vec;
 
-      // populate vector of string-converted columns:
+      // convert the columns that are not formatted in place to strings columns;
+      // all other columns are formatted straight into the output
       //
-      std::transform(
-        sub_view.begin(),
-        sub_view.end(),
-        std::back_inserter(str_column_vec),
-        [&converter = std::as_const(converter)](auto const& current_col) {
-          return cudf::type_dispatcher<cudf::id_to_type_impl, column_to_strings_fn const&>(
-            current_col.type(), converter, current_col);
-        });
-
-      // create string table view from str_column_vec:
-      //
-      auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
-      auto str_table_view = str_table_ptr->view();
+      std::vector<std::unique_ptr<column>> str_column_vec;
+      std::vector<column_view> row_columns;
+      for (auto const& current_col : sub_view) {
+        auto str_col = cudf::type_dispatcher<cudf::id_to_type_impl, column_to_strings_fn const&>(
+          current_col.type(), std::as_const(converter), current_col);
+        row_columns.push_back(str_col ? str_col->view() : current_col);
+        str_column_vec.push_back(std::move(str_col));
+      }
 
-      // concatenate columns in each row into one big string column
-      // (using null representation and delimiter):
+      // format the rows (using null representation, delimiter and line terminator)
+      // into one character buffer:
       //
-      auto str_concat_col = [&] {
-        cudf::string_scalar delimiter_str{
-          std::string{options.get_inter_column_delimiter()}, true, stream};
-        cudf::string_scalar options_narep{options.get_na_rep(), true, stream};
-        if (str_table_view.num_columns() > 1)
-          return cudf::strings::detail::concatenate(str_table_view,
-                                                    delimiter_str,
-                                                    options_narep,
-                                                    strings::separator_on_nulls::YES,
-                                                    stream,
-                                                    rmm::mr::get_current_device_resource());
-        return cudf::strings::detail::replace_nulls(
-          str_table_view.column(0), options_narep, stream, rmm::mr::get_current_device_resource());
-      }();
-
-      write_chunked(out_sink, str_concat_col->view(), options, stream, mr);
+      auto const d_table = table_device_view::create(table_view{row_columns}, stream);
+      row_to_csv_fn fn{*d_table,
+                       d_escape_strings.data(),
+                       delimiter_str.value(stream),
+                       newline_str.value(stream),
+                       na_rep_str.value(stream),
+                       format_element};
+      auto [offsets_column, chars] = cudf::strings::detail::make_strings_children(
+        fn, sub_view.num_rows(), stream, rmm::mr::get_current_device_resource());
+
+      write_chunked(out_sink, chars, stream, mr);
     }
   }
 }
@@ -40,16 +40,28 @@ struct AgentDFAPolicy {
 };
 
 /**
- * @brief The list of architecture-specific tuning policies. Yet TBD.
+ * @brief The list of architecture-specific tuning policies, specialized on the number of states
+ * of the DFA.
+ *
+ * Each thread composes a state-transition vector with one entry per state for every symbol it
+ * reads, so the per-symbol work and register footprint grow with the number of states. Machines
+ * with few states therefore process more symbols per thread, which also shrinks the number of
+ * state-transition vectors that have to be scanned across threads.
+ *
+ * @tparam MAX_NUM_STATES The maximum number of states of the DFA
  */
+template <int32_t MAX_NUM_STATES>
 struct DeviceFSMPolicy {
+  // The largest number of states that is considered a small machine
+  static constexpr int32_t MAX_SMALL_NUM_STATES = 8;
+
   //------------------------------------------------------------------------------
   // Architecture-specific tuning policies
   //------------------------------------------------------------------------------
   struct Policy900 : cub::ChainedPolicy<900, Policy900, Policy900> {
     enum {
       BLOCK_THREADS    = 128,
-      ITEMS_PER_THREAD = 32,
+      ITEMS_PER_THREAD = MAX_NUM_STATES <= MAX_SMALL_NUM_STATES ? 64 : 32,
     };
 
     using AgentDFAPolicy = AgentDFAPolicy<BLOCK_THREADS, ITEMS_PER_THREAD>;
@@ -78,7 +90,7 @@ template <typename DfaT,
           typename TransducedIndexOutItT,
           typename TransducedCountOutItT,
           typename OffsetT>
-struct DispatchFSM : DeviceFSMPolicy {
+struct DispatchFSM : DeviceFSMPolicy<DfaT::MAX_NUM_STATES> {
   //------------------------------------------------------------------------------
   // DEFAULT TYPES
   //------------------------------------------------------------------------------
@@ -161,7 +173,7 @@ struct DispatchFSM : DeviceFSMPolicy {
     TransducedCountOutItT d_num_transduced_out_it,
     cudaStream_t stream)
   {
-    using MaxPolicyT = DispatchFSM::MaxPolicy;
+    using MaxPolicyT = typename DispatchFSM::MaxPolicy;
 
     cudaError_t error;
 
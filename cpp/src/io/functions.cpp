@@ -16,8 +16,10 @@
 
 #include "io/orc/orc.hpp"
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/avro.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/data_sink.hpp>
@@ -32,11 +34,15 @@
 #include <cudf/io/orc_metadata.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/io/parquet_metadata.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <algorithm>
+#include <type_traits>
+#include <variant>
 
 namespace cudf::io {
 // Returns builder for csv_reader_options
@@ -214,6 +220,45 @@ table_with_metadata read_json(json_reader_options options,
   return json::detail::read_json(datasources, options, stream, mr);
 }
 
+/**
+ * @copydoc cudf::io::chunked_json_reader::chunked_json_reader
+ */
+chunked_json_reader::chunked_json_reader(std::size_t chunk_read_limit,
+                                         json_reader_options options,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  options.set_compression(infer_compression_type(options.get_compression(), options.get_source()));
+  auto datasources = make_datasources(options.get_source());
+  reader           = std::make_unique<json::detail::chunked_reader>(
+    chunk_read_limit, std::move(datasources), std::move(options), stream, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::~chunked_json_reader
+ */
+chunked_json_reader::~chunked_json_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::has_next
+ */
+bool chunked_json_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::read_chunk
+ */
+table_with_metadata chunked_json_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 void write_json(json_writer_options const& options,
                 rmm::cuda_stream_view stream,
                 rmm::mr::device_memory_resource* mr)
@@ -373,6 +418,203 @@ parsed_orc_statistics read_parsed_orc_statistics(source_info const& src_info,
 
   return result;
 }
+namespace {
+/**
+ * @brief Creates a device column from optional host values, with nulls for the missing values.
+ *
+ * Non-string values are stored as the representation type `T` of `dtype`.
+ */
+template <typename T>
+std::unique_ptr<column> make_statistics_column(data_type dtype,
+                                               host_span<std::optional<T> const> values,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto const size = static_cast<size_type>(values.size());
+  std::vector<bitmask_type> null_mask(num_bitmask_words(size), ~bitmask_type{0});
+  size_type null_count = 0;
+  for (size_type i = 0; i < size; ++i) {
+    if (not values[i].has_value()) {
+      clear_bit_unsafe(null_mask.data(), i);
+      null_count++;
+    }
+  }
+  rmm::device_buffer d_null_mask{
+    null_mask.data(), bitmask_allocation_size_bytes(size), stream, mr};
+
+  std::unique_ptr<column> result;
+  if constexpr (std::is_same_v<T, std::string>) {
+    std::vector<char> chars;
+    std::vector<size_type> offsets{0};
+    for (auto const& value : values) {
+      if (value.has_value()) { chars.insert(chars.end(), value->begin(), value->end()); }
+      offsets.push_back(static_cast<size_type>(chars.size()));
+    }
+    auto d_offsets = std::make_unique<column>(
+      cudf::detail::make_device_uvector_sync(offsets, stream, mr), rmm::device_buffer{}, 0);
+    auto d_chars = cudf::detail::make_device_uvector_sync(chars, stream, mr);
+    result       = make_strings_column(
+      size, std::move(d_offsets), d_chars.release(), null_count, std::move(d_null_mask));
+  } else {
+    std::vector<T> data(size);
+    std::transform(values.begin(), values.end(), data.begin(), [](auto const& value) {
+      return value.value_or(T{});
+    });
+    auto d_data = cudf::detail::make_device_uvector_sync(data, stream, mr);
+    result =
+      std::make_unique<column>(dtype, size, d_data.release(), std::move(d_null_mask), null_count);
+  }
+  stream.synchronize();
+  return result;
+}
+
+/**
+ * @brief Returns the minimum and maximum of ORC column statistics of a type.
+ */
+template <typename Statistics>
+auto get_min_max(column_statistics const& stats)
+{
+  using value_type  = decltype(Statistics::minimum);
+  auto const* typed = std::get_if<Statistics>(&stats.type_specific_stats);
+  return typed ? std::pair{typed->minimum, typed->maximum} : std::pair<value_type, value_type>{};
+}
+
+/**
+ * @brief Creates the minimum and maximum columns of ORC column statistics, with nulls for the
+ * missing statistics.
+ */
+template <typename MinMaxFn>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_min_max_columns(
+  data_type dtype,
+  host_span<column_statistics const* const> stats,
+  MinMaxFn min_max,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  using value_type = typename std::invoke_result_t<MinMaxFn, column_statistics const&>::first_type;
+  std::vector<value_type> mins;
+  std::vector<value_type> maxs;
+  for (auto const* col_stats : stats) {
+    auto const [min, max] =
+      col_stats != nullptr ? min_max(*col_stats) : std::pair<value_type, value_type>{};
+    mins.push_back(min);
+    maxs.push_back(max);
+  }
+  using T = typename value_type::value_type;
+  return {make_statistics_column<T>(dtype, mins, stream, mr),
+          make_statistics_column<T>(dtype, maxs, stream, mr)};
+}
+}  // namespace
+
+table_with_metadata read_orc_statistics(source_info const& src_info,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto sources = make_datasources(src_info);
+  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
+  orc::metadata metadata(sources.front().get(), stream);
+
+  // Statistics of each column, per stripe; empty if the file has no stripe statistics
+  auto const num_stripes = metadata.ff.stripes.size();
+  std::vector<std::vector<column_statistics>> stripes_stats;
+  if (metadata.md.stripeStats.size() == num_stripes) {
+    for (auto const& stripe_stats : metadata.md.stripeStats) {
+      auto& stats = stripes_stats.emplace_back();
+      for (auto const& col_stats : stripe_stats.colStats) {
+        orc::column_statistics stats_internal;
+        orc::ProtobufReader(col_stats.data(), col_stats.size()).read(stats_internal);
+        stats.emplace_back(std::move(stats_internal));
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<column>> columns;
+  table_metadata out_metadata;
+  std::vector<std::optional<int64_t>> num_rows;
+  for (auto const& stripe : metadata.ff.stripes) {
+    num_rows.emplace_back(stripe.numberOfRows);
+  }
+  columns.push_back(
+    make_statistics_column<int64_t>(data_type{type_id::INT64}, num_rows, stream, mr));
+  out_metadata.schema_info.emplace_back("num_rows");
+
+  for (auto const col_id : metadata.ff.types[0].subtypes) {
+    std::vector<column_statistics const*> col_stats(num_stripes, nullptr);
+    std::vector<std::optional<int64_t>> null_counts(num_stripes);
+    for (size_t stripe_idx = 0; stripe_idx < stripes_stats.size(); ++stripe_idx) {
+      if (col_id >= stripes_stats[stripe_idx].size()) { continue; }
+      col_stats[stripe_idx] = &stripes_stats[stripe_idx][col_id];
+      auto const num_values = col_stats[stripe_idx]->number_of_values;
+      if (num_values.has_value()) {
+        null_counts[stripe_idx] = static_cast<int64_t>(num_rows[stripe_idx].value()) -
+                                  static_cast<int64_t>(num_values.value());
+      }
+    }
+
+    auto min_max = [&]() {
+      switch (metadata.ff.types[col_id].kind) {
+        case orc::BYTE:
+        case orc::SHORT:
+        case orc::INT:
+        case orc::LONG:
+          return make_min_max_columns(
+            data_type{type_id::INT64}, col_stats, get_min_max<integer_statistics>, stream, mr);
+        case orc::FLOAT:
+        case orc::DOUBLE:
+          return make_min_max_columns(
+            data_type{type_id::FLOAT64}, col_stats, get_min_max<double_statistics>, stream, mr);
+        case orc::STRING:
+        case orc::VARCHAR:
+        case orc::CHAR:
+          return make_min_max_columns(
+            data_type{type_id::STRING}, col_stats, get_min_max<string_statistics>, stream, mr);
+        case orc::DECIMAL:
+          return make_min_max_columns(
+            data_type{type_id::STRING}, col_stats, get_min_max<decimal_statistics>, stream, mr);
+        case orc::DATE:
+          return make_min_max_columns(data_type{type_id::TIMESTAMP_DAYS},
+                                      col_stats,
+                                      get_min_max<date_statistics>,
+                                      stream,
+                                      mr);
+        case orc::TIMESTAMP:
+          return make_min_max_columns(
+            data_type{type_id::TIMESTAMP_MILLISECONDS},
+            col_stats,
+            [](column_statistics const& stats) {
+              // the UTC values, if present
+              auto const* typed = std::get_if<timestamp_statistics>(&stats.type_specific_stats);
+              if (typed != nullptr and typed->minimum_utc.has_value()) {
+                return std::pair{typed->minimum_utc, typed->maximum_utc};
+              }
+              return get_min_max<timestamp_statistics>(stats);
+            },
+            stream,
+            mr);
+        default: {
+          // all null placeholders for the types without a minimum and maximum
+          std::vector<std::optional<bool>> const nulls(num_stripes);
+          auto const dtype = data_type{type_id::BOOL8};
+          return std::pair{make_statistics_column<bool>(dtype, nulls, stream, mr),
+                           make_statistics_column<bool>(dtype, nulls, stream, mr)};
+        }
+      }
+    }();
+    columns.push_back(std::move(min_max.first));
+    columns.push_back(std::move(min_max.second));
+    columns.push_back(
+      make_statistics_column<int64_t>(data_type{type_id::INT64}, null_counts, stream, mr));
+
+    auto const& name = metadata.column_name(col_id);
+    for (auto const* statistic : {".min", ".max", ".null_count"}) {
+      out_metadata.schema_info.emplace_back(name + statistic);
+    }
+  }
+  return {std::make_unique<table>(std::move(columns)), std::move(out_metadata)};
+}
+
 namespace {
 orc_column_schema make_orc_column_schema(host_span<orc::SchemaType const> orc_schema,
                                          uint32_t column_id,
@@ -422,6 +664,60 @@ table_with_metadata read_orc(orc_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<orc::detail::chunked_reader>(
+      chunk_read_limit, 0, make_datasources(options.get_source()), options, stream, mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       std::size_t pass_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<orc::detail::chunked_reader>(chunk_read_limit,
+                                                         pass_read_limit,
+                                                         make_datasources(options.get_source()),
+                                                         options,
+                                                         stream,
+                                                         mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::~chunked_orc_reader
+ */
+chunked_orc_reader::~chunked_orc_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::has_next
+ */
+bool chunked_orc_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::read_chunk
+ */
+table_with_metadata chunked_orc_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -501,6 +797,26 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+memory_estimate estimate_read_parquet_memory(parquet_reader_options const& options)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(options.get_source());
+  return detail_parquet::estimate_read_memory(datasources, options);
+}
+
+table_with_metadata read_parquet_statistics(parquet_reader_options const& options,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(options.get_source());
+  return detail_parquet::read_statistics(datasources, options, stream, mr);
+}
+
+void clear_parquet_metadata_cache() { detail_parquet::clear_metadata_cache(); }
+
 parquet_metadata read_parquet_metadata(source_info const& src_info)
 {
   CUDF_FUNC_RANGE();
@@ -668,14 +984,29 @@ void parquet_reader_options::set_row_groups(std::vector<std::vector<size_type>>
   if ((!row_groups.empty()) and ((_skip_rows != 0) or _num_rows.has_value())) {
     CUDF_FAIL("row_groups can't be set along with skip_rows and num_rows");
   }
+  CUDF_EXPECTS(row_groups.empty() or (_byte_range_offset == 0 and _byte_range_size == 0),
+               "row_groups can't be set along with a byte range");
 
   _row_groups = std::move(row_groups);
 }
 
+void parquet_reader_options::set_byte_range(std::size_t offset, std::size_t size)
+{
+  if ((offset != 0 or size != 0) and
+      ((!_row_groups.empty()) or (_skip_rows != 0) or _num_rows.has_value())) {
+    CUDF_FAIL("A byte range can't be set along with row_groups, skip_rows and num_rows");
+  }
+
+  _byte_range_offset = offset;
+  _byte_range_size   = size;
+}
+
 void parquet_reader_options::set_skip_rows(int64_t val)
 {
   CUDF_EXPECTS(val >= 0, "skip_rows cannot be negative");
   CUDF_EXPECTS(_row_groups.empty(), "skip_rows can't be set along with a non-empty row_groups");
+  CUDF_EXPECTS(_byte_range_offset == 0 and _byte_range_size == 0,
+               "skip_rows can't be set along with a byte range");
 
   _skip_rows = val;
 }
@@ -684,6 +1015,8 @@ void parquet_reader_options::set_num_rows(size_type val)
 {
   CUDF_EXPECTS(val >= 0, "num_rows cannot be negative");
   CUDF_EXPECTS(_row_groups.empty(), "num_rows can't be set along with a non-empty row_groups");
+  CUDF_EXPECTS(_byte_range_offset == 0 and _byte_range_size == 0,
+               "num_rows can't be set along with a byte range");
 
   _num_rows = val;
 }
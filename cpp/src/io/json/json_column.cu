@@ -50,6 +50,10 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
 
 namespace cudf::io::json::detail {
 
@@ -620,6 +624,7 @@ void make_device_json_column(device_span<SymbolT const> input,
   // find column_ids which are values, but should be ignored in validity
   std::vector<uint8_t> ignore_vals(num_columns, 0);
   std::vector<uint8_t> is_mixed_type_column(num_columns, 0);
+  std::vector<uint8_t> is_pruned(num_columns, 0);
   columns.try_emplace(parent_node_sentinel, std::ref(root));
 
   for (auto const this_col_id : unique_col_ids) {
@@ -643,6 +648,20 @@ void make_device_json_column(device_span<SymbolT const> input,
       CUDF_FAIL("Unexpected parent column category");
     }
 
+    // columns not selected by dtypes, and everything below them, are not materialized
+    if (options.is_enabled_prune_columns()) {
+      auto const is_pruned_column = [&]() {
+        if (parent_col_id != parent_node_sentinel && is_pruned[parent_col_id] == 1) { return true; }
+        auto path = tree_path.get_path(this_col_id);
+        return not path.empty() and not get_path_data_type(path, options).has_value();
+      }();
+      if (is_pruned_column) {
+        is_pruned[this_col_id]   = 1;
+        ignore_vals[this_col_id] = 1;
+        continue;
+      }
+    }
+
     if (parent_col_id != parent_node_sentinel && is_mixed_type_column[parent_col_id] == 1) {
       // if parent is mixed type column, ignore this column.
       is_mixed_type_column[this_col_id] = 1;
@@ -1079,6 +1098,32 @@ table_with_metadata device_parse_nested_json(device_span<SymbolT const> d_input,
     return h_node_categories[0] == NC_LIST and h_node_categories[1] == NC_LIST;
   }();
 
+  // the fields not selected by dtypes are dropped before the node to column mapping, so neither
+  // their nodes nor their values are processed further
+  if (options.is_enabled_prune_columns() and not is_array_of_arrays) {
+    auto const selected_fields = std::visit(
+      cudf::detail::visitor_overload{
+        [](std::vector<data_type> const&) { return std::optional<std::vector<std::string>>{}; },
+        [](auto const& dtypes) {
+          std::vector<std::string> names;
+          for (auto const& dtype : dtypes) {
+            names.push_back(dtype.first);
+          }
+          return std::optional<std::vector<std::string>>{std::move(names)};
+        }},
+      options.get_dtypes());
+    if (selected_fields.has_value()) {
+      // records are at level 0 for JSON lines and below the root list otherwise
+      auto const field_level = static_cast<TreeDepthT>(options.is_enabled_lines() ? 1 : 2);
+      gpu_tree               = prune_unselected_fields(d_input,
+                                         std::move(gpu_tree),
+                                         selected_fields.value(),
+                                         field_level,
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+    }
+  }
+
   auto [gpu_col_id, gpu_row_offsets] =
     records_orient_tree_traversal(d_input,
                                   gpu_tree,
@@ -1126,6 +1171,25 @@ table_with_metadata device_parse_nested_json(device_span<SymbolT const> d_input,
   // Slice off the root list column, which has only a single row that contains all the structs
   auto& root_struct_col = data_root.child_columns.begin()->second;
 
+  // Like the legacy JSON lines reader, the legacy mode requires the dtypes to cover all columns
+  if (options.is_enabled_legacy()) {
+    auto const& column_order = root_struct_col.column_order;
+    std::visit(
+      cudf::detail::visitor_overload{
+        [&](std::vector<data_type> const& user_dtypes) {
+          CUDF_EXPECTS(user_dtypes.empty() or user_dtypes.size() == column_order.size(),
+                       "Must specify types for all columns");
+        },
+        [&](auto const& user_dtypes) {
+          CUDF_EXPECTS(user_dtypes.empty() or
+                         std::all_of(column_order.cbegin(),
+                                     column_order.cend(),
+                                     [&](auto const& name) { return user_dtypes.count(name) > 0; }),
+                       "Must specify types for all columns");
+        }},
+      options.get_dtypes());
+  }
+
   // Initialize meta data to be populated while recursing through the tree of columns
   std::vector<std::unique_ptr<column>> out_columns;
   std::vector<column_name_info> out_column_names;
@@ -23,7 +23,9 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/count.h>
 #include <thrust/iterator/discard_iterator.h>
 
 #include <cstdlib>
@@ -295,6 +297,154 @@ struct TransduceToNormalizedWS {
 
 }  // namespace normalize_whitespace
 
+namespace normalize_empty_values {
+
+enum class dfa_symbol_group_id : uint32_t {
+  DOUBLE_QUOTE_CHAR,   ///< Quote character SG: "
+  ESCAPE_CHAR,         ///< Escape character SG: '\\'
+  NEWLINE_CHAR,        ///< Newline character SG: '\n'
+  WHITESPACE_SYMBOLS,  ///< Whitespace characters SG: '\t', '\r' or ' '
+  COLON_CHAR,          ///< Field-name separator SG: ':'
+  COMMA_CHAR,          ///< Value separator SG: ','
+  OPEN_BRACKET_CHAR,   ///< List start SG: '['
+  CLOSE_BRACKET_CHAR,  ///< List end SG: ']'
+  CLOSE_BRACE_CHAR,    ///< Struct end SG: '}'
+  OTHER_SYMBOLS,       ///< SG implicitly matching all other characters
+  NUM_SYMBOL_GROUPS    ///< Total number of symbol groups
+};
+// Alias for readability of symbol group ids
+constexpr auto NUM_SYMBOL_GROUPS = static_cast<uint32_t>(dfa_symbol_group_id::NUM_SYMBOL_GROUPS);
+// The i-th string representing all the characters of a symbol group
+std::array<std::vector<SymbolT>, NUM_SYMBOL_GROUPS - 1> const eva_sgs{
+  {{'"'}, {'\\'}, {'\n'}, {' ', '\t', '\r'}, {':'}, {','}, {'['}, {']'}, {'}'}}};
+
+/**
+ * -------- FST states ---------
+ * -----------------------------
+ * TT_OOS | Out-of-string state, after a value or a field name
+ * TT_DQS | Double-quoted string state
+ * TT_DEC | State handling escaped characters inside double-quoted string
+ * TT_COL | After a ':', expecting the value of a field
+ * TT_COM | After a ',', expecting the next list element or field name
+ * TT_BRK | After a '[', expecting the first list element
+ *
+ * A value separator or end reached in TT_COL, TT_COM or TT_BRK, with only whitespace since the
+ * state was entered, closes an empty value, which is output as `null`. TT_COM does not insert a
+ * null before a '}' since a ',' in a struct is followed by a field name, and TT_BRK does not insert
+ * a null before a ']' to keep empty lists empty.
+ */
+enum class dfa_states : StateT {
+  TT_OOS = 0U,
+  TT_DQS,
+  TT_DEC,
+  TT_COL,
+  TT_COM,
+  TT_BRK,
+  TT_NUM_STATES
+};
+// Aliases for readability of the transition table
+constexpr auto TT_OOS        = dfa_states::TT_OOS;
+constexpr auto TT_DQS        = dfa_states::TT_DQS;
+constexpr auto TT_DEC        = dfa_states::TT_DEC;
+constexpr auto TT_COL        = dfa_states::TT_COL;
+constexpr auto TT_COM        = dfa_states::TT_COM;
+constexpr auto TT_BRK        = dfa_states::TT_BRK;
+constexpr auto TT_NUM_STATES = static_cast<StateT>(dfa_states::TT_NUM_STATES);
+
+// Transition table
+std::array<std::array<dfa_states, NUM_SYMBOL_GROUPS>, TT_NUM_STATES> const eva_state_tt{{
+  /* IN_STATE      "       \       \n     <SPC>     :       ,       [       ]       }     OTHER */
+  /* TT_OOS */ {{TT_DQS, TT_OOS, TT_OOS, TT_OOS, TT_COL, TT_COM, TT_BRK, TT_OOS, TT_OOS, TT_OOS}},
+  /* TT_DQS */ {{TT_OOS, TT_DEC, TT_OOS, TT_DQS, TT_DQS, TT_DQS, TT_DQS, TT_DQS, TT_DQS, TT_DQS}},
+  /* TT_DEC */ {{TT_DQS, TT_DQS, TT_OOS, TT_DQS, TT_DQS, TT_DQS, TT_DQS, TT_DQS, TT_DQS, TT_DQS}},
+  /* TT_COL */ {{TT_DQS, TT_OOS, TT_OOS, TT_COL, TT_COL, TT_COM, TT_BRK, TT_OOS, TT_OOS, TT_OOS}},
+  /* TT_COM */ {{TT_DQS, TT_OOS, TT_OOS, TT_COM, TT_COL, TT_COM, TT_BRK, TT_OOS, TT_OOS, TT_OOS}},
+  /* TT_BRK */ {{TT_DQS, TT_OOS, TT_OOS, TT_BRK, TT_COL, TT_COM, TT_BRK, TT_OOS, TT_OOS, TT_OOS}},
+}};
+
+// The DFA's starting state
+constexpr StateT start_state = static_cast<StateT>(TT_OOS);
+
+// Number of characters of the `null` output for an empty value
+constexpr uint32_t null_literal_length = 4;
+
+/**
+ * @brief Returns the i-th character of the `null` output for an empty value.
+ */
+constexpr CUDF_HOST_DEVICE char null_literal(uint32_t i) { return "null"[i]; }
+
+/**
+ * @brief Returns whether the transition closes an empty value, preceding the read symbol by `null`.
+ */
+template <typename StateT, typename SymbolGroupT>
+constexpr CUDF_HOST_DEVICE bool closes_empty_value(StateT const state_id,
+                                                   SymbolGroupT const match_id)
+{
+  auto const is_match = [match_id](dfa_symbol_group_id sg) {
+    return match_id == static_cast<SymbolGroupT>(sg);
+  };
+  switch (static_cast<dfa_states>(state_id)) {
+    case TT_COL:
+      return is_match(dfa_symbol_group_id::COMMA_CHAR) ||
+             is_match(dfa_symbol_group_id::CLOSE_BRACE_CHAR);
+    case TT_COM:
+      return is_match(dfa_symbol_group_id::COMMA_CHAR) ||
+             is_match(dfa_symbol_group_id::CLOSE_BRACKET_CHAR);
+    case TT_BRK: return is_match(dfa_symbol_group_id::COMMA_CHAR);
+    default: return false;
+  }
+}
+
+struct TransduceToNullEmptyValues {
+  /**
+   * @brief Returns the <relative_offset>-th output symbol on the transition (state_id, match_id).
+   */
+  template <typename StateT, typename SymbolGroupT, typename RelativeOffsetT, typename SymbolT>
+  constexpr CUDF_HOST_DEVICE SymbolT operator()(StateT const state_id,
+                                                SymbolGroupT const match_id,
+                                                RelativeOffsetT const relative_offset,
+                                                SymbolT const read_symbol) const
+  {
+    // -------- TRANSLATION TABLE ------------
+    //      Let the alphabet set be Sigma
+    // ---------------------------------------
+    // ---------- NON-SPECIAL CASES: ----------
+    //      Output symbol same as input symbol <s>
+    // state | read_symbol <s> -> output_symbol <s>
+    // OOS   | Sigma           -> Sigma
+    // DQS   | Sigma           -> Sigma
+    // DEC   | Sigma           -> Sigma
+    // COL   | Sigma\{,}}      -> Sigma\{,}}
+    // COM   | Sigma\{,]}      -> Sigma\{,]}
+    // BRK   | Sigma\{,}       -> Sigma\{,}
+    // ---------- SPECIAL CASES: --------------
+    //    Input symbol translates to output symbol
+    // COL   | {,}             -> {null,}
+    // COL   | {}}             -> {null}}
+    // COM   | {,}             -> {null,}
+    // COM   | {]}             -> {null]}
+    // BRK   | {,}             -> {null,}
+    if (closes_empty_value(state_id, match_id) && relative_offset < null_literal_length) {
+      return null_literal(relative_offset);
+    }
+    return read_symbol;
+  }
+
+  /**
+   * @brief Returns the number of output characters for a given transition. The input character is
+   * always output, preceded by `null` when it closes an empty value.
+   */
+  template <typename StateT, typename SymbolGroupT, typename SymbolT>
+  constexpr CUDF_HOST_DEVICE uint32_t operator()(StateT const state_id,
+                                                 SymbolGroupT const match_id,
+                                                 SymbolT const read_symbol) const
+  {
+    return closes_empty_value(state_id, match_id) ? null_literal_length + 1 : 1;
+  }
+};
+
+}  // namespace normalize_empty_values
+
 namespace detail {
 
 rmm::device_uvector<SymbolT> normalize_single_quotes(rmm::device_uvector<SymbolT>&& inbuf,
@@ -345,5 +495,38 @@ rmm::device_uvector<SymbolT> normalize_whitespace(rmm::device_uvector<SymbolT>&&
   return outbuf;
 }
 
+rmm::device_uvector<SymbolT> normalize_empty_values(rmm::device_uvector<SymbolT>&& inbuf,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  auto parser = fst::detail::make_fst(
+    fst::detail::make_symbol_group_lut(normalize_empty_values::eva_sgs),
+    fst::detail::make_transition_table(normalize_empty_values::eva_state_tt),
+    fst::detail::make_translation_functor(normalize_empty_values::TransduceToNullEmptyValues{}),
+    stream);
+
+  // Every `null` is inserted before a ',', ']' or '}'
+  auto const num_separators = thrust::count_if(
+    rmm::exec_policy(stream), inbuf.begin(), inbuf.end(), [] __device__(SymbolT c) {
+      return c == ',' || c == ']' || c == '}';
+    });
+  rmm::device_uvector<SymbolT> outbuf(
+    inbuf.size() + static_cast<std::size_t>(num_separators) *
+                     normalize_empty_values::null_literal_length,
+    stream,
+    mr);
+  rmm::device_scalar<SymbolOffsetT> outbuf_size(stream, mr);
+  parser.Transduce(inbuf.data(),
+                   static_cast<SymbolOffsetT>(inbuf.size()),
+                   outbuf.data(),
+                   thrust::make_discard_iterator(),
+                   outbuf_size.data(),
+                   normalize_empty_values::start_state,
+                   stream);
+
+  outbuf.resize(outbuf_size.value(stream), stream);
+  return outbuf;
+}
+
 }  // namespace detail
 }  // namespace cudf::io::json
@@ -38,11 +38,15 @@
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
+#include <thrust/equal.h>
 #include <thrust/fill.h>
+#include <thrust/find.h>
+#include <thrust/functional.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/reduce.h>
@@ -54,6 +58,8 @@
 #include <thrust/transform.h>
 
 #include <limits>
+#include <string>
+#include <vector>
 
 namespace cudf::io::json {
 namespace detail {
@@ -491,6 +497,118 @@ tree_meta_t get_tree_representation(device_span<PdaTokenT const> tokens,
           std::move(node_range_end)};
 }
 
+tree_meta_t prune_unselected_fields(device_span<SymbolT const> d_input,
+                                    tree_meta_t&& tree,
+                                    host_span<std::string const> selected_fields,
+                                    TreeDepthT field_level,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const num_nodes = static_cast<NodeIndexT>(tree.node_categories.size());
+  if (num_nodes == 0) { return std::move(tree); }
+
+  // concatenated names of the selected fields
+  std::vector<SymbolT> h_field_chars;
+  std::vector<size_type> h_field_offsets{0};
+  for (auto const& name : selected_fields) {
+    h_field_chars.insert(h_field_chars.end(), name.begin(), name.end());
+    h_field_offsets.push_back(static_cast<size_type>(h_field_chars.size()));
+  }
+  auto const d_field_chars = cudf::detail::make_device_uvector_async(
+    h_field_chars, stream, rmm::mr::get_current_device_resource());
+  auto const d_field_offsets = cudf::detail::make_device_uvector_async(
+    h_field_offsets, stream, rmm::mr::get_current_device_resource());
+
+  // nodes are in pre-order, so the closest preceding node at or above the field level is the
+  // field (or other record member) whose subtree a node belongs to
+  rmm::device_uvector<NodeIndexT> subtree_roots(num_nodes, stream);
+  auto const subtree_root_it = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<NodeIndexT>(0),
+    cuda::proclaim_return_type<NodeIndexT>(
+      [node_levels = tree.node_levels.begin(), field_level] __device__(NodeIndexT node_id) {
+        return node_levels[node_id] <= field_level ? node_id : parent_node_sentinel;
+      }));
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         subtree_root_it,
+                         subtree_root_it + num_nodes,
+                         subtree_roots.begin(),
+                         thrust::maximum<NodeIndexT>{});
+
+  auto const is_kept = cuda::proclaim_return_type<bool>(
+    [d_input,
+     node_categories = tree.node_categories.begin(),
+     node_levels     = tree.node_levels.begin(),
+     range_begin     = tree.node_range_begin.begin(),
+     range_end       = tree.node_range_end.begin(),
+     subtree_roots   = subtree_roots.begin(),
+     field_chars     = d_field_chars.begin(),
+     field_offsets   = d_field_offsets.begin(),
+     num_fields      = static_cast<size_type>(selected_fields.size()),
+     field_level] __device__(NodeIndexT node_id) -> bool {
+      if (node_levels[node_id] < field_level) { return true; }
+      auto const root = subtree_roots[node_id];
+      if (node_categories[root] != NC_FN or node_levels[root] != field_level) { return true; }
+      auto const name_begin = d_input.data() + range_begin[root];
+      auto const name_size  = static_cast<size_type>(range_end[root] - range_begin[root]);
+      if (thrust::find(thrust::seq, name_begin, name_begin + name_size, '\\') !=
+          name_begin + name_size) {
+        return true;
+      }
+      for (size_type field = 0; field < num_fields; ++field) {
+        auto const field_size = field_offsets[field + 1] - field_offsets[field];
+        auto const field_begin = field_chars + field_offsets[field];
+        if (field_size == name_size and
+            thrust::equal(thrust::seq, name_begin, name_begin + name_size, field_begin)) {
+          return true;
+        }
+      }
+      return false;
+    });
+
+  rmm::device_uvector<uint8_t> kept_flags(num_nodes, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<NodeIndexT>(0),
+                    thrust::make_counting_iterator<NodeIndexT>(0) + num_nodes,
+                    kept_flags.begin(),
+                    is_kept);
+  // new index of each kept node, used to remap the parent ids
+  auto& new_node_ids = subtree_roots;
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), kept_flags.begin(), kept_flags.end(), new_node_ids.begin(), 0);
+  auto const num_kept = static_cast<NodeIndexT>(
+    thrust::count(rmm::exec_policy(stream), kept_flags.begin(), kept_flags.end(), uint8_t{1}));
+  if (num_kept == num_nodes) { return std::move(tree); }
+
+  auto const compact = [&](auto const& input, auto&& output_it) {
+    cudf::detail::copy_if_safe(input.begin(),
+                               input.end(),
+                               kept_flags.begin(),
+                               output_it,
+                               thrust::identity<uint8_t>{},
+                               stream);
+  };
+  tree_meta_t pruned{rmm::device_uvector<NodeT>(num_kept, stream, mr),
+                     rmm::device_uvector<NodeIndexT>(num_kept, stream, mr),
+                     rmm::device_uvector<TreeDepthT>(num_kept, stream, mr),
+                     rmm::device_uvector<SymbolOffsetT>(num_kept, stream, mr),
+                     rmm::device_uvector<SymbolOffsetT>(num_kept, stream, mr)};
+  compact(tree.node_categories, pruned.node_categories.begin());
+  compact(tree.node_levels, pruned.node_levels.begin());
+  compact(tree.node_range_begin, pruned.node_range_begin.begin());
+  compact(tree.node_range_end, pruned.node_range_end.begin());
+  // the ancestors of a kept node are kept, so its parent always has a new index
+  compact(tree.parent_node_ids,
+          thrust::make_transform_output_iterator(
+            pruned.parent_node_ids.begin(),
+            cuda::proclaim_return_type<NodeIndexT>(
+              [new_node_ids = new_node_ids.begin()] __device__(NodeIndexT parent_id) {
+                return parent_id == parent_node_sentinel ? parent_node_sentinel
+                                                         : new_node_ids[parent_id];
+              })));
+  return pruned;
+}
+
 /**
  * @brief Generates unique node_type id for each node.
  * Field nodes with the same name are assigned the same node_type id.
@@ -234,6 +234,27 @@ tree_meta_t get_tree_representation(device_span<PdaTokenT const> tokens,
                                     rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Removes the fields of each record that are not selected, together with their subtrees,
+ * from the tree representation of the JSON input.
+ *
+ * Field names that contain escape sequences are conservatively kept.
+ *
+ * @param d_input The JSON input
+ * @param tree A tree representation of the input JSON string
+ * @param selected_fields Names of the fields to keep
+ * @param field_level Tree level of the field name nodes of the records
+ * @param stream The CUDA stream to which kernels are dispatched
+ * @param mr Optional, resource with which to allocate
+ * @return The tree representation without the nodes of the unselected fields
+ */
+tree_meta_t prune_unselected_fields(device_span<SymbolT const> d_input,
+                                    tree_meta_t&& tree,
+                                    host_span<std::string const> selected_fields,
+                                    TreeDepthT field_level,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Traverse the tree representation of the JSON input in records orient format and populate
  * the output columns indices and row offsets within that column.
@@ -2052,6 +2052,8 @@ cudf::io::parse_options parsing_options(cudf::io::json_reader_options const& opt
   parse_opts.trie_true  = cudf::detail::create_serialized_trie({"true"}, stream);
   parse_opts.trie_false = cudf::detail::create_serialized_trie({"false"}, stream);
   parse_opts.trie_na    = cudf::detail::create_serialized_trie({"", "null"}, stream);
+  // the legacy JSON lines reader inferred unquoted date-like values as timestamps
+  parse_opts.infer_datetime = options.is_enabled_legacy();
   return parse_opts;
 }
 
@@ -15,13 +15,15 @@
  */
 
 #include "io/comp/io_uncomp.hpp"
-#include "io/json/legacy/read_json.hpp"
 #include "io/json/nested_json.hpp"
 #include "read_json.hpp"
 
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/detail/json.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/exec_policy.hpp>
@@ -29,6 +31,8 @@
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/scatter.h>
 
+#include <algorithm>
+#include <map>
 #include <numeric>
 
 namespace cudf::io::json::detail {
@@ -170,30 +174,28 @@ auto get_record_range_raw_input(host_span<std::unique_ptr<datasource>> sources,
                                  reader_opts.get_byte_range_size(),
                                  stream);
   if (should_load_whole_source(reader_opts, sources[0]->size())) return buffer;
-  auto first_delim_pos =
+  auto const first_delim_in_range =
     reader_opts.get_byte_range_offset() == 0 ? 0 : find_first_delimiter(buffer, '\n', stream);
-  if (first_delim_pos == -1) {
+  if (first_delim_in_range == -1) {
     return rmm::device_uvector<char>{0, stream};
   } else {
-    first_delim_pos = first_delim_pos + reader_opts.get_byte_range_offset();
+    // Positions in the source are size_t, since byte ranges may start beyond size_type
+    auto const first_delim_pos = reader_opts.get_byte_range_offset() + first_delim_in_range;
     // Find next delimiter
-    decltype(first_delim_pos) next_delim_pos = -1;
-    auto const total_source_size             = sources_size(sources, 0, 0);
+    size_type next_delim_in_range = -1;
+    auto const total_source_size  = sources_size(sources, 0, 0);
     auto current_offset = reader_opts.get_byte_range_offset() + reader_opts.get_byte_range_size();
-    while (current_offset < total_source_size and next_delim_pos == -1) {
-      buffer         = ingest_raw_input(sources,
+    while (current_offset < total_source_size and next_delim_in_range == -1) {
+      buffer              = ingest_raw_input(sources,
                                 reader_opts.get_compression(),
                                 current_offset,
                                 reader_opts.get_byte_range_size(),
                                 stream);
-      next_delim_pos = find_first_delimiter(buffer, '\n', stream);
-      if (next_delim_pos == -1) { current_offset += reader_opts.get_byte_range_size(); }
-    }
-    if (next_delim_pos == -1) {
-      next_delim_pos = total_source_size;
-    } else {
-      next_delim_pos = next_delim_pos + current_offset;
+      next_delim_in_range = find_first_delimiter(buffer, '\n', stream);
+      if (next_delim_in_range == -1) { current_offset += reader_opts.get_byte_range_size(); }
     }
+    auto const next_delim_pos =
+      next_delim_in_range == -1 ? total_source_size : current_offset + next_delim_in_range;
     return ingest_raw_input(sources,
                             reader_opts.get_compression(),
                             first_delim_pos,
@@ -202,6 +204,72 @@ auto get_record_range_raw_input(host_span<std::unique_ptr<datasource>> sources,
   }
 }
 
+namespace {
+
+/**
+ * @brief Normalizes the given JSON buffer as requested by the options and parses it to a table.
+ *
+ * @param buffer Device buffer with the JSON records to parse
+ * @param reader_opts JSON reader options
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation
+ * @return Table and its metadata parsed from the buffer
+ */
+table_with_metadata parse_raw_input(rmm::device_uvector<char>&& buffer,
+                                    json_reader_options const& reader_opts,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  // If input JSON buffer has single quotes and option to normalize single quotes is enabled,
+  // invoke pre-processing FST
+  if (reader_opts.is_enabled_normalize_single_quotes()) {
+    buffer =
+      normalize_single_quotes(std::move(buffer), stream, rmm::mr::get_current_device_resource());
+  }
+
+  // The empty values the legacy reader read as nulls are normalized to `null` literals
+  if (reader_opts.is_enabled_legacy()) {
+    buffer =
+      normalize_empty_values(std::move(buffer), stream, rmm::mr::get_current_device_resource());
+  }
+
+  // If input JSON buffer has unquoted spaces and tabs and option to normalize whitespaces is
+  // enabled, invoke pre-processing FST
+  if (reader_opts.is_enabled_normalize_whitespace()) {
+    buffer =
+      normalize_whitespace(std::move(buffer), stream, rmm::mr::get_current_device_resource());
+  }
+
+  return device_parse_nested_json(buffer, reader_opts, stream, mr);
+  // For debug purposes, use host_parse_nested_json()
+}
+
+/**
+ * @brief Builds the schema of a column and of its children from a parsed column.
+ *
+ * @param col Parsed column
+ * @param col_info Name information of the column and its children
+ * @return Schema element with the types of the column and its children
+ */
+schema_element make_schema_element(column_view const& col, column_name_info const& col_info)
+{
+  schema_element element{col.type()};
+  if (col.type().id() == type_id::STRUCT) {
+    for (size_type child_idx = 0; child_idx < col.num_children(); ++child_idx) {
+      element.child_types.emplace(
+        col_info.children[child_idx].name,
+        make_schema_element(col.child(child_idx), col_info.children[child_idx]));
+    }
+  } else if (col.type().id() == type_id::LIST) {
+    auto const child_idx = lists_column_view::child_column_index;
+    element.child_types.emplace(
+      list_child_name, make_schema_element(col.child(child_idx), col_info.children[child_idx]));
+  }
+  return element;
+}
+
+}  // namespace
+
 table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
                               json_reader_options const& reader_opts,
                               rmm::cuda_stream_view stream,
@@ -209,10 +277,6 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
 {
   CUDF_FUNC_RANGE();
 
-  if (reader_opts.is_enabled_legacy()) {
-    return legacy::read_json(sources, reader_opts, stream, mr);
-  }
-
   if (reader_opts.get_byte_range_offset() != 0 or reader_opts.get_byte_range_size() != 0) {
     CUDF_EXPECTS(reader_opts.is_enabled_lines(),
                  "Specifying a byte range is supported only for JSON Lines");
@@ -227,24 +291,121 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
                  "Multiple inputs are supported only for JSON Lines format");
   }
 
-  auto buffer = get_record_range_raw_input(sources, reader_opts, stream);
+  return parse_raw_input(get_record_range_raw_input(sources, reader_opts, stream),
+                         reader_opts,
+                         stream,
+                         mr);
+}
 
-  // If input JSON buffer has single quotes and option to normalize single quotes is enabled,
-  // invoke pre-processing FST
-  if (reader_opts.is_enabled_normalize_single_quotes()) {
-    buffer =
-      normalize_single_quotes(std::move(buffer), stream, rmm::mr::get_current_device_resource());
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<datasource>>&& sources,
+                               json_reader_options options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _chunk_read_limit{chunk_read_limit},
+    _sources{std::move(sources)},
+    _options{std::move(options)},
+    _stream{stream},
+    _mr{mr}
+{
+  CUDF_EXPECTS(_options.is_enabled_lines(), "Chunked reading is supported only for JSON Lines");
+  CUDF_EXPECTS(_options.get_compression() == compression_type::NONE,
+               "Chunked reading is not supported for compressed inputs");
+  CUDF_EXPECTS(_options.get_byte_range_offset() == 0 and _options.get_byte_range_size() == 0,
+               "Chunked reading does not support a byte range");
+
+  // Start at the first non-empty source
+  while (_source_idx < _sources.size() and _sources[_source_idx]->is_empty()) {
+    ++_source_idx;
   }
+}
 
-  // If input JSON buffer has unquoted spaces and tabs and option to normalize whitespaces is
-  // enabled, invoke pre-processing FST
-  if (reader_opts.is_enabled_normalize_whitespace()) {
-    buffer =
-      normalize_whitespace(std::move(buffer), stream, rmm::mr::get_current_device_resource());
+bool chunked_reader::has_next() const { return _source_idx < _sources.size(); }
+
+void chunked_reader::advance()
+{
+  _offset += _chunk_read_limit;
+  if (_chunk_read_limit == 0 or _offset >= _sources[_source_idx]->size()) {
+    _offset = 0;
+    do {
+      ++_source_idx;
+    } while (_source_idx < _sources.size() and _sources[_source_idx]->is_empty());
   }
+}
 
-  return device_parse_nested_json(buffer, reader_opts, stream, mr);
-  // For debug purposes, use host_parse_nested_json()
+table_with_metadata chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+
+  while (has_next()) {
+    auto chunk_options = _options;
+    chunk_options.set_byte_range_offset(_offset);
+    chunk_options.set_byte_range_size(_chunk_read_limit);
+    auto source = host_span<std::unique_ptr<datasource>>{&_sources[_source_idx], 1};
+    auto buffer = get_record_range_raw_input(source, chunk_options, _stream);
+    advance();
+
+    // No record starts in this byte range
+    if (buffer.is_empty()) { continue; }
+
+    return conform_to_schema(parse_raw_input(std::move(buffer), _options, _stream, _mr));
+  }
+  // All records have been read
+  return conform_to_schema({std::make_unique<table>(), table_metadata{}});
+}
+
+table_with_metadata chunked_reader::conform_to_schema(table_with_metadata&& chunk)
+{
+  if (not _schema_columns) {
+    if (chunk.tbl->num_columns() == 0) { return std::move(chunk); }
+
+    // The first chunk fixes the schema; parse the next chunks with its column types, unless the
+    // user has given them
+    _schema_columns  = cudf::empty_like(chunk.tbl->view());
+    _schema_metadata = chunk.metadata;
+    auto const has_user_dtypes =
+      std::visit([](auto const& dtypes) { return not dtypes.empty(); }, _options.get_dtypes());
+    if (not has_user_dtypes) {
+      std::map<std::string, schema_element> dtypes;
+      for (size_type col_idx = 0; col_idx < chunk.tbl->num_columns(); ++col_idx) {
+        auto const& col_info = chunk.metadata.schema_info[col_idx];
+        dtypes.emplace(col_info.name,
+                       make_schema_element(chunk.tbl->get_column(col_idx).view(), col_info));
+      }
+      _options.set_dtypes(std::move(dtypes));
+    }
+    return std::move(chunk);
+  }
+
+  auto const num_rows = chunk.tbl->num_rows();
+  auto columns        = chunk.tbl->release();
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (size_type col_idx = 0; col_idx < _schema_columns->num_columns(); ++col_idx) {
+    auto const& name = _schema_metadata.schema_info[col_idx].name;
+    auto const chunk_col =
+      std::find_if(chunk.metadata.schema_info.cbegin(),
+                   chunk.metadata.schema_info.cend(),
+                   [&](auto const& col_info) { return col_info.name == name; });
+    if (chunk_col != chunk.metadata.schema_info.cend()) {
+      out_columns.push_back(
+        std::move(columns[std::distance(chunk.metadata.schema_info.cbegin(), chunk_col)]));
+    } else {
+      // Gathering out of bounds of the empty schema column gives nulls of any type
+      rmm::device_uvector<size_type> gather_map(num_rows, _stream);
+      CUDF_CUDA_TRY(cudaMemsetAsync(
+        gather_map.data(), 0, gather_map.size() * sizeof(size_type), _stream.value()));
+      auto nulls = cudf::detail::gather(table_view{{_schema_columns->get_column(col_idx).view()}},
+                                        gather_map,
+                                        out_of_bounds_policy::NULLIFY,
+                                        cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                        _stream,
+                                        _mr);
+      out_columns.push_back(std::move(nulls->release().front()));
+    }
+  }
+  auto out_metadata        = std::move(chunk.metadata);
+  out_metadata.schema_info = _schema_metadata.schema_info;
+  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
 }  // namespace cudf::io::json::detail
@@ -29,6 +29,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/detail/json.hpp>
@@ -42,6 +43,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -49,6 +51,8 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/gather.h>
 #include <thrust/host_vector.h>
@@ -56,10 +60,13 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/tabulate.h>
+#include <thrust/transform.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace cudf::io::json::detail {
@@ -755,6 +762,201 @@ struct column_to_strings_fn {
   string_scalar const false_value;
 };
 
+// Target output size of a chunk of rows; the strings columns of a chunk are several times larger
+constexpr size_t target_chunk_output_size = 256 * 1024 * 1024;
+
+/**
+ * @brief Functor returning the maximum JSON output size of a value of a fixed-width type.
+ */
+struct formatted_width_fn {
+  json_writer_options const& options;
+
+  template <typename T>
+  size_t operator()() const
+  {
+    if constexpr (std::is_same_v<T, bool>) {
+      return std::max(options.get_true_value().size(), options.get_false_value().size());
+    } else if constexpr (std::is_integral_v<T>) {
+      return std::numeric_limits<T>::digits10 + 2;  // sign and a partial digit
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return std::numeric_limits<T>::max_digits10 + 8;  // sign, point and exponent
+    } else if constexpr (cudf::is_fixed_point<T>()) {
+      return std::numeric_limits<typename T::rep>::digits10 + 4;
+    } else {
+      return 48;  // quoted timestamps and durations
+    }
+  }
+};
+
+/**
+ * @brief Functor returning the estimated JSON output size of a row of a strings or fixed-width
+ * column.
+ */
+struct leaf_size_fn {
+  column_device_view col;
+  size_t width;
+  size_t null_width;
+
+  __device__ size_t operator()(size_type idx) const
+  {
+    if (col.is_null(idx)) { return null_width; }
+    if (col.type().id() != type_id::STRING) { return width; }
+    // quotes; escaped characters are not accounted for
+    return col.element<string_view>(idx).size_bytes() + 2;
+  }
+};
+
+/**
+ * @brief Functor returning the estimated JSON output size of a row of a lists column from the
+ * prefix sums of the sizes of its child rows.
+ */
+struct list_size_fn {
+  size_type const* offsets;
+  size_t const* child_size_sums;
+
+  __device__ size_t operator()(size_type idx) const
+  {
+    auto const begin = offsets[idx] - offsets[0];
+    auto const end   = offsets[idx + 1] - offsets[0];
+    // brackets and separators
+    return child_size_sums[end] - child_size_sums[begin] + (end - begin) + 2;
+  }
+};
+
+rmm::device_uvector<size_t> estimate_row_sizes(column_view const& col,
+                                               host_span<column_name_info const> children_names,
+                                               json_writer_options const& options,
+                                               rmm::cuda_stream_view stream);
+
+/**
+ * @brief Estimates the JSON output size of each row of a table or structs column, from the sizes
+ * of the fields.
+ */
+template <typename column_iterator>
+rmm::device_uvector<size_t> estimate_struct_sizes(column_iterator column_begin,
+                                                  column_iterator column_end,
+                                                  size_type num_rows,
+                                                  host_span<column_name_info const> children_names,
+                                                  json_writer_options const& options,
+                                                  rmm::cuda_stream_view stream)
+{
+  // braces, and the quoted name, colon and separator of each field
+  size_t fields_size = 2;
+  for (auto i = 0; i < std::distance(column_begin, column_end); ++i) {
+    auto const name_size = children_names.size() > static_cast<size_t>(i)
+                             ? children_names[i].name.size()
+                             : std::to_string(i).size();
+    fields_size += name_size + 4;
+  }
+  rmm::device_uvector<size_t> sizes(num_rows, stream);
+  thrust::fill(rmm::exec_policy_nosync(stream), sizes.begin(), sizes.end(), fields_size);
+
+  for (auto i = 0; i < std::distance(column_begin, column_end); ++i) {
+    auto const field_sizes = estimate_row_sizes(*(column_begin + i),
+                                                children_names.size() > static_cast<size_t>(i)
+                                                  ? children_names[i].children
+                                                  : std::vector<column_name_info>{},
+                                                options,
+                                                stream);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      sizes.begin(),
+                      sizes.end(),
+                      field_sizes.begin(),
+                      sizes.begin(),
+                      thrust::plus<size_t>{});
+  }
+  return sizes;
+}
+
+/**
+ * @brief Estimates the JSON output size of each row of a column without formatting it.
+ *
+ * The estimate is used to split the table into chunks of a bounded output size; it is an upper
+ * bound of the output size except for the escaped characters of strings.
+ */
+rmm::device_uvector<size_t> estimate_row_sizes(column_view const& col,
+                                               host_span<column_name_info const> children_names,
+                                               json_writer_options const& options,
+                                               rmm::cuda_stream_view stream)
+{
+  if (col.type().id() == type_id::STRUCT) {
+    auto const child_it = cudf::detail::make_counting_transform_iterator(
+      0, [&stream, structs_view = structs_column_view{col}](auto const child_idx) {
+        return structs_view.get_sliced_child(child_idx, stream);
+      });
+    return estimate_struct_sizes(
+      child_it, child_it + col.num_children(), col.size(), children_names, options, stream);
+  }
+
+  rmm::device_uvector<size_t> sizes(col.size(), stream);
+  if (col.type().id() == type_id::LIST) {
+    auto const lists_view      = lists_column_view(col);
+    auto constexpr child_index = lists_column_view::child_column_index;
+    auto const child_sizes =
+      estimate_row_sizes(lists_view.get_sliced_child(stream),
+                         children_names.size() > child_index ? children_names[child_index].children
+                                                             : std::vector<column_name_info>{},
+                         options,
+                         stream);
+    rmm::device_uvector<size_t> child_size_sums(child_sizes.size() + 1, stream);
+    child_size_sums.set_element_to_zero_async(0, stream);
+    thrust::inclusive_scan(rmm::exec_policy_nosync(stream),
+                           child_sizes.begin(),
+                           child_sizes.end(),
+                           child_size_sums.begin() + 1);
+    thrust::tabulate(rmm::exec_policy_nosync(stream),
+                     sizes.begin(),
+                     sizes.end(),
+                     list_size_fn{lists_view.offsets_begin(), child_size_sums.data()});
+    return sizes;
+  }
+
+  auto const width = col.type().id() == type_id::STRING
+                       ? 0
+                       : cudf::type_dispatcher(col.type(), formatted_width_fn{options});
+  auto const d_col = column_device_view::create(col, stream);
+  thrust::tabulate(rmm::exec_policy_nosync(stream),
+                   sizes.begin(),
+                   sizes.end(),
+                   leaf_size_fn{*d_col, width, options.get_na_rep().size()});
+  return sizes;
+}
+
+/**
+ * @brief Returns the rows at which to split a table for each chunk to have an estimated JSON
+ * output size of at most `target_chunk_output_size` bytes.
+ */
+std::vector<size_type> output_size_splits(table_view const& table,
+                                          host_span<column_name_info const> column_names,
+                                          json_writer_options const& options,
+                                          rmm::cuda_stream_view stream)
+{
+  auto row_end_sizes = estimate_struct_sizes(
+    table.begin(), table.end(), table.num_rows(), column_names, options, stream);
+  thrust::inclusive_scan(rmm::exec_policy_nosync(stream),
+                         row_end_sizes.begin(),
+                         row_end_sizes.end(),
+                         row_end_sizes.begin());
+
+  auto const total_size = row_end_sizes.back_element(stream);
+  auto const num_chunks = cudf::util::div_rounding_up_safe(total_size, target_chunk_output_size);
+  if (num_chunks <= 1) { return {}; }
+
+  // the first row of each chunk is the first row that ends past the target size of the chunk
+  rmm::device_uvector<size_type> splits(num_chunks - 1, stream);
+  auto const chunk_ends = cudf::detail::make_counting_transform_iterator(
+    1, cuda::proclaim_return_type<size_t>([] __device__(size_t chunk) {
+      return chunk * target_chunk_output_size;
+    }));
+  thrust::upper_bound(rmm::exec_policy_nosync(stream),
+                      row_end_sizes.begin(),
+                      row_end_sizes.end(),
+                      chunk_ends,
+                      chunk_ends + splits.size(),
+                      splits.begin());
+  return cudf::detail::make_std_vector_sync(splits, stream);
+}
+
 }  // namespace
 
 std::unique_ptr<column> make_strings_column_from_host(host_span<std::string const> host_strings,
@@ -866,9 +1068,8 @@ void write_json(data_sink* out_sink,
   if (table.num_rows() > 0) {
     auto n_rows_per_chunk = options.get_rows_per_chunk();
 
-    // This outputs the JSON in row chunks to save memory.
-    // Maybe we can use the total_rows*count calculation and a memory threshold
-    // instead of an arbitrary chunk count.
+    // This outputs the JSON in row chunks to save memory: a chunk has at most `n_rows_per_chunk`
+    // rows, and an estimated output size of at most `target_chunk_output_size` bytes.
     // The entire JSON chunk must fit in CPU memory before writing it out.
     //
     if (n_rows_per_chunk % 8)  // must be divisible by 8
@@ -877,20 +1078,23 @@ void write_json(data_sink* out_sink,
     CUDF_EXPECTS(n_rows_per_chunk >= 8, "write_json: invalid chunk_rows; must be at least 8");
 
     auto num_rows = table.num_rows();
-    std::vector<table_view> vector_views;
-
-    if (num_rows <= n_rows_per_chunk) {
-      vector_views.push_back(table);
-    } else {
-      auto const n_chunks = num_rows / n_rows_per_chunk;
-      std::vector<size_type> splits(n_chunks);
-      thrust::tabulate(splits.begin(), splits.end(), [n_rows_per_chunk](auto idx) {
-        return (idx + 1) * n_rows_per_chunk;
-      });
-
-      // split table_view into chunks:
-      vector_views = cudf::detail::split(table, splits, stream);
+    auto splits   = output_size_splits(table, user_column_names, options, stream);
+    for (int64_t row = n_rows_per_chunk; row < num_rows; row += n_rows_per_chunk) {
+      splits.push_back(static_cast<size_type>(row));
     }
+    // splits are also divisible by 8
+    std::transform(
+      splits.begin(), splits.end(), splits.begin(), [](auto split) { return split - split % 8; });
+    std::sort(splits.begin(), splits.end());
+    splits.erase(std::unique(splits.begin(), splits.end()), splits.end());
+    splits.erase(std::remove_if(splits.begin(),
+                                splits.end(),
+                                [num_rows](auto split) { return split <= 0 or split >= num_rows; }),
+                 splits.end());
+
+    // split table_view into chunks:
+    std::vector<table_view> vector_views =
+      splits.empty() ? std::vector<table_view>{table} : cudf::detail::split(table, splits, stream);
 
     // convert each chunk to JSON:
     column_to_strings_fn converter{options, stream, rmm::mr::get_current_device_resource()};
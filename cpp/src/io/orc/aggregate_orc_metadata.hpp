@@ -18,6 +18,11 @@
 
 #include "orc.hpp"
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <functional>
 #include <map>
 #include <optional>
 #include <vector>
@@ -121,6 +126,27 @@ class aggregate_orc_metadata {
                  std::optional<size_type> const& num_rows,
                  rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Filters the stripes based on the predicate filter and the stripe statistics.
+   *
+   * A stripe is filtered out only if its statistics show that none of its rows can satisfy the
+   * filter. Stripes without statistics are always kept.
+   *
+   * @param stripes Indices of the stripes to filter in each source; all stripes if empty
+   * @param output_dtypes Data types of the output columns
+   * @param output_col_ids ORC column IDs of the output columns
+   * @param filter AST expression on the output columns to filter stripes with
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Indices of the remaining stripes in each source, or `std::nullopt` if no source has
+   * stripe statistics
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_stripes(
+    std::vector<std::vector<size_type>> const& stripes,
+    host_span<data_type const> output_dtypes,
+    host_span<size_type const> output_col_ids,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Filters ORC file to a selection of columns, based on their paths in the file.
    *
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "orc_gpu.hpp"
+
+#include <cudf/hashing/detail/hash_functions.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf::io::orc::gpu {
+
+namespace {
+
+constexpr int bloom_filter_block_size = 256;
+
+using cudf::hashing::detail::rotate_bits_left;
+
+/**
+ * @brief 64-bit variant of the Murmur3 hash, as implemented by `Murmur3.hash64` in ORC.
+ *
+ * This is not the first half of Murmur3 x64_128, so the cudf implementation can't be reused.
+ */
+__device__ uint64_t murmur3_hash64(uint8_t const* data, size_type length)
+{
+  constexpr uint64_t c1   = 0x87c37b91114253d5ull;
+  constexpr uint64_t c2   = 0x4cf5ad432745937full;
+  constexpr uint64_t seed = 104729;
+
+  auto const mix_block = [&](uint64_t k) {
+    k *= c1;
+    k = rotate_bits_left(k, 31);
+    return k * c2;
+  };
+  auto const load_bytes = [&](size_type offset, size_type num_bytes) {
+    uint64_t k = 0;
+    for (auto b = num_bytes - 1; b >= 0; --b) {
+      k = (k << 8) | data[offset + b];
+    }
+    return k;
+  };
+
+  uint64_t hash         = seed;
+  auto const num_blocks = length / 8;
+  for (size_type i = 0; i < num_blocks; ++i) {
+    hash ^= mix_block(load_bytes(i * 8, 8));
+    hash = rotate_bits_left(hash, 27) * 5 + 0x52dce729;
+  }
+  auto const tail_length = length - num_blocks * 8;
+  if (tail_length > 0) { hash ^= mix_block(load_bytes(num_blocks * 8, tail_length)); }
+
+  hash ^= static_cast<uint64_t>(length);
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * @brief Thomas Wang's 64-bit integer hash, as implemented by `BloomFilter.getLongHash` in ORC.
+ *
+ * Right shifts are arithmetic, as in the Java implementation.
+ */
+__device__ uint64_t long_hash(int64_t value)
+{
+  auto const sra = [](uint64_t k, int shift) {
+    return static_cast<uint64_t>(static_cast<int64_t>(k) >> shift);
+  };
+  auto key = static_cast<uint64_t>(value);
+  key      = ~key + (key << 21);
+  key      = key ^ sra(key, 24);
+  key      = (key + (key << 3)) + (key << 8);
+  key      = key ^ sra(key, 14);
+  key      = (key + (key << 2)) + (key << 4);
+  key      = key ^ sra(key, 28);
+  key      = key + (key << 31);
+  return key;
+}
+
+/**
+ * @brief Computes the ORC Bloom filter hash of a column element.
+ *
+ * Integers and dates are hashed as 64-bit integers, floating-point values as the bits of the
+ * equivalent double, and strings as their UTF-8 bytes.
+ */
+struct bloom_filter_hash_fn {
+  column_device_view const& col;
+
+  template <typename T>
+  __device__ uint64_t operator()(size_type row) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const value = col.element<string_view>(row);
+      return murmur3_hash64(reinterpret_cast<uint8_t const*>(value.data()), value.size_bytes());
+    } else if constexpr (std::is_same_v<T, timestamp_D>) {
+      return long_hash(col.element<T>(row).time_since_epoch().count());
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      auto const value = static_cast<double>(col.element<T>(row));
+      // Matches Double.doubleToLongBits, which collapses all NaNs into the canonical one
+      return long_hash(isnan(value) ? 0x7ff8000000000000ll : __double_as_longlong(value));
+    } else if constexpr (cudf::is_integral<T>()) {
+      return long_hash(static_cast<int64_t>(col.element<T>(row)));
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for the ORC Bloom filters");
+    }
+  }
+};
+
+// blockDim {bloom_filter_block_size,1,1}
+CUDF_KERNEL void __launch_bounds__(bloom_filter_block_size)
+  populate_bloom_filters_kernel(device_2dspan<uint64_t> bitsets,
+                                device_span<orc_column_device_view const> orc_columns,
+                                device_2dspan<rowgroup_rows const> rowgroup_bounds,
+                                device_span<uint32_t const> bloom_filter_col_indexes,
+                                uint32_t num_hash_functions)
+{
+  auto const row_group_idx = blockIdx.x;
+  auto const bf_col_idx    = blockIdx.y;
+  auto const col_idx       = bloom_filter_col_indexes[bf_col_idx];
+  auto const& col          = orc_columns[col_idx];
+  auto const num_rowgroups = rowgroup_bounds.size().first;
+  auto bitset              = bitsets[bf_col_idx * num_rowgroups + row_group_idx];
+  auto const num_bits      = static_cast<int32_t>(bitset.size() * 64);
+
+  // Elements are null where the parent column is null as well
+  auto const pushdown_mask =
+    col.parent_index.has_value() ? orc_columns[col.parent_index.value()].pushdown_mask : nullptr;
+  auto const hash_fn = bloom_filter_hash_fn{col};
+  auto const rows    = rowgroup_bounds[row_group_idx][col_idx];
+  for (auto row = rows.begin + static_cast<size_type>(threadIdx.x); row < rows.end;
+       row += bloom_filter_block_size) {
+    if (not bit_value_or(pushdown_mask, col.offset() + row, true) or col.is_null(row)) {
+      continue;
+    }
+    auto const hash64 = type_dispatcher(col.type(), hash_fn, row);
+    // Same bit positions as `BloomFilter.addHash` in ORC, in 32-bit signed arithmetic
+    auto const hash1 = static_cast<int32_t>(hash64);
+    auto const hash2 = static_cast<int32_t>(hash64 >> 32);
+    for (uint32_t i = 1; i <= num_hash_functions; ++i) {
+      auto combined_hash =
+        static_cast<int32_t>(static_cast<uint32_t>(hash1) + i * static_cast<uint32_t>(hash2));
+      if (combined_hash < 0) { combined_hash = ~combined_hash; }
+      auto const pos = combined_hash % num_bits;
+      atomicOr(reinterpret_cast<unsigned long long*>(&bitset[pos / 64]), 1ull << (pos % 64));
+    }
+  }
+}
+
+}  // namespace
+
+void populate_bloom_filters(device_2dspan<uint64_t> bitsets,
+                            device_span<orc_column_device_view const> orc_columns,
+                            device_2dspan<rowgroup_rows const> rowgroup_bounds,
+                            device_span<uint32_t const> bloom_filter_col_indexes,
+                            uint32_t num_hash_functions,
+                            rmm::cuda_stream_view stream)
+{
+  auto const num_rowgroups = rowgroup_bounds.size().first;
+  if (num_rowgroups == 0 or bloom_filter_col_indexes.empty()) { return; }
+
+  dim3 const dim_grid(num_rowgroups, bloom_filter_col_indexes.size());
+  populate_bloom_filters_kernel<<<dim_grid, bloom_filter_block_size, 0, stream.value()>>>(
+    bitsets, orc_columns, rowgroup_bounds, bloom_filter_col_indexes, num_hash_functions);
+}
+
+}  // namespace cudf::io::orc::gpu
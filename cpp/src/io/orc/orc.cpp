@@ -227,6 +227,18 @@ void ProtobufReader::read(Metadata& s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(BloomFilter& s, size_t maxlen)
+{
+  auto op = std::tuple(field_reader(1, s.numHashFunctions), field_reader(3, s.utf8bitset));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilterIndex& s, size_t maxlen)
+{
+  auto op = std::tuple(field_reader(1, s.bloomFilter));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -393,6 +405,21 @@ size_t ProtobufWriter::write(Metadata const& s)
   return w.value();
 }
 
+size_t ProtobufWriter::write(BloomFilter const& s)
+{
+  ProtobufFieldWriter w(this);
+  w.field_uint(1, s.numHashFunctions);
+  w.field_blob(3, s.utf8bitset);
+  return w.value();
+}
+
+size_t ProtobufWriter::write(BloomFilterIndex const& s)
+{
+  ProtobufFieldWriter w(this);
+  w.field_repeated_struct(1, s.bloomFilter);
+  return w.value();
+}
+
 OrcDecompressor::OrcDecompressor(CompressionKind kind, uint64_t block_size)
   : m_blockSize(block_size)
 {
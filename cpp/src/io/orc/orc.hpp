@@ -168,6 +168,15 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;    // number of hash functions used to set the bits
+  std::vector<uint8_t> utf8bitset;  // the bitset, as little-endian 64-bit words
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // one filter per row group in the stripe
+};
+
 int inline constexpr encode_field_number(int field_number, ProtofType field_type) noexcept
 {
   return (field_number * 8) + static_cast<int>(field_type);
@@ -255,6 +264,8 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(BloomFilter&, size_t maxlen);
+  void read(BloomFilterIndex&, size_t maxlen);
 
  private:
   template <int index>
@@ -304,9 +315,18 @@ class ProtobufReader {
     m_cur += size;
   }
 
+  template <typename T, std::enable_if_t<std::is_same_v<T, std::vector<uint8_t>>>* = nullptr>
+  void read_field(T& value, uint8_t const* end)
+  {
+    auto const size = read_field_size(end);
+    value.assign(m_cur, m_cur + size);
+    m_cur += size;
+  }
+
   template <typename T,
             std::enable_if_t<std::is_same_v<T, std::vector<typename T::value_type>> and
-                             !std::is_same_v<std::string, typename T::value_type>>* = nullptr>
+                             !std::is_same_v<std::string, typename T::value_type> and
+                             !std::is_same_v<uint8_t, typename T::value_type>>* = nullptr>
   void read_field(T& value, uint8_t const* end)
   {
     auto const size = read_field_size(end);
@@ -528,6 +548,8 @@ class ProtobufWriter {
   size_t write(ColumnEncoding const&);
   size_t write(StripeStatistics const&);
   size_t write(Metadata const&);
+  size_t write(BloomFilter const&);
+  size_t write(BloomFilterIndex const&);
 
  protected:
   std::vector<uint8_t> m_buff;
@@ -423,6 +423,25 @@ void rowgroup_char_counts(device_2dspan<size_type> counts,
                           device_span<uint32_t const> str_col_indexes,
                           rmm::cuda_stream_view stream);
 
+/**
+ * @brief Sets the bits of the Bloom filters of each rowgroup, for a subset of the columns.
+ *
+ * Filters are compatible with the BLOOM_FILTER_UTF8 streams written by the ORC Java library.
+ *
+ * @param bitsets Zero-initialized filter bitsets [column * num_rowgroups + rowgroup][word]
+ * @param orc_columns Pre-order flattened device array of ORC column views
+ * @param rowgroup_bounds Ranges of rows in each rowgroup [rowgroup][column]
+ * @param bloom_filter_col_indexes Indexes of the Bloom filter columns in orc_columns
+ * @param num_hash_functions Number of bits set for each value
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void populate_bloom_filters(device_2dspan<uint64_t> bitsets,
+                            device_span<orc_column_device_view const> orc_columns,
+                            device_2dspan<rowgroup_rows const> rowgroup_bounds,
+                            device_span<uint32_t const> bloom_filter_col_indexes,
+                            uint32_t num_hash_functions,
+                            rmm::cuda_stream_view stream);
+
 /**
  * @brief Converts sizes of decimal elements to offsets within the rowgroup.
  *
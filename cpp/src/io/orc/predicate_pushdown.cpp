@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aggregate_orc_metadata.hpp"
+
+#include "io/utilities/stats_filter.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+namespace cudf::io::orc::detail {
+
+namespace {
+
+/**
+ * @brief Converts a duration to a timestamp of type `T`, rounding down for minimum values and up
+ * for maximum values when `T` is coarser than the duration.
+ */
+template <typename T, typename Duration>
+T to_timestamp(Duration value, bool round_up)
+{
+  using cuda::std::chrono::duration_cast;
+  using target_duration = typename T::duration;
+  auto result           = duration_cast<target_duration>(value);
+  if (round_up and duration_cast<Duration>(result) < value) { result += target_duration{1}; }
+  if (not round_up and duration_cast<Duration>(result) > value) { result -= target_duration{1}; }
+  return T{result};
+}
+
+/**
+ * @brief Converts the statistics of a column in each stripe to 2 device columns - min, max values.
+ */
+struct stats_caster {
+  host_span<orc::column_statistics const> stats;
+
+  // Minimum or maximum value of the statistics as type `T`, if known
+  template <typename T>
+  static std::optional<T> stats_value(orc::column_statistics const& stats, bool is_max)
+  {
+    if constexpr (cudf::is_timestamp<T>()) {
+      if (stats.date_stats.has_value()) {
+        auto const& days = is_max ? stats.date_stats->maximum : stats.date_stats->minimum;
+        if (days.has_value()) { return to_timestamp<T>(duration_D{*days}, is_max); }
+      }
+      if (stats.timestamp_stats.has_value()) {
+        auto const& millis =
+          is_max ? stats.timestamp_stats->maximum_utc : stats.timestamp_stats->minimum_utc;
+        // The sub-millisecond part of the maximum is not included, so round the maximum up
+        if (millis.has_value()) {
+          return to_timestamp<T>(duration_ms{*millis + (is_max ? 1 : 0)}, is_max);
+        }
+      }
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      if (stats.double_stats.has_value()) {
+        auto const& value = is_max ? stats.double_stats->maximum : stats.double_stats->minimum;
+        if (value.has_value()) { return static_cast<T>(*value); }
+      }
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      if (stats.int_stats.has_value()) {
+        auto const& value = is_max ? stats.int_stats->maximum : stats.int_stats->minimum;
+        if (value.has_value()) { return static_cast<T>(*value); }
+      }
+    }
+    return std::nullopt;
+  }
+
+  static std::optional<std::string> string_value(orc::column_statistics const& stats, bool is_max)
+  {
+    if (not stats.string_stats.has_value()) { return std::nullopt; }
+    return is_max ? stats.string_stats->maximum : stats.string_stats->minimum;
+  }
+
+  // Null mask buffer where the elements without a value are null
+  template <typename Values>
+  static std::pair<rmm::device_buffer, size_type> make_null_mask(
+    Values const& values, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+  {
+    auto const num_rows = static_cast<size_type>(values.size());
+    std::vector<bitmask_type> null_mask(
+      cudf::util::div_rounding_up_safe<size_type>(cudf::bitmask_allocation_size_bytes(num_rows),
+                                                  sizeof(bitmask_type)),
+      ~bitmask_type{0});
+    size_type null_count = 0;
+    for (size_type idx = 0; idx < num_rows; ++idx) {
+      if (not values[idx].has_value()) {
+        clear_bit_unsafe(null_mask.data(), idx);
+        null_count++;
+      }
+    }
+    return {rmm::device_buffer{
+              null_mask.data(), cudf::bitmask_allocation_size_bytes(num_rows), stream, mr},
+            null_count};
+  }
+
+  template <typename T>
+  std::unique_ptr<column> make_stats_column(bool is_max,
+                                            cudf::data_type dtype,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      std::vector<std::optional<std::string>> values;
+      std::transform(stats.begin(), stats.end(), std::back_inserter(values), [&](auto const& s) {
+        return string_value(s, is_max);
+      });
+      std::vector<char> chars{};
+      std::vector<cudf::size_type> offsets(1, 0);
+      for (auto const& value : values) {
+        if (value.has_value()) { chars.insert(chars.end(), value->cbegin(), value->cend()); }
+        offsets.push_back(static_cast<size_type>(chars.size()));
+      }
+      auto [null_mask, null_count] = make_null_mask(values, stream, mr);
+      auto d_chars                 = cudf::detail::make_device_uvector_async(chars, stream, mr);
+      auto d_offsets               = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
+      return cudf::make_strings_column(
+        static_cast<size_type>(values.size()),
+        std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
+        d_chars.release(),
+        null_count,
+        std::move(null_mask));
+    } else {
+      std::vector<std::optional<T>> values;
+      std::transform(stats.begin(), stats.end(), std::back_inserter(values), [&](auto const& s) {
+        return stats_value<T>(s, is_max);
+      });
+      std::vector<T> host_values(values.size());
+      std::transform(values.cbegin(), values.cend(), host_values.begin(), [](auto const& value) {
+        return value.value_or(T{});
+      });
+      auto [null_mask, null_count] = make_null_mask(values, stream, mr);
+      return std::make_unique<column>(
+        dtype,
+        static_cast<size_type>(values.size()),
+        cudf::detail::make_device_uvector_async(host_values, stream, mr).release(),
+        std::move(null_mask),
+        null_count);
+    }
+  }
+
+  // Creates device columns from column statistics (min, max)
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    cudf::data_type dtype, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+  {
+    auto const num_rows = static_cast<size_type>(stats.size());
+    if constexpr (std::is_same_v<T, string_view> or cudf::is_timestamp<T>() or
+                  cudf::is_floating_point<T>() or
+                  (cudf::is_integral<T>() and not cudf::is_boolean<T>())) {
+      return {make_stats_column<T>(false, dtype, stream, mr),
+              make_stats_column<T>(true, dtype, stream, mr)};
+    } else if constexpr (cudf::is_fixed_width<T>()) {
+      // Boolean and decimal statistics have no usable min/max values; null keeps every stripe
+      return {
+        cudf::make_fixed_width_column(dtype, num_rows, mask_state::ALL_NULL, stream, mr),
+        cudf::make_fixed_width_column(dtype, num_rows, mask_state::ALL_NULL, stream, mr)};
+    } else {
+      // Placeholder only for the nested types, which can't be referenced by the filter
+      return {cudf::make_numeric_column(
+                data_type{type_id::BOOL8}, num_rows, rmm::device_buffer{}, 0, stream, mr),
+              cudf::make_numeric_column(
+                data_type{type_id::BOOL8}, num_rows, rmm::device_buffer{}, 0, stream, mr)};
+    }
+  }
+};
+
+}  // namespace
+
+std::optional<std::vector<std::vector<size_type>>> aggregate_orc_metadata::filter_stripes(
+  std::vector<std::vector<size_type>> const& stripes,
+  host_span<data_type const> output_dtypes,
+  host_span<size_type const> output_col_ids,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream) const
+{
+  auto const has_stats =
+    std::any_of(per_file_metadata.cbegin(), per_file_metadata.cend(), [](auto const& meta) {
+      return not meta.md.stripeStats.empty();
+    });
+  if (not has_stats) { return std::nullopt; }
+
+  // Stripes to filter in each source
+  std::vector<std::vector<size_type>> input_stripes;
+  if (stripes.empty()) {
+    std::transform(per_file_metadata.cbegin(),
+                   per_file_metadata.cend(),
+                   std::back_inserter(input_stripes),
+                   [](auto const& meta) {
+                     std::vector<size_type> stripe_idx(meta.ff.stripes.size());
+                     std::iota(stripe_idx.begin(), stripe_idx.end(), 0);
+                     return stripe_idx;
+                   });
+  } else {
+    CUDF_EXPECTS(stripes.size() == per_file_metadata.size(),
+                 "Must specify stripes for each source");
+    input_stripes = stripes;
+  }
+  auto const total_stripes = std::accumulate(
+    input_stripes.cbegin(), input_stripes.cend(), std::size_t{0}, [](auto sum, auto const& s) {
+      return sum + s.size();
+    });
+
+  // Converts the stripe statistics to a table
+  // where min(col[i]) = columns[i*2], max(col[i])=columns[i*2+1]
+  auto mr = rmm::mr::get_current_device_resource();
+  std::vector<std::unique_ptr<column>> columns;
+  for (std::size_t col_idx = 0; col_idx < output_dtypes.size(); ++col_idx) {
+    auto const orc_col_id = output_col_ids[col_idx];
+    // Missing statistics leave the default, empty `column_statistics`
+    std::vector<orc::column_statistics> col_stats(total_stripes);
+    std::size_t stats_idx = 0;
+    for (std::size_t src_idx = 0; src_idx < input_stripes.size(); ++src_idx) {
+      auto const& stripe_stats = per_file_metadata[src_idx].md.stripeStats;
+      for (auto const stripe_idx : input_stripes[src_idx]) {
+        if (static_cast<std::size_t>(stripe_idx) < stripe_stats.size() and
+            static_cast<std::size_t>(orc_col_id) < stripe_stats[stripe_idx].colStats.size()) {
+          auto const& blob = stripe_stats[stripe_idx].colStats[orc_col_id];
+          ProtobufReader(blob.data(), blob.size()).read(col_stats[stats_idx]);
+        }
+        stats_idx++;
+      }
+    }
+    auto [min_col, max_col] = cudf::type_dispatcher(
+      output_dtypes[col_idx], stats_caster{col_stats}, output_dtypes[col_idx], stream, mr);
+    columns.push_back(std::move(min_col));
+    columns.push_back(std::move(max_col));
+  }
+  auto const stats_table = cudf::table(std::move(columns));
+
+  auto const is_stripe_required = cudf::io::detail::rows_required_by_stats(
+    stats_table, filter.get(), static_cast<size_type>(output_dtypes.size()), stream, mr);
+
+  std::vector<std::vector<size_type>> filtered_stripes(input_stripes.size());
+  std::size_t stripe_pos = 0;
+  for (std::size_t src_idx = 0; src_idx < input_stripes.size(); ++src_idx) {
+    for (auto const stripe_idx : input_stripes[src_idx]) {
+      if (is_stripe_required[stripe_pos++]) { filtered_stripes[src_idx].push_back(stripe_idx); }
+    }
+  }
+  return filtered_stripes;
+}
+
+}  // namespace cudf::io::orc::detail
@@ -18,6 +18,17 @@
 #include "reader_impl_chunking.hpp"
 #include "reader_impl_helpers.hpp"
 
+#include "io/utilities/row_selection.hpp"
+
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <numeric>
+
 namespace cudf::io::orc::detail {
 
 reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
@@ -31,6 +42,7 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
     _use_np_dtypes{options.is_enabled_use_np_dtypes()},
     _decimal128_columns{options.get_decimal128_columns()},
     _col_meta{std::make_unique<reader_column_meta>()},
+    _filter{options.get_filter()},
     _sources(std::move(sources)),
     _metadata{_sources, stream},
     _selected_columns{_metadata.select_columns(options.get_columns())}
@@ -41,10 +53,217 @@ table_with_metadata reader::impl::read(int64_t skip_rows,
                                        std::optional<size_type> const& num_rows_opt,
                                        std::vector<std::vector<size_type>> const& stripes)
 {
-  prepare_data(skip_rows, num_rows_opt, stripes);
+  prepare_data(skip_rows, num_rows_opt, filter_stripes(skip_rows, num_rows_opt, stripes));
   return read_chunk_internal();
 }
 
+std::vector<std::vector<size_type>> reader::impl::filter_stripes(
+  int64_t skip_rows,
+  std::optional<size_type> const& num_rows_opt,
+  std::vector<std::vector<size_type>> const& stripes)
+{
+  if (not _filter.has_value() or skip_rows != 0 or num_rows_opt.has_value() or
+      _selected_columns.num_levels() == 0) {
+    return stripes;
+  }
+
+  std::vector<data_type> output_dtypes;
+  std::vector<size_type> output_col_ids;
+  for (auto const& col : _selected_columns.levels[0]) {
+    auto const col_type =
+      to_cudf_type(_metadata.get_col_type(col.id).kind,
+                   _use_np_dtypes,
+                   _timestamp_type.id(),
+                   to_cudf_decimal_type(_decimal128_columns, _metadata, col.id));
+    if (cudf::is_fixed_point(data_type{col_type})) {
+      // sign of the scale is changed since cuDF follows c++ libraries like CNL
+      auto const scale = static_cast<int32_t>(_metadata.get_col_type(col.id).scale.value_or(0));
+      output_dtypes.emplace_back(col_type, -scale);
+    } else {
+      output_dtypes.emplace_back(col_type);
+    }
+    output_col_ids.push_back(col.id);
+  }
+
+  auto filtered_stripes =
+    _metadata.filter_stripes(stripes, output_dtypes, output_col_ids, _filter.value(), _stream);
+  return filtered_stripes.has_value() ? std::move(filtered_stripes.value()) : stripes;
+}
+
+reader::impl::impl(std::size_t chunk_read_limit,
+                   std::size_t pass_read_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   orc_reader_options const& options,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+  : impl(std::move(sources), options, stream, mr)
+{
+  _chunk_read_limit = chunk_read_limit;
+  _pass_read_limit  = pass_read_limit;
+  auto const skip_rows = static_cast<int64_t>(options.get_skip_rows());
+  compute_chunks(skip_rows,
+                 options.get_num_rows(),
+                 filter_stripes(skip_rows, options.get_num_rows(), options.get_stripes()));
+}
+
+void reader::impl::compute_chunks(int64_t skip_rows,
+                                  std::optional<size_type> const& num_rows_opt,
+                                  std::vector<std::vector<size_type>> const& stripes)
+{
+  CUDF_EXPECTS((skip_rows == 0 and not num_rows_opt.has_value()) or stripes.empty(),
+               "Can't use both the row selection and the stripe selection");
+
+  auto const& per_file_metadata = _metadata.per_file_metadata;
+  auto const use_row_bounds     = skip_rows != 0 or num_rows_opt.has_value();
+
+  // Nested columns can't be read starting in the middle of the selected rows, so row bounds are
+  // only split for flat columns
+  if ((_chunk_read_limit == 0 and _pass_read_limit == 0) or _selected_columns.num_levels() == 0 or
+      (use_row_bounds and _selected_columns.num_levels() > 1)) {
+    _chunks.push_back({skip_rows, num_rows_opt, stripes});
+    return;
+  }
+
+  // Estimate of the decoded size of one row, from the fixed-width top level columns
+  std::size_t row_size = 0;
+  for (auto const& col : _selected_columns.levels[0]) {
+    auto const type = data_type{
+      to_cudf_type(_metadata.get_col_type(col.id).kind,
+                   _use_np_dtypes,
+                   _timestamp_type.id(),
+                   to_cudf_decimal_type(_decimal128_columns, _metadata, col.id))};
+    if (type.id() != type_id::EMPTY and is_fixed_width(type)) { row_size += size_of(type); }
+  }
+
+  struct stripe_to_read {
+    size_type source_idx;
+    size_type stripe_idx;
+    int64_t start_row;  // First row read from the stripe, counted over all sources
+    int64_t num_rows;   // Number of rows read from the stripe
+  };
+  std::vector<stripe_to_read> stripes_to_read;
+
+  if (use_row_bounds) {
+    auto const [rows_to_skip, rows_to_read] = cudf::io::detail::skip_rows_num_rows_from_options(
+      skip_rows, num_rows_opt, _metadata.get_num_rows());
+    auto const end_row = rows_to_skip + rows_to_read;
+
+    int64_t stripe_start_row = 0;
+    for (std::size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const& file_stripes = per_file_metadata[src_idx].ff.stripes;
+      for (std::size_t stripe_idx = 0; stripe_idx < file_stripes.size(); ++stripe_idx) {
+        auto const stripe_end_row =
+          stripe_start_row + static_cast<int64_t>(file_stripes[stripe_idx].numberOfRows);
+        auto const first_row = std::max(stripe_start_row, rows_to_skip);
+        auto const last_row  = std::min(stripe_end_row, end_row);
+        if (first_row < last_row) {
+          stripes_to_read.push_back({static_cast<size_type>(src_idx),
+                                     static_cast<size_type>(stripe_idx),
+                                     first_row,
+                                     last_row - first_row});
+        }
+        stripe_start_row = stripe_end_row;
+      }
+    }
+  } else {
+    for (std::size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const& file_stripes = per_file_metadata[src_idx].ff.stripes;
+      auto const add_stripe    = [&](size_type stripe_idx) {
+        CUDF_EXPECTS(stripe_idx >= 0 and static_cast<std::size_t>(stripe_idx) < file_stripes.size(),
+                     "Invalid stripe index");
+        stripes_to_read.push_back(
+          {static_cast<size_type>(src_idx),
+           stripe_idx,
+           0,
+           static_cast<int64_t>(file_stripes[stripe_idx].numberOfRows)});
+      };
+      if (stripes.empty()) {
+        for (std::size_t stripe_idx = 0; stripe_idx < file_stripes.size(); ++stripe_idx) {
+          add_stripe(static_cast<size_type>(stripe_idx));
+        }
+      } else {
+        CUDF_EXPECTS(stripes.size() == per_file_metadata.size(),
+                     "Must specify stripes for each source");
+        std::for_each(stripes[src_idx].cbegin(), stripes[src_idx].cend(), add_stripe);
+      }
+    }
+  }
+
+  if (stripes_to_read.empty()) {
+    _chunks.push_back({skip_rows, num_rows_opt, stripes});
+    return;
+  }
+
+  auto const add_chunk = [&](std::size_t begin, std::size_t end) {
+    if (use_row_bounds) {
+      auto const num_rows = std::accumulate(
+        stripes_to_read.begin() + begin,
+        stripes_to_read.begin() + end,
+        int64_t{0},
+        [](int64_t sum, auto const& stripe) { return sum + stripe.num_rows; });
+      _chunks.push_back(
+        {stripes_to_read[begin].start_row, static_cast<size_type>(num_rows), {}});
+    } else {
+      std::vector<std::vector<size_type>> chunk_stripes(per_file_metadata.size());
+      for (auto i = begin; i < end; ++i) {
+        chunk_stripes[stripes_to_read[i].source_idx].push_back(stripes_to_read[i].stripe_idx);
+      }
+      _chunks.push_back({0, std::nullopt, std::move(chunk_stripes)});
+    }
+  };
+
+  auto const exceeds_limit = [](std::size_t limit, std::size_t size) {
+    return limit > 0 and size > limit;
+  };
+
+  // Group consecutive stripes into chunks; each chunk has at least one stripe
+  std::size_t chunk_begin    = 0;
+  std::size_t chunk_out_size = 0;
+  std::size_t chunk_in_size  = 0;
+  for (std::size_t i = 0; i < stripes_to_read.size(); ++i) {
+    auto const& stripe_info = per_file_metadata[stripes_to_read[i].source_idx]
+                                .ff.stripes[stripes_to_read[i].stripe_idx];
+    // Stripe data stays encoded in device memory, and decodes to no less than the fixed-width
+    // size of its rows
+    auto const in_size  = stripe_info.indexLength + stripe_info.dataLength;
+    auto const out_size = std::max<std::size_t>(stripes_to_read[i].num_rows * row_size,
+                                                stripe_info.dataLength);
+    if (i > chunk_begin and (exceeds_limit(_chunk_read_limit, chunk_out_size + out_size) or
+                             exceeds_limit(_pass_read_limit, chunk_in_size + in_size))) {
+      add_chunk(chunk_begin, i);
+      chunk_begin    = i;
+      chunk_out_size = 0;
+      chunk_in_size  = 0;
+    }
+    chunk_out_size += out_size;
+    chunk_in_size += in_size;
+  }
+  add_chunk(chunk_begin, stripes_to_read.size());
+}
+
+bool reader::impl::has_next() const { return _next_chunk < _chunks.size(); }
+
+table_with_metadata reader::impl::read_chunk()
+{
+  // `prepare_data` expects the per-read state to start empty
+  *_col_meta = reader_column_meta{};
+  _out_buffers.clear();
+
+  if (has_next()) {
+    auto const& chunk = _chunks[_next_chunk++];
+    prepare_data(chunk.skip_rows, chunk.num_rows, chunk.stripes);
+  } else {
+    // All data has been read; select no stripes to output an empty table with the file schema
+    prepare_data(
+      0, std::nullopt, std::vector<std::vector<size_type>>(_metadata.per_file_metadata.size()));
+  }
+  auto result = read_chunk_internal();
+
+  // Release the stripe data of this chunk before the next one is loaded
+  _file_itm_data.reset();
+  return result;
+}
+
 table_metadata reader::impl::make_output_metadata()
 {
   if (_output_metadata) { return table_metadata{*_output_metadata}; }
@@ -112,9 +331,19 @@ table_with_metadata reader::impl::read_chunk_internal()
       return make_column(col_buffer, &out_metadata.schema_info.back(), std::nullopt, _stream);
     });
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  auto out_table = std::make_unique<table>(std::move(out_columns));
+  if (_filter.has_value()) {
+    auto const predicate = cudf::detail::compute_column(
+      *out_table, _filter.value().get(), _stream, rmm::mr::get_current_device_resource());
+    CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+                 "Predicate filter should return a boolean");
+    out_table = cudf::detail::apply_boolean_mask(*out_table, *predicate, _stream, _mr);
+  }
+  return {std::move(out_table), std::move(out_metadata)};
 }
 
+reader::reader() = default;
+
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                orc_reader_options const& options,
@@ -133,4 +362,21 @@ table_with_metadata reader::read(orc_reader_options const& options)
   return _impl->read(options.get_skip_rows(), options.get_num_rows(), options.get_stripes());
 }
 
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::size_t pass_read_limit,
+                               std::vector<std::unique_ptr<datasource>>&& sources,
+                               orc_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  _impl = std::make_unique<impl>(
+    chunk_read_limit, pass_read_limit, std::move(sources), options, stream, mr);
+}
+
+chunked_reader::~chunked_reader() = default;
+
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(); }
+
 }  // namespace cudf::io::orc::detail
@@ -25,6 +25,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -33,6 +34,7 @@ namespace cudf::io::orc::detail {
 
 struct reader_column_meta;
 struct file_intermediate_data;
+struct chunk_read_info;
 
 /**
  * @brief Implementation for ORC reader.
@@ -52,6 +54,25 @@ class reader::impl {
                 rmm::cuda_stream_view stream,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor from size limits, a dataset source and reader options.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param pass_read_limit Limit on total amount of stripe data loaded per read,
+   *        or `0` if there is no limit
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::size_t pass_read_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                orc_reader_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -64,7 +85,48 @@ class reader::impl {
                            std::optional<size_type> const& num_rows_opt,
                            std::vector<std::vector<size_type>> const& stripes);
 
+  /**
+   * @copydoc cudf::io::chunked_orc_reader::has_next
+   */
+  bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_orc_reader::read_chunk
+   */
+  table_with_metadata read_chunk();
+
  private:
+  /**
+   * @brief Split the data selected by the reader options into chunks that fit the size limits.
+   *
+   * Chunks are made of whole stripes. Stripes are added to a chunk until either its estimated
+   * output size exceeds `_chunk_read_limit` or its stripe data size exceeds `_pass_read_limit`.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows_opt Optional number of rows to read, or `std::nullopt` to read all rows
+   * @param stripes Indices of individual stripes to load if non-empty
+   */
+  void compute_chunks(int64_t skip_rows,
+                      std::optional<size_type> const& num_rows_opt,
+                      std::vector<std::vector<size_type>> const& stripes);
+
+  /**
+   * @brief Select the stripes that may contain rows satisfying the filter, based on the stripe
+   * statistics.
+   *
+   * Stripes are not pruned when reading a custom range of rows, since the row bounds are relative
+   * to all stripes.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows_opt Optional number of rows to read, or `std::nullopt` to read all rows
+   * @param stripes Indices of individual stripes to load if non-empty
+   * @return Indices of the stripes to read from each source; `stripes` if nothing is pruned
+   */
+  std::vector<std::vector<size_type>> filter_stripes(
+    int64_t skip_rows,
+    std::optional<size_type> const& num_rows_opt,
+    std::vector<std::vector<size_type>> const& stripes);
+
   /**
    * @brief Perform all the necessary data preprocessing before creating an output table.
    *
@@ -102,6 +164,9 @@ class reader::impl {
   std::vector<std::string> const _decimal128_columns;   // Control decimals conversion
   std::unique_ptr<reader_column_meta> const _col_meta;  // Track of orc mapping and child details
 
+  // Predicate filter to prune stripes with and to apply to the output rows
+  std::optional<std::reference_wrapper<ast::expression const>> const _filter;
+
   // Intermediate data for internal processing.
   std::vector<std::unique_ptr<datasource>> const _sources;  // Unused but owns data for `_metadata`
   aggregate_orc_metadata _metadata;
@@ -109,6 +174,12 @@ class reader::impl {
   std::unique_ptr<file_intermediate_data> _file_itm_data;
   std::unique_ptr<table_metadata> _output_metadata;
   std::vector<std::vector<cudf::io::detail::column_buffer>> _out_buffers;
+
+  // Chunked reading state
+  std::size_t _chunk_read_limit{0};      // Output size limit of each chunk, or `0` if no limit
+  std::size_t _pass_read_limit{0};       // Stripe data size limit of each chunk, or `0` if no limit
+  std::vector<chunk_read_info> _chunks;  // Data to read for each chunk
+  std::size_t _next_chunk{0};            // Index of the next chunk to read
 };
 
 }  // namespace cudf::io::orc::detail
@@ -24,6 +24,9 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <optional>
+#include <vector>
+
 namespace cudf::io::orc::detail {
 
 /**
@@ -38,4 +41,16 @@ struct file_intermediate_data {
   std::vector<metadata::stripe_source_mapping> selected_stripes;
 };
 
+/**
+ * @brief Struct to describe the data read by one call to the chunked reader's `read_chunk()`.
+ *
+ * A chunk is either a range of rows aligned to stripe boundaries, or a list of stripes to read
+ * from each source, matching how the user selected the data to read.
+ */
+struct chunk_read_info {
+  int64_t skip_rows{0};                         // Number of rows to skip from the start
+  std::optional<size_type> num_rows;            // Number of rows to read, if reading by rows
+  std::vector<std::vector<size_type>> stripes;  // Stripes to read from each source, if non-empty
+};
+
 }  // namespace cudf::io::orc::detail
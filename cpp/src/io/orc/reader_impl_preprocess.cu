@@ -293,30 +293,30 @@ rmm::device_buffer decompress_stripe_data(
         }
         break;
       case compression_type::ZSTD:
-        if (auto const reason = nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD);
-            reason) {
-          CUDF_FAIL("Decompression error: " + reason.value());
+        if (nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD)) {
+          gpu_unzstd(inflate_in_view, inflate_out_view, inflate_res, stream);
+        } else {
+          nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
+                                     inflate_in_view,
+                                     inflate_out_view,
+                                     inflate_res,
+                                     max_uncomp_block_size,
+                                     total_decomp_size,
+                                     stream);
         }
-        nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
-                                   inflate_in_view,
-                                   inflate_out_view,
-                                   inflate_res,
-                                   max_uncomp_block_size,
-                                   total_decomp_size,
-                                   stream);
         break;
       case compression_type::LZ4:
-        if (auto const reason = nvcomp::is_decompression_disabled(nvcomp::compression_type::LZ4);
-            reason) {
-          CUDF_FAIL("Decompression error: " + reason.value());
+        if (nvcomp::is_decompression_disabled(nvcomp::compression_type::LZ4)) {
+          gpu_unlz4(inflate_in_view, inflate_out_view, inflate_res, stream);
+        } else {
+          nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                     inflate_in_view,
+                                     inflate_out_view,
+                                     inflate_res,
+                                     max_uncomp_block_size,
+                                     total_decomp_size,
+                                     stream);
         }
-        nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
-                                   inflate_in_view,
-                                   inflate_out_view,
-                                   inflate_res,
-                                   max_uncomp_block_size,
-                                   total_decomp_size,
-                                   stream);
         break;
       default: CUDF_FAIL("Unexpected decompression dispatch"); break;
     }
@@ -744,10 +744,15 @@ void reader::impl::prepare_data(int64_t skip_rows,
         });
       });
 
-    return has_timestamp_column
-             ? cudf::detail::make_timezone_transition_table(
-                 {}, selected_stripes[0].stripe_info[0].second->writerTimezone, _stream)
-             : std::make_unique<cudf::table>();
+    if (not has_timestamp_column) { return std::make_unique<cudf::table>(); }
+
+    // Some sources may have no stripes selected, so use the first source that has any
+    auto const first_mapping = std::find_if(
+      selected_stripes.cbegin(), selected_stripes.cend(), [](auto const& mapping) {
+        return not mapping.stripe_info.empty();
+      });
+    return cudf::detail::make_timezone_transition_table(
+      {}, first_mapping->stripe_info[0].second->writerTimezone, _stream);
   }();
 
   auto& lvl_stripe_data        = _file_itm_data->lvl_stripe_data;
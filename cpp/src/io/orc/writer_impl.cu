@@ -27,6 +27,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/logger.hpp>
 #include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
@@ -60,6 +61,7 @@
 #include <thrust/transform.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <numeric>
 #include <tuple>
@@ -547,11 +549,13 @@ auto comp_block_alignment(CompressionKind compression_kind)
  * @param[in,out] columns List of columns
  * @param[in] segmentation stripe and rowgroup ranges
  * @param[in] decimal_column_sizes Sizes of encoded decimal columns
+ * @param[in] bloom_filter_col_indexes Indexes of the columns with Bloom filters
  * @return List of stream descriptors
  */
 orc_streams create_streams(host_span<orc_column_view> columns,
                            file_segmentation const& segmentation,
                            std::map<uint32_t, size_t> const& decimal_column_sizes,
+                           host_span<uint32_t const> bloom_filter_col_indexes,
                            bool enable_dictionary,
                            CompressionKind compression_kind,
                            single_write_mode write_mode)
@@ -559,10 +563,15 @@ orc_streams create_streams(host_span<orc_column_view> columns,
   // 'column 0' row index stream
   std::vector<Stream> streams{{ROW_INDEX, 0}};  // TODO: Separate index and data streams?
   // First n + 1 streams are row index streams
-  streams.reserve(columns.size() + 1);
+  streams.reserve(columns.size() + 1 + bloom_filter_col_indexes.size());
   std::transform(columns.begin(), columns.end(), std::back_inserter(streams), [](auto const& col) {
     return Stream{ROW_INDEX, col.id()};
   });
+  // Followed by the Bloom filter streams, which are also part of the stripe index
+  std::transform(bloom_filter_col_indexes.begin(),
+                 bloom_filter_col_indexes.end(),
+                 std::back_inserter(streams),
+                 [&](auto col_idx) { return Stream{BLOOM_FILTER_UTF8, columns[col_idx].id()}; });
 
   std::vector<int32_t> ids(columns.size() * gpu::CI_NUM_STREAMS, -1);
   std::vector<TypeKind> types(streams.size(), INVALID_TYPE_KIND);
@@ -1439,6 +1448,7 @@ encoded_footer_statistics finish_statistic_blobs(Footer const& footer,
  *
  * @param[in] stripe_id Stripe's identifier
  * @param[in] stream_id Stream identifier (column id + 1)
+ * @param[in] num_index_streams Total number of index streams
  * @param[in] columns List of columns
  * @param[in] segmentation stripe and rowgroup ranges
  * @param[in] enc_streams List of encoder chunk streams [column][rowgroup]
@@ -1453,6 +1463,7 @@ encoded_footer_statistics finish_statistic_blobs(Footer const& footer,
  */
 void write_index_stream(int32_t stripe_id,
                         int32_t stream_id,
+                        size_t num_index_streams,
                         host_span<orc_column_view const> columns,
                         file_segmentation const& segmentation,
                         host_2dspan<gpu::encoder_chunk_streams const> enc_streams,
@@ -1476,7 +1487,7 @@ void write_index_stream(int32_t stripe_id,
     if (stream.ids[type] > 0) {
       record.pos = 0;
       if (compression_kind != NONE) {
-        auto const& ss   = strm_desc[stripe_id][stream.ids[type] - (columns.size() + 1)];
+        auto const& ss   = strm_desc[stripe_id][stream.ids[type] - num_index_streams];
         record.blk_pos   = ss.first_block;
         record.comp_pos  = 0;
         record.comp_size = ss.stream_size;
@@ -1628,6 +1639,52 @@ void add_uncompressed_block_headers(CompressionKind compression_kind,
   }
 }
 
+/**
+ * @brief Write the specified column's Bloom filter stream
+ *
+ * @param[in] stripe_id Stripe's identifier
+ * @param[in] stream_id Stream identifier
+ * @param[in] bf_col_idx Index of the column among the Bloom filter columns
+ * @param[in] segmentation stripe and rowgroup ranges
+ * @param[in] bloom_filters Bloom filters of each rowgroup
+ * @param[in,out] stripe Stream's parent stripe
+ * @param[in,out] streams List of all streams
+ * @param[in] compression_kind The compression kind
+ * @param[in] compression_blocksize The block size used for compression
+ * @param[in] out_sink Sink for writing data
+ */
+void write_bloom_filter_stream(int32_t stripe_id,
+                               int32_t stream_id,
+                               size_t bf_col_idx,
+                               file_segmentation const& segmentation,
+                               encoded_bloom_filters const& bloom_filters,
+                               StripeInformation* stripe,
+                               orc_streams* streams,
+                               CompressionKind compression_kind,
+                               size_t compression_blocksize,
+                               std::unique_ptr<data_sink> const& out_sink)
+{
+  BloomFilterIndex bf_index;
+  auto const& rowgroups_range = segmentation.stripes[stripe_id];
+  std::transform(
+    rowgroups_range.cbegin(),
+    rowgroups_range.cend(),
+    std::back_inserter(bf_index.bloomFilter),
+    [&](auto rowgroup) {
+      auto const bitset =
+        bloom_filters.bitsets[bf_col_idx * segmentation.num_rowgroups() + rowgroup];
+      auto const bytes = reinterpret_cast<uint8_t const*>(bitset.data());
+      return BloomFilter{bloom_filters.num_hash_functions, {bytes, bytes + bitset.size_bytes()}};
+    });
+
+  ProtobufWriter pbw((compression_kind != NONE) ? 3 : 0);
+  pbw.write(bf_index);
+  add_uncompressed_block_headers(compression_kind, compression_blocksize, pbw.buffer());
+  (*streams)[stream_id].length = pbw.size();
+  out_sink->host_write(pbw.data(), pbw.size());
+  stripe->indexLength += pbw.size();
+}
+
 void pushdown_lists_null_mask(orc_column_view const& col,
                               device_span<orc_column_device_view> d_columns,
                               bitmask_type const* parent_pd_mask,
@@ -2089,24 +2146,28 @@ struct string_rows_less {
   }
 };
 
+/**
+ * @brief Returns whether the dictionary encoding of strings is smaller than their direct encoding.
+ *
+ * The estimate excludes the LENGTH stream size, which is present in both cases.
+ */
+bool is_dictionary_smaller(gpu::stripe_dictionary const& sd, size_type direct_char_count)
+{
+  auto const dict_index_size = varint_size(sd.entry_count);
+  return sd.char_count + dict_index_size * sd.entry_count < direct_char_count;
+}
+
 // Build stripe dictionaries for string columns
 stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
                                        file_segmentation const& segmentation,
                                        bool sort_dictionaries,
                                        rmm::cuda_stream_view stream)
 {
-  std::vector<std::vector<rmm::device_uvector<gpu::slot_type>>> hash_maps_storage(
-    orc_table.string_column_indices.size());
-  for (auto col_idx : orc_table.string_column_indices) {
-    auto& str_column = orc_table.column(col_idx);
-    for (auto const& stripe : segmentation.stripes) {
-      auto const stripe_num_rows =
-        stripe.size == 0 ? 0
-                         : segmentation.rowgroups[stripe.first + stripe.size - 1][col_idx].end -
-                             segmentation.rowgroups[stripe.first][col_idx].begin;
-      hash_maps_storage[str_column.str_index()].emplace_back(stripe_num_rows * 1.43, stream);
-    }
-  }
+  auto const stripe_num_rows = [&](auto const& stripe, auto col_idx) -> size_type {
+    return stripe.size == 0 ? 0
+                            : segmentation.rowgroups[stripe.first + stripe.size - 1][col_idx].end -
+                                segmentation.rowgroups[stripe.first][col_idx].begin;
+  };
 
   hostdevice_2dvector<gpu::stripe_dictionary> stripe_dicts(
     orc_table.num_string_columns(), segmentation.num_stripes(), stream);
@@ -2122,13 +2183,63 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
       auto const stripe_idx = stripe.id;
       auto& sd              = stripe_dicts[str_col_idx][stripe_idx];
 
-      sd.map_slots      = hash_maps_storage[str_col_idx][stripe_idx];
       sd.column_idx     = col_idx;
       sd.start_row      = segmentation.rowgroups[stripe.first][col_idx].begin;
       sd.start_rowgroup = stripe.first;
-      sd.num_rows =
-        segmentation.rowgroups[stripe.first + stripe.size - 1][col_idx].end - sd.start_row;
+      sd.num_rows       = stripe_num_rows(stripe, col_idx);
+    }
+  }
 
+  // Detect high-cardinality stripes early by building the dictionary of their first rowgroup; a
+  // stripe whose first rowgroup does not benefit from dictionary encoding is not dictionary
+  // encoded and its hash map is never allocated. A sample of a single rowgroup stripe would be
+  // the whole stripe, so these stripes are not sampled
+  auto const is_sampled = [](auto const& stripe) { return stripe.size > 1; };
+  std::vector<std::vector<bool>> use_dictionary(
+    orc_table.num_string_columns(), std::vector<bool>(segmentation.num_stripes(), true));
+  if (std::any_of(segmentation.stripes.begin(), segmentation.stripes.end(), is_sampled)) {
+    std::vector<rmm::device_uvector<gpu::slot_type>> sample_maps_storage;
+    for (auto col_idx : orc_table.string_column_indices) {
+      auto const str_col_idx = orc_table.column(col_idx).str_index();
+      for (auto const& stripe : segmentation.stripes) {
+        auto& sd = stripe_dicts[str_col_idx][stripe.id];
+
+        sd.num_rows = is_sampled(stripe) ? segmentation.rowgroups[stripe.first][col_idx].size() : 0;
+        sample_maps_storage.emplace_back(sd.num_rows * 1.43, stream);
+        sd.map_slots = sample_maps_storage.back();
+      }
+    }
+    stripe_dicts.host_to_device_async(stream);
+
+    gpu::initialize_dictionary_hash_maps(stripe_dicts, stream);
+    gpu::populate_dictionary_hash_maps(stripe_dicts, orc_table.d_columns, stream);
+    stripe_dicts.device_to_host_sync(stream);
+
+    for (auto col_idx : orc_table.string_column_indices) {
+      auto const& str_column = orc_table.column(col_idx);
+      auto const str_col_idx = str_column.str_index();
+      for (auto const& stripe : segmentation.stripes) {
+        auto& sd = stripe_dicts[str_col_idx][stripe.id];
+        if (is_sampled(stripe)) {
+          use_dictionary[str_col_idx][stripe.id] =
+            is_dictionary_smaller(sd, str_column.rowgroup_char_count(stripe.first));
+        }
+        sd.num_rows = stripe_num_rows(stripe, col_idx);
+      }
+    }
+  }
+
+  // Allocate the hash maps of the stripes that may use dictionary encoding
+  std::vector<std::vector<rmm::device_uvector<gpu::slot_type>>> hash_maps_storage(
+    orc_table.string_column_indices.size());
+  for (auto col_idx : orc_table.string_column_indices) {
+    auto const str_col_idx = orc_table.column(col_idx).str_index();
+    for (auto const& stripe : segmentation.stripes) {
+      auto& sd             = stripe_dicts[str_col_idx][stripe.id];
+      auto const num_slots = use_dictionary[str_col_idx][stripe.id] ? sd.num_rows * 1.43 : 0;
+      hash_maps_storage[str_col_idx].emplace_back(num_slots, stream);
+
+      sd.map_slots   = hash_maps_storage[str_col_idx].back();
       sd.entry_count = 0;
       sd.char_count  = 0;
     }
@@ -2158,11 +2269,8 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
         0,
         [&](auto total, auto const& rg) { return total + str_column.rowgroup_char_count(rg); });
       // Enable dictionary encoding if the dictionary size is smaller than the direct encode size
-      // The estimate excludes the LENGTH stream size, which is present in both cases
-      sd.is_enabled = [&]() {
-        auto const dict_index_size = varint_size(sd.entry_count);
-        return sd.char_count + dict_index_size * sd.entry_count < direct_char_count;
-      }();
+      sd.is_enabled =
+        use_dictionary[str_col_idx][stripe_idx] and is_dictionary_smaller(sd, direct_char_count);
       if (sd.is_enabled) {
         dict_data_owner.emplace_back(sd.entry_count, stream);
         sd.data            = dict_data_owner.back();
@@ -2244,6 +2352,96 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
           std::move(dict_order_owner)};
 }
 
+/**
+ * @brief Selects the columns to write Bloom filters for.
+ *
+ * Columns are matched by their full path, with the names of the levels separated by '.'. Columns
+ * whose type does not support Bloom filters are skipped.
+ *
+ * @param orc_table Non-owning view of a cuDF table that includes ORC-related information
+ * @param column_names Names of the Bloom filter columns
+ * @return Indexes of the Bloom filter columns in the table
+ */
+std::vector<uint32_t> bloom_filter_column_indexes(orc_table_view const& orc_table,
+                                                  host_span<std::string const> column_names)
+{
+  if (column_names.empty()) { return {}; }
+
+  // Columns are in pre-order, so parent paths are always computed first
+  std::vector<std::string> paths(orc_table.num_columns());
+  std::vector<uint32_t> col_indexes;
+  for (auto const& col : orc_table.columns) {
+    paths[col.index()] = col.is_child() ? paths[col.parent_index()] + "." + col.orc_name()
+                                        : std::string{col.orc_name()};
+    if (std::find(column_names.begin(), column_names.end(), paths[col.index()]) ==
+        column_names.end()) {
+      continue;
+    }
+    switch (col.orc_kind()) {
+      case TypeKind::BOOLEAN:
+      case TypeKind::BYTE:
+      case TypeKind::SHORT:
+      case TypeKind::INT:
+      case TypeKind::LONG:
+      case TypeKind::DATE:
+      case TypeKind::FLOAT:
+      case TypeKind::DOUBLE:
+      case TypeKind::STRING: col_indexes.push_back(col.index()); break;
+      default:
+        CUDF_LOG_WARN("ORC writer: Bloom filters are not supported for column '{}', ignoring",
+                      paths[col.index()]);
+    }
+  }
+  return col_indexes;
+}
+
+/**
+ * @brief Computes the Bloom filters of each rowgroup of the selected columns.
+ *
+ * The filters are sized for `row_index_stride` values, the same as in the ORC Java library.
+ *
+ * @param orc_table Non-owning view of a cuDF table that includes ORC-related information
+ * @param segmentation stripe and rowgroup ranges
+ * @param col_indexes Indexes of the Bloom filter columns
+ * @param row_index_stride Maximum number of rows in each rowgroup
+ * @param fpp False positive probability of the filters
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The Bloom filters, copied to the host
+ */
+encoded_bloom_filters build_bloom_filters(orc_table_view const& orc_table,
+                                          file_segmentation const& segmentation,
+                                          std::vector<uint32_t>&& col_indexes,
+                                          size_type row_index_stride,
+                                          double fpp,
+                                          rmm::cuda_stream_view stream)
+{
+  if (col_indexes.empty()) { return {}; }
+
+  auto const ln2       = std::log(2.0);
+  auto const num_bits  = static_cast<int64_t>(-row_index_stride * std::log(fpp) / (ln2 * ln2));
+  auto const num_words = static_cast<size_t>(num_bits / 64 + 1);
+
+  auto const num_hash_functions = std::max<uint32_t>(
+    1, std::lround(static_cast<double>(num_words * 64) / row_index_stride * ln2));
+
+  hostdevice_2dvector<uint64_t> bitsets(
+    col_indexes.size() * segmentation.num_rowgroups(), num_words, stream);
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(bitsets.base_device_ptr(), 0, bitsets.size_bytes(), stream.value()));
+
+  auto const d_col_indexes = cudf::detail::make_device_uvector_async(
+    col_indexes, stream, rmm::mr::get_current_device_resource());
+  gpu::populate_bloom_filters(bitsets,
+                              orc_table.d_columns,
+                              segmentation.rowgroups,
+                              d_col_indexes,
+                              num_hash_functions,
+                              stream);
+  bitsets.device_to_host_sync(stream);
+
+  return {std::move(col_indexes), std::move(bitsets), num_hash_functions};
+}
+
 /**
  * @brief Perform the processing steps needed to convert the input table into the output ORC data
  * for writing, such as compression and ORC encoding.
@@ -2258,6 +2456,8 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
  * @param compression_blocksize The block size used for compression
  * @param stats_freq Column statistics granularity type for parquet/orc writers
  * @param collect_compression_stats Flag to indicate if compression statistics should be collected
+ * @param bloom_filter_columns Names of the columns to write Bloom filters for
+ * @param bloom_filter_fpp False positive probability of the Bloom filters
  * @param write_mode Flag to indicate if there is only a single table write
  * @param out_sink Sink for writing data
  * @param stream CUDA stream used for device memory operations and kernel launches
@@ -2273,6 +2473,8 @@ auto convert_table_to_orc_data(table_view const& input,
                                size_t compression_blocksize,
                                statistics_freq stats_freq,
                                bool collect_compression_stats,
+                               host_span<std::string const> bloom_filter_columns,
+                               double bloom_filter_fpp,
                                single_write_mode write_mode,
                                data_sink const& out_sink,
                                rmm::cuda_stream_view stream)
@@ -2295,6 +2497,13 @@ auto convert_table_to_orc_data(table_view const& input,
 
   auto stripe_dicts    = build_dictionaries(orc_table, segmentation, sort_dictionaries, stream);
   auto dec_chunk_sizes = decimal_chunk_sizes(orc_table, segmentation, stream);
+  auto bf_col_indexes  = bloom_filter_column_indexes(orc_table, bloom_filter_columns);
+  auto bloom_filters   = build_bloom_filters(orc_table,
+                                           segmentation,
+                                           std::move(bf_col_indexes),
+                                           row_index_stride,
+                                           bloom_filter_fpp,
+                                           stream);
 
   auto const uncompressed_block_align = uncomp_block_alignment(compression_kind);
   auto const compressed_block_align   = comp_block_alignment(compression_kind);
@@ -2302,6 +2511,7 @@ auto convert_table_to_orc_data(table_view const& input,
   auto streams  = create_streams(orc_table.columns,
                                 segmentation,
                                 decimal_column_sizes(dec_chunk_sizes.rg_sizes),
+                                bloom_filters.column_indices,
                                 enable_dictionary,
                                 compression_kind,
                                 write_mode);
@@ -2313,8 +2523,9 @@ auto convert_table_to_orc_data(table_view const& input,
   auto const num_rows = input.num_rows();
 
   // Assemble individual disparate column chunks into contiguous data streams
-  size_type const num_index_streams = (orc_table.num_columns() + 1);
-  auto const num_data_streams       = streams.size() - num_index_streams;
+  size_type const num_index_streams =
+    orc_table.num_columns() + 1 + bloom_filters.column_indices.size();
+  auto const num_data_streams = streams.size() - num_index_streams;
   hostdevice_2dvector<gpu::StripeStream> strm_descs(
     segmentation.num_stripes(), num_data_streams, stream);
   auto stripes = gather_stripes(num_index_streams, segmentation, &enc_data, &strm_descs, stream);
@@ -2327,6 +2538,7 @@ auto convert_table_to_orc_data(table_view const& input,
                       cudf::detail::hostdevice_vector<compression_result>{},  // comp_results
                       std::move(strm_descs),
                       intermediate_statistics{orc_table, stream},
+                      std::move(bloom_filters),
                       std::optional<writer_compression_statistics>{},
                       std::move(streams),
                       std::move(stripes),
@@ -2410,6 +2622,7 @@ auto convert_table_to_orc_data(table_view const& input,
                     std::move(comp_results),
                     std::move(strm_descs),
                     std::move(intermediate_stats),
+                    std::move(bloom_filters),
                     std::move(compression_stats),
                     std::move(streams),
                     std::move(stripes),
@@ -2433,6 +2646,8 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     _sort_dictionaries{options.get_enable_dictionary_sort()},
     _single_write_mode(mode),
     _kv_meta(options.get_key_value_metadata()),
+    _bloom_filter_columns(options.get_bloom_filter_columns()),
+    _bloom_filter_fpp(options.get_bloom_filter_fpp()),
     _out_sink(std::move(sink))
 {
   if (options.get_metadata()) {
@@ -2455,6 +2670,8 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     _sort_dictionaries{options.get_enable_dictionary_sort()},
     _single_write_mode(mode),
     _kv_meta(options.get_key_value_metadata()),
+    _bloom_filter_columns(options.get_bloom_filter_columns()),
+    _bloom_filter_fpp(options.get_bloom_filter_fpp()),
     _out_sink(std::move(sink))
 {
   if (options.get_metadata()) {
@@ -2489,6 +2706,7 @@ void writer::impl::write(table_view const& input)
                          comp_results,
                          strm_descs,
                          intermediate_stats,
+                         bloom_filters,
                          compression_stats,
                          streams,
                          stripes,
@@ -2505,6 +2723,8 @@ void writer::impl::write(table_view const& input)
                                        _compression_blocksize,
                                        _stats_freq,
                                        _compression_statistics != nullptr,
+                                       _bloom_filter_columns,
+                                       _bloom_filter_fpp,
                                        _single_write_mode,
                                        *_out_sink,
                                        _stream);
@@ -2524,6 +2744,7 @@ void writer::impl::write(table_view const& input)
                          comp_results,
                          strm_descs,
                          intermediate_stats.rowgroup_blobs,
+                         bloom_filters,
                          streams,
                          stripes,
                          bounce_buffer);
@@ -2555,6 +2776,7 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
                                           host_span<compression_result const> comp_results,
                                           host_2dspan<gpu::StripeStream const> strm_descs,
                                           host_span<ColStatsBlob const> rg_stats,
+                                          encoded_bloom_filters const& bloom_filters,
                                           orc_streams& streams,
                                           host_span<StripeInformation> stripes,
                                           host_span<uint8_t> bounce_buffer)
@@ -2569,10 +2791,13 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
     stripe.offset = _out_sink->bytes_written();
 
     // Column (skippable) index streams appear at the start of the stripe
-    size_type const num_index_streams = (orc_table.num_columns() + 1);
-    for (size_type stream_id = 0; stream_id < num_index_streams; ++stream_id) {
+    size_type const num_row_index_streams = (orc_table.num_columns() + 1);
+    size_type const num_index_streams =
+      num_row_index_streams + bloom_filters.column_indices.size();
+    for (size_type stream_id = 0; stream_id < num_row_index_streams; ++stream_id) {
       write_index_stream(stripe_id,
                          stream_id,
+                         num_index_streams,
                          orc_table.columns,
                          segmentation,
                          enc_data.streams,
@@ -2585,6 +2810,18 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
                          _compression_blocksize,
                          _out_sink);
     }
+    for (size_type stream_id = num_row_index_streams; stream_id < num_index_streams; ++stream_id) {
+      write_bloom_filter_stream(stripe_id,
+                                stream_id,
+                                stream_id - num_row_index_streams,
+                                segmentation,
+                                bloom_filters,
+                                &stripe,
+                                &streams,
+                                _compression_kind,
+                                _compression_blocksize,
+                                _out_sink);
+    }
 
     // Column data consisting one or more separate streams
     for (auto const& strm_desc : strm_descs[stripe_id]) {
@@ -139,6 +139,15 @@ struct encoded_data {
   hostdevice_2dvector<gpu::encoder_chunk_streams> streams;  // streams of encoded data, per chunk
 };
 
+/**
+ * @brief ORC Bloom filters of each rowgroup, for a subset of the columns.
+ */
+struct encoded_bloom_filters {
+  std::vector<uint32_t> column_indices;   // Indices of the Bloom filter columns in the table
+  hostdevice_2dvector<uint64_t> bitsets;  // Bitsets [column * num_rowgroups + rowgroup][word]
+  uint32_t num_hash_functions = 0;        // Number of bits set for each value
+};
+
 /**
  * @brief Dictionary data for string columns and their device views, per column.
  */
@@ -302,6 +311,7 @@ class writer::impl {
    * @param[in] comp_results Status of data compression
    * @param[in] strm_descs List of stream descriptors
    * @param[in] rg_stats row group level statistics
+   * @param[in] bloom_filters Bloom filters of each rowgroup
    * @param[in,out] streams List of stream descriptors
    * @param[in,out] stripes List of stripe description
    * @param[out] bounce_buffer Temporary host output buffer
@@ -313,6 +323,7 @@ class writer::impl {
                               host_span<compression_result const> comp_results,
                               host_2dspan<gpu::StripeStream const> strm_descs,
                               host_span<ColStatsBlob const> rg_stats,
+                              encoded_bloom_filters const& bloom_filters,
                               orc_streams& streams,
                               host_span<StripeInformation> stripes,
                               host_span<uint8_t> bounce_buffer);
@@ -353,6 +364,8 @@ class writer::impl {
                                                // indicate that we are guaranteeing a single table
                                                // write. This enables some internal optimizations.
   std::map<std::string, std::string> const _kv_meta;  // Optional user metadata.
+  std::vector<std::string> const _bloom_filter_columns;
+  double const _bloom_filter_fpp;
   std::unique_ptr<data_sink> const _out_sink;
 
   // Debug parameter---currently not yet supported to be user-specified.
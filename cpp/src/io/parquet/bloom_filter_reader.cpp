@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "compact_protocol_reader.hpp"
+#include "reader_impl_helpers.hpp"
+
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+
+namespace cudf::io::parquet::detail {
+
+namespace {
+
+/**
+ * @brief Upper bound on the size of a serialized `BloomFilterHeader`, used when the column
+ * chunk metadata does not record the total Bloom filter length.
+ */
+constexpr size_t bloom_filter_header_size_guess = 256;
+
+// A split-block Bloom filter is made of 256-bit blocks of eight 32-bit words
+constexpr int split_block_words = 8;
+constexpr int split_block_bytes = split_block_words * sizeof(uint32_t);
+
+/**
+ * @brief Host implementation of xxHash64 (seed 0), as required by the Parquet specification for
+ * split-block Bloom filters.
+ */
+class xxhash_64 {
+ public:
+  [[nodiscard]] uint64_t operator()(host_span<uint8_t const> in) const
+  {
+    size_t offset = 0;
+    uint64_t h64;
+    if (in.size() >= 32) {
+      uint64_t v1 = prime1 + prime2;
+      uint64_t v2 = prime2;
+      uint64_t v3 = 0;
+      uint64_t v4 = -prime1;
+      for (; offset + 32 <= in.size(); offset += 32) {
+        v1 = round(v1, getblock64(in, offset));
+        v2 = round(v2, getblock64(in, offset + 8));
+        v3 = round(v3, getblock64(in, offset + 16));
+        v4 = round(v4, getblock64(in, offset + 24));
+      }
+      h64 = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+      h64 = merge_round(h64, v1);
+      h64 = merge_round(h64, v2);
+      h64 = merge_round(h64, v3);
+      h64 = merge_round(h64, v4);
+    } else {
+      h64 = prime5;
+    }
+
+    h64 += in.size();
+
+    for (; offset + 8 <= in.size(); offset += 8) {
+      h64 ^= round(0, getblock64(in, offset));
+      h64 = rotl(h64, 27) * prime1 + prime4;
+    }
+    for (; offset + 4 <= in.size(); offset += 4) {
+      h64 ^= static_cast<uint64_t>(getblock32(in, offset)) * prime1;
+      h64 = rotl(h64, 23) * prime2 + prime3;
+    }
+    for (; offset < in.size(); ++offset) {
+      h64 ^= in[offset] * prime5;
+      h64 = rotl(h64, 11) * prime1;
+    }
+
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+  }
+
+ private:
+  static constexpr uint64_t prime1 = 0x9e3779b185ebca87ul;
+  static constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4ful;
+  static constexpr uint64_t prime3 = 0x165667b19e3779f9ul;
+  static constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ul;
+  static constexpr uint64_t prime5 = 0x27d4eb2f165667c5ul;
+
+  static uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+  static uint32_t getblock32(host_span<uint8_t const> in, size_t offset)
+  {
+    uint32_t v;
+    std::memcpy(&v, in.data() + offset, sizeof(v));
+    return v;
+  }
+
+  static uint64_t getblock64(host_span<uint8_t const> in, size_t offset)
+  {
+    uint64_t v;
+    std::memcpy(&v, in.data() + offset, sizeof(v));
+    return v;
+  }
+
+  static uint64_t round(uint64_t acc, uint64_t input)
+  {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+  }
+
+  static uint64_t merge_round(uint64_t acc, uint64_t val)
+  {
+    acc ^= round(0, val);
+    return acc * prime1 + prime4;
+  }
+};
+
+/**
+ * @brief Checks whether a hash value may be present in a split-block Bloom filter bitset.
+ *
+ * @param bitset Filter bitset, a whole number of 256-bit blocks
+ * @param hash xxHash64 of the PLAIN encoded value
+ * @return `false` if the value is definitely not in the filter, `true` otherwise
+ */
+bool split_block_filter_may_contain(host_span<uint8_t const> bitset, uint64_t hash)
+{
+  constexpr uint32_t salt[split_block_words] = {0x47b6137bU,
+                                                0x44974d91U,
+                                                0x8824ad5bU,
+                                                0xa2b7289dU,
+                                                0x705495c7U,
+                                                0x2df1424bU,
+                                                0x9efc4947U,
+                                                0x5c6bfb31U};
+
+  auto const num_blocks = bitset.size() / split_block_bytes;
+  if (num_blocks == 0) { return true; }
+  auto const block_idx = static_cast<size_t>(((hash >> 32) * num_blocks) >> 32);
+  auto const key       = static_cast<uint32_t>(hash);
+  auto const block     = bitset.data() + block_idx * split_block_bytes;
+  for (int i = 0; i < split_block_words; ++i) {
+    uint32_t word;
+    std::memcpy(&word, block + i * sizeof(uint32_t), sizeof(word));
+    auto const mask = uint32_t{1} << ((key * salt[i]) >> 27);
+    if ((word & mask) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Converts a literal scalar into the PLAIN encoding of the given Parquet physical type.
+ *
+ * Only types whose PLAIN encoding is independent of the file's logical type annotations are
+ * supported; `std::nullopt` is returned for all others so the literal never prunes a row group.
+ */
+struct plain_encoder {
+  template <typename T>
+  static std::vector<uint8_t> to_bytes(T const value)
+  {
+    std::vector<uint8_t> bytes(sizeof(T));
+    std::memcpy(bytes.data(), &value, sizeof(T));
+    return bytes;
+  }
+
+  template <typename T>
+  std::optional<std::vector<uint8_t>> operator()(cudf::scalar const& scalar,
+                                                 Type physical_type,
+                                                 rmm::cuda_stream_view stream) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      if (physical_type != BYTE_ARRAY) { return std::nullopt; }
+      auto const str = static_cast<string_scalar const&>(scalar).to_string(stream);
+      return std::vector<uint8_t>(str.begin(), str.end());
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      auto const value = static_cast<numeric_scalar<T> const&>(scalar).value(stream);
+      switch (physical_type) {
+        case INT32: return to_bytes(static_cast<int32_t>(value));
+        case INT64: return to_bytes(static_cast<int64_t>(value));
+        default: return std::nullopt;
+      }
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      auto const value = static_cast<numeric_scalar<T> const&>(scalar).value(stream);
+      // NaN compares unequal to everything, and -0.0 == 0.0 hash differently; don't prune
+      if (value != value or value == T{0}) { return std::nullopt; }
+      if (physical_type == FLOAT and std::is_same_v<T, float>) { return to_bytes(value); }
+      if (physical_type == DOUBLE and std::is_same_v<T, double>) { return to_bytes(value); }
+      return std::nullopt;
+    } else {
+      return std::nullopt;
+    }
+  }
+};
+
+/**
+ * @brief An equality predicate `column == literal` found in the filter expression
+ */
+struct equality_predicate {
+  ast::operation const* op;  ///< The EQUAL operation, since a literal may be shared
+  size_type column_index;
+  ast::literal const* literal;
+};
+
+/**
+ * @brief Collects all `column == literal` predicates in the filter expression.
+ *
+ * Only predicates that are reachable through LOGICAL_AND / LOGICAL_OR chains are collected, since
+ * those are the only ones `may_match` is able to use for pruning.
+ */
+void collect_equality_predicates(ast::expression const& expr,
+                                 std::vector<equality_predicate>& predicates)
+{
+  using ast::ast_operator;
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr) { return; }
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast_operator::EQUAL: {
+      auto const* col = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+      auto const* lit = dynamic_cast<ast::literal const*>(&operands[1].get());
+      if (col != nullptr and lit != nullptr and
+          col->get_table_source() == ast::table_reference::LEFT) {
+        predicates.push_back({op, col->get_column_index(), lit});
+      }
+      break;
+    }
+    case ast_operator::LOGICAL_AND: [[fallthrough]];
+    case ast_operator::NULL_LOGICAL_AND: [[fallthrough]];
+    case ast_operator::LOGICAL_OR: [[fallthrough]];
+    case ast_operator::NULL_LOGICAL_OR:
+      for (auto const& operand : operands) {
+        collect_equality_predicates(operand.get(), predicates);
+      }
+      break;
+    default: break;
+  }
+}
+
+/**
+ * @brief Evaluates whether a row group may satisfy the filter expression given the Bloom filter
+ * membership result of each equality predicate.
+ *
+ * Any sub-expression other than an equality predicate or a logical AND/OR of such is
+ * conservatively treated as possibly true.
+ */
+bool may_match(ast::expression const& expr,
+               std::unordered_map<ast::operation const*, bool> const& predicate_may_match)
+{
+  using ast::ast_operator;
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr) { return true; }
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast_operator::EQUAL: {
+      auto const it = predicate_may_match.find(op);
+      return it == predicate_may_match.end() or it->second;
+    }
+    case ast_operator::LOGICAL_AND: [[fallthrough]];
+    case ast_operator::NULL_LOGICAL_AND:
+      return may_match(operands[0].get(), predicate_may_match) and
+             may_match(operands[1].get(), predicate_may_match);
+    case ast_operator::LOGICAL_OR: [[fallthrough]];
+    case ast_operator::NULL_LOGICAL_OR:
+      return may_match(operands[0].get(), predicate_may_match) or
+             may_match(operands[1].get(), predicate_may_match);
+    default: return true;
+  }
+}
+
+/**
+ * @brief Reads the Bloom filter bitset of a column chunk from the datasource.
+ *
+ * @param source Datasource of the file containing the column chunk
+ * @param chunk Metadata of the column chunk
+ * @return The filter bitset, or `std::nullopt` if the chunk has no usable Bloom filter
+ */
+std::optional<std::vector<uint8_t>> read_bloom_filter_bitset(datasource& source,
+                                                             ColumnChunkMetaData const& chunk)
+{
+  if (not chunk.bloom_filter_offset.has_value()) { return std::nullopt; }
+  auto const offset = static_cast<size_t>(chunk.bloom_filter_offset.value());
+  if (offset >= source.size()) { return std::nullopt; }
+
+  // Read the header along with the bitset if the total length is known; otherwise read a
+  // conservative prefix for the header first.
+  auto const header_read_size =
+    chunk.bloom_filter_length.has_value()
+      ? static_cast<size_t>(chunk.bloom_filter_length.value())
+      : std::min(bloom_filter_header_size_guess, source.size() - offset);
+  auto buffer = source.host_read(offset, header_read_size);
+
+  BloomFilterHeader header;
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  cp.read(&header);
+  auto const header_size = static_cast<size_t>(cp.bytecount());
+
+  // Only the uncompressed split-block/xxHash combination is defined by the specification
+  if (header.algorithm.type != BloomFilterAlgorithm::SPLIT_BLOCK or
+      header.hash.type != BloomFilterHash::XXHASH or
+      header.compression.type != BloomFilterCompression::UNCOMPRESSED or header.num_bytes <= 0 or
+      header.num_bytes % split_block_bytes != 0) {
+    return std::nullopt;
+  }
+
+  auto const num_bytes = static_cast<size_t>(header.num_bytes);
+  if (header_size + num_bytes <= buffer->size()) {
+    return std::vector<uint8_t>(buffer->data() + header_size,
+                                buffer->data() + header_size + num_bytes);
+  }
+  if (offset + header_size + num_bytes > source.size()) { return std::nullopt; }
+  std::vector<uint8_t> bitset(num_bytes);
+  source.host_read(offset + header_size, num_bytes, bitset.data());
+  return bitset;
+}
+
+}  // namespace
+
+std::optional<std::vector<std::vector<size_type>>>
+aggregate_reader_metadata::apply_bloom_filters(
+  host_span<std::unique_ptr<datasource> const> sources,
+  host_span<std::vector<size_type> const> row_group_indices,
+  host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream) const
+{
+  std::vector<equality_predicate> predicates;
+  collect_equality_predicates(filter.get(), predicates);
+  if (predicates.empty()) { return std::nullopt; }
+
+  // Encode each usable literal once; literals that cannot be encoded never prune.
+  std::vector<std::optional<uint64_t>> literal_hashes(predicates.size());
+  for (size_t i = 0; i < predicates.size(); ++i) {
+    auto const& pred = predicates[i];
+    if (pred.column_index < 0 or
+        pred.column_index >= static_cast<size_type>(output_column_schemas.size()) or
+        pred.column_index >= static_cast<size_type>(output_dtypes.size())) {
+      continue;
+    }
+    auto const& schema = get_schema(output_column_schemas[pred.column_index]);
+    if (schema.num_children != 0 or schema.max_repetition_level > 0) { continue; }
+    // The literal must have the column's type for its PLAIN encoding to match the file's
+    auto const& scalar = pred.literal->get_scalar();
+    if (scalar.type() != output_dtypes[pred.column_index] or not scalar.is_valid(stream)) {
+      continue;
+    }
+    auto const plain =
+      cudf::type_dispatcher(scalar.type(), plain_encoder{}, scalar, schema.type, stream);
+    if (plain.has_value()) { literal_hashes[i] = xxhash_64{}(plain.value()); }
+  }
+  if (std::none_of(literal_hashes.cbegin(), literal_hashes.cend(), [](auto const& h) {
+        return h.has_value();
+      })) {
+    return std::nullopt;
+  }
+
+  // An empty selection means all row groups of all sources
+  std::vector<std::vector<size_type>> all_row_group_indices;
+  if (row_group_indices.empty()) {
+    all_row_group_indices = get_all_row_group_indices();
+    row_group_indices     = host_span<std::vector<size_type> const>(all_row_group_indices);
+  }
+
+  bool any_filtered = false;
+  std::vector<std::vector<size_type>> filtered_row_group_indices;
+  for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
+    std::vector<size_type> filtered_row_groups;
+    for (auto const rg_idx : row_group_indices[src_idx]) {
+      auto const& row_group = per_file_metadata[src_idx].row_groups[rg_idx];
+      // Bitsets are read lazily and at most once per column chunk
+      std::unordered_map<int, std::optional<std::vector<uint8_t>>> bitsets;
+      std::unordered_map<ast::operation const*, bool> predicate_may_match;
+      for (size_t i = 0; i < predicates.size(); ++i) {
+        if (not literal_hashes[i].has_value()) { continue; }
+        auto const schema_idx = output_column_schemas[predicates[i].column_index];
+        auto bitset_it        = bitsets.find(schema_idx);
+        if (bitset_it == bitsets.end()) {
+          auto const chunk = std::find_if(
+            row_group.columns.cbegin(), row_group.columns.cend(), [schema_idx](auto const& col) {
+              return col.schema_idx == schema_idx;
+            });
+          bitset_it =
+            bitsets
+              .emplace(schema_idx,
+                       chunk == row_group.columns.cend()
+                         ? std::nullopt
+                         : read_bloom_filter_bitset(*sources[src_idx], chunk->meta_data))
+              .first;
+        }
+        auto const& bitset = bitset_it->second;
+        if (bitset.has_value()) {
+          predicate_may_match[predicates[i].op] =
+            split_block_filter_may_contain(bitset.value(), literal_hashes[i].value());
+        }
+      }
+      if (may_match(filter.get(), predicate_may_match)) {
+        filtered_row_groups.push_back(rg_idx);
+      } else {
+        any_filtered = true;
+      }
+    }
+    filtered_row_group_indices.push_back(std::move(filtered_row_groups));
+  }
+  if (not any_filtered) { return std::nullopt; }
+  return {std::move(filtered_row_group_indices)};
+}
+
+}  // namespace cudf::io::parquet::detail
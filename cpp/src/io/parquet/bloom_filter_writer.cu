@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parquet_gpu.cuh"
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/hashing/detail/xxhash_64.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+namespace cudf::io::parquet::detail {
+
+namespace {
+
+constexpr int DEFAULT_BLOCK_SIZE = 256;
+
+// A split-block Bloom filter is made of 256-bit blocks of eight 32-bit words
+constexpr int split_block_words = 8;
+
+// Salts of the split-block Bloom filter, as defined by the Parquet specification
+static const __device__ __constant__ uint32_t kBloomFilterSalt[split_block_words] = {
+  0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U,
+  0x5c6bfb31U};
+
+/**
+ * @brief Computes the xxHash64 of the PLAIN encoding of a value, as required by the Parquet
+ * specification for Bloom filters.
+ */
+struct bloom_filter_hash_fn {
+  column_device_view const& col;
+
+  template <typename T>
+  __device__ uint64_t operator()(size_type idx) const
+  {
+    using cudf::hashing::detail::XXHash_64;
+    if constexpr (std::is_same_v<T, string_view>) {
+      return XXHash_64<string_view>{}(col.element<string_view>(idx));
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      // Integers narrower than 64 bits are stored as INT32
+      if constexpr (sizeof(T) <= sizeof(int32_t)) {
+        return XXHash_64<int32_t>{}(static_cast<int32_t>(col.element<T>(idx)));
+      } else {
+        return XXHash_64<int64_t>{}(static_cast<int64_t>(col.element<T>(idx)));
+      }
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      return XXHash_64<T>{}(col.element<T>(idx));
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for Bloom filters");
+    }
+  }
+};
+
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  populate_chunk_bloom_filters_kernel(cudf::detail::device_2dspan<PageFragment const> frags)
+{
+  auto col_idx = blockIdx.y;
+  auto block_x = blockIdx.x;
+  auto t       = threadIdx.x;
+  auto frag    = frags[col_idx][block_x];
+  auto chunk   = frag.chunk;
+  auto col     = chunk->col_desc;
+
+  if (chunk->bloom_filter_bitset == nullptr) { return; }
+
+  size_type start_row = frag.start_row;
+  size_type end_row   = frag.start_row + frag.num_rows;
+
+  // Find the bounds of values in leaf column to be inserted into the filter for current chunk
+  size_type const s_start_value_idx = row_to_value_idx(start_row, *col);
+  size_type const end_value_idx     = row_to_value_idx(end_row, *col);
+
+  column_device_view const& data_col = *col->leaf_column;
+
+  auto const num_blocks = chunk->bloom_filter_size / (split_block_words * sizeof(uint32_t));
+
+  for (thread_index_type val_idx = s_start_value_idx + t; val_idx < end_value_idx;
+       val_idx += block_size) {
+    if (val_idx >= data_col.size() or not data_col.is_valid(val_idx)) { continue; }
+
+    auto const hash      = type_dispatcher(
+      data_col.type(), bloom_filter_hash_fn{data_col}, static_cast<size_type>(val_idx));
+    auto const block_idx = ((hash >> 32) * num_blocks) >> 32;
+    auto const key       = static_cast<uint32_t>(hash);
+    auto const block     = chunk->bloom_filter_bitset + block_idx * split_block_words;
+#pragma unroll
+    for (int i = 0; i < split_block_words; ++i) {
+      atomicOr(block + i, uint32_t{1} << ((key * kBloomFilterSalt[i]) >> 27));
+    }
+  }
+}
+
+}  // namespace
+
+void populate_chunk_bloom_filters(cudf::detail::device_2dspan<PageFragment const> frags,
+                                  rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  populate_chunk_bloom_filters_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
+}
+
+}  // namespace cudf::io::parquet::detail
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -109,6 +109,7 @@ class CompactProtocolReader {
   void read(RowGroup* r);
   void read(ColumnChunk* c);
   void read(ColumnChunkMetaData* c);
+  void read(PageEncodingStats* s);
   void read(PageHeader* p);
   void read(DataPageHeader* d);
   void read(DictionaryPageHeader* d);
@@ -120,6 +121,10 @@ class CompactProtocolReader {
   void read(ColumnIndex* c);
   void read(Statistics* s);
   void read(ColumnOrder* c);
+  void read(BloomFilterAlgorithm* alg);
+  void read(BloomFilterHash* hash);
+  void read(BloomFilterCompression* comp);
+  void read(BloomFilterHeader* bf);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -182,6 +182,8 @@ size_t CompactProtocolWriter::write(ColumnChunkMetaData const& s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   c.field_struct(12, s.statistics);
+  if (s.bloom_filter_offset.has_value()) { c.field_int(14, s.bloom_filter_offset.value()); }
+  if (s.bloom_filter_length.has_value()) { c.field_int(15, s.bloom_filter_length.value()); }
   if (s.size_statistics.has_value()) { c.field_struct(16, s.size_statistics.value()); }
   return c.value();
 }
@@ -242,6 +244,48 @@ size_t CompactProtocolWriter::write(ColumnOrder const& co)
   return c.value();
 }
 
+size_t CompactProtocolWriter::write(BloomFilterAlgorithm const& alg)
+{
+  CompactProtocolFieldWriter c(*this);
+  switch (alg.type) {
+    case BloomFilterAlgorithm::SPLIT_BLOCK: c.field_empty_struct(alg.type); break;
+    default:
+      CUDF_FAIL("Trying to write an invalid BloomFilterAlgorithm " + std::to_string(alg.type));
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterHash const& hash)
+{
+  CompactProtocolFieldWriter c(*this);
+  switch (hash.type) {
+    case BloomFilterHash::XXHASH: c.field_empty_struct(hash.type); break;
+    default: CUDF_FAIL("Trying to write an invalid BloomFilterHash " + std::to_string(hash.type));
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterCompression const& comp)
+{
+  CompactProtocolFieldWriter c(*this);
+  switch (comp.type) {
+    case BloomFilterCompression::UNCOMPRESSED: c.field_empty_struct(comp.type); break;
+    default:
+      CUDF_FAIL("Trying to write an invalid BloomFilterCompression " + std::to_string(comp.type));
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterHeader const& bf)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, bf.num_bytes);
+  c.field_struct(2, bf.algorithm);
+  c.field_struct(3, bf.hash);
+  c.field_struct(4, bf.compression);
+  return c.value();
+}
+
 void CompactProtocolFieldWriter::put_byte(uint8_t v) { writer.m_buf.push_back(v); }
 
 void CompactProtocolFieldWriter::put_byte(uint8_t const* raw, uint32_t len)
@@ -53,6 +53,10 @@ class CompactProtocolWriter {
   size_t write(OffsetIndex const&);
   size_t write(SizeStatistics const&);
   size_t write(ColumnOrder const&);
+  size_t write(BloomFilterAlgorithm const&);
+  size_t write(BloomFilterHash const&);
+  size_t write(BloomFilterCompression const&);
+  size_t write(BloomFilterHeader const&);
 
  protected:
   std::vector<uint8_t>& m_buf;
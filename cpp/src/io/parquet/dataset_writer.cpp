@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/parquet.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/replace.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace cudf::io {
+namespace {
+
+// Hive's directory name for the null values of a partition column
+constexpr char const* hive_null_partition = "__HIVE_DEFAULT_PARTITION__";
+
+/**
+ * @brief Sink of a file that creates the file, and its directory, on the first write.
+ */
+class lazy_file_sink : public data_sink {
+ public:
+  explicit lazy_file_sink(std::string path) : _path(std::move(path)) {}
+
+  void host_write(void const* data, size_t size) override { sink().host_write(data, size); }
+
+  void flush() override
+  {
+    if (_sink) { _sink->flush(); }
+  }
+
+  size_t bytes_written() override { return _sink ? _sink->bytes_written() : 0; }
+
+ private:
+  data_sink& sink()
+  {
+    if (!_sink) {
+      std::filesystem::create_directories(std::filesystem::path(_path).parent_path());
+      _sink = data_sink::create(_path);
+    }
+    return *_sink;
+  }
+
+  std::string _path;
+  std::unique_ptr<data_sink> _sink;
+};
+
+/**
+ * @brief Formats the values of a partition column as strings on the device.
+ */
+std::unique_ptr<column> to_strings(column_view const& values, rmm::cuda_stream_view stream)
+{
+  auto const mr = rmm::mr::get_current_device_resource();
+  switch (values.type().id()) {
+    case type_id::STRING: return std::make_unique<column>(values, stream, mr);
+    case type_id::BOOL8:
+      return strings::from_booleans(values,
+                                    string_scalar("true", true, stream),
+                                    string_scalar("false", true, stream),
+                                    stream,
+                                    mr);
+    case type_id::TIMESTAMP_DAYS:
+      return strings::from_timestamps(
+        values,
+        "%Y-%m-%d",
+        strings_column_view(column_view{data_type{type_id::STRING}, 0, nullptr, nullptr, 0}),
+        stream,
+        mr);
+    default:
+      if (is_integral(values.type())) { return strings::from_integers(values, stream, mr); }
+      if (is_floating_point(values.type())) { return strings::from_floats(values, stream, mr); }
+      CUDF_FAIL("Unsupported partition column type", cudf::data_type_error);
+  }
+}
+
+/**
+ * @brief Formats the values of a partition column as the names of their directories, with Hive's
+ * name for nulls.
+ */
+std::unique_ptr<column> format_partition_values(column_view const& values,
+                                                rmm::cuda_stream_view stream)
+{
+  auto formatted = to_strings(values, stream);
+  if (!formatted->has_nulls()) { return formatted; }
+  return replace_nulls(formatted->view(),
+                       string_scalar(hive_null_partition, true, stream),
+                       stream,
+                       rmm::mr::get_current_device_resource());
+}
+
+/**
+ * @brief Copies the strings of a column without nulls to the host.
+ */
+std::vector<std::string> to_host_strings(strings_column_view const& input,
+                                         rmm::cuda_stream_view stream)
+{
+  if (input.size() == 0) { return {}; }
+  auto const offsets = input.offsets();
+  std::vector<int64_t> h_offsets(input.size() + 1);
+  if (offsets.type().id() == type_id::INT32) {
+    auto const h = cudf::detail::make_std_vector_sync(
+      device_span<int32_t const>(offsets.data<int32_t>() + input.offset(), input.size() + 1),
+      stream);
+    std::copy(h.begin(), h.end(), h_offsets.begin());
+  } else {
+    h_offsets = cudf::detail::make_std_vector_sync(
+      device_span<int64_t const>(offsets.data<int64_t>() + input.offset(), input.size() + 1),
+      stream);
+  }
+  auto const h_chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>(input.chars_begin(stream) + h_offsets.front(),
+                            h_offsets.back() - h_offsets.front()),
+    stream);
+
+  std::vector<std::string> result(input.size());
+  for (size_type i = 0; i < input.size(); ++i) {
+    result[i] = std::string(h_chars.data() + (h_offsets[i] - h_offsets.front()),
+                            h_offsets[i + 1] - h_offsets[i]);
+  }
+  return result;
+}
+
+/**
+ * @brief Escapes the characters of a partition value that are not valid in a directory name the
+ * way Hive does, as `%XX`.
+ */
+std::string escape_partition_value(std::string const& value)
+{
+  constexpr char const* special_chars = "\"#%'*/:=?\\{[]^";
+  constexpr char const* hex_digits    = "0123456789ABCDEF";
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (auto const c : value) {
+    auto const byte = static_cast<unsigned char>(c);
+    if (byte < 0x20 || byte == 0x7f || std::strchr(special_chars, c) != nullptr) {
+      escaped.push_back('%');
+      escaped.push_back(hex_digits[byte >> 4]);
+      escaped.push_back(hex_digits[byte & 0xf]);
+    } else {
+      escaped.push_back(c);
+    }
+  }
+  return escaped;
+}
+
+}  // namespace
+
+std::vector<std::string> write_parquet_dataset(parquet_writer_options const& options,
+                                               std::string const& base_path,
+                                               std::vector<size_type> const& partition_by,
+                                               rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  auto const input = options.get_table();
+  auto const keys  = input.select(partition_by);
+
+  std::vector<size_type> data_columns;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (std::find(partition_by.begin(), partition_by.end(), i) == partition_by.end()) {
+      data_columns.push_back(i);
+    }
+  }
+  CUDF_EXPECTS(!data_columns.empty(),
+               "A dataset needs a column that is not a partition column",
+               std::invalid_argument);
+  CUDF_EXPECTS(options.get_key_value_metadata().size() <= 1,
+               "A dataset has a single key-value metadata map",
+               std::invalid_argument);
+
+  // the partition columns are named like the writer names them
+  std::vector<std::string> names(partition_by.size());
+  std::transform(partition_by.begin(), partition_by.end(), names.begin(), [&](auto index) {
+    auto const& metadata = options.get_metadata();
+    if (metadata.has_value() && !metadata->column_metadata[index].get_name().empty()) {
+      return metadata->column_metadata[index].get_name();
+    }
+    return "_col" + std::to_string(index);
+  });
+  if (input.num_rows() == 0) { return {}; }
+
+  // group the rows by partition key
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  groupby::detail::sort::sort_groupby_helper helper(
+    keys, null_policy::INCLUDE, sorted::NO, std::vector<null_order>{});
+  auto const sorted_data = cudf::detail::gather(input.select(data_columns),
+                                                helper.key_sort_order(stream),
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                stream,
+                                                temp_mr);
+  auto const offsets = cudf::detail::make_std_vector_sync(
+    device_span<size_type const>(helper.group_offsets(stream)), stream);
+  auto const unique_keys    = helper.unique_keys(stream, temp_mr);
+  auto const num_partitions = static_cast<size_type>(offsets.size()) - 1;
+
+  std::vector<std::string> paths(num_partitions, base_path);
+  for (size_type k = 0; k < keys.num_columns(); ++k) {
+    auto const formatted = format_partition_values(unique_keys->get_column(k).view(), stream);
+    auto const values    = to_host_strings(strings_column_view(formatted->view()), stream);
+    for (size_type p = 0; p < num_partitions; ++p) {
+      paths[p] += "/" + escape_partition_value(names[k]) + "=" + escape_partition_value(values[p]);
+    }
+  }
+  std::vector<std::unique_ptr<data_sink>> sinks;
+  std::vector<partition_info> partitions;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    paths[p] += "/part-0.parquet";
+    sinks.push_back(std::make_unique<lazy_file_sink>(paths[p]));
+    partitions.emplace_back(offsets[p], offsets[p + 1] - offsets[p]);
+  }
+
+  // the files only hold the data columns
+  auto dataset_options = options;
+  if (options.get_metadata().has_value()) {
+    auto metadata = *options.get_metadata();
+    std::vector<column_in_metadata> data_metadata;
+    for (auto const index : data_columns) {
+      data_metadata.push_back(metadata.column_metadata[index]);
+    }
+    metadata.column_metadata = std::move(data_metadata);
+    dataset_options.set_metadata(std::move(metadata));
+  }
+  if (!options.get_key_value_metadata().empty()) {
+    dataset_options.set_key_value_metadata(std::vector<std::map<std::string, std::string>>(
+      num_partitions, options.get_key_value_metadata().front()));
+  }
+
+  parquet::detail::writer writer(
+    std::move(sinks), dataset_options, io::detail::single_write_mode::YES, stream);
+  writer.write(sorted_data->view(), partitions);
+  writer.close();
+  return paths;
+}
+
+}  // namespace cudf::io
@@ -157,7 +157,151 @@ static __device__ int gpuUpdateValidityOffsetsAndRowIndicesFlat(int32_t target_v
   return valid_count;
 }
 
-template <typename state_buf>
+/**
+ * @brief Processes the repetition and definition levels of a column with lists, up to the target
+ * count, and generates the validity, list offsets and value decoding indices.
+ *
+ * Unlike `gpuUpdateValidityOffsetsAndRowIndices`, which walks the levels a warp at a time, each
+ * thread of the block takes one level and the positions of the values at each nesting depth come
+ * from block-wide scans.
+ *
+ * @param target_value_count The number of levels to process up to
+ * @param s Local page information
+ * @param sb Page state buffer output
+ * @param rep Repetition level buffer
+ * @param def Definition level buffer
+ * @param t Thread index
+ * @return The number of valid leaf values processed so far
+ */
+template <typename level_t, typename state_buf>
+static __device__ int gpuUpdateValidityAndRowIndicesLists(int32_t target_value_count,
+                                                          page_state_s* s,
+                                                          state_buf* sb,
+                                                          level_t const* const rep,
+                                                          level_t const* const def,
+                                                          int t)
+{
+  constexpr int num_warps      = decode_block_size / cudf::detail::warp_size;
+  constexpr int max_batch_size = num_warps * cudf::detail::warp_size;
+  // a single scan counts the values, the valid values and the values of the next depth, each in
+  // its own field of the sum
+  constexpr int count_bits = 10;
+  constexpr int count_mask = (1 << count_bits) - 1;
+  static_assert(max_batch_size <= count_mask, "A batch does not fit in a count field");
+
+  using block_scan = cub::BlockScan<int, decode_block_size>;
+  __shared__ typename block_scan::TempStorage scan_storage;
+
+  PageNestingDecodeInfo* nesting_info_base = s->nesting_info;
+  int const max_depth                      = s->col.max_nesting_depth;
+  int const last_row                       = s->first_row + s->num_rows;
+  int const warp_lane                      = t % cudf::detail::warp_size;
+
+  __syncthreads();
+
+  // how many levels, rows and valid leaf values we've processed in the page so far
+  int value_count = s->input_value_count;
+  int row_count   = s->input_row_count;
+  int valid_count = nesting_info_base[max_depth - 1].valid_count;
+
+  while (value_count < target_value_count) {
+    int const batch_size = min(max_batch_size, target_value_count - value_count);
+
+    // the nesting depths this level adds a value to, and the definition level up to which the
+    // values are valid
+    int start_depth = -1;
+    int end_depth   = -1;
+    int d           = -1;
+    if (t < batch_size) {
+      int const index = rolling_index<rolling_buf_size>(value_count + t);
+      d               = static_cast<int>(def[index]);
+      start_depth     = nesting_info_base[rep[index]].start_depth;
+      end_depth       = nesting_info_base[d].end_depth;
+    }
+
+    // a level that starts at depth 0 starts a new row
+    int thread_row_count, block_row_count;
+    block_scan(scan_storage)
+      .InclusiveSum(start_depth == 0 ? 1 : 0, thread_row_count, block_row_count);
+    __syncthreads();
+    int const row_index      = (row_count + thread_row_count) - 1;
+    bool const in_row_bounds = row_index >= s->row_index_lower_bound && row_index < last_row;
+
+    for (int s_idx = 0; s_idx < max_depth; s_idx++) {
+      auto& ni = nesting_info_base[s_idx];
+
+      int const in_nesting_bounds = in_row_bounds && s_idx >= start_depth && s_idx <= end_depth;
+      int const in_next_bounds    = in_row_bounds && s_idx + 1 >= start_depth && s_idx < end_depth;
+      int const is_valid          = in_nesting_bounds && d >= ni.max_def_level;
+
+      int thread_counts, block_counts;
+      block_scan(scan_storage)
+        .ExclusiveSum(in_nesting_bounds | (is_valid << count_bits) |
+                        (in_next_bounds << (2 * count_bits)),
+                      thread_counts,
+                      block_counts);
+      int const thread_value_count = thread_counts & count_mask;
+      int const thread_valid_count = (thread_counts >> count_bits) & count_mask;
+      int const thread_next_count  = thread_counts >> (2 * count_bits);
+
+      // emit the index of a valid leaf value for decoding
+      if (is_valid && s_idx == max_depth - 1) {
+        int const src_pos = ni.valid_count + thread_valid_count;
+        int const dst_pos = ni.value_count + thread_value_count;
+        sb->nz_idx[rolling_index<state_buf::nz_buf_size>(src_pos)] = dst_pos;
+      }
+
+      // a depth above the leaf with an output buffer is a list, whose offset is the current
+      // length of the next depth
+      if (in_nesting_bounds && s_idx < max_depth - 1 && ni.data_out != nullptr) {
+        auto const& next = nesting_info_base[s_idx + 1];
+        reinterpret_cast<size_type*>(ni.data_out)[ni.value_count + thread_value_count] =
+          next.value_count + thread_next_count + next.page_start_value;
+      }
+
+      // the values of a warp are contiguous at each depth, so each warp stores its own validity
+      uint32_t const warp_value_mask = ballot(in_nesting_bounds);
+      if (ni.valid_map != nullptr && warp_value_mask != 0) {
+        // the bit of a value is at its position among the values of the warp
+        int const warp_position = thread_value_count - shuffle(thread_value_count);
+        uint32_t const warp_valid_mask =
+          WarpReduceOr32(static_cast<uint32_t>(is_valid) << warp_position);
+        if (warp_lane == 0) {
+          int const warp_value_count = __popc(warp_value_mask);
+          store_validity(ni.valid_map_offset + ni.value_count + thread_value_count,
+                         ni.valid_map,
+                         warp_valid_mask,
+                         warp_value_count);
+          atomicAdd(&ni.null_count, warp_value_count - __popc(warp_valid_mask));
+        }
+      }
+
+      if (s_idx == max_depth - 1) { valid_count += (block_counts >> count_bits) & count_mask; }
+
+      // all threads are done reading the counts of this depth and the scan storage
+      __syncthreads();
+      if (t == 0) {
+        ni.value_count += block_counts & count_mask;
+        ni.valid_count += (block_counts >> count_bits) & count_mask;
+      }
+    }
+
+    value_count += batch_size;
+    row_count += block_row_count;
+    __syncthreads();
+  }
+
+  if (t == 0) {
+    // update valid value count for decoding and total # of values we've processed
+    s->nz_count          = valid_count;
+    s->input_value_count = value_count;
+    s->input_row_count   = row_count;
+  }
+
+  return valid_count;
+}
+
+template <bool has_lists_t, typename state_buf>
 __device__ inline void gpuDecodeValues(
   page_state_s* s, state_buf* const sb, int start, int end, int t)
 {
@@ -166,6 +310,9 @@ __device__ inline void gpuDecodeValues(
 
   PageNestingDecodeInfo* nesting_info_base = s->nesting_info;
   int const dtype                          = s->col.data_type & 7;
+  // the values of the rows before the first row to read are skipped in pages of lists, and are
+  // not counted in the positions of nz_idx. always 0 for flat columns.
+  int const skipped_leaf_values = s->page.skipped_leaf_values;
 
   // decode values
   int pos = start;
@@ -175,49 +322,55 @@ __device__ inline void gpuDecodeValues(
     int const target_pos = pos + batch_size;
     int const src_pos    = pos + t;
 
-    // the position in the output column/buffer
-    int dst_pos = sb->nz_idx[rolling_index<state_buf::nz_buf_size>(src_pos)] - s->first_row;
+    // the position in the output column/buffer. the positions of lists are already relative to
+    // the first row, while flat columns are read from the start of the page.
+    int dst_pos = sb->nz_idx[rolling_index<state_buf::nz_buf_size>(src_pos)];
+    if constexpr (!has_lists_t) { dst_pos -= s->first_row; }
 
     // target_pos will always be properly bounded by num_rows, but dst_pos may be negative (values
     // before first_row) in the flat hierarchy case.
     if (src_pos < target_pos && dst_pos >= 0) {
+      int const val_src_pos = src_pos + skipped_leaf_values;
+
       // nesting level that is storing actual leaf values
       int const leaf_level_index = s->col.max_nesting_depth - 1;
 
       uint32_t dtype_len = s->dtype_len;
       void* dst =
         nesting_info_base[leaf_level_index].data_out + static_cast<size_t>(dst_pos) * dtype_len;
-      if (s->col.converted_type == DECIMAL) {
+      if (s->page.encoding == Encoding::BYTE_STREAM_SPLIT) {
+        gpuOutputByteStreamSplit(s, val_src_pos, static_cast<uint8_t*>(dst));
+      } else if (s->col.converted_type == DECIMAL) {
         switch (dtype) {
-          case INT32: gpuOutputFast(s, sb, src_pos, static_cast<uint32_t*>(dst)); break;
-          case INT64: gpuOutputFast(s, sb, src_pos, static_cast<uint2*>(dst)); break;
+          case INT32: gpuOutputFast(s, sb, val_src_pos, static_cast<uint32_t*>(dst)); break;
+          case INT64: gpuOutputFast(s, sb, val_src_pos, static_cast<uint2*>(dst)); break;
           default:
             if (s->dtype_len_in <= sizeof(int32_t)) {
-              gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<int32_t*>(dst));
+              gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<int32_t*>(dst));
             } else if (s->dtype_len_in <= sizeof(int64_t)) {
-              gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<int64_t*>(dst));
+              gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<int64_t*>(dst));
             } else {
-              gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<__int128_t*>(dst));
+              gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<__int128_t*>(dst));
             }
             break;
         }
       } else if (dtype == INT96) {
-        gpuOutputInt96Timestamp(s, sb, src_pos, static_cast<int64_t*>(dst));
+        gpuOutputInt96Timestamp(s, sb, val_src_pos, static_cast<int64_t*>(dst));
       } else if (dtype_len == 8) {
         if (s->dtype_len_in == 4) {
           // Reading INT32 TIME_MILLIS into 64-bit DURATION_MILLISECONDS
           // TIME_MILLIS is the only duration type stored as int32:
           // https://github.com/apache/parquet-format/blob/master/LogicalTypes.md#deprecated-time-convertedtype
-          gpuOutputFast(s, sb, src_pos, static_cast<uint32_t*>(dst));
+          gpuOutputFast(s, sb, val_src_pos, static_cast<uint32_t*>(dst));
         } else if (s->ts_scale) {
-          gpuOutputInt64Timestamp(s, sb, src_pos, static_cast<int64_t*>(dst));
+          gpuOutputInt64Timestamp(s, sb, val_src_pos, static_cast<int64_t*>(dst));
         } else {
-          gpuOutputFast(s, sb, src_pos, static_cast<uint2*>(dst));
+          gpuOutputFast(s, sb, val_src_pos, static_cast<uint2*>(dst));
         }
       } else if (dtype_len == 4) {
-        gpuOutputFast(s, sb, src_pos, static_cast<uint32_t*>(dst));
+        gpuOutputFast(s, sb, val_src_pos, static_cast<uint32_t*>(dst));
       } else {
-        gpuOutputGeneric(s, sb, src_pos, static_cast<uint8_t*>(dst), dtype_len);
+        gpuOutputGeneric(s, sb, val_src_pos, static_cast<uint8_t*>(dst), dtype_len);
       }
     }
 
@@ -265,8 +418,10 @@ __device__ inline bool has_nulls(page_state_s* s)
  * @param min_row Row index to start reading at
  * @param num_rows Maximum number of rows to read
  * @param error_code Error code to set if an error is encountered
+ * @tparam level_t Type used to store decoded repetition and definition levels
+ * @tparam has_lists_t Whether the pages are of columns with lists
  */
-template <typename level_t>
+template <typename level_t, bool has_lists_t>
 CUDF_KERNEL void __launch_bounds__(decode_block_size)
   gpuDecodePageDataFixed(PageInfo* pages,
                          device_span<ColumnChunkDesc const> chunks,
@@ -286,7 +441,9 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
   int const t           = threadIdx.x;
   PageInfo* pp          = &pages[page_idx];
 
-  if (!(BitAnd(pages[page_idx].kernel_mask, decode_kernel_mask::FIXED_WIDTH_NO_DICT))) { return; }
+  constexpr auto kernel_mask = has_lists_t ? decode_kernel_mask::FIXED_WIDTH_NO_DICT_LIST
+                                          : decode_kernel_mask::FIXED_WIDTH_NO_DICT;
+  if (!(BitAnd(pages[page_idx].kernel_mask, kernel_mask))) { return; }
 
   // must come after the kernel mask check
   [[maybe_unused]] null_count_back_copier _{s, t};
@@ -296,7 +453,7 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
                           chunks,
                           min_row,
                           num_rows,
-                          mask_filter{decode_kernel_mask::FIXED_WIDTH_NO_DICT},
+                          mask_filter{kernel_mask},
                           page_processing_stage::DECODE)) {
     return;
   }
@@ -304,22 +461,35 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
   // the level stream decoders
   __shared__ rle_run<level_t> def_runs[rle_run_buffer_size];
   rle_stream<level_t, decode_block_size, rolling_buf_size> def_decoder{def_runs};
+  __shared__ rle_run<level_t> rep_runs[has_lists_t ? rle_run_buffer_size : 1];
+  rle_stream<level_t, decode_block_size, rolling_buf_size> rep_decoder{rep_runs};
 
-  // if we have no work to do (eg, in a skip_rows/num_rows case) in this page.
-  if (s->num_rows == 0) { return; }
+  // if we have no work to do (eg, in a skip_rows/num_rows case) in this page. a page of lists
+  // without rows can still end a row that started in a previous page.
+  if (!has_lists_t && s->num_rows == 0) { return; }
 
   bool const nullable            = is_nullable(s);
   bool const nullable_with_nulls = nullable && has_nulls(s);
 
   // initialize the stream decoders (requires values computed in setupLocalPageInfo)
   level_t* const def = reinterpret_cast<level_t*>(pp->lvl_decode_buf[level_type::DEFINITION]);
-  if (nullable_with_nulls) {
+  [[maybe_unused]] level_t* const rep =
+    reinterpret_cast<level_t*>(pp->lvl_decode_buf[level_type::REPETITION]);
+  // the definition levels of lists are always decoded
+  if (has_lists_t || nullable_with_nulls) {
     def_decoder.init(s->col.level_bits[level_type::DEFINITION],
                      s->abs_lvl_start[level_type::DEFINITION],
                      s->abs_lvl_end[level_type::DEFINITION],
                      def,
                      s->page.num_input_values);
   }
+  if constexpr (has_lists_t) {
+    rep_decoder.init(s->col.level_bits[level_type::REPETITION],
+                     s->abs_lvl_start[level_type::REPETITION],
+                     s->abs_lvl_end[level_type::REPETITION],
+                     rep,
+                     s->page.num_input_values);
+  }
   __syncthreads();
 
   // We use two counters in the loop below: processed_count and valid_count.
@@ -336,8 +506,18 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
   while (s->error == 0 && processed_count < s->page.num_input_values) {
     int next_valid_count;
 
+    // the levels of lists are decoded from the start of the page, but those of the rows before
+    // the first row to read are not processed
+    if constexpr (has_lists_t) {
+      processed_count += rep_decoder.decode_next(t);
+      def_decoder.decode_next(t);
+      __syncthreads();
+
+      next_valid_count =
+        gpuUpdateValidityAndRowIndicesLists<level_t>(processed_count, s, sb, rep, def, t);
+    }
     // only need to process definition levels if this is a nullable column
-    if (nullable) {
+    else if (nullable) {
       if (nullable_with_nulls) {
         processed_count += def_decoder.decode_next(t);
         __syncthreads();
@@ -359,7 +539,7 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
     __syncthreads();
 
     // decode the values themselves
-    gpuDecodeValues(s, sb, valid_count, next_valid_count, t);
+    gpuDecodeValues<has_lists_t>(s, sb, valid_count, next_valid_count, t);
     __syncthreads();
 
     valid_count = next_valid_count;
@@ -380,8 +560,10 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
  * @param min_row Row index to start reading at
  * @param num_rows Maximum number of rows to read
  * @param error_code Error code to set if an error is encountered
+ * @tparam level_t Type used to store decoded repetition and definition levels
+ * @tparam has_lists_t Whether the pages are of columns with lists
  */
-template <typename level_t>
+template <typename level_t, bool has_lists_t>
 CUDF_KERNEL void __launch_bounds__(decode_block_size)
   gpuDecodePageDataFixedDict(PageInfo* pages,
                              device_span<ColumnChunkDesc const> chunks,
@@ -401,7 +583,9 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
   int const t           = threadIdx.x;
   PageInfo* pp          = &pages[page_idx];
 
-  if (!(BitAnd(pages[page_idx].kernel_mask, decode_kernel_mask::FIXED_WIDTH_DICT))) { return; }
+  constexpr auto kernel_mask = has_lists_t ? decode_kernel_mask::FIXED_WIDTH_DICT_LIST
+                                          : decode_kernel_mask::FIXED_WIDTH_DICT;
+  if (!(BitAnd(pages[page_idx].kernel_mask, kernel_mask))) { return; }
 
   // must come after the kernel mask check
   [[maybe_unused]] null_count_back_copier _{s, t};
@@ -411,37 +595,61 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
                           chunks,
                           min_row,
                           num_rows,
-                          mask_filter{decode_kernel_mask::FIXED_WIDTH_DICT},
+                          mask_filter{kernel_mask},
                           page_processing_stage::DECODE)) {
     return;
   }
 
   __shared__ rle_run<level_t> def_runs[rle_run_buffer_size];
   rle_stream<level_t, decode_block_size, rolling_buf_size> def_decoder{def_runs};
+  __shared__ rle_run<level_t> rep_runs[has_lists_t ? rle_run_buffer_size : 1];
+  rle_stream<level_t, decode_block_size, rolling_buf_size> rep_decoder{rep_runs};
 
   __shared__ rle_run<uint32_t> dict_runs[rle_run_buffer_size];
   rle_stream<uint32_t, decode_block_size, rolling_buf_size> dict_stream{dict_runs};
 
-  // if we have no work to do (eg, in a skip_rows/num_rows case) in this page.
-  if (s->num_rows == 0) { return; }
+  // if we have no work to do (eg, in a skip_rows/num_rows case) in this page. a page of lists
+  // without rows can still end a row that started in a previous page.
+  if (!has_lists_t && s->num_rows == 0) { return; }
 
   bool const nullable            = is_nullable(s);
   bool const nullable_with_nulls = nullable && has_nulls(s);
 
   // initialize the stream decoders (requires values computed in setupLocalPageInfo)
   level_t* const def = reinterpret_cast<level_t*>(pp->lvl_decode_buf[level_type::DEFINITION]);
-  if (nullable_with_nulls) {
+  [[maybe_unused]] level_t* const rep =
+    reinterpret_cast<level_t*>(pp->lvl_decode_buf[level_type::REPETITION]);
+  // the definition levels of lists are always decoded
+  if (has_lists_t || nullable_with_nulls) {
     def_decoder.init(s->col.level_bits[level_type::DEFINITION],
                      s->abs_lvl_start[level_type::DEFINITION],
                      s->abs_lvl_end[level_type::DEFINITION],
                      def,
                      s->page.num_input_values);
   }
+  if constexpr (has_lists_t) {
+    rep_decoder.init(s->col.level_bits[level_type::REPETITION],
+                     s->abs_lvl_start[level_type::REPETITION],
+                     s->abs_lvl_end[level_type::REPETITION],
+                     rep,
+                     s->page.num_input_values);
+  }
 
   dict_stream.init(
     s->dict_bits, s->data_start, s->data_end, sb->dict_idx, s->page.num_input_values);
   __syncthreads();
 
+  // skip the dictionary indices of the rows before the first row to read. always 0 for flat
+  // columns.
+  if constexpr (has_lists_t) {
+    for (int skipped = 0; skipped < s->page.skipped_leaf_values;) {
+      int const decoded =
+        dict_stream.decode_next(t, min(rolling_buf_size, s->page.skipped_leaf_values - skipped));
+      if (decoded == 0) { break; }
+      skipped += decoded;
+    }
+  }
+
   // We use two counters in the loop below: processed_count and valid_count.
   // - processed_count: number of rows out of num_input_values that we have decoded so far.
   //   the definition stream returns the number of total rows it has processed in each call
@@ -457,8 +665,18 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
   while (s->error == 0 && processed_count < s->page.num_input_values) {
     int next_valid_count;
 
+    // the levels of lists are decoded from the start of the page, but those of the rows before
+    // the first row to read are not processed
+    if constexpr (has_lists_t) {
+      processed_count += rep_decoder.decode_next(t);
+      def_decoder.decode_next(t);
+      __syncthreads();
+
+      next_valid_count =
+        gpuUpdateValidityAndRowIndicesLists<level_t>(processed_count, s, sb, rep, def, t);
+    }
     // only need to process definition levels if this is a nullable column
-    if (nullable) {
+    else if (nullable) {
       if (nullable_with_nulls) {
         processed_count += def_decoder.decode_next(t);
         __syncthreads();
@@ -487,7 +705,7 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
     __syncthreads();
 
     // decode the values themselves
-    gpuDecodeValues(s, sb, valid_count, next_valid_count, t);
+    gpuDecodeValues<has_lists_t>(s, sb, valid_count, next_valid_count, t);
     __syncthreads();
 
     valid_count = next_valid_count;
@@ -502,6 +720,7 @@ void __host__ DecodePageDataFixed(cudf::detail::hostdevice_span<PageInfo> pages,
                                   size_t num_rows,
                                   size_t min_row,
                                   int level_type_size,
+                                  bool has_lists,
                                   kernel_error::pointer error_code,
                                   rmm::cuda_stream_view stream)
 {
@@ -509,11 +728,21 @@ void __host__ DecodePageDataFixed(cudf::detail::hostdevice_span<PageInfo> pages,
   dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
 
   if (level_type_size == 1) {
-    gpuDecodePageDataFixed<uint8_t><<<dim_grid, dim_block, 0, stream.value()>>>(
-      pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    if (has_lists) {
+      gpuDecodePageDataFixed<uint8_t, true><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    } else {
+      gpuDecodePageDataFixed<uint8_t, false><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    }
   } else {
-    gpuDecodePageDataFixed<uint16_t><<<dim_grid, dim_block, 0, stream.value()>>>(
-      pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    if (has_lists) {
+      gpuDecodePageDataFixed<uint16_t, true><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    } else {
+      gpuDecodePageDataFixed<uint16_t, false><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    }
   }
 }
 
@@ -522,6 +751,7 @@ void __host__ DecodePageDataFixedDict(cudf::detail::hostdevice_span<PageInfo> pa
                                       size_t num_rows,
                                       size_t min_row,
                                       int level_type_size,
+                                      bool has_lists,
                                       kernel_error::pointer error_code,
                                       rmm::cuda_stream_view stream)
 {
@@ -531,11 +761,21 @@ void __host__ DecodePageDataFixedDict(cudf::detail::hostdevice_span<PageInfo> pa
   dim3 dim_grid(pages.size(), 1);        // 1 thread block per pags => # blocks
 
   if (level_type_size == 1) {
-    gpuDecodePageDataFixedDict<uint8_t><<<dim_grid, dim_block, 0, stream.value()>>>(
-      pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    if (has_lists) {
+      gpuDecodePageDataFixedDict<uint8_t, true><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    } else {
+      gpuDecodePageDataFixedDict<uint8_t, false><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    }
   } else {
-    gpuDecodePageDataFixedDict<uint16_t><<<dim_grid, dim_block, 0, stream.value()>>>(
-      pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    if (has_lists) {
+      gpuDecodePageDataFixedDict<uint16_t, true><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    } else {
+      gpuDecodePageDataFixedDict<uint16_t, false><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    }
   }
 }
 
@@ -345,6 +345,16 @@ CUDF_KERNEL void __launch_bounds__(preprocess_block_size)
   rle_stream<level_t, preprocess_block_size, rolling_buf_size>
     decoders[level_type::NUM_LEVEL_TYPES] = {{def_runs}, {rep_runs}};
 
+  // pages skipped by the predicate pushdown are not decompressed. they only belong to flat,
+  // fixed-width columns, whose sizes follow from the page header
+  if ((pp->flags & PAGEINFO_FLAGS_SKIPPED) != 0) {
+    if (t < pp->num_output_nesting_levels) {
+      if (is_base_pass) { pp->nesting[t].size = pp->num_input_values; }
+      pp->nesting[t].batch_size = pp->num_input_values;
+    }
+    return;
+  }
+
   // setup page info
   if (!setupLocalPageInfo(
         s, pp, chunks, min_row, num_rows, all_types_filter{}, page_processing_stage::PREPROCESS)) {
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parquet_gpu.cuh"
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <cub/cub.cuh>
+
+#include <limits>
+
+namespace cudf::io::parquet::detail {
+
+namespace {
+
+constexpr int DEFAULT_BLOCK_SIZE = 256;
+
+constexpr uint32_t full_warp_mask = 0xffff'ffffu;
+
+// Bit width of a DELTA_BINARY_PACKED miniblock, plus a share of the min delta of its block
+constexpr size_type delta_miniblock_overhead = 3;
+
+/**
+ * @brief Estimates the DELTA_BINARY_PACKED size of the valid values of a warp.
+ *
+ * A warp covers 32 consecutive values, so its deltas are packed like a miniblock, with the bit
+ * width of the range of the deltas. The estimate is returned by all lanes.
+ */
+__device__ size_type warp_delta_binary_size(int64_t value, bool is_valid)
+{
+  auto const lane_id    = threadIdx.x % cudf::detail::warp_size;
+  auto const valid_mask = __ballot_sync(full_warp_mask, is_valid);
+  auto const prev_mask  = valid_mask & ((1u << lane_id) - 1);
+
+  // Delta to the previous valid value of the warp
+  auto const prev_lane  = prev_mask != 0 ? 31 - __clz(prev_mask) : lane_id;
+  auto const prev_value = __shfl_sync(full_warp_mask, value, prev_lane);
+  auto const has_delta  = is_valid and prev_mask != 0;
+  auto const delta =
+    static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(prev_value));
+
+  auto min_delta = has_delta ? delta : std::numeric_limits<int64_t>::max();
+  auto max_delta = has_delta ? delta : std::numeric_limits<int64_t>::min();
+  for (int offset = cudf::detail::warp_size / 2; offset > 0; offset /= 2) {
+    min_delta = min(min_delta, __shfl_xor_sync(full_warp_mask, min_delta, offset));
+    max_delta = max(max_delta, __shfl_xor_sync(full_warp_mask, max_delta, offset));
+  }
+
+  auto const num_deltas = __popc(valid_mask) - (valid_mask != 0 ? 1 : 0);
+  if (num_deltas == 0) { return valid_mask != 0 ? delta_miniblock_overhead : 0; }
+  auto const delta_range = static_cast<uint64_t>(max_delta) - static_cast<uint64_t>(min_delta);
+  auto const bit_width   = 64 - __clzll(static_cast<long long>(delta_range));
+  return delta_miniblock_overhead + util::div_rounding_up_unsafe(num_deltas * bit_width, 8);
+}
+
+/**
+ * @brief Returns whether values of type `T` are DELTA_BINARY_PACKED without a conversion.
+ */
+struct is_delta_integer_fn {
+  template <typename T>
+  __device__ bool operator()() const
+  {
+    return (cudf::is_integral<T>() and not cudf::is_boolean<T>()) or
+           std::is_same_v<T, numeric::decimal32> or std::is_same_v<T, numeric::decimal64>;
+  }
+};
+
+struct delta_integer_fn {
+  column_device_view const& col;
+
+  template <typename T>
+  __device__ int64_t operator()(size_type idx) const
+  {
+    if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      return static_cast<int64_t>(col.element<T>(idx));
+    } else if constexpr (std::is_same_v<T, numeric::decimal32> or
+                         std::is_same_v<T, numeric::decimal64>) {
+      return static_cast<int64_t>(col.element<T>(idx).value());
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for DELTA_BINARY_PACKED size estimates");
+    }
+  }
+};
+
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  estimate_chunk_delta_sizes_kernel(cudf::detail::device_2dspan<PageFragment const> frags)
+{
+  auto col_idx = blockIdx.y;
+  auto block_x = blockIdx.x;
+  auto t       = threadIdx.x;
+  auto frag    = frags[col_idx][block_x];
+  auto chunk   = frag.chunk;
+  auto col     = chunk->col_desc;
+
+  if (col->requested_encoding != column_encoding::AUTO) { return; }
+
+  column_device_view const& data_col = *col->leaf_column;
+
+  auto const is_string =
+    col->physical_type == Type::BYTE_ARRAY and data_col.type().id() == type_id::STRING;
+  auto const is_integer =
+    (col->physical_type == Type::INT32 or col->physical_type == Type::INT64) and
+    type_dispatcher(data_col.type(), is_delta_integer_fn{});
+  if (not is_string and not is_integer) { return; }
+
+  using block_reduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+
+  size_type start_row = frag.start_row;
+  size_type end_row   = frag.start_row + frag.num_rows;
+
+  // Find the bounds of values in leaf column to be estimated for current chunk
+  size_type const s_start_value_idx = row_to_value_idx(start_row, *col);
+  size_type const end_value_idx     = row_to_value_idx(end_row, *col);
+
+  auto const lane_id  = t % cudf::detail::warp_size;
+  size_type data_size = 0;
+  // All threads of a warp iterate together, for the warp-wide estimates
+  for (thread_index_type val_idx = s_start_value_idx + t; val_idx - t < end_value_idx;
+       val_idx += block_size) {
+    auto const idx = static_cast<size_type>(val_idx);
+    auto const is_valid =
+      val_idx < end_value_idx and val_idx < data_col.size() and data_col.is_valid(idx);
+
+    if (is_string) {
+      // DELTA_BYTE_ARRAY stores the suffixes, and the prefix and suffix lengths as
+      // DELTA_BINARY_PACKED
+      size_type prefix_len = 0;
+      size_type suffix_len = 0;
+      if (is_valid) {
+        auto const value = data_col.element<string_view>(idx);
+        if (idx > s_start_value_idx and data_col.is_valid(idx - 1)) {
+          auto const prev       = data_col.element<string_view>(idx - 1);
+          auto const max_prefix = min(value.size_bytes(), prev.size_bytes());
+          while (prefix_len < max_prefix and value.data()[prefix_len] == prev.data()[prefix_len]) {
+            ++prefix_len;
+          }
+        }
+        suffix_len = value.size_bytes() - prefix_len;
+      }
+      auto const lengths_size =
+        warp_delta_binary_size(prefix_len, is_valid) + warp_delta_binary_size(suffix_len, is_valid);
+      data_size += suffix_len + (lane_id == 0 ? lengths_size : 0);
+    } else {
+      auto const value =
+        is_valid ? type_dispatcher(data_col.type(), delta_integer_fn{data_col}, idx) : int64_t{0};
+      auto const values_size = warp_delta_binary_size(value, is_valid);
+      data_size += lane_id == 0 ? values_size : 0;
+    }
+  }
+
+  auto const total_size = block_reduce(reduce_storage).Sum(data_size);
+  if (t == 0) { atomicAdd(&chunk->delta_data_size, total_size); }
+}
+
+}  // namespace
+
+void estimate_chunk_delta_sizes(cudf::detail::device_2dspan<PageFragment const> frags,
+                                rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  estimate_chunk_delta_sizes_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
+}
+
+}  // namespace cudf::io::parquet::detail
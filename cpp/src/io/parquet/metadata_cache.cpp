@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metadata_cache.hpp"
+
+#include "io/utilities/config_utils.hpp"
+#include "reader_impl_helpers.hpp"
+
+#include <cudf/io/detail/parquet.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+
+namespace cudf::io::parquet::detail {
+
+metadata_cache& metadata_cache::instance()
+{
+  static metadata_cache cache{
+    getenv_or<std::size_t>("LIBCUDF_PARQUET_METADATA_CACHE_SIZE", 1024)};
+  return cache;
+}
+
+std::shared_ptr<metadata const> metadata_cache::get(std::string const& key)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = _index.find(key);
+  if (it == _index.end()) { return nullptr; }
+  _entries.splice(_entries.begin(), _entries, it->second);
+  return it->second->second;
+}
+
+void metadata_cache::put(std::string const& key, std::shared_ptr<metadata const> meta)
+{
+  if (_capacity == 0) { return; }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (auto const it = _index.find(key); it != _index.end()) {
+    it->second->second = std::move(meta);
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return;
+  }
+  if (_entries.size() == _capacity) {
+    _index.erase(_entries.back().first);
+    _entries.pop_back();
+  }
+  _entries.emplace_front(key, std::move(meta));
+  _index.emplace(key, _entries.begin());
+}
+
+void metadata_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _index.clear();
+  _entries.clear();
+}
+
+std::vector<std::string> metadata_cache_keys(source_info const& info,
+                                             std::vector<std::string> const& user_keys,
+                                             std::size_t num_sources)
+{
+  if (not user_keys.empty()) {
+    CUDF_EXPECTS(user_keys.size() == num_sources,
+                 "Number of metadata cache keys must match the number of sources");
+    return user_keys;
+  }
+
+  std::vector<std::string> keys(num_sources);
+  if (info.type() == io_type::FILEPATH and info.filepaths().size() == num_sources) {
+    auto const& filepaths = info.filepaths();
+    std::transform(filepaths.begin(), filepaths.end(), keys.begin(), [](auto const& path) {
+      struct stat st {};
+      if (stat(path.c_str(), &st) != 0) { return std::string{}; }
+      auto const mtime_ns = static_cast<int64_t>(st.st_mtim.tv_sec) * 1'000'000'000 +
+                            static_cast<int64_t>(st.st_mtim.tv_nsec);
+      return path + ":" + std::to_string(st.st_size) + ":" + std::to_string(mtime_ns);
+    });
+  }
+  return keys;
+}
+
+void clear_metadata_cache() { metadata_cache::instance().clear(); }
+
+}  // namespace cudf::io::parquet::detail
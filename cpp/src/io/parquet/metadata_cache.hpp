@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf::io::parquet::detail {
+
+struct metadata;
+
+/**
+ * @brief Process-wide LRU cache of parsed file footers, keyed by a string that identifies the file
+ * contents.
+ *
+ * The capacity, in number of files, is read from `LIBCUDF_PARQUET_METADATA_CACHE_SIZE` on first
+ * use (1024 by default).
+ */
+class metadata_cache {
+ public:
+  /**
+   * @brief Returns the process-wide cache instance.
+   */
+  static metadata_cache& instance();
+
+  /**
+   * @brief Returns the cached metadata for the key, or nullptr if there is none.
+   */
+  [[nodiscard]] std::shared_ptr<metadata const> get(std::string const& key);
+
+  /**
+   * @brief Stores the metadata for the key, evicting the least recently used entry if full.
+   */
+  void put(std::string const& key, std::shared_ptr<metadata const> meta);
+
+  /**
+   * @brief Removes all entries.
+   */
+  void clear();
+
+ private:
+  explicit metadata_cache(std::size_t capacity) : _capacity{capacity} {}
+
+  using entry = std::pair<std::string, std::shared_ptr<metadata const>>;
+
+  std::size_t const _capacity;
+  std::mutex _mutex;
+  std::list<entry> _entries;  ///< Most recently used first
+  std::unordered_map<std::string, std::list<entry>::iterator> _index;
+};
+
+/**
+ * @brief Returns the metadata cache key of each source.
+ *
+ * User-supplied keys take precedence. Otherwise, file paths are keyed by the path, the file size
+ * and the modification time. An empty key means that the source is not cached.
+ *
+ * @param info The sources being read
+ * @param user_keys User-supplied keys, either empty or one per source
+ * @param num_sources Number of sources
+ * @return Cache key of each source
+ */
+[[nodiscard]] std::vector<std::string> metadata_cache_keys(
+  source_info const& info, std::vector<std::string> const& user_keys, std::size_t num_sources);
+
+}  // namespace cudf::io::parquet::detail
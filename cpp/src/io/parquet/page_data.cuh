@@ -28,11 +28,18 @@ namespace cudf::io::parquet::detail {
  * @param[in,out] s Page state input/output
  * @param[out] sb Page state buffer output
  * @param[in] src_pos Source position
- * @param[in] dstv Pointer to row output data (string descriptor or 32-bit hash)
+ * @param[in] dstv Pointer to row output data (string descriptor, dictionary key or 32-bit hash)
  */
 template <typename state_buf>
 inline __device__ void gpuOutputString(page_state_s* s, state_buf* sb, int src_pos, void* dstv)
 {
+  if (s->dtype_len == 4 and (s->col.data_type & 7) == BYTE_ARRAY and s->col.dict_key_offset >= 0) {
+    // Output the position of the string in the dictionary keys of all the chunks of the column
+    auto const dict_idx =
+      (s->dict_bits > 0) ? sb->dict_idx[rolling_index<state_buf::dict_buf_size>(src_pos)] : 0;
+    *static_cast<uint32_t*>(dstv) = s->col.dict_key_offset + dict_idx;
+    return;
+  }
   auto [ptr, len] = gpuGetStringData(s, sb, src_pos);
   // make sure to only hash `BYTE_ARRAY` when specified with the output type size
   if (s->dtype_len == 4 and (s->col.data_type & 7) == BYTE_ARRAY) {
@@ -315,6 +322,26 @@ __device__ void gpuOutputFixedLenByteArrayAsInt(page_state_s* s, state_buf* sb,
   *dst = unscaled;
 }
 
+/**
+ * @brief Output a value of a BYTE_STREAM_SPLIT encoded page
+ *
+ * The values of the page are split into one stream per byte, so byte `b` of the value at
+ * `src_pos` is at `b * num_values + src_pos`.
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[out] dst8 Pointer to row output data
+ */
+inline __device__ void gpuOutputByteStreamSplit(page_state_s* s, int src_pos, uint8_t* dst8)
+{
+  uint32_t const dtype_len  = s->dtype_len_in;
+  uint32_t const num_values = s->dict_size / dtype_len;
+  uint32_t const pos        = src_pos;
+  for (uint32_t b = 0; b < dtype_len; b++) {
+    dst8[b] = pos < num_values ? s->data_start[b * num_values + pos] : 0;
+  }
+}
+
 /**
  * @brief Output a small fixed-length value
  *
@@ -1047,8 +1047,12 @@ inline __device__ bool setupLocalPageInfo(page_state_s* const s,
   }
   __syncthreads();
 
-  // return false if this is a dictionary page or it does not pass the filter condition
-  if ((s->page.flags & PAGEINFO_FLAGS_DICTIONARY) != 0 || !filter(s->page)) { return false; }
+  // return false if this is a dictionary page, a page skipped by the predicate pushdown (which is
+  // never decompressed) or it does not pass the filter condition
+  if ((s->page.flags & (PAGEINFO_FLAGS_DICTIONARY | PAGEINFO_FLAGS_SKIPPED)) != 0 ||
+      !filter(s->page)) {
+    return false;
+  }
 
   // our starting row (absolute index) is
   // col.start_row == absolute row index
@@ -1318,6 +1322,14 @@ inline __device__ bool setupLocalPageInfo(page_state_s* const s,
           s->dict_val  = 0;
           if ((s->col.data_type & 7) == BOOLEAN) { s->dict_run = s->dict_size * 2 + 1; }
           break;
+        case Encoding::BYTE_STREAM_SPLIT:
+          s->dict_size = static_cast<int32_t>(end - cur);
+          s->dict_val  = 0;
+          // only the floating point types are split into streams by the writers we support
+          if ((s->col.data_type & 7) != FLOAT && (s->col.data_type & 7) != DOUBLE) {
+            s->set_error_code(decode_error::UNSUPPORTED_ENCODING);
+          }
+          break;
         case Encoding::RLE: {
           // first 4 bytes are length of RLE data
           int const len = (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
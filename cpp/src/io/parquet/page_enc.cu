@@ -506,14 +506,19 @@ __device__ encode_kernel_mask data_encoding_for_col(EncColumnChunk const* chunk,
   }
 
   // next check for user requested encoding, but skip if user requested dictionary encoding
-  // (if we could use the requested dict encoding, we'd have returned above)
-  if (col_desc->requested_encoding != column_encoding::USE_DEFAULT and
-      col_desc->requested_encoding != column_encoding::DICTIONARY) {
-    switch (col_desc->requested_encoding) {
+  // (if we could use the requested dict encoding, we'd have returned above). AUTO columns use the
+  // encoding selected by the writer for the chunk.
+  auto const requested_encoding = col_desc->requested_encoding == column_encoding::AUTO
+                                    ? chunk->selected_encoding
+                                    : col_desc->requested_encoding;
+  if (requested_encoding != column_encoding::USE_DEFAULT and
+      requested_encoding != column_encoding::DICTIONARY) {
+    switch (requested_encoding) {
       case column_encoding::PLAIN: return encode_kernel_mask::PLAIN;
       case column_encoding::DELTA_BINARY_PACKED: return encode_kernel_mask::DELTA_BINARY;
       case column_encoding::DELTA_LENGTH_BYTE_ARRAY: return encode_kernel_mask::DELTA_LENGTH_BA;
       case column_encoding::DELTA_BYTE_ARRAY: return encode_kernel_mask::DELTA_BYTE_ARRAY;
+      case column_encoding::BYTE_STREAM_SPLIT: return encode_kernel_mask::BYTE_STREAM_SPLIT;
     }
   }
 
@@ -1835,6 +1840,83 @@ CUDF_KERNEL void __launch_bounds__(block_size, 8)
     s, s->cur, pages, comp_in, comp_out, comp_results, write_v2_headers);
 }
 
+// BYTE_STREAM_SPLIT page data encoder
+// blockDim(128, 1, 1)
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size, 8)
+  gpuEncodeByteStreamSplitPages(device_span<EncPage> pages,
+                                device_span<device_span<uint8_t const>> comp_in,
+                                device_span<device_span<uint8_t>> comp_out,
+                                device_span<compression_result> comp_results,
+                                bool write_v2_headers)
+{
+  __shared__ __align__(8) page_enc_state_s<0> state_g;
+  using block_scan = cub::BlockScan<uint32_t, block_size>;
+  __shared__ typename block_scan::TempStorage scan_storage;
+
+  auto* const s = &state_g;
+  uint32_t t    = threadIdx.x;
+
+  if (t == 0) {
+    state_g        = page_enc_state_s<0>{};
+    s->page        = pages[blockIdx.x];
+    s->ck          = *s->page.chunk;
+    s->col         = *s->ck.col_desc;
+    s->rle_len_pos = nullptr;
+    // get s->cur back to where it was at the end of encoding the rep and def level data
+    set_page_data_start(s);
+  }
+  __syncthreads();
+
+  if (BitAnd(s->page.kernel_mask, encode_kernel_mask::BYTE_STREAM_SPLIT) == 0) { return; }
+
+  // Encode data values
+  auto const dtype_len = s->col.physical_type == DOUBLE ? sizeof(double) : sizeof(float);
+
+  if (t == 0) {
+    s->page.encoding   = Encoding::BYTE_STREAM_SPLIT;
+    s->page_start_val  = row_to_value_idx(s->page.start_row, s->col);
+    s->chunk_start_val = row_to_value_idx(s->ck.start_row, s->col);
+  }
+  __syncthreads();
+
+  // byte `b` of the value with index `i` among the valid values goes to stream `b`, which starts
+  // at `b * num_valid`
+  uint8_t* const data_start = s->cur;
+  auto const num_valid      = s->page.num_valid;
+  uint32_t valid_idx        = 0;
+  for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
+    uint32_t const nvals            = min(s->page.num_leaf_values - cur_val_idx, block_size);
+    size_type const val_idx_in_leaf = s->page_start_val + cur_val_idx + t;
+    bool const in_page = cur_val_idx + t < s->page.num_leaf_values &&
+                         val_idx_in_leaf < s->col.leaf_column->size();
+    uint32_t const is_valid = in_page && s->col.leaf_column->is_valid(val_idx_in_leaf) ? 1 : 0;
+    cur_val_idx += nvals;
+
+    uint32_t pos, batch_valid;
+    block_scan(scan_storage).ExclusiveSum(is_valid, pos, batch_valid);
+    if (is_valid) {
+      auto const* const src =
+        dtype_len == sizeof(double)
+          ? reinterpret_cast<uint8_t const*>(s->col.leaf_column->data<double>() + val_idx_in_leaf)
+          : reinterpret_cast<uint8_t const*>(s->col.leaf_column->data<float>() + val_idx_in_leaf);
+      for (uint32_t b = 0; b < dtype_len; b++) {
+        data_start[b * num_valid + valid_idx + pos] = src[b];
+      }
+    }
+    valid_idx += batch_valid;
+    __syncthreads();
+  }
+
+  finish_page_encode<block_size>(s,
+                                 data_start + dtype_len * num_valid,
+                                 pages,
+                                 comp_in,
+                                 comp_out,
+                                 comp_results,
+                                 write_v2_headers);
+}
+
 // DICTIONARY page data encoder
 // blockDim(128, 1, 1)
 template <int block_size>
@@ -3436,6 +3518,14 @@ void EncodePages(device_span<EncPage> pages,
     gpuEncodeDeltaByteArrayPages<encode_block_size>
       <<<num_pages, encode_block_size, 0, strm.value()>>>(pages, comp_in, comp_out, comp_results);
   }
+  if (BitAnd(kernel_mask, encode_kernel_mask::BYTE_STREAM_SPLIT) != 0) {
+    auto const strm = streams[s_idx++];
+    gpuEncodePageLevels<encode_block_size><<<num_pages, encode_block_size, 0, strm.value()>>>(
+      pages, write_v2_headers, encode_kernel_mask::BYTE_STREAM_SPLIT);
+    gpuEncodeByteStreamSplitPages<encode_block_size>
+      <<<num_pages, encode_block_size, 0, strm.value()>>>(
+        pages, comp_in, comp_out, comp_results, write_v2_headers);
+  }
   if (BitAnd(kernel_mask, encode_kernel_mask::DICTIONARY) != 0) {
     auto const strm = streams[s_idx++];
     gpuEncodePageLevels<encode_block_size><<<num_pages, encode_block_size, 0, strm.value()>>>(
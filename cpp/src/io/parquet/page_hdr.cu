@@ -145,6 +145,11 @@ __device__ inline bool is_nested(ColumnChunkDesc const& chunk)
   return chunk.max_nesting_depth > 1;
 }
 
+__device__ inline bool is_list(ColumnChunkDesc const& chunk)
+{
+  return chunk.max_level[level_type::REPETITION] > 0;
+}
+
 __device__ inline bool is_byte_array(ColumnChunkDesc const& chunk)
 {
   return (chunk.data_type & 7) == BYTE_ARRAY;
@@ -166,11 +171,24 @@ __device__ decode_kernel_mask kernel_mask_for_page(PageInfo const& page,
                                                    ColumnChunkDesc const& chunk)
 {
   if (page.flags & PAGEINFO_FLAGS_DICTIONARY) { return decode_kernel_mask::NONE; }
-  if (!is_string_col(chunk) && !is_nested(chunk) && !is_byte_array(chunk) && !is_boolean(chunk)) {
-    if (page.encoding == Encoding::PLAIN) {
-      return decode_kernel_mask::FIXED_WIDTH_NO_DICT;
-    } else if (page.encoding == Encoding::PLAIN_DICTIONARY) {
-      return decode_kernel_mask::FIXED_WIDTH_DICT;
+  if (!is_string_col(chunk) && !is_byte_array(chunk) && !is_boolean(chunk)) {
+    // BYTE_STREAM_SPLIT pages are decoded like PLAIN pages, with the bytes of each value gathered
+    // from its streams
+    auto const is_plain =
+      page.encoding == Encoding::PLAIN || page.encoding == Encoding::BYTE_STREAM_SPLIT;
+    if (!is_nested(chunk)) {
+      if (is_plain) {
+        return decode_kernel_mask::FIXED_WIDTH_NO_DICT;
+      } else if (page.encoding == Encoding::PLAIN_DICTIONARY) {
+        return decode_kernel_mask::FIXED_WIDTH_DICT;
+      }
+    } else if (is_list(chunk)) {
+      // the columns of structs without lists remain with the catch-all kernel
+      if (is_plain) {
+        return decode_kernel_mask::FIXED_WIDTH_NO_DICT_LIST;
+      } else if (page.encoding == Encoding::PLAIN_DICTIONARY) {
+        return decode_kernel_mask::FIXED_WIDTH_DICT_LIST;
+      }
     }
   }
   if (page.encoding == Encoding::DELTA_BINARY_PACKED) {
@@ -33,12 +33,13 @@ namespace cudf::io::parquet::detail {
 
 namespace {
 
-constexpr int preprocess_block_size    = 512;
-constexpr int decode_block_size        = 128;
-constexpr int delta_preproc_block_size = 64;
-constexpr int delta_length_block_size  = 32;
-constexpr int rolling_buf_size         = decode_block_size * 2;
-constexpr int preproc_buf_size         = LEVEL_DECODE_BUF_SIZE;
+constexpr int preprocess_block_size      = 512;
+constexpr int decode_block_size          = 128;
+constexpr int delta_preproc_block_size   = 64;
+constexpr int delta_length_block_size    = 32;
+constexpr int plain_positions_block_size = 128;
+constexpr int rolling_buf_size           = decode_block_size * 2;
+constexpr int preproc_buf_size           = LEVEL_DECODE_BUF_SIZE;
 
 /**
  * @brief Compute the start and end page value bounds for this page
@@ -931,6 +932,148 @@ CUDF_KERNEL void __launch_bounds__(preprocess_block_size) gpuComputePageStringSi
   }
 }
 
+/**
+ * @brief Position and length of a PLAIN encoded string, relative to the start of the page's values
+ */
+struct plain_string_pos {
+  size_type offset;
+  size_type length;
+};
+
+/**
+ * @brief Returns true if the page holds PLAIN encoded BYTE_ARRAY values decoded by the string
+ * kernel, whose positions can only be found by walking the length prefixes.
+ */
+__device__ inline bool is_plain_byte_array(PageInfo const& page, ColumnChunkDesc const& chunk)
+{
+  return BitAnd(page.kernel_mask, decode_kernel_mask::STRING) != 0 &&
+         page.encoding == Encoding::PLAIN && (chunk.data_type & 7) == BYTE_ARRAY;
+}
+
+/**
+ * @brief Returns the size in bytes of a level section that starts at `cur`.
+ *
+ * This mirrors the section sizes computed by `InitLevelSection`.
+ */
+__device__ int32_t level_section_size(PageInfo const& page,
+                                      ColumnChunkDesc const& chunk,
+                                      uint8_t const* cur,
+                                      uint8_t const* end,
+                                      level_type lvl)
+{
+  int const level_bits = chunk.level_bits[lvl];
+  auto const encoding  = lvl == level_type::DEFINITION ? page.definition_level_encoding
+                                                       : page.repetition_level_encoding;
+  if ((page.flags & PAGEINFO_FLAGS_V2) != 0 && page.lvl_bytes[lvl] != 0) {
+    return page.lvl_bytes[lvl];
+  } else if (level_bits == 0) {
+    return 0;
+  } else if (encoding == Encoding::RLE) {
+    return cur + 4 < end ? 4 + ((cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24)) : 0;
+  } else if (encoding == Encoding::BIT_PACKED) {
+    return (page.num_input_values * level_bits + 7) >> 3;
+  }
+  return 0;
+}
+
+/**
+ * @brief Returns the number of string positions `gpuComputePlainStringPositions` writes for a
+ * page, zero for pages that are not PLAIN encoded BYTE_ARRAY.
+ */
+struct plain_positions_count {
+  device_span<ColumnChunkDesc const> chunks;
+
+  __device__ int64_t operator()(PageInfo const& page) const
+  {
+    return is_plain_byte_array(page, chunks[page.chunk_idx]) ? page.num_input_values : 0;
+  }
+};
+
+/**
+ * @brief Kernel for finding the position and length of every string in PLAIN encoded BYTE_ARRAY
+ * pages.
+ *
+ * Each string is preceded by its length, so finding a string requires the positions of all of
+ * the strings before it. Rather than having a single thread of each decode block walk the
+ * prefixes between batches of copies, one thread per page walks the whole page here, with many
+ * pages in flight per block. The decode kernel then reads the positions of a batch in parallel.
+ * Strings that run past the end of the page get a length of zero, like in
+ * `gpuInitStringDescriptors`.
+ *
+ * @param pages List of pages
+ * @param chunks List of column chunks
+ * @param page_offsets Offset of the first position of each page in `positions`
+ * @param positions Output positions of the strings of all pages
+ */
+CUDF_KERNEL void __launch_bounds__(plain_positions_block_size)
+  gpuComputePlainStringPositions(device_span<PageInfo const> pages,
+                                 device_span<ColumnChunkDesc const> chunks,
+                                 int64_t const* page_offsets,
+                                 plain_string_pos* positions)
+{
+  auto const page_idx = cudf::detail::grid_1d::global_thread_id();
+  if (page_idx >= pages.size()) { return; }
+
+  auto const& page  = pages[page_idx];
+  auto const& chunk = chunks[page.chunk_idx];
+  if (!is_plain_byte_array(page, chunk) || page.num_input_values <= 0) { return; }
+
+  // skip the level sections to the values
+  uint8_t const* cur       = page.page_data;
+  uint8_t const* const end = cur + page.uncompressed_page_size;
+  cur += level_section_size(page, chunk, cur, end, level_type::REPETITION);
+  cur += level_section_size(page, chunk, cur, end, level_type::DEFINITION);
+  if (cur > end) { return; }
+
+  int const data_size  = static_cast<int>(end - cur);
+  auto* const page_pos = positions + page_offsets[page_idx];
+
+  int k = 0;
+  for (int pos = 0; pos < page.num_input_values; pos++) {
+    int len = 0;
+    if (k + 4 <= data_size) {
+      len = (cur[k]) | (cur[k + 1] << 8) | (cur[k + 2] << 16) | (cur[k + 3] << 24);
+      k += 4;
+      if (k + len > data_size) { len = 0; }
+    }
+    page_pos[pos] = {k, len};
+    k += len;
+  }
+}
+
+/**
+ * @brief Fills the string positions and lengths of a batch of PLAIN encoded values in parallel.
+ *
+ * FIXED_LEN_BYTE_ARRAY positions are computed from the value index, and BYTE_ARRAY positions are
+ * read from the output of `gpuComputePlainStringPositions`.
+ *
+ * @param[in,out] s Page state input/output
+ * @param[out] sb Page state buffer output
+ * @param[in] page_pos String positions of the page, or nullptr for FIXED_LEN_BYTE_ARRAY pages
+ * @param[in] target_pos Target output position
+ * @param[in] t Warp thread ID (0..31)
+ */
+template <typename state_buf>
+__device__ void gpuInitPlainStringDescriptors(
+  page_state_s* s, state_buf* sb, plain_string_pos const* page_pos, int target_pos, int t)
+{
+  bool const is_flba = (s->col.data_type & 7) == FIXED_LEN_BYTE_ARRAY;
+  for (int pos = s->dict_pos + t; pos < target_pos; pos += cudf::detail::warp_size) {
+    int k   = s->dict_size;
+    int len = 0;
+    if (is_flba) {
+      k   = pos * s->dtype_len_in;
+      len = k < s->dict_size ? s->dtype_len_in : 0;
+    } else if (pos < s->page.num_input_values) {
+      k   = page_pos[pos].offset;
+      len = page_pos[pos].length;
+    }
+    sb->dict_idx[rolling_index<state_buf::dict_buf_size>(pos)] = k;
+    sb->str_len[rolling_index<state_buf::str_buf_size>(pos)]   = len;
+  }
+  __syncwarp();
+}
+
 /**
  * @brief Kernel for computing the string column data stored in the pages
  *
@@ -943,6 +1086,9 @@ CUDF_KERNEL void __launch_bounds__(preprocess_block_size) gpuComputePageStringSi
  * @param chunks List of column chunks
  * @param min_row Row index to start reading at
  * @param num_rows Maximum number of rows to read
+ * @param plain_offsets Offset of the first string position of each page in `plain_positions`
+ * @param plain_positions String positions of PLAIN encoded BYTE_ARRAY pages
+ * @param error_code Error code to set if an error is encountered
  * @tparam level_t Type used to store decoded repetition and definition levels
  */
 template <typename level_t>
@@ -951,6 +1097,8 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
                           device_span<ColumnChunkDesc const> chunks,
                           size_t min_row,
                           size_t num_rows,
+                          int64_t const* plain_offsets,
+                          plain_string_pos const* plain_positions,
                           kernel_error::pointer error_code)
 {
   using cudf::detail::warp_size;
@@ -978,6 +1126,10 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
   }
 
   bool const has_repetition = s->col.max_level[level_type::REPETITION] > 0;
+  bool const has_plain_positions =
+    !s->dict_base && (s->col.data_type & 7) == BYTE_ARRAY && plain_positions != nullptr;
+  auto const* const page_pos =
+    has_plain_positions ? plain_positions + plain_offsets[page_idx] : nullptr;
 
   // offsets are local to the page
   if (t == 0) { last_offset = 0; }
@@ -1019,6 +1171,8 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
       // WARP1: Decode dictionary indices, booleans or string positions
       if (s->dict_base) {
         src_target_pos = gpuDecodeDictionaryIndices<false>(s, sb, src_target_pos, lane_id).first;
+      } else if (has_plain_positions || (s->col.data_type & 7) == FIXED_LEN_BYTE_ARRAY) {
+        gpuInitPlainStringDescriptors(s, sb, page_pos, src_target_pos, lane_id);
       } else {
         gpuInitStringDescriptors<false>(s, sb, src_target_pos, lane_id);
       }
@@ -1234,15 +1388,43 @@ void __host__ DecodeStringPageData(cudf::detail::hostdevice_span<PageInfo> pages
 {
   CUDF_EXPECTS(pages.size() > 0, "There is no page to decode");
 
+  // find the string positions of PLAIN encoded BYTE_ARRAY pages up front
+  rmm::device_uvector<int64_t> plain_offsets(pages.size(), stream);
+  auto const positions_count = plain_positions_count{chunks};
+  thrust::transform_exclusive_scan(rmm::exec_policy_nosync(stream),
+                                   pages.device_begin(),
+                                   pages.device_end(),
+                                   plain_offsets.begin(),
+                                   positions_count,
+                                   0L,
+                                   thrust::plus<int64_t>{});
+  auto const num_positions = thrust::transform_reduce(rmm::exec_policy(stream),
+                                                      pages.device_begin(),
+                                                      pages.device_end(),
+                                                      positions_count,
+                                                      0L,
+                                                      thrust::plus<int64_t>{});
+  rmm::device_uvector<plain_string_pos> plain_positions(num_positions, stream);
+  if (num_positions > 0) {
+    cudf::detail::grid_1d const grid{static_cast<thread_index_type>(pages.size()),
+                                     plain_positions_block_size};
+    gpuComputePlainStringPositions<<<grid.num_blocks,
+                                     grid.num_threads_per_block,
+                                     0,
+                                     stream.value()>>>(
+      pages, chunks, plain_offsets.data(), plain_positions.data());
+  }
+  auto const* const d_positions = num_positions > 0 ? plain_positions.data() : nullptr;
+
   dim3 dim_block(decode_block_size, 1);
   dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
 
   if (level_type_size == 1) {
     gpuDecodeStringPageData<uint8_t><<<dim_grid, dim_block, 0, stream.value()>>>(
-      pages.device_ptr(), chunks, min_row, num_rows, error_code);
+      pages.device_ptr(), chunks, min_row, num_rows, plain_offsets.data(), d_positions, error_code);
   } else {
     gpuDecodeStringPageData<uint16_t><<<dim_grid, dim_block, 0, stream.value()>>>(
-      pages.device_ptr(), chunks, min_row, num_rows, error_code);
+      pages.device_ptr(), chunks, min_row, num_rows, plain_offsets.data(), d_positions, error_code);
   }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -322,6 +322,15 @@ struct ColumnIndex {
   thrust::optional<std::vector<int64_t>> definition_level_histogram;
 };
 
+/**
+ * @brief Thrift-derived struct describing the number of pages of a given type and encoding
+ */
+struct PageEncodingStats {
+  PageType page_type = PageType::DATA_PAGE;
+  Encoding encoding  = Encoding::PLAIN;
+  int32_t count      = 0;
+};
+
 /**
  * @brief Thrift-derived struct describing a column chunk
  */
@@ -340,6 +349,11 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;                    // Byte offset from the beginning of file to first (only) dictionary page
   Statistics statistics;  // Encoded chunk-level statistics
+  thrust::optional<std::vector<PageEncodingStats>> encoding_stats;  // Page counts by encoding
+  thrust::optional<int64_t> bloom_filter_offset;  // Byte offset from beginning of file to the
+                                                  // Bloom filter header (if present)
+  thrust::optional<int32_t> bloom_filter_length;  // Size of the Bloom filter header and bitset,
+                                                  // in bytes (if present)
   thrust::optional<SizeStatistics> size_statistics;  // Size statistics for the chunk
 };
 
@@ -455,6 +469,42 @@ struct PageHeader {
   DataPageHeaderV2 data_page_header_v2;
 };
 
+/**
+ * @brief Union to specify the Bloom filter algorithm used. Only split-block is defined.
+ */
+struct BloomFilterAlgorithm {
+  enum Type { UNDEFINED, SPLIT_BLOCK };
+  Type type = UNDEFINED;
+};
+
+/**
+ * @brief Union to specify the hash function used by a Bloom filter. Only xxHash64 is defined.
+ */
+struct BloomFilterHash {
+  enum Type { UNDEFINED, XXHASH };
+  Type type = UNDEFINED;
+};
+
+/**
+ * @brief Union to specify the compression of a Bloom filter bitset. Only uncompressed is defined.
+ */
+struct BloomFilterCompression {
+  enum Type { UNDEFINED, UNCOMPRESSED };
+  Type type = UNDEFINED;
+};
+
+/**
+ * @brief Thrift-derived struct describing the header of a column chunk's Bloom filter
+ *
+ * The header is immediately followed by `num_bytes` bytes of the filter bitset.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+  BloomFilterAlgorithm algorithm;
+  BloomFilterHash hash;
+  BloomFilterCompression compression;
+};
+
 // bit space we are reserving in column_buffer::user_data
 constexpr uint32_t PARQUET_COLUMN_BUFFER_SCHEMA_MASK          = (0xff'ffffu);
 constexpr uint32_t PARQUET_COLUMN_BUFFER_FLAG_LIST_TERMINATED = (1 << 24);
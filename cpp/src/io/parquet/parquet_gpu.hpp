@@ -81,7 +81,8 @@ constexpr bool is_supported_encoding(Encoding enc)
     case Encoding::RLE_DICTIONARY:
     case Encoding::DELTA_BINARY_PACKED:
     case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-    case Encoding::DELTA_BYTE_ARRAY: return true;
+    case Encoding::DELTA_BYTE_ARRAY:
+    case Encoding::BYTE_STREAM_SPLIT: return true;
     default: return false;
   }
 }
@@ -181,6 +182,7 @@ constexpr uint32_t BitOr(T1 a, T2 b)
 enum {
   PAGEINFO_FLAGS_DICTIONARY = (1 << 0),  // Indicates a dictionary page
   PAGEINFO_FLAGS_V2         = (1 << 1),  // V2 page header
+  PAGEINFO_FLAGS_SKIPPED    = (1 << 2),  // Data page holding no rows that may pass the filter
 };
 
 /**
@@ -199,14 +201,16 @@ enum level_type {
  * Used to control which decode kernels to run.
  */
 enum class decode_kernel_mask {
-  NONE                = 0,
-  GENERAL             = (1 << 0),  // Run catch-all decode kernel
-  STRING              = (1 << 1),  // Run decode kernel for string data
-  DELTA_BINARY        = (1 << 2),  // Run decode kernel for DELTA_BINARY_PACKED data
-  DELTA_BYTE_ARRAY    = (1 << 3),  // Run decode kernel for DELTA_BYTE_ARRAY encoded data
-  DELTA_LENGTH_BA     = (1 << 4),  // Run decode kernel for DELTA_LENGTH_BYTE_ARRAY encoded data
-  FIXED_WIDTH_NO_DICT = (1 << 5),  // Run decode kernel for fixed width non-dictionary pages
-  FIXED_WIDTH_DICT    = (1 << 6)   // Run decode kernel for fixed width dictionary pages
+  NONE                     = 0,
+  GENERAL                  = (1 << 0),  // Run catch-all decode kernel
+  STRING                   = (1 << 1),  // Run decode kernel for string data
+  DELTA_BINARY             = (1 << 2),  // Run decode kernel for DELTA_BINARY_PACKED data
+  DELTA_BYTE_ARRAY         = (1 << 3),  // Run decode kernel for DELTA_BYTE_ARRAY encoded data
+  DELTA_LENGTH_BA          = (1 << 4),  // Run decode kernel for DELTA_LENGTH_BYTE_ARRAY data
+  FIXED_WIDTH_NO_DICT      = (1 << 5),  // Run decode kernel for fixed width non-dictionary pages
+  FIXED_WIDTH_DICT         = (1 << 6),  // Run decode kernel for fixed width dictionary pages
+  FIXED_WIDTH_NO_DICT_LIST = (1 << 7),  // Run decode kernel for fixed width non-dictionary lists
+  FIXED_WIDTH_DICT_LIST    = (1 << 8)   // Run decode kernel for fixed width dictionary lists
 };
 
 // mask representing all the ways in which a string can be encoded
@@ -442,6 +446,10 @@ struct ColumnChunkDesc {
   int32_t src_col_index{};   // my input column index
   int32_t src_col_schema{};  // my schema index in the file
 
+  // offset of the dictionary of this chunk within the keys of a dictionary output column, or -1
+  // to decode the strings themselves
+  int32_t dict_key_offset{-1};
+
   // pointer to column_chunk_info struct for this chunk (host only)
   column_chunk_info const* h_chunk_info{};
 
@@ -516,11 +524,12 @@ constexpr uint32_t encoding_to_mask(Encoding encoding)
  * Used to control which encode kernels to run.
  */
 enum class encode_kernel_mask {
-  PLAIN            = (1 << 0),  // Run plain encoding kernel
-  DICTIONARY       = (1 << 1),  // Run dictionary encoding kernel
-  DELTA_BINARY     = (1 << 2),  // Run DELTA_BINARY_PACKED encoding kernel
-  DELTA_LENGTH_BA  = (1 << 3),  // Run DELTA_LENGTH_BYTE_ARRAY encoding kernel
-  DELTA_BYTE_ARRAY = (1 << 4),  // Run DELTA_BYtE_ARRAY encoding kernel
+  PLAIN             = (1 << 0),  // Run plain encoding kernel
+  DICTIONARY        = (1 << 1),  // Run dictionary encoding kernel
+  DELTA_BINARY      = (1 << 2),  // Run DELTA_BINARY_PACKED encoding kernel
+  DELTA_LENGTH_BA   = (1 << 3),  // Run DELTA_LENGTH_BYTE_ARRAY encoding kernel
+  DELTA_BYTE_ARRAY  = (1 << 4),  // Run DELTA_BYtE_ARRAY encoding kernel
+  BYTE_STREAM_SPLIT = (1 << 5),  // Run BYTE_STREAM_SPLIT encoding kernel
 };
 
 /**
@@ -557,12 +566,19 @@ struct EncColumnChunk {
   size_type* dict_index;  //!< Index of value in dictionary page. column[dict_data[dict_index[row]]]
   uint8_t dict_rle_bits;  //!< Bit size for encoding dictionary indices
   bool use_dictionary;    //!< True if the chunk uses dictionary encoding
-  uint8_t* column_index_blob;    //!< Binary blob containing encoded column index for this chunk
-  uint32_t column_index_size;    //!< Size of column index blob
-  uint32_t encodings;            //!< Mask representing the set of encodings used for this chunk
-  uint32_t* def_histogram_data;  //!< Buffers for size histograms. One for chunk and one per page.
-  uint32_t* rep_histogram_data;  //!< Size is (max(level) + 1) * (num_data_pages + 1).
-  size_t var_bytes_size;         //!< Sum of var_bytes_size from the pages (byte arrays only)
+  uint8_t* column_index_blob;     //!< Binary blob containing encoded column index for this chunk
+  uint32_t column_index_size;     //!< Size of column index blob
+  uint32_t encodings;             //!< Mask representing the set of encodings used for this chunk
+  uint32_t* def_histogram_data;   //!< Buffers for size histograms. One for chunk and one per page.
+  uint32_t* rep_histogram_data;   //!< Size is (max(level) + 1) * (num_data_pages + 1).
+  size_t var_bytes_size;          //!< Sum of var_bytes_size from the pages (byte arrays only)
+  uint32_t* bloom_filter_bitset;  //!< Bloom filter bitset of the chunk values, or nullptr
+  uint32_t bloom_filter_size;     //!< Size of the Bloom filter bitset in bytes
+
+  size_type delta_data_size;          //!< Estimated size of data if a DELTA encoding is used
+  column_encoding selected_encoding;  //!< Non-dictionary encoding selected for AUTO columns
+  Compression codec;                  //!< Compression codec of the pages in this chunk
+  bool is_codec_adaptive;             //!< True if the codec is selected from a sample page
 
   constexpr uint32_t num_dict_pages() const { return use_dictionary ? 1 : 0; }
 
@@ -852,6 +868,7 @@ void DecodeDeltaLengthByteArray(cudf::detail::hostdevice_span<PageInfo> pages,
  * @param[in] num_rows Total number of rows to read
  * @param[in] min_row Minimum number of rows to read
  * @param[in] level_type_size Size in bytes of the type for level decoding
+ * @param[in] has_lists Whether to decode the pages of columns with lists
  * @param[out] error_code Error code for kernel failures
  * @param[in] stream CUDA stream to use
  */
@@ -860,6 +877,7 @@ void DecodePageDataFixed(cudf::detail::hostdevice_span<PageInfo> pages,
                          std::size_t num_rows,
                          size_t min_row,
                          int level_type_size,
+                         bool has_lists,
                          kernel_error::pointer error_code,
                          rmm::cuda_stream_view stream);
 
@@ -874,6 +892,7 @@ void DecodePageDataFixed(cudf::detail::hostdevice_span<PageInfo> pages,
  * @param[in] num_rows Total number of rows to read
  * @param[in] min_row Minimum number of rows to read
  * @param[in] level_type_size Size in bytes of the type for level decoding
+ * @param[in] has_lists Whether to decode the pages of columns with lists
  * @param[out] error_code Error code for kernel failures
  * @param[in] stream CUDA stream to use
  */
@@ -882,6 +901,7 @@ void DecodePageDataFixedDict(cudf::detail::hostdevice_span<PageInfo> pages,
                              std::size_t num_rows,
                              size_t min_row,
                              int level_type_size,
+                             bool has_lists,
                              kernel_error::pointer error_code,
                              rmm::cuda_stream_view stream);
 
@@ -950,6 +970,29 @@ void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_st
 void populate_chunk_hash_maps(cudf::detail::device_2dspan<PageFragment const> frags,
                               rmm::cuda_stream_view stream);
 
+/**
+ * @brief Insert the hashes of chunk values into the Bloom filters of their chunks
+ *
+ * Chunks without a Bloom filter bitset are skipped. The bitsets must be zero-initialized.
+ *
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void populate_chunk_bloom_filters(cudf::detail::device_2dspan<PageFragment const> frags,
+                                  rmm::cuda_stream_view stream);
+
+/**
+ * @brief Estimate the size of the DELTA encoding of the chunks whose requested encoding is AUTO
+ *
+ * Adds the estimated DELTA_BINARY_PACKED size of integer chunks, or DELTA_BYTE_ARRAY size of string
+ * chunks, to `delta_data_size`, which must be zero-initialized. Other chunks are left untouched.
+ *
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void estimate_chunk_delta_sizes(cudf::detail::device_2dspan<PageFragment const> frags,
+                                rmm::cuda_stream_view stream);
+
 /**
  * @brief Compact dictionary hash map entries into chunk.dict_data
  *
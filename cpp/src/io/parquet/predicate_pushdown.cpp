@@ -15,12 +15,13 @@
  */
 #include "reader_impl_helpers.hpp"
 
+#include "io/utilities/stats_filter.hpp"
+
 #include <cudf/ast/detail/expression_transformer.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
-#include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -123,6 +124,76 @@ struct stats_caster {
     }
   }
 
+  // Struct to hold host columns of statistics values
+  template <typename T>
+  struct host_column {
+    // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
+    thrust::host_vector<T> val;
+    std::vector<bitmask_type> null_mask;
+    cudf::size_type null_count = 0;
+    host_column(size_type total_row_groups)
+      : val(total_row_groups),
+        null_mask(
+          cudf::util::div_rounding_up_safe<size_type>(
+            cudf::bitmask_allocation_size_bytes(total_row_groups), sizeof(bitmask_type)),
+          ~bitmask_type{0})
+    {
+    }
+
+    void set_index(size_type index,
+                   thrust::optional<std::vector<uint8_t>> const& binary_value,
+                   Type const type)
+    {
+      if (binary_value.has_value()) {
+        val[index] = convert<T>(binary_value.value().data(), binary_value.value().size(), type);
+      }
+      if (not binary_value.has_value()) {
+        clear_bit_unsafe(null_mask.data(), index);
+        null_count++;
+      }
+    }
+
+    static auto make_strings_children(host_span<string_view> host_strings,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+    {
+      std::vector<char> chars{};
+      std::vector<cudf::size_type> offsets(1, 0);
+      for (auto const& str : host_strings) {
+        auto tmp =
+          str.empty() ? std::string_view{} : std::string_view(str.data(), str.size_bytes());
+        chars.insert(chars.end(), std::cbegin(tmp), std::cend(tmp));
+        offsets.push_back(offsets.back() + tmp.length());
+      }
+      auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
+      auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
+      return std::tuple{std::move(d_chars), std::move(d_offsets)};
+    }
+
+    auto to_device(cudf::data_type dtype,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+    {
+      if constexpr (std::is_same_v<T, string_view>) {
+        auto [d_chars, d_offsets] = make_strings_children(val, stream, mr);
+        return cudf::make_strings_column(
+          val.size(),
+          std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
+          d_chars.release(),
+          null_count,
+          rmm::device_buffer{
+            null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr});
+      }
+      return std::make_unique<column>(
+        dtype,
+        val.size(),
+        cudf::detail::make_device_uvector_async(val, stream, mr).release(),
+        rmm::device_buffer{
+          null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
+        null_count);
+    }
+  };  // struct host_column
+
   // Creates device columns from column statistics (min, max)
   template <typename T>
   std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
@@ -135,76 +206,8 @@ struct stats_caster {
     if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
       CUDF_FAIL("Compound types do not have statistics");
     } else {
-      // Local struct to hold host columns
-      struct host_column {
-        // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
-        thrust::host_vector<T> val;
-        std::vector<bitmask_type> null_mask;
-        cudf::size_type null_count = 0;
-        host_column(size_type total_row_groups)
-          : val(total_row_groups),
-            null_mask(
-              cudf::util::div_rounding_up_safe<size_type>(
-                cudf::bitmask_allocation_size_bytes(total_row_groups), sizeof(bitmask_type)),
-              ~bitmask_type{0})
-        {
-        }
-
-        void set_index(size_type index,
-                       thrust::optional<std::vector<uint8_t>> const& binary_value,
-                       Type const type)
-        {
-          if (binary_value.has_value()) {
-            val[index] = convert<T>(binary_value.value().data(), binary_value.value().size(), type);
-          }
-          if (not binary_value.has_value()) {
-            clear_bit_unsafe(null_mask.data(), index);
-            null_count++;
-          }
-        }
-
-        static auto make_strings_children(host_span<string_view> host_strings,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
-        {
-          std::vector<char> chars{};
-          std::vector<cudf::size_type> offsets(1, 0);
-          for (auto const& str : host_strings) {
-            auto tmp =
-              str.empty() ? std::string_view{} : std::string_view(str.data(), str.size_bytes());
-            chars.insert(chars.end(), std::cbegin(tmp), std::cend(tmp));
-            offsets.push_back(offsets.back() + tmp.length());
-          }
-          auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
-          auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
-          return std::tuple{std::move(d_chars), std::move(d_offsets)};
-        }
-
-        auto to_device(cudf::data_type dtype,
-                       rmm::cuda_stream_view stream,
-                       rmm::mr::device_memory_resource* mr)
-        {
-          if constexpr (std::is_same_v<T, string_view>) {
-            auto [d_chars, d_offsets] = make_strings_children(val, stream, mr);
-            return cudf::make_strings_column(
-              val.size(),
-              std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
-              d_chars.release(),
-              null_count,
-              rmm::device_buffer{
-                null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr});
-          }
-          return std::make_unique<column>(
-            dtype,
-            val.size(),
-            cudf::detail::make_device_uvector_async(val, stream, mr).release(),
-            rmm::device_buffer{
-              null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
-            null_count);
-        }
-      };  // local struct host_column
-      host_column min(total_row_groups);
-      host_column max(total_row_groups);
+      host_column<T> min(total_row_groups);
+      host_column<T> max(total_row_groups);
 
       size_type stats_idx = 0;
       for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
@@ -230,151 +233,156 @@ struct stats_caster {
 };
 
 /**
- * @brief Converts AST expression to StatsAST for comparing with column statistics
- * This is used in row group filtering based on predicate.
- * statistics min value of a column is referenced by column_index*2
- * statistics max value of a column is referenced by column_index*2+1
+ * @brief Converts page statistics from the column indexes to 2 device columns - min, max values.
  *
+ * Each row of the output columns corresponds to a page fragment: a range of rows of a row group
+ * that is covered by a single page of every column referenced by the filter.
  */
-class stats_expression_converter : public ast::detail::expression_transformer {
- public:
-  stats_expression_converter(ast::expression const& expr, size_type const& num_columns)
-    : _num_columns{num_columns}
-  {
-    expr.accept(*this);
-  }
-
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
-  {
-    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
-    return expr;
-  }
+struct page_stats_caster {
+  size_type total_fragments;
+  // For each output column, the column chunk and page index covering every fragment. Empty for
+  // the columns that are not referenced by the filter.
+  std::vector<std::vector<std::pair<ColumnChunk const*, size_type>>> const& fragment_pages;
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    size_t col_idx,
+    cudf::data_type dtype,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
   {
-    CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
-                 "Statistics AST supports only left table");
-    CUDF_EXPECTS(expr.get_column_index() < _num_columns,
-                 "Column index cannot be more than number of columns in the table");
-    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
-    return expr;
+    if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
+      CUDF_FAIL("Compound types do not have statistics");
+    } else {
+      stats_caster::host_column<T> min(total_fragments);
+      stats_caster::host_column<T> max(total_fragments);
+      for (size_type frag_idx = 0; frag_idx < total_fragments; ++frag_idx) {
+        auto const [chunk, page_idx] = fragment_pages[col_idx][frag_idx];
+        auto const& column_index     = chunk->column_index.value();
+        // null pages have no min/max values
+        auto const is_null_page = column_index.null_pages[page_idx];
+        auto const min_value    = is_null_page ? thrust::optional<std::vector<uint8_t>>{}
+                                               : column_index.min_values[page_idx];
+        auto const max_value    = is_null_page ? thrust::optional<std::vector<uint8_t>>{}
+                                               : column_index.max_values[page_idx];
+        min.set_index(frag_idx, min_value, chunk->meta_data.type);
+        max.set_index(frag_idx, max_value, chunk->meta_data.type);
+      }
+      return {min.to_device(dtype, stream, mr), max.to_device(dtype, stream, mr)};
+    }
   }
+};
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(
-    ast::column_name_reference const& expr) override
-  {
-    CUDF_FAIL("Column name reference is not supported in statistics AST");
-  }
+/**
+ * @brief Converts the statistics of a list of column chunks to 2 device columns - min, max values.
+ */
+struct chunk_stats_caster {
+  std::vector<ColumnChunkMetaData const*> const& chunks;
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    cudf::data_type dtype, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
   {
-    using cudf::ast::ast_operator;
-    auto const operands = expr.get_operands();
-    auto const op       = expr.get_operator();
-
-    if (auto* v = dynamic_cast<ast::column_reference const*>(&operands[0].get())) {
-      // First operand should be column reference, second should be literal.
-      CUDF_EXPECTS(cudf::ast::detail::ast_operator_arity(op) == 2,
-                   "Only binary operations are supported on column reference");
-      CUDF_EXPECTS(dynamic_cast<ast::literal const*>(&operands[1].get()) != nullptr,
-                   "Second operand of binary operation with column reference must be a literal");
-      v->accept(*this);
-      auto const col_index = v->get_column_index();
-      switch (op) {
-        /* transform to stats conditions. op(col, literal)
-        col1 == val --> vmin <= val && vmax >= val
-        col1 != val --> !(vmin == val && vmax == val)
-        col1 >  val --> vmax > val
-        col1 <  val --> vmin < val
-        col1 >= val --> vmax >= val
-        col1 <= val --> vmin <= val
-        */
-        case ast_operator::EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          auto const& op1 =
-            _operators.emplace_back(ast_operator::LESS_EQUAL, vmin, operands[1].get());
-          auto const& op2 =
-            _operators.emplace_back(ast_operator::GREATER_EQUAL, vmax, operands[1].get());
-          _operators.emplace_back(ast::ast_operator::LOGICAL_AND, op1, op2);
-          break;
-        }
-        case ast_operator::NOT_EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          auto const& op1  = _operators.emplace_back(ast_operator::NOT_EQUAL, vmin, vmax);
-          auto const& op2 =
-            _operators.emplace_back(ast_operator::NOT_EQUAL, vmax, operands[1].get());
-          _operators.emplace_back(ast_operator::LOGICAL_OR, op1, op2);
-          break;
-        }
-        case ast_operator::LESS: [[fallthrough]];
-        case ast_operator::LESS_EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          _operators.emplace_back(op, vmin, operands[1].get());
-          break;
-        }
-        case ast_operator::GREATER: [[fallthrough]];
-        case ast_operator::GREATER_EQUAL: {
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          _operators.emplace_back(op, vmax, operands[1].get());
-          break;
-        }
-        default: CUDF_FAIL("Unsupported operation in Statistics AST");
-      };
+    if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
+      CUDF_FAIL("Compound types do not have statistics");
     } else {
-      auto new_operands = visit_operands(operands);
-      if (cudf::ast::detail::ast_operator_arity(op) == 2) {
-        _operators.emplace_back(op, new_operands.front(), new_operands.back());
-      } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
-        _operators.emplace_back(op, new_operands.front());
+      auto const num_chunks = static_cast<size_type>(chunks.size());
+      stats_caster::host_column<T> min(num_chunks);
+      stats_caster::host_column<T> max(num_chunks);
+      for (size_type chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        auto const& statistics = chunks[chunk_idx]->statistics;
+        // To support deprecated min, max fields.
+        auto const& min_value =
+          statistics.min_value.has_value() ? statistics.min_value : statistics.min;
+        auto const& max_value =
+          statistics.max_value.has_value() ? statistics.max_value : statistics.max;
+        min.set_index(chunk_idx, min_value, chunks[chunk_idx]->type);
+        max.set_index(chunk_idx, max_value, chunks[chunk_idx]->type);
       }
+      return {min.to_device(dtype, stream, mr), max.to_device(dtype, stream, mr)};
     }
-    _stats_expr = std::reference_wrapper<ast::expression const>(_operators.back());
-    return std::reference_wrapper<ast::expression const>(_operators.back());
   }
+};
 
-  /**
-   * @brief Returns the AST to apply on Column chunk statistics.
-   *
-   * @return AST operation expression
-   */
-  [[nodiscard]] std::reference_wrapper<ast::expression const> get_stats_expr() const
-  {
-    return _stats_expr.value().get();
+/**
+ * @brief Creates an INT64 device column from optional host values, with nulls for missing values.
+ */
+std::unique_ptr<column> make_int64_column(host_span<thrust::optional<int64_t> const> values,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const size = static_cast<size_type>(values.size());
+  std::vector<int64_t> data(size);
+  std::vector<bitmask_type> null_mask(
+    cudf::util::div_rounding_up_safe<size_type>(cudf::bitmask_allocation_size_bytes(size),
+                                                sizeof(bitmask_type)),
+    ~bitmask_type{0});
+  size_type null_count = 0;
+  for (size_type i = 0; i < size; ++i) {
+    if (values[i].has_value()) {
+      data[i] = values[i].value();
+    } else {
+      clear_bit_unsafe(null_mask.data(), i);
+      null_count++;
+    }
   }
+  auto result = std::make_unique<column>(
+    data_type{type_id::INT64},
+    size,
+    cudf::detail::make_device_uvector_sync(data, stream, mr).release(),
+    rmm::device_buffer{null_mask.data(), cudf::bitmask_allocation_size_bytes(size), stream, mr},
+    null_count);
+  stream.synchronize();
+  return result;
+}
 
- private:
-  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
-    std::vector<std::reference_wrapper<ast::expression const>> operands)
-  {
-    std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
-    for (auto const& operand : operands) {
-      auto const new_operand = operand.get().accept(*this);
-      transformed_operands.push_back(new_operand);
+/**
+ * @brief Appends the indices of all columns referenced by the expression.
+ */
+void collect_column_references(ast::expression const& expr, std::vector<size_type>& col_indices)
+{
+  if (auto const* col = dynamic_cast<ast::column_reference const*>(&expr)) {
+    col_indices.push_back(col->get_column_index());
+  } else if (auto const* op = dynamic_cast<ast::operation const*>(&expr)) {
+    for (auto const& operand : op->get_operands()) {
+      collect_column_references(operand.get(), col_indices);
     }
-    return transformed_operands;
   }
-  std::optional<std::reference_wrapper<ast::expression const>> _stats_expr;
-  size_type _num_columns;
-  std::list<ast::column_reference> _col_ref;
-  std::list<ast::operation> _operators;
-};
+}
+
 }  // namespace
 
 std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::filter_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
+  host_span<std::vector<size_type> const> row_group_indices,
+  host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream,
+  filtered_row_ranges* filtered_rows) const
+{
+  // Prune with the (cheap, in-footer) statistics first, so that Bloom filters are only read for
+  // the row groups that survive.
+  auto stats_filtered =
+    filter_row_groups_with_stats(row_group_indices, output_dtypes, filter, stream);
+  if (stats_filtered.has_value()) {
+    row_group_indices = host_span<std::vector<size_type> const>(stats_filtered.value());
+  }
+  // Then with the page statistics from the column indexes, which can rule out row groups whose
+  // chunk-level min/max range spans the predicate but none of whose pages do.
+  auto page_filtered = filter_row_groups_with_page_index(
+    row_group_indices, output_dtypes, output_column_schemas, filter, stream, filtered_rows);
+  if (page_filtered.has_value()) {
+    row_group_indices = host_span<std::vector<size_type> const>(page_filtered.value());
+  }
+  auto bloom_filtered = apply_bloom_filters(
+    sources, row_group_indices, output_dtypes, output_column_schemas, filter, stream);
+  if (bloom_filtered.has_value()) { return bloom_filtered; }
+  return page_filtered.has_value() ? std::move(page_filtered) : std::move(stats_filtered);
+}
+
+std::optional<std::vector<std::vector<size_type>>>
+aggregate_reader_metadata::filter_row_groups_with_stats(
   host_span<std::vector<size_type> const> row_group_indices,
   host_span<data_type const> output_dtypes,
   std::reference_wrapper<ast::expression const> filter,
@@ -428,42 +436,21 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
   }
   auto stats_table = cudf::table(std::move(columns));
 
-  // Converts AST to StatsAST with reference to min, max columns in above `stats_table`.
-  stats_expression_converter stats_expr{filter, static_cast<size_type>(output_dtypes.size())};
-  auto stats_ast     = stats_expr.get_stats_expr();
-  auto predicate_col = cudf::detail::compute_column(stats_table, stats_ast.get(), stream, mr);
-  auto predicate     = predicate_col->view();
-  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
-               "Filter expression must return a boolean column");
-
-  auto num_bitmasks = num_bitmask_words(predicate.size());
-  std::vector<bitmask_type> host_bitmask(num_bitmasks, ~bitmask_type{0});
-  if (predicate.nullable()) {
-    CUDF_CUDA_TRY(cudaMemcpyAsync(host_bitmask.data(),
-                                  predicate.null_mask(),
-                                  num_bitmasks * sizeof(bitmask_type),
-                                  cudaMemcpyDefault,
-                                  stream.value()));
-  }
-  auto validity_it = cudf::detail::make_counting_transform_iterator(
-    0, [bitmask = host_bitmask.data()](auto bit_index) { return bit_is_set(bitmask, bit_index); });
-
-  auto is_row_group_required = cudf::detail::make_std_vector_sync(
-    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+  auto const is_row_group_required = cudf::io::detail::rows_required_by_stats(
+    stats_table, filter.get(), static_cast<size_type>(output_dtypes.size()), stream, mr);
 
   // Return only filtered row groups based on predicate
   // if all are required or all are nulls, return.
-  if (std::all_of(is_row_group_required.cbegin(),
-                  is_row_group_required.cend(),
-                  [](auto i) { return bool(i); }) or
-      predicate.null_count() == predicate.size()) {
+  if (std::all_of(is_row_group_required.cbegin(), is_row_group_required.cend(), [](auto i) {
+        return i;
+      })) {
     return std::nullopt;
   }
   size_type is_required_idx = 0;
   for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
     std::vector<size_type> filtered_row_groups;
     for (auto const rg_idx : input_row_group_indices[src_idx]) {
-      if ((!validity_it[is_required_idx]) || is_row_group_required[is_required_idx]) {
+      if (is_row_group_required[is_required_idx]) {
         filtered_row_groups.push_back(rg_idx);
       }
       ++is_required_idx;
@@ -473,6 +460,294 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
   return {std::move(filtered_row_group_indices)};
 }
 
+std::unique_ptr<table> aggregate_reader_metadata::get_row_group_statistics(
+  host_span<std::vector<size_type> const> row_group_indices,
+  host_span<data_type const> dtypes,
+  host_span<int const> schema_indices,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  std::vector<thrust::optional<int64_t>> num_rows;
+  for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
+    for (auto const rg_idx : row_group_indices[src_idx]) {
+      num_rows.emplace_back(per_file_metadata[src_idx].row_groups[rg_idx].num_rows);
+    }
+  }
+  auto const total_row_groups = static_cast<size_type>(num_rows.size());
+
+  std::vector<std::unique_ptr<column>> columns;
+  columns.push_back(make_int64_column(num_rows, stream, mr));
+  for (size_t col_idx = 0; col_idx < dtypes.size(); ++col_idx) {
+    std::vector<ColumnChunkMetaData const*> chunks;
+    std::vector<thrust::optional<int64_t>> null_counts;
+    std::vector<thrust::optional<int64_t>> sizes;
+    for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
+      for (auto const rg_idx : row_group_indices[src_idx]) {
+        auto const& chunk = get_column_metadata(
+          rg_idx, static_cast<size_type>(src_idx), schema_indices[col_idx]);
+        chunks.push_back(&chunk);
+        null_counts.push_back(chunk.statistics.null_count);
+        sizes.emplace_back(chunk.total_compressed_size);
+      }
+    }
+
+    auto const& dtype = dtypes[col_idx];
+    if ((cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) ||
+        dtype.id() == cudf::type_id::EMPTY) {
+      // all null placeholders for the types without statistics
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, total_row_groups, mask_state::ALL_NULL, stream, mr));
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, total_row_groups, mask_state::ALL_NULL, stream, mr));
+    } else {
+      auto [min_col, max_col] = cudf::type_dispatcher<dispatch_storage_type>(
+        dtype, chunk_stats_caster{chunks}, dtype, stream, mr);
+      columns.push_back(std::move(min_col));
+      columns.push_back(std::move(max_col));
+    }
+    columns.push_back(make_int64_column(null_counts, stream, mr));
+    columns.push_back(make_int64_column(sizes, stream, mr));
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+std::optional<std::vector<std::vector<size_type>>>
+aggregate_reader_metadata::filter_row_groups_with_membership(
+  host_span<std::vector<size_type> const> row_group_indices,
+  data_type dtype,
+  int schema_idx,
+  membership_index const& index,
+  rmm::cuda_stream_view stream) const
+{
+  auto mr = rmm::mr::get_current_device_resource();
+  // Only comparable types with the type of the keys are supported.
+  if ((cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) or
+      dtype != index.keys().type()) {
+    return std::nullopt;
+  }
+
+  std::vector<std::vector<size_type>> all_row_group_indices;
+  if (row_group_indices.empty()) {
+    all_row_group_indices = get_all_row_group_indices();
+    row_group_indices     = host_span<std::vector<size_type> const>(all_row_group_indices);
+  }
+  auto const total_row_groups = std::accumulate(row_group_indices.begin(),
+                                                row_group_indices.end(),
+                                                0,
+                                                [](size_type sum, auto const& per_file_row_groups) {
+                                                  return sum + per_file_row_groups.size();
+                                                });
+  if (total_row_groups == 0) { return std::nullopt; }
+
+  // the column chunks are in the same order in all row groups
+  auto const src_idx = std::distance(
+    row_group_indices.begin(),
+    std::find_if(row_group_indices.begin(), row_group_indices.end(), [](auto const& rg_indices) {
+      return not rg_indices.empty();
+    }));
+  auto const& columns =
+    per_file_metadata[src_idx].row_groups[row_group_indices[src_idx].front()].columns;
+  auto const chunk = std::find_if(columns.cbegin(), columns.cend(), [schema_idx](auto const& col) {
+    return col.schema_idx == schema_idx;
+  });
+  if (chunk == columns.cend()) { return std::nullopt; }
+
+  stats_caster stats_col{total_row_groups, per_file_metadata, row_group_indices};
+  auto [min_col, max_col] = cudf::type_dispatcher<dispatch_storage_type>(
+    dtype, stats_col, std::distance(columns.cbegin(), chunk), dtype, stream, mr);
+  auto const intersects = index.intersects(min_col->view(), max_col->view(), stream, mr);
+
+  auto const is_row_group_required = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(intersects->view().data<uint8_t>(), total_row_groups), stream);
+  if (std::all_of(is_row_group_required.cbegin(), is_row_group_required.cend(), [](auto i) {
+        return i;
+      })) {
+    return std::nullopt;
+  }
+  std::vector<std::vector<size_type>> filtered_row_group_indices;
+  size_type is_required_idx = 0;
+  for (auto const& per_file_row_groups : row_group_indices) {
+    std::vector<size_type> filtered_row_groups;
+    for (auto const rg_idx : per_file_row_groups) {
+      if (is_row_group_required[is_required_idx++]) { filtered_row_groups.push_back(rg_idx); }
+    }
+    filtered_row_group_indices.push_back(std::move(filtered_row_groups));
+  }
+  return {std::move(filtered_row_group_indices)};
+}
+
+std::optional<std::vector<std::vector<size_type>>>
+aggregate_reader_metadata::filter_row_groups_with_page_index(
+  host_span<std::vector<size_type> const> row_group_indices,
+  host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream,
+  filtered_row_ranges* filtered_rows) const
+{
+  auto mr = rmm::mr::get_current_device_resource();
+
+  auto const filter_columns = referenced_column_indices(filter.get());
+  if (filter_columns.empty()) { return std::nullopt; }
+  for (auto const col_idx : filter_columns) {
+    if (col_idx < 0 or col_idx >= static_cast<size_type>(output_column_schemas.size())) {
+      return std::nullopt;
+    }
+    auto const& dtype = output_dtypes[col_idx];
+    if (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) { return std::nullopt; }
+  }
+
+  std::vector<std::vector<size_type>> all_row_group_indices;
+  if (row_group_indices.empty()) {
+    all_row_group_indices = get_all_row_group_indices();
+    row_group_indices     = host_span<std::vector<size_type> const>(all_row_group_indices);
+  }
+
+  // Split each row group at the page boundaries of all filter columns. Row groups where any filter
+  // column lacks a page index get no fragments and are kept as is.
+  std::vector<std::vector<std::pair<ColumnChunk const*, size_type>>> fragment_pages(
+    output_dtypes.size());
+  std::vector<size_type> num_row_group_fragments;
+  // first row of each fragment, relative to the start of its row group
+  std::vector<int64_t> fragment_start_rows;
+  for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
+    for (auto const rg_idx : row_group_indices[src_idx]) {
+      auto const& row_group = per_file_metadata[src_idx].row_groups[rg_idx];
+      std::vector<ColumnChunk const*> chunks;
+      for (auto const col_idx : filter_columns) {
+        auto const schema_idx = output_column_schemas[col_idx];
+        auto const chunk      = std::find_if(
+          row_group.columns.cbegin(), row_group.columns.cend(), [schema_idx](auto const& col) {
+            return col.schema_idx == schema_idx;
+          });
+        if (chunk == row_group.columns.cend() or not chunk->column_index.has_value() or
+            not chunk->offset_index.has_value() or
+            chunk->column_index->null_pages.size() !=
+              chunk->offset_index->page_locations.size() or
+            chunk->offset_index->page_locations.empty()) {
+          break;
+        }
+        chunks.push_back(&*chunk);
+      }
+      if (chunks.size() != filter_columns.size()) {
+        num_row_group_fragments.push_back(0);
+        continue;
+      }
+
+      std::vector<int64_t> fragment_starts;
+      for (auto const* chunk : chunks) {
+        for (auto const& page_loc : chunk->offset_index->page_locations) {
+          if (page_loc.first_row_index < row_group.num_rows) {
+            fragment_starts.push_back(page_loc.first_row_index);
+          }
+        }
+      }
+      std::sort(fragment_starts.begin(), fragment_starts.end());
+      fragment_starts.erase(std::unique(fragment_starts.begin(), fragment_starts.end()),
+                            fragment_starts.end());
+
+      for (auto const start_row : fragment_starts) {
+        for (size_t i = 0; i < filter_columns.size(); ++i) {
+          auto const& page_locs = chunks[i]->offset_index->page_locations;
+          // the last page starting at or before the first row of the fragment
+          auto const page_it = std::upper_bound(
+            page_locs.cbegin(), page_locs.cend(), start_row, [](int64_t row, auto const& loc) {
+              return row < loc.first_row_index;
+            });
+          auto const page_idx =
+            static_cast<size_type>(std::max<std::ptrdiff_t>(0, page_it - page_locs.cbegin() - 1));
+          fragment_pages[filter_columns[i]].emplace_back(chunks[i], page_idx);
+        }
+      }
+      fragment_start_rows.insert(
+        fragment_start_rows.end(), fragment_starts.cbegin(), fragment_starts.cend());
+      num_row_group_fragments.push_back(static_cast<size_type>(fragment_starts.size()));
+    }
+  }
+  auto const total_fragments = std::accumulate(
+    num_row_group_fragments.cbegin(), num_row_group_fragments.cend(), size_type{0});
+  if (total_fragments == 0) { return std::nullopt; }
+
+  // Converts page statistics to a table of min(col[i]) = columns[i*2], max(col[i]) = columns[i*2+1]
+  // with one row per fragment
+  std::vector<std::unique_ptr<column>> columns;
+  page_stats_caster stats_col{total_fragments, fragment_pages};
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
+    auto const& dtype = output_dtypes[col_idx];
+    if (fragment_pages[col_idx].empty()) {
+      // placeholder only for columns not referenced by the filter
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, total_fragments, rmm::device_buffer{}, 0, stream, mr));
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, total_fragments, rmm::device_buffer{}, 0, stream, mr));
+      continue;
+    }
+    auto [min_col, max_col] =
+      cudf::type_dispatcher<dispatch_storage_type>(dtype, stats_col, col_idx, dtype, stream, mr);
+    columns.push_back(std::move(min_col));
+    columns.push_back(std::move(max_col));
+  }
+  auto stats_table = cudf::table(std::move(columns));
+
+  auto const is_fragment_required = cudf::io::detail::rows_required_by_stats(
+    stats_table, filter.get(), static_cast<size_type>(output_dtypes.size()), stream, mr);
+
+  // A row group is required if it has no fragments or any of its fragments is required. The rows
+  // of the required fragments, with adjacent fragments merged, may satisfy the filter.
+  bool any_filtered = false;
+  std::vector<std::vector<size_type>> filtered_row_group_indices;
+  size_type rg_count     = 0;
+  size_type fragment_idx = 0;
+  for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
+    std::vector<size_type> filtered_row_groups;
+    for (auto const rg_idx : row_group_indices[src_idx]) {
+      auto const num_fragments = num_row_group_fragments[rg_count++];
+      auto const frag_begin    = fragment_idx;
+      fragment_idx += num_fragments;
+      if (num_fragments == 0) {
+        filtered_row_groups.push_back(rg_idx);
+        continue;
+      }
+      auto const num_rows = per_file_metadata[src_idx].row_groups[rg_idx].num_rows;
+      std::vector<std::pair<size_t, size_t>> row_ranges;
+      for (auto i = frag_begin; i < fragment_idx; ++i) {
+        if (not is_fragment_required[i]) { continue; }
+        auto const begin = static_cast<size_t>(fragment_start_rows[i]);
+        auto const end =
+          static_cast<size_t>(i + 1 < fragment_idx ? fragment_start_rows[i + 1] : num_rows);
+        if (not row_ranges.empty() and row_ranges.back().second == begin) {
+          row_ranges.back().second = end;
+        } else {
+          row_ranges.emplace_back(begin, end);
+        }
+      }
+      if (row_ranges.empty()) {
+        any_filtered = true;
+        continue;
+      }
+      filtered_row_groups.push_back(rg_idx);
+      auto const all_rows = row_ranges.size() == 1 and row_ranges.front().first == 0 and
+                            row_ranges.front().second == static_cast<size_t>(num_rows);
+      if (filtered_rows != nullptr and not all_rows) {
+        filtered_rows->insert_or_assign({static_cast<size_type>(src_idx), rg_idx},
+                                        std::move(row_ranges));
+      }
+    }
+    filtered_row_group_indices.push_back(std::move(filtered_row_groups));
+  }
+  if (not any_filtered) { return std::nullopt; }
+  return {std::move(filtered_row_group_indices)};
+}
+
+std::vector<size_type> referenced_column_indices(ast::expression const& expr)
+{
+  std::vector<size_type> col_indices;
+  collect_column_references(expr, col_indices);
+  std::sort(col_indices.begin(), col_indices.end());
+  col_indices.erase(std::unique(col_indices.begin(), col_indices.end()), col_indices.end());
+  return col_indices;
+}
+
 // convert column named expression to column index reference expression
 std::reference_wrapper<ast::expression const> named_to_reference_converter::visit(
   ast::literal const& expr)
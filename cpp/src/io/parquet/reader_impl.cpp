@@ -17,12 +17,26 @@
 #include "reader_impl.hpp"
 
 #include "error.hpp"
+#include "metadata_cache.hpp"
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/search.hpp>
+#include <cudf/utilities/bit.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
 #include <bitset>
 #include <numeric>
 
@@ -100,12 +114,25 @@ void reader::impl::decode_page_data(bool uses_custom_row_bounds, size_t skip_row
   auto chunk_nested_str_data =
     cudf::detail::hostdevice_vector<void*>(has_strings ? sum_max_depths : 0, _stream);
 
+  // The chunks of a dictionary column index into the keys of all its chunks, in chunk order
+  auto const dict_key_counts = dictionary_key_counts();
+  std::vector<int64_t> column_dict_keys(_input_columns.size(), 0);
+
   // Update chunks with pointers to column data.
   for (size_t c = 0, chunk_off = 0; c < pass.chunks.size(); c++) {
     input_column_info const& input_col = _input_columns[pass.chunks[c].src_col_index];
     CUDF_EXPECTS(input_col.schema_idx == pass.chunks[c].src_col_schema,
                  "Column/page schema index mismatch");
 
+    if (is_dictionary_column(input_col.schema_idx)) {
+      auto& num_keys                 = column_dict_keys[pass.chunks[c].src_col_index];
+      pass.chunks[c].dict_key_offset = static_cast<int32_t>(num_keys);
+      num_keys += dict_key_counts[c];
+      CUDF_EXPECTS(num_keys <= std::numeric_limits<size_type>::max(),
+                   "Dictionary keys exceed the column size limit",
+                   std::overflow_error);
+    }
+
     size_t max_depth = _metadata->get_output_nesting_depth(pass.chunks[c].src_col_schema);
     chunk_offsets.push_back(chunk_off);
 
@@ -243,6 +270,18 @@ void reader::impl::decode_page_data(bool uses_custom_row_bounds, size_t skip_row
                         num_rows,
                         skip_rows,
                         level_type_size,
+                        false,
+                        error_code.data(),
+                        streams[s_idx++]);
+  }
+
+  if (BitAnd(kernel_mask, decode_kernel_mask::FIXED_WIDTH_NO_DICT_LIST) != 0) {
+    DecodePageDataFixed(subpass.pages,
+                        pass.chunks,
+                        num_rows,
+                        skip_rows,
+                        level_type_size,
+                        true,
                         error_code.data(),
                         streams[s_idx++]);
   }
@@ -253,6 +292,18 @@ void reader::impl::decode_page_data(bool uses_custom_row_bounds, size_t skip_row
                             num_rows,
                             skip_rows,
                             level_type_size,
+                            false,
+                            error_code.data(),
+                            streams[s_idx++]);
+  }
+
+  if (BitAnd(kernel_mask, decode_kernel_mask::FIXED_WIDTH_DICT_LIST) != 0) {
+    DecodePageDataFixedDict(subpass.pages,
+                            pass.chunks,
+                            num_rows,
+                            skip_rows,
+                            level_type_size,
+                            true,
                             error_code.data(),
                             streams[s_idx++]);
   }
@@ -338,6 +389,14 @@ void reader::impl::decode_page_data(bool uses_custom_row_bounds, size_t skip_row
       if (chunk_nested_valids.host_ptr(chunk_offsets[pi->chunk_idx])[l_idx] == nullptr) {
         continue;
       }
+      // skipped pages are not decoded and leave all of their rows in the output chunk null
+      if (pi->flags & PAGEINFO_FLAGS_SKIPPED) {
+        auto const page_begin = col->start_row + pi->chunk_row;
+        auto const begin      = std::max(page_begin, skip_rows);
+        auto const end        = std::min(page_begin + pi->num_rows, skip_rows + num_rows);
+        if (begin < end) { out_buf.null_count() += end - begin; }
+        continue;
+      }
       out_buf.null_count() += pndi[l_idx].null_count;
     }
   }
@@ -345,6 +404,84 @@ void reader::impl::decode_page_data(bool uses_custom_row_bounds, size_t skip_row
   _stream.synchronize();
 }
 
+std::vector<size_type> reader::impl::dictionary_key_counts() const
+{
+  auto const& pass = *_pass_itm_data;
+
+  std::vector<size_type> key_counts(pass.chunks.size(), 0);
+  if (_dictionary_schemas.empty()) { return key_counts; }
+  for (size_t idx = 0; idx < pass.pages.size(); idx++) {
+    auto const& page = pass.pages[idx];
+    if (not is_dictionary_column(pass.chunks[page.chunk_idx].src_col_schema)) { continue; }
+    if (page.flags & PAGEINFO_FLAGS_DICTIONARY) {
+      key_counts[page.chunk_idx] = page.num_input_values;
+    } else {
+      // the column metadata claimed that every data page is dictionary-encoded
+      CUDF_EXPECTS(
+        page.encoding == Encoding::PLAIN_DICTIONARY or page.encoding == Encoding::RLE_DICTIONARY,
+        "Dictionary column contains a page that is not dictionary-encoded");
+    }
+  }
+  return key_counts;
+}
+
+void reader::impl::make_dictionary_columns(std::vector<std::unique_ptr<column>>& out_columns)
+{
+  if (_dictionary_schemas.empty()) { return; }
+
+  auto const& pass      = *_pass_itm_data;
+  auto const key_counts = dictionary_key_counts();
+  for (size_t i = 0; i < out_columns.size(); ++i) {
+    auto const schema_idx = _output_column_schemas[i];
+    if (not is_dictionary_column(schema_idx)) { continue; }
+
+    // gather the string index pairs of the dictionary pages of all the chunks of the column
+    size_type num_keys = 0;
+    for (size_t c = 0; c < pass.chunks.size(); c++) {
+      if (pass.chunks[c].src_col_schema == schema_idx) { num_keys += key_counts[c]; }
+    }
+    rmm::device_uvector<string_index_pair> chunk_keys(num_keys, _stream);
+    size_type keys_offset = 0;
+    for (size_t c = 0; c < pass.chunks.size(); c++) {
+      if (pass.chunks[c].src_col_schema != schema_idx or key_counts[c] == 0) { continue; }
+      CUDF_CUDA_TRY(cudaMemcpyAsync(chunk_keys.data() + keys_offset,
+                                    pass.chunks[c].str_dict_index,
+                                    key_counts[c] * sizeof(string_index_pair),
+                                    cudaMemcpyDefault,
+                                    _stream.value()));
+      keys_offset += key_counts[c];
+    }
+
+    // sort and deduplicate the keys, keeping the unique key index of each chunk key
+    auto const chunk_strings =
+      cudf::make_strings_column(chunk_keys, _stream, rmm::mr::get_current_device_resource());
+    auto const encoded = cudf::dictionary::detail::encode(
+      chunk_strings->view(), data_type{type_id::UINT32}, _stream, _mr);
+    auto encoded_contents = encoded->release();
+    auto& children        = encoded_contents.children;
+    auto keys             = std::move(children[dictionary_column_view::keys_column_index]);
+    auto key_indices      = std::move(children[dictionary_column_view::indices_column_index]);
+
+    // the decoded values of the null rows are undefined, so out of bounds ones are nullified
+    auto const decoded = out_columns[i]->view();
+    auto const decoded_indices =
+      column_view(decoded.type(), decoded.size(), decoded.head(), nullptr, 0);
+    auto indices = std::move(cudf::detail::gather(table_view{{key_indices->view()}},
+                                                  decoded_indices,
+                                                  out_of_bounds_policy::NULLIFY,
+                                                  cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                  _stream,
+                                                  _mr)
+                               ->release()
+                               .front());
+    auto const null_count = decoded.null_count();
+    indices->set_null_mask(std::move(*out_columns[i]->release().null_mask), null_count);
+
+    out_columns[i] =
+      cudf::make_dictionary_column(std::move(keys), std::move(indices), _stream, _mr);
+  }
+}
+
 reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                    parquet_reader_options const& options,
                    rmm::cuda_stream_view stream,
@@ -371,7 +508,12 @@ reader::impl::impl(std::size_t chunk_read_limit,
     _input_pass_read_limit{pass_read_limit}
 {
   // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_reader_metadata>(_sources);
+  auto const cache_keys =
+    options.is_enabled_use_metadata_cache()
+      ? metadata_cache_keys(
+          options.get_source(), options.get_metadata_cache_keys(), _sources.size())
+      : std::vector<std::string>{};
+  _metadata = std::make_unique<aggregate_reader_metadata>(_sources, cache_keys);
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -384,6 +526,20 @@ reader::impl::impl(std::size_t chunk_read_limit,
   // Binary columns can be read as binary or strings
   _reader_column_schema = options.get_column_schema();
 
+  _late_materialization = options.is_enabled_late_materialization();
+
+  _join_filter         = options.get_join_filter();
+  _join_filter_columns = options.get_join_filter_columns();
+
+  _membership_filter        = options.get_membership_filter();
+  _membership_filter_column = options.get_membership_filter_column();
+
+  // Row groups are selected by the byte range with the (possibly cached) footers
+  if (options.get_byte_range_offset() != 0 or options.get_byte_range_size() != 0) {
+    _byte_range_row_groups = _metadata->get_row_group_indices_in_byte_range(
+      options.get_byte_range_offset(), options.get_byte_range_size());
+  }
+
   // Select only columns required by the options
   std::tie(_input_columns, _output_buffers, _output_column_schemas) =
     _metadata->select_columns(options.get_columns(),
@@ -391,6 +547,25 @@ reader::impl::impl(std::size_t chunk_read_limit,
                               _strings_to_categorical,
                               _timestamp_type.id());
 
+  // Dictionary-encoded string columns may be returned as dictionary columns. Filters are
+  // evaluated on the strings, so the columns are then returned as strings.
+  if (options.is_enabled_keep_dictionaries() and not options.get_filter().has_value() and
+      not _join_filter.has_value() and not _membership_filter.has_value()) {
+    for (size_t i = 0; i < _output_buffers.size(); ++i) {
+      auto const schema_idx = _output_column_schemas[i];
+      auto const& schema    = _metadata->get_schema(schema_idx);
+      auto const is_binary  = _reader_column_schema.has_value() and
+                             not(*_reader_column_schema)[i].is_enabled_convert_binary_to_strings();
+      if (_output_buffers[i].type.id() == type_id::STRING and schema.type == BYTE_ARRAY and
+          schema.num_children == 0 and not is_binary and
+          _metadata->is_dictionary_encoded(schema_idx)) {
+        // the rows are decoded as indices into the keys of the dictionary pages
+        _output_buffers[i].type = data_type{type_id::INT32};
+        _dictionary_schemas.insert(schema_idx);
+      }
+    }
+  }
+
   // Save the states of the output buffers for reuse in `chunk_read()`.
   for (auto const& buff : _output_buffers) {
     _output_buffers_template.emplace_back(cudf::io::detail::inline_column_buffer::empty_like(buff));
@@ -403,6 +578,10 @@ void reader::impl::prepare_data(int64_t skip_rows,
                                 host_span<std::vector<size_type> const> row_group_indices,
                                 std::optional<std::reference_wrapper<ast::expression const>> filter)
 {
+  if (row_group_indices.empty() and _byte_range_row_groups.has_value()) {
+    row_group_indices = *_byte_range_row_groups;
+  }
+
   // if we have not preprocessed at the whole-file level, do that now
   if (!_file_preprocessed) {
     // setup file level information
@@ -477,14 +656,62 @@ table_with_metadata reader::impl::read_chunk_internal(
     }
   }
 
-  // Add empty columns if needed. Filter output columns based on filter.
-  return finalize_output(out_metadata, out_columns, filter);
+  // Replace the decoded indices of the dictionary columns by dictionary columns
+  make_dictionary_columns(out_columns);
+
+  // Add empty columns if needed. Filter output columns based on filter and the rows of the
+  // skipped pages.
+  auto const filtered_rows = filter.has_value()
+                               ? filtered_rows_mask(read_info.skip_rows, read_info.num_rows)
+                               : nullptr;
+  return finalize_output(out_metadata, out_columns, filter, filtered_rows.get());
+}
+
+std::unique_ptr<column> reader::impl::filtered_rows_mask(size_t skip_rows, size_t num_rows) const
+{
+  auto const& row_groups = _file_itm_data.row_groups;
+  auto const end_row     = skip_rows + num_rows;
+  if (std::none_of(row_groups.cbegin(), row_groups.cend(), [&](auto const& rg) {
+        return rg.filtered_rows.has_value() and rg.start_row < end_row;
+      })) {
+    return nullptr;
+  }
+
+  std::vector<bool> is_row_required(num_rows, true);
+  // clears the rows in `[begin, end)` of the row group that lie in the output chunk
+  auto const clear_rows = [&](row_group_info const& rg, size_t begin, size_t end) {
+    begin = std::max(rg.start_row + begin, skip_rows);
+    end   = std::min(rg.start_row + end, end_row);
+    for (auto row = begin; row < end; ++row) {
+      is_row_required[row - skip_rows] = false;
+    }
+  };
+  for (auto const& rg : row_groups) {
+    if (not rg.filtered_rows.has_value()) { continue; }
+    // rows before, between and after the filtered ranges are not required
+    size_t unfiltered_begin = 0;
+    for (auto const& [begin, end] : rg.filtered_rows.value()) {
+      clear_rows(rg, unfiltered_begin, begin);
+      unfiltered_begin = end;
+    }
+    clear_rows(rg, unfiltered_begin, _metadata->get_row_group(rg.index, rg.source_index).num_rows);
+  }
+
+  std::vector<uint8_t> const h_mask(is_row_required.cbegin(), is_row_required.cend());
+  return std::make_unique<column>(
+    data_type{type_id::BOOL8},
+    static_cast<size_type>(num_rows),
+    cudf::detail::make_device_uvector_sync(h_mask, _stream, rmm::mr::get_current_device_resource())
+      .release(),
+    rmm::device_buffer{},
+    0);
 }
 
 table_with_metadata reader::impl::finalize_output(
   table_metadata& out_metadata,
   std::vector<std::unique_ptr<column>>& out_columns,
-  std::optional<std::reference_wrapper<ast::expression const>> filter)
+  std::optional<std::reference_wrapper<ast::expression const>> filter,
+  column const* filtered_rows)
 {
   // Create empty columns as needed (this can happen if we've ended up with no actual data to read)
   for (size_t i = out_columns.size(); i < _output_buffers.size(); ++i) {
@@ -494,6 +721,12 @@ table_with_metadata reader::impl::finalize_output(
     } else {
       out_columns.emplace_back(io::detail::empty_like(_output_buffers[i], nullptr, _stream, _mr));
     }
+    if (is_dictionary_column(_output_column_schemas[i])) {
+      out_columns.back() = cudf::make_dictionary_column(cudf::make_empty_column(type_id::STRING),
+                                                        cudf::make_empty_column(type_id::UINT32),
+                                                        _stream,
+                                                        _mr);
+    }
   }
 
   if (!_output_metadata) {
@@ -510,16 +743,63 @@ table_with_metadata reader::impl::finalize_output(
     _file_itm_data._output_chunk_count++;
   }
 
+  auto read_table = std::make_unique<table>(std::move(out_columns));
   if (filter.has_value()) {
-    auto read_table = std::make_unique<table>(std::move(out_columns));
-    auto predicate  = cudf::detail::compute_column(
+    auto predicate = cudf::detail::compute_column(
       *read_table, filter.value().get(), _stream, rmm::mr::get_current_device_resource());
     CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
                  "Predicate filter should return a boolean");
-    auto output_table = cudf::detail::apply_boolean_mask(*read_table, *predicate, _stream, _mr);
-    return {std::move(output_table), std::move(out_metadata)};
+    // the rows of skipped pages are null in the output, which does not mean that they fail every
+    // filter (e.g. `IS_NULL`), so they are dropped explicitly
+    if (filtered_rows != nullptr) {
+      predicate = cudf::detail::binary_operation(predicate->view(),
+                                                 filtered_rows->view(),
+                                                 binary_operator::NULL_LOGICAL_AND,
+                                                 data_type{type_id::BOOL8},
+                                                 _stream,
+                                                 rmm::mr::get_current_device_resource());
+    }
+    read_table = cudf::detail::apply_boolean_mask(*read_table, *predicate, _stream, _mr);
+  }
+  if (_join_filter.has_value()) {
+    read_table = apply_join_filter(std::move(read_table), out_metadata);
   }
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  if (_membership_filter.has_value()) {
+    read_table = apply_membership_filter(std::move(read_table), out_metadata);
+  }
+  return {std::move(read_table), std::move(out_metadata)};
+}
+
+std::unique_ptr<table> reader::impl::apply_join_filter(std::unique_ptr<table> read_table,
+                                                       table_metadata const& metadata)
+{
+  auto const& schema = metadata.schema_info;
+  std::vector<column_view> key_columns;
+  for (auto const& name : _join_filter_columns) {
+    auto const it = std::find_if(
+      schema.cbegin(), schema.cend(), [&](auto const& info) { return info.name == name; });
+    CUDF_EXPECTS(it != schema.cend(), "Join filter key column " + name + " is not read");
+    key_columns.push_back(read_table->get_column(std::distance(schema.cbegin(), it)).view());
+  }
+  auto const matches = _join_filter.value().get().contains(
+    table_view{key_columns}, _stream, rmm::mr::get_current_device_resource());
+  return cudf::detail::apply_boolean_mask(read_table->view(), matches->view(), _stream, _mr);
+}
+
+std::unique_ptr<table> reader::impl::apply_membership_filter(std::unique_ptr<table> read_table,
+                                                             table_metadata const& metadata)
+{
+  auto const& schema = metadata.schema_info;
+  auto const it      = std::find_if(schema.cbegin(), schema.cend(), [&](auto const& info) {
+    return info.name == _membership_filter_column;
+  });
+  CUDF_EXPECTS(it != schema.cend(),
+               "Membership filter column " + _membership_filter_column + " is not read");
+  auto const matches = _membership_filter.value().get().contains(
+    read_table->get_column(std::distance(schema.cbegin(), it)).view(),
+    _stream,
+    rmm::mr::get_current_device_resource());
+  return cudf::detail::apply_boolean_mask(read_table->view(), matches->view(), _stream, _mr);
 }
 
 table_with_metadata reader::impl::read(
@@ -536,10 +816,209 @@ table_with_metadata reader::impl::read(
   auto expr_conv     = named_to_reference_converter(filter, metadata);
   auto output_filter = expr_conv.get_converted_expr();
 
+  if (row_group_indices.empty() and _byte_range_row_groups.has_value()) {
+    row_group_indices = *_byte_range_row_groups;
+  }
+
+  if (_late_materialization and output_filter.has_value() and not uses_custom_row_bounds) {
+    auto late_materialized =
+      read_with_late_materialization(row_group_indices, output_filter.value().get(), metadata);
+    if (late_materialized.has_value()) { return std::move(late_materialized.value()); }
+  }
+
   prepare_data(skip_rows, num_rows, uses_custom_row_bounds, row_group_indices, output_filter);
   return read_chunk_internal(uses_custom_row_bounds, output_filter);
 }
 
+std::optional<table_with_metadata> reader::impl::read_with_late_materialization(
+  host_span<std::vector<size_type> const> row_group_indices,
+  ast::expression const& filter,
+  table_metadata const& metadata)
+{
+  auto const filter_columns = referenced_column_indices(filter);
+  if (filter_columns.empty() or filter_columns.size() >= _output_buffers.size()) {
+    return std::nullopt;
+  }
+  for (auto const col_idx : filter_columns) {
+    if (col_idx < 0 or col_idx >= static_cast<size_type>(_output_buffers.size())) {
+      return std::nullopt;
+    }
+    // nested columns cannot be selected by their top-level name alone
+    auto const& schema = _metadata->get_schema(_output_column_schemas[col_idx]);
+    if (schema.num_children != 0) { return std::nullopt; }
+  }
+  std::vector<size_type> other_columns;
+  for (size_type col_idx = 0; col_idx < static_cast<size_type>(_output_buffers.size());
+       ++col_idx) {
+    if (not std::binary_search(filter_columns.cbegin(), filter_columns.cend(), col_idx)) {
+      other_columns.push_back(col_idx);
+    }
+  }
+
+  // Prune with the metadata first so that only the candidate row groups are decoded
+  std::vector<data_type> output_types;
+  std::transform(_output_buffers.cbegin(),
+                 _output_buffers.cend(),
+                 std::back_inserter(output_types),
+                 [](auto const& col) { return col.type; });
+  auto candidate_row_groups = _metadata->filter_row_groups(
+    _sources, row_group_indices, output_types, _output_column_schemas, filter, _stream);
+  if (not candidate_row_groups.has_value()) {
+    candidate_row_groups = row_group_indices.empty()
+                             ? _metadata->get_all_row_group_indices()
+                             : std::vector<std::vector<size_type>>(row_group_indices.begin(),
+                                                                   row_group_indices.end());
+  }
+
+  // Reads the given output columns of the given row groups with a separate reader over
+  // non-owning views of our sources. `selected_rows` lets it skip the pages without such rows.
+  auto const temp_mr      = rmm::mr::get_current_device_resource();
+  auto const read_columns = [&](std::vector<size_type> const& col_indices,
+                                std::vector<std::vector<size_type>> const& row_groups,
+                                filtered_row_ranges&& selected_rows) {
+    std::vector<std::string> column_names;
+    std::vector<reader_column_schema> column_schema;
+    for (auto const col_idx : col_indices) {
+      column_names.push_back(metadata.schema_info[col_idx].name);
+      if (_reader_column_schema.has_value()) {
+        column_schema.push_back((*_reader_column_schema)[col_idx]);
+      }
+    }
+    parquet_reader_options options;
+    options.set_columns(column_names);
+    options.set_row_groups(row_groups);
+    options.enable_convert_strings_to_categories(_strings_to_categorical);
+    options.enable_use_pandas_metadata(false);
+    options.set_timestamp_type(_timestamp_type);
+    if (_reader_column_schema.has_value()) { options.set_column_schema(std::move(column_schema)); }
+
+    std::vector<std::unique_ptr<datasource>> sources;
+    std::transform(_sources.begin(),
+                   _sources.end(),
+                   std::back_inserter(sources),
+                   [](auto& source) { return datasource::create(source.get()); });
+    impl reader(std::move(sources), options, _stream, temp_mr);
+    reader._selected_rows = std::move(selected_rows);
+    return reader.read(0, std::nullopt, false, options.get_row_groups(), std::nullopt);
+  };
+  // Returns the index of the column read for the given output column
+  auto const find_column = [&](table_with_metadata const& read, size_type col_idx) {
+    auto const& name   = metadata.schema_info[col_idx].name;
+    auto const& schema = read.metadata.schema_info;
+    auto const it      = std::find_if(
+      schema.cbegin(), schema.cend(), [&name](auto const& info) { return info.name == name; });
+    CUDF_EXPECTS(it != schema.cend(), "Output column not found in the columns read");
+    return static_cast<size_type>(std::distance(schema.cbegin(), it));
+  };
+
+  // Decode the filter columns of the candidate row groups and evaluate the filter over a table laid
+  // out like the output table. Columns not referenced by the filter are stand-ins with the right
+  // number of rows.
+  auto const filtered      = read_columns(filter_columns, candidate_row_groups.value(), {});
+  auto const filtered_view = filtered.tbl->view();
+  std::vector<column_view> eval_columns(_output_buffers.size(), filtered_view.column(0));
+  for (auto const col_idx : filter_columns) {
+    eval_columns[col_idx] = filtered_view.column(find_column(filtered, col_idx));
+  }
+  auto const predicate =
+    cudf::detail::compute_column(table_view{eval_columns}, filter, _stream, temp_mr);
+  CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+               "Predicate filter should return a boolean");
+
+  // A row matches if the predicate is valid and true
+  auto const num_rows = predicate->size();
+  std::vector<bitmask_type> null_mask(num_bitmask_words(num_rows), ~bitmask_type{0});
+  if (predicate->nullable()) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(null_mask.data(),
+                                  predicate->view().null_mask(),
+                                  null_mask.size() * sizeof(bitmask_type),
+                                  cudaMemcpyDefault,
+                                  _stream.value()));
+  }
+  auto const is_row_true = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate->view().data<uint8_t>(), num_rows), _stream);
+
+  // The other columns are only read from the row groups with matches, and only the pages holding
+  // matching rows are decoded. `selected_matches` are the matches among the rows of these row
+  // groups.
+  std::vector<std::vector<size_type>> selected_row_groups;
+  filtered_row_ranges selected_rows;
+  std::vector<uint8_t> selected_matches;
+  size_type row_offset = 0;
+  for (size_t src_idx = 0; src_idx < candidate_row_groups->size(); ++src_idx) {
+    std::vector<size_type> src_row_groups;
+    for (auto const rg_idx : (*candidate_row_groups)[src_idx]) {
+      auto const rg_num_rows =
+        static_cast<size_type>(_metadata->get_row_group(rg_idx, src_idx).num_rows);
+      std::vector<std::pair<size_t, size_t>> row_ranges;
+      for (size_type row = 0; row < rg_num_rows; ++row) {
+        auto const idx = row_offset + row;
+        if (not(bit_is_set(null_mask.data(), idx) and is_row_true[idx])) { continue; }
+        if (not row_ranges.empty() and row_ranges.back().second == static_cast<size_t>(row)) {
+          row_ranges.back().second++;
+        } else {
+          row_ranges.emplace_back(row, row + 1);
+        }
+      }
+      if (not row_ranges.empty()) {
+        src_row_groups.push_back(rg_idx);
+        std::transform(is_row_true.cbegin() + row_offset,
+                       is_row_true.cbegin() + row_offset + rg_num_rows,
+                       thrust::make_counting_iterator(row_offset),
+                       std::back_inserter(selected_matches),
+                       [&](auto is_true, size_type row) {
+                         return static_cast<uint8_t>(is_true and bit_is_set(null_mask.data(), row));
+                       });
+        selected_rows.emplace(std::pair{static_cast<size_type>(src_idx), rg_idx},
+                              std::move(row_ranges));
+      }
+      row_offset += rg_num_rows;
+    }
+    selected_row_groups.push_back(std::move(src_row_groups));
+  }
+
+  // Keep the matching rows of the filter columns that were already decoded, and read the others
+  auto filter_table =
+    cudf::detail::apply_boolean_mask(filtered_view, predicate->view(), _stream, _mr)->release();
+  auto const others = read_columns(other_columns, selected_row_groups, std::move(selected_rows));
+  CUDF_EXPECTS(static_cast<size_t>(others.tbl->num_rows()) == selected_matches.size(),
+               "Unexpected number of rows read for the selected row groups");
+  auto const matches_mask = std::make_unique<column>(
+    data_type{type_id::BOOL8},
+    static_cast<size_type>(selected_matches.size()),
+    cudf::detail::make_device_uvector_sync(selected_matches, _stream, temp_mr).release(),
+    rmm::device_buffer{},
+    0);
+  auto other_table =
+    cudf::detail::apply_boolean_mask(others.tbl->view(), matches_mask->view(), _stream, _mr)
+      ->release();
+
+  // Lay the columns out like the output table
+  table_metadata out_metadata;
+  out_metadata.schema_info.resize(_output_buffers.size());
+  std::vector<std::unique_ptr<column>> out_columns(_output_buffers.size());
+  for (auto const col_idx : filter_columns) {
+    auto const read_idx               = find_column(filtered, col_idx);
+    out_columns[col_idx]              = std::move(filter_table[read_idx]);
+    out_metadata.schema_info[col_idx] = filtered.metadata.schema_info[read_idx];
+  }
+  for (auto const col_idx : other_columns) {
+    auto const read_idx               = find_column(others, col_idx);
+    out_columns[col_idx]              = std::move(other_table[read_idx]);
+    out_metadata.schema_info[col_idx] = others.metadata.schema_info[read_idx];
+  }
+  populate_metadata(out_metadata);
+
+  auto read_table = std::make_unique<table>(std::move(out_columns));
+  if (_join_filter.has_value()) {
+    read_table = apply_join_filter(std::move(read_table), out_metadata);
+  }
+  if (_membership_filter.has_value()) {
+    read_table = apply_membership_filter(std::move(read_table), out_metadata);
+  }
+  return table_with_metadata{std::move(read_table), std::move(out_metadata)};
+}
+
 table_with_metadata reader::impl::read_chunk()
 {
   // Reset the output buffers to their original states (right after reader construction).
@@ -596,4 +1075,86 @@ parquet_metadata read_parquet_metadata(host_span<std::unique_ptr<datasource> con
                           metadata.get_key_value_metadata()[0]};
 }
 
+table_with_metadata read_statistics(host_span<std::unique_ptr<datasource> const> sources,
+                                    parquet_reader_options const& options,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const metadata = aggregate_reader_metadata(sources);
+  // the statistics are in the types of the file, without the conversions of the reader
+  auto const input_columns = std::get<0>(metadata.select_columns(
+    options.get_columns(), options.is_enabled_use_pandas_metadata(), false, type_id::EMPTY));
+  auto const row_groups = options.get_row_groups().empty() ? metadata.get_all_row_group_indices()
+                                                           : options.get_row_groups();
+
+  std::vector<data_type> dtypes;
+  std::vector<int> schema_indices;
+  table_metadata out_metadata;
+  out_metadata.schema_info.emplace_back("num_rows");
+  for (auto const& column : input_columns) {
+    auto const& schema = metadata.get_schema(column.schema_idx);
+    dtypes.push_back(to_data_type(to_type_id(schema, false, type_id::EMPTY), schema));
+    schema_indices.push_back(column.schema_idx);
+
+    // dot-separated path of the column from the root of the schema
+    auto path = schema.name;
+    for (auto idx = schema.parent_idx; idx > 0; idx = metadata.get_schema(idx).parent_idx) {
+      path = metadata.get_schema(idx).name + "." + path;
+    }
+    for (auto const* statistic : {".min", ".max", ".null_count", ".size"}) {
+      out_metadata.schema_info.emplace_back(path + statistic);
+    }
+  }
+  return {metadata.get_row_group_statistics(row_groups, dtypes, schema_indices, stream, mr),
+          std::move(out_metadata)};
+}
+
+memory_estimate estimate_read_memory(host_span<std::unique_ptr<datasource> const> sources,
+                                     parquet_reader_options const& options)
+{
+  auto const metadata = aggregate_reader_metadata(sources);
+  auto const input_columns =
+    std::get<0>(metadata.select_columns(options.get_columns(),
+                                        options.is_enabled_use_pandas_metadata(),
+                                        options.is_enabled_convert_strings_to_categories(),
+                                        options.get_timestamp_type().id()));
+  auto const row_groups = options.get_row_groups().empty() ? metadata.get_all_row_group_indices()
+                                                           : options.get_row_groups();
+
+  // decoded width of the values of a physical type, or of the offsets of byte arrays
+  auto const value_width = [](Type type) -> std::size_t {
+    switch (type) {
+      case BOOLEAN: return 1;
+      case INT32:
+      case FLOAT: return 4;
+      case INT96: return 12;
+      case BYTE_ARRAY:
+      case FIXED_LEN_BYTE_ARRAY: return sizeof(size_type);
+      default: return 8;
+    }
+  };
+
+  memory_estimate estimate{};
+  for (std::size_t src = 0; src < row_groups.size(); ++src) {
+    for (auto const row_group : row_groups[src]) {
+      for (auto const& column : input_columns) {
+        auto const& chunk =
+          metadata.get_column_metadata(row_group, static_cast<size_type>(src), column.schema_idx);
+        // the raw column chunks, then the decompressed pages, are held until the pages are decoded
+        estimate.temporary_bytes += chunk.total_compressed_size;
+        if (chunk.codec != UNCOMPRESSED) {
+          estimate.temporary_bytes += chunk.total_uncompressed_size;
+        }
+        // dictionary-encoded values are smaller than the decoded ones, which take at least their
+        // width and a null mask bit per value
+        auto const num_values    = static_cast<std::size_t>(chunk.num_values);
+        auto const decoded_bytes = num_values * value_width(chunk.type) + num_values / 8;
+        estimate.output_bytes +=
+          std::max<std::size_t>(chunk.total_uncompressed_size, decoded_bytes);
+      }
+    }
+  }
+  return estimate;
+}
+
 }  // namespace cudf::io::parquet::detail
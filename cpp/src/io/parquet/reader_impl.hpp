@@ -34,6 +34,7 @@
 
 #include <memory>
 #include <optional>
+#include <unordered_set>
 #include <vector>
 
 namespace cudf::io::parquet::detail {
@@ -123,6 +124,27 @@ class reader::impl {
   // top level functions involved with ratcheting through the passes, subpasses
   // and output chunks of the read process
  private:
+  /**
+   * @brief Reads the rows that satisfy the filter by decoding the filter columns first.
+   *
+   * The row groups are first pruned with the metadata (statistics, page indexes and Bloom filters),
+   * then the filter columns of the remaining row groups are decoded with a separate reader over
+   * the same sources and the filter is evaluated on them. The matching rows of the decoded filter
+   * columns are kept as is, and the other columns are only read from the row groups with matches,
+   * skipping the pages without matching rows where possible.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param filter AST expression referencing output columns by index
+   * @param metadata Output table metadata, used to name the columns
+   *
+   * @return The filtered output table, or `std::nullopt` if the filter references all output
+   *         columns or columns that cannot be read separately
+   */
+  std::optional<table_with_metadata> read_with_late_materialization(
+    host_span<std::vector<size_type> const> row_group_indices,
+    ast::expression const& filter,
+    table_metadata const& metadata);
+
   /**
    * @brief Perform the necessary data preprocessing for parsing file later on.
    *
@@ -167,7 +189,8 @@ class reader::impl {
    * @brief Setup step for the next input read pass.
    *
    * A 'pass' is defined as a subset of row groups read out of the globally
-   * requested set of all row groups.
+   * requested set of all row groups, or as the pages spanning a range of rows of a single row
+   * group too large for the pass read limit.
    *
    * @param uses_custom_row_bounds Whether or not num_rows and skip_rows represents user-specific
    *        bounds
@@ -217,12 +240,70 @@ class reader::impl {
    */
   void read_compressed_data();
 
+  /**
+   * @brief Flags the data pages of the current pass that hold no rows that may satisfy the filter.
+   *
+   * The rows that may satisfy the filter come from the page statistics of the row groups (see
+   * `row_group_info::filtered_rows`). Only pages of flat, fixed-width columns are skipped: they are
+   * neither decompressed nor decoded, and their rows are left null in the output buffers until
+   * `filtered_rows_mask` drops them.
+   */
+  void skip_filtered_pages();
+
+  /**
+   * @brief Returns a mask of the rows that may satisfy the filter according to the page statistics.
+   *
+   * @param skip_rows Absolute index of the first row of the output chunk
+   * @param num_rows Number of rows of the output chunk
+   * @return BOOL8 column with a row per row of the output chunk, or nullptr if all rows may
+   */
+  [[nodiscard]] std::unique_ptr<column> filtered_rows_mask(size_t skip_rows, size_t num_rows) const;
+
+  /**
+   * @brief Hint the data sources with the byte ranges of the column chunks in the given pass.
+   *
+   * Lets prefetching sources start reading the chunks before they are requested. Does nothing if
+   * `pass` is not a valid pass index.
+   *
+   * @param pass Index of the input pass
+   */
+  void prefetch_pass_data(size_t pass);
+
   /**
    * @brief Build string dictionary indices for a pass.
    *
    */
   void build_string_dict_indices();
 
+  /**
+   * @brief Returns whether a column is read as a dictionary column.
+   *
+   * The rows of such a column are decoded as indices into the keys of the dictionary pages of all
+   * its chunks, which are then turned into a dictionary column by `make_dictionary_columns`.
+   *
+   * @param schema_idx Schema index of the column
+   */
+  [[nodiscard]] bool is_dictionary_column(int schema_idx) const
+  {
+    return _dictionary_schemas.count(schema_idx) > 0;
+  }
+
+  /**
+   * @brief Returns the number of dictionary keys of each chunk of the current pass that is read
+   * as part of a dictionary column, and 0 for the other chunks.
+   */
+  [[nodiscard]] std::vector<size_type> dictionary_key_counts() const;
+
+  /**
+   * @brief Turns the decoded indices of the dictionary columns into dictionary columns.
+   *
+   * The keys of the dictionary pages of all the chunks of the current pass are sorted and
+   * deduplicated, and the decoded indices are remapped to the unique keys.
+   *
+   * @param out_columns Output columns of the current chunk, replaced in place
+   */
+  void make_dictionary_columns(std::vector<std::unique_ptr<column>>& out_columns);
+
   /**
    * @brief For list columns, generate estimated row counts for pages in the current pass.
    *
@@ -284,12 +365,34 @@ class reader::impl {
    * @param out_metadata The output table metadata
    * @param out_columns The columns for building the output table
    * @param filter Optional AST expression to filter output rows
+   * @param filtered_rows Optional mask of the rows that may satisfy `filter`, anded with it
    * @return The output table along with columns' metadata
    */
   table_with_metadata finalize_output(
     table_metadata& out_metadata,
     std::vector<std::unique_ptr<column>>& out_columns,
-    std::optional<std::reference_wrapper<ast::expression const>> filter);
+    std::optional<std::reference_wrapper<ast::expression const>> filter,
+    column const* filtered_rows = nullptr);
+
+  /**
+   * @brief Keeps the rows of the table whose join filter keys may be in the join filter.
+   *
+   * @param read_table The table to filter
+   * @param metadata The table metadata, used to find the key columns by name
+   * @return The rows of `read_table` that may have a join match
+   */
+  std::unique_ptr<table> apply_join_filter(std::unique_ptr<table> read_table,
+                                           table_metadata const& metadata);
+
+  /**
+   * @brief Keeps the rows of the table whose membership filter value is a key of the index.
+   *
+   * @param read_table The table to filter
+   * @param metadata The table metadata, used to find the filtered column by name
+   * @return The rows of `read_table` whose value is in the membership index
+   */
+  std::unique_ptr<table> apply_membership_filter(std::unique_ptr<table> read_table,
+                                                 table_metadata const& metadata);
 
   /**
    * @brief Allocate data buffers for the output columns.
@@ -368,12 +471,33 @@ class reader::impl {
 
   bool _strings_to_categorical = false;
 
+  // schema indices of the string columns decoded as indices into the keys of their dictionaries
+  std::unordered_set<int> _dictionary_schemas;
+
   // are there usable page indexes available
   bool _has_page_index = false;
 
   std::optional<std::vector<reader_column_schema>> _reader_column_schema;
   data_type _timestamp_type{type_id::EMPTY};
 
+  // decode the filter columns first to only read the other columns for the matching rows
+  bool _late_materialization = false;
+
+  // rows of each row group (keyed by source and row group index) that the caller will keep; the
+  // pages holding none of them are skipped
+  filtered_row_ranges _selected_rows;
+
+  // Bloom filter of join keys to filter the output rows, and the names of the key columns
+  std::optional<std::reference_wrapper<join_bloom_filter const>> _join_filter;
+  std::vector<std::string> _join_filter_columns;
+
+  // Membership index of the values to keep, and the name of the filtered column
+  std::optional<std::reference_wrapper<membership_index const>> _membership_filter;
+  std::string _membership_filter_column;
+
+  // row groups of the byte range set in the options, read when no row groups are given
+  std::optional<std::vector<std::vector<size_type>>> _byte_range_row_groups;
+
   // chunked reading happens in 2 parts:
   //
   // At the top level, the entire file is divided up into "passes" omn which we try and limit the
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "io/comp/batch_scheduler.hpp"
 #include "io/comp/nvcomp_adapter.hpp"
 #include "io/utilities/config_utils.hpp"
 #include "io/utilities/time_utils.cuh"
@@ -23,7 +24,9 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/logger.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/allocation_purpose.hpp>
 
 #include <rmm/exec_policy.hpp>
 
@@ -36,7 +39,10 @@
 #include <thrust/transform_scan.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
+#include <chrono>
 #include <numeric>
+#include <optional>
 
 namespace cudf::io::parquet::detail {
 
@@ -425,6 +431,94 @@ std::pair<size_t, size_t> get_row_group_size(RowGroup const& rg)
   return {compressed_size, total_size};
 }
 
+/**
+ * @brief Splits the rows of a row group too large for the pass read limit into ranges whose pages
+ * fit within the limit, using the page locations from the offset index.
+ *
+ * The pages of different columns do not start on the same rows, so a page spanning the end of a
+ * range is loaded again for the next one. A range always holds at least one page of each column,
+ * even if that exceeds the limit.
+ *
+ * @param chunks The column chunks of the row group
+ * @param num_rows Number of rows in the row group
+ * @param read_limit Limit on the compressed size of the pages and dictionaries of a range
+ * @return The row ranges, relative to the start of the row group
+ */
+std::vector<row_range> split_row_group_by_pages(host_span<ColumnChunkDesc const> chunks,
+                                                size_t num_rows,
+                                                size_t read_limit)
+{
+  // a range can end on the first row of any page
+  std::vector<size_t> split_rows{num_rows};
+  for (auto const& chunk : chunks) {
+    for (auto const& page : chunk.h_chunk_info->pages) {
+      auto const first_row = static_cast<size_t>(page.location.first_row_index);
+      if (first_row > 0 && first_row < num_rows) { split_rows.push_back(first_row); }
+    }
+  }
+  std::sort(split_rows.begin(), split_rows.end());
+  split_rows.erase(std::unique(split_rows.begin(), split_rows.end()), split_rows.end());
+
+  auto const range_size = [&](size_t start_row, size_t end_row) {
+    return std::accumulate(
+      chunks.begin(), chunks.end(), size_t{0}, [&](size_t size, ColumnChunkDesc const& chunk) {
+        auto const& info         = *chunk.h_chunk_info;
+        auto const [first, last] = info.page_range(start_row, end_row);
+        return size + info.dictionary_size.value_or(0) + info.page_bytes(first, last).second;
+      });
+  };
+
+  std::vector<row_range> ranges;
+  for (size_t start_row = 0; start_row < num_rows;) {
+    // end the range on the last split row that fits, but always on or after the next one
+    auto const next_end = std::upper_bound(split_rows.begin(), split_rows.end(), start_row);
+    auto const fit_end  = std::partition_point(next_end, split_rows.end(), [&](size_t end_row) {
+      return range_size(start_row, end_row) <= read_limit;
+    });
+    auto const end_row = fit_end == next_end ? *next_end : *(fit_end - 1);
+    ranges.push_back({start_row, end_row - start_row});
+    start_row = end_row;
+  }
+  return ranges;
+}
+
+/**
+ * @brief Limits the chunks of a pass reading part of a single row group to the pages spanning the
+ * rows of the pass.
+ *
+ * The page index information of the pass's copy of the row group is trimmed to those pages, and
+ * the chunks are pointed at it, so that only the dictionary and the selected pages of each chunk
+ * are read and decompressed.
+ *
+ * @param pass The pass, whose only row group is a copy of `row_group`
+ * @param row_group The file-wide row group the chunks of the pass point to
+ * @param rows The rows of the row group read by the pass
+ */
+void select_pass_pages(pass_intermediate_data& pass,
+                       row_group_info const& row_group,
+                       row_range const& rows)
+{
+  auto& column_chunks = pass.row_groups.front().column_chunks.value();
+  for (auto& chunk : pass.chunks) {
+    auto& info               = column_chunks[chunk.h_chunk_info - row_group.column_chunks->data()];
+    auto const [first, last] = info.page_range(rows.skip_rows, rows.skip_rows + rows.num_rows);
+    CUDF_EXPECTS(first < last, "Encountered a pass without pages for a column");
+    auto const& last_page = info.pages[last - 1];
+    auto const start_row  = info.pages[first].location.first_row_index;
+    auto const end_row    = last_page.location.first_row_index + last_page.num_rows;
+
+    // keep the page index information of the selected pages only
+    info.pages = std::vector<page_info>(info.pages.begin() + first, info.pages.begin() + last);
+
+    // the chunk now starts at its first selected page
+    chunk.compressed_size =
+      info.dictionary_size.value_or(0) + info.page_bytes(0, info.pages.size()).second;
+    chunk.start_row += start_row;
+    chunk.num_rows     = end_row - start_row;
+    chunk.h_chunk_info = &info;
+  }
+}
+
 /**
  * @brief For a set of cumulative_page_info data, adjust the size_bytes field
  * such that it reflects the worst case for all pages that span the same rows.
@@ -739,10 +833,13 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
   rmm::cuda_stream_view stream)
 {
   CUDF_FUNC_RANGE();
+  allocation_purpose_scope const purpose{allocation_purpose::DECOMPRESSION};
 
+  // pages skipped by the predicate pushdown are never decoded, so they are not decompressed either
   auto for_each_codec_page = [&](Compression codec, std::function<void(size_t)> const& f) {
     for (size_t p = 0; p < pages.size(); p++) {
       if (chunks[pages[p].chunk_idx].codec == codec &&
+          !(pages[p].flags & PAGEINFO_FLAGS_SKIPPED) &&
           ((dict_pages && (pages[p].flags & PAGEINFO_FLAGS_DICTIONARY)) ||
            (!dict_pages && !(pages[p].flags & PAGEINFO_FLAGS_DICTIONARY)))) {
         f(p);
@@ -819,6 +916,13 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
                comp_res.end(),
                compression_result{0, compression_status::FAILURE});
 
+  // The decompression is only timed, which requires synchronizing, when perf events are logged
+  std::optional<std::chrono::steady_clock::time_point> perf_start;
+  if (cudf::detail::perf_logging_enabled()) {
+    stream.synchronize();
+    perf_start = std::chrono::steady_clock::now();
+  }
+
   size_t decomp_offset = 0;
   int32_t start_pos    = 0;
   for (auto const& codec : codecs) {
@@ -847,41 +951,51 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
 
     host_span<device_span<uint8_t const> const> comp_in_view{comp_in.data() + start_pos,
                                                              codec.num_pages};
-    auto const d_comp_in = cudf::detail::make_device_uvector_async(
-      comp_in_view, stream, rmm::mr::get_current_device_resource());
     host_span<device_span<uint8_t> const> comp_out_view(comp_out.data() + start_pos,
                                                         codec.num_pages);
-    auto const d_comp_out = cudf::detail::make_device_uvector_async(
-      comp_out_view, stream, rmm::mr::get_current_device_resource());
     device_span<compression_result> d_comp_res_view(comp_res.data() + start_pos, codec.num_pages);
 
+    // Pages are decompressed in concurrent batches of similar compressed sizes
+    auto const decompress_batches = [&](cudf::io::detail::batch_function const& fn) {
+      cudf::io::detail::schedule_batches(comp_in_view, comp_out_view, d_comp_res_view, fn, stream);
+    };
+    using cudf::io::detail::batch_output_sizes;
+    auto const nvcomp_decompress = [&](nvcomp::compression_type type) {
+      decompress_batches([type](auto in, auto out, auto res, batch_output_sizes sizes, auto strm) {
+        nvcomp::batched_decompress(type, in, out, res, sizes.max_size, sizes.total_size, strm);
+      });
+    };
+
     switch (codec.compression_type) {
       case GZIP:
-        gpuinflate(d_comp_in, d_comp_out, d_comp_res_view, gzip_header_included::YES, stream);
+        decompress_batches([](auto in, auto out, auto res, batch_output_sizes, auto strm) {
+          gpuinflate(in, out, res, gzip_header_included::YES, strm);
+        });
         break;
       case SNAPPY:
         if (cudf::io::detail::nvcomp_integration::is_stable_enabled()) {
-          nvcomp::batched_decompress(nvcomp::compression_type::SNAPPY,
-                                     d_comp_in,
-                                     d_comp_out,
-                                     d_comp_res_view,
-                                     codec.max_decompressed_size,
-                                     codec.total_decomp_size,
-                                     stream);
+          nvcomp_decompress(nvcomp::compression_type::SNAPPY);
         } else {
-          gpu_unsnap(d_comp_in, d_comp_out, d_comp_res_view, stream);
+          decompress_batches([](auto in, auto out, auto res, batch_output_sizes, auto strm) {
+            gpu_unsnap(in, out, res, strm);
+          });
         }
         break;
       case ZSTD:
-        nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
-                                   d_comp_in,
-                                   d_comp_out,
-                                   d_comp_res_view,
-                                   codec.max_decompressed_size,
-                                   codec.total_decomp_size,
-                                   stream);
+        if (nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD)) {
+          decompress_batches([](auto in, auto out, auto res, batch_output_sizes, auto strm) {
+            gpu_unzstd(in, out, res, strm);
+          });
+        } else {
+          nvcomp_decompress(nvcomp::compression_type::ZSTD);
+        }
         break;
-      case BROTLI:
+      case BROTLI: {
+        // All pages share the scratch memory, so they are decompressed in a single batch
+        auto const d_comp_in = cudf::detail::make_device_uvector_async(
+          comp_in_view, stream, rmm::mr::get_current_device_resource());
+        auto const d_comp_out = cudf::detail::make_device_uvector_async(
+          comp_out_view, stream, rmm::mr::get_current_device_resource());
         gpu_debrotli(d_comp_in,
                      d_comp_out,
                      d_comp_res_view,
@@ -889,14 +1003,15 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
                      debrotli_scratch.size(),
                      stream);
         break;
+      }
       case LZ4_RAW:
-        nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
-                                   d_comp_in,
-                                   d_comp_out,
-                                   d_comp_res_view,
-                                   codec.max_decompressed_size,
-                                   codec.total_decomp_size,
-                                   stream);
+        if (nvcomp::is_decompression_disabled(nvcomp::compression_type::LZ4)) {
+          decompress_batches([](auto in, auto out, auto res, batch_output_sizes, auto strm) {
+            gpu_unlz4(in, out, res, strm);
+          });
+        } else {
+          nvcomp_decompress(nvcomp::compression_type::LZ4);
+        }
         break;
       default: CUDF_FAIL("Unexpected decompression dispatch"); break;
     }
@@ -910,15 +1025,20 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
                                 return res.status == compression_status::SUCCESS;
                               })),
                "Error during decompression");
+  if (perf_start.has_value()) {
+    auto const elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - *perf_start);
+    CUDF_LOG_PERF("parquet_decompress",
+                  "pages={} bytes={} dictionary={} time_us={}",
+                  num_comp_pages,
+                  total_decomp_size,
+                  dict_pages,
+                  elapsed.count());
+  }
 
   // now copy the uncompressed V2 def and rep level data
   if (not copy_in.empty()) {
-    auto const d_copy_in = cudf::detail::make_device_uvector_async(
-      copy_in, stream, rmm::mr::get_current_device_resource());
-    auto const d_copy_out = cudf::detail::make_device_uvector_async(
-      copy_out, stream, rmm::mr::get_current_device_resource());
-
-    gpu_copy_uncompressed_blocks(d_copy_in, d_copy_out, stream);
+    cudf::io::detail::copy_uncompressed_blocks(copy_in, copy_out, stream);
     stream.synchronize();
   }
 
@@ -1081,12 +1201,19 @@ struct get_decomp_scratch {
         break;
 
       case ZSTD:
+        if (cudf::io::nvcomp::is_decompression_disabled(
+              cudf::io::nvcomp::compression_type::ZSTD)) {
+          return 0;
+        }
         return cudf::io::nvcomp::batched_decompress_temp_size(
           cudf::io::nvcomp::compression_type::ZSTD,
           di.num_pages,
           di.max_page_decompressed_size,
           di.total_decompressed_size);
       case LZ4_RAW:
+        if (cudf::io::nvcomp::is_decompression_disabled(cudf::io::nvcomp::compression_type::LZ4)) {
+          return 0;
+        }
         return cudf::io::nvcomp::batched_decompress_temp_size(
           cudf::io::nvcomp::compression_type::LZ4,
           di.num_pages,
@@ -1203,11 +1330,10 @@ void reader::impl::setup_next_pass(bool uses_custom_row_bounds)
     auto& pass = *_pass_itm_data;
 
     // setup row groups to be loaded for this pass
-    auto const row_group_start =
-      _file_itm_data.input_pass_row_group_offsets[_file_itm_data._current_input_pass];
-    auto const row_group_end =
-      _file_itm_data.input_pass_row_group_offsets[_file_itm_data._current_input_pass + 1];
-    auto const num_row_groups = row_group_end - row_group_start;
+    auto const& pass_info      = _file_itm_data.input_passes[_file_itm_data._current_input_pass];
+    auto const row_group_start = pass_info.row_group_start;
+    auto const row_group_end   = pass_info.row_group_end;
+    auto const num_row_groups  = row_group_end - row_group_start;
     pass.row_groups.resize(num_row_groups);
     std::copy(_file_itm_data.row_groups.begin() + row_group_start,
               _file_itm_data.row_groups.begin() + row_group_end,
@@ -1225,6 +1351,12 @@ void reader::impl::setup_next_pass(bool uses_custom_row_bounds)
     pass.chunks = cudf::detail::hostdevice_vector<ColumnChunkDesc>(num_chunks, _stream);
     std::copy(chunk_start, chunk_end, pass.chunks.begin());
 
+    // if the pass reads part of a row group, only load the pages spanning its rows
+    if (pass_info.row_group_rows.has_value()) {
+      select_pass_pages(
+        pass, _file_itm_data.row_groups[row_group_start], *pass_info.row_group_rows);
+    }
+
     // compute skip_rows / num_rows for this pass.
     if (num_passes == 1) {
       pass.skip_rows = _file_itm_data.global_skip_rows;
@@ -1248,6 +1380,10 @@ void reader::impl::setup_next_pass(bool uses_custom_row_bounds)
       pass.num_rows = end_row - start_row;
     }
 
+    // let prefetching sources read this pass and the next one ahead of the chunk reads below
+    prefetch_pass_data(_file_itm_data._current_input_pass);
+    prefetch_pass_data(_file_itm_data._current_input_pass + 1);
+
     // load page information for the chunk. this retrieves the compressed bytes for all the
     // pages, and their headers (which we can access without decompressing)
     read_compressed_data();
@@ -1264,6 +1400,9 @@ void reader::impl::setup_next_pass(bool uses_custom_row_bounds)
       uses_custom_row_bounds ? std::nullopt : std::make_optional(pass.num_rows),
       _stream);
 
+    // skip the data pages that hold no rows that may satisfy the filter
+    skip_filtered_pages();
+
     // decompress dictionary data if applicable.
     if (pass.has_compressed_data) {
       pass.decomp_dict_data = decompress_page_data(pass.chunks, pass.pages, true, _stream);
@@ -1516,7 +1655,9 @@ void reader::impl::create_global_chunk_info()
       auto& schema   = _metadata->get_schema(col.schema_idx);
 
       auto [type_width, clock_rate, converted_type] =
-        conversion_info(to_type_id(schema, _strings_to_categorical, _timestamp_type.id()),
+        conversion_info(to_type_id(schema,
+                                   _strings_to_categorical or is_dictionary_column(col.schema_idx),
+                                   _timestamp_type.id()),
                         _timestamp_type.id(),
                         schema.type,
                         schema.converted_type,
@@ -1569,8 +1710,7 @@ void reader::impl::compute_input_passes()
 
   // if the user hasn't specified an input size limit, read everything in a single pass.
   if (_input_pass_read_limit == 0) {
-    _file_itm_data.input_pass_row_group_offsets.push_back(0);
-    _file_itm_data.input_pass_row_group_offsets.push_back(row_groups_info.size());
+    _file_itm_data.input_passes.push_back({0, row_groups_info.size()});
     _file_itm_data.input_pass_start_row_count.push_back(0);
     auto rg_row_count = cudf::detail::make_counting_transform_iterator(0, [&](size_t i) {
       auto const& rgi       = row_groups_info[i];
@@ -1591,9 +1731,9 @@ void reader::impl::compute_input_passes()
   std::size_t cur_pass_byte_size = 0;
   std::size_t cur_rg_start       = 0;
   std::size_t cur_row_count      = 0;
-  _file_itm_data.input_pass_row_group_offsets.push_back(0);
   _file_itm_data.input_pass_start_row_count.push_back(0);
 
+  auto const num_columns = _input_columns.size();
   for (size_t cur_rg_index = 0; cur_rg_index < row_groups_info.size(); cur_rg_index++) {
     auto const& rgi       = row_groups_info[cur_rg_index];
     auto const& row_group = _metadata->get_row_group(rgi.index, rgi.source_index);
@@ -1602,24 +1742,33 @@ void reader::impl::compute_input_passes()
     auto const [compressed_rg_size, _ /*compressed + uncompressed*/] =
       get_row_group_size(row_group);
 
-    // can we add this row group
-    if (cur_pass_byte_size + compressed_rg_size >= comp_read_limit) {
-      // A single row group (the current one) is larger than the read limit:
-      // We always need to include at least one row group, so end the pass at the end of the current
-      // row group
-      if (cur_rg_start == cur_rg_index) {
-        _file_itm_data.input_pass_row_group_offsets.push_back(cur_rg_index + 1);
+    // can we add this row group? if not, end the pass at the end of the previous row group
+    if (cur_rg_start != cur_rg_index &&
+        cur_pass_byte_size + compressed_rg_size >= comp_read_limit) {
+      _file_itm_data.input_passes.push_back({cur_rg_start, cur_rg_index});
+      _file_itm_data.input_pass_start_row_count.push_back(cur_row_count);
+      cur_rg_start       = cur_rg_index;
+      cur_pass_byte_size = 0;
+    }
+
+    // A single row group (the current one) is larger than the read limit. With page indexes, split
+    // it into passes that each load only the pages of some of its rows. Otherwise, we always need
+    // to include at least one row group, so end the pass at the end of the current row group
+    if (compressed_rg_size >= comp_read_limit) {
+      if (_has_page_index) {
+        auto const first_chunk = _file_itm_data.chunks.data() + cur_rg_index * num_columns;
+        auto const row_ranges  = split_row_group_by_pages(
+          {first_chunk, num_columns}, row_group.num_rows, comp_read_limit);
+        for (auto const& rows : row_ranges) {
+          _file_itm_data.input_passes.push_back({cur_rg_index, cur_rg_index + 1, rows});
+          _file_itm_data.input_pass_start_row_count.push_back(cur_row_count + rows.skip_rows +
+                                                              rows.num_rows);
+        }
+      } else {
+        _file_itm_data.input_passes.push_back({cur_rg_index, cur_rg_index + 1});
         _file_itm_data.input_pass_start_row_count.push_back(cur_row_count + row_group.num_rows);
-        cur_rg_start       = cur_rg_index + 1;
-        cur_pass_byte_size = 0;
-      }
-      // End the pass at the end of the previous row group
-      else {
-        _file_itm_data.input_pass_row_group_offsets.push_back(cur_rg_index);
-        _file_itm_data.input_pass_start_row_count.push_back(cur_row_count);
-        cur_rg_start       = cur_rg_index;
-        cur_pass_byte_size = compressed_rg_size;
       }
+      cur_rg_start = cur_rg_index + 1;
     } else {
       cur_pass_byte_size += compressed_rg_size;
     }
@@ -1627,8 +1776,8 @@ void reader::impl::compute_input_passes()
   }
 
   // add the last pass if necessary
-  if (_file_itm_data.input_pass_row_group_offsets.back() != row_groups_info.size()) {
-    _file_itm_data.input_pass_row_group_offsets.push_back(row_groups_info.size());
+  if (cur_rg_start != row_groups_info.size()) {
+    _file_itm_data.input_passes.push_back({cur_rg_start, row_groups_info.size()});
     _file_itm_data.input_pass_start_row_count.push_back(cur_row_count);
   }
 }
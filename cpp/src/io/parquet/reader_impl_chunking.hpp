@@ -20,8 +20,31 @@
 
 #include <cudf/types.hpp>
 
+#include <optional>
+
 namespace cudf::io::parquet::detail {
 
+/**
+ * @brief Struct to identify a range of rows.
+ */
+struct row_range {
+  size_t skip_rows;
+  size_t num_rows;
+};
+
+/**
+ * @brief Struct to identify the row groups read by an input pass.
+ */
+struct input_pass_info {
+  // [row_group_start, row_group_end) indices into file_intermediate_data::row_groups
+  size_t row_group_start;
+  size_t row_group_end;
+
+  // a single row group too large for the pass read limit is read by several passes, each of which
+  // only loads the pages spanning its rows (relative to the start of the row group).
+  std::optional<row_range> row_group_rows{};
+};
+
 /**
  * @brief Struct to store file-level data that remains constant for
  * all passes/chunks in the file.
@@ -33,12 +56,11 @@ struct file_intermediate_data {
   // all chunks from the selected row groups.
   std::vector<ColumnChunkDesc> chunks{};
 
-  // an array of offsets into _file_itm_data::global_chunks. Each pair of offsets represents
-  // the start/end of the chunks to be loaded for a given pass.
-  std::vector<std::size_t> input_pass_row_group_offsets{};
+  // the row groups to be loaded for each pass.
+  std::vector<input_pass_info> input_passes{};
 
-  // start row counts per input-pass. this includes all rows in the row groups of the pass and
-  // is not capped by global_skip_rows and global_num_rows.
+  // start row counts per input-pass. this includes all rows in the row groups (or row group rows)
+  // of the pass and is not capped by global_skip_rows and global_num_rows.
   std::vector<std::size_t> input_pass_start_row_count{};
 
   size_t _current_input_pass{0};  // current input pass index
@@ -50,18 +72,10 @@ struct file_intermediate_data {
 
   [[nodiscard]] size_t num_passes() const
   {
-    return input_pass_row_group_offsets.size() == 0 ? 0 : input_pass_row_group_offsets.size() - 1;
+    return input_passes.size();
   }
 };
 
-/**
- * @brief Struct to identify a range of rows.
- */
-struct row_range {
-  size_t skip_rows;
-  size_t num_rows;
-};
-
 /**
  * @brief Passes are broken down into subpasses based on temporary memory constraints.
  */
@@ -98,7 +112,9 @@ struct subpass_intermediate_data {
  * @brief Struct to store pass-level data that remains constant for a single pass.
  *
  * A pass is defined as a set of rowgroups read but not yet decompressed. This set of
- * rowgroups may represent less than all of the rowgroups to be read for the file.
+ * rowgroups may represent less than all of the rowgroups to be read for the file. A rowgroup
+ * too large for the pass read limit is read by several passes, each loading only the pages
+ * spanning some of its rows.
  */
 struct pass_intermediate_data {
   std::vector<std::unique_ptr<datasource::buffer>> raw_page_data;
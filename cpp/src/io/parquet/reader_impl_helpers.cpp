@@ -16,13 +16,23 @@
 
 #include "reader_impl_helpers.hpp"
 
+#include "io/utilities/config_utils.hpp"
 #include "io/utilities/row_selection.hpp"
+#include "metadata_cache.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
 #include <regex>
 
 namespace cudf::io::parquet::detail {
 
+cudf::detail::thread_pool& reader_thread_pool()
+{
+  static cudf::detail::thread_pool pool(getenv_or("LIBCUDF_PARQUET_READER_THREAD_COUNT", 8));
+  return pool;
+}
+
 namespace {
 
 ConvertedType logical_type_to_converted_type(thrust::optional<LogicalType> const& logical)
@@ -314,13 +324,43 @@ metadata::metadata(datasource* source)
 }
 
 std::vector<metadata> aggregate_reader_metadata::metadatas_from_sources(
-  host_span<std::unique_ptr<datasource> const> sources)
+  host_span<std::unique_ptr<datasource> const> sources, host_span<std::string const> cache_keys)
 {
+  CUDF_EXPECTS(cache_keys.empty() or cache_keys.size() == sources.size(),
+               "Number of metadata cache keys must match the number of sources");
+
+  auto const read_metadata = [&](std::size_t src_idx) {
+    if (cache_keys.empty() or cache_keys[src_idx].empty()) {
+      return metadata(sources[src_idx].get());
+    }
+    auto& cache = metadata_cache::instance();
+    auto cached = cache.get(cache_keys[src_idx]);
+    if (cached == nullptr) {
+      cached = std::make_shared<metadata const>(sources[src_idx].get());
+      cache.put(cache_keys[src_idx], cached);
+    }
+    return *cached;
+  };
+
   std::vector<metadata> metadatas;
-  std::transform(
-    sources.begin(), sources.end(), std::back_inserter(metadatas), [](auto const& source) {
-      return metadata(source.get());
-    });
+  metadatas.reserve(sources.size());
+  if (sources.size() == 1) {
+    metadatas.push_back(read_metadata(0));
+    return metadatas;
+  }
+
+  // Overlap the footer reads and decoding of multiple sources
+  std::vector<std::future<metadata>> read_tasks;
+  read_tasks.reserve(sources.size());
+  for (std::size_t src_idx = 0; src_idx < sources.size(); ++src_idx) {
+    read_tasks.push_back(reader_thread_pool().submit(read_metadata, src_idx));
+  }
+  // Wait for all tasks before rethrowing any error, as they reference the local state
+  std::for_each(read_tasks.begin(), read_tasks.end(), [](auto& task) { task.wait(); });
+  std::transform(read_tasks.begin(),
+                 read_tasks.end(),
+                 std::back_inserter(metadatas),
+                 [](auto& task) { return task.get(); });
   return metadatas;
 }
 
@@ -504,8 +544,8 @@ void aggregate_reader_metadata::column_info_for_row_group(row_group_info& rg_inf
 }
 
 aggregate_reader_metadata::aggregate_reader_metadata(
-  host_span<std::unique_ptr<datasource> const> sources)
-  : per_file_metadata(metadatas_from_sources(sources)),
+  host_span<std::unique_ptr<datasource> const> sources, host_span<std::string const> cache_keys)
+  : per_file_metadata(metadatas_from_sources(sources, cache_keys)),
     keyval_maps(collect_keyval_metadata()),
     num_rows(calc_num_rows()),
     num_row_groups(calc_num_row_groups())
@@ -535,6 +575,82 @@ RowGroup const& aggregate_reader_metadata::get_row_group(size_type row_group_ind
   return per_file_metadata[src_idx].row_groups[row_group_index];
 }
 
+std::vector<std::vector<size_type>> aggregate_reader_metadata::get_all_row_group_indices() const
+{
+  std::vector<std::vector<size_type>> all_row_group_indices;
+  std::transform(per_file_metadata.cbegin(),
+                 per_file_metadata.cend(),
+                 std::back_inserter(all_row_group_indices),
+                 [](auto const& file_meta) {
+                   std::vector<size_type> rg_idx(file_meta.row_groups.size());
+                   std::iota(rg_idx.begin(), rg_idx.end(), 0);
+                   return rg_idx;
+                 });
+  return all_row_group_indices;
+}
+
+std::vector<std::vector<size_type>> aggregate_reader_metadata::get_row_group_indices_in_byte_range(
+  std::size_t offset, std::size_t size) const
+{
+  auto const end = size == 0 ? std::numeric_limits<std::size_t>::max() : offset + size;
+  std::vector<std::vector<size_type>> row_group_indices;
+  for (auto const& file_meta : per_file_metadata) {
+    auto& indices = row_group_indices.emplace_back();
+    for (size_t rg_idx = 0; rg_idx < file_meta.row_groups.size(); ++rg_idx) {
+      // a row group spans its column chunks, each starting at its dictionary page if it has one
+      auto start              = std::numeric_limits<int64_t>::max();
+      int64_t compressed_size = 0;
+      for (auto const& chunk : file_meta.row_groups[rg_idx].columns) {
+        auto const& meta = chunk.meta_data;
+        auto const chunk_start =
+          meta.dictionary_page_offset != 0
+            ? std::min(meta.data_page_offset, meta.dictionary_page_offset)
+            : meta.data_page_offset;
+        start = std::min(start, chunk_start);
+        compressed_size += meta.total_compressed_size;
+      }
+      if (compressed_size == 0) { continue; }
+      auto const midpoint = static_cast<std::size_t>(start + compressed_size / 2);
+      if (midpoint >= offset && midpoint < end) {
+        indices.push_back(static_cast<size_type>(rg_idx));
+      }
+    }
+  }
+  return row_group_indices;
+}
+
+bool aggregate_reader_metadata::is_dictionary_encoded(int schema_idx) const
+{
+  auto const is_dictionary = [](Encoding encoding) {
+    return encoding == Encoding::PLAIN_DICTIONARY or encoding == Encoding::RLE_DICTIONARY;
+  };
+  auto const is_chunk_dictionary_encoded = [&](ColumnChunkMetaData const& meta) {
+    if (meta.encoding_stats.has_value()) {
+      return std::all_of(
+        meta.encoding_stats->begin(), meta.encoding_stats->end(), [&](auto const& stats) {
+          return stats.page_type == PageType::DICTIONARY_PAGE or stats.count == 0 or
+                 is_dictionary(stats.encoding);
+        });
+    }
+    // Without page statistics, PLAIN may be the encoding of the dictionary page as well as of
+    // fallback data pages, so only chunks listing the dictionary and level encodings qualify
+    return std::any_of(meta.encodings.begin(), meta.encodings.end(), is_dictionary) and
+           std::all_of(meta.encodings.begin(), meta.encodings.end(), [&](auto encoding) {
+             return is_dictionary(encoding) or encoding == Encoding::RLE or
+                    encoding == Encoding::BIT_PACKED;
+           });
+  };
+
+  return std::all_of(per_file_metadata.cbegin(), per_file_metadata.cend(), [&](auto const& pfm) {
+    return std::all_of(pfm.row_groups.cbegin(), pfm.row_groups.cend(), [&](auto const& rg) {
+      auto const col = std::find_if(rg.columns.cbegin(), rg.columns.cend(), [&](auto const& c) {
+        return c.schema_idx == schema_idx;
+      });
+      return col != rg.columns.cend() and is_chunk_dictionary_encoded(col->meta_data);
+    });
+  });
+}
+
 ColumnChunkMetaData const& aggregate_reader_metadata::get_column_metadata(size_type row_group_index,
                                                                           size_type src_idx,
                                                                           int schema_idx) const
@@ -598,23 +714,37 @@ std::vector<std::string> aggregate_reader_metadata::get_pandas_index_names() con
 
 std::tuple<int64_t, size_type, std::vector<row_group_info>>
 aggregate_reader_metadata::select_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   int64_t skip_rows_opt,
   std::optional<size_type> const& num_rows_opt,
   host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
   std::optional<std::reference_wrapper<ast::expression const>> filter,
   rmm::cuda_stream_view stream) const
 {
   std::optional<std::vector<std::vector<size_type>>> filtered_row_group_indices;
+  filtered_row_ranges filtered_rows;
   if (filter.has_value()) {
-    filtered_row_group_indices =
-      filter_row_groups(row_group_indices, output_dtypes, filter.value(), stream);
+    filtered_row_group_indices = filter_row_groups(sources,
+                                                   row_group_indices,
+                                                   output_dtypes,
+                                                   output_column_schemas,
+                                                   filter.value(),
+                                                   stream,
+                                                   &filtered_rows);
     if (filtered_row_group_indices.has_value()) {
       row_group_indices =
         host_span<std::vector<size_type> const>(filtered_row_group_indices.value());
     }
   }
   std::vector<row_group_info> selection;
+  // attaches the rows of the row group that may satisfy the filter to its selection
+  auto const select_filtered_rows = [&](row_group_info& rg) {
+    if (auto it = filtered_rows.find({rg.source_index, rg.index}); it != filtered_rows.end()) {
+      rg.filtered_rows = std::move(it->second);
+    }
+  };
   auto [rows_to_skip, rows_to_read] = [&]() {
     if (not row_group_indices.empty()) { return std::pair<int64_t, size_type>{}; }
     auto const from_opts = cudf::io::detail::skip_rows_num_rows_from_options(
@@ -635,6 +765,7 @@ aggregate_reader_metadata::select_row_groups(
         selection.emplace_back(rowgroup_idx, rows_to_read, src_idx);
         // if page-level indexes are present, then collect extra chunk and page info.
         column_info_for_row_group(selection.back(), 0);
+        select_filtered_rows(selection.back());
         rows_to_read += get_row_group(rowgroup_idx, src_idx).num_rows;
       }
     }
@@ -650,6 +781,7 @@ aggregate_reader_metadata::select_row_groups(
           selection.emplace_back(rg_idx, chunk_start_row, src_idx);
           // if page-level indexes are present, then collect extra chunk and page info.
           column_info_for_row_group(selection.back(), chunk_start_row);
+          select_filtered_rows(selection.back());
         }
         if (count >= rows_to_skip + rows_to_read) { break; }
       }
@@ -17,18 +17,23 @@
 #pragma once
 
 #include "compact_protocol_reader.hpp"
+#include "io/utilities/thread_pool.hpp"
 #include "parquet_gpu.hpp"
 
 #include <cudf/ast/detail/expression_transformer.hpp>
 #include <cudf/ast/expressions.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/search.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 
+#include <algorithm>
 #include <list>
+#include <map>
 #include <tuple>
 #include <vector>
 
@@ -69,8 +74,52 @@ struct column_chunk_info {
   {
     return dictionary_offset.has_value() && dictionary_size.has_value();
   }
+
+  /**
+   * @brief Returns the range of the data pages holding any of the rows in `[start_row, end_row)`.
+   *
+   * @param start_row First row, relative to the start of the row group
+   * @param end_row One past the last row, relative to the start of the row group
+   * @return Index of the first page and one past the index of the last page
+   */
+  [[nodiscard]] std::pair<size_t, size_t> page_range(int64_t start_row, int64_t end_row) const
+  {
+    auto const first = std::find_if(pages.begin(), pages.end(), [&](auto const& page) {
+      return page.location.first_row_index + page.num_rows > start_row;
+    });
+    auto const last = std::find_if(first, pages.end(), [&](auto const& page) {
+      return page.location.first_row_index >= end_row;
+    });
+    return {static_cast<size_t>(std::distance(pages.begin(), first)),
+            static_cast<size_t>(std::distance(pages.begin(), last))};
+  }
+
+  /**
+   * @brief Returns the file offset and size in bytes of the data pages in `[first, last)`.
+   *
+   * @param first Index of the first page
+   * @param last One past the index of the last page
+   * @return File offset and size of the pages, including their headers
+   */
+  [[nodiscard]] std::pair<size_t, size_t> page_bytes(size_t first, size_t last) const
+  {
+    if (first == last) { return {0, 0}; }
+    auto const& last_page = pages[last - 1].location;
+    auto const begin      = pages[first].location.offset;
+    auto const end        = last_page.offset + last_page.compressed_page_size;
+    return {static_cast<size_t>(begin), static_cast<size_t>(end - begin)};
+  }
 };
 
+/**
+ * @brief Returns the thread pool the reader uses to read from multiple sources concurrently.
+ *
+ * Footers are parsed, and column chunks are read through `host_read`, on this pool with one task
+ * per source. The number of threads is read from `LIBCUDF_PARQUET_READER_THREAD_COUNT` on first
+ * use (8 by default).
+ */
+cudf::detail::thread_pool& reader_thread_pool();
+
 /**
  * @brief The row_group_info class
  */
@@ -83,6 +132,10 @@ struct row_group_info {
   // Optional metadata pulled from the column and offset indexes, if present.
   std::optional<std::vector<column_chunk_info>> column_chunks;
 
+  // Optional `[begin, end)` ranges of the rows, relative to the start of the row group, that may
+  // satisfy the filter according to the page statistics. All rows may when not set.
+  std::optional<std::vector<std::pair<size_t, size_t>>> filtered_rows;
+
   row_group_info() = default;
 
   row_group_info(size_type index, size_t start_row, size_type source_index)
@@ -96,6 +149,15 @@ struct row_group_info {
   [[nodiscard]] bool has_page_index() const { return column_chunks.has_value(); }
 };
 
+/**
+ * @brief Rows of the row groups that may satisfy a filter, keyed by source and row group index
+ *
+ * Each row group maps to sorted, disjoint `[begin, end)` row ranges relative to its first row.
+ * Row groups all of whose rows may satisfy the filter are not listed.
+ */
+using filtered_row_ranges =
+  std::map<std::pair<size_type, size_type>, std::vector<std::pair<size_t, size_t>>>;
+
 /**
  * @brief Function that translates Parquet datatype to cuDF type enum
  */
@@ -129,9 +191,11 @@ class aggregate_reader_metadata {
 
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * Sources with a non-empty cache key are looked up in, and added to, the metadata cache.
    */
   static std::vector<metadata> metadatas_from_sources(
-    host_span<std::unique_ptr<datasource> const> sources);
+    host_span<std::unique_ptr<datasource> const> sources, host_span<std::string const> cache_keys);
 
   /**
    * @brief Collect the keyvalue maps from each per-file metadata object into a vector of maps.
@@ -158,7 +222,14 @@ class aggregate_reader_metadata {
   void column_info_for_row_group(row_group_info& rg_info, size_type chunk_start_row) const;
 
  public:
-  aggregate_reader_metadata(host_span<std::unique_ptr<datasource> const> sources);
+  /**
+   * @brief Parses the metadata of the sources.
+   *
+   * @param sources Dataset sources to read from
+   * @param cache_keys Metadata cache key of each source; empty to bypass the metadata cache
+   */
+  aggregate_reader_metadata(host_span<std::unique_ptr<datasource> const> sources,
+                            host_span<std::string const> cache_keys = {});
 
   [[nodiscard]] RowGroup const& get_row_group(size_type row_group_index, size_type src_idx) const;
 
@@ -170,6 +241,32 @@ class aggregate_reader_metadata {
 
   [[nodiscard]] auto get_num_row_groups() const { return num_row_groups; }
 
+  /**
+   * @brief Returns the indices of all row groups, one list per source
+   */
+  [[nodiscard]] std::vector<std::vector<size_type>> get_all_row_group_indices() const;
+
+  /**
+   * @brief Returns the indices of the row groups whose midpoint lies in a byte range, one list per
+   * source
+   *
+   * The midpoint of a row group is halfway through the bytes of its column chunks, so consecutive
+   * byte ranges assign each row group to exactly one range.
+   *
+   * @param offset Byte offset of the range from the start of each source
+   * @param size Number of bytes in the range, or `0` for the rest of each source
+   */
+  [[nodiscard]] std::vector<std::vector<size_type>> get_row_group_indices_in_byte_range(
+    std::size_t offset, std::size_t size) const;
+
+  /**
+   * @brief Returns whether the data pages of a column are dictionary-encoded in every row group
+   *
+   * @param schema_idx Schema index of the column
+   * @return `true` if no row group of any source has a data page with another encoding
+   */
+  [[nodiscard]] bool is_dictionary_encoded(int schema_idx) const;
+
   [[nodiscard]] auto const& get_schema(int schema_idx) const
   {
     return per_file_metadata[0].schema[schema_idx];
@@ -223,38 +320,157 @@ class aggregate_reader_metadata {
   /**
    * @brief Filters the row groups based on predicate filter
    *
+   * Row groups are first pruned with the column chunk statistics, then the surviving row groups
+   * are pruned with the page statistics of the column indexes and with the column chunk Bloom
+   * filters, if any.
+   *
+   * @param sources Lists of input datasources
    * @param row_group_indices Lists of row groups to read, one per source
    * @param output_dtypes List of output column datatypes
+   * @param output_column_schemas List of output column schema indices
    * @param filter AST expression to filter row groups based on Column chunk statistics
    * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param filtered_rows If not null, receives the rows of the remaining row groups that may
+   * satisfy the filter according to the page statistics
    * @return Filtered row group indices, if any is filtered.
    */
   [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_row_groups(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<std::vector<size_type> const> row_group_indices,
+    host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream,
+    filtered_row_ranges* filtered_rows = nullptr) const;
+
+  /**
+   * @brief Filters the row groups based on the column chunk statistics
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param output_dtypes List of output column datatypes
+   * @param filter AST expression to filter row groups based on Column chunk statistics
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Filtered row group indices, if any is filtered.
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_row_groups_with_stats(
     host_span<std::vector<size_type> const> row_group_indices,
     host_span<data_type const> output_dtypes,
     std::reference_wrapper<ast::expression const> filter,
     rmm::cuda_stream_view stream) const;
 
+  /**
+   * @brief Converts the column chunk statistics of row groups to a table with a row per row group
+   *
+   * The table has the number of rows of each row group, then the minimum, maximum, null count and
+   * compressed size of each column. Missing statistics are null.
+   *
+   * @param row_group_indices Lists of row groups, one per source
+   * @param dtypes Data types of the minimum and maximum of each column
+   * @param schema_indices Schema index of each column
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table
+   * @return Table of the row group statistics
+   */
+  [[nodiscard]] std::unique_ptr<table> get_row_group_statistics(
+    host_span<std::vector<size_type> const> row_group_indices,
+    host_span<data_type const> dtypes,
+    host_span<int const> schema_indices,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const;
+
+  /**
+   * @brief Filters the row groups based on the page statistics in the column indexes
+   *
+   * Each row group is split at the page boundaries of all filter columns, and the filter is
+   * evaluated on the min/max values of the pages covering each of the resulting row ranges. A row
+   * group is dropped when none of its row ranges may satisfy the filter; otherwise the ranges that
+   * may are added to `filtered_rows`, so that the reader can skip the pages outside of them. Row
+   * groups in which any filter column lacks a page index are kept whole.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param output_dtypes List of output column datatypes
+   * @param output_column_schemas List of output column schema indices
+   * @param filter AST expression to filter row groups based on page statistics
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param filtered_rows If not null, receives the rows of the remaining row groups that may
+   * satisfy the filter
+   * @return Filtered row group indices, if any is filtered.
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>>
+  filter_row_groups_with_page_index(host_span<std::vector<size_type> const> row_group_indices,
+                                    host_span<data_type const> output_dtypes,
+                                    host_span<int const> output_column_schemas,
+                                    std::reference_wrapper<ast::expression const> filter,
+                                    rmm::cuda_stream_view stream,
+                                    filtered_row_ranges* filtered_rows = nullptr) const;
+
+  /**
+   * @brief Filters the row groups using the split-block Bloom filters of the column chunks
+   *
+   * Only `column == literal` predicates combined with logical AND/OR are used; a row group is
+   * dropped when the Bloom filters prove that the filter expression cannot be satisfied by any of
+   * its rows. Bloom filters are read from the datasources on the host.
+   *
+   * @param sources Lists of input datasources
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param output_dtypes List of output column datatypes
+   * @param output_column_schemas List of output column schema indices
+   * @param filter AST expression to filter row groups based on Column chunk Bloom filters
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Filtered row group indices, if any is filtered.
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> apply_bloom_filters(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<std::vector<size_type> const> row_group_indices,
+    host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Filters the row groups with the keys of a membership index
+   *
+   * A row group is dropped when none of the keys of `index` lie within the min/max statistics of
+   * its chunk of the filtered column. Row groups without statistics are kept.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param dtype Output datatype of the filtered column
+   * @param schema_idx Schema index of the filtered column
+   * @param index Membership index holding the values of the filtered column to keep
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Filtered row group indices, if any is filtered.
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>>
+  filter_row_groups_with_membership(host_span<std::vector<size_type> const> row_group_indices,
+                                    data_type dtype,
+                                    int schema_idx,
+                                    membership_index const& index,
+                                    rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
    * The input `row_start` and `row_count` parameters will be recomputed and output as the valid
    * values based on the input row group list.
    *
+   * @param sources Lists of input datasources
    * @param row_group_indices Lists of row groups to read, one per source
    * @param row_start Starting row of the selection
    * @param row_count Total number of rows selected
    * @param output_dtypes List of output column datatypes
+   * @param output_column_schemas List of output column schema indices
    * @param filter Optional AST expression to filter row groups based on Column chunk statistics
    * @param stream CUDA stream used for device memory operations and kernel launches
    * @return A tuple of corrected row_start, row_count and list of row group indexes and its
-   *         starting row
+   *         starting row, along with the rows that may satisfy the filter
    */
   [[nodiscard]] std::tuple<int64_t, size_type, std::vector<row_group_info>> select_row_groups(
+    host_span<std::unique_ptr<datasource> const> sources,
     host_span<std::vector<size_type> const> row_group_indices,
     int64_t row_start,
     std::optional<size_type> const& row_count,
     host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
     std::optional<std::reference_wrapper<ast::expression const>> filter,
     rmm::cuda_stream_view stream) const;
 
@@ -279,6 +495,14 @@ class aggregate_reader_metadata {
                  type_id timestamp_type_id) const;
 };
 
+/**
+ * @brief Collects the indices of the columns referenced by an expression
+ *
+ * @param expr AST expression with column index references
+ * @return Sorted, unique list of referenced column indices
+ */
+[[nodiscard]] std::vector<size_type> referenced_column_indices(ast::expression const& expr);
+
 /**
  * @brief Converts named columns to index reference columns
  *
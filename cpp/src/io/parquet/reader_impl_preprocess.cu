@@ -20,7 +20,11 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/logger.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/allocation_purpose.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/exec_policy.hpp>
 
@@ -42,7 +46,9 @@
 #include <thrust/unique.h>
 
 #include <bitset>
+#include <map>
 #include <numeric>
+#include <optional>
 
 namespace cudf::io::parquet::detail {
 namespace {
@@ -201,6 +207,8 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
  * @param begin_chunk Index of first column chunk to read
  * @param end_chunk Index after the last column chunk to read
  * @param column_chunk_offsets File offset for all chunks
+ * @param partial_chunk_pages File offset and size of the data pages of the chunks that only load
+ * some of their pages. These follow the dictionary page of the chunk, read from its file offset
  * @param chunk_source_map Association between each column chunk and its source
  * @param stream CUDA stream used for device memory operations and kernel launches
  *
@@ -213,21 +221,34 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
   size_t begin_chunk,
   size_t end_chunk,
   std::vector<size_t> const& column_chunk_offsets,
+  std::vector<std::optional<std::pair<size_t, size_t>>> const& partial_chunk_pages,
   std::vector<size_type> const& chunk_source_map,
   rmm::cuda_stream_view stream)
 {
+  // Byte range to be read with `host_read` and copied to the device
+  struct host_read_info {
+    size_t offset;
+    size_t size;
+    uint8_t* dst;
+  };
+  // Grouped by source, so that the sources are read concurrently but each from a single thread
+  std::map<size_type, std::vector<host_read_info>> host_reads;
+
   // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
+    auto const& pages        = partial_chunk_pages[chunk];
+    size_t const pages_size  = pages.has_value() ? pages->second : 0;
     size_t const io_offset   = column_chunk_offsets[chunk];
-    size_t io_size           = chunks[chunk].compressed_size;
+    size_t io_size           = chunks[chunk].compressed_size - pages_size;
     size_t next_chunk        = chunk + 1;
     bool const is_compressed = (chunks[chunk].codec != Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
+    while (next_chunk < end_chunk && not pages.has_value()) {
       size_t const next_offset      = column_chunk_offsets[next_chunk];
       bool const is_next_compressed = (chunks[next_chunk].codec != Compression::UNCOMPRESSED);
       if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
-          chunk_source_map[chunk] != chunk_source_map[next_chunk]) {
+          chunk_source_map[chunk] != chunk_source_map[next_chunk] ||
+          partial_chunk_pages[next_chunk].has_value()) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -236,28 +257,27 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
       io_size += chunks[next_chunk].compressed_size;
       next_chunk++;
     }
-    if (io_size != 0) {
+    if (io_size + pages_size != 0) {
       auto& source = sources[chunk_source_map[chunk]];
-      if (source->is_device_read_preferred(io_size)) {
-        // Buffer needs to be padded.
-        // Required by `gpuDecodePageData`.
-        auto buffer =
-          rmm::device_buffer(cudf::util::round_up_safe(io_size, BUFFER_PADDING_MULTIPLE), stream);
-        auto fut_read_size = source->device_read_async(
-          io_offset, io_size, static_cast<uint8_t*>(buffer.data()), stream);
-        read_tasks.emplace_back(std::move(fut_read_size));
-        page_data[chunk] = datasource::buffer::create(std::move(buffer));
-      } else {
-        auto const read_buffer = source->host_read(io_offset, io_size);
-        // Buffer needs to be padded.
-        // Required by `gpuDecodePageData`.
-        auto tmp_buffer = rmm::device_buffer(
-          cudf::util::round_up_safe(read_buffer->size(), BUFFER_PADDING_MULTIPLE), stream);
-        CUDF_CUDA_TRY(cudaMemcpyAsync(
-          tmp_buffer.data(), read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream));
-        page_data[chunk] = datasource::buffer::create(std::move(tmp_buffer));
+      // Buffer needs to be padded.
+      // Required by `gpuDecodePageData`.
+      auto buffer = rmm::device_buffer(
+        cudf::util::round_up_safe(io_size + pages_size, BUFFER_PADDING_MULTIPLE), stream);
+      auto read_range = [&](size_t offset, size_t size, uint8_t* dst) {
+        if (size == 0) { return; }
+        if (source->is_device_read_preferred(size)) {
+          read_tasks.emplace_back(source->device_read_async(offset, size, dst, stream));
+        } else {
+          host_reads[chunk_source_map[chunk]].push_back({offset, size, dst});
+        }
+      };
+      read_range(io_offset, io_size, static_cast<uint8_t*>(buffer.data()));
+      // the selected pages of a partially loaded chunk follow its dictionary page
+      if (pages.has_value()) {
+        read_range(pages->first, pages_size, static_cast<uint8_t*>(buffer.data()) + io_size);
       }
-      auto d_compdata = page_data[chunk]->data();
+      page_data[chunk] = datasource::buffer::create(std::move(buffer));
+      auto d_compdata  = page_data[chunk]->data();
       do {
         chunks[chunk].compressed_data = d_compdata;
         d_compdata += chunks[chunk].compressed_size;
@@ -266,12 +286,47 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
       chunk = next_chunk;
     }
   }
-  auto sync_fn = [](decltype(read_tasks) read_tasks) {
+
+  // Read each source on the reader thread pool, copying to the device on a separate stream per
+  // task so that the reads and copies of different sources overlap
+  auto& pool   = reader_thread_pool();
+  auto streams = cudf::detail::fork_streams(
+    stream, std::min<size_t>(host_reads.size(), pool.get_thread_count()));
+  size_t task_idx = 0;
+  for (auto& [src_idx, reads] : host_reads) {
+    auto const task_stream = streams[task_idx++ % streams.size()];
+    read_tasks.push_back(pool.submit([source = sources[src_idx].get(),
+                                      reads  = std::move(reads),
+                                      task_stream]() {
+      size_t bytes_read = 0;
+      for (auto const& read : reads) {
+        auto const read_buffer = source->host_read(read.offset, read.size);
+        CUDF_CUDA_TRY(cudaMemcpyAsync(read.dst,
+                                      read_buffer->data(),
+                                      read_buffer->size(),
+                                      cudaMemcpyDefault,
+                                      task_stream.value()));
+        // The host buffer is released at the end of the iteration
+        task_stream.synchronize();
+        bytes_read += read_buffer->size();
+      }
+      return bytes_read;
+    }));
+  }
+
+  auto sync_fn = [stream](decltype(read_tasks) read_tasks, decltype(streams) streams) {
+    // Wait for all tasks before rethrowing any error, as they reference the output buffers
     for (auto& task : read_tasks) {
       task.wait();
     }
+    size_t bytes_read = 0;
+    for (auto& task : read_tasks) {
+      bytes_read += task.get();
+    }
+    cudf::detail::join_streams(streams, stream);
+    CUDF_LOG_PERF("parquet_read", "bytes={} reads={}", bytes_read, read_tasks.size());
   };
-  return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
+  return std::async(std::launch::deferred, sync_fn, std::move(read_tasks), std::move(streams));
 }
 
 /**
@@ -760,6 +815,7 @@ void reader::impl::build_string_dict_indices()
 
 void reader::impl::allocate_nesting_info()
 {
+  allocation_purpose_scope const purpose{allocation_purpose::TEMPORARY};
   auto& pass    = *_pass_itm_data;
   auto& subpass = *pass.subpass;
 
@@ -863,8 +919,9 @@ void reader::impl::allocate_nesting_info()
           // values indexed by output column index
           nesting_info[cur_depth].max_def_level = cur_schema.max_definition_level;
           pni[cur_depth].size                   = 0;
-          pni[cur_depth].type =
-            to_type_id(cur_schema, _strings_to_categorical, _timestamp_type.id());
+          auto const as_categorical =
+            _strings_to_categorical or is_dictionary_column(schema_idx);
+          pni[cur_depth].type = to_type_id(cur_schema, as_categorical, _timestamp_type.id());
           pni[cur_depth].nullable = cur_schema.repetition_type == OPTIONAL;
         }
 
@@ -887,6 +944,7 @@ void reader::impl::allocate_nesting_info()
 
 void reader::impl::allocate_level_decode_space()
 {
+  allocation_purpose_scope const purpose{allocation_purpose::TEMPORARY};
   auto& pass    = *_pass_itm_data;
   auto& subpass = *pass.subpass;
 
@@ -913,6 +971,7 @@ void reader::impl::allocate_level_decode_space()
 
 std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks()
 {
+  allocation_purpose_scope const purpose{allocation_purpose::INPUT_BUFFER};
   auto const& row_groups_info = _pass_itm_data->row_groups;
 
   auto& raw_page_data = _pass_itm_data->raw_page_data;
@@ -931,6 +990,11 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks
   // Keep track of column chunk file offsets
   std::vector<size_t> column_chunk_offsets(num_chunks);
 
+  // Passes reading part of a row group only load the pages spanning their rows
+  auto const is_partial_pass =
+    _file_itm_data.input_passes[_file_itm_data._current_input_pass].row_group_rows.has_value();
+  std::vector<std::optional<std::pair<size_t, size_t>>> partial_chunk_pages(num_chunks);
+
   // Initialize column chunk information
   size_t total_decompressed_size = 0;
   // TODO: make this respect the pass-wide skip_rows/num_rows instead of the file-wide
@@ -953,6 +1017,14 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks
           ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
           : col_meta.data_page_offset;
 
+      if (is_partial_pass) {
+        auto const& info                 = *chunks[chunk_count].h_chunk_info;
+        auto const pages                 = info.page_bytes(0, info.pages.size());
+        partial_chunk_pages[chunk_count] = pages;
+        column_chunk_offsets[chunk_count] =
+          info.has_dictionary() ? info.dictionary_offset.value() : pages.first;
+      }
+
       // Map each column chunk to its column index and its source index
       chunk_source_map[chunk_count] = row_group_source;
 
@@ -971,12 +1043,53 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks
                                                       0,
                                                       chunks.size(),
                                                       column_chunk_offsets,
+                                                      partial_chunk_pages,
                                                       chunk_source_map,
                                                       _stream));
 
   return {total_decompressed_size > 0, std::move(read_chunk_tasks)};
 }
 
+void reader::impl::prefetch_pass_data(size_t pass)
+{
+  if (pass >= _file_itm_data.num_passes()) { return; }
+
+  auto const& pass_info   = _file_itm_data.input_passes[pass];
+  auto const num_columns = _input_columns.size();
+
+  // Byte ranges of the column chunks, per source
+  std::vector<std::vector<std::pair<size_t, size_t>>> ranges(_sources.size());
+  for (auto rg_idx = pass_info.row_group_start; rg_idx < pass_info.row_group_end; ++rg_idx) {
+    auto const& rg = _file_itm_data.row_groups[rg_idx];
+    for (size_t c = 0; c < num_columns; ++c) {
+      auto const& col = _input_columns[c];
+      // passes reading part of a row group only load the dictionary and the pages of their rows
+      if (pass_info.row_group_rows.has_value()) {
+        auto const& info         = *_file_itm_data.chunks[rg_idx * num_columns + c].h_chunk_info;
+        auto const& rows         = *pass_info.row_group_rows;
+        auto const [first, last] = info.page_range(rows.skip_rows, rows.skip_rows + rows.num_rows);
+        if (info.has_dictionary()) {
+          ranges[rg.source_index].emplace_back(info.dictionary_offset.value(),
+                                               info.dictionary_size.value());
+        }
+        ranges[rg.source_index].push_back(info.page_bytes(first, last));
+        continue;
+      }
+      auto const& col_meta =
+        _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
+      auto const offset =
+        (col_meta.dictionary_page_offset != 0)
+          ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+          : col_meta.data_page_offset;
+      ranges[rg.source_index].emplace_back(offset, col_meta.total_compressed_size);
+    }
+  }
+
+  for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+    if (not ranges[src_idx].empty()) { _sources[src_idx]->prefetch(ranges[src_idx]); }
+  }
+}
+
 void reader::impl::read_compressed_data()
 {
   auto& pass = *_pass_itm_data;
@@ -1005,6 +1118,44 @@ void reader::impl::read_compressed_data()
                "Encountered page_offsets / num_columns mismatch");
 }
 
+void reader::impl::skip_filtered_pages()
+{
+  auto& pass = *_pass_itm_data;
+
+  // page rows are only known up front from the offset indexes
+  if (not _has_page_index or
+      std::none_of(pass.row_groups.cbegin(), pass.row_groups.cend(), [](auto const& rg) {
+        return rg.filtered_rows.has_value();
+      })) {
+    return;
+  }
+
+  auto const num_columns = _input_columns.size();
+  bool any_skipped       = false;
+  for (auto& page : pass.pages) {
+    if (page.flags & PAGEINFO_FLAGS_DICTIONARY) { continue; }
+    // chunks are laid out row group by row group
+    auto const& rg        = pass.row_groups[page.chunk_idx / num_columns];
+    auto const& chunk     = pass.chunks[page.chunk_idx];
+    auto const& input_col = _input_columns[chunk.src_col_index];
+    if (not rg.filtered_rows.has_value() or input_col.nesting_depth() != 1 or
+        not cudf::is_fixed_width(_output_buffers[input_col.nesting[0]].type) or
+        is_dictionary_column(chunk.src_col_schema)) {
+      continue;
+    }
+    auto const page_begin = static_cast<size_t>(page.chunk_row);
+    auto const page_end   = page_begin + page.num_rows;
+    auto const& ranges    = rg.filtered_rows.value();
+    if (std::none_of(ranges.cbegin(), ranges.cend(), [&](auto const& range) {
+          return range.first < page_end and page_begin < range.second;
+        })) {
+      page.flags |= PAGEINFO_FLAGS_SKIPPED;
+      any_skipped = true;
+    }
+  }
+  if (any_skipped) { pass.pages.host_to_device_async(_stream); }
+}
+
 namespace {
 
 struct cumulative_row_info {
@@ -1228,10 +1379,46 @@ void reader::impl::preprocess_file(
                    std::back_inserter(output_types),
                    [](auto const& col) { return col.type; });
   }
+
+  // prune the row groups whose statistics rule out all keys of the membership filter; selecting
+  // row groups overrides the row bounds, so only when they are not set
+  std::optional<std::vector<std::vector<size_type>>> membership_row_groups;
+  if (_membership_filter.has_value() and skip_rows == 0 and not num_rows.has_value()) {
+    auto const it =
+      std::find_if(_output_buffers.cbegin(), _output_buffers.cend(), [this](auto const& col) {
+        return col.name == _membership_filter_column;
+      });
+    if (it != _output_buffers.cend()) {
+      auto const col_idx    = std::distance(_output_buffers.cbegin(), it);
+      membership_row_groups = _metadata->filter_row_groups_with_membership(
+        row_group_indices,
+        it->type,
+        _output_column_schemas[col_idx],
+        _membership_filter.value().get(),
+        _stream);
+      if (membership_row_groups.has_value()) {
+        row_group_indices = host_span<std::vector<size_type> const>(membership_row_groups.value());
+      }
+    }
+  }
+
   std::tie(
     _file_itm_data.global_skip_rows, _file_itm_data.global_num_rows, _file_itm_data.row_groups) =
-    _metadata->select_row_groups(
-      row_group_indices, skip_rows, num_rows, output_types, filter, _stream);
+    _metadata->select_row_groups(_sources,
+                                 row_group_indices,
+                                 skip_rows,
+                                 num_rows,
+                                 output_types,
+                                 _output_column_schemas,
+                                 filter,
+                                 _stream);
+
+  // rows selected by the caller, only set when reading without a filter
+  for (auto& rg : _file_itm_data.row_groups) {
+    if (auto it = _selected_rows.find({rg.source_index, rg.index}); it != _selected_rows.end()) {
+      rg.filtered_rows = it->second;
+    }
+  }
 
   // check for page indexes
   _has_page_index = std::all_of(_file_itm_data.row_groups.begin(),
@@ -1248,6 +1435,13 @@ void reader::impl::preprocess_file(
     compute_input_passes();
   }
 
+  CUDF_LOG_PERF("parquet_preprocess",
+                "row_groups={} passes={} columns={} rows={}",
+                _file_itm_data.row_groups.size(),
+                _file_itm_data.num_passes(),
+                _input_columns.size(),
+                _file_itm_data.global_num_rows);
+
 #if defined(PARQUET_CHUNK_LOGGING)
   printf("==============================================\n");
   setlocale(LC_NUMERIC, "");
@@ -1261,7 +1455,10 @@ void reader::impl::preprocess_file(
   printf("# Input columns: %'lu\n", _input_columns.size());
   for (size_t idx = 0; idx < _input_columns.size(); idx++) {
     auto const& schema = _metadata->get_schema(_input_columns[idx].schema_idx);
-    auto const type_id = to_type_id(schema, _strings_to_categorical, _timestamp_type.id());
+    auto const type_id =
+      to_type_id(schema,
+                 _strings_to_categorical or is_dictionary_column(_input_columns[idx].schema_idx),
+                 _timestamp_type.id());
     printf("\tC(%'lu, %s): %s\n",
            idx,
            _input_columns[idx].name.c_str(),
@@ -1444,6 +1641,7 @@ void reader::impl::preprocess_subpass_pages(bool uses_custom_row_bounds, size_t
 
 void reader::impl::allocate_columns(size_t skip_rows, size_t num_rows, bool uses_custom_row_bounds)
 {
+  allocation_purpose_scope const purpose{allocation_purpose::OUTPUT};
   auto& pass    = *_pass_itm_data;
   auto& subpass = *pass.subpass;
 
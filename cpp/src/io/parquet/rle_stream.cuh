@@ -266,7 +266,9 @@ struct rle_stream {
       int written = 0;
       while (written < output_count) {
         int const batch_size = min(num_rle_stream_decode_threads, output_count - written);
-        if (t < batch_size) { output[rolling_index<max_output_values>(written + t)] = 0; }
+        if (t < batch_size) {
+          output[rolling_index<max_output_values>(cur_values + written + t)] = 0;
+        }
         written += batch_size;
       }
       cur_values += output_count;
@@ -31,7 +31,9 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/get_value.cuh>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/linked_column.hpp>
 #include <cudf/detail/utilities/pinned_host_vector.hpp>
@@ -41,17 +43,27 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <cuda/functional>
+#include <thrust/binary_search.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <numeric>
+#include <optional>
 #include <utility>
 
 #ifndef CUDF_VERSION
@@ -268,12 +280,17 @@ bool is_col_fixed_width(column_view const& column)
  * 3. ts_scale: scale to multiply or divide timestamp by in order to convert timestamp to parquet
  *    supported types
  * 4. requested_encoding: A user provided encoding to use for the column.
+ * 5. bloom_filter_fpp, bloom_filter_max_bytes: User provided Bloom filter settings of the column.
+ * 6. compression: A user provided compression codec for the column.
  */
 struct schema_tree_node : public SchemaElement {
   cudf::detail::LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
   column_encoding requested_encoding;
+  std::optional<double> bloom_filter_fpp;
+  size_t bloom_filter_max_bytes;
+  std::optional<compression_type> compression;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -657,9 +674,19 @@ std::vector<schema_tree_node> construct_schema_tree(
               }
               break;
 
+            case column_encoding::BYTE_STREAM_SPLIT:
+              if (s.type != Type::FLOAT && s.type != Type::DOUBLE) {
+                CUDF_LOG_WARN(
+                  "BYTE_STREAM_SPLIT encoding is only supported for FLOAT and DOUBLE columns; the "
+                  "requested encoding will be ignored");
+                return;
+              }
+              break;
+
             // supported parquet encodings
             case column_encoding::PLAIN:
-            case column_encoding::DICTIONARY: break;
+            case column_encoding::DICTIONARY:
+            case column_encoding::AUTO: break;
 
             // all others
             default:
@@ -674,6 +701,37 @@ std::vector<schema_tree_node> construct_schema_tree(
         }
       };
 
+      // only call this after col_schema.type has been set
+      auto set_bloom_filter = [](schema_tree_node& s, column_in_metadata const& col_meta) {
+        if (not col_meta.is_bloom_filter_enabled()) { return; }
+        auto const fpp = col_meta.get_bloom_filter_fpp();
+        CUDF_EXPECTS(fpp > 0 and fpp < 1,
+                     "Bloom filter false positive probability must be in the range (0, 1)");
+
+        // The filter holds the hashes of the PLAIN encoded values, which are only computed for
+        // the types that are stored without conversion
+        auto const col_type     = s.leaf_column->type();
+        auto const is_supported = [&] {
+          switch (s.type) {
+            case Type::INT32:
+            case Type::INT64:
+              return cudf::is_integral(col_type) and not cudf::is_boolean(col_type);
+            case Type::FLOAT:
+            case Type::DOUBLE: return cudf::is_floating_point(col_type);
+            case Type::BYTE_ARRAY: return col_type.id() == type_id::STRING;
+            default: return false;
+          }
+        }();
+        if (not is_supported) {
+          CUDF_LOG_WARN(
+            "Bloom filters are only supported for integral, floating point and string columns; "
+            "the requested Bloom filter will be ignored");
+          return;
+        }
+        s.bloom_filter_fpp       = fpp;
+        s.bloom_filter_max_bytes = col_meta.get_bloom_filter_max_bytes();
+      };
+
       // There is a special case for a list<int8> column with one byte column child. This column can
       // have a special flag that indicates we write this out as binary instead of a list. This is a
       // more efficient storage mechanism for a single-depth list of bytes, but is a departure from
@@ -698,6 +756,7 @@ std::vector<schema_tree_node> construct_schema_tree(
         set_field_id(col_schema, col_meta);
         set_encoding(col_schema, col_meta);
         col_schema.output_as_byte_array = col_meta.is_enabled_output_as_binary();
+        col_schema.compression          = col_meta.get_compression();
         schema.push_back(col_schema);
       } else if (col->type().id() == type_id::STRUCT) {
         // if struct, add current and recursively call for all children
@@ -833,6 +892,8 @@ std::vector<schema_tree_node> construct_schema_tree(
         col_schema.leaf_column = col;
         set_field_id(col_schema, col_meta);
         set_encoding(col_schema, col_meta);
+        set_bloom_filter(col_schema, col_meta);
+        col_schema.compression = col_meta.get_compression();
         schema.push_back(col_schema);
       }
     };
@@ -873,6 +934,16 @@ struct parquet_column_view {
 
   std::vector<std::string> const& get_path_in_schema() { return path_in_schema; }
 
+  [[nodiscard]] std::optional<double> bloom_filter_fpp() const
+  {
+    return schema_node.bloom_filter_fpp;
+  }
+  [[nodiscard]] size_t bloom_filter_max_bytes() const { return schema_node.bloom_filter_max_bytes; }
+  [[nodiscard]] std::optional<compression_type> compression() const
+  {
+    return schema_node.compression;
+  }
+
   // LIST related member functions
   [[nodiscard]] uint8_t max_def_level() const noexcept { return _max_def_level; }
   [[nodiscard]] uint8_t max_rep_level() const noexcept { return _max_rep_level; }
@@ -1117,13 +1188,53 @@ size_t max_compression_output_size(Compression codec, uint32_t compression_block
   return compress_max_output_chunk_size(to_nvcomp_compression_type(codec), compression_blocksize);
 }
 
+// Page alignment that satisfies all the given codecs; alignments are powers of two
+auto page_alignment(host_span<Compression const> codecs)
+{
+  return std::accumulate(codecs.begin(), codecs.end(), 1u, [](auto alignment, auto codec) {
+    return std::max(alignment, page_alignment(codec));
+  });
+}
+
+// Size of compression output buffer that fits the output of any of the given codecs
+size_t max_compression_output_size(host_span<Compression const> codecs,
+                                   uint32_t compression_blocksize)
+{
+  return std::accumulate(
+    codecs.begin(), codecs.end(), size_t{0}, [compression_blocksize](auto size, auto codec) {
+      return std::max(size, max_compression_output_size(codec, compression_blocksize));
+    });
+}
+
+// Maximum fraction by which the sampled output of the selected adaptive codec can exceed the
+// smallest sampled output
+constexpr double adaptive_compression_tolerance = 0.05;
+
+/**
+ * @brief Returns the codecs that can be selected for columns with adaptive compression.
+ *
+ * The codecs are ordered from the fastest to the slowest to encode. Snappy is always available
+ * through the cuIO implementation.
+ */
+std::vector<Compression> adaptive_compression_candidates()
+{
+  std::vector<Compression> codecs{Compression::UNCOMPRESSED, Compression::SNAPPY};
+  if (not nvcomp::is_compression_disabled(nvcomp::compression_type::LZ4)) {
+    codecs.push_back(Compression::LZ4_RAW);
+  }
+  if (not nvcomp::is_compression_disabled(nvcomp::compression_type::ZSTD)) {
+    codecs.push_back(Compression::ZSTD);
+  }
+  return codecs;
+}
+
 auto init_page_sizes(hostdevice_2dvector<EncColumnChunk>& chunks,
                      device_span<parquet_column_device_view const> col_desc,
                      uint32_t num_columns,
                      size_t max_page_size_bytes,
                      size_type max_page_size_rows,
                      bool write_v2_headers,
-                     Compression compression_codec,
+                     host_span<Compression const> codecs,
                      rmm::cuda_stream_view stream)
 {
   if (chunks.is_empty()) { return cudf::detail::hostdevice_vector<size_type>{}; }
@@ -1138,7 +1249,7 @@ auto init_page_sizes(hostdevice_2dvector<EncColumnChunk>& chunks,
                    num_columns,
                    max_page_size_bytes,
                    max_page_size_rows,
-                   page_alignment(compression_codec),
+                   page_alignment(codecs),
                    write_v2_headers,
                    nullptr,
                    nullptr,
@@ -1163,7 +1274,7 @@ auto init_page_sizes(hostdevice_2dvector<EncColumnChunk>& chunks,
                    num_columns,
                    max_page_size_bytes,
                    max_page_size_rows,
-                   page_alignment(compression_codec),
+                   page_alignment(codecs),
                    write_v2_headers,
                    nullptr,
                    nullptr,
@@ -1175,8 +1286,8 @@ auto init_page_sizes(hostdevice_2dvector<EncColumnChunk>& chunks,
   std::transform(page_sizes.begin(),
                  page_sizes.end(),
                  comp_page_sizes.begin(),
-                 [compression_codec](auto page_size) {
-                   return max_compression_output_size(compression_codec, page_size);
+                 [codecs](auto page_size) {
+                   return max_compression_output_size(codecs, page_size);
                  });
   comp_page_sizes.host_to_device_async(stream);
 
@@ -1189,7 +1300,7 @@ auto init_page_sizes(hostdevice_2dvector<EncColumnChunk>& chunks,
                    num_columns,
                    max_page_size_bytes,
                    max_page_size_rows,
-                   page_alignment(compression_codec),
+                   page_alignment(codecs),
                    write_v2_headers,
                    nullptr,
                    nullptr,
@@ -1212,11 +1323,20 @@ size_t max_page_bytes(Compression compression, size_t max_page_size_bytes)
   return std::min<size_t>(max_size, std::numeric_limits<int32_t>::max());
 }
 
+// Maximum page size that is supported by all the given codecs
+size_t max_page_bytes(host_span<Compression const> codecs, size_t max_page_size_bytes)
+{
+  return std::accumulate(
+    codecs.begin(), codecs.end(), max_page_size_bytes, [](auto max_size, auto codec) {
+      return max_page_bytes(codec, max_size);
+    });
+}
+
 std::pair<std::vector<rmm::device_uvector<size_type>>, std::vector<rmm::device_uvector<size_type>>>
 build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
                          host_span<parquet_column_device_view const> col_desc,
                          device_2dspan<PageFragment const> frags,
-                         Compression compression,
+                         host_span<Compression const> codecs,
                          dictionary_policy dict_policy,
                          size_t max_dict_size,
                          rmm::cuda_stream_view stream)
@@ -1245,7 +1365,8 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
     auto const& chunk_col_desc = col_desc[chunk.col_desc_id];
     auto const is_requested_non_dict =
       chunk_col_desc.requested_encoding != column_encoding::USE_DEFAULT &&
-      chunk_col_desc.requested_encoding != column_encoding::DICTIONARY;
+      chunk_col_desc.requested_encoding != column_encoding::DICTIONARY &&
+      chunk_col_desc.requested_encoding != column_encoding::AUTO;
     auto const is_type_non_dict =
       chunk_col_desc.physical_type == Type::BOOLEAN ||
       (chunk_col_desc.output_as_byte_array && chunk_col_desc.physical_type == Type::BYTE_ARRAY);
@@ -1292,7 +1413,7 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
       // don't use dictionary if it gets too large for the given compression codec
       if (dict_policy == dictionary_policy::ADAPTIVE) {
         auto const unique_size = static_cast<size_t>(ck.uniq_data_size);
-        if (unique_size > max_page_bytes(compression, max_dict_size)) { return {false, 0}; }
+        if (unique_size > max_page_bytes(codecs, max_dict_size)) { return {false, 0}; }
       }
 
       return {true, nbits};
@@ -1332,6 +1453,134 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
   return std::pair(std::move(dict_data), std::move(dict_index));
 }
 
+/**
+ * @brief Selects the encoding of the column chunks whose requested encoding is AUTO.
+ *
+ * Picks the smallest of the PLAIN size, the dictionary size if the chunk can use a dictionary, and
+ * the estimated DELTA_BINARY_PACKED (integers) or DELTA_BYTE_ARRAY (strings) size. Ties go to the
+ * dictionary, then to PLAIN. Must be called after the chunk dictionaries are built.
+ *
+ * @param chunks Column chunk array
+ * @param col_desc Column description array
+ * @param frags Column fragments
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void select_chunk_encodings(hostdevice_2dvector<EncColumnChunk>& chunks,
+                            host_span<parquet_column_device_view const> col_desc,
+                            device_2dspan<PageFragment const> frags,
+                            rmm::cuda_stream_view stream)
+{
+  auto h_chunks = chunks.host_view().flat_view();
+  auto const is_auto_encoding = [&](EncColumnChunk const& ck) {
+    return col_desc[ck.col_desc_id].requested_encoding == column_encoding::AUTO;
+  };
+  if (std::none_of(h_chunks.begin(), h_chunks.end(), is_auto_encoding)) { return; }
+
+  estimate_chunk_delta_sizes(frags, stream);
+  chunks.device_to_host_sync(stream);
+
+  constexpr auto unavailable = std::numeric_limits<size_t>::max();
+  for (auto& ck : h_chunks) {
+    if (not is_auto_encoding(ck)) { continue; }
+
+    auto const plain_size = static_cast<size_t>(ck.plain_data_size);
+    auto const rle_size =
+      util::div_rounding_up_safe<size_t>(static_cast<size_t>(ck.num_values) * ck.dict_rle_bits, 8);
+    auto const dict_size =
+      ck.use_dictionary ? static_cast<size_t>(ck.uniq_data_size) + rle_size : unavailable;
+    // Only integer and string chunks have a DELTA size estimate
+    auto const delta_size =
+      ck.delta_data_size > 0 ? static_cast<size_t>(ck.delta_data_size) : unavailable;
+
+    // PLAIN is also the fallback if the dictionary turns out to be too large for a page
+    ck.selected_encoding = column_encoding::PLAIN;
+    if (dict_size <= std::min(plain_size, delta_size)) { continue; }
+
+    ck.use_dictionary = false;
+    if (delta_size < plain_size) {
+      ck.selected_encoding = col_desc[ck.col_desc_id].physical_type == Type::BYTE_ARRAY
+                               ? column_encoding::DELTA_BYTE_ARRAY
+                               : column_encoding::DELTA_BINARY_PACKED;
+    }
+  }
+  chunks.host_to_device_async(stream);
+}
+
+/**
+ * @brief Computes the size of the Bloom filter bitset of a column chunk.
+ *
+ * The Parquet specification gives the optimal number of bits for `num_distinct` values and a
+ * target false positive probability `fpp` as `-8 * num_distinct / log(1 - fpp^(1/8))`. The size is
+ * rounded up to a power of two, between a single 32-byte block and `max_bytes`.
+ *
+ * @param num_distinct Upper bound of the number of distinct values in the chunk
+ * @param fpp Target false positive probability
+ * @param max_bytes Maximum size of the bitset, in bytes
+ * @return Size of the bitset, in bytes
+ */
+uint32_t bloom_filter_size_bytes(size_type num_distinct, double fpp, size_t max_bytes)
+{
+  constexpr uint32_t min_size = 32;
+  // Upper limit of the bitset size used by other writers; also keeps the size within `int32_t`
+  constexpr uint32_t max_size_limit = 128 * 1024 * 1024;
+
+  auto const optimal_size =
+    std::ceil(-8.0 * num_distinct / std::log(1.0 - std::pow(fpp, 1.0 / 8)) / 8);
+  auto const max_size = std::clamp<size_t>(max_bytes, min_size, max_size_limit);
+  uint32_t size       = min_size;
+  while (size < optimal_size and size * 2 <= max_size) {
+    size *= 2;
+  }
+  return size;
+}
+
+/**
+ * @brief Allocates and builds the Bloom filters of the column chunks that request them.
+ *
+ * Must be called after the chunk dictionaries are built, so that the number of distinct values of
+ * the chunks is known.
+ *
+ * @param chunks Column chunk array
+ * @param parquet_columns Columns written to the file, indexed by `col_desc_id`
+ * @param frags Column fragments
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Device buffer with the bitsets of all Bloom filters
+ */
+rmm::device_uvector<uint32_t> build_chunk_bloom_filters(
+  hostdevice_2dvector<EncColumnChunk>& chunks,
+  host_span<parquet_column_view const> parquet_columns,
+  device_2dspan<PageFragment const> frags,
+  rmm::cuda_stream_view stream)
+{
+  auto h_chunks = chunks.host_view().flat_view();
+
+  size_t num_words = 0;
+  for (auto& ck : h_chunks) {
+    auto const& col = parquet_columns[ck.col_desc_id];
+    if (not col.bloom_filter_fpp().has_value() or ck.num_values == 0) { continue; }
+    // Chunks that built a dictionary hash map know their number of distinct values
+    auto const num_distinct = ck.dict_map_slots != nullptr ? ck.num_dict_entries : ck.num_values;
+    ck.bloom_filter_size    = bloom_filter_size_bytes(
+      num_distinct, col.bloom_filter_fpp().value(), col.bloom_filter_max_bytes());
+    num_words += ck.bloom_filter_size / sizeof(uint32_t);
+  }
+
+  rmm::device_uvector<uint32_t> bitsets(num_words, stream);
+  if (num_words == 0) { return bitsets; }
+
+  auto bitset = bitsets.data();
+  for (auto& ck : h_chunks) {
+    if (ck.bloom_filter_size == 0) { continue; }
+    ck.bloom_filter_bitset = bitset;
+    bitset += ck.bloom_filter_size / sizeof(uint32_t);
+  }
+  thrust::uninitialized_fill(rmm::exec_policy_nosync(stream), bitsets.begin(), bitsets.end(), 0);
+  chunks.host_to_device_async(stream);
+  populate_chunk_bloom_filters(frags, stream);
+
+  return bitsets;
+}
+
 /**
  * @brief Initialize encoder pages.
  *
@@ -1344,7 +1593,7 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
  * @param num_columns Total number of columns
  * @param num_pages Total number of pages
  * @param num_stats_bfr Number of statistics buffers
- * @param compression Compression format
+ * @param codecs Compression codecs used by the column chunks
  * @param max_page_size_bytes Maximum uncompressed page size, in bytes
  * @param max_page_size_rows Maximum page size, in rows
  * @param write_v2_headers True if version 2 page headers are to be written
@@ -1359,7 +1608,7 @@ void init_encoder_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
                         uint32_t num_columns,
                         uint32_t num_pages,
                         uint32_t num_stats_bfr,
-                        Compression compression,
+                        host_span<Compression const> codecs,
                         size_t max_page_size_bytes,
                         size_type max_page_size_rows,
                         bool write_v2_headers,
@@ -1375,7 +1624,7 @@ void init_encoder_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
                    num_columns,
                    max_page_size_bytes,
                    max_page_size_rows,
-                   page_alignment(compression),
+                   page_alignment(codecs),
                    write_v2_headers,
                    (num_stats_bfr) ? page_stats_mrg.data() : nullptr,
                    (num_stats_bfr > num_pages) ? page_stats_mrg.data() + num_pages : nullptr,
@@ -1395,6 +1644,205 @@ void init_encoder_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
   stream.synchronize();
 }
 
+/**
+ * @brief Compress pages with the given codec.
+ *
+ * @param codec Compression codec
+ * @param comp_in Input of the compression of each page
+ * @param comp_out Output of the compression of each page
+ * @param comp_res Result of the compression of each page
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void compress_pages(Compression codec,
+                    device_span<device_span<uint8_t const> const> comp_in,
+                    device_span<device_span<uint8_t> const> comp_out,
+                    device_span<compression_result> comp_res,
+                    rmm::cuda_stream_view stream)
+{
+  switch (codec) {
+    case Compression::SNAPPY:
+      if (nvcomp::is_compression_disabled(nvcomp::compression_type::SNAPPY)) {
+        gpu_snap(comp_in, comp_out, comp_res, stream);
+      } else {
+        nvcomp::batched_compress(
+          nvcomp::compression_type::SNAPPY, comp_in, comp_out, comp_res, stream);
+      }
+      break;
+    case Compression::ZSTD: {
+      if (auto const reason = nvcomp::is_compression_disabled(nvcomp::compression_type::ZSTD);
+          reason) {
+        CUDF_FAIL("Compression error: " + reason.value());
+      }
+      nvcomp::batched_compress(nvcomp::compression_type::ZSTD, comp_in, comp_out, comp_res, stream);
+      break;
+    }
+    case Compression::LZ4_RAW: {
+      if (auto const reason = nvcomp::is_compression_disabled(nvcomp::compression_type::LZ4);
+          reason) {
+        CUDF_FAIL("Compression error: " + reason.value());
+      }
+      nvcomp::batched_compress(nvcomp::compression_type::LZ4, comp_in, comp_out, comp_res, stream);
+      break;
+    }
+    case Compression::UNCOMPRESSED: break;
+    default: CUDF_FAIL("invalid compression type");
+  }
+}
+
+/**
+ * @brief Compress each page with the codec of its column chunk.
+ *
+ * Pages are compressed in one batch per codec. The results of uncompressed pages are unchanged.
+ *
+ * @param page_codecs Compression codec of each page
+ * @param comp_in Input of the compression of each page
+ * @param comp_out Output of the compression of each page
+ * @param comp_res Result of the compression of each page
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void compress_pages(host_span<Compression const> page_codecs,
+                    device_span<device_span<uint8_t const> const> comp_in,
+                    device_span<device_span<uint8_t> const> comp_out,
+                    device_span<compression_result> comp_res,
+                    rmm::cuda_stream_view stream)
+{
+  std::vector<Compression> codecs(page_codecs.begin(), page_codecs.end());
+  std::sort(codecs.begin(), codecs.end());
+  codecs.erase(std::unique(codecs.begin(), codecs.end()), codecs.end());
+
+  // Common case of a single codec for all pages
+  if (codecs.size() == 1) {
+    compress_pages(codecs.front(), comp_in, comp_out, comp_res, stream);
+    return;
+  }
+
+  for (auto const codec : codecs) {
+    if (codec == Compression::UNCOMPRESSED) { continue; }
+
+    std::vector<size_type> page_indices;
+    for (size_t page = 0; page < page_codecs.size(); ++page) {
+      if (page_codecs[page] == codec) { page_indices.push_back(static_cast<size_type>(page)); }
+    }
+    auto const d_page_indices = cudf::detail::make_device_uvector_async(
+      page_indices, stream, rmm::mr::get_current_device_resource());
+
+    rmm::device_uvector<device_span<uint8_t const>> codec_in(page_indices.size(), stream);
+    rmm::device_uvector<device_span<uint8_t>> codec_out(page_indices.size(), stream);
+    rmm::device_uvector<compression_result> codec_res(page_indices.size(), stream);
+    thrust::gather(rmm::exec_policy_nosync(stream),
+                   d_page_indices.begin(),
+                   d_page_indices.end(),
+                   comp_in.begin(),
+                   codec_in.begin());
+    thrust::gather(rmm::exec_policy_nosync(stream),
+                   d_page_indices.begin(),
+                   d_page_indices.end(),
+                   comp_out.begin(),
+                   codec_out.begin());
+    thrust::fill(rmm::exec_policy_nosync(stream),
+                 codec_res.begin(),
+                 codec_res.end(),
+                 compression_result{0, compression_status::FAILURE});
+
+    compress_pages(codec, codec_in, codec_out, codec_res, stream);
+
+    thrust::scatter(rmm::exec_policy_nosync(stream),
+                    codec_res.begin(),
+                    codec_res.end(),
+                    d_page_indices.begin(),
+                    comp_res.begin());
+  }
+}
+
+/**
+ * @brief Select the codec of the column chunks with adaptive compression.
+ *
+ * The first data page of each chunk is compressed with every candidate codec, including
+ * `UNCOMPRESSED`. The first candidate, i.e. the fastest codec, whose output is within
+ * `adaptive_compression_tolerance` of the smallest output is selected.
+ *
+ * @param chunks Column chunks of the batch
+ * @param first_page_in_batch First page in batch
+ * @param comp_in Input of the compression of each page in batch
+ * @param comp_out Output of the compression of each page in batch; overwritten for the samples
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Compression codec of each column chunk of the batch
+ */
+std::vector<Compression> select_chunk_codecs(host_span<EncColumnChunk const> chunks,
+                                             uint32_t first_page_in_batch,
+                                             device_span<device_span<uint8_t const> const> comp_in,
+                                             device_span<device_span<uint8_t> const> comp_out,
+                                             rmm::cuda_stream_view stream)
+{
+  std::vector<Compression> chunk_codecs;
+  std::vector<size_t> sample_chunks;
+  std::vector<size_type> sample_pages;
+  for (size_t c = 0; c < chunks.size(); ++c) {
+    auto const& ck = chunks[c];
+    chunk_codecs.push_back(ck.is_codec_adaptive ? Compression::UNCOMPRESSED : ck.codec);
+    if (not ck.is_codec_adaptive or ck.num_data_pages() == 0) { continue; }
+    sample_chunks.push_back(c);
+    sample_pages.push_back(ck.first_page + ck.num_dict_pages() - first_page_in_batch);
+  }
+  if (sample_pages.empty()) { return chunk_codecs; }
+
+  auto const num_samples    = sample_pages.size();
+  auto const d_sample_pages = cudf::detail::make_device_uvector_async(
+    sample_pages, stream, rmm::mr::get_current_device_resource());
+  rmm::device_uvector<device_span<uint8_t const>> sample_in(num_samples, stream);
+  rmm::device_uvector<device_span<uint8_t>> sample_out(num_samples, stream);
+  rmm::device_uvector<compression_result> sample_res(num_samples, stream);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 d_sample_pages.begin(),
+                 d_sample_pages.end(),
+                 comp_in.begin(),
+                 sample_in.begin());
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 d_sample_pages.begin(),
+                 d_sample_pages.end(),
+                 comp_out.begin(),
+                 sample_out.begin());
+  auto const h_sample_in = cudf::detail::make_std_vector_sync(sample_in, stream);
+
+  // Size of each sample page with each candidate codec; failures count as uncompressed
+  auto const candidates = adaptive_compression_candidates();
+  std::vector<std::vector<size_t>> sample_sizes(candidates.size());
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    std::transform(h_sample_in.begin(),
+                   h_sample_in.end(),
+                   std::back_inserter(sample_sizes[i]),
+                   [](auto const& in) { return in.size(); });
+    if (candidates[i] == Compression::UNCOMPRESSED) { continue; }
+
+    thrust::fill(rmm::exec_policy_nosync(stream),
+                 sample_res.begin(),
+                 sample_res.end(),
+                 compression_result{0, compression_status::FAILURE});
+    compress_pages(candidates[i], sample_in, sample_out, sample_res, stream);
+    auto const h_sample_res = cudf::detail::make_std_vector_sync(sample_res, stream);
+    for (size_t s = 0; s < num_samples; ++s) {
+      if (h_sample_res[s].status == compression_status::SUCCESS) {
+        sample_sizes[i][s] = std::min(sample_sizes[i][s], h_sample_res[s].bytes_written);
+      }
+    }
+  }
+
+  for (size_t s = 0; s < num_samples; ++s) {
+    auto min_size = std::numeric_limits<size_t>::max();
+    for (auto const& sizes : sample_sizes) {
+      min_size = std::min(min_size, sizes[s]);
+    }
+    auto const max_size = static_cast<double>(min_size) * (1 + adaptive_compression_tolerance);
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      if (sample_sizes[i][s] <= max_size) {
+        chunk_codecs[sample_chunks[s]] = candidates[i];
+        break;
+      }
+    }
+  }
+  return chunk_codecs;
+}
+
 /**
  * @brief Encode a batch of pages.
  *
@@ -1410,7 +1858,6 @@ void init_encoder_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
  * @param chunk_stats optional chunk-level statistics (nullptr if none)
  * @param column_stats optional page-level statistics for column index (nullptr if none)
  * @param comp_stats optional compression statistics (nullopt if none)
- * @param compression compression format
  * @param column_index_truncate_length maximum length of min or max values in column index, in bytes
  * @param write_v2_headers True if V2 page headers should be written
  * @param stream CUDA stream used for device memory operations and kernel launches
@@ -1425,7 +1872,6 @@ void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
                   statistics_chunk const* chunk_stats,
                   statistics_chunk const* column_stats,
                   std::optional<writer_compression_statistics>& comp_stats,
-                  Compression compression,
                   int32_t column_index_truncate_length,
                   bool write_v2_headers,
                   rmm::cuda_stream_view stream)
@@ -1437,7 +1883,14 @@ void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
       ? device_span<statistics_chunk const>(page_stats + first_page_in_batch, pages_in_batch)
       : device_span<statistics_chunk const>();
 
-  uint32_t max_comp_pages = (compression != Compression::UNCOMPRESSED) ? pages_in_batch : 0;
+  auto h_chunks_in_batch = chunks.host_view().subspan(first_rowgroup, rowgroups_in_batch);
+  auto const is_batch_compressed =
+    std::any_of(h_chunks_in_batch.flat_view().begin(),
+                h_chunks_in_batch.flat_view().end(),
+                [](auto const& ck) {
+                  return ck.is_codec_adaptive or ck.codec != Compression::UNCOMPRESSED;
+                });
+  uint32_t max_comp_pages = is_batch_compressed ? pages_in_batch : 0;
 
   rmm::device_uvector<device_span<uint8_t const>> comp_in(max_comp_pages, stream);
   rmm::device_uvector<device_span<uint8_t>> comp_out(max_comp_pages, stream);
@@ -1448,33 +1901,19 @@ void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
                compression_result{0, compression_status::FAILURE});
 
   EncodePages(batch_pages, write_v2_headers, comp_in, comp_out, comp_res, stream);
-  switch (compression) {
-    case Compression::SNAPPY:
-      if (nvcomp::is_compression_disabled(nvcomp::compression_type::SNAPPY)) {
-        gpu_snap(comp_in, comp_out, comp_res, stream);
-      } else {
-        nvcomp::batched_compress(
-          nvcomp::compression_type::SNAPPY, comp_in, comp_out, comp_res, stream);
-      }
-      break;
-    case Compression::ZSTD: {
-      if (auto const reason = nvcomp::is_compression_disabled(nvcomp::compression_type::ZSTD);
-          reason) {
-        CUDF_FAIL("Compression error: " + reason.value());
-      }
-      nvcomp::batched_compress(nvcomp::compression_type::ZSTD, comp_in, comp_out, comp_res, stream);
-      break;
-    }
-    case Compression::LZ4_RAW: {
-      if (auto const reason = nvcomp::is_compression_disabled(nvcomp::compression_type::LZ4);
-          reason) {
-        CUDF_FAIL("Compression error: " + reason.value());
-      }
-      nvcomp::batched_compress(nvcomp::compression_type::LZ4, comp_in, comp_out, comp_res, stream);
-      break;
+
+  // Compress each page with the codec of its chunk, once the adaptive codecs are selected
+  auto const chunk_codecs = select_chunk_codecs(
+    h_chunks_in_batch.flat_view(), first_page_in_batch, comp_in, comp_out, stream);
+  if (is_batch_compressed) {
+    std::vector<Compression> page_codecs(pages_in_batch, Compression::UNCOMPRESSED);
+    for (size_t c = 0; c < chunk_codecs.size(); ++c) {
+      auto const& ck = h_chunks_in_batch.flat_view()[c];
+      std::fill_n(page_codecs.begin() + (ck.first_page - first_page_in_batch),
+                  ck.num_pages,
+                  chunk_codecs[c]);
     }
-    case Compression::UNCOMPRESSED: break;
-    default: CUDF_FAIL("invalid compression type");
+    compress_pages(page_codecs, comp_in, comp_out, comp_res, stream);
   }
 
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
@@ -1495,7 +1934,6 @@ void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
                         stream);
   }
 
-  auto h_chunks_in_batch = chunks.host_view().subspan(first_rowgroup, rowgroups_in_batch);
   CUDF_CUDA_TRY(cudaMemcpyAsync(h_chunks_in_batch.data(),
                                 d_chunks_in_batch.data(),
                                 d_chunks_in_batch.flat_view().size_bytes(),
@@ -1506,6 +1944,11 @@ void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
     comp_stats.value() += collect_compression_statistics(comp_in, comp_res, stream);
   }
   stream.synchronize();
+
+  // The codecs of the adaptive chunks are only selected on the host
+  for (size_t c = 0; c < chunk_codecs.size(); ++c) {
+    h_chunks_in_batch.flat_view()[c].codec = chunk_codecs[c];
+  }
 }
 
 /**
@@ -1604,7 +2047,7 @@ void fill_table_meta(std::unique_ptr<table_input_metadata> const& table_meta)
  * @param max_page_size_rows Maximum page size, in rows
  * @param column_index_truncate_length maximum length of min or max values in column index, in bytes
  * @param stats_granularity Level of statistics requested in output file
- * @param compression Compression format
+ * @param compression Compression format of the columns without a column-level codec
  * @param collect_statistics Flag to indicate if statistics should be collected
  * @param dict_policy Policy for dictionary use
  * @param max_dictionary_size Maximum dictionary size, in bytes
@@ -1659,6 +2102,31 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
   table_view single_streams_table(cudf_cols);
   size_type num_columns = single_streams_table.num_columns();
 
+  // Compression codec of each column; nullopt if the codec is selected adaptively for each chunk
+  std::vector<std::optional<Compression>> column_codecs;
+  std::transform(parquet_columns.begin(),
+                 parquet_columns.end(),
+                 std::back_inserter(column_codecs),
+                 [compression](auto const& pcol) -> std::optional<Compression> {
+                   auto const col_compression = pcol.compression();
+                   if (not col_compression.has_value()) { return compression; }
+                   if (col_compression.value() == compression_type::AUTO) { return std::nullopt; }
+                   return to_parquet_compression(col_compression.value());
+                 });
+  // All codecs that the column chunks may use, to size the pages and the compression buffers
+  std::vector<Compression> codecs;
+  for (auto const& codec : column_codecs) {
+    if (codec.has_value()) {
+      codecs.push_back(codec.value());
+    } else {
+      auto const candidates = adaptive_compression_candidates();
+      codecs.insert(codecs.end(), candidates.begin(), candidates.end());
+    }
+  }
+  std::sort(codecs.begin(), codecs.end());
+  codecs.erase(std::unique(codecs.begin(), codecs.end()), codecs.end());
+  max_page_size_bytes = max_page_bytes(codecs, max_page_size_bytes);
+
   std::vector<SchemaElement> this_table_schema(schema_tree.begin(), schema_tree.end());
 
   // Initialize column description
@@ -1852,6 +2320,8 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
         ck.num_rows          = (uint32_t)row_group.num_rows;
         ck.first_fragment    = c * num_fragments + f;
         ck.encodings         = 0;
+        ck.codec             = column_codecs[c].value_or(Compression::UNCOMPRESSED);
+        ck.is_codec_adaptive = not column_codecs[c].has_value();
         auto chunk_fragments = row_group_fragments[c].subspan(f, fragments_in_chunk);
         // In fragment struct, add a pointer to the chunk it belongs to
         // In each fragment in chunk_fragments, update the chunk pointer here.
@@ -1882,7 +2352,10 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
 
   row_group_fragments.host_to_device_async(stream);
   [[maybe_unused]] auto dict_info_owner = build_chunk_dictionaries(
-    chunks, col_desc, row_group_fragments, compression, dict_policy, max_dictionary_size, stream);
+    chunks, col_desc, row_group_fragments, codecs, dict_policy, max_dictionary_size, stream);
+  select_chunk_encodings(chunks, col_desc, row_group_fragments, stream);
+  auto bloom_filter_bfr =
+    build_chunk_bloom_filters(chunks, parquet_columns, row_group_fragments, stream);
 
   // The code preceding this used a uniform fragment size for all columns. Now recompute
   // fragments with a (potentially) varying number of fragments per column.
@@ -1950,7 +2423,7 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                                                                                max_page_size_bytes,
                                                                                max_page_size_rows,
                                                                                write_v2_headers,
-                                                                               compression,
+                                                                               codecs,
                                                                                stream);
 
   // Find which partition a rg belongs to
@@ -2027,7 +2500,11 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
   }
 
   // Clear compressed buffer size if compression has been turned off
-  if (compression == Compression::UNCOMPRESSED) { max_comp_bfr_size = 0; }
+  if (std::all_of(codecs.begin(), codecs.end(), [](auto codec) {
+        return codec == Compression::UNCOMPRESSED;
+      })) {
+    max_comp_bfr_size = 0;
+  }
 
   // Initialize data pointers in batch
   uint32_t const num_stats_bfr =
@@ -2095,7 +2572,7 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                        num_columns,
                        num_pages,
                        num_stats_bfr,
-                       compression,
+                       codecs,
                        max_page_size_bytes,
                        max_page_size_rows,
                        write_v2_headers,
@@ -2129,7 +2606,6 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                                                               : nullptr,
       (stats_granularity == statistics_freq::STATISTICS_COLUMN) ? page_stats.data() : nullptr,
       comp_stats,
-      compression,
       column_index_truncate_length,
       write_v2_headers,
       stream);
@@ -2162,7 +2638,7 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
         auto const dev_bfr      = ck.is_compressed ? ck.compressed_bfr : ck.uncompressed_bfr;
         auto& column_chunk_meta = row_group.columns[i].meta_data;
 
-        if (ck.is_compressed) { column_chunk_meta.codec = compression; }
+        if (ck.is_compressed) { column_chunk_meta.codec = ck.codec; }
         if (!out_sink[p]->is_device_write_preferred(ck.compressed_size)) {
           all_device_write = false;
         }
@@ -2257,9 +2733,103 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                     std::move(uncomp_bfr),
                     std::move(comp_bfr),
                     std::move(col_idx_bfr),
+                    std::move(bloom_filter_bfr),
                     std::move(bounce_buffer)};
 }
 
+/**
+ * @brief Sorts the rows of each partition by the sorting columns.
+ *
+ * @param input The table to write
+ * @param partitions Partitions of the input, one per file
+ * @param sorting_columns Columns by which the rows are sorted
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The rows of the partitions, sorted and one partition after another, and the
+ * partitions of these rows
+ */
+std::pair<std::unique_ptr<table>, std::vector<partition_info>> sort_partitions(
+  table_view const& input,
+  host_span<partition_info const> partitions,
+  host_span<sorting_column const> sorting_columns,
+  rmm::cuda_stream_view stream)
+{
+  std::vector<size_type> key_columns;
+  std::vector<order> column_order;
+  std::vector<null_order> null_precedence;
+  for (auto const& column : sorting_columns) {
+    CUDF_EXPECTS(column.column_idx >= 0 && column.column_idx < input.num_columns(),
+                 "Sorting column index is out of range",
+                 std::out_of_range);
+    key_columns.push_back(column.column_idx);
+    column_order.push_back(column.is_descending ? order::DESCENDING : order::ASCENDING);
+    // a descending order also reverses the order of the nulls
+    null_precedence.push_back(column.is_nulls_first != column.is_descending ? null_order::BEFORE
+                                                                             : null_order::AFTER);
+  }
+
+  std::vector<partition_info> sorted_partitions;
+  std::vector<size_type> h_starts;
+  std::vector<size_type> h_offsets{0};
+  for (auto const& part : partitions) {
+    sorted_partitions.emplace_back(h_offsets.back(), part.num_rows);
+    h_starts.push_back(part.start_row);
+    h_offsets.push_back(h_offsets.back() + part.num_rows);
+  }
+  auto const num_rows  = h_offsets.back();
+  auto const temp_mr   = rmm::mr::get_current_device_resource();
+  auto const d_starts  = cudf::detail::make_device_uvector_async(h_starts, stream, temp_mr);
+  auto const d_offsets = cudf::detail::make_device_uvector_async(h_offsets, stream, temp_mr);
+
+  // the input row of each row of the partitions laid out one after another
+  rmm::device_uvector<size_type> rows(num_rows, stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_rows),
+    rows.begin(),
+    cuda::proclaim_return_type<size_type>(
+      [starts      = d_starts.data(),
+       offsets     = d_offsets.data(),
+       num_offsets = d_offsets.size()] __device__(size_type row) {
+        auto const part =
+          thrust::upper_bound(thrust::seq, offsets, offsets + num_offsets, row) - offsets - 1;
+        return starts[part] + row - offsets[part];
+      }));
+
+  // sort the keys within each partition, keeping the input order of equal keys
+  auto const keys       = cudf::detail::gather(input.select(key_columns),
+                                               rows,
+                                               out_of_bounds_policy::DONT_CHECK,
+                                               cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                               stream,
+                                               temp_mr);
+  auto const sort_order = cudf::detail::stable_segmented_sorted_order(
+    keys->view(),
+    column_view(data_type{type_to_id<size_type>()},
+                static_cast<size_type>(d_offsets.size()),
+                d_offsets.data(),
+                nullptr,
+                0),
+    column_order,
+    null_precedence,
+    stream,
+    temp_mr);
+  rmm::device_uvector<size_type> sorted_rows(num_rows, stream);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 sort_order->view().begin<size_type>(),
+                 sort_order->view().end<size_type>(),
+                 rows.begin(),
+                 sorted_rows.begin());
+
+  return {cudf::detail::gather(input,
+                               sorted_rows,
+                               out_of_bounds_policy::DONT_CHECK,
+                               cudf::detail::negative_index_policy::NOT_ALLOWED,
+                               stream,
+                               temp_mr),
+          std::move(sorted_partitions)};
+}
+
 }  // namespace
 
 writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
@@ -2279,6 +2849,7 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     _int96_timestamps(options.is_enabled_int96_timestamps()),
     _utc_timestamps(options.is_enabled_utc_timestamps()),
     _write_v2_headers(options.is_enabled_write_v2_headers()),
+    _sorting_columns(options.get_sorting_columns()),
     _column_index_truncate_length(options.get_column_index_truncate_length()),
     _kv_meta(options.get_key_value_metadata()),
     _single_write_mode(mode),
@@ -2308,6 +2879,7 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     _int96_timestamps(options.is_enabled_int96_timestamps()),
     _utc_timestamps(options.is_enabled_utc_timestamps()),
     _write_v2_headers(options.is_enabled_write_v2_headers()),
+    _sorting_columns(options.get_sorting_columns()),
     _column_index_truncate_length(options.get_column_index_truncate_length()),
     _kv_meta(options.get_key_value_metadata()),
     _single_write_mode(mode),
@@ -2350,6 +2922,16 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
   if (not _table_meta) { _table_meta = std::make_unique<table_input_metadata>(input); }
   fill_table_meta(_table_meta);
 
+  // cluster the rows of each file by the sorting columns before they are encoded
+  std::unique_ptr<table> sorted_input;
+  std::vector<partition_info> sorted_partitions;
+  if (not _sorting_columns.empty()) {
+    std::tie(sorted_input, sorted_partitions) =
+      sort_partitions(input, partitions, _sorting_columns, _stream);
+  }
+  auto const write_input       = sorted_input ? sorted_input->view() : input;
+  auto const& write_partitions = sorted_input ? sorted_partitions : partitions;
+
   // All kinds of memory allocation and data compressions/encoding are performed here.
   // If any error occurs, such as out-of-memory exception, the internal state of the current
   // writer is still intact.
@@ -2364,11 +2946,12 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
                          uncomp_bfr,   // unused, but contains data for later write to sink
                          comp_bfr,     // unused, but contains data for later write to sink
                          col_idx_bfr,  // unused, but contains data for later write to sink
+                         bloom_filter_bfr,
                          bounce_buffer] = [&] {
     try {
       return convert_table_to_parquet_data(*_table_meta,
-                                           input,
-                                           partitions,
+                                           write_input,
+                                           write_partitions,
                                            _kv_meta,
                                            _agg_meta,
                                            _max_page_fragment_size,
@@ -2404,6 +2987,7 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
                              first_rg_in_part,
                              batch_list,
                              rg_to_part,
+                             bloom_filter_bfr,
                              bounce_buffer);
 
   update_compression_statistics(comp_stats);
@@ -2419,10 +3003,12 @@ void writer::impl::write_parquet_data_to_sink(
   host_span<int const> first_rg_in_part,
   host_span<size_type const> batch_list,
   host_span<int const> rg_to_part,
+  device_span<uint32_t const> bloom_filter_bfr,
   host_span<uint8_t> bounce_buffer)
 {
-  _agg_meta              = std::move(updated_agg_meta);
-  auto const num_columns = chunks.size().second;
+  _agg_meta                  = std::move(updated_agg_meta);
+  auto const num_columns     = chunks.size().second;
+  auto const h_bloom_filters = cudf::detail::make_std_vector_sync(bloom_filter_bfr, _stream);
 
   for (auto b = 0, r = 0; b < static_cast<size_type>(batch_list.size()); b++) {
     auto const rnext = r + batch_list[b];
@@ -2460,6 +3046,25 @@ void writer::impl::write_parquet_data_to_sink(
         column_chunk_meta.dictionary_page_offset =
           (ck.use_dictionary) ? _current_chunk_offset[p] : 0;
         _current_chunk_offset[p] += ck.compressed_size;
+
+        // The Bloom filter of the chunk is written right after the chunk data
+        if (ck.bloom_filter_bitset != nullptr) {
+          BloomFilterHeader header;
+          header.num_bytes        = static_cast<int32_t>(ck.bloom_filter_size);
+          header.algorithm.type   = BloomFilterAlgorithm::SPLIT_BLOCK;
+          header.hash.type        = BloomFilterHash::XXHASH;
+          header.compression.type = BloomFilterCompression::UNCOMPRESSED;
+          std::vector<uint8_t> buffer;
+          CompactProtocolWriter(&buffer).write(header);
+          auto const bitset = reinterpret_cast<uint8_t const*>(
+            h_bloom_filters.data() + (ck.bloom_filter_bitset - bloom_filter_bfr.data()));
+          buffer.insert(buffer.end(), bitset, bitset + ck.bloom_filter_size);
+
+          column_chunk_meta.bloom_filter_offset = _current_chunk_offset[p];
+          column_chunk_meta.bloom_filter_length = static_cast<int32_t>(buffer.size());
+          _out_sink[p]->host_write(buffer.data(), buffer.size());
+          _current_chunk_offset[p] += buffer.size();
+        }
       }
     }
     for (auto const& task : write_tasks) {
@@ -131,6 +131,7 @@ class writer::impl {
    * @param first_rg_in_part The first rowgroup in each partition
    * @param batch_list The batches of rowgroups to encode
    * @param rg_to_part A map from rowgroup to partition
+   * @param bloom_filter_bfr Bloom filter bitsets of the column chunks
    * @param[out] bounce_buffer Temporary host output buffer
    */
   void write_parquet_data_to_sink(std::unique_ptr<aggregate_writer_metadata>& updated_agg_meta,
@@ -140,6 +141,7 @@ class writer::impl {
                                   host_span<int const> first_rg_in_part,
                                   host_span<size_type const> batch_list,
                                   host_span<int const> rg_to_part,
+                                  device_span<uint32_t const> bloom_filter_bfr,
                                   host_span<uint8_t> bounce_buffer);
 
   // Cuda stream to be used
@@ -158,6 +160,7 @@ class writer::impl {
   bool const _int96_timestamps;
   bool const _utc_timestamps;
   bool const _write_v2_headers;
+  std::vector<sorting_column> const _sorting_columns;
   int32_t const _column_index_truncate_length;
   std::vector<std::map<std::string, std::string>> const _kv_meta;  // Optional user metadata.
   cudf::io::detail::single_write_mode const
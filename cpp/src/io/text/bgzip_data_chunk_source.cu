@@ -34,8 +34,12 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <vector>
 
 namespace cudf::io::text {
 namespace {
@@ -99,6 +103,8 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
     // this is usually equal to decompressed_size()
     // unless we are in the last chunk, where it's limited by _local_end
     std::size_t available_decompressed_size{};
+    // offset of the first block in the decompressed data, relative to the first block read
+    std::size_t decompressed_begin{};
     std::size_t read_pos{};
     bool is_decompressed{};
 
@@ -224,6 +230,7 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
       CUDF_CUDA_TRY(cudaEventSynchronize(_curr_blocks.event));
     }
     _curr_blocks.reset();
+    _curr_blocks.decompressed_begin = _next_decompressed_pos;
     // read chunks until we have enough decompressed data
     while (_curr_blocks.decompressed_size() < requested_size) {
       // calling peek on an already EOF stream causes it to fail, we need to avoid that
@@ -235,6 +242,7 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
       _curr_blocks.read_block(header, *_data_stream);
       auto footer = detail::bgzip::read_footer(*_data_stream);
       _curr_blocks.add_block_offsets(header, footer);
+      _next_decompressed_pos += footer.decompressed_size;
       // for the last GZIP block, we restrict ourselves to the bytes up to _local_end
       // but only for the reader, not for decompression!
       if (_compressed_pos == _compressed_end) {
@@ -248,13 +256,38 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
     }
   }
 
+  /**
+   * @brief Moves the reader to the given decompressed offset, seeking directly to the block
+   *        containing it with the help of the block index.
+   */
+  void seek_to_decompressed_offset(std::size_t offset)
+  {
+    // the last block starting at or before the offset
+    auto const next_block = std::upper_bound(
+      _index->begin(), _index->end(), offset, [](std::size_t pos, auto const& entry) {
+        return pos < entry.decompressed_offset;
+      });
+    auto const block =
+      next_block == _index->begin() ? detail::bgzip::index_entry{0, 0} : *std::prev(next_block);
+    _curr_blocks.consume_bytes(_curr_blocks.remaining_size());
+    _data_stream->clear();
+    _data_stream->seekg(block.compressed_offset, std::ios_base::beg);
+    _compressed_pos        = block.compressed_offset;
+    _next_decompressed_pos = block.decompressed_offset;
+    read_next_compressed_chunk(chunk_load_size);
+    _curr_blocks.consume_bytes(
+      std::min(offset - block.decompressed_offset, _curr_blocks.remaining_size()));
+  }
+
   constexpr static std::size_t chunk_load_size = 1 << 24;  // load 16 MB of data by default
 
  public:
   bgzip_data_chunk_reader(std::unique_ptr<std::istream> input_stream,
                           uint64_t virtual_begin,
-                          uint64_t virtual_end)
+                          uint64_t virtual_end,
+                          std::shared_ptr<std::vector<detail::bgzip::index_entry> const> index)
     : _data_stream(std::move(input_stream)),
+      _index(std::move(index)),
       _prev_blocks{cudf::get_default_stream()},  // here we can use the default stream because
       _curr_blocks{cudf::get_default_stream()},  // we only initialize empty device_uvectors
       _local_end{virtual_end & 0xFFFFu},
@@ -279,6 +312,11 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
 
   void skip_bytes(std::size_t read_size) override
   {
+    if (_index != nullptr && read_size > _curr_blocks.remaining_size()) {
+      seek_to_decompressed_offset(_curr_blocks.decompressed_begin + _curr_blocks.read_pos +
+                                  read_size);
+      return;
+    }
     while (read_size > _curr_blocks.remaining_size()) {
       read_size -= _curr_blocks.remaining_size();
       _curr_blocks.consume_bytes(_curr_blocks.remaining_size());
@@ -311,6 +349,9 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
       _curr_blocks.consume_bytes(read_size);
       return std::make_unique<device_uvector_data_chunk>(std::move(data));
     }
+    // start decompressing the remaining blocks before reading the next ones, so the host-side
+    // reading and parsing of the blocks overlaps with the decompression on the device
+    if (_curr_blocks.remaining_size() > 0) { _curr_blocks.decompress(stream); }
     read_next_compressed_chunk(read_size /* - _curr_blocks.remaining_size()*/);
     _prev_blocks.decompress(stream);
     _curr_blocks.decompress(stream);
@@ -337,11 +378,15 @@ class bgzip_data_chunk_reader : public data_chunk_reader {
 
  private:
   std::unique_ptr<std::istream> _data_stream;
+  // optional block index, only available when reading the full file
+  std::shared_ptr<std::vector<detail::bgzip::index_entry> const> _index;
   decompression_blocks _prev_blocks;
   decompression_blocks _curr_blocks;
   std::size_t _local_end;
   std::size_t _compressed_pos;
   std::size_t _compressed_end;
+  // offset of the next block to be read in the decompressed data
+  std::size_t _next_decompressed_pos{};
 };
 
 class bgzip_data_chunk_source : public data_chunk_source {
@@ -351,16 +396,30 @@ class bgzip_data_chunk_source : public data_chunk_source {
   {
   }
 
+  bgzip_data_chunk_source(std::string_view filename, std::string_view index_filename)
+    : _filename{filename}, _virtual_begin{0}, _virtual_end{std::numeric_limits<uint64_t>::max()}
+  {
+    std::ifstream index_stream{std::string{index_filename}, std::ifstream::binary};
+    // set failbit to throw on IO failures
+    index_stream.exceptions(std::istream::failbit);
+    _index = std::make_shared<std::vector<detail::bgzip::index_entry> const>(
+      detail::bgzip::read_index(index_stream));
+  }
+
   [[nodiscard]] std::unique_ptr<data_chunk_reader> create_reader() const override
   {
     return std::make_unique<bgzip_data_chunk_reader>(
-      std::make_unique<std::ifstream>(_filename, std::ifstream::in), _virtual_begin, _virtual_end);
+      std::make_unique<std::ifstream>(_filename, std::ifstream::in),
+      _virtual_begin,
+      _virtual_end,
+      _index);
   }
 
  private:
   std::string _filename;
   uint64_t _virtual_begin;
   uint64_t _virtual_end;
+  std::shared_ptr<std::vector<detail::bgzip::index_entry> const> _index;
 };
 
 }  // namespace
@@ -378,4 +437,22 @@ std::unique_ptr<data_chunk_source> make_source_from_bgzip_file(std::string_view
     filename, 0, std::numeric_limits<uint64_t>::max());
 }
 
+std::unique_ptr<data_chunk_source> make_source_from_bgzip_file(std::string_view filename,
+                                                               std::string_view index_filename)
+{
+  return std::make_unique<bgzip_data_chunk_source>(filename, index_filename);
+}
+
+void build_bgzip_index(std::string_view filename, std::string_view index_filename)
+{
+  CUDF_FUNC_RANGE();
+  std::ifstream data_stream{std::string{filename}, std::ifstream::binary};
+  // set failbit to throw on IO failures
+  data_stream.exceptions(std::istream::failbit);
+  auto const index = detail::bgzip::build_index(data_stream);
+  std::ofstream index_stream{std::string{index_filename}, std::ofstream::binary};
+  index_stream.exceptions(std::ostream::failbit);
+  detail::bgzip::write_index(index_stream, index);
+}
+
 }  // namespace cudf::io::text
@@ -24,6 +24,7 @@
 #include <array>
 #include <fstream>
 #include <limits>
+#include <vector>
 
 namespace cudf::io::text::detail::bgzip {
 namespace {
@@ -96,6 +97,49 @@ footer read_footer(std::istream& input_stream)
   return {read_int<uint32_t>(&buffer[0]), read_int<uint32_t>(&buffer[4])};
 }
 
+std::vector<index_entry> read_index(std::istream& input_stream)
+{
+  std::array<char, 2 * sizeof(uint64_t)> buffer{};
+  input_stream.read(buffer.data(), sizeof(uint64_t));
+  auto const num_entries = read_int<uint64_t>(&buffer[0]);
+  std::vector<index_entry> index;
+  index.reserve(num_entries);
+  for (uint64_t i = 0; i < num_entries; i++) {
+    input_stream.read(buffer.data(), buffer.size());
+    index_entry const entry{read_int<uint64_t>(&buffer[0]), read_int<uint64_t>(&buffer[8])};
+    CUDF_EXPECTS(index.empty() || (entry.compressed_offset > index.back().compressed_offset &&
+                                   entry.decompressed_offset >= index.back().decompressed_offset),
+                 "unsorted BGZIP index");
+    index.push_back(entry);
+  }
+  return index;
+}
+
+void write_index(std::ostream& output_stream, host_span<index_entry const> index)
+{
+  write_int<uint64_t>(output_stream, index.size());
+  for (auto const& entry : index) {
+    write_int<uint64_t>(output_stream, entry.compressed_offset);
+    write_int<uint64_t>(output_stream, entry.decompressed_offset);
+  }
+}
+
+std::vector<index_entry> build_index(std::istream& input_stream)
+{
+  std::vector<index_entry> index;
+  index_entry position{0, 0};
+  // calling peek on an already EOF stream causes it to fail, so we check eof first
+  while (!input_stream.eof() && input_stream.peek() != std::istream::traits_type::eof()) {
+    if (position.compressed_offset > 0) { index.push_back(position); }
+    auto const header = read_header(input_stream);
+    input_stream.seekg(header.data_size(), std::ios_base::cur);
+    auto const footer = read_footer(input_stream);
+    position.compressed_offset += header.block_size;
+    position.decompressed_offset += footer.decompressed_size;
+  }
+  return index;
+}
+
 void write_footer(std::ostream& output_stream, host_span<char const> data)
 {
   // compute crc32 with zlib, this allows checking the generated files with external tools
@@ -23,10 +23,12 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/text/byte_range_info.hpp>
 #include <cudf/io/text/data_chunk_source.hpp>
 #include <cudf/io/text/detail/multistate.hpp>
 #include <cudf/io/text/detail/tile_state.hpp>
+#include <cudf/io/text/detail/trie.hpp>
 #include <cudf/io/text/multibyte_split.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
@@ -42,6 +44,8 @@
 #include <cub/block/block_scan.cuh>
 #include <cuda/functional>
 #include <thrust/copy.h>
+#include <thrust/equal.h>
+#include <thrust/execution_policy.h>
 #include <thrust/find.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
@@ -51,6 +55,8 @@
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace {
 
@@ -62,32 +68,68 @@ int32_t constexpr ITEMS_PER_TILE   = ITEMS_PER_THREAD * THREADS_PER_TILE;
 int32_t constexpr TILES_PER_CHUNK  = 4096;
 int32_t constexpr ITEMS_PER_CHUNK  = ITEMS_PER_TILE * TILES_PER_CHUNK;
 
-constexpr multistate transition_init(char c, cudf::device_span<char const> delim)
-{
-  auto result = multistate();
+/**
+ * @brief Matches a single delimiter, whose states are the lengths of its partial matches.
+ */
+struct delimiter_pattern {
+  cudf::device_span<char const> delim;
+
+  [[nodiscard]] constexpr multistate transition_init(char c) const
+  {
+    auto result = multistate();
+
+    result.enqueue(0, 0);
 
-  result.enqueue(0, 0);
+    for (std::size_t i = 0; i < delim.size(); i++) {
+      if (delim[i] == c) { result.enqueue(i, i + 1); }
+    }
 
-  for (std::size_t i = 0; i < delim.size(); i++) {
-    if (delim[i] == c) { result.enqueue(i, i + 1); }
+    return result;
   }
 
-  return result;
-}
+  [[nodiscard]] constexpr multistate transition(char c, multistate const& state) const
+  {
+    auto result = multistate();
 
-constexpr multistate transition(char c, multistate state, cudf::device_span<char const> delim)
-{
-  auto result = multistate();
+    result.enqueue(0, 0);
 
-  result.enqueue(0, 0);
+    for (uint8_t i = 0; i < state.size(); i++) {
+      auto const tail = state.get_tail(i);
+      if (tail < delim.size() && delim[tail] == c) { result.enqueue(state.get_head(i), tail + 1); }
+    }
 
-  for (uint8_t i = 0; i < state.size(); i++) {
-    auto const tail = state.get_tail(i);
-    if (tail < delim.size() && delim[tail] == c) { result.enqueue(state.get_head(i), tail + 1); }
+    return result;
   }
 
-  return result;
-}
+  [[nodiscard]] constexpr bool is_match(multistate const& state) const
+  {
+    return state.max_tail() == delim.size();
+  }
+};
+
+/**
+ * @brief Matches any of several delimiters, whose states are the nodes of their trie.
+ */
+struct trie_pattern {
+  cudf::io::text::detail::trie_device_view trie;
+
+  [[nodiscard]] constexpr multistate transition_init(char c) { return trie.transition_init(c); }
+
+  [[nodiscard]] constexpr multistate transition(char c, multistate const& state)
+  {
+    return trie.transition(c, state);
+  }
+
+  // The partial matches of the delimiters end in different branches of the trie, so all of them
+  // need to be checked, not only the deepest state
+  [[nodiscard]] constexpr bool is_match(multistate const& state)
+  {
+    for (uint8_t i = 0; i < state.size(); i++) {
+      if (trie.is_match(state.get_tail(i))) { return true; }
+    }
+    return false;
+  }
+};
 
 struct PatternScan {
   using BlockScan         = cub::BlockScan<multistate, THREADS_PER_TILE>;
@@ -103,16 +145,17 @@ struct PatternScan {
 
   __device__ inline PatternScan(TempStorage& temp_storage) : _temp_storage(temp_storage.Alias()) {}
 
+  template <typename Pattern>
   __device__ inline void Scan(cudf::size_type tile_idx,
                               cudf::io::text::detail::scan_tile_state_view<multistate> tile_state,
-                              cudf::device_span<char const> delim,
+                              Pattern& pattern,
                               char (&thread_data)[ITEMS_PER_THREAD],
                               multistate& thread_multistate)
   {
-    thread_multistate = transition_init(thread_data[0], delim);
+    thread_multistate = pattern.transition_init(thread_data[0]);
 
     for (uint32_t i = 1; i < ITEMS_PER_THREAD; i++) {
-      thread_multistate = transition(thread_data[i], thread_multistate, delim);
+      thread_multistate = pattern.transition(thread_data[i], thread_multistate);
     }
 
     auto prefix_callback = BlockScanCallback(tile_state, tile_idx);
@@ -152,13 +195,14 @@ CUDF_KERNEL void multibyte_split_init_kernel(
   }
 }
 
+template <typename Pattern>
 CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
   cudf::size_type base_tile_idx,
   byte_offset base_input_offset,
   output_offset base_output_offset,
   cudf::io::text::detail::scan_tile_state_view<multistate> tile_multistates,
   cudf::io::text::detail::scan_tile_state_view<output_offset> tile_output_offsets,
-  cudf::device_span<char const> delim,
+  Pattern pattern,
   cudf::device_span<char const> chunk_input_chars,
   cudf::split_device_span<byte_offset> row_offsets)
 {
@@ -195,7 +239,7 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
 
   __syncthreads();  // required before temp_memory re-use
   PatternScan(temp_storage.pattern_scan)
-    .Scan(tile_idx, tile_multistates, delim, thread_chars, thread_multistate);
+    .Scan(tile_idx, tile_multistates, pattern, thread_chars, thread_multistate);
 
   // STEP 3: Flag matches
 
@@ -203,9 +247,8 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
   uint32_t thread_match_mask[(ITEMS_PER_THREAD + 31) / 32]{};
 
   for (int32_t i = 0; i < ITEMS_PER_THREAD; i++) {
-    thread_multistate       = transition(thread_chars[i], thread_multistate, delim);
-    auto const thread_state = thread_multistate.max_tail();
-    auto const is_match     = i < thread_input_size and thread_state == delim.size();
+    thread_multistate   = pattern.transition(thread_chars[i], thread_multistate);
+    auto const is_match = i < thread_input_size and pattern.is_match(thread_multistate);
     thread_match_mask[i / 32] |= uint32_t{is_match} << (i % 32);
     thread_offset += output_offset{is_match};
   }
@@ -302,7 +345,7 @@ namespace text {
 namespace detail {
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
-                                              std::string const& delimiter,
+                                              std::vector<std::string> const& delimiters,
                                               byte_range_info byte_range,
                                               bool strip_delimiters,
                                               rmm::cuda_stream_view stream,
@@ -310,28 +353,52 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 {
   CUDF_FUNC_RANGE();
 
+  CUDF_EXPECTS(not delimiters.empty(), "at least one delimiter is required.");
+
   if (byte_range.empty()) { return make_empty_column(type_id::STRING); }
 
+  auto const& delimiter = delimiters.front();
+  auto const max_delimiter_size =
+    std::max_element(delimiters.begin(), delimiters.end(), [](auto const& lhs, auto const& rhs) {
+      return lhs.size() < rhs.size();
+    })->size();
+
   auto device_delim = cudf::string_scalar(delimiter, true, stream, mr);
 
-  auto sorted_delim = delimiter;
-  std::sort(sorted_delim.begin(), sorted_delim.end());
-  auto [_last_char, _last_char_count, max_duplicate_tokens] = std::accumulate(
-    sorted_delim.begin(), sorted_delim.end(), std::make_tuple('\0', 0, 0), [](auto acc, char c) {
-      if (std::get<0>(acc) != c) {
-        std::get<0>(acc) = c;
-        std::get<1>(acc) = 0;
-      }
-      std::get<1>(acc)++;
-      std::get<2>(acc) = std::max(std::get<1>(acc), std::get<2>(acc));
-      return acc;
-    });
+  // Several delimiters are matched in the same pass by scanning the states of their trie
+  std::optional<trie> delimiter_trie;
+  if (delimiters.size() > 1) {
+    CUDF_EXPECTS(
+      std::none_of(delimiters.begin(), delimiters.end(), [](auto const& d) { return d.empty(); }),
+      "delimiters must not be empty.");
+    delimiter_trie.emplace(
+      trie::create(delimiters, stream, rmm::mr::get_current_device_resource()));
 
-  CUDF_EXPECTS(max_duplicate_tokens < multistate::max_segment_count,
-               "delimiter contains too many duplicate tokens to produce a deterministic result.");
+    CUDF_EXPECTS(delimiter_trie->max_duplicate_tokens() < multistate::max_segment_count,
+                 "delimiters contain too many duplicate tokens to produce a deterministic result.");
 
-  CUDF_EXPECTS(delimiter.size() < multistate::max_segment_value,
-               "delimiter contains too many total tokens to produce a deterministic result.");
+    CUDF_EXPECTS(delimiter_trie->size() - 1 <= multistate::max_segment_value,
+                 "delimiters contain too many total tokens to produce a deterministic result.");
+  } else {
+    auto sorted_delim = delimiter;
+    std::sort(sorted_delim.begin(), sorted_delim.end());
+    auto [_last_char, _last_char_count, max_duplicate_tokens] = std::accumulate(
+      sorted_delim.begin(), sorted_delim.end(), std::make_tuple('\0', 0, 0), [](auto acc, char c) {
+        if (std::get<0>(acc) != c) {
+          std::get<0>(acc) = c;
+          std::get<1>(acc) = 0;
+        }
+        std::get<1>(acc)++;
+        std::get<2>(acc) = std::max(std::get<1>(acc), std::get<2>(acc));
+        return acc;
+      });
+
+    CUDF_EXPECTS(max_duplicate_tokens < multistate::max_segment_count,
+                 "delimiter contains too many duplicate tokens to produce a deterministic result.");
+
+    CUDF_EXPECTS(delimiter.size() < multistate::max_segment_value,
+                 "delimiter contains too many total tokens to produce a deterministic result.");
+  }
 
   auto const concurrency = 2;
 
@@ -370,7 +437,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
     stream);
 
   auto reader               = source.create_reader();
-  auto chunk_offset         = std::max<byte_offset>(0, byte_range.offset() - delimiter.size());
+  auto chunk_offset = std::max<byte_offset>(0, byte_range.offset() - max_delimiter_size);
   auto const byte_range_end = byte_range.offset() + byte_range.size();
   reader->skip_bytes(chunk_offset);
   // amortize output chunk allocations over 8 worst-case outputs. This limits the overallocation
@@ -417,7 +484,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 
     CUDF_CUDA_TRY(cudaStreamWaitEvent(scan_stream.value(), last_launch_event));
 
-    if (delimiter.size() == 1) {
+    if (not delimiter_trie.has_value() and delimiter.size() == 1) {
       // the single-byte case allows for a much more efficient kernel, so we special-case it
       byte_split_kernel<<<tiles_in_launch,
                           THREADS_PER_TILE,
@@ -430,6 +497,19 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
         delimiter[0],
         *chunk,
         row_offsets);
+    } else if (delimiter_trie.has_value()) {
+      multibyte_split_kernel<<<tiles_in_launch,
+                               THREADS_PER_TILE,
+                               0,
+                               scan_stream.value()>>>(  //
+        base_tile_idx,
+        chunk_offset,
+        row_offset_storage.size(),
+        tile_multistates,
+        tile_offsets,
+        trie_pattern{delimiter_trie->view()},
+        *chunk,
+        row_offsets);
     } else {
       multibyte_split_kernel<<<tiles_in_launch,
                                THREADS_PER_TILE,
@@ -440,7 +520,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
         row_offset_storage.size(),
         tile_multistates,
         tile_offsets,
-        {device_delim.data(), static_cast<std::size_t>(device_delim.size())},
+        delimiter_pattern{{device_delim.data(), static_cast<std::size_t>(device_delim.size())}},
         *chunk,
         row_offsets);
     }
@@ -532,7 +612,46 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
                         return static_cast<int32_t>(global_offset - baseline);
                       }));
   auto string_count = offsets.size() - 1;
-  if (strip_delimiters) {
+  if (strip_delimiters and delimiter_trie.has_value()) {
+    // Rows end with any of the delimiters: the longest one that matches the end of a row is the
+    // one that was found
+    std::vector<char> delimiter_chars;
+    std::vector<size_type> delimiter_offsets{0};
+    for (auto const& d : delimiters) {
+      delimiter_chars.insert(delimiter_chars.end(), d.begin(), d.end());
+      delimiter_offsets.push_back(static_cast<size_type>(delimiter_chars.size()));
+    }
+    auto const d_delimiter_chars = cudf::detail::make_device_uvector_async(
+      delimiter_chars, stream, rmm::mr::get_current_device_resource());
+    auto const d_delimiter_offsets = cudf::detail::make_device_uvector_async(
+      delimiter_offsets, stream, rmm::mr::get_current_device_resource());
+    auto it = cudf::detail::make_counting_transform_iterator(
+      0,
+      cuda::proclaim_return_type<thrust::pair<char*, int32_t>>(
+        [ofs           = offsets.data(),
+         chars         = chars.data(),
+         delim_chars   = d_delimiter_chars.data(),
+         delim_offsets = d_delimiter_offsets.data(),
+         num_delims    = static_cast<size_type>(delimiters.size()),
+         last_row      = static_cast<size_type>(string_count) - 1,
+         insert_end] __device__(size_type row) {
+          auto const begin = ofs[row];
+          auto const end   = ofs[row + 1];
+          auto const len   = end - begin;
+          if (row == last_row && insert_end) { return thrust::make_pair(chars + begin, len); }
+          size_type delim_size = 0;
+          for (size_type d = 0; d < num_delims; d++) {
+            auto const size = delim_offsets[d + 1] - delim_offsets[d];
+            if (size > delim_size && size <= end &&
+                thrust::equal(
+                  thrust::seq, chars + end - size, chars + end, delim_chars + delim_offsets[d])) {
+              delim_size = size;
+            }
+          }
+          return thrust::make_pair(chars + begin, std::max<size_type>(0, len - delim_size));
+        }));
+    return cudf::strings::detail::make_strings_column(it, it + string_count, stream, mr);
+  } else if (strip_delimiters) {
     auto it = cudf::detail::make_counting_transform_iterator(
       0,
       cuda::proclaim_return_type<thrust::pair<char*, int32_t>>(
@@ -560,6 +679,17 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
   }
 }
 
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::string const& delimiter,
+                                              byte_range_info byte_range,
+                                              bool strip_delimiters,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  return multibyte_split(
+    source, std::vector<std::string>{delimiter}, byte_range, strip_delimiters, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
@@ -584,6 +714,19 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
   return result;
 }
 
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::vector<std::string> const& delimiters,
+                                              parse_options options,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto stream = cudf::get_default_stream();
+
+  auto result = detail::multibyte_split(
+    source, delimiters, options.byte_range, options.strip_delimiters, stream, mr);
+
+  return result;
+}
+
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
                                               std::string const& delimiter,
                                               rmm::mr::device_memory_resource* mr)
@@ -16,14 +16,21 @@
 
 #include "config_utils.hpp"
 
+#include <cudf/io/memory_resource.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/export.hpp>
 
+#include <rmm/aligned.hpp>
 #include <rmm/cuda_device.hpp>
+#include <rmm/cuda_stream.hpp>
+#include <rmm/mr/device/pool_memory_resource.hpp>
 #include <rmm/mr/pinned_host_memory_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <algorithm>
 #include <cstdlib>
+#include <mutex>
+#include <optional>
 #include <string>
 
 namespace cudf::io {
@@ -93,18 +100,162 @@ inline std::mutex& host_mr_lock()
   return map_lock;
 }
 
-inline rmm::host_async_resource_ref default_pinned_mr()
+namespace {
+
+/**
+ * @brief A pinned host memory resource that serves allocations from a fixed-size pool and falls
+ * back to `cudaHostAlloc` for allocations that do not fit.
+ *
+ * Allocating pinned memory is slow and synchronizes the device, so the pool keeps small staging
+ * buffers, e.g. the host side of `hostdevice_vector`, from paying for it on every read.
+ */
+class fixed_pinned_pool_memory_resource {
+  using upstream_mr    = rmm::mr::pinned_host_memory_resource;
+  using host_pooled_mr = rmm::mr::pool_memory_resource<upstream_mr>;
+
+ public:
+  explicit fixed_pinned_pool_memory_resource(std::size_t size)
+    : _pool_size{size}, _pool{&_upstream_mr, size, size}
+  {
+    if (_pool_size == 0) { return; }
+    // Allocate the whole pool once to find the address range it covers
+    _pool_begin = _pool.allocate_async(_pool_size, _stream.view());
+    _pool_end   = static_cast<uint8_t*>(_pool_begin) + _pool_size;
+    _pool.deallocate_async(_pool_begin, _pool_size, _stream.view());
+  }
+
+  void* allocate_async(std::size_t bytes, std::size_t alignment, cuda::stream_ref stream)
+  {
+    if (bytes <= _pool_size) {
+      try {
+        return _pool.allocate_async(bytes, alignment, stream);
+      } catch (rmm::out_of_memory const&) {
+        // the pool is exhausted or fragmented, fall back to the upstream resource
+      }
+    }
+    return _upstream_mr.allocate_async(bytes, alignment, stream);
+  }
+
+  void* allocate_async(std::size_t bytes, cuda::stream_ref stream)
+  {
+    return allocate_async(bytes, rmm::RMM_DEFAULT_HOST_ALIGNMENT, stream);
+  }
+
+  void* allocate(std::size_t bytes, std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT)
+  {
+    // the internal stream makes the pool wait for pending frees on other streams; the memory is
+    // usable by the host once it is synchronized
+    auto const result = allocate_async(bytes, alignment, _stream.view());
+    _stream.synchronize();
+    return result;
+  }
+
+  void deallocate_async(void* ptr,
+                        std::size_t bytes,
+                        std::size_t alignment,
+                        cuda::stream_ref stream) noexcept
+  {
+    if (ptr >= _pool_begin and ptr < _pool_end) {
+      _pool.deallocate_async(ptr, bytes, alignment, stream);
+    } else {
+      _upstream_mr.deallocate_async(ptr, bytes, alignment, stream);
+    }
+  }
+
+  void deallocate_async(void* ptr, std::size_t bytes, cuda::stream_ref stream) noexcept
+  {
+    deallocate_async(ptr, bytes, rmm::RMM_DEFAULT_HOST_ALIGNMENT, stream);
+  }
+
+  void deallocate(void* ptr,
+                  std::size_t bytes,
+                  std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT) noexcept
+  {
+    deallocate_async(ptr, bytes, alignment, _stream.view());
+  }
+
+  bool operator==(fixed_pinned_pool_memory_resource const& other) const
+  {
+    return this == &other;
+  }
+
+  bool operator!=(fixed_pinned_pool_memory_resource const& other) const
+  {
+    return !operator==(other);
+  }
+
+  friend void get_property(fixed_pinned_pool_memory_resource const&,
+                           cuda::mr::device_accessible) noexcept
+  {
+  }
+
+  friend void get_property(fixed_pinned_pool_memory_resource const&,
+                           cuda::mr::host_accessible) noexcept
+  {
+  }
+
+ private:
+  upstream_mr _upstream_mr{};
+  std::size_t _pool_size{0};
+  host_pooled_mr _pool;
+  rmm::cuda_stream _stream{};
+  void* _pool_begin{nullptr};
+  void* _pool_end{nullptr};
+};
+
+static_assert(cuda::mr::resource_with<fixed_pinned_pool_memory_resource,
+                                      cuda::mr::device_accessible,
+                                      cuda::mr::host_accessible>,
+              "");
+
+/**
+ * @brief Returns the size of the default pinned pool.
+ *
+ * `LIBCUDF_PINNED_POOL_SIZE` takes precedence over the configured size; by default the pool takes
+ * 0.5% of the device memory, up to 100MB.
+ */
+std::size_t default_pinned_pool_size(std::optional<std::size_t> config_size)
 {
-  static rmm::mr::pinned_host_memory_resource default_mr{};
-  return default_mr;
+  auto const size = [&]() -> std::size_t {
+    if (std::getenv("LIBCUDF_PINNED_POOL_SIZE") != nullptr) {
+      return getenv_or<std::size_t>("LIBCUDF_PINNED_POOL_SIZE", 0);
+    }
+    if (config_size.has_value()) { return *config_size; }
+    auto const total = rmm::available_device_memory().second;
+    return std::min(total / 200, std::size_t{100} * 1024 * 1024);
+  }();
+  // rmm pools are sized in multiples of 256 bytes
+  return rmm::align_up(size, rmm::CUDA_ALLOCATION_ALIGNMENT);
 }
 
-CUDF_EXPORT inline auto& host_mr()
+rmm::host_async_resource_ref make_default_pinned_mr(std::optional<std::size_t> config_size)
 {
-  static rmm::host_async_resource_ref host_mr = default_pinned_mr();
+  // Never freed: releasing pinned memory during static destruction can outlive the CUDA context
+  static auto* mr = new fixed_pinned_pool_memory_resource{default_pinned_pool_size(config_size)};
+  return *mr;
+}
+
+}  // namespace
+
+inline std::optional<rmm::host_async_resource_ref>& host_mr_storage()
+{
+  static std::optional<rmm::host_async_resource_ref> host_mr;
   return host_mr;
 }
 
+/**
+ * @brief Returns the host memory resource, creating the default pinned pool on first use.
+ *
+ * Must be called with `host_mr_lock()` held.
+ */
+CUDF_EXPORT inline rmm::host_async_resource_ref& host_mr(
+  std::optional<std::size_t> pool_size = std::nullopt)
+{
+  auto& mr = host_mr_storage();
+  if (not mr.has_value()) { mr = make_default_pinned_mr(pool_size); }
+  return *mr;
+}
+
 }  // namespace detail
 
 rmm::host_async_resource_ref set_host_memory_resource(rmm::host_async_resource_ref mr)
@@ -121,4 +272,12 @@ rmm::host_async_resource_ref get_host_memory_resource()
   return detail::host_mr();
 }
 
+bool config_default_host_memory_resource(host_mr_options const& opts)
+{
+  std::lock_guard lock{detail::host_mr_lock()};
+  if (detail::host_mr_storage().has_value()) { return false; }
+  detail::host_mr(opts.pool_size);
+  return true;
+}
+
 }  // namespace cudf::io
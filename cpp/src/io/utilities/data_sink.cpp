@@ -17,6 +17,7 @@
 #include "file_io_utilities.hpp"
 #include "io/utilities/config_utils.hpp"
 
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -24,11 +25,198 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
 
 namespace cudf {
 namespace io {
 
+/**
+ * @brief Writes data to a file from a background thread, staging it in rotating pinned buffers.
+ *
+ * Device data is copied to a staging buffer asynchronously on the caller's stream; the returned
+ * future is ready once the copy completes, while the file write happens in the background. The
+ * caller only blocks when all staging buffers hold data that has not been written yet.
+ */
+class staged_file_writer {
+  constexpr static int num_tickets = 2;
+
+  struct host_ticket {
+    cudaEvent_t event;
+    cudf::detail::pinned_host_vector<char> buffer;
+  };
+
+  struct write_request {
+    std::size_t ticket_idx;
+    std::size_t offset;
+    std::size_t size;
+    bool is_device_copy;
+    // Set for the last piece of a device write, once the piece has been copied to the host
+    std::unique_ptr<std::promise<void>> copied;
+  };
+
+ public:
+  staged_file_writer(std::ofstream& output_stream, std::size_t buffer_size)
+    : _output_stream{output_stream}
+  {
+    CUDF_EXPECTS(buffer_size > 0, "Staging buffers must not be empty");
+    for (auto& ticket : _tickets) {
+      CUDF_CUDA_TRY(cudaEventCreateWithFlags(&(ticket.event), cudaEventDisableTiming));
+      ticket.buffer.resize(buffer_size);
+      _free_tickets.push(_free_tickets.size());
+    }
+    _worker = std::thread([this] { write_pending(); });
+  }
+
+  ~staged_file_writer()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _cv.notify_all();
+    _worker.join();
+    for (auto& ticket : _tickets) {
+      cudaEventDestroy(ticket.event);
+    }
+  }
+
+  void host_write(void const* data, std::size_t size, std::size_t offset)
+  {
+    auto const src = static_cast<char const*>(data);
+    for (std::size_t pos = 0; pos < size;) {
+      auto const ticket_idx = acquire_ticket();
+      auto const piece_size = std::min(size - pos, _tickets[ticket_idx].buffer.size());
+      std::memcpy(_tickets[ticket_idx].buffer.data(), src + pos, piece_size);
+      enqueue({ticket_idx, offset + pos, piece_size, false, nullptr});
+      pos += piece_size;
+    }
+  }
+
+  std::future<void> device_write_async(void const* gpu_data,
+                                       std::size_t size,
+                                       std::size_t offset,
+                                       rmm::cuda_stream_view stream)
+  {
+    auto copied     = std::make_unique<std::promise<void>>();
+    auto copied_fut = copied->get_future();
+    auto const src  = static_cast<char const*>(gpu_data);
+    std::size_t pos = 0;
+    do {
+      auto const ticket_idx = acquire_ticket();
+      auto& ticket          = _tickets[ticket_idx];
+      auto const piece_size = std::min(size - pos, ticket.buffer.size());
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        ticket.buffer.data(), src + pos, piece_size, cudaMemcpyDefault, stream.value()));
+      CUDF_CUDA_TRY(cudaEventRecord(ticket.event, stream.value()));
+      pos += piece_size;
+      enqueue({ticket_idx,
+               offset + pos - piece_size,
+               piece_size,
+               true,
+               pos == size ? std::move(copied) : nullptr});
+    } while (pos < size);
+    return copied_fut;
+  }
+
+  /**
+   * @brief Blocks until all enqueued data has been written to the file.
+   */
+  void flush()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] { return _pending.empty() and not _is_writing; });
+    rethrow_error();
+  }
+
+ private:
+  std::size_t acquire_ticket()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] { return not _free_tickets.empty() or _error != nullptr; });
+    rethrow_error();
+    auto const ticket_idx = _free_tickets.front();
+    _free_tickets.pop();
+    return ticket_idx;
+  }
+
+  void enqueue(write_request&& request)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _pending.push(std::move(request));
+    }
+    _cv.notify_all();
+  }
+
+  // Must be called with `_mutex` held
+  void rethrow_error()
+  {
+    if (_error != nullptr) { std::rethrow_exception(std::exchange(_error, nullptr)); }
+  }
+
+  void write_pending()
+  {
+    while (true) {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv.wait(lock, [this] { return not _pending.empty() or _stop; });
+      if (_pending.empty()) { return; }
+      auto request = std::move(_pending.front());
+      _pending.pop();
+      _is_writing = true;
+      lock.unlock();
+
+      auto const& ticket = _tickets[request.ticket_idx];
+      std::exception_ptr error;
+      try {
+        if (request.is_device_copy) { CUDF_CUDA_TRY(cudaEventSynchronize(ticket.event)); }
+      } catch (...) {
+        error = std::current_exception();
+      }
+      if (request.copied) {
+        if (error) {
+          request.copied->set_exception(error);
+        } else {
+          request.copied->set_value();
+        }
+      }
+      if (not error) {
+        _output_stream.seekp(request.offset);
+        _output_stream.write(ticket.buffer.data(), request.size);
+        if (not _output_stream.good()) {
+          error = std::make_exception_ptr(cudf::logic_error("Failed to write to the output file"));
+        }
+      }
+
+      lock.lock();
+      if (error and not _error) { _error = error; }
+      _free_tickets.push(request.ticket_idx);
+      _is_writing = false;
+      lock.unlock();
+      _cv.notify_all();
+    }
+  }
+
+  std::ofstream& _output_stream;
+  std::array<host_ticket, num_tickets> _tickets{};
+  std::queue<std::size_t> _free_tickets;
+  std::queue<write_request> _pending;
+  bool _is_writing = false;
+  bool _stop       = false;
+  std::exception_ptr _error;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::thread _worker;
+};
+
 /**
  * @brief Implementation class for storing data into a local file.
  */
@@ -46,28 +234,50 @@ class file_sink : public data_sink {
     } else {
       _cufile_out = detail::make_cufile_output(filepath);
     }
+
+    if (detail::getenv_or("LIBCUDF_FILE_SINK_ASYNC", 0) != 0) {
+      _staged_writer = std::make_unique<staged_file_writer>(
+        _output_stream, detail::getenv_or("LIBCUDF_FILE_SINK_BUFFER_SIZE", _default_buffer_size));
+    }
   }
 
-  virtual ~file_sink() { flush(); }
+  virtual ~file_sink()
+  {
+    try {
+      flush();
+    } catch (std::exception const& e) {
+      CUDF_LOG_ERROR("Failed to write to the output file: {}", e.what());
+    }
+  }
 
   void host_write(void const* data, size_t size) override
   {
-    _output_stream.seekp(_bytes_written);
-    _output_stream.write(static_cast<char const*>(data), size);
+    if (_staged_writer) {
+      _staged_writer->host_write(data, size, _bytes_written);
+    } else {
+      _output_stream.seekp(_bytes_written);
+      _output_stream.write(static_cast<char const*>(data), size);
+    }
     _bytes_written += size;
   }
 
-  void flush() override { _output_stream.flush(); }
+  void flush() override
+  {
+    if (_staged_writer) { _staged_writer->flush(); }
+    _output_stream.flush();
+  }
 
   size_t bytes_written() override { return _bytes_written; }
 
   [[nodiscard]] bool supports_device_write() const override
   {
-    return !_kvikio_file.closed() || _cufile_out != nullptr;
+    return !_kvikio_file.closed() || _cufile_out != nullptr || _staged_writer != nullptr;
   }
 
   [[nodiscard]] bool is_device_write_preferred(size_t size) const override
   {
+    // Staged writes copy to the host without blocking the caller, so they are always preferred
+    if (_staged_writer) { return true; }
     if (size < _gds_write_preferred_threshold) { return false; }
     return supports_device_write();
   }
@@ -81,6 +291,11 @@ class file_sink : public data_sink {
     size_t offset = _bytes_written;
     _bytes_written += size;
 
+    bool const is_gds_available = !_kvikio_file.closed() || _cufile_out != nullptr;
+    if (_staged_writer and (!is_gds_available or size < _gds_write_preferred_threshold)) {
+      return _staged_writer->device_write_async(gpu_data, size, offset, stream);
+    }
+
     if (!_kvikio_file.closed()) {
       // KvikIO's `pwrite()` returns a `std::future<size_t>` so we convert it
       // to `std::future<void>`
@@ -101,8 +316,12 @@ class file_sink : public data_sink {
   size_t _bytes_written = 0;
   std::unique_ptr<detail::cufile_output_impl> _cufile_out;
   kvikio::FileHandle _kvikio_file;
+  // Declared after `_output_stream`, so it stops writing before the stream is closed
+  std::unique_ptr<staged_file_writer> _staged_writer;
   // The write size above which GDS is faster then d2h-copy + posix-write
   static constexpr size_t _gds_write_preferred_threshold = 128 << 10;  // 128KB
+  // Size of each staging buffer used by asynchronous writes
+  static constexpr size_t _default_buffer_size = 8 << 20;  // 8MB
 };
 
 /**
@@ -16,6 +16,8 @@
 
 #include "file_io_utilities.hpp"
 #include "io/utilities/config_utils.hpp"
+#include "io/utilities/remote_datasource.hpp"
+#include "io/utilities/thread_pool.hpp"
 
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/datasource.hpp>
@@ -30,6 +32,11 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <mutex>
 #include <unordered_map>
 
 namespace cudf {
@@ -254,24 +261,21 @@ class direct_read_source : public file_source {
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     ssize_t const read_size = std::min(size, _file.size() - offset);
 
+    // `pread` does not move the file position, so concurrent reads are safe
     std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
+    CUDF_EXPECTS(pread(_file.desc(), v.data(), read_size, offset) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     auto const read_size = std::min(size, _file.size() - offset);
 
-    CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
+    CUDF_EXPECTS(pread(_file.desc(), dst, read_size, offset) == static_cast<ssize_t>(read_size),
                  "read failed");
     return read_size;
   }
@@ -389,6 +393,11 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  void prefetch(host_span<std::pair<size_t, size_t> const> ranges) override
+  {
+    source->prefetch(ranges);
+  }
+
   [[nodiscard]] bool supports_device_read() const override
   {
     return source->supports_device_read();
@@ -430,12 +439,321 @@ class user_datasource_wrapper : public datasource {
   datasource* const source;  ///< A non-owning pointer to the user-implemented datasource
 };
 
+/**
+ * @brief Buffer that exposes a slice of a shared prefetched block.
+ */
+class prefetched_buffer : public datasource::buffer {
+ public:
+  prefetched_buffer(std::shared_ptr<datasource::buffer> block, size_t offset, size_t size)
+    : _block{std::move(block)}, _data{_block->data() + offset}, _size{size}
+  {
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+  [[nodiscard]] uint8_t const* data() const override { return _data; }
+
+ private:
+  std::shared_ptr<datasource::buffer> _block;  ///< Keeps the prefetched block alive
+  uint8_t const* _data;
+  size_t _size;
+};
+
+/**
+ * @brief Set of disjoint byte ranges, stored as a map from the begin to the end of each range.
+ */
+class range_set {
+ public:
+  /**
+   * @brief Adds the range `[begin, end)`, merging it with the ranges it overlaps or touches.
+   */
+  void add(size_t begin, size_t end)
+  {
+    if (begin >= end) { return; }
+    auto it = _ranges.upper_bound(begin);
+    if (it != _ranges.begin() and std::prev(it)->second >= begin) { --it; }
+    while (it != _ranges.end() and it->first <= end) {
+      begin = std::min(begin, it->first);
+      end   = std::max(end, it->second);
+      it    = _ranges.erase(it);
+    }
+    _ranges.emplace(begin, end);
+  }
+
+  /**
+   * @brief Removes the range `[begin, end)`, trimming or splitting the ranges it overlaps.
+   */
+  void remove(size_t begin, size_t end)
+  {
+    if (begin >= end) { return; }
+    auto it = _ranges.upper_bound(begin);
+    if (it != _ranges.begin() and std::prev(it)->second > begin) { --it; }
+    while (it != _ranges.end() and it->first < end) {
+      auto const [range_begin, range_end] = *it;
+      it                                  = _ranges.erase(it);
+      if (range_begin < begin) { _ranges.emplace(range_begin, begin); }
+      if (range_end > end) { _ranges.emplace(end, range_end); }
+    }
+  }
+
+  /**
+   * @brief Adds all ranges of another set.
+   */
+  void merge(range_set const& other)
+  {
+    for (auto const& [begin, end] : other._ranges) {
+      add(begin, end);
+    }
+  }
+
+  [[nodiscard]] bool empty() const { return _ranges.empty(); }
+
+ private:
+  std::map<size_t, size_t> _ranges;
+};
+
+/**
+ * @brief Wrapper class that coalesces the prefetched byte ranges and reads them on a thread pool.
+ *
+ * Each block keeps the ranges that were requested from it and not read yet. Bytes merged into a
+ * block only to fill a gap between requested ranges are never waited for. A block is released
+ * once all of its requested ranges have been read, which makes room in the window for the ranges
+ * that are still pending.
+ */
+class prefetching_source : public datasource {
+  struct pending_read {
+    size_t offset;        ///< Offset of the coalesced read
+    size_t size;          ///< Size of the coalesced read
+    range_set requested;  ///< Ranges requested through `prefetch()`
+  };
+
+  struct block {
+    size_t size;                                       ///< Requested size of the block
+    std::shared_future<std::shared_ptr<buffer>> data;  ///< Result of the read task
+    range_set unread;                                  ///< Requested ranges not read yet
+  };
+
+ public:
+  prefetching_source(std::unique_ptr<datasource> source,
+                     size_t max_gap,
+                     size_t window_size,
+                     int num_threads)
+    : _source{std::move(source)},
+      _max_gap{max_gap},
+      _window_size{window_size},
+      _max_read_size{std::max<size_t>(window_size / std::max(num_threads, 1), 1)},
+      _pool(num_threads)
+  {
+    CUDF_EXPECTS(_source != nullptr, "Cannot prefetch from a null source");
+    CUDF_EXPECTS(num_threads > 0, "Prefetching requires at least one thread");
+  }
+
+  void prefetch(host_span<std::pair<size_t, size_t> const> ranges) override
+  {
+    std::vector<std::pair<size_t, size_t>> sorted_ranges;
+    sorted_ranges.reserve(ranges.size());
+    for (auto const& [offset, size] : ranges) {
+      if (offset < _source->size() and size != 0) {
+        sorted_ranges.emplace_back(offset, std::min(size, _source->size() - offset));
+      }
+    }
+    std::sort(sorted_ranges.begin(), sorted_ranges.end());
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto const& [offset, size] : sorted_ranges) {
+      if (auto const requested = covering_ranges(offset, size); requested != nullptr) {
+        // Keep the covering block alive until this range has been read as well
+        requested->add(offset, offset + size);
+        continue;
+      }
+      if (not _pending.empty()) {
+        // Merge with the previous range when the gap is small enough
+        auto& last            = _pending.back();
+        auto const last_end   = last.offset + last.size;
+        auto const merged_end = std::max(last_end, offset + size);
+        if (offset >= last.offset and offset <= last_end + _max_gap and
+            merged_end - last.offset <= _max_read_size) {
+          last.size = merged_end - last.offset;
+          last.requested.add(offset, offset + size);
+          continue;
+        }
+      }
+      _pending.push_back(pending_read{offset, size, {}});
+      _pending.back().requested.add(offset, offset + size);
+    }
+    issue_pending_reads();
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const count = std::min(size, this->size() - offset);
+    if (auto prefetched = read_prefetched(offset, count)) { return prefetched; }
+    return _source->host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const count = std::min(size, this->size() - offset);
+    if (auto const prefetched = read_prefetched(offset, count)) {
+      std::memcpy(dst, prefetched->data(), prefetched->size());
+      return prefetched->size();
+    }
+    return _source->host_read(offset, size, dst);
+  }
+
+  [[nodiscard]] bool supports_device_read() const override
+  {
+    return _source->supports_device_read();
+  }
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override
+  {
+    return _source->is_device_read_preferred(size);
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    auto const count = std::min(size, this->size() - offset);
+    if (auto const prefetched = read_prefetched(offset, count)) {
+      auto const read_size = prefetched->size();
+      CUDF_CUDA_TRY(
+        cudaMemcpyAsync(dst, prefetched->data(), read_size, cudaMemcpyDefault, stream.value()));
+      // The prefetched block may be released when this function returns
+      stream.synchronize();
+      return std::async(std::launch::deferred, [read_size] { return read_size; });
+    }
+    return _source->device_read_async(offset, size, dst, stream);
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return device_read_async(offset, size, dst, stream).get();
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    rmm::device_buffer out_data(size, stream);
+    size_t read = device_read(offset, size, reinterpret_cast<uint8_t*>(out_data.data()), stream);
+    out_data.resize(read, stream);
+    return datasource::buffer::create(std::move(out_data));
+  }
+
+  [[nodiscard]] size_t size() const override { return _source->size(); }
+
+ private:
+  /**
+   * @brief Returns an iterator to the block that holds the given range, or `end()` if none does.
+   */
+  std::map<size_t, block>::iterator find_block(size_t offset, size_t size)
+  {
+    auto it = _blocks.upper_bound(offset);
+    if (it == _blocks.begin()) { return _blocks.end(); }
+    --it;
+    return (offset + size <= it->first + it->second.size) ? it : _blocks.end();
+  }
+
+  /**
+   * @brief Returns the requested ranges of the block or pending read that holds the given range,
+   * or nullptr if none does.
+   */
+  range_set* covering_ranges(size_t offset, size_t size)
+  {
+    if (auto const it = find_block(offset, size); it != _blocks.end()) {
+      return &it->second.unread;
+    }
+    auto const it = std::find_if(_pending.begin(), _pending.end(), [&](auto const& read) {
+      return offset >= read.offset and offset + size <= read.offset + read.size;
+    });
+    return it != _pending.end() ? &it->requested : nullptr;
+  }
+
+  /**
+   * @brief Submits the pending reads that fit into the prefetch window.
+   *
+   * Always submits at least one read when nothing is buffered, so that ranges larger than the
+   * window are still prefetched. Expects `_mutex` to be held.
+   */
+  void issue_pending_reads()
+  {
+    while (not _pending.empty() and
+           (_blocks.empty() or _buffered_bytes + _pending.front().size <= _window_size)) {
+      auto read = std::move(_pending.front());
+      _pending.pop_front();
+      if (auto const it = _blocks.find(read.offset); it != _blocks.end()) {
+        it->second.unread.merge(read.requested);
+        continue;
+      }
+
+      auto read_task =
+        _pool.submit([source = _source.get(), offset = read.offset, size = read.size] {
+          // Reads of the current pass go ahead of the prefetches in the shared I/O pool
+          detail::scoped_io_priority const priority{cudf::detail::task_priority::LOW};
+          return std::shared_ptr<buffer>{source->host_read(offset, size)};
+        });
+      _blocks.emplace(read.offset,
+                      block{read.size, read_task.share(), std::move(read.requested)});
+      _buffered_bytes += read.size;
+    }
+  }
+
+  /**
+   * @brief Returns the given range from a prefetched block, or nullptr if it was not prefetched.
+   *
+   * Waits for the block read to complete if needed.
+   */
+  std::unique_ptr<buffer> read_prefetched(size_t offset, size_t size)
+  {
+    std::shared_future<std::shared_ptr<buffer>> data;
+    size_t block_offset = 0;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto const it = find_block(offset, size);
+      if (it == _blocks.end()) { return nullptr; }
+      block_offset = it->first;
+      data         = it->second.data;
+      it->second.unread.remove(offset, offset + size);
+      if (it->second.unread.empty()) {
+        _buffered_bytes -= it->second.size;
+        _blocks.erase(it);
+        issue_pending_reads();
+      }
+    }
+    auto const block_data = data.get();
+    // Clamp to the data the source actually returned
+    auto const begin = std::min(offset - block_offset, block_data->size());
+    return std::make_unique<prefetched_buffer>(
+      block_data, begin, std::min(size, block_data->size() - begin));
+  }
+
+  std::unique_ptr<datasource> const _source;
+  size_t const _max_gap;
+  size_t const _window_size;
+  size_t const _max_read_size;  ///< Coalesced reads are not merged beyond this size
+
+  std::mutex _mutex;
+  std::map<size_t, block> _blocks;    ///< Submitted reads, keyed by offset
+  std::deque<pending_read> _pending;  ///< Coalesced reads not yet submitted
+  size_t _buffered_bytes = 0;         ///< Total size of the submitted blocks
+
+  // Declared last so that the pool is destroyed, and the read tasks completed, first
+  cudf::detail::thread_pool _pool;
+};
+
 }  // namespace
 
 std::unique_ptr<datasource> datasource::create(std::string const& filepath,
                                                size_t offset,
                                                size_t size)
 {
+  if (detail::is_remote_path(filepath)) { return detail::make_remote_source(filepath); }
 #ifdef CUFILE_FOUND
   if (detail::cufile_integration::is_always_enabled()) {
     // avoid mmap as GDS is expected to be used for most reads
@@ -468,5 +786,14 @@ std::unique_ptr<datasource> datasource::create(datasource* source)
   return std::make_unique<user_datasource_wrapper>(source);
 }
 
+std::unique_ptr<datasource> datasource::create_prefetching(std::unique_ptr<datasource> source,
+                                                           size_t max_gap,
+                                                           size_t window_size,
+                                                           int num_threads)
+{
+  return std::make_unique<prefetching_source>(
+    std::move(source), max_gap, window_size, num_threads);
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -28,6 +28,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <numeric>
 
 namespace cudf {
@@ -209,11 +210,8 @@ cufile_registered_file::~cufile_registered_file() { shim->handle_deregister(cf_h
 
 cufile_input_impl::cufile_input_impl(std::string const& filepath)
   : shim{cufile_shim::instance()},
-    cf_file(shim, filepath, O_RDONLY | O_DIRECT),
-    // The benefit from multithreaded read plateaus around 16 threads
-    pool(getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", 16))
+    cf_file(shim, filepath, O_RDONLY | O_DIRECT)
 {
-  pool.sleep_duration = 10;
 }
 
 namespace {
@@ -222,14 +220,16 @@ template <typename DataT,
           typename F,
           typename ResultT = std::invoke_result_t<F, DataT*, size_t, size_t>>
 std::vector<std::future<ResultT>> make_sliced_tasks(
-  F function, DataT* ptr, size_t offset, size_t size, cudf::detail::thread_pool& pool)
+  F function, DataT* ptr, size_t offset, size_t size)
 {
   constexpr size_t default_max_slice_size = 4 * 1024 * 1024;
   static auto const max_slice_size = getenv_or("LIBCUDF_CUFILE_SLICE_SIZE", default_max_slice_size);
   auto const slices                = make_file_io_slices(size, max_slice_size);
+  auto const priority              = current_io_priority();
   std::vector<std::future<ResultT>> slice_tasks;
   std::transform(slices.cbegin(), slices.cend(), std::back_inserter(slice_tasks), [&](auto& slice) {
-    return pool.submit(function, ptr + slice.offset, slice.size, offset + slice.offset);
+    return io_thread_pool().submit_with_priority(
+      priority, function, ptr + slice.offset, slice.size, offset + slice.offset);
   });
   return slice_tasks;
 }
@@ -252,7 +252,7 @@ std::future<size_t> cufile_input_impl::read_async(size_t offset,
     return read_size;
   };
 
-  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size, pool);
+  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size);
 
   auto waiter = [](auto slice_tasks) -> size_t {
     return std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0, [](auto sum, auto& task) {
@@ -266,8 +266,7 @@ std::future<size_t> cufile_input_impl::read_async(size_t offset,
 
 cufile_output_impl::cufile_output_impl(std::string const& filepath)
   : shim{cufile_shim::instance()},
-    cf_file(shim, filepath, O_CREAT | O_RDWR | O_DIRECT, 0664),
-    pool(getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", 16))
+    cf_file(shim, filepath, O_CREAT | O_RDWR | O_DIRECT, 0664)
 {
 }
 
@@ -285,7 +284,7 @@ std::future<void> cufile_output_impl::write_async(void const* data, size_t offse
   };
 
   auto source      = static_cast<uint8_t const*>(data);
-  auto slice_tasks = make_sliced_tasks(write_slice, source, offset, size, pool);
+  auto slice_tasks = make_sliced_tasks(write_slice, source, offset, size);
 
   auto waiter = [](auto slice_tasks) -> void {
     for (auto const& task : slice_tasks) {
@@ -368,6 +367,35 @@ std::vector<file_io_slice> make_file_io_slices(size_t size, size_t max_slice_siz
   return slices;
 }
 
+namespace {
+
+thread_local cudf::detail::task_priority io_priority = cudf::detail::task_priority::HIGH;
+
+}  // namespace
+
+cudf::detail::thread_pool& io_thread_pool()
+{
+  static auto const pool = [] {
+    // The benefit from multithreaded I/O plateaus around 16 threads
+    auto pool = std::make_unique<cudf::detail::thread_pool>(
+      getenv_or("LIBCUDF_IO_THREAD_COUNT", getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", 16)));
+    // Slices are small; idle threads poll often so that reads do not wait for them to wake up
+    pool->sleep_duration = 10;
+    return pool;
+  }();
+  return *pool;
+}
+
+cudf::detail::task_priority current_io_priority() { return io_priority; }
+
+scoped_io_priority::scoped_io_priority(cudf::detail::task_priority priority)
+  : _previous{io_priority}
+{
+  io_priority = priority;
+}
+
+scoped_io_priority::~scoped_io_priority() { io_priority = _previous; }
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
@@ -16,9 +16,9 @@
 
 #pragma once
 
-#ifdef CUFILE_FOUND
 #include "thread_pool.hpp"
 
+#ifdef CUFILE_FOUND
 #include <cudf_test/file_utilities.hpp>
 
 #include <cufile.h>
@@ -147,7 +147,6 @@ class cufile_input_impl final : public cufile_input {
  private:
   cufile_shim const* shim = nullptr;
   cufile_registered_file const cf_file;
-  cudf::detail::thread_pool pool;
 };
 
 /**
@@ -164,7 +163,6 @@ class cufile_output_impl final : public cufile_output {
  private:
   cufile_shim const* shim = nullptr;
   cufile_registered_file const cf_file;
-  cudf::detail::thread_pool pool;
 };
 #else
 
@@ -221,6 +219,38 @@ struct file_io_slice {
  */
 std::vector<file_io_slice> make_file_io_slices(size_t size, size_t max_slice_size);
 
+/**
+ * @brief Returns the thread pool that performs the sliced reads and writes of all I/O sources and
+ * sinks in the process.
+ *
+ * Sharing the pool bounds the number of concurrent I/O requests when several readers or writers
+ * run at the same time. Its size is set by `LIBCUDF_IO_THREAD_COUNT`, and defaults to 16.
+ */
+cudf::detail::thread_pool& io_thread_pool();
+
+/**
+ * @brief Returns the priority of the I/O tasks submitted by the calling thread.
+ */
+cudf::detail::task_priority current_io_priority();
+
+/**
+ * @brief Sets the priority of the I/O tasks submitted by the calling thread for the lifetime of
+ * the object.
+ *
+ * Prefetches use `LOW` so that they do not delay the reads the current pass is waiting on.
+ */
+class scoped_io_priority {
+ public:
+  explicit scoped_io_priority(cudf::detail::task_priority priority);
+  ~scoped_io_priority();
+
+  scoped_io_priority(scoped_io_priority const&)            = delete;
+  scoped_io_priority& operator=(scoped_io_priority const&) = delete;
+
+ private:
+  cudf::detail::task_priority const _previous;
+};
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
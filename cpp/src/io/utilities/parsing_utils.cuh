@@ -22,6 +22,7 @@
 
 #include <cudf/io/types.hpp>
 #include <cudf/lists/list_view.hpp>
+#include <cudf/strings/detail/convert/decimal_to_binary.cuh>
 #include <cudf/strings/detail/convert/fixed_point.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/structs/struct_view.hpp>
@@ -49,6 +50,7 @@ struct json_inference_options_view {
   cudf::detail::trie_view trie_true;
   cudf::detail::trie_view trie_false;
   cudf::detail::trie_view trie_na;
+  bool infer_datetime;
 };
 
 /**
@@ -87,13 +89,15 @@ struct parse_options {
   cudf::detail::optional_trie trie_false;
   cudf::detail::optional_trie trie_na;
   bool multi_delimiter;
+  bool infer_datetime;
 
   [[nodiscard]] json_inference_options_view json_view() const
   {
     return {quotechar,
             cudf::detail::make_trie_view(trie_true),
             cudf::detail::make_trie_view(trie_false),
-            cudf::detail::make_trie_view(trie_na)};
+            cudf::detail::make_trie_view(trie_na),
+            infer_datetime};
   }
 
   [[nodiscard]] parse_options_view view() const
@@ -216,24 +220,79 @@ __host__ __device__ std::optional<T> parse_numeric(char const* begin,
   }
   if (*begin == '-' || *begin == '+') begin++;
 
-  // Skip over the "0x" prefix for hex notation
-  if (base == 16 && begin + 2 < end && *begin == '0' && *(begin + 1) == 'x') { begin += 2; }
+  if constexpr (std::is_floating_point_v<T>) {
+#ifdef __CUDA_ARCH__
+    // The significant digits are accumulated exactly, as long as they fit, and
+    // converted only once together with the decimal exponent
+    uint64_t digits      = 0;
+    int32_t num_digits   = 0;
+    int32_t exp10        = 0;
+    bool truncated       = false;
+    auto const add_digit = [&](char c, bool is_fraction) {
+      auto const digit = decode_digit<T, as_hex>(c, &all_digits_valid);
+      if (num_digits < strings::detail::max_exact_decimal_digits) {
+        digits = (digits * 10) + digit;
+        num_digits += static_cast<int32_t>(digits > 0);  // leading zeros are not significant
+        exp10 -= static_cast<int32_t>(is_fraction);
+      } else {
+        truncated = truncated || (digit != 0);
+        exp10 += static_cast<int32_t>(!is_fraction);
+      }
+    };
 
-  // Handle the whole part of the number
-  // auto index = begin;
-  while (begin < end) {
-    if (*begin == opts.decimal) {
+    // Handle the whole part of the number
+    while (begin < end) {
+      if (*begin == opts.decimal) {
+        ++begin;
+        break;
+      } else if (*begin == 'e' || *begin == 'E') {
+        break;
+      } else if (*begin != opts.thousands && *begin != '+') {
+        add_digit(*begin, false);
+      }
+      ++begin;
+    }
+
+    // Handle fractional part of the number if necessary
+    while (begin < end) {
+      if (*begin == 'e' || *begin == 'E') {
+        ++begin;
+        break;
+      } else if (*begin != opts.thousands && *begin != '+') {
+        add_digit(*begin, true);
+      }
+      ++begin;
+    }
+
+    // Handle exponential part of the number if necessary
+    if (begin < end) {
+      int32_t const exponent_sign = *begin == '-' ? -1 : 1;
+      if (*begin == '-' || *begin == '+') { ++begin; }
+      int32_t exponent = 0;
+      while (begin < end) {
+        auto const digit = decode_digit<T, as_hex>(*(begin++), &all_digits_valid);
+        // large enough to overflow or underflow any mantissa
+        if (exponent < 100'000) { exponent = (exponent * 10) + digit; }
+      }
+      exp10 += exponent * exponent_sign;
+    }
+    if (!all_digits_valid) { return std::optional<T>{}; }
+
+    return static_cast<T>(sign * strings::detail::decimal_to_double(digits, exp10, truncated));
+#else
+    // `decimal_to_double` is device-only; host code builds the value digit by digit
+    while (begin < end) {
+      if (*begin == opts.decimal) {
+        ++begin;
+        break;
+      } else if (*begin == 'e' || *begin == 'E') {
+        break;
+      } else if (*begin != opts.thousands && *begin != '+') {
+        value = (value * base) + decode_digit<T, as_hex>(*begin, &all_digits_valid);
+      }
       ++begin;
-      break;
-    } else if (base == 10 && (*begin == 'e' || *begin == 'E')) {
-      break;
-    } else if (*begin != opts.thousands && *begin != '+') {
-      value = (value * base) + decode_digit<T, as_hex>(*begin, &all_digits_valid);
     }
-    ++begin;
-  }
 
-  if (std::is_floating_point_v<T>) {
     // Handle fractional part of the number if necessary
     double divisor = 1;
     while (begin < end) {
@@ -257,7 +316,29 @@ __host__ __device__ std::optional<T> parse_numeric(char const* begin,
       }
       if (exponent != 0) { value *= exp10(double(exponent * exponent_sign)); }
     }
+    if (!all_digits_valid) { return std::optional<T>{}; }
+
+    return value * sign;
+#endif
+  }
+
+  // Skip over the "0x" prefix for hex notation
+  if (base == 16 && begin + 2 < end && *begin == '0' && *(begin + 1) == 'x') { begin += 2; }
+
+  // Handle the whole part of the number
+  // auto index = begin;
+  while (begin < end) {
+    if (*begin == opts.decimal) {
+      ++begin;
+      break;
+    } else if (base == 10 && (*begin == 'e' || *begin == 'E')) {
+      break;
+    } else if (*begin != opts.thousands && *begin != '+') {
+      value = (value * base) + decode_digit<T, as_hex>(*begin, &all_digits_valid);
+    }
+    ++begin;
   }
+
   if (!all_digits_valid) { return std::optional<T>{}; }
 
   return value * sign;
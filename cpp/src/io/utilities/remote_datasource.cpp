@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/utilities/remote_datasource.hpp"
+
+#include "io/utilities/config_utils.hpp"
+#include "io/utilities/file_io_utilities.hpp"
+
+#include <cudf/detail/utilities/rmm_host_vector.hpp>
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#ifdef CUDF_REMOTE_IO
+#include <curl/curl.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+#include <string_view>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+namespace {
+
+constexpr std::string_view s3_scheme{"s3://"};
+constexpr std::string_view gcs_scheme{"gs://"};
+
+[[nodiscard]] bool starts_with(std::string_view str, std::string_view prefix)
+{
+  return str.substr(0, prefix.size()) == prefix;
+}
+
+#ifdef CUDF_REMOTE_IO
+
+/**
+ * @brief Translates object paths to the equivalent public HTTPS endpoint.
+ */
+[[nodiscard]] std::string to_url(std::string const& path)
+{
+  auto const split_bucket = [&](std::string_view scheme) {
+    auto const object = std::string_view{path}.substr(scheme.size());
+    auto const slash  = object.find('/');
+    CUDF_EXPECTS(slash != std::string_view::npos and slash != 0, "Invalid object path: " + path);
+    return std::pair{std::string{object.substr(0, slash)}, std::string{object.substr(slash + 1)}};
+  };
+  if (starts_with(path, s3_scheme)) {
+    auto const [bucket, key] = split_bucket(s3_scheme);
+    return "https://" + bucket + ".s3.amazonaws.com/" + key;
+  }
+  if (starts_with(path, gcs_scheme)) {
+    auto const [bucket, key] = split_bucket(gcs_scheme);
+    return "https://storage.googleapis.com/" + bucket + "/" + key;
+  }
+  return path;
+}
+
+/**
+ * @brief Returns this thread's libcurl handle, reset to the default options.
+ *
+ * Handles are reused across requests so that connections to the server are kept alive.
+ */
+[[nodiscard]] CURL* thread_curl_handle()
+{
+  static std::once_flag curl_init_flag;
+  std::call_once(curl_init_flag, [] {
+    CUDF_EXPECTS(curl_global_init(CURL_GLOBAL_DEFAULT) == CURLE_OK, "Failed to initialize libcurl");
+  });
+
+  struct curl_handle {
+    CURL* handle = curl_easy_init();
+    ~curl_handle() { curl_easy_cleanup(handle); }
+  };
+  thread_local curl_handle thread_handle;
+  CUDF_EXPECTS(thread_handle.handle != nullptr, "Failed to create a libcurl handle");
+  curl_easy_reset(thread_handle.handle);
+  return thread_handle.handle;
+}
+
+/**
+ * @brief Destination of the response body of a range request.
+ */
+struct range_writer {
+  uint8_t* dst;
+  size_t capacity;
+  size_t written = 0;
+};
+
+size_t write_range(char* data, size_t size, size_t nmemb, void* userdata)
+{
+  auto& writer       = *static_cast<range_writer*>(userdata);
+  auto const length  = size * nmemb;
+  auto const to_copy = std::min(length, writer.capacity - writer.written);
+  std::memcpy(writer.dst + writer.written, data, to_copy);
+  writer.written += to_copy;
+  // Returning a short count aborts the transfer if the server sends more than requested
+  return to_copy;
+}
+
+/**
+ * @brief Parses the total object size from a `Content-Range: bytes <first>-<last>/<total>` header.
+ */
+size_t parse_content_range(char* data, size_t size, size_t nitems, void* userdata)
+{
+  constexpr std::string_view header{"content-range:"};
+  auto const length = size * nitems;
+  std::string_view const line{data, length};
+  if (line.size() > header.size() and
+      std::equal(header.begin(), header.end(), line.begin(), [](char lhs, char rhs) {
+        return lhs == std::tolower(static_cast<unsigned char>(rhs));
+      })) {
+    auto const slash = line.find('/');
+    if (slash != std::string_view::npos) {
+      *static_cast<size_t*>(userdata) =
+        std::strtoull(std::string{line.substr(slash + 1)}.c_str(), nullptr, 10);
+    }
+  }
+  return length;
+}
+
+/**
+ * @brief Performs a single range request and returns the HTTP status code.
+ */
+long request_range(std::string const& url,
+                   size_t offset,
+                   size_t size,
+                   range_writer& writer,
+                   size_t* total_size = nullptr)
+{
+  auto handle      = thread_curl_handle();
+  auto const range = std::to_string(offset) + "-" + std::to_string(offset + size - 1);
+  curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
+  curl_easy_setopt(handle, CURLOPT_RANGE, range.c_str());
+  curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, 1L);
+  curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, write_range);
+  curl_easy_setopt(handle, CURLOPT_WRITEDATA, &writer);
+  if (total_size != nullptr) {
+    curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, parse_content_range);
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, total_size);
+  }
+
+  auto const result = curl_easy_perform(handle);
+  // A write error is expected when the server ignores the range and the full buffer is written
+  CUDF_EXPECTS(result == CURLE_OK or (result == CURLE_WRITE_ERROR and writer.written == size),
+               "HTTP range request to " + url + " failed: " + curl_easy_strerror(result));
+
+  long status = 0;
+  curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &status);
+  return status;
+}
+
+/**
+ * @brief Implementation class for reading remote objects with HTTP range requests.
+ */
+class remote_source : public datasource {
+ public:
+  explicit remote_source(std::string const& path)
+    : _url{to_url(path)},
+      _max_slice_size{getenv_or("LIBCUDF_REMOTE_IO_SLICE_SIZE", default_max_slice_size)}
+  {
+    // Probe with a one byte request; unlike HEAD, this also works with presigned GET URLs
+    uint8_t first_byte = 0;
+    range_writer writer{&first_byte, 1};
+    auto const status = request_range(_url, 0, 1, writer, &_size);
+    CUDF_EXPECTS(status == 206, "Remote object does not support HTTP range requests: " + _url);
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = std::min(size, _size - offset);
+    cudf::detail::rmm_host_vector<uint8_t> h_data(
+      {cudf::io::get_host_memory_resource(), cudf::get_default_stream()});
+    h_data.resize(read_size);
+    h_data.resize(host_read(offset, read_size, h_data.data()));
+    return buffer::create(std::move(h_data));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const read_size = std::min(size, _size - offset);
+    auto slice_tasks     = read_slices_async(offset, read_size, dst);
+    return std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0ul, [](auto sum, auto& task) {
+      return sum + task.get();
+    });
+  }
+
+  [[nodiscard]] bool supports_device_read() const override { return true; }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    auto const read_size = std::min(size, _size - offset);
+    auto h_data          = std::make_unique<cudf::detail::rmm_host_vector<uint8_t>>(
+      cudf::detail::rmm_host_allocator<uint8_t>{cudf::io::get_host_memory_resource(), stream});
+    h_data->resize(read_size);
+    auto slice_tasks = read_slices_async(offset, read_size, h_data->data());
+
+    auto waiter = [dst, stream](auto h_data, auto slice_tasks) -> size_t {
+      auto const bytes_read =
+        std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0ul, [](auto sum, auto& task) {
+          return sum + task.get();
+        });
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        dst, h_data->data(), bytes_read, cudaMemcpyHostToDevice, stream.value()));
+      // The staging buffer is released when this function returns
+      stream.synchronize();
+      return bytes_read;
+    };
+    // Deferred so that no thread is created per read; the slices are already in flight
+    return std::async(std::launch::deferred, waiter, std::move(h_data), std::move(slice_tasks));
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return device_read_async(offset, size, dst, stream).get();
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    rmm::device_buffer out_data(size, stream);
+    size_t read = device_read(offset, size, reinterpret_cast<uint8_t*>(out_data.data()), stream);
+    out_data.resize(read, stream);
+    return datasource::buffer::create(std::move(out_data));
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+ private:
+  /**
+   * @brief Submits one range request per slice of the given range.
+   */
+  std::vector<std::future<size_t>> read_slices_async(size_t offset, size_t size, uint8_t* dst)
+  {
+    // The shared pool does not wait for the tasks when the source is destroyed; capture the URL
+    auto read_slice = [url = _url, dst, offset](file_io_slice const& slice) {
+      range_writer writer{dst + slice.offset, slice.size};
+      auto const status = request_range(url, offset + slice.offset, slice.size, writer);
+      CUDF_EXPECTS(status == 206 or (status == 200 and offset + slice.offset == 0),
+                   "HTTP range request to " + url + " returned status " + std::to_string(status));
+      return writer.written;
+    };
+
+    auto const slices   = make_file_io_slices(size, _max_slice_size);
+    auto const priority = current_io_priority();
+    std::vector<std::future<size_t>> slice_tasks;
+    slice_tasks.reserve(slices.size());
+    for (auto const& slice : slices) {
+      slice_tasks.push_back(io_thread_pool().submit_with_priority(priority, read_slice, slice));
+    }
+    return slice_tasks;
+  }
+
+  static constexpr size_t default_max_slice_size = 4 * 1024 * 1024;
+
+  std::string const _url;
+  size_t const _max_slice_size;
+  size_t _size = 0;
+};
+
+#endif
+
+}  // namespace
+
+bool is_remote_path(std::string const& path)
+{
+  return starts_with(path, "http://") or starts_with(path, "https://") or
+         starts_with(path, s3_scheme) or starts_with(path, gcs_scheme);
+}
+
+std::unique_ptr<datasource> make_remote_source(std::string const& path)
+{
+#ifdef CUDF_REMOTE_IO
+  return std::make_unique<remote_source>(path);
+#else
+  CUDF_FAIL("libcudf was built without remote IO support (CUDF_ENABLE_REMOTE_IO)");
+#endif
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Whether the path refers to an object that is read with HTTP range requests.
+ *
+ * Recognizes `http://` and `https://` URLs, as well as `s3://bucket/key` and `gs://bucket/key`
+ * object paths.
+ *
+ * @param path The path passed to `datasource::create`
+ * @return true if the path is a remote object
+ */
+[[nodiscard]] bool is_remote_path(std::string const& path);
+
+/**
+ * @brief Creates a source that reads a remote object with parallel HTTP range requests.
+ *
+ * Each read is split into slices that are requested concurrently on a thread pool. Device reads
+ * are staged through pinned host buffers allocated from `cudf::io::get_host_memory_resource()`.
+ * The requests are not signed, so private objects need to be accessed through presigned URLs.
+ *
+ * @throws cudf::logic_error if libcudf was built without remote IO support
+ *
+ * @param path URL or object path of the remote object
+ * @return Constructed datasource object
+ */
+[[nodiscard]] std::unique_ptr<datasource> make_remote_source(std::string const& path);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Evaluates the filter on a table of min/max statistics
+ *
+ * @param stats_table Table where min(col[i]) = columns[i*2], max(col[i]) = columns[i*2+1]
+ * @param filter AST expression on the original columns
+ * @param num_columns Number of columns the filter may reference
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the predicate column
+ * @return For each row of the statistics table, whether its data may satisfy the filter. Rows
+ *         where the predicate evaluates to null are required.
+ */
+std::vector<bool> rows_required_by_stats(cudf::table_view const& stats_table,
+                                         ast::expression const& filter,
+                                         size_type num_columns,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr);
+
+}  // namespace cudf::io::detail
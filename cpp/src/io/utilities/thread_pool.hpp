@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -37,6 +37,12 @@
 namespace cudf {
 namespace detail {
 
+/**
+ * @brief Priority of a task in a `thread_pool`. Queued `HIGH` tasks are all executed before any
+ * queued `LOW` task.
+ */
+enum class task_priority : bool { HIGH, LOW };
+
 /**
  * @brief A C++17 thread pool class. The user submits tasks to be executed into a queue. Whenever a
  * thread becomes available, it pops a task from the queue and executes it. Each task is
@@ -82,7 +88,7 @@ class thread_pool {
   [[nodiscard]] size_t get_tasks_queued() const
   {
     std::scoped_lock const lock(queue_mutex);
-    return tasks.size();
+    return tasks.size() + low_priority_tasks.size();
   }
 
   /**
@@ -155,11 +161,25 @@ class thread_pool {
    */
   template <typename F>
   void push_task(F const& task)
+  {
+    push_task_with_priority(task_priority::HIGH, task);
+  }
+
+  /**
+   * @brief Push a function with no arguments or return value into the queue of the given priority.
+   *
+   * @tparam F The type of the function.
+   * @param priority The priority of the task.
+   * @param task The function to push.
+   */
+  template <typename F>
+  void push_task_with_priority(task_priority priority, F const& task)
   {
     tasks_total++;
     {
       std::scoped_lock const lock(queue_mutex);
-      tasks.push(std::function<void()>(task));
+      auto& queue = priority == task_priority::HIGH ? tasks : low_priority_tasks;
+      queue.push(std::function<void()>(task));
     }
   }
 
@@ -223,10 +243,31 @@ class thread_pool {
             typename... A,
             typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
   std::future<R> submit(F const& task, A const&... args)
+  {
+    return submit_with_priority(task_priority::HIGH, task, args...);
+  }
+
+  /**
+   * @brief Submit a function with zero or more arguments and a return value into the queue of the
+   * given priority, and get a future for its eventual returned value.
+   *
+   * @tparam F The type of the function.
+   * @tparam A The types of the zero or more arguments to pass to the function.
+   * @tparam R The return type of the function.
+   * @param priority The priority of the task.
+   * @param task The function to submit.
+   * @param args The zero or more arguments to pass to the function.
+   * @return A future to be used later to obtain the function's returned value, waiting for it to
+   * finish its execution if needed.
+   */
+  template <typename F,
+            typename... A,
+            typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
+  std::future<R> submit_with_priority(task_priority priority, F const& task, A const&... args)
   {
     std::shared_ptr<std::promise<R>> promise(new std::promise<R>);
     std::future<R> future = promise->get_future();
-    push_task([task, args..., promise] {
+    push_task_with_priority(priority, [task, args..., promise] {
       try {
         if constexpr (std::is_void_v<R>) {
           task(args...);
@@ -297,20 +338,21 @@ class thread_pool {
   }
 
   /**
-   * @brief Try to pop a new task out of the queue.
+   * @brief Try to pop a new task out of the queues, high priority tasks first.
    *
-   * @param task A reference to the task. Will be populated with a function if the queue is not
+   * @param task A reference to the task. Will be populated with a function if a queue is not
    * empty.
-   * @return true if a task was found, false if the queue is empty.
+   * @return true if a task was found, false if the queues are empty.
    */
   bool pop_task(std::function<void()>& task)
   {
     std::scoped_lock const lock(queue_mutex);
-    if (tasks.empty())
+    auto& queue = tasks.empty() ? low_priority_tasks : tasks;
+    if (queue.empty())
       return false;
     else {
-      task = std::move(tasks.front());
-      tasks.pop();
+      task = std::move(queue.front());
+      queue.pop();
       return true;
     }
   }
@@ -360,6 +402,11 @@ class thread_pool {
    */
   std::queue<std::function<void()>> tasks;
 
+  /**
+   * @brief A queue of tasks to be executed by the threads once `tasks` is empty.
+   */
+  std::queue<std::function<void()>> low_priority_tasks;
+
   /**
    * @brief The number of threads in the pool.
    */
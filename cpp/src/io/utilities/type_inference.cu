@@ -193,6 +193,15 @@ CUDF_KERNEL void infer_column_type_kernel(OptionsView options,
                  field_len, digit_count, decimal_count, dash_count + plus_count, exponent_count)) {
       ++thread_type_histogram.float_count;
     }
+    // Unquoted values with one or two '-' or '/' separators, up to two ':' and at most three other
+    // characters, e.g. 2020-01-01, are datetimes if requested. This does not cover all the
+    // date-time formats, only the common ones.
+    else if (options.infer_datetime and other_count <= 3 and decimal_count <= 1 and
+             colon_count <= 2 and
+             ((dash_count > 0 and dash_count <= 2 and slash_count == 0) or
+              (dash_count == 0 and slash_count > 0 and slash_count <= 2))) {
+      ++thread_type_histogram.datetime_count;
+    }
     // All invalid JSON values are treated as string
     else {
       ++thread_type_histogram.string_count;
@@ -273,7 +282,7 @@ cudf::data_type infer_data_type(
     } else if (cinfo.string_count > 0) {
       return type_id::STRING;
     } else if (cinfo.datetime_count > 0) {
-      CUDF_FAIL("Date time is inferred as string.\n");
+      return type_id::TIMESTAMP_MILLISECONDS;
     } else if (cinfo.float_count > 0) {
       return type_id::FLOAT64;
     } else if (cinfo.big_int_count == 0 && int_count_total != 0) {
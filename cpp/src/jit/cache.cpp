@@ -15,6 +15,7 @@
  */
 
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/jit_cache.hpp>
 
 #include <cuda.h>
 
@@ -22,6 +23,10 @@
 
 #include <cstddef>
 #include <filesystem>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
 
 namespace cudf {
 namespace jit {
@@ -111,9 +116,17 @@ std::size_t try_parse_numeric_env_var(char const* const env_name, std::size_t de
   return value != nullptr ? std::stoull(value) : default_val;
 }
 
+namespace {
+
+std::mutex caches_mutex{};
+
+// limits of the caches created next, set by `set_jit_cache_limits`
+std::optional<std::pair<std::size_t, std::size_t>> cache_limits{};
+
+}  // namespace
+
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
 {
-  static std::mutex caches_mutex{};
   static std::unordered_map<std::string, std::unique_ptr<jitify2::ProgramCache<>>> caches{};
 
   std::lock_guard<std::mutex> caches_lock(caches_mutex);
@@ -122,9 +135,13 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
 
   if (existing_cache == caches.end()) {
     auto const kernel_limit_proc =
-      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS", 10'000);
+      cache_limits.has_value()
+        ? cache_limits->first
+        : try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS", 10'000);
     auto const kernel_limit_disk =
-      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 100'000);
+      cache_limits.has_value()
+        ? cache_limits->second
+        : try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 100'000);
 
     // if kernel_limit_disk is zero, jitify will assign it the value of kernel_limit_proc.
     // to avoid this, we treat zero as "disable disk caching" by not providing the cache dir.
@@ -141,4 +158,14 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
 }
 
 }  // namespace jit
+
+void set_jit_cache_limits(std::size_t kernels_in_memory, std::size_t kernels_on_disk)
+{
+  CUDF_EXPECTS(kernels_in_memory > 0,
+               "The kernel cache must hold at least one kernel in memory",
+               std::invalid_argument);
+  std::lock_guard<std::mutex> caches_lock(jit::caches_mutex);
+  jit::cache_limits = std::pair{kernels_in_memory, kernels_on_disk};
+}
+
 }  // namespace cudf
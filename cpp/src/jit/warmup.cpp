@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rolling/detail/rolling.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/jit_cache.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <memory>
+#include <stdexcept>
+
+namespace cudf {
+namespace jit {
+namespace {
+
+/**
+ * @brief Makes a column of one zero element, on which an operation compiles its kernel
+ */
+std::unique_ptr<column> make_warmup_column(data_type type, rmm::cuda_stream_view stream)
+{
+  auto result = make_fixed_width_column(
+    type, 1, mask_state::UNALLOCATED, stream, rmm::mr::get_current_device_resource());
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(result->mutable_view().head(), 0, cudf::size_of(type), stream.value()));
+  return result;
+}
+
+void warmup_kernel(jit_kernel_spec const& spec, rmm::cuda_stream_view stream)
+{
+  auto const num_inputs = spec.operation == jit_operation::BINARY_OPERATION ? 2 : 1;
+  CUDF_EXPECTS(static_cast<int>(spec.input_types.size()) == num_inputs,
+               "Unexpected number of input types for the kernel",
+               std::invalid_argument);
+  auto const mr    = rmm::mr::get_current_device_resource();
+  auto const input = make_warmup_column(spec.input_types.front(), stream);
+
+  switch (spec.operation) {
+    case jit_operation::TRANSFORM:
+      cudf::detail::transform(input->view(), spec.udf, spec.output_type, spec.is_ptx, stream, mr);
+      break;
+    case jit_operation::BINARY_OPERATION: {
+      CUDF_EXPECTS(spec.is_ptx,
+                   "Binary operations only compile PTX functions",
+                   std::invalid_argument);
+      auto const rhs = make_warmup_column(spec.input_types.back(), stream);
+      cudf::detail::binary_operation(
+        input->view(), rhs->view(), spec.udf, spec.output_type, stream, mr);
+      break;
+    }
+    case jit_operation::ROLLING_WINDOW: {
+      auto const agg = make_udf_aggregation<rolling_aggregation>(
+        spec.is_ptx ? udf_type::PTX : udf_type::CUDA, spec.udf, spec.output_type);
+      cudf::detail::rolling_window(
+        input->view(), empty_like(input->view())->view(), 1, 0, 1, *agg, stream, mr);
+      break;
+    }
+    default: CUDF_FAIL("Unsupported JIT operation", std::invalid_argument);
+  }
+}
+
+}  // namespace
+}  // namespace jit
+
+void warmup_jit_cache(host_span<jit_kernel_spec const> manifest, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  for (auto const& spec : manifest) {
+    jit::warmup_kernel(spec, stream);
+  }
+  stream.synchronize();
+}
+
+}  // namespace cudf
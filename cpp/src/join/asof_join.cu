@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/join_common_utils.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Type of the distance between two `on` values: the duration of timestamps, the value type
+ * otherwise.
+ */
+template <typename T, typename = void>
+struct distance_type {
+  using type = T;
+};
+
+template <typename T>
+struct distance_type<T, std::enable_if_t<cudf::is_timestamp<T>()>> {
+  using type = typename T::duration;
+};
+
+template <typename T>
+using distance_type_t = typename distance_type<T>::type;
+
+template <typename T>
+constexpr bool is_asof_on_type()
+{
+  return (cudf::is_numeric<T>() and not cudf::is_boolean<T>()) or cudf::is_chrono<T>();
+}
+
+/**
+ * @brief Right row bounds of the search of each left row.
+ */
+struct asof_bounds {
+  size_type const* group_begin;  // first right row with the left keys, or nullptr without keys
+  size_type const* group_end;    // end of the right rows with the left keys
+  size_type const* backward;     // end of the right rows at or before the left `on` value
+  size_type const* forward;      // first right row at or after the left `on` value
+  size_type num_right_rows;
+};
+
+template <typename T>
+struct asof_match_fn {
+  column_device_view left_on;
+  column_device_view right_on;
+  asof_bounds bounds;
+  bitmask_type const* row_bitmask;  // rows with null keys that never match, or nullptr
+  asof_direction direction;
+  bool has_tolerance;
+  distance_type_t<T> tolerance;
+
+  __device__ bool is_within_tolerance(distance_type_t<T> distance) const
+  {
+    return not has_tolerance or not(tolerance < distance);
+  }
+
+  __device__ size_type operator()(size_type row) const
+  {
+    if (left_on.is_null(row) or (row_bitmask != nullptr and not bit_is_set(row_bitmask, row))) {
+      return JoinNoneValue;
+    }
+    auto const begin = bounds.group_begin == nullptr ? 0 : bounds.group_begin[row];
+    auto const end   = bounds.group_end == nullptr ? bounds.num_right_rows : bounds.group_end[row];
+    auto const value = left_on.element<T>(row);
+
+    auto backward = direction == asof_direction::FORWARD ? JoinNoneValue : bounds.backward[row] - 1;
+    auto backward_distance = distance_type_t<T>{};
+    if (backward != JoinNoneValue and backward >= begin and backward < end and
+        right_on.is_valid(backward)) {
+      backward_distance = static_cast<distance_type_t<T>>(value - right_on.element<T>(backward));
+      if (not is_within_tolerance(backward_distance)) { backward = JoinNoneValue; }
+    } else {
+      backward = JoinNoneValue;
+    }
+
+    auto forward = direction == asof_direction::BACKWARD ? JoinNoneValue : bounds.forward[row];
+    auto forward_distance = distance_type_t<T>{};
+    if (forward != JoinNoneValue and forward >= begin and forward < end and
+        right_on.is_valid(forward)) {
+      forward_distance = static_cast<distance_type_t<T>>(right_on.element<T>(forward) - value);
+      if (not is_within_tolerance(forward_distance)) { forward = JoinNoneValue; }
+    } else {
+      forward = JoinNoneValue;
+    }
+
+    if (backward == JoinNoneValue) { return forward; }
+    if (forward == JoinNoneValue) { return backward; }
+    return forward_distance < backward_distance ? forward : backward;
+  }
+};
+
+struct asof_match_dispatch {
+  template <typename T, CUDF_ENABLE_IF(is_asof_on_type<T>())>
+  void operator()(column_view const& left_on,
+                  column_view const& right_on,
+                  asof_bounds bounds,
+                  bitmask_type const* row_bitmask,
+                  asof_direction direction,
+                  std::optional<std::reference_wrapper<scalar const>> tolerance,
+                  rmm::device_uvector<size_type>& result,
+                  rmm::cuda_stream_view stream) const
+  {
+    using Distance       = distance_type_t<T>;
+    auto tolerance_value = Distance{};
+    if (tolerance.has_value()) {
+      auto const& tolerance_scalar = tolerance.value().get();
+      CUDF_EXPECTS(tolerance_scalar.type() == data_type{type_to_id<Distance>()},
+                   "Mismatch between the tolerance type and the on column type");
+      CUDF_EXPECTS(tolerance_scalar.is_valid(stream), "The tolerance must be valid");
+      tolerance_value =
+        static_cast<cudf::scalar_type_t<Distance> const&>(tolerance_scalar).value(stream);
+      CUDF_EXPECTS(not(tolerance_value < Distance{}), "The tolerance must not be negative");
+    }
+
+    auto const d_left_on  = column_device_view::create(left_on, stream);
+    auto const d_right_on = column_device_view::create(right_on, stream);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(left_on.size()),
+                      result.begin(),
+                      asof_match_fn<T>{*d_left_on,
+                                       *d_right_on,
+                                       bounds,
+                                       row_bitmask,
+                                       direction,
+                                       tolerance.has_value(),
+                                       tolerance_value});
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_asof_on_type<T>(), void> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported type of the as-of join on columns");
+  }
+};
+
+table_view append_column(table_view const& keys, column_view const& column)
+{
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  columns.push_back(column);
+  return table_view{columns};
+}
+
+}  // namespace
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  table_view const& left_keys_input,
+  table_view const& right_keys_input,
+  column_view const& left_on,
+  column_view const& right_on,
+  asof_direction direction,
+  std::optional<std::reference_wrapper<scalar const>> tolerance,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_keys_input.num_columns() == right_keys_input.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(left_keys_input.num_columns() == 0 or left_keys_input.num_rows() == left_on.size(),
+               "Mismatch in number of rows of the left keys and on column");
+  CUDF_EXPECTS(
+    right_keys_input.num_columns() == 0 or right_keys_input.num_rows() == right_on.size(),
+    "Mismatch in number of rows of the right keys and on column");
+  CUDF_EXPECTS(left_on.type() == right_on.type(), "Mismatch in types of the on columns");
+
+  auto result = std::make_unique<rmm::device_uvector<size_type>>(left_on.size(), stream, mr);
+  if (left_on.is_empty()) { return result; }
+
+  // Make sure any dictionary columns have matched key sets.
+  // This will return any new dictionary columns created as well as updated table_views.
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto matched       = cudf::dictionary::detail::match_dictionaries(
+    {left_keys_input, right_keys_input}, stream, temp_mr);  // temporary objects returned
+  auto const left_keys  = matched.second.front();
+  auto const right_keys = matched.second.back();
+  auto const has_keys   = left_keys.num_columns() > 0;
+
+  // The right rows with the left keys, then with an `on` value at or before and after the left one
+  std::unique_ptr<column> group_begin, group_end;
+  if (has_keys) {
+    group_begin = cudf::detail::lower_bound(right_keys, left_keys, {}, {}, stream, temp_mr);
+    group_end   = cudf::detail::upper_bound(right_keys, left_keys, {}, {}, stream, temp_mr);
+  }
+  auto const right = append_column(right_keys, right_on);
+  auto const left  = append_column(left_keys, left_on);
+  std::unique_ptr<column> backward, forward;
+  if (direction != asof_direction::FORWARD) {
+    backward = cudf::detail::upper_bound(right, left, {}, {}, stream, temp_mr);
+  }
+  if (direction != asof_direction::BACKWARD) {
+    forward = cudf::detail::lower_bound(right, left, {}, {}, stream, temp_mr);
+  }
+  auto const data_or_null = [](std::unique_ptr<column> const& col) {
+    return col == nullptr ? nullptr : col->view().data<size_type>();
+  };
+  auto const bounds = asof_bounds{data_or_null(group_begin),
+                                  data_or_null(group_end),
+                                  data_or_null(backward),
+                                  data_or_null(forward),
+                                  right_on.size()};
+
+  auto const row_bitmask = compare_nulls == null_equality::EQUAL or not has_keys
+                             ? rmm::device_buffer{0, stream}
+                             : cudf::detail::bitmask_and(left_keys, stream, temp_mr).first;
+  cudf::type_dispatcher(left_on.type(),
+                        asof_match_dispatch{},
+                        left_on,
+                        right_on,
+                        bounds,
+                        static_cast<bitmask_type const*>(row_bitmask.data()),
+                        direction,
+                        tolerance,
+                        *result,
+                        stream);
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  column_view const& left_on,
+  column_view const& right_on,
+  asof_direction direction,
+  std::optional<std::reference_wrapper<scalar const>> tolerance,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::asof_join(left_keys,
+                           right_keys,
+                           left_on,
+                           right_on,
+                           direction,
+                           tolerance,
+                           compare_nulls,
+                           cudf::get_default_stream(),
+                           mr);
+}
+
+}  // namespace cudf
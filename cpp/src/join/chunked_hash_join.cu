@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace cudf {
+
+chunked_inner_join::chunked_inner_join(hash_join const& hash_join,
+                                       cudf::table_view const& probe,
+                                       std::size_t max_output_rows,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+  : _hash_join{hash_join},
+    _probe{probe},
+    _max_output_rows{max_output_rows},
+    _chunk_rows{probe.num_rows()},
+    _stream{stream},
+    _mr{mr}
+{
+  CUDF_EXPECTS(max_output_rows > 0, "The output row budget must be positive");
+}
+
+bool chunked_inner_join::has_next() const { return _next_row < _probe.num_rows(); }
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+chunked_inner_join::next()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "All the probe rows are already joined");
+
+  auto const slice_rows = [&](size_type num_rows) {
+    return cudf::slice(_probe, {_next_row, _next_row + num_rows}).front();
+  };
+
+  // Halve the probe rows of the chunk until their matches fit in the budget
+  auto num_rows    = std::min(_chunk_rows, _probe.num_rows() - _next_row);
+  auto output_size = _hash_join.inner_join_size(slice_rows(num_rows), _stream);
+  while (output_size > _max_output_rows and num_rows > 1) {
+    num_rows /= 2;
+    output_size = _hash_join.inner_join_size(slice_rows(num_rows), _stream);
+  }
+  CUDF_EXPECTS(output_size <= _max_output_rows,
+               "A probe row has more matches than the output row budget",
+               std::overflow_error);
+
+  auto join_indices = _hash_join.inner_join(slice_rows(num_rows), output_size, _stream, _mr);
+  if (_next_row > 0) {
+    auto& left_indices = *join_indices.first;
+    thrust::transform(rmm::exec_policy_nosync(_stream),
+                      left_indices.begin(),
+                      left_indices.end(),
+                      thrust::make_constant_iterator(_next_row),
+                      left_indices.begin(),
+                      thrust::plus<size_type>{});
+  }
+  _next_row += num_rows;
+
+  // Try more probe rows next time if the chunk used less than half of the budget
+  auto const doubled_rows = std::min(int64_t{num_rows} * 2, int64_t{_probe.num_rows()});
+  _chunk_rows =
+    output_size <= _max_output_rows / 2 ? static_cast<size_type>(doubled_rows) : num_rows;
+  return join_indices;
+}
+
+}  // namespace cudf
@@ -16,12 +16,15 @@
 
 #include "join/conditional_join.hpp"
 #include "join/conditional_join_kernels.cuh"
+#include "join/interval_join.hpp"
 #include "join/join_common_utils.cuh"
 #include "join/join_common_utils.hpp"
 
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
@@ -30,11 +33,59 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <optional>
+#include <stdexcept>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+// Fewest inner rows of a tile of the nested loop of a conditional inner join
+constexpr thread_index_type min_inner_tile_rows = 1024;
+
+// Resident blocks per multiprocessor the tiles of a conditional inner join aim to fill
+constexpr int target_blocks_per_sm = 4;
+
+/**
+ * @brief Returns the grid of the nested loop kernels of a conditional join.
+ *
+ * The x dimension covers the outer rows. Inner joins with too few outer rows to fill the device
+ * also split their inner rows into tiles along the y dimension, so that each thread evaluates the
+ * predicate on a tile of the inner rows instead of all of them.
+ *
+ * @param join_type The type of join evaluated by the kernels
+ * @param outer_num_blocks Number of blocks covering the outer rows
+ * @param inner_num_rows Number of inner rows
+ * @return The grid of the kernels
+ */
+dim3 conditional_join_grid(join_kind join_type,
+                           int outer_num_blocks,
+                           thread_index_type inner_num_rows)
+{
+  if (join_type != join_kind::INNER_JOIN) { return dim3(outer_num_blocks); }
+
+  int device = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  int num_sms = 0;
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+  auto const max_tiles = std::min<thread_index_type>(
+    std::numeric_limits<uint16_t>::max(),
+    util::div_rounding_up_safe(inner_num_rows, min_inner_tile_rows));
+  auto const num_tiles = std::clamp<thread_index_type>(
+    num_sms * target_blocks_per_sm / outer_num_blocks, 1, max_tiles);
+  return dim3(outer_num_blocks, static_cast<unsigned int>(num_tiles));
+}
+
+}  // namespace
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -85,6 +136,14 @@ conditional_join(table_view const& left,
     }
   }
 
+  // Inner joins on a range predicate of a single column are evaluated by
+  // binary searches of the sorted points instead of the nested loop.
+  if (join_type == join_kind::INNER_JOIN) {
+    if (auto const interval = find_interval_predicate(binary_predicate, left, right)) {
+      return interval_inner_join(left, right, *interval, stream, mr);
+    }
+  }
+
   // If evaluating the expression may produce null outputs we create a nullable
   // output column and follow the null-supporting expression evaluation code
   // path.
@@ -107,6 +166,10 @@ conditional_join(table_view const& left,
   join_kind const kernel_join_type =
     join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
 
+  // Inner joins with few outer rows also split the inner rows among the blocks
+  auto const grid = conditional_join_grid(
+    kernel_join_type, config.num_blocks, swap_tables ? left_num_rows : right_num_rows);
+
   // If the join size was not provided as an input, compute it here.
   std::size_t join_size;
   if (output_size.has_value()) {
@@ -116,7 +179,7 @@ conditional_join(table_view const& left,
     rmm::device_scalar<std::size_t> size(0, stream, mr);
     if (has_nulls) {
       compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        <<<grid, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
           *left_table,
           *right_table,
           kernel_join_type,
@@ -125,7 +188,7 @@ conditional_join(table_view const& left,
           size.data());
     } else {
       compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        <<<grid, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
           *left_table,
           *right_table,
           kernel_join_type,
@@ -156,7 +219,7 @@ conditional_join(table_view const& left,
   auto const& join_output_r = right_indices->data();
   if (has_nulls) {
     conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+      <<<grid, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
         *left_table,
         *right_table,
         kernel_join_type,
@@ -168,7 +231,7 @@ conditional_join(table_view const& left,
         swap_tables);
   } else {
     conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+      <<<grid, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
         *left_table,
         *right_table,
         kernel_join_type,
@@ -236,6 +299,12 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
     }
   }
 
+  if (join_type == join_kind::INNER_JOIN) {
+    if (auto const interval = find_interval_predicate(binary_predicate, left, right)) {
+      return interval_inner_join_size(left, right, *interval, stream);
+    }
+  }
+
   // Prepare output column. Whether or not the output column is nullable is
   // determined by whether any of the columns in the input table are nullable.
   // If none of the input columns actually contain nulls, we can still use the
@@ -258,6 +327,10 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
                                DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
 
+  // Inner joins with few outer rows also split the inner rows among the blocks
+  auto const grid = conditional_join_grid(
+    join_type, config.num_blocks, swap_tables ? left_num_rows : right_num_rows);
+
   // Allocate storage for the counter used to get the size of the join output
   rmm::device_scalar<std::size_t> size(0, stream, mr);
 
@@ -265,7 +338,7 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
   // find what the size of the output will be.
   if (has_nulls) {
     compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+      <<<grid, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
         *left_table,
         *right_table,
         join_type,
@@ -274,7 +347,7 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
         size.data());
   } else {
     compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+      <<<grid, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
         *left_table,
         *right_table,
         join_type,
@@ -424,4 +497,82 @@ std::size_t conditional_left_anti_join_size(table_view const& left,
                                                                 mr));
 }
 
+chunked_conditional_inner_join::chunked_conditional_inner_join(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  std::size_t max_output_rows,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+  : _left{left},
+    _right{right},
+    _binary_predicate{binary_predicate},
+    _max_output_rows{max_output_rows},
+    _chunk_rows{left.num_rows()},
+    _stream{stream},
+    _mr{mr}
+{
+  CUDF_EXPECTS(max_output_rows > 0, "The output row budget must be positive");
+}
+
+bool chunked_conditional_inner_join::has_next() const { return _next_row < _left.num_rows(); }
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+chunked_conditional_inner_join::next()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "All the left rows are already joined");
+
+  auto const temp_mr    = rmm::mr::get_current_device_resource();
+  auto const slice_rows = [&](size_type num_rows) {
+    return cudf::slice(_left, {_next_row, _next_row + num_rows}).front();
+  };
+
+  // Number of matches of the next `num_rows` left rows
+  auto const join_size = [&](size_type num_rows) {
+    return detail::compute_conditional_join_output_size(slice_rows(num_rows),
+                                                        _right,
+                                                        _binary_predicate,
+                                                        detail::join_kind::INNER_JOIN,
+                                                        _stream,
+                                                        temp_mr);
+  };
+
+  // Halve the left rows of the chunk until their matches fit in the budget
+  auto num_rows    = std::min(_chunk_rows, _left.num_rows() - _next_row);
+  auto output_size = join_size(num_rows);
+  while (output_size > _max_output_rows and num_rows > 1) {
+    num_rows /= 2;
+    output_size = join_size(num_rows);
+  }
+  CUDF_EXPECTS(output_size <= _max_output_rows,
+               "A left row has more matches than the output row budget",
+               std::overflow_error);
+
+  auto join_indices = detail::conditional_join(slice_rows(num_rows),
+                                               _right,
+                                               _binary_predicate,
+                                               detail::join_kind::INNER_JOIN,
+                                               output_size,
+                                               _stream,
+                                               _mr);
+  if (_next_row > 0) {
+    auto& left_indices = *join_indices.first;
+    thrust::transform(rmm::exec_policy_nosync(_stream),
+                      left_indices.begin(),
+                      left_indices.end(),
+                      thrust::make_constant_iterator(_next_row),
+                      left_indices.begin(),
+                      thrust::plus<size_type>{});
+  }
+  _next_row += num_rows;
+
+  // Try more left rows next time if the chunk used less than half of the budget
+  auto const doubled_rows = std::min(int64_t{num_rows} * 2, int64_t{_left.num_rows()});
+  _chunk_rows =
+    output_size <= _max_output_rows / 2 ? static_cast<size_type>(doubled_rows) : num_rows;
+  return join_indices;
+}
+
 }  // namespace cudf
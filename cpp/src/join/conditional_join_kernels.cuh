@@ -33,7 +33,9 @@ namespace detail {
  * @brief Computes the output size of joining the left table to the right table.
  *
  * This method uses a nested loop to iterate over the left and right tables and count the number of
- * matches according to a boolean expression.
+ * matches according to a boolean expression. The inner rows are split into `gridDim.y` tiles, one
+ * per row of blocks, which is only valid for inner joins: the other joins need to see all the
+ * inner rows of an outer row in one thread.
  *
  * @tparam block_size The number of threads per block for this kernel
  * @tparam has_nulls Whether or not the inputs may contain nulls.
@@ -74,6 +76,8 @@ CUDF_KERNEL void compute_conditional_join_output_size(
   cudf::thread_index_type const right_num_rows = right_table.num_rows();
   auto const outer_num_rows                    = (swap_tables ? right_num_rows : left_num_rows);
   auto const inner_num_rows                    = (swap_tables ? left_num_rows : right_num_rows);
+  auto const inner_begin                       = inner_num_rows * blockIdx.y / gridDim.y;
+  auto const inner_end                         = inner_num_rows * (blockIdx.y + 1) / gridDim.y;
 
   auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
     left_table, right_table, device_expression_data);
@@ -81,7 +85,7 @@ CUDF_KERNEL void compute_conditional_join_output_size(
   for (cudf::thread_index_type outer_row_index = start_idx; outer_row_index < outer_num_rows;
        outer_row_index += stride) {
     bool found_match = false;
-    for (cudf::thread_index_type inner_row_index = 0; inner_row_index < inner_num_rows;
+    for (cudf::thread_index_type inner_row_index = inner_begin; inner_row_index < inner_end;
          ++inner_row_index) {
       auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
       cudf::size_type const left_row_index  = swap_tables ? inner_row_index : outer_row_index;
@@ -119,6 +123,9 @@ CUDF_KERNEL void compute_conditional_join_output_size(
  * between the left and right tables and generate the output for the desired
  * Join operation.
  *
+ * As in `compute_conditional_join_output_size`, the inner rows are split into `gridDim.y` tiles,
+ * which must be 1 for all joins but inner joins.
+ *
  * @tparam block_size The number of threads per block for this kernel
  * @tparam output_cache_size The side of the shared memory buffer to cache join
  * output results
@@ -169,6 +176,8 @@ CUDF_KERNEL void conditional_join(table_device_view left_table,
   cudf::thread_index_type const right_num_rows = right_table.num_rows();
   cudf::thread_index_type const outer_num_rows = (swap_tables ? right_num_rows : left_num_rows);
   cudf::thread_index_type const inner_num_rows = (swap_tables ? left_num_rows : right_num_rows);
+  auto const inner_begin                       = inner_num_rows * blockIdx.y / gridDim.y;
+  auto const inner_end                         = inner_num_rows * (blockIdx.y + 1) / gridDim.y;
 
   if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
 
@@ -183,7 +192,7 @@ CUDF_KERNEL void conditional_join(table_device_view left_table,
 
   if (outer_row_index < outer_num_rows) {
     bool found_match = false;
-    for (thread_index_type inner_row_index(0); inner_row_index < inner_num_rows;
+    for (thread_index_type inner_row_index(inner_begin); inner_row_index < inner_end;
          ++inner_row_index) {
       auto output_dest           = cudf::ast::detail::value_expression_result<bool, has_nulls>();
       auto const left_row_index  = swap_tables ? inner_row_index : outer_row_index;
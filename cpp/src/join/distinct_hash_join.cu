@@ -19,7 +19,11 @@
 #include <cudf/detail/cuco_helpers.hpp>
 #include <cudf/detail/distinct_hash_join.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/algorithm.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/hashing/detail/hash_functions.cuh>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/hashing/detail/xxhash_64.cuh>
 #include <cudf/join.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
@@ -28,11 +32,15 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
 #include <cooperative_groups.h>
 #include <cub/block/block_scan.cuh>
 #include <cuco/static_set.cuh>
+#include <thrust/copy.h>
 #include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/sequence.h>
 
@@ -60,6 +68,148 @@ auto prepare_device_equal(
     nullate::DYNAMIC{has_nulls}, compare_nulls)};
 }
 
+/**
+ * @brief Computes the 64-bit hash value of a row in the given table.
+ *
+ * Same as `cudf::experimental::row::hash::device_row_hasher`, except that the element hashes and
+ * their combination are 64-bit wide. Floating-point zeros are normalized along with NaNs, since the
+ * row comparators treat `-0.0` and `0.0` as equal.
+ *
+ * @tparam hash_function Hash functor with 64-bit results, used for hashing elements
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls
+ */
+template <template <typename> class hash_function, typename Nullate>
+class device_row_hasher_64 {
+  friend class cudf::experimental::row::hash::row_hasher;  ///< Allow row_hasher to access private
+                                                           ///< members.
+
+ public:
+  /**
+   * @brief Return the hash value of a row in the given table.
+   *
+   * @param row_index The row index to compute the hash value of
+   * @return The hash value of the row
+   */
+  __device__ distinct_hash_value_type operator()(size_type row_index) const noexcept
+  {
+    auto it = thrust::make_transform_iterator(_table.begin(), [=](auto const& column) {
+      return cudf::type_dispatcher<cudf::dispatch_storage_type>(
+        column.type(), element_hasher_adapter{_check_nulls, _seed}, column, row_index);
+    });
+
+    // Hash each element and combine all the hash values together
+    return cudf::detail::accumulate(
+      it, it + _table.num_columns(), distinct_hash_value_type{_seed}, [](auto hash, auto h) {
+        return cudf::hashing::detail::hash_combine(hash, h);
+      });
+  }
+
+ private:
+  /**
+   * @brief Computes the hash value of an element in the given column.
+   *
+   * Nested columns are hashed by their shape and values, as in `device_row_hasher`.
+   */
+  class element_hasher_adapter {
+    static constexpr distinct_hash_value_type NULL_HASH =
+      std::numeric_limits<distinct_hash_value_type>::max();
+    static constexpr distinct_hash_value_type NON_NULL_HASH = 0;
+
+   public:
+    __device__ element_hasher_adapter(Nullate check_nulls, uint32_t seed) noexcept
+      : _check_nulls(check_nulls), _seed(seed)
+    {
+    }
+
+    template <typename T,
+              CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>() and
+                             not cudf::is_nested<T>())>
+    __device__ distinct_hash_value_type operator()(column_device_view const& col,
+                                                   size_type row_index) const noexcept
+    {
+      if (_check_nulls && col.is_null(row_index)) { return NULL_HASH; }
+      return hash_function<T>{_seed}(
+        cudf::hashing::detail::normalize_nans_and_zeros(col.element<T>(row_index)));
+    }
+
+    template <typename T,
+              CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() and
+                             not cudf::is_nested<T>())>
+    __device__ distinct_hash_value_type operator()(column_device_view const&,
+                                                   size_type) const noexcept
+    {
+      CUDF_UNREACHABLE("Unsupported type in hash.");
+    }
+
+    template <typename T, CUDF_ENABLE_IF(cudf::is_nested<T>())>
+    __device__ distinct_hash_value_type operator()(column_device_view const& col,
+                                                   size_type row_index) const noexcept
+    {
+      auto hash                   = distinct_hash_value_type{0};
+      column_device_view curr_col = col.slice(row_index, 1);
+      while (curr_col.type().id() == type_id::STRUCT || curr_col.type().id() == type_id::LIST) {
+        if (_check_nulls) {
+          auto validity_it = cudf::detail::make_validity_iterator<true>(curr_col);
+          hash             = cudf::detail::accumulate(
+            validity_it, validity_it + curr_col.size(), hash, [](auto hash, auto is_valid) {
+              return cudf::hashing::detail::hash_combine(hash,
+                                                         is_valid ? NON_NULL_HASH : NULL_HASH);
+            });
+        }
+        if (curr_col.type().id() == type_id::STRUCT) {
+          if (curr_col.num_child_columns() == 0) { return hash; }
+          // Non-empty structs are assumed to be decomposed and contain only one child
+          curr_col = cudf::detail::structs_column_device_view(curr_col).get_sliced_child(0);
+        } else if (curr_col.type().id() == type_id::LIST) {
+          auto list_col   = cudf::detail::lists_column_device_view(curr_col);
+          auto list_sizes = make_list_size_iterator(list_col);
+          hash            = cudf::detail::accumulate(
+            list_sizes, list_sizes + list_col.size(), hash, [](auto hash, auto size) {
+              return cudf::hashing::detail::hash_combine(hash, hash_function<size_type>{}(size));
+            });
+          curr_col = list_col.get_sliced_child();
+        }
+      }
+      for (int i = 0; i < curr_col.size(); ++i) {
+        hash = cudf::hashing::detail::hash_combine(
+          hash,
+          type_dispatcher<cudf::experimental::dispatch_void_if_nested>(
+            curr_col.type(), *this, curr_col, i));
+      }
+      return hash;
+    }
+
+    Nullate const _check_nulls;
+    uint32_t const _seed;
+  };
+
+  CUDF_HOST_DEVICE device_row_hasher_64(Nullate check_nulls,
+                                        table_device_view t,
+                                        uint32_t seed = DEFAULT_HASH_SEED) noexcept
+    : _check_nulls{check_nulls}, _table{t}, _seed(seed)
+  {
+  }
+
+  Nullate const _check_nulls;
+  table_device_view const _table;
+  uint32_t const _seed;
+};
+
+/**
+ * @brief Returns the device functor computing the 64-bit hash value of each row of a table.
+ *
+ * @param table The table preprocessed for row operators
+ * @param has_nulls Flag indicating whether the table may have nulls
+ * @return The row hasher
+ */
+auto make_device_row_hasher(
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> table, bool has_nulls)
+{
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher{std::move(table)};
+  return row_hasher.device_hasher<cudf::hashing::detail::XXHash_64, device_row_hasher_64>(
+    nullate::DYNAMIC{has_nulls});
+}
+
 /**
  * @brief Device functor to create a pair of {hash_value, row_index} for a given row.
  *
@@ -80,12 +230,12 @@ class build_keys_fn {
 };
 
 /**
- * @brief Device output transform functor to construct `size_type` with `cuco::pair<hash_value_type,
- * lhs_index_type>`
+ * @brief Device output transform functor to construct `size_type` with
+ * `cuco::pair<distinct_hash_value_type, lhs_index_type>`
  */
 struct output_fn {
   __device__ constexpr cudf::size_type operator()(
-    cuco::pair<hash_value_type, lhs_index_type> const& x) const
+    cuco::pair<distinct_hash_value_type, lhs_index_type> const& x) const
   {
     return static_cast<cudf::size_type>(x.second);
   }
@@ -268,7 +418,7 @@ distinct_hash_join<HasNested>::distinct_hash_join(cudf::table_view const& build,
       cudf::experimental::row::equality::preprocessed_table::create(_probe, stream)},
     _hash_table{build.num_rows(),
                 CUCO_DESIRED_LOAD_FACTOR,
-                cuco::empty_key{cuco::pair{std::numeric_limits<hash_value_type>::max(),
+                cuco::empty_key{cuco::pair{std::numeric_limits<distinct_hash_value_type>::max(),
                                            lhs_index_type{JoinNoneValue}}},
                 prepare_device_equal<HasNested>(
                   _preprocessed_build, _preprocessed_probe, has_nulls, compare_nulls),
@@ -283,8 +433,7 @@ distinct_hash_join<HasNested>::distinct_hash_join(cudf::table_view const& build,
 
   if (this->_build.num_rows() == 0) { return; }
 
-  auto const row_hasher = experimental::row::hash::row_hasher{this->_preprocessed_build};
-  auto const d_hasher   = row_hasher.device_hasher(nullate::DYNAMIC{this->_has_nulls});
+  auto const d_hasher = make_device_row_hasher(this->_preprocessed_build, this->_has_nulls);
 
   auto const iter = cudf::detail::make_counting_transform_iterator(
     0, build_keys_fn<decltype(d_hasher), lhs_index_type>{d_hasher});
@@ -326,9 +475,7 @@ distinct_hash_join<HasNested>::inner_join(rmm::cuda_stream_view stream,
   auto probe_indices =
     std::make_unique<rmm::device_uvector<size_type>>(probe_table_num_rows, stream, mr);
 
-  auto const probe_row_hasher =
-    cudf::experimental::row::hash::row_hasher{this->_preprocessed_probe};
-  auto const d_probe_hasher = probe_row_hasher.device_hasher(nullate::DYNAMIC{this->_has_nulls});
+  auto const d_probe_hasher = make_device_row_hasher(this->_preprocessed_probe, this->_has_nulls);
   auto const iter           = cudf::detail::make_counting_transform_iterator(
     0, build_keys_fn<decltype(d_probe_hasher), rhs_index_type>{d_probe_hasher});
   auto counter = rmm::device_scalar<cudf::size_type>{stream};
@@ -371,9 +518,8 @@ std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<HasNested>::l
     thrust::fill(
       rmm::exec_policy_nosync(stream), build_indices->begin(), build_indices->end(), JoinNoneValue);
   } else {
-    auto const probe_row_hasher =
-      cudf::experimental::row::hash::row_hasher{this->_preprocessed_probe};
-    auto const d_probe_hasher = probe_row_hasher.device_hasher(nullate::DYNAMIC{this->_has_nulls});
+    auto const d_probe_hasher =
+      make_device_row_hasher(this->_preprocessed_probe, this->_has_nulls);
     auto const iter           = cudf::detail::make_counting_transform_iterator(
       0, build_keys_fn<decltype(d_probe_hasher), rhs_index_type>{d_probe_hasher});
 
@@ -385,6 +531,66 @@ std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<HasNested>::l
 
   return build_indices;
 }
+
+template <cudf::has_nested HasNested>
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+distinct_hash_join<HasNested>::left_join_indices(rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr) const
+{
+  cudf::scoped_range range{"distinct_hash_join::left_join_indices"};
+
+  auto build_indices = this->left_join(stream, mr);
+  auto probe_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(build_indices->size(), stream, mr);
+  thrust::sequence(rmm::exec_policy_nosync(stream), probe_indices->begin(), probe_indices->end());
+
+  return {std::move(build_indices), std::move(probe_indices)};
+}
+
+template <cudf::has_nested HasNested>
+std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<HasNested>::semi_anti_join(
+  join_kind kind, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_EXPECTS(kind == join_kind::LEFT_SEMI_JOIN or kind == join_kind::LEFT_ANTI_JOIN,
+               "Unsupported join type");
+
+  size_type const probe_table_num_rows{this->_probe.num_rows()};
+  auto const is_anti = kind == join_kind::LEFT_ANTI_JOIN;
+
+  // If the build table is empty, no probe row has a match
+  if (probe_table_num_rows == 0 or (this->_build.num_rows() == 0 and not is_anti)) {
+    return std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr);
+  }
+  if (this->_build.num_rows() == 0) {
+    auto probe_indices =
+      std::make_unique<rmm::device_uvector<size_type>>(probe_table_num_rows, stream, mr);
+    thrust::sequence(rmm::exec_policy_nosync(stream), probe_indices->begin(), probe_indices->end());
+    return probe_indices;
+  }
+
+  auto const d_probe_hasher = make_device_row_hasher(this->_preprocessed_probe, this->_has_nulls);
+  auto const iter           = cudf::detail::make_counting_transform_iterator(
+    0, build_keys_fn<decltype(d_probe_hasher), rhs_index_type>{d_probe_hasher});
+
+  // The keys of the build table are distinct, so a probe row matches at most one build row and
+  // membership in the hash table is enough for both joins
+  rmm::device_uvector<bool> has_match(probe_table_num_rows, stream);
+  this->_hash_table.contains_async(
+    iter, iter + probe_table_num_rows, has_match.begin(), stream.value());
+
+  auto probe_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(probe_table_num_rows, stream, mr);
+  auto const probe_indices_end =
+    thrust::copy_if(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>{0},
+                    thrust::counting_iterator<size_type>{probe_table_num_rows},
+                    has_match.begin(),
+                    probe_indices->begin(),
+                    [is_anti] __device__(bool matched) { return matched != is_anti; });
+  probe_indices->resize(thrust::distance(probe_indices->begin(), probe_indices_end), stream);
+  return probe_indices;
+}
 }  // namespace detail
 
 template <>
@@ -447,4 +653,54 @@ std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<cudf::has_nes
 {
   return _impl->left_join(stream, mr);
 }
+
+template <>
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+distinct_hash_join<cudf::has_nested::YES>::left_join_indices(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  return _impl->left_join_indices(stream, mr);
+}
+
+template <>
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+distinct_hash_join<cudf::has_nested::NO>::left_join_indices(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  return _impl->left_join_indices(stream, mr);
+}
+
+template <>
+std::unique_ptr<rmm::device_uvector<size_type>>
+distinct_hash_join<cudf::has_nested::YES>::left_semi_join(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  return _impl->semi_anti_join(detail::join_kind::LEFT_SEMI_JOIN, stream, mr);
+}
+
+template <>
+std::unique_ptr<rmm::device_uvector<size_type>>
+distinct_hash_join<cudf::has_nested::NO>::left_semi_join(rmm::cuda_stream_view stream,
+                                                         rmm::mr::device_memory_resource* mr) const
+{
+  return _impl->semi_anti_join(detail::join_kind::LEFT_SEMI_JOIN, stream, mr);
+}
+
+template <>
+std::unique_ptr<rmm::device_uvector<size_type>>
+distinct_hash_join<cudf::has_nested::YES>::left_anti_join(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  return _impl->semi_anti_join(detail::join_kind::LEFT_ANTI_JOIN, stream, mr);
+}
+
+template <>
+std::unique_ptr<rmm::device_uvector<size_type>>
+distinct_hash_join<cudf::has_nested::NO>::left_anti_join(rmm::cuda_stream_view stream,
+                                                         rmm::mr::device_memory_resource* mr) const
+{
+  return _impl->semi_anti_join(detail::join_kind::LEFT_ANTI_JOIN, stream, mr);
+}
 }  // namespace cudf
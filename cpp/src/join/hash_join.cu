@@ -16,33 +16,514 @@
 #include "join_common_utils.cuh"
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/join.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/hashing/detail/default_hash.cuh>
+#include <cudf/hashing/detail/fixed_width_row_hasher.cuh>
 #include <cudf/hashing/detail/helper_functions.cuh>
 #include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/functional.h>
+#include <thrust/gather.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 #include <thrust/uninitialized_fill.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <numeric>
+#include <tuple>
+#include <vector>
 
 namespace cudf {
 namespace detail {
 namespace {
+
+// Build keys with at least this many rows are heavy hitters, joined apart from the hash table
+constexpr size_type heavy_hitter_min_rows = 1024;
+// Number of build rows sampled to find the heavy-hitter candidates
+constexpr size_type heavy_hitter_sample_size = 64 * 1024;
+
+/**
+ * @brief The build rows of the heavy hitters, grouped by row hash.
+ */
+struct heavy_hitter_table {
+  device_span<hash_value_type const> hashes;  ///< sorted row hashes of the heavy hitters
+  device_span<size_type const> offsets;       ///< offsets of the rows of each hash in `rows`
+  device_span<size_type const> rows;          ///< build rows of the heavy hitters
+
+  [[nodiscard]] bool is_empty() const { return hashes.empty(); }
+};
+
+/**
+ * @brief Device functor returning the index of a row hash in the heavy hitters, or -1.
+ */
+struct heavy_group_fn {
+  hash_value_type const* hashes;
+  size_type num_hashes;
+
+  __device__ size_type operator()(hash_value_type hash) const
+  {
+    auto const it = thrust::lower_bound(thrust::seq, hashes, hashes + num_hashes, hash);
+    return (it != hashes + num_hashes and *it == hash) ? static_cast<size_type>(it - hashes) : -1;
+  }
+};
+
+/**
+ * @brief Device functor to create a pair of {hash_value, row_index} for the i-th row of a subset
+ * of the probe rows, or of all of them if the subset is null.
+ */
+template <typename Hasher>
+struct make_probe_pair_function {
+  Hasher hash;
+  hash_value_type empty_key_sentinel;
+  size_type const* rows;
+
+  __device__ __forceinline__ auto operator()(size_type i) const noexcept
+  {
+    auto const row = rows == nullptr ? i : rows[i];
+    return cuco::make_pair(remap_sentinel_hash(hash(row), empty_key_sentinel), row);
+  }
+};
+
+/**
+ * @brief Device functor returning the heavy-hitter group of a probe row, or -1.
+ */
+template <typename Hasher>
+struct probe_group_fn {
+  Hasher hash;
+  hash_value_type empty_key_sentinel;
+  heavy_group_fn group;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    return group(remap_sentinel_hash(hash(row), empty_key_sentinel));
+  }
+};
+
+/**
+ * @brief The probe rows split into the rows probed in the hash table and the rows matched with
+ * the heavy hitters.
+ */
+struct probe_partition {
+  size_type num_light_rows;
+  rmm::device_uvector<size_type> light_rows;    ///< probed rows; empty if they are all the rows
+  rmm::device_uvector<size_type> heavy_rows;    ///< rows with a heavy-hitter hash
+  rmm::device_uvector<size_type> heavy_groups;  ///< heavy-hitter group of each heavy row
+  rmm::device_uvector<int64_t> candidate_offsets;  ///< offsets of the candidates of each heavy row
+  int64_t num_candidates;                          ///< number of (probe, build) candidate pairs
+
+  [[nodiscard]] size_type const* light_rows_data() const
+  {
+    return heavy_rows.is_empty() ? nullptr : light_rows.data();
+  }
+};
+
+template <typename Hasher>
+probe_partition partition_probe_rows(Hasher const& hash_probe,
+                                     hash_value_type empty_key_sentinel,
+                                     size_type num_rows,
+                                     heavy_hitter_table const& heavy,
+                                     rmm::cuda_stream_view stream)
+{
+  auto const policy = rmm::exec_policy_nosync(stream);
+  if (heavy.is_empty()) {
+    return probe_partition{num_rows,
+                           rmm::device_uvector<size_type>{0, stream},
+                           rmm::device_uvector<size_type>{0, stream},
+                           rmm::device_uvector<size_type>{0, stream},
+                           rmm::device_uvector<int64_t>{0, stream},
+                           0};
+  }
+
+  rmm::device_uvector<size_type> groups(num_rows, stream);
+  thrust::transform(
+    policy,
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    groups.begin(),
+    probe_group_fn<Hasher>{hash_probe,
+                           empty_key_sentinel,
+                           heavy_group_fn{heavy.hashes.data(),
+                                          static_cast<size_type>(heavy.hashes.size())}});
+  auto const is_heavy  = [] __device__(size_type group) { return group >= 0; };
+  auto const is_light  = [] __device__(size_type group) { return group < 0; };
+  auto const num_heavy = static_cast<size_type>(
+    thrust::count_if(policy, groups.begin(), groups.end(), is_heavy));
+
+  probe_partition result{num_rows - num_heavy,
+                         rmm::device_uvector<size_type>(num_rows - num_heavy, stream),
+                         rmm::device_uvector<size_type>(num_heavy, stream),
+                         rmm::device_uvector<size_type>(num_heavy, stream),
+                         rmm::device_uvector<int64_t>(num_heavy + 1, stream),
+                         0};
+  thrust::copy_if(policy,
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  groups.begin(),
+                  result.light_rows.begin(),
+                  is_light);
+  auto const rows_and_groups =
+    thrust::make_zip_iterator(thrust::make_counting_iterator<size_type>(0), groups.begin());
+  thrust::copy_if(
+    policy,
+    rows_and_groups,
+    rows_and_groups + num_rows,
+    groups.begin(),
+    thrust::make_zip_iterator(result.heavy_rows.begin(), result.heavy_groups.begin()),
+    is_heavy);
+
+  // Every build row of the group of a heavy probe row is a candidate match
+  auto const sizes_it = cudf::detail::make_counting_transform_iterator(
+    0,
+    [groups = result.heavy_groups.data(), offsets = heavy.offsets.data(), num_heavy] __device__(
+      size_type i) -> int64_t {
+      return i < num_heavy ? offsets[groups[i] + 1] - offsets[groups[i]] : 0;
+    });
+  result.num_candidates = cudf::detail::sizes_to_offsets(
+    sizes_it, sizes_it + num_heavy + 1, result.candidate_offsets.begin(), stream);
+  return result;
+}
+
+/**
+ * @brief The (probe row, build row) candidate pairs of the heavy probe rows, one per index.
+ */
+template <typename DeviceComparator>
+struct heavy_candidate_pairs {
+  int64_t const* candidate_offsets;
+  size_type num_heavy_rows;
+  size_type const* heavy_rows;
+  size_type const* heavy_groups;
+  size_type const* group_offsets;
+  size_type const* group_rows;
+  DeviceComparator equal;
+
+  /// Returns the index of the heavy probe row of the k-th candidate pair
+  __device__ size_type heavy_index(int64_t k) const
+  {
+    auto const it = thrust::upper_bound(
+      thrust::seq, candidate_offsets, candidate_offsets + num_heavy_rows + 1, k);
+    return static_cast<size_type>(thrust::distance(candidate_offsets, it) - 1);
+  }
+
+  __device__ thrust::tuple<size_type, size_type> operator()(int64_t k) const
+  {
+    auto const i = heavy_index(k);
+    return {heavy_rows[i],
+            group_rows[group_offsets[heavy_groups[i]] + (k - candidate_offsets[i])]};
+  }
+
+  __device__ bool is_match(int64_t k) const
+  {
+    using experimental::row::lhs_index_type;
+    using experimental::row::rhs_index_type;
+    auto const [probe_row, build_row] = (*this)(k);
+    return equal(lhs_index_type{probe_row}, rhs_index_type{build_row});
+  }
+};
+
+template <typename DeviceComparator>
+struct heavy_candidate_index_fn {
+  heavy_candidate_pairs<DeviceComparator> pairs;
+  __device__ size_type operator()(int64_t k) const { return pairs.heavy_index(k); }
+};
+
+template <typename DeviceComparator>
+struct heavy_candidate_match_fn {
+  heavy_candidate_pairs<DeviceComparator> pairs;
+  __device__ size_type operator()(int64_t k) const { return pairs.is_match(k) ? 1 : 0; }
+};
+
+template <typename DeviceComparator>
+heavy_candidate_pairs<DeviceComparator> make_heavy_candidate_pairs(
+  probe_partition const& partition, heavy_hitter_table const& heavy, DeviceComparator equal)
+{
+  return heavy_candidate_pairs<DeviceComparator>{
+    partition.candidate_offsets.data(),
+    static_cast<size_type>(partition.heavy_rows.size()),
+    partition.heavy_rows.data(),
+    partition.heavy_groups.data(),
+    heavy.offsets.data(),
+    heavy.rows.data(),
+    equal};
+}
+
+/**
+ * @brief Counts the matches of each heavy probe row.
+ *
+ * Every thread checks one candidate pair, so that the work is balanced whatever the number of
+ * build rows of each heavy hitter.
+ */
+template <typename DeviceComparator>
+rmm::device_uvector<size_type> count_heavy_matches(probe_partition const& partition,
+                                                   heavy_hitter_table const& heavy,
+                                                   DeviceComparator equal,
+                                                   rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> counts(partition.heavy_rows.size(), stream);
+  if (counts.is_empty()) { return counts; }
+  auto const pairs = make_heavy_candidate_pairs(partition, heavy, equal);
+  // every heavy probe row has candidates, so there is one count per heavy probe row
+  auto const keys    = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<int64_t>(0), heavy_candidate_index_fn<DeviceComparator>{pairs});
+  auto const matches = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<int64_t>(0), heavy_candidate_match_fn<DeviceComparator>{pairs});
+  thrust::reduce_by_key(rmm::exec_policy_nosync(stream),
+                        keys,
+                        keys + partition.num_candidates,
+                        matches,
+                        thrust::make_discard_iterator(),
+                        counts.begin());
+  return counts;
+}
+
+/**
+ * @brief Returns the number of output rows of the heavy probe rows.
+ */
+std::size_t heavy_join_size(device_span<size_type const> match_counts,
+                            join_kind join,
+                            rmm::cuda_stream_view stream)
+{
+  auto const keeps_unmatched = join != join_kind::INNER_JOIN;
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    match_counts.begin(),
+    match_counts.end(),
+    [keeps_unmatched] __device__(size_type count) -> std::size_t {
+      return count == 0 and keeps_unmatched ? 1 : count;
+    },
+    std::size_t{0},
+    thrust::plus<std::size_t>{});
+}
+
+/**
+ * @brief Writes the output rows of the heavy probe rows and returns their number.
+ */
+template <typename DeviceComparator>
+std::size_t retrieve_heavy_matches(probe_partition const& partition,
+                                   heavy_hitter_table const& heavy,
+                                   DeviceComparator equal,
+                                   device_span<size_type const> match_counts,
+                                   join_kind join,
+                                   size_type* probe_indices,
+                                   size_type* build_indices,
+                                   rmm::cuda_stream_view stream)
+{
+  if (match_counts.empty()) { return 0; }
+  auto const policy = rmm::exec_policy_nosync(stream);
+  auto const pairs  = make_heavy_candidate_pairs(partition, heavy, equal);
+  auto const out    = thrust::make_zip_iterator(probe_indices, build_indices);
+  auto const pairs_begin =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<int64_t>(0), pairs);
+  auto out_end = thrust::copy_if(policy,
+                                 pairs_begin,
+                                 pairs_begin + partition.num_candidates,
+                                 thrust::make_counting_iterator<int64_t>(0),
+                                 out,
+                                 [pairs] __device__(int64_t k) { return pairs.is_match(k); });
+  if (join != join_kind::INNER_JOIN) {
+    auto const unmatched = thrust::make_zip_iterator(
+      partition.heavy_rows.begin(), thrust::make_constant_iterator(JoinNoneValue));
+    out_end = thrust::copy_if(policy,
+                              unmatched,
+                              unmatched + partition.heavy_rows.size(),
+                              match_counts.begin(),
+                              out_end,
+                              [] __device__(size_type count) { return count == 0; });
+  }
+  return thrust::distance(out, out_end);
+}
+
+/**
+ * @brief Finds the heavy-hitter build keys and groups their rows by row hash.
+ *
+ * A strided sample of the build row hashes gives the candidate heavy hashes, whose build rows are
+ * then counted exactly. The hashes with at least `heavy_hitter_min_rows` rows are kept.
+ *
+ * @return The sorted heavy hashes, the offsets of their rows and the rows grouped by hash
+ */
+template <typename Hasher>
+std::tuple<rmm::device_uvector<hash_value_type>,
+           rmm::device_uvector<size_type>,
+           rmm::device_uvector<size_type>>
+find_heavy_hitters(Hasher const& hash_build,
+                   size_type num_rows,
+                   bitmask_type const* row_bitmask,
+                   hash_value_type empty_key_sentinel,
+                   rmm::cuda_stream_view stream)
+{
+  auto const policy = rmm::exec_policy_nosync(stream);
+  auto no_heavy_hitters = [&] {
+    return std::tuple(rmm::device_uvector<hash_value_type>{0, stream},
+                      rmm::device_uvector<size_type>{0, stream},
+                      rmm::device_uvector<size_type>{0, stream});
+  };
+  if (num_rows < heavy_hitter_min_rows) { return no_heavy_hitters(); }
+
+  // Row hashes of the build rows; the rows that never match get the empty key sentinel
+  rmm::device_uvector<hash_value_type> hashes(num_rows, stream);
+  thrust::transform(policy,
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    hashes.begin(),
+                    [hash_build, row_bitmask, empty_key_sentinel] __device__(size_type row) {
+                      if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) {
+                        return empty_key_sentinel;
+                      }
+                      return remap_sentinel_hash(hash_build(row), empty_key_sentinel);
+                    });
+
+  // Candidates: the hashes whose sample frequency estimates at least half of the minimum rows
+  auto const stride      = std::max(size_type{1}, num_rows / heavy_hitter_sample_size);
+  auto const sample_size = num_rows / stride;
+  rmm::device_uvector<hash_value_type> sample(sample_size, stream);
+  auto const sample_map = cudf::detail::make_counting_transform_iterator(
+    0, [stride] __device__(size_type i) { return i * stride; });
+  thrust::gather(policy, sample_map, sample_map + sample_size, hashes.begin(), sample.begin());
+  thrust::sort(policy, sample.begin(), sample.end());
+  rmm::device_uvector<hash_value_type> sample_hashes(sample_size, stream);
+  rmm::device_uvector<size_type> sample_counts(sample_size, stream);
+  auto const num_sample_hashes = thrust::distance(
+    sample_hashes.begin(),
+    thrust::reduce_by_key(policy,
+                          sample.begin(),
+                          sample.end(),
+                          thrust::make_constant_iterator(size_type{1}),
+                          sample_hashes.begin(),
+                          sample_counts.begin())
+      .first);
+  rmm::device_uvector<hash_value_type> candidates(num_sample_hashes, stream);
+  auto const candidates_end = thrust::copy_if(
+    policy,
+    sample_hashes.begin(),
+    sample_hashes.begin() + num_sample_hashes,
+    thrust::make_zip_iterator(sample_hashes.begin(), sample_counts.begin()),
+    candidates.begin(),
+    [stride, empty_key_sentinel] __device__(thrust::tuple<hash_value_type, size_type> entry) {
+      auto const count = thrust::get<1>(entry);
+      return thrust::get<0>(entry) != empty_key_sentinel and count > 1 and
+             static_cast<int64_t>(count) * stride * 2 >= heavy_hitter_min_rows;
+    });
+  candidates.resize(thrust::distance(candidates.begin(), candidates_end), stream);
+  if (candidates.is_empty()) { return no_heavy_hitters(); }
+
+  // Exact counts of the build rows of each candidate
+  auto const group = heavy_group_fn{candidates.data(), static_cast<size_type>(candidates.size())};
+  rmm::device_uvector<size_type> row_groups(num_rows, stream);
+  thrust::transform(policy, hashes.begin(), hashes.end(), row_groups.begin(), group);
+  auto const is_candidate = [] __device__(size_type g) { return g >= 0; };
+  auto const num_candidate_rows =
+    thrust::count_if(policy, row_groups.begin(), row_groups.end(), is_candidate);
+  rmm::device_uvector<size_type> keys(num_candidate_rows, stream);
+  rmm::device_uvector<size_type> rows(num_candidate_rows, stream);
+  auto const rows_and_groups =
+    thrust::make_zip_iterator(row_groups.begin(), thrust::make_counting_iterator<size_type>(0));
+  thrust::copy_if(policy,
+                  rows_and_groups,
+                  rows_and_groups + num_rows,
+                  row_groups.begin(),
+                  thrust::make_zip_iterator(keys.begin(), rows.begin()),
+                  is_candidate);
+  thrust::stable_sort_by_key(policy, keys.begin(), keys.end(), rows.begin());
+
+  rmm::device_uvector<size_type> group_ids(candidates.size(), stream);
+  rmm::device_uvector<size_type> group_counts(candidates.size(), stream);
+  auto const num_groups = thrust::distance(
+    group_ids.begin(),
+    thrust::reduce_by_key(policy,
+                          keys.begin(),
+                          keys.end(),
+                          thrust::make_constant_iterator(size_type{1}),
+                          group_ids.begin(),
+                          group_counts.begin())
+      .first);
+  rmm::device_uvector<size_type> candidate_counts(candidates.size(), stream);
+  thrust::uninitialized_fill(policy, candidate_counts.begin(), candidate_counts.end(), 0);
+  thrust::scatter(policy,
+                  group_counts.begin(),
+                  group_counts.begin() + num_groups,
+                  group_ids.begin(),
+                  candidate_counts.begin());
+
+  // Keep the candidates with at least the minimum number of rows
+  auto const is_heavy = [] __device__(size_type count) { return count >= heavy_hitter_min_rows; };
+  auto const num_heavy = static_cast<size_type>(
+    thrust::count_if(policy, candidate_counts.begin(), candidate_counts.end(), is_heavy));
+  if (num_heavy == 0) { return no_heavy_hitters(); }
+  rmm::device_uvector<hash_value_type> heavy_hashes(num_heavy, stream);
+  rmm::device_uvector<size_type> heavy_offsets(num_heavy + 1, stream);
+  thrust::copy_if(policy,
+                  candidates.begin(),
+                  candidates.end(),
+                  candidate_counts.begin(),
+                  heavy_hashes.begin(),
+                  is_heavy);
+  auto const heavy_counts_end = thrust::copy_if(policy,
+                                                candidate_counts.begin(),
+                                                candidate_counts.end(),
+                                                heavy_offsets.begin(),
+                                                is_heavy);
+  thrust::uninitialized_fill(policy, heavy_counts_end, heavy_offsets.end(), 0);
+  cudf::detail::sizes_to_offsets(
+    heavy_offsets.begin(), heavy_offsets.end(), heavy_offsets.begin(), stream);
+
+  rmm::device_uvector<size_type> heavy_rows(num_candidate_rows, stream);
+  auto const heavy_rows_end =
+    thrust::copy_if(policy,
+                    rows.begin(),
+                    rows.end(),
+                    keys.begin(),
+                    heavy_rows.begin(),
+                    [counts = candidate_counts.data()] __device__(size_type g) {
+                      return counts[g] >= heavy_hitter_min_rows;
+                    });
+  heavy_rows.resize(thrust::distance(heavy_rows.begin(), heavy_rows_end), stream);
+  return std::tuple(std::move(heavy_hashes), std::move(heavy_offsets), std::move(heavy_rows));
+}
+
+/**
+ * @brief Device functor to determine if a build row is inserted in the hash table: it must be
+ * valid if a row bitmask is given, and not a heavy hitter.
+ */
+template <typename Hasher>
+struct is_hash_table_row {
+  Hasher hash;
+  bitmask_type const* row_bitmask;
+  hash_value_type empty_key_sentinel;
+  heavy_group_fn group;
+
+  __device__ bool operator()(size_type row) const
+  {
+    if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) { return false; }
+    return group(remap_sentinel_hash(hash(row), empty_key_sentinel)) < 0;
+  }
+};
+
 /**
  * @brief Calculates the exact size of the join output produced when
  * joining two tables together.
@@ -57,6 +538,7 @@ namespace {
  *                           probe_table
  * @param hash_table A hash table built on the build table that maps the index
  *                   of every row to the hash value of that row
+ * @param heavy The build rows of the heavy hitters, which are not in `hash_table`
  * @param join The type of join to be performed
  * @param has_nulls Flag to denote if build or probe tables have nested nulls
  * @param nulls_equal Flag to denote nulls are equal or not
@@ -70,6 +552,7 @@ std::size_t compute_join_output_size(
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
   cudf::detail::multimap_type const& hash_table,
+  heavy_hitter_table const& heavy,
   join_kind join,
   bool has_nulls,
   cudf::null_equality nulls_equal,
@@ -95,22 +578,30 @@ std::size_t compute_join_output_size(
 
   auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
 
-  auto const row_hash           = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
-  auto const hash_probe         = row_hash.device_hasher(probe_nulls);
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+  auto const hash_probe = cudf::hashing::detail::make_fixed_width_row_hasher<
+    cudf::hashing::detail::default_hash>(probe_table, row_hash.device_hasher(probe_nulls));
   auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
-  auto const iter               = cudf::detail::make_counting_transform_iterator(
-    0, make_pair_function{hash_probe, empty_key_sentinel});
+  auto const partition =
+    partition_probe_rows(hash_probe, empty_key_sentinel, probe_table_num_rows, heavy, stream);
+  auto const iter = cudf::detail::make_counting_transform_iterator(
+    0,
+    make_probe_pair_function<decltype(hash_probe)>{
+      hash_probe, empty_key_sentinel, partition.light_rows_data()});
 
   auto const row_comparator =
     cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
   auto const comparator_helper = [&](auto device_comparator) {
     pair_equality equality{device_comparator};
 
+    auto const heavy_size = heavy_join_size(
+      count_heavy_matches(partition, heavy, device_comparator, stream), join, stream);
     if (join == join_kind::LEFT_JOIN) {
-      return hash_table.pair_count_outer(
-        iter, iter + probe_table_num_rows, equality, stream.value());
+      return heavy_size + hash_table.pair_count_outer(
+                            iter, iter + partition.num_light_rows, equality, stream.value());
     } else {
-      return hash_table.pair_count(iter, iter + probe_table_num_rows, equality, stream.value());
+      return heavy_size +
+             hash_table.pair_count(iter, iter + partition.num_light_rows, equality, stream.value());
     }
   };
 
@@ -135,6 +626,7 @@ std::size_t compute_join_output_size(
  * @param preprocessed_probe shared_ptr to cudf::experimental::row::equality::preprocessed_table for
  *                           probe_table
  * @param hash_table Hash table built from `build_table`
+ * @param heavy The build rows of the heavy hitters, which are not in `hash_table`
  * @param join The type of join to be performed
  * @param has_nulls Flag to denote if build or probe tables have nested nulls
  * @param compare_nulls Controls whether null join-key values should match or not
@@ -152,6 +644,7 @@ probe_join_hash_table(
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
   cudf::detail::multimap_type const& hash_table,
+  heavy_hitter_table const& heavy,
   join_kind join,
   bool has_nulls,
   null_equality compare_nulls,
@@ -169,6 +662,7 @@ probe_join_hash_table(
                                                                        preprocessed_build,
                                                                        preprocessed_probe,
                                                                        hash_table,
+                                                                       heavy,
                                                                        probe_join_type,
                                                                        has_nulls,
                                                                        compare_nulls,
@@ -185,41 +679,55 @@ probe_join_hash_table(
 
   auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
 
-  auto const row_hash           = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
-  auto const hash_probe         = row_hash.device_hasher(probe_nulls);
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+  auto const hash_probe = cudf::hashing::detail::make_fixed_width_row_hasher<
+    cudf::hashing::detail::default_hash>(probe_table, row_hash.device_hasher(probe_nulls));
   auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
-  auto const iter               = cudf::detail::make_counting_transform_iterator(
-    0, make_pair_function{hash_probe, empty_key_sentinel});
-
-  cudf::size_type const probe_table_num_rows = probe_table.num_rows();
-
-  auto const out1_zip_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin()));
-  auto const out2_zip_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(thrust::make_discard_iterator(), right_indices->begin()));
+  auto const partition =
+    partition_probe_rows(hash_probe, empty_key_sentinel, probe_table.num_rows(), heavy, stream);
+  auto const iter = cudf::detail::make_counting_transform_iterator(
+    0,
+    make_probe_pair_function<decltype(hash_probe)>{
+      hash_probe, empty_key_sentinel, partition.light_rows_data()});
 
   auto const row_comparator =
     cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
   auto const comparator_helper = [&](auto device_comparator) {
     pair_equality equality{device_comparator};
 
+    // The matches of the heavy probe rows are written first, followed by those of the hash table
+    auto const match_counts = count_heavy_matches(partition, heavy, device_comparator, stream);
+    auto const heavy_size   = retrieve_heavy_matches(partition,
+                                                   heavy,
+                                                   device_comparator,
+                                                   match_counts,
+                                                   probe_join_type,
+                                                   left_indices->data(),
+                                                   right_indices->data(),
+                                                   stream);
+
+    auto const out1_zip_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin() + heavy_size));
+    auto const out2_zip_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(thrust::make_discard_iterator(), right_indices->begin() + heavy_size));
+
     if (join == cudf::detail::join_kind::FULL_JOIN or join == cudf::detail::join_kind::LEFT_JOIN) {
       [[maybe_unused]] auto [out1_zip_end, out2_zip_end] =
         hash_table.pair_retrieve_outer(iter,
-                                       iter + probe_table_num_rows,
+                                       iter + partition.num_light_rows,
                                        out1_zip_begin,
                                        out2_zip_begin,
                                        equality,
                                        stream.value());
 
       if (join == cudf::detail::join_kind::FULL_JOIN) {
-        auto const actual_size = thrust::distance(out1_zip_begin, out1_zip_end);
+        auto const actual_size = heavy_size + thrust::distance(out1_zip_begin, out1_zip_end);
         left_indices->resize(actual_size, stream);
         right_indices->resize(actual_size, stream);
       }
     } else {
       hash_table.pair_retrieve(iter,
-                               iter + probe_table_num_rows,
+                               iter + partition.num_light_rows,
                                out1_zip_begin,
                                out2_zip_begin,
                                equality,
@@ -251,6 +759,7 @@ probe_join_hash_table(
  * @param preprocessed_probe shared_ptr to cudf::experimental::row::equality::preprocessed_table for
  *                           probe_table
  * @param hash_table Hash table built from `build_table`
+ * @param heavy The build rows of the heavy hitters, which are not in `hash_table`
  * @param has_nulls Flag to denote if build or probe tables have nested nulls
  * @param compare_nulls Controls whether null join-key values should match or not
  * @param stream CUDA stream used for device memory operations and kernel launches
@@ -264,57 +773,29 @@ std::size_t get_full_join_size(
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
   cudf::detail::multimap_type const& hash_table,
+  heavy_hitter_table const& heavy,
   bool has_nulls,
   null_equality compare_nulls,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
-  std::size_t join_size = compute_join_output_size(build_table,
-                                                   probe_table,
-                                                   preprocessed_build,
-                                                   preprocessed_probe,
-                                                   hash_table,
-                                                   cudf::detail::join_kind::LEFT_JOIN,
-                                                   has_nulls,
-                                                   compare_nulls,
-                                                   stream);
+  auto [left_indices, right_indices] = probe_join_hash_table(build_table,
+                                                             probe_table,
+                                                             preprocessed_build,
+                                                             preprocessed_probe,
+                                                             hash_table,
+                                                             heavy,
+                                                             cudf::detail::join_kind::LEFT_JOIN,
+                                                             has_nulls,
+                                                             compare_nulls,
+                                                             std::nullopt,
+                                                             stream,
+                                                             mr);
+  std::size_t const join_size = right_indices->size();
 
   // If output size is zero, return immediately
   if (join_size == 0) { return join_size; }
 
-  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
-  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
-
-  auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
-
-  auto const row_hash           = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
-  auto const hash_probe         = row_hash.device_hasher(probe_nulls);
-  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
-  auto const iter               = cudf::detail::make_counting_transform_iterator(
-    0, make_pair_function{hash_probe, empty_key_sentinel});
-
-  cudf::size_type const probe_table_num_rows = probe_table.num_rows();
-
-  auto const out1_zip_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin()));
-  auto const out2_zip_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(thrust::make_discard_iterator(), right_indices->begin()));
-
-  auto const row_comparator =
-    cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
-  auto const comparator_helper = [&](auto device_comparator) {
-    pair_equality equality{device_comparator};
-    hash_table.pair_retrieve_outer(
-      iter, iter + probe_table_num_rows, out1_zip_begin, out2_zip_begin, equality, stream.value());
-  };
-  if (cudf::detail::has_nested_columns(probe_table)) {
-    auto const device_comparator = row_comparator.equal_to<true>(probe_nulls, compare_nulls);
-    comparator_helper(device_comparator);
-  } else {
-    auto const device_comparator = row_comparator.equal_to<false>(probe_nulls, compare_nulls);
-    comparator_helper(device_comparator);
-  }
-
   // Release intermediate memory allocation
   left_indices->resize(0, stream);
 
@@ -355,6 +836,82 @@ std::size_t get_full_join_size(
   }
   return join_size + left_join_complement_size;
 }
+
+// Number of groups of sample rows of a join size estimate
+constexpr size_type estimate_num_groups = 16;
+// Half width of the 95% confidence interval of a normal distribution, in standard deviations
+constexpr double estimate_z_score = 1.96;
+
+/**
+ * @brief Device functor returning the probe row of the i-th of `sample_size` sample rows, spread
+ * evenly over `num_rows` rows.
+ */
+struct sample_row_fn {
+  size_type num_rows;
+  size_type sample_size;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return static_cast<size_type>(static_cast<int64_t>(i) * num_rows / sample_size);
+  }
+};
+
+// Identifies the metadata of a packed hash join
+constexpr uint32_t packed_hash_join_magic = 0x4a485043;
+
+/**
+ * @brief Header of the metadata of a packed hash join, followed by the type ids of the build
+ * columns.
+ *
+ * The device buffer holds the hash table slots, then the heavy-hitter hashes, offsets and rows.
+ */
+struct packed_hash_join_header {
+  uint32_t magic;                 ///< `packed_hash_join_magic`
+  size_type num_rows;             ///< number of rows of the build table
+  size_type num_columns;          ///< number of columns of the build table
+  bool has_nulls;                 ///< whether the hash table was built with null checks
+  null_equality nulls_equal;      ///< whether nulls compare equal
+  std::size_t capacity;           ///< number of slots of the hash table
+  std::size_t slot_size;          ///< size in bytes of a slot of the hash table
+  std::size_t num_heavy_hashes;   ///< number of heavy-hitter hashes
+  std::size_t num_heavy_offsets;  ///< number of heavy-hitter offsets
+  std::size_t num_heavy_rows;     ///< number of build rows of the heavy hitters
+};
+
+/**
+ * @brief Returns the header of a packed hash join, checking that it was packed from a table with
+ * the number of rows and the column types of `build`.
+ */
+packed_hash_join_header unpack_header(cudf::packed_hash_join const& packed,
+                                      cudf::table_view const& build)
+{
+  CUDF_EXPECTS(packed.metadata != nullptr and packed.gpu_data != nullptr,
+               "Invalid packed hash join");
+  auto const& metadata = *packed.metadata;
+  packed_hash_join_header header{};
+  CUDF_EXPECTS(metadata.size() >= sizeof(header), "Invalid packed hash join");
+  std::memcpy(&header, metadata.data(), sizeof(header));
+  CUDF_EXPECTS(header.magic == packed_hash_join_magic and
+                 metadata.size() == sizeof(header) + header.num_columns * sizeof(type_id),
+               "Invalid packed hash join");
+  CUDF_EXPECTS(header.num_rows == build.num_rows() and header.num_columns == build.num_columns(),
+               "Mismatch in the shape of the packed hash join build table");
+
+  std::vector<type_id> type_ids(header.num_columns);
+  std::memcpy(type_ids.data(), metadata.data() + sizeof(header), type_ids.size() * sizeof(type_id));
+  CUDF_EXPECTS(std::equal(type_ids.begin(),
+                          type_ids.end(),
+                          build.begin(),
+                          build.end(),
+                          [](auto id, auto const& col) { return id == col.type().id(); }),
+               "Mismatch in the column types of the packed hash join build table");
+
+  auto const data_size = header.capacity * header.slot_size +
+                         header.num_heavy_hashes * sizeof(hash_value_type) +
+                         (header.num_heavy_offsets + header.num_heavy_rows) * sizeof(size_type);
+  CUDF_EXPECTS(packed.gpu_data->size() == data_size, "Invalid packed hash join");
+  return header;
+}
 }  // namespace
 
 template <typename Hasher>
@@ -372,7 +929,10 @@ hash_join<Hasher>::hash_join(cudf::table_view const& build,
                 cudf::detail::cuco_allocator{stream}},
     _build{build},
     _preprocessed_build{
-      cudf::experimental::row::equality::preprocessed_table::create(_build, stream)}
+      cudf::experimental::row::equality::preprocessed_table::create(_build, stream)},
+    _heavy_hashes{0, stream},
+    _heavy_offsets{0, stream},
+    _heavy_rows{0, stream}
 {
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(0 != build.num_columns(), "Hash join build table is empty");
@@ -381,13 +941,129 @@ hash_join<Hasher>::hash_join(cudf::table_view const& build,
 
   auto const row_bitmask =
     cudf::detail::bitmask_and(build, stream, rmm::mr::get_current_device_resource()).first;
-  cudf::detail::build_join_hash_table(_build,
-                                      _preprocessed_build,
-                                      _hash_table,
-                                      _has_nulls,
-                                      _nulls_equal,
-                                      reinterpret_cast<bitmask_type const*>(row_bitmask.data()),
-                                      stream);
+  auto const valid_rows = (_nulls_equal == null_equality::UNEQUAL and nullable(build))
+                            ? reinterpret_cast<bitmask_type const*>(row_bitmask.data())
+                            : nullptr;
+
+  auto const build_nulls = nullate::DYNAMIC{_has_nulls};
+  auto const row_hash    = experimental::row::hash::row_hasher{_preprocessed_build};
+  auto const hash_build  = cudf::hashing::detail::make_fixed_width_row_hasher<
+    cudf::hashing::detail::default_hash>(build, row_hash.device_hasher(build_nulls));
+  auto const empty_key_sentinel = _hash_table.get_empty_key_sentinel();
+  std::tie(_heavy_hashes, _heavy_offsets, _heavy_rows) =
+    find_heavy_hitters(hash_build, build.num_rows(), valid_rows, empty_key_sentinel, stream);
+
+  if (_heavy_hashes.is_empty()) {
+    cudf::detail::build_join_hash_table(_build,
+                                        _preprocessed_build,
+                                        _hash_table,
+                                        _has_nulls,
+                                        _nulls_equal,
+                                        reinterpret_cast<bitmask_type const*>(row_bitmask.data()),
+                                        stream);
+    return;
+  }
+
+  // Only the rows of the other keys are inserted in the hash table
+  auto const iter = cudf::detail::make_counting_transform_iterator(
+    0, make_pair_function{hash_build, empty_key_sentinel});
+  _hash_table.insert_if(
+    iter,
+    iter + build.num_rows(),
+    thrust::counting_iterator<size_type>(0),
+    is_hash_table_row<decltype(hash_build)>{
+      hash_build,
+      valid_rows,
+      empty_key_sentinel,
+      heavy_group_fn{_heavy_hashes.data(), static_cast<size_type>(_heavy_hashes.size())}},
+    stream.value());
+}
+
+template <typename Hasher>
+hash_join<Hasher>::hash_join(cudf::table_view const& build,
+                             cudf::packed_hash_join const& packed,
+                             rmm::cuda_stream_view stream)
+  : _is_empty{build.num_rows() == 0},
+    _has_nulls{unpack_header(packed, build).has_nulls},
+    _nulls_equal{unpack_header(packed, build).nulls_equal},
+    _build{build},
+    _preprocessed_build{
+      cudf::experimental::row::equality::preprocessed_table::create(_build, stream)},
+    _hash_table{compute_hash_table_size(build.num_rows()),
+                cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+                cuco::empty_value{cudf::detail::JoinNoneValue},
+                stream.value(),
+                cudf::detail::cuco_allocator{stream}},
+    _heavy_hashes{0, stream},
+    _heavy_offsets{0, stream},
+    _heavy_rows{0, stream}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != build.num_columns(), "Hash join build table is empty");
+
+  auto const header = unpack_header(packed, build);
+  auto slots        = _hash_table.get_device_mutable_view().get_slots();
+  CUDF_EXPECTS(header.capacity == _hash_table.get_capacity() and header.slot_size == sizeof(*slots),
+               "Mismatch in the hash table layout of the packed hash join");
+
+  _heavy_hashes.resize(header.num_heavy_hashes, stream);
+  _heavy_offsets.resize(header.num_heavy_offsets, stream);
+  _heavy_rows.resize(header.num_heavy_rows, stream);
+
+  auto src             = static_cast<uint8_t const*>(packed.gpu_data->data());
+  auto const copy_from = [&](void* dst, std::size_t size) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyDefault, stream.value()));
+    src += size;
+  };
+  copy_from(slots, header.capacity * header.slot_size);
+  copy_from(_heavy_hashes.data(), _heavy_hashes.size() * sizeof(hash_value_type));
+  copy_from(_heavy_offsets.data(), _heavy_offsets.size() * sizeof(size_type));
+  copy_from(_heavy_rows.data(), _heavy_rows.size() * sizeof(size_type));
+}
+
+template <typename Hasher>
+cudf::packed_hash_join hash_join<Hasher>::pack(rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+
+  auto const slots = _hash_table.get_device_view().get_slots();
+  packed_hash_join_header const header{packed_hash_join_magic,
+                                       _build.num_rows(),
+                                       _build.num_columns(),
+                                       _has_nulls,
+                                       _nulls_equal,
+                                       _hash_table.get_capacity(),
+                                       sizeof(*slots),
+                                       _heavy_hashes.size(),
+                                       _heavy_offsets.size(),
+                                       _heavy_rows.size()};
+
+  auto metadata = std::make_unique<std::vector<uint8_t>>(sizeof(header) +
+                                                         _build.num_columns() * sizeof(type_id));
+  std::memcpy(metadata->data(), &header, sizeof(header));
+  auto type_ids = metadata->data() + sizeof(header);
+  for (auto const& col : _build) {
+    auto const id = col.type().id();
+    std::memcpy(type_ids, &id, sizeof(id));
+    type_ids += sizeof(id);
+  }
+
+  auto const data_size = header.capacity * header.slot_size +
+                         _heavy_hashes.size() * sizeof(hash_value_type) +
+                         (_heavy_offsets.size() + _heavy_rows.size()) * sizeof(size_type);
+  auto gpu_data      = std::make_unique<rmm::device_buffer>(data_size, stream, mr);
+  auto dst           = static_cast<uint8_t*>(gpu_data->data());
+  auto const copy_to = [&](void const* src, std::size_t size) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyDefault, stream.value()));
+    dst += size;
+  };
+  copy_to(slots, header.capacity * header.slot_size);
+  copy_to(_heavy_hashes.data(), _heavy_hashes.size() * sizeof(hash_value_type));
+  copy_to(_heavy_offsets.data(), _heavy_offsets.size() * sizeof(size_type));
+  copy_to(_heavy_rows.data(), _heavy_rows.size() * sizeof(size_type));
+
+  return cudf::packed_hash_join{std::move(metadata), std::move(gpu_data)};
 }
 
 template <typename Hasher>
@@ -440,18 +1116,83 @@ std::size_t hash_join<Hasher>::inner_join_size(cudf::table_view const& probe,
 
   auto const preprocessed_probe =
     cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
+  auto const heavy = heavy_hitter_table{_heavy_hashes, _heavy_offsets, _heavy_rows};
 
   return cudf::detail::compute_join_output_size(_build,
                                                 probe,
                                                 _preprocessed_build,
                                                 preprocessed_probe,
                                                 _hash_table,
+                                                heavy,
                                                 cudf::detail::join_kind::INNER_JOIN,
                                                 _has_nulls,
                                                 _nulls_equal,
                                                 stream);
 }
 
+template <typename Hasher>
+cudf::join_size_estimate hash_join<Hasher>::estimate_inner_join_size(
+  cudf::table_view const& probe, size_type sample_size, rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(sample_size > 0, "The sample size must be positive");
+
+  auto const num_rows = probe.num_rows();
+  if (_is_empty or num_rows == 0) { return cudf::join_size_estimate{0, 0, 0}; }
+  if (sample_size >= num_rows) {
+    auto const size = inner_join_size(probe, stream);
+    return cudf::join_size_estimate{size, size, size};
+  }
+
+  rmm::device_uvector<size_type> sample_map(sample_size, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(sample_size),
+                    sample_map.begin(),
+                    sample_row_fn{num_rows, sample_size});
+  auto const sample = cudf::detail::gather(probe,
+                                           sample_map,
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           rmm::mr::get_current_device_resource());
+
+  // Mean matches per row of each group of consecutive sample rows
+  auto const num_groups = std::min(sample_size, estimate_num_groups);
+  std::vector<double> group_means(num_groups);
+  std::size_t sample_join_size = 0;
+  for (size_type g = 0; g < num_groups; ++g) {
+    auto const begin = static_cast<size_type>(int64_t{g} * sample_size / num_groups);
+    auto const end   = static_cast<size_type>(int64_t{g + 1} * sample_size / num_groups);
+    auto const size  = inner_join_size(cudf::slice(sample->view(), {begin, end}).front(), stream);
+    group_means[g]   = static_cast<double>(size) / (end - begin);
+    sample_join_size += size;
+  }
+
+  auto const mean     = static_cast<double>(sample_join_size) / sample_size;
+  auto const estimate = mean * num_rows;
+  if (num_groups < 2) {
+    return cudf::join_size_estimate{static_cast<std::size_t>(std::llround(estimate)),
+                                    0,
+                                    std::numeric_limits<std::size_t>::max()};
+  }
+
+  // Standard error of the mean of the groups, with the finite population correction
+  auto const groups_mean =
+    std::accumulate(group_means.begin(), group_means.end(), 0.0) / num_groups;
+  auto squared_deviations = 0.0;
+  for (auto const m : group_means) {
+    squared_deviations += (m - groups_mean) * (m - groups_mean);
+  }
+  auto const variance  = squared_deviations / (num_groups - 1);
+  auto const std_error = std::sqrt(variance / num_groups *
+                                   (1.0 - static_cast<double>(sample_size) / num_rows));
+  auto const half_width = estimate_z_score * std_error * num_rows;
+  return cudf::join_size_estimate{static_cast<std::size_t>(std::llround(estimate)),
+                                  static_cast<std::size_t>(std::max(0.0, estimate - half_width)),
+                                  static_cast<std::size_t>(std::ceil(estimate + half_width))};
+}
+
 template <typename Hasher>
 std::size_t hash_join<Hasher>::left_join_size(cudf::table_view const& probe,
                                               rmm::cuda_stream_view stream) const
@@ -466,12 +1207,14 @@ std::size_t hash_join<Hasher>::left_join_size(cudf::table_view const& probe,
 
   auto const preprocessed_probe =
     cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
+  auto const heavy = heavy_hitter_table{_heavy_hashes, _heavy_offsets, _heavy_rows};
 
   return cudf::detail::compute_join_output_size(_build,
                                                 probe,
                                                 _preprocessed_build,
                                                 preprocessed_probe,
                                                 _hash_table,
+                                                heavy,
                                                 cudf::detail::join_kind::LEFT_JOIN,
                                                 _has_nulls,
                                                 _nulls_equal,
@@ -493,12 +1236,14 @@ std::size_t hash_join<Hasher>::full_join_size(cudf::table_view const& probe,
 
   auto const preprocessed_probe =
     cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
+  auto const heavy = heavy_hitter_table{_heavy_hashes, _heavy_offsets, _heavy_rows};
 
   return cudf::detail::get_full_join_size(_build,
                                           probe,
                                           _preprocessed_build,
                                           preprocessed_probe,
                                           _hash_table,
+                                          heavy,
                                           _has_nulls,
                                           _nulls_equal,
                                           stream,
@@ -526,11 +1271,13 @@ hash_join<Hasher>::probe_join_indices(cudf::table_view const& probe_table,
 
   auto const preprocessed_probe =
     cudf::experimental::row::equality::preprocessed_table::create(probe_table, stream);
+  auto const heavy = heavy_hitter_table{_heavy_hashes, _heavy_offsets, _heavy_rows};
   auto join_indices = cudf::detail::probe_join_hash_table(_build,
                                                           probe_table,
                                                           _preprocessed_build,
                                                           preprocessed_probe,
                                                           _hash_table,
+                                                          heavy,
                                                           join,
                                                           _has_nulls,
                                                           _nulls_equal,
@@ -598,6 +1345,38 @@ hash_join::hash_join(cudf::table_view const& build,
 {
 }
 
+hash_join::hash_join(cudf::table_view const& build,
+                     packed_hash_join const& packed,
+                     rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<impl_type const>(build, packed, stream)}
+{
+}
+
+memory_estimate hash_join::estimate_memory(cudf::table_view const& build,
+                                           std::size_t output_rows)
+{
+  auto const num_rows = static_cast<std::size_t>(build.num_rows());
+  // the heavy-hitter rows are kept out of the hash table, which is still sized for every row
+  auto const hash_table_bytes =
+    compute_hash_table_size(build.num_rows()) * sizeof(detail::pair_type) +
+    num_rows * sizeof(size_type);
+  auto const row_bitmask_bytes =
+    nullable(build) ? bitmask_allocation_size_bytes(build.num_rows()) : 0;
+  // finding the heavy hitters hashes every row, then sorts the rows of the candidates by group
+  auto const heavy_hitter_bytes =
+    build.num_rows() < detail::heavy_hitter_min_rows
+      ? 0
+      : num_rows * (sizeof(hash_value_type) + 5 * sizeof(size_type));
+  return {row_bitmask_bytes + heavy_hitter_bytes,
+          hash_table_bytes + 2 * output_rows * sizeof(size_type)};
+}
+
+packed_hash_join hash_join::pack(rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr) const
+{
+  return _impl->pack(stream, mr);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::inner_join(cudf::table_view const& probe,
@@ -634,6 +1413,13 @@ std::size_t hash_join::inner_join_size(cudf::table_view const& probe,
   return _impl->inner_join_size(probe, stream);
 }
 
+join_size_estimate hash_join::estimate_inner_join_size(cudf::table_view const& probe,
+                                                       size_type sample_size,
+                                                       rmm::cuda_stream_view stream) const
+{
+  return _impl->estimate_inner_join_size(probe, sample_size, stream);
+}
+
 std::size_t hash_join::left_join_size(cudf::table_view const& probe,
                                       rmm::cuda_stream_view stream) const
 {
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/interval_join.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/labeling/label_segments.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <limits>
+#include <stdexcept>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief A comparison of the point column with an interval bound, as `lhs < rhs` or `lhs <= rhs`.
+ */
+struct bound_comparison {
+  ast::column_reference const* lhs;
+  ast::column_reference const* rhs;
+  bool inclusive;
+};
+
+std::optional<bound_comparison> as_bound_comparison(ast::expression const& expr)
+{
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr) { return std::nullopt; }
+  auto const operands = op->get_operands();
+  if (operands.size() != 2) { return std::nullopt; }
+  auto const* lhs = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+  auto const* rhs = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+  if (lhs == nullptr or rhs == nullptr) { return std::nullopt; }
+  switch (op->get_operator()) {
+    case ast::ast_operator::LESS: return bound_comparison{lhs, rhs, false};
+    case ast::ast_operator::LESS_EQUAL: return bound_comparison{lhs, rhs, true};
+    case ast::ast_operator::GREATER: return bound_comparison{rhs, lhs, false};
+    case ast::ast_operator::GREATER_EQUAL: return bound_comparison{rhs, lhs, true};
+    default: return std::nullopt;
+  }
+}
+
+bool is_interval_type(data_type type)
+{
+  return (cudf::is_integral(type) and not cudf::is_boolean(type)) or cudf::is_chrono(type);
+}
+
+/**
+ * @brief Number of points and first sorted point of each interval.
+ */
+struct interval_run {
+  size_type const* lower;
+  size_type const* upper;
+  bitmask_type const* interval_bitmask;  // intervals with null bounds never match, or nullptr
+
+  __device__ size_type operator()(size_type row) const
+  {
+    if (interval_bitmask != nullptr and not bit_is_set(interval_bitmask, row)) { return 0; }
+    return lower[row] < upper[row] ? upper[row] - lower[row] : 0;
+  }
+};
+
+/**
+ * @brief Number of output rows of each interval; zero past the last one, for the offsets scan.
+ */
+struct interval_size_fn {
+  interval_run run;
+  size_type num_intervals;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    return row < num_intervals ? run(row) : 0;
+  }
+};
+
+/**
+ * @brief Point row index of each output row, from the interval index and its output offsets.
+ */
+struct point_index_fn {
+  interval_run run;
+  size_type const* offsets;
+  size_type const* sorted_order;
+
+  __device__ size_type operator()(size_type idx, size_type interval) const
+  {
+    return sorted_order[run.lower[interval] + (idx - offsets[interval])];
+  }
+};
+
+/**
+ * @brief The sorted order of the points and the bounds of the sorted points of each interval.
+ */
+struct interval_bounds {
+  std::unique_ptr<column> sorted_order;
+  std::unique_ptr<column> lower;
+  std::unique_ptr<column> upper;
+  rmm::device_buffer interval_bitmask;
+
+  [[nodiscard]] interval_run run() const
+  {
+    return interval_run{lower->view().data<size_type>(),
+                        upper->view().data<size_type>(),
+                        static_cast<bitmask_type const*>(interval_bitmask.data())};
+  }
+};
+
+interval_bounds compute_interval_bounds(column_view const& points,
+                                        column_view const& begin,
+                                        column_view const& end,
+                                        interval_predicate const& predicate,
+                                        rmm::cuda_stream_view stream)
+{
+  auto const mr = rmm::mr::get_current_device_resource();
+  // Nulls are sorted before the valid points, out of the bounds of all the valid intervals
+  auto sorted_order        = cudf::detail::sorted_order(table_view{{points}}, {}, {}, stream, mr);
+  auto const sorted_points = cudf::detail::gather(table_view{{points}},
+                                                  sorted_order->view(),
+                                                  out_of_bounds_policy::DONT_CHECK,
+                                                  negative_index_policy::NOT_ALLOWED,
+                                                  stream,
+                                                  mr);
+  // The first sorted point at or after the bound, or the first one after it
+  auto const search_interval = [&](column_view const& bound, bool first) {
+    return first ? cudf::detail::lower_bound(
+                     sorted_points->view(), table_view{{bound}}, {}, {}, stream, mr)
+                 : cudf::detail::upper_bound(
+                     sorted_points->view(), table_view{{bound}}, {}, {}, stream, mr);
+  };
+  auto lower = search_interval(begin, predicate.begin_inclusive);
+  auto upper = search_interval(end, not predicate.end_inclusive);
+  auto interval_bitmask =
+    begin.has_nulls() or end.has_nulls()
+      ? cudf::detail::bitmask_and(table_view{{begin, end}}, stream, mr).first
+      : rmm::device_buffer{0, stream};
+  return interval_bounds{
+    std::move(sorted_order), std::move(lower), std::move(upper), std::move(interval_bitmask)};
+}
+
+}  // namespace
+
+std::optional<interval_predicate> find_interval_predicate(ast::expression const& binary_predicate,
+                                                          table_view const& left,
+                                                          table_view const& right)
+{
+  auto const* op = dynamic_cast<ast::operation const*>(&binary_predicate);
+  if (op == nullptr or op->get_operator() != ast::ast_operator::LOGICAL_AND) {
+    return std::nullopt;
+  }
+  auto const operands = op->get_operands();
+  auto const first    = as_bound_comparison(operands[0].get());
+  auto const second   = as_bound_comparison(operands[1].get());
+  if (not first.has_value() or not second.has_value()) { return std::nullopt; }
+
+  // The point column is the shared column of the two comparisons: the rhs of the lower bound
+  // comparison and the lhs of the upper bound comparison
+  auto const same_column = [](ast::column_reference const* lhs, ast::column_reference const* rhs) {
+    return lhs->get_table_source() == rhs->get_table_source() and
+           lhs->get_column_index() == rhs->get_column_index();
+  };
+  auto const is_lower_first = same_column(first->rhs, second->lhs);
+  auto const is_upper_first = same_column(first->lhs, second->rhs);
+  if (not is_lower_first and not is_upper_first) { return std::nullopt; }
+  auto const& begin_bound = is_lower_first ? *first : *second;
+  auto const& end_bound   = is_lower_first ? *second : *first;
+
+  auto const point_table = begin_bound.rhs->get_table_source();
+  if (point_table == ast::table_reference::OUTPUT or
+      begin_bound.lhs->get_table_source() == point_table or
+      end_bound.rhs->get_table_source() == point_table or
+      begin_bound.lhs->get_table_source() != end_bound.rhs->get_table_source() or
+      begin_bound.lhs->get_table_source() == ast::table_reference::OUTPUT) {
+    return std::nullopt;
+  }
+
+  auto const& points    = point_table == ast::table_reference::LEFT ? left : right;
+  auto const& intervals = point_table == ast::table_reference::LEFT ? right : left;
+  auto const result     = interval_predicate{point_table,
+                                         begin_bound.rhs->get_column_index(),
+                                         begin_bound.lhs->get_column_index(),
+                                         end_bound.rhs->get_column_index(),
+                                         begin_bound.inclusive,
+                                         end_bound.inclusive};
+  if (result.point_column >= points.num_columns() or
+      result.begin_column >= intervals.num_columns() or
+      result.end_column >= intervals.num_columns()) {
+    return std::nullopt;
+  }
+  auto const type = points.column(result.point_column).type();
+  if (not is_interval_type(type) or intervals.column(result.begin_column).type() != type or
+      intervals.column(result.end_column).type() != type) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+interval_inner_join(table_view const& left,
+                    table_view const& right,
+                    interval_predicate const& predicate,
+                    rmm::cuda_stream_view stream,
+                    rmm::mr::device_memory_resource* mr)
+{
+  auto const points_left = predicate.point_table == ast::table_reference::LEFT;
+  auto const& points     = points_left ? left : right;
+  auto const& intervals  = points_left ? right : left;
+  auto const bounds      = compute_interval_bounds(points.column(predicate.point_column),
+                                              intervals.column(predicate.begin_column),
+                                              intervals.column(predicate.end_column),
+                                              predicate,
+                                              stream);
+  auto const run         = bounds.run();
+
+  rmm::device_uvector<size_type> offsets(intervals.num_rows() + 1, stream);
+  auto const sizes_it = cudf::detail::make_counting_transform_iterator(
+    0, interval_size_fn{run, intervals.num_rows()});
+  auto const output_size =
+    cudf::detail::sizes_to_offsets(sizes_it, sizes_it + offsets.size(), offsets.begin(), stream);
+  CUDF_EXPECTS(output_size <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+               "Size of output exceeds the column size limit",
+               std::overflow_error);
+
+  auto interval_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto point_indices    = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  cudf::detail::label_segments(
+    offsets.begin(), offsets.end(), interval_indices->begin(), interval_indices->end(), stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(output_size),
+    interval_indices->begin(),
+    point_indices->begin(),
+    point_index_fn{run, offsets.data(), bounds.sorted_order->view().data<size_type>()});
+  return points_left ? std::pair(std::move(point_indices), std::move(interval_indices))
+                     : std::pair(std::move(interval_indices), std::move(point_indices));
+}
+
+std::size_t interval_inner_join_size(table_view const& left,
+                                     table_view const& right,
+                                     interval_predicate const& predicate,
+                                     rmm::cuda_stream_view stream)
+{
+  auto const points_left = predicate.point_table == ast::table_reference::LEFT;
+  auto const& points     = points_left ? left : right;
+  auto const& intervals  = points_left ? right : left;
+  auto const bounds      = compute_interval_bounds(points.column(predicate.point_column),
+                                              intervals.column(predicate.begin_column),
+                                              intervals.column(predicate.end_column),
+                                              predicate,
+                                              stream);
+  return thrust::transform_reduce(rmm::exec_policy(stream),
+                                  thrust::make_counting_iterator<size_type>(0),
+                                  thrust::make_counting_iterator<size_type>(intervals.num_rows()),
+                                  bounds.run(),
+                                  std::size_t{0},
+                                  thrust::plus<std::size_t>{});
+}
+
+}  // namespace detail
+}  // namespace cudf
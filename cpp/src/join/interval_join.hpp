@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief The columns of a range predicate `begin <(=) point AND point <(=) end`, matching the rows
+ * of a point column with the intervals of the other table.
+ */
+struct interval_predicate {
+  ast::table_reference point_table;  ///< Table of the point column, `LEFT` or `RIGHT`
+  size_type point_column;            ///< Index of the point column
+  size_type begin_column;            ///< Index of the interval begin column in the other table
+  size_type end_column;              ///< Index of the interval end column in the other table
+  bool begin_inclusive;              ///< Whether the points equal to the begin match
+  bool end_inclusive;                ///< Whether the points equal to the end match
+};
+
+/**
+ * @brief Recognizes a range predicate on a single point column that an interval join can evaluate.
+ *
+ * The predicate must be the `LOGICAL_AND` of a lower bound and an upper bound comparison of the
+ * same point column of one table with two columns of the other table, with `LESS`, `LESS_EQUAL`,
+ * `GREATER` or `GREATER_EQUAL` operators. The three columns must have the same integral or chrono
+ * type; floating-point columns are left to the AST evaluation for its NaN semantics.
+ *
+ * @param binary_predicate The join predicate
+ * @param left The left table
+ * @param right The right table
+ * @return The columns of the range predicate, or nothing if it is not a supported range predicate
+ */
+std::optional<interval_predicate> find_interval_predicate(ast::expression const& binary_predicate,
+                                                          table_view const& left,
+                                                          table_view const& right);
+
+/**
+ * @brief Computes the inner join of the rows of the point column with the intervals containing
+ * them.
+ *
+ * The points are sorted, then the contiguous run of sorted points within each interval is found by
+ * binary searches, in O((n + m) log n) time plus the output size. The result is the same as
+ * `conditional_join` with the range predicate, in a different order.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param predicate The columns of the range predicate
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ * @return A pair of vectors [`left_indices`, `right_indices`] of the matching rows
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+interval_inner_join(table_view const& left,
+                    table_view const& right,
+                    interval_predicate const& predicate,
+                    rmm::cuda_stream_view stream,
+                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Computes the number of rows of `interval_inner_join`.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param predicate The columns of the range predicate
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The number of matching pairs of rows
+ */
+std::size_t interval_inner_join_size(table_view const& left,
+                                     table_view const& right,
+                                     interval_predicate const& predicate,
+                                     rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/join.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// A split-block Bloom filter is made of 256-bit blocks of eight 32-bit words
+constexpr int split_block_words = 8;
+
+// Largest size of a filter bitset
+constexpr std::size_t max_bloom_filter_bytes = 128 * 1024 * 1024;
+
+// Salts of the split-block Bloom filter, as defined by the Parquet specification
+__device__ __constant__ uint32_t bloom_filter_salt[split_block_words] = {
+  0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U,
+  0x5c6bfb31U};
+
+/**
+ * @brief Maps a row hash to the index of its filter block and to the key that selects the bits of
+ * the block.
+ *
+ * The row hashes are only 32 bits wide, so the key is a remix of the hash, to keep the selected
+ * bits independent of the block index.
+ */
+__device__ thrust::pair<std::size_t, uint32_t> block_and_key(hash_value_type hash,
+                                                             std::size_t num_blocks)
+{
+  auto const block_idx = (static_cast<uint64_t>(hash) * num_blocks) >> 32;
+  // finalizer of MurmurHash3
+  auto key = hash;
+  key ^= key >> 16;
+  key *= 0x85ebca6bU;
+  key ^= key >> 13;
+  key *= 0xc2b2ae35U;
+  key ^= key >> 16;
+  return {block_idx, key};
+}
+
+template <typename Hasher>
+struct insert_keys_fn {
+  Hasher hasher;
+  bitmask_type const* row_bitmask;
+  uint32_t* bitset;
+  std::size_t num_blocks;
+
+  __device__ void operator()(size_type row) const
+  {
+    if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) { return; }
+    auto const [block_idx, key] = block_and_key(hasher(row), num_blocks);
+    auto const block            = bitset + block_idx * split_block_words;
+#pragma unroll
+    for (int i = 0; i < split_block_words; ++i) {
+      atomicOr(block + i, uint32_t{1} << ((key * bloom_filter_salt[i]) >> 27));
+    }
+  }
+};
+
+template <typename Hasher>
+struct contains_keys_fn {
+  Hasher hasher;
+  bitmask_type const* row_bitmask;
+  uint32_t const* bitset;
+  std::size_t num_blocks;
+
+  __device__ bool operator()(size_type row) const
+  {
+    if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) { return false; }
+    auto const [block_idx, key] = block_and_key(hasher(row), num_blocks);
+    auto const block            = bitset + block_idx * split_block_words;
+#pragma unroll
+    for (int i = 0; i < split_block_words; ++i) {
+      if ((block[i] & (uint32_t{1} << ((key * bloom_filter_salt[i]) >> 27))) == 0) { return false; }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Computes the number of filter blocks for the given number of keys and false positive
+ * rate.
+ *
+ * Uses the bits per key of a split-block Bloom filter recommended by the Parquet specification:
+ * `-8 / log(1 - fpp^(1/8))`.
+ */
+std::size_t num_filter_blocks(size_type num_keys, double false_positive_rate)
+{
+  auto const bits_per_key = -8.0 / std::log(1.0 - std::pow(false_positive_rate, 1.0 / 8));
+  auto const num_bytes    = std::min(
+    static_cast<std::size_t>(std::ceil(num_keys * bits_per_key / 8)), max_bloom_filter_bytes);
+  auto constexpr block_bytes = split_block_words * sizeof(uint32_t);
+  return std::max<std::size_t>(cudf::util::div_rounding_up_safe(num_bytes, block_bytes), 1);
+}
+
+/**
+ * @brief Returns the mask of the rows without null keys, or an empty buffer if all rows may match.
+ */
+rmm::device_buffer matching_rows_mask(table_view const& keys,
+                                      null_equality compare_nulls,
+                                      rmm::cuda_stream_view stream)
+{
+  if (compare_nulls == null_equality::EQUAL) { return rmm::device_buffer{0, stream}; }
+  return cudf::detail::bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first;
+}
+
+bool keeps_key_range(table_view const& build, null_equality compare_nulls)
+{
+  if (build.num_columns() != 1) { return false; }
+  auto const& col = build.column(0);
+  auto const type = col.type();
+  return ((cudf::is_numeric(type) and not cudf::is_boolean(type)) or cudf::is_chrono(type)) and
+         (compare_nulls == null_equality::UNEQUAL or not col.has_nulls());
+}
+
+}  // namespace
+}  // namespace detail
+
+join_bloom_filter::~join_bloom_filter() = default;
+
+join_bloom_filter::join_bloom_filter(join_bloom_filter&&) = default;
+
+join_bloom_filter& join_bloom_filter::operator=(join_bloom_filter&&) = default;
+
+join_bloom_filter::join_bloom_filter(cudf::table_view const& build,
+                                     double false_positive_rate,
+                                     null_equality compare_nulls,
+                                     rmm::cuda_stream_view stream)
+  : _compare_nulls{compare_nulls},
+    _num_columns{build.num_columns()},
+    _bitset{detail::num_filter_blocks(build.num_rows(), false_positive_rate) *
+              detail::split_block_words,
+            stream}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != build.num_columns(), "Join Bloom filter build table is empty");
+  CUDF_EXPECTS(false_positive_rate > 0 and false_positive_rate < 1,
+               "The false positive rate must be in the range (0, 1)");
+
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(_bitset.data(), 0, _bitset.size() * sizeof(uint32_t), stream.value()));
+  if (build.num_rows() == 0) { return; }
+
+  auto const row_bitmask = detail::matching_rows_mask(build, compare_nulls, stream);
+  auto const row_hash    = cudf::experimental::row::hash::row_hasher{build, stream};
+  auto const hasher      = row_hash.device_hasher(nullate::DYNAMIC{cudf::has_nested_nulls(build)});
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    build.num_rows(),
+    detail::insert_keys_fn<decltype(hasher)>{
+      hasher,
+      static_cast<bitmask_type const*>(row_bitmask.data()),
+      _bitset.data(),
+      _bitset.size() / detail::split_block_words});
+
+  if (detail::keeps_key_range(build, compare_nulls)) {
+    auto const& col = build.column(0);
+    auto const mr   = rmm::mr::get_current_device_resource();
+    auto min_key    = reduction::detail::reduce(
+      col, *make_min_aggregation<reduce_aggregation>(), col.type(), std::nullopt, stream, mr);
+    auto max_key = reduction::detail::reduce(
+      col, *make_max_aggregation<reduce_aggregation>(), col.type(), std::nullopt, stream, mr);
+    if (min_key->is_valid(stream)) {
+      _min_key = std::move(min_key);
+      _max_key = std::move(max_key);
+    }
+  }
+}
+
+std::unique_ptr<column> join_bloom_filter::contains(cudf::table_view const& probe,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(probe.num_columns() == _num_columns,
+               "Mismatch in number of columns of the probe and build tables");
+
+  auto result = make_numeric_column(
+    data_type{type_id::BOOL8}, probe.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (probe.num_rows() == 0) { return result; }
+
+  auto const row_bitmask = detail::matching_rows_mask(probe, _compare_nulls, stream);
+  auto const row_hash    = cudf::experimental::row::hash::row_hasher{probe, stream};
+  auto const hasher      = row_hash.device_hasher(nullate::DYNAMIC{cudf::has_nested_nulls(probe)});
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(probe.num_rows()),
+                    result->mutable_view().begin<bool>(),
+                    detail::contains_keys_fn<decltype(hasher)>{
+                      hasher,
+                      static_cast<bitmask_type const*>(row_bitmask.data()),
+                      _bitset.data(),
+                      _bitset.size() / detail::split_block_words});
+  return result;
+}
+
+std::unique_ptr<table> filter_by_bloom(cudf::table_view const& input,
+                                       cudf::table_view const& keys,
+                                       join_bloom_filter const& filter,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows of the input and key tables");
+  auto const matches = filter.contains(keys, stream, rmm::mr::get_current_device_resource());
+  return detail::apply_boolean_mask(input, matches->view(), stream, mr);
+}
+
+}  // namespace cudf
@@ -20,6 +20,8 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/hashing/detail/default_hash.cuh>
+#include <cudf/hashing/detail/fixed_width_row_hasher.cuh>
 #include <cudf/table/experimental/row_operators.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -176,8 +178,10 @@ void build_join_hash_table(
   CUDF_EXPECTS(0 != build.num_columns(), "Selected build dataset is empty");
   CUDF_EXPECTS(0 != build.num_rows(), "Build side table has no rows");
 
-  auto const row_hash   = experimental::row::hash::row_hasher{preprocessed_build};
-  auto const hash_build = row_hash.device_hasher(nullate::DYNAMIC{has_nulls});
+  auto const build_nulls = nullate::DYNAMIC{has_nulls};
+  auto const row_hash    = experimental::row::hash::row_hasher{preprocessed_build};
+  auto const hash_build  = cudf::hashing::detail::make_fixed_width_row_hasher<
+    cudf::hashing::detail::default_hash>(build, row_hash.device_hasher(build_nulls));
 
   auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
   make_pair_function pair_func{hash_build, empty_key_sentinel};
@@ -36,12 +36,81 @@
 #include <thrust/fill.h>
 #include <thrust/scan.h>
 
+#include <memory>
 #include <optional>
 #include <utility>
 
 namespace cudf {
 namespace detail {
 
+/**
+ * @brief Hash table of the equality table of the build side of a mixed join.
+ */
+class mixed_hash_join {
+ public:
+  /**
+   * @brief Builds the hash table of the rows of `build`.
+   *
+   * @param build The equality table of the build side, which must have rows
+   * @param compare_nulls Whether or not null values join to each other or not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  mixed_hash_join(table_view const& build,
+                  null_equality compare_nulls,
+                  rmm::cuda_stream_view stream)
+    : _hash_table{compute_hash_table_size(build.num_rows()),
+                  cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+                  cuco::empty_value{cudf::detail::JoinNoneValue},
+                  stream.value(),
+                  cudf::detail::cuco_allocator{stream}},
+      _preprocessed_build{experimental::row::equality::preprocessed_table::create(build, stream)}
+  {
+    // TODO: To add support for nested columns we will need to flatten in many
+    // places. However, this probably isn't worth adding any time soon since we
+    // won't be able to support AST conditions for those types anyway.
+    auto const row_bitmask =
+      cudf::detail::bitmask_and(build, stream, rmm::mr::get_current_device_resource()).first;
+    build_join_hash_table(build,
+                          _preprocessed_build,
+                          _hash_table,
+                          cudf::has_nulls(build),
+                          compare_nulls,
+                          static_cast<bitmask_type const*>(row_bitmask.data()),
+                          stream);
+  }
+
+  /**
+   * @brief Returns the device view of the hash table.
+   */
+  [[nodiscard]] mixed_multimap_type::device_view view() const
+  {
+    return _hash_table.get_device_view();
+  }
+
+  /**
+   * @brief Returns the build table preprocessed for row comparisons.
+   */
+  [[nodiscard]] std::shared_ptr<experimental::row::equality::preprocessed_table> const&
+  preprocessed_build() const
+  {
+    return _preprocessed_build;
+  }
+
+ private:
+  // Don't use multimap_type because we want a CG size of 1.
+  mixed_multimap_type _hash_table;
+  std::shared_ptr<experimental::row::equality::preprocessed_table> _preprocessed_build;
+};
+
+namespace {
+
+/**
+ * @brief Performs a mixed join, probing the hash table of the build side given by the caller or,
+ * if there is none, built here.
+ *
+ * A given hash table is always the one of the right equality table, so the left tables are the
+ * probe side whatever their sizes.
+ */
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 mixed_join(
@@ -53,6 +122,7 @@ mixed_join(
   null_equality compare_nulls,
   join_kind join_type,
   std::optional<std::pair<std::size_t, device_span<size_type const>>> const& output_size_data,
+  mixed_hash_join const* right_hash_table,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
@@ -66,7 +136,8 @@ mixed_join(
 
   auto const right_num_rows{right_conditional.num_rows()};
   auto const left_num_rows{left_conditional.num_rows()};
-  auto const swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
+  auto const swap_tables = (right_hash_table == nullptr) && (join_type == join_kind::INNER_JOIN) &&
+                           (right_num_rows > left_num_rows);
 
   // The "outer" table is the larger of the two tables. The kernels are
   // launched with one thread per row of the outer table, which also means that
@@ -127,28 +198,11 @@ mixed_join(
   auto probe_view = table_device_view::create(probe, stream);
   auto build_view = table_device_view::create(build, stream);
 
-  // Don't use multimap_type because we want a CG size of 1.
-  mixed_multimap_type hash_table{compute_hash_table_size(build.num_rows()),
-                                 cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
-                                 cuco::empty_value{cudf::detail::JoinNoneValue},
-                                 stream.value(),
-                                 cudf::detail::cuco_allocator{stream}};
-
-  // TODO: To add support for nested columns we will need to flatten in many
-  // places. However, this probably isn't worth adding any time soon since we
-  // won't be able to support AST conditions for those types anyway.
-  auto const row_bitmask =
-    cudf::detail::bitmask_and(build, stream, rmm::mr::get_current_device_resource()).first;
-  auto const preprocessed_build =
-    experimental::row::equality::preprocessed_table::create(build, stream);
-  build_join_hash_table(build,
-                        preprocessed_build,
-                        hash_table,
-                        has_nulls,
-                        compare_nulls,
-                        static_cast<bitmask_type const*>(row_bitmask.data()),
-                        stream);
-  auto hash_table_view = hash_table.get_device_view();
+  std::optional<mixed_hash_join> built_hash_table;
+  if (right_hash_table == nullptr) { built_hash_table.emplace(build, compare_nulls, stream); }
+  auto const& hash_table         = right_hash_table ? *right_hash_table : *built_hash_table;
+  auto const& preprocessed_build = hash_table.preprocessed_build();
+  auto hash_table_view           = hash_table.view();
 
   auto left_conditional_view  = table_device_view::create(left_conditional, stream);
   auto right_conditional_view = table_device_view::create(right_conditional, stream);
@@ -295,6 +349,10 @@ mixed_join(
   return join_indices;
 }
 
+/**
+ * @brief Computes the output size of a mixed join and the number of matches of each probe row,
+ * with the hash table of the build side given by the caller or, if there is none, built here.
+ */
 std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
 compute_mixed_join_output_size(table_view const& left_equality,
                                table_view const& right_equality,
@@ -303,6 +361,7 @@ compute_mixed_join_output_size(table_view const& left_equality,
                                ast::expression const& binary_predicate,
                                null_equality compare_nulls,
                                join_kind join_type,
+                               mixed_hash_join const* right_hash_table,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
@@ -324,7 +383,8 @@ compute_mixed_join_output_size(table_view const& left_equality,
 
   auto const right_num_rows{right_conditional.num_rows()};
   auto const left_num_rows{left_conditional.num_rows()};
-  auto const swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
+  auto const swap_tables = (right_hash_table == nullptr) && (join_type == join_kind::INNER_JOIN) &&
+                           (right_num_rows > left_num_rows);
 
   // The "outer" table is the larger of the two tables. The kernels are
   // launched with one thread per row of the outer table, which also means that
@@ -392,28 +452,11 @@ compute_mixed_join_output_size(table_view const& left_equality,
   auto probe_view = table_device_view::create(probe, stream);
   auto build_view = table_device_view::create(build, stream);
 
-  // Don't use multimap_type because we want a CG size of 1.
-  mixed_multimap_type hash_table{compute_hash_table_size(build.num_rows()),
-                                 cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
-                                 cuco::empty_value{cudf::detail::JoinNoneValue},
-                                 stream.value(),
-                                 cudf::detail::cuco_allocator{stream}};
-
-  // TODO: To add support for nested columns we will need to flatten in many
-  // places. However, this probably isn't worth adding any time soon since we
-  // won't be able to support AST conditions for those types anyway.
-  auto const row_bitmask =
-    cudf::detail::bitmask_and(build, stream, rmm::mr::get_current_device_resource()).first;
-  auto const preprocessed_build =
-    experimental::row::equality::preprocessed_table::create(build, stream);
-  build_join_hash_table(build,
-                        preprocessed_build,
-                        hash_table,
-                        has_nulls,
-                        compare_nulls,
-                        static_cast<bitmask_type const*>(row_bitmask.data()),
-                        stream);
-  auto hash_table_view = hash_table.get_device_view();
+  std::optional<mixed_hash_join> built_hash_table;
+  if (right_hash_table == nullptr) { built_hash_table.emplace(build, compare_nulls, stream); }
+  auto const& hash_table         = right_hash_table ? *right_hash_table : *built_hash_table;
+  auto const& preprocessed_build = hash_table.preprocessed_build();
+  auto hash_table_view           = hash_table.view();
 
   auto left_conditional_view  = table_device_view::create(left_conditional, stream);
   auto right_conditional_view = table_device_view::create(right_conditional, stream);
@@ -471,6 +514,7 @@ compute_mixed_join_output_size(table_view const& left_equality,
   return {size.value(stream), std::move(matches_per_row)};
 }
 
+}  // namespace
 }  // namespace detail
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -494,6 +538,7 @@ mixed_inner_join(
                             compare_nulls,
                             detail::join_kind::INNER_JOIN,
                             output_size_data,
+                            nullptr,
                             cudf::get_default_stream(),
                             mr);
 }
@@ -515,6 +560,7 @@ std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>> mixed_in
                                                 binary_predicate,
                                                 compare_nulls,
                                                 detail::join_kind::INNER_JOIN,
+                                                nullptr,
                                                 cudf::get_default_stream(),
                                                 mr);
 }
@@ -540,6 +586,7 @@ mixed_left_join(
                             compare_nulls,
                             detail::join_kind::LEFT_JOIN,
                             output_size_data,
+                            nullptr,
                             cudf::get_default_stream(),
                             mr);
 }
@@ -561,6 +608,7 @@ std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>> mixed_le
                                                 binary_predicate,
                                                 compare_nulls,
                                                 detail::join_kind::LEFT_JOIN,
+                                                nullptr,
                                                 cudf::get_default_stream(),
                                                 mr);
 }
@@ -586,8 +634,138 @@ mixed_full_join(
                             compare_nulls,
                             detail::join_kind::FULL_JOIN,
                             output_size_data,
+                            nullptr,
                             cudf::get_default_stream(),
                             mr);
 }
 
+mixed_hash_join::mixed_hash_join(table_view const& right_equality,
+                                 table_view const& right_conditional,
+                                 null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream)
+  : _right_equality{right_equality},
+    _right_conditional{right_conditional},
+    _compare_nulls{compare_nulls}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(right_conditional.num_rows() == right_equality.num_rows(),
+               "The right conditional and equality tables must have the same number of rows.");
+  // The joins with an empty right table return before probing
+  if (right_equality.num_rows() > 0) {
+    _impl = std::make_unique<detail::mixed_hash_join const>(right_equality, compare_nulls, stream);
+  }
+}
+
+mixed_hash_join::~mixed_hash_join() = default;
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_hash_join::inner_join(
+  table_view const& left_equality,
+  table_view const& left_conditional,
+  ast::expression const& binary_predicate,
+  std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::mixed_join(left_equality,
+                            _right_equality,
+                            left_conditional,
+                            _right_conditional,
+                            binary_predicate,
+                            _compare_nulls,
+                            detail::join_kind::INNER_JOIN,
+                            output_size_data,
+                            _impl.get(),
+                            stream,
+                            mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_hash_join::left_join(
+  table_view const& left_equality,
+  table_view const& left_conditional,
+  ast::expression const& binary_predicate,
+  std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::mixed_join(left_equality,
+                            _right_equality,
+                            left_conditional,
+                            _right_conditional,
+                            binary_predicate,
+                            _compare_nulls,
+                            detail::join_kind::LEFT_JOIN,
+                            output_size_data,
+                            _impl.get(),
+                            stream,
+                            mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_hash_join::full_join(table_view const& left_equality,
+                           table_view const& left_conditional,
+                           ast::expression const& binary_predicate,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::mixed_join(left_equality,
+                            _right_equality,
+                            left_conditional,
+                            _right_conditional,
+                            binary_predicate,
+                            _compare_nulls,
+                            detail::join_kind::FULL_JOIN,
+                            {},
+                            _impl.get(),
+                            stream,
+                            mr);
+}
+
+std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_hash_join::inner_join_size(table_view const& left_equality,
+                                 table_view const& left_conditional,
+                                 ast::expression const& binary_predicate,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_mixed_join_output_size(left_equality,
+                                                _right_equality,
+                                                left_conditional,
+                                                _right_conditional,
+                                                binary_predicate,
+                                                _compare_nulls,
+                                                detail::join_kind::INNER_JOIN,
+                                                _impl.get(),
+                                                stream,
+                                                mr);
+}
+
+std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_hash_join::left_join_size(table_view const& left_equality,
+                                table_view const& left_conditional,
+                                ast::expression const& binary_predicate,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_mixed_join_output_size(left_equality,
+                                                _right_equality,
+                                                left_conditional,
+                                                _right_conditional,
+                                                binary_predicate,
+                                                _compare_nulls,
+                                                detail::join_kind::LEFT_JOIN,
+                                                _impl.get(),
+                                                stream,
+                                                mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/join_common_utils.hpp"
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/host_spill.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/hashing/detail/helper_functions.cuh>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/functional>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Largest number of partitions a bucket is split into at once
+constexpr std::size_t max_partitions_per_level = 256;
+// Number of times a bucket that still exceeds the memory budget is partitioned again. Buckets
+// that cannot be split further, e.g. because they only hold a single key, are joined as they are.
+constexpr int max_partition_depth = 4;
+
+/**
+ * @brief A pair of partitions of the build and probe tables holding the same hash values.
+ */
+struct spilled_bucket {
+  spilled_table build;
+  spilled_table probe;
+};
+
+/**
+ * @brief Estimates the device memory used by a join: the build and probe tables plus the hash
+ * table built from the build table.
+ */
+std::size_t join_memory_size(std::size_t tables_size, size_type build_rows)
+{
+  return tables_size + compute_hash_table_size(build_rows) * sizeof(pair_type);
+}
+
+/**
+ * @brief Joins the keys of a probe table against the keys of a build table.
+ *
+ * @return The probe and build row indices of the join result
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+join_keys(table_view const& build,
+          table_view const& probe,
+          join_kind kind,
+          null_equality compare_nulls,
+          rmm::cuda_stream_view stream,
+          rmm::mr::device_memory_resource* mr)
+{
+  auto const has_nulls = cudf::has_nested_nulls(build) || cudf::has_nested_nulls(probe)
+                           ? cudf::nullable_join::YES
+                           : cudf::nullable_join::NO;
+  cudf::hash_join hj_obj(build, has_nulls, compare_nulls, stream);
+  return kind == join_kind::INNER_JOIN ? hj_obj.inner_join(probe, std::nullopt, stream, mr)
+                                       : hj_obj.left_join(probe, std::nullopt, stream, mr);
+}
+
+/**
+ * @brief Collects the join results of the partition pairs in host memory.
+ */
+struct join_result_builder {
+  std::vector<size_type> build_indices;
+  std::vector<size_type> probe_indices;
+
+  /**
+   * @brief Maps the partition-local row indices of a join result to the original row indices and
+   * appends them to the result.
+   */
+  static void append(rmm::device_uvector<size_type>& local_indices,
+                     column_view const& original_indices,
+                     std::vector<size_type>& result,
+                     rmm::cuda_stream_view stream)
+  {
+    auto const original = original_indices.begin<size_type>();
+    auto const num_rows = original_indices.size();
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      local_indices.begin(),
+                      local_indices.end(),
+                      local_indices.begin(),
+                      cuda::proclaim_return_type<size_type>(
+                        [original, num_rows] __device__(size_type idx) {
+                          return idx >= 0 && idx < num_rows ? original[idx] : JoinNoneValue;
+                        }));
+    auto const offset = result.size();
+    result.resize(offset + local_indices.size());
+    CUDF_CUDA_TRY(cudaMemcpyAsync(result.data() + offset,
+                                  local_indices.data(),
+                                  local_indices.size() * sizeof(size_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+  }
+
+  /**
+   * @brief Joins a pair of partitions whose last column holds the original row indices.
+   */
+  void join(table_view const& build,
+            table_view const& probe,
+            join_kind kind,
+            null_equality compare_nulls,
+            rmm::cuda_stream_view stream)
+  {
+    if (probe.num_rows() == 0 || (kind == join_kind::INNER_JOIN && build.num_rows() == 0)) {
+      return;
+    }
+    std::vector<size_type> key_columns(build.num_columns() - 1);
+    std::iota(key_columns.begin(), key_columns.end(), 0);
+    auto [probe_result, build_result] =
+      join_keys(build.select(key_columns),
+                probe.select(key_columns),
+                kind,
+                compare_nulls,
+                stream,
+                rmm::mr::get_current_device_resource());
+    append(*probe_result, probe.column(key_columns.size()), probe_indices, stream);
+    append(*build_result, build.column(key_columns.size()), build_indices, stream);
+    stream.synchronize();
+  }
+};
+
+/**
+ * @brief Hash-partitions a pair of build and probe tables on their key columns, which are all
+ * columns but the last, and spills the partitions to host memory.
+ */
+std::vector<spilled_bucket> partition_and_spill(table_view const& build,
+                                                table_view const& probe,
+                                                std::size_t num_partitions,
+                                                int depth,
+                                                rmm::cuda_stream_view stream)
+{
+  std::vector<size_type> key_columns(build.num_columns() - 1);
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  // every level uses a different seed, so a bucket is not mapped again to a single partition
+  auto const seed = DEFAULT_HASH_SEED + static_cast<uint32_t>(depth);
+
+  std::vector<spilled_bucket> buckets(num_partitions);
+  auto const spill_partitions = [&](table_view const& input, auto spilled_member) {
+    auto [partitioned, offsets] = cudf::hash_partition(input,
+                                                       key_columns,
+                                                       static_cast<int>(num_partitions),
+                                                       hash_id::HASH_MURMUR3,
+                                                       seed,
+                                                       stream,
+                                                       rmm::mr::get_current_device_resource());
+    offsets.push_back(input.num_rows());
+    for (std::size_t i = 0; i < num_partitions; ++i) {
+      auto const partition = cudf::slice(partitioned->view(), {offsets[i], offsets[i + 1]}, stream);
+      buckets[i].*spilled_member = spill(partition.front(), stream);
+    }
+  };
+  spill_partitions(build, &spilled_bucket::build);
+  spill_partitions(probe, &spilled_bucket::probe);
+  return buckets;
+}
+
+std::size_t num_partitions_for(std::size_t memory_size, std::size_t memory_budget)
+{
+  return std::clamp<std::size_t>(cudf::util::div_rounding_up_safe(memory_size, memory_budget),
+                                 2,
+                                 max_partitions_per_level);
+}
+
+/**
+ * @brief Joins a pair of spilled partitions, partitioning them again while they exceed the memory
+ * budget.
+ */
+void join_bucket(spilled_bucket const& bucket,
+                 join_kind kind,
+                 std::size_t memory_budget,
+                 null_equality compare_nulls,
+                 int depth,
+                 join_result_builder& result,
+                 rmm::cuda_stream_view stream)
+{
+  if (bucket.probe.num_rows == 0 || (kind == join_kind::INNER_JOIN && bucket.build.num_rows == 0)) {
+    return;
+  }
+  std::vector<spilled_bucket> buckets;
+  {
+    auto const build_packed = unspill(bucket.build, stream);
+    auto const probe_packed = unspill(bucket.probe, stream);
+    auto const build        = cudf::unpack(build_packed);
+    auto const probe        = cudf::unpack(probe_packed);
+    auto const memory_size  = join_memory_size(
+      build_packed.gpu_data->size() + probe_packed.gpu_data->size(), build.num_rows());
+    if (memory_size <= memory_budget || depth >= max_partition_depth || build.num_rows() <= 1) {
+      result.join(build, probe, kind, compare_nulls, stream);
+      return;
+    }
+    buckets = partition_and_spill(
+      build, probe, num_partitions_for(memory_size, memory_budget), depth, stream);
+  }
+  // the partitioned tables are released before joining their partitions
+  for (auto& sub_bucket : buckets) {
+    join_bucket(sub_bucket, kind, memory_budget, compare_nulls, depth + 1, result, stream);
+    sub_bucket = {};
+  }
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_join(table_view const& left_input,
+                 table_view const& right_input,
+                 join_kind kind,
+                 std::size_t memory_budget,
+                 null_equality compare_nulls,
+                 rmm::cuda_stream_view stream,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_input.num_columns() == right_input.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(memory_budget > 0, "The memory budget must be positive");
+
+  // Make sure any dictionary columns have matched key sets.
+  // This will return any new dictionary columns created as well as updated table_views.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_input, right_input},
+    stream,
+    rmm::mr::get_current_device_resource());  // temporary objects returned
+  auto const left  = matched.second.front();
+  auto const right = matched.second.back();
+
+  // Like `inner_join`, inner joins build the hash table from the smaller table. Left joins always
+  // build it from the right table.
+  bool const swap_tables = kind == join_kind::INNER_JOIN && right.num_rows() > left.num_rows();
+  auto const& build      = swap_tables ? left : right;
+  auto const& probe      = swap_tables ? right : left;
+  auto const make_result = [&](auto&& probe_result, auto&& build_result) {
+    return swap_tables ? std::pair(std::move(build_result), std::move(probe_result))
+                       : std::pair(std::move(probe_result), std::move(build_result));
+  };
+
+  auto const memory_size = join_memory_size(
+    estimated_table_size(build, stream) + estimated_table_size(probe, stream), build.num_rows());
+  if (memory_size <= memory_budget || build.num_rows() <= 1) {
+    auto [probe_result, build_result] = join_keys(build, probe, kind, compare_nulls, stream, mr);
+    return make_result(std::move(probe_result), std::move(build_result));
+  }
+
+  std::vector<spilled_bucket> buckets;
+  {
+    // append the row indices to the keys, to map the results of the partitions back to the input
+    auto const with_row_indices = [&](table_view const& keys, rmm::device_uvector<size_type>& idx) {
+      thrust::sequence(rmm::exec_policy_nosync(stream), idx.begin(), idx.end(), 0);
+      std::vector<column_view> columns(keys.begin(), keys.end());
+      columns.emplace_back(device_span<size_type const>{idx});
+      return table_view{columns};
+    };
+    rmm::device_uvector<size_type> build_indices(build.num_rows(), stream);
+    rmm::device_uvector<size_type> probe_indices(probe.num_rows(), stream);
+    buckets = partition_and_spill(with_row_indices(build, build_indices),
+                                  with_row_indices(probe, probe_indices),
+                                  num_partitions_for(memory_size, memory_budget),
+                                  0,
+                                  stream);
+  }
+
+  join_result_builder result;
+  for (auto& bucket : buckets) {
+    join_bucket(bucket, kind, memory_budget, compare_nulls, 1, result, stream);
+    bucket = {};
+  }
+  return make_result(
+    std::make_unique<rmm::device_uvector<size_type>>(
+      cudf::detail::make_device_uvector_async(result.probe_indices, stream, mr)),
+    std::make_unique<rmm::device_uvector<size_type>>(
+      cudf::detail::make_device_uvector_async(result.build_indices, stream, mr)));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left_keys,
+                       table_view const& right_keys,
+                       std::size_t memory_budget,
+                       null_equality compare_nulls,
+                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join(left_keys,
+                                  right_keys,
+                                  detail::join_kind::INNER_JOIN,
+                                  memory_budget,
+                                  compare_nulls,
+                                  cudf::get_default_stream(),
+                                  mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_left_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::size_t memory_budget,
+                      null_equality compare_nulls,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join(left_keys,
+                                  right_keys,
+                                  detail::join_kind::LEFT_JOIN,
+                                  memory_budget,
+                                  compare_nulls,
+                                  cudf::get_default_stream(),
+                                  mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/join_common_utils.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/labeling/label_segments.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Bounds of the run of right rows equal to each left row.
+ */
+struct matching_run {
+  size_type const* lower;
+  size_type const* upper;
+  bitmask_type const* row_bitmask;  // rows with null keys that never match, or nullptr
+
+  __device__ bool has_match(size_type row) const
+  {
+    return (row_bitmask == nullptr or bit_is_set(row_bitmask, row)) and lower[row] < upper[row];
+  }
+
+  __device__ size_type num_matches(size_type row) const
+  {
+    return has_match(row) ? upper[row] - lower[row] : 0;
+  }
+};
+
+/**
+ * @brief Number of output rows of each left row; zero past the last row, for the offsets scan.
+ */
+struct output_size_fn {
+  matching_run run;
+  size_type num_rows;
+  bool keeps_unmatched;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    if (row >= num_rows) { return 0; }
+    auto const num_matches = run.num_matches(row);
+    return keeps_unmatched and num_matches == 0 ? 1 : num_matches;
+  }
+};
+
+/**
+ * @brief Right row index of each output row, from the left row index and its output offsets.
+ */
+struct right_index_fn {
+  matching_run run;
+  size_type const* offsets;
+
+  __device__ size_type operator()(size_type idx, size_type left_row) const
+  {
+    return run.has_match(left_row) ? run.lower[left_row] + (idx - offsets[left_row])
+                                   : JoinNoneValue;
+  }
+};
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_join(table_view const& left_input,
+            table_view const& right_input,
+            std::vector<order> const& column_order,
+            std::vector<null_order> const& null_precedence,
+            join_kind kind,
+            null_equality compare_nulls,
+            rmm::cuda_stream_view stream,
+            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_input.num_columns() == right_input.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  // Make sure any dictionary columns have matched key sets.
+  // This will return any new dictionary columns created as well as updated table_views.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_input, right_input},
+    stream,
+    rmm::mr::get_current_device_resource());  // temporary objects returned
+  auto const left  = matched.second.front();
+  auto const right = matched.second.back();
+
+  // The equal right rows of each left row are the range between its lower and upper bounds
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const lower =
+    cudf::detail::lower_bound(right, left, column_order, null_precedence, stream, temp_mr);
+  auto const upper =
+    cudf::detail::upper_bound(right, left, column_order, null_precedence, stream, temp_mr);
+  // The row comparator matches null keys, so the left rows with null keys are masked out
+  auto const row_bitmask = compare_nulls == null_equality::EQUAL
+                             ? rmm::device_buffer{0, stream}
+                             : cudf::detail::bitmask_and(left, stream, temp_mr).first;
+  auto const run = matching_run{lower->view().data<size_type>(),
+                                upper->view().data<size_type>(),
+                                static_cast<bitmask_type const*>(row_bitmask.data())};
+
+  rmm::device_uvector<size_type> offsets(left.num_rows() + 1, stream);
+  auto const sizes_it = cudf::detail::make_counting_transform_iterator(
+    0, output_size_fn{run, left.num_rows(), kind == join_kind::LEFT_JOIN});
+  auto const output_size =
+    cudf::detail::sizes_to_offsets(sizes_it, sizes_it + offsets.size(), offsets.begin(), stream);
+  CUDF_EXPECTS(output_size <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+               "Size of output exceeds the column size limit",
+               std::overflow_error);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  cudf::detail::label_segments(
+    offsets.begin(), offsets.end(), left_indices->begin(), left_indices->end(), stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(output_size),
+                    left_indices->begin(),
+                    right_indices->begin(),
+                    right_index_fn{run, offsets.data()});
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_inner_join(table_view const& left_keys,
+                  table_view const& right_keys,
+                  std::vector<order> const& column_order,
+                  std::vector<null_order> const& null_precedence,
+                  null_equality compare_nulls,
+                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_join(left_keys,
+                             right_keys,
+                             column_order,
+                             null_precedence,
+                             detail::join_kind::INNER_JOIN,
+                             compare_nulls,
+                             cudf::get_default_stream(),
+                             mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_left_join(table_view const& left_keys,
+                 table_view const& right_keys,
+                 std::vector<order> const& column_order,
+                 std::vector<null_order> const& null_precedence,
+                 null_equality compare_nulls,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_join(left_keys,
+                             right_keys,
+                             column_order,
+                             null_precedence,
+                             detail::join_kind::LEFT_JOIN,
+                             compare_nulls,
+                             cudf::get_default_stream(),
+                             mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/join_common_utils.cuh"
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/functional>
+#include <thrust/transform.h>
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Largest magnitude of a bucket, so that the neighbor buckets of any value do not overflow
+constexpr double max_bucket = static_cast<double>(int64_t{1} << 62);
+
+/**
+ * @brief Returns the buckets of width `tolerance` of the values of `on`, shifted by `offset`.
+ *
+ * Values that differ by less than the tolerance are in the same or adjacent buckets. The buckets of
+ * values too large to be numbered are clamped, and NaNs share bucket 0: pairs of such values are
+ * still compared, the condition of the join decides whether they match.
+ */
+template <typename T>
+std::unique_ptr<column> make_buckets(column_view const& on,
+                                     double tolerance,
+                                     int64_t offset,
+                                     rmm::cuda_stream_view stream)
+{
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto buckets       = make_numeric_column(data_type{type_id::INT64},
+                                           on.size(),
+                                           detail::copy_bitmask(on, stream, temp_mr),
+                                           on.null_count(),
+                                           stream,
+                                           temp_mr);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    on.begin<T>(),
+                    on.end<T>(),
+                    buckets->mutable_view().begin<int64_t>(),
+                    cuda::proclaim_return_type<int64_t>([tolerance, offset] __device__(T value) {
+                      auto const bucket = floor(static_cast<double>(value) / tolerance);
+                      if (isnan(bucket)) { return offset; }
+                      return static_cast<int64_t>(fmin(fmax(bucket, -max_bucket), max_bucket)) +
+                             offset;
+                    }));
+  return buckets;
+}
+
+struct tolerance_join_fn {
+  template <typename T, typename... Args>
+  std::enable_if_t<not std::is_floating_point_v<T>,
+                   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                             std::unique_ptr<rmm::device_uvector<size_type>>>>
+  operator()(Args&&...) const
+  {
+    CUDF_FAIL("Tolerance joins require floating-point on columns", cudf::data_type_error);
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_floating_point_v<T>,
+                   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                             std::unique_ptr<rmm::device_uvector<size_type>>>>
+  operator()(table_view const& left_keys,
+             table_view const& right_keys,
+             column_view const& left_on,
+             column_view const& right_on,
+             double tolerance,
+             null_equality compare_nulls,
+             rmm::cuda_stream_view stream,
+             rmm::mr::device_memory_resource* mr) const
+  {
+    // abs(left.on - right.on) < tolerance, evaluated in the type of the on columns
+    auto tolerance_scalar        = numeric_scalar<T>(static_cast<T>(tolerance), true, stream);
+    auto const tolerance_literal = ast::literal(tolerance_scalar);
+    auto const left_ref          = ast::column_reference(0, ast::table_reference::LEFT);
+    auto const right_ref         = ast::column_reference(0, ast::table_reference::RIGHT);
+    auto const difference        = ast::operation(ast::ast_operator::SUB, left_ref, right_ref);
+    auto const distance          = ast::operation(ast::ast_operator::ABS, difference);
+
+    auto const predicate = ast::operation(ast::ast_operator::LESS, distance, tolerance_literal);
+
+    // The equality keys are the keys followed by the bucket of the on value
+    auto const with_buckets = [](table_view const& keys, column_view const& buckets) {
+      std::vector<column_view> columns(keys.begin(), keys.end());
+      columns.push_back(buckets);
+      return table_view{columns};
+    };
+
+    auto const right_buckets  = make_buckets<T>(right_on, tolerance, 0, stream);
+    auto const right_equality = with_buckets(right_keys, right_buckets->view());
+    cudf::mixed_hash_join const hash_table(
+      right_equality, table_view{{right_on}}, compare_nulls, stream);
+
+    // A right value within the tolerance is in the bucket of the left value or a neighbor one,
+    // and each right bucket is probed from a single one of the three
+    std::vector<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                          std::unique_ptr<rmm::device_uvector<size_type>>>>
+      matches;
+    for (auto const offset : {int64_t{-1}, int64_t{0}, int64_t{1}}) {
+      auto const left_buckets = make_buckets<T>(left_on, tolerance, offset, stream);
+      matches.push_back(hash_table.inner_join(with_buckets(left_keys, left_buckets->view()),
+                                              table_view{{left_on}},
+                                              predicate,
+                                              {},
+                                              stream,
+                                              mr));
+    }
+    auto result = concatenate_vector_pairs(matches[0], matches[1], stream);
+    return concatenate_vector_pairs(result, matches[2], stream);
+  }
+};
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+tolerance_inner_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     column_view const& left_on,
+                     column_view const& right_on,
+                     double tolerance,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(left_keys.num_columns() == 0 or left_keys.num_rows() == left_on.size(),
+               "Mismatch in number of rows of the left keys and on column");
+  CUDF_EXPECTS(right_keys.num_columns() == 0 or right_keys.num_rows() == right_on.size(),
+               "Mismatch in number of rows of the right keys and on column");
+  CUDF_EXPECTS(left_on.type() == right_on.type(),
+               "Mismatch in types of the on columns",
+               cudf::data_type_error);
+  CUDF_EXPECTS(tolerance > 0 and std::isfinite(tolerance),
+               "The tolerance must be positive and finite",
+               std::invalid_argument);
+
+  return type_dispatcher(left_on.type(),
+                         tolerance_join_fn{},
+                         left_keys,
+                         right_keys,
+                         left_on,
+                         right_on,
+                         tolerance,
+                         compare_nulls,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+tolerance_inner_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     column_view const& left_on,
+                     column_view const& right_on,
+                     double tolerance,
+                     null_equality compare_nulls,
+                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tolerance_inner_join(left_keys,
+                                      right_keys,
+                                      left_on,
+                                      right_on,
+                                      tolerance,
+                                      compare_nulls,
+                                      cudf::get_default_stream(),
+                                      mr);
+}
+
+}  // namespace cudf
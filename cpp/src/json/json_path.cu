@@ -23,6 +23,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/json/json.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -43,6 +44,11 @@
 #include <thrust/scan.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -228,10 +234,12 @@ class json_state : private parser {
   __device__ json_state() : parser() {}
   __device__ json_state(char const* _input,
                         int64_t _input_len,
-                        cudf::get_json_object_options _options)
+                        cudf::get_json_object_options _options,
+                        bool _warp_cooperative = false)
     : parser(_input, _input_len),
 
-      options(_options)
+      options(_options),
+      warp_cooperative(_warp_cooperative)
   {
   }
 
@@ -240,7 +248,8 @@ class json_state : private parser {
       cur_el_start(j.cur_el_start),
       cur_el_type(j.cur_el_type),
       parent_el_type(j.parent_el_type),
-      options(j.options)
+      options(j.options),
+      warp_cooperative(j.warp_cooperative)
   {
   }
 
@@ -264,7 +273,11 @@ class json_state : private parser {
       }
     }
     // otherwise, march through everything inside
-    else {
+    else if (warp_cooperative) {
+      pos = end;
+      if (skip_nested_warp() != parse_result::SUCCESS) { return parse_result::ERROR; }
+      end = pos;
+    } else {
       int obj_count = 0;
       int arr_count = 0;
 
@@ -427,9 +440,93 @@ class json_state : private parser {
 
     // string or number?
     string_view unused;
+    if (warp_cooperative && is_quote(*pos)) { return skip_string_warp(); }
     return is_quote(*pos) ? parse_string(unused, false, *pos) : parse_non_string_value(unused);
   }
 
+  /**
+   * @brief Skips the quote-enclosed string at the current position with all lanes of the warp.
+   *
+   * Each lane looks at one of the next `warp_size` characters so that the closing quote is found
+   * a warp-width at a time. Escape sequences are validated the same way `parse_string` does.
+   * Must be called by all lanes of the warp with the same state.
+   *
+   * @returns A result code indicating success or failure.
+   */
+  __device__ parse_result skip_string_warp()
+  {
+    auto const lane  = static_cast<int>(threadIdx.x % cudf::detail::warp_size);
+    char const quote = *pos++;
+    while (!eof()) {
+      char const* const p = pos + lane;
+      auto const mask = __ballot_sync(0xffff'ffffu, !eof(p) && (*p == quote || *p == '\\'));
+      if (mask == 0) {
+        auto const remaining = input_len - (pos - input);
+        pos += remaining < cudf::detail::warp_size ? remaining : cudf::detail::warp_size;
+        continue;
+      }
+      pos += __ffs(mask) - 1;
+      if (*pos == quote) {
+        pos++;
+        return parse_result::SUCCESS;
+      }
+      if (!parse_escape_seq()) { return parse_result::ERROR; }
+    }
+    return parse_result::ERROR;
+  }
+
+  /**
+   * @brief Skips the object or array starting at the current position with all lanes of the warp.
+   *
+   * Between strings, the bracket depths of the next `warp_size` characters are computed with a
+   * warp prefix sum and the first character that closes the element ends the scan. Strings are
+   * skipped with `skip_string_warp`. Must be called by all lanes of the warp with the same state.
+   *
+   * @returns A result code indicating success or failure.
+   */
+  __device__ parse_result skip_nested_warp()
+  {
+    constexpr auto full_mask = 0xffff'ffffu;
+    auto const lane          = static_cast<int>(threadIdx.x % cudf::detail::warp_size);
+    auto const inclusive_sum = [lane](int value) {
+      for (int delta = 1; delta < cudf::detail::warp_size; delta *= 2) {
+        auto const other = __shfl_up_sync(full_mask, value, delta);
+        if (lane >= delta) { value += other; }
+      }
+      return value;
+    };
+
+    int obj_count = 0;
+    int arr_count = 0;
+    while (!eof()) {
+      char const* const p = pos + lane;
+      char const c        = eof(p) ? '\0' : *p;
+      // characters before the first quote or the end of the input are scanned in this step
+      auto const quotes    = __ballot_sync(full_mask, !eof(p) && is_quote(c));
+      auto const in_bounds = __ballot_sync(full_mask, !eof(p));
+      auto const num_chars = quotes != 0 ? __ffs(quotes) - 1 : __popc(in_bounds);
+      auto const in_scan   = lane < num_chars;
+
+      auto const obj_depth = obj_count + inclusive_sum(in_scan ? (c == '{') - (c == '}') : 0);
+      auto const arr_depth = arr_count + inclusive_sum(in_scan ? (c == '[') - (c == ']') : 0);
+      auto const closed = __ballot_sync(full_mask, in_scan && obj_depth == 0 && arr_depth == 0);
+      if (closed != 0) {
+        pos += __ffs(closed);
+        return parse_result::SUCCESS;
+      }
+      if (num_chars > 0) {
+        obj_count = __shfl_sync(full_mask, obj_depth, num_chars - 1);
+        arr_count = __shfl_sync(full_mask, arr_depth, num_chars - 1);
+        pos += num_chars;
+      }
+      if (quotes != 0) {
+        if (skip_string_warp() != parse_result::SUCCESS) { return parse_result::ERROR; }
+        if (obj_count == 0 && arr_count == 0) { return parse_result::SUCCESS; }
+      }
+    }
+    return (obj_count > 0 || arr_count > 0) ? parse_result::ERROR : parse_result::SUCCESS;
+  }
+
   __device__ parse_result next_element_internal(bool child)
   {
     // if we're not getting a child element, skip the current element.
@@ -493,6 +590,7 @@ class json_state : private parser {
   json_element_type cur_el_type{json_element_type::NONE};     // type of the current element
   json_element_type parent_el_type{json_element_type::NONE};  // parent element type
   get_json_object_options options;                            // behavior options
+  bool warp_cooperative{false};  // whether all lanes of a warp scan this same state together
 };
 
 enum class path_operator_type { ROOT, CHILD, CHILD_WILDCARD, CHILD_INDEX, ERROR, END };
@@ -648,14 +746,15 @@ class path_state : private parser {
 };
 
 /**
- * @brief Preprocess the incoming JSONPath string on the host to generate a
- * command buffer for use by the GPU.
+ * @brief Preprocess the incoming JSONPath string on the host to generate the
+ * commands for use by the GPU.
  *
  * @param json_path The incoming json path
  * @param stream Cuda stream to perform any gpu actions on
- * @returns A pair containing the command buffer, and maximum stack depth required.
+ * @returns A pair containing the commands, empty for an empty query, and the maximum stack depth
+ * required.
  */
-std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_command_buffer(
+std::pair<std::vector<path_operator>, int> build_command_buffer(
   cudf::string_scalar const& json_path, rmm::cuda_stream_view stream)
 {
   std::string h_json_path = json_path.to_string(stream);
@@ -689,10 +788,8 @@ std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_comma
   } while (op.type != path_operator_type::END);
 
   auto const is_empty = h_operators.size() == 1 && h_operators[0].type == path_operator_type::END;
-  return is_empty ? std::pair(thrust::nullopt, 0)
-                  : std::pair(thrust::make_optional(cudf::detail::make_device_uvector_sync(
-                                h_operators, stream, rmm::mr::get_current_device_resource())),
-                              max_stack_depth);
+  return is_empty ? std::pair(std::vector<path_operator>{}, 0)
+                  : std::pair(std::move(h_operators), max_stack_depth);
 }
 
 #define PARSE_TRY(_x)                                                       \
@@ -880,6 +977,7 @@ constexpr int max_command_stack_depth = 8;
  * step)
  * @param out_buf_size Size of the output buffer
  * @param options Options controlling behavior
+ * @param warp_cooperative Whether all lanes of the warp parse this string together
  * @returns A pair containing the result code the output buffer.
  */
 __device__ thrust::pair<parse_result, json_output> get_json_object_single(
@@ -888,9 +986,10 @@ __device__ thrust::pair<parse_result, json_output> get_json_object_single(
   path_operator const* const commands,
   char* out_buf,
   size_t out_buf_size,
-  get_json_object_options options)
+  get_json_object_options options,
+  bool warp_cooperative)
 {
-  json_state j_state(input, input_len, options);
+  json_state j_state(input, input_len, options, warp_cooperative);
   json_output output{out_buf_size, out_buf};
 
   auto const result = parse_json_path<max_command_stack_depth>(j_state, commands, output);
@@ -899,160 +998,276 @@ __device__ thrust::pair<parse_result, json_output> get_json_object_single(
 }
 
 /**
- * @brief Kernel for running the JSONPath query.
+ * @brief Device data of a single JSONPath query applied to all rows.
+ */
+struct json_path_processing_data {
+  path_operator const* commands;  // nullptr for an empty query
+  size_type* d_sizes;             // output size of each row, filled in by the size pass
+  cudf::detail::input_offsetalator output_offsets;
+  char* out_buf;
+  bitmask_type* out_validity;
+};
+
+/**
+ * @brief Applies all queries to a single row.
+ *
+ * @param str The row
+ * @param row Index of the row
+ * @param paths Command buffer and output buffers of each query
+ * @param is_size_pass Whether only the output sizes are computed
+ * @param has_output Whether this thread writes the output chars
+ * @param options Options controlling behavior
+ * @param warp_cooperative Whether all lanes of the warp parse this row together
+ * @param on_result Callback invoked with each query and its result validity and size
+ */
+template <typename ResultCallback>
+__device__ void get_json_objects_row(string_view const str,
+                                     size_type row,
+                                     device_span<json_path_processing_data const> paths,
+                                     bool is_size_pass,
+                                     bool has_output,
+                                     get_json_object_options options,
+                                     bool warp_cooperative,
+                                     ResultCallback on_result)
+{
+  for (auto const& path : paths) {
+    bool is_valid         = false;
+    size_type output_size = 0;
+    if (str.size_bytes() > 0 && path.commands != nullptr) {
+      char* dst =
+        (is_size_pass || !has_output) ? nullptr : path.out_buf + path.output_offsets[row];
+      size_t const dst_size =
+        is_size_pass ? 0 : path.output_offsets[row + 1] - path.output_offsets[row];
+
+      parse_result result;
+      json_output out;
+      thrust::tie(result, out) = get_json_object_single(
+        str.data(), str.size_bytes(), path.commands, dst, dst_size, options, warp_cooperative);
+      output_size = out.output_len.value_or(0);
+      if (out.output_len.has_value() && result == parse_result::SUCCESS) { is_valid = true; }
+    }
+    on_result(path, is_valid, output_size);
+  }
+}
+
+/**
+ * @brief Kernel for running a set of JSONPath queries.
  *
  * This kernel operates in a 2-pass way.  On the first pass, it computes
  * output sizes.  On the second pass it fills in the provided output buffers
- * (chars and validity)
+ * (chars and validity).
+ *
+ * Each thread applies all queries to its row so that the row is read from global memory once.
  *
  * @param col Device view of the incoming string
- * @param commands JSONPath command buffer
- * @param output_offsets Buffer used to store the string offsets for the results of the query
- * @param out_buf Buffer used to store the results of the query
- * @param out_validity Output validity buffer
- * @param out_valid_count Output count of # of valid bits
+ * @param paths Command buffer and output buffers of each query
+ * @param is_size_pass Whether only the output sizes are computed
  * @param options Options controlling behavior
  */
 template <int block_size>
 __launch_bounds__(block_size) CUDF_KERNEL
   void get_json_object_kernel(column_device_view col,
-                              path_operator const* const commands,
-                              size_type* d_sizes,
-                              cudf::detail::input_offsetalator output_offsets,
-                              thrust::optional<char*> out_buf,
-                              thrust::optional<bitmask_type*> out_validity,
-                              thrust::optional<size_type*> out_valid_count,
+                              device_span<json_path_processing_data const> paths,
+                              bool is_size_pass,
                               get_json_object_options options)
 {
   auto tid          = cudf::detail::grid_1d::global_thread_id();
   auto const stride = cudf::thread_index_type{blockDim.x} * cudf::thread_index_type{gridDim.x};
 
-  size_type warp_valid_count{0};
-
   auto active_threads = __ballot_sync(0xffff'ffffu, tid < col.size());
   while (tid < col.size()) {
-    bool is_valid         = false;
-    string_view const str = col.element<string_view>(tid);
-    size_type output_size = 0;
-    if (str.size_bytes() > 0) {
-      char* dst = out_buf.has_value() ? out_buf.value() + output_offsets[tid] : nullptr;
-      size_t const dst_size =
-        out_buf.has_value() ? output_offsets[tid + 1] - output_offsets[tid] : 0;
-
-      parse_result result;
-      json_output out;
-      thrust::tie(result, out) =
-        get_json_object_single(str.data(), str.size_bytes(), commands, dst, dst_size, options);
-      output_size = out.output_len.value_or(0);
-      if (out.output_len.has_value() && result == parse_result::SUCCESS) { is_valid = true; }
-    }
-
-    // filled in only during the precompute step. during the compute step, the offsets
-    // are fed back in so we do -not- want to write them out
-    if (!out_buf.has_value()) { d_sizes[tid] = output_size; }
-
-    // validity filled in only during the output step
-    if (out_validity.has_value()) {
-      uint32_t mask = __ballot_sync(active_threads, is_valid);
-      // 0th lane of the warp writes the validity
-      if (!(tid % cudf::detail::warp_size)) {
-        out_validity.value()[cudf::word_index(tid)] = mask;
-        warp_valid_count += __popc(mask);
-      }
-    }
+    auto const row = static_cast<size_type>(tid);
+    get_json_objects_row(
+      col.element<string_view>(row),
+      row,
+      paths,
+      is_size_pass,
+      true,
+      options,
+      false,
+      [&](json_path_processing_data const& path, bool is_valid, size_type output_size) {
+        // filled in only during the precompute step. during the compute step, the offsets
+        // are fed back in so we do -not- want to write them out
+        if (is_size_pass) {
+          path.d_sizes[row] = output_size;
+          return;
+        }
+        // validity filled in only during the output step
+        uint32_t mask = __ballot_sync(active_threads, is_valid);
+        // 0th lane of the warp writes the validity
+        if (!(tid % cudf::detail::warp_size)) { path.out_validity[cudf::word_index(row)] = mask; }
+      });
 
     tid += stride;
     active_threads = __ballot_sync(active_threads, tid < col.size());
   }
+}
 
-  // sum the valid counts across the whole block
-  if (out_valid_count) {
-    size_type block_valid_count =
-      cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
-    if (threadIdx.x == 0) { atomicAdd(out_valid_count.value(), block_valid_count); }
+/**
+ * @brief Kernel for running a set of JSONPath queries with one warp per row.
+ *
+ * All lanes of a warp evaluate the queries on the same row with the same parser state, and
+ * scan across objects, arrays and strings together. Lane 0 writes the results. Used for long
+ * rows, where a thread per row leaves most of its warp idle and reads the row one byte at a time.
+ *
+ * @param col Device view of the incoming string
+ * @param paths Command buffer and output buffers of each query
+ * @param is_size_pass Whether only the output sizes are computed
+ * @param options Options controlling behavior
+ */
+template <int block_size>
+__launch_bounds__(block_size) CUDF_KERNEL
+  void get_json_object_warp_kernel(column_device_view col,
+                                   device_span<json_path_processing_data const> paths,
+                                   bool is_size_pass,
+                                   get_json_object_options options)
+{
+  auto const tid  = cudf::detail::grid_1d::global_thread_id();
+  auto const lane   = tid % cudf::detail::warp_size;
+  auto const stride = cudf::thread_index_type{blockDim.x} * cudf::thread_index_type{gridDim.x} /
+                      cudf::detail::warp_size;
+
+  for (auto warp_row = tid / cudf::detail::warp_size; warp_row < col.size(); warp_row += stride) {
+    auto const row = static_cast<size_type>(warp_row);
+    get_json_objects_row(
+      col.element<string_view>(row),
+      row,
+      paths,
+      is_size_pass,
+      lane == 0,
+      options,
+      true,
+      [&](json_path_processing_data const& path, bool is_valid, size_type output_size) {
+        if (lane != 0) { return; }
+        if (is_size_pass) {
+          path.d_sizes[row] = output_size;
+        } else if (is_valid) {
+          cudf::set_bit(path.out_validity, row);
+        } else {
+          cudf::clear_bit(path.out_validity, row);
+        }
+      });
   }
 }
 
-std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& col,
-                                              cudf::string_scalar const& json_path,
-                                              get_json_object_options options,
-                                              rmm::cuda_stream_view stream,
-                                              rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Average row size in bytes from which each row is processed by a whole warp.
+ */
+constexpr int64_t warp_per_row_threshold = 1024;
+
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
-  // preprocess the json_path into a command buffer
-  auto preprocess = build_command_buffer(json_path, stream);
-  CUDF_EXPECTS(std::get<1>(preprocess) <= max_command_stack_depth,
-               "Encountered JSONPath string that is too complex");
-
-  if (col.is_empty()) return make_empty_column(type_id::STRING);
-
-  // if the query is empty, return a string column containing all nulls
-  if (!std::get<0>(preprocess).has_value()) {
-    return std::make_unique<column>(
-      data_type{type_id::STRING},
-      col.size(),
-      rmm::device_buffer{0, stream, mr},  // no data
-      cudf::detail::create_null_mask(col.size(), mask_state::ALL_NULL, stream, mr),
-      col.size());  // null count
+  // preprocess the json_paths into a single command buffer
+  std::vector<path_operator> h_commands;
+  std::vector<std::optional<std::size_t>> command_offsets;
+  for (auto const& json_path : json_paths) {
+    auto const [operators, max_stack_depth] = build_command_buffer(json_path, stream);
+    CUDF_EXPECTS(max_stack_depth <= max_command_stack_depth,
+                 "Encountered JSONPath string that is too complex");
+    command_offsets.push_back(operators.empty() ? std::nullopt
+                                                : std::optional<std::size_t>{h_commands.size()});
+    h_commands.insert(h_commands.end(), operators.begin(), operators.end());
   }
 
-  // compute output sizes
-  auto sizes =
-    rmm::device_uvector<size_type>(col.size(), stream, rmm::mr::get_current_device_resource());
-  auto d_offsets = cudf::detail::offsetalator_factory::make_input_iterator(col.offsets());
+  auto const num_paths = json_paths.size();
+  std::vector<std::unique_ptr<cudf::column>> results;
+  if (col.is_empty()) {
+    std::generate_n(std::back_inserter(results), num_paths, [] {
+      return make_empty_column(type_id::STRING);
+    });
+    return results;
+  }
+
+  auto const d_commands = cudf::detail::make_device_uvector_async(
+    h_commands, stream, rmm::mr::get_current_device_resource());
+  auto sizes = rmm::device_uvector<size_type>(
+    num_paths * col.size(), stream, rmm::mr::get_current_device_resource());
+  std::vector<json_path_processing_data> h_paths(num_paths);
+  for (std::size_t idx = 0; idx < num_paths; ++idx) {
+    h_paths[idx].commands =
+      command_offsets[idx].has_value() ? d_commands.data() + command_offsets[idx].value() : nullptr;
+    h_paths[idx].d_sizes = sizes.data() + idx * col.size();
+  }
+  auto d_paths = cudf::detail::make_device_uvector_async(
+    h_paths, stream, rmm::mr::get_current_device_resource());
 
   constexpr int block_size = 512;
-  cudf::detail::grid_1d const grid{col.size(), block_size};
-  auto cdv = column_device_view::create(col.parent(), stream);
-  // preprocess sizes (returned in the offsets buffer)
-  get_json_object_kernel<block_size>
-    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-      *cdv,
-      std::get<0>(preprocess).value().data(),
-      sizes.data(),
-      d_offsets,
-      thrust::nullopt,
-      thrust::nullopt,
-      thrust::nullopt,
-      options);
-
-  // convert sizes to offsets
-  auto [offsets, output_size] =
-    cudf::strings::detail::make_offsets_child_column(sizes.begin(), sizes.end(), stream, mr);
-  d_offsets = cudf::detail::offsetalator_factory::make_input_iterator(offsets->view());
-
-  // allocate output string column
-  rmm::device_uvector<char> chars(output_size, stream, mr);
-
-  // potential optimization : if we know that all outputs are valid, we could skip creating
-  // the validity mask altogether
-  rmm::device_buffer validity =
-    cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr);
+  auto cdv                 = column_device_view::create(col.parent(), stream);
+  // long rows are scanned by a whole warp each
+  auto const warp_per_row = col.chars_size(stream) / col.size() >= warp_per_row_threshold;
+  auto const launch       = [&](bool is_size_pass) {
+    if (warp_per_row) {
+      auto const num_blocks =
+        cudf::util::div_rounding_up_safe(col.size(), block_size / cudf::detail::warp_size);
+      get_json_object_warp_kernel<block_size><<<num_blocks, block_size, 0, stream.value()>>>(
+        *cdv, d_paths, is_size_pass, options);
+    } else {
+      cudf::detail::grid_1d const grid{col.size(), block_size};
+      get_json_object_kernel<block_size>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+          *cdv, d_paths, is_size_pass, options);
+    }
+  };
+  // preprocess sizes
+  launch(true);
+
+  // convert sizes to offsets and allocate the output string columns
+  std::vector<std::unique_ptr<column>> offsets(num_paths);
+  std::vector<rmm::device_uvector<char>> chars;
+  std::vector<rmm::device_buffer> validity;
+  for (std::size_t idx = 0; idx < num_paths; ++idx) {
+    auto const path_sizes = sizes.begin() + idx * col.size();
+    auto [path_offsets, output_size] = cudf::strings::detail::make_offsets_child_column(
+      path_sizes, path_sizes + col.size(), stream, mr);
+    offsets[idx] = std::move(path_offsets);
+    chars.emplace_back(output_size, stream, mr);
+    // potential optimization : if we know that all outputs are valid, we could skip creating
+    // the validity mask altogether
+    validity.push_back(
+      cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr));
+
+    h_paths[idx].output_offsets =
+      cudf::detail::offsetalator_factory::make_input_iterator(offsets[idx]->view());
+    h_paths[idx].out_buf      = chars.back().data();
+    h_paths[idx].out_validity = static_cast<bitmask_type*>(validity.back().data());
+  }
+  d_paths = cudf::detail::make_device_uvector_async(
+    h_paths, stream, rmm::mr::get_current_device_resource());
 
   // compute results
-  rmm::device_scalar<size_type> d_valid_count{0, stream};
-
-  get_json_object_kernel<block_size>
-    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-      *cdv,
-      std::get<0>(preprocess).value().data(),
-      sizes.data(),
-      d_offsets,
-      chars.data(),
-      static_cast<bitmask_type*>(validity.data()),
-      d_valid_count.data(),
-      options);
-
-  auto result = make_strings_column(col.size(),
-                                    std::move(offsets),
-                                    chars.release(),
-                                    col.size() - d_valid_count.value(stream),
-                                    std::move(validity));
-  // unmatched array query may result in unsanitized '[' value in the result
-  if (cudf::detail::has_nonempty_nulls(result->view(), stream)) {
-    result = cudf::detail::purge_nonempty_nulls(result->view(), stream, mr);
+  launch(false);
+
+  for (std::size_t idx = 0; idx < num_paths; ++idx) {
+    auto const null_count = cudf::detail::null_count(
+      static_cast<bitmask_type const*>(validity[idx].data()), 0, col.size(), stream);
+    auto result = make_strings_column(col.size(),
+                                      std::move(offsets[idx]),
+                                      chars[idx].release(),
+                                      null_count,
+                                      std::move(validity[idx]));
+    // unmatched array query may result in unsanitized '[' value in the result
+    if (cudf::detail::has_nonempty_nulls(result->view(), stream)) {
+      result = cudf::detail::purge_nonempty_nulls(result->view(), stream, mr);
+    }
+    results.push_back(std::move(result));
   }
-  return result;
+  return results;
+}
+
+std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& col,
+                                              cudf::string_scalar const& json_path,
+                                              get_json_object_options options,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto results = get_json_objects(
+    col, host_span<cudf::string_scalar const>{&json_path, 1}, options, stream, mr);
+  return std::move(results.front());
 }
 
 }  // namespace
@@ -1068,4 +1283,15 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
   return detail::get_json_object(col, json_path, options, stream, mr);
 }
 
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_json_objects(col, json_paths, options, stream, mr);
+}
+
 }  // namespace cudf
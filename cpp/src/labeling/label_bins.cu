@@ -19,6 +19,8 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/label_bins.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/labeling/label_bins.hpp>
 #include <cudf/types.hpp>
@@ -37,9 +39,11 @@
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/pair.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
 #include <limits>
 
 namespace cudf {
@@ -195,8 +199,188 @@ struct bin_type_dispatcher {
   }
 };
 
+// Bins whose per-block counts fit in shared memory
+constexpr size_type max_shared_memory_bins = 8192;
+constexpr size_type histogram_block_size   = 256;
+constexpr size_type max_histogram_blocks   = 1024;
+
+/**
+ * @brief Maps a value to its bin among `num_bins` bins of equal width in `[lower, upper]`.
+ *
+ * The bins include their left edge, and the last bin also includes `upper`.
+ */
+struct uniform_bin_fn {
+  double lower;
+  double upper;
+  size_type num_bins;
+
+  template <typename T>
+  __device__ size_type operator()(T value) const
+  {
+    auto const v = static_cast<double>(value);
+    // also rejects NaN
+    if (!(v >= lower && v <= upper)) { return NULL_VALUE; }
+    // multiplying before dividing keeps the edges exact for integer values
+    auto const bin = static_cast<size_type>((v - lower) * num_bins / (upper - lower));
+    return bin < num_bins ? bin : num_bins - 1;
+  }
+};
+
+template <typename T>
+struct label_uniform_fn {
+  column_device_view input;
+  uniform_bin_fn bin;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    return input.is_null(row) ? NULL_VALUE : bin(input.element<T>(row));
+  }
+};
+
+/**
+ * @brief Counts the values of `input` in each bin, in shared memory per block when
+ * `use_shared_memory` and directly in `counts` otherwise.
+ */
+template <typename T, bool use_shared_memory>
+CUDF_KERNEL void uniform_histogram_kernel(column_device_view input,
+                                          uniform_bin_fn bin,
+                                          unsigned long long* counts)
+{
+  extern __shared__ uint32_t block_counts[];
+  if constexpr (use_shared_memory) {
+    for (auto b = static_cast<size_type>(threadIdx.x); b < bin.num_bins; b += blockDim.x) {
+      block_counts[b] = 0;
+    }
+    __syncthreads();
+  }
+
+  auto const stride = grid_1d::grid_stride();
+  for (auto tid = grid_1d::global_thread_id(); tid < input.size(); tid += stride) {
+    auto const row = static_cast<size_type>(tid);
+    if (input.is_null(row)) { continue; }
+    auto const b = bin(input.element<T>(row));
+    if (b == NULL_VALUE) { continue; }
+    if constexpr (use_shared_memory) {
+      atomicAdd(&block_counts[b], 1u);
+    } else {
+      atomicAdd(&counts[b], 1ull);
+    }
+  }
+
+  if constexpr (use_shared_memory) {
+    __syncthreads();
+    for (auto b = static_cast<size_type>(threadIdx.x); b < bin.num_bins; b += blockDim.x) {
+      if (block_counts[b] > 0) {
+        atomicAdd(&counts[b], static_cast<unsigned long long>(block_counts[b]));
+      }
+    }
+  }
+}
+
+template <typename T>
+constexpr bool is_uniform_bin_type()
+{
+  return cudf::is_numeric<T>() && !cudf::is_boolean<T>();
+}
+
+struct uniform_bin_dispatcher {
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_uniform_bin_type<T>(), std::unique_ptr<column>> operator()(
+    Args&&...) const
+  {
+    CUDF_FAIL("Uniform bins require a numeric, non-boolean column", cudf::data_type_error);
+  }
+
+  template <typename T>
+  std::enable_if_t<is_uniform_bin_type<T>(), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    uniform_bin_fn bin,
+    bool count_only,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    auto const d_input = column_device_view::create(input, stream);
+    if (!count_only) {
+      if (input.is_empty()) { return make_empty_column(type_to_id<size_type>()); }
+      auto output = make_numeric_column(
+        data_type(type_to_id<size_type>()), input.size(), mask_state::UNALLOCATED, stream, mr);
+      auto const output_begin = output->mutable_view().begin<size_type>();
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(input.size()),
+                        output_begin,
+                        label_uniform_fn<T>{*d_input, bin});
+      auto [null_mask, null_count] = valid_if(
+        output_begin, output_begin + input.size(), filter_null_sentinel(), stream, mr);
+      output->set_null_mask(std::move(null_mask), null_count);
+      return output;
+    }
+
+    auto output = make_numeric_column(
+      data_type(type_id::INT64), bin.num_bins, mask_state::UNALLOCATED, stream, mr);
+    auto const counts =
+      reinterpret_cast<unsigned long long*>(output->mutable_view().data<int64_t>());
+    CUDF_CUDA_TRY(
+      cudaMemsetAsync(counts, 0, bin.num_bins * sizeof(unsigned long long), stream.value()));
+    if (input.is_empty()) { return output; }
+
+    // the blocks loop over the rows, so that each block flushes its counts once
+    grid_1d const grid{input.size(), histogram_block_size};
+    auto const num_blocks = std::min(grid.num_blocks, max_histogram_blocks);
+    if (bin.num_bins <= max_shared_memory_bins) {
+      uniform_histogram_kernel<T, true>
+        <<<num_blocks, histogram_block_size, bin.num_bins * sizeof(uint32_t), stream.value()>>>(
+          *d_input, bin, counts);
+    } else {
+      uniform_histogram_kernel<T, false>
+        <<<num_blocks, histogram_block_size, 0, stream.value()>>>(*d_input, bin, counts);
+    }
+    CUDF_CHECK_CUDA(stream.value());
+    return output;
+  }
+};
+
+std::unique_ptr<column> uniform_bins(column_view const& input,
+                                     double lower,
+                                     double upper,
+                                     size_type num_bins,
+                                     bool count_only,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_bins > 0, "The number of bins must be positive", std::invalid_argument);
+  CUDF_EXPECTS(lower < upper, "The lower edge must be below the upper edge", std::invalid_argument);
+  return type_dispatcher(input.type(),
+                         uniform_bin_dispatcher{},
+                         input,
+                         uniform_bin_fn{lower, upper, num_bins},
+                         count_only,
+                         stream,
+                         mr);
+}
+
 }  // anonymous namespace
 
+std::unique_ptr<column> label_bins_uniform(column_view const& input,
+                                           double lower,
+                                           double upper,
+                                           size_type num_bins,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  return uniform_bins(input, lower, upper, num_bins, false, stream, mr);
+}
+
+std::unique_ptr<column> histogram_uniform(column_view const& input,
+                                          double lower,
+                                          double upper,
+                                          size_type num_bins,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  return uniform_bins(input, lower, upper, num_bins, true, stream, mr);
+}
+
 /// Bin the input by the edges in left_edges and right_edges.
 std::unique_ptr<column> label_bins(column_view const& input,
                                    column_view const& left_edges,
@@ -243,4 +427,26 @@ std::unique_ptr<column> label_bins(column_view const& input,
   return detail::label_bins(
     input, left_edges, left_inclusive, right_edges, right_inclusive, stream, mr);
 }
+
+std::unique_ptr<column> label_bins_uniform(column_view const& input,
+                                           double lower,
+                                           double upper,
+                                           size_type num_bins,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::label_bins_uniform(input, lower, upper, num_bins, stream, mr);
+}
+
+std::unique_ptr<column> histogram_uniform(column_view const& input,
+                                          double lower,
+                                          double upper,
+                                          size_type num_bins,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::histogram_uniform(input, lower, upper, num_bins, stream, mr);
+}
 }  // namespace cudf
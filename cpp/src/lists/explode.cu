@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/labeling/label_segments.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/lists/explode.hpp>
 #include <cudf/lists/lists_column_view.hpp>
@@ -28,10 +29,6 @@
 #include <rmm/exec_policy.hpp>
 
 #include <cuda/functional>
-#include <thrust/advance.h>
-#include <thrust/binary_search.h>
-#include <thrust/distance.h>
-#include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
@@ -119,24 +116,11 @@ std::unique_ptr<table> explode(table_view const& input_table,
   auto sliced_child = explode_col.get_sliced_child(stream);
   rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
 
-  // Sliced columns may require rebasing of the offsets.
+  // Each child row is gathered from the row of its list, found by expanding the offsets in a
+  // single pass rather than by a binary search per child row. Sliced offsets are rebased there.
   auto offsets = explode_col.offsets_begin();
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    thrust::next(offsets), cuda::proclaim_return_type<size_type>([offsets] __device__(auto i) {
-      return (i - offsets[0]) - 1;
-    }));
-  auto counting_iter = thrust::make_counting_iterator(0);
-
-  // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
-  // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
-  // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::lower_bound(rmm::exec_policy(stream),
-                      offsets_minus_one,
-                      offsets_minus_one + explode_col.size(),
-                      counting_iter,
-                      counting_iter + gather_map.size(),
-                      gather_map.begin());
+  label_segments(
+    offsets, offsets + explode_col.size() + 1, gather_map.begin(), gather_map.end(), stream);
 
   return build_table(input_table,
                      explode_column_idx,
@@ -159,34 +143,19 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
 
   // Sliced columns may require rebasing of the offsets.
   auto offsets = explode_col.offsets_begin();
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    offsets + 1, cuda::proclaim_return_type<size_type>([offsets] __device__(auto i) {
-      return (i - offsets[0]) - 1;
-    }));
-  auto counting_iter = thrust::make_counting_iterator(0);
+  label_segments(
+    offsets, offsets + explode_col.size() + 1, gather_map.begin(), gather_map.end(), stream);
 
   rmm::device_uvector<size_type> pos(sliced_child.size(), stream, mr);
-
-  // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
-  // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
-  // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::transform(
-    rmm::exec_policy(stream),
-    counting_iter,
-    counting_iter + gather_map.size(),
-    gather_map.begin(),
-    cuda::proclaim_return_type<size_type>([position_array = pos.data(),
-                                           offsets_minus_one,
-                                           offsets,
-                                           offset_size =
-                                             explode_col.size()] __device__(auto idx) -> size_type {
-      auto lb_idx = thrust::distance(
-        offsets_minus_one,
-        thrust::lower_bound(thrust::seq, offsets_minus_one, offsets_minus_one + offset_size, idx));
-      position_array[idx] = idx - (offsets[lb_idx] - offsets[0]);
-      return lb_idx;
-    }));
+  auto counting_iter = thrust::make_counting_iterator(0);
+  thrust::transform(rmm::exec_policy(stream),
+                    counting_iter,
+                    counting_iter + pos.size(),
+                    pos.begin(),
+                    cuda::proclaim_return_type<size_type>(
+                      [gather_map = gather_map.begin(), offsets] __device__(auto idx) {
+                        return idx - (offsets[gather_map[idx]] - offsets[0]);
+                      }));
 
   return build_table(input_table,
                      explode_column_idx,
@@ -238,13 +207,12 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
   rmm::device_uvector<size_type> explode_col_gather_map(gather_map_size, stream);
   rmm::device_uvector<size_type> pos(include_position ? gather_map_size : 0, stream, mr);
 
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    thrust::next(offsets), cuda::proclaim_return_type<size_type>([offsets] __device__(auto i) {
-      return (i - offsets[0]) - 1;
-    }));
+  // the list row of each child row
+  rmm::device_uvector<size_type> child_labels(sliced_child.size(), stream);
+  label_segments(
+    offsets, offsets + explode_col.size() + 1, child_labels.begin(), child_labels.end(), stream);
 
-  auto fill_gather_maps = [offsets_minus_one,
+  auto fill_gather_maps = [child_labels_p           = child_labels.begin(),
                            gather_map_p             = gather_map.begin(),
                            explode_col_gather_map_p = explode_col_gather_map.begin(),
                            position_array           = pos.begin(),
@@ -252,13 +220,9 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
                            null_or_empty_offset_p   = null_or_empty_offset.begin(),
                            include_position,
                            offsets,
-                           null_or_empty,
-                           offset_size = explode_col.offsets().size() - 1] __device__(auto idx) {
+                           null_or_empty] __device__(auto idx) {
     if (idx < sliced_child_size) {
-      auto lb_idx =
-        thrust::distance(offsets_minus_one,
-                         thrust::lower_bound(
-                           thrust::seq, offsets_minus_one, offsets_minus_one + (offset_size), idx));
+      auto lb_idx                              = child_labels_p[idx];
       auto index_to_write                      = null_or_empty_offset_p[lb_idx] + idx;
       gather_map_p[index_to_write]             = lb_idx;
       explode_col_gather_map_p[index_to_write] = idx;
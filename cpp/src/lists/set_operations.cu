@@ -26,16 +26,21 @@
 #include <cudf/lists/detail/combine.hpp>
 #include <cudf/lists/detail/set_operations.hpp>
 #include <cudf/lists/detail/stream_compaction.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/functional>
 #include <thrust/distance.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/reduce.h>
 #include <thrust/scatter.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/uninitialized_fill.h>
 
 namespace cudf::lists {
@@ -55,6 +60,118 @@ void check_compatibility(lists_column_view const& lhs, lists_column_view const&
                "The input lists columns must have children having the same type structure");
 }
 
+// Haystack lists up to this size are searched element by element instead of through a hash table
+constexpr size_type max_linear_search_list_size = 64;
+
+/**
+ * @brief Functor to search a needle element in the haystack list of its row.
+ */
+template <typename DeviceEqual>
+struct search_same_row_fn {
+  DeviceEqual d_equal;
+  size_type const* haystack_offsets;
+  size_type const* needle_labels;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    using cudf::experimental::row::lhs_index_type;
+    using cudf::experimental::row::rhs_index_type;
+
+    auto const row   = needle_labels[idx];
+    auto const begin = haystack_offsets[row] - haystack_offsets[0];
+    auto const end   = haystack_offsets[row + 1] - haystack_offsets[0];
+    for (auto i = begin; i < end; ++i) {
+      if (d_equal(lhs_index_type{i}, rhs_index_type{idx})) { return true; }
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief Search each needle element in the haystack list of its row with the given comparator.
+ */
+template <bool has_nested_columns, typename PhysicalEqualityComparator>
+void search_same_row(table_view const& haystack_child,
+                     table_view const& needles_child,
+                     size_type const* haystack_offsets,
+                     size_type const* needle_labels,
+                     null_equality nulls_equal,
+                     device_span<bool> contained,
+                     rmm::cuda_stream_view stream)
+{
+  auto const comparator = cudf::experimental::row::equality::two_table_comparator(
+    haystack_child, needles_child, stream);
+  auto const has_nulls =
+    nullate::DYNAMIC{has_nested_nulls(haystack_child) || has_nested_nulls(needles_child)};
+  auto const d_equal = comparator.equal_to<has_nested_columns>(
+    has_nulls, nulls_equal, PhysicalEqualityComparator{});
+  thrust::tabulate(rmm::exec_policy(stream),
+                   contained.begin(),
+                   contained.end(),
+                   search_same_row_fn<decltype(d_equal)>{d_equal, haystack_offsets, needle_labels});
+}
+
+/**
+ * @brief Check, for each element of the needles lists, whether it is in the haystack list of the
+ * same row.
+ *
+ * When all haystack lists are short, each needle element is compared with the elements of its
+ * haystack list by one thread, which needs no temporary storage. Otherwise, the labeled needle
+ * elements are looked up in a hash table of the labeled haystack elements.
+ *
+ * @param haystack The haystack lists column
+ * @param haystack_table The table of the labels and the child of the haystack lists
+ * @param needles_table The table of the labels and the child of the needles lists
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether floating-point NaNs should be considered as equal
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Whether each needle element is in the haystack list of its row
+ */
+rmm::device_uvector<bool> contains_in_same_row(lists_column_view const& haystack,
+                                               table_view const& haystack_table,
+                                               table_view const& needles_table,
+                                               null_equality nulls_equal,
+                                               nan_equality nans_equal,
+                                               rmm::cuda_stream_view stream)
+{
+  auto const offsets       = haystack.offsets_begin();
+  auto const max_list_size = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(haystack.size()),
+    cuda::proclaim_return_type<size_type>(
+      [offsets] __device__(size_type row) { return offsets[row + 1] - offsets[row]; }),
+    size_type{0},
+    thrust::maximum<size_type>{});
+  if (max_list_size > max_linear_search_list_size) {
+    return cudf::detail::contains(haystack_table,
+                                  needles_table,
+                                  nulls_equal,
+                                  nans_equal,
+                                  stream,
+                                  rmm::mr::get_current_device_resource());
+  }
+
+  auto contained = rmm::device_uvector<bool>(needles_table.num_rows(), stream);
+  if (contained.is_empty()) { return contained; }
+  auto const haystack_child = table_view{{haystack_table.column(1)}};
+  auto const needles_child  = table_view{{needles_table.column(1)}};
+  auto const needle_labels  = needles_table.column(0).begin<size_type>();
+
+  using nan_equal_comparator =
+    cudf::experimental::row::equality::nan_equal_physical_equality_comparator;
+  using nan_unequal_comparator = cudf::experimental::row::equality::physical_equality_comparator;
+  auto const has_nested        = cudf::detail::has_nested_columns(haystack_child);
+
+  auto const search = nans_equal == nan_equality::ALL_EQUAL
+                        ? (has_nested ? search_same_row<true, nan_equal_comparator>
+                                      : search_same_row<false, nan_equal_comparator>)
+                        : (has_nested ? search_same_row<true, nan_unequal_comparator>
+                                      : search_same_row<false, nan_unequal_comparator>);
+  search(haystack_child, needles_child, offsets, needle_labels, nulls_equal, contained, stream);
+  return contained;
+}
+
 }  // namespace
 
 std::unique_ptr<column> have_overlap(lists_column_view const& lhs,
@@ -83,8 +200,8 @@ std::unique_ptr<column> have_overlap(lists_column_view const& lhs,
   auto const rhs_table = table_view{{rhs_labels->view(), rhs_child}};
 
   // Check existence for each row of the rhs_table in lhs_table.
-  auto const contained = cudf::detail::contains(
-    lhs_table, rhs_table, nulls_equal, nans_equal, stream, rmm::mr::get_current_device_resource());
+  auto const contained =
+    contains_in_same_row(lhs, lhs_table, rhs_table, nulls_equal, nans_equal, stream);
 
   auto const num_rows = lhs.size();
 
@@ -152,8 +269,8 @@ std::unique_ptr<column> intersect_distinct(lists_column_view const& lhs,
   auto const lhs_table = table_view{{lhs_labels->view(), lhs_child}};
   auto const rhs_table = table_view{{rhs_labels->view(), rhs_child}};
 
-  auto const contained = cudf::detail::contains(
-    lhs_table, rhs_table, nulls_equal, nans_equal, stream, rmm::mr::get_current_device_resource());
+  auto const contained =
+    contains_in_same_row(lhs, lhs_table, rhs_table, nulls_equal, nans_equal, stream);
 
   auto const intersect_table = cudf::detail::copy_if(
     rhs_table,
@@ -235,8 +352,8 @@ std::unique_ptr<column> difference_distinct(lists_column_view const& lhs,
   auto const lhs_table = table_view{{lhs_labels->view(), lhs_child}};
   auto const rhs_table = table_view{{rhs_labels->view(), rhs_child}};
 
-  auto const contained = cudf::detail::contains(
-    rhs_table, lhs_table, nulls_equal, nans_equal, stream, rmm::mr::get_current_device_resource());
+  auto const contained =
+    contains_in_same_row(rhs, rhs_table, lhs_table, nulls_equal, nans_equal, stream);
 
   auto const difference_table = cudf::detail::copy_if(
     lhs_table,
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
@@ -41,6 +42,7 @@
 
 #include <cuda/functional>
 #include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
@@ -52,6 +54,7 @@
 #include <limits>
 #include <numeric>
 #include <queue>
+#include <type_traits>
 #include <vector>
 
 namespace cudf {
@@ -589,6 +592,90 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
+/**
+ * @brief Scatters every row of the concatenated sorted tables to its position in the merged
+ * table.
+ *
+ * The position of a row is its index in its own table plus the number of rows of every other
+ * table that precede it, found by a binary search in each table: the rows equal to it precede it
+ * in the earlier tables and follow it in the later ones, so the merge is stable.
+ */
+template <typename Comparator>
+struct scatter_merged_row_fn {
+  size_type const* offsets;  ///< Offsets of the tables in the concatenated table
+  size_type num_tables;
+  Comparator less;
+  size_type* gather_map;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const table = static_cast<size_type>(
+      thrust::distance(offsets,
+                       thrust::upper_bound(thrust::seq, offsets, offsets + num_tables + 1, row)) -
+      1);
+    auto position = row - offsets[table];
+    for (size_type t = 0; t < num_tables; ++t) {
+      if (t == table) { continue; }
+      auto const begin = thrust::make_counting_iterator(offsets[t]);
+      auto const end   = thrust::make_counting_iterator(offsets[t + 1]);
+      auto const bound = t < table ? thrust::upper_bound(thrust::seq, begin, end, row, less)
+                                   : thrust::lower_bound(thrust::seq, begin, end, row, less);
+      position += static_cast<size_type>(thrust::distance(begin, bound));
+    }
+    gather_map[position] = row;
+  }
+};
+
+/**
+ * @brief Merges more than two sorted tables at once.
+ *
+ * Instead of merging pairs of tables until one is left, the position of every row in the merged
+ * table is computed from all the tables in a single pass, and the concatenated tables are
+ * gathered once into the merged table.
+ */
+table_ptr_type multiway_merge(std::vector<table_view> const& tables_to_merge,
+                              std::vector<cudf::size_type> const& key_cols,
+                              std::vector<cudf::order> const& column_order,
+                              std::vector<cudf::null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  std::vector<size_type> offsets{0};
+  for (auto const& table : tables_to_merge) {
+    offsets.push_back(offsets.back() + table.num_rows());
+  }
+  auto const num_rows   = offsets.back();
+  auto const num_tables = static_cast<size_type>(tables_to_merge.size());
+
+  auto const temp_mr      = rmm::mr::get_current_device_resource();
+  auto const d_offsets    = cudf::detail::make_device_uvector_async(offsets, stream, temp_mr);
+  auto const concatenated = cudf::detail::concatenate(tables_to_merge, stream, temp_mr);
+  auto const keys = concatenated->view().select(key_cols);
+
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  auto const scatter_rows = [&](auto const& comparator) {
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator(0),
+                       num_rows,
+                       scatter_merged_row_fn<std::decay_t<decltype(comparator)>>{
+                         d_offsets.data(), num_tables, comparator, gather_map.data()});
+  };
+  auto const comp = cudf::experimental::row::lexicographic::self_comparator(
+    keys, column_order, null_precedence, stream);
+  if (cudf::detail::has_nested_columns(keys)) {
+    scatter_rows(comp.less<true>(nullate::DYNAMIC{has_nested_nulls(keys)}));
+  } else {
+    scatter_rows(comp.less<false>(nullate::DYNAMIC{has_nested_nulls(keys)}));
+  }
+
+  return cudf::detail::gather(concatenated->view(),
+                              gather_map,
+                              out_of_bounds_policy::DONT_CHECK,
+                              negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
 struct merge_queue_item {
   table_view view;
   table_ptr_type table;
@@ -671,6 +758,19 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   // No inputs have rows, return a table with same columns as the first one
   if (merge_queue.empty()) { return empty_like(first_table); }
 
+  // Dictionary keys are compared by the pairwise merge of their matched dictionaries
+  auto const has_dictionary_keys = std::any_of(key_cols.begin(), key_cols.end(), [&](auto idx) {
+    return cudf::is_dictionary(first_table.column(idx).type());
+  });
+  if (merge_queue.size() > 2 and not has_dictionary_keys) {
+    std::vector<table_view> non_empty_tables;
+    std::copy_if(merge_tables.begin(),
+                 merge_tables.end(),
+                 std::back_inserter(non_empty_tables),
+                 [](auto const& table) { return table.num_rows() > 0; });
+    return multiway_merge(non_empty_tables, key_cols, column_order, null_precedence, stream, mr);
+  }
+
   // Pick the two smallest tables and merge them
   // Until there is only one table left in the queue
   while (merge_queue.size() > 1) {
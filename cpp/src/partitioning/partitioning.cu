@@ -15,18 +15,27 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/contiguous_split.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
+#include <cudf/hashing/detail/xxhash_64.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -34,10 +43,22 @@
 
 #include <cub/block/block_scan.cuh>
 #include <cub/device/device_histogram.cuh>
+#include <cub/device/device_radix_sort.cuh>
+#include <cuda/functional>
+#include <cuda/std/functional>
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -463,6 +484,104 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
+/**
+ * @brief Computes the partition number of a row from its hash value.
+ */
+template <typename row_hasher_t, typename partitioner_type>
+struct partition_number_fn {
+  row_hasher_t hasher;
+  partitioner_type partitioner;
+
+  __device__ size_type operator()(size_type row) const { return partitioner(hasher(row)); }
+};
+
+/**
+ * @brief Partitions the rows of `input` into more partitions than the per-block shared memory
+ * histograms handle efficiently.
+ *
+ * The per-block histograms grow with the number of partitions times the number of blocks, so
+ * instead the rows are ordered by a least significant digit radix sort on only the bits of their
+ * partition numbers. The sort makes passes of at most 8 bits (256 buckets), e.g. two passes for
+ * 4096 partitions. The sorted rows are the gather map of all the columns, copied together.
+ *
+ * NOTE hash_has_nulls must be true if table_to_hash has nulls
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> radix_hash_partition_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  uint32_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = table_to_hash.num_rows();
+
+  auto const row_hasher = experimental::row::hash::row_hasher(table_to_hash, stream);
+  auto const hasher =
+    row_hasher.device_hasher<hash_function>(nullate::DYNAMIC{hash_has_nulls}, seed);
+
+  rmm::device_uvector<size_type> partitions_buffer1(num_rows, stream);
+  rmm::device_uvector<size_type> partitions_buffer2(num_rows, stream);
+  auto const compute_partition_numbers = [&](auto partitioner) {
+    thrust::transform(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_rows),
+      partitions_buffer1.begin(),
+      partition_number_fn<decltype(hasher), decltype(partitioner)>{hasher, partitioner});
+  };
+  if (is_power_two(num_partitions)) {
+    compute_partition_numbers(bitwise_partitioner<hash_value_type>(num_partitions));
+  } else {
+    compute_partition_numbers(modulo_partitioner<hash_value_type>(num_partitions));
+  }
+
+  rmm::device_uvector<size_type> rows_buffer1(num_rows, stream);
+  rmm::device_uvector<size_type> rows_buffer2(num_rows, stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), rows_buffer1.begin(), rows_buffer1.end(), 0);
+
+  // only the bits that can be set in a partition number are sorted
+  int num_bits = 0;
+  while ((size_type{1} << num_bits) < num_partitions) {
+    ++num_bits;
+  }
+  cub::DoubleBuffer<size_type> partitions(partitions_buffer1.data(), partitions_buffer2.data());
+  cub::DoubleBuffer<size_type> rows(rows_buffer1.data(), rows_buffer2.data());
+  std::size_t temp_storage_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(
+    nullptr, temp_storage_bytes, partitions, rows, num_rows, 0, num_bits, stream.value());
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+  cub::DeviceRadixSort::SortPairs(temp_storage.data(),
+                                  temp_storage_bytes,
+                                  partitions,
+                                  rows,
+                                  num_rows,
+                                  0,
+                                  num_bits,
+                                  stream.value());
+
+  // the start of every partition in the sorted partition numbers
+  rmm::device_uvector<size_type> d_partition_offsets(num_partitions, stream);
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      partitions.Current(),
+                      partitions.Current() + num_rows,
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_partitions),
+                      d_partition_offsets.begin());
+  auto partition_offsets = cudf::detail::make_std_vector_async(d_partition_offsets, stream);
+
+  auto output = cudf::detail::gather(input,
+                                     device_span<size_type const>(rows.Current(), num_rows),
+                                     out_of_bounds_policy::DONT_CHECK,
+                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                     stream,
+                                     mr);
+
+  stream.synchronize();  // Async D2H copy must finish before returning host vec
+  return std::pair(std::move(output), std::move(partition_offsets));
+}
+
 // NOTE hash_has_nulls must be true if table_to_hash has nulls
 template <template <typename> class hash_function, bool hash_has_nulls>
 std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
@@ -473,13 +592,14 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
-  auto const num_rows = table_to_hash.num_rows();
+  if (num_partitions > THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL) {
+    return radix_hash_partition_table<hash_function, hash_has_nulls>(
+      input, table_to_hash, num_partitions, seed, stream, mr);
+  }
 
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
-  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
-  auto const rows_per_thread =
-    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
+  auto const num_rows       = table_to_hash.num_rows();
+  auto const block_size     = OPTIMIZED_BLOCK_SIZE;
+  auto const rows_per_block = OPTIMIZED_BLOCK_SIZE * OPTIMIZED_ROWS_PER_THREAD;
 
   // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
   auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
@@ -573,62 +693,42 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   auto const partition_offsets =
     cudf::detail::make_std_vector_async(global_partition_sizes, stream);
 
-  // When the number of partitions is less than a threshold, we can apply an
-  // optimization using shared memory to copy values to the output buffer.
-  // Otherwise, fallback to using scatter.
-  if (use_optimization) {
-    std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
-
-    // Copy input to output by partition per column
-    std::transform(input.begin(), input.end(), output_cols.begin(), [&](auto const& col) {
-      return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
-                                                          copy_block_partitions_dispatcher{},
-                                                          col,
-                                                          num_partitions,
-                                                          row_partition_numbers.data(),
-                                                          row_partition_offset.data(),
-                                                          block_partition_sizes.data(),
-                                                          scanned_block_partition_sizes.data(),
-                                                          grid_size,
-                                                          stream,
-                                                          mr);
-    });
-
-    if (has_nested_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
-                                           num_partitions,
-                                           row_partition_numbers.data(),
-                                           row_partition_offset.data(),
-                                           block_partition_sizes.data(),
-                                           scanned_block_partition_sizes.data(),
-                                           grid_size,
-                                           stream);
-
-      // Handle bitmask using gather to take advantage of ballot_sync
-      detail::gather_bitmask(
-        input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
-    }
+  // Use shared memory to copy values to the output buffer
+  std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
+
+  // Copy input to output by partition per column
+  std::transform(input.begin(), input.end(), output_cols.begin(), [&](auto const& col) {
+    return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
+                                                        copy_block_partitions_dispatcher{},
+                                                        col,
+                                                        num_partitions,
+                                                        row_partition_numbers.data(),
+                                                        row_partition_offset.data(),
+                                                        block_partition_sizes.data(),
+                                                        scanned_block_partition_sizes.data(),
+                                                        grid_size,
+                                                        stream,
+                                                        mr);
+  });
+
+  if (has_nested_nulls(input)) {
+    // Use copy_block_partitions to compute a gather map
+    auto gather_map = compute_gather_map(num_rows,
+                                         num_partitions,
+                                         row_partition_numbers.data(),
+                                         row_partition_offset.data(),
+                                         block_partition_sizes.data(),
+                                         scanned_block_partition_sizes.data(),
+                                         grid_size,
+                                         stream);
 
-    stream.synchronize();  // Async D2H copy must finish before returning host vec
-    return std::pair(std::make_unique<table>(std::move(output_cols)), std::move(partition_offsets));
-  } else {
-    // Compute a scatter map from input to output such that the output rows are
-    // sorted by partition number
-    auto row_output_locations{row_partition_numbers.data()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data()};
-    compute_row_output_locations<<<grid_size,
-                                   block_size,
-                                   num_partitions * sizeof(size_type),
-                                   stream.value()>>>(
-      row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
-
-    // Use the resulting scatter map to materialize the output
-    auto output = detail::scatter(input, row_partition_numbers, input, stream, mr);
-
-    stream.synchronize();  // Async D2H copy must finish before returning host vec
-    return std::pair(std::move(output), std::move(partition_offsets));
+    // Handle bitmask using gather to take advantage of ballot_sync
+    detail::gather_bitmask(
+      input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
   }
+
+  stream.synchronize();  // Async D2H copy must finish before returning host vec
+  return std::pair(std::make_unique<table>(std::move(output_cols)), std::move(partition_offsets));
 }
 
 struct dispatch_map_type {
@@ -778,6 +878,298 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
       input, table_to_hash, num_partitions, seed, stream, mr);
   }
 }
+
+/**
+ * @brief Computes the location of every row in the partition-major order of the hash partitions
+ * of `table_to_hash`.
+ *
+ * @return The location of every row, and the `num_partitions + 1` offsets of the partitions
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<rmm::device_uvector<size_type>, std::vector<size_type>> hash_partition_scatter_map(
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  uint32_t seed,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = table_to_hash.num_rows();
+  auto grid_size =
+    util::div_rounding_up_safe(num_rows, FALLBACK_BLOCK_SIZE * FALLBACK_ROWS_PER_THREAD);
+  auto const shared_size = num_partitions * sizeof(size_type);
+
+  auto row_partition_numbers = rmm::device_uvector<size_type>(num_rows, stream);
+  auto block_partition_sizes = rmm::device_uvector<size_type>(grid_size * num_partitions, stream);
+  // one more entry, so that the exclusive scan puts the number of rows at the end
+  auto partition_offsets = cudf::detail::make_zeroed_device_uvector_async<size_type>(
+    num_partitions + 1, stream, rmm::mr::get_current_device_resource());
+  auto row_partition_offset = cudf::detail::make_zeroed_device_uvector_async<size_type>(
+    num_rows, stream, rmm::mr::get_current_device_resource());
+
+  auto const row_hasher = experimental::row::hash::row_hasher(table_to_hash, stream);
+  auto const hasher =
+    row_hasher.device_hasher<hash_function>(nullate::DYNAMIC{hash_has_nulls}, seed);
+  auto const compute_partition_numbers = [&](auto partitioner) {
+    compute_row_partition_numbers<<<grid_size,
+                                    FALLBACK_BLOCK_SIZE,
+                                    shared_size,
+                                    stream.value()>>>(hasher,
+                                                      num_rows,
+                                                      num_partitions,
+                                                      partitioner,
+                                                      row_partition_numbers.data(),
+                                                      row_partition_offset.data(),
+                                                      block_partition_sizes.data(),
+                                                      partition_offsets.data());
+  };
+  if (is_power_two(num_partitions)) {
+    compute_partition_numbers(bitwise_partitioner<hash_value_type>(num_partitions));
+  } else {
+    compute_partition_numbers(modulo_partitioner<hash_value_type>(num_partitions));
+  }
+
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         block_partition_sizes.begin(),
+                         block_partition_sizes.end(),
+                         block_partition_sizes.begin());
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         partition_offsets.begin(),
+                         partition_offsets.end(),
+                         partition_offsets.begin());
+
+  // the partition numbers are replaced in-place by the output locations
+  compute_row_output_locations<<<grid_size, FALLBACK_BLOCK_SIZE, shared_size, stream.value()>>>(
+    row_partition_numbers.data(), num_rows, num_partitions, block_partition_sizes.data());
+
+  return std::pair(std::move(row_partition_numbers),
+                   cudf::detail::make_std_vector_sync(partition_offsets, stream));
+}
+
+/**
+ * @brief Copies the rows of a fixed-width column, in partition-major order, into the packed
+ * buffers of their partitions.
+ */
+struct pack_partition_rows_fn {
+  template <typename T, CUDF_ENABLE_IF(is_rep_layout_compatible<T>())>
+  void operator()(column_view const& input,
+                  device_span<size_type const> gather_map,
+                  device_span<size_type const> partition_offsets,
+                  device_span<uint8_t* const> partition_data,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      gather_map.size(),
+      [source = input.data<T>(), gather_map, partition_offsets, partition_data] __device__(
+        size_type row) {
+        auto const partition = thrust::distance(partition_offsets.begin(),
+                                                thrust::upper_bound(thrust::seq,
+                                                                    partition_offsets.begin(),
+                                                                    partition_offsets.end(),
+                                                                    row)) -
+                               1;
+        reinterpret_cast<T*>(partition_data[partition])[row - partition_offsets[partition]] =
+          source[gather_map[row]];
+      });
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not is_rep_layout_compatible<T>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported type for hash_partition_and_pack");
+  }
+};
+
+/**
+ * @brief Builds the null masks of a column, in partition-major order, in the packed buffers of
+ * its partitions, and counts the nulls of every partition.
+ */
+void pack_partition_null_masks(column_view const& input,
+                               device_span<size_type const> gather_map,
+                               device_span<size_type const> partition_offsets,
+                               host_span<size_type const> h_partition_offsets,
+                               device_span<bitmask_type* const> partition_masks,
+                               device_span<size_type> partition_null_counts,
+                               rmm::cuda_stream_view stream)
+{
+  auto const num_partitions = static_cast<size_type>(partition_masks.size());
+  std::vector<size_type> h_word_offsets(num_partitions + 1, 0);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    h_word_offsets[p + 1] =
+      h_word_offsets[p] + num_bitmask_words(h_partition_offsets[p + 1] - h_partition_offsets[p]);
+  }
+  auto const word_offsets = cudf::detail::make_device_uvector_async(
+    h_word_offsets, stream, rmm::mr::get_current_device_resource());
+
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    h_word_offsets.back(),
+    [mask        = input.null_mask(),
+     mask_offset = input.offset(),
+     gather_map,
+     partition_offsets,
+     word_offsets = device_span<size_type const>(word_offsets),
+     partition_masks,
+     partition_null_counts] __device__(size_type index) {
+      auto const partition =
+        thrust::distance(
+          word_offsets.begin(),
+          thrust::upper_bound(thrust::seq, word_offsets.begin(), word_offsets.end(), index)) -
+        1;
+      auto const bits_per_word = static_cast<size_type>(detail::size_in_bits<bitmask_type>());
+      auto const word          = index - word_offsets[partition];
+      auto const begin         = partition_offsets[partition] + word * bits_per_word;
+      auto const end = cuda::std::min(begin + bits_per_word, partition_offsets[partition + 1]);
+      bitmask_type bits = 0;
+      for (auto row = begin; row < end; ++row) {
+        if (bit_is_set(mask, mask_offset + gather_map[row])) {
+          bits |= bitmask_type{1} << (row - begin);
+        }
+      }
+      partition_masks[partition][word] = bits;
+      auto const num_nulls             = (end - begin) - __popc(bits);
+      if (num_nulls > 0) { atomicAdd(&partition_null_counts[partition], num_nulls); }
+    });
+}
+
+template <template <typename> class hash_function>
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(
+    num_partitions > 0, "The number of partitions must be positive", std::invalid_argument);
+  auto const table_to_hash = input.select(columns_to_hash);
+
+  // only flat fixed-width columns are packed straight from the input rows, the others are
+  // partitioned and then split
+  bool const is_flat_fixed_width = std::all_of(
+    input.begin(), input.end(), [](auto const& col) { return is_fixed_width(col.type()); });
+  if (!is_flat_fixed_width || input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    auto const [partitioned, offsets] = hash_partition<hash_function>(
+      input, columns_to_hash, num_partitions, seed, stream, rmm::mr::get_current_device_resource());
+    std::vector<size_type> const splits(offsets.begin() + 1, offsets.end());
+    return contiguous_split(partitioned->view(), splits, stream, mr);
+  }
+
+  auto const [scatter_map, h_partition_offsets] =
+    has_nested_nulls(table_to_hash)
+      ? hash_partition_scatter_map<hash_function, true>(table_to_hash, num_partitions, seed, stream)
+      : hash_partition_scatter_map<hash_function, false>(
+          table_to_hash, num_partitions, seed, stream);
+  auto const num_rows = input.num_rows();
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  thrust::scatter(rmm::exec_policy_nosync(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  scatter_map.begin(),
+                  gather_map.begin());
+  auto const partition_offsets = cudf::detail::make_device_uvector_async(
+    h_partition_offsets, stream, rmm::mr::get_current_device_resource());
+
+  // lay out every partition like contiguous_split: the data and null mask of each column, each
+  // aligned to `split_align` bytes
+  constexpr std::size_t split_align = 64;
+  auto const num_columns            = input.num_columns();
+  auto const layout_index           = [num_partitions](size_type col, size_type partition) {
+    return static_cast<std::size_t>(col) * num_partitions + partition;
+  };
+  std::vector<std::size_t> data_offsets(num_columns * num_partitions);
+  std::vector<std::size_t> mask_offsets(num_columns * num_partitions);
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers;
+  buffers.reserve(num_partitions);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const partition_size = h_partition_offsets[p + 1] - h_partition_offsets[p];
+    std::size_t buffer_size   = 0;
+    if (partition_size > 0) {
+      for (size_type c = 0; c < num_columns; ++c) {
+        auto const& col                  = input.column(c);
+        data_offsets[layout_index(c, p)] = util::round_up_safe(buffer_size, split_align);
+        buffer_size =
+          data_offsets[layout_index(c, p)] + partition_size * cudf::size_of(col.type());
+        if (col.nullable()) {
+          mask_offsets[layout_index(c, p)] = util::round_up_safe(buffer_size, split_align);
+          buffer_size                      = mask_offsets[layout_index(c, p)] +
+                        bitmask_allocation_size_bytes(partition_size, split_align);
+        }
+      }
+    }
+    buffers.push_back(std::make_unique<rmm::device_buffer>(buffer_size, stream, mr));
+  }
+
+  std::vector<uint8_t*> h_partition_data(num_columns * num_partitions, nullptr);
+  std::vector<bitmask_type*> h_partition_masks(num_columns * num_partitions, nullptr);
+  for (size_type c = 0; c < num_columns; ++c) {
+    for (size_type p = 0; p < num_partitions; ++p) {
+      if (h_partition_offsets[p + 1] == h_partition_offsets[p]) { continue; }
+      auto const base = static_cast<uint8_t*>(buffers[p]->data());
+      h_partition_data[layout_index(c, p)] = base + data_offsets[layout_index(c, p)];
+      if (input.column(c).nullable()) {
+        h_partition_masks[layout_index(c, p)] =
+          reinterpret_cast<bitmask_type*>(base + mask_offsets[layout_index(c, p)]);
+      }
+    }
+  }
+  auto const partition_data = cudf::detail::make_device_uvector_async(
+    h_partition_data, stream, rmm::mr::get_current_device_resource());
+  auto const partition_masks = cudf::detail::make_device_uvector_async(
+    h_partition_masks, stream, rmm::mr::get_current_device_resource());
+  auto partition_null_counts = cudf::detail::make_zeroed_device_uvector_async<size_type>(
+    num_columns * num_partitions, stream, rmm::mr::get_current_device_resource());
+
+  // every row is read once and written once, straight into its packed partition
+  auto const all_data   = device_span<uint8_t* const>(partition_data);
+  auto const all_masks  = device_span<bitmask_type* const>(partition_masks);
+  auto const all_counts = device_span<size_type>(partition_null_counts);
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const& col = input.column(c);
+    type_dispatcher<dispatch_storage_type>(
+      col.type(),
+      pack_partition_rows_fn{},
+      col,
+      gather_map,
+      partition_offsets,
+      all_data.subspan(layout_index(c, 0), num_partitions),
+      stream);
+    if (col.nullable()) {
+      pack_partition_null_masks(col,
+                                gather_map,
+                                partition_offsets,
+                                h_partition_offsets,
+                                all_masks.subspan(layout_index(c, 0), num_partitions),
+                                all_counts.subspan(layout_index(c, 0), num_partitions),
+                                stream);
+    }
+  }
+  auto const h_null_counts = cudf::detail::make_std_vector_sync(partition_null_counts, stream);
+
+  std::vector<packed_table> result;
+  result.reserve(num_partitions);
+  auto builder = cudf::detail::metadata_builder(num_columns);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const partition_size = h_partition_offsets[p + 1] - h_partition_offsets[p];
+    std::vector<column_view> columns;
+    columns.reserve(num_columns);
+    for (size_type c = 0; c < num_columns; ++c) {
+      columns.emplace_back(input.column(c).type(),
+                           partition_size,
+                           h_partition_data[layout_index(c, p)],
+                           h_partition_masks[layout_index(c, p)],
+                           h_null_counts[layout_index(c, p)]);
+    }
+    auto const partition = table_view{columns};
+    auto metadata        = std::make_unique<std::vector<uint8_t>>(detail::pack_metadata(
+      partition, static_cast<uint8_t const*>(buffers[p]->data()), buffers[p]->size(), builder));
+    builder.clear();
+    result.push_back(
+      packed_table{partition, packed_columns{std::move(metadata), std::move(buffers[p])}});
+  }
+  return result;
+}
 }  // namespace
 
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
@@ -799,6 +1191,56 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, stream, mr);
 }
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& sort_keys,
+  size_type num_partitions,
+  double sample_fraction,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  int64_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(
+    num_partitions > 0, "The number of partitions must be positive", std::invalid_argument);
+  CUDF_EXPECTS(sample_fraction > 0 && sample_fraction <= 1,
+               "The sample fraction must be in (0, 1]",
+               std::invalid_argument);
+  auto const keys     = input.select(sort_keys);
+  auto const num_rows = input.num_rows();
+  if (num_rows == 0) {
+    return std::pair(empty_like(input), std::vector<size_type>(num_partitions + 1, 0));
+  }
+
+  auto const temp_mr     = rmm::mr::get_current_device_resource();
+  auto const num_samples = std::min(
+    num_rows,
+    std::max(num_partitions, static_cast<size_type>(std::ceil(sample_fraction * num_rows))));
+  auto const samples =
+    detail::sample(keys, num_samples, sample_with_replacement::FALSE, seed, stream, temp_mr);
+  auto const sorted_samples =
+    detail::sort(samples->view(), column_order, null_precedence, stream, temp_mr);
+
+  // boundary `i` is the first sample of the quantile `i + 1` of the sorted samples
+  auto const boundary_rows = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(1),
+    cuda::proclaim_return_type<size_type>([num_samples, num_partitions] __device__(size_type i) {
+      return static_cast<size_type>(static_cast<int64_t>(i) * num_samples / num_partitions);
+    }));
+  auto const boundaries = detail::gather(sorted_samples->view(),
+                                         boundary_rows,
+                                         boundary_rows + (num_partitions - 1),
+                                         out_of_bounds_policy::DONT_CHECK,
+                                         stream,
+                                         temp_mr);
+
+  // the number of boundaries less than or equal to a row is its partition
+  auto const partition_map =
+    detail::upper_bound(boundaries->view(), keys, column_order, null_precedence, stream, temp_mr);
+  return detail::partition(input, partition_map->view(), num_partitions, stream, mr);
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -824,10 +1266,67 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
     case (hash_id::HASH_MURMUR3):
       return detail::hash_partition<cudf::hashing::detail::MurmurHash3_x86_32>(
         input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64):
+      // the partition map uses the low 32 bits of each row hash
+      return detail::hash_partition<cudf::hashing::detail::XXHash_64>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
     default: CUDF_FAIL("Unsupported hash function in hash_partition");
   }
 }
 
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  hash_id hash_function,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  switch (hash_function) {
+    case (hash_id::HASH_IDENTITY):
+      for (size_type const& column_id : columns_to_hash) {
+        if (!is_numeric(input.column(column_id).type()))
+          CUDF_FAIL("IdentityHash does not support this data type");
+      }
+      return detail::hash_partition_and_pack<cudf::detail::IdentityHash>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3):
+      return detail::hash_partition_and_pack<cudf::hashing::detail::MurmurHash3_x86_32>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64):
+      // the partition map uses the low 32 bits of each row hash
+      return detail::hash_partition_and_pack<cudf::hashing::detail::XXHash_64>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    default: CUDF_FAIL("Unsupported hash function in hash_partition_and_pack");
+  }
+}
+
+// Partition based on the quantiles of a sample of the sort keys
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& sort_keys,
+  size_type num_partitions,
+  double sample_fraction,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  int64_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(input,
+                                 sort_keys,
+                                 num_partitions,
+                                 sample_fraction,
+                                 column_order,
+                                 null_precedence,
+                                 seed,
+                                 stream,
+                                 mr);
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "quantiles/quantiles_util.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Number of bits of the key selected by each histogram pass
+constexpr int radix_bits = 8;
+constexpr int radix_bins = 1 << radix_bits;
+
+// Ranks selected together; quantiles needing more distinct ranks sort the input instead
+constexpr size_type max_select_ranks = 8;
+
+constexpr size_type select_block_size        = 256;
+constexpr size_type select_items_per_thread  = 32;
+constexpr size_type select_histogram_entries = max_select_ranks * radix_bins;
+
+/**
+ * @brief Unsigned integer type whose values sort like the values of type `T`
+ */
+template <typename T>
+using radix_key_t = std::conditional_t<
+  sizeof(T) == 1,
+  uint8_t,
+  std::conditional_t<
+    sizeof(T) == 2,
+    uint16_t,
+    std::conditional_t<sizeof(T) == 4,
+                       uint32_t,
+                       std::conditional_t<sizeof(T) == 8, uint64_t, unsigned __int128>>>>;
+
+template <typename To, typename From>
+CUDF_HOST_DEVICE inline To copy_bits(From value)
+{
+  To result;
+  memcpy(&result, &value, sizeof(To));
+  return result;
+}
+
+/**
+ * @brief Maps a value to a key such that the keys of smaller values are smaller.
+ *
+ * NaNs are greater than all the other floating-point values, as in `sorted_order`, and negative
+ * zeros are equal to positive ones.
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline radix_key_t<T> to_radix_key(T value)
+{
+  using Key = radix_key_t<T>;
+  if constexpr (std::is_floating_point_v<T>) {
+    if (value != value) { value = std::numeric_limits<T>::quiet_NaN(); }
+    if (value == T{0}) { value = T{0}; }
+    auto constexpr sign = Key{1} << (sizeof(Key) * 8 - 1);
+    auto const bits     = copy_bits<Key>(value);
+    return (bits & sign) ? static_cast<Key>(~bits) : static_cast<Key>(bits | sign);
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return static_cast<Key>(value);
+  } else if constexpr (std::is_signed_v<T> || std::is_same_v<T, __int128_t>) {
+    auto constexpr sign = Key{1} << (sizeof(Key) * 8 - 1);
+    return static_cast<Key>(static_cast<Key>(value) ^ sign);
+  } else {
+    return static_cast<Key>(value);
+  }
+}
+
+/**
+ * @brief Returns the value whose key is `key`, the inverse of `to_radix_key`
+ */
+template <typename T>
+T from_radix_key(radix_key_t<T> key)
+{
+  using Key = radix_key_t<T>;
+  if constexpr (std::is_floating_point_v<T>) {
+    auto constexpr sign = Key{1} << (sizeof(Key) * 8 - 1);
+    return copy_bits<T>((key & sign) ? static_cast<Key>(key ^ sign) : static_cast<Key>(~key));
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return key != 0;
+  } else if constexpr (std::is_signed_v<T> || std::is_same_v<T, __int128_t>) {
+    auto constexpr sign = Key{1} << (sizeof(Key) * 8 - 1);
+    return static_cast<T>(static_cast<Key>(key ^ sign));
+  } else {
+    return static_cast<T>(key);
+  }
+}
+
+/**
+ * @brief The key bits of the ranks selected by the previous passes
+ */
+template <typename Key>
+struct rank_prefixes {
+  Key values[max_select_ranks];
+};
+
+/**
+ * @brief Counts the digits at `shift` of the keys of the valid values that match the prefix of
+ * each rank.
+ *
+ * Each block counts its values in shared memory and adds its non-zero counts to `histograms`,
+ * which holds `radix_bins` counts per rank.
+ */
+template <typename T>
+CUDF_KERNEL void __launch_bounds__(select_block_size)
+  radix_select_histogram_kernel(column_device_view input,
+                                size_type num_ranks,
+                                rank_prefixes<radix_key_t<T>> prefixes,
+                                radix_key_t<T> prefix_mask,
+                                int shift,
+                                size_type* histograms)
+{
+  __shared__ size_type block_histograms[select_histogram_entries];
+  for (auto i = static_cast<int>(threadIdx.x); i < num_ranks * radix_bins; i += blockDim.x) {
+    block_histograms[i] = 0;
+  }
+  __syncthreads();
+
+  auto const stride = grid_1d::grid_stride();
+  for (auto idx = grid_1d::global_thread_id(); idx < input.size(); idx += stride) {
+    auto const row = static_cast<size_type>(idx);
+    if (input.is_null(row)) { continue; }
+    auto const key   = to_radix_key(input.element<T>(row));
+    auto const digit = static_cast<int>((key >> shift) & (radix_bins - 1));
+    for (size_type r = 0; r < num_ranks; ++r) {
+      if ((key & prefix_mask) == prefixes.values[r]) {
+        atomicAdd(&block_histograms[r * radix_bins + digit], 1);
+      }
+    }
+  }
+  __syncthreads();
+
+  for (auto i = static_cast<int>(threadIdx.x); i < num_ranks * radix_bins; i += blockDim.x) {
+    if (block_histograms[i] > 0) { atomicAdd(&histograms[i], block_histograms[i]); }
+  }
+}
+
+/**
+ * @brief Finds the valid values of `input` at the given ranks of its sorted order.
+ *
+ * Every pass selects the next `radix_bits` bits of the key of each rank from the histogram of
+ * those bits in the values whose previous bits match the ones selected so far.
+ *
+ * @param input Column of values
+ * @param ranks Sorted distinct ranks, smaller than the number of valid values
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The value at each rank
+ */
+template <typename T>
+std::vector<T> radix_select(column_view const& input,
+                            std::vector<size_type> const& ranks,
+                            rmm::cuda_stream_view stream)
+{
+  using Key            = radix_key_t<T>;
+  auto const num_ranks = static_cast<size_type>(ranks.size());
+  auto const d_input   = column_device_view::create(input, stream);
+  auto const config    = grid_1d{input.size(), select_block_size, select_items_per_thread};
+  auto remaining_ranks = ranks;
+  auto prefixes        = rank_prefixes<Key>{};
+  auto prefix_mask     = Key{0};
+  rmm::device_uvector<size_type> histograms(num_ranks * radix_bins, stream);
+
+  for (int shift = static_cast<int>(sizeof(Key)) * 8 - radix_bits; shift >= 0;
+       shift -= radix_bits) {
+    CUDF_CUDA_TRY(cudaMemsetAsync(
+      histograms.data(), 0, histograms.size() * sizeof(size_type), stream.value()));
+    radix_select_histogram_kernel<T>
+      <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+        *d_input, num_ranks, prefixes, prefix_mask, shift, histograms.data());
+    CUDF_CHECK_CUDA(stream.value());
+
+    auto const h_histograms = cudf::detail::make_std_vector_sync(histograms, stream);
+    for (size_type r = 0; r < num_ranks; ++r) {
+      auto const histogram = h_histograms.begin() + r * radix_bins;
+      auto digit           = 0;
+      while (remaining_ranks[r] >= histogram[digit]) {
+        remaining_ranks[r] -= histogram[digit++];
+      }
+      prefixes.values[r] |= static_cast<Key>(digit) << shift;
+    }
+    prefix_mask |= static_cast<Key>(radix_bins - 1) << shift;
+  }
+
+  std::vector<T> values(num_ranks);
+  std::transform(prefixes.values, prefixes.values + num_ranks, values.begin(), [](Key key) {
+    return from_radix_key<T>(key);
+  });
+  return values;
+}
+
+/**
+ * @brief Returns the ranks of the sorted values that are interpolated to compute quantile `q`
+ */
+std::vector<size_type> quantile_ranks(size_type size, double q, interpolation interp)
+{
+  if (size < 2) { return {0}; }
+  auto const idx = quantile_index(size, q);
+  switch (interp) {
+    case interpolation::LINEAR:
+    case interpolation::MIDPOINT: return {idx.lower, idx.higher};
+    case interpolation::LOWER: return {idx.lower};
+    case interpolation::HIGHER: return {idx.higher};
+    case interpolation::NEAREST: return {idx.nearest};
+    default: CUDF_FAIL("Invalid interpolation operation for quantiles.");
+  }
+}
+
+template <bool exact>
+struct quantile_select_functor {
+  std::vector<double> const& q;
+  interpolation interp;
+  rmm::cuda_stream_view stream;
+  rmm::mr::device_memory_resource* mr;
+
+  template <typename T>
+  std::enable_if_t<not std::is_arithmetic_v<T> and not cudf::is_fixed_point<T>(),
+                   std::unique_ptr<column>>
+  operator()(column_view const&, std::vector<size_type> const&)
+  {
+    CUDF_FAIL("quantile does not support non-numeric types");
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic_v<T> or cudf::is_fixed_point<T>(), std::unique_ptr<column>>
+  operator()(column_view const& input, std::vector<size_type> const& ranks)
+  {
+    using StorageType   = cudf::device_storage_type_t<T>;
+    using ExactResult   = std::conditional_t<exact and not cudf::is_fixed_point<T>(), double, T>;
+    using StorageResult = cudf::device_storage_type_t<ExactResult>;
+    // avoids std::vector<bool> for the results of non-exact quantiles of BOOL8 values
+    using HostResult =
+      std::conditional_t<std::is_same_v<StorageResult, bool>, int8_t, StorageResult>;
+
+    auto const values    = radix_select<StorageType>(input, ranks, stream);
+    auto const num_valid = input.size() - input.null_count();
+    auto const value_at  = [&](size_type rank) {
+      auto const position = std::lower_bound(ranks.begin(), ranks.end(), rank) - ranks.begin();
+      return values[position];
+    };
+
+    std::vector<HostResult> h_output(q.size());
+    std::transform(q.begin(), q.end(), h_output.begin(), [&](double quantile) {
+      return static_cast<HostResult>(
+        select_quantile<StorageResult>(value_at, num_valid, quantile, interp));
+    });
+
+    auto const type =
+      is_fixed_point(input.type()) ? input.type() : data_type{type_to_id<StorageResult>()};
+    auto output = make_fixed_width_column(type, q.size(), mask_state::UNALLOCATED, stream, mr);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(output->mutable_view().head(),
+                                  h_output.data(),
+                                  h_output.size() * sizeof(HostResult),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    stream.synchronize();
+    return output;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> quantile_unsorted(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const num_valid = input.size() - input.null_count();
+  if (q.empty() || num_valid == 0) {
+    // the quantiles of no value are all null
+    auto const no_values = cudf::detail::slice(input, {0, 0}, stream).front();
+    return detail::quantile(no_values, q, interp, column_view{}, exact, stream, mr);
+  }
+
+  std::vector<size_type> ranks;
+  for (auto const quantile : q) {
+    auto const quantile_rank = quantile_ranks(num_valid, quantile, interp);
+    ranks.insert(ranks.end(), quantile_rank.begin(), quantile_rank.end());
+  }
+  std::sort(ranks.begin(), ranks.end());
+  ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+
+  if (cudf::is_dictionary(input.type()) || ranks.size() > max_select_ranks) {
+    // selecting many ranks costs more passes than sorting once
+    auto const sorted_indices = detail::sorted_order(table_view{{input}},
+                                                     {order::ASCENDING},
+                                                     {null_order::AFTER},
+                                                     stream,
+                                                     rmm::mr::get_current_device_resource());
+    auto const valid_indices =
+      cudf::detail::slice(sorted_indices->view(), {0, num_valid}, stream).front();
+    return detail::quantile(input, q, interp, valid_indices, exact, stream, mr);
+  }
+
+  if (exact) {
+    return type_dispatcher(
+      input.type(), quantile_select_functor<true>{q, interp, stream, mr}, input, ranks);
+  }
+  return type_dispatcher(
+    input.type(), quantile_select_functor<false>{q, interp, stream, mr}, input, ranks);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> quantile_unsorted(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::quantile_unsorted(input, q, interp, exact, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
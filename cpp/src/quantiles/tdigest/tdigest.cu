@@ -18,6 +18,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/valid_if.cuh>
@@ -342,6 +343,9 @@ std::unique_ptr<scalar> make_empty_tdigest_scalar(rmm::cuda_stream_view stream,
 }
 
 }  // namespace detail
+}  // namespace tdigest
+
+namespace detail {
 
 std::unique_ptr<column> percentile_approx(tdigest_column_view const& input,
                                           column_view const& percentiles,
@@ -357,8 +361,8 @@ std::unique_ptr<column> percentile_approx(tdigest_column_view const& input,
     data_type{type_id::INT32}, input.size() + 1, mask_state::UNALLOCATED, stream, mr);
   auto const all_empty_rows =
     thrust::count_if(rmm::exec_policy(stream),
-                     detail::size_begin(input),
-                     detail::size_begin(input) + input.size(),
+                     tdigest::detail::size_begin(input),
+                     tdigest::detail::size_begin(input) + input.size(),
                      [] __device__(auto const x) { return x == 0; }) == input.size();
   auto row_size_iter = thrust::make_constant_iterator(all_empty_rows ? 0 : percentiles.size());
   thrust::exclusive_scan(rmm::exec_policy(stream),
@@ -382,7 +386,7 @@ std::unique_ptr<column> percentile_approx(tdigest_column_view const& input,
   // uninitialized)
   auto [bitmask, null_count] = [stream, mr, &tdv]() {
     auto tdigest_is_empty = thrust::make_transform_iterator(
-      detail::size_begin(tdv),
+      tdigest::detail::size_begin(tdv),
       cuda::proclaim_return_type<size_type>(
         [] __device__(size_type tdigest_size) -> size_type { return tdigest_size == 0; }));
     auto const null_count =
@@ -394,23 +398,24 @@ std::unique_ptr<column> percentile_approx(tdigest_column_view const& input,
       tdigest_is_empty, tdigest_is_empty + tdv.size(), thrust::logical_not{}, stream, mr);
   }();
 
-  return cudf::make_lists_column(input.size(),
-                                 std::move(offsets),
-                                 detail::compute_approx_percentiles(input, percentiles, stream, mr),
-                                 null_count,
-                                 std::move(bitmask),
-                                 stream,
-                                 mr);
+  return cudf::make_lists_column(
+    input.size(),
+    std::move(offsets),
+    tdigest::detail::compute_approx_percentiles(input, percentiles, stream, mr),
+    null_count,
+    std::move(bitmask),
+    stream,
+    mr);
 }
 
-}  // namespace tdigest
+}  // namespace detail
 
 std::unique_ptr<column> percentile_approx(tdigest_column_view const& input,
                                           column_view const& percentiles,
                                           rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return tdigest::percentile_approx(input, percentiles, cudf::get_default_stream(), mr);
+  return detail::percentile_approx(input, percentiles, cudf::get_default_stream(), mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/tdigest/tdigest.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/tdigest/tdigest_accumulator.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace cudf {
+namespace tdigest {
+namespace {
+
+/**
+ * @brief Creates a column of `num_groups` empty tdigests.
+ */
+std::unique_ptr<column> make_empty_tdigests(size_type num_groups,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto make_zeros = [&](data_type type, size_type size) {
+    auto col = cudf::make_fixed_width_column(type, size, mask_state::UNALLOCATED, stream, mr);
+    CUDF_CUDA_TRY(cudaMemsetAsync(col->mutable_view().head(),
+                                  0,
+                                  size * cudf::size_of(type),
+                                  stream.value()));
+    return col;
+  };
+  return detail::make_tdigest_column(num_groups,
+                                     make_empty_column(type_id::FLOAT64),
+                                     make_empty_column(type_id::FLOAT64),
+                                     make_zeros(data_type{type_id::INT32}, num_groups + 1),
+                                     make_zeros(data_type{type_id::FLOAT64}, num_groups),
+                                     make_zeros(data_type{type_id::FLOAT64}, num_groups),
+                                     stream,
+                                     mr);
+}
+
+/**
+ * @brief Maps the rows of the digests of a group to the rows of the batch-major concatenation of
+ * the digests of all the groups
+ */
+struct group_major_row_fn {
+  size_type num_batches;
+  size_type num_groups;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    return (row % num_batches) * num_groups + row / num_batches;
+  }
+};
+
+}  // namespace
+
+tdigest_accumulator::~tdigest_accumulator() = default;
+
+tdigest_accumulator::tdigest_accumulator(tdigest_accumulator&&) = default;
+
+tdigest_accumulator& tdigest_accumulator::operator=(tdigest_accumulator&&) = default;
+
+tdigest_accumulator::tdigest_accumulator(size_type num_groups,
+                                         int max_centroids,
+                                         size_type max_pending_batches,
+                                         rmm::cuda_stream_view stream)
+  : _num_groups{num_groups},
+    _max_centroids{max_centroids},
+    _max_pending_batches{max_pending_batches}
+{
+  CUDF_EXPECTS(num_groups > 0, "The number of groups must be positive", std::invalid_argument);
+  CUDF_EXPECTS(max_centroids > 0, "max_centroids must be positive", std::invalid_argument);
+  CUDF_EXPECTS(max_pending_batches > 0,
+               "The number of pending batches must be positive",
+               std::invalid_argument);
+  _digests = make_empty_tdigests(num_groups, stream, rmm::mr::get_current_device_resource());
+}
+
+void tdigest_accumulator::add(column_view const& group_labels,
+                              column_view const& values,
+                              rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(group_labels.type().id() == type_id::INT32 && !group_labels.nullable(),
+               "Group labels must be a non-nullable INT32 column",
+               std::invalid_argument);
+  CUDF_EXPECTS(group_labels.size() == values.size(),
+               "Group labels and values must have the same number of rows",
+               std::invalid_argument);
+  CUDF_EXPECTS(cudf::is_numeric(values.type()) || cudf::is_fixed_point(values.type()),
+               "tdigests can only be computed from numeric or fixed-point values",
+               std::invalid_argument);
+  if (values.is_empty()) { return; }
+
+  // group_tdigest expects the values sorted within each group, with the nulls at the end
+  auto const sorted = cudf::detail::sort(table_view{{group_labels, values}},
+                                         {order::ASCENDING, order::ASCENDING},
+                                         {null_order::AFTER, null_order::AFTER},
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+  auto const labels        = sorted->get_column(0).view();
+  auto const sorted_values = sorted->get_column(1).view();
+  auto const num_rows      = sorted_values.size();
+
+  auto const min_label = cudf::detail::get_value<size_type>(labels, 0, stream);
+  auto const max_label = cudf::detail::get_value<size_type>(labels, num_rows - 1, stream);
+  CUDF_EXPECTS(min_label >= 0 && max_label < _num_groups,
+               "Group labels must be in [0, num_groups)",
+               std::invalid_argument);
+
+  // every group gets an offset, so groups absent from the batch are empty
+  rmm::device_uvector<size_type> group_offsets(_num_groups + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      labels.begin<size_type>(),
+                      labels.end<size_type>(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(_num_groups + 1),
+                      group_offsets.begin());
+
+  // the valid values of each group precede its nulls, so counting the valid values before
+  // every row gives the per-group valid counts from the group offsets
+  auto const d_values = column_device_view::create(sorted_values, stream);
+  auto const is_valid = cudf::detail::make_counting_transform_iterator(
+    0,
+    cuda::proclaim_return_type<size_type>(
+      [values = *d_values, num_rows] __device__(size_type row) -> size_type {
+        return row < num_rows && values.is_valid(row);
+      }));
+  rmm::device_uvector<size_type> valid_offsets(num_rows + 1, stream);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), is_valid, is_valid + num_rows + 1, valid_offsets.begin());
+
+  rmm::device_uvector<size_type> group_valid_counts(_num_groups, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    group_offsets.begin(),
+                    group_offsets.end() - 1,
+                    group_offsets.begin() + 1,
+                    group_valid_counts.begin(),
+                    cuda::proclaim_return_type<size_type>(
+                      [valid_offsets = valid_offsets.data()] __device__(
+                        size_type begin, size_type end) -> size_type {
+                        return valid_offsets[end] - valid_offsets[begin];
+                      }));
+
+  _pending.push_back(detail::group_tdigest(sorted_values,
+                                           group_offsets,
+                                           {labels.begin<size_type>(), labels.end<size_type>()},
+                                           group_valid_counts,
+                                           _num_groups,
+                                           _max_centroids,
+                                           stream,
+                                           rmm::mr::get_current_device_resource()));
+  if (num_pending_batches() >= _max_pending_batches) { flush(stream); }
+}
+
+void tdigest_accumulator::merge(tdigest_column_view const& tdigests, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(tdigests.size() == _num_groups,
+               "The tdigests to merge must have one row per group",
+               std::invalid_argument);
+  _pending.push_back(
+    std::make_unique<column>(tdigests.parent(), stream, rmm::mr::get_current_device_resource()));
+  if (num_pending_batches() >= _max_pending_batches) { flush(stream); }
+}
+
+void tdigest_accumulator::flush(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  if (_pending.empty()) { return; }
+
+  std::vector<column_view> batches{_digests->view()};
+  std::transform(_pending.begin(),
+                 _pending.end(),
+                 std::back_inserter(batches),
+                 [](auto const& batch) { return batch->view(); });
+  auto const num_batches = static_cast<size_type>(batches.size());
+  auto const all_digests =
+    cudf::detail::concatenate(batches, stream, rmm::mr::get_current_device_resource());
+
+  // reorder the digests group by group, as group_merge_tdigest expects: the digest of the batch
+  // `b` of group `g` moves from row `b * num_groups + g` to row `g * num_batches + b`
+  auto const num_rows = num_batches * _num_groups;
+  auto const gather_map = cudf::detail::make_counting_transform_iterator(
+    0, group_major_row_fn{num_batches, _num_groups});
+  auto const grouped = cudf::detail::gather(table_view{{all_digests->view()}},
+                                            gather_map,
+                                            gather_map + num_rows,
+                                            out_of_bounds_policy::DONT_CHECK,
+                                            stream,
+                                            rmm::mr::get_current_device_resource());
+
+  rmm::device_uvector<size_type> group_offsets(_num_groups + 1, stream);
+  thrust::sequence(
+    rmm::exec_policy(stream), group_offsets.begin(), group_offsets.end(), 0, num_batches);
+  rmm::device_uvector<size_type> group_labels(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    group_labels.begin(),
+                    cuda::proclaim_return_type<size_type>(
+                      [num_batches] __device__(size_type row) -> size_type {
+                        return row / num_batches;
+                      }));
+
+  _digests = detail::group_merge_tdigest(grouped->get_column(0).view(),
+                                         group_offsets,
+                                         group_labels,
+                                         _num_groups,
+                                         _max_centroids,
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+  _pending.clear();
+}
+
+tdigest_column_view tdigest_accumulator::digests(rmm::cuda_stream_view stream)
+{
+  flush(stream);
+  return tdigest_column_view{_digests->view()};
+}
+
+std::unique_ptr<column> tdigest_accumulator::percentile_approx(column_view const& percentiles,
+                                                               rmm::cuda_stream_view stream,
+                                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::percentile_approx(digests(stream), percentiles, stream, mr);
+}
+
+}  // namespace tdigest
+}  // namespace cudf
@@ -0,0 +1,539 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/reduction/detail/reduction_operators.cuh>
+#include <cudf/scalar/scalar_batch.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_reduce.cuh>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace reduction {
+namespace detail {
+namespace {
+
+/**
+ * @brief Partial results of every reduction computed by the fused pass over a column
+ *
+ * Sums and products are accumulated in `int64_t` for integral columns and in `double` for
+ * floating-point columns, while the moments of MEAN, VARIANCE and STD are always accumulated in
+ * `double`, like the compound reductions.
+ */
+template <typename T>
+struct multi_reduce_accumulator {
+  using sum_type = std::conditional_t<std::is_floating_point_v<T>, double, int64_t>;
+
+  size_type count;          ///< Number of valid elements
+  size_type nonzero_count;  ///< Number of valid elements that are not zero, for ANY and ALL
+  sum_type sum;
+  sum_type product;
+  sum_type sum_of_squares;
+  var_std<double> moments;  ///< Sum and sum of squares for MEAN, VARIANCE and STD
+  T min;
+  T max;
+
+  static CUDF_HOST_DEVICE multi_reduce_accumulator identity()
+  {
+    return {0,
+            0,
+            sum_type{0},
+            sum_type{1},
+            sum_type{0},
+            var_std<double>{},
+            cudf::DeviceMin::identity<T>(),
+            cudf::DeviceMax::identity<T>()};
+  }
+};
+
+/**
+ * @brief Functor making the accumulator of a single row, or the identity for a null row
+ */
+template <typename T>
+struct make_accumulator_fn {
+  column_device_view d_col;
+
+  __device__ multi_reduce_accumulator<T> operator()(size_type idx) const
+  {
+    using accumulator = multi_reduce_accumulator<T>;
+    using sum_type    = typename accumulator::sum_type;
+    if (d_col.is_null(idx)) { return accumulator::identity(); }
+    auto const value = d_col.element<T>(idx);
+    auto const s     = static_cast<sum_type>(value);
+    auto const d     = static_cast<double>(value);
+    return {1, value != T{0}, s, s, s * s, var_std<double>{d, d * d}, value, value};
+  }
+};
+
+/**
+ * @brief Functor merging two accumulators
+ */
+template <typename T>
+struct merge_accumulators_fn {
+  __device__ multi_reduce_accumulator<T> operator()(multi_reduce_accumulator<T> const& lhs,
+                                                    multi_reduce_accumulator<T> const& rhs) const
+  {
+    return {lhs.count + rhs.count,
+            lhs.nonzero_count + rhs.nonzero_count,
+            lhs.sum + rhs.sum,
+            lhs.product * rhs.product,
+            lhs.sum_of_squares + rhs.sum_of_squares,
+            lhs.moments + rhs.moments,
+            cudf::DeviceMin{}(lhs.min, rhs.min),
+            cudf::DeviceMax{}(lhs.max, rhs.max)};
+  }
+};
+
+/// Returns whether the fused pass computes the reductions of columns of type `type`
+bool is_fusable_input(data_type type)
+{
+  return cudf::is_numeric(type) && type.id() != type_id::BOOL8;
+}
+
+/// Returns whether the fused pass computes the reduction `kind` with output type `output_dtype`
+bool is_fusable_aggregation(aggregation::Kind kind, data_type input_type, data_type output_dtype)
+{
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::SUM_OF_SQUARES:
+      return cudf::is_numeric(output_dtype) && output_dtype.id() != type_id::BOOL8;
+    case aggregation::MIN:
+    case aggregation::MAX: return output_dtype == input_type;
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return cudf::is_floating_point(output_dtype);
+    case aggregation::ANY:
+    case aggregation::ALL: return output_dtype.id() == type_id::BOOL8;
+    default: return false;
+  }
+}
+
+/// Delta degrees of freedom of a VARIANCE or STD aggregation, 0 for the other aggregations
+size_type ddof_of(aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::VARIANCE: return static_cast<cudf::detail::var_aggregation const&>(agg)._ddof;
+    case aggregation::STD: return static_cast<cudf::detail::std_aggregation const&>(agg)._ddof;
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Functor making a numeric scalar of the output type from a value of the accumulator
+ */
+struct make_numeric_result_fn {
+  template <typename OutputType, typename ValueType>
+  std::unique_ptr<scalar> operator()(ValueType value,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    if constexpr (cudf::is_numeric<OutputType>()) {
+      return cudf::make_fixed_width_scalar(static_cast<OutputType>(value), stream, mr);
+    } else {
+      CUDF_FAIL("Unsupported output data type");
+    }
+  }
+};
+
+/**
+ * @brief Dispatch functor running the fused pass and making the scalar of every fused reduction
+ */
+struct fused_reduce_dispatch_fn {
+  template <typename T>
+  void operator()(column_view const& col,
+                  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+                  host_span<data_type const> output_dtypes,
+                  std::vector<bool> const& fused,
+                  std::vector<std::unique_ptr<scalar>>& results,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr) const
+  {
+    if constexpr (cudf::is_numeric<T>() && !std::is_same_v<T, bool>) {
+      auto const d_col = column_device_view::create(col, stream);
+      auto const acc   = thrust::transform_reduce(rmm::exec_policy(stream),
+                                                thrust::make_counting_iterator<size_type>(0),
+                                                thrust::make_counting_iterator(col.size()),
+                                                make_accumulator_fn<T>{*d_col},
+                                                multi_reduce_accumulator<T>::identity(),
+                                                merge_accumulators_fn<T>{});
+
+      auto numeric_result = [&](auto value, data_type output_dtype) {
+        return type_dispatcher(output_dtype, make_numeric_result_fn{}, value, stream, mr);
+      };
+      auto variance_of = [&](aggregation const& agg) {
+        return op::variance::intermediate<double>::compute_result(
+          acc.moments, acc.count, ddof_of(agg));
+      };
+
+      for (std::size_t i = 0; i < aggs.size(); ++i) {
+        if (!fused[i]) { continue; }
+        auto const output_dtype = output_dtypes[i];
+        switch (aggs[i]->kind) {
+          case aggregation::SUM: results[i] = numeric_result(acc.sum, output_dtype); break;
+          case aggregation::PRODUCT: results[i] = numeric_result(acc.product, output_dtype); break;
+          case aggregation::SUM_OF_SQUARES:
+            results[i] = numeric_result(acc.sum_of_squares, output_dtype);
+            break;
+          case aggregation::MIN:
+            results[i] = cudf::make_fixed_width_scalar(acc.min, stream, mr);
+            break;
+          case aggregation::MAX:
+            results[i] = cudf::make_fixed_width_scalar(acc.max, stream, mr);
+            break;
+          case aggregation::MEAN:
+            results[i] = numeric_result(acc.moments.value / acc.count, output_dtype);
+            break;
+          case aggregation::VARIANCE:
+            results[i] = numeric_result(variance_of(*aggs[i]), output_dtype);
+            break;
+          case aggregation::STD:
+            results[i] = numeric_result(std::sqrt(variance_of(*aggs[i])), output_dtype);
+            break;
+          case aggregation::ANY:
+            results[i] = cudf::make_fixed_width_scalar(acc.nonzero_count > 0, stream, mr);
+            break;
+          case aggregation::ALL:
+            results[i] = cudf::make_fixed_width_scalar(acc.nonzero_count == acc.count, stream, mr);
+            break;
+          default: CUDF_FAIL("Unsupported fused reduction");
+        }
+      }
+    } else {
+      CUDF_FAIL("Unsupported column type for the fused reductions");
+    }
+  }
+};
+
+/**
+ * @brief A fused reduction writing its result to a value of a scalar batch
+ */
+struct fused_slot {
+  aggregation::Kind kind;
+  type_id output_type;
+  size_type ddof;  ///< Delta degrees of freedom of VARIANCE and STD
+  void* value;
+  bool* validity;
+};
+
+/**
+ * @brief Functor storing a value of the accumulator as a value of the output type
+ */
+struct store_value_fn {
+  template <typename OutputType, typename ValueType>
+  __device__ void operator()(void* output, ValueType value) const
+  {
+    if constexpr (cudf::is_numeric<OutputType>()) {
+      *static_cast<OutputType*>(output) = static_cast<OutputType>(value);
+    }
+  }
+};
+
+/**
+ * @brief Functor writing the result of a fused reduction from the accumulator in device memory
+ */
+template <typename T>
+struct write_fused_result_fn {
+  multi_reduce_accumulator<T> const* d_acc;
+
+  __device__ void operator()(fused_slot const& slot) const
+  {
+    auto const& acc = *d_acc;
+    auto store      = [&](auto value) {
+      type_dispatcher(data_type{slot.output_type}, store_value_fn{}, slot.value, value);
+    };
+    auto variance = [&] {
+      return op::variance::intermediate<double>::compute_result(acc.moments, acc.count, slot.ddof);
+    };
+
+    switch (slot.kind) {
+      case aggregation::SUM: store(acc.sum); break;
+      case aggregation::PRODUCT: store(acc.product); break;
+      case aggregation::SUM_OF_SQUARES: store(acc.sum_of_squares); break;
+      case aggregation::MIN: store(acc.min); break;
+      case aggregation::MAX: store(acc.max); break;
+      case aggregation::MEAN: store(acc.moments.value / acc.count); break;
+      case aggregation::VARIANCE: store(variance()); break;
+      case aggregation::STD: store(sqrt(variance())); break;
+      case aggregation::ANY: store(acc.nonzero_count > 0); break;
+      case aggregation::ALL: store(acc.nonzero_count == acc.count); break;
+      default: return;
+    }
+    *slot.validity = true;
+  }
+};
+
+/**
+ * @brief Dispatch functor running the fused pass and writing every fused reduction to a scalar
+ * batch, without synchronizing the stream
+ */
+struct fused_reduce_batch_dispatch_fn {
+  template <typename T>
+  void operator()(column_view const& col,
+                  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+                  std::vector<bool> const& fused,
+                  scalar_batch& results,
+                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (cudf::is_numeric<T>() && !std::is_same_v<T, bool>) {
+      using accumulator  = multi_reduce_accumulator<T>;
+      auto const temp_mr = rmm::mr::get_current_device_resource();
+      auto const d_col   = column_device_view::create(col, stream);
+      auto const input   = thrust::make_transform_iterator(
+        thrust::make_counting_iterator<size_type>(0), make_accumulator_fn<T>{*d_col});
+
+      // The accumulator stays in device memory, unlike the result of thrust::transform_reduce
+      auto d_acc                = rmm::device_scalar<accumulator>(stream, temp_mr);
+      std::size_t temp_bytes    = 0;
+      auto const reduce_rows    = [&](void* temp_storage) {
+        CUDF_CUDA_TRY(cub::DeviceReduce::Reduce(temp_storage,
+                                                temp_bytes,
+                                                input,
+                                                d_acc.data(),
+                                                col.size(),
+                                                merge_accumulators_fn<T>{},
+                                                accumulator::identity(),
+                                                stream.value()));
+      };
+      reduce_rows(nullptr);
+      auto temp_storage = rmm::device_buffer(temp_bytes, stream, temp_mr);
+      reduce_rows(temp_storage.data());
+
+      std::vector<fused_slot> slots;
+      for (std::size_t i = 0; i < aggs.size(); ++i) {
+        if (!fused[i]) { continue; }
+        auto const index = static_cast<size_type>(i);
+        slots.push_back({aggs[i]->kind,
+                         results.type(index).id(),
+                         ddof_of(*aggs[i]),
+                         results.data(index),
+                         results.validity_data(index)});
+      }
+      auto const d_slots = cudf::detail::make_device_uvector_async(slots, stream, temp_mr);
+      thrust::for_each(rmm::exec_policy_nosync(stream),
+                       d_slots.begin(),
+                       d_slots.end(),
+                       write_fused_result_fn<T>{d_acc.data()});
+    } else {
+      CUDF_FAIL("Unsupported column type for the fused reductions");
+    }
+  }
+};
+
+/**
+ * @brief Functor returning the device pointer to the value of a fixed-width scalar
+ */
+struct scalar_data_fn {
+  template <typename T>
+  void const* operator()(scalar const& s) const
+  {
+    if constexpr (cudf::is_fixed_width<T>()) {
+      return static_cast<scalar_type_t<T> const&>(s).data();
+    } else {
+      CUDF_FAIL("Unsupported scalar type", cudf::data_type_error);
+    }
+  }
+};
+
+/// Output type of a reduction of the table-wide `reduce_multiple`
+data_type default_output_type(aggregation::Kind kind, data_type input_type)
+{
+  switch (kind) {
+    case aggregation::ANY:
+    case aggregation::ALL: return data_type{type_id::BOOL8};
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return data_type{type_id::FLOAT64};
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::SUM_OF_SQUARES:
+      if (cudf::is_floating_point(input_type)) { return data_type{type_id::FLOAT64}; }
+      if (cudf::is_integral(input_type)) { return data_type{type_id::INT64}; }
+      return input_type;
+    default: return input_type;
+  }
+}
+
+/**
+ * @brief Validates the arguments of `reduce_multiple` and returns which reductions the fused pass
+ * computes
+ */
+std::vector<bool> fused_reductions(column_view const& col,
+                                   host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+                                   host_span<data_type const> output_dtypes)
+{
+  CUDF_EXPECTS(aggs.size() == output_dtypes.size(),
+               "Each aggregation requires an output type.",
+               std::invalid_argument);
+  CUDF_EXPECTS(
+    std::all_of(aggs.begin(), aggs.end(), [](auto const& agg) { return agg != nullptr; }),
+    "Null reduce aggregation.",
+    std::invalid_argument);
+
+  // Empty or all-null columns reduce without reading the data
+  auto fused = std::vector<bool>(aggs.size(), false);
+  if (col.size() > col.null_count() && is_fusable_input(col.type())) {
+    for (std::size_t i = 0; i < aggs.size(); ++i) {
+      fused[i] = is_fusable_aggregation(aggs[i]->kind, col.type(), output_dtypes[i]);
+    }
+  }
+  // A single fusable reduction is faster on its own than with the wider accumulator
+  if (std::count(fused.begin(), fused.end(), true) < 2) {
+    std::fill(fused.begin(), fused.end(), false);
+  }
+  return fused;
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> reduce_multiple(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const fused = fused_reductions(col, aggs, output_dtypes);
+
+  std::vector<std::unique_ptr<scalar>> results(aggs.size());
+  if (std::count(fused.begin(), fused.end(), true) > 0) {
+    type_dispatcher(
+      col.type(), fused_reduce_dispatch_fn{}, col, aggs, output_dtypes, fused, results, stream, mr);
+  }
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    if (!results[i]) {
+      results[i] = reduce(col, *aggs[i], output_dtypes[i], std::nullopt, stream, mr);
+    }
+  }
+  return results;
+}
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_multiple(
+  table_view const& table,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::vector<std::unique_ptr<scalar>>> results;
+  results.reserve(table.num_columns());
+  for (auto const& col : table) {
+    std::vector<data_type> output_dtypes;
+    output_dtypes.reserve(aggs.size());
+    std::transform(
+      aggs.begin(), aggs.end(), std::back_inserter(output_dtypes), [&](auto const& agg) {
+        return agg ? default_output_type(agg->kind, col.type()) : col.type();
+      });
+    results.push_back(reduce_multiple(col, aggs, output_dtypes, stream, mr));
+  }
+  return results;
+}
+
+
+scalar_batch reduce_batch(column_view const& col,
+                          host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+                          host_span<data_type const> output_dtypes,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr)
+{
+  auto const fused = fused_reductions(col, aggs, output_dtypes);
+  auto results =
+    scalar_batch(std::vector<data_type>(output_dtypes.begin(), output_dtypes.end()), stream, mr);
+
+  if (std::count(fused.begin(), fused.end(), true) > 0) {
+    type_dispatcher(
+      col.type(), fused_reduce_batch_dispatch_fn{}, col, aggs, fused, results, stream);
+  }
+  // The other reductions are copied into the batch, the temporary scalars are freed in stream order
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    if (fused[i]) { continue; }
+    auto const index  = static_cast<size_type>(i);
+    auto const result = reduce(col, *aggs[i], output_dtypes[i], std::nullopt, stream, temp_mr);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(results.data(index),
+                                  type_dispatcher(result->type(), scalar_data_fn{}, *result),
+                                  size_of(result->type()),
+                                  cudaMemcpyDeviceToDevice,
+                                  stream.value()));
+    CUDF_CUDA_TRY(cudaMemcpyAsync(results.validity_data(index),
+                                  result->validity_data(),
+                                  sizeof(bool),
+                                  cudaMemcpyDeviceToDevice,
+                                  stream.value()));
+  }
+  return results;
+}
+
+}  // namespace detail
+}  // namespace reduction
+
+std::vector<std::unique_ptr<scalar>> reduce_multiple(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::reduce_multiple(
+    col, aggs, output_dtypes, cudf::get_default_stream(), mr);
+}
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_multiple(
+  table_view const& table,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::reduce_multiple(table, aggs, cudf::get_default_stream(), mr);
+}
+
+scalar_batch reduce_batch(column_view const& col,
+                          host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+                          host_span<data_type const> output_dtypes,
+                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::reduce_batch(col, aggs, output_dtypes, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
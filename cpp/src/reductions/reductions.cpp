@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/aggregation/hllpp.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/quantiles.hpp>
@@ -141,6 +142,18 @@ struct reduce_dispatch_functor {
         auto td_agg = static_cast<cudf::detail::merge_tdigest_aggregation const&>(agg);
         return tdigest::detail::reduce_merge_tdigest(col, td_agg.max_centroids, stream, mr);
       }
+      case aggregation::HLLPP: {
+        CUDF_EXPECTS(output_dtype.id() == type_id::STRUCT,
+                     "HLLPP aggregations expect output type to be STRUCT");
+        auto hllpp_agg = static_cast<cudf::detail::hllpp_aggregation const&>(agg);
+        return cudf::detail::reduce_hllpp(col, hllpp_agg.precision, stream, mr);
+      }
+      case aggregation::MERGE_HLLPP: {
+        CUDF_EXPECTS(output_dtype.id() == type_id::STRUCT,
+                     "HLLPP aggregations expect output type to be STRUCT");
+        auto hllpp_agg = static_cast<cudf::detail::merge_hllpp_aggregation const&>(agg);
+        return cudf::detail::reduce_merge_hllpp(col, hllpp_agg.precision, stream, mr);
+      }
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -164,6 +177,12 @@ std::unique_ptr<scalar> reduce(column_view const& col,
 
   // Returns default scalar if input column is empty or all null
   if (col.size() <= col.null_count()) {
+    // The sketch of no values has all its registers set to zero
+    if (agg.kind == aggregation::HLLPP || agg.kind == aggregation::MERGE_HLLPP) {
+      return cudf::detail::aggregation_dispatcher(
+        agg.kind, reduce_dispatch_functor{col, output_dtype, init, stream, mr}, agg);
+    }
+
     if (agg.kind == aggregation::TDIGEST || agg.kind == aggregation::MERGE_TDIGEST) {
       return tdigest::detail::make_empty_tdigest_scalar(stream, mr);
     }
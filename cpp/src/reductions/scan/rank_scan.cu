@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/utilities/device_operators.cuh>
 #include <cudf/table/experimental/row_operators.cuh>
@@ -24,9 +25,9 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/functional>
+#include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/scan.h>
-#include <thrust/tabulate.h>
-#include <thrust/transform.h>
 
 namespace cudf {
 namespace detail {
@@ -49,38 +50,54 @@ struct rank_equality_functor {
   value_resolver _resolver;
 };
 
+/**
+ * @brief Flag of the first row of each run of equal rows for dense ranks
+ */
+struct dense_rank_resolver {
+  __device__ size_type operator()(bool unequal, size_type) const { return unequal ? 1 : 0; }
+};
+
+/**
+ * @brief Rank of the first row of each run of equal rows for min ranks
+ */
+struct min_rank_resolver {
+  __device__ size_type operator()(bool unequal, size_type row_index) const
+  {
+    return unequal ? row_index + 1 : 0;
+  }
+};
+
 /**
  * @brief generate row ranks or dense ranks using a row comparison then scan the results
  *
+ * The row comparison is evaluated on the fly by the scan, which is a single pass over the rows
+ * that writes each rank once.
+ *
  * @tparam value_resolver flag value resolver with boolean first and row number arguments
  * @tparam scan_operator scan function ran on the flag values
+ * @tparam OutputIterator iterator type the ranks are written to
  * @param order_by input column to generate ranks for
  * @param resolver flag value resolver
  * @param scan_op scan operation ran on the flag results
+ * @param output iterator the rank of each row is written to
  * @param stream CUDA stream used for device memory operations and kernel launches
- * @param mr Device memory resource used to allocate the returned column's device memory
- * @return std::unique_ptr<column> rank values
  */
-template <typename value_resolver, typename scan_operator>
-std::unique_ptr<column> rank_generator(column_view const& order_by,
-                                       value_resolver resolver,
-                                       scan_operator scan_op,
-                                       rmm::cuda_stream_view stream,
-                                       rmm::mr::device_memory_resource* mr)
+template <typename value_resolver, typename scan_operator, typename OutputIterator>
+void rank_generator(column_view const& order_by,
+                    value_resolver resolver,
+                    scan_operator scan_op,
+                    OutputIterator output,
+                    rmm::cuda_stream_view stream)
 {
   auto const order_by_tview = table_view{{order_by}};
   auto comp = cudf::experimental::row::equality::self_comparator(order_by_tview, stream);
 
-  auto ranks = make_fixed_width_column(
-    data_type{type_to_id<size_type>()}, order_by.size(), mask_state::UNALLOCATED, stream, mr);
-  auto mutable_ranks = ranks->mutable_view();
-
   auto const comparator_helper = [&](auto const device_comparator) {
-    thrust::tabulate(rmm::exec_policy(stream),
-                     mutable_ranks.begin<size_type>(),
-                     mutable_ranks.end<size_type>(),
-                     rank_equality_functor<decltype(device_comparator), value_resolver>(
-                       device_comparator, resolver));
+    using equality_functor = rank_equality_functor<decltype(device_comparator), value_resolver>;
+    auto const flags       = cudf::detail::make_counting_transform_iterator(
+      0, equality_functor(device_comparator, resolver));
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), flags, flags + order_by.size(), output, scan_op);
   };
 
   if (cudf::detail::has_nested_columns(order_by_tview)) {
@@ -92,12 +109,21 @@ std::unique_ptr<column> rank_generator(column_view const& order_by,
       comp.equal_to<false>(nullate::DYNAMIC{has_nested_nulls(table_view({order_by}))});
     comparator_helper(device_comparator);
   }
+}
 
-  thrust::inclusive_scan(rmm::exec_policy(stream),
-                         mutable_ranks.begin<size_type>(),
-                         mutable_ranks.end<size_type>(),
-                         mutable_ranks.begin<size_type>(),
-                         scan_op);
+/**
+ * @brief Creates the column of the ranks of `order_by` generated with `resolver` and `scan_op`
+ */
+template <typename value_resolver, typename scan_operator>
+std::unique_ptr<column> make_rank_column(column_view const& order_by,
+                                         value_resolver resolver,
+                                         scan_operator scan_op,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto ranks = make_fixed_width_column(
+    data_type{type_to_id<size_type>()}, order_by.size(), mask_state::UNALLOCATED, stream, mr);
+  rank_generator(order_by, resolver, scan_op, ranks->mutable_view().begin<size_type>(), stream);
   return ranks;
 }
 
@@ -107,12 +133,7 @@ std::unique_ptr<column> inclusive_dense_rank_scan(column_view const& order_by,
                                                   rmm::cuda_stream_view stream,
                                                   rmm::mr::device_memory_resource* mr)
 {
-  return rank_generator(
-    order_by,
-    [] __device__(bool const unequal, size_type const) { return unequal ? 1 : 0; },
-    DeviceSum{},
-    stream,
-    mr);
+  return make_rank_column(order_by, dense_rank_resolver{}, DeviceSum{}, stream, mr);
 }
 
 std::unique_ptr<column> inclusive_rank_scan(column_view const& order_by,
@@ -121,33 +142,28 @@ std::unique_ptr<column> inclusive_rank_scan(column_view const& order_by,
 {
   CUDF_EXPECTS(!cudf::structs::detail::is_or_has_nested_lists(order_by),
                "Unsupported list type in rank scan.");
-  return rank_generator(
-    order_by,
-    [] __device__(bool unequal, auto row_index) { return unequal ? row_index + 1 : 0; },
-    DeviceMax{},
-    stream,
-    mr);
+  return make_rank_column(order_by, min_rank_resolver{}, DeviceMax{}, stream, mr);
 }
 
 std::unique_ptr<column> inclusive_one_normalized_percent_rank_scan(
   column_view const& order_by, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
 {
-  auto const rank_column =
-    inclusive_rank_scan(order_by, stream, rmm::mr::get_current_device_resource());
-  auto const rank_view = rank_column->view();
+  CUDF_EXPECTS(!cudf::structs::detail::is_or_has_nested_lists(order_by),
+               "Unsupported list type in rank scan.");
 
   // Result type for min 0-index percent rank is independent of input type.
   using result_type        = double;
   auto percent_rank_result = cudf::make_fixed_width_column(
-    data_type{type_to_id<result_type>()}, rank_view.size(), mask_state::UNALLOCATED, stream, mr);
-
-  thrust::transform(rmm::exec_policy(stream),
-                    rank_view.begin<size_type>(),
-                    rank_view.end<size_type>(),
-                    percent_rank_result->mutable_view().begin<result_type>(),
-                    [n_rows = rank_view.size()] __device__(auto const rank) {
-                      return n_rows == 1 ? 0.0 : ((rank - 1.0) / (n_rows - 1));
-                    });
+    data_type{type_to_id<result_type>()}, order_by.size(), mask_state::UNALLOCATED, stream, mr);
+
+  // the ranks are normalized as the scan writes them, without materializing them
+  auto const percent_ranks = thrust::make_transform_output_iterator(
+    percent_rank_result->mutable_view().begin<result_type>(),
+    cuda::proclaim_return_type<result_type>(
+      [n_rows = order_by.size()] __device__(size_type const rank) -> result_type {
+        return n_rows == 1 ? 0.0 : ((rank - 1.0) / (n_rows - 1));
+      }));
+  rank_generator(order_by, min_rank_resolver{}, DeviceMax{}, percent_ranks, stream);
   return percent_rank_result;
 }
 
@@ -37,32 +37,44 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/join.hpp>
 #include <cudf/replace.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <cuda/functional>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
 #include <thrust/pair.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 namespace {  // anonymous
 
 static constexpr int BLOCK_SIZE = 256;
 
+// Number of values to replace above which a hash table of them is probed instead of searching
+// them linearly for each row
+static constexpr cudf::size_type hash_replace_min_values = 64;
+
 // return the new_value for output column at index `idx`
 template <class T, bool replacement_has_nulls>
 __device__ auto get_new_value(cudf::size_type idx,
@@ -517,6 +529,12 @@ std::unique_ptr<cudf::column> find_and_replace_all(cudf::column_view const& inpu
     return std::make_unique<cudf::column>(input_col, stream, mr);
   }
 
+  if (values_to_replace.size() >= hash_replace_min_values and
+      input_col.type().id() != type_id::DICTIONARY32) {
+    return replacement_map(values_to_replace, replacement_values, stream)
+      .replace(input_col, stream, mr);
+  }
+
   return cudf::type_dispatcher<dispatch_storage_type>(input_col.type(),
                                                       replace_kernel_forwarder{},
                                                       input_col,
@@ -528,6 +546,81 @@ std::unique_ptr<cudf::column> find_and_replace_all(cudf::column_view const& inpu
 
 }  // namespace detail
 
+replacement_map::replacement_map(column_view const& values_to_replace,
+                                 column_view const& replacement_values,
+                                 rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(values_to_replace.size() == replacement_values.size(),
+               "values_to_replace and replacement_values size mismatch.");
+  CUDF_EXPECTS(values_to_replace.type() == replacement_values.type(), "Columns type mismatch");
+  CUDF_EXPECTS(not values_to_replace.has_nulls(), "values_to_replace must not have nulls");
+  CUDF_EXPECTS(
+    is_fixed_width(values_to_replace.type()) or values_to_replace.type().id() == type_id::STRING,
+    "Replacement maps support fixed-width and string values");
+
+  // the first occurrence of an old value is the one that replaces it
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const first   = detail::distinct_indices(table_view{{values_to_replace}},
+                                                duplicate_keep_option::KEEP_FIRST,
+                                                null_equality::EQUAL,
+                                                nan_equality::ALL_EQUAL,
+                                                stream,
+                                                temp_mr);
+
+  _values = detail::gather(table_view{{values_to_replace, replacement_values}},
+                           first,
+                           out_of_bounds_policy::DONT_CHECK,
+                           detail::negative_index_policy::NOT_ALLOWED,
+                           stream,
+                           temp_mr);
+
+  // old values never match null rows
+  _lookup = std::make_unique<hash_join>(
+    _values->view().select({0}), nullable_join::YES, null_equality::UNEQUAL, stream);
+}
+
+replacement_map::~replacement_map() = default;
+
+std::unique_ptr<column> replacement_map::replace(column_view const& input,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  auto const values = _values->view();
+  CUDF_EXPECTS(input.type() == values.column(0).type(), "Columns type mismatch");
+  if (input.is_empty() or values.num_rows() == 0) {
+    return std::make_unique<column>(input, stream, mr);
+  }
+
+  // the index of the old value of each row, or a negative index if the row is not replaced
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const [input_indices, value_indices] =
+    _lookup->left_join(table_view{{input}}, std::nullopt, stream, temp_mr);
+  rmm::device_uvector<size_type> matches(input.size(), stream);
+  thrust::scatter(rmm::exec_policy_nosync(stream),
+                  value_indices->begin(),
+                  value_indices->end(),
+                  input_indices->begin(),
+                  matches.begin());
+
+  auto const replaced = detail::gather(table_view{{values.column(1)}},
+                                       matches,
+                                       out_of_bounds_policy::NULLIFY,
+                                       detail::negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       temp_mr);
+  auto is_replaced =
+    make_numeric_column(data_type{type_id::BOOL8}, input.size(), mask_state::UNALLOCATED, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    matches.begin(),
+                    matches.end(),
+                    is_replaced->mutable_view().begin<bool>(),
+                    cuda::proclaim_return_type<bool>(
+                      [] __device__(size_type index) { return index >= 0; }));
+  return detail::copy_if_else(
+    replaced->get_column(0).view(), input, is_replaced->view(), stream, mr);
+}
+
 /**
  * @brief Replace elements from `input_col` according to the mapping `values_to_replace` to
  *        `replacement_values`, that is, replace all `values_to_replace[i]` present in `input_col`
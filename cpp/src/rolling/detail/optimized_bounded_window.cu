@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rolling/detail/optimized_bounded_window.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/std/limits>
+#include <thrust/functional.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace cudf::detail {
+namespace {
+
+/// Smallest number of rows of the windows for which the partial aggregations are faster
+constexpr int64_t min_optimized_window_size = 1024;
+
+/**
+ * @brief Bounds of the window of each row, clamped to the rows of the column
+ */
+struct window_bounds_fn {
+  size_type num_rows;
+  size_type preceding_window;
+  size_type following_window;
+
+  __device__ thrust::pair<size_type, size_type> operator()(size_type i) const
+  {
+    auto const start = static_cast<size_type>(thrust::min<int64_t>(
+      num_rows, thrust::max<int64_t>(0, int64_t{i} - preceding_window + 1)));
+    auto const end = static_cast<size_type>(thrust::min<int64_t>(
+      num_rows, thrust::max<int64_t>(0, int64_t{i} + following_window + 1)));
+    return {thrust::min(start, end), thrust::max(start, end)};
+  }
+};
+
+/**
+ * @brief Number of valid rows of the window of each row, from the prefix counts of the valid rows
+ */
+struct window_count_fn {
+  window_bounds_fn bounds;
+  size_type const* valid_counts;  ///< Valid rows before each row, or null if there are no nulls
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const [start, end] = bounds(i);
+    return valid_counts == nullptr ? end - start : valid_counts[end] - valid_counts[start];
+  }
+};
+
+/**
+ * @brief Aggregation of the window of each row from the partial aggregations over its blocks.
+ *
+ * A window of at most `block_size` rows spans at most two blocks: its result is the suffix of its
+ * first row combined with the prefix of its last row. A window within a single block either starts
+ * the block, or is clipped at the end of the column, which ends the last block.
+ */
+template <typename Acc, typename Op>
+struct window_partial_fn {
+  window_bounds_fn bounds;
+  Acc const* prefix;
+  Acc const* suffix;
+  size_type block_size;
+  Op op;
+  Acc identity;
+
+  __device__ Acc operator()(size_type i) const
+  {
+    auto const [start, end] = bounds(i);
+    if (start == end) { return identity; }
+    auto const last = end - 1;
+    if (start / block_size != last / block_size) { return op(suffix[start], prefix[last]); }
+    return start % block_size == 0 ? prefix[last] : suffix[start];
+  }
+};
+
+/**
+ * @brief Count, mean and sum of squared deviations of the valid rows of a range
+ */
+struct moments {
+  double count;
+  double mean;
+  double m2;
+};
+
+/**
+ * @brief Merges the moments of two ranges of rows with the parallel algorithm of Chan et al.
+ *
+ * See https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+ */
+struct merge_moments_fn {
+  __device__ moments operator()(moments const& lhs, moments const& rhs) const
+  {
+    if (lhs.count == 0) { return rhs; }
+    if (rhs.count == 0) { return lhs; }
+    auto const count = lhs.count + rhs.count;
+    auto const delta = rhs.mean - lhs.mean;
+    return moments{count,
+                   lhs.mean + delta * rhs.count / count,
+                   lhs.m2 + rhs.m2 + delta * delta * lhs.count * rhs.count / count};
+  }
+};
+
+/**
+ * @brief Value of each row converted to `Acc`, or `identity` for the null rows
+ */
+template <typename T, typename Acc>
+struct element_or_identity_fn {
+  column_device_view input;
+  Acc identity;
+
+  __device__ Acc operator()(size_type i) const
+  {
+    return input.is_valid(i) ? static_cast<Acc>(input.element<T>(i)) : identity;
+  }
+};
+
+/**
+ * @brief Moments of each row on its own, with a count of zero for the null rows
+ */
+template <typename T>
+struct element_moments_fn {
+  column_device_view input;
+
+  __device__ moments operator()(size_type i) const
+  {
+    return input.is_valid(i) ? moments{1, static_cast<double>(input.element<T>(i)), 0}
+                             : moments{0, 0, 0};
+  }
+};
+
+/// Whether each row is valid, and zero past the last row
+struct is_valid_row_fn {
+  column_device_view input;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return i < input.size() and input.is_valid_nocheck(i);
+  }
+};
+
+/// Index of the block of each row
+struct block_index_fn {
+  size_type block_size;
+
+  __device__ size_type operator()(size_type i) const { return i / block_size; }
+};
+
+/// Aggregation of a window as is
+struct aggregation_result_fn {
+  template <typename Acc>
+  __device__ Acc operator()(Acc aggregation, size_type) const
+  {
+    return aggregation;
+  }
+};
+
+/// Average of the valid rows of a window from their sum
+struct mean_result_fn {
+  template <typename Acc>
+  __device__ Acc operator()(Acc sum, size_type count) const
+  {
+    return sum / count;
+  }
+};
+
+/// Variance, or standard deviation, of the valid rows of a window from their moments
+struct variance_result_fn {
+  size_type ddof;
+  bool is_std;
+
+  __device__ double operator()(moments m, size_type count) const
+  {
+    auto const variance = count >= ddof ? m.m2 / (count - ddof)
+                                        : cuda::std::numeric_limits<double>::signaling_NaN();
+    return is_std ? sqrt(variance) : variance;
+  }
+};
+
+/// Result of each row from the aggregation of its window and its number of valid rows
+template <typename WindowFn, typename ResultFn>
+struct window_result_fn {
+  WindowFn window_fn;
+  window_count_fn count_fn;
+  ResultFn result_fn;
+
+  __device__ auto operator()(size_type i) const { return result_fn(window_fn(i), count_fn(i)); }
+};
+
+/**
+ * @brief Validity of the result of each row.
+ *
+ * The results are valid when the windows have at least `min_periods` valid rows, or any rows if
+ * `count_all_rows`, and have a valid row if `requires_valid_row`.
+ */
+struct window_validity_fn {
+  window_bounds_fn bounds;
+  window_count_fn count_fn;
+  size_type min_periods;
+  bool count_all_rows;
+  bool requires_valid_row;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const [start, end] = bounds(i);
+    auto const count        = count_fn(i);
+    return (count_all_rows ? end - start : count) >= min_periods and
+           (count > 0 or not requires_valid_row);
+  }
+};
+
+/**
+ * @brief Computes, for every row, the aggregation of the rows of its block of `block_size` rows
+ * up to that row and from that row on.
+ */
+template <typename Acc, typename ValueIterator, typename Op>
+std::pair<rmm::device_uvector<Acc>, rmm::device_uvector<Acc>> compute_block_partials(
+  ValueIterator values,
+  size_type num_rows,
+  size_type block_size,
+  Op op,
+  rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<Acc> prefix(num_rows, stream);
+  rmm::device_uvector<Acc> suffix(num_rows, stream);
+  auto const blocks =
+    cudf::detail::make_counting_transform_iterator(0, block_index_fn{block_size});
+
+  thrust::inclusive_scan_by_key(rmm::exec_policy_nosync(stream),
+                                blocks,
+                                blocks + num_rows,
+                                values,
+                                prefix.begin(),
+                                thrust::equal_to<size_type>{},
+                                op);
+  // The suffixes are the prefixes of the reversed rows of each block
+  thrust::inclusive_scan_by_key(rmm::exec_policy_nosync(stream),
+                                thrust::make_reverse_iterator(blocks + num_rows),
+                                thrust::make_reverse_iterator(blocks),
+                                thrust::make_reverse_iterator(values + num_rows),
+                                thrust::make_reverse_iterator(suffix.end()),
+                                thrust::equal_to<size_type>{},
+                                op);
+  return {std::move(prefix), std::move(suffix)};
+}
+
+/**
+ * @brief Computes the results of the windows from the functor returning the result of each row
+ */
+template <typename ResultFn>
+std::unique_ptr<column> make_window_results(size_type num_rows,
+                                            ResultFn result_fn,
+                                            window_validity_fn validity_fn,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  using OutType                = decltype(result_fn(0));
+  auto [null_mask, null_count] = cudf::detail::valid_if(thrust::make_counting_iterator(0),
+                                                        thrust::make_counting_iterator(num_rows),
+                                                        validity_fn,
+                                                        stream,
+                                                        mr);
+  auto output = make_fixed_width_column(
+    data_type{type_to_id<OutType>()}, num_rows, std::move(null_mask), null_count, stream, mr);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    output->mutable_view().template begin<OutType>(),
+                    result_fn);
+  return output;
+}
+
+/**
+ * @brief Computes the bounded windows of one aggregation of values of type `T`
+ */
+struct optimized_bounded_window_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_integral_not_bool<T>() or cudf::is_floating_point<T>();
+  }
+
+  /**
+   * @brief Aggregates the windows with `op` over the values converted to `Acc`, the null rows
+   * being `identity`, and computes the result of each row with `result_fn`
+   */
+  template <typename T, typename Acc, typename Op, typename ResultFn>
+  static std::unique_ptr<column> aggregate_windows(column_device_view const& d_input,
+                                                   window_bounds_fn bounds,
+                                                   window_count_fn count_fn,
+                                                   window_validity_fn validity_fn,
+                                                   size_type block_size,
+                                                   Op op,
+                                                   Acc identity,
+                                                   ResultFn result_fn,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+  {
+    auto const values = cudf::detail::make_counting_transform_iterator(
+      0, element_or_identity_fn<T, Acc>{d_input, identity});
+    auto const [prefix, suffix] =
+      compute_block_partials<Acc>(values, bounds.num_rows, block_size, op, stream);
+    auto const window_fn =
+      window_partial_fn<Acc, Op>{bounds, prefix.data(), suffix.data(), block_size, op, identity};
+    return make_window_results(
+      bounds.num_rows,
+      window_result_fn<decltype(window_fn), ResultFn>{window_fn, count_fn, result_fn},
+      validity_fn,
+      stream,
+      mr);
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type,
+                                     size_type,
+                                     size_type,
+                                     rolling_aggregation const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("Unsupported type for optimized bounded windows.");
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type preceding_window,
+                                     size_type following_window,
+                                     size_type min_periods,
+                                     rolling_aggregation const& agg,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    auto const num_rows   = input.size();
+    auto const block_size = static_cast<size_type>(std::min(
+      static_cast<int64_t>(preceding_window) + following_window, static_cast<int64_t>(num_rows)));
+    auto const d_input    = column_device_view::create(input, stream);
+    auto const bounds     = window_bounds_fn{num_rows, preceding_window, following_window};
+
+    // Number of valid rows before each row, and in the whole column
+    rmm::device_uvector<size_type> valid_counts(input.has_nulls() ? num_rows + 1 : 0, stream);
+    if (input.has_nulls()) {
+      auto const is_valid =
+        cudf::detail::make_counting_transform_iterator(0, is_valid_row_fn{*d_input});
+      thrust::exclusive_scan(rmm::exec_policy_nosync(stream),
+                             is_valid,
+                             is_valid + num_rows + 1,
+                             valid_counts.begin());
+    }
+    auto const count_fn =
+      window_count_fn{bounds, input.has_nulls() ? valid_counts.data() : nullptr};
+    auto const validity_fn = window_validity_fn{bounds, count_fn, min_periods, false, false};
+
+    switch (agg.kind) {
+      case aggregation::SUM: {
+        using Acc = cudf::detail::target_type_t<T, aggregation::SUM>;
+        return aggregate_windows<T>(*d_input,
+                                    bounds,
+                                    count_fn,
+                                    validity_fn,
+                                    block_size,
+                                    DeviceSum{},
+                                    DeviceSum::identity<Acc>(),
+                                    aggregation_result_fn{},
+                                    stream,
+                                    mr);
+      }
+      case aggregation::MEAN: {
+        using Acc = cudf::detail::target_type_t<T, aggregation::MEAN>;
+        return aggregate_windows<T>(*d_input,
+                                    bounds,
+                                    count_fn,
+                                    validity_fn,
+                                    block_size,
+                                    DeviceSum{},
+                                    DeviceSum::identity<Acc>(),
+                                    mean_result_fn{},
+                                    stream,
+                                    mr);
+      }
+      case aggregation::MIN:
+        return aggregate_windows<T>(*d_input,
+                                    bounds,
+                                    count_fn,
+                                    validity_fn,
+                                    block_size,
+                                    DeviceMin{},
+                                    DeviceMin::identity<T>(),
+                                    aggregation_result_fn{},
+                                    stream,
+                                    mr);
+      case aggregation::MAX:
+        return aggregate_windows<T>(*d_input,
+                                    bounds,
+                                    count_fn,
+                                    validity_fn,
+                                    block_size,
+                                    DeviceMax{},
+                                    DeviceMax::identity<T>(),
+                                    aggregation_result_fn{},
+                                    stream,
+                                    mr);
+      case aggregation::COUNT_VALID: {
+        // The counts are valid when the windows have enough rows, valid or not
+        return make_window_results(num_rows,
+                                   count_fn,
+                                   window_validity_fn{bounds, count_fn, min_periods, true, false},
+                                   stream,
+                                   mr);
+      }
+      case aggregation::VARIANCE:
+      case aggregation::STD: {
+        auto const ddof = dynamic_cast<cudf::detail::std_var_aggregation const&>(agg)._ddof;
+        auto const values =
+          cudf::detail::make_counting_transform_iterator(0, element_moments_fn<T>{*d_input});
+        auto const [prefix, suffix] =
+          compute_block_partials<moments>(values, num_rows, block_size, merge_moments_fn{}, stream);
+        auto const window_fn = window_partial_fn<moments, merge_moments_fn>{
+          bounds, prefix.data(), suffix.data(), block_size, merge_moments_fn{}, moments{0, 0, 0}};
+        auto const result_fn = variance_result_fn{ddof, agg.kind == aggregation::STD};
+        return make_window_results(
+          num_rows,
+          window_result_fn<decltype(window_fn), variance_result_fn>{window_fn, count_fn, result_fn},
+          window_validity_fn{bounds, count_fn, min_periods, false, true},
+          stream,
+          mr);
+      }
+      default: CUDF_FAIL("Unsupported aggregation kind for optimized bounded windows.");
+    }
+  }
+};
+
+}  // namespace
+
+bool can_optimize_bounded_window(column_view const& input,
+                                 size_type preceding_window,
+                                 size_type following_window,
+                                 rolling_aggregation const& agg)
+{
+  auto const is_supported = [](auto const& agg) {
+    switch (agg.kind) {
+      case cudf::aggregation::Kind::SUM: [[fallthrough]];
+      case cudf::aggregation::Kind::MEAN: [[fallthrough]];
+      case cudf::aggregation::Kind::MIN: [[fallthrough]];
+      case cudf::aggregation::Kind::MAX: [[fallthrough]];
+      case cudf::aggregation::Kind::COUNT_VALID: [[fallthrough]];
+      case cudf::aggregation::Kind::VARIANCE: [[fallthrough]];
+      case cudf::aggregation::Kind::STD: return true;
+      default: return false;
+    }
+  };
+
+  auto const window_size = static_cast<int64_t>(preceding_window) + following_window;
+  return window_size >= min_optimized_window_size and is_supported(agg) and
+         (cudf::is_integral_not_bool(input.type()) or cudf::is_floating_point(input.type()));
+}
+
+std::unique_ptr<column> optimized_bounded_window(column_view const& input,
+                                                 size_type preceding_window,
+                                                 size_type following_window,
+                                                 size_type min_periods,
+                                                 rolling_aggregation const& agg,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(input.type(),
+                         optimized_bounded_window_fn{},
+                         input,
+                         preceding_window,
+                         following_window,
+                         min_periods,
+                         agg,
+                         stream,
+                         mr);
+}
+}  // namespace cudf::detail
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace rmm::mr {
+class device_memory_resource;
+}
+
+namespace cudf {
+
+class rolling_aggregation;
+
+namespace detail {
+/**
+ * @brief Checks if it is possible to optimize a window function of fixed bounds.
+ *
+ * @return true if the window aggregation can be optimized, i.e. if it is a SUM, MEAN, MIN, MAX,
+ * COUNT_VALID or VARIANCE of integral or floating-point values, over windows of at least
+ * `min_optimized_window_size` rows.
+ * @return false if the window aggregation cannot be optimized.
+ */
+bool can_optimize_bounded_window(column_view const& input,
+                                 size_type preceding_window,
+                                 size_type following_window,
+                                 rolling_aggregation const& agg);
+
+/**
+ * @brief Optimized path for window functions of large fixed bounds.
+ *
+ * The rows are split into blocks of the size of the windows, and the partial aggregations of the
+ * prefix and the suffix of each block up to every row are computed with segmented scans. A window
+ * spans at most two blocks, so its result combines two partial aggregations, in constant time per
+ * row instead of aggregating every row of the window. The valid rows of the windows are counted
+ * with a prefix sum.
+ *
+ * @return the result column from running the bounded window aggregation
+ */
+std::unique_ptr<column> optimized_bounded_window(column_view const& input,
+                                                 size_type preceding_window,
+                                                 size_type following_window,
+                                                 size_type min_periods,
+                                                 rolling_aggregation const& agg,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr);
+}  // namespace detail
+}  // namespace cudf
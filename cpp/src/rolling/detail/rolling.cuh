@@ -48,6 +48,7 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/exec_policy.hpp>
 
@@ -61,7 +62,10 @@
 
 #include <jit_preprocessed_files/rolling/jit/kernel.cu.jit.hpp>
 
+#include <algorithm>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 
 namespace cudf {
 
@@ -1272,6 +1276,67 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
   auto output_view = output->mutable_view();
   rmm::device_scalar<size_type> device_valid_count{0, stream};
 
+  // The fixed windows of an associative UDF combine the partial results over blocks of the size
+  // of the windows, in constant time per row
+  if constexpr (std::is_same_v<PrecedingWindowIterator, size_type> and
+                std::is_same_v<FollowingWindowIterator, size_type>) {
+    if (udf_agg._is_associative) {
+      CUDF_EXPECTS(input.type() == udf_agg._output_type,
+                   "The output type of an associative UDF must be the type of its input.",
+                   std::invalid_argument);
+
+      auto const block_size = static_cast<size_type>(
+        std::min(static_cast<int64_t>(preceding_window) + following_window,
+                 static_cast<int64_t>(input.size())));
+      rmm::device_buffer prefix(input.size() * size_of(input.type()), stream);
+      rmm::device_buffer suffix(input.size() * size_of(input.type()), stream);
+
+      std::string partials_kernel_name =
+        jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_associative_partials")
+          .instantiate(cudf::type_to_name(input.type()), udf_agg._operator_name);
+      std::string associative_kernel_name =
+        jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_associative")
+          .instantiate(cudf::type_to_name(input.type()), udf_agg._operator_name);
+
+      cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
+        .get_kernel(partials_kernel_name,
+                    {},
+                    {{"rolling/jit/operation-udf.hpp", cuda_source}},
+                    {"-arch=sm_."})                            //
+        ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+        ->launch(input.size(),
+                 cudf::jit::get_data_ptr(input),
+                 prefix.data(),
+                 suffix.data(),
+                 block_size);
+
+      cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
+        .get_kernel(associative_kernel_name,
+                    {},
+                    {{"rolling/jit/operation-udf.hpp", cuda_source}},
+                    {"-arch=sm_."})                            //
+        ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+        ->launch(input.size(),
+                 cudf::jit::get_data_ptr(input),
+                 prefix.data(),
+                 suffix.data(),
+                 block_size,
+                 cudf::jit::get_data_ptr(output_view),
+                 output_view.null_mask(),
+                 device_valid_count.data(),
+                 preceding_window,
+                 following_window,
+                 min_periods);
+
+      output->set_null_count(output->size() - device_valid_count.value(stream));
+
+      // check the stream for debugging
+      CUDF_CHECK_CUDA(stream.value());
+
+      return output;
+    }
+  }
+
   std::string kernel_name =
     jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_new")  //
       .instantiate(cudf::type_to_name(input.type()),  // list of template arguments
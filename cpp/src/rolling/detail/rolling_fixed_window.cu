@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "optimized_bounded_window.hpp"
 #include "rolling.cuh"
 
 #include <cudf_test/column_utilities.hpp>
@@ -59,6 +60,9 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                             agg,
                                             stream,
                                             mr);
+  } else if (can_optimize_bounded_window(input, preceding_window, following_window, agg)) {
+    return optimized_bounded_window(
+      input, preceding_window, following_window, min_periods, agg, stream, mr);
   } else {
     // Clamp preceding/following to column boundaries.
     // E.g. If preceding_window == 2, then for a column of 5 elements, preceding_window will be:
@@ -25,6 +25,7 @@
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/rolling/range_window_bounds.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -37,6 +38,11 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/partition.h>
 
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 namespace cudf {
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                                column_view const& input,
@@ -425,21 +431,20 @@ std::tuple<size_type, size_type> get_null_bounds_for_orderby_column(
                            : std::make_tuple(num_rows - num_nulls, num_rows);
 }
 
+/// Preceding and following window sizes of every row, as INT32 columns for `rolling_window()`.
+using range_window_columns = std::pair<std::unique_ptr<column>, std::unique_ptr<column>>;
+
 /// Range window computation, with
 ///   1. no grouping keys specified
 ///   2. rows in ASCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+range_window_columns range_window_ASC(column_view const& orderby_column,
+                                      T preceding_window,
+                                      bool preceding_window_is_unbounded,
+                                      T following_window,
+                                      bool following_window_is_unbounded,
+                                      rmm::cuda_stream_view stream)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
   auto const p_orderby_device_view = cudf::column_device_view::create(orderby_column, stream);
@@ -478,13 +483,13 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [nulls_begin_idx     = h_nulls_begin_idx,
      nulls_end_idx       = h_nulls_end_idx,
-     num_rows            = input.size(),
+     num_rows            = orderby_column.size(),
      orderby_device_view = *p_orderby_device_view,
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -514,11 +519,10 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 // Given an orderby column grouped as specified in group_offsets,
@@ -603,18 +607,14 @@ get_null_bounds_for_orderby_column(column_view const& orderby_column,
 
 // Range window computation, for orderby column in ASCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                         rmm::device_uvector<cudf::size_type> const& group_labels,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+range_window_columns range_window_ASC(column_view const& orderby_column,
+                                      rmm::device_uvector<cudf::size_type> const& group_offsets,
+                                      rmm::device_uvector<cudf::size_type> const& group_labels,
+                                      T preceding_window,
+                                      bool preceding_window_is_unbounded,
+                                      T following_window,
+                                      bool following_window_is_unbounded,
+                                      rmm::cuda_stream_view stream)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -660,8 +660,8 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [d_group_offsets     = group_offsets.data(),
@@ -675,7 +675,7 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
       auto const group_start = d_group_offsets[group_label];
       auto const group_end =
         d_group_offsets[group_label + 1];  // Cannot fall off the end, since offsets
-                                           // is capped with `input.size()`.
+                                           // is capped with `orderby_column.size()`.
       auto const nulls_begin = d_nulls_begin[group_label];
       auto const nulls_end   = d_nulls_end[group_label];
 
@@ -707,11 +707,10 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 /// Range window computation, with
@@ -719,16 +718,12 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
 ///   2. rows in DESCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+range_window_columns range_window_DESC(column_view const& orderby_column,
+                                       T preceding_window,
+                                       bool preceding_window_is_unbounded,
+                                       T following_window,
+                                       bool following_window_is_unbounded,
+                                       rmm::cuda_stream_view stream)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
   auto const p_orderby_device_view = cudf::column_device_view::create(orderby_column, stream);
@@ -767,13 +762,13 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [nulls_begin_idx     = h_nulls_begin_idx,
      nulls_end_idx       = h_nulls_end_idx,
-     num_rows            = input.size(),
+     num_rows            = orderby_column.size(),
      orderby_device_view = *p_orderby_device_view,
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -803,27 +798,22 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 // Range window computation, for rows in DESCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                          rmm::device_uvector<cudf::size_type> const& group_labels,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+range_window_columns range_window_DESC(column_view const& orderby_column,
+                                       rmm::device_uvector<cudf::size_type> const& group_offsets,
+                                       rmm::device_uvector<cudf::size_type> const& group_labels,
+                                       T preceding_window,
+                                       bool preceding_window_is_unbounded,
+                                       T following_window,
+                                       bool following_window_is_unbounded,
+                                       rmm::cuda_stream_view stream)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -868,8 +858,8 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [d_group_offsets     = group_offsets.data(),
@@ -912,30 +902,21 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
-    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-  }
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 template <typename OrderByT>
-std::unique_ptr<column> grouped_range_rolling_window_impl(
-  column_view const& input,
+range_window_columns range_window_columns_impl(
   column_view const& orderby_column,
   cudf::order const& order_of_orderby_column,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
   rmm::device_uvector<cudf::size_type> const& group_labels,
   range_window_bounds const& preceding_window,
   range_window_bounds const& following_window,
-  size_type min_periods,
-  rolling_aggregation const& aggr,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
+  rmm::cuda_stream_view stream)
 {
   auto [preceding_value, following_value] = [&] {
     if constexpr (std::is_same_v<OrderByT, cudf::string_view>) {
@@ -954,58 +935,42 @@ std::unique_ptr<column> grouped_range_rolling_window_impl(
   }();
 
   if (order_of_orderby_column == cudf::order::ASCENDING) {
-    return group_offsets.is_empty() ? range_window_ASC(input,
-                                                       orderby_column,
+    return group_offsets.is_empty() ? range_window_ASC(orderby_column,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
-                                                       stream,
-                                                       mr)
-                                    : range_window_ASC(input,
-                                                       orderby_column,
+                                                       stream)
+                                    : range_window_ASC(orderby_column,
                                                        group_offsets,
                                                        group_labels,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
-                                                       stream,
-                                                       mr);
+                                                       stream);
   } else {
-    return group_offsets.is_empty() ? range_window_DESC(input,
-                                                        orderby_column,
+    return group_offsets.is_empty() ? range_window_DESC(orderby_column,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
-                                                        stream,
-                                                        mr)
-                                    : range_window_DESC(input,
-                                                        orderby_column,
+                                                        stream)
+                                    : range_window_DESC(orderby_column,
                                                         group_offsets,
                                                         group_labels,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
-                                                        stream,
-                                                        mr);
+                                                        stream);
   }
 }
 
-struct dispatch_grouped_range_rolling_window {
+struct dispatch_range_window_columns {
   template <typename OrderByColumnType, typename... Args>
   std::enable_if_t<!detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
+                   range_window_columns>
   operator()(Args&&...) const
   {
     CUDF_FAIL("Unsupported OrderBy column type.");
@@ -1013,33 +978,60 @@ struct dispatch_grouped_range_rolling_window {
 
   template <typename OrderByColumnType>
   std::enable_if_t<detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
-  operator()(column_view const& input,
-             column_view const& orderby_column,
+                   range_window_columns>
+  operator()(column_view const& orderby_column,
              cudf::order const& order_of_orderby_column,
              rmm::device_uvector<cudf::size_type> const& group_offsets,
              rmm::device_uvector<cudf::size_type> const& group_labels,
              range_window_bounds const& preceding_window,
              range_window_bounds const& following_window,
-             size_type min_periods,
-             rolling_aggregation const& aggr,
-             rmm::cuda_stream_view stream,
-             rmm::mr::device_memory_resource* mr) const
+             rmm::cuda_stream_view stream) const
   {
-    return grouped_range_rolling_window_impl<OrderByColumnType>(input,
-                                                                orderby_column,
-                                                                order_of_orderby_column,
-                                                                group_offsets,
-                                                                group_labels,
-                                                                preceding_window,
-                                                                following_window,
-                                                                min_periods,
-                                                                aggr,
-                                                                stream,
-                                                                mr);
+    return range_window_columns_impl<OrderByColumnType>(orderby_column,
+                                                        order_of_orderby_column,
+                                                        group_offsets,
+                                                        group_labels,
+                                                        preceding_window,
+                                                        following_window,
+                                                        stream);
   }
 };
 
+/**
+ * @brief Computes the preceding and following window columns of every row for a range window.
+ *
+ * The group offsets and labels of `group_keys` and the search of the range bounds in the
+ * `orderby_column` are computed once, so that any number of aggregations of the same partitioning,
+ * ordering and bounds may be evaluated against the returned columns with `rolling_window`.
+ */
+range_window_columns compute_range_window_columns(table_view const& group_keys,
+                                                  column_view const& orderby_column,
+                                                  cudf::order const& order,
+                                                  range_window_bounds const& preceding,
+                                                  range_window_bounds const& following,
+                                                  rmm::cuda_stream_view stream)
+{
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  using index_vector        = sort_groupby_helper::index_vector;
+
+  index_vector group_offsets(0, stream), group_labels(0, stream);
+  if (group_keys.num_columns() > 0) {
+    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES, {}};
+    group_offsets = index_vector(helper.group_offsets(stream), stream);
+    group_labels  = index_vector(helper.group_labels(stream), stream);
+  }
+
+  return cudf::type_dispatcher(orderby_column.type(),
+                               dispatch_range_window_columns{},
+                               orderby_column,
+                               order,
+                               group_offsets,
+                               group_labels,
+                               preceding,
+                               following,
+                               stream);
+}
+
 /**
  * @brief Functor to convert from size_type (number of days) to appropriate duration type.
  */
@@ -1106,6 +1098,18 @@ range_window_bounds to_range_bounds(cudf::window_bounds const& days_bounds,
            : cudf::type_dispatcher(timestamp_type, to_duration_bounds{}, days_bounds.value());
 }
 
+/**
+ * @brief Throws if `aggr` cannot be evaluated over the range windows of `group_keys` in `order`.
+ */
+void expects_supported_range_aggregation(table_view const& group_keys,
+                                         cudf::order order,
+                                         rolling_aggregation const& aggr)
+{
+  auto const is_udf = aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX;
+  CUDF_EXPECTS(!is_udf || order == cudf::order::ASCENDING || group_keys.num_columns() == 0,
+               "Ranged rolling window does NOT (yet) support UDF.");
+}
+
 }  // namespace
 
 namespace detail {
@@ -1150,29 +1154,79 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
     return optimized_unbounded_window(group_keys, input, aggr, stream, mr);
   }
 
-  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
-  using index_vector        = sort_groupby_helper::index_vector;
+  expects_supported_range_aggregation(group_keys, order, aggr);
 
-  index_vector group_offsets(0, stream), group_labels(0, stream);
-  if (group_keys.num_columns() > 0) {
-    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES, {}};
-    group_offsets = index_vector(helper.group_offsets(stream), stream);
-    group_labels  = index_vector(helper.group_labels(stream), stream);
+  auto const [preceding_column, following_column] =
+    compute_range_window_columns(group_keys, order_by_column, order, preceding, following, stream);
+
+  return cudf::detail::rolling_window(
+    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+}
+
+/**
+ * @copydoc std::unique_ptr<table> grouped_range_rolling_window(
+ *               table_view const& group_keys,
+ *               column_view const& orderby_column,
+ *               cudf::order const& order,
+ *               range_window_bounds const& preceding,
+ *               range_window_bounds const& following,
+ *               host_span<rolling_request const> requests,
+ *               rmm::mr::device_memory_resource* mr);
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> grouped_range_rolling_window(table_view const& group_keys,
+                                                    column_view const& order_by_column,
+                                                    cudf::order const& order,
+                                                    range_window_bounds const& preceding,
+                                                    range_window_bounds const& following,
+                                                    host_span<rolling_request const> requests,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == order_by_column.size()),
+               "Size mismatch between group_keys and orderby column.",
+               std::invalid_argument);
+  for (auto const& request : requests) {
+    CUDF_EXPECTS(request.values.size() == order_by_column.size(),
+                 "Size mismatch between orderby column and input vector.",
+                 std::invalid_argument);
+    CUDF_EXPECTS(request.aggregation != nullptr,
+                 "Rolling request without an aggregation.",
+                 std::invalid_argument);
+    CUDF_EXPECTS(request.min_periods > 0, "min_periods must be positive", std::invalid_argument);
+    expects_supported_range_aggregation(group_keys, order, *request.aggregation);
   }
 
-  return cudf::type_dispatcher(order_by_column.type(),
-                               dispatch_grouped_range_rolling_window{},
-                               input,
-                               order_by_column,
-                               order,
-                               group_offsets,
-                               group_labels,
-                               preceding,
-                               following,
-                               min_periods,
-                               aggr,
-                               stream,
-                               mr);
+  // The windows are shared by all the requests, and only computed if some request needs them.
+  std::optional<range_window_columns> windows;
+
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(requests.size());
+  for (auto const& request : requests) {
+    auto const& aggr = *request.aggregation;
+    if (request.values.is_empty()) {
+      results.push_back(cudf::detail::empty_output_for_rolling_aggregation(request.values, aggr));
+    } else if (can_optimize_unbounded_window(
+                 preceding.is_unbounded(), following.is_unbounded(), request.min_periods, aggr)) {
+      results.push_back(optimized_unbounded_window(group_keys, request.values, aggr, stream, mr));
+    } else {
+      if (!windows.has_value()) {
+        windows = compute_range_window_columns(
+          group_keys, order_by_column, order, preceding, following, stream);
+      }
+      results.push_back(cudf::detail::rolling_window(request.values,
+                                                     windows->first->view(),
+                                                     windows->second->view(),
+                                                     request.min_periods,
+                                                     aggr,
+                                                     stream,
+                                                     mr));
+    }
+  }
+  return std::make_unique<table>(std::move(results));
 }
 
 }  // namespace detail
@@ -1290,4 +1344,23 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
                                               mr);
 }
 
+std::unique_ptr<table> grouped_range_rolling_window(table_view const& group_keys,
+                                                    column_view const& orderby_column,
+                                                    cudf::order const& order,
+                                                    range_window_bounds const& preceding,
+                                                    range_window_bounds const& following,
+                                                    host_span<rolling_request const> requests,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::grouped_range_rolling_window(group_keys,
+                                              orderby_column,
+                                              order,
+                                              preceding,
+                                              following,
+                                              requests,
+                                              cudf::get_default_stream(),
+                                              mr);
+}
+
 }  // namespace cudf
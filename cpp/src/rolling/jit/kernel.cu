@@ -101,6 +101,123 @@ CUDF_KERNEL void gpu_rolling_new(cudf::size_type nrows,
   if (0 == cudf::intra_word_index(threadIdx.x)) { atomicAdd(output_valid_count, warp_valid_count); }
 }
 
+/**
+ * @brief Aggregates two partial results of an associative UDF, whose output type is its input type
+ */
+template <class agg_op, typename T>
+T __device__ combine_partials(T lhs, T rhs)
+{
+  T partials[2] = {lhs, rhs};
+  return agg_op::template operate<T, T>(partials, 0, 2);
+}
+
+/**
+ * @brief Computes the partial results of an associative UDF over the blocks of `block_size`
+ * consecutive rows.
+ *
+ * `prefix[i]` aggregates the rows of the block of row `i` up to row `i`, and `suffix[i]` the rows
+ * from row `i` to the end of its block. Each thread scans the rows of one block.
+ */
+template <typename T, class agg_op>
+CUDF_KERNEL void gpu_rolling_associative_partials(cudf::size_type nrows,
+                                                  T const* const __restrict__ in_col,
+                                                  T* __restrict__ prefix,
+                                                  T* __restrict__ suffix,
+                                                  cudf::size_type block_size)
+{
+  cudf::thread_index_type const stride = blockDim.x * gridDim.x;
+  auto const num_blocks =
+    (static_cast<cudf::thread_index_type>(nrows) + block_size - 1) / block_size;
+
+  for (cudf::thread_index_type block = blockIdx.x * blockDim.x + threadIdx.x; block < num_blocks;
+       block += stride) {
+    auto const begin = block * block_size;
+    auto const end   = min(static_cast<cudf::thread_index_type>(nrows), begin + block_size);
+
+    prefix[begin] = agg_op::template operate<T, T>(in_col, begin, 1);
+    for (auto i = begin + 1; i < end; ++i) {
+      prefix[i] = combine_partials<agg_op>(prefix[i - 1], in_col[i]);
+    }
+    suffix[end - 1] = agg_op::template operate<T, T>(in_col, end - 1, 1);
+    for (auto i = end - 2; i >= begin; --i) {
+      suffix[i] = combine_partials<agg_op>(in_col[i], suffix[i + 1]);
+    }
+  }
+}
+
+/**
+ * @brief Computes the rolling windows of fixed size of an associative UDF from the partial results
+ * of `gpu_rolling_associative_partials` over blocks of `preceding_window + following_window` rows.
+ *
+ * A window spans at most two blocks, so it is the suffix of its first row combined with the
+ * prefix of its last row. The windows clipped at the boundaries of the column that lie in a
+ * single block are a prefix or a suffix.
+ */
+template <typename T, class agg_op>
+CUDF_KERNEL void gpu_rolling_associative(cudf::size_type nrows,
+                                         T const* const __restrict__ in_col,
+                                         T const* const __restrict__ prefix,
+                                         T const* const __restrict__ suffix,
+                                         cudf::size_type block_size,
+                                         T* __restrict__ out_col,
+                                         cudf::bitmask_type* __restrict__ out_col_valid,
+                                         cudf::size_type* __restrict__ output_valid_count,
+                                         cudf::size_type preceding_window,
+                                         cudf::size_type following_window,
+                                         cudf::size_type min_periods)
+{
+  cudf::thread_index_type i            = blockIdx.x * blockDim.x + threadIdx.x;
+  cudf::thread_index_type const stride = blockDim.x * gridDim.x;
+
+  cudf::size_type warp_valid_count{0};
+
+  auto active_threads = __ballot_sync(0xffff'ffffu, i < nrows);
+  while (i < nrows) {
+    // compute bounds
+    auto const start = static_cast<cudf::size_type>(
+      min(static_cast<int64_t>(nrows), max(int64_t{0}, i - preceding_window + 1)));
+    auto const end = static_cast<cudf::size_type>(
+      min(static_cast<int64_t>(nrows), max(int64_t{0}, i + following_window + 1)));
+    auto const start_index = min(start, end);
+    auto const end_index   = max(start, end);
+
+    // aggregate
+    cudf::size_type count = end_index - start_index;
+    T val;
+    if (count == 0) {
+      val = agg_op::template operate<T, T>(in_col, start_index, 0);
+    } else {
+      auto const last_index = end_index - 1;
+      if (start_index / block_size != last_index / block_size) {
+        val = combine_partials<agg_op>(suffix[start_index], prefix[last_index]);
+      } else {
+        val = start_index % block_size == 0 ? prefix[last_index] : suffix[start_index];
+      }
+    }
+
+    // check if we have enough input samples
+    bool const output_is_valid = (count >= min_periods);
+
+    // set the mask
+    unsigned int const result_mask = __ballot_sync(active_threads, output_is_valid);
+
+    // store the output value, one per thread
+    if (output_is_valid) { out_col[i] = val; }
+
+    // only one thread writes the mask
+    if (0 == cudf::intra_word_index(i)) {
+      out_col_valid[cudf::word_index(i)] = result_mask;
+      warp_valid_count += __popc(result_mask);
+    }
+
+    // process next element
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < nrows);
+  }
+
+  if (0 == cudf::intra_word_index(threadIdx.x)) { atomicAdd(output_valid_count, warp_valid_count); }
+}
+
 }  // namespace jit
 }  // namespace rolling
 }  // namespace cudf
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/scalar/scalar_batch.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace cudf {
+namespace {
+
+// Alignment of every value, enough for the widest fixed-width type
+constexpr std::size_t value_alignment = 16;
+
+}  // namespace
+
+scalar_batch::scalar_batch(std::vector<data_type> types,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+  : _types(std::move(types))
+{
+  CUDF_EXPECTS(
+    std::all_of(_types.begin(), _types.end(), [](auto type) { return is_fixed_width(type); }),
+    "A scalar batch only holds fixed-width values",
+    cudf::data_type_error);
+
+  _offsets.reserve(_types.size());
+  std::size_t offset = 0;
+  for (auto const type : _types) {
+    _offsets.push_back(offset);
+    offset += (size_of(type) + value_alignment - 1) / value_alignment * value_alignment;
+  }
+  _validity_offset = offset;
+
+  // All the values start null
+  _data = rmm::device_buffer(_validity_offset + _types.size(), stream, mr);
+  CUDF_CUDA_TRY(cudaMemsetAsync(static_cast<uint8_t*>(_data.data()) + _validity_offset,
+                                0,
+                                _types.size(),
+                                stream.value()));
+}
+
+void scalar_batch::copy_to_host_async(host_span<uint8_t> host, rmm::cuda_stream_view stream) const
+{
+  CUDF_EXPECTS(host.size() >= size_bytes(),
+               "The host buffer is smaller than the scalar batch",
+               std::invalid_argument);
+  if (size_bytes() == 0) { return; }
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    host.data(), _data.data(), size_bytes(), cudaMemcpyDeviceToHost, stream.value()));
+}
+
+}  // namespace cudf
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/search.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
+#include <stdexcept>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Returns the positions in the sorted `keys` of the first key not less than (for
+ * `lower_bound`) or greater than (otherwise) each value of `values`.
+ */
+std::unique_ptr<column> search_keys(column_view const& keys,
+                                    column_view const& values,
+                                    bool lower_bound,
+                                    rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(cudf::column_types_equal(keys, values),
+               "Values must have the type of the membership index",
+               cudf::data_type_error);
+  auto const search = lower_bound ? detail::lower_bound : detail::upper_bound;
+  return search(table_view{{keys}},
+                table_view{{values}},
+                {order::ASCENDING},
+                {null_order::AFTER},
+                stream,
+                rmm::mr::get_current_device_resource());
+}
+
+}  // namespace
+
+membership_index::membership_index(column_view const& haystack,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(haystack.type().id() != type_id::DICTIONARY32,
+               "Dictionary columns are not supported by the membership index",
+               cudf::data_type_error);
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const valid   = detail::drop_nulls(table_view{{haystack}}, {0}, 1, stream, temp_mr);
+  auto const values  = detail::distinct(valid->view(),
+                                       {0},
+                                       duplicate_keep_option::KEEP_ANY,
+                                       null_equality::EQUAL,
+                                       nan_equality::ALL_EQUAL,
+                                       stream,
+                                       temp_mr);
+  _keys = std::move(detail::sort(values->view(), {}, {}, stream, mr)->release().front());
+}
+
+std::unique_ptr<column> membership_index::contains(column_view const& needles,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  // a needle is a key when some keys are equivalent to it, i.e. its bounds differ
+  auto const first = search_keys(keys(), needles, true, stream);
+  auto const last  = search_keys(keys(), needles, false, stream);
+  auto result      = make_numeric_column(data_type{type_id::BOOL8},
+                                    needles.size(),
+                                    detail::copy_bitmask(needles, stream, mr),
+                                    needles.null_count(),
+                                    stream,
+                                    mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    first->view().begin<size_type>(),
+                    first->view().end<size_type>(),
+                    last->view().begin<size_type>(),
+                    result->mutable_view().begin<bool>(),
+                    thrust::less<size_type>{});
+  return result;
+}
+
+std::unique_ptr<column> membership_index::intersects(column_view const& lower,
+                                                     column_view const& upper,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(lower.size() == upper.size(),
+               "The lower and upper bounds must have the same size",
+               std::invalid_argument);
+  // the keys within a range are those from the first one not less than its lower bound to the
+  // last one not greater than its upper bound
+  auto const first = search_keys(keys(), lower, true, stream);
+  auto const last  = search_keys(keys(), upper, false, stream);
+  auto result      = make_numeric_column(
+    data_type{type_id::BOOL8}, lower.size(), mask_state::UNALLOCATED, stream, mr);
+
+  auto const d_lower = column_device_view::create(lower, stream);
+  auto const d_upper = column_device_view::create(upper, stream);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   result->mutable_view().begin<bool>(),
+                   result->mutable_view().end<bool>(),
+                   [first    = first->view().begin<size_type>(),
+                    last     = last->view().begin<size_type>(),
+                    lower    = *d_lower,
+                    upper    = *d_upper,
+                    num_keys = keys().size()] __device__(size_type i) {
+                     auto const begin = lower.is_null(i) ? 0 : first[i];
+                     auto const end   = upper.is_null(i) ? num_keys : last[i];
+                     return begin < end;
+                   });
+  return result;
+}
+
+}  // namespace cudf
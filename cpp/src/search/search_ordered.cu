@@ -15,7 +15,10 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
@@ -26,12 +29,222 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/functional>
+#include <cuda/std/utility>
 #include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace detail {
 namespace {
 
+// Haystacks with fewer rows are searched in a single level, as they fit in the cache anyway
+constexpr size_type min_two_level_search_rows = 1 << 16;
+// Number of haystack rows gathered into the first level of the search of unsorted needles
+constexpr size_type num_sampled_rows = 1023;
+// Number of consecutive sorted needles searched within the same window of the haystack
+constexpr size_type needles_per_tile = 128;
+
+using cudf::experimental::row::lhs_index_type;
+using cudf::experimental::row::rhs_index_type;
+
+/**
+ * @brief Returns the haystack row of a sample of the first level of the search.
+ *
+ * The samples are evenly spaced so that they split the haystack into `num_samples + 1` windows.
+ */
+__device__ size_type sampled_row(size_type sample, size_type num_samples, size_type num_rows)
+{
+  return static_cast<size_type>(static_cast<int64_t>(sample + 1) * num_rows / (num_samples + 1));
+}
+
+/**
+ * @brief Searches the whole haystack.
+ */
+struct full_window {
+  size_type num_rows;
+
+  __device__ cuda::std::pair<size_type, size_type> operator()(size_type) const
+  {
+    return {0, num_rows};
+  }
+};
+
+/**
+ * @brief Searches the haystack between the bounds of the samples around the needle.
+ */
+struct sampled_window {
+  size_type const* sample_bounds;  ///< bound of every needle among the samples
+  size_type num_samples;
+  size_type num_rows;
+
+  __device__ cuda::std::pair<size_type, size_type> operator()(size_type needle) const
+  {
+    auto const sample = sample_bounds[needle];
+    return {sample > 0 ? sampled_row(sample - 1, num_samples, num_rows) + 1 : 0,
+            sample < num_samples ? sampled_row(sample, num_samples, num_rows) : num_rows};
+  }
+};
+
+/**
+ * @brief Searches the haystack between the bounds of the first needles of the tile of the needle
+ * and of the next tile, which hold the bounds of all the needles of the tile when the needles are
+ * sorted.
+ */
+struct tile_window {
+  size_type const* tile_bounds;
+  size_type num_tiles;
+  size_type num_rows;
+
+  __device__ cuda::std::pair<size_type, size_type> operator()(size_type needle) const
+  {
+    auto const tile = needle / needles_per_tile;
+    return {tile_bounds[tile], tile + 1 < num_tiles ? tile_bounds[tile + 1] : num_rows};
+  }
+};
+
+/**
+ * @brief Binary search of the lower or upper bound of a needle within a window of the haystack.
+ */
+template <typename Comparator, typename Window>
+struct window_search_fn {
+  Comparator less;
+  Window window;
+  bool find_first;
+
+  __device__ size_type operator()(size_type needle) const
+  {
+    auto [begin, end] = window(needle);
+    auto const rhs    = static_cast<rhs_index_type>(needle);
+    while (begin < end) {
+      auto const mid = begin + (end - begin) / 2;
+      auto const lhs = static_cast<lhs_index_type>(mid);
+      // the bound is past a haystack row that sorts before the needle, or equal to it for the
+      // upper bound
+      if (find_first ? less(lhs, rhs) : !less(rhs, lhs)) {
+        begin = mid + 1;
+      } else {
+        end = mid;
+      }
+    }
+    return begin;
+  }
+};
+
+template <typename Comparator, typename Window>
+window_search_fn<Comparator, Window> make_window_search(Comparator less,
+                                                        Window window,
+                                                        bool find_first)
+{
+  return window_search_fn<Comparator, Window>{less, window, find_first};
+}
+
+/**
+ * @brief Finds the bound of every needle in the haystack.
+ *
+ * Large haystacks are searched in two levels. Sorted needles first search the bounds of every
+ * `needles_per_tile`-th needle, and the needles between them only search the window between these
+ * bounds, so that neighboring needles read neighboring haystack rows. Other needles first search
+ * a small table of evenly spaced haystack rows, which stays in the cache, and then only the
+ * window between the two samples around them.
+ */
+template <bool has_nested_columns>
+void search_rows(table_view const& haystack,
+                 table_view const& needles,
+                 bool find_first,
+                 std::vector<order> const& column_order,
+                 std::vector<null_order> const& null_precedence,
+                 size_type* out_it,
+                 rmm::cuda_stream_view stream)
+{
+  auto const num_rows    = haystack.num_rows();
+  auto const num_needles = needles.num_rows();
+  auto const has_nulls   = has_nested_nulls(haystack) or has_nested_nulls(needles);
+  auto const comparator  = cudf::experimental::row::lexicographic::two_table_comparator(
+    haystack, needles, column_order, null_precedence, stream);
+  auto const d_comparator = comparator.less<has_nested_columns>(nullate::DYNAMIC{has_nulls});
+  auto const needle_rows  = thrust::make_counting_iterator<size_type>(0);
+
+  if (num_rows < min_two_level_search_rows) {
+    auto const haystack_it = cudf::experimental::row::lhs_iterator(0);
+    auto const needles_it  = cudf::experimental::row::rhs_iterator(0);
+    if (find_first) {
+      thrust::lower_bound(rmm::exec_policy(stream),
+                          haystack_it,
+                          haystack_it + num_rows,
+                          needles_it,
+                          needles_it + num_needles,
+                          out_it,
+                          d_comparator);
+    } else {
+      thrust::upper_bound(rmm::exec_policy(stream),
+                          haystack_it,
+                          haystack_it + num_rows,
+                          needles_it,
+                          needles_it + num_needles,
+                          out_it,
+                          d_comparator);
+    }
+    return;
+  }
+
+  if (num_needles > needles_per_tile &&
+      detail::is_sorted(needles, column_order, null_precedence, stream)) {
+    auto const num_tiles = util::div_rounding_up_safe(num_needles, needles_per_tile);
+    rmm::device_uvector<size_type> tile_bounds(num_tiles, stream);
+    auto const tile_needles = thrust::make_transform_iterator(
+      needle_rows,
+      cuda::proclaim_return_type<size_type>(
+        [] __device__(size_type tile) { return tile * needles_per_tile; }));
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      tile_needles,
+                      tile_needles + num_tiles,
+                      tile_bounds.begin(),
+                      make_window_search(d_comparator, full_window{num_rows}, find_first));
+    thrust::transform(
+      rmm::exec_policy(stream),
+      needle_rows,
+      needle_rows + num_needles,
+      out_it,
+      make_window_search(
+        d_comparator, tile_window{tile_bounds.data(), num_tiles, num_rows}, find_first));
+    return;
+  }
+
+  auto const sample_rows = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<size_type>([num_rows] __device__(size_type sample) {
+      return sampled_row(sample, num_sampled_rows, num_rows);
+    }));
+  auto const samples = detail::gather(haystack,
+                                      sample_rows,
+                                      sample_rows + num_sampled_rows,
+                                      out_of_bounds_policy::DONT_CHECK,
+                                      stream,
+                                      rmm::mr::get_current_device_resource());
+  auto const sample_comparator = cudf::experimental::row::lexicographic::two_table_comparator(
+    samples->view(), needles, column_order, null_precedence, stream);
+  rmm::device_uvector<size_type> sample_bounds(num_needles, stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    needle_rows,
+    needle_rows + num_needles,
+    sample_bounds.begin(),
+    make_window_search(sample_comparator.less<has_nested_columns>(nullate::DYNAMIC{has_nulls}),
+                       full_window{num_sampled_rows},
+                       find_first));
+  thrust::transform(
+    rmm::exec_policy(stream),
+    needle_rows,
+    needle_rows + num_needles,
+    out_it,
+    make_window_search(d_comparator,
+                       sampled_window{sample_bounds.data(), num_sampled_rows, num_rows},
+                       find_first));
+}
+
 std::unique_ptr<column> search_ordered(table_view const& haystack,
                                        table_view const& needles,
                                        bool find_first,
@@ -66,51 +279,22 @@ std::unique_ptr<column> search_ordered(table_view const& haystack,
   auto const& matched_haystack = matched.second.front();
   auto const& matched_needles  = matched.second.back();
 
-  auto const comparator = cudf::experimental::row::lexicographic::two_table_comparator(
-    matched_haystack, matched_needles, column_order, null_precedence, stream);
-  auto const has_nulls = has_nested_nulls(matched_haystack) or has_nested_nulls(matched_needles);
-
-  auto const haystack_it = cudf::experimental::row::lhs_iterator(0);
-  auto const needles_it  = cudf::experimental::row::rhs_iterator(0);
-
   if (cudf::detail::has_nested_columns(haystack) || cudf::detail::has_nested_columns(needles)) {
-    auto const d_comparator = comparator.less<true>(nullate::DYNAMIC{has_nulls});
-    if (find_first) {
-      thrust::lower_bound(rmm::exec_policy(stream),
-                          haystack_it,
-                          haystack_it + haystack.num_rows(),
-                          needles_it,
-                          needles_it + needles.num_rows(),
-                          out_it,
-                          d_comparator);
-    } else {
-      thrust::upper_bound(rmm::exec_policy(stream),
-                          haystack_it,
-                          haystack_it + haystack.num_rows(),
-                          needles_it,
-                          needles_it + needles.num_rows(),
-                          out_it,
-                          d_comparator);
-    }
+    search_rows<true>(matched_haystack,
+                      matched_needles,
+                      find_first,
+                      column_order,
+                      null_precedence,
+                      out_it,
+                      stream);
   } else {
-    auto const d_comparator = comparator.less<false>(nullate::DYNAMIC{has_nulls});
-    if (find_first) {
-      thrust::lower_bound(rmm::exec_policy(stream),
-                          haystack_it,
-                          haystack_it + haystack.num_rows(),
-                          needles_it,
-                          needles_it + needles.num_rows(),
-                          out_it,
-                          d_comparator);
-    } else {
-      thrust::upper_bound(rmm::exec_policy(stream),
-                          haystack_it,
-                          haystack_it + haystack.num_rows(),
-                          needles_it,
-                          needles_it + needles.num_rows(),
-                          out_it,
-                          d_comparator);
-    }
+    search_rows<false>(matched_haystack,
+                       matched_needles,
+                       find_first,
+                       column_order,
+                       null_precedence,
+                       out_it,
+                       stream);
   }
   return result;
 }
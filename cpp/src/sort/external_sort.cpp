@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/merge.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/host_spill.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Returns the first value of a column of row indices.
+ */
+size_type first_index(column const& indices, rmm::cuda_stream_view stream)
+{
+  return cudf::detail::make_std_vector_sync(
+           device_span<size_type const>{indices.view().data<size_type>(), 1}, stream)
+    .front();
+}
+
+/**
+ * @brief Returns the number of rows of a sorted table not greater than the row of `needle`.
+ */
+size_type num_rows_up_to(table_view const& haystack,
+                         table_view const& needle,
+                         std::vector<order> const& column_order,
+                         std::vector<null_order> const& null_precedence,
+                         rmm::cuda_stream_view stream)
+{
+  auto const bound = cudf::detail::upper_bound(haystack,
+                                               needle,
+                                               column_order,
+                                               null_precedence,
+                                               stream,
+                                               rmm::mr::get_current_device_resource());
+  return first_index(*bound, stream);
+}
+
+}  // namespace
+
+external_sorter::~external_sorter() = default;
+
+external_sorter::external_sorter(external_sorter&&) = default;
+
+external_sorter& external_sorter::operator=(external_sorter&&) = default;
+
+external_sorter::external_sorter(std::vector<size_type> key_cols,
+                                 std::vector<order> column_order,
+                                 std::vector<null_order> null_precedence,
+                                 std::size_t chunk_size)
+  : _key_cols{std::move(key_cols)},
+    _column_order{std::move(column_order)},
+    _null_precedence{std::move(null_precedence)},
+    _chunk_size{chunk_size}
+{
+  CUDF_EXPECTS(_column_order.size() == _key_cols.size(),
+               "Mismatch between number of key columns and column order");
+  CUDF_EXPECTS(_null_precedence.empty() or _null_precedence.size() == _key_cols.size(),
+               "Mismatch between number of key columns and null precedence");
+  CUDF_EXPECTS(chunk_size > 0, "The chunk size must be positive");
+}
+
+void external_sorter::add_batch(table_view const& input, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not _merging, "Batches cannot be added once the merge has started");
+  CUDF_EXPECTS(std::all_of(_key_cols.begin(),
+                           _key_cols.end(),
+                           [&](auto idx) { return idx >= 0 and idx < input.num_columns(); }),
+               "Key column index out of bounds");
+
+  std::vector<data_type> types;
+  std::transform(input.begin(), input.end(), std::back_inserter(types), [](auto const& col) {
+    return col.type();
+  });
+  if (_types.empty()) {
+    _types = std::move(types);
+  } else {
+    CUDF_EXPECTS(types == _types, "The column types differ from the previous batches");
+  }
+  if (input.num_rows() == 0) { return; }
+
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const sorted  = cudf::detail::sort_by_key(
+    input, input.select(_key_cols), _column_order, _null_precedence, stream, temp_mr);
+
+  // rows of a block are estimated to have the average size of the rows of the batch
+  auto const num_rows = static_cast<std::size_t>(input.num_rows());
+  auto const table_size =
+    std::max<std::size_t>(cudf::detail::estimated_table_size(input, stream), 1);
+  auto const block_rows = static_cast<size_type>(
+    std::clamp<std::size_t>(_chunk_size * num_rows / table_size, 1, num_rows));
+
+  std::vector<cudf::detail::spilled_table> blocks;
+  for (size_type begin = 0; begin < input.num_rows(); begin += block_rows) {
+    auto const end   = std::min(begin + block_rows, input.num_rows());
+    auto const block = cudf::slice(sorted->view(), {begin, end}, stream);
+    blocks.push_back(cudf::detail::spill(block.front(), stream));
+  }
+  _runs.push_back(std::move(blocks));
+  _next_blocks.push_back(0);
+  _heads.emplace_back();
+}
+
+bool external_sorter::has_next() const
+{
+  for (std::size_t i = 0; i < _runs.size(); ++i) {
+    if (_next_blocks[i] < _runs[i].size() or (_heads[i] and _heads[i]->num_rows() > 0)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::unique_ptr<table> external_sorter::next_chunk(rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "All the rows of the batches were already returned");
+  _merging = true;
+
+  // load the next block of the runs whose loaded rows were all merged
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  for (std::size_t i = 0; i < _runs.size(); ++i) {
+    if ((not _heads[i] or _heads[i]->num_rows() == 0) and _next_blocks[i] < _runs[i].size()) {
+      auto const packed = cudf::detail::unspill(_runs[i][_next_blocks[i]], stream);
+      _heads[i]         = std::make_unique<table>(cudf::unpack(packed), stream, temp_mr);
+      // the spilled block is not needed anymore
+      _runs[i][_next_blocks[i]++] = {};
+    }
+  }
+
+  // The rows of the loaded blocks up to the smallest last row of the runs with more blocks can
+  // be merged, since all the rows of those blocks are not smaller than their last row.
+  std::vector<std::size_t> active;
+  std::vector<table_view> last_rows;
+  for (std::size_t i = 0; i < _runs.size(); ++i) {
+    if (not _heads[i] or _heads[i]->num_rows() == 0) { continue; }
+    active.push_back(i);
+    if (_next_blocks[i] < _runs[i].size()) {
+      auto const num_rows = _heads[i]->num_rows();
+      last_rows.push_back(
+        cudf::slice(_heads[i]->view().select(_key_cols), {num_rows - 1, num_rows}, stream)
+          .front());
+    }
+  }
+  std::unique_ptr<table> limit;
+  if (not last_rows.empty()) {
+    auto const candidates = cudf::detail::concatenate(last_rows, stream, temp_mr);
+    auto const sorted     = cudf::detail::sorted_order(
+      candidates->view(), _column_order, _null_precedence, stream, temp_mr);
+    auto const smallest = first_index(*sorted, stream);
+    limit               = std::make_unique<table>(last_rows[smallest], stream, temp_mr);
+  }
+
+  std::vector<table_view> merged;
+  std::vector<std::unique_ptr<table>> residuals(_runs.size());
+  for (auto const i : active) {
+    auto const view     = _heads[i]->view();
+    auto const num_rows = view.num_rows();
+
+    auto const end =
+      limit ? num_rows_up_to(
+                view.select(_key_cols), limit->view(), _column_order, _null_precedence, stream)
+            : num_rows;
+    if (end > 0) { merged.push_back(cudf::slice(view, {0, end}, stream).front()); }
+    if (end < num_rows) {
+      residuals[i] = std::make_unique<table>(
+        cudf::slice(view, {end, num_rows}, stream).front(), stream, temp_mr);
+    }
+  }
+
+  auto result = merged.size() == 1
+                  ? std::make_unique<table>(merged.front(), stream, mr)
+                  : cudf::detail::merge(
+                      merged, _key_cols, _column_order, _null_precedence, stream, mr);
+  _heads = std::move(residuals);
+  return result;
+}
+
+}  // namespace cudf
@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "normalized_keys.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_radix_sort.cuh>
+#include <cuda/functional>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr size_type key_word_size = sizeof(key_word);
+
+/**
+ * @brief Layout of the bytes of a column in the normalized keys of the rows.
+ */
+struct column_layout {
+  size_type offset;   ///< Offset of the bytes of the column in a key
+  size_type size;     ///< Number of bytes of the column, including its null indicator
+  bool has_nulls;     ///< Whether the bytes of the column start with a null indicator
+  bool nulls_before;  ///< Whether nulls are ordered before the valid values
+  bool descending;    ///< Whether the bytes are inverted for a descending order
+};
+
+size_type encoded_value_size(data_type type)
+{
+  return type.id() == type_id::STRING ? normalized_string_prefix_size + 1
+                                      : static_cast<size_type>(cudf::size_of(type));
+}
+
+/**
+ * @brief Writes the big-endian bytes of a value such that the order of the bytes is the order of
+ * the values.
+ */
+struct encode_element_fn {
+  template <typename T>
+  __device__ void write_ordered_bytes(T value, uint8_t* out) const
+  {
+    uint8_t bytes[sizeof(T)];
+    memcpy(bytes, &value, sizeof(T));
+    auto& top = bytes[sizeof(T) - 1];
+    if constexpr (cuda::std::is_floating_point_v<T>) {
+      // negative values are ordered by their decreasing magnitude
+      if (top & 0x80) {
+        for (auto& byte : bytes) {
+          byte = ~byte;
+        }
+      } else {
+        top ^= 0x80;
+      }
+    } else if constexpr (static_cast<T>(-1) < static_cast<T>(0)) {
+      top ^= 0x80;
+    }
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      out[i] = bytes[sizeof(T) - 1 - i];
+    }
+  }
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  __device__ bool operator()(column_device_view const& col, size_type row, uint8_t* out) const
+  {
+    if constexpr (cudf::is_fixed_point<T>()) {
+      write_ordered_bytes(col.element<device_storage_type_t<T>>(row), out);
+    } else if constexpr (cudf::is_timestamp<T>()) {
+      write_ordered_bytes(col.element<T>(row).time_since_epoch().count(), out);
+    } else if constexpr (cudf::is_duration<T>()) {
+      write_ordered_bytes(col.element<T>(row).count(), out);
+    } else if constexpr (cuda::std::is_same_v<T, bool>) {
+      *out = col.element<bool>(row) ? 1 : 0;
+    } else if constexpr (cuda::std::is_floating_point_v<T>) {
+      // NaNs are equivalent and greater than the other values, and -0.0 is equivalent to 0.0
+      auto const value = col.element<T>(row);
+      if (isnan(value)) {
+        write_ordered_bytes(cuda::std::numeric_limits<T>::quiet_NaN(), out);
+      } else {
+        write_ordered_bytes(value == T{0} ? T{0} : value, out);
+      }
+    } else {
+      write_ordered_bytes(col.element<T>(row), out);
+    }
+    return false;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(cuda::std::is_same_v<T, string_view>)>
+  __device__ bool operator()(column_device_view const& col, size_type row, uint8_t* out) const
+  {
+    auto const str    = col.element<string_view>(row);
+    auto const prefix = min(str.size_bytes(), normalized_string_prefix_size);
+    memcpy(out, str.data(), prefix);
+    // the size orders the strings that are a prefix of one another, while the strings longer than
+    // the prefix all have the same size byte and their ties are resolved by `sort_tied_rows`
+    out[normalized_string_prefix_size] =
+      static_cast<uint8_t>(min(str.size_bytes(), normalized_string_prefix_size + 1));
+    return str.size_bytes() > normalized_string_prefix_size;
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not cudf::is_fixed_width<T>() and
+                           not cuda::std::is_same_v<T, string_view>)>
+  __device__ bool operator()(column_device_view const&, size_type, uint8_t*) const
+  {
+    CUDF_UNREACHABLE("Unsupported type for a normalized key");
+  }
+};
+
+/**
+ * @brief Encodes the normalized key of each row into its 64-bit words, in a column-major layout.
+ */
+CUDF_KERNEL void encode_keys_kernel(table_device_view input,
+                                    column_layout const* layouts,
+                                    size_type num_words,
+                                    key_word* words,
+                                    bool* truncated)
+{
+  auto const num_rows = input.num_rows();
+  auto const stride   = cudf::detail::grid_1d::grid_stride();
+  for (auto idx = cudf::detail::grid_1d::global_thread_id(); idx < num_rows; idx += stride) {
+    auto const row = static_cast<size_type>(idx);
+    uint8_t key[max_normalized_key_size] = {};
+    bool is_truncated                    = false;
+    for (size_type c = 0; c < input.num_columns(); ++c) {
+      auto const& layout = layouts[c];
+      auto const col     = input.column(c);
+      auto out           = key + layout.offset;
+      bool const is_null = layout.has_nulls and col.is_null(row);
+      if (layout.has_nulls) { *out++ = layout.nulls_before ? !is_null : is_null; }
+      if (not is_null) {
+        is_truncated |= cudf::type_dispatcher(col.type(), encode_element_fn{}, col, row, out);
+      }
+      if (layout.descending) {
+        for (auto i = layout.offset; i < layout.offset + layout.size; ++i) {
+          key[i] = ~key[i];
+        }
+      }
+    }
+    for (size_type w = 0; w < num_words; ++w) {
+      key_word word = 0;
+      for (size_type b = 0; b < key_word_size; ++b) {
+        word = (word << 8) | key[w * key_word_size + b];
+      }
+      words[static_cast<std::size_t>(w) * num_rows + row] = word;
+    }
+    truncated[row] = is_truncated;
+  }
+}
+
+/**
+ * @brief Compares the normalized keys of two rows.
+ */
+struct keys_equal_fn {
+  key_word const* words;
+  size_type num_rows;
+  size_type num_words;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    for (size_type w = 0; w < num_words; ++w) {
+      auto const word = words + static_cast<std::size_t>(w) * num_rows;
+      if (word[lhs] != word[rhs]) { return false; }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Orders tied rows by the run of equal normalized keys they belong to, then by the
+ * row comparator.
+ */
+template <typename RowLess>
+struct tied_row_less_fn {
+  size_type const* run_labels;
+  size_type const* rows;
+  RowLess row_less;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (run_labels[lhs] != run_labels[rhs]) { return run_labels[lhs] < run_labels[rhs]; }
+    return row_less(rows[lhs], rows[rhs]);
+  }
+};
+
+/**
+ * @brief Sorts again with the lexicographic row comparator the runs of rows with equal normalized
+ * keys and truncated strings.
+ */
+void sort_tied_rows(table_view const& input,
+                    std::vector<order> const& column_order,
+                    std::vector<null_order> const& null_precedence,
+                    keys_equal_fn keys_equal,
+                    bool const* truncated,
+                    device_span<size_type> sorted_rows,
+                    rmm::cuda_stream_view stream)
+{
+  auto const num_rows = static_cast<size_type>(sorted_rows.size());
+  auto const rows     = sorted_rows.data();
+
+  // label the runs of equal keys, and select the positions of the runs of truncated rows
+  rmm::device_uvector<size_type> run_labels(num_rows, stream);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_rows),
+    run_labels.begin(),
+    cuda::proclaim_return_type<size_type>([rows, keys_equal] __device__(size_type i) {
+      return i > 0 and keys_equal(rows[i - 1], rows[i]) ? 0 : 1;
+    }),
+    thrust::plus<size_type>{});
+  rmm::device_uvector<size_type> positions(num_rows, stream);
+  auto const positions_end = thrust::copy_if(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_rows),
+    positions.begin(),
+    [rows, keys_equal, truncated, num_rows] __device__(size_type i) {
+      return truncated[rows[i]] and ((i > 0 and keys_equal(rows[i - 1], rows[i])) or
+                                     (i + 1 < num_rows and keys_equal(rows[i], rows[i + 1])));
+    });
+  auto const num_tied = static_cast<size_type>(thrust::distance(positions.begin(), positions_end));
+  if (num_tied == 0) { return; }
+
+  rmm::device_uvector<size_type> tied_rows(num_tied, stream);
+  rmm::device_uvector<size_type> tied_labels(num_tied, stream);
+  thrust::gather(
+    rmm::exec_policy_nosync(stream), positions.begin(), positions_end, rows, tied_rows.begin());
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 positions.begin(),
+                 positions_end,
+                 run_labels.begin(),
+                 tied_labels.begin());
+
+  // the runs are contiguous, so the sorted runs are scattered back to the same positions
+  rmm::device_uvector<size_type> tied_order(num_tied, stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), tied_order.begin(), tied_order.end(), 0);
+  auto const comparator = cudf::experimental::row::lexicographic::self_comparator(
+    input, column_order, null_precedence, stream);
+  auto const row_less = comparator.less<false>(nullate::DYNAMIC{cudf::has_nulls(input)});
+  thrust::stable_sort(
+    rmm::exec_policy_nosync(stream),
+    tied_order.begin(),
+    tied_order.end(),
+    tied_row_less_fn<decltype(row_less)>{tied_labels.data(), tied_rows.data(), row_less});
+  thrust::scatter(rmm::exec_policy_nosync(stream),
+                  thrust::make_permutation_iterator(tied_rows.begin(), tied_order.begin()),
+                  thrust::make_permutation_iterator(tied_rows.begin(), tied_order.end()),
+                  positions.begin(),
+                  rows);
+}
+
+}  // namespace
+
+bool is_normalized_sort_supported(table_view const& input)
+{
+  size_type key_size = 0;
+  for (auto const& col : input) {
+    if (not cudf::is_fixed_width(col.type()) and col.type().id() != type_id::STRING) {
+      return false;
+    }
+    key_size += encoded_value_size(col.type()) + (col.has_nulls() ? 1 : 0);
+  }
+  return key_size <= max_normalized_key_size;
+}
+
+normalized_keys encode_normalized_keys(table_view const& input,
+                                       std::vector<order> const& column_order,
+                                       std::vector<null_order> const& null_precedence,
+                                       rmm::cuda_stream_view stream)
+{
+  auto const num_rows = input.num_rows();
+
+  std::vector<column_layout> layouts;
+  size_type key_size = 0;
+  bool has_strings   = false;
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    auto const col       = input.column(c);
+    auto const has_nulls = col.has_nulls();
+    auto const size      = encoded_value_size(col.type()) + (has_nulls ? 1 : 0);
+    layouts.push_back({key_size,
+                       size,
+                       has_nulls,
+                       null_precedence.empty() or null_precedence[c] == null_order::BEFORE,
+                       not column_order.empty() and column_order[c] == order::DESCENDING});
+    key_size += size;
+    has_strings |= col.type().id() == type_id::STRING;
+  }
+  auto const num_words = cudf::util::div_rounding_up_safe(key_size, key_word_size);
+
+  auto const d_layouts = cudf::detail::make_device_uvector_async(
+    layouts, stream, rmm::mr::get_current_device_resource());
+  normalized_keys keys{
+    rmm::device_uvector<key_word>(static_cast<std::size_t>(num_words) * num_rows, stream),
+    rmm::device_uvector<bool>(num_rows, stream),
+    key_size,
+    num_words,
+    has_strings};
+  if (num_rows > 0) {
+    auto const d_input = table_device_view::create(input, stream);
+    cudf::detail::grid_1d const grid{num_rows, 256};
+    encode_keys_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *d_input, d_layouts.data(), num_words, keys.words.data(), keys.truncated.data());
+  }
+  return keys;
+}
+
+std::unique_ptr<column> normalized_sorted_order(table_view const& input,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.num_rows();
+  auto const [words, truncated, key_size, num_words, has_strings] =
+    encode_normalized_keys(input, column_order, null_precedence, stream);
+
+  // Least significant digit radix sort of the words of the keys, from the last to the first
+  auto result = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const sorted_rows = result->mutable_view().begin<size_type>();
+  rmm::device_uvector<size_type> rows_buffer(num_rows, stream);
+  auto current_rows   = sorted_rows;
+  auto alternate_rows = rows_buffer.data();
+  rmm::device_uvector<key_word> keys_buffer1(num_rows, stream);
+  rmm::device_uvector<key_word> keys_buffer2(num_rows, stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), sorted_rows, sorted_rows + num_rows, 0);
+
+  std::size_t temp_storage_bytes = 0;
+  {
+    cub::DoubleBuffer<key_word> keys(keys_buffer1.data(), keys_buffer2.data());
+    cub::DoubleBuffer<size_type> rows(sorted_rows, rows_buffer.data());
+    cub::DeviceRadixSort::SortPairs(
+      nullptr, temp_storage_bytes, keys, rows, num_rows, 0, key_word_size * 8, stream.value());
+  }
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+
+  for (auto w = num_words - 1; w >= 0; --w) {
+    thrust::gather(rmm::exec_policy_nosync(stream),
+                   current_rows,
+                   current_rows + num_rows,
+                   words.begin() + static_cast<std::size_t>(w) * num_rows,
+                   keys_buffer1.begin());
+    cub::DoubleBuffer<key_word> keys(keys_buffer1.data(), keys_buffer2.data());
+    cub::DoubleBuffer<size_type> rows(current_rows, alternate_rows);
+    // the unused low bytes of the last word are zeros
+    auto const begin_bit =
+      w == num_words - 1 ? (num_words * key_word_size - key_size) * 8 : size_type{0};
+    cub::DeviceRadixSort::SortPairs(temp_storage.data(),
+                                    temp_storage_bytes,
+                                    keys,
+                                    rows,
+                                    num_rows,
+                                    begin_bit,
+                                    key_word_size * 8,
+                                    stream.value());
+    if (rows.Current() != current_rows) { std::swap(current_rows, alternate_rows); }
+  }
+  if (current_rows != sorted_rows) {
+    thrust::copy(
+      rmm::exec_policy_nosync(stream), current_rows, current_rows + num_rows, sorted_rows);
+  }
+
+  if (has_strings and thrust::any_of(rmm::exec_policy(stream),
+                                     truncated.begin(),
+                                     truncated.end(),
+                                     thrust::identity<bool>{})) {
+    sort_tied_rows(input,
+                   column_order,
+                   null_precedence,
+                   keys_equal_fn{words.data(), num_rows, num_words},
+                   truncated.data(),
+                   device_span<size_type>(sorted_rows, num_rows),
+                   stream);
+  }
+
+  return result;
+}
+
+}  // namespace detail
+}  // namespace cudf
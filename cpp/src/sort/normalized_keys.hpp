@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/// Number of leading bytes of a string encoded in its normalized key
+constexpr size_type normalized_string_prefix_size = 15;
+
+/// Maximum size in bytes of the normalized key of a row
+constexpr size_type max_normalized_key_size = 64;
+
+/// The words of a normalized key, compared as unsigned integers from the first to the last
+using key_word = uint64_t;
+
+/**
+ * @brief The normalized keys of the rows of a table.
+ */
+struct normalized_keys {
+  rmm::device_uvector<key_word> words;  ///< Word `w` of row `i` at `w * num_rows + i`
+  rmm::device_uvector<bool> truncated;  ///< Whether the key of a row truncates a string
+  size_type key_size;                   ///< Number of bytes of a key
+  size_type num_words;                  ///< Number of words of a key
+  bool has_strings;                     ///< Whether any column is a strings column
+};
+
+/**
+ * @brief Checks whether the rows of a table can be sorted by their normalized keys.
+ *
+ * The columns must be fixed-width or strings columns, and the normalized key of a row must not
+ * exceed `max_normalized_key_size` bytes.
+ *
+ * @param input The table to sort
+ * @return true if `normalized_sorted_order` can sort `input`
+ */
+bool is_normalized_sort_supported(table_view const& input);
+
+/**
+ * @brief Encodes the rows of a table into byte-comparable normalized keys.
+ *
+ * The normalized key of a row concatenates, for each column, a null indicator byte if the column
+ * has nulls and the value of the row encoded so that comparing the bytes of two keys orders them
+ * like the values: integers are big-endian with a flipped sign bit, floating-point values are
+ * mapped to integers of the same order, and strings are encoded by their first
+ * `normalized_string_prefix_size` bytes and a byte of their size. The bytes of a column sorted in
+ * descending order are inverted, and the unused bytes of the last word are zeros. Keys of rows
+ * without truncated strings compare like the rows.
+ *
+ * Precondition: `is_normalized_sort_supported(input)` is true.
+ *
+ * @param input The table to encode
+ * @param column_order The desired order of each column, ascending if empty
+ * @param null_precedence The desired order of nulls of each column, before if empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The normalized keys of the rows of `input`
+ */
+normalized_keys encode_normalized_keys(table_view const& input,
+                                       std::vector<order> const& column_order,
+                                       std::vector<null_order> const& null_precedence,
+                                       rmm::cuda_stream_view stream);
+
+/**
+ * @brief Computes the stable sorted order of the rows of a table by radix sorting their
+ * normalized keys.
+ *
+ * The keys from `encode_normalized_keys` are sorted by a least significant digit radix sort of
+ * their 64-bit words, and rows of equal keys with truncated strings are then sorted again with the
+ * lexicographic row comparator.
+ *
+ * Precondition: `is_normalized_sort_supported(input)` is true.
+ *
+ * @param input The table to sort
+ * @param column_order The desired order of each column, ascending if empty
+ * @param null_precedence The desired order of nulls of each column, before if empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The indices of the rows of `input` in sorted order
+ */
+std::unique_ptr<column> normalized_sorted_order(table_view const& input,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace cudf
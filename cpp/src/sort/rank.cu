@@ -261,16 +261,16 @@ void rank_average(cudf::device_span<size_type const> group_keys,
     stream);
 }
 
-}  // anonymous namespace
-
-std::unique_ptr<column> rank(column_view const& input,
-                             rank_method method,
-                             order column_order,
-                             null_policy null_handling,
-                             null_order null_precedence,
-                             bool percentage,
-                             rmm::cuda_stream_view stream,
-                             rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Computes the ranks of the rows of a column from their sorted order.
+ */
+std::unique_ptr<column> rank_from_sorted_order(column_view const& input,
+                                               column_view const& sorted_order_view,
+                                               rank_method method,
+                                               null_policy null_handling,
+                                               bool percentage,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
 {
   data_type const output_type         = (percentage or method == rank_method::AVERAGE)
                                           ? data_type(type_id::FLOAT64)
@@ -289,13 +289,6 @@ std::unique_ptr<column> rank(column_view const& input,
   }();
   auto rank_mutable_view = rank_column->mutable_view();
 
-  std::unique_ptr<column> sorted_order =
-    (method == rank_method::FIRST)
-      ? detail::stable_sorted_order(
-          table_view{{input}}, {column_order}, {null_precedence}, stream, mr)
-      : detail::sorted_order(table_view{{input}}, {column_order}, {null_precedence}, stream, mr);
-  column_view sorted_order_view = sorted_order->view();
-
   // dense: All equal values have same rank and rank always increases by 1 between groups
   // acts as key for min, max, average to denote equal value groups
   rmm::device_uvector<size_type> const dense_rank_sorted =
@@ -364,6 +357,44 @@ std::unique_ptr<column> rank(column_view const& input,
   }
   return rank_column;
 }
+
+}  // anonymous namespace
+
+std::unique_ptr<column> rank(column_view const& input,
+                             rank_method method,
+                             order column_order,
+                             null_policy null_handling,
+                             null_order null_precedence,
+                             bool percentage,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  std::unique_ptr<column> sorted_order =
+    (method == rank_method::FIRST)
+      ? detail::stable_sorted_order(
+          table_view{{input}}, {column_order}, {null_precedence}, stream, temp_mr)
+      : detail::sorted_order(
+          table_view{{input}}, {column_order}, {null_precedence}, stream, temp_mr);
+  return rank_from_sorted_order(
+    input, sorted_order->view(), method, null_handling, percentage, stream, mr);
+}
+
+std::unique_ptr<column> rank(column_view const& input,
+                             column_view const& sorted_order,
+                             rank_method method,
+                             null_policy null_handling,
+                             bool percentage,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sorted_order.type().id() == type_to_id<size_type>(),
+               "The sorted order must be a column of size_type",
+               cudf::data_type_error);
+  CUDF_EXPECTS(sorted_order.size() == input.size() and not sorted_order.has_nulls(),
+               "The sorted order must have one valid index per row of the input");
+  return rank_from_sorted_order(input, sorted_order, method, null_handling, percentage, stream, mr);
+}
 }  // namespace detail
 
 std::unique_ptr<column> rank(column_view const& input,
@@ -379,4 +410,16 @@ std::unique_ptr<column> rank(column_view const& input,
   return detail::rank(
     input, method, column_order, null_handling, null_precedence, percentage, stream, mr);
 }
+
+std::unique_ptr<column> rank(column_view const& input,
+                             column_view const& sorted_order,
+                             rank_method method,
+                             null_policy null_handling,
+                             bool percentage,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rank(input, sorted_order, method, null_handling, percentage, stream, mr);
+}
 }  // namespace cudf
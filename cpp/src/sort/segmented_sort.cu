@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,16 +16,33 @@
 
 #include "segmented_sort_impl.cuh"
 
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/strings/detail/string_prefix.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/gather.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
+#include <type_traits>
 
 namespace cudf {
 namespace detail {
@@ -52,6 +69,300 @@ rmm::device_uvector<size_type> get_segment_indices(size_type num_rows,
   return segment_ids;
 }
 
+namespace {
+
+constexpr int block_size      = 256;
+constexpr int warps_per_block = block_size / cudf::detail::warp_size;
+
+/**
+ * @brief Orders row indices by a row comparator, then by their value so that the sorts are
+ * stable, with the negative padding indices after all the rows.
+ */
+template <typename Comparator>
+struct stable_row_less_fn {
+  Comparator less;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (lhs < 0 or rhs < 0) { return rhs < 0 and lhs >= 0; }
+    return less(lhs, rhs) or (not less(rhs, lhs) and lhs < rhs);
+  }
+};
+
+/**
+ * @brief Orders the rows of a strings column by their prefixes, and by their characters only
+ * when their prefixes tie.
+ */
+struct string_prefix_less_fn {
+  column_device_view d_strings;
+  cudf::strings::detail::string_prefix const* prefixes;
+  bool ascending;
+  bool nulls_before;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    auto const lhs_null = d_strings.is_null(lhs);
+    auto const rhs_null = d_strings.is_null(rhs);
+    if (lhs_null or rhs_null) {
+      return lhs_null != rhs_null and (lhs_null == nulls_before) == ascending;
+    }
+    auto result = cudf::strings::detail::compare_prefixes(prefixes[lhs], prefixes[rhs]);
+    if (not result.has_value()) {
+      result = d_strings.element<string_view>(lhs).compare(d_strings.element<string_view>(rhs));
+    }
+    return ascending ? result.value() < 0 : result.value() > 0;
+  }
+};
+
+/**
+ * @brief Sorts each segment with a bitonic sort of the row indices held by the lanes of a warp.
+ */
+template <typename Comparator>
+CUDF_KERNEL void sort_warp_segments_kernel(size_type const* offsets,
+                                           size_type const* segments,
+                                           size_type num_segments,
+                                           stable_row_less_fn<Comparator> less,
+                                           size_type* indices)
+{
+  auto const warp = static_cast<size_type>(cudf::detail::grid_1d::global_thread_id() /
+                                           cudf::detail::warp_size);
+  if (warp >= num_segments) { return; }
+  auto const lane    = static_cast<int>(threadIdx.x % cudf::detail::warp_size);
+  auto const segment = segments[warp];
+  auto const begin   = offsets[segment];
+  auto const size    = offsets[segment + 1] - begin;
+
+  size_type row = lane < size ? begin + lane : -1;
+  for (int k = 2; k <= cudf::detail::warp_size; k <<= 1) {
+    for (int j = k >> 1; j > 0; j >>= 1) {
+      auto const other = __shfl_xor_sync(0xffff'ffffu, row, j);
+      // the lanes of an ascending sequence keep the smaller row of a pair of lanes
+      bool const keep_min = ((lane & k) == 0) == ((lane & j) == 0);
+      bool const swap     = keep_min ? less(other, row) : less(row, other);
+      if (swap) { row = other; }
+    }
+  }
+  if (lane < size) { indices[begin + lane] = row; }
+}
+
+/**
+ * @brief Sorts each segment with a bitonic sort of its row indices in the shared memory of a
+ * block.
+ */
+template <typename Comparator>
+CUDF_KERNEL void sort_block_segments_kernel(size_type const* offsets,
+                                            size_type const* segments,
+                                            stable_row_less_fn<Comparator> less,
+                                            size_type* indices)
+{
+  __shared__ size_type rows[max_block_segment_size];
+  auto const segment = segments[blockIdx.x];
+  auto const begin   = offsets[segment];
+  auto const size    = offsets[segment + 1] - begin;
+  auto num_padded    = max_warp_segment_size;
+  while (num_padded < size) {
+    num_padded <<= 1;
+  }
+
+  for (auto i = static_cast<size_type>(threadIdx.x); i < num_padded; i += block_size) {
+    rows[i] = i < size ? begin + i : -1;
+  }
+  __syncthreads();
+  for (size_type k = 2; k <= num_padded; k <<= 1) {
+    for (size_type j = k >> 1; j > 0; j >>= 1) {
+      for (auto i = static_cast<size_type>(threadIdx.x); i < num_padded; i += block_size) {
+        auto const partner = i ^ j;
+        if (partner > i) {
+          bool const ascending = (i & k) == 0;
+          if (ascending ? less(rows[partner], rows[i]) : less(rows[i], rows[partner])) {
+            auto const row = rows[i];
+            rows[i]        = rows[partner];
+            rows[partner]  = row;
+          }
+        }
+      }
+      __syncthreads();
+    }
+  }
+  for (auto i = static_cast<size_type>(threadIdx.x); i < size; i += block_size) {
+    indices[begin + i] = rows[i];
+  }
+}
+
+/**
+ * @brief Selects the segments whose size is in `(min_size, max_size]`.
+ */
+rmm::device_uvector<size_type> segments_of_size(size_type const* offsets,
+                                                size_type num_segments,
+                                                size_type min_size,
+                                                size_type max_size,
+                                                rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> segments(num_segments, stream);
+  auto const end = thrust::copy_if(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_segments),
+    segments.begin(),
+    [offsets, min_size, max_size] __device__(size_type segment) {
+      auto const size = offsets[segment + 1] - offsets[segment];
+      return size > min_size and size <= max_size;
+    });
+  segments.resize(thrust::distance(segments.begin(), end), stream);
+  return segments;
+}
+
+/**
+ * @brief Sorts the rows of the segments larger than a block by a sort of their segment ids and
+ * keys.
+ */
+void sort_large_segments(table_view const& keys,
+                         column_view const& segment_offsets,
+                         std::vector<order> const& column_order,
+                         std::vector<null_order> const& null_precedence,
+                         size_type* indices,
+                         rmm::cuda_stream_view stream)
+{
+  auto const offset_begin = segment_offsets.begin<size_type>();
+  auto const offset_end   = segment_offsets.end<size_type>();
+  auto const num_rows     = keys.num_rows();
+
+  // the segment, or -1, of each row of a large segment
+  rmm::device_uvector<size_type> row_segments(num_rows, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(num_rows),
+                    row_segments.begin(),
+                    [offset_begin, offset_end] __device__(size_type row) -> size_type {
+                      if (row < *offset_begin or row >= *(offset_end - 1)) { return -1; }
+                      auto const segment = static_cast<size_type>(
+                        thrust::distance(offset_begin,
+                                         thrust::upper_bound(
+                                           thrust::seq, offset_begin, offset_end, row)) -
+                        1);
+                      auto const size = offset_begin[segment + 1] - offset_begin[segment];
+                      return size > max_block_segment_size ? segment : -1;
+                    });
+  rmm::device_uvector<size_type> large_rows(num_rows, stream);
+  auto const large_rows_end = thrust::copy_if(rmm::exec_policy_nosync(stream),
+                                              thrust::counting_iterator<size_type>(0),
+                                              thrust::counting_iterator<size_type>(num_rows),
+                                              row_segments.begin(),
+                                              large_rows.begin(),
+                                              [] __device__(size_type segment) {
+                                                return segment >= 0;
+                                              });
+  large_rows.resize(thrust::distance(large_rows.begin(), large_rows_end), stream);
+  auto const num_large_rows = static_cast<size_type>(large_rows.size());
+
+  auto const temp_mr    = rmm::mr::get_current_device_resource();
+  auto const large_keys = cudf::detail::gather(
+    keys, large_rows.begin(), large_rows.end(), out_of_bounds_policy::DONT_CHECK, stream, temp_mr);
+  rmm::device_uvector<size_type> large_segment_ids(num_large_rows, stream);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 large_rows.begin(),
+                 large_rows.end(),
+                 row_segments.begin(),
+                 large_segment_ids.begin());
+
+  std::vector<column_view> keys_with_segid{column_view(
+    data_type(type_to_id<size_type>()), num_large_rows, large_segment_ids.data(), nullptr, 0)};
+  auto const large_keys_view = large_keys->view();
+  keys_with_segid.insert(keys_with_segid.end(), large_keys_view.begin(), large_keys_view.end());
+  auto child_column_order = column_order;
+  if (not child_column_order.empty()) {
+    child_column_order.insert(child_column_order.begin(), order::ASCENDING);
+  }
+  auto child_null_precedence = null_precedence;
+  if (not child_null_precedence.empty()) {
+    child_null_precedence.insert(child_null_precedence.begin(), null_order::AFTER);
+  }
+  auto const sorted = cudf::detail::stable_sorted_order(
+    table_view{keys_with_segid}, child_column_order, child_null_precedence, stream, temp_mr);
+
+  // the large segments keep their positions, so the sorted rows are scattered to the same rows
+  auto const sorted_rows =
+    thrust::make_permutation_iterator(large_rows.begin(), sorted->view().begin<size_type>());
+  thrust::scatter(rmm::exec_policy_nosync(stream),
+                  sorted_rows,
+                  sorted_rows + num_large_rows,
+                  large_rows.begin(),
+                  indices);
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_sorted_order_by_size(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const offsets      = segment_offsets.begin<size_type>();
+  auto const num_segments = segment_offsets.size() - 1;
+  auto const warp_segments =
+    segments_of_size(offsets, num_segments, 1, max_warp_segment_size, stream);
+  auto const block_segments = segments_of_size(
+    offsets, num_segments, max_warp_segment_size, max_block_segment_size, stream);
+  auto const num_large_segments = thrust::count_if(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_segments),
+    [offsets] __device__(size_type segment) {
+      return offsets[segment + 1] - offsets[segment] > max_block_segment_size;
+    });
+  if (warp_segments.is_empty() and block_segments.is_empty() and num_large_segments > 0) {
+    return nullptr;
+  }
+
+  auto result = cudf::detail::sequence(
+    keys.num_rows(), numeric_scalar<size_type>{0, true, stream}, stream, mr);
+  auto const indices = result->mutable_view().begin<size_type>();
+
+  auto const sort_small_segments = [&](auto const& comparator) {
+    auto const less = stable_row_less_fn<std::decay_t<decltype(comparator)>>{comparator};
+    if (not warp_segments.is_empty()) {
+      auto const num_warp_segments = static_cast<size_type>(warp_segments.size());
+      auto const num_blocks =
+        cudf::util::div_rounding_up_safe(num_warp_segments, warps_per_block);
+      sort_warp_segments_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+        offsets, warp_segments.data(), num_warp_segments, less, indices);
+    }
+    if (not block_segments.is_empty()) {
+      auto const num_blocks = static_cast<int>(block_segments.size());
+      sort_block_segments_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+        offsets, block_segments.data(), less, indices);
+    }
+  };
+  if (keys.num_columns() == 1 and keys.column(0).type().id() == type_id::STRING) {
+    // every row is compared many times, so most comparisons only load the prefixes of the rows
+    auto const prefixes = cudf::strings::detail::make_string_prefixes(
+      strings_column_view(keys.column(0)), stream, rmm::mr::get_current_device_resource());
+    auto const d_strings = column_device_view::create(keys.column(0), stream);
+    sort_small_segments(string_prefix_less_fn{
+      *d_strings,
+      prefixes.data(),
+      column_order.empty() or column_order.front() == order::ASCENDING,
+      null_precedence.empty() or null_precedence.front() == null_order::BEFORE});
+  } else {
+    auto const comp = cudf::experimental::row::lexicographic::self_comparator(
+      keys, column_order, null_precedence, stream);
+    if (cudf::detail::has_nested_columns(keys)) {
+      sort_small_segments(comp.less<true>(nullate::DYNAMIC{has_nested_nulls(keys)}));
+    } else {
+      sort_small_segments(comp.less<false>(nullate::DYNAMIC{has_nested_nulls(keys)}));
+    }
+  }
+  CUDF_CHECK_CUDA(stream.value());
+
+  if (num_large_segments > 0) {
+    sort_large_segments(keys, segment_offsets, column_order, null_precedence, indices, stream);
+  }
+  return result;
+}
+
 std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
                                                column_view const& segment_offsets,
                                                std::vector<order> const& column_order,
@@ -206,6 +206,37 @@ rmm::device_uvector<size_type> get_segment_indices(size_type num_rows,
                                                    column_view const& offsets,
                                                    rmm::cuda_stream_view stream);
 
+/// Maximum number of rows of a segment sorted by a warp
+constexpr size_type max_warp_segment_size = 32;
+
+/// Maximum number of rows of a segment sorted by a block
+constexpr size_type max_block_segment_size = 1024;
+
+/**
+ * @brief Sorts the segments by warp-level or block-level sorts according to their size.
+ *
+ * Segments of at most `max_warp_segment_size` rows are sorted by a bitonic sort in the registers
+ * of a warp, and segments of at most `max_block_segment_size` rows by a bitonic sort in the
+ * shared memory of a block. The rows of the larger segments are sorted together by a device-wide
+ * sort on their segment ids and keys. The sort is stable.
+ *
+ * @param keys Table to sort
+ * @param segment_offsets Identifies the segments within the keys, at least two offsets
+ * @param column_order Sort order for each column in the keys
+ * @param null_precedence Where to place the null entries for each column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to allocate any returned objects
+ * @return The segmented sorted order, or nullptr if all the segments are larger than
+ * `max_block_segment_size` rows
+ */
+std::unique_ptr<column> segmented_sorted_order_by_size(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Segmented sorted-order utility
  *
@@ -266,6 +297,13 @@ std::unique_ptr<column> segmented_sorted_order_common(
       keys.column(0), segment_offsets, col_order, stream, mr);
   }
 
+  // many small segments are sorted by warps and blocks instead of a sort of all the rows
+  if (segment_offsets.size() > 1) {
+    auto result = segmented_sorted_order_by_size(
+      keys, segment_offsets, column_order, null_precedence, stream, mr);
+    if (result) { return result; }
+  }
+
   // Get segment id of each element in all segments.
   auto segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
 
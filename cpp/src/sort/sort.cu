@@ -21,6 +21,8 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/host_spill.hpp>
+#include <cudf/detail/utilities/instrumentation.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -41,6 +43,15 @@ std::unique_ptr<column> sorted_order(table_view const& input,
   return sorted_order<sort_method::UNSTABLE>(input, column_order, null_precedence, stream, mr);
 }
 
+std::unique_ptr<column> sorted_order(
+  table_view const& input,
+  std::shared_ptr<cudf::experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return sorted_order<sort_method::UNSTABLE>(input, std::move(preprocessed_input), stream, mr);
+}
+
 std::unique_ptr<table> sort_by_key(table_view const& values,
                                    table_view const& keys,
                                    std::vector<order> const& column_order,
@@ -101,9 +112,22 @@ std::unique_ptr<table> sort(table_view const& input,
                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
+  CUDF_API_EVENT(stream, input);
   return detail::sort(input, column_order, null_precedence, stream, mr);
 }
 
+memory_estimate estimate_sort_memory(table_view const& input, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  auto const output_bytes = detail::estimated_table_size(input, stream);
+  // the fast path sorts a copy of the column in place, through a double buffer of its values
+  if (detail::inplace_column_sort_fn<detail::sort_method::UNSTABLE>::is_usable(input)) {
+    return {output_bytes, output_bytes};
+  }
+  // otherwise the sorted order, and the double buffer sorting it, gather the rows
+  return {2 * static_cast<std::size_t>(input.num_rows()) * sizeof(size_type), output_bytes};
+}
+
 std::unique_ptr<table> sort_by_key(table_view const& values,
                                    table_view const& keys,
                                    std::vector<order> const& column_order,
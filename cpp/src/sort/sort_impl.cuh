@@ -17,50 +17,40 @@
 #pragma once
 
 #include "common_sort_impl.cuh"
+#include "normalized_keys.hpp"
 #include "sort_column_impl.cuh"
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+
+#include <memory>
 
 namespace cudf {
 namespace detail {
 
 /**
- * @copydoc
- * sorted_order(table_view&,std::vector<order>,std::vector<null_order>,rmm::mr::device_memory_resource*)
+ * @brief Sorts the rows of a table with the row comparator of its preprocessed table.
  *
- * @tparam stable Whether to use stable sort
+ * @tparam method Whether to use stable sort
+ * @param input The table to sort
+ * @param preprocessed_input The preprocessed `input`, holding the column orders and null
+ *        precedences
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The indices of the sorted rows
  */
 template <sort_method method>
-std::unique_ptr<column> sorted_order(table_view input,
-                                     std::vector<order> const& column_order,
-                                     std::vector<null_order> const& null_precedence,
-                                     rmm::cuda_stream_view stream,
-                                     rmm::mr::device_memory_resource* mr)
+std::unique_ptr<column> sorted_order(
+  table_view input,
+  std::shared_ptr<cudf::experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   if (input.num_rows() == 0 or input.num_columns() == 0) {
     return cudf::make_numeric_column(
       data_type(type_to_id<size_type>()), 0, mask_state::UNALLOCATED, stream, mr);
   }
 
-  if (not column_order.empty()) {
-    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == column_order.size(),
-                 "Mismatch between number of columns and column order.");
-  }
-
-  if (not null_precedence.empty()) {
-    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == null_precedence.size(),
-                 "Mismatch between number of columns and null_precedence size.");
-  }
-
-  // fast-path for single column sort
-  if (input.num_columns() == 1 and not cudf::is_nested(input.column(0).type())) {
-    auto const single_col = input.column(0);
-    auto const col_order  = column_order.empty() ? order::ASCENDING : column_order.front();
-    auto const null_prec  = null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
-    return sorted_order<method>(single_col, col_order, null_prec, stream, mr);
-  }
-
   std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
     data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
@@ -85,8 +75,8 @@ std::unique_ptr<column> sorted_order(table_view input,
     }
   };
 
-  auto const comp = cudf::experimental::row::lexicographic::self_comparator(
-    input, column_order, null_precedence, stream);
+  auto const comp =
+    cudf::experimental::row::lexicographic::self_comparator(std::move(preprocessed_input));
   if (cudf::detail::has_nested_columns(input)) {
     auto const comparator = comp.less<true>(nullate::DYNAMIC{has_nested_nulls(input)});
     do_sort(comparator);
@@ -98,5 +88,55 @@ std::unique_ptr<column> sorted_order(table_view input,
   return sorted_indices;
 }
 
+/**
+ * @copydoc
+ * sorted_order(table_view&,std::vector<order>,std::vector<null_order>,rmm::mr::device_memory_resource*)
+ *
+ * @tparam stable Whether to use stable sort
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <sort_method method>
+std::unique_ptr<column> sorted_order(table_view input,
+                                     std::vector<order> const& column_order,
+                                     std::vector<null_order> const& null_precedence,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return cudf::make_numeric_column(
+      data_type(type_to_id<size_type>()), 0, mask_state::UNALLOCATED, stream, mr);
+  }
+
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+  }
+
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null_precedence size.");
+  }
+
+  // fast-path for single column sort
+  if (input.num_columns() == 1 and not cudf::is_nested(input.column(0).type())) {
+    auto const single_col = input.column(0);
+    auto const col_order  = column_order.empty() ? order::ASCENDING : column_order.front();
+    auto const null_prec  = null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
+    return sorted_order<method>(single_col, col_order, null_prec, stream, mr);
+  }
+
+  // keys of fixed-width and strings columns are radix sorted by their byte-comparable encodings,
+  // which orders the rows stably for both methods
+  if (is_normalized_sort_supported(input)) {
+    return normalized_sorted_order(input, column_order, null_precedence, stream, mr);
+  }
+
+  return sorted_order<method>(input,
+                              cudf::experimental::row::lexicographic::preprocessed_table::create(
+                                input, column_order, null_precedence, stream),
+                              stream,
+                              mr);
+}
+
 }  // namespace detail
 }  // namespace cudf
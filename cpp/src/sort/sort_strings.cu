@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sort_strings.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_radix_sort.cuh>
+#include <cuda/functional>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using prefix_word = uint64_t;
+
+/// Number of bytes of a string in a word, whose last byte is the number of remaining bytes
+constexpr size_type word_string_bytes = sizeof(prefix_word) - 1;
+
+/// Number of radix passes after which the remaining ties are sorted by comparing the strings
+constexpr int max_radix_passes = 8;
+
+/**
+ * @brief Encodes the bytes of a string from `depth` into a word ordered like the strings.
+ *
+ * The last byte of the word is the number of remaining bytes of the string, up to
+ * `word_string_bytes + 1`: it orders a string before the longer strings it is a prefix of, and
+ * marks the strings whose ties need another pass.
+ */
+struct prefix_word_fn {
+  column_device_view d_strings;
+  size_type depth;
+  bool ascending;
+
+  __device__ prefix_word operator()(size_type row) const
+  {
+    auto const str       = d_strings.element<string_view>(row);
+    auto const remaining = max(str.size_bytes() - depth, 0);
+    auto const bytes     = reinterpret_cast<uint8_t const*>(str.data()) + depth;
+    prefix_word word     = 0;
+    for (size_type b = 0; b < word_string_bytes; ++b) {
+      word = (word << 8) | (b < remaining ? bytes[b] : 0);
+    }
+    word = (word << 8) | static_cast<prefix_word>(min(remaining, word_string_bytes + 1));
+    return ascending ? word : ~word;
+  }
+};
+
+/**
+ * @brief Checks if two consecutive strings of a pass have the same run and word.
+ */
+struct same_run_fn {
+  size_type const* labels;
+  prefix_word const* words;
+
+  __device__ bool operator()(size_type i) const
+  {
+    return labels[i - 1] == labels[i] and words[i - 1] == words[i];
+  }
+};
+
+/**
+ * @brief Checks if a string of a pass ties with a neighbor and has bytes after its word.
+ */
+struct is_tied_fn {
+  same_run_fn same_run;
+  size_type num_strings;
+  bool ascending;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const word      = ascending ? same_run.words[i] : ~same_run.words[i];
+    auto const remaining = static_cast<size_type>(word & 0xff);
+    return remaining > word_string_bytes and
+           ((i > 0 and same_run(i)) or (i + 1 < num_strings and same_run(i + 1)));
+  }
+};
+
+/**
+ * @brief Orders tied strings by their run, then by comparing them.
+ */
+struct tied_string_less_fn {
+  column_device_view d_strings;
+  size_type const* labels;
+  size_type const* rows;
+  bool ascending;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (labels[lhs] != labels[rhs]) { return labels[lhs] < labels[rhs]; }
+    auto const lhs_str = d_strings.element<string_view>(rows[lhs]);
+    auto const rhs_str = d_strings.element<string_view>(rows[rhs]);
+    return ascending ? lhs_str < rhs_str : rhs_str < lhs_str;
+  }
+};
+
+struct is_valid_row_fn {
+  column_device_view d_strings;
+  bool valid;
+
+  __device__ bool operator()(size_type row) const
+  {
+    return d_strings.is_valid_nocheck(row) == valid;
+  }
+};
+
+/**
+ * @brief Stable radix sort of pairs, whose keys and values are sorted in place.
+ */
+template <typename Key>
+void radix_sort_pairs(device_span<Key> keys,
+                      device_span<size_type> values,
+                      rmm::cuda_stream_view stream)
+{
+  auto const num_items = static_cast<size_type>(keys.size());
+  rmm::device_uvector<Key> alternate_keys(num_items, stream);
+  rmm::device_uvector<size_type> alternate_values(num_items, stream);
+  cub::DoubleBuffer<Key> d_keys(keys.data(), alternate_keys.data());
+  cub::DoubleBuffer<size_type> d_values(values.data(), alternate_values.data());
+
+  std::size_t temp_storage_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(
+    nullptr, temp_storage_bytes, d_keys, d_values, num_items, 0, sizeof(Key) * 8, stream.value());
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+  cub::DeviceRadixSort::SortPairs(temp_storage.data(),
+                                  temp_storage_bytes,
+                                  d_keys,
+                                  d_values,
+                                  num_items,
+                                  0,
+                                  sizeof(Key) * 8,
+                                  stream.value());
+  if (d_keys.Current() != keys.data()) {
+    thrust::copy(rmm::exec_policy_nosync(stream),
+                 alternate_keys.begin(),
+                 alternate_keys.end(),
+                 keys.begin());
+  }
+  if (d_values.Current() != values.data()) {
+    thrust::copy(rmm::exec_policy_nosync(stream),
+                 alternate_values.begin(),
+                 alternate_values.end(),
+                 values.begin());
+  }
+}
+
+/**
+ * @brief Sorts the rows of valid strings by passes of radix sorts over the runs of tied strings.
+ *
+ * Every pass sorts the strings of the runs of the previous pass by their run and by the word of
+ * their next bytes, and moves them back to the positions of their runs. The strings of equal
+ * words with more bytes form the runs of the next pass.
+ */
+void sort_valid_strings(column_device_view const& d_strings,
+                        device_span<size_type> rows,
+                        bool ascending,
+                        rmm::cuda_stream_view stream)
+{
+  auto const num_rows = static_cast<size_type>(rows.size());
+
+  // positions in `rows` of the strings of the pass, and the run each of them belongs to
+  rmm::device_uvector<size_type> positions(num_rows, stream);
+  rmm::device_uvector<size_type> labels(num_rows, stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), positions.begin(), positions.end(), 0);
+  thrust::fill(rmm::exec_policy_nosync(stream), labels.begin(), labels.end(), 0);
+
+  for (int pass = 0; not positions.is_empty(); ++pass) {
+    auto const num_strings = static_cast<size_type>(positions.size());
+    rmm::device_uvector<size_type> pass_rows(num_strings, stream);
+    thrust::gather(rmm::exec_policy_nosync(stream),
+                   positions.begin(),
+                   positions.end(),
+                   rows.begin(),
+                   pass_rows.begin());
+    rmm::device_uvector<size_type> pass_order(num_strings, stream);
+    thrust::sequence(rmm::exec_policy_nosync(stream), pass_order.begin(), pass_order.end(), 0);
+    // the runs are contiguous, so the sorted strings are moved back to the same positions
+    auto const scatter_sorted_rows = [&] {
+      thrust::scatter(rmm::exec_policy_nosync(stream),
+                      thrust::make_permutation_iterator(pass_rows.begin(), pass_order.begin()),
+                      thrust::make_permutation_iterator(pass_rows.begin(), pass_order.end()),
+                      positions.begin(),
+                      rows.begin());
+    };
+
+    if (pass == max_radix_passes) {
+      // the runs of strings with a long common prefix are left to the comparisons
+      thrust::stable_sort(
+        rmm::exec_policy_nosync(stream),
+        pass_order.begin(),
+        pass_order.end(),
+        tied_string_less_fn{d_strings, labels.data(), pass_rows.data(), ascending});
+      scatter_sorted_rows();
+      return;
+    }
+
+    rmm::device_uvector<prefix_word> words(num_strings, stream);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      pass_rows.begin(),
+                      pass_rows.end(),
+                      words.begin(),
+                      prefix_word_fn{d_strings, pass * word_string_bytes, ascending});
+    rmm::device_uvector<prefix_word> sorted_words(words, stream);
+    radix_sort_pairs<prefix_word>(sorted_words, pass_order, stream);
+    if (pass > 0) {
+      // the stable sort by run keeps the strings of a run ordered by their words
+      rmm::device_uvector<size_type> sorted_labels(num_strings, stream);
+      thrust::gather(rmm::exec_policy_nosync(stream),
+                     pass_order.begin(),
+                     pass_order.end(),
+                     labels.begin(),
+                     sorted_labels.begin());
+      radix_sort_pairs<size_type>(sorted_labels, pass_order, stream);
+      labels = std::move(sorted_labels);
+      thrust::gather(rmm::exec_policy_nosync(stream),
+                     pass_order.begin(),
+                     pass_order.end(),
+                     words.begin(),
+                     sorted_words.begin());
+    }
+    scatter_sorted_rows();
+
+    // label the runs of equal words, and select the tied strings for the next pass
+    auto const same_run = same_run_fn{labels.data(), sorted_words.data()};
+    rmm::device_uvector<size_type> run_labels(num_strings, stream);
+    thrust::transform_inclusive_scan(
+      rmm::exec_policy_nosync(stream),
+      thrust::counting_iterator<size_type>(0),
+      thrust::counting_iterator<size_type>(num_strings),
+      run_labels.begin(),
+      cuda::proclaim_return_type<size_type>(
+        [same_run] __device__(size_type i) { return i > 0 and same_run(i) ? 0 : 1; }),
+      thrust::plus<size_type>{});
+    auto const is_tied = is_tied_fn{same_run, num_strings, ascending};
+    rmm::device_uvector<size_type> tied_positions(num_strings, stream);
+    rmm::device_uvector<size_type> tied_labels(num_strings, stream);
+    auto const tied_end = thrust::copy_if(rmm::exec_policy_nosync(stream),
+                                          positions.begin(),
+                                          positions.end(),
+                                          thrust::counting_iterator<size_type>(0),
+                                          tied_positions.begin(),
+                                          is_tied);
+    thrust::copy_if(rmm::exec_policy_nosync(stream),
+                    run_labels.begin(),
+                    run_labels.end(),
+                    thrust::counting_iterator<size_type>(0),
+                    tied_labels.begin(),
+                    is_tied);
+    auto const num_tied = thrust::distance(tied_positions.begin(), tied_end);
+    tied_positions.resize(num_tied, stream);
+    tied_labels.resize(num_tied, stream);
+    positions = std::move(tied_positions);
+    labels    = std::move(tied_labels);
+  }
+}
+
+}  // namespace
+
+void sorted_order_strings(column_view const& input,
+                          mutable_column_view& indices,
+                          bool ascending,
+                          null_order null_precedence,
+                          rmm::cuda_stream_view stream)
+{
+  auto const d_strings = column_device_view::create(input, stream);
+  auto valid_begin     = indices.begin<size_type>();
+  auto valid_end       = indices.end<size_type>();
+  if (input.has_nulls()) {
+    // nulls are smaller than the valid strings for null_order::BEFORE
+    if ((null_precedence == null_order::BEFORE) == ascending) {
+      valid_begin = thrust::stable_partition(
+        rmm::exec_policy(stream), valid_begin, valid_end, is_valid_row_fn{*d_strings, false});
+    } else {
+      valid_end = thrust::stable_partition(
+        rmm::exec_policy(stream), valid_begin, valid_end, is_valid_row_fn{*d_strings, true});
+    }
+  }
+  sort_valid_strings(
+    *d_strings,
+    device_span<size_type>(valid_begin, static_cast<std::size_t>(valid_end - valid_begin)),
+    ascending,
+    stream);
+}
+
+}  // namespace detail
+}  // namespace cudf
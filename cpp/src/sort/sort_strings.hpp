@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Sorts the indices of a strings column by most significant digit radix sorts of the
+ * bytes of the strings.
+ *
+ * The strings are radix sorted by a word of their first bytes, and only the runs of strings with
+ * equal words that are longer than these bytes are sorted again by their next bytes, until no
+ * such run is left. The sort is stable.
+ *
+ * @param input Strings column to sort
+ * @param indices The indices of the rows of `input`, in their order before the sort
+ * @param ascending True if sort order is ascending
+ * @param null_precedence How null rows are to be ordered
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void sorted_order_strings(column_view const& input,
+                          mutable_column_view& indices,
+                          bool ascending,
+                          null_order null_precedence,
+                          rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
@@ -38,6 +38,15 @@ std::unique_ptr<column> stable_sorted_order(table_view const& input,
   return sorted_order<sort_method::STABLE>(input, column_order, null_precedence, stream, mr);
 }
 
+std::unique_ptr<column> stable_sorted_order(
+  table_view const& input,
+  std::shared_ptr<cudf::experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return sorted_order<sort_method::STABLE>(input, std::move(preprocessed_input), stream, mr);
+}
+
 std::unique_ptr<table> stable_sort(table_view const& input,
                                    std::vector<order> const& column_order,
                                    std::vector<null_order> const& null_precedence,
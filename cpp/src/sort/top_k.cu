@@ -0,0 +1,592 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "normalized_keys.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/swap.h>
+#include <thrust/transform.h>
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Largest `k` of the per-thread heaps, a larger `k` sorts all the non-null rows
+constexpr size_type max_heap_k = 64;
+
+/// Number of rows of a segment scanned by each thread of the heap pass
+constexpr size_type rows_per_chunk = 1024;
+
+/**
+ * @brief Less comparator ordering NaN after all the other values, like `sorted_order`.
+ */
+template <typename T>
+struct nan_last_less {
+  __device__ bool operator()(T const& lhs, T const& rhs) const
+  {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (isnan(lhs)) { return false; }
+      if (isnan(rhs)) { return true; }
+    }
+    return lhs < rhs;
+  }
+};
+
+/**
+ * @brief Keeps the best `k` rows of each chunk of `rows_per_chunk` rows of a segment.
+ *
+ * The rows are kept in a binary heap whose root is the worst kept row. Ties between equal values
+ * keep the lowest rows. Each chunk writes its rows to its `k` slots, and `-1` to the unused slots.
+ */
+template <typename T>
+struct chunk_top_k_fn {
+  column_device_view values;
+  size_type const* segment_offsets;
+  size_type const* chunk_offsets;  ///< Index of the first chunk of each segment
+  size_type num_segments;
+  size_type k;
+  bool descending;
+  size_type* slots;
+
+  __device__ bool is_better(size_type lhs, size_type rhs) const
+  {
+    auto const lhs_value = values.element<T>(lhs);
+    auto const rhs_value = values.element<T>(rhs);
+    auto const less      = nan_last_less<T>{};
+    if (less(lhs_value, rhs_value)) { return not descending; }
+    if (less(rhs_value, lhs_value)) { return descending; }
+    return lhs < rhs;
+  }
+
+  __device__ void operator()(size_type chunk) const
+  {
+    auto const segment = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, chunk_offsets, chunk_offsets + num_segments + 1, chunk) -
+      chunk_offsets - 1);
+    auto const begin =
+      segment_offsets[segment] + (chunk - chunk_offsets[segment]) * rows_per_chunk;
+    auto const end = min(begin + rows_per_chunk, segment_offsets[segment + 1]);
+
+    size_type heap[max_heap_k];
+    size_type size = 0;
+    for (auto row = begin; row < end; ++row) {
+      if (values.is_null(row)) { continue; }
+      if (size < k) {
+        auto i  = size++;
+        heap[i] = row;
+        while (i > 0 and is_better(heap[(i - 1) / 2], heap[i])) {
+          thrust::swap(heap[(i - 1) / 2], heap[i]);
+          i = (i - 1) / 2;
+        }
+      } else if (is_better(row, heap[0])) {
+        heap[0] = row;
+        size_type i = 0;
+        while (true) {
+          auto worst       = i;
+          auto const left  = 2 * i + 1;
+          auto const right = 2 * i + 2;
+          if (left < size and is_better(heap[worst], heap[left])) { worst = left; }
+          if (right < size and is_better(heap[worst], heap[right])) { worst = right; }
+          if (worst == i) { break; }
+          thrust::swap(heap[worst], heap[i]);
+          i = worst;
+        }
+      }
+    }
+
+    auto const chunk_slots = slots + static_cast<int64_t>(chunk) * k;
+    for (size_type i = 0; i < k; ++i) {
+      chunk_slots[i] = i < size ? heap[i] : -1;
+    }
+  }
+};
+
+rmm::device_uvector<size_type> non_null_rows(column_view const& values,
+                                             rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> rows(values.size() - values.null_count(), stream);
+  if (not values.has_nulls()) {
+    thrust::sequence(rmm::exec_policy_nosync(stream), rows.begin(), rows.end());
+    return rows;
+  }
+  thrust::copy_if(rmm::exec_policy_nosync(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(values.size()),
+                  rows.begin(),
+                  [null_mask = values.null_mask(), offset = values.offset()] __device__(
+                    size_type row) { return bit_is_set(null_mask, offset + row); });
+  return rows;
+}
+
+/**
+ * @brief Returns the rows that may be among the `k` first rows of their segment.
+ */
+struct top_k_candidates_fn {
+  template <typename T>
+  static constexpr bool is_heap_supported()
+  {
+    return cudf::is_fixed_width<T>() and cudf::is_relationally_comparable<T, T>();
+  }
+
+  template <typename T, CUDF_ENABLE_IF(is_heap_supported<T>())>
+  rmm::device_uvector<size_type> operator()(column_view const& values,
+                                            device_span<size_type const> segment_offsets,
+                                            size_type k,
+                                            order sort_order,
+                                            rmm::cuda_stream_view stream) const
+  {
+    if (k > max_heap_k) { return non_null_rows(values, stream); }
+
+    auto const num_segments = static_cast<size_type>(segment_offsets.size()) - 1;
+    rmm::device_uvector<size_type> chunk_offsets(segment_offsets.size(), stream);
+    thrust::transform(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_segments + 1),
+      chunk_offsets.begin(),
+      cuda::proclaim_return_type<size_type>(
+        [offsets = segment_offsets.begin(), num_segments] __device__(size_type segment) {
+          if (segment == num_segments) { return size_type{0}; }
+          auto const num_rows = offsets[segment + 1] - offsets[segment];
+          return cudf::util::div_rounding_up_unsafe(num_rows, rows_per_chunk);
+        }));
+    thrust::exclusive_scan(rmm::exec_policy_nosync(stream),
+                           chunk_offsets.begin(),
+                           chunk_offsets.end(),
+                           chunk_offsets.begin());
+    auto const num_chunks = chunk_offsets.back_element(stream);
+
+    rmm::device_uvector<size_type> slots(static_cast<std::size_t>(num_chunks) * k, stream);
+    auto const d_values = column_device_view::create(values, stream);
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_chunks,
+                       chunk_top_k_fn<T>{*d_values,
+                                         segment_offsets.data(),
+                                         chunk_offsets.data(),
+                                         num_segments,
+                                         k,
+                                         sort_order == order::DESCENDING,
+                                         slots.data()});
+
+    rmm::device_uvector<size_type> candidates(slots.size(), stream);
+    auto const candidates_end =
+      thrust::copy_if(rmm::exec_policy_nosync(stream),
+                      slots.begin(),
+                      slots.end(),
+                      candidates.begin(),
+                      cuda::proclaim_return_type<bool>(
+                        [] __device__(size_type row) { return row >= 0; }));
+    candidates.resize(thrust::distance(candidates.begin(), candidates_end), stream);
+    return candidates;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not is_heap_supported<T>())>
+  rmm::device_uvector<size_type> operator()(column_view const& values,
+                                            device_span<size_type const>,
+                                            size_type,
+                                            order,
+                                            rmm::cuda_stream_view stream) const
+  {
+    return non_null_rows(values, stream);
+  }
+};
+
+/**
+ * @brief Indicates whether a row of the sorted candidates is among the `k` first of its segment.
+ */
+struct is_top_k_fn {
+  size_type const* sorted_labels;
+  size_type k;
+
+  __device__ bool operator()(size_type i) const
+  {
+    return i < k or sorted_labels[i - k] != sorted_labels[i];
+  }
+};
+
+/// Number of bits of the digits of the radix select
+constexpr int radix_bits = 8;
+
+/// Number of distinct digits of the radix select
+constexpr int radix_bins = 1 << radix_bits;
+
+/// Number of bits of a normalized key word
+constexpr int key_word_bits = sizeof(key_word) * 8;
+
+/// Number of candidates beyond `k` below which the radix select stops refining the threshold
+constexpr size_type max_extra_candidates = 1024;
+
+/**
+ * @brief Counts the digits at `shift` of the words whose bits above the digit equal `prefix`.
+ */
+CUDF_KERNEL void digit_histogram_kernel(key_word const* words,
+                                        size_type num_rows,
+                                        key_word prefix,
+                                        int shift,
+                                        size_type* histogram)
+{
+  __shared__ size_type block_histogram[radix_bins];
+  for (auto i = threadIdx.x; i < radix_bins; i += blockDim.x) {
+    block_histogram[i] = 0;
+  }
+  __syncthreads();
+
+  auto const high_shift = shift + radix_bits;
+  auto const stride     = cudf::detail::grid_1d::grid_stride();
+  for (auto idx = cudf::detail::grid_1d::global_thread_id(); idx < num_rows; idx += stride) {
+    auto const word = words[idx];
+    if (high_shift == key_word_bits or (word >> high_shift) == prefix) {
+      atomicAdd(&block_histogram[(word >> shift) & (radix_bins - 1)], 1);
+    }
+  }
+  __syncthreads();
+
+  for (auto i = threadIdx.x; i < radix_bins; i += blockDim.x) {
+    if (block_histogram[i] != 0) { atomicAdd(&histogram[i], block_histogram[i]); }
+  }
+}
+
+/**
+ * @brief Finds the leading bits of the `k`-th smallest word by a most significant digit radix
+ * select.
+ *
+ * The select stops once few words beyond the `k` smallest ones share the selected leading bits.
+ *
+ * @return The selected leading bits, and the number of trailing bits that were not selected
+ */
+std::pair<key_word, int> select_threshold(device_span<key_word const> words,
+                                          size_type k,
+                                          rmm::cuda_stream_view stream)
+{
+  auto const num_rows = static_cast<size_type>(words.size());
+  rmm::device_uvector<size_type> histogram(radix_bins, stream);
+  cudf::detail::grid_1d const grid{num_rows, 256};
+
+  key_word prefix     = 0;
+  int shift           = key_word_bits;
+  size_type remaining = k;  // number of words to select among the words of the prefix
+  while (shift > 0) {
+    shift -= radix_bits;
+    thrust::fill(rmm::exec_policy_nosync(stream), histogram.begin(), histogram.end(), 0);
+    digit_histogram_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      words.data(), num_rows, prefix, shift, histogram.data());
+    auto const counts = cudf::detail::make_std_vector_sync(histogram, stream);
+
+    int digit = 0;
+    while (counts[digit] < remaining) {
+      remaining -= counts[digit++];
+    }
+    prefix = (prefix << radix_bits) | static_cast<key_word>(digit);
+    if (counts[digit] - remaining <= max_extra_candidates) { break; }
+  }
+  return {prefix, shift};
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> segmented_top_k_order(
+  column_view const& values,
+  device_span<size_type const> segment_offsets,
+  device_span<size_type const> segment_labels,
+  size_type k,
+  order sort_order,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative", std::invalid_argument);
+  CUDF_EXPECTS(not segment_offsets.empty(), "The segment offsets must not be empty");
+  auto const num_segments = static_cast<size_type>(segment_offsets.size()) - 1;
+  auto const temp_mr      = rmm::mr::get_current_device_resource();
+
+  auto candidates = rmm::device_uvector<size_type>(0, stream);
+  if (k > 0) {
+    candidates = type_dispatcher(
+      values.type(), top_k_candidates_fn{}, values, segment_offsets, k, sort_order, stream);
+  }
+  auto const num_candidates = static_cast<size_type>(candidates.size());
+
+  // Only the candidates are sorted by segment, then by value, then by row
+  rmm::device_uvector<size_type> candidate_labels(num_candidates, stream);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 candidates.begin(),
+                 candidates.end(),
+                 segment_labels.begin(),
+                 candidate_labels.begin());
+  auto const candidate_values = cudf::detail::gather(table_view{{values}},
+                                                     candidates,
+                                                     out_of_bounds_policy::DONT_CHECK,
+                                                     negative_index_policy::NOT_ALLOWED,
+                                                     stream,
+                                                     temp_mr);
+  auto const index_type = data_type{type_to_id<size_type>()};
+  auto const labels_view =
+    column_view{index_type, num_candidates, candidate_labels.data(), nullptr, 0};
+  auto const rows_view = column_view{index_type, num_candidates, candidates.data(), nullptr, 0};
+  auto const sorted_candidates = cudf::detail::sorted_order(
+    table_view{{labels_view, candidate_values->view().column(0), rows_view}},
+    {order::ASCENDING, sort_order, order::ASCENDING},
+    {},
+    stream,
+    temp_mr);
+  auto const d_sorted_candidates = sorted_candidates->view().begin<size_type>();
+
+  rmm::device_uvector<size_type> sorted_labels(num_candidates, stream);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 d_sorted_candidates,
+                 d_sorted_candidates + num_candidates,
+                 candidate_labels.begin(),
+                 sorted_labels.begin());
+
+  // Keep the `k` first candidates of each segment
+  auto const ranked_rows =
+    thrust::make_permutation_iterator(candidates.begin(), d_sorted_candidates);
+
+  auto const is_top_k = is_top_k_fn{sorted_labels.data(), k};
+  rmm::device_uvector<size_type> indices(num_candidates, stream, mr);
+  auto const indices_end = thrust::copy_if(rmm::exec_policy_nosync(stream),
+                                           ranked_rows,
+                                           ranked_rows + num_candidates,
+                                           thrust::make_counting_iterator<size_type>(0),
+                                           indices.begin(),
+                                           is_top_k);
+  indices.resize(thrust::distance(indices.begin(), indices_end), stream);
+
+  rmm::device_uvector<size_type> kept_labels(indices.size(), stream);
+  thrust::copy_if(rmm::exec_policy_nosync(stream),
+                  sorted_labels.begin(),
+                  sorted_labels.end(),
+                  thrust::make_counting_iterator<size_type>(0),
+                  kept_labels.begin(),
+                  is_top_k);
+
+  auto offsets = make_numeric_column(
+    index_type, num_segments + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      kept_labels.begin(),
+                      kept_labels.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_segments + 1),
+                      offsets->mutable_view().begin<size_type>());
+
+  return {std::make_unique<column>(std::move(indices), rmm::device_buffer{}, 0),
+          std::move(offsets)};
+}
+
+std::unique_ptr<column> top_k_order(column_view const& col,
+                                    size_type k,
+                                    order sort_order,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const segment_offsets = cudf::detail::make_device_uvector_async(
+    std::vector<size_type>{0, col.size()}, stream, rmm::mr::get_current_device_resource());
+  rmm::device_uvector<size_type> segment_labels(col.size(), stream);
+  thrust::fill(rmm::exec_policy_nosync(stream), segment_labels.begin(), segment_labels.end(), 0);
+  return std::move(
+    segmented_top_k_order(col, segment_offsets, segment_labels, k, sort_order, stream, mr).first);
+}
+
+std::unique_ptr<column> top_k(column_view const& col,
+                              size_type k,
+                              order sort_order,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto const indices =
+    top_k_order(col, k, sort_order, stream, rmm::mr::get_current_device_resource());
+  return std::move(cudf::detail::gather(table_view{{col}},
+                                        indices->view(),
+                                        out_of_bounds_policy::DONT_CHECK,
+                                        negative_index_policy::NOT_ALLOWED,
+                                        stream,
+                                        mr)
+                     ->release()
+                     .front());
+}
+
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative", std::invalid_argument);
+  auto const num_columns = static_cast<std::size_t>(keys.num_columns());
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == num_columns,
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == num_columns,
+               "Mismatch between number of columns and null_precedence size.");
+  auto const num_rows = keys.num_rows();
+  auto const temp_mr  = rmm::mr::get_current_device_resource();
+
+  if (k >= num_rows) {
+    return cudf::detail::stable_sorted_order(keys, column_order, null_precedence, stream, mr);
+  }
+  if (k == 0 or keys.num_columns() == 0) {
+    return make_numeric_column(
+      data_type{type_to_id<size_type>()}, 0, mask_state::UNALLOCATED, stream, mr);
+  }
+  if (not is_normalized_sort_supported(keys)) {
+    auto const sorted =
+      cudf::detail::stable_sorted_order(keys, column_order, null_precedence, stream, temp_mr);
+    return std::make_unique<column>(
+      cudf::detail::slice(sorted->view(), 0, k, stream), stream, mr);
+  }
+
+  // Only the rows whose key starts like the key of the `k`-th row, or lower, can be selected
+  rmm::device_uvector<size_type> candidates(num_rows, stream);
+  {
+    auto const normalized    = encode_normalized_keys(keys, column_order, null_precedence, stream);
+    auto const leading_words = device_span<key_word const>(normalized.words.data(), num_rows);
+
+    auto const [threshold, shift] = select_threshold(leading_words, k, stream);
+    auto const candidates_end     = thrust::copy_if(
+      rmm::exec_policy_nosync(stream),
+      thrust::counting_iterator<size_type>(0),
+      thrust::counting_iterator<size_type>(num_rows),
+      candidates.begin(),
+      [words = leading_words.data(), threshold = threshold, shift = shift] __device__(
+        size_type row) { return (words[row] >> shift) <= threshold; });
+    candidates.resize(thrust::distance(candidates.begin(), candidates_end), stream);
+  }
+
+  // The candidates are in the order of the rows, so ties are ranked like a stable sort of all rows
+  auto const candidate_keys = cudf::detail::gather(keys,
+                                                   candidates,
+                                                   out_of_bounds_policy::DONT_CHECK,
+                                                   negative_index_policy::NOT_ALLOWED,
+                                                   stream,
+                                                   temp_mr);
+  auto const sorted_candidates = cudf::detail::stable_sorted_order(
+    candidate_keys->view(), column_order, null_precedence, stream, temp_mr);
+  auto const d_sorted_candidates = sorted_candidates->view().begin<size_type>();
+
+  rmm::device_uvector<size_type> indices(k, stream, mr);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 d_sorted_candidates,
+                 d_sorted_candidates + k,
+                 candidates.begin(),
+                 indices.begin());
+  return std::make_unique<column>(std::move(indices), rmm::device_buffer{}, 0);
+}
+
+std::unique_ptr<table> top_k_by_key(table_view const& values,
+                                    table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows for values and keys");
+  auto const indices = top_k_order(
+    keys, k, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  return cudf::detail::gather(values,
+                              indices->view(),
+                              out_of_bounds_policy::DONT_CHECK,
+                              negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k_order(column_view const& col,
+                                    size_type k,
+                                    order sort_order,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k_order(col, k, sort_order, stream, mr);
+}
+
+std::unique_ptr<column> top_k(column_view const& col,
+                              size_type k,
+                              order sort_order,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(col, k, sort_order, stream, mr);
+}
+
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k_order(keys, k, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<table> top_k_by_key(table_view const& values,
+                                    table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k_by_key(values, keys, k, column_order, null_precedence, stream, mr);
+}
+
+}  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/instrumentation.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -83,6 +84,36 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   }
 }
 
+/*
+ * Filters a table_view using a column_view of boolean values as a mask, leaving the output
+ * size on the device.
+ */
+deferred_table apply_boolean_mask_deferred(table_view const& input,
+                                           column_view const& boolean_mask,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  // an empty mask filters out every row, as in apply_boolean_mask
+  auto const empty_input = boolean_mask.is_empty() ? empty_like(input) : nullptr;
+  auto const filtered    = boolean_mask.is_empty() ? empty_input->view() : input;
+
+  CUDF_EXPECTS(boolean_mask.is_empty() || boolean_mask.type().id() == type_id::BOOL8,
+               "Mask must be Boolean type");
+  // zero-size inputs are OK, but otherwise input size must match mask size
+  CUDF_EXPECTS(filtered.num_rows() == 0 || filtered.num_rows() == boolean_mask.size(),
+               "Column size mismatch");
+
+  auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
+
+  if (boolean_mask.has_nulls()) {
+    return detail::copy_if_deferred(
+      filtered, boolean_mask_filter<true>{*device_boolean_mask}, stream, mr);
+  } else {
+    return detail::copy_if_deferred(
+      filtered, boolean_mask_filter<false>{*device_boolean_mask}, stream, mr);
+  }
+}
+
 }  // namespace detail
 
 /*
@@ -93,6 +124,17 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
+  CUDF_API_EVENT(cudf::get_default_stream(), input);
   return detail::apply_boolean_mask(input, boolean_mask, cudf::get_default_stream(), mr);
 }
+
+deferred_table apply_boolean_mask_deferred(table_view const& input,
+                                           column_view const& boolean_mask,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_API_EVENT(stream, input);
+  return detail::apply_boolean_mask_deferred(input, boolean_mask, stream, mr);
+}
 }  // namespace cudf
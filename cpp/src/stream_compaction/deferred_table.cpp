@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Returns `buffer`, or a copy of its first `size` bytes if they are less than half of it.
+ */
+rmm::device_buffer shrink(rmm::device_buffer&& buffer,
+                          std::size_t size,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr)
+{
+  if (2 * size > buffer.size()) { return std::move(buffer); }
+  // orders the deallocation of `buffer` after the copy
+  buffer.set_stream(stream);
+  return rmm::device_buffer{buffer.data(), size, stream, mr};
+}
+
+}  // namespace
+
+deferred_table::deferred_table(std::vector<std::unique_ptr<column>>&& columns,
+                               rmm::device_uvector<size_type>&& counts)
+  : _columns{std::move(columns)}, _counts{std::move(counts)}
+{
+  CUDF_EXPECTS(_counts.size() == _columns.size() + 1,
+               "A count is needed for the number of rows and for each column",
+               std::invalid_argument);
+  CUDF_EXPECTS(std::all_of(_columns.begin(),
+                           _columns.end(),
+                           [&](auto const& col) {
+                             return is_fixed_width(col->type()) && col->num_children() == 0 &&
+                                    col->size() == _columns.front()->size();
+                           }),
+               "Columns must be fixed-width and of the same size",
+               std::invalid_argument);
+}
+
+table_view deferred_table::capacity_view() const
+{
+  std::vector<column_view> views;
+  std::transform(_columns.begin(), _columns.end(), std::back_inserter(views), [](auto const& col) {
+    return col->view();
+  });
+  return table_view{views};
+}
+
+std::unique_ptr<table> deferred_table::release(rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const counts   = cudf::detail::make_std_vector_sync(_counts, stream);
+  auto const num_rows = counts.front();
+
+  std::vector<std::unique_ptr<column>> columns;
+  for (std::size_t i = 0; i < _columns.size(); ++i) {
+    auto const type     = _columns[i]->type();
+    auto const nullable = _columns[i]->nullable();
+    auto contents       = _columns[i]->release();
+    auto const data_size = static_cast<std::size_t>(num_rows) * size_of(type);
+    auto data            = shrink(std::move(*contents.data), data_size, stream, mr);
+    auto null_mask       = nullable ? shrink(std::move(*contents.null_mask),
+                                       bitmask_allocation_size_bytes(num_rows),
+                                       stream,
+                                       mr)
+                                    : rmm::device_buffer{};
+    columns.push_back(std::make_unique<column>(
+      type, num_rows, std::move(data), std::move(null_mask), nullable ? counts[i + 1] : 0));
+  }
+  _columns.clear();
+  _counts = rmm::device_uvector<size_type>(0, stream);
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace cudf
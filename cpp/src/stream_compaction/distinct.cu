@@ -49,6 +49,27 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
   if (input.num_rows() == 0 or input.num_columns() == 0) {
     return rmm::device_uvector<size_type>(0, stream, mr);
   }
+  return distinct_indices(input,
+                          cudf::experimental::row::hash::preprocessed_table::create(input, stream),
+                          keep,
+                          nulls_equal,
+                          nans_equal,
+                          stream,
+                          mr);
+}
+
+rmm::device_uvector<size_type> distinct_indices(
+  table_view const& input,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> preprocessed_input,
+  duplicate_keep_option keep,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return rmm::device_uvector<size_type>(0, stream, mr);
+  }
 
   auto map = hash_map_type{compute_hash_table_size(input.num_rows()),
                            cuco::empty_key{-1},
@@ -56,8 +77,6 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
                            cudf::detail::cuco_allocator{stream},
                            stream.value()};
 
-  auto const preprocessed_input =
-    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
   auto const has_nulls          = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
   auto const has_nested_columns = cudf::detail::has_nested_columns(input);
 
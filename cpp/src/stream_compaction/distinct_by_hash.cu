@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "stream_compaction_common.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuco/static_set.cuh>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using probing_scheme_type = cuco::linear_probing<1, cuco::default_hash_function<uint64_t>>;
+
+/// Row hash never produced by `wide_row_hasher`, marking the empty slots of a hash set
+auto constexpr empty_row_hash = std::numeric_limits<uint64_t>::max();
+
+/**
+ * @brief Combines the 32-bit hashes of a row with two different seeds into a 64-bit hash.
+ */
+template <typename RowHasher>
+struct wide_row_hasher {
+  RowHasher low;
+  RowHasher high;
+
+  __device__ uint64_t operator()(size_type row) const noexcept
+  {
+    auto const hash = (static_cast<uint64_t>(high(row)) << 32) | static_cast<uint64_t>(low(row));
+    return hash == empty_row_hash ? hash - 1 : hash;
+  }
+};
+
+/**
+ * @brief Returns one UINT64 column of row hashes for each 64 bits of `width`.
+ *
+ * Each column is hashed with different seeds, so the columns together form a wider hash.
+ */
+std::vector<std::unique_ptr<column>> hash_rows(table_view const& input,
+                                               row_hash_width width,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto const preprocessed_input =
+    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
+  auto const has_nulls  = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
+  using hasher_type     = decltype(row_hasher.device_hasher(has_nulls));
+
+  auto const num_words = width == row_hash_width::BITS_64 ? 1u : 2u;
+  std::vector<std::unique_ptr<column>> hashes;
+  for (uint32_t word = 0; word < num_words; ++word) {
+    auto hash = make_numeric_column(
+      data_type{type_id::UINT64}, input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    auto const output = hash->mutable_view();
+    auto const low    = row_hasher.device_hasher(has_nulls, 2 * word);
+    auto const high   = row_hasher.device_hasher(has_nulls, 2 * word + 1);
+    auto const hasher = wide_row_hasher<hasher_type>{low, high};
+    thrust::tabulate(
+      rmm::exec_policy(stream), output.begin<uint64_t>(), output.end<uint64_t>(), hasher);
+    hashes.push_back(std::move(hash));
+  }
+  return hashes;
+}
+
+/**
+ * @brief Returns a view of the columns of `columns`.
+ */
+table_view view_of(std::vector<std::unique_ptr<column>> const& columns)
+{
+  std::vector<column_view> views(columns.size());
+  std::transform(
+    columns.begin(), columns.end(), views.begin(), [](auto const& col) { return col->view(); });
+  return table_view{views};
+}
+
+}  // namespace
+
+rmm::device_uvector<size_type> distinct_indices_by_hash(table_view const& input,
+                                                        duplicate_keep_option keep,
+                                                        row_hash_width width,
+                                                        bool verify,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return rmm::device_uvector<size_type>(0, stream, mr);
+  }
+
+  // the hash columns are flat and have no nulls, so comparing them is cheap at any input width
+  auto const hashes     = hash_rows(input, width, stream, rmm::mr::get_current_device_resource());
+  auto const hash_table = view_of(hashes);
+  auto indices =
+    distinct_indices(hash_table, keep, null_equality::EQUAL, nan_equality::ALL_EQUAL, stream, mr);
+  if (not verify) { return indices; }
+
+  // equal rows have equal hashes, so there are as many distinct hashes as distinct rows unless
+  // two distinct rows collide
+  auto const distinct_hashes = keep == duplicate_keep_option::KEEP_NONE
+                                 ? distinct_count(hash_table, null_equality::EQUAL, stream)
+                                 : static_cast<size_type>(indices.size());
+  if (distinct_hashes == distinct_count(input, null_equality::EQUAL, stream)) { return indices; }
+  return distinct_indices(input, keep, null_equality::EQUAL, nan_equality::ALL_EQUAL, stream, mr);
+}
+
+/**
+ * @brief Keeps the hashes of the distinct rows inserted into a `cudf::streaming_distinct`.
+ */
+class streaming_distinct {
+  using hash_set_type = cuco::static_set<uint64_t,
+                                         cuco::extent<std::size_t>,
+                                         cuda::thread_scope_device,
+                                         thrust::equal_to<uint64_t>,
+                                         probing_scheme_type,
+                                         cudf::detail::cuco_allocator,
+                                         cuco::storage<1>>;
+
+ public:
+  streaming_distinct(std::size_t expected_rows, rmm::cuda_stream_view stream)
+    : _set{make_set(expected_rows, stream)}
+  {
+  }
+
+  std::unique_ptr<column> insert(table_view const& batch,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+  {
+    std::vector<data_type> schema(batch.num_columns());
+    std::transform(
+      batch.begin(), batch.end(), schema.begin(), [](auto const& col) { return col.type(); });
+    if (_schema.empty()) { _schema = schema; }
+    CUDF_EXPECTS(
+      schema == _schema, "All batches must have the same column types", std::invalid_argument);
+    if (batch.num_rows() == 0 or batch.num_columns() == 0) {
+      return make_empty_column(type_to_id<size_type>());
+    }
+
+    auto const temp_mr      = rmm::mr::get_current_device_resource();
+    auto const hashes       = hash_rows(batch, row_hash_width::BITS_64, stream, temp_mr);
+    auto const batch_hashes = hashes.front()->view();
+
+    // the first of the equal rows of the batch, which is new unless its hash is in the set
+    auto const candidates = distinct_indices(table_view{{batch_hashes}},
+                                             duplicate_keep_option::KEEP_FIRST,
+                                             null_equality::EQUAL,
+                                             nan_equality::ALL_EQUAL,
+                                             stream,
+                                             temp_mr);
+    rmm::device_uvector<uint64_t> candidate_hashes(candidates.size(), stream);
+    thrust::gather(rmm::exec_policy(stream),
+                   candidates.begin(),
+                   candidates.end(),
+                   batch_hashes.begin<uint64_t>(),
+                   candidate_hashes.begin());
+
+    reserve(_size + candidates.size(), stream);
+    rmm::device_uvector<bool> seen(candidates.size(), stream);
+    _set->contains_async(
+      candidate_hashes.begin(), candidate_hashes.end(), seen.begin(), stream.value());
+
+    rmm::device_uvector<size_type> indices(candidates.size(), stream, mr);
+    auto const end = thrust::copy_if(rmm::exec_policy(stream),
+                                     candidates.begin(),
+                                     candidates.end(),
+                                     seen.begin(),
+                                     indices.begin(),
+                                     thrust::logical_not<bool>{});
+    indices.resize(std::distance(indices.begin(), end), stream);
+
+    _set->insert_async(candidate_hashes.begin(), candidate_hashes.end(), stream.value());
+    _size += indices.size();
+    return std::make_unique<column>(std::move(indices), rmm::device_buffer{}, 0);
+  }
+
+  [[nodiscard]] std::size_t size() const { return _size; }
+
+ private:
+  static std::unique_ptr<hash_set_type> make_set(std::size_t num_rows,
+                                                 rmm::cuda_stream_view stream)
+  {
+    auto const capacity = std::max<std::size_t>(
+      std::ceil(static_cast<double>(num_rows) / CUCO_DESIRED_LOAD_FACTOR), 1);
+    return std::make_unique<hash_set_type>(cuco::extent<std::size_t>{capacity},
+                                           cuco::empty_key<uint64_t>{empty_row_hash},
+                                           thrust::equal_to<uint64_t>{},
+                                           probing_scheme_type{},
+                                           cuco::thread_scope_device,
+                                           cuco::storage<1>{},
+                                           cudf::detail::cuco_allocator{stream},
+                                           stream.value());
+  }
+
+  /**
+   * @brief Grows the set, if needed, to hold `num_rows` hashes at the desired load factor.
+   */
+  void reserve(std::size_t num_rows, rmm::cuda_stream_view stream)
+  {
+    if (num_rows <= _set->capacity() * CUCO_DESIRED_LOAD_FACTOR) { return; }
+    rmm::device_uvector<uint64_t> keys(_size, stream);
+    // retrieve_all synchronizes the stream, so the old set is no longer in use once replaced
+    _set->retrieve_all(keys.begin(), stream.value());
+    // doubling the requested size amortizes the rebuilds over the inserted rows
+    auto set = make_set(2 * num_rows, stream);
+    set->insert_async(keys.begin(), keys.end(), stream.value());
+    _set = std::move(set);
+  }
+
+  std::unique_ptr<hash_set_type> _set;  ///< Hashes of the distinct rows inserted
+  std::size_t _size{0};                 ///< Number of distinct rows inserted
+  std::vector<data_type> _schema;       ///< Column types of the batches
+};
+
+}  // namespace detail
+
+std::unique_ptr<column> distinct_indices_by_hash(table_view const& input,
+                                                 duplicate_keep_option keep,
+                                                 row_hash_width width,
+                                                 bool verify,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto indices = detail::distinct_indices_by_hash(input, keep, width, verify, stream, mr);
+  return std::make_unique<column>(std::move(indices), rmm::device_buffer{}, 0);
+}
+
+streaming_distinct::streaming_distinct(std::size_t expected_rows, rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<detail::streaming_distinct>(expected_rows, stream)}
+{
+}
+
+streaming_distinct::~streaming_distinct() = default;
+
+std::unique_ptr<column> streaming_distinct::insert(table_view const& batch,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->insert(batch, stream, mr);
+}
+
+std::size_t streaming_distinct::size() const { return _impl->size(); }
+
+}  // namespace cudf
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <stdexcept>
+
+namespace cudf {
+
+selection_vector::selection_vector(rmm::device_uvector<size_type>&& indices,
+                                   size_type source_rows)
+  : _indices{std::move(indices)}, _source_rows{source_rows}
+{
+  CUDF_EXPECTS(source_rows >= 0, "Negative number of source rows", std::invalid_argument);
+}
+
+column_view selection_vector::gather_map() const
+{
+  return column_view{data_type{type_to_id<size_type>()}, size(), _indices.data(), nullptr, 0};
+}
+
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns true for the rows where the mask is true and, if it has nulls, valid.
+ */
+template <bool has_nulls>
+struct selected_row_fn {
+  column_device_view boolean_mask;
+
+  __device__ bool operator()(size_type row) const
+  {
+    return (!has_nulls || boolean_mask.is_valid_nocheck(row)) &&
+           boolean_mask.element<bool>(row);
+  }
+};
+
+template <typename Filter>
+selection_vector select_rows(size_type num_rows,
+                             Filter filter,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  // size the indices for every row, then shrink to the selected ones
+  rmm::device_uvector<size_type> indices(num_rows, stream, mr);
+  auto const end = thrust::copy_if(rmm::exec_policy(stream),
+                                   thrust::counting_iterator<size_type>(0),
+                                   thrust::counting_iterator<size_type>(num_rows),
+                                   indices.begin(),
+                                   filter);
+  indices.resize(std::distance(indices.begin(), end), stream);
+  indices.shrink_to_fit(stream);
+  return selection_vector{std::move(indices), num_rows};
+}
+
+}  // namespace
+
+selection_vector make_selection_vector(column_view const& boolean_mask,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+  auto const device_boolean_mask = column_device_view::create(boolean_mask, stream);
+  if (boolean_mask.has_nulls()) {
+    return select_rows(
+      boolean_mask.size(), selected_row_fn<true>{*device_boolean_mask}, stream, mr);
+  }
+  return select_rows(
+    boolean_mask.size(), selected_row_fn<false>{*device_boolean_mask}, stream, mr);
+}
+
+std::unique_ptr<table> materialize(table_view const& input,
+                                   selection_vector const& selection,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.num_rows() == selection.source_rows(),
+               "Table size does not match the selection",
+               std::invalid_argument);
+  // the indices are in bounds by construction
+  return detail::gather(input,
+                        selection.gather_map(),
+                        out_of_bounds_policy::DONT_CHECK,
+                        negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> to_source_rows(device_span<size_type const> rows,
+                                                               selection_vector const& selection,
+                                                               rmm::cuda_stream_view stream,
+                                                               rmm::mr::device_memory_resource* mr)
+{
+  auto result  = std::make_unique<rmm::device_uvector<size_type>>(rows.size(), stream, mr);
+  auto indices = selection.indices();
+  thrust::transform(rmm::exec_policy(stream),
+                    rows.begin(),
+                    rows.end(),
+                    result->begin(),
+                    [indices] __device__(size_type row) {
+                      return row >= 0 && row < static_cast<size_type>(indices.size())
+                               ? indices[row]
+                               : row;
+                    });
+  return result;
+}
+
+}  // namespace detail
+
+selection_vector make_selection_vector(column_view const& boolean_mask,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_selection_vector(boolean_mask, stream, mr);
+}
+
+std::unique_ptr<table> materialize(table_view const& input,
+                                   selection_vector const& selection,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::materialize(input, selection, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> to_source_rows(device_span<size_type const> rows,
+                                                               selection_vector const& selection,
+                                                               rmm::cuda_stream_view stream,
+                                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_source_rows(rows, selection, stream, mr);
+}
+
+}  // namespace cudf
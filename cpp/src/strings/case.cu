@@ -32,7 +32,6 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <cuda/atomic>
 #include <cuda/functional>
 
 namespace cudf {
@@ -44,7 +43,7 @@ namespace {
  * @brief Threshold to decide on using string or warp parallel functions.
  *
  * If the average byte length of a string in a column exceeds this value then
- * the warp-parallel function is used to compute the output sizes.
+ * the warp-parallel function is used to convert the strings.
  * Otherwise, a regular string-parallel function is used.
  *
  * This value was found using the strings_lengths benchmark results.
@@ -99,7 +98,7 @@ struct convert_char_fn {
   }
 
   // special function for converting ASCII-only characters
-  __device__ char process_ascii(char chr)
+  __device__ char process_ascii(char chr) const
   {
     return (case_flag & d_flags[chr]) ? static_cast<char>(d_case_table[chr]) : chr;
   }
@@ -138,43 +137,71 @@ struct upper_lower_fn {
 };
 
 /**
- * @brief Count output bytes in warp-parallel threads
+ * @brief Warp-parallel case conversion for longer strings
  *
- * This executes as one warp per string and just computes the output sizes.
+ * This executes as one warp per string. The string is processed in chunks of warp-size bytes
+ * where each lane converts the character starting at its byte. The output positions of the
+ * characters are found by a warp scan of their output sizes, and chunks of only ASCII
+ * characters are converted byte to byte without the scan.
+ *
+ * This is called twice. The first pass computes the output sizes into `d_offsets` and the
+ * second pass, with non-null `d_chars`, writes the output strings.
  */
-struct count_bytes_fn {
-  convert_char_fn converter;
-  column_device_view d_strings;
-  size_type* d_offsets;
-
-  __device__ void operator()(size_type idx) const
-  {
-    auto const str_idx  = idx / cudf::detail::warp_size;
-    auto const lane_idx = idx % cudf::detail::warp_size;
+CUDF_KERNEL void convert_case_warp_parallel_fn(convert_char_fn converter,
+                                               column_device_view const d_strings,
+                                               size_type* d_offsets,
+                                               char* d_chars)
+{
+  auto const idx = cudf::detail::grid_1d::global_thread_id();
+  if (idx >= (static_cast<thread_index_type>(d_strings.size()) * cudf::detail::warp_size)) {
+    return;
+  }
 
-    // initialize the output for the atomicAdd
-    if (lane_idx == 0) { d_offsets[str_idx] = 0; }
-    __syncwarp();
+  auto const str_idx  = static_cast<size_type>(idx / cudf::detail::warp_size);
+  auto const lane_idx = static_cast<size_type>(idx % cudf::detail::warp_size);
 
-    if (d_strings.is_null(str_idx)) { return; }
-    auto const d_str   = d_strings.element<string_view>(str_idx);
-    auto const str_ptr = d_str.data();
+  if (d_strings.is_null(str_idx)) {
+    if (!d_chars && lane_idx == 0) { d_offsets[str_idx] = 0; }
+    return;
+  }
+  auto const d_str      = d_strings.element<string_view>(str_idx);
+  auto const str_ptr    = d_str.data();
+  auto const d_output   = d_chars ? d_chars + d_offsets[str_idx] : nullptr;
+  auto const full_mask  = 0xffff'ffffu;
+  size_type output_size = 0;  // same in all lanes
+
+  for (size_type base = 0; base < d_str.size_bytes(); base += cudf::detail::warp_size) {
+    auto const pos      = base + lane_idx;
+    auto const in_range = pos < d_str.size_bytes();
+    auto const chr      = in_range ? str_ptr[pos] : char{0};
+
+    // ASCII characters convert to single ASCII characters
+    if (__all_sync(full_mask, static_cast<uint8_t>(chr) < 0x80)) {
+      if (d_output && in_range) { d_output[output_size + lane_idx] = converter.process_ascii(chr); }
+      output_size += min(cudf::detail::warp_size, d_str.size_bytes() - base);
+      continue;
+    }
 
+    char_utf8 u8   = 0;
     size_type size = 0;
-    for (auto i = lane_idx; i < d_str.size_bytes(); i += cudf::detail::warp_size) {
-      auto const chr = str_ptr[i];
-      if (is_utf8_continuation_char(chr)) { continue; }
-      char_utf8 u8 = 0;
-      to_char_utf8(str_ptr + i, u8);
-      size += converter.process_character(u8);
+    if (in_range && !is_utf8_continuation_char(chr)) {
+      to_char_utf8(str_ptr + pos, u8);
+      size = converter.process_character(u8);
     }
-    // this is every so slightly faster than using the cub::warp_reduce
-    if (size > 0) {
-      cuda::atomic_ref<size_type, cuda::thread_scope_block> ref{*(d_offsets + str_idx)};
-      ref.fetch_add(size, cuda::std::memory_order_relaxed);
+    // inclusive scan of the output sizes of the chunk
+    auto position = size;
+    for (size_type delta = 1; delta < cudf::detail::warp_size; delta *= 2) {
+      auto const prev = __shfl_up_sync(full_mask, position, delta);
+      if (lane_idx >= delta) { position += prev; }
     }
+    if (d_output && size > 0) {
+      converter.process_character(u8, d_output + output_size + position - size);
+    }
+    output_size += __shfl_sync(full_mask, position, cudf::detail::warp_size - 1);
   }
-};
+
+  if (!d_chars && lane_idx == 0) { d_offsets[str_idx] = output_size; }
+}
 
 /**
  * @brief Special functor for processing ASCII-only data
@@ -245,17 +272,18 @@ std::unique_ptr<column> convert_case(strings_column_view const& input,
   }
 
   // This will use a warp-parallel algorithm to compute the output sizes for each string
-  // and then uses the normal string parallel functor to build the output.
+  // and then again to build the output.
   auto offsets = make_numeric_column(
     data_type{type_to_id<size_type>()}, input.size() + 1, mask_state::UNALLOCATED, stream, mr);
   auto d_offsets = offsets->mutable_view().data<size_type>();
 
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, block_size};
+
   // first pass, compute output sizes
   // note: tried to use segmented-reduce approach instead here and it was consistently slower
-  count_bytes_fn counter{ccfn, *d_strings, d_offsets};
-  auto const count_itr = thrust::make_counting_iterator<size_type>(0);
-  thrust::for_each_n(
-    rmm::exec_policy(stream), count_itr, input.size() * cudf::detail::warp_size, counter);
+  convert_case_warp_parallel_fn<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+    ccfn, *d_strings, d_offsets, nullptr);
 
   // convert sizes to offsets
   auto const bytes =
@@ -266,9 +294,8 @@ std::unique_ptr<column> convert_case(strings_column_view const& input,
 
   rmm::device_uvector<char> chars(bytes, stream, mr);
   // second pass, write output
-  converter.d_offsets = d_offsets;
-  converter.d_chars   = chars.data();
-  thrust::for_each_n(rmm::exec_policy(stream), count_itr, input.size(), converter);
+  convert_case_warp_parallel_fn<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+    ccfn, *d_strings, d_offsets, chars.data());
 
   return make_strings_column(input.size(),
                              std::move(offsets),
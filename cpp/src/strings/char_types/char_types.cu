@@ -19,6 +19,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/char_types/char_types.hpp>
 #include <cudf/strings/detail/char_tables.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
@@ -81,6 +82,72 @@ struct char_types_fn {
     return type_matched && (check_count > 0);
   }
 };
+
+/**
+ * @brief Threshold to decide on using string or warp parallel functions.
+ *
+ * If the average byte length of a string in a column exceeds this value then
+ * the warp-parallel function is used to check the strings.
+ * Otherwise, a regular string-parallel function is used.
+ */
+constexpr size_type AVG_CHAR_BYTES_THRESHOLD = 64;
+
+/**
+ * @brief String per warp function for all_characters_of_type
+ *
+ * Each lane checks the character starting at its byte of a chunk of warp-size bytes,
+ * so the result matches `char_types_fn` while the string is read once by the whole warp.
+ * The warp stops at the first chunk having a checked character not matching `types`.
+ */
+CUDF_KERNEL void char_types_warp_parallel_fn(column_device_view const d_column,
+                                             character_flags_table_type const* d_flags,
+                                             string_character_types const types,
+                                             string_character_types const verify_types,
+                                             bool* d_results)
+{
+  auto const idx = cudf::detail::grid_1d::global_thread_id();
+  if (idx >= (static_cast<thread_index_type>(d_column.size()) * cudf::detail::warp_size)) {
+    return;
+  }
+
+  auto const str_idx  = static_cast<size_type>(idx / cudf::detail::warp_size);
+  auto const lane_idx = static_cast<size_type>(idx % cudf::detail::warp_size);
+
+  if (d_column.is_null(str_idx)) {
+    if (lane_idx == 0) { d_results[str_idx] = false; }
+    return;
+  }
+  auto const d_str     = d_column.element<string_view>(str_idx);
+  auto const str_ptr   = d_str.data();
+  auto const full_mask = 0xffff'ffffu;
+
+  bool type_matched = true;
+  bool checked      = false;  // same in all lanes
+  for (size_type base = 0; type_matched && (base < d_str.size_bytes());
+       base += cudf::detail::warp_size) {
+    auto const pos     = base + lane_idx;
+    auto const chr     = pos < d_str.size_bytes() ? static_cast<uint8_t>(str_ptr[pos]) : 0;
+    bool lane_checked  = false;
+    bool lane_mismatch = false;
+    if (pos < d_str.size_bytes() && !is_utf8_continuation_char(chr)) {
+      // ASCII characters are their own code points
+      auto code_point = static_cast<uint32_t>(chr);
+      if (chr > 0x7F) {
+        char_utf8 u8 = 0;
+        to_char_utf8(str_ptr + pos, u8);
+        code_point = utf8_to_codepoint(u8);
+      }
+      auto const flag = code_point <= 0x00'FFFF ? d_flags[code_point] : 0;
+      lane_checked    = (verify_types & flag) || (flag == 0 && verify_types == ALL_TYPES);
+      lane_mismatch   = lane_checked && ((types & flag) == 0);
+    }
+    checked      = __any_sync(full_mask, lane_checked) || checked;
+    type_matched = !__any_sync(full_mask, lane_mismatch);
+  }
+
+  if (lane_idx == 0) { d_results[str_idx] = type_matched && checked; }
+}
+
 }  // namespace
 
 std::unique_ptr<column> all_characters_of_type(strings_column_view const& input,
@@ -101,12 +168,24 @@ std::unique_ptr<column> all_characters_of_type(strings_column_view const& input,
   // get the static character types table
   auto d_flags = detail::get_character_flags_table();
 
+  auto const d_results = results->mutable_view().data<bool>();
+
   // set the output values by checking the character types for each string
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(input.size()),
-                    results->mutable_view().data<bool>(),
-                    char_types_fn{*d_strings, d_flags, types, verify_types});
+  if ((input.size() > input.null_count()) &&
+      ((input.chars_size(stream) / (input.size() - input.null_count())) >
+       AVG_CHAR_BYTES_THRESHOLD)) {
+    // warp-per-string runs faster for longer strings (but not shorter ones)
+    constexpr int block_size = 256;
+    cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, block_size};
+    char_types_warp_parallel_fn<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *d_strings, d_flags, types, verify_types, d_results);
+  } else {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      d_results,
+                      char_types_fn{*d_strings, d_flags, types, verify_types});
+  }
 
   results->set_null_count(input.null_count());
   return results;
@@ -29,6 +29,10 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace strings {
@@ -49,6 +53,7 @@ struct contains_fn {
   {
     if (d_strings.is_null(idx)) return false;
     auto const d_str = d_strings.element<string_view>(idx);
+    if (!prog.has_required_literal(d_str)) return false;
 
     size_type end = beginning_only ? 1    // match only the beginning of the string;
                                    : -1;  // match anywhere in the string
@@ -56,6 +61,22 @@ struct contains_fn {
   }
 };
 
+/**
+ * @brief This functor handles both contains_re and match_re for the programs
+ * evaluated by their bitset tables.
+ */
+struct contains_bitset_fn {
+  column_device_view const d_strings;
+  reprog_device const prog;
+  bool const beginning_only;
+
+  __device__ bool operator()(size_type const idx) const
+  {
+    if (d_strings.is_null(idx)) return false;
+    return prog.contains(d_strings.element<string_view>(idx), beginning_only);
+  }
+};
+
 std::unique_ptr<column> contains_impl(strings_column_view const& input,
                                       regex_program const& prog,
                                       bool const beginning_only,
@@ -75,8 +96,17 @@ std::unique_ptr<column> contains_impl(strings_column_view const& input,
   auto d_results       = results->mutable_view().data<bool>();
   auto const d_strings = column_device_view::create(input.parent(), stream);
 
-  launch_transform_kernel(
-    contains_fn{*d_strings, beginning_only}, *d_prog, d_results, input.size(), stream);
+  if (d_prog->has_bitset()) {
+    // no working memory is needed for the instruction states
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(input.size()),
+                      d_results,
+                      contains_bitset_fn{*d_strings, *d_prog, beginning_only});
+  } else {
+    launch_transform_kernel(
+      contains_fn{*d_strings, beginning_only}, *d_prog, d_results, input.size(), stream);
+  }
 
   results->set_null_count(input.null_count());
 
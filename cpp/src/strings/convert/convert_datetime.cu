@@ -21,6 +21,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/detail/convert/iso_datetime.cuh>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/utilities.cuh>
@@ -95,6 +96,25 @@ struct alignas(4) format_item {
   }
 };
 
+/**
+ * @brief Byte offsets of the fields of a format made only of literals and the `%Y`, `%m`, `%d`,
+ * `%H`, `%M` and `%S` specifiers, such as `%Y-%m-%dT%H:%M:%S`.
+ *
+ * Strings of exactly `width` bytes are parsed by reading each field at its offset instead of
+ * walking the format items. An offset of -1 means the format does not contain the field.
+ */
+struct fixed_format {
+  size_type width{-1};  ///< total bytes of the format; -1 if the format is not fixed-width
+  size_type year{-1};
+  size_type month{-1};
+  size_type day{-1};
+  size_type hour{-1};
+  size_type minute{-1};
+  size_type second{-1};
+
+  [[nodiscard]] __host__ __device__ bool is_valid() const { return width >= 0; }
+};
+
 /**
  * @brief The format-compiler parses a timestamp format string into a vector of
  * `format_items`.
@@ -107,6 +127,7 @@ using specifier_map = std::map<char, int8_t>;
 struct format_compiler {
   std::string_view const format;
   rmm::device_uvector<format_item> d_items;
+  fixed_format fixed;
 
   // clang-format off
   // The specifiers are documented here (not all are supported):
@@ -159,6 +180,8 @@ struct format_compiler {
       items.push_back(format_item::new_specifier(ch, specifiers[ch]));
     }
 
+    fixed = compile_fixed_format(items);
+
     // copy format_items to device memory
     d_items = cudf::detail::make_device_uvector_async(
       items, stream, rmm::mr::get_current_device_resource());
@@ -166,7 +189,37 @@ struct format_compiler {
 
   device_span<format_item const> format_items() { return device_span<format_item const>(d_items); }
 
+  [[nodiscard]] fixed_format fixed_format_plan() const { return fixed; }
+
   [[nodiscard]] int8_t subsecond_precision() const { return specifiers.at('f'); }
+
+ private:
+  static fixed_format compile_fixed_format(std::vector<format_item> const& items)
+  {
+    fixed_format plan;
+    size_type offset = 0;
+    for (auto const& item : items) {
+      if (item.item_type == format_char_type::specifier) {
+        auto const field = [&]() -> size_type* {
+          switch (item.value) {
+            case 'Y': return item.length == 4 ? &plan.year : nullptr;
+            case 'm': return item.length == 2 ? &plan.month : nullptr;
+            case 'd': return item.length == 2 ? &plan.day : nullptr;
+            case 'H': return item.length == 2 ? &plan.hour : nullptr;
+            case 'M': return item.length == 2 ? &plan.minute : nullptr;
+            case 'S': return item.length == 2 ? &plan.second : nullptr;
+            default: return nullptr;
+          }
+        }();
+        // any other specifier, or a repeated one, needs the general parser
+        if (field == nullptr || *field >= 0) { return fixed_format{}; }
+        *field = offset;
+      }
+      offset += item.length;
+    }
+    plan.width = offset;
+    return plan;
+  }
 };
 
 /**
@@ -198,6 +251,7 @@ struct parse_datetime {
   column_device_view const d_strings;
   device_span<format_item const> const d_format_items;
   int8_t const subsecond_precision;
+  fixed_format const fixed;
 
   /**
    * @brief Return power of ten value given an exponent.
@@ -346,6 +400,46 @@ struct parse_datetime {
     return timeparts;
   }
 
+  // Read each field of a fixed-width format at its offset; returns nothing if any field holds
+  // a non-digit so the string is parsed by `parse_into_parts` instead
+  [[nodiscard]] __device__ thrust::optional<timestamp_components> parse_fixed_into_parts(
+    string_view const& d_string) const
+  {
+    timestamp_components timeparts = {1970, 1, 1, 0};  // init to epoch time
+
+    auto const ptr   = d_string.data();
+    int32_t value    = 0;
+    auto const field = [ptr, &value](size_type offset, bool four_digits) {
+      return four_digits ? parse_four_digits(ptr + offset, value)
+                         : parse_two_digits(ptr + offset, value);
+    };
+    if (fixed.year >= 0) {
+      if (!field(fixed.year, true)) { return thrust::nullopt; }
+      timeparts.year = static_cast<int16_t>(value);
+    }
+    if (fixed.month >= 0) {
+      if (!field(fixed.month, false)) { return thrust::nullopt; }
+      timeparts.month = static_cast<int8_t>(value);
+    }
+    if (fixed.day >= 0) {
+      if (!field(fixed.day, false)) { return thrust::nullopt; }
+      timeparts.day = static_cast<int8_t>(value);
+    }
+    if (fixed.hour >= 0) {
+      if (!field(fixed.hour, false)) { return thrust::nullopt; }
+      timeparts.hour = static_cast<int8_t>(value);
+    }
+    if (fixed.minute >= 0) {
+      if (!field(fixed.minute, false)) { return thrust::nullopt; }
+      timeparts.minute = static_cast<int8_t>(value);
+    }
+    if (fixed.second >= 0) {
+      if (!field(fixed.second, false)) { return thrust::nullopt; }
+      timeparts.second = static_cast<int8_t>(value);
+    }
+    return timeparts;
+  }
+
   [[nodiscard]] __device__ int64_t timestamp_from_parts(timestamp_components const& timeparts) const
   {
     // Reference: https://howardhinnant.github.io/date/date.html#Reference
@@ -396,6 +490,11 @@ struct parse_datetime {
     string_view d_str = d_strings.element<string_view>(idx);
     if (d_str.empty()) return epoch_time;
 
+    if (fixed.is_valid() && d_str.size_bytes() == fixed.width) {
+      auto const timeparts = parse_fixed_into_parts(d_str);
+      if (timeparts.has_value()) { return T{T::duration(timestamp_from_parts(*timeparts))}; }
+    }
+
     auto const timeparts = parse_into_parts(d_str);
 
     return T{T::duration(timestamp_from_parts(timeparts))};
@@ -413,7 +512,10 @@ struct dispatch_to_timestamps_fn {
                   rmm::cuda_stream_view stream) const
   {
     format_compiler compiler(format, stream);
-    parse_datetime<T> pfn{d_strings, compiler.format_items(), compiler.subsecond_precision()};
+    parse_datetime<T> pfn{d_strings,
+                          compiler.format_items(),
+                          compiler.subsecond_precision(),
+                          compiler.fixed_format_plan()};
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(results_view.size()),
@@ -62,7 +62,9 @@ struct extract_fn {
 
     if (d_strings.is_valid(idx)) {
       auto const d_str = d_strings.element<string_view>(idx);
-      auto const match = d_prog.find(prog_idx, d_str, d_str.begin());
+      auto const match = d_prog.has_required_literal(d_str)
+                           ? d_prog.find(prog_idx, d_str, d_str.begin())
+                           : match_result{};
       if (match) {
         auto const itr = d_str.begin() + match->first;
         auto last_pos  = itr;
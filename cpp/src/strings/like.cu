@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,17 +18,26 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/offsets_iterator_factory.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/contains.hpp>
+#include <cudf/strings/detail/utf8.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <thrust/iterator/constant_iterator.h>
+#include <thrust/copy.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -38,6 +47,288 @@ namespace {
 constexpr char multi_wildcard  = '%';
 constexpr char single_wildcard = '_';
 
+// A `_` in a compiled pattern; 0xFF is not a valid UTF-8 byte so this is no character
+constexpr char_utf8 any_char_code = 0xFFFF'FFFFu;
+
+/**
+ * @brief How a compiled like pattern is matched
+ */
+enum class like_kind : int8_t {
+  EQUAL,     ///< The pattern has no wildcards: the string equals the literal
+  PREFIX,    ///< `abc%`: the string starts with the literal
+  SUFFIX,    ///< `%abc`: the string ends with the literal
+  CONTAINS,  ///< `%abc%`: the string contains the literal
+  SEGMENTS   ///< Any other pattern: the segments match in order
+};
+
+/**
+ * @brief A like pattern compiled on the host.
+ *
+ * The patterns whose only wildcards are a leading or trailing `%` are matched as a literal of
+ * UTF-8 bytes. The other patterns are split at their `%` wildcards into segments of characters, in
+ * which a `_` is `any_char_code`. The first segment is anchored at the beginning of the string and
+ * the last one at its end; the segments in between are matched greedily at their leftmost
+ * position, which never needs backtracking since each segment matches a fixed number of
+ * characters.
+ */
+struct like_pattern {
+  like_kind kind;
+  size_type literal_begin;   ///< Byte range of the literal in the literals of the patterns
+  size_type literal_end;     ///< End of the byte range of the literal
+  size_type segments_begin;  ///< Range of the segments in the segments of the patterns
+  size_type segments_end;    ///< End of the range of the segments
+};
+
+/**
+ * @brief Like patterns compiled on the host and copied to the device.
+ */
+struct compiled_like_patterns {
+  rmm::device_uvector<like_pattern> patterns;
+  rmm::device_uvector<char> literals;
+  rmm::device_uvector<char_utf8> codes;
+  rmm::device_uvector<size_type> segment_offsets;  ///< Range of each segment in `codes`
+};
+
+/**
+ * @brief Compiles like patterns, see `like_pattern`.
+ */
+compiled_like_patterns compile_like_patterns(std::vector<std::string> const& patterns,
+                                             std::string const& escape_character,
+                                             rmm::cuda_stream_view stream)
+{
+  auto const has_escape = not escape_character.empty();
+  char_utf8 esc_char    = 0;
+  if (has_escape) { to_char_utf8(escape_character.data(), esc_char); }
+
+  std::vector<like_pattern> h_patterns;
+  std::vector<char> h_literals;
+  std::vector<char_utf8> h_codes;
+  std::vector<size_type> h_segment_offsets{0};
+  for (auto const& pattern : patterns) {
+    // split the pattern at its unescaped '%'
+    std::vector<std::vector<char_utf8>> segments(1);
+    bool has_any_char = false;
+    for (auto itr = pattern.data(), end = pattern.data() + pattern.size(); itr < end;) {
+      char_utf8 chr = 0;
+      itr += to_char_utf8(itr, chr);
+      if (has_escape && chr == esc_char) {
+        // an escape at the end of the pattern is itself matched
+        if (itr < end) { itr += to_char_utf8(itr, chr); }
+        segments.back().push_back(chr);
+      } else if (chr == multi_wildcard) {
+        segments.emplace_back();
+      } else if (chr == single_wildcard) {
+        segments.back().push_back(any_char_code);
+        has_any_char = true;
+      } else {
+        segments.back().push_back(chr);
+      }
+    }
+    // consecutive '%' are the same as one
+    if (segments.size() > 2) {
+      segments.erase(std::remove_if(std::next(segments.begin()),
+                                    std::prev(segments.end()),
+                                    [](auto const& segment) { return segment.empty(); }),
+                     std::prev(segments.end()));
+    }
+
+    auto const kind = [&] {
+      if (has_any_char) { return like_kind::SEGMENTS; }
+      if (segments.size() == 1) { return like_kind::EQUAL; }
+      if (segments.size() == 2 && segments[1].empty()) { return like_kind::PREFIX; }
+      if (segments.size() == 2 && segments[0].empty()) { return like_kind::SUFFIX; }
+      if (segments.size() == 3 && segments[0].empty() && segments[2].empty()) {
+        return like_kind::CONTAINS;
+      }
+      return like_kind::SEGMENTS;
+    }();
+
+    like_pattern compiled{kind, 0, 0, 0, 0};
+    if (kind == like_kind::SEGMENTS) {
+      compiled.segments_begin = static_cast<size_type>(h_segment_offsets.size()) - 1;
+      for (auto const& segment : segments) {
+        h_codes.insert(h_codes.end(), segment.begin(), segment.end());
+        h_segment_offsets.push_back(static_cast<size_type>(h_codes.size()));
+      }
+      compiled.segments_end = static_cast<size_type>(h_segment_offsets.size()) - 1;
+    } else {
+      // the literal follows the leading '%' of SUFFIX and CONTAINS patterns
+      auto const& literal =
+        segments[kind == like_kind::SUFFIX || kind == like_kind::CONTAINS ? 1 : 0];
+      compiled.literal_begin = static_cast<size_type>(h_literals.size());
+      for (auto const chr : literal) {
+        char bytes[4];
+        h_literals.insert(h_literals.end(), bytes, bytes + from_char_utf8(chr, bytes));
+      }
+      compiled.literal_end = static_cast<size_type>(h_literals.size());
+    }
+    h_patterns.push_back(compiled);
+  }
+
+  auto const mr = rmm::mr::get_current_device_resource();
+  return compiled_like_patterns{cudf::detail::make_device_uvector_async(h_patterns, stream, mr),
+                                cudf::detail::make_device_uvector_async(h_literals, stream, mr),
+                                cudf::detail::make_device_uvector_async(h_codes, stream, mr),
+                                cudf::detail::make_device_uvector_async(
+                                  h_segment_offsets, stream, mr)};
+}
+
+/**
+ * @brief Returns the end of the characters of `segment` if they match the string at `itr`, or
+ * nullptr.
+ */
+__device__ char const* match_segment(char const* itr,
+                                     char const* end,
+                                     char_utf8 const* segment,
+                                     char_utf8 const* segment_end)
+{
+  for (; segment < segment_end; ++segment) {
+    if (itr == end) { return nullptr; }
+    if (*segment == any_char_code) {
+      itr += bytes_in_utf8_byte(*itr);
+      continue;
+    }
+    char_utf8 chr = 0;
+    itr += to_char_utf8(itr, chr);
+    if (chr != *segment) { return nullptr; }
+  }
+  return itr;
+}
+
+/**
+ * @brief Identifies the strings that match any of the compiled like patterns.
+ */
+struct compiled_like_fn {
+  column_device_view const d_strings;
+  device_span<like_pattern const> const patterns;
+  char const* literals;
+  char_utf8 const* codes;
+  size_type const* segment_offsets;
+
+  __device__ bool matches_segments(string_view d_str, like_pattern const& pattern) const
+  {
+    // the codes of segment `index` end where the codes of the next segment begin
+    auto const segment = [&](size_type index) { return codes + segment_offsets[index]; };
+    auto const begin   = d_str.data();
+    auto const end     = begin + d_str.size_bytes();
+
+    auto const first = pattern.segments_begin;
+    auto const last  = pattern.segments_end - 1;
+    auto itr         = match_segment(begin, end, segment(first), segment(first + 1));
+    if (first == last || itr == nullptr) { return itr == end; }
+
+    // the segments between two '%' match at their leftmost position
+    for (auto index = first + 1; index < last; ++index) {
+      auto matched = match_segment(itr, end, segment(index), segment(index + 1));
+      while (matched == nullptr && itr < end) {
+        itr += bytes_in_utf8_byte(*itr);
+        matched = match_segment(itr, end, segment(index), segment(index + 1));
+      }
+      if (matched == nullptr) { return false; }
+      itr = matched;
+    }
+
+    // the last segment ends with the string, and starts after the other segments
+    auto start = end;
+    for (auto code = segment(last); code < segment(last + 1); ++code) {
+      if (start == itr) { return false; }
+      do {
+        --start;
+      } while (start > itr && is_utf8_continuation_char(*start));
+    }
+    return match_segment(start, end, segment(last), segment(last + 1)) == end;
+  }
+
+  __device__ bool matches(string_view d_str, like_pattern const& pattern) const
+  {
+    auto const literal =
+      string_view(literals + pattern.literal_begin, pattern.literal_end - pattern.literal_begin);
+    auto const literal_size = literal.size_bytes();
+    auto const size         = d_str.size_bytes();
+    switch (pattern.kind) {
+      case like_kind::EQUAL: return d_str == literal;
+      case like_kind::PREFIX:
+        return size >= literal_size && string_view(d_str.data(), literal_size) == literal;
+      case like_kind::SUFFIX:
+        return size >= literal_size &&
+               string_view(d_str.data() + size - literal_size, literal_size) == literal;
+      case like_kind::CONTAINS:
+        for (size_type pos = 0; pos + literal_size <= size; ++pos) {
+          if (string_view(d_str.data() + pos, literal_size) == literal) { return true; }
+        }
+        return false;
+      default: return matches_segments(d_str, pattern);
+    }
+  }
+
+  __device__ bool operator()(size_type const idx) const
+  {
+    if (d_strings.is_null(idx)) { return false; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    for (auto const& pattern : patterns) {
+      if (matches(d_str, pattern)) { return true; }
+    }
+    return false;
+  }
+};
+
+std::unique_ptr<column> like(strings_column_view const& input,
+                             std::vector<std::string> const& patterns,
+                             std::string const& escape_character,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  auto results = make_numeric_column(data_type{type_id::BOOL8},
+                                     input.size(),
+                                     cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                     input.null_count(),
+                                     stream,
+                                     mr);
+  if (input.is_empty()) { return results; }
+
+  auto const compiled  = compile_like_patterns(patterns, escape_character, stream);
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    results->mutable_view().data<bool>(),
+                    compiled_like_fn{*d_strings,
+                                     compiled.patterns,
+                                     compiled.literals.data(),
+                                     compiled.codes.data(),
+                                     compiled.segment_offsets.data()});
+
+  results->set_null_count(input.null_count());
+  return results;
+}
+
+/**
+ * @brief Copies the strings of a column without nulls to the host.
+ */
+std::vector<std::string> to_host_strings(strings_column_view const& input,
+                                         rmm::cuda_stream_view stream)
+{
+  if (input.is_empty()) { return {}; }
+  auto const d_offsets =
+    cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
+  rmm::device_uvector<int64_t> offsets(input.size() + 1, stream);
+  thrust::copy(
+    rmm::exec_policy_nosync(stream), d_offsets, d_offsets + offsets.size(), offsets.begin());
+  auto const h_offsets = cudf::detail::make_std_vector_sync(offsets, stream);
+  auto const h_chars   = cudf::detail::make_std_vector_sync(
+    device_span<char const>(input.chars_begin(stream) + h_offsets.front(),
+                            h_offsets.back() - h_offsets.front()),
+    stream);
+
+  std::vector<std::string> result;
+  for (std::size_t i = 0; i + 1 < h_offsets.size(); ++i) {
+    result.emplace_back(h_chars.data() + (h_offsets[i] - h_offsets.front()),
+                        h_offsets[i + 1] - h_offsets[i]);
+  }
+  return result;
+}
+
 template <typename PatternIterator>
 struct like_fn {
   column_device_view const d_strings;
@@ -156,10 +447,11 @@ std::unique_ptr<column> like(strings_column_view const& input,
   CUDF_EXPECTS(pattern.is_valid(stream), "Parameter pattern must be valid");
   CUDF_EXPECTS(escape_character.is_valid(stream), "Parameter escape_character must be valid");
 
-  auto const d_pattern    = pattern.value(stream);
-  auto const patterns_itr = thrust::make_constant_iterator(d_pattern);
-
-  return like(input, patterns_itr, escape_character.value(stream), stream, mr);
+  return like(input,
+              std::vector<std::string>{pattern.to_string(stream)},
+              escape_character.to_string(stream),
+              stream,
+              mr);
 }
 
 std::unique_ptr<column> like(strings_column_view const& input,
@@ -178,6 +470,22 @@ std::unique_ptr<column> like(strings_column_view const& input,
   return like(input, patterns_itr, escape_character.value(stream), stream, mr);
 }
 
+std::unique_ptr<column> like_any(strings_column_view const& input,
+                                 strings_column_view const& patterns,
+                                 string_scalar const& escape_character,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(patterns.has_nulls() == false, "Parameter patterns must not contain nulls");
+  CUDF_EXPECTS(escape_character.is_valid(stream), "Parameter escape_character must be valid");
+
+  return like(input,
+              to_host_strings(patterns, stream),
+              escape_character.to_string(stream),
+              stream,
+              mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -202,5 +510,15 @@ std::unique_ptr<column> like(strings_column_view const& input,
   return detail::like(input, patterns, escape_character, stream, mr);
 }
 
+std::unique_ptr<column> like_any(strings_column_view const& input,
+                                 strings_column_view const& patterns,
+                                 string_scalar const& escape_character,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::like_any(input, patterns, escape_character, stream, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
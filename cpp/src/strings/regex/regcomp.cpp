@@ -16,6 +16,9 @@
 
 #include "strings/regex/regcomp.h"
 
+#include "strings/char_types/char_flags.h"
+
+#include <cudf/strings/detail/char_tables.hpp>
 #include <cudf/strings/detail/utf8.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -1168,6 +1171,187 @@ void reprog::check_for_errors()
   }
 }
 
+namespace {
+
+/// The beginning of line instructions passed at a position
+enum class line_begin : int32_t {
+  NONE,     ///< No BOL instruction passes
+  NEWLINE,  ///< Only the MULTILINE BOL instructions pass, after a new-line character
+  STRING    ///< All BOL instructions pass, at the first position of a string
+};
+
+/**
+ * @brief Returns the instructions that consume a character or are EOL or END instructions,
+ * reached from the instruction `id` without consuming characters.
+ */
+reprog_bitset::mask_type reachable_insts(reprog const& prog, int32_t id, line_begin bol)
+{
+  reprog_bitset::mask_type result = 0;
+  std::vector<bool> visited(prog.insts_count(), false);
+  std::stack<int32_t> ids;
+  ids.push(id);
+  while (!ids.empty()) {
+    id = ids.top();
+    ids.pop();
+    if (visited[id]) { continue; }
+    visited[id] = true;
+
+    auto const& inst = prog.insts_data()[id];
+    switch (inst.type) {
+      case LBRA:
+      case RBRA: ids.push(inst.u2.next_id); break;
+      case OR:
+        ids.push(inst.u1.right_id);
+        ids.push(inst.u2.left_id);
+        break;
+      case BOL:
+        if (bol == line_begin::STRING || (bol == line_begin::NEWLINE && inst.u1.c == '^')) {
+          ids.push(inst.u2.next_id);
+        }
+        break;
+      default: result |= reprog_bitset::mask_type{1} << id;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Host version of `reclass_device::is_match` for ASCII characters.
+ */
+bool is_ascii_match(reclass const& cls, char32_t const ch)
+{
+  if (std::any_of(cls.literals.begin(), cls.literals.end(), [ch](auto const& literal) {
+        return (ch >= literal.first) && (ch <= literal.last);
+      })) {
+    return true;
+  }
+  auto const fl = g_character_codepoint_flags[ch];
+  return ((cls.builtins & CCLASS_W) && ((ch == '_') || IS_ALPHANUM(fl))) ||
+         ((cls.builtins & CCLASS_S) && IS_SPACE(fl)) ||
+         ((cls.builtins & CCLASS_D) && IS_DIGIT(fl)) ||
+         ((cls.builtins & NCCLASS_W) && ((ch != '\n') && (ch != '_') && !IS_ALPHANUM(fl))) ||
+         ((cls.builtins & NCCLASS_S) && !IS_SPACE(fl)) ||
+         ((cls.builtins & NCCLASS_D) && ((ch != '\n') && !IS_DIGIT(fl)));
+}
+
+/**
+ * @brief Checks if an instruction consumes an ASCII character, as executed by `regexec`.
+ */
+bool is_ascii_match(reprog const& prog, reinst const& inst, char32_t const ch)
+{
+  switch (inst.type) {
+    case CHAR: return inst.u1.c == ch;
+    case ANY: return ch != '\n';
+    case ANYNL: return true;
+    case CCLASS: return is_ascii_match(prog.class_at(inst.u1.cls_id), ch);
+    case NCCLASS: return !is_ascii_match(prog.class_at(inst.u1.cls_id), ch);
+    default: return false;
+  }
+}
+
+}  // namespace
+
+std::optional<reprog_bitset> build_bitset(reprog const& prog)
+{
+  auto const insts_count = prog.insts_count();
+  if (insts_count > reprog_bitset::max_insts) { return std::nullopt; }
+
+  reprog_bitset result{};
+  for (int32_t id = 0; id < insts_count; ++id) {
+    auto const& inst = prog.insts_data()[id];
+    auto const bit   = reprog_bitset::mask_type{1} << id;
+    switch (inst.type) {
+      case CHAR:
+      case ANY:
+      case ANYNL:
+      case CCLASS:
+      case NCCLASS: {
+        result.follow[id]      = reachable_insts(prog, inst.u2.next_id, line_begin::NONE);
+        result.follow_line[id] = reachable_insts(prog, inst.u2.next_id, line_begin::NEWLINE);
+        result.consuming |= bit;
+        for (char32_t ch = 0; ch < reprog_bitset::ascii_size; ++ch) {
+          if (is_ascii_match(prog, inst, ch)) { result.ascii[ch] |= bit; }
+        }
+        break;
+      }
+      case END: result.end |= bit; break;
+      case EOL:
+        result.eol |= bit;
+        if (inst.u1.c == '$') { result.eol_newline |= bit; }
+        if (inst.u1.c != 'Z') { result.eol_final_newline |= bit; }
+        break;
+      case LBRA:
+      case RBRA:
+      case OR:
+      case BOL: break;
+      default: return std::nullopt;  // word boundaries
+    }
+  }
+
+  // an EOL must end the match at any position, so it is only followed by END instructions
+  for (int32_t id = 0; id < insts_count; ++id) {
+    auto const& inst = prog.insts_data()[id];
+    if (inst.type != EOL) { continue; }
+    auto const next = reachable_insts(prog, inst.u2.next_id, line_begin::NONE);
+    if (next == 0 || (next & ~result.end) != 0 ||
+        next != reachable_insts(prog, inst.u2.next_id, line_begin::STRING)) {
+      return std::nullopt;
+    }
+  }
+
+  auto const start_id = prog.get_start_inst();
+  result.start        = reachable_insts(prog, start_id, line_begin::NONE);
+  result.start_line   = reachable_insts(prog, start_id, line_begin::NEWLINE);
+  result.start_string = reachable_insts(prog, start_id, line_begin::STRING);
+  return result;
+}
+
+std::string required_literal(reprog const& prog)
+{
+  auto const insts_count = prog.insts_count();
+  auto const insts       = prog.insts_data();
+
+  // checks if an END instruction is reached from the start without the `excluded` instruction
+  auto const reaches_end = [&](int32_t excluded) {
+    std::vector<bool> visited(insts_count, false);
+    std::stack<int32_t> ids;
+    ids.push(prog.get_start_inst());
+    while (!ids.empty()) {
+      auto const id = ids.top();
+      ids.pop();
+      if (id == excluded || visited[id]) { continue; }
+      visited[id] = true;
+      if (insts[id].type == END) { return true; }
+      ids.push(insts[id].u2.next_id);
+      if (insts[id].type == OR) { ids.push(insts[id].u1.right_id); }
+    }
+    return false;
+  };
+  if (insts_count == 0 || !reaches_end(-1)) { return {}; }
+
+  std::vector<bool> required(insts_count, false);
+  for (int32_t id = 0; id < insts_count; ++id) {
+    required[id] = (insts[id].type == CHAR) && !reaches_end(id);
+  }
+
+  // join the required characters that follow each other, skipping the capture groups;
+  // these chains cannot loop since their instructions reach an END instruction
+  std::string result;
+  for (int32_t id = 0; id < insts_count; ++id) {
+    std::string literal;
+    for (auto next = id; required[next];) {
+      char bytes[4];
+      literal.append(bytes, from_char_utf8(insts[next].u1.c, bytes));
+      next = insts[next].u2.next_id;
+      while (insts[next].type == LBRA || insts[next].type == RBRA) {
+        next = insts[next].u2.next_id;
+      }
+    }
+    if (literal.size() > result.size()) { result = std::move(literal); }
+  }
+  return result;
+}
+
 #ifndef NDEBUG
 void reprog::print(regex_flags const flags)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,8 @@
 
 #include <cudf/strings/regex/flags.hpp>
 
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -157,6 +159,55 @@ class reprog {
   void check_for_errors(int32_t id, int32_t next_id);
 };
 
+/**
+ * @brief Tables for evaluating a regex program with one bit per instruction.
+ *
+ * The bit of an instruction is set while the instruction is reached at the current position of
+ * a string and it consumes a character or ends a match. The tables resolve the instructions that
+ * consume no characters, so a string is matched by updating a 64-bit word per character without
+ * the working memory of the instruction states.
+ */
+struct alignas(8) reprog_bitset {
+  using mask_type = uint64_t;
+
+  static constexpr int32_t max_insts  = 64;   ///< Maximum number of instructions of a program
+  static constexpr int32_t ascii_size = 128;  ///< Number of ASCII characters
+
+  mask_type ascii[ascii_size];       ///< Instructions consuming each ASCII character
+  mask_type follow[max_insts];       ///< Instructions reached after an instruction consumes
+  mask_type follow_line[max_insts];  ///< Same as `follow` for a new-line character
+  mask_type consuming;               ///< Instructions consuming a character
+  mask_type start;                   ///< Instructions starting a match
+  mask_type start_line;              ///< Instructions starting a match after a new-line
+  mask_type start_string;            ///< Instructions starting a match at the first position
+  mask_type end;                     ///< Instructions ending a match
+  mask_type eol;                     ///< EOL instructions, all matching at the end of a string
+  mask_type eol_newline;             ///< EOL instructions matching before a new-line
+  mask_type eol_final_newline;       ///< EOL instructions matching before a final new-line
+};
+
+/**
+ * @brief Builds the bitset tables of a regex program.
+ *
+ * The program must have at most `reprog_bitset::max_insts` instructions, no word boundary
+ * instructions, and its EOL instructions must be followed by the end of a match.
+ *
+ * @param prog The regex program
+ * @return The tables of `prog`, or no value if it cannot be evaluated by them
+ */
+std::optional<reprog_bitset> build_bitset(reprog const& prog);
+
+/**
+ * @brief Returns the longest literal found in the strings of every match of a regex program.
+ *
+ * The literal is made of consecutive CHAR instructions on every path of the program from its
+ * start to an END instruction, so strings without it cannot match.
+ *
+ * @param prog The regex program
+ * @return The literal encoded as UTF-8, or an empty string if the program requires none
+ */
+std::string required_literal(reprog const& prog);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -106,6 +106,11 @@ class reprog_device {
     return _num_capturing_groups;
   }
 
+  /**
+   * @brief Returns true if `contains()` can evaluate this program.
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE inline bool has_bitset() const { return _bitset != nullptr; }
+
   /**
    * @brief Returns true if this is an empty program.
    */
@@ -211,6 +216,28 @@ class reprog_device {
                                          cudf::size_type end,
                                          cudf::size_type const group_id) const;
 
+  /**
+   * @brief Checks if the given string contains the literal required by every match.
+   *
+   * This is a fast check to skip the strings that the compiled expression cannot match.
+   *
+   * @param d_str The string to check.
+   * @return false if `d_str` has no match
+   */
+  __device__ inline bool has_required_literal(string_view const d_str) const;
+
+  /**
+   * @brief Checks if the compiled expression matches the given string using its bitset tables.
+   *
+   * This requires no working memory but only reports whether a match exists.
+   * Call only if `has_bitset()` is true.
+   *
+   * @param d_str The string to search.
+   * @param beginning_only Only match at the beginning of `d_str`.
+   * @return true if a match is found
+   */
+  __device__ inline bool contains(string_view const d_str, bool const beginning_only) const;
+
  private:
   struct reljunk {
     relist* __restrict__ list1;
@@ -232,6 +259,12 @@ class reprog_device {
    */
   __device__ inline reclass_device get_class(int32_t id) const;
 
+  /**
+   * @brief Returns the instructions of `insts` consuming the given non-ASCII character.
+   */
+  __device__ inline reprog_bitset::mask_type match_non_ascii(reprog_bitset::mask_type insts,
+                                                             char_utf8 const c) const;
+
   /**
    * @brief Executes the regex pattern on the given string.
    */
@@ -263,6 +296,9 @@ class reprog_device {
   reinst const* _insts{};             // array of regex instructions
   int32_t const* _startinst_ids{};    // array of start instruction ids
   reclass_device const* _classes{};   // array of regex classes
+  reprog_bitset const* _bitset{};     // tables for contains(), if the program supports them
+  char const* _literal{};             // literal required by every match
+  size_type _literal_size{};          // bytes in the required literal
 
   std::size_t _prog_size{};  // total size of this instance
   void* _buffer{};           // working memory buffer
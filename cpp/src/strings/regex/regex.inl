@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -426,6 +426,75 @@ reprog_device::call_regexec(int32_t const thread_idx,
   return regexec(dstr, jnk, begin, end, group_id);
 }
 
+__device__ __forceinline__ bool reprog_device::has_required_literal(string_view const dstr) const
+{
+  return _literal_size == 0 || dstr.find(_literal, _literal_size) != string_view::npos;
+}
+
+__device__ __forceinline__ reprog_bitset::mask_type reprog_device::match_non_ascii(
+  reprog_bitset::mask_type insts, char_utf8 const c) const
+{
+  reprog_bitset::mask_type result = 0;
+  for (; insts != 0; insts &= insts - 1) {
+    auto const id   = __ffsll(static_cast<long long>(insts)) - 1;
+    auto const inst = get_inst(id);
+    bool is_match   = false;
+    switch (inst.type) {
+      case CHAR: is_match = inst.u1.c == c; break;
+      case ANY:
+      case ANYNL: is_match = true; break;
+      case NCCLASS:
+      case CCLASS:
+        is_match = get_class(inst.u1.cls_id).is_match(static_cast<char32_t>(c), _codepoint_flags) ==
+                   (inst.type == CCLASS);
+        break;
+    }
+    if (is_match) { result |= reprog_bitset::mask_type{1} << id; }
+  }
+  return result;
+}
+
+/**
+ * @brief Evaluate a string against the bitset tables of the regex pattern.
+ *
+ * This follows the instructions of `regexec` for all the match start positions at once: the bit of
+ * an instruction is set if any of the started matches reached it.
+ */
+__device__ __forceinline__ bool reprog_device::contains(string_view const dstr,
+                                                        bool const beginning_only) const
+{
+  auto const& bits = *_bitset;
+  auto itr         = dstr.begin();
+  auto insts       = bits.start_string;
+  while (true) {
+    if (insts & bits.end) { return true; }
+    if (itr.byte_offset() >= dstr.size_bytes()) { return (insts & bits.eol) != 0; }
+
+    char_utf8 const c = *itr;
+    if (c == '\n') {
+      auto const is_final = itr.byte_offset() + 1 == dstr.size_bytes();
+      if (insts & (is_final ? bits.eol_final_newline : bits.eol_newline)) { return true; }
+    }
+
+    // advance the instructions consuming the character
+    auto const* follow = (c == '\n') ? bits.follow_line : bits.follow;
+    auto matched       = (c < static_cast<char_utf8>(reprog_bitset::ascii_size))
+                           ? (insts & bits.ascii[c])
+                           : match_non_ascii(insts & bits.consuming, c);
+    insts              = 0;
+    for (; matched != 0; matched &= matched - 1) {
+      insts |= follow[__ffsll(static_cast<long long>(matched)) - 1];
+    }
+    ++itr;
+
+    if (beginning_only) {
+      if (insts == 0) { return false; }
+    } else {
+      insts |= (c == '\n') ? bits.start_line : bits.start;
+    }
+  }
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,9 +17,12 @@
 #include "regex_program_impl.h"
 
 #include <cudf/strings/regex/regex_program.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
 
 namespace cudf {
 namespace strings {
@@ -39,6 +42,7 @@ regex_program& regex_program::operator=(regex_program&& other) = default;
 regex_program::regex_program(std::string_view pattern, regex_flags flags, capture_groups capture)
   : _pattern(pattern),
     _flags(flags),
+    _capture(capture),
     _impl(
       std::make_unique<regex_program_impl>(detail::reprog::create_from(pattern, flags, capture)))
 {
@@ -59,5 +63,59 @@ std::size_t regex_program::compute_working_memory_size(int32_t num_strings) cons
   return detail::compute_working_memory_size(num_strings, instructions_count());
 }
 
+void regex_program::release_device_program(rmm::cuda_stream_view stream) const
+{
+  _impl->release_device_progs(stream);
+}
+
+std::shared_ptr<detail::reprog_device const> regex_program::regex_program_impl::device_prog(
+  rmm::cuda_stream_view stream)
+{
+  int device_id;
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& d_prog = _device_progs[device_id];
+  if (!d_prog) {
+    d_prog = detail::reprog_device::create(prog, stream);
+    // the calls on other streams use the program once it is uploaded
+    stream.synchronize();
+  }
+  return d_prog;
+}
+
+void regex_program::regex_program_impl::release_device_progs(rmm::cuda_stream_view stream)
+{
+  stream.synchronize();
+  std::lock_guard<std::mutex> lock(_mutex);
+  _device_progs.clear();
+}
+
+std::shared_ptr<regex_program const> regex_program_cache::get(std::string_view pattern,
+                                                              regex_flags flags,
+                                                              capture_groups capture)
+{
+  auto key = std::make_tuple(std::string{pattern}, flags, capture);
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto itr = _programs.find(key);
+  if (itr == _programs.end()) {
+    // an invalid pattern throws here and is not cached
+    itr = _programs.emplace(std::move(key), regex_program::create(pattern, flags, capture)).first;
+  }
+  return itr->second;
+}
+
+std::size_t regex_program_cache::size() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _programs.size();
+}
+
+void regex_program_cache::clear(rmm::cuda_stream_view stream)
+{
+  stream.synchronize();
+  std::lock_guard<std::mutex> lock(_mutex);
+  _programs.clear();
+}
+
 }  // namespace strings
 }  // namespace cudf
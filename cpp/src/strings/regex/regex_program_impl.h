@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,11 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
 namespace cudf {
 namespace strings {
 
@@ -36,6 +41,28 @@ struct regex_program::regex_program_impl {
   regex_program_impl(detail::reprog const& p) : prog(p) {}
   regex_program_impl(detail::reprog&& p) : prog(p) {}
 
+  /**
+   * @brief Returns the device program of `prog` for the current device
+   *
+   * The device program is created and uploaded by the first call on each device and shared
+   * by the later calls, from any thread and on any stream.
+   *
+   * @param stream CUDA stream used to upload the device program
+   * @return The shared device program
+   */
+  std::shared_ptr<detail::reprog_device const> device_prog(rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Releases the device programs once the work queued on `stream` is complete
+   *
+   * @param stream CUDA stream of the last work using the device programs
+   */
+  void release_device_progs(rmm::cuda_stream_view stream);
+
+ private:
+  std::mutex _mutex;
+  std::map<int, std::shared_ptr<detail::reprog_device const>> _device_progs;  // by device id
+
   // TODO: There will be other options added here in the future to handle issues
   // 10852 and possibly others like 11979
 };
@@ -43,7 +70,11 @@ struct regex_program::regex_program_impl {
 struct regex_device_builder {
   static auto create_prog_device(regex_program const& p, rmm::cuda_stream_view stream)
   {
-    return detail::reprog_device::create(p._impl->prog, stream);
+    auto const d_prog = p._impl->device_prog(stream);
+    // each call owns a copy since its working memory is set by the call,
+    // and the shared device program outlives the copy
+    return std::unique_ptr<detail::reprog_device, std::function<void(detail::reprog_device*)>>(
+      new detail::reprog_device(*d_prog), [d_prog](detail::reprog_device* t) { t->destroy(); });
   }
 };
 
@@ -61,10 +61,16 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     classes_count * sizeof(_classes[0]),
     std::plus<std::size_t>{},
     [&h_prog](auto& cls) { return cls.literals.size() * sizeof(reclass_range); });
+  // the bitset tables and the literal are placed last since they are not copied into shared memory
+  auto const bitset      = build_bitset(h_prog);
+  auto const bitset_size = bitset.has_value() ? sizeof(reprog_bitset) : 0;
+  auto const literal     = required_literal(h_prog);
   // make sure each section is aligned for the subsequent section's data type
-  auto const memsize = cudf::util::round_up_safe(insts_size, sizeof(_startinst_ids[0])) +
-                       cudf::util::round_up_safe(startids_size, sizeof(_classes[0])) +
-                       cudf::util::round_up_safe(classes_size, sizeof(char32_t));
+  auto const bitset_offset  = cudf::util::round_up_safe(insts_size, sizeof(_startinst_ids[0])) +
+                              cudf::util::round_up_safe(startids_size, sizeof(_classes[0])) +
+                              cudf::util::round_up_safe(classes_size, alignof(reprog_bitset));
+  auto const literal_offset = bitset_offset + bitset_size;
+  auto const memsize        = literal_offset + literal.size();
 
   // allocate memory to store all the prog data in a flat contiguous buffer
   std::vector<u_char> h_buffer(memsize);                        // copy everything into here;
@@ -109,9 +115,18 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     d_end += h_class.literals.size() * sizeof(reclass_range);
   }
 
+  if (bitset.has_value()) {
+    memcpy(h_buffer.data() + bitset_offset, &bitset.value(), bitset_size);
+    d_prog->_bitset = reinterpret_cast<reprog_bitset*>(
+      reinterpret_cast<u_char*>(d_buffer->data()) + bitset_offset);
+  }
+  memcpy(h_buffer.data() + literal_offset, literal.data(), literal.size());
+  d_prog->_literal      = reinterpret_cast<char const*>(d_buffer->data()) + literal_offset;
+  d_prog->_literal_size = static_cast<size_type>(literal.size());
+
   // initialize the rest of the elements
   d_prog->_max_insts = insts_count;
-  d_prog->_prog_size = memsize + sizeof(reprog_device);
+  d_prog->_prog_size = bitset_offset + sizeof(reprog_device);
 
   // copy flat prog to device memory
   CUDF_CUDA_TRY(
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "strings/search/target_automaton.cuh"
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
@@ -104,21 +106,16 @@ struct replace_multi_parallel_fn {
   {
     auto const d_offsets = get_offsets_ptr();
     auto const d_chars   = get_base_ptr() + d_offsets[0] + idx;
-    size_type str_idx    = -1;
-    for (std::size_t t = 0; t < d_targets.size(); ++t) {
-      auto const d_tgt = d_targets[t];
-      if (!d_tgt.empty() && (idx + d_tgt.size_bytes() <= chars_bytes) &&
-          (d_tgt.compare(d_chars, d_tgt.size_bytes()) == 0)) {
-        if (str_idx < 0) {
-          auto const idx_itr =
-            thrust::upper_bound(thrust::seq, d_offsets, d_offsets + d_strings.size(), idx);
-          str_idx = thrust::distance(d_offsets, idx_itr) - 1;
-        }
-        auto const d_str = get_string(str_idx - d_offsets[0]);
-        if ((d_chars + d_tgt.size_bytes()) <= (d_str.data() + d_str.size_bytes())) { return t; }
-      }
-    }
-    return thrust::nullopt;
+    if (d_automaton.first_target(d_chars, chars_bytes - idx) < 0) { return thrust::nullopt; }
+    // only the targets ending within the string containing this position are replaced
+    auto const idx_itr =
+      thrust::upper_bound(thrust::seq, d_offsets, d_offsets + d_strings.size(), idx);
+    auto const str_idx = static_cast<size_type>(thrust::distance(d_offsets, idx_itr)) - 1;
+    auto const d_str   = get_string(str_idx - d_offsets[0]);
+    auto const d_end   = d_str.data() + d_str.size_bytes();
+    auto const target =
+      d_automaton.first_target(d_chars, static_cast<size_type>(thrust::distance(d_chars, d_end)));
+    return target < 0 ? thrust::nullopt : thrust::optional<size_type>{target};
   }
 
   /**
@@ -229,8 +226,12 @@ struct replace_multi_parallel_fn {
 
   replace_multi_parallel_fn(column_device_view const& d_strings,
                             device_span<string_view const> d_targets,
-                            device_span<string_view const> d_replacements)
-    : d_strings(d_strings), d_targets{d_targets}, d_replacements{d_replacements}
+                            device_span<string_view const> d_replacements,
+                            target_automaton_device_view d_automaton)
+    : d_strings(d_strings),
+      d_targets{d_targets},
+      d_replacements{d_replacements},
+      d_automaton{d_automaton}
   {
   }
 
@@ -238,6 +239,7 @@ struct replace_multi_parallel_fn {
   column_device_view d_strings;
   device_span<string_view const> d_targets;
   device_span<string_view const> d_replacements;
+  target_automaton_device_view d_automaton;
 };
 
 /**
@@ -263,6 +265,7 @@ struct copy_if_fn {
 std::unique_ptr<column> replace_character_parallel(strings_column_view const& input,
                                                    strings_column_view const& targets,
                                                    strings_column_view const& repls,
+                                                   target_automaton const& automaton,
                                                    rmm::cuda_stream_view stream,
                                                    rmm::mr::device_memory_resource* mr)
 {
@@ -278,7 +281,7 @@ std::unique_ptr<column> replace_character_parallel(strings_column_view const& in
   auto d_replacements =
     create_string_vector_from_column(repls, stream, rmm::mr::get_current_device_resource());
 
-  replace_multi_parallel_fn fn{*d_strings, d_targets, d_replacements};
+  replace_multi_parallel_fn fn{*d_strings, d_targets, d_replacements, automaton.device_view()};
 
   // count the number of targets in the entire column
   auto const target_count = thrust::count_if(rmm::exec_policy(stream),
@@ -397,6 +400,7 @@ struct replace_multi_fn {
   column_device_view const d_strings;
   column_device_view const d_targets;
   column_device_view const d_repls;
+  target_automaton_device_view const d_automaton;
   int32_t* d_offsets{};
   char* d_chars{};
 
@@ -414,24 +418,20 @@ struct replace_multi_fn {
     size_type lpos  = 0;
     char* out_ptr   = d_chars ? d_chars + d_offsets[idx] : nullptr;
 
-    // check each character against each target
+    // the first of the targets starting at each character is replaced
     while (spos < d_str.size_bytes()) {
-      for (int tgt_idx = 0; tgt_idx < d_targets.size(); ++tgt_idx) {
-        auto const d_tgt = d_targets.element<string_view>(tgt_idx);
-        if ((d_tgt.size_bytes() <= (d_str.size_bytes() - spos)) &&    // check fit
-            (d_tgt.compare(in_ptr + spos, d_tgt.size_bytes()) == 0))  // and match
-        {
-          auto const d_repl = (d_repls.size() == 1) ? d_repls.element<string_view>(0)
-                                                    : d_repls.element<string_view>(tgt_idx);
-          bytes += d_repl.size_bytes() - d_tgt.size_bytes();
-          if (out_ptr) {
-            out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
-            out_ptr = copy_string(out_ptr, d_repl);
-            lpos    = spos + d_tgt.size_bytes();
-          }
-          spos += d_tgt.size_bytes() - 1;
-          break;
+      auto const tgt_idx = d_automaton.first_target(in_ptr + spos, d_str.size_bytes() - spos);
+      if (tgt_idx >= 0) {
+        auto const d_tgt  = d_targets.element<string_view>(tgt_idx);
+        auto const d_repl = (d_repls.size() == 1) ? d_repls.element<string_view>(0)
+                                                  : d_repls.element<string_view>(tgt_idx);
+        bytes += d_repl.size_bytes() - d_tgt.size_bytes();
+        if (out_ptr) {
+          out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
+          out_ptr = copy_string(out_ptr, d_repl);
+          lpos    = spos + d_tgt.size_bytes();
         }
+        spos += d_tgt.size_bytes() - 1;
       }
       ++spos;
     }
@@ -445,6 +445,7 @@ struct replace_multi_fn {
 std::unique_ptr<column> replace_string_parallel(strings_column_view const& input,
                                                 strings_column_view const& targets,
                                                 strings_column_view const& repls,
+                                                target_automaton const& automaton,
                                                 rmm::cuda_stream_view stream,
                                                 rmm::mr::device_memory_resource* mr)
 {
@@ -453,7 +454,10 @@ std::unique_ptr<column> replace_string_parallel(strings_column_view const& input
   auto d_replacements = column_device_view::create(repls.parent(), stream);
 
   auto [offsets_column, chars] = cudf::strings::detail::make_strings_children(
-    replace_multi_fn{*d_strings, *d_targets, *d_replacements}, input.size(), stream, mr);
+    replace_multi_fn{*d_strings, *d_targets, *d_replacements, automaton.device_view()},
+    input.size(),
+    stream,
+    mr);
 
   return make_strings_column(input.size(),
                              std::move(offsets_column),
@@ -478,11 +482,14 @@ std::unique_ptr<column> replace(strings_column_view const& input,
   if (repls.size() > 1)
     CUDF_EXPECTS(repls.size() == targets.size(), "Sizes for targets and repls must match");
 
+  // empty targets are never matched by the automaton
+  auto const automaton = target_automaton(targets, stream);
+
   return (input.size() == input.null_count() ||
           ((input.chars_size(stream) / (input.size() - input.null_count())) <
            AVG_CHAR_BYTES_THRESHOLD))
-           ? replace_string_parallel(input, targets, repls, stream, mr)
-           : replace_character_parallel(input, targets, repls, stream, mr);
+           ? replace_string_parallel(input, targets, repls, automaton, stream, mr)
+           : replace_character_parallel(input, targets, repls, automaton, stream, mr);
 }
 
 }  // namespace detail
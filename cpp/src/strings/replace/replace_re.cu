@@ -62,6 +62,9 @@ struct replace_regex_fn {
     auto itr      = d_str.begin();
     auto last_pos = itr;
 
+    // strings without the literal required by the pattern have nothing to replace
+    if (!prog.has_required_literal(d_str)) { mxn = 0; }
+
     // copy input to output replacing strings as we go
     while (mxn-- > 0 && itr.position() <= nchars && !prog.is_empty()) {
       auto const match = prog.find(prog_idx, d_str, itr);
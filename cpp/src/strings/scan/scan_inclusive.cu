@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,7 +16,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
-#include <cudf/detail/gather.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/device_operators.cuh>
@@ -27,7 +27,6 @@
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
-#include <thrust/scatter.h>
 
 namespace cudf {
 namespace strings {
@@ -71,9 +70,19 @@ struct min_max_scan_operator {
   }
 };
 
-struct null_iterator {
+/**
+ * @brief Returns the scan result index of a row, or `size` for null rows
+ */
+struct nullify_index_fn {
+  size_type const* result_map;
   bitmask_type const* mask;
-  __device__ bool operator()(size_type idx) const { return !bit_is_set(mask, idx); }
+  bool const has_nulls;
+  size_type const size;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return has_nulls && !bit_is_set(mask, idx) ? size : result_map[idx];
+  }
 };
 
 }  // namespace
@@ -94,24 +103,16 @@ std::unique_ptr<column> scan_inclusive(column_view const& input,
                          result_map.begin(),
                          min_max_scan_operator<cudf::string_view, Op>{*d_input, input.has_nulls()});
 
-  if (input.has_nulls()) {
-    // fill the null rows with out-of-bounds values so gather records them as null;
-    // this prevents un-sanitized null entries in the output
-    auto null_itr = cudf::detail::make_counting_transform_iterator(0, null_iterator{mask});
-    auto oob_val  = thrust::constant_iterator<size_type>(input.size());
-    thrust::scatter_if(rmm::exec_policy(stream),
-                       oob_val,
-                       oob_val + input.size(),
-                       thrust::counting_iterator<size_type>(0),
-                       null_itr,
-                       result_map.data());
-  }
+  // null rows map to an out-of-bounds index so gather records them as null; this prevents
+  // un-sanitized null entries in the output without another pass over the indices
+  auto const gather_map = cudf::detail::make_counting_transform_iterator(
+    0, nullify_index_fn{result_map.data(), mask, input.has_nulls(), input.size()});
 
   // call gather using the indices to build the output column
   auto result_table = cudf::detail::gather(cudf::table_view({input}),
-                                           result_map,
+                                           gather_map,
+                                           gather_map + input.size(),
                                            cudf::out_of_bounds_policy::NULLIFY,
-                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
                                            stream,
                                            mr);
   return std::move(result_table->release().front());
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,26 +14,73 @@
  * limitations under the License.
  */
 
+#include "strings/search/target_automaton.cuh"
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/utf8.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <memory>
+#include <vector>
 
 namespace cudf {
 namespace strings {
 namespace detail {
+namespace {
+
+/**
+ * @brief Scans a string once and calls `fn(target_id, end)` for every occurrence of a target,
+ * where `end` is the character position just after the occurrence.
+ */
+template <typename Fn>
+__device__ void for_each_match(target_automaton_device_view const& d_automaton,
+                               string_view const& d_str,
+                               Fn fn)
+{
+  d_automaton.for_each_empty_target([&](auto target_id) { fn(target_id, 0); });
+  auto const d_chars = reinterpret_cast<uint8_t const*>(d_str.data());
+  size_type node     = 0;
+  size_type chars    = 0;
+  for (size_type idx = 0; idx < d_str.size_bytes(); ++idx) {
+    if (is_begin_utf8_char(d_chars[idx])) { ++chars; }
+    node = d_automaton.next(node, d_chars[idx]);
+    d_automaton.for_each_target(node, [&](auto target_id) { fn(target_id, chars); });
+  }
+}
+
+void validate_targets(strings_column_view const& targets)
+{
+  CUDF_EXPECTS(targets.size() > 0, "Must include at least one search target");
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+}
+
+}  // namespace
+
 std::unique_ptr<column> find_multiple(strings_column_view const& input,
                                       strings_column_view const& targets,
                                       rmm::cuda_stream_view stream,
@@ -41,32 +88,51 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
 {
   auto const strings_count = input.size();
   auto const targets_count = targets.size();
-  CUDF_EXPECTS(targets_count > 0, "Must include at least one search target");
-  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+  validate_targets(targets);
 
   auto strings_column = column_device_view::create(input.parent(), stream);
   auto d_strings      = *strings_column;
   auto targets_column = column_device_view::create(targets.parent(), stream);
   auto d_targets      = *targets_column;
 
+  auto const automaton   = target_automaton(targets, stream);
+  auto const d_automaton = automaton.device_view();
+
+  // the character length of each target locates its occurrences from their ends
+  auto lengths = rmm::device_uvector<size_type>(targets_count, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(targets_count),
+                    lengths.begin(),
+                    [d_targets] __device__(size_type idx) {
+                      return d_targets.element<string_view>(idx).length();
+                    });
+  auto const d_lengths = lengths.data();
+
   auto const total_count = strings_count * targets_count;
 
   // create output column
   auto results = make_numeric_column(
     data_type{type_id::INT32}, total_count, rmm::device_buffer{0, stream, mr}, 0, stream, mr);
+  auto d_results = results->mutable_view().begin<int32_t>();
+  thrust::fill(rmm::exec_policy(stream), d_results, d_results + total_count, -1);
 
-  // fill output column with position values
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(total_count),
-                    results->mutable_view().begin<int32_t>(),
-                    [d_strings, d_targets, targets_count] __device__(size_type idx) {
-                      size_type str_idx = idx / targets_count;
-                      if (d_strings.is_null(str_idx)) return -1;
-                      string_view d_str = d_strings.element<string_view>(str_idx);
-                      string_view d_tgt = d_targets.element<string_view>(idx % targets_count);
-                      return d_str.find(d_tgt);
-                    });
+  // fill output column with the position of the first occurrence of each target
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     [d_strings, d_automaton, d_lengths, d_results, targets_count] __device__(
+                       size_type str_idx) {
+                       if (d_strings.is_null(str_idx)) { return; }
+                       auto const d_output = d_results + str_idx * targets_count;
+                       for_each_match(d_automaton,
+                                      d_strings.element<string_view>(str_idx),
+                                      [&](size_type target_id, size_type end) {
+                                        if (d_output[target_id] < 0) {
+                                          d_output[target_id] = end - d_lengths[target_id];
+                                        }
+                                      });
+                     });
   results->set_null_count(0);
 
   auto offsets = cudf::detail::sequence(strings_count + 1,
@@ -83,6 +149,136 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
                            mr);
 }
 
+std::unique_ptr<table> contains_multiple(strings_column_view const& input,
+                                         strings_column_view const& targets,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  validate_targets(targets);
+
+  auto const automaton   = target_automaton(targets, stream);
+  auto const d_automaton = automaton.device_view();
+  auto d_strings         = column_device_view::create(input.parent(), stream);
+
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<bool*> h_outputs;
+  for (size_type t = 0; t < targets.size(); ++t) {
+    results.push_back(make_numeric_column(data_type{type_id::BOOL8},
+                                          input.size(),
+                                          cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                          input.null_count(),
+                                          stream,
+                                          mr));
+    h_outputs.push_back(results.back()->mutable_view().data<bool>());
+  }
+  auto const outputs = cudf::detail::make_device_uvector_async(
+    h_outputs, stream, rmm::mr::get_current_device_resource());
+  auto const d_outputs     = outputs.data();
+  auto const targets_count = targets.size();
+
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    input.size(),
+    [d_strings = *d_strings, d_automaton, d_outputs, targets_count] __device__(size_type idx) {
+      for (size_type t = 0; t < targets_count; ++t) {
+        d_outputs[t][idx] = false;
+      }
+      if (d_strings.is_null(idx)) { return; }
+      for_each_match(d_automaton,
+                     d_strings.element<string_view>(idx),
+                     [&](size_type target_id, size_type) { d_outputs[target_id][idx] = true; });
+    });
+
+  return std::make_unique<table>(std::move(results));
+}
+
+std::unique_ptr<column> contains_multiple_indices(strings_column_view const& input,
+                                                  strings_column_view const& targets,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  validate_targets(targets);
+
+  auto const strings_count = input.size();
+  auto const targets_count = static_cast<int64_t>(targets.size());
+  auto const automaton     = target_automaton(targets, stream);
+  auto const d_automaton   = automaton.device_view();
+  auto d_strings           = column_device_view::create(input.parent(), stream);
+
+  // count the occurrences of the targets in each string
+  auto match_offsets = rmm::device_uvector<int64_t>(strings_count + 1, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    match_offsets.begin(),
+                    [d_strings = *d_strings, d_automaton] __device__(size_type idx) -> int64_t {
+                      if (d_strings.is_null(idx)) { return 0; }
+                      int64_t count = 0;
+                      for_each_match(d_automaton,
+                                     d_strings.element<string_view>(idx),
+                                     [&](size_type, size_type) { ++count; });
+                      return count;
+                    });
+  match_offsets.set_element_to_zero_async(strings_count, stream);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), match_offsets.begin(), match_offsets.end(), match_offsets.begin());
+  auto const total_matches = match_offsets.back_element(stream);
+
+  // each occurrence is keyed by its row and target, so sorting groups and orders them by row
+  auto keys   = rmm::device_uvector<int64_t>(total_matches, stream);
+  auto d_keys = keys.data();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     [d_strings = *d_strings,
+                      d_automaton,
+                      d_offsets = match_offsets.data(),
+                      d_keys,
+                      targets_count] __device__(size_type idx) {
+                       if (d_strings.is_null(idx)) { return; }
+                       auto d_output = d_keys + d_offsets[idx];
+                       for_each_match(d_automaton,
+                                      d_strings.element<string_view>(idx),
+                                      [&](size_type target_id, size_type) {
+                                        *d_output++ = idx * targets_count + target_id;
+                                      });
+                     });
+  thrust::sort(rmm::exec_policy(stream), keys.begin(), keys.end());
+  auto const keys_end    = thrust::unique(rmm::exec_policy(stream), keys.begin(), keys.end());
+  auto const num_indices = static_cast<size_type>(thrust::distance(keys.begin(), keys_end));
+
+  auto indices = make_numeric_column(
+    data_type{type_id::INT32}, num_indices, rmm::device_buffer{0, stream, mr}, 0, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    keys.begin(),
+                    keys_end,
+                    indices->mutable_view().begin<size_type>(),
+                    [targets_count] __device__(int64_t key) {
+                      return static_cast<size_type>(key % targets_count);
+                    });
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const row_keys = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<int64_t>(0),
+    [targets_count] __device__(int64_t row) { return row * targets_count; });
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      keys.begin(),
+                      keys_end,
+                      row_keys,
+                      row_keys + strings_count + 1,
+                      offsets->mutable_view().begin<size_type>());
+
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           std::move(indices),
+                           input.null_count(),
+                           cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -95,5 +291,23 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
   return detail::find_multiple(input, targets, stream, mr);
 }
 
+std::unique_ptr<table> contains_multiple(strings_column_view const& input,
+                                         strings_column_view const& targets,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_multiple(input, targets, stream, mr);
+}
+
+std::unique_ptr<column> contains_multiple_indices(strings_column_view const& input,
+                                                  strings_column_view const& targets,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_multiple_indices(input, targets, stream, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
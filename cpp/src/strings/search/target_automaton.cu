@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "strings/search/target_automaton.cuh"
+
+#include <cudf/detail/offsets_iterator_factory.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/copy.h>
+
+#include <map>
+#include <queue>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief Host trie of the targets from which the device automaton is flattened.
+ */
+struct host_trie {
+  std::vector<std::map<uint8_t, size_type>> children{1};
+  std::vector<std::vector<size_type>> targets{1};
+
+  void insert(char const* ptr, int64_t bytes, size_type target_id)
+  {
+    size_type node = 0;
+    for (int64_t idx = 0; idx < bytes; ++idx) {
+      auto const byte = static_cast<uint8_t>(ptr[idx]);
+      auto const itr  = children[node].find(byte);
+      if (itr != children[node].end()) {
+        node = itr->second;
+        continue;
+      }
+      auto const child = static_cast<size_type>(children.size());
+      children[node].emplace(byte, child);
+      children.emplace_back();
+      targets.emplace_back();
+      node = child;
+    }
+    targets[node].push_back(target_id);
+  }
+};
+
+}  // namespace
+
+target_automaton::target_automaton(strings_column_view const& targets,
+                                   rmm::cuda_stream_view stream)
+  : _edge_offsets{0, stream},
+    _edge_bytes{0, stream},
+    _edge_nodes{0, stream},
+    _fail_nodes{0, stream},
+    _output_nodes{0, stream},
+    _target_offsets{0, stream},
+    _target_ids{0, stream}
+{
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+
+  // the targets are expected to be few and small compared to the strings they are searched in
+  auto d_offsets   = rmm::device_uvector<int64_t>(targets.size() + 1, stream);
+  auto offsets_itr = cudf::detail::offsetalator_factory::make_input_iterator(targets.offsets(),
+                                                                             targets.offset());
+  thrust::copy(rmm::exec_policy_nosync(stream),
+               offsets_itr,
+               offsets_itr + d_offsets.size(),
+               d_offsets.begin());
+  auto const h_offsets = cudf::detail::make_std_vector_sync(d_offsets, stream);
+  auto const h_chars   = cudf::detail::make_std_vector_sync<char>(
+    device_span<char const>(targets.chars_begin(stream) + h_offsets.front(),
+                            h_offsets.back() - h_offsets.front()),
+    stream);
+
+  host_trie trie;
+  for (size_type t = 0; t < targets.size(); ++t) {
+    trie.insert(h_chars.data() + h_offsets[t] - h_offsets.front(),
+                h_offsets[t + 1] - h_offsets[t],
+                t);
+  }
+  auto const num_nodes = static_cast<size_type>(trie.children.size());
+
+  // fail and output nodes in breadth-first order, so the ones of the shorter prefixes are known
+  std::vector<size_type> fail_nodes(num_nodes, 0);
+  std::vector<size_type> output_nodes(num_nodes, 0);
+  std::queue<size_type> nodes;
+  for (auto const& [byte, child] : trie.children.front()) {
+    nodes.push(child);
+  }
+  while (!nodes.empty()) {
+    auto const node = nodes.front();
+    nodes.pop();
+    for (auto const& [byte, child] : trie.children[node]) {
+      auto fail = fail_nodes[node];
+      while (fail > 0 && trie.children[fail].count(byte) == 0) {
+        fail = fail_nodes[fail];
+      }
+      auto const itr        = trie.children[fail].find(byte);
+      auto const child_fail = itr != trie.children[fail].end() ? itr->second : 0;
+      fail_nodes[child]     = child_fail;
+      output_nodes[child] =
+        trie.targets[child_fail].empty() ? output_nodes[child_fail] : child_fail;
+      nodes.push(child);
+    }
+  }
+
+  std::vector<size_type> edge_offsets{0};
+  std::vector<uint8_t> edge_bytes;
+  std::vector<size_type> edge_nodes;
+  std::vector<size_type> target_offsets{0};
+  std::vector<size_type> target_ids;
+  for (size_type node = 0; node < num_nodes; ++node) {
+    for (auto const& [byte, child] : trie.children[node]) {
+      edge_bytes.push_back(byte);
+      edge_nodes.push_back(child);
+    }
+    edge_offsets.push_back(static_cast<size_type>(edge_bytes.size()));
+    target_ids.insert(target_ids.end(), trie.targets[node].begin(), trie.targets[node].end());
+    target_offsets.push_back(static_cast<size_type>(target_ids.size()));
+  }
+
+  auto const mr   = rmm::mr::get_current_device_resource();
+  _edge_offsets   = cudf::detail::make_device_uvector_async(edge_offsets, stream, mr);
+  _edge_bytes     = cudf::detail::make_device_uvector_async(edge_bytes, stream, mr);
+  _edge_nodes     = cudf::detail::make_device_uvector_async(edge_nodes, stream, mr);
+  _fail_nodes     = cudf::detail::make_device_uvector_async(fail_nodes, stream, mr);
+  _output_nodes   = cudf::detail::make_device_uvector_async(output_nodes, stream, mr);
+  _target_offsets = cudf::detail::make_device_uvector_async(target_offsets, stream, mr);
+  _target_ids     = cudf::detail::make_device_uvector_async(target_ids, stream, mr);
+  // the host vectors are released when returning
+  stream.synchronize();
+}
+
+target_automaton_device_view target_automaton::device_view() const
+{
+  return target_automaton_device_view{_edge_offsets.data(),
+                                      _edge_bytes.data(),
+                                      _edge_nodes.data(),
+                                      _fail_nodes.data(),
+                                      _output_nodes.data(),
+                                      _target_offsets.data(),
+                                      _target_ids.data()};
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+
+#include <cstdint>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Device view of a `target_automaton`.
+ *
+ * The nodes are the prefixes of the target strings, with the root node 0 for the empty prefix.
+ * The edges of a node are sorted by their byte. The fail node of a node is its longest proper
+ * suffix that is also a node, and its output node is the nearest node along the fail nodes at
+ * which targets end.
+ */
+struct target_automaton_device_view {
+  size_type const* edge_offsets;    ///< Offsets of the edges of each node
+  uint8_t const* edge_bytes;        ///< Byte of each edge
+  size_type const* edge_nodes;      ///< Node reached by each edge
+  size_type const* fail_nodes;      ///< Fail node of each node
+  size_type const* output_nodes;    ///< Output node of each node, 0 if none
+  size_type const* target_offsets;  ///< Offsets of the targets ending at each node
+  size_type const* target_ids;      ///< Indices of the targets ending at each node, ascending
+
+  /**
+   * @brief Returns the node reached from `node` by an edge of `byte`, or -1 if there is none.
+   */
+  __device__ size_type child(size_type node, uint8_t byte) const
+  {
+    auto const begin = edge_bytes + edge_offsets[node];
+    auto const end   = edge_bytes + edge_offsets[node + 1];
+    auto const itr   = thrust::lower_bound(thrust::seq, begin, end, byte);
+    return (itr != end && *itr == byte) ? edge_nodes[itr - edge_bytes] : -1;
+  }
+
+  /**
+   * @brief Returns the node of the longest suffix of the bytes scanned up to `node` and `byte`.
+   */
+  __device__ size_type next(size_type node, uint8_t byte) const
+  {
+    auto result = child(node, byte);
+    while (result < 0 && node > 0) {
+      node   = fail_nodes[node];
+      result = child(node, byte);
+    }
+    return result < 0 ? 0 : result;
+  }
+
+  /**
+   * @brief Calls `fn(target_id)` for every non-empty target ending at the bytes scanned up to
+   * `node`.
+   */
+  template <typename Fn>
+  __device__ void for_each_target(size_type node, Fn fn) const
+  {
+    if (target_offsets[node] == target_offsets[node + 1]) { node = output_nodes[node]; }
+    for (; node > 0; node = output_nodes[node]) {
+      for (auto t = target_offsets[node]; t < target_offsets[node + 1]; ++t) {
+        fn(target_ids[t]);
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the smallest index of the non-empty targets matching the beginning of the
+   * given bytes, or -1 if there is none.
+   */
+  __device__ size_type first_target(char const* ptr, size_type bytes) const
+  {
+    size_type result = -1;
+    size_type node   = 0;
+    for (size_type idx = 0; idx < bytes; ++idx) {
+      node = child(node, static_cast<uint8_t>(ptr[idx]));
+      if (node < 0) { break; }
+      if (target_offsets[node] < target_offsets[node + 1]) {
+        auto const id = target_ids[target_offsets[node]];
+        result        = (result < 0 || id < result) ? id : result;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Calls `fn(target_id)` for every empty target, which matches any string.
+   */
+  template <typename Fn>
+  __device__ void for_each_empty_target(Fn fn) const
+  {
+    for (auto t = target_offsets[0]; t < target_offsets[1]; ++t) {
+      fn(target_ids[t]);
+    }
+  }
+};
+
+/**
+ * @brief Aho-Corasick automaton matching a set of target strings in a single pass over a string.
+ *
+ * The automaton is built once for all the targets, and each string is then scanned once
+ * whatever the number of targets instead of once per target.
+ */
+class target_automaton {
+ public:
+  /**
+   * @brief Builds the automaton of the given targets.
+   *
+   * @param targets Strings to search for, with no nulls
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  target_automaton(strings_column_view const& targets, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the device view of the automaton.
+   */
+  [[nodiscard]] target_automaton_device_view device_view() const;
+
+ private:
+  rmm::device_uvector<size_type> _edge_offsets;
+  rmm::device_uvector<uint8_t> _edge_bytes;
+  rmm::device_uvector<size_type> _edge_nodes;
+  rmm::device_uvector<size_type> _fail_nodes;
+  rmm::device_uvector<size_type> _output_nodes;
+  rmm::device_uvector<size_type> _target_offsets;
+  rmm::device_uvector<size_type> _target_ids;
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
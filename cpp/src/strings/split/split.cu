@@ -33,6 +33,7 @@
 #include <rmm/exec_policy.hpp>
 
 #include <cuda/functional>
+#include <thrust/binary_search.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
@@ -391,36 +392,27 @@ std::unique_ptr<column> create_offsets_from_positions(strings_column_view const&
   auto const d_offsets =
     cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
 
-  // first, create a vector of string indices for each position
-  auto indices = rmm::device_uvector<size_type>(positions.size(), stream);
-  thrust::upper_bound(rmm::exec_policy_nosync(stream),
-                      d_offsets,
-                      d_offsets + input.size(),
-                      positions.begin(),
-                      positions.end(),
-                      indices.begin());
-
-  // compute position offsets per string
-  auto counts = rmm::device_uvector<size_type>(input.size(), stream);
-  // memset to zero-out the counts for any null-entries or strings with no positions
-  thrust::uninitialized_fill(rmm::exec_policy_nosync(stream), counts.begin(), counts.end(), 0);
-
-  // next, count the number of positions per string
-  auto d_counts  = counts.data();
-  auto d_indices = indices.data();
-  thrust::for_each_n(
-    rmm::exec_policy_nosync(stream),
-    thrust::counting_iterator<int64_t>(0),
-    positions.size(),
-    [d_indices, d_counts] __device__(int64_t idx) {
-      auto const str_idx = d_indices[idx] - 1;
-      cuda::atomic_ref<size_type, cuda::thread_scope_device> ref{*(d_counts + str_idx)};
-      ref.fetch_add(1L, cuda::std::memory_order_relaxed);
-    });
-
-  // finally, convert the counts into offsets
-  return std::get<0>(
-    cudf::strings::detail::make_offsets_child_column(counts.begin(), counts.end(), stream, mr));
+  // the positions are sorted so each string's positions begin at the first one not before it
+  auto const offsets_type =
+    positions.size() < static_cast<std::size_t>(std::numeric_limits<size_type>::max())
+      ? data_type{type_id::INT32}
+      : data_type{type_id::INT64};
+  auto offsets =
+    make_numeric_column(offsets_type, input.size() + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const find_offsets = [&](auto d_results) {
+    thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                        positions.begin(),
+                        positions.end(),
+                        d_offsets,
+                        d_offsets + input.size() + 1,
+                        d_results);
+  };
+  if (offsets_type.id() == type_id::INT32) {
+    find_offsets(offsets->mutable_view().begin<int32_t>());
+  } else {
+    find_offsets(offsets->mutable_view().begin<int64_t>());
+  }
+  return offsets;
 }
 
 std::unique_ptr<table> split(strings_column_view const& strings_column,
@@ -19,7 +19,8 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sizes_to_offsets_iterator.cuh>
-#include <cudf/detail/utilities/algorithm.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/detail/split_utils.cuh>
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/string_view.cuh>
@@ -27,11 +28,11 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
 #include <cuda/atomic>
 #include <thrust/binary_search.h>
-#include <thrust/copy.h>
-#include <thrust/count.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
@@ -279,6 +280,120 @@ struct rsplit_tokenizer_fn : base_split_tokenizer<rsplit_tokenizer_fn> {
   }
 };
 
+/**
+ * @brief Sets a bit in `d_masks` for each byte of the chars column at which a delimiter starts
+ *
+ * Each warp checks warp-size consecutive bytes at a time and stores their bits as a single
+ * mask so the chars column is read only once.
+ *
+ * @param tokenizer Object used for identifying delimiters
+ * @param d_offsets Offsets values to locate the chars ranges
+ * @param chars_bytes Total number of characters to process
+ * @param d_masks One mask for each warp-size bytes of the chars column
+ */
+template <typename Tokenizer>
+CUDF_KERNEL void delimiter_masks_kernel(Tokenizer tokenizer,
+                                        cudf::detail::input_offsetalator const d_offsets,
+                                        int64_t chars_bytes,
+                                        uint32_t* d_masks)
+{
+  auto const tid        = cudf::detail::grid_1d::global_thread_id();
+  auto const stride     = cudf::detail::grid_1d::grid_stride();
+  auto const warp_bytes = static_cast<int64_t>(cudf::detail::warp_size);
+  // all lanes of a warp iterate the same number of times for the ballot
+  auto const end = ((chars_bytes + warp_bytes - 1) / warp_bytes) * warp_bytes;
+  for (auto idx = tid; idx < end; idx += stride) {
+    auto const found = (idx < chars_bytes) && tokenizer.is_delimiter(idx, d_offsets, chars_bytes);
+    auto const mask  = __ballot_sync(0xffff'ffffu, found);
+    if ((idx % warp_bytes) == 0) { d_masks[idx / warp_bytes] = mask; }
+  }
+}
+
+/**
+ * @brief Returns the position of every delimiter in the chars column of `input`
+ *
+ * The delimiters are found in a single pass over the chars column which records them as
+ * bitmasks. The positions are then counted and written from the bitmasks alone.
+ * These may include overlapping or otherwise out-of-bounds delimiters which
+ * will be resolved during token processing.
+ *
+ * @tparam Tokenizer Type of the tokenizer object
+ *
+ * @param input The input column of strings to split
+ * @param tokenizer Object used for identifying delimiters
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Sorted positions of the delimiters in the chars column
+ */
+template <typename Tokenizer>
+rmm::device_uvector<int64_t> find_delimiter_positions(strings_column_view const& input,
+                                                      Tokenizer tokenizer,
+                                                      rmm::cuda_stream_view stream)
+{
+  auto const first_offset = get_offset_value(input.offsets(), input.offset(), stream);
+  auto const chars_bytes =
+    get_offset_value(input.offsets(), input.offset() + input.size(), stream) - first_offset;
+  auto const d_offsets =
+    cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
+
+  auto const masks_count =
+    cudf::util::div_rounding_up_safe(chars_bytes, int64_t{cudf::detail::warp_size});
+  auto masks = rmm::device_uvector<uint32_t>(masks_count, stream);
+  if (masks_count > 0) {
+    constexpr int block_size = 256;
+    constexpr int max_blocks = 65536;
+    auto const num_blocks    = static_cast<int>(std::min<int64_t>(
+      cudf::util::div_rounding_up_safe(masks_count * cudf::detail::warp_size, int64_t{block_size}),
+      max_blocks));
+    delimiter_masks_kernel<Tokenizer><<<num_blocks, block_size, 0, stream.value()>>>(
+      tokenizer, d_offsets, chars_bytes, masks.data());
+  }
+
+  // count the delimiters for each group of masks
+  constexpr int64_t masks_per_group = 8;
+  auto const groups_count = cudf::util::div_rounding_up_safe(masks_count, masks_per_group);
+  auto group_offsets      = rmm::device_uvector<int64_t>(groups_count + 1, stream);
+  auto const d_masks      = masks.data();
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<int64_t>(0),
+                    thrust::counting_iterator<int64_t>(groups_count),
+                    group_offsets.begin(),
+                    [d_masks, masks_count] __device__(int64_t group) -> int64_t {
+                      auto const end = min((group + 1) * masks_per_group, masks_count);
+                      int64_t count  = 0;
+                      for (auto idx = group * masks_per_group; idx < end; ++idx) {
+                        count += __popc(d_masks[idx]);
+                      }
+                      return count;
+                    });
+  group_offsets.set_element_to_zero_async(groups_count, stream);
+  thrust::exclusive_scan(rmm::exec_policy_nosync(stream),
+                         group_offsets.begin(),
+                         group_offsets.end(),
+                         group_offsets.begin());
+  auto const delimiter_count = group_offsets.back_element(stream);
+
+  // the positions are relative to the beginning of the chars column like the offsets
+  auto delimiter_positions = rmm::device_uvector<int64_t>(delimiter_count, stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<int64_t>(0),
+                     groups_count,
+                     [d_masks,
+                      masks_count,
+                      d_group_offsets = group_offsets.data(),
+                      d_positions     = delimiter_positions.data(),
+                      first_offset] __device__(int64_t group) {
+                       auto d_output  = d_positions + d_group_offsets[group];
+                       auto const end = min((group + 1) * masks_per_group, masks_count);
+                       for (auto idx = group * masks_per_group; idx < end; ++idx) {
+                         for (auto mask = d_masks[idx]; mask != 0; mask &= mask - 1) {
+                           *d_output++ = first_offset + idx * cudf::detail::warp_size +
+                                         (__ffs(mask) - 1);
+                         }
+                       }
+                     });
+  return delimiter_positions;
+}
+
 /**
  * @brief Create offsets for position values within a strings column
  *
@@ -286,7 +401,7 @@ struct rsplit_tokenizer_fn : base_split_tokenizer<rsplit_tokenizer_fn> {
  * The offsets identify the set of positions for each string row.
  *
  * @param input Strings column corresponding to the input positions
- * @param positions Indices of target bytes within the input column
+ * @param positions Sorted indices of target bytes within the input column
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned objects' device memory
  * @return Offsets of the position values for each string in input
@@ -318,33 +433,10 @@ std::pair<std::unique_ptr<column>, rmm::device_uvector<string_index_pair>> split
   rmm::mr::device_memory_resource* mr)
 {
   auto const strings_count = input.size();
-  auto const chars_bytes =
-    get_offset_value(input.offsets(), input.offset() + strings_count, stream) -
-    get_offset_value(input.offsets(), input.offset(), stream);
-  auto const d_offsets =
-    cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
 
-  // count the number of delimiters in the entire column
-  auto const delimiter_count =
-    thrust::count_if(rmm::exec_policy(stream),
-                     thrust::counting_iterator<int64_t>(0),
-                     thrust::counting_iterator<int64_t>(chars_bytes),
-                     [tokenizer, d_offsets, chars_bytes] __device__(int64_t idx) {
-                       return tokenizer.is_delimiter(idx, d_offsets, chars_bytes);
-                     });
-  // Create a vector of every delimiter position in the chars column.
-  // These may include overlapping or otherwise out-of-bounds delimiters which
-  // will be resolved during token processing.
-  auto delimiter_positions = rmm::device_uvector<int64_t>(delimiter_count, stream);
-  auto d_positions         = delimiter_positions.data();
-  cudf::detail::copy_if_safe(
-    thrust::counting_iterator<int64_t>(0),
-    thrust::counting_iterator<int64_t>(chars_bytes),
-    delimiter_positions.begin(),
-    [tokenizer, d_offsets, chars_bytes] __device__(int64_t idx) {
-      return tokenizer.is_delimiter(idx, d_offsets, chars_bytes);
-    },
-    stream);
+  // find every delimiter position in the chars column
+  auto const delimiter_positions = find_delimiter_positions(input, tokenizer, stream);
+  auto const d_positions         = delimiter_positions.data();
 
   // create a vector of offsets to each string's delimiter set within delimiter_positions
   auto const delimiter_offsets =
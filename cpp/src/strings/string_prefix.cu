@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/detail/string_prefix.cuh>
+#include <cudf/strings/string_view.cuh>
+
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/functional>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+rmm::device_uvector<string_prefix> make_string_prefixes(strings_column_view const& input,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  auto prefixes        = rmm::device_uvector<string_prefix>(input.size(), stream, mr);
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(input.size()),
+    prefixes.begin(),
+    cuda::proclaim_return_type<string_prefix>(
+      [d_strings = *d_strings] __device__(size_type idx) -> string_prefix {
+        return d_strings.is_valid(idx) ? make_string_prefix(d_strings.element<string_view>(idx))
+                                       : string_prefix{{0, 0, 0}, 0};
+      }));
+  return prefixes;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
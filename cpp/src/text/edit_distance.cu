@@ -19,6 +19,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -29,13 +30,14 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/reduce.h>
 #include <thrust/scan.h>
-#include <thrust/sequence.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
@@ -43,54 +45,132 @@ namespace nvtext {
 namespace detail {
 namespace {
 
+/**
+ * @brief Number of characters of the shorter string handled by each machine word
+ */
+constexpr cudf::size_type block_width = 64;
+
+/**
+ * @brief Vertical deltas of a block of `block_width` rows of the distance matrix
+ *
+ * Bit `k` of `pv` (`mv`) is set if the difference between rows `k` and `k-1` of the
+ * current column is +1 (-1).
+ */
+struct myers_block {
+  uint64_t pv;
+  uint64_t mv;
+};
+
+/**
+ * @brief Advances a block of the distance matrix by one column
+ *
+ * This is the step of Myers' bit-vector algorithm in the blocked formulation of Hyyrö.
+ *
+ * @param block Vertical deltas of the block, updated to the next column
+ * @param eq Bit `k` is set if row `k` of the block matches the character of the column
+ * @param hin Horizontal delta entering the top of the block
+ * @param last_bit Bit of the last row of the block
+ * @return Horizontal delta leaving the bottom of the block
+ */
+__device__ inline int advance_block(myers_block& block, uint64_t eq, int hin, uint64_t last_bit)
+{
+  auto const xv = eq | block.mv;
+  if (hin < 0) { eq |= 1; }
+  auto const xh   = (((eq & block.pv) + block.pv) ^ block.pv) | eq;
+  auto ph         = block.mv | ~(xh | block.pv);
+  auto mh         = block.pv & xh;
+  auto const hout = (ph & last_bit) ? 1 : ((mh & last_bit) ? -1 : 0);
+  ph <<= 1;
+  mh <<= 1;
+  if (hin < 0) {
+    mh |= 1;
+  } else if (hin > 0) {
+    ph |= 1;
+  }
+  block.pv = mh | ~(xv | ph);
+  block.mv = ph & xv;
+  return hout;
+}
+
+/**
+ * @brief Returns the number of blocks the compute buffer needs for a pair of strings
+ *
+ * A shorter string of up to `block_width` characters is computed in registers.
+ */
+__device__ inline cudf::size_type compute_buffer_size(cudf::string_view const& d_str,
+                                                      cudf::string_view const& d_tgt)
+{
+  auto const n = std::min(d_str.length(), d_tgt.length());
+  return n > block_width ? cudf::util::div_rounding_up_safe(n, block_width) : 0;
+}
+
 /**
  * @brief Compute the Levenshtein distance for each string pair
  *
- * Documentation here: https://www.cuelogic.com/blog/the-levenshtein-algorithm
- * And here: https://en.wikipedia.org/wiki/Levenshtein_distance
+ * This uses Myers' bit-parallel algorithm which advances a column of the distance matrix
+ * with a few word operations per `block_width` characters of the shorter string.
+ *
+ * Documentation here: https://en.wikipedia.org/wiki/Levenshtein_distance
+ * And here: https://doi.org/10.1145/316542.316550
  *
  * @param d_str First string
  * @param d_tgt Second string
- * @param buffer Working buffer for intermediate calculations
+ * @param buffer Working buffer of `compute_buffer_size()` blocks
  * @return The edit distance value
  */
 __device__ cudf::size_type compute_distance(cudf::string_view const& d_str,
                                             cudf::string_view const& d_tgt,
-                                            cudf::size_type* buffer)
+                                            myers_block* buffer)
 {
   auto const str_length = d_str.length();
   auto const tgt_length = d_tgt.length();
   if (str_length == 0) return tgt_length;
   if (tgt_length == 0) return str_length;
 
-  auto begin = str_length < tgt_length ? d_str.begin() : d_tgt.begin();
-  auto itr   = str_length < tgt_length ? d_tgt.begin() : d_str.begin();
+  // the shorter string is the pattern along the rows of the matrix
+  auto const& d_pattern = str_length < tgt_length ? d_str : d_tgt;
+  auto const& d_text    = str_length < tgt_length ? d_tgt : d_str;
   // .first is min and .second is max
   auto const [n, m] = std::minmax(str_length, tgt_length);
-  // setup compute buffer pointers
-  auto v0 = buffer;
-  auto v1 = v0 + n + 1;
-  // initialize v0
-  thrust::sequence(thrust::seq, v0, v1);
-
-  for (int i = 0; i < m; ++i, ++itr) {
-    auto itr_tgt = begin;
-    v1[0]        = i + 1;
-    for (int j = 0; j < n; ++j, ++itr_tgt) {
-      auto sub_cost = v0[j] + (*itr != *itr_tgt);
-      auto del_cost = v0[j + 1] + 1;
-      auto ins_cost = v1[j] + 1;
-      v1[j + 1]     = std::min(std::min(sub_cost, del_cost), ins_cost);
+  auto score        = n;
+
+  if (n <= block_width) {
+    cudf::char_utf8 chars[block_width];
+    thrust::copy(thrust::seq, d_pattern.begin(), d_pattern.end(), chars);
+    auto block          = myers_block{~uint64_t{0}, 0};
+    auto const last_bit = uint64_t{1} << (n - 1);
+    for (auto const chr : d_text) {
+      uint64_t eq = 0;
+      for (cudf::size_type k = 0; k < n; ++k) {
+        eq |= static_cast<uint64_t>(chars[k] == chr) << k;
+      }
+      score += advance_block(block, eq, 1, last_bit);
+    }
+    return score;
+  }
+
+  auto const num_blocks = cudf::util::div_rounding_up_safe(n, block_width);
+  thrust::fill(thrust::seq, buffer, buffer + num_blocks, myers_block{~uint64_t{0}, 0});
+  for (auto const chr : d_text) {
+    auto itr = d_pattern.begin();
+    int hin  = 1;  // the first row of the matrix increases by one per column
+    for (cudf::size_type b = 0; b < num_blocks; ++b) {
+      auto const width = std::min(block_width, n - b * block_width);
+      uint64_t eq      = 0;
+      for (cudf::size_type k = 0; k < width; ++k, ++itr) {
+        eq |= static_cast<uint64_t>(*itr == chr) << k;
+      }
+      hin = advance_block(buffer[b], eq, hin, uint64_t{1} << (width - 1));
     }
-    thrust::swap(v0, v1);
+    score += hin;
   }
-  return v0[n];
+  return score;
 }
 
 struct edit_distance_levenshtein_algorithm {
   cudf::column_device_view d_strings;  // computing these
   cudf::column_device_view d_targets;  // against these;
-  cudf::size_type* d_buffer;           // compute buffer for each string
+  myers_block* d_buffer;               // compute buffer for each string
   std::ptrdiff_t const* d_offsets;     // locate sub-buffer for each string
   cudf::size_type* d_results;          // edit distance values
 
@@ -109,7 +189,7 @@ struct edit_distance_levenshtein_algorithm {
 
 struct edit_distance_matrix_levenshtein_algorithm {
   cudf::column_device_view d_strings;  // computing these against itself
-  cudf::size_type* d_buffer;           // compute buffer for each string
+  myers_block* d_buffer;               // compute buffer for each string
   std::ptrdiff_t const* d_offsets;     // locate sub-buffer for each string
   cudf::size_type* d_results;          // edit distance values
 
@@ -168,8 +248,7 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
                       auto d_tgt = d_targets.size() == 1
                                      ? d_targets.element<cudf::string_view>(0)
                                      : d_targets.element<cudf::string_view>(idx);
-                      // just need 2 integers for each character of the shorter string
-                      return (std::min(d_str.length(), d_tgt.length()) + 1) * 2;
+                      return compute_buffer_size(d_str, d_tgt);
                     });
 
   // get the total size of the temporary compute buffer
@@ -178,7 +257,7 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
   // convert sizes to offsets in-place
   thrust::exclusive_scan(rmm::exec_policy(stream), offsets.begin(), offsets.end(), offsets.begin());
   // create the temporary compute buffer
-  rmm::device_uvector<cudf::size_type> compute_buffer(compute_size, stream);
+  rmm::device_uvector<myers_block> compute_buffer(compute_size, stream);
   auto d_buffer = compute_buffer.data();
 
   auto results = cudf::make_fixed_width_column(cudf::data_type{cudf::type_to_id<cudf::size_type>()},
@@ -238,9 +317,7 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
       cudf::string_view const d_str2 =
         d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
       if (d_str1.empty() || d_str2.empty()) { return; }
-      // the temp size needed is 2 integers per character of the shorter string
-      d_offsets[idx - ((row + 1) * (row + 2)) / 2] =
-        (std::min(d_str1.length(), d_str2.length()) + 1) * 2;
+      d_offsets[idx - ((row + 1) * (row + 2)) / 2] = compute_buffer_size(d_str1, d_str2);
     });
 
   // get the total size for the compute buffer
@@ -249,7 +326,7 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
   // convert sizes to offsets in-place
   thrust::exclusive_scan(rmm::exec_policy(stream), offsets.begin(), offsets.end(), offsets.begin());
   // create the compute buffer
-  rmm::device_uvector<cudf::size_type> compute_buffer(compute_size, stream);
+  rmm::device_uvector<myers_block> compute_buffer(compute_size, stream);
   auto d_buffer = compute_buffer.data();
 
   // compute the edit distance into the output column
@@ -17,10 +17,15 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
@@ -29,14 +34,22 @@
 #include <nvtext/jaccard.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <cub/cub.cuh>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
 #include <thrust/transform.h>
 
+#include <limits>
+
 namespace nvtext {
 namespace detail {
 namespace {
@@ -241,6 +254,206 @@ std::unique_ptr<cudf::column> hash_substrings(cudf::strings_column_view const& c
     stream,
     rmm::mr::get_current_device_resource());
 }
+
+/**
+ * @brief Computes the jaccard of each row from the sorted hashes of the substrings of both
+ * columns, which are built in device memory
+ */
+void jaccard_from_hashes(cudf::strings_column_view const& input1,
+                         cudf::strings_column_view const& input2,
+                         cudf::size_type width,
+                         float* d_results,
+                         rmm::cuda_stream_view stream)
+{
+  // build hashes of the substrings
+  auto const hash1 = hash_substrings(input1, width, stream);
+  auto const hash2 = hash_substrings(input2, width, stream);
+
+  // compute the unique counts in each set and the intersection counts
+  auto const d_uniques1   = compute_unique_counts(hash1->view(), stream);
+  auto const d_uniques2   = compute_unique_counts(hash2->view(), stream);
+  auto const d_intersects = compute_intersect_counts(hash1->view(), hash2->view(), stream);
+
+  // compute the jaccard using the unique counts and the intersect counts
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::counting_iterator<cudf::size_type>(0),
+                    thrust::counting_iterator<cudf::size_type>(input1.size()),
+                    d_results,
+                    jaccard_fn{d_uniques1.data(), d_uniques2.data(), d_intersects.data()});
+}
+
+// Threads per block of `jaccard_small_rows_kernel` and the hashes each thread sorts
+constexpr int block_size       = 256;
+constexpr int items_per_thread = 4;
+// Rows whose strings have at most this many substrings are computed in shared memory
+constexpr cudf::size_type max_block_substrings = block_size * items_per_thread;
+
+/**
+ * @brief Computes the jaccard of each row whose strings have at most `max_block_substrings`
+ * substrings, with a block per row
+ *
+ * The hashes of the substrings of both strings are built and sorted in shared memory, so no
+ * hashes are stored in device memory. The number of substrings of each string is returned in
+ * `d_counts1` and `d_counts2`; the result of the rows with more substrings is not computed.
+ */
+CUDF_KERNEL void jaccard_small_rows_kernel(cudf::column_device_view const d_input1,
+                                           cudf::column_device_view const d_input2,
+                                           cudf::size_type width,
+                                           float* d_results,
+                                           cudf::size_type* d_counts1,
+                                           cudf::size_type* d_counts2)
+{
+  using block_sort   = cub::BlockRadixSort<uint32_t, block_size, items_per_thread>;
+  using block_reduce = cub::BlockReduce<cudf::size_type, block_size>;
+  __shared__ union {
+    typename block_sort::TempStorage sort;
+    typename block_reduce::TempStorage reduce;
+  } temp_storage;
+  __shared__ uint32_t hashes[2][max_block_substrings];
+  __shared__ cudf::size_type counts[2];
+  __shared__ cudf::size_type slots[2];
+
+  auto const idx = static_cast<cudf::size_type>(blockIdx.x);
+  auto const tid = static_cast<cudf::size_type>(threadIdx.x);
+  cudf::string_view const d_strs[2] = {
+    d_input1.is_null(idx) ? cudf::string_view{} : d_input1.element<cudf::string_view>(idx),
+    d_input2.is_null(idx) ? cudf::string_view{} : d_input2.element<cudf::string_view>(idx)};
+
+  // a string has a substring starting at each character but the last `width - 1`
+  for (int s = 0; s < 2; ++s) {
+    cudf::size_type chars = 0;
+    for (auto pos = tid; pos < d_strs[s].size_bytes(); pos += block_size) {
+      chars += cudf::strings::detail::is_begin_utf8_char(d_strs[s].data()[pos]);
+    }
+    auto const total = block_reduce(temp_storage.reduce).Sum(chars);
+    if (tid == 0) {
+      counts[s] = max(0, total + 1 - width);
+      slots[s]  = 0;
+    }
+    __syncthreads();
+  }
+  if (tid == 0) {
+    d_counts1[idx] = counts[0];
+    d_counts2[idx] = counts[1];
+  }
+  if (counts[0] > max_block_substrings || counts[1] > max_block_substrings) { return; }
+
+  // hash and sort the substrings of each string
+  auto const hasher = cudf::hashing::detail::MurmurHash3_x86_32<cudf::string_view>{0};
+  for (int s = 0; s < 2; ++s) {
+    auto const data = d_strs[s].data();
+    auto const size = d_strs[s].size_bytes();
+    for (auto pos = tid; pos < size; pos += block_size) {
+      if (not cudf::strings::detail::is_begin_utf8_char(data[pos])) { continue; }
+      auto end   = pos;
+      auto chars = 0;
+      for (; chars < width && end < size; ++chars) {
+        end += cudf::strings::detail::bytes_in_utf8_byte(data[end]);
+      }
+      if (chars < width) { continue; }
+      hashes[s][atomicAdd(&slots[s], 1)] = hasher(cudf::string_view(data + pos, end - pos));
+    }
+    __syncthreads();
+
+    // the padding sorts after the hashes, an equal hash is equivalent to it
+    uint32_t keys[items_per_thread];
+    for (int i = 0; i < items_per_thread; ++i) {
+      auto const slot = tid * items_per_thread + i;
+      keys[i] = slot < counts[s] ? hashes[s][slot] : std::numeric_limits<uint32_t>::max();
+    }
+    block_sort(temp_storage.sort).Sort(keys);
+    for (int i = 0; i < items_per_thread; ++i) {
+      auto const slot = tid * items_per_thread + i;
+      if (slot < counts[s]) { hashes[s][slot] = keys[i]; }
+    }
+    __syncthreads();
+  }
+
+  // the union is the unique hashes of both strings less the ones they have in common
+  cudf::size_type unions     = 0;
+  cudf::size_type intersects = 0;
+  for (auto slot = tid; slot < counts[0]; slot += block_size) {
+    auto const hash = hashes[0][slot];
+    if (slot > 0 && hashes[0][slot - 1] == hash) { continue; }
+    auto const common = thrust::binary_search(thrust::seq, hashes[1], hashes[1] + counts[1], hash);
+    unions += 1 - common;
+    intersects += common;
+  }
+  for (auto slot = tid; slot < counts[1]; slot += block_size) {
+    unions += (slot == 0 || hashes[1][slot - 1] != hashes[1][slot]);
+  }
+  auto const total_unions = block_reduce(temp_storage.reduce).Sum(unions);
+  __syncthreads();
+  auto const total_intersects = block_reduce(temp_storage.reduce).Sum(intersects);
+  if (tid == 0) {
+    d_results[idx] =
+      total_unions ? static_cast<float>(total_intersects) / static_cast<float>(total_unions) : 0.f;
+  }
+}
+
+/**
+ * @brief Computes the jaccard of the rows that `jaccard_small_rows_kernel` left out
+ *
+ * @param input1 Strings of the first set of each row
+ * @param input2 Strings of the second set of each row
+ * @param width The character width of the substrings
+ * @param counts1 The number of substrings of each string of `input1`
+ * @param counts2 The number of substrings of each string of `input2`
+ * @param d_results The jaccard of each row
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void jaccard_large_rows(cudf::strings_column_view const& input1,
+                        cudf::strings_column_view const& input2,
+                        cudf::size_type width,
+                        rmm::device_uvector<cudf::size_type> const& counts1,
+                        rmm::device_uvector<cudf::size_type> const& counts2,
+                        float* d_results,
+                        rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<cudf::size_type> large_rows(input1.size(), stream);
+  auto const large_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<cudf::size_type>(0),
+    thrust::counting_iterator<cudf::size_type>(input1.size()),
+    large_rows.begin(),
+    [d_counts1 = counts1.data(), d_counts2 = counts2.data()] __device__(cudf::size_type idx) {
+      return d_counts1[idx] > max_block_substrings || d_counts2[idx] > max_block_substrings;
+    });
+  large_rows.resize(thrust::distance(large_rows.begin(), large_end), stream);
+  if (large_rows.is_empty()) { return; }
+
+  // the hashes of a side without any substrings cannot be built, and have nothing in common
+  auto const has_substrings = [&](rmm::device_uvector<cudf::size_type> const& counts) {
+    auto const large_counts =
+      thrust::make_permutation_iterator(counts.begin(), large_rows.begin());
+    return thrust::reduce(rmm::exec_policy(stream),
+                          large_counts,
+                          large_counts + large_rows.size(),
+                          int64_t{0}) > 0;
+  };
+  rmm::device_uvector<float> large_results(large_rows.size(), stream);
+  if (has_substrings(counts1) && has_substrings(counts2)) {
+    auto const large_input =
+      cudf::detail::gather(cudf::table_view({input1.parent(), input2.parent()}),
+                           cudf::device_span<cudf::size_type const>(large_rows),
+                           cudf::out_of_bounds_policy::DONT_CHECK,
+                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                           stream,
+                           rmm::mr::get_current_device_resource());
+    jaccard_from_hashes(cudf::strings_column_view(large_input->get_column(0).view()),
+                        cudf::strings_column_view(large_input->get_column(1).view()),
+                        width,
+                        large_results.data(),
+                        stream);
+  } else {
+    thrust::fill(rmm::exec_policy(stream), large_results.begin(), large_results.end(), 0.f);
+  }
+  thrust::scatter(rmm::exec_policy(stream),
+                  large_results.begin(),
+                  large_results.end(),
+                  large_rows.begin(),
+                  d_results);
+}
 }  // namespace
 
 std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& input1,
@@ -258,29 +471,19 @@ std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& inp
   constexpr auto output_type = cudf::data_type{cudf::type_id::FLOAT32};
   if (input1.is_empty()) { return cudf::make_empty_column(output_type); }
 
-  auto const [d_uniques1, d_uniques2, d_intersects] = [&] {
-    // build hashes of the substrings
-    auto const hash1 = hash_substrings(input1, width, stream);
-    auto const hash2 = hash_substrings(input2, width, stream);
-
-    // compute the unique counts in each set and the intersection counts
-    auto d_uniques1   = compute_unique_counts(hash1->view(), stream);
-    auto d_uniques2   = compute_unique_counts(hash2->view(), stream);
-    auto d_intersects = compute_intersect_counts(hash1->view(), hash2->view(), stream);
-
-    return std::tuple{std::move(d_uniques1), std::move(d_uniques2), std::move(d_intersects)};
-  }();
-
   auto results = cudf::make_numeric_column(
     output_type, input1.size(), cudf::mask_state::UNALLOCATED, stream, mr);
   auto d_results = results->mutable_view().data<float>();
 
-  // compute the jaccard using the unique counts and the intersect counts
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::counting_iterator<cudf::size_type>(0),
-                    thrust::counting_iterator<cudf::size_type>(results->size()),
-                    d_results,
-                    jaccard_fn{d_uniques1.data(), d_uniques2.data(), d_intersects.data()});
+  auto const d_input1 = cudf::column_device_view::create(input1.parent(), stream);
+  auto const d_input2 = cudf::column_device_view::create(input2.parent(), stream);
+  rmm::device_uvector<cudf::size_type> counts1(input1.size(), stream);
+  rmm::device_uvector<cudf::size_type> counts2(input1.size(), stream);
+  jaccard_small_rows_kernel<<<input1.size(), block_size, 0, stream.value()>>>(
+    *d_input1, *d_input2, width, d_results, counts1.data(), counts2.data());
+
+  // the rows with too many substrings for shared memory sort their hashes in device memory
+  jaccard_large_rows(input1, input2, width, counts1, counts2, d_results, stream);
 
   if (input1.null_count() || input2.null_count()) {
     auto [null_mask, null_count] =
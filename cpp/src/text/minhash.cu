@@ -20,14 +20,18 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/sequence.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/hashing/detail/hashing.hpp>
 #include <cudf/hashing/detail/murmurhash3_x64_128.cuh>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <nvtext/minhash.hpp>
 
@@ -35,8 +39,11 @@
 #include <rmm/exec_policy.hpp>
 
 #include <cuda/atomic>
+#include <cuda/functional>
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <limits>
 
@@ -44,6 +51,33 @@ namespace nvtext {
 namespace detail {
 namespace {
 
+/**
+ * @brief Calls `fn(substring)` for the `width` characters substrings of `d_str` handled by
+ * a lane of the warp processing the string
+ *
+ * A string shorter than `width` characters is a single substring.
+ */
+template <typename Fn>
+__device__ void for_each_substring(cudf::string_view const d_str,
+                                   cudf::size_type lane_idx,
+                                   cudf::size_type width,
+                                   Fn fn)
+{
+  auto const begin = d_str.data() + lane_idx;
+  auto const end   = d_str.data() + d_str.size_bytes();
+
+  // each lane hashes 'width' substrings of d_str
+  for (auto itr = begin; itr < end; itr += cudf::detail::warp_size) {
+    if (cudf::strings::detail::is_utf8_continuation_char(*itr)) { continue; }
+    auto const check_str =  // used for counting 'width' characters
+      cudf::string_view(itr, static_cast<cudf::size_type>(thrust::distance(itr, end)));
+    auto const [bytes, left] = cudf::strings::detail::bytes_to_character_position(check_str, width);
+    if ((itr != d_str.data()) && (left > 0)) { continue; }  // true if past the end of the string
+
+    fn(cudf::string_view(itr, bytes));
+  }
+}
+
 /**
  * @brief Compute the minhash of each string for each seed
  *
@@ -87,18 +121,7 @@ CUDF_KERNEL void minhash_kernel(cudf::column_device_view const d_strings,
   }
   __syncwarp();
 
-  auto const begin = d_str.data() + lane_idx;
-  auto const end   = d_str.data() + d_str.size_bytes();
-
-  // each lane hashes 'width' substrings of d_str
-  for (auto itr = begin; itr < end; itr += cudf::detail::warp_size) {
-    if (cudf::strings::detail::is_utf8_continuation_char(*itr)) { continue; }
-    auto const check_str =  // used for counting 'width' characters
-      cudf::string_view(itr, static_cast<cudf::size_type>(thrust::distance(itr, end)));
-    auto const [bytes, left] = cudf::strings::detail::bytes_to_character_position(check_str, width);
-    if ((itr != d_str.data()) && (left > 0)) { continue; }  // true if past the end of the string
-
-    auto const hash_str = cudf::string_view(itr, bytes);
+  for_each_substring(d_str, lane_idx, width, [&](cudf::string_view hash_str) {
     // hashing with each seed on the same section of the string is 10x faster than
     // computing the substrings for each seed
     for (std::size_t seed_idx = 0; seed_idx < seeds.size(); ++seed_idx) {
@@ -116,7 +139,90 @@ CUDF_KERNEL void minhash_kernel(cudf::column_device_view const d_strings,
         ref.fetch_min(hvalue, cuda::std::memory_order_relaxed);
       }
     }
+  });
+}
+
+/**
+ * @brief Mersenne prime 2^61 - 1 used as the modulus of the permutations
+ */
+constexpr uint64_t mersenne_prime = (1UL << 61) - 1;
+
+/**
+ * @brief Returns `(a * hv + b) mod (2^61 - 1)`, a cheap permutation of the hash value `hv`
+ *
+ * Since 2^61 is 1 modulo the prime, the high bits of the product are folded onto its low bits.
+ */
+__device__ inline uint64_t permute_hash(uint64_t hv, uint64_t a, uint64_t b)
+{
+  auto value = static_cast<__uint128_t>(hv) * a + b;
+  value      = (value & mersenne_prime) + (value >> 61);
+  value      = (value & mersenne_prime) + (value >> 61);
+  return static_cast<uint64_t>(value >= mersenne_prime ? value - mersenne_prime : value);
+}
+
+/**
+ * @brief Compute the minhash of each string for each pair of permutation parameters
+ *
+ * Each substring is hashed once with the seed and the hash value is then permuted with
+ * each pair of parameters. This is a warp-per-string algorithm like `minhash_kernel`.
+ *
+ * @tparam HashFunction hash function to use on each substring
+ *
+ * @param d_strings Strings column to process
+ * @param seed Seed for hashing each substring
+ * @param parameter_a Multipliers of the permutations
+ * @param parameter_b Increments of the permutations
+ * @param width Substring window size in characters
+ * @param d_hashes Minhash output values for each string
+ */
+template <
+  typename HashFunction,
+  typename hash_value_type = std::
+    conditional_t<std::is_same_v<typename HashFunction::result_type, uint32_t>, uint32_t, uint64_t>>
+CUDF_KERNEL void minhash_permuted_kernel(cudf::column_device_view const d_strings,
+                                         hash_value_type seed,
+                                         cudf::device_span<hash_value_type const> parameter_a,
+                                         cudf::device_span<hash_value_type const> parameter_b,
+                                         cudf::size_type width,
+                                         hash_value_type* d_hashes)
+{
+  auto const idx = static_cast<std::size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+  if (idx >= (static_cast<std::size_t>(d_strings.size()) *
+              static_cast<std::size_t>(cudf::detail::warp_size))) {
+    return;
+  }
+
+  auto const str_idx  = static_cast<cudf::size_type>(idx / cudf::detail::warp_size);
+  auto const lane_idx = static_cast<cudf::size_type>(idx % cudf::detail::warp_size);
+
+  if (d_strings.is_null(str_idx)) { return; }
+
+  auto const d_str    = d_strings.element<cudf::string_view>(str_idx);
+  auto const d_output = d_hashes + (str_idx * parameter_a.size());
+
+  // initialize hashes output for this string
+  if (lane_idx == 0) {
+    auto const init = d_str.empty() ? 0 : std::numeric_limits<hash_value_type>::max();
+    thrust::fill(thrust::seq, d_output, d_output + parameter_a.size(), init);
   }
+  __syncwarp();
+
+  auto const hasher = HashFunction(seed);
+  for_each_substring(d_str, lane_idx, width, [&](cudf::string_view hash_str) {
+    auto const hvalue = [&] {
+      if constexpr (std::is_same_v<hash_value_type, uint32_t>) {
+        return hasher(hash_str);
+      } else {
+        return thrust::get<0>(hasher(hash_str));
+      }
+    }();
+    for (std::size_t param_idx = 0; param_idx < parameter_a.size(); ++param_idx) {
+      auto const pvalue = static_cast<hash_value_type>(
+        permute_hash(hvalue, parameter_a[param_idx], parameter_b[param_idx]));
+      cuda::atomic_ref<hash_value_type, cuda::thread_scope_block> ref{*(d_output + param_idx)};
+      ref.fetch_min(pvalue, cuda::std::memory_order_relaxed);
+    }
+  });
 }
 
 template <
@@ -158,6 +264,54 @@ std::unique_ptr<cudf::column> minhash_fn(cudf::strings_column_view const& input,
   return hashes;
 }
 
+template <
+  typename HashFunction,
+  typename hash_value_type = std::
+    conditional_t<std::is_same_v<typename HashFunction::result_type, uint32_t>, uint32_t, uint64_t>>
+std::unique_ptr<cudf::column> minhash_permuted_fn(
+  cudf::strings_column_view const& input,
+  hash_value_type seed,
+  cudf::device_span<hash_value_type const> parameter_a,
+  cudf::device_span<hash_value_type const> parameter_b,
+  cudf::size_type width,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!parameter_a.empty(), "Parameters a and b cannot be empty", std::invalid_argument);
+  CUDF_EXPECTS(parameter_a.size() == parameter_b.size(),
+               "Parameters a and b must have the same size",
+               std::invalid_argument);
+  CUDF_EXPECTS(width >= 2,
+               "Parameter width should be an integer value of 2 or greater",
+               std::invalid_argument);
+  CUDF_EXPECTS((static_cast<std::size_t>(input.size()) * parameter_a.size()) <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "The number of parameters times the number of input rows exceeds the column size "
+               "limit",
+               std::overflow_error);
+
+  auto const output_type = cudf::data_type{cudf::type_to_id<hash_value_type>()};
+  if (input.is_empty()) { return cudf::make_empty_column(output_type); }
+
+  auto const d_strings = cudf::column_device_view::create(input.parent(), stream);
+
+  auto hashes = cudf::make_numeric_column(
+    output_type,
+    input.size() * static_cast<cudf::size_type>(parameter_a.size()),
+    cudf::mask_state::UNALLOCATED,
+    stream,
+    mr);
+  auto d_hashes = hashes->mutable_view().data<hash_value_type>();
+
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, block_size};
+  minhash_permuted_kernel<HashFunction>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *d_strings, seed, parameter_a, parameter_b, width, d_hashes);
+
+  return hashes;
+}
+
 std::unique_ptr<cudf::column> build_list_result(cudf::strings_column_view const& input,
                                                 std::unique_ptr<cudf::column>&& hashes,
                                                 cudf::size_type seeds_size,
@@ -233,6 +387,105 @@ std::unique_ptr<cudf::column> minhash64(cudf::strings_column_view const& input,
   auto hashes        = detail::minhash_fn<HashFunction>(input, seeds, width, stream, mr);
   return build_list_result(input, std::move(hashes), seeds.size(), stream, mr);
 }
+
+std::unique_ptr<cudf::column> minhash_permuted(cudf::strings_column_view const& input,
+                                               uint32_t seed,
+                                               cudf::device_span<uint32_t const> parameter_a,
+                                               cudf::device_span<uint32_t const> parameter_b,
+                                               cudf::size_type width,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  using HashFunction = cudf::hashing::detail::MurmurHash3_x86_32<cudf::string_view>;
+  auto hashes        = detail::minhash_permuted_fn<HashFunction>(
+    input, seed, parameter_a, parameter_b, width, stream, mr);
+  return build_list_result(input, std::move(hashes), parameter_a.size(), stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash64_permuted(cudf::strings_column_view const& input,
+                                                 uint64_t seed,
+                                                 cudf::device_span<uint64_t const> parameter_a,
+                                                 cudf::device_span<uint64_t const> parameter_b,
+                                                 cudf::size_type width,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  using HashFunction = cudf::hashing::detail::MurmurHash3_x64_128<cudf::string_view>;
+  auto hashes        = detail::minhash_permuted_fn<HashFunction>(
+    input, seed, parameter_a, parameter_b, width, stream, mr);
+  return build_list_result(input, std::move(hashes), parameter_a.size(), stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_bands(cudf::lists_column_view const& input,
+                                            cudf::size_type band_size,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(band_size > 0, "Parameter band_size must be positive", std::invalid_argument);
+  auto const child_type = input.child().type().id();
+  CUDF_EXPECTS(child_type == cudf::type_id::UINT32 || child_type == cudf::type_id::UINT64,
+               "Input must be a lists column of UINT32 or UINT64 minhash values",
+               cudf::data_type_error);
+
+  auto const output_type = cudf::data_type{cudf::type_id::UINT64};
+  if (input.is_empty()) {
+    return cudf::make_lists_column(0,
+                                   cudf::make_empty_column(cudf::type_to_id<cudf::size_type>()),
+                                   cudf::make_empty_column(output_type),
+                                   0,
+                                   rmm::device_buffer{},
+                                   stream,
+                                   mr);
+  }
+
+  auto const d_input   = cudf::column_device_view::create(input.parent(), stream);
+  auto const d_offsets = input.offsets_begin();
+  auto const sizes     = cudf::detail::make_counting_transform_iterator(
+    0,
+    cuda::proclaim_return_type<cudf::size_type>(
+      [d_input = *d_input, d_offsets, band_size] __device__(cudf::size_type idx) {
+        if (d_input.is_null(idx)) { return 0; }
+        return (d_offsets[idx + 1] - d_offsets[idx]) / band_size;
+      }));
+  auto [offsets, total_bands] =
+    cudf::detail::make_offsets_child_column(sizes, sizes + input.size(), stream, mr);
+
+  auto bands = cudf::make_numeric_column(
+    output_type, total_bands, cudf::mask_state::UNALLOCATED, stream, mr);
+
+  // each band is hashed as the bytes of its minhash values
+  auto const element_size = static_cast<cudf::size_type>(cudf::size_of(input.child().type()));
+  auto const d_values =
+    input.child().head<char>() + static_cast<std::size_t>(input.child().offset()) * element_size;
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    input.size(),
+    [d_offsets,
+     d_values,
+     element_size,
+     band_size,
+     d_band_offsets = offsets->view().data<cudf::size_type>(),
+     d_bands        = bands->mutable_view().data<uint64_t>()] __device__(cudf::size_type idx) {
+      using HashFunction = cudf::hashing::detail::MurmurHash3_x64_128<cudf::string_view>;
+      auto const hasher  = HashFunction(0);
+      auto const begin   = d_values + static_cast<std::size_t>(d_offsets[idx]) * element_size;
+      auto const bytes   = band_size * element_size;
+      for (auto band = d_band_offsets[idx]; band < d_band_offsets[idx + 1]; ++band) {
+        auto const band_str =
+          cudf::string_view(begin + (band - d_band_offsets[idx]) * bytes, bytes);
+        d_bands[band] = thrust::get<0>(hasher(band_str));
+      }
+    });
+
+  return cudf::make_lists_column(input.size(),
+                                 std::move(offsets),
+                                 std::move(bands),
+                                 input.null_count(),
+                                 cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
 }  // namespace detail
 
 std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& input,
@@ -275,4 +528,37 @@ std::unique_ptr<cudf::column> minhash64(cudf::strings_column_view const& input,
   return detail::minhash64(input, seeds, width, stream, mr);
 }
 
+std::unique_ptr<cudf::column> minhash_permuted(cudf::strings_column_view const& input,
+                                               uint32_t seed,
+                                               cudf::device_span<uint32_t const> parameter_a,
+                                               cudf::device_span<uint32_t const> parameter_b,
+                                               cudf::size_type width,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_permuted(input, seed, parameter_a, parameter_b, width, stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash64_permuted(cudf::strings_column_view const& input,
+                                                 uint64_t seed,
+                                                 cudf::device_span<uint64_t const> parameter_a,
+                                                 cudf::device_span<uint64_t const> parameter_b,
+                                                 cudf::size_type width,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash64_permuted(input, seed, parameter_a, parameter_b, width, stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_bands(cudf::lists_column_view const& input,
+                                            cudf::size_type band_size,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_bands(input, band_size, stream, mr);
+}
+
 }  // namespace nvtext
@@ -19,9 +19,13 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/datasource.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <nvtext/detail/load_hash_file.hpp>
 
@@ -35,6 +39,8 @@
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <vector>
 
 namespace nvtext {
@@ -109,6 +115,111 @@ rmm::device_uvector<aux_codepoint_data_type> get_aux_codepoint_data(rmm::cuda_st
 }
 
 namespace {
+
+/**
+ * @brief Magic bytes at the beginning of a binary vocabulary file.
+ */
+constexpr char vocabulary_file_magic[8] = {'N', 'V', 'T', 'X', 'V', 'O', 'C', '1'};
+
+/**
+ * @brief Header of a binary vocabulary file.
+ *
+ * The header is followed by the bin coefficients, the hash table and the bin offsets, in this
+ * order and in the native byte order, so that each table can be copied to device memory as is.
+ */
+struct vocabulary_file_header {
+  char magic[sizeof(vocabulary_file_magic)];
+  uint32_t outer_hash_a;
+  uint32_t outer_hash_b;
+  uint16_t first_token_id;
+  uint16_t separator_token_id;
+  uint16_t unknown_token_id;
+  uint16_t num_bins;
+  uint64_t table_size;
+};
+
+/**
+ * @brief Adds the code point tables used for normalization to a vocabulary.
+ */
+void add_codepoint_tables(hashed_vocabulary& vocabulary, rmm::cuda_stream_view stream)
+{
+  auto cp_metadata            = detail::get_codepoint_metadata(stream);
+  auto const cp_metadata_size = static_cast<cudf::size_type>(cp_metadata.size());
+  vocabulary.cp_metadata = std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::UINT32},
+                                                          cp_metadata_size,
+                                                          cp_metadata.release(),
+                                                          rmm::device_buffer{},
+                                                          0);
+
+  auto aux_cp_table            = detail::get_aux_codepoint_data(stream);
+  auto const aux_cp_table_size = static_cast<cudf::size_type>(aux_cp_table.size());
+  vocabulary.aux_cp_table = std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::UINT64},
+                                                           aux_cp_table_size,
+                                                           aux_cp_table.release(),
+                                                           rmm::device_buffer{},
+                                                           0);
+}
+
+/**
+ * @brief Loads a binary vocabulary file written by `write_vocabulary_file`.
+ *
+ * The file is memory mapped and each table is copied to device memory with a single copy, or
+ * read directly into device memory when the source supports it.
+ */
+std::unique_ptr<hashed_vocabulary> load_vocabulary_binary_file(std::string const& filename,
+                                                               rmm::cuda_stream_view stream,
+                                                               rmm::mr::device_memory_resource* mr)
+{
+  auto source = cudf::io::datasource::create(filename);
+  vocabulary_file_header header{};
+  CUDF_EXPECTS(source->size() >= sizeof(header), "Truncated vocabulary file " + filename);
+  source->host_read(0, sizeof(header), reinterpret_cast<uint8_t*>(&header));
+
+  auto const coefficients_offset = sizeof(header);
+  auto const table_offset        = coefficients_offset + header.num_bins * sizeof(uint64_t);
+  auto const offsets_offset      = table_offset + header.table_size * sizeof(uint64_t);
+  CUDF_EXPECTS(source->size() == offsets_offset + header.num_bins * sizeof(uint16_t),
+               "Truncated vocabulary file " + filename);
+  CUDF_EXPECTS(header.table_size <= std::numeric_limits<cudf::size_type>::max(),
+               "Vocabulary hash table exceeds the column size limit");
+
+  auto read_column = [&](auto element, size_t offset, size_t count) {
+    using T     = decltype(element);
+    auto result = cudf::make_numeric_column(cudf::data_type{cudf::type_to_id<T>()},
+                                            static_cast<cudf::size_type>(count),
+                                            cudf::mask_state::UNALLOCATED,
+                                            stream,
+                                            mr);
+    auto const size   = count * sizeof(T);
+    auto const d_data = result->mutable_view().template data<uint8_t>();
+    if (size == 0) { return result; }
+    if (source->is_device_read_preferred(size)) {
+      source->device_read(offset, size, d_data, stream);
+    } else {
+      auto const buffer = source->host_read(offset, size);
+      CUDF_CUDA_TRY(
+        cudaMemcpyAsync(d_data, buffer->data(), size, cudaMemcpyDefault, stream.value()));
+      // the mapped buffer is released when returning
+      stream.synchronize();
+    }
+    return result;
+  };
+
+  hashed_vocabulary result;
+  result.outer_hash_a       = header.outer_hash_a;
+  result.outer_hash_b       = header.outer_hash_b;
+  result.num_bins           = header.num_bins;
+  result.unknown_token_id   = header.unknown_token_id;
+  result.first_token_id     = header.first_token_id;
+  result.separator_token_id = header.separator_token_id;
+  result.bin_coefficients   = read_column(uint64_t{}, coefficients_offset, header.num_bins);
+  result.table              = read_column(uint64_t{}, table_offset, header.table_size);
+  result.bin_offsets        = read_column(uint16_t{}, offsets_offset, header.num_bins);
+  add_codepoint_tables(result, stream);
+
+  return std::make_unique<hashed_vocabulary>(std::move(result));
+}
+
 /**
  * @brief Convert string to uint32.
  *
@@ -186,6 +297,16 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   std::ifstream hash_file(filename_hashed_vocabulary);
   CUDF_EXPECTS(hash_file.good(), "Could not open " + filename_hashed_vocabulary);
 
+  // binary files are recognized by their magic bytes
+  char magic[sizeof(vocabulary_file_magic)] = {};
+  hash_file.read(magic, sizeof(magic));
+  if (hash_file.gcount() == sizeof(magic) and
+      std::equal(std::begin(magic), std::end(magic), std::begin(vocabulary_file_magic))) {
+    return load_vocabulary_binary_file(filename_hashed_vocabulary, stream, mr);
+  }
+  hash_file.clear();
+  hash_file.seekg(0);
+
   uint64_t line_no = 1;
   std::string line;
   std::getline(hash_file, line);
@@ -266,25 +387,50 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
                                 cudaMemcpyDefault,
                                 stream.value()));
 
-  auto cp_metadata            = detail::get_codepoint_metadata(stream);
-  auto const cp_metadata_size = static_cast<cudf::size_type>(cp_metadata.size());
-  result.cp_metadata = std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::UINT32},
-                                                      cp_metadata_size,
-                                                      cp_metadata.release(),
-                                                      rmm::device_buffer{},
-                                                      0);
-
-  auto aux_cp_table            = detail::get_aux_codepoint_data(stream);
-  auto const aux_cp_table_size = static_cast<cudf::size_type>(aux_cp_table.size());
-  result.aux_cp_table = std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::UINT64},
-                                                       aux_cp_table_size,
-                                                       aux_cp_table.release(),
-                                                       rmm::device_buffer{},
-                                                       0);
+  add_codepoint_tables(result, stream);
 
   return std::make_unique<hashed_vocabulary>(std::move(result));
 }
 
+void write_vocabulary_file(hashed_vocabulary const& vocabulary,
+                           std::string const& filename,
+                           rmm::cuda_stream_view stream)
+{
+  auto to_host = [stream](auto element, cudf::column const& column) {
+    using T = decltype(element);
+    return cudf::detail::make_std_vector_sync(
+      cudf::device_span<T const>(column.view().data<T>(), column.size()), stream);
+  };
+  auto const bin_coefficients = to_host(uint64_t{}, *vocabulary.bin_coefficients);
+  auto const table            = to_host(uint64_t{}, *vocabulary.table);
+  auto const bin_offsets      = to_host(uint16_t{}, *vocabulary.bin_offsets);
+  CUDF_EXPECTS(bin_coefficients.size() == vocabulary.num_bins and
+                 bin_offsets.size() == vocabulary.num_bins,
+               "Vocabulary bin tables must have one entry per bin");
+
+  vocabulary_file_header header{};
+  std::copy(std::begin(vocabulary_file_magic), std::end(vocabulary_file_magic), header.magic);
+  header.outer_hash_a       = vocabulary.outer_hash_a;
+  header.outer_hash_b       = vocabulary.outer_hash_b;
+  header.first_token_id     = vocabulary.first_token_id;
+  header.separator_token_id = vocabulary.separator_token_id;
+  header.unknown_token_id   = vocabulary.unknown_token_id;
+  header.num_bins           = vocabulary.num_bins;
+  header.table_size         = table.size();
+
+  std::ofstream outfile(filename, std::ofstream::out | std::ofstream::binary);
+  CUDF_EXPECTS(outfile.good(), "Could not open " + filename);
+  auto write = [&outfile](auto const& data, size_t size) {
+    outfile.write(reinterpret_cast<char const*>(data), size);
+  };
+  write(&header, sizeof(header));
+  write(bin_coefficients.data(), bin_coefficients.size() * sizeof(uint64_t));
+  write(table.data(), table.size() * sizeof(uint64_t));
+  write(bin_offsets.data(), bin_offsets.size() * sizeof(uint16_t));
+  outfile.close();
+  CUDF_EXPECTS(outfile.good(), "Could not write " + filename);
+}
+
 }  // namespace detail
 
 std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
@@ -294,4 +440,12 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   return detail::load_vocabulary_file(filename_hashed_vocabulary, cudf::get_default_stream(), mr);
 }
 
+void write_vocabulary_file(hashed_vocabulary const& vocabulary,
+                           std::string const& filename,
+                           rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  detail::write_vocabulary_file(vocabulary, filename, stream);
+}
+
 }  // namespace nvtext
@@ -18,26 +18,36 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/sequence.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <nvtext/detail/load_hash_file.hpp>
+#include <nvtext/detail/subword_tokenize.hpp>
 #include <nvtext/subword_tokenize.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/tabulate.h>
+#include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace nvtext {
 namespace detail {
 namespace {
@@ -157,6 +167,72 @@ tokenizer_result build_empty_result(cudf::size_type size,
     0, max_sequence_length, std::move(ids), std::move(mask), std::move(metadata)};
 }
 
+/**
+ * @brief Tokenizes the strings in batches of rows of about `max_batch_bytes` bytes each.
+ *
+ * A batch holds at least one row, so a single longer string is tokenized in its own batch.
+ *
+ * @return The token ids of the strings and the offsets of the token ids of each string
+ */
+uvector_pair tokenize_in_batches(wordpiece_tokenizer& tokenizer,
+                                 cudf::strings_column_view const& input,
+                                 int64_t max_batch_bytes,
+                                 rmm::cuda_stream_view stream)
+{
+  auto const strings_count = input.size();
+  auto const d_offsets =
+    cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
+  rmm::device_uvector<int64_t> d_row_offsets(strings_count + 1, stream);
+  thrust::copy_n(rmm::exec_policy(stream), d_offsets, strings_count + 1, d_row_offsets.begin());
+  auto const row_offsets  = cudf::detail::make_std_vector_sync(d_row_offsets, stream);
+  auto const first_offset = row_offsets.front();
+  if (row_offsets.back() - first_offset <= max_batch_bytes) {
+    return tokenizer.tokenize(input, stream);
+  }
+
+  // each batch begins at the first row beginning at or after a multiple of max_batch_bytes
+  std::vector<cudf::size_type> bounds;
+  for (auto target = first_offset; target < row_offsets.back(); target += max_batch_bytes) {
+    auto const row = std::lower_bound(row_offsets.begin(), row_offsets.end(), target);
+    bounds.push_back(static_cast<cudf::size_type>(std::distance(row_offsets.begin(), row)));
+  }
+  bounds.push_back(strings_count);
+  bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+  auto offsets = std::make_unique<rmm::device_uvector<int64_t>>(strings_count + 1, stream);
+  offsets->set_element_to_zero_async(0, stream);
+  std::vector<rmm::device_uvector<uint32_t>> batch_token_ids;
+  int64_t total_tokens = 0;
+  for (std::size_t idx = 0; idx + 1 < bounds.size(); ++idx) {
+    auto const batch = cudf::strings_column_view(
+      cudf::detail::slice(input.parent(), bounds[idx], bounds[idx + 1], stream));
+    auto const tokens     = tokenizer.tokenize(batch, stream);
+    auto const num_tokens = tokens.second->back_element(stream);
+    // copying the token ids releases the working memory of the batch
+    batch_token_ids.emplace_back(num_tokens, stream);
+    thrust::copy_n(
+      rmm::exec_policy(stream), tokens.first->begin(), num_tokens, batch_token_ids.back().begin());
+    thrust::transform(rmm::exec_policy(stream),
+                      tokens.second->begin() + 1,
+                      tokens.second->end(),
+                      offsets->begin() + bounds[idx] + 1,
+                      [total_tokens] __device__(int64_t offset) { return offset + total_tokens; });
+    total_tokens += num_tokens;
+  }
+
+  auto token_ids = std::make_unique<rmm::device_uvector<uint32_t>>(total_tokens, stream);
+  auto d_output  = token_ids->data();
+  for (auto const& ids : batch_token_ids) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(d_output,
+                                  ids.data(),
+                                  ids.size() * sizeof(uint32_t),
+                                  cudaMemcpyDeviceToDevice,
+                                  stream.value()));
+    d_output += ids.size();
+  }
+  return uvector_pair(std::move(token_ids), std::move(offsets));
+}
+
 }  // namespace
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -165,11 +241,13 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   uint32_t stride,
                                   bool do_lower_case,
                                   bool do_truncate,
+                                  int64_t max_batch_bytes,
                                   rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr)
 {
   CUDF_EXPECTS(stride <= max_sequence_length,
                "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_batch_bytes > 0, "max_batch_bytes must be positive");
   auto const strings_count = strings.size();
   if (strings_count == strings.null_count()) {  // empty or all-null returns empty
     return tokenizer_result{0,
@@ -188,7 +266,7 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
   wordpiece_tokenizer tokenizer(
     vocab_table, max_sequence_length, stride, do_truncate, do_lower_case);
   // Run tokenizer
-  auto const tokens = tokenizer.tokenize(strings, stream);
+  auto const tokens = tokenize_in_batches(tokenizer, strings, max_batch_bytes, stream);
   // assign output components
   auto device_token_ids = tokens.first->data();
   auto device_offsets   = tokens.second->data();
@@ -301,6 +379,7 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   stride,
                                   do_lower_case,
                                   do_truncate,
+                                  default_max_batch_bytes,
                                   cudf::get_default_stream(),
                                   mr);
 }
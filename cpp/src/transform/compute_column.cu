@@ -23,6 +23,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -30,10 +31,18 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -52,12 +61,14 @@ namespace detail {
  * @param device_expression_data Container of device data required to evaluate the desired
  * expression.
  * @param output_column The destination for the results of evaluating the expression.
+ * @param selection Rows of `table` to evaluate, one per output row, or nullptr for all rows
  */
 template <cudf::size_type max_block_size, bool has_nulls>
 __launch_bounds__(max_block_size) CUDF_KERNEL
   void compute_column_kernel(table_device_view const table,
                              ast::detail::expression_device_view device_expression_data,
-                             mutable_column_device_view output_column)
+                             mutable_column_device_view output_column,
+                             size_type const* selection)
 {
   // The (required) extern storage of the shared memory array leads to
   // conflicting declarations between different templates. The easiest
@@ -74,16 +85,81 @@ __launch_bounds__(max_block_size) CUDF_KERNEL
   auto evaluator =
     cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
 
+  for (thread_index_type row_index = start_idx; row_index < output_column.size();
+       row_index += stride) {
+    auto output_dest     = ast::detail::mutable_column_expression_result<has_nulls>(output_column);
+    auto const input_row = selection != nullptr ? selection[row_index] : row_index;
+    evaluator.evaluate(output_dest, input_row, input_row, row_index, thread_intermediate_storage);
+  }
+}
+
+/**
+ * @brief Kernel for evaluating several expressions on a table to produce new columns.
+ *
+ * Each thread evaluates all the expressions of a row at once, so the operands and intermediates
+ * shared by several expressions are loaded and computed once.
+ *
+ * @tparam max_block_size The size of the thread block, used to set launch
+ * bounds and minimize register usage.
+ * @tparam has_nulls whether or not the output columns may contain nulls.
+ *
+ * @param table The table device view used for evaluation.
+ * @param device_expression_data Container of device data required to evaluate the desired
+ * expressions.
+ * @param output_columns The destinations for the results of evaluating the expressions.
+ */
+template <cudf::size_type max_block_size, bool has_nulls>
+__launch_bounds__(max_block_size) CUDF_KERNEL
+  void compute_columns_kernel(table_device_view const table,
+                              ast::detail::expression_device_view device_expression_data,
+                              mutable_column_device_view* output_columns)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+  auto start_idx    = cudf::detail::grid_1d::global_thread_id();
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  auto evaluator =
+    cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
+
   for (thread_index_type row_index = start_idx; row_index < table.num_rows(); row_index += stride) {
-    auto output_dest = ast::detail::mutable_column_expression_result<has_nulls>(output_column);
+    auto output_dest = ast::detail::mutable_table_expression_result<has_nulls>(output_columns);
     evaluator.evaluate(output_dest, row_index, thread_intermediate_storage);
   }
 }
 
-std::unique_ptr<column> compute_column(table_view const& table,
-                                       ast::expression const& expr,
-                                       rmm::cuda_stream_view stream,
-                                       rmm::mr::device_memory_resource* mr)
+namespace {
+
+/**
+ * @brief Returns the block size of a kernel evaluating a plan, which is limited by the shared
+ * memory storing the intermediates of the threads.
+ */
+template <cudf::size_type max_block_size>
+cudf::size_type evaluation_block_size(ast::detail::expression_parser const& parser)
+{
+  int device_id;
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  return parser.shmem_per_thread != 0
+           ? std::min(max_block_size, shmem_limit_per_block / parser.shmem_per_thread)
+           : max_block_size;
+}
+
+/**
+ * @brief Evaluates an expression on the rows of a table listed in `selection`, or on all rows if
+ * `selection` is empty and `num_rows` is the number of rows of the table.
+ */
+std::unique_ptr<column> compute_selected_rows(table_view const& table,
+                                              ast::expression const& expr,
+                                              device_span<size_type const> selection,
+                                              size_type num_rows,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
 {
   // If evaluating the expression may produce null outputs we create a nullable
   // output column and follow the null-supporting expression evaluation code
@@ -96,36 +172,29 @@ std::unique_ptr<column> compute_column(table_view const& table,
     has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED;
 
   auto output_column = cudf::make_fixed_width_column(
-    parser.output_type(), table.num_rows(), output_column_mask_state, stream, mr);
-  if (table.num_rows() == 0) { return output_column; }
+    parser.output_type(), num_rows, output_column_mask_state, stream, mr);
+  if (num_rows == 0) { return output_column; }
   auto mutable_output_device =
     cudf::mutable_column_device_view::create(output_column->mutable_view(), stream);
 
   // Configure kernel parameters
   auto const& device_expression_data = parser.device_expression_data;
-  int device_id;
-  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
-  int shmem_limit_per_block;
-  CUDF_CUDA_TRY(
-    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
-  auto constexpr MAX_BLOCK_SIZE = 128;
-  auto const block_size =
-    parser.shmem_per_thread != 0
-      ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / parser.shmem_per_thread)
-      : MAX_BLOCK_SIZE;
-  auto const config          = cudf::detail::grid_1d{table.num_rows(), block_size};
+  auto constexpr MAX_BLOCK_SIZE      = 128;
+  auto const block_size              = evaluation_block_size<MAX_BLOCK_SIZE>(parser);
+  auto const config          = cudf::detail::grid_1d{num_rows, block_size};
   auto const shmem_per_block = parser.shmem_per_thread * config.num_threads_per_block;
 
   // Execute the kernel
-  auto table_device = table_device_view::create(table, stream);
+  auto table_device        = table_device_view::create(table, stream);
+  auto const selected_rows = selection.empty() ? nullptr : selection.data();
   if (has_nulls) {
     cudf::detail::compute_column_kernel<MAX_BLOCK_SIZE, true>
       <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
-        *table_device, device_expression_data, *mutable_output_device);
+        *table_device, device_expression_data, *mutable_output_device, selected_rows);
   } else {
     cudf::detail::compute_column_kernel<MAX_BLOCK_SIZE, false>
       <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
-        *table_device, device_expression_data, *mutable_output_device);
+        *table_device, device_expression_data, *mutable_output_device, selected_rows);
   }
   CUDF_CHECK_CUDA(stream.value());
   output_column->set_null_count(
@@ -133,6 +202,101 @@ std::unique_ptr<column> compute_column(table_view const& table,
   return output_column;
 }
 
+}  // namespace
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return compute_selected_rows(table, expr, {}, table.num_rows(), stream, mr);
+}
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       selection_vector const& selection,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(table.num_rows() == selection.source_rows(),
+               "Table size does not match the selection",
+               std::invalid_argument);
+  return compute_selected_rows(table, expr, selection.indices(), selection.size(), stream, mr);
+}
+
+std::vector<std::unique_ptr<column>> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& exprs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (exprs.empty()) { return {}; }
+
+  // Outputs of expressions which may produce nulls are nullable, and the null-supporting code
+  // path evaluates all the expressions if any of them may produce nulls
+  auto nullable_outputs = std::vector<bool>{};
+  std::transform(exprs.cbegin(),
+                 exprs.cend(),
+                 std::back_inserter(nullable_outputs),
+                 [&](auto const& expr) { return expr.get().may_evaluate_null(table, stream); });
+  auto const has_nulls =
+    std::any_of(nullable_outputs.cbegin(), nullable_outputs.cend(), [](auto v) { return v; });
+
+  auto const parser = ast::detail::expression_parser{exprs, table, has_nulls, stream, mr};
+
+  auto const output_column_mask_state =
+    has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED;
+  auto output_columns = std::vector<std::unique_ptr<column>>{};
+  for (auto const type : parser.output_types()) {
+    output_columns.push_back(cudf::make_fixed_width_column(
+      type, table.num_rows(), output_column_mask_state, stream, mr));
+  }
+  if (table.num_rows() == 0) { return output_columns; }
+
+  std::vector<std::unique_ptr<mutable_column_device_view,
+                              std::function<void(mutable_column_device_view*)>>>
+    device_views;
+  auto h_output_views = std::vector<mutable_column_device_view>{};
+  for (auto& output : output_columns) {
+    device_views.push_back(mutable_column_device_view::create(output->mutable_view(), stream));
+    h_output_views.push_back(*device_views.back());
+  }
+  auto d_output_views = cudf::detail::make_device_uvector_async(
+    h_output_views, stream, rmm::mr::get_current_device_resource());
+
+  // Configure kernel parameters
+  auto const& device_expression_data = parser.device_expression_data;
+  auto constexpr MAX_BLOCK_SIZE      = 128;
+  auto const block_size              = evaluation_block_size<MAX_BLOCK_SIZE>(parser);
+  auto const config          = cudf::detail::grid_1d{table.num_rows(), block_size};
+  auto const shmem_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+  // Execute the kernel
+  auto table_device = table_device_view::create(table, stream);
+  if (has_nulls) {
+    cudf::detail::compute_columns_kernel<MAX_BLOCK_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, device_expression_data, d_output_views.data());
+  } else {
+    cudf::detail::compute_columns_kernel<MAX_BLOCK_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, device_expression_data, d_output_views.data());
+  }
+  CUDF_CHECK_CUDA(stream.value());
+
+  for (std::size_t idx = 0; idx < output_columns.size(); ++idx) {
+    auto& output = output_columns[idx];
+    if (!nullable_outputs[idx]) {
+      // the output of an expression which cannot produce nulls has no null mask
+      output->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);
+    } else {
+      output->set_null_count(
+        cudf::detail::null_count(output->view().null_mask(), 0, output->size(), stream));
+    }
+  }
+  return output_columns;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> compute_column(table_view const& table,
@@ -143,4 +307,22 @@ std::unique_ptr<column> compute_column(table_view const& table,
   return detail::compute_column(table, expr, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       selection_vector const& selection,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, selection, cudf::get_default_stream(), mr);
+}
+
+std::vector<std::unique_ptr<column>> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& exprs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_columns(table, exprs, cudf::get_default_stream(), mr);
+}
+
 }  // namespace cudf
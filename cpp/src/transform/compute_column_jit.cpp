@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jit/cache.hpp"
+#include "jit/util.hpp"
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <jit_preprocessed_files/transform/jit/expression_kernel.cu.jit.hpp>
+
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+namespace {
+
+using ast::ast_operator;
+
+/**
+ * @brief Returns the CUDA expression computing an operator like its non-nullable
+ * `ast::detail::operator_functor`, or nullopt if the operator has no generated code
+ *
+ * @param op The operator
+ * @param args Names of the operand values
+ * @param type Type of the operands
+ */
+std::optional<std::string> operation_source(ast_operator op,
+                                            std::vector<std::string> const& args,
+                                            data_type type)
+{
+  auto const is_float  = type.id() == type_id::FLOAT32;
+  auto const is_double = type.id() == type_id::FLOAT64;
+  auto infix           = [&](std::string const& symbol) {
+    return "(" + args[0] + " " + symbol + " " + args[1] + ")";
+  };
+  // math function of the input type for floating-point inputs and of double otherwise
+  auto math = [&](std::string const& name) {
+    if (is_float) { return name + "f(" + args[0] + ")"; }
+    if (is_double) { return name + "(" + args[0] + ")"; }
+    return name + "(static_cast<double>(" + args[0] + "))";
+  };
+  auto to_double = [&](std::string const& arg) { return "static_cast<double>(" + arg + ")"; };
+  auto mod       = [&](std::string const& lhs, std::string const& rhs) {
+    if (is_float) { return "fmodf(" + lhs + ", " + rhs + ")"; }
+    if (is_double) { return "fmod(" + lhs + ", " + rhs + ")"; }
+    return "(" + lhs + " % " + rhs + ")";
+  };
+
+  switch (op) {
+    case ast_operator::ADD: return infix("+");
+    case ast_operator::SUB: return infix("-");
+    case ast_operator::MUL: return infix("*");
+    case ast_operator::DIV: return infix("/");
+    case ast_operator::TRUE_DIV: return "(" + to_double(args[0]) + " / " + to_double(args[1]) + ")";
+    case ast_operator::FLOOR_DIV:
+      return "floor(" + to_double(args[0]) + " / " + to_double(args[1]) + ")";
+    case ast_operator::MOD: return mod(args[0], args[1]);
+    case ast_operator::PYMOD: return mod(mod(args[0], args[1]) + " + " + args[1], args[1]);
+    case ast_operator::POW:
+      if (is_float) { return "powf(" + args[0] + ", " + args[1] + ")"; }
+      if (is_double) { return "pow(" + args[0] + ", " + args[1] + ")"; }
+      return "pow(" + to_double(args[0]) + ", " + to_double(args[1]) + ")";
+    case ast_operator::EQUAL:
+    case ast_operator::NULL_EQUAL: return infix("==");
+    case ast_operator::NOT_EQUAL: return infix("!=");
+    case ast_operator::LESS: return infix("<");
+    case ast_operator::GREATER: return infix(">");
+    case ast_operator::LESS_EQUAL: return infix("<=");
+    case ast_operator::GREATER_EQUAL: return infix(">=");
+    case ast_operator::BITWISE_AND: return infix("&");
+    case ast_operator::BITWISE_OR: return infix("|");
+    case ast_operator::BITWISE_XOR: return infix("^");
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND: return infix("&&");
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR: return infix("||");
+    case ast_operator::IDENTITY: return args[0];
+    case ast_operator::IS_NULL: return std::string{"false"};
+    case ast_operator::SIN: return math("sin");
+    case ast_operator::COS: return math("cos");
+    case ast_operator::TAN: return math("tan");
+    case ast_operator::ARCSIN: return math("asin");
+    case ast_operator::ARCCOS: return math("acos");
+    case ast_operator::ARCTAN: return math("atan");
+    case ast_operator::SINH: return math("sinh");
+    case ast_operator::COSH: return math("cosh");
+    case ast_operator::TANH: return math("tanh");
+    case ast_operator::ARCSINH: return math("asinh");
+    case ast_operator::ARCCOSH: return math("acosh");
+    case ast_operator::ARCTANH: return math("atanh");
+    case ast_operator::EXP: return math("exp");
+    case ast_operator::LOG: return math("log");
+    case ast_operator::SQRT: return math("sqrt");
+    case ast_operator::CBRT: return math("cbrt");
+    case ast_operator::CEIL: return math("ceil");
+    case ast_operator::FLOOR: return math("floor");
+    case ast_operator::RINT: return math("rint");
+    case ast_operator::ABS:
+      if (is_float || is_double) { return math("fabs"); }
+      if (!is_unsigned(type)) {
+        return "(" + args[0] + " < 0 ? -" + args[0] + " : " + args[0] + ")";
+      }
+      return args[0];
+    case ast_operator::BIT_INVERT: return "(~" + args[0] + ")";
+    case ast_operator::NOT: return "(!" + args[0] + ")";
+    case ast_operator::CAST_TO_INT64: return "static_cast<int64_t>(" + args[0] + ")";
+    case ast_operator::CAST_TO_UINT64: return "static_cast<uint64_t>(" + args[0] + ")";
+    case ast_operator::CAST_TO_FLOAT64: return to_double(args[0]);
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Generated source of an expression and the data it reads
+ */
+struct expression_source {
+  std::string source;               ///< Definition of `GENERIC_EXPRESSION_OP`
+  std::vector<void const*> inputs;  ///< Data of the columns and literals read by the source
+};
+
+/**
+ * @brief Generates the CUDA source of `GENERIC_EXPRESSION_OP` which evaluates the linearized
+ * expression of `parser` on a row
+ *
+ * Each operator becomes a local value so the compiler keeps the intermediates in registers
+ * instead of the shared memory storage of the interpreter.
+ *
+ * @return The generated source, or nullopt if the expression references non-numeric types or
+ * operators with no generated code
+ */
+std::optional<expression_source> generate_expression_source(
+  ast::detail::expression_parser const& parser, table_view const& table)
+{
+  using ast::detail::device_data_reference_type;
+  auto const& references = parser.data_references();
+  for (auto const& ref : references) {
+    if (!is_numeric(ref.data_type)) { return std::nullopt; }
+  }
+
+  expression_source result;
+  std::vector<std::string> names(references.size());
+  std::ostringstream body;
+  auto load = [&](std::size_t idx, std::string const& value) {
+    names[idx] = "in" + std::to_string(result.inputs.size());
+    body << "  auto const " << names[idx] << " = " << value << ";\n";
+  };
+  for (std::size_t idx = 0; idx < references.size(); ++idx) {
+    auto const& ref       = references[idx];
+    auto const type_name  = type_to_name(ref.data_type);
+    auto const input_name = "inputs[" + std::to_string(result.inputs.size()) + "]";
+    if (ref.reference_type == device_data_reference_type::COLUMN &&
+        ref.table_source == ast::table_reference::LEFT) {
+      load(idx, "static_cast<" + type_name + " const*>(" + input_name + ")[row]");
+      result.inputs.push_back(cudf::jit::get_data_ptr(table.column(ref.data_index)));
+    } else if (ref.reference_type == device_data_reference_type::LITERAL) {
+      load(idx, "*static_cast<" + type_name + " const*>(" + input_name + ")");
+      result.inputs.push_back(parser.literals()[ref.data_index].data());
+    }
+  }
+
+  auto const& operators      = parser.operators();
+  auto const& source_indices = parser.operator_source_indices();
+  std::size_t position       = 0;
+  for (std::size_t op_idx = 0; op_idx < operators.size(); ++op_idx) {
+    auto const op    = operators[op_idx];
+    auto const arity = ast::detail::ast_operator_arity(op);
+    std::vector<std::string> args;
+    for (cudf::size_type arg = 0; arg < arity; ++arg) {
+      args.push_back(names[source_indices[position + arg]]);
+    }
+    auto const value =
+      operation_source(op, args, references[source_indices[position]].data_type);
+    if (!value.has_value()) { return std::nullopt; }
+
+    auto const output = source_indices[position + arity];
+    position += arity + 1;
+    // an intermediate storage location may be reused, so each write is a new local value
+    if (references[output].table_source == ast::table_reference::OUTPUT) {
+      auto const type_name = type_to_name(references[output].data_type);
+      body << "  static_cast<" << type_name << "*>(output)[row] = static_cast<" << type_name
+           << ">(" << *value << ");\n";
+    } else {
+      names[output] = "t" + std::to_string(op_idx);
+      body << "  auto const " << names[output] << " = " << *value << ";\n";
+    }
+  }
+
+  result.source =
+    "#pragma once\n"
+    "__device__ inline void GENERIC_EXPRESSION_OP(cudf::size_type row, void* output, "
+    "void const* const* inputs)\n{\n" +
+    body.str() + "}\n";
+  return result;
+}
+
+}  // namespace
+}  // namespace jit
+}  // namespace transformation
+
+namespace detail {
+
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  // nullable expressions are evaluated by the interpreter
+  if (expr.may_evaluate_null(table, stream)) { return compute_column(table, expr, stream, mr); }
+
+  auto const parser     = ast::detail::expression_parser{expr, table, false, stream, mr};
+  auto const expression = transformation::jit::generate_expression_source(parser, table);
+  if (!expression.has_value()) { return compute_column(table, expr, stream, mr); }
+
+  auto output = make_fixed_width_column(
+    parser.output_type(), table.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (table.num_rows() == 0) { return output; }
+
+  auto const inputs = cudf::detail::make_device_uvector_sync(
+    expression->inputs, stream, rmm::mr::get_current_device_resource());
+  auto const kernel_name = std::string{"cudf::transformation::jit::expression_kernel"};
+  cudf::jit::get_program_cache(*transform_jit_expression_kernel_cu_jit)
+    .get_kernel(kernel_name,
+                {},
+                {{"transform/jit/expression-udf.hpp", expression->source}},
+                {"-arch=sm_."})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())
+    ->launch(table.num_rows(), cudf::jit::get_data_ptr(output->view()), inputs.data());
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column_jit(table, expr, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
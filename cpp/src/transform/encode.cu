@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,54 +15,158 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.hpp>
-#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/hash_reduce_by_row.cuh>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
-#include <cudf/detail/search.hpp>
 #include <cudf/detail/sorting.hpp>
-#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/transform.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
-#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/functional>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scatter.h>
+
+#include <limits>
 #include <memory>
-#include <numeric>
 #include <utility>
 #include <vector>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Functor writing the code of each row, which is the code stored at the index of the
+ * row that represents its group of equal rows in the map.
+ */
+template <typename MapView, typename KeyHasher, typename KeyEqual>
+struct encode_fn : reduce_by_row_fn_base<MapView, KeyHasher, KeyEqual, size_type> {
+  size_type* const d_indices;
+
+  encode_fn(MapView const& d_map,
+            KeyHasher const& d_hasher,
+            KeyEqual const& d_equal,
+            size_type* const d_codes,
+            size_type* const d_indices)
+    : reduce_by_row_fn_base<MapView, KeyHasher, KeyEqual, size_type>{d_map,
+                                                                     d_hasher,
+                                                                     d_equal,
+                                                                     d_codes},
+      d_indices{d_indices}
+  {
+  }
+
+  __device__ void operator()(size_type const idx) const
+  {
+    d_indices[idx] = *this->get_output_ptr(idx);
+  }
+};
+
+}  // namespace
 
 std::pair<std::unique_ptr<table>, std::unique_ptr<column>> encode(
   table_view const& input_table, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
 {
   auto const num_cols = input_table.num_columns();
+  auto const num_rows = input_table.num_rows();
+  auto const temp_mr  = rmm::mr::get_current_device_resource();
 
-  std::vector<size_type> drop_keys(num_cols);
-  std::iota(drop_keys.begin(), drop_keys.end(), 0);
+  auto indices_column = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  if (num_rows == 0 or num_cols == 0) {
+    return std::pair(empty_like(input_table), std::move(indices_column));
+  }
 
-  auto distinct_keys = cudf::detail::distinct(input_table,
-                                              drop_keys,
-                                              duplicate_keep_option::KEEP_ANY,
-                                              null_equality::EQUAL,
-                                              nan_equality::ALL_EQUAL,
-                                              stream,
-                                              mr);
+  // Hash the rows to find one representative row for each group of equal rows, so that the
+  // input rows are looked up in a hash table instead of searched in the sorted keys
+  auto const preprocessed_input =
+    cudf::experimental::row::hash::preprocessed_table::create(input_table, stream);
+  auto map = hash_map_type{compute_hash_table_size(num_rows),
+                           cuco::empty_key{-1},
+                           cuco::empty_value{std::numeric_limits<size_type>::min()},
+                           cudf::detail::cuco_allocator{stream},
+                           stream.value()};
+
+  auto const has_nulls          = nullate::DYNAMIC{cudf::has_nested_nulls(input_table)};
+  auto const has_nested_columns = cudf::detail::has_nested_columns(input_table);
+
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
+  auto const key_hasher = row_hasher.device_hasher(has_nulls);
+  auto const row_comp   = cudf::experimental::row::equality::self_comparator(preprocessed_input);
+
+  using nan_equal_comparator =
+    cudf::experimental::row::equality::nan_equal_physical_equality_comparator;
+  auto const with_key_equal = [&](auto&& fn) {
+    if (has_nested_columns) {
+      fn(row_comp.equal_to<true>(has_nulls, null_equality::EQUAL, nan_equal_comparator{}));
+    } else {
+      fn(row_comp.equal_to<false>(has_nulls, null_equality::EQUAL, nan_equal_comparator{}));
+    }
+  };
+
+  auto const pair_iter = cudf::detail::make_counting_transform_iterator(
+    size_type{0},
+    cuda::proclaim_return_type<cuco::pair<size_type, size_type>>(
+      [] __device__(size_type const i) { return cuco::make_pair(i, i); }));
+  with_key_equal([&](auto const& key_equal) {
+    map.insert(pair_iter, pair_iter + num_rows, key_hasher, key_equal, stream.value());
+  });
+
+  // Only the distinct rows are sorted to produce the keys
+  auto distinct_rows = rmm::device_uvector<size_type>(map.get_size(), stream, temp_mr);
+  map.retrieve_all(distinct_rows.begin(), thrust::make_discard_iterator(), stream.value());
+  auto const distinct_keys = cudf::detail::gather(input_table,
+                                                  distinct_rows,
+                                                  out_of_bounds_policy::DONT_CHECK,
+                                                  negative_index_policy::NOT_ALLOWED,
+                                                  stream,
+                                                  temp_mr);
 
   std::vector<order> column_order(num_cols, order::ASCENDING);
   std::vector<null_order> null_precedence(num_cols, null_order::AFTER);
-  auto sorted_unique_keys =
-    cudf::detail::sort(distinct_keys->view(), column_order, null_precedence, stream, mr);
+  auto const keys_order = cudf::detail::sorted_order(
+    distinct_keys->view(), column_order, null_precedence, stream, temp_mr);
+  auto sorted_unique_keys = cudf::detail::gather(distinct_keys->view(),
+                                                 keys_order->view(),
+                                                 out_of_bounds_policy::DONT_CHECK,
+                                                 negative_index_policy::NOT_ALLOWED,
+                                                 stream,
+                                                 mr);
+
+  // The code of each representative row is the position of its key in the sorted keys
+  auto codes = rmm::device_uvector<size_type>(num_rows, stream, temp_mr);
+  thrust::scatter(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(distinct_rows.size()),
+    thrust::make_permutation_iterator(distinct_rows.begin(), keys_order->view().begin<size_type>()),
+    codes.begin());
 
-  auto indices_column = cudf::detail::lower_bound(
-    sorted_unique_keys->view(), input_table, column_order, null_precedence, stream, mr);
+  auto const map_dview = map.get_device_view();
+  auto const d_indices = indices_column->mutable_view().data<size_type>();
+  with_key_equal([&](auto const& key_equal) {
+    using key_equal_type = std::decay_t<decltype(key_equal)>;
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_rows,
+      encode_fn<decltype(map_dview), decltype(key_hasher), key_equal_type>{
+        map_dview, key_hasher, key_equal, codes.data(), d_indices});
+  });
 
   return std::pair(std::move(sorted_unique_keys), std::move(indices_column));
 }
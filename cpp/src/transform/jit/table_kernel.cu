@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/types.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <cstddef>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+/**
+ * @brief Returns whether a row of an input column is valid.
+ *
+ * @param mask Null mask of the column, or nullptr if the column has no nulls
+ * @param offset Offset of the column in its null mask
+ * @param row Index of the row
+ */
+__device__ inline bool is_valid_input(cudf::bitmask_type const* mask,
+                                      cudf::size_type offset,
+                                      cudf::size_type row)
+{
+  if (mask == nullptr) { return true; }
+  auto const bit = static_cast<cudf::size_type>(row + offset);
+  return (mask[bit / 32] >> (bit % 32)) & 1u;
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
+
+// clang-format off
+#include "transform/jit/table-udf.hpp"
+// clang-format on
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+/**
+ * @brief Evaluates the generated `GENERIC_TRANSFORM_ROW` on each row of a table.
+ *
+ * @param size Number of rows
+ * @param output Data of the output column
+ * @param output_valid Validity of each output row, only written by null-aware functions
+ * @param inputs Data of the input columns
+ * @param input_masks Null masks of the input columns, nullptr for the columns without nulls
+ * @param input_offsets Offsets of the input columns in their null masks
+ */
+CUDF_KERNEL void table_kernel(cudf::size_type size,
+                              void* output,
+                              bool* output_valid,
+                              void const* const* inputs,
+                              cudf::bitmask_type const* const* input_masks,
+                              cudf::size_type const* input_offsets)
+{
+  // cannot use global_thread_id utility due to a JIT build issue by including
+  // the `cudf/detail/utilities/cuda.cuh` header
+  thread_index_type const start  = threadIdx.x + blockIdx.x * blockDim.x;
+  thread_index_type const stride = blockDim.x * gridDim.x;
+
+  for (auto i = start; i < static_cast<thread_index_type>(size); i += stride) {
+    GENERIC_TRANSFORM_ROW(
+      static_cast<cudf::size_type>(i), output, output_valid, inputs, input_masks, input_offsets);
+  }
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
@@ -19,6 +19,8 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/join.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -29,6 +31,8 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 
 #include <algorithm>
@@ -106,6 +110,30 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const&
   return {std::move(all_encodings), encodings_view};
 }
 
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sparse_one_hot_encode(
+  column_view const& input,
+  column_view const& categories,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.type() == categories.type(), "Mismatch type between input and categories.");
+
+  if (input.is_empty() or categories.is_empty()) {
+    return {make_empty_column(type_to_id<size_type>()), make_empty_column(type_to_id<size_type>())};
+  }
+
+  // The true values of the encoding are the matches of an equality join of the input with the
+  // categories, which are the smaller side to build the hash table from
+  auto const hash_table = cudf::hash_join(table_view{{categories}}, null_equality::EQUAL, stream);
+  auto [rows, codes]    = hash_table.inner_join(table_view{{input}}, {}, stream, mr);
+
+  auto const coordinates = thrust::make_zip_iterator(rows->begin(), codes->begin());
+  thrust::sort(rmm::exec_policy(stream), coordinates, coordinates + rows->size());
+
+  return {std::make_unique<column>(std::move(*rows), rmm::device_buffer{}, 0),
+          std::make_unique<column>(std::move(*codes), rmm::device_buffer{}, 0)};
+}
+
 }  // namespace detail
 
 std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const& input,
@@ -115,4 +143,11 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const&
   CUDF_FUNC_RANGE();
   return detail::one_hot_encode(input, categories, cudf::get_default_stream(), mr);
 }
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sparse_one_hot_encode(
+  column_view const& input, column_view const& categories, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sparse_one_hot_encode(input, categories, cudf::get_default_stream(), mr);
+}
 }  // namespace cudf
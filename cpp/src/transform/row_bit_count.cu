@@ -37,6 +37,10 @@
 #include <thrust/optional.h>
 #include <thrust/tabulate.h>
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -320,7 +324,7 @@ struct row_size_functor {
    *                 1 bit per row for validity if applicable.
    */
   template <typename T>
-  __device__ size_type operator()(column_device_view const& col, row_span const& span)
+  __device__ int64_t operator()(column_device_view const& col, row_span const& span)
   {
     auto const num_rows{span.row_end - span.row_start};
     auto const element_size  = sizeof(device_storage_type_t<T>) * CHAR_BIT;
@@ -337,8 +341,8 @@ struct row_size_functor {
  *                 1 bit per row for validity if applicable.
  */
 template <>
-__device__ size_type row_size_functor::operator()<string_view>(column_device_view const& col,
-                                                               row_span const& span)
+__device__ int64_t row_size_functor::operator()<string_view>(column_device_view const& col,
+                                                             row_span const& span)
 {
   auto const num_rows{span.row_end - span.row_start};
   if (num_rows == 0) {
@@ -361,7 +365,7 @@ __device__ size_type row_size_functor::operator()<string_view>(column_device_vie
   auto const validity_size = col.nullable() ? 1 : 0;
   auto const d_offsets     = cudf::detail::input_offsetalator(offsets.head(), offsets.type());
   auto const chars_size    = (d_offsets[row_end] - d_offsets[row_start]) * CHAR_BIT;
-  return static_cast<size_type>(((offsets_size + validity_size) * num_rows) + chars_size);
+  return static_cast<int64_t>(((offsets_size + validity_size) * num_rows) + chars_size);
 }
 
 /**
@@ -372,8 +376,8 @@ __device__ size_type row_size_functor::operator()<string_view>(column_device_vie
  *                 1 bit per row for validity if applicable.
  */
 template <>
-__device__ size_type row_size_functor::operator()<list_view>(column_device_view const& col,
-                                                             row_span const& span)
+__device__ int64_t row_size_functor::operator()<list_view>(column_device_view const& col,
+                                                           row_span const& span)
 {
   auto const num_rows{span.row_end - span.row_start};
 
@@ -388,26 +392,70 @@ __device__ size_type row_size_functor::operator()<list_view>(column_device_view
  * Computed as :   1 bit per row for validity if applicable.
  */
 template <>
-__device__ size_type row_size_functor::operator()<struct_view>(column_device_view const& col,
-                                                               row_span const& span)
+__device__ int64_t row_size_functor::operator()<struct_view>(column_device_view const& col,
+                                                             row_span const& span)
 {
   auto const num_rows{span.row_end - span.row_start};
   return (col.nullable() ? 1 : 0) * num_rows;  // cost of validity
 }
 
 /**
- * @brief Kernel for computing per-row sizes in bits.
+ * @brief Rows of the segments of a fixed length, the last segment being possibly shorter.
+ */
+struct fixed_length_segments {
+  size_type segment_length;
+  size_type num_rows;
+
+  __device__ row_span operator()(size_type segment_idx) const
+  {
+    return row_span{segment_idx * segment_length,
+                    cuda::std::min((segment_idx + 1) * segment_length, num_rows)};
+  }
+};
+
+/**
+ * @brief Rows of the segments delimited by offsets.
+ */
+struct offset_segments {
+  size_type const* offsets;
+
+  __device__ row_span operator()(size_type segment_idx) const
+  {
+    return row_span{offsets[segment_idx], offsets[segment_idx + 1]};
+  }
+};
+
+/**
+ * @brief Converts a size in bits to the unit of an output column.
+ */
+template <typename OutputType>
+struct size_converter {
+  int64_t bits_per_unit;
+
+  __device__ OutputType operator()(int64_t bits) const
+  {
+    return static_cast<OutputType>(cudf::util::div_rounding_up_unsafe(bits, bits_per_unit));
+  }
+};
+
+/**
+ * @brief Kernel for computing per-segment sizes.
  *
  * @param cols An span of column_device_views representing a column hierarchy
  * @param info An span of column_info structs corresponding the elements in `cols`
- * @param output Output span of size (# rows) where per-row bit sizes are stored
- * @param segment_length The number of rows in each segment for which the total size is computed
+ * @param segment_rows Functor returning the span of rows of a segment
+ * @param fixed_per_row_size Size in bits of each row of the columns not in `cols`
+ * @param to_output Functor converting a size in bits to an output value
+ * @param output Output span of size (# segments) where per-segment sizes are stored
  * @param max_branch_depth Maximum depth of the span stack needed per-thread
  */
+template <typename SegmentRows, typename OutputType>
 CUDF_KERNEL void compute_segment_sizes(device_span<column_device_view const> cols,
                                        device_span<column_info const> info,
-                                       device_span<size_type> output,
-                                       size_type segment_length,
+                                       SegmentRows segment_rows,
+                                       int64_t fixed_per_row_size,
+                                       size_converter<OutputType> to_output,
+                                       device_span<OutputType> output,
                                        size_type max_branch_depth)
 {
   extern __shared__ row_span thread_branch_stacks[];
@@ -421,16 +469,11 @@ CUDF_KERNEL void compute_segment_sizes(device_span<column_device_view const> col
   row_span* my_branch_stack = thread_branch_stacks + (threadIdx.x * max_branch_depth);
   size_type branch_depth{0};
 
-  // current row span - always starts at spanning over `segment_length` rows.
-  auto const num_rows             = cols[0].size();
-  auto const get_default_row_span = [=] {
-    return row_span{tid * segment_length, cuda::std::min((tid + 1) * segment_length, num_rows)};
-  };
-  auto cur_span = get_default_row_span();
+  // current row span - always starts at spanning over the rows of the segment.
+  auto cur_span = segment_rows(tid);
 
-  // output size
-  size_type& size = output[tid];
-  size            = 0;
+  // the columns without strings or lists add the same size for every row
+  int64_t size = fixed_per_row_size * (cur_span.row_end - cur_span.row_start);
 
   size_type last_branch_depth{0};
   for (size_type idx = 0; idx < cols.size(); idx++) {
@@ -453,7 +496,7 @@ CUDF_KERNEL void compute_segment_sizes(device_span<column_device_view const> col
     if (info[idx].depth == 0) {
       branch_depth      = 0;
       last_branch_depth = 0;
-      cur_span          = get_default_row_span();
+      cur_span          = segment_rows(tid);
     }
 
     // add the contributing size of this row
@@ -470,53 +513,64 @@ CUDF_KERNEL void compute_segment_sizes(device_span<column_device_view const> col
 
     last_branch_depth = info[idx].branch_depth_end;
   }
-}
 
-}  // anonymous namespace
+  output[tid] = to_output(size);
+}
 
-std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
-                                                size_type segment_length,
-                                                rmm::cuda_stream_view stream,
-                                                rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Computes the size of each segment of rows of a table.
+ *
+ * @param t The table view to perform the computation on
+ * @param segment_rows Functor returning the span of rows of a segment
+ * @param to_output Functor converting a size in bits to an output value
+ * @param output Output span of size (# segments) where per-segment sizes are stored
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <typename SegmentRows, typename OutputType>
+void compute_table_segment_sizes(table_view const& t,
+                                 SegmentRows segment_rows,
+                                 size_converter<OutputType> to_output,
+                                 device_span<OutputType> output,
+                                 rmm::cuda_stream_view stream)
 {
-  // If there is no rows, segment_length will not be checked.
-  if (t.num_rows() <= 0) { return cudf::make_empty_column(type_id::INT32); }
-
-  CUDF_EXPECTS(segment_length >= 1 && segment_length <= t.num_rows(),
-               "Invalid segment length.",
-               std::invalid_argument);
+  auto const num_segments = static_cast<size_type>(output.size());
+  if (num_segments == 0) { return; }
 
-  // flatten the hierarchy and determine some information about it.
+  // flatten the hierarchy and determine some information about it. the top-level columns
+  // without strings or lists have the same size for every row, so they are not traversed.
   std::vector<cudf::column_view> cols;
   std::vector<column_info> info;
   hierarchy_info h_info;
-  flatten_hierarchy(t.begin(), t.end(), cols, info, h_info, stream);
+  int64_t fixed_per_row_size = 0;
+  for (auto it = t.begin(); it != t.end(); ++it) {
+    std::vector<cudf::column_view> col_cols;
+    std::vector<column_info> col_info;
+    hierarchy_info col_h_info;
+    flatten_hierarchy(it, std::next(it), col_cols, col_info, col_h_info, stream);
+    if (col_h_info.complex_type_count <= 0) {
+      fixed_per_row_size += col_h_info.simple_per_row_size;
+      continue;
+    }
+    cols.insert(cols.end(), col_cols.begin(), col_cols.end());
+    info.insert(info.end(), col_info.begin(), col_info.end());
+    h_info.complex_type_count += col_h_info.complex_type_count;
+    h_info.max_branch_depth = std::max(h_info.max_branch_depth, col_h_info.max_branch_depth);
+  }
   CUDF_EXPECTS(info.size() == cols.size(), "Size/info mismatch");
 
-  // create output buffer and view
-  auto const num_segments = cudf::util::div_rounding_up_safe(t.num_rows(), segment_length);
-  auto output             = cudf::make_fixed_width_column(
-    data_type{type_id::INT32}, num_segments, mask_state::UNALLOCATED, stream, mr);
-  mutable_column_view mcv = output->mutable_view();
-
   // simple case.  if we have no complex types (lists, strings, etc), the per-row size is already
   // trivially computed
   if (h_info.complex_type_count <= 0) {
-    thrust::tabulate(
-      rmm::exec_policy_nosync(stream),
-      mcv.begin<size_type>(),
-      mcv.end<size_type>(),
-      cuda::proclaim_return_type<size_type>(
-        [segment_length,
-         num_rows     = t.num_rows(),
-         per_row_size = h_info.simple_per_row_size] __device__(size_type const segment_idx) {
-          // Since the number of rows may not divisible by segment_length,
-          // the last segment may be shorter than the others.
-          auto const current_length =
-            cuda::std::min(segment_length, num_rows - segment_length * segment_idx);
-          return per_row_size * current_length;
-        }));
-    return output;
+    thrust::tabulate(rmm::exec_policy_nosync(stream),
+                     output.begin(),
+                     output.end(),
+                     cuda::proclaim_return_type<OutputType>(
+                       [segment_rows, fixed_per_row_size, to_output] __device__(
+                         size_type const segment_idx) {
+                         auto const rows = segment_rows(segment_idx);
+                         return to_output(fixed_per_row_size * (rows.row_end - rows.row_start));
+                       }));
+    return;
   }
 
   // create a contiguous block of column_device_views
@@ -548,10 +602,59 @@ std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
   compute_segment_sizes<<<grid.num_blocks, block_size, shared_mem_size, stream.value()>>>(
     {std::get<1>(d_cols), cols.size()},
     {d_info.data(), info.size()},
-    {mcv.data<size_type>(), static_cast<std::size_t>(mcv.size())},
-    segment_length,
+    segment_rows,
+    fixed_per_row_size,
+    to_output,
+    output,
     h_info.max_branch_depth);
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
+                                                size_type segment_length,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  // If there is no rows, segment_length will not be checked.
+  if (t.num_rows() <= 0) { return cudf::make_empty_column(type_id::INT32); }
 
+  CUDF_EXPECTS(segment_length >= 1 && segment_length <= t.num_rows(),
+               "Invalid segment length.",
+               std::invalid_argument);
+
+  // create output buffer and view
+  auto const num_segments = cudf::util::div_rounding_up_safe(t.num_rows(), segment_length);
+  auto output             = cudf::make_fixed_width_column(
+    data_type{type_id::INT32}, num_segments, mask_state::UNALLOCATED, stream, mr);
+  mutable_column_view mcv = output->mutable_view();
+
+  compute_table_segment_sizes(
+    t,
+    fixed_length_segments{segment_length, t.num_rows()},
+    size_converter<size_type>{1},
+    device_span<size_type>{mcv.data<size_type>(), static_cast<std::size_t>(mcv.size())},
+    stream);
+  return output;
+}
+
+std::unique_ptr<column> segmented_row_byte_count(table_view const& t,
+                                                 device_span<size_type const> segment_offsets,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const num_segments =
+    segment_offsets.empty() ? 0 : static_cast<size_type>(segment_offsets.size()) - 1;
+  auto output = cudf::make_fixed_width_column(
+    data_type{type_id::INT64}, num_segments, mask_state::UNALLOCATED, stream, mr);
+  mutable_column_view mcv = output->mutable_view();
+
+  compute_table_segment_sizes(
+    t,
+    offset_segments{segment_offsets.data()},
+    size_converter<int64_t>{CHAR_BIT},
+    device_span<int64_t>{mcv.data<int64_t>(), static_cast<std::size_t>(mcv.size())},
+    stream);
   return output;
 }
 
@@ -572,6 +675,14 @@ std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
   return detail::segmented_row_bit_count(t, segment_length, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<column> segmented_row_byte_count(table_view const& t,
+                                                 device_span<size_type const> segment_offsets,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_row_byte_count(t, segment_offsets, cudf::get_default_stream(), mr);
+}
+
 std::unique_ptr<column> row_bit_count(table_view const& t, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -20,16 +20,28 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <jit_preprocessed_files/transform/jit/kernel.cu.jit.hpp>
+#include <jit_preprocessed_files/transform/jit/table_kernel.cu.jit.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace transformation {
@@ -64,6 +76,82 @@ void unary_operation(mutable_column_view output,
              cudf::jit::get_data_ptr(input));
 }
 
+/**
+ * @brief Generates the source of `GENERIC_TRANSFORM_ROW`, which calls the user's function
+ * `GENERIC_TRANSFORM_OP` on a row of the inputs
+ *
+ * The function is called with a pointer to the output element, followed by a pointer to the
+ * output validity if it is null-aware, by the value of each input, and by the validity of each
+ * input if it is null-aware.
+ */
+std::string generate_row_source(table_view const& inputs, data_type output_type, bool null_aware)
+{
+  std::ostringstream source;
+  source << "__device__ inline void GENERIC_TRANSFORM_ROW(cudf::size_type row, void* output, "
+            "bool* output_valid, void const* const* inputs, "
+            "cudf::bitmask_type const* const* masks, cudf::size_type const* offsets)\n{\n"
+         << "  GENERIC_TRANSFORM_OP(static_cast<" << cudf::type_to_name(output_type)
+         << "*>(output) + row";
+  if (null_aware) { source << ", output_valid + row"; }
+  for (size_type idx = 0; idx < inputs.num_columns(); ++idx) {
+    source << ",\n    static_cast<" << cudf::type_to_name(inputs.column(idx).type())
+           << " const*>(inputs[" << idx << "])[row]";
+  }
+  if (null_aware) {
+    for (size_type idx = 0; idx < inputs.num_columns(); ++idx) {
+      source << ",\n    cudf::transformation::jit::is_valid_input(masks[" << idx << "], offsets["
+             << idx << "], row)";
+    }
+  }
+  source << ");\n}\n";
+  return source.str();
+}
+
+void table_operation(mutable_column_view output,
+                     bool* output_valid,
+                     table_view const& inputs,
+                     std::string const& udf,
+                     bool is_ptx,
+                     bool null_aware,
+                     rmm::cuda_stream_view stream)
+{
+  std::string const udf_source =
+    is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
+                                                  "GENERIC_TRANSFORM_OP",
+                                                  cudf::type_to_name(output.type()),
+                                                  {0})
+           : cudf::jit::parse_single_function_cuda(udf,  //
+                                                   "GENERIC_TRANSFORM_OP");
+  auto const source =
+    "#pragma once\n" + udf_source + generate_row_source(inputs, output.type(), null_aware);
+
+  auto h_data    = std::vector<void const*>{};
+  auto h_masks   = std::vector<bitmask_type const*>{};
+  auto h_offsets = std::vector<size_type>{};
+  for (auto const& input : inputs) {
+    h_data.push_back(cudf::jit::get_data_ptr(input));
+    h_masks.push_back(input.nullable() ? input.null_mask() : nullptr);
+    h_offsets.push_back(input.offset());
+  }
+  auto const d_mr      = rmm::mr::get_current_device_resource();
+  auto const d_data    = cudf::detail::make_device_uvector_async(h_data, stream, d_mr);
+  auto const d_masks   = cudf::detail::make_device_uvector_async(h_masks, stream, d_mr);
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(h_offsets, stream, d_mr);
+
+  cudf::jit::get_program_cache(*transform_jit_table_kernel_cu_jit)
+    .get_kernel("cudf::transformation::jit::table_kernel",
+                {},
+                {{"transform/jit/table-udf.hpp", source}},
+                {"-arch=sm_."})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())
+    ->launch(output.size(),
+             cudf::jit::get_data_ptr(output),
+             output_valid,
+             d_data.data(),
+             d_masks.data(),
+             d_offsets.data());
+}
+
 }  // namespace jit
 }  // namespace transformation
 
@@ -90,6 +178,47 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  bool null_aware,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(inputs.num_columns() > 0, "Transform requires at least one input column.");
+  CUDF_EXPECTS(std::all_of(inputs.begin(),
+                           inputs.end(),
+                           [](auto const& input) { return is_fixed_width(input.type()); }),
+               "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(is_fixed_width(output_type), "Unexpected non-fixed-width output type.");
+  CUDF_EXPECTS(!(is_ptx && null_aware),
+               "Null-aware transforms require a CUDA function.",
+               std::invalid_argument);
+
+  auto const size = inputs.num_rows();
+  if (null_aware) {
+    auto output = make_fixed_width_column(output_type, size, mask_state::UNALLOCATED, stream, mr);
+    if (size == 0) { return output; }
+    // the function writes the validity of each row, which is then packed into the null mask
+    auto valid = rmm::device_uvector<bool>(size, stream);
+    transformation::jit::table_operation(
+      output->mutable_view(), valid.data(), inputs, udf, is_ptx, null_aware, stream);
+    auto [null_mask, null_count] = cudf::detail::bools_to_mask(
+      column_view{data_type{type_id::BOOL8}, size, valid.data(), nullptr, 0}, stream, mr);
+    if (null_count > 0) { output->set_null_mask(std::move(*null_mask), null_count); }
+    return output;
+  }
+
+  auto [null_mask, null_count] = cudf::detail::bitmask_and(inputs, stream, mr);
+  auto output =
+    make_fixed_width_column(output_type, size, std::move(null_mask), null_count, stream, mr);
+  if (size == 0) { return output; }
+  transformation::jit::table_operation(
+    output->mutable_view(), nullptr, inputs, udf, is_ptx, null_aware, stream);
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -102,4 +231,16 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  bool null_aware,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(
+    inputs, udf, output_type, is_ptx, null_aware, cudf::get_default_stream(), mr);
+}
+
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,12 +13,15 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reshape.hpp>
 #include <cudf/detail/transpose.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -26,12 +29,103 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace detail {
+namespace {
+
+constexpr int transpose_tile_dim   = 32;
+constexpr int transpose_block_rows = 8;
+// Limit of the y dimension of a grid
+constexpr int max_column_tiles = 65535;
+
+/**
+ * @brief Copies the columns to a row-major matrix by tiles of `transpose_tile_dim` rows and
+ * columns.
+ *
+ * Each block stages a tile in shared memory: the warps read consecutive rows of a column and
+ * write consecutive columns of a row.
+ */
+template <typename T>
+CUDF_KERNEL void copy_to_row_major_kernel(T const* const* columns,
+                                          size_type num_columns,
+                                          size_type num_rows,
+                                          T* output)
+{
+  // padded so that the transposed accesses are on different banks
+  __shared__ T tile[transpose_tile_dim][transpose_tile_dim + 1];
+
+  auto const row_begin        = static_cast<int64_t>(blockIdx.x) * transpose_tile_dim;
+  auto const num_column_tiles = util::div_rounding_up_safe(num_columns, transpose_tile_dim);
+  for (auto column_tile = static_cast<size_type>(blockIdx.y); column_tile < num_column_tiles;
+       column_tile += gridDim.y) {
+    auto const column_begin = column_tile * transpose_tile_dim;
+    for (int i = threadIdx.y; i < transpose_tile_dim; i += transpose_block_rows) {
+      auto const column = column_begin + i;
+      auto const row    = row_begin + threadIdx.x;
+      if (column < num_columns && row < num_rows) { tile[i][threadIdx.x] = columns[column][row]; }
+    }
+    __syncthreads();
+    for (int i = threadIdx.y; i < transpose_tile_dim; i += transpose_block_rows) {
+      auto const column = column_begin + static_cast<size_type>(threadIdx.x);
+      auto const row    = row_begin + i;
+      if (column < num_columns && row < num_rows) {
+        output[row * num_columns + column] = tile[threadIdx.x][i];
+      }
+    }
+    __syncthreads();
+  }
+}
+
+template <typename T>
+void copy_tiles_to_row_major(table_view const& input, T* output, rmm::cuda_stream_view stream)
+{
+  std::vector<T const*> h_columns(input.num_columns());
+  std::transform(input.begin(), input.end(), h_columns.begin(), [](column_view const& col) {
+    return static_cast<T const*>(col.head()) + col.offset();
+  });
+  auto const d_columns =
+    make_device_uvector_async(h_columns, stream, rmm::mr::get_current_device_resource());
+
+  auto const num_column_tiles = util::div_rounding_up_safe(input.num_columns(), transpose_tile_dim);
+  dim3 const grid(util::div_rounding_up_safe(input.num_rows(), transpose_tile_dim),
+                  std::min(num_column_tiles, max_column_tiles));
+  dim3 const block(transpose_tile_dim, transpose_block_rows);
+  copy_to_row_major_kernel<<<grid, block, 0, stream.value()>>>(
+    d_columns.data(), input.num_columns(), input.num_rows(), output);
+}
+
+}  // namespace
+
+void copy_to_row_major(table_view const& input, void* output, rmm::cuda_stream_view stream)
+{
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return; }
+
+  auto const dtype = input.column(0).type();
+  CUDF_EXPECTS(
+    std::all_of(
+      input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
+    "Column type mismatch");
+  CUDF_EXPECTS(is_fixed_width(dtype), "Copy to row-major requires fixed-width columns");
+
+  // Only the size of the elements matters to the copy
+  switch (size_of(dtype)) {
+    case 1: return copy_tiles_to_row_major(input, static_cast<uint8_t*>(output), stream);
+    case 2: return copy_tiles_to_row_major(input, static_cast<uint16_t*>(output), stream);
+    case 4: return copy_tiles_to_row_major(input, static_cast<uint32_t*>(output), stream);
+    case 8: return copy_tiles_to_row_major(input, static_cast<uint64_t*>(output), stream);
+    case 16: return copy_tiles_to_row_major(input, static_cast<__int128_t*>(output), stream);
+    default: CUDF_FAIL("Unsupported element size for copy to row-major");
+  }
+}
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::cuda_stream_view stream,
                                                          rmm::mr::device_memory_resource* mr)
@@ -48,9 +142,20 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
 
-  auto output_column = cudf::detail::interleave_columns(input, stream, mr);
-  auto one_iter      = thrust::make_counting_iterator<size_type>(1);
-  auto splits_iter   = thrust::make_transform_iterator(
+  // Without nulls, the interleaved column is the row-major matrix of the input
+  auto const has_nulls =
+    std::any_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); });
+  std::unique_ptr<column> output_column;
+  if (is_fixed_width(dtype) && !has_nulls) {
+    output_column = make_fixed_width_column(
+      dtype, input.num_columns() * input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    copy_to_row_major(input, output_column->mutable_view().head(), stream);
+  } else {
+    output_column = cudf::detail::interleave_columns(input, stream, mr);
+  }
+
+  auto one_iter    = thrust::make_counting_iterator<size_type>(1);
+  auto splits_iter = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
   auto splits = std::vector<size_type>(splits_iter, splits_iter + input.num_rows() - 1);
   auto output_column_views = detail::split(output_column->view(), splits, stream);
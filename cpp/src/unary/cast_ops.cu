@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,8 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/instrumentation.hpp>
+#include <cudf/detail/utilities/vectorized_transform.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -233,6 +235,16 @@ struct dispatch_unary_cast_to {
 
     mutable_column_view output_mutable = *output;
 
+    // Numeric casts load and store several elements at a time when the data is aligned
+    if constexpr (cudf::is_numeric<SourceT>() && cudf::is_numeric<TargetT>()) {
+      auto const source = input.data<SourceT>();
+      auto const target = output_mutable.data<TargetT>();
+      if (detail::can_vectorize(target, source)) {
+        detail::vectorized_transform(size, unary_cast<TargetT>{}, stream, target, source);
+        return output;
+      }
+    }
+
     thrust::transform(rmm::exec_policy(stream),
                       input.begin<SourceT>(),
                       input.end<SourceT>(),
@@ -419,6 +431,7 @@ std::unique_ptr<column> cast(column_view const& input,
                              rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
+  CUDF_API_EVENT(stream, input);
   return detail::cast(input, type, stream, mr);
 }
 
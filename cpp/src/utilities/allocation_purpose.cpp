@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/allocation_purpose.hpp>
+
+#include <utility>
+
+namespace cudf {
+namespace {
+
+thread_local allocation_purpose thread_purpose{allocation_purpose::UNSPECIFIED};
+
+}  // namespace
+
+allocation_purpose current_allocation_purpose() noexcept { return thread_purpose; }
+
+allocation_purpose_scope::allocation_purpose_scope(allocation_purpose purpose) noexcept
+  : _previous{std::exchange(thread_purpose, purpose)}
+{
+}
+
+allocation_purpose_scope::~allocation_purpose_scope() { thread_purpose = _previous; }
+
+}  // namespace cudf
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/cuda_graph.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Tries to update `exec` in place with the nodes of `graph`.
+ *
+ * @return true if `graph` has the topology of the graph `exec` was instantiated from
+ */
+bool update_in_place(cudaGraphExec_t exec, cudaGraph_t graph)
+{
+#if CUDART_VERSION >= 12000
+  cudaGraphExecUpdateResultInfo info{};
+  auto const status = cudaGraphExecUpdate(exec, graph, &info);
+#else
+  cudaGraphNode_t error_node{};
+  cudaGraphExecUpdateResult result{};
+  auto const status = cudaGraphExecUpdate(exec, graph, &error_node, &result);
+#endif
+  if (status == cudaErrorGraphExecUpdateFailure) {
+    // the failed update leaves the executable unchanged, clear its error for the next call
+    cudaGetLastError();
+    return false;
+  }
+  CUDF_CUDA_TRY(status);
+  return true;
+}
+
+cudaGraphExec_t instantiate(cudaGraph_t graph)
+{
+  cudaGraphExec_t exec{};
+#if CUDART_VERSION >= 12000
+  CUDF_CUDA_TRY(cudaGraphInstantiate(&exec, graph, 0));
+#else
+  CUDF_CUDA_TRY(cudaGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+#endif
+  return exec;
+}
+
+}  // namespace
+
+cuda_graph::cuda_graph(cuda_graph&& other) noexcept
+  : _graph{std::exchange(other._graph, nullptr)},
+    _exec{std::exchange(other._exec, nullptr)},
+    _num_updates{std::exchange(other._num_updates, 0)}
+{
+}
+
+cuda_graph& cuda_graph::operator=(cuda_graph&& other) noexcept
+{
+  if (this != &other) {
+    std::swap(_graph, other._graph);
+    std::swap(_exec, other._exec);
+    std::swap(_num_updates, other._num_updates);
+  }
+  return *this;
+}
+
+cuda_graph::~cuda_graph()
+{
+  // the destructor must not throw, errors are left to the next CUDA call of the caller
+  if (_exec != nullptr) { cudaGraphExecDestroy(_exec); }
+  if (_graph != nullptr) { cudaGraphDestroy(_graph); }
+}
+
+void cuda_graph::capture(pipeline const& work, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(!stream.is_default(),
+               "The legacy default stream cannot be captured",
+               std::invalid_argument);
+
+  // thread-local mode lets other threads make capture-unsafe calls during the capture
+  CUDF_CUDA_TRY(cudaStreamBeginCapture(stream.value(), cudaStreamCaptureModeThreadLocal));
+  cudaGraph_t graph{};
+  try {
+    work(stream);
+  } catch (...) {
+    // the stream must leave capture mode before it can be used again
+    if (cudaStreamEndCapture(stream.value(), &graph) == cudaSuccess && graph != nullptr) {
+      cudaGraphDestroy(graph);
+    }
+    cudaGetLastError();
+    throw;
+  }
+  CUDF_CUDA_TRY(cudaStreamEndCapture(stream.value(), &graph));
+
+  try {
+    if (_exec != nullptr && update_in_place(_exec, graph)) {
+      ++_num_updates;
+    } else {
+      auto const exec = instantiate(graph);
+      if (_exec != nullptr) { cudaGraphExecDestroy(_exec); }
+      _exec = exec;
+    }
+  } catch (...) {
+    cudaGraphDestroy(graph);
+    throw;
+  }
+  if (_graph != nullptr) { cudaGraphDestroy(_graph); }
+  _graph = graph;
+}
+
+void cuda_graph::replay(rmm::cuda_stream_view stream) const
+{
+  CUDF_EXPECTS(is_captured(), "No pipeline was captured", std::logic_error);
+  CUDF_CUDA_TRY(cudaGraphLaunch(_exec, stream.value()));
+}
+
+}  // namespace cudf
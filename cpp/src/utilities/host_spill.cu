@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/host_spill.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuda/functional>
+#include <thrust/functional.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+
+namespace cudf::detail {
+
+namespace {
+
+/**
+ * @brief Owns a CUDA event used to order the copies through a bounce buffer.
+ */
+class bounce_event {
+ public:
+  bounce_event() { CUDF_CUDA_TRY(cudaEventCreateWithFlags(&_event, cudaEventDisableTiming)); }
+  ~bounce_event() { cudaEventDestroy(_event); }
+  bounce_event(bounce_event const&)            = delete;
+  bounce_event& operator=(bounce_event const&) = delete;
+
+  [[nodiscard]] cudaEvent_t value() const { return _event; }
+
+ private:
+  cudaEvent_t _event{};
+};
+
+spilled_table spill_packed(table_view const& input, rmm::cuda_stream_view stream)
+{
+  auto packed = cudf::detail::pack(input, stream, rmm::mr::get_current_device_resource());
+  spilled_table result{
+    std::move(*packed.metadata), std::vector<uint8_t>(packed.gpu_data->size()), input.num_rows()};
+  CUDF_CUDA_TRY(cudaMemcpyAsync(result.data.data(),
+                                packed.gpu_data->data(),
+                                result.data.size(),
+                                cudaMemcpyDefault,
+                                stream.value()));
+  stream.synchronize();
+  return result;
+}
+
+}  // namespace
+
+spilled_table spill(table_view const& input,
+                    rmm::cuda_stream_view stream,
+                    std::size_t bounce_buffer_size)
+{
+  // chunked_pack always runs on the default stream
+  auto const pack_stream = cudf::get_default_stream();
+  cudf::detail::join_streams(std::vector<rmm::cuda_stream_view>{stream}, pack_stream);
+
+  auto packer           = cudf::chunked_pack::create(input, bounce_buffer_size);
+  auto const total_size = packer->get_total_contiguous_size();
+  if (total_size <= bounce_buffer_size) { return spill_packed(input, stream); }
+
+  spilled_table result{
+    std::move(*packer->build_metadata()), std::vector<uint8_t>(total_size), input.num_rows()};
+
+  // each chunk goes through the device and pinned buffers of a slot, which alternate so that
+  // packing a chunk, copying the previous one to pinned memory and draining the one before it
+  // to the spilled table overlap
+  auto const copy_streams = cudf::detail::fork_streams(pack_stream, 1);
+  auto const copy_stream  = copy_streams.front();
+  std::array<rmm::device_buffer, 2> device_buffers{
+    rmm::device_buffer(bounce_buffer_size, pack_stream),
+    rmm::device_buffer(bounce_buffer_size, pack_stream)};
+  std::array<pinned_host_vector<uint8_t>, 2> host_buffers{
+    pinned_host_vector<uint8_t>(bounce_buffer_size),
+    pinned_host_vector<uint8_t>(bounce_buffer_size)};
+  std::array<bounce_event, 2> packed;
+  std::array<bounce_event, 2> copied;
+  std::array<std::size_t, 2> chunk_offsets{};
+  std::array<std::size_t, 2> chunk_sizes{};
+
+  auto const drain = [&](std::size_t slot) {
+    CUDF_CUDA_TRY(cudaEventSynchronize(copied[slot].value()));
+    std::memcpy(
+      result.data.data() + chunk_offsets[slot], host_buffers[slot].data(), chunk_sizes[slot]);
+  };
+
+  std::size_t num_chunks = 0;
+  std::size_t offset     = 0;
+  for (; packer->has_next(); ++num_chunks) {
+    auto const slot = num_chunks % 2;
+    // the device buffer of the slot is reused once its previous chunk is in pinned memory
+    CUDF_CUDA_TRY(cudaStreamWaitEvent(pack_stream.value(), copied[slot].value()));
+    auto const size = packer->next(cudf::device_span<uint8_t>(
+      static_cast<uint8_t*>(device_buffers[slot].data()), bounce_buffer_size));
+    CUDF_CUDA_TRY(cudaEventRecord(packed[slot].value(), pack_stream.value()));
+
+    // the pinned buffer of the slot is drained while the chunk is packed
+    if (num_chunks >= 2) { drain(slot); }
+    chunk_offsets[slot] = offset;
+    chunk_sizes[slot]   = size;
+    offset += size;
+
+    CUDF_CUDA_TRY(cudaStreamWaitEvent(copy_stream.value(), packed[slot].value()));
+    CUDF_CUDA_TRY(cudaMemcpyAsync(host_buffers[slot].data(),
+                                  device_buffers[slot].data(),
+                                  size,
+                                  cudaMemcpyDefault,
+                                  copy_stream.value()));
+    CUDF_CUDA_TRY(cudaEventRecord(copied[slot].value(), copy_stream.value()));
+  }
+  for (auto chunk = num_chunks - std::min<std::size_t>(num_chunks, 2); chunk < num_chunks;
+       ++chunk) {
+    drain(chunk % 2);
+  }
+
+  // the device buffers are freed on the pack stream
+  cudf::detail::join_streams(copy_streams, pack_stream);
+  return result;
+}
+
+packed_columns unspill(spilled_table const& input,
+                       rmm::cuda_stream_view stream,
+                       std::size_t bounce_buffer_size)
+{
+  CUDF_EXPECTS(bounce_buffer_size > 0, "The bounce buffer size must be positive");
+  auto const total_size = input.data.size();
+  if (total_size <= bounce_buffer_size) {
+    return packed_columns{
+      std::make_unique<std::vector<uint8_t>>(input.metadata),
+      std::make_unique<rmm::device_buffer>(input.data.data(), input.data.size(), stream)};
+  }
+
+  // a chunk is staged in the pinned buffer of a slot while the chunk of the other slot is copied
+  // to the device
+  auto unpacker = cudf::chunked_unpack(
+    std::make_unique<std::vector<uint8_t>>(input.metadata), total_size, stream);
+  std::array<pinned_host_vector<uint8_t>, 2> host_buffers{
+    pinned_host_vector<uint8_t>(bounce_buffer_size),
+    pinned_host_vector<uint8_t>(bounce_buffer_size)};
+  std::array<bounce_event, 2> copied;
+
+  for (std::size_t offset = 0, chunk = 0; offset < total_size;
+       offset += bounce_buffer_size, ++chunk) {
+    auto const slot = chunk % 2;
+    auto const size = std::min(bounce_buffer_size, total_size - offset);
+    // the pinned buffer of the slot is refilled once its previous chunk is on the device
+    CUDF_CUDA_TRY(cudaEventSynchronize(copied[slot].value()));
+    std::memcpy(host_buffers[slot].data(), input.data.data() + offset, size);
+    unpacker.next(cudf::host_span<uint8_t const>(host_buffers[slot].data(), size));
+    CUDF_CUDA_TRY(cudaEventRecord(copied[slot].value(), stream.value()));
+  }
+
+  // the pinned buffers are freed on return
+  stream.synchronize();
+  return unpacker.finish();
+}
+
+std::size_t estimated_table_size(table_view const& input, rmm::cuda_stream_view stream)
+{
+  if (input.num_rows() == 0) { return 0; }
+  auto const row_bits =
+    cudf::detail::row_bit_count(input, stream, rmm::mr::get_current_device_resource());
+  auto const bits       = row_bits->view().begin<size_type>();
+  auto const total_bits = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    bits,
+    bits + input.num_rows(),
+    cuda::proclaim_return_type<std::size_t>(
+      [] __device__(size_type row_bits) { return static_cast<std::size_t>(row_bits); }),
+    std::size_t{0},
+    thrust::plus<std::size_t>{});
+  return cudf::util::div_rounding_up_safe<std::size_t>(total_bits, 8);
+}
+
+}  // namespace cudf::detail
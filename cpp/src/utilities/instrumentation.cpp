@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/instrumentation.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+std::atomic<bool> api_instrumentation_enabled{false};
+
+namespace {
+
+/// Bytes allocated through an `api_memory_tracker` by this thread and not freed yet; negative if
+/// the thread freed memory allocated by another one
+thread_local std::int64_t thread_allocated{0};
+/// Peak of `thread_allocated` since the innermost open scope of this thread started
+thread_local std::int64_t thread_peak{0};
+
+/**
+ * @brief An event whose work may still be running on the device.
+ */
+struct pending_event {
+  api_event event;
+  cudaEvent_t start;
+  cudaEvent_t end;
+};
+
+/**
+ * @brief Registered callbacks and pending events.
+ */
+class instrumentation_registry {
+ public:
+  std::size_t add(api_event_callback&& callback)
+  {
+    std::lock_guard lock{_callbacks_mutex};
+    auto const id = _next_id++;
+    _callbacks.emplace(id, std::move(callback));
+    api_instrumentation_enabled = true;
+    return id;
+  }
+
+  void remove(std::size_t id)
+  {
+    std::lock_guard lock{_callbacks_mutex};
+    _callbacks.erase(id);
+    api_instrumentation_enabled = !_callbacks.empty();
+  }
+
+  void push(pending_event const& event)
+  {
+    std::lock_guard lock{_pending_mutex};
+    _pending.push_back(event);
+  }
+
+  /**
+   * @brief Delivers the events whose work completed, or all of them after waiting for their work
+   * if `wait` is true.
+   */
+  void deliver(bool wait)
+  {
+    std::vector<api_event> completed;
+    {
+      std::lock_guard lock{_pending_mutex};
+      std::vector<pending_event> still_pending;
+      for (auto& pending : _pending) {
+        auto const status = wait ? cudaEventSynchronize(pending.end) : cudaEventQuery(pending.end);
+        if (status == cudaErrorNotReady) {
+          still_pending.push_back(pending);
+          continue;
+        }
+        if (status == cudaSuccess &&
+            cudaEventElapsedTime(&pending.event.elapsed_ms, pending.start, pending.end) ==
+              cudaSuccess) {
+          completed.push_back(pending.event);
+        }
+        // the errors of the instrumentation are not reported to the next CUDA call of the caller
+        cudaGetLastError();
+        cudaEventDestroy(pending.start);
+        cudaEventDestroy(pending.end);
+      }
+      _pending = std::move(still_pending);
+    }
+    if (completed.empty()) { return; }
+
+    std::vector<api_event_callback> callbacks;
+    {
+      std::lock_guard lock{_callbacks_mutex};
+      std::transform(_callbacks.begin(),
+                     _callbacks.end(),
+                     std::back_inserter(callbacks),
+                     [](auto const& entry) { return entry.second; });
+    }
+    for (auto const& event : completed) {
+      for (auto const& callback : callbacks) {
+        callback(event);
+      }
+    }
+  }
+
+ private:
+  std::mutex _callbacks_mutex;
+  std::map<std::size_t, api_event_callback> _callbacks;
+  std::size_t _next_id{0};
+  std::mutex _pending_mutex;
+  std::vector<pending_event> _pending;
+};
+
+instrumentation_registry& registry()
+{
+  static instrumentation_registry instance;
+  return instance;
+}
+
+/**
+ * @brief Returns the bytes of the fixed-width data, offsets and null masks of `col`.
+ */
+std::size_t column_bytes(column_view const& col)
+{
+  auto const data_bytes =
+    is_fixed_width(col.type()) ? static_cast<std::size_t>(col.size()) * size_of(col.type()) : 0;
+  auto const mask_bytes = col.nullable() ? bitmask_allocation_size_bytes(col.size()) : 0;
+  return std::accumulate(col.child_begin(),
+                         col.child_end(),
+                         data_bytes + mask_bytes,
+                         [](std::size_t bytes, auto const& child) {
+                           return bytes + column_bytes(child);
+                         });
+}
+
+}  // namespace
+
+void api_event_scope::start(char const* name, rmm::cuda_stream_view stream, table_view const& input)
+{
+  _event.name        = name;
+  _event.stream      = stream;
+  _event.input_rows  = input.num_rows();
+  _event.input_bytes = std::accumulate(
+    input.begin(), input.end(), std::size_t{0}, [](std::size_t bytes, auto const& col) {
+      return bytes + column_bytes(col);
+    });
+
+  CUDF_CUDA_TRY(cudaEventCreate(&_start));
+  if (cudaEventRecord(_start, stream.value()) != cudaSuccess) {
+    cudaEventDestroy(_start);
+    _start = nullptr;
+    CUDF_CUDA_TRY(cudaGetLastError());
+  }
+  _allocated_at_start = thread_allocated;
+  _outer_peak         = std::exchange(thread_peak, thread_allocated);
+}
+
+void api_event_scope::finish() noexcept
+{
+  _event.peak_memory_bytes = static_cast<std::size_t>(thread_peak - _allocated_at_start);
+  thread_peak              = std::max(_outer_peak, thread_peak);
+
+  cudaEvent_t end{};
+  if (cudaEventCreate(&end) != cudaSuccess ||
+      cudaEventRecord(end, _event.stream.value()) != cudaSuccess) {
+    if (end != nullptr) { cudaEventDestroy(end); }
+    cudaEventDestroy(_start);
+    cudaGetLastError();
+    return;
+  }
+  try {
+    registry().push({_event, _start, end});
+    registry().deliver(false);
+  } catch (...) {
+    // a destructor must not throw, an event or callback failing is dropped
+  }
+}
+
+}  // namespace detail
+
+std::size_t register_api_event_callback(api_event_callback callback)
+{
+  CUDF_EXPECTS(callback != nullptr, "The callback must not be empty", std::invalid_argument);
+  return detail::registry().add(std::move(callback));
+}
+
+void unregister_api_event_callback(std::size_t id) { detail::registry().remove(id); }
+
+void flush_api_events() { detail::registry().deliver(true); }
+
+api_memory_tracker::api_memory_tracker(rmm::mr::device_memory_resource* upstream)
+  : _upstream{upstream}
+{
+  CUDF_EXPECTS(upstream != nullptr, "Unexpected null upstream resource", std::invalid_argument);
+}
+
+void* api_memory_tracker::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  auto const ptr = _upstream->allocate(bytes, stream);
+  detail::thread_allocated += static_cast<std::int64_t>(bytes);
+  detail::thread_peak = std::max(detail::thread_peak, detail::thread_allocated);
+  return ptr;
+}
+
+void api_memory_tracker::do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  _upstream->deallocate(ptr, bytes, stream);
+  detail::thread_allocated -= static_cast<std::int64_t>(bytes);
+}
+
+bool api_memory_tracker::do_is_equal(device_memory_resource const& other) const noexcept
+{
+  if (this == &other) { return true; }
+  auto const cast = dynamic_cast<api_memory_tracker const*>(&other);
+  if (cast == nullptr) { return _upstream->is_equal(other); }
+  return _upstream->is_equal(*cast->get_upstream());
+}
+
+}  // namespace cudf
@@ -17,9 +17,12 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/logger.hpp>
 
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_sinks.h>
 
+#include <memory>
 #include <string>
 
 namespace {
@@ -59,23 +62,64 @@ namespace {
 }
 
 /**
- * @brief Simple wrapper around a spdlog::logger that performs cuDF-specific initialization.
+ * @brief Returns whether the environment variable is set to `ON`.
+ */
+[[nodiscard]] bool is_env_on(char const* env_var_name)
+{
+  auto const env_value = std::getenv(env_var_name);
+  return env_value != nullptr && std::string(env_value) == "ON";
+}
+
+// Capacity of the queue of messages of the asynchronous loggers
+constexpr std::size_t async_queue_size = 8192;
+
+/**
+ * @brief Simple wrapper around the spdlog::loggers that performs cuDF-specific initialization.
+ *
+ * When `LIBCUDF_LOGGING_ASYNC` is `ON`, messages are queued and written to the sink by a
+ * background thread, so that logging never waits on the sink. The oldest messages are then dropped
+ * if the sink falls behind.
  */
 struct logger_wrapper {
-  spdlog::logger logger_;
+  // Destroyed last, after writing the messages still queued by the loggers
+  std::shared_ptr<spdlog::details::thread_pool> thread_pool_;
+  std::shared_ptr<spdlog::logger> logger_;
+  std::shared_ptr<spdlog::logger> perf_logger_;
 
-  logger_wrapper() : logger_{"CUDF", make_libcudf_sink()}
+  logger_wrapper()
   {
-    logger_.set_pattern("[%6t][%H:%M:%S:%f][%-6l] %v");
-    logger_.set_level(libcudf_log_level());
-    logger_.flush_on(spdlog::level::warn);
+    auto const sink = make_libcudf_sink();
+    if (is_env_on("LIBCUDF_LOGGING_ASYNC")) {
+      thread_pool_     = std::make_shared<spdlog::details::thread_pool>(async_queue_size, 1);
+      auto make_logger = [&](std::string name) {
+        return std::make_shared<spdlog::async_logger>(
+          std::move(name), sink, thread_pool_, spdlog::async_overflow_policy::overrun_oldest);
+      };
+      logger_      = make_logger("CUDF");
+      perf_logger_ = make_logger("CUDF_PERF");
+    } else {
+      logger_      = std::make_shared<spdlog::logger>("CUDF", sink);
+      perf_logger_ = std::make_shared<spdlog::logger>("CUDF_PERF", sink);
+    }
+
+    logger_->set_pattern("[%6t][%H:%M:%S:%f][%-6l] %v");
+    logger_->set_level(libcudf_log_level());
+    logger_->flush_on(spdlog::level::warn);
+
+    perf_logger_->set_pattern("[%6t][%H:%M:%S:%f][PERF  ] %v");
+    perf_logger_->set_level(is_env_on("LIBCUDF_PERF_LOGGING") ? spdlog::level::info
+                                                              : spdlog::level::off);
   }
 };
 
-}  // namespace
-
-spdlog::logger& cudf::logger()
+logger_wrapper& wrapped_loggers()
 {
   static logger_wrapper wrapped{};
-  return wrapped.logger_;
+  return wrapped;
 }
+
+}  // namespace
+
+spdlog::logger& cudf::logger() { return *wrapped_loggers().logger_; }
+
+spdlog::logger& cudf::perf_logger() { return *wrapped_loggers().perf_logger_; }
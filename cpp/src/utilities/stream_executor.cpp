@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/stream_executor.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace cudf {
+namespace {
+
+/// Marks a stream no task was submitted on yet
+constexpr stream_executor::task_id no_task = std::numeric_limits<stream_executor::task_id>::max();
+
+}  // namespace
+
+stream_executor::stream_executor(std::size_t num_streams, rmm::cuda_stream_view stream)
+  : _stream{stream}
+{
+  CUDF_EXPECTS(num_streams > 0, "The number of streams must be positive", std::invalid_argument);
+  _streams    = cudf::detail::fork_streams(stream, num_streams);
+  _last_tasks = std::vector<task_id>(num_streams, no_task);
+}
+
+stream_executor::~stream_executor()
+{
+  // the destructor must not throw, errors are left to the next CUDA call of the caller
+  for (auto const last : _last_tasks) {
+    if (last != no_task) { cudaStreamWaitEvent(_stream.value(), _events[last], 0); }
+  }
+  for (auto const event : _events) {
+    cudaEventDestroy(event);
+  }
+}
+
+stream_executor::task_id stream_executor::submit(task const& work,
+                                                 host_span<task_id const> dependencies)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(std::all_of(dependencies.begin(),
+                           dependencies.end(),
+                           [&](auto dependency) { return dependency < num_tasks(); }),
+               "Dependencies must be tasks submitted to the executor",
+               std::invalid_argument);
+
+  // reusing the stream of the first dependency orders the task after it without an event, as
+  // long as no unrelated task was enqueued on that stream in between
+  auto const stream_index = [&] {
+    if (!dependencies.empty()) {
+      auto const first = _task_streams[dependencies.front()];
+      if (_last_tasks[first] == dependencies.front()) { return first; }
+    }
+    auto const next = _next_stream;
+    _next_stream    = (_next_stream + 1) % _streams.size();
+    return next;
+  }();
+  auto const stream = _streams[stream_index];
+
+  // dependencies enqueued on the same stream are ordered before the task already
+  for (auto const dependency : dependencies) {
+    if (_task_streams[dependency] != stream_index) {
+      CUDF_CUDA_TRY(cudaStreamWaitEvent(stream.value(), _events[dependency], 0));
+    }
+  }
+
+  work(stream);
+
+  cudaEvent_t event{};
+  CUDF_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  auto const id = num_tasks();
+  _events.push_back(event);
+  _task_streams.push_back(stream_index);
+  _last_tasks[stream_index] = id;
+  CUDF_CUDA_TRY(cudaEventRecord(event, stream.value()));
+  return id;
+}
+
+void stream_executor::wait(task_id id, rmm::cuda_stream_view stream) const
+{
+  CUDF_EXPECTS(
+    id < num_tasks(), "The task must be submitted to the executor", std::invalid_argument);
+  CUDF_CUDA_TRY(cudaStreamWaitEvent(stream.value(), _events[id], 0));
+}
+
+void stream_executor::join() const
+{
+  // the last task of each stream completes after all the tasks before it on the stream
+  for (auto const last : _last_tasks) {
+    if (last != no_task) { CUDF_CUDA_TRY(cudaStreamWaitEvent(_stream.value(), _events[last], 0)); }
+  }
+}
+
+rmm::cuda_stream_view stream_executor::task_stream(task_id id) const
+{
+  CUDF_EXPECTS(
+    id < num_tasks(), "The task must be submitted to the executor", std::invalid_argument);
+  return _streams[_task_streams[id]];
+}
+
+}  // namespace cudf
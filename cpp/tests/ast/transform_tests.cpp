@@ -28,6 +28,7 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
@@ -140,6 +141,25 @@ TEST_F(TransformTest, BasicAddition)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, BasicAdditionSelectedRows)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+
+  auto const selection = cudf::make_selection_vector(column_wrapper<bool>{false, true, true, true});
+  auto expected        = column_wrapper<int32_t>{{0, 21, 50}, {0, 1, 1}};
+  auto result          = cudf::compute_column(table, expression, selection);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  auto const none = cudf::make_selection_vector(column_wrapper<bool>{false, false, false, false});
+  EXPECT_EQ(cudf::compute_column(table, expression, none)->size(), 0);
+}
+
 TEST_F(TransformTest, BasicAdditionEmptyTable)
 {
   auto c_0   = column_wrapper<int32_t>{};
@@ -568,6 +588,63 @@ TEST_F(TransformTest, StringScalarComparison)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, StringPrefixSuffix)
+{
+  auto c_0 = cudf::test::strings_column_wrapper({"apple", "ape", "", "grape", "ap", "maple"},
+                                                {true, true, true, true, true, false});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0    = cudf::ast::column_reference(0);
+  auto prefix_value = cudf::string_scalar("ap");
+  auto prefix       = cudf::ast::literal(prefix_value);
+  auto suffix_value = cudf::string_scalar("ple");
+  auto suffix       = cudf::ast::literal(suffix_value);
+
+  auto starts_with = cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, col_ref_0, prefix);
+  auto result      = cudf::compute_column(table, starts_with);
+  auto expected    = column_wrapper<bool>{{true, true, false, false, true, false},
+                                          {true, true, true, true, true, false}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  auto ends_with = cudf::ast::operation(cudf::ast::ast_operator::ENDS_WITH, col_ref_0, suffix);
+  result         = cudf::compute_column(table, ends_with);
+  expected       = column_wrapper<bool>{{true, false, false, false, false, false},
+                                        {true, true, true, true, true, false}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  auto number_value = cudf::numeric_scalar<int32_t>(1);
+  auto number       = cudf::ast::literal(number_value);
+  auto invalid      = cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, number, number);
+  EXPECT_THROW(cudf::compute_column(table, invalid), cudf::logic_error);
+}
+
+TEST_F(TransformTest, StringPredicate)
+{
+  // name == 'x' AND country IN ('a', 'c') in a single expression
+  auto names     = cudf::test::strings_column_wrapper({"x", "x", "y", "x", "x"});
+  auto countries = cudf::test::strings_column_wrapper({"a", "b", "a", "c", "ab"});
+  auto table     = cudf::table_view{{names, countries}};
+
+  auto name      = cudf::ast::column_reference(0);
+  auto country   = cudf::ast::column_reference(1);
+  auto x_value   = cudf::string_scalar("x");
+  auto x         = cudf::ast::literal(x_value);
+  auto a_value   = cudf::string_scalar("a");
+  auto a         = cudf::ast::literal(a_value);
+  auto c_value   = cudf::string_scalar("c");
+  auto c         = cudf::ast::literal(c_value);
+  auto is_x      = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, name, x);
+  auto is_a      = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, country, a);
+  auto is_c      = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, country, c);
+  auto is_in     = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, is_a, is_c);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, is_x, is_in);
+
+  auto result   = cudf::compute_column(table, predicate);
+  auto expected = column_wrapper<bool>{true, false, false, true, false};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
 TEST_F(TransformTest, NumericScalarComparison)
 {
   auto c_0   = column_wrapper<int32_t>{1, 12, 123, 23};
@@ -828,4 +905,223 @@ TEST_F(TransformTest, NullLogicalOr)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, CommonSubexpressions)
+{
+  auto c_0   = column_wrapper<double>{1.0, 2.5, -3.0, 10.0};
+  auto c_1   = column_wrapper<double>{2.0, 2.0, 4.0, 0.5};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  // expression: ((c0 * c1) > c1) && ((c0 * c1) < (c0 * c1 + c1)), with the product built twice
+  auto product       = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto other_product = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto sum           = cudf::ast::operation(cudf::ast::ast_operator::ADD, other_product, col_ref_1);
+  auto greater       = cudf::ast::operation(cudf::ast::ast_operator::GREATER, product, col_ref_1);
+  auto less          = cudf::ast::operation(cudf::ast::ast_operator::LESS, other_product, sum);
+  auto expression    = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, greater, less);
+
+  auto result   = cudf::compute_column(table, expression);
+  auto expected = column_wrapper<bool>{false, true, false, true};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ConstantFolding)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0   = cudf::ast::column_reference(0);
+  auto two_value   = cudf::numeric_scalar<int32_t>(2);
+  auto two         = cudf::ast::literal(two_value);
+  auto three_value = cudf::numeric_scalar<int32_t>(3);
+  auto three       = cudf::ast::literal(three_value);
+
+  // expression: c0 + (2 * 3 - 2)
+  auto product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, two, three);
+  auto difference = cudf::ast::operation(cudf::ast::ast_operator::SUB, product, two);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, difference);
+
+  auto result   = cudf::compute_column(table, expression);
+  auto expected = column_wrapper<int32_t>{7, 24, 5, 54};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  // a constant evaluating to null
+  auto null_value = cudf::numeric_scalar<int32_t>(0);
+  null_value.set_valid_async(false);
+  auto null_literal    = cudf::ast::literal(null_value);
+  auto null_sum        = cudf::ast::operation(cudf::ast::ast_operator::ADD, null_literal, three);
+  auto null_expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, null_sum);
+
+  auto null_result   = cudf::compute_column(table, null_expression);
+  auto null_expected = column_wrapper<int32_t>({0, 0, 0, 0}, {0, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(null_expected, null_result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitMultiLevelTreeArithmetic)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto literal_value = cudf::numeric_scalar<int32_t>(2);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  // expression: ((c0 + c1) * 2) - (c0 % 7)
+  auto sum     = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto product = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum, literal);
+
+  auto seven_value = cudf::numeric_scalar<int32_t>(7);
+  auto seven       = cudf::ast::literal(seven_value);
+  auto remainder   = cudf::ast::operation(cudf::ast::ast_operator::MOD, col_ref_0, seven);
+  auto expression  = cudf::ast::operation(cudf::ast::ast_operator::SUB, product, remainder);
+
+  auto result   = cudf::compute_column_jit(table, expression);
+  auto expected = column_wrapper<int32_t>{23, 48, 41, 99};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::compute_column(table, expression)->view(), result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitMixedOperators)
+{
+  auto c_0   = column_wrapper<double>{0.5, -1.5, 4.0, 1.0};
+  auto c_1   = column_wrapper<double>{2.0, 3.0, -4.0, 1.0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  // expression: (abs(c0) < sqrt(abs(c1))) || (floor_div(c0, c1) == c1)
+  auto abs_0      = cudf::ast::operation(cudf::ast::ast_operator::ABS, col_ref_0);
+  auto abs_1      = cudf::ast::operation(cudf::ast::ast_operator::ABS, col_ref_1);
+  auto root_1     = cudf::ast::operation(cudf::ast::ast_operator::SQRT, abs_1);
+  auto less       = cudf::ast::operation(cudf::ast::ast_operator::LESS, abs_0, root_1);
+  auto floor_div  = cudf::ast::operation(cudf::ast::ast_operator::FLOOR_DIV, col_ref_0, col_ref_1);
+  auto equal      = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, floor_div, col_ref_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, less, equal);
+
+  auto result   = cudf::compute_column_jit(table, expression);
+  auto expected = column_wrapper<bool>{true, true, false, true};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitFallback)
+{
+  // nullable inputs and string comparisons are evaluated by the interpreter
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto c_1   = cudf::test::strings_column_wrapper({"a", "bb", "a", "c"});
+  auto c_2   = cudf::test::strings_column_wrapper({"a", "b", "c", "c"});
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto expression = cudf::ast::operation(
+    cudf::ast::ast_operator::ADD, cudf::ast::column_reference(0), cudf::ast::column_reference(0));
+  auto result = cudf::compute_column_jit(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::compute_column(table, expression)->view(), result->view(), verbosity);
+
+  auto strings_expression = cudf::ast::operation(
+    cudf::ast::ast_operator::EQUAL, cudf::ast::column_reference(1), cudf::ast::column_reference(2));
+  auto strings_result = cudf::compute_column_jit(table, strings_expression);
+  auto expected       = column_wrapper<bool>{true, false, false, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, strings_result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ComputeColumns)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  // expressions: c0 + c1, (c0 + c1) * c1, c1 < 10, sharing the sum
+  auto sum       = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto product   = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum, col_ref_1);
+  auto ten_value = cudf::numeric_scalar<int32_t>(10);
+  auto ten       = cudf::ast::literal(ten_value);
+  auto less      = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_1, ten);
+
+  auto results = cudf::compute_columns(table, {sum, product, less});
+  ASSERT_EQ(results.size(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::compute_column(table, sum)->view(), results[0]->view(), verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::compute_column(table, product)->view(), results[1]->view(), verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::compute_column(table, less)->view(), results[2]->view(), verbosity);
+  EXPECT_FALSE(results[2]->nullable());
+
+  auto empty_0       = column_wrapper<int32_t>{};
+  auto empty_1       = column_wrapper<int32_t>{};
+  auto empty_results = cudf::compute_columns(cudf::table_view{{empty_0, empty_1}}, {sum, less});
+  ASSERT_EQ(empty_results.size(), 2);
+  EXPECT_EQ(empty_results[0]->size(), 0);
+  EXPECT_EQ(empty_results[1]->size(), 0);
+}
+
+TEST_F(TransformTest, ShortCircuitLogicalOperators)
+{
+  auto c_0   = column_wrapper<int32_t>{{5, -1, 3, 0, 7}, {1, 1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{{3, 4, 6, 8, 1}, {1, 1, 1, 0, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0   = cudf::ast::column_reference(0);
+  auto col_ref_1   = cudf::ast::column_reference(1);
+  auto zero_value  = cudf::numeric_scalar<int32_t>(0);
+  auto zero        = cudf::ast::literal(zero_value);
+  auto two_value   = cudf::numeric_scalar<int32_t>(2);
+  auto two         = cudf::ast::literal(two_value);
+  auto five_value  = cudf::numeric_scalar<int32_t>(5);
+  auto five        = cudf::ast::literal(five_value);
+  auto is_positive = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, zero);
+  auto doubled     = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_1, two);
+  auto is_large    = cudf::ast::operation(cudf::ast::ast_operator::GREATER, doubled, five);
+
+  // expression: (c0 > 0) op (c1 * 2 > 5), whose right operand is skipped by some rows
+  auto test_operator = [&](cudf::ast::ast_operator op, auto const& expected) {
+    auto expression = cudf::ast::operation(op, is_positive, is_large);
+    auto result     = cudf::compute_column(table, expression);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+    // the right operand cannot be skipped when another output reads its values
+    auto not_large = cudf::ast::operation(cudf::ast::ast_operator::NOT, is_large);
+    auto results   = cudf::compute_columns(table, {expression, not_large});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, results[0]->view(), verbosity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::compute_column(table, not_large)->view(), results[1]->view(), verbosity);
+  };
+  test_operator(cudf::ast::ast_operator::LOGICAL_AND,
+                column_wrapper<bool>{{true, false, false, false, false}, {1, 1, 0, 0, 1}});
+  test_operator(cudf::ast::ast_operator::NULL_LOGICAL_AND,
+                column_wrapper<bool>{{true, false, false, false, false}, {1, 1, 0, 1, 1}});
+  test_operator(cudf::ast::ast_operator::LOGICAL_OR,
+                column_wrapper<bool>{{true, true, true, true, true}, {1, 1, 0, 0, 1}});
+  test_operator(cudf::ast::ast_operator::NULL_LOGICAL_OR,
+                column_wrapper<bool>{{true, true, true, true, true}, {1, 1, 1, 0, 1}});
+
+  // without nulls
+  auto n_0            = column_wrapper<int32_t>{5, -1, 3};
+  auto n_1            = column_wrapper<int32_t>{3, 4, 1};
+  auto non_null_table = cudf::table_view{{n_0, n_1}};
+
+  auto and_expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, is_positive, is_large);
+  auto or_expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, is_positive, is_large);
+  auto and_result = cudf::compute_column(non_null_table, and_expression);
+  auto or_result  = cudf::compute_column(non_null_table, or_expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    column_wrapper<bool>{true, false, false}, and_result->view(), verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    column_wrapper<bool>{true, true, true}, or_result->view(), verbosity);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
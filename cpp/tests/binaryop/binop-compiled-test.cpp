@@ -24,6 +24,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -784,4 +785,34 @@ TEST_F(BinaryOperationCompiledTest_NullOpsString, NullMin_Vector_Vector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
 }
 
+struct BinaryOperationCompiledTest_Vectorized : public BinaryOperationTest {};
+
+TEST_F(BinaryOperationCompiledTest_Vectorized, UnalignedAndPartialVectors)
+{
+  // operands of the same type are processed 16 bytes at a time, except for the last rows and for
+  // the slices which are not aligned
+  using ADD  = cudf::library::operation::Add<int8_t, int8_t, int8_t>;
+  using LESS = cudf::library::operation::Less<bool, int16_t, int16_t>;
+  auto lhs   = lhs_random_column<int8_t>(1001);
+  auto rhs   = rhs_random_column<int8_t>(1001);
+  auto s_rhs = make_random_wrapped_scalar<int8_t>();
+
+  auto out = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::ADD, cudf::data_type(cudf::type_id::INT8));
+  ASSERT_BINOP<int8_t, int8_t, int8_t>(*out, lhs, rhs, ADD());
+  out = cudf::binary_operation(
+    lhs, s_rhs, cudf::binary_operator::ADD, cudf::data_type(cudf::type_id::INT8));
+  ASSERT_BINOP<int8_t, int8_t, int8_t>(*out, lhs, s_rhs, ADD());
+
+  auto lhs_16           = lhs_random_column<int16_t>(1001);
+  auto rhs_16           = rhs_random_column<int16_t>(1001);
+  auto const sliced_lhs = cudf::column(cudf::slice(lhs_16, {3, 1001}).front());
+  auto const sliced_rhs = cudf::column(cudf::slice(rhs_16, {3, 1001}).front());
+  auto const sliced_out = cudf::binary_operation(cudf::slice(lhs_16, {3, 1001}).front(),
+                                                 cudf::slice(rhs_16, {3, 1001}).front(),
+                                                 cudf::binary_operator::LESS,
+                                                 cudf::data_type(cudf::type_id::BOOL8));
+  ASSERT_BINOP<bool, int16_t, int16_t>(*sliced_out, sliced_lhs, sliced_rhs, LESS());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -618,6 +618,29 @@ TEST_F(CopyBitmaskTest, TestNonZeroOffset)
     gold_splice_mask.data(), splice_mask.data(), cudf::num_bitmask_words(number_of_bits));
 }
 
+TEST_F(CopyBitmaskTest, TestWordAlignedOffset)
+{
+  std::vector<int> validity_bit(1000);
+  for (auto& m : validity_bit) {
+    m = this->generate();
+  }
+  auto input_mask =
+    std::get<0>(cudf::test::detail::make_null_mask(validity_bit.begin(), validity_bit.end()));
+
+  int begin_bit         = 64;
+  int end_bit           = 999;
+  auto gold_splice_mask = std::get<0>(cudf::test::detail::make_null_mask(
+    validity_bit.begin() + begin_bit, validity_bit.begin() + end_bit));
+
+  auto splice_mask = cudf::copy_bitmask(
+    static_cast<cudf::bitmask_type const*>(input_mask.data()), begin_bit, end_bit);
+
+  cleanEndWord(splice_mask, begin_bit, end_bit);
+  auto number_of_bits = end_bit - begin_bit;
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+    gold_splice_mask.data(), splice_mask.data(), cudf::num_bitmask_words(number_of_bits));
+}
+
 TEST_F(CopyBitmaskTest, TestCopyColumnViewVectorContiguous)
 {
   cudf::data_type t{cudf::type_id::INT32};
@@ -754,4 +777,50 @@ TEST_F(MergeBitmaskTest, TestBitmaskOr)
   EXPECT_EQ(nullptr, result3_mask.data());
 }
 
+TEST_F(MergeBitmaskTest, TestAllValidAndAllNullMasks)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const all_valid({1, 2, 3, 4, 5}, {1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> const all_null({1, 2, 3, 4, 5}, {0, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> const some_null({1, 2, 3, 4, 5},
+                                                                  {1, 0, 1, 0, 1});
+
+  auto const num_rows = cudf::size_type{5};
+  auto const valid_mask =
+    cudf::create_null_mask(num_rows, cudf::mask_state::ALL_VALID, cudf::get_default_stream());
+  auto const some_null_mask =
+    cudf::copy_bitmask(static_cast<cudf::column_view>(some_null), cudf::get_default_stream());
+
+  {
+    auto const [mask, null_count] = cudf::bitmask_and(cudf::table_view({all_valid, some_null}));
+    EXPECT_EQ(null_count, 2);
+    CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+      mask.data(), some_null_mask.data(), cudf::num_bitmask_words(num_rows));
+  }
+  {
+    auto const [mask, null_count] = cudf::bitmask_and(cudf::table_view({some_null, all_null}));
+    EXPECT_EQ(null_count, num_rows);
+    EXPECT_EQ(cudf::null_count(static_cast<cudf::bitmask_type const*>(mask.data()), 0, num_rows),
+              num_rows);
+  }
+  {
+    // a nullable column without nulls still yields a mask
+    auto const [mask, null_count] = cudf::bitmask_and(cudf::table_view({all_valid}));
+    EXPECT_EQ(null_count, 0);
+    CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+      mask.data(), valid_mask.data(), cudf::num_bitmask_words(num_rows));
+  }
+  {
+    auto const [mask, null_count] = cudf::bitmask_or(cudf::table_view({all_null, some_null}));
+    EXPECT_EQ(null_count, 2);
+    CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+      mask.data(), some_null_mask.data(), cudf::num_bitmask_words(num_rows));
+  }
+  {
+    auto const [mask, null_count] = cudf::bitmask_or(cudf::table_view({all_valid, some_null}));
+    EXPECT_EQ(null_count, 0);
+    CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+      mask.data(), valid_mask.data(), cudf::num_bitmask_words(num_rows));
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -27,14 +27,18 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/filling.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 #include <numeric>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
@@ -367,6 +371,37 @@ TEST_F(TableTest, ConcatenateTablesWithOffsetsAndNulls)
   }
 }
 
+TEST_F(TableTest, ConcatenateManySmallTables)
+{
+  // many partitions of a few rows, some nullable and some sliced, so that output mask words span
+  // several partitions at arbitrary bit offsets
+  constexpr cudf::size_type num_tables = 1000;
+  auto const values = thrust::make_counting_iterator(0);
+  auto const valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 3 != 0 or i % 7 == 0; });
+  cudf::test::fixed_width_column_wrapper<int16_t> col1(values, values + 5 * num_tables, valids);
+  cudf::test::fixed_width_column_wrapper<double> col2(values, values + 5 * num_tables);
+  cudf::test::fixed_width_column_wrapper<int64_t> col3(values, values + 5 * num_tables, valids);
+  cudf::table_view const input({col1, col2, col3});
+
+  std::vector<cudf::table_view> tables;
+  std::vector<cudf::size_type> rows;
+  for (cudf::size_type t = 0; t < num_tables; ++t) {
+    auto const begin = 5 * t + t % 3;
+    auto const end   = begin + t % 4;
+    tables.push_back(cudf::slice(input, {begin, end}).front());
+    for (auto r = begin; r < end; ++r) {
+      rows.push_back(r);
+    }
+  }
+
+  auto const result = cudf::concatenate(tables);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(rows.begin(), rows.end());
+  auto const expected = cudf::gather(input, gather_map);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected->view(), result->view());
+}
+
 struct OverflowTest : public cudf::test::BaseFixture {};
 
 TEST_F(OverflowTest, OverflowTest)
@@ -1654,6 +1689,34 @@ TEST_F(DictionaryConcatTest, StringsKeys)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, strings);
 }
 
+TEST_F(DictionaryConcatTest, PrefixKeys)
+{
+  cudf::test::strings_column_wrapper strings1({"ccc", "aaa", "bbb", "aaa"});
+  cudf::test::strings_column_wrapper strings2({"aaa", "ccc", "bbb"}, {1, 0, 1});
+  cudf::test::strings_column_wrapper strings3({"ddd", "bbb"});
+  auto dictionary1 = cudf::dictionary::encode(strings1);
+  auto dictionary2 = cudf::dictionary::encode(strings2);
+  auto dictionary3 = cudf::dictionary::encode(strings3);
+
+  // the keys of the second column are a prefix of the keys of the first
+  auto result = cudf::concatenate(
+    std::vector<cudf::column_view>{dictionary2->view(), dictionary1->view()});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::dictionary_column_view(result->view()).keys(),
+                                 cudf::dictionary_column_view(dictionary1->view()).keys());
+  cudf::test::strings_column_wrapper expected(
+    {"aaa", "", "bbb", "ccc", "aaa", "bbb", "aaa"}, {1, 0, 1, 1, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(result->view()), expected);
+
+  // the keys of the third column are not a prefix so all the keys are merged
+  result = cudf::concatenate(
+    std::vector<cudf::column_view>{dictionary1->view(), dictionary3->view()});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::dictionary_column_view(result->view()).keys(),
+                                 cudf::test::strings_column_wrapper({"aaa", "bbb", "ccc", "ddd"}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *cudf::dictionary::decode(result->view()),
+    cudf::test::strings_column_wrapper({"ccc", "aaa", "bbb", "aaa", "ddd", "bbb"}));
+}
+
 template <typename T>
 struct DictionaryConcatTestFW : public cudf::test::BaseFixture {};
 
@@ -27,6 +27,9 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <string>
+#include <vector>
+
 class GatherTestStr : public cudf::test::BaseFixture {};
 
 TEST_F(GatherTestStr, StringColumn)
@@ -131,6 +134,44 @@ TEST_F(GatherTestStr, GatherDontCheckOutOfBounds)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view().column(0), expected);
 }
 
+TEST_F(GatherTestStr, GatherStringsColumnsTogether)
+{
+  // the short strings use the char parallel copy and the long ones the string parallel one
+  cudf::test::strings_column_wrapper short_strings({"eee", "bb", "", "aa", "bbb", "ééé"},
+                                                   {1, 1, 0, 1, 1, 1});
+  std::vector<std::string> h_long_strings;
+  for (int i = 0; i < 6; ++i) {
+    h_long_strings.push_back(std::string(40 + 7 * i, static_cast<char>('a' + i)));
+  }
+  cudf::test::strings_column_wrapper long_strings(h_long_strings.begin(), h_long_strings.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> numbers{1, 2, 3, 4, 5, 6};
+  cudf::table_view source_table({short_strings, numbers, long_strings});
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{4, 1, 5, 2, 7, 0, 0};
+  auto const gather = [&](cudf::table_view const& source) {
+    return cudf::detail::gather(source,
+                                gather_map,
+                                cudf::out_of_bounds_policy::NULLIFY,
+                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                cudf::get_default_stream(),
+                                rmm::mr::get_current_device_resource());
+  };
+  auto const results = gather(source_table);
+
+  // a table with a single strings column is gathered one column at a time
+  for (cudf::size_type i = 0; i < source_table.num_columns(); ++i) {
+    auto const expected = gather(cudf::table_view({source_table.column(i)}));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(i).view(), expected->get_column(0).view());
+  }
+
+  auto const sliced_short    = cudf::slice(short_strings, {1, 6}).front();
+  auto const sliced_long     = cudf::slice(long_strings, {0, 5}).front();
+  auto const sliced_results  = gather(cudf::table_view({sliced_short, sliced_long}));
+  auto const sliced_expected = gather(cudf::table_view({sliced_short}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sliced_results->get_column(0).view(),
+                                 sliced_expected->get_column(0).view());
+}
+
 TEST_F(GatherTestStr, GatherEmptyMapStringsColumn)
 {
   auto const zero_size_strings_column = cudf::make_empty_column(cudf::type_id::STRING);
@@ -25,9 +25,12 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <vector>
+
 template <typename T>
 class GatherTest : public cudf::test::BaseFixture {};
 
@@ -243,3 +246,48 @@ TYPED_TEST(GatherTest, MultiColNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_column, result->view().column(i));
   }
 }
+
+struct GatherMixedTest : public cudf::test::BaseFixture {};
+
+TEST_F(GatherMixedTest, MixedWidthColumnsNullifyOutOfBounds)
+{
+  using dec128 = numeric::decimal128;
+
+  cudf::test::fixed_width_column_wrapper<int8_t> col_int8({0, 1, 2, 3, 4, 5});
+  cudf::test::fixed_width_column_wrapper<int16_t> col_int16({0, 10, 20, 30, 40, 50},
+                                                            {1, 1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<float> col_float({0.f, .5f, 1.f, 1.5f, 2.f, 2.5f});
+  cudf::test::fixed_width_column_wrapper<int64_t> col_int64({0, -1, -2, -3, -4, -5});
+  cudf::test::fixed_point_column_wrapper<dec128::rep> col_dec128({0, 100, 200, 300, 400, 500},
+                                                                 numeric::scale_type{-2});
+  cudf::test::strings_column_wrapper col_str({"a", "b", "c", "d", "e", "f"});
+  // a sliced column checks that the batched gather applies the column offsets
+  cudf::test::fixed_width_column_wrapper<int32_t> col_int32({-1, 0, 1, 2, 3, 4, 5});
+  auto const sliced_int32 = cudf::slice(col_int32, {1, 7}).front();
+
+  cudf::table_view const source(
+    {col_int8, col_int16, col_float, col_int64, col_dec128, col_str, sliced_int32});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({5, 2, 6, 0});
+
+  auto const result = cudf::gather(source, gather_map, cudf::out_of_bounds_policy::NULLIFY);
+
+  std::vector<bool> const valids{true, true, false, true};
+  cudf::test::fixed_width_column_wrapper<int8_t> expect_int8({5, 2, 0, 0}, valids.begin());
+  cudf::test::fixed_width_column_wrapper<int16_t> expect_int16({50, 20, 0, 0}, {1, 0, 0, 1});
+  cudf::test::fixed_width_column_wrapper<float> expect_float({2.5f, 1.f, 0.f, 0.f},
+                                                             valids.begin());
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_int64({-5, -2, 0, 0}, valids.begin());
+  cudf::test::fixed_point_column_wrapper<dec128::rep> expect_dec128(
+    {500, 200, 0, 0}, valids.begin(), numeric::scale_type{-2});
+  cudf::test::strings_column_wrapper expect_str({"f", "c", "", "a"}, valids.begin());
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_int32({5, 2, 0, 0}, valids.begin());
+
+  cudf::table_view const expected({expect_int8,
+                                   expect_int16,
+                                   expect_float,
+                                   expect_int64,
+                                   expect_dec128,
+                                   expect_str,
+                                   expect_int32});
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, result->view());
+}
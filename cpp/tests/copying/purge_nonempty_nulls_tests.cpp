@@ -482,3 +482,23 @@ TEST_F(PurgeNonEmptyNullsTest, StructOfList)
     EXPECT_FALSE(cudf::has_nonempty_nulls(*result));
   }
 }
+
+TEST_F(PurgeNonEmptyNullsTest, OwnedColumn)
+{
+  auto input = LCW<T>{{{1, 2, 3, 4}, {5}, {6, 7}, {8, 9, 10}}, no_nulls()}.release();
+
+  // A column without non-empty nulls is returned as it is
+  auto const input_ptr = input.get();
+  auto result          = cudf::purge_nonempty_nulls(std::move(input));
+  EXPECT_EQ(result.get(), input_ptr);
+
+  cudf::detail::set_null_mask(
+    result->mutable_view().null_mask(), 2, 3, false, cudf::get_default_stream());
+  result->set_null_count(1);
+  EXPECT_TRUE(cudf::has_nonempty_nulls(*result));
+
+  auto const purged = cudf::purge_nonempty_nulls(std::move(result));
+  EXPECT_FALSE(cudf::has_nonempty_nulls(*purged));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::lists_column_view(*purged).offsets(),
+                                 offsets_col_t{0, 4, 5, 5, 8});
+}
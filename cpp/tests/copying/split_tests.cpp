@@ -34,8 +34,10 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 std::vector<cudf::size_type> splits_to_indices(std::vector<cudf::size_type> splits,
@@ -2350,6 +2352,108 @@ TEST_F(ContiguousSplitTableCornerCases, ExhaustedHasNextFalse)
   EXPECT_EQ(copied, 0);
 }
 
+TEST_F(ContiguousSplitTableCornerCases, ChunkedUnpackRoundTrip)
+{
+  auto const size = 400'000;
+  auto iter       = thrust::make_counting_iterator<int64_t>(0);
+  auto valids     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  cudf::test::fixed_width_column_wrapper<int64_t> a(iter, iter + size, valids);
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 13, 'x'); });
+  cudf::test::strings_column_wrapper b(strings, strings + size);
+  cudf::table_view t({a, b});
+
+  // pack into host memory through a 1MB bounce buffer
+  auto const stream = cudf::get_default_stream();
+  rmm::device_buffer buff(1 * 1024 * 1024, stream, rmm::mr::get_current_device_resource());
+  cudf::device_span<uint8_t> bounce_buff(static_cast<uint8_t*>(buff.data()), buff.size());
+  auto chunked_pack = cudf::chunked_pack::create(t, buff.size());
+  auto const total_size = chunked_pack->get_total_contiguous_size();
+  EXPECT_GT(total_size, buff.size());
+  std::vector<uint8_t> host_data(total_size);
+  std::size_t offset = 0;
+  while (chunked_pack->has_next()) {
+    auto const copied = chunked_pack->next(bounce_buff);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      host_data.data() + offset, buff.data(), copied, cudaMemcpyDefault, stream.value()));
+    stream.synchronize();
+    offset += copied;
+  }
+
+  // unpack from chunks of a different size than the packed ones
+  auto chunked_unpack = cudf::chunked_unpack::create(chunked_pack->build_metadata(), total_size);
+  EXPECT_EQ(chunked_unpack->get_total_contiguous_size(), total_size);
+  std::size_t const chunk_size = 300'000;
+  for (offset = 0; offset < total_size; offset += chunk_size) {
+    EXPECT_TRUE(chunked_unpack->has_next());
+    chunked_unpack->next(cudf::host_span<uint8_t const>(
+      host_data.data() + offset, std::min(chunk_size, total_size - offset)));
+  }
+  EXPECT_FALSE(chunked_unpack->has_next());
+  auto const packed = chunked_unpack->finish();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(t, cudf::unpack(packed));
+}
+
+TEST_F(ContiguousSplitTableCornerCases, ChunkedUnpackChunkTooLarge)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3, 4};
+  auto packed         = cudf::pack(cudf::table_view({a}));
+  auto const size     = packed.gpu_data->size();
+  auto chunked_unpack = cudf::chunked_unpack::create(std::move(packed.metadata), size);
+  std::vector<uint8_t> host_data(size + 1);
+
+  EXPECT_THROW(chunked_unpack->next(cudf::host_span<uint8_t const>(host_data)),
+               cudf::logic_error);
+  EXPECT_THROW(std::ignore = chunked_unpack->finish(), cudf::logic_error);
+  chunked_unpack->next(cudf::device_span<uint8_t const>(
+    static_cast<uint8_t const*>(packed.gpu_data->data()), size));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({a}), cudf::unpack(chunked_unpack->finish()));
+}
+
+TEST_F(ContiguousSplitTableCornerCases, CompressedRoundTrip)
+{
+  auto const size = 200'000;
+  auto iter       = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i / 8; });
+  auto valids     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  cudf::test::fixed_width_column_wrapper<int64_t> a(iter, iter + size, valids);
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i % 100); });
+  cudf::test::strings_column_wrapper b(strings, strings + size);
+  cudf::table_view t({a, b});
+  std::vector<cudf::size_type> const splits{0, 1000, 150'000};
+  auto const expected = cudf::split(t, splits);
+
+  for (auto compression : {cudf::io::compression_type::NONE, cudf::io::compression_type::LZ4}) {
+    auto const compressed = cudf::contiguous_split_compressed(t, splits, compression);
+    ASSERT_EQ(compressed.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      auto const packed = cudf::decompress_packed(compressed[i]);
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[i], cudf::unpack(packed));
+    }
+  }
+
+  auto const packed     = cudf::pack(t);
+  auto const compressed = cudf::compress_packed(packed, cudf::io::compression_type::LZ4);
+  EXPECT_LT(compressed.gpu_data->size(), packed.gpu_data->size());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(t, cudf::unpack(cudf::decompress_packed(compressed)));
+}
+
+TEST_F(ContiguousSplitTableCornerCases, CompressedEmptyTable)
+{
+  auto const compressed = cudf::compress_packed(cudf::pack({}), cudf::io::compression_type::LZ4);
+  EXPECT_EQ(compressed.gpu_data->size(), 0);
+  EXPECT_EQ(cudf::unpack(cudf::decompress_packed(compressed)).num_columns(), 0);
+}
+
+TEST_F(ContiguousSplitTableCornerCases, CompressedUnsupportedCodec)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3, 4};
+  EXPECT_THROW(cudf::contiguous_split_compressed(
+                 cudf::table_view({a}), {2}, cudf::io::compression_type::BROTLI),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::decompress_packed(cudf::compressed_packed_columns{}), cudf::logic_error);
+}
+
 struct ContiguousSplitNestedTypesTest : public cudf::test::BaseFixture {};
 
 TEST_F(ContiguousSplitNestedTypesTest, Lists)
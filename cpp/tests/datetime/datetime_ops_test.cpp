@@ -26,11 +26,14 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/timezone.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
 #include <thrust/transform.h>
 
+#include <filesystem>
+
 #define XXX false  // stub for null values
 
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
@@ -824,6 +827,65 @@ TEST_F(BasicDatetimeOpsTest, TestQuarter)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_quarter(timestamps_s), quarter);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestExtractDatetimeComponentsFused)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cudf::test::iterators;
+
+  auto timestamps_ms =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>{
+      {
+        -131968727238L,   // 1965-10-26 14:01:12.762 GMT
+        1530705600000L,   // 2018-07-04 12:00:00.000 GMT
+        0L,               // null
+        -11663029161000L  // 1600-05-31 05:40:39.000 GMT
+      },
+      null_at(2)};
+
+  std::vector<datetime_component> const components{datetime_component::YEAR,
+                                                   datetime_component::MONTH,
+                                                   datetime_component::DAY,
+                                                   datetime_component::HOUR,
+                                                   datetime_component::MILLISECOND};
+  auto const results = extract_datetime_components(timestamps_ms, components);
+  ASSERT_EQ(results.size(), components.size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[0], *extract_year(timestamps_ms));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[1], *extract_month(timestamps_ms));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[2], *extract_day(timestamps_ms));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[3], *extract_hour(timestamps_ms));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[4], *extract_millisecond_fraction(timestamps_ms));
+
+  EXPECT_THROW(extract_datetime_components(cudf::test::fixed_width_column_wrapper<int32_t>{1, 2},
+                                           components),
+               cudf::logic_error);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test::iterators;
+
+  auto const timestamps_s =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      {1594332839L, 0L, 1608581568L}, null_at(1)};
+
+  // Converting between the same timezone is a no-op
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::convert_timezone(timestamps_s, {}, "UTC", "UTC"),
+                                 timestamps_s);
+
+  if (not std::filesystem::exists("/usr/share/zoneinfo/Asia/Kolkata")) {
+    GTEST_SKIP() << "System timezone files are not available";
+  }
+
+  // Asia/Kolkata is UTC+05:30 without daylight saving time
+  auto const local_s =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      {1594332839L + 19800L, 0L, 1608581568L + 19800L}, null_at(1)};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::to_local_time(timestamps_s, {}, "Asia/Kolkata"), local_s);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::convert_timezone(local_s, {}, "Asia/Kolkata", "UTC"),
+                                 timestamps_s);
+}
+
 TYPED_TEST(TypedDatetimeOpsTest, TestCeilDatetime)
 {
   using T = TypeParam;
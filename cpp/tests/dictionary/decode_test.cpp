@@ -20,7 +20,11 @@
 
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/strings/contains.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 
+#include <stdexcept>
 #include <vector>
 
 struct DictionaryDecodeTest : public cudf::test::BaseFixture {};
@@ -67,3 +71,27 @@ TEST_F(DictionaryDecodeTest, EmptyColumn)
   EXPECT_EQ(output->size(), 0);
   EXPECT_EQ(output->type().id(), cudf::type_id::EMPTY);
 }
+
+TEST_F(DictionaryDecodeTest, KeysResults)
+{
+  cudf::test::strings_column_wrapper input({"eee", "aaa", "", "bbb", "ccc", "ccc", "aaa", "eee"},
+                                           {1, 1, 0, 1, 1, 1, 1, 1});
+  auto dictionary = cudf::dictionary::encode(input);
+  auto d_view     = cudf::dictionary_column_view(dictionary->view());
+
+  auto prog        = cudf::strings::regex_program::create("^[ab]");
+  auto keys_result = cudf::strings::contains_re(cudf::strings_column_view(d_view.keys()), *prog);
+  auto output      = cudf::dictionary::decode(d_view, keys_result->view());
+  auto expected    = cudf::strings::contains_re(cudf::strings_column_view(input), *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *output);
+
+  // nulls in the keys results are applied to the rows
+  cudf::test::fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 4}, {1, 0, 1, 1});
+  output = cudf::dictionary::decode(d_view, keys);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_keys({4, 1, 0, 2, 3, 3, 1, 4},
+                                                                {1, 1, 0, 0, 1, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_keys, *output);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> invalid({1, 2});
+  EXPECT_THROW(cudf::dictionary::decode(d_view, invalid), std::invalid_argument);
+}
@@ -20,9 +20,12 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/detail/iterator.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/transform.hpp>
 
+#include <string>
+
 template <typename T>
 class EncodeNumericTests : public cudf::test::BaseFixture {};
 
@@ -119,6 +122,28 @@ TEST_F(EncodeStringTest, UnorderedWithNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.second->view(), expect);
 }
 
+TEST_F(EncodeStringTest, ManyDuplicates)
+{
+  auto const num_rows = 1000;
+  auto const num_keys = 50;
+  auto const key_of   = [](auto i) { return (i * 7) % num_keys; };
+  auto const key_str  = [](auto key) {
+    return std::string(key < 10 ? "k0" : "k") + std::to_string(key);
+  };
+  auto const rows = cudf::detail::make_counting_transform_iterator(
+    0, [&](auto i) { return key_str(key_of(i)); });
+  auto const codes = cudf::detail::make_counting_transform_iterator(0, key_of);
+  auto const keys  = cudf::detail::make_counting_transform_iterator(0, key_str);
+
+  cudf::test::strings_column_wrapper input(rows, rows + num_rows);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect(codes, codes + num_rows);
+  cudf::test::strings_column_wrapper expect_keys(keys, keys + num_keys);
+  auto const result = cudf::encode(cudf::table_view({input}));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.first->view().column(0), expect_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.second->view(), expect);
+}
+
 TYPED_TEST(EncodeNumericTests, TableEncodeWithNulls)
 {
   auto col_1 = cudf::test::fixed_width_column_wrapper<TypeParam>({1, 0, 2, 0, 1}, {1, 0, 1, 0, 1});
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+struct groupby_filter_test : public cudf::test::BaseFixture {};
+
+namespace {
+
+/**
+ * @brief Aggregates the sum of `values` by `keys` on the rows where `filter` is true, and compares
+ * the results sorted by key to the expected ones
+ */
+void test_filtered_sum(cudf::column_view const& keys,
+                       cudf::column_view const& values,
+                       cudf::table_view const& filter_table,
+                       cudf::ast::expression const& filter,
+                       cudf::column_view const& expect_keys,
+                       cudf::column_view const& expect_vals,
+                       bool use_sort = false)
+{
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  if (use_sort) {
+    // WAR to force cudf::groupby to use sort implementation
+    requests[0].aggregations.push_back(
+      cudf::make_nth_element_aggregation<cudf::groupby_aggregation>(0));
+  }
+
+  cudf::groupby::groupby gb_obj(cudf::table_view({keys}));
+  auto const result =
+    gb_obj.aggregate(requests, filter_table, filter, cudf::test::get_default_stream());
+
+  auto const sort_order  = cudf::sorted_order(result.first->view());
+  auto const sorted_keys = cudf::gather(result.first->view(), *sort_order);
+  auto const sorted_vals =
+    cudf::gather(cudf::table_view({result.second[0].results[0]->view()}), *sort_order);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expect_keys}), *sorted_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals, sorted_vals->get_column(0));
+}
+
+}  // namespace
+
+TEST_F(groupby_filter_test, basic)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 3, 1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{3, 1, 4, 9, 2, 6, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> weights{5, 1, 7, 2, 8, 6, 9};
+
+  auto const filter_table = cudf::table_view{{weights}};
+  auto const threshold    = cudf::numeric_scalar<int32_t>(4);
+  auto const literal      = cudf::ast::literal(threshold);
+  auto const weight       = cudf::ast::column_reference(0);
+
+  auto const filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER, weight, literal);
+
+  // Key 3 only has row 6 left, key 2 only has row 5
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_vals{9, 6, 5};
+
+  test_filtered_sum(keys, vals, filter_table, filter, expect_keys, expect_vals);
+  test_filtered_sum(keys, vals, filter_table, filter, expect_keys, expect_vals, true);
+}
+
+TEST_F(groupby_filter_test, empty_groups_and_nulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys({1, 2, 1, 3, 1, 2, 4}, null_at(6));
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{3, 1, 4, 9, 2, 6, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> weights({5, 1, 7, 2, 8, 6, 9}, null_at(2));
+
+  auto const filter_table = cudf::table_view{{weights}};
+  auto const threshold    = cudf::numeric_scalar<int32_t>(4);
+  auto const literal      = cudf::ast::literal(threshold);
+  auto const weight       = cudf::ast::column_reference(0);
+
+  auto const filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER, weight, literal);
+
+  // A null predicate skips row 2, the null key skips row 6 and no row of key 3 passes the filter
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_vals{5, 6};
+
+  test_filtered_sum(keys, vals, filter_table, filter, expect_keys, expect_vals);
+  test_filtered_sum(keys, vals, filter_table, filter, expect_keys, expect_vals, true);
+}
+
+TEST_F(groupby_filter_test, projected_values)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 3, 1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> price{3, 1, 4, 9, 2, 6, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> quantity{2, 1, 1, 3, 2, 1, 0};
+
+  auto const table        = cudf::table_view{{price, quantity}};
+  auto const price_ref    = cudf::ast::column_reference(0);
+  auto const quantity_ref = cudf::ast::column_reference(1);
+  auto const zero         = cudf::numeric_scalar<int32_t>(0);
+  auto const zero_literal = cudf::ast::literal(zero);
+
+  // The projection is computed from the unfiltered rows
+  auto const revenue = cudf::ast::operation(cudf::ast::ast_operator::MUL, price_ref, quantity_ref);
+  auto const values  = cudf::compute_column(table, revenue);
+
+  auto const filter =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, quantity_ref, zero_literal);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_vals{14, 7, 27};
+
+  test_filtered_sum(keys, values->view(), table, filter, expect_keys, expect_vals);
+}
+
+TEST_F(groupby_filter_test, invalid_filter)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{3, 1, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> weights{5, 1};
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+
+  auto const weight = cudf::ast::column_reference(0);
+  auto const filter = cudf::ast::operation(cudf::ast::ast_operator::IDENTITY, weight);
+
+  cudf::groupby::groupby gb_obj(cudf::table_view({keys}));
+  EXPECT_THROW(gb_obj.aggregate(requests, cudf::table_view{{weights}}, filter),
+               std::invalid_argument);
+  EXPECT_THROW(gb_obj.aggregate(requests, cudf::table_view{{vals}}, filter), cudf::logic_error);
+}
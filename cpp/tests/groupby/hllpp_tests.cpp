@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+namespace {
+
+using keys_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+using int64_col = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+/**
+ * @brief Computes the sketches of the values of each key, in the order of the keys
+ */
+std::unique_ptr<cudf::column> groupby_sketches(cudf::column_view const& keys,
+                                               cudf::column_view const& values,
+                                               std::unique_ptr<cudf::groupby_aggregation>&& agg)
+{
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(std::move(agg));
+  auto const result   = cudf::groupby::groupby(cudf::table_view{{keys}}).aggregate(requests);
+  auto const sketches = cudf::table_view{{result.second[0].results[0]->view()}};
+  return std::move(cudf::sort_by_key(sketches, result.first->view())->release().front());
+}
+
+}  // namespace
+
+struct GroupbyHllppTest : public cudf::test::BaseFixture {};
+
+TEST_F(GroupbyHllppTest, SmallGroups)
+{
+  auto const keys   = keys_col{1, 2, 1, 2, 1, 3, 2, 1};
+  auto const values = int64_col{{10, 20, 10, 30, 11, 0, 20, 12}, null_at(5)};
+
+  auto const sketches =
+    groupby_sketches(keys, values, cudf::make_hllpp_aggregation<cudf::groupby_aggregation>(12));
+  EXPECT_EQ(sketches->type().id(), cudf::type_id::STRUCT);
+  EXPECT_EQ(sketches->num_children(), 410);
+
+  auto const estimates = cudf::estimate_distinct_count(sketches->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int64_col{3, 2, 0}, *estimates);
+}
+
+TEST_F(GroupbyHllppTest, LargeCardinality)
+{
+  auto constexpr num_rows = 100'000;
+
+  auto const values_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i % (num_rows / 2)); });
+  auto const keys_iter = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i % 2;
+  });
+  auto const values = int64_col(values_iter, values_iter + num_rows);
+  auto const keys   = keys_col(keys_iter, keys_iter + num_rows);
+
+  auto const sketches =
+    groupby_sketches(keys, values, cudf::make_hllpp_aggregation<cudf::groupby_aggregation>(12));
+  auto const estimates      = cudf::estimate_distinct_count(sketches->view());
+  auto const host_estimates = cudf::test::to_host<int64_t>(estimates->view()).first;
+
+  // Each key gets the even or the odd half of the distinct values
+  for (auto const estimate : host_estimates) {
+    EXPECT_LT(std::abs(static_cast<double>(estimate) - num_rows / 4) / (num_rows / 4), 0.05);
+  }
+}
+
+TEST_F(GroupbyHllppTest, MergeMatchesSingleSketch)
+{
+  auto const keys1   = keys_col{1, 2, 1, 3};
+  auto const values1 = int64_col{{1, 2, 3, 4}, null_at(3)};
+  auto const keys2   = keys_col{2, 1, 2, 1};
+  auto const values2 = int64_col{5, 1, 6, 7};
+
+  auto const sketches1 =
+    groupby_sketches(keys1, values1, cudf::make_hllpp_aggregation<cudf::groupby_aggregation>());
+  auto const sketches2 =
+    groupby_sketches(keys2, values2, cudf::make_hllpp_aggregation<cudf::groupby_aggregation>());
+  auto const partial_keys = keys_col{1, 2, 3, 1, 2};
+  auto const partials =
+    cudf::concatenate(std::vector<cudf::column_view>{sketches1->view(), sketches2->view()});
+  auto const merged = groupby_sketches(
+    partial_keys, *partials, cudf::make_merge_hllpp_aggregation<cudf::groupby_aggregation>());
+
+  auto const all_keys   = keys_col{1, 2, 1, 3, 2, 1, 2, 1};
+  auto const all_values = int64_col{{1, 2, 3, 4, 5, 1, 6, 7}, null_at(3)};
+  auto const expected   = groupby_sketches(
+    all_keys, all_values, cudf::make_hllpp_aggregation<cudf::groupby_aggregation>());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *merged);
+}
+
+TEST_F(GroupbyHllppTest, InvalidInput)
+{
+  EXPECT_THROW(cudf::make_hllpp_aggregation<cudf::groupby_aggregation>(3), std::invalid_argument);
+  EXPECT_THROW(cudf::make_merge_hllpp_aggregation<cudf::groupby_aggregation>(19),
+               std::invalid_argument);
+
+  auto const keys     = keys_col{1, 1};
+  auto const values   = int64_col{1, 2};
+  auto const sketches =
+    groupby_sketches(keys, values, cudf::make_hllpp_aggregation<cudf::groupby_aggregation>(10));
+  EXPECT_THROW(groupby_sketches(keys_col{1},
+                                *sketches,
+                                cudf::make_merge_hllpp_aggregation<cudf::groupby_aggregation>(12)),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::estimate_distinct_count(values), cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,10 +19,16 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+#include <limits>
+#include <vector>
 
 using namespace cudf::test::iterators;
 
@@ -224,6 +230,58 @@ TYPED_TEST(groupby_keys_test, pre_sorted_keys_nulls_before_include_nulls)
                   cudf::sorted::YES);
 }
 
+TYPED_TEST(groupby_keys_test, pre_clustered_keys)
+{
+  using K = TypeParam;
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  // Equal keys are contiguous but the groups are not in sorted order
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<K> keys        { 3, 3, 1, 1, 1, 4, 2, 2, 2, 2};
+  cudf::test::fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  cudf::test::fixed_width_column_wrapper<K> expect_keys { 1,       2,          3,    4};
+  cudf::test::fixed_width_column_wrapper<R> expect_vals { 9,       30,         1,    5};
+  // clang-format on
+
+  auto agg = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  std::move(agg),
+                  force_use_sort_impl::YES,
+                  cudf::null_policy::EXCLUDE,
+                  cudf::sorted::YES);
+}
+
+TYPED_TEST(groupby_keys_test, pre_clustered_keys_sorted_values)
+{
+  using K = TypeParam;
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::MEDIAN>;
+
+  // Aggregations that sort the values within each group
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<K> keys        { 3, 3, 3, 1, 1, 4, 2, 2, 2, 2};
+  cudf::test::fixed_width_column_wrapper<V> vals        { 9, 1, 5, 4, 2, 5, 8, 0, 7, 6};
+
+  cudf::test::fixed_width_column_wrapper<K> expect_keys { 1,    2,          3,       4};
+  cudf::test::fixed_width_column_wrapper<R> expect_vals { 3.,   6.5,        5.,      5.};
+  // clang-format on
+
+  auto agg = cudf::make_median_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  std::move(agg),
+                  force_use_sort_impl::YES,
+                  cudf::null_policy::EXCLUDE,
+                  cudf::sorted::YES);
+}
+
 TYPED_TEST(groupby_keys_test, mismatch_num_rows)
 {
   using K = TypeParam;
@@ -313,6 +371,26 @@ TYPED_TEST(groupby_keys_test, lists)
   test_single_agg(keys, values, expected_keys, expected_values, std::move(agg));
 }
 
+TEST_F(groupby_keys_test, estimate_memory)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5};
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+
+  cudf::groupby::groupby gb_obj(cudf::table_view({keys}));
+  auto const estimate = gb_obj.estimate_memory(requests);
+  // every key may be distinct: the keys, and INT64 sums with a null mask padded to 64 bytes
+  EXPECT_EQ(estimate.output_bytes, 6 * sizeof(int32_t) + 6 * sizeof(int64_t) + 64);
+  EXPECT_GT(estimate.temporary_bytes, 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> short_vals{1};
+  requests[0].values = short_vals;
+  EXPECT_THROW((void)gb_obj.estimate_memory(requests), cudf::logic_error);
+}
+
 struct groupby_string_keys_test : public cudf::test::BaseFixture {};
 
 TEST_F(groupby_string_keys_test, basic)
@@ -358,6 +436,98 @@ TEST_F(groupby_dictionary_keys_test, basic)
                   force_use_sort_impl::YES);
 }
 
+TEST_F(groupby_dictionary_keys_test, include_null_keys)
+{
+  using K = std::string;
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  // clang-format off
+  cudf::test::dictionary_column_wrapper<K>  keys       ({"b", "a", "b", "", "c", ""}, nulls_at({3, 5}));
+  cudf::test::fixed_width_column_wrapper<V> vals       {  0,   1,   2,  3,   4,  5};
+  cudf::test::dictionary_column_wrapper<K>  expect_keys({"a", "b", "c", ""}, null_at(3));
+  cudf::test::fixed_width_column_wrapper<R> expect_vals{  1,   2,   4,  8};
+  // clang-format on
+
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  cudf::make_sum_aggregation<cudf::groupby_aggregation>(),
+                  force_use_sort_impl::NO,
+                  cudf::null_policy::INCLUDE);
+}
+
+struct groupby_dense_keys_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_dense_keys_test, negative_keys_with_gaps)
+{
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<int64_t> keys        { -5, 100, -5, 7, 100, 7, 7 };
+  cudf::test::fixed_width_column_wrapper<V>       vals        {  0,   1,  2, 3,   4, 5, 6 };
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_keys { -5,  7, 100 };
+  cudf::test::fixed_width_column_wrapper<R>       expect_vals {  2, 14,   5 };
+  // clang-format on
+
+  test_single_agg(
+    keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+}
+
+TEST_F(groupby_dense_keys_test, wide_range_keys)
+{
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  // Too many key values for direct indexing, the keys are hashed
+  auto constexpr large = std::numeric_limits<int64_t>::max();
+  auto constexpr small = std::numeric_limits<int64_t>::min();
+
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<int64_t> keys        { large, small, large, 0 };
+  cudf::test::fixed_width_column_wrapper<V>       vals        {     1,     2,     3, 4 };
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_keys { small, 0, large };
+  cudf::test::fixed_width_column_wrapper<R>       expect_vals {     2, 4,     4 };
+  // clang-format on
+
+  test_single_agg(
+    keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+}
+
+TEST_F(groupby_dense_keys_test, multiple_columns_with_nulls)
+{
+  using R = cudf::detail::target_type_t<int32_t, cudf::aggregation::COUNT_ALL>;
+
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<int8_t>  keys0({ 1,  2,  1,  0,  2, 1 }, null_at(3));
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1({ 10, 10, 10, 10, 20, 0 }, null_at(5));
+  cudf::test::fixed_width_column_wrapper<int32_t> vals { 0,  1,  2,  3,  4, 5 };
+
+  cudf::test::fixed_width_column_wrapper<int8_t>  expect_keys0({ 0, 1,  1,  2,  2 }, null_at(0));
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys1({ 10, 0, 10, 10, 20 }, null_at(1));
+  cudf::test::fixed_width_column_wrapper<R>       expect_vals { 1, 1,  2,  1,  1 };
+  // clang-format on
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>(
+    cudf::null_policy::INCLUDE));
+
+  cudf::groupby::groupby gb_obj(cudf::table_view{{keys0, keys1}}, cudf::null_policy::INCLUDE);
+  auto const result = gb_obj.aggregate(requests);
+
+  auto const result_table = cudf::table_view{{result.first->get_column(0).view(),
+                                              result.first->get_column(1).view(),
+                                              result.second[0].results[0]->view()}};
+  auto const sorted = cudf::sort_by_key(result_table, result.first->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expect_keys0, expect_keys1, expect_vals}),
+                                sorted->view());
+}
+
 struct groupby_cache_test : public cudf::test::BaseFixture {};
 
 // To check if the cache doesn't insert multiple times to cache for the same aggregation on a
@@ -419,3 +589,45 @@ TEST_F(groupby_cache_test, duplicate_columns)
     cudf::make_nth_element_aggregation<cudf::groupby_aggregation>(0));
   EXPECT_NO_THROW(gb_obj.aggregate(requests));
 }
+
+// The later hash-based aggregations on the same object reuse the groups of the rows found by the
+// first one
+TEST_F(groupby_cache_test, reuse_key_groups)
+{
+  using V = int32_t;
+
+  cudf::test::strings_column_wrapper string_keys({"b", "a", "", "b", "c", "a", "b"}, null_at(2));
+  cudf::test::fixed_width_column_wrapper<int32_t> int_keys({2, 1, 0, 2, 3, 1, 2}, null_at(2));
+  cudf::test::fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6};
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_sums{6, 9, 4};
+  cudf::test::fixed_width_column_wrapper<V> expect_maxs{5, 6, 4};
+  cudf::test::fixed_width_column_wrapper<double> expect_means{3., 3., 4.};
+
+  auto const sorted_results = [](auto const& result) {
+    auto const results_table = cudf::table_view{{result.second[0].results[0]->view()}};
+    return cudf::sort_by_key(results_table, result.first->view());
+  };
+
+  auto const key_columns = std::vector<cudf::column_view>{string_keys, int_keys};
+  for (auto const& keys : key_columns) {
+    cudf::groupby::groupby gb_obj(
+      cudf::table_view({keys}), cudf::null_policy::EXCLUDE, cudf::sorted::NO, {}, {}, true);
+
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      expect_sums, sorted_results(gb_obj.aggregate(requests))->get_column(0));
+
+    requests[0].aggregations.clear();
+    requests[0].aggregations.push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      expect_maxs, sorted_results(gb_obj.aggregate(requests))->get_column(0));
+
+    requests[0].aggregations.clear();
+    requests[0].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      expect_means, sorted_results(gb_obj.aggregate(requests))->get_column(0));
+  }
+}
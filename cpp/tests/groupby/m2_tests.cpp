@@ -22,6 +22,7 @@
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
 
 using namespace cudf::test::iterators;
 
@@ -48,7 +49,12 @@ auto compute_M2(cudf::column_view const& keys, cudf::column_view const& values)
 
   auto gb_obj = cudf::groupby::groupby(cudf::table_view({keys}));
   auto result = gb_obj.aggregate(requests);
-  return std::pair(std::move(result.first->release()[0]), std::move(result.second[0].results[0]));
+  // The groups of the hash-based groupby are in no particular order
+  auto sorted = cudf::sort_by_key(
+    cudf::table_view({result.first->get_column(0).view(), result.second[0].results[0]->view()}),
+    result.first->view());
+  auto sorted_columns = sorted->release();
+  return std::pair(std::move(sorted_columns[0]), std::move(sorted_columns[1]));
 }
 }  // namespace
 
@@ -179,6 +185,27 @@ TYPED_TEST(GroupbyM2TypedTest, KeysAndValuesHaveNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_M2s, *out_M2s, verbosity);
 }
 
+TYPED_TEST(GroupbyM2TypedTest, DictionaryValuesHaveNulls)
+{
+  using T = TypeParam;
+  using R = cudf::detail::target_type_t<T, cudf::aggregation::M2>;
+
+  // key = 1: vals = [null, 3, 6]
+  // key = 2: vals = [1, 4, null, 9]
+  // key = 3: vals = [2, 8]
+  // key = 4: vals = [null]
+  auto const keys = keys_col<T>{{1, 2, 3, 1, 2, 2, 1, null, 3, 2, 4}, null_at(7)};
+  auto const vals = cudf::test::dictionary_column_wrapper<T>{
+    {null, 1, 2, 3, 4, null, 6, 7, 8, 9, null}, nulls_at({0, 5, 10})};
+
+  auto const [out_keys, out_M2s] = compute_M2(keys, vals);
+  auto const expected_keys       = keys_col<T>{1, 2, 3, 4};
+  auto const expected_M2s = M2s_col<R>{{4.5, 32.0 + 2.0 / 3.0, 18.0, 0.0 /*NULL*/}, null_at(3)};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_keys, *out_keys, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_M2s, *out_M2s, verbosity);
+}
+
 TYPED_TEST(GroupbyM2TypedTest, InputHaveNullsAndNaNs)
 {
   using T = TypeParam;
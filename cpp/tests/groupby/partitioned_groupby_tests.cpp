@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/lists/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+namespace {
+
+using keys_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+using vals_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+std::vector<std::unique_ptr<cudf::groupby_aggregation>> make_aggregations()
+{
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_nunique_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_median_aggregation<cudf::groupby_aggregation>());
+  return aggs;
+}
+
+std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> make_aggregation_lists()
+{
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs;
+  aggs.push_back(make_aggregations());
+  return aggs;
+}
+
+// Sorts the results of a groupby by their keys
+std::unique_ptr<cudf::table> sort_results(
+  std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::groupby::aggregation_result>> const&
+    results)
+{
+  auto const keys = results.first->view();
+  std::vector<cudf::column_view> columns(keys.begin(), keys.end());
+  for (auto const& result : results.second) {
+    for (auto const& col : result.results) {
+      columns.push_back(col->view());
+    }
+  }
+  return cudf::sort_by_key(cudf::table_view{columns}, keys);
+}
+
+// Aggregates the concatenated batches with a single groupby
+std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::groupby::aggregation_result>>
+expected_results(std::vector<cudf::column_view> const& keys,
+                 std::vector<cudf::column_view> const& values,
+                 cudf::null_policy null_handling = cudf::null_policy::EXCLUDE)
+{
+  auto const all_keys = cudf::concatenate(keys);
+  auto const all_vals = cudf::concatenate(values);
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values       = all_vals->view();
+  requests[0].aggregations = make_aggregations();
+  return cudf::groupby::groupby(cudf::table_view{{all_keys->view()}}, null_handling)
+    .aggregate(requests);
+}
+
+}  // namespace
+
+struct PartitionedGroupbyTest : public cudf::test::BaseFixture {};
+
+TEST_F(PartitionedGroupbyTest, MatchesSingleGroupby)
+{
+  auto const keys1 = keys_col{{1, 2, 3, 1, 2, 2, 1, 0, 3}, null_at(7)};
+  auto const vals1 = vals_col{{5, 1, 2, 3, 4, 5, 6, 7, 8}, nulls_at({1, 4})};
+  auto const keys2 = keys_col{4, 2, 1, 4, 3};
+  auto const vals2 = vals_col{{9, 2, 3, 1, 0}, null_at(3)};
+  auto const keys3 = keys_col{};
+  auto const vals3 = vals_col{};
+  auto const keys4 = keys_col{{5, 1, 5}, null_at(2)};
+  auto const vals4 = vals_col{{7, 7, 7}, null_at(0)};
+  std::vector<cudf::column_view> const keys{keys1, keys2, keys3, keys4};
+  std::vector<cudf::column_view> const vals{vals1, vals2, vals3, vals4};
+
+  for (auto const null_handling : {cudf::null_policy::EXCLUDE, cudf::null_policy::INCLUDE}) {
+    cudf::groupby::partitioned_groupby grouper(
+      make_aggregation_lists(), 3, std::size_t{1} << 30, null_handling);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      grouper.add_batch(cudf::table_view{{keys[i]}}, std::vector<cudf::column_view>{vals[i]});
+    }
+    EXPECT_EQ(grouper.num_partitions(), 3);
+
+    auto const expected = expected_results(keys, vals, null_handling);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sort_results(expected),
+                                       *sort_results(grouper.finalize()));
+  }
+}
+
+TEST_F(PartitionedGroupbyTest, PartitionsHaveDisjointKeys)
+{
+  auto const keys = keys_col{1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4};
+  auto const vals = vals_col{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+
+  cudf::groupby::partitioned_groupby grouper(make_aggregation_lists(), 4, std::size_t{1} << 30);
+  grouper.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{vals});
+
+  std::vector<std::unique_ptr<cudf::table>> partition_keys;
+  std::vector<cudf::column_view> key_views;
+  for (cudf::size_type i = 0; i < grouper.num_partitions(); ++i) {
+    partition_keys.push_back(std::move(grouper.aggregate_partition(i).first));
+    key_views.push_back(partition_keys.back()->get_column(0).view());
+  }
+  // every group is in exactly one partition
+  auto const all_keys = cudf::concatenate(key_views);
+  auto const sorted   = cudf::sort(cudf::table_view{{all_keys->view()}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted->get_column(0), keys_col{1, 2, 3, 4, 5, 6, 7, 8});
+  EXPECT_THROW((void)grouper.aggregate_partition(4), std::out_of_range);
+}
+
+TEST_F(PartitionedGroupbyTest, RepartitionsOverBudget)
+{
+  auto constexpr num_rows    = 4000;
+  auto constexpr num_batches = 4;
+
+  std::vector<std::unique_ptr<cudf::column>> keys_cols;
+  std::vector<std::unique_ptr<cudf::column>> vals_cols;
+  for (int b = 0; b < num_batches; ++b) {
+    auto const key_it = cudf::detail::make_counting_transform_iterator(
+      0, [b](auto i) { return (i * 7 + b * 11) % (num_rows / 2); });
+    auto const val_it =
+      cudf::detail::make_counting_transform_iterator(0, [b](auto i) { return i % 100 + b; });
+    keys_cols.push_back(keys_col(key_it, key_it + num_rows).release());
+    vals_cols.push_back(vals_col(val_it, val_it + num_rows, nulls_at({3, 42})).release());
+  }
+  std::vector<cudf::column_view> keys;
+  std::vector<cudf::column_view> vals;
+  for (int b = 0; b < num_batches; ++b) {
+    keys.push_back(keys_cols[b]->view());
+    vals.push_back(vals_cols[b]->view());
+  }
+
+  // A budget of a few KB partitions the buckets again, over several levels
+  cudf::groupby::partitioned_groupby grouper(make_aggregation_lists(), 2, 4096);
+  for (int b = 0; b < num_batches; ++b) {
+    grouper.add_batch(cudf::table_view{{keys[b]}}, std::vector<cudf::column_view>{vals[b]});
+  }
+
+  auto const expected = expected_results(keys, vals);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sort_results(expected), *sort_results(grouper.finalize()));
+}
+
+TEST_F(PartitionedGroupbyTest, CollectAndStringKeys)
+{
+  auto const keys1 = cudf::test::strings_column_wrapper{"a", "bb", "a", "ccc", ""};
+  auto const vals1 = vals_col{1, 2, 3, 4, 5};
+  auto const keys2 = cudf::test::strings_column_wrapper{"ccc", "a", "dd"};
+  auto const vals2 = vals_col{6, 7, 8};
+
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs(1);
+  aggs[0].push_back(cudf::make_collect_list_aggregation<cudf::groupby_aggregation>());
+  aggs[0].push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::partitioned_groupby grouper(std::move(aggs), 2, 64);
+  grouper.add_batch(cudf::table_view{{keys1}}, std::vector<cudf::column_view>{vals1});
+  grouper.add_batch(cudf::table_view{{keys2}}, std::vector<cudf::column_view>{vals2});
+
+  auto [result_keys, results] = grouper.finalize();
+  auto const order            = cudf::sorted_order(result_keys->view());
+  auto const sorted_keys      = cudf::gather(result_keys->view(), *order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_keys->get_column(0),
+                                 cudf::test::strings_column_wrapper{"", "a", "bb", "ccc", "dd"});
+
+  auto const sorted_max = cudf::gather(cudf::table_view{{results[0].results[1]->view()}}, *order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_max->get_column(0), vals_col{5, 7, 2, 6, 8});
+
+  // the rows of a group are not collected in a specific order
+  auto const sorted_lists =
+    cudf::gather(cudf::table_view{{results[0].results[0]->view()}}, *order);
+  auto const lists = cudf::lists::sort_lists(cudf::lists_column_view(sorted_lists->get_column(0)),
+                                             cudf::order::ASCENDING,
+                                             cudf::null_order::AFTER);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *lists, cudf::test::lists_column_wrapper<int32_t>{{5}, {1, 3, 7}, {2}, {4, 6}, {8}});
+}
+
+TEST_F(PartitionedGroupbyTest, DictionaryKeys)
+{
+  // The batches have different dictionaries for the same keys
+  auto const keys1 = cudf::dictionary::encode(keys_col{10, 20, 10, 30});
+  auto const vals1 = vals_col{1, 2, 3, 4};
+  auto const keys2 = cudf::dictionary::encode(keys_col{30, 40, 10});
+  auto const vals2 = vals_col{5, 6, 7};
+
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs(1);
+  aggs[0].push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::partitioned_groupby grouper(std::move(aggs), 4, std::size_t{1} << 30);
+  grouper.add_batch(cudf::table_view{{keys1->view()}}, std::vector<cudf::column_view>{vals1});
+  grouper.add_batch(cudf::table_view{{keys2->view()}}, std::vector<cudf::column_view>{vals2});
+
+  auto const result = sort_results(grouper.finalize());
+  auto const decoded_keys =
+    cudf::dictionary::decode(cudf::dictionary_column_view(result->get_column(0)));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded_keys, keys_col{10, 20, 30, 40});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result->get_column(1),
+                                      cudf::test::fixed_width_column_wrapper<int64_t>{11, 2, 9, 6});
+}
+
+TEST_F(PartitionedGroupbyTest, InvalidArguments)
+{
+  EXPECT_THROW(
+    cudf::groupby::partitioned_groupby(make_aggregation_lists(), 0, std::size_t{1} << 30),
+    cudf::logic_error);
+  EXPECT_THROW(cudf::groupby::partitioned_groupby(make_aggregation_lists(), 2, 0),
+               cudf::logic_error);
+
+  cudf::groupby::partitioned_groupby grouper(make_aggregation_lists(), 2, std::size_t{1} << 30);
+  EXPECT_THROW((void)grouper.finalize(), cudf::logic_error);
+
+  auto const keys = keys_col{1, 2};
+  auto const vals = vals_col{1, 2};
+  grouper.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{vals});
+  auto const float_vals = cudf::test::fixed_width_column_wrapper<float>{1, 2};
+  EXPECT_THROW(
+    grouper.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{float_vals}),
+    cudf::logic_error);
+  auto const short_vals = vals_col{1};
+  EXPECT_THROW(
+    grouper.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{short_vals}),
+    cudf::logic_error);
+}
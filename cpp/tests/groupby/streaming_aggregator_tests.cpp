@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+namespace {
+
+using keys_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+using vals_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+std::vector<std::unique_ptr<cudf::groupby_aggregation>> make_aggregations()
+{
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(
+    cudf::make_count_aggregation<cudf::groupby_aggregation>(cudf::null_policy::INCLUDE));
+  aggs.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_m2_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_variance_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_std_aggregation<cudf::groupby_aggregation>(0));
+  return aggs;
+}
+
+// Sorts the results of a groupby by their keys
+std::unique_ptr<cudf::table> sort_results(
+  std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::groupby::aggregation_result>> const&
+    results)
+{
+  auto const keys = results.first->view();
+  std::vector<cudf::column_view> columns(keys.begin(), keys.end());
+  for (auto const& result : results.second) {
+    for (auto const& col : result.results) {
+      columns.push_back(col->view());
+    }
+  }
+  return cudf::sort_by_key(cudf::table_view{columns}, keys);
+}
+
+}  // namespace
+
+struct StreamingAggregatorTest : public cudf::test::BaseFixture {};
+
+TEST_F(StreamingAggregatorTest, MatchesSingleGroupby)
+{
+  auto const keys1 = keys_col{{1, 2, 3, 1, 2, 2, 1, 0, 3}, null_at(7)};
+  auto const vals1 = vals_col{{5, 1, 2, 3, 4, 5, 6, 7, 8}, nulls_at({1, 4})};
+  auto const keys2 = keys_col{4, 2, 1, 4, 3};
+  auto const vals2 = vals_col{{9, 2, 3, 1, 0}, null_at(3)};
+  auto const keys3 = keys_col{};
+  auto const vals3 = vals_col{};
+  auto const keys4 = keys_col{{5, 1, 5}, null_at(2)};
+  auto const vals4 = vals_col{{7, 7, 7}, null_at(0)};
+
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs;
+  aggs.push_back(make_aggregations());
+  cudf::groupby::streaming_aggregator aggregator(std::move(aggs));
+  std::vector<std::pair<cudf::column_view, cudf::column_view>> const batches{
+    {keys1, vals1}, {keys2, vals2}, {keys3, vals3}, {keys4, vals4}};
+  for (auto const& [keys, vals] : batches) {
+    aggregator.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{vals});
+  }
+  EXPECT_EQ(aggregator.num_groups(), 5);
+
+  auto const all_keys =
+    cudf::concatenate(std::vector<cudf::column_view>{keys1, keys2, keys3, keys4});
+  auto const all_vals =
+    cudf::concatenate(std::vector<cudf::column_view>{vals1, vals2, vals3, vals4});
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values       = all_vals->view();
+  requests[0].aggregations = make_aggregations();
+  auto const expected =
+    cudf::groupby::groupby(cudf::table_view{{all_keys->view()}}).aggregate(requests);
+
+  auto const result = aggregator.finalize();
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sort_results(expected), *sort_results(result));
+}
+
+TEST_F(StreamingAggregatorTest, FinalizeBetweenBatches)
+{
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs(1);
+  aggs[0].push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  aggs[0].push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::streaming_aggregator aggregator(std::move(aggs));
+
+  auto const keys1 = keys_col{1, 2, 1};
+  auto const vals1 = vals_col{1, 2, 3};
+  aggregator.add_batch(cudf::table_view{{keys1}}, std::vector<cudf::column_view>{vals1});
+  {
+    auto const result = sort_results(aggregator.finalize());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+      cudf::test::fixed_width_column_wrapper<int64_t>{4, 2}, result->get_column(1));
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(vals_col{3, 2}, result->get_column(2));
+  }
+
+  auto const keys2 = keys_col{2, 3};
+  auto const vals2 = vals_col{4, 5};
+  aggregator.add_batch(cudf::table_view{{keys2}}, std::vector<cudf::column_view>{vals2});
+  auto const result = sort_results(aggregator.finalize());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(keys_col{1, 2, 3}, result->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(cudf::test::fixed_width_column_wrapper<int64_t>{4, 6, 5},
+                                      result->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(vals_col{3, 4, 5}, result->get_column(2));
+}
+
+TEST_F(StreamingAggregatorTest, ManyBatchesOfNewAndSeenGroups)
+{
+  // Each batch has groups of the previous batches and new ones, so the map of the groups grows
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs(1);
+  aggs[0].push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  aggs[0].push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::streaming_aggregator aggregator(std::move(aggs));
+
+  std::vector<std::unique_ptr<cudf::column>> all_keys;
+  std::vector<std::unique_ptr<cudf::column>> all_vals;
+  for (int batch = 0; batch < 8; ++batch) {
+    auto const keys_iter = cudf::detail::make_counting_transform_iterator(
+      0, [batch](auto i) { return (i * 7 + batch * 100) % (200 * (batch + 1)); });
+    auto const vals_iter = cudf::detail::make_counting_transform_iterator(
+      0, [batch](auto i) { return i + batch; });
+    all_keys.push_back(keys_col(keys_iter, keys_iter + 300).release());
+    all_vals.push_back(vals_col(vals_iter, vals_iter + 300).release());
+    aggregator.add_batch(cudf::table_view{{all_keys.back()->view()}},
+                         std::vector<cudf::column_view>{all_vals.back()->view()});
+  }
+
+  std::vector<cudf::column_view> key_views;
+  std::vector<cudf::column_view> val_views;
+  for (std::size_t i = 0; i < all_keys.size(); ++i) {
+    key_views.push_back(all_keys[i]->view());
+    val_views.push_back(all_vals[i]->view());
+  }
+  auto const keys = cudf::concatenate(key_views);
+  auto const vals = cudf::concatenate(val_views);
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = vals->view();
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  auto const expected =
+    cudf::groupby::groupby(cudf::table_view{{keys->view()}}).aggregate(requests);
+
+  EXPECT_EQ(aggregator.num_groups(), expected.first->num_rows());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sort_results(expected), *sort_results(aggregator.finalize()));
+}
+
+TEST_F(StreamingAggregatorTest, StringKeysAndValues)
+{
+  // MIN and MAX of strings are not merged in place
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs(1);
+  aggs[0].push_back(cudf::make_min_aggregation<cudf::groupby_aggregation>());
+  aggs[0].push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+  aggs[0].push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::streaming_aggregator aggregator(std::move(aggs));
+
+  using strings_col = cudf::test::strings_column_wrapper;
+  auto const keys1  = strings_col{{"a", "bb", "a", "ccc", ""}, null_at(4)};
+  auto const vals1  = strings_col{{"x", "y", "z", "w", "v"}, null_at(2)};
+  auto const keys2  = strings_col{"bb", "dd", "a"};
+  auto const vals2  = strings_col{{"a", "b", "c"}, null_at(1)};
+  aggregator.add_batch(cudf::table_view{{keys1}}, std::vector<cudf::column_view>{vals1});
+  aggregator.add_batch(cudf::table_view{{keys2}}, std::vector<cudf::column_view>{vals2});
+
+  auto const result = sort_results(aggregator.finalize());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(strings_col{"a", "bb", "ccc", "dd"}, result->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(strings_col({"c", "a", "w", ""}, null_at(3)),
+                                      result->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(strings_col({"x", "y", "w", ""}, null_at(3)),
+                                      result->get_column(2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(cudf::test::fixed_width_column_wrapper<int32_t>{2, 2, 1, 0},
+                                      result->get_column(3));
+}
+
+TEST_F(StreamingAggregatorTest, InvalidInput)
+{
+  {
+    std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs(1);
+    aggs[0].push_back(cudf::make_nunique_aggregation<cudf::groupby_aggregation>());
+    EXPECT_THROW(cudf::groupby::streaming_aggregator(std::move(aggs)), cudf::logic_error);
+  }
+
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggs(1);
+  aggs[0].push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::streaming_aggregator aggregator(std::move(aggs));
+  EXPECT_THROW((void)aggregator.finalize(), cudf::logic_error);
+
+  auto const keys      = keys_col{1, 2};
+  auto const vals      = vals_col{1, 2};
+  auto const long_vals = vals_col{1, 2, 3};
+  auto const fp_vals   = cudf::test::fixed_width_column_wrapper<double>{1.0, 2.0};
+  EXPECT_THROW(aggregator.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{}),
+               cudf::logic_error);
+  EXPECT_THROW(
+    aggregator.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{long_vals}),
+    cudf::logic_error);
+  aggregator.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{vals});
+  EXPECT_THROW(
+    aggregator.add_batch(cudf::table_view{{keys}}, std::vector<cudf::column_view>{fp_vals}),
+    cudf::logic_error);
+}
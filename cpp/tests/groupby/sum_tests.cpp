@@ -22,6 +22,11 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <vector>
 
 using namespace cudf::test::iterators;
 
@@ -130,6 +135,42 @@ TYPED_TEST(groupby_sum_test, null_keys_and_values)
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, low_cardinality_keys)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  // Enough rows with few distinct keys to aggregate in shared memory
+  constexpr cudf::size_type num_rows   = 100'000;
+  constexpr cudf::size_type num_groups = 7;
+  auto const key_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<K>(i % num_groups); });
+  auto const key_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  auto const val_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  auto const val_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  cudf::test::fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows, key_valid);
+  cudf::test::fixed_width_column_wrapper<V, int32_t> vals(
+    val_iter, val_iter + num_rows, val_valid);
+
+  std::vector<int64_t> sums(num_groups, 0);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    if (i % 11 != 0 and i % 5 != 0) { sums[i % num_groups] += i % 10; }
+  }
+  auto const expect_key_iter = thrust::make_counting_iterator<K>(0);
+  cudf::test::fixed_width_column_wrapper<K> expect_keys(
+    expect_key_iter, expect_key_iter + num_groups, no_nulls());
+  cudf::test::fixed_width_column_wrapper<R, int64_t> expect_vals(sums.begin(), sums.end());
+
+  auto agg = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 TYPED_TEST(groupby_sum_test, dictionary)
 {
   using V = TypeParam;
@@ -229,3 +270,22 @@ TYPED_TEST(GroupBySumFixedPointTest, GroupByHashSumDecimalAsValue)
     EXPECT_THROW(test_single_agg(keys, vals, expect_keys, {}, std::move(agg8)), cudf::logic_error);
   }
 }
+
+struct GroupBySumDecimal128Test : public cudf::test::BaseFixture {};
+
+TEST_F(GroupBySumDecimal128Test, HashSumCarriesAcrossWords)
+{
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<__int128_t>;
+  using K          = int32_t;
+
+  // the sums carry and borrow between the low and the high 64-bit words
+  auto const two_64 = __int128_t{1} << 64;
+  auto const keys   = cudf::test::fixed_width_column_wrapper<K>{1, 2, 1, 2, 1, 2};
+  auto const vals   = fp_wrapper{{two_64 - 1, -1, 1, -two_64, two_64, 3}, numeric::scale_type{-2}};
+
+  auto const expect_keys     = cudf::test::fixed_width_column_wrapper<K>{1, 2};
+  auto const expect_vals_sum = fp_wrapper{{2 * two_64, 2 - two_64}, numeric::scale_type{-2}};
+
+  auto agg = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals_sum, std::move(agg));
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/aggregation.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+template <typename V>
+struct groupby_top_k_test : public cudf::test::BaseFixture {};
+
+using FixedWidthTypesNotBool = cudf::test::Concat<cudf::test::IntegralTypesNotBool,
+                                                  cudf::test::FloatingPointTypes,
+                                                  cudf::test::TimestampTypes>;
+TYPED_TEST_SUITE(groupby_top_k_test, FixedWidthTypesNotBool);
+
+TYPED_TEST(groupby_top_k_test, Basic)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<K, int32_t> keys{1, 2, 1, 1, 2, 1, 3};
+  cudf::test::fixed_width_column_wrapper<V, int32_t> values{{5, 3, 9, 0, 4, 7, 0},
+                                                            nulls_at({3, 6})};
+
+  cudf::test::fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2, 3};
+  cudf::test::lists_column_wrapper<V, int32_t> expect_top{{9, 7}, {4, 3}, {}};
+  cudf::test::lists_column_wrapper<V, int32_t> expect_bottom{{5, 7}, {3, 4}, {}};
+
+  test_single_agg(keys,
+                  values,
+                  expect_keys,
+                  expect_top,
+                  cudf::make_top_k_aggregation<cudf::groupby_aggregation>(2));
+  test_single_agg(
+    keys,
+    values,
+    expect_keys,
+    expect_bottom,
+    cudf::make_top_k_aggregation<cudf::groupby_aggregation>(2, cudf::order::ASCENDING));
+}
+
+struct groupby_top_k_misc_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_top_k_misc_test, ManyChunksPerGroup)
+{
+  auto constexpr num_rows   = 5000;
+  auto constexpr num_groups = 3;
+
+  std::vector<int32_t> keys(num_rows);
+  std::vector<int32_t> values(num_rows);
+  std::vector<std::vector<int32_t>> group_values(num_groups);
+  for (int32_t i = 0; i < num_rows; ++i) {
+    keys[i]   = i % num_groups;
+    values[i] = (i * 7919) % 5003;
+    group_values[keys[i]].push_back(values[i]);
+  }
+  for (auto& group : group_values) {
+    std::sort(group.begin(), group.end(), std::greater<>{});
+  }
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys_col(keys.begin(), keys.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> values_col(values.begin(), values.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{0, 1, 2};
+
+  // The heaps select the candidates of the small k, a large k sorts all the values
+  for (auto const k : {5, 100}) {
+    using lcw = cudf::test::lists_column_wrapper<int32_t>;
+    lcw expect_vals{lcw(group_values[0].begin(), group_values[0].begin() + k),
+                    lcw(group_values[1].begin(), group_values[1].begin() + k),
+                    lcw(group_values[2].begin(), group_values[2].begin() + k)};
+    test_single_agg(keys_col,
+                    values_col,
+                    expect_keys,
+                    expect_vals,
+                    cudf::make_top_k_aggregation<cudf::groupby_aggregation>(k));
+  }
+}
+
+TEST_F(groupby_top_k_misc_test, Strings)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 1, 2};
+  cudf::test::strings_column_wrapper values{{"b", "x", "d", "", "a"}, null_at(3)};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  cudf::test::lists_column_wrapper<cudf::string_view> expect_vals{{"d", "b"}, {"x", "a"}};
+
+  test_single_agg(keys,
+                  values,
+                  expect_keys,
+                  expect_vals,
+                  cudf::make_top_k_aggregation<cudf::groupby_aggregation>(3));
+}
+
+TEST_F(groupby_top_k_misc_test, NegativeK)
+{
+  EXPECT_THROW(cudf::make_top_k_aggregation<cudf::groupby_aggregation>(-1),
+               std::invalid_argument);
+}
@@ -22,6 +22,8 @@
 
 #include <cudf/hashing.hpp>
 
+#include <string>
+
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
 
 class MD5HashTest : public cudf::test::BaseFixture {};
@@ -89,6 +91,33 @@ TEST_F(MD5HashTest, MultiValue)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(md5_output1->view(), md5_output2->view());
 }
 
+TEST_F(MD5HashTest, MultiChunkStrings)
+{
+  // Messages spanning several chunks, including exact multiples of the chunk size
+  auto const alphabet = [](std::size_t begin, std::size_t end) {
+    std::string str;
+    for (auto i = begin; i < end; ++i) {
+      str.push_back(static_cast<char>('a' + i % 26));
+    }
+    return str;
+  };
+  cudf::test::strings_column_wrapper const strings_col(
+    {alphabet(0, 64), alphabet(0, 128), alphabet(0, 200)});
+  cudf::test::strings_column_wrapper const hashes(
+    {"a2eaf6295c32adc403865fd96a2f182b",
+     "3e8c1ccbd71838ef3df4b72e57fb9bf6",
+     "32cce8c4f2bf6f04dbb71b5cb9e37c30"});
+  auto const output = cudf::hashing::md5(cudf::table_view({strings_col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), hashes, verbosity);
+
+  // An element that ends part way into a chunk followed by one that spans chunks
+  cudf::test::strings_column_wrapper const first_col({alphabet(0, 30)});
+  cudf::test::strings_column_wrapper const second_col({alphabet(30, 130)});
+  cudf::test::strings_column_wrapper const split_hash({"a69d9a9991712224e6a899482474c56c"});
+  auto const split_output = cudf::hashing::md5(cudf::table_view({first_col, second_col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(split_output->view(), split_hash, verbosity);
+}
+
 TEST_F(MD5HashTest, EmptyNullEquivalence)
 {
   // Test that empty strings hash the same as nulls
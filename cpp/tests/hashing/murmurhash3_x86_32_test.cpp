@@ -21,6 +21,7 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/hashing.hpp>
 
@@ -120,6 +121,23 @@ TEST_F(MurmurHashTest, MultiValueNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
 }
 
+TEST_F(MurmurHashTest, FixedWidthNonNullable)
+{
+  // Non-nullable integer tables are hashed without type dispatch, with the same hash values
+  cudf::test::fixed_width_column_wrapper<int64_t> const col1({0, -1, 1, 42, 7});
+  cudf::test::fixed_width_column_wrapper<int64_t> const col2({5, 4, 3, 2, 1});
+  cudf::test::fixed_width_column_wrapper<int64_t> const nullable_col1({0, -1, 1, 42, 7},
+                                                                      {1, 1, 1, 1, 0});
+
+  auto const output = cudf::hashing::murmurhash3_x86_32(cudf::table_view({col1, col2}), 11);
+  auto const expected =
+    cudf::hashing::murmurhash3_x86_32(cudf::table_view({nullable_col1, col2}), 11);
+
+  // the rows without nulls hash the same through the generic path
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(output->view(), {0, 4})[0],
+                                 cudf::slice(expected->view(), {0, 4})[0]);
+}
+
 TEST_F(MurmurHashTest, BasicList)
 {
   using LCW = cudf::test::lists_column_wrapper<uint64_t>;
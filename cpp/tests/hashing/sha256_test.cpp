@@ -23,6 +23,8 @@
 #include <cudf/hashing.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <string>
+
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
 
 class SHA256HashTest : public cudf::test::BaseFixture {};
@@ -112,6 +114,35 @@ TEST_F(SHA256HashTest, MultiValue)
   EXPECT_EQ(input1.num_rows(), sha256_output1->size());
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha256_output1->view(), sha256_output2->view());
 }
+
+TEST_F(SHA256HashTest, MultiChunkStrings)
+{
+  // Messages spanning several chunks, including exact multiples of the chunk size
+  auto const alphabet = [](std::size_t begin, std::size_t end) {
+    std::string str;
+    for (auto i = begin; i < end; ++i) {
+      str.push_back(static_cast<char>('a' + i % 26));
+    }
+    return str;
+  };
+  cudf::test::strings_column_wrapper const strings_col(
+    {alphabet(0, 64), alphabet(0, 128), alphabet(0, 200)});
+  cudf::test::strings_column_wrapper const hashes(
+    {"2fcd5a0d60e4c941381fcc4e00a4bf8be422c3ddfafb93c809e8d1e2bfffae8e",
+     "6c05be2c4268843ae47e68e611277ce62c02153f2f4d2e1e2a1a4b44f766cf74",
+     "8013a82140d916576e2cf550b27449a368abec66cc154a7d9f599019d33aa3d2"});
+  auto const output = cudf::hashing::sha256(cudf::table_view({strings_col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), hashes, verbosity);
+
+  // An element that ends part way into a chunk followed by one that spans chunks
+  cudf::test::strings_column_wrapper const first_col({alphabet(0, 30)});
+  cudf::test::strings_column_wrapper const second_col({alphabet(30, 130)});
+  cudf::test::strings_column_wrapper const split_hash(
+    {"06f9b1a7ac97bc8e6a835c08986fe538f0478b03826efb4eed35dc517b433b8a"});
+  auto const split_output = cudf::hashing::sha256(cudf::table_view({first_col, second_col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(split_output->view(), split_hash, verbosity);
+}
+
 TEST_F(SHA256HashTest, EmptyNullEquivalence)
 {
   // Test that empty strings hash the same as nulls
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <string>
+#include <vector>
+
+struct ArrowDeviceTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+cudf::table make_test_table()
+{
+  auto ints    = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  auto strings = cudf::test::strings_column_wrapper({"a", "bc", "", "def", "g"}, {1, 1, 0, 1, 1});
+  auto lists   = cudf::test::lists_column_wrapper<int64_t>({{1, 2}, {}, {3}, {4, 5, 6}, {7}});
+  auto bools   = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 1, 1}, {1, 1, 1, 0, 1});
+  auto child   = cudf::test::fixed_width_column_wrapper<int16_t>({10, 20, 30, 40, 50});
+  auto structs = cudf::test::structs_column_wrapper({child}, {1, 1, 0, 1, 1});
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(ints.release());
+  columns.push_back(strings.release());
+  columns.push_back(lists.release());
+  columns.push_back(bools.release());
+  columns.push_back(structs.release());
+  return cudf::table(std::move(columns));
+}
+
+}  // namespace
+
+TEST_F(ArrowDeviceTest, RoundTrip)
+{
+  auto const table = make_test_table();
+
+  auto const schema = cudf::to_arrow_schema(table.view(), {});
+  auto const array  = cudf::to_arrow_device(table.view());
+  EXPECT_EQ(array->device_type, ARROW_DEVICE_CUDA);
+  EXPECT_NE(array->sync_event, nullptr);
+  EXPECT_EQ(array->array.n_children, table.num_columns());
+
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table.view(), *result);
+
+  // the data of the columns is shared, except for the converted booleans
+  EXPECT_EQ(result->column(0).head(), table.view().column(0).head());
+  EXPECT_EQ(result->column(1).head(), table.view().column(1).head());
+  EXPECT_NE(result->column(3).head(), table.view().column(3).head());
+}
+
+TEST_F(ArrowDeviceTest, SlicedRoundTrip)
+{
+  auto const table  = make_test_table();
+  auto const sliced = cudf::slice(table.view(), {1, 4}).front();
+
+  auto const schema = cudf::to_arrow_schema(sliced, {});
+  auto const array  = cudf::to_arrow_device(sliced);
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sliced, *result);
+}
+
+TEST_F(ArrowDeviceTest, OwningExport)
+{
+  auto table        = make_test_table();
+  auto const head   = table.view().column(0).head();
+  auto const schema = cudf::to_arrow_schema(table.view(), {});
+  auto array        = cudf::to_arrow_device(std::move(table));
+
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  EXPECT_EQ(result->column(0).head(), head);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(make_test_table().view(), *result);
+
+  array->array.release(&array->array);
+  EXPECT_EQ(array->array.release, nullptr);
+}
+
+TEST_F(ArrowDeviceTest, Schema)
+{
+  auto const table = make_test_table();
+  std::vector<cudf::column_metadata> metadata{{"ints"}, {"strings"}, {"lists"}, {"bools"}, {"s"}};
+  metadata[4].children_meta = {{"child"}};
+
+  auto const schema = cudf::to_arrow_schema(table.view(), metadata);
+  EXPECT_EQ(std::string{schema->format}, "+s");
+  ASSERT_EQ(schema->n_children, 5);
+  EXPECT_EQ(std::string{schema->children[0]->format}, "i");
+  EXPECT_EQ(std::string{schema->children[1]->format}, "u");
+  EXPECT_EQ(std::string{schema->children[2]->format}, "+l");
+  EXPECT_EQ(std::string{schema->children[2]->children[0]->format}, "l");
+  EXPECT_EQ(std::string{schema->children[3]->format}, "b");
+  EXPECT_EQ(std::string{schema->children[4]->format}, "+s");
+  EXPECT_EQ(std::string{schema->children[0]->name}, "ints");
+  EXPECT_EQ(std::string{schema->children[4]->children[0]->name}, "child");
+}
+
+TEST_F(ArrowDeviceTest, Decimals)
+{
+  auto col =
+    cudf::test::fixed_point_column_wrapper<int32_t>({100, 200, 300}, numeric::scale_type{-2});
+  auto const input = cudf::table_view({col});
+
+  auto const schema = cudf::to_arrow_schema(input, {});
+  EXPECT_EQ(std::string{schema->children[0]->format}, "d:9,2");
+
+  auto const array  = cudf::to_arrow_device(input);
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  EXPECT_EQ(result->column(0).type(),
+            cudf::data_type(cudf::type_id::DECIMAL128, numeric::scale_type{-2}));
+  auto expected =
+    cudf::test::fixed_point_column_wrapper<__int128_t>({100, 200, 300}, numeric::scale_type{-2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->column(0));
+}
+
+TEST_F(ArrowDeviceTest, Unsupported)
+{
+  auto col         = cudf::test::fixed_width_column_wrapper<cudf::duration_D, int32_t>({1, 2});
+  auto const input = cudf::table_view({col});
+  EXPECT_THROW(cudf::to_arrow_schema(input, {}), cudf::logic_error);
+  EXPECT_THROW(cudf::to_arrow_device(input), cudf::logic_error);
+}
@@ -423,6 +423,37 @@ TYPED_TEST(DLPackNumericTests, ToDlpack2D)
   }
 }
 
+TYPED_TEST(DLPackNumericTests, ToDlpackRowMajor2D)
+{
+  using T         = TypeParam;
+  auto const col1 = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  auto const col2 = cudf::test::make_type_param_vector<T>({4, 5, 6, 7});
+  auto const col3 = cudf::test::make_type_param_vector<T>({7, 8, 9, 10});
+  cudf::test::fixed_width_column_wrapper<T> const c1(col1.cbegin(), col1.cend());
+  cudf::test::fixed_width_column_wrapper<T> const c2(col2.cbegin(), col2.cend());
+  cudf::test::fixed_width_column_wrapper<T> const c3(col3.cbegin(), col3.cend());
+
+  cudf::table_view input({c1, c2, c3});
+  unique_managed_tensor result(cudf::to_dlpack_row_major(input));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(3, tensor.shape[1]);
+  EXPECT_EQ(3, tensor.strides[0]);
+  EXPECT_EQ(1, tensor.strides[1]);
+
+  // The rows of the input are contiguous
+  auto const expected_tmp =
+    cudf::test::make_type_param_vector<T>({1, 4, 7, 2, 5, 8, 3, 6, 9, 4, 7, 10});
+  cudf::test::fixed_width_column_wrapper<T> const expected(expected_tmp.cbegin(),
+                                                           expected_tmp.cend());
+  constexpr cudf::data_type type{cudf::type_to_id<TypeParam>()};
+  cudf::column_view const result_view(type, 12, tensor.data, nullptr, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result_view);
+}
+
 TYPED_TEST(DLPackNumericTests, FromDlpack1D)
 {
   // Use to_dlpack to generate an input tensor
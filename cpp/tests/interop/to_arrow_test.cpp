@@ -178,6 +178,36 @@ TEST_F(ToArrowTest, EmptyTable)
   ASSERT_EQ(expected_arrow_table->Equals(*got_arrow_table, true), true);
 }
 
+TEST_F(ToArrowTest, AsyncTable)
+{
+  auto tables = get_tables(10000);
+
+  auto cudf_table_view      = tables.first->view();
+  auto expected_arrow_table = tables.second;
+  auto struct_meta          = cudf::column_metadata{"f"};
+  struct_meta.children_meta = {{"integral"}, {"string"}};
+
+  auto got_arrow_table =
+    cudf::to_arrow_async(cudf_table_view, {{"a"}, {"b"}, {"c"}, {"d"}, {"e"}, struct_meta});
+
+  ASSERT_EQ(expected_arrow_table->Equals(*got_arrow_table.get(), true), true);
+}
+
+TEST_F(ToArrowTest, AsyncSlicedTable)
+{
+  auto tables = get_tables(100);
+
+  auto const sliced         = cudf::slice(tables.first->view(), {3, 70}).front();
+  auto struct_meta          = cudf::column_metadata{"f"};
+  struct_meta.children_meta = {{"integral"}, {"string"}};
+  std::vector<cudf::column_metadata> metadata{{"a"}, {"b"}, {"c"}, {"d"}, {"e"}, struct_meta};
+
+  auto expected_arrow_table = cudf::to_arrow(sliced, metadata);
+  auto got_arrow_table      = cudf::to_arrow_async(sliced, metadata);
+
+  ASSERT_EQ(expected_arrow_table->Equals(*got_arrow_table.get(), true), true);
+}
+
 TEST_F(ToArrowTest, DateTimeTable)
 {
   auto data = {1, 2, 3, 4, 5, 6};
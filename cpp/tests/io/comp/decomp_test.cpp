@@ -14,12 +14,14 @@
  * limitations under the License.
  */
 
+#include "io/comp/batch_scheduler.hpp"
 #include "io/comp/gpuinflate.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/testing_main.hpp>
 
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/device_buffer.hpp>
@@ -27,6 +29,9 @@
 
 #include <src/io/comp/nvcomp_adapter.hpp>
 
+#include <iterator>
+#include <numeric>
+#include <string>
 #include <vector>
 
 using cudf::device_span;
@@ -121,8 +126,34 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for LZ4 decompression
+ */
+struct Lz4DecompressTest : public DecompressTest<Lz4DecompressTest> {
+  void dispatch(device_span<device_span<uint8_t const>> d_inf_in,
+                device_span<device_span<uint8_t>> d_inf_out,
+                device_span<cudf::io::compression_result> d_inf_stat)
+  {
+    cudf::io::gpu_unlz4(d_inf_in, d_inf_out, d_inf_stat, cudf::get_default_stream());
+  }
+};
+
+/**
+ * @brief Derived fixture for ZSTD decompression
+ */
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  void dispatch(device_span<device_span<uint8_t const>> d_inf_in,
+                device_span<device_span<uint8_t>> d_inf_out,
+                device_span<cudf::io::compression_result> d_inf_stat)
+  {
+    cudf::io::gpu_unzstd(d_inf_in, d_inf_out, d_inf_stat, cudf::get_default_stream());
+  }
+};
+
 struct NvcompConfigTest : public cudf::test::BaseFixture {};
 
+struct BatchSchedulerTest : public cudf::test::BaseFixture {};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -171,6 +202,289 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(Lz4DecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0xb0, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4DecompressTest, OverlappingMatch)
+{
+  constexpr char uncompressed[] = "hellohellohello!";
+  // Match of 10 bytes at offset 5, followed by the last literal
+  constexpr uint8_t compressed[] = {0x56, 'h', 'e', 'l', 'l', 'o', 0x5, 0x0, 0x10, '!'};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x0,  0x58, 0x59, 0x0,  0x0,  0x68,
+                                    0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, CompressedBlock)
+{
+  constexpr char uncompressed[] =
+    "Aaaa, hello world! hello world! hello world! Aaaaaaaaaaaaaaaaaah!";
+  // Raw literals and sequences with the predefined tables, including repeated offsets
+  constexpr uint8_t compressed[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x41, 0xf5, 0x0,  0x0,  0xb0, 0x41, 0x61, 0x61, 0x61,
+    0x2c, 0x20, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21,
+    0x41, 0x61, 0x68, 0x21, 0x2,  0x0,  0x2e, 0x82, 0x41, 0x38, 0xc3};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+namespace {
+
+// Pseudo-random lines of common words, so that the text has both literals and matches
+std::vector<uint8_t> make_word_text(size_t size)
+{
+  std::vector<std::string> const words{
+    "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "column", "table", "parquet",
+    "reader", "writer", "stream", "device", "memory", "kernel", "warp", "block", "literal",
+    "sequence", "offset", "match", "length", "huffman", "entropy", "frame", "window", "decoder",
+    "buffer", "chunk", "string", "integer", "decimal", "timestamp", "dictionary", "statistics",
+    "filter", "predicate", "page", "schema", "nested", "struct", "list", "null", "mask", "bitmap",
+    "scan"};
+  std::vector<uint8_t> text;
+  uint32_t state = 1;
+  for (int num_words = 1; text.size() < size; ++num_words) {
+    state            = state * 1103515245u + 12345u;
+    auto const& word = words[(state >> 16) % words.size()];
+    text.insert(text.end(), word.begin(), word.end());
+    text.push_back(num_words % 12 == 0 ? '\n' : ' ');
+  }
+  text.resize(size);
+  return text;
+}
+
+// "hello, world! 0" to "hello, world! W", each but the first a literal and a repeated match
+std::vector<uint8_t> make_hello_text()
+{
+  std::vector<uint8_t> text;
+  for (int i = 0; i < 40; ++i) {
+    constexpr char line[] = "hello, world! ";
+    text.insert(text.end(), line, line + sizeof(line) - 1);
+    text.push_back('0' + i);
+  }
+  return text;
+}
+
+// 128KiB of "0123456789abcdef" followed by 200KiB of 'x'
+std::vector<uint8_t> make_run_text()
+{
+  std::vector<uint8_t> text;
+  for (int i = 0; i < 8192; ++i) {
+    constexpr char digits[] = "0123456789abcdef";
+    text.insert(text.end(), digits, digits + sizeof(digits) - 1);
+  }
+  text.insert(text.end(), 200 * 1024, 'x');
+  return text;
+}
+
+// The frames below are the output of `zstd -19` (v1.5.6) and carry a content checksum
+
+// `make_word_text(2048)`: Huffman-coded literals in 4 streams with FSE-compressed weights, and
+// FSE-compressed literal length, offset and match length tables, with repeated offsets
+constexpr uint8_t zstd_text_frame[] = {
+  0x28, 0xb5, 0x2f, 0xfd, 0x64, 0x0,  0x7,  0xfd, 0x13, 0x0,  0x96, 0x12, 0x31, 0x15, 0x90, 0xb9,
+  0xd,  0xc0, 0x7f, 0x2f, 0xd7, 0xb0, 0x85, 0xb5, 0xdf, 0xa2, 0xcf, 0x52, 0xdc, 0xdd, 0xdd, 0xd9,
+  0xac, 0xae, 0x75, 0x2a, 0x0,  0x2b, 0x0,  0x2b, 0x0,  0xc8, 0x6d, 0x1a, 0x86, 0x2a, 0xcf, 0xcd,
+  0x50, 0x59, 0x32, 0xe1, 0xcd, 0xbe, 0x19, 0x67, 0xc8, 0x3f, 0x79, 0xc6, 0x45, 0x16, 0x3,  0xd8,
+  0x4c, 0x13, 0xb2, 0xce, 0x2a, 0x82, 0x29, 0x95, 0x9a, 0x1f, 0x24, 0xb6, 0x21, 0x83, 0xef, 0x34,
+  0x7a, 0xce, 0x45, 0xb,  0xb,  0x95, 0xcd, 0xae, 0xb4, 0x2f, 0x65, 0xe2, 0x9f, 0x95, 0xea, 0xc8,
+  0x30, 0x6c, 0x2e, 0x16, 0xf7, 0xfe, 0x2e, 0x64, 0x41, 0x98, 0x95, 0x0,  0x44, 0xa6, 0x53, 0xe1,
+  0x8d, 0x1e, 0x17, 0xd6, 0xc1, 0x82, 0x13, 0xc1, 0x94, 0xda, 0x22, 0xbf, 0x95, 0x3,  0xcd, 0x8c,
+  0x36, 0xd3, 0xe6, 0x3,  0xb8, 0xaa, 0xa5, 0x65, 0x30, 0x59, 0x1,  0x16, 0xa9, 0x5a, 0x1,  0x14,
+  0x56, 0xb9, 0xd9, 0x9d, 0x37, 0xfb, 0x5e, 0x25, 0x7,  0x4f, 0x40, 0x36, 0xff, 0x58, 0xa,  0x2f,
+  0x75, 0xb5, 0xa9, 0x82, 0xa0, 0xa1, 0x3e, 0xb,  0x82, 0xec, 0x2e, 0xdc, 0x1d, 0xea, 0x36, 0x8d,
+  0xfb, 0xe,  0xb5, 0xb0, 0x4f, 0x98, 0xbe, 0x7c, 0xe2, 0x58, 0xa1, 0xda, 0x70, 0xa,  0xe7, 0x2e,
+  0x6d, 0xc2, 0x68, 0x33, 0x58, 0xaa, 0xe3, 0x77, 0xd2, 0x0,  0xf9, 0xc2, 0x7b, 0xf5, 0xa8, 0xef,
+  0x28, 0x80, 0xf0, 0xa8, 0x1,  0x93, 0x88, 0x8c, 0xa4, 0xa8, 0xa0, 0x90, 0x69, 0xe,  0x10, 0x10,
+  0x1,  0x31, 0xc6, 0xc1, 0xf4, 0x31, 0x8,  0xca, 0xf1, 0x8a, 0x26, 0x4d, 0x61, 0x38, 0x41, 0x20,
+  0x9f, 0x66, 0x45, 0x69, 0xc6, 0xda, 0x32, 0x6c, 0x85, 0x3d, 0xa9, 0xfb, 0x5d, 0x9e, 0xc2, 0x8b,
+  0x27, 0xc4, 0x4c, 0x1f, 0x36, 0x59, 0x1f, 0x9c, 0x2b, 0x8d, 0x77, 0xe,  0x28, 0x63, 0x5d, 0x46,
+  0xa1, 0x3,  0x26, 0x91, 0x24, 0x1,  0xc6, 0xd4, 0x97, 0xc6, 0x5,  0xf4, 0x9e, 0xa,  0xc5, 0x50,
+  0x17, 0xb8, 0xa3, 0x39, 0xdd, 0x23, 0xa9, 0x8b, 0xb3, 0x25, 0xc4, 0xbe, 0x33, 0xae, 0x1a, 0xd4,
+  0x64, 0xb,  0x18, 0xad, 0x9b, 0xfc, 0x48, 0x43, 0xc2, 0xb4, 0xe,  0x6d, 0xf1, 0x6,  0x0,  0xeb,
+  0xc0, 0x1,  0xab, 0x14, 0xdf, 0x16, 0x92, 0x9a, 0x91, 0x46, 0xff, 0x10, 0xfc, 0x4d, 0xb3, 0x8a,
+  0x71, 0xda, 0xbd, 0xa2, 0x48, 0x9b, 0x1a, 0x65, 0x3c, 0x9f, 0x6c, 0x45, 0x26, 0x61, 0x74, 0x57,
+  0x52, 0xb1, 0x65, 0x4d, 0x64, 0x61, 0x9b, 0xb0, 0x91, 0x75, 0x3b, 0x7c, 0x20, 0xc0, 0xaa, 0xbd,
+  0x71, 0x70, 0x21, 0xdd, 0xba, 0xa6, 0x1f, 0x32, 0xc4, 0x14, 0x61, 0xea, 0x6b, 0xf6, 0x4a, 0xdb,
+  0x3f, 0x48, 0xe7, 0x4e, 0xdf, 0xfd, 0xa6, 0xbc, 0xe9, 0x3f, 0x8,  0xc6, 0x75, 0x79, 0xe5, 0xd5,
+  0x83, 0x5,  0x42, 0xb6, 0xeb, 0x40, 0xe8, 0xfc, 0xbb, 0xd2, 0x51, 0x29, 0x68, 0x45, 0x8e, 0x8e,
+  0x9f, 0x99, 0xdf, 0xf9, 0xd2, 0x40, 0xbe, 0xfb, 0xc4, 0x11, 0xae, 0x76, 0x1c, 0x6d, 0x42, 0x7,
+  0xaa, 0x5b, 0xb4, 0x8d, 0x99, 0xb2, 0x94, 0x51, 0xbf, 0x6b, 0xbd, 0xa7, 0x9a, 0x8f, 0x6f, 0x3a,
+  0x75, 0xcd, 0x3c, 0x1,  0xd7, 0x1d, 0xce, 0x12, 0xe4, 0xc4, 0x7b, 0xac, 0x57, 0x11, 0x89, 0xc1,
+  0x34, 0x3a, 0xe2, 0x84, 0xaa, 0xaf, 0xa4, 0x22, 0x5f, 0xd0, 0x9e, 0xa8, 0x49, 0x2,  0x2b, 0x2c,
+  0x1,  0xef, 0x85, 0x14, 0x4f, 0x26, 0x1a, 0xd,  0x94, 0x10, 0x33, 0x1d, 0xfa, 0xab, 0x82, 0x33,
+  0x87, 0x20, 0x2d, 0x67, 0xf2, 0xca, 0x12, 0x42, 0x22, 0x2a, 0x66, 0x56, 0x2d, 0x2,  0x1b, 0x6,
+  0xb9, 0xc1, 0x75, 0x37, 0x7b, 0xcc, 0x86, 0x43, 0x23, 0x6e, 0xab, 0x3b, 0x59, 0x1,  0xb2, 0x4f,
+  0x9d, 0x9a, 0xbd, 0x61, 0xf5, 0x0,  0x99, 0x61, 0xaf, 0x82, 0x1,  0xb4, 0xc8, 0xa8, 0xd4, 0x59,
+  0x94, 0xbb, 0x81, 0xfd, 0xf6, 0x55, 0xd0, 0x1,  0x9,  0x94, 0x29, 0x8d, 0x6,  0x9b, 0xc,  0x9d,
+  0x0,  0x91, 0xa7, 0x49, 0xc6, 0x30, 0xd4, 0x55, 0x85, 0x78, 0x6e, 0x96, 0xf0, 0x3,  0x28, 0x3f,
+  0x76, 0x64, 0x50, 0x68, 0x90, 0xd9, 0x66, 0xe1, 0x2b, 0x28, 0xeb, 0x2d, 0x9d, 0x53, 0xd0, 0x9d,
+  0x2c, 0xc8, 0x32, 0xf2, 0xc2, 0x10, 0xd9, 0xbc, 0xf,  0xc2, 0x15, 0xa9, 0x4c, 0x86, 0x9e, 0x60,
+  0x8e, 0x8,  0xaa, 0x9a, 0x65, 0x14, 0xa3, 0x1,  0xc5, 0xdb, 0x35, 0x87, 0x5d, 0x8,  0xb6, 0x82,
+  0x3f, 0xcf, 0xd2, 0x8e, 0xad, 0xc0, 0xe,  0xc5, 0x7b, 0x5a, 0x50, 0xc,  0x87, 0x33, 0x60, 0xe6,
+  0x2a, 0xe6, 0x13, 0x80, 0x57, 0x2a, 0x5,  0x5d, 0x35, 0x46, 0xfe, 0xec, 0x43};
+
+// `make_hello_text()`: all match lengths share a code, so their table is RLE-coded
+constexpr uint8_t zstd_rle_sequence_table_frame[] = {
+  0x28, 0xb5, 0x2f, 0xfd, 0x64, 0x58, 0x1,  0x2d, 0x2,  0x0,  0x64, 0x3,  0x68, 0x65, 0x6c, 0x6c,
+  0x6f, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21, 0x20, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+  0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+  0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+  0x56, 0x57, 0x27, 0xa4, 0x10, 0xf0, 0xfb, 0x67, 0xe0, 0xe7, 0xb,  0x68, 0x2d, 0x29, 0x5,  0x5a,
+  0xbc, 0x4f, 0x52};
+
+// `make_run_text()`: a compressed block followed by two RLE blocks
+constexpr uint8_t zstd_rle_block_frame[] = {
+  0x28, 0xb5, 0x2f, 0xfd, 0xa4, 0x0,  0x20, 0x5,  0x0,  0xc4, 0x0,  0x0,  0x80, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x1,  0x0,  0xda,
+  0xff, 0x27, 0x9f, 0x4b, 0x2,  0x0,  0x10, 0x78, 0x3,  0x0,  0x9,  0x78, 0x75, 0x56, 0x3,  0x72};
+
+}  // namespace
+
+TEST_F(ZstdDecompressTest, HuffmanLiterals)
+{
+  auto const expected = make_word_text(2048);
+  std::vector<uint8_t> output(expected.size());
+  Decompress(&output, zstd_text_frame, sizeof(zstd_text_frame));
+  EXPECT_EQ(output, expected);
+}
+
+TEST_F(ZstdDecompressTest, RleSequenceTable)
+{
+  auto const expected = make_hello_text();
+  std::vector<uint8_t> output(expected.size());
+  Decompress(&output, zstd_rle_sequence_table_frame, sizeof(zstd_rle_sequence_table_frame));
+  EXPECT_EQ(output, expected);
+}
+
+TEST_F(ZstdDecompressTest, RleBlocks)
+{
+  auto const expected = make_run_text();
+  std::vector<uint8_t> output(expected.size());
+  Decompress(&output, zstd_rle_block_frame, sizeof(zstd_rle_block_frame));
+  EXPECT_EQ(output, expected);
+}
+
+TEST_F(ZstdDecompressTest, MultipleFrames)
+{
+  // Two frames with a skippable frame of 4 bytes in between
+  constexpr uint8_t skippable_frame[] = {
+    0x53, 0x2a, 0x4d, 0x18, 0x4, 0x0, 0x0, 0x0, 0xde, 0xad, 0xbe, 0xef};
+  std::vector<uint8_t> compressed(std::cbegin(zstd_rle_sequence_table_frame),
+                                  std::cend(zstd_rle_sequence_table_frame));
+  compressed.insert(compressed.end(), std::cbegin(skippable_frame), std::cend(skippable_frame));
+  compressed.insert(
+    compressed.end(), std::cbegin(zstd_rle_block_frame), std::cend(zstd_rle_block_frame));
+
+  auto expected       = make_hello_text();
+  auto const run_text = make_run_text();
+  expected.insert(expected.end(), run_text.begin(), run_text.end());
+  std::vector<uint8_t> output(expected.size());
+  Decompress(&output, compressed.data(), compressed.size());
+  EXPECT_EQ(output, expected);
+}
+
+TEST_F(BatchSchedulerTest, MixedSizes)
+{
+  auto const stream = cudf::get_default_stream();
+  auto const mr     = rmm::mr::get_current_device_resource();
+
+  // Sizes in all buckets, in no particular order
+  std::vector<size_t> const sizes{100, 3 << 20, 70000, 0, 1 << 20, 5000, 65536, 2 << 20};
+  auto const total_size = std::accumulate(sizes.begin(), sizes.end(), size_t{0});
+  std::vector<uint8_t> h_data(total_size);
+  for (size_t i = 0; i < h_data.size(); ++i) {
+    h_data[i] = static_cast<uint8_t>((i * 7) % 251);
+  }
+  auto const d_data = cudf::detail::make_device_uvector_sync(h_data, stream, mr);
+  rmm::device_uvector<uint8_t> d_copy(total_size, stream);
+
+  std::vector<device_span<uint8_t const>> inputs;
+  std::vector<device_span<uint8_t>> outputs;
+  size_t offset = 0;
+  for (auto const size : sizes) {
+    inputs.emplace_back(d_data.data() + offset, size);
+    outputs.emplace_back(d_copy.data() + offset, size);
+    offset += size;
+  }
+  rmm::device_uvector<cudf::io::compression_result> results(sizes.size(), stream);
+
+  // Copy each chunk and record its size, to check the order of the results
+  cudf::io::detail::schedule_batches(
+    inputs,
+    outputs,
+    results,
+    [](auto in, auto out, auto res, cudf::io::detail::batch_output_sizes, auto strm) {
+      cudf::io::gpu_copy_uncompressed_blocks(in, out, strm);
+      auto const h_in = cudf::detail::make_std_vector_sync(in, strm);
+      std::vector<cudf::io::compression_result> h_res;
+      for (auto const& span : h_in) {
+        h_res.push_back({span.size(), cudf::io::compression_status::SUCCESS, 0});
+      }
+      CUDF_CUDA_TRY(cudaMemcpyAsync(res.data(),
+                                    h_res.data(),
+                                    h_res.size() * sizeof(cudf::io::compression_result),
+                                    cudaMemcpyDefault,
+                                    strm.value()));
+      strm.synchronize();
+    },
+    stream);
+
+  auto const h_results = cudf::detail::make_std_vector_sync(results, stream);
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    EXPECT_EQ(h_results[i].bytes_written, sizes[i]);
+    EXPECT_EQ(h_results[i].status, cudf::io::compression_status::SUCCESS);
+  }
+  EXPECT_EQ(cudf::detail::make_std_vector_sync(d_copy, stream), h_data);
+}
+
+TEST_F(BatchSchedulerTest, SplitCopies)
+{
+  auto const stream = cudf::get_default_stream();
+  auto const mr     = rmm::mr::get_current_device_resource();
+
+  std::vector<uint8_t> h_data((1 << 20) + 12345);
+  for (size_t i = 0; i < h_data.size(); ++i) {
+    h_data[i] = static_cast<uint8_t>((i * 13) % 253);
+  }
+  auto const d_data = cudf::detail::make_device_uvector_sync(h_data, stream, mr);
+  // Unaligned output, to copy segments with different alignments
+  rmm::device_uvector<uint8_t> d_copy(h_data.size() + 1, stream);
+
+  std::vector<device_span<uint8_t const>> inputs{{d_data.data(), d_data.size()}};
+  std::vector<device_span<uint8_t>> outputs{{d_copy.data() + 1, d_data.size()}};
+  cudf::io::detail::copy_uncompressed_blocks(inputs, outputs, stream);
+
+  auto h_copy = cudf::detail::make_std_vector_sync(d_copy, stream);
+  h_copy.erase(h_copy.begin());
+  EXPECT_EQ(h_copy, h_data);
+}
+
 TEST_F(NvcompConfigTest, Compression)
 {
   using cudf::io::nvcomp::compression_type;
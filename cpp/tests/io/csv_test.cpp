@@ -42,6 +42,7 @@
 #include <arrow/io/api.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -484,6 +485,38 @@ TEST_F(CsvWriterTest, QuotingDisabled)
   test_quoting_disabled_with_delimiter('\u0001');
 }
 
+TEST_F(CsvWriterTest, MixedTypesRows)
+{
+  auto const ints =
+    cudf::test::fixed_width_column_wrapper<int32_t>{{1, -20, 0}, {true, true, false}};
+  auto const bools   = cudf::test::fixed_width_column_wrapper<bool>{true, false, true};
+  auto const strings = cudf::test::strings_column_wrapper{"a,b", "say \"hi\"", "plain"};
+  auto const timestamps =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>{
+      0, -1, 1500};
+  auto const decimals = cudf::test::fixed_point_column_wrapper<int32_t>{{12345, -5, 100},
+                                                                       numeric::scale_type{-2}};
+  auto const floats =
+    cudf::test::fixed_width_column_wrapper<double>{{1.5, 0., -2.25}, {true, false, true}};
+  auto const input_table = table_view{{ints, bools, strings, timestamps, decimals, floats}};
+
+  auto const filepath = temp_env->get_temp_dir() + "MixedTypesRows.csv";
+  auto w_options = cudf::io::csv_writer_options::builder(cudf::io::sink_info{filepath}, input_table)
+                     .include_header(false);
+  cudf::io::write_csv(w_options.build());
+
+  std::ifstream result_file(filepath);
+  ASSERT_TRUE(result_file.is_open());
+  std::string const result{std::istreambuf_iterator<char>(result_file),
+                           std::istreambuf_iterator<char>()};
+
+  std::string const expected =
+    "1,true,\"a,b\",1970-01-01T00:00:00.000Z,123.45,1.5\n"
+    "-20,false,\"say \"\"hi\"\"\",1969-12-31T23:59:59.999Z,-0.05,\n"
+    ",true,plain,1970-01-01T00:00:01.500Z,1.00,-2.25\n";
+  EXPECT_EQ(result, expected);
+}
+
 TEST_F(CsvReaderTest, MultiColumn)
 {
   constexpr auto num_rows = 10;
@@ -928,6 +961,42 @@ TEST_F(CsvReaderTest, FloatingPoint)
   ASSERT_EQ((1u << ref_vals.size()) - 1, bitmask[0]);
 }
 
+TEST_F(CsvReaderTest, FloatingPointCorrectlyRounded)
+{
+  std::vector<std::string> const values{"0.1",
+                                        "9007199254740993",
+                                        "1'234.5e-3",
+                                        "2.2250738585072011e-308",
+                                        "4.9406564584124654e-324",
+                                        "1.7976931348623157e308",
+                                        "3.14159265358979323846264338327950288"};
+  auto filepath = temp_env->get_temp_dir() + "FloatingPointCorrectlyRounded.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    for (auto const& value : values) {
+      outfile << value << ';';
+    }
+  }
+
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{filepath})
+      .names({"A"})
+      .dtypes({dtype<double>()})
+      .lineterminator(';')
+      .thousands('\'')
+      .header(-1);
+  auto result = cudf::io::read_csv(in_opts);
+
+  std::vector<double> ref_vals;
+  for (auto value : values) {
+    value.erase(std::remove(value.begin(), value.end(), '\''), value.end());
+    ref_vals.push_back(std::strtod(value.c_str(), nullptr));
+  }
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    result.tbl->view().column(0),
+    cudf::test::fixed_width_column_wrapper<double>(ref_vals.begin(), ref_vals.end()));
+}
+
 TEST_F(CsvReaderTest, Strings)
 {
   std::vector<std::string> names{"line", "verse"};
@@ -1107,6 +1176,28 @@ TEST_F(CsvReaderTest, BlanksAndComments)
   expect_column_data_equal(std::vector<int32_t>{1, 3, 4, 5, 8, 9}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, QuotedTerminatorsAndComments)
+{
+  // Terminators and comment characters within quotes, and quotes within comments, do not split
+  // rows
+  std::string const input = "1,\"a\n#b\"\n#comment \"x\n2,\"c\"\"\nd\"\n3,e\n";
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{input.c_str(), input.size()})
+      .names({"A", "B"})
+      .dtypes(std::vector<data_type>{dtype<int32_t>(), dtype<cudf::string_view>()})
+      .header(-1)
+      .comment('#');
+  auto result = cudf::io::read_csv(in_opts);
+
+  auto const view = result.tbl->view();
+  EXPECT_EQ(2, view.num_columns());
+  ASSERT_EQ(type_id::INT32, view.column(0).type().id());
+  ASSERT_EQ(type_id::STRING, view.column(1).type().id());
+
+  expect_column_data_equal(std::vector<int32_t>{1, 2, 3}, view.column(0));
+  expect_column_data_equal(std::vector<std::string>{"a\n#b", "c\"\nd", "e"}, view.column(1));
+}
+
 TEST_F(CsvReaderTest, EmptyFile)
 {
   auto filepath = temp_env->get_temp_dir() + "EmptyFile.csv";
@@ -1266,6 +1357,33 @@ TEST_F(CsvReaderTest, TypeInferenceWithDecimal)
   expect_column_data_equal(dbl_col, result_view.column(2));
 }
 
+TEST_F(CsvReaderTest, TypeInferenceSampleRows)
+{
+  // Only rows 0, 12, 24, ... are sampled; the float in row 50 is found when decoding
+  constexpr int num_rows = 100;
+  std::string buffer;
+  std::vector<int64_t> int_col;
+  std::vector<double> dbl_col;
+  for (int row = 0; row < num_rows; ++row) {
+    auto const value = row == 50 ? std::string{"1.5"} : std::to_string(row);
+    buffer += std::to_string(row) + "," + value + "\n";
+    int_col.push_back(row);
+    dbl_col.push_back(row == 50 ? 1.5 : row);
+  }
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .header(-1)
+      .type_inference_sample_rows(8);
+  auto const result      = cudf::io::read_csv(in_opts);
+  auto const result_view = result.tbl->view();
+
+  EXPECT_EQ(result_view.num_columns(), 2);
+  EXPECT_EQ(result_view.column(0).type().id(), type_id::INT64);
+  EXPECT_EQ(result_view.column(1).type().id(), type_id::FLOAT64);
+  expect_column_data_equal(int_col, result_view.column(0));
+  expect_column_data_equal(dbl_col, result_view.column(1));
+}
+
 TEST_F(CsvReaderTest, SkipRowsXorSkipFooter)
 {
   std::string buffer = "1,2,3";
@@ -18,9 +18,27 @@
 #include <cudf_test/cudf_gtest.hpp>
 #include <cudf_test/testing_main.hpp>
 
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
 #include <src/io/utilities/file_io_utilities.hpp>
+#include <src/io/utilities/remote_datasource.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
 
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <numeric>
 #include <type_traits>
+#include <vector>
+
+cudf::test::TempDirTestEnvironment* const temp_env =
+  static_cast<cudf::test::TempDirTestEnvironment*>(
+    ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
 
 // Base test fixture for tests
 struct CuFileIOTest : public cudf::test::BaseFixture {};
@@ -43,4 +61,157 @@ TEST_F(CuFileIOTest, SliceSize)
   }
 }
 
+// Host buffer source that counts the reads it serves
+class counting_source : public cudf::io::datasource {
+ public:
+  explicit counting_source(std::vector<uint8_t> const& data) : _data{data} {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    ++num_reads;
+    auto const count = std::min(size, this->size() - offset);
+    return std::make_unique<non_owning_buffer>(_data.data() + offset, count);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++num_reads;
+    auto const count = std::min(size, this->size() - offset);
+    std::copy(_data.begin() + offset, _data.begin() + offset + count, dst);
+    return count;
+  }
+
+  [[nodiscard]] size_t size() const override { return _data.size(); }
+
+  std::atomic<int> num_reads{0};
+
+ private:
+  std::vector<uint8_t> const& _data;
+};
+
+TEST_F(CuFileIOTest, PrefetchingSourceCoalescesReads)
+{
+  std::vector<uint8_t> data(1 << 16);
+  std::iota(data.begin(), data.end(), 0);
+
+  auto counting     = std::make_unique<counting_source>(data);
+  auto& num_reads   = counting->num_reads;
+  auto const source = cudf::io::datasource::create_prefetching(std::move(counting), 64, 1 << 20, 2);
+
+  // The first two ranges are 50 bytes apart and get merged into a single read
+  std::vector<std::pair<size_t, size_t>> const ranges{{0, 100}, {150, 100}, {1000, 50}};
+  source->prefetch(ranges);
+
+  for (auto const& [offset, size] : ranges) {
+    auto const buffer = source->host_read(offset, size);
+    ASSERT_EQ(buffer->size(), size);
+    EXPECT_TRUE(std::equal(buffer->data(), buffer->data() + size, data.begin() + offset));
+  }
+  EXPECT_EQ(num_reads.load(), 2);
+
+  // Ranges that were not prefetched are read from the wrapped source
+  std::vector<uint8_t> out(10);
+  EXPECT_EQ(source->host_read(5000, out.size(), out.data()), out.size());
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin() + 5000));
+  EXPECT_EQ(num_reads.load(), 3);
+}
+
+TEST_F(CuFileIOTest, PrefetchingSourceReleasesGappedBlocks)
+{
+  std::vector<uint8_t> data(1 << 16);
+  std::iota(data.begin(), data.end(), 0);
+
+  auto counting   = std::make_unique<counting_source>(data);
+  auto& num_reads = counting->num_reads;
+  // The window only fits one coalesced block at a time
+  auto const source = cudf::io::datasource::create_prefetching(std::move(counting), 64, 256, 1);
+
+  // Each pair of ranges is merged into a 250-byte block across a 50-byte gap
+  std::vector<std::pair<size_t, size_t>> const ranges{
+    {0, 100}, {150, 100}, {1000, 100}, {1150, 100}, {2000, 100}, {2150, 100}};
+  source->prefetch(ranges);
+
+  auto const expect_read = [&](size_t offset, size_t size) {
+    auto const buffer = source->host_read(offset, size);
+    ASSERT_EQ(buffer->size(), size);
+    EXPECT_TRUE(std::equal(buffer->data(), buffer->data() + size, data.begin() + offset));
+  };
+
+  // Reading a range twice does not count it twice; the block is kept for the other range
+  expect_read(0, 100);
+  expect_read(0, 100);
+  expect_read(150, 100);
+  // The gap bytes are never read, yet the block is released and the next one is submitted
+  expect_read(1000, 100);
+  expect_read(1150, 100);
+  expect_read(2000, 100);
+  expect_read(2150, 100);
+  EXPECT_EQ(num_reads.load(), 3);
+}
+
+TEST_F(CuFileIOTest, TaskPriority)
+{
+  using cudf::detail::task_priority;
+  cudf::detail::thread_pool pool(1);
+  pool.paused = true;
+
+  std::vector<int> order;
+  auto low  = pool.submit_with_priority(task_priority::LOW, [&] { order.push_back(0); });
+  auto high = pool.submit_with_priority(task_priority::HIGH, [&] { order.push_back(1); });
+  EXPECT_EQ(pool.get_tasks_queued(), 2);
+  pool.paused = false;
+  low.wait();
+  high.wait();
+  EXPECT_EQ(order, (std::vector<int>{1, 0}));
+
+  EXPECT_EQ(cudf::io::detail::current_io_priority(), task_priority::HIGH);
+  {
+    cudf::io::detail::scoped_io_priority const priority{task_priority::LOW};
+    EXPECT_EQ(cudf::io::detail::current_io_priority(), task_priority::LOW);
+  }
+  EXPECT_EQ(cudf::io::detail::current_io_priority(), task_priority::HIGH);
+}
+
+TEST_F(CuFileIOTest, RemotePaths)
+{
+  using cudf::io::detail::is_remote_path;
+  EXPECT_TRUE(is_remote_path("https://example.com/data.parquet"));
+  EXPECT_TRUE(is_remote_path("http://example.com/data.parquet"));
+  EXPECT_TRUE(is_remote_path("s3://bucket/data.parquet"));
+  EXPECT_TRUE(is_remote_path("gs://bucket/data.parquet"));
+  EXPECT_FALSE(is_remote_path("/tmp/data.parquet"));
+  EXPECT_FALSE(is_remote_path("data/https://example.com"));
+}
+
+TEST_F(CuFileIOTest, AsyncFileSink)
+{
+  // Staging buffers smaller than the writes, so that each write is split across the buffers
+  setenv("LIBCUDF_FILE_SINK_ASYNC", "1", 1);
+  setenv("LIBCUDF_FILE_SINK_BUFFER_SIZE", "1000", 1);
+
+  std::vector<char> expected(10'000);
+  std::iota(expected.begin(), expected.end(), 0);
+  auto const d_data = cudf::detail::make_device_uvector_sync(
+    expected, cudf::get_default_stream(), rmm::mr::get_current_device_resource());
+
+  auto const filepath = temp_env->get_temp_filepath("AsyncFileSink.bin");
+  {
+    auto sink = cudf::io::data_sink::create(filepath);
+    ASSERT_TRUE(sink->is_device_write_preferred(1));
+    sink->host_write(expected.data(), 2500);
+    auto task = sink->device_write_async(d_data.data() + 2500, 5000, cudf::get_default_stream());
+    sink->host_write(expected.data() + 7500, 2500);
+    task.wait();
+    sink->flush();
+    EXPECT_EQ(sink->bytes_written(), expected.size());
+  }
+  unsetenv("LIBCUDF_FILE_SINK_ASYNC");
+  unsetenv("LIBCUDF_FILE_SINK_BUFFER_SIZE");
+
+  std::ifstream file(filepath, std::ios::binary);
+  std::vector<char> const written{std::istreambuf_iterator<char>(file),
+                                  std::istreambuf_iterator<char>()};
+  EXPECT_EQ(written, expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
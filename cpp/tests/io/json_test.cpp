@@ -25,6 +25,7 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/arrow_io_source.hpp>
 #include <cudf/io/json.hpp>
@@ -703,7 +704,6 @@ TEST_F(JsonReaderTest, JsonLinesByteRange)
   cudf::io::json_reader_options in_options =
     cudf::io::json_reader_options::builder(cudf::io::source_info{fname})
       .lines(true)
-      .legacy(true)  // Support in new reader coming in https://github.com/rapidsai/cudf/pull/12498
       .byte_range_offset(11)
       .byte_range_size(20);
 
@@ -718,6 +718,42 @@ TEST_F(JsonReaderTest, JsonLinesByteRange)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_wrapper{{3000, 4000, 5000}});
 }
 
+TEST_F(JsonReaderTest, JsonLinesChunkedRead)
+{
+  const std::string fname = temp_env->get_temp_dir() + "JsonLinesChunkedReadTest.json";
+  std::ofstream outfile(fname, std::ofstream::out);
+  for (int i = 0; i < 50; ++i) {
+    // Records in the middle have no "b", so some chunks don't have the column at all
+    if (i >= 20 and i < 30) {
+      outfile << "{\"a\": " << i << "}\n";
+    } else {
+      outfile << "{\"a\": " << i << ", \"b\": \"s" << i << "\"}\n";
+    }
+  }
+  outfile.close();
+
+  auto const in_options =
+    cudf::io::json_reader_options::builder(cudf::io::source_info{fname}).lines(true).build();
+  auto const expected = cudf::io::read_json(in_options);
+
+  auto reader = cudf::io::chunked_json_reader(64, in_options);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    auto chunk = reader.read_chunk();
+    ASSERT_EQ(chunk.tbl->num_columns(), 2);
+    EXPECT_EQ(chunk.metadata.schema_info[0].name, "a");
+    EXPECT_EQ(chunk.metadata.schema_info[1].name, "b");
+    chunks.push_back(std::move(chunk.tbl));
+  }
+  EXPECT_GT(chunks.size(), 1ul);
+
+  std::vector<cudf::table_view> chunk_views;
+  std::transform(chunks.cbegin(), chunks.cend(), std::back_inserter(chunk_views), [](auto& tbl) {
+    return tbl->view();
+  });
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(chunk_views)->view(), expected.tbl->view());
+}
+
 TEST_P(JsonReaderDualTest, JsonLinesObjects)
 {
   auto const test_opt     = GetParam();
@@ -737,7 +773,7 @@ TEST_P(JsonReaderDualTest, JsonLinesObjects)
   EXPECT_EQ(result.tbl->num_rows(), 1);
 
   EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT64);
-  EXPECT_EQ(result.metadata.schema_info[0].name, is_legacy_test(test_opt) ? "co\\\"l1" : "co\"l1");
+  EXPECT_EQ(result.metadata.schema_info[0].name, "co\"l1");
   EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::FLOAT64);
   EXPECT_EQ(result.metadata.schema_info[1].name, "col2");
 
@@ -915,8 +951,7 @@ TEST_F(JsonReaderTest, ArrowFileSource)
   cudf::io::json_reader_options in_options =
     cudf::io::json_reader_options::builder(cudf::io::source_info{&arrow_source})
       .dtypes({dtype<int8_t>()})
-      .lines(true)
-      .legacy(true);  // Support in new reader coming in https://github.com/rapidsai/cudf/pull/12498
+      .lines(true);
 
   cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
 
@@ -1279,6 +1314,51 @@ TEST_F(JsonReaderTest, BadDtypeParams)
   EXPECT_THROW(cudf::io::read_json(options_map), cudf::logic_error);
 }
 
+TEST_F(JsonReaderTest, LegacyEmptyValues)
+{
+  std::string const buffer = "[1.0,]\n[, 2]\n[3.0, 4]";
+
+  cudf::io::json_reader_options const in_options =
+    cudf::io::json_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .lines(true)
+      .legacy(true);
+
+  // empty values are read as nulls
+  auto const result = cudf::io::read_json(in_options);
+  ASSERT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0),
+                                 float64_wrapper{{1.0, 0.0, 3.0}, {true, false, true}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1),
+                                 int64_wrapper{{0, 2, 4}, {false, true, true}});
+
+  // without the legacy option, empty values are invalid JSON
+  cudf::io::json_reader_options const strict_options =
+    cudf::io::json_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .lines(true);
+  EXPECT_THROW(cudf::io::read_json(strict_options), cudf::logic_error);
+}
+
+TEST_F(JsonReaderTest, LegacyDatetimeInference)
+{
+  std::string const buffer = "[2020-01-01, \"2020-01-01\"]\n[2021-12-31T10:30:00, \"b\"]";
+
+  cudf::io::json_reader_options in_options =
+    cudf::io::json_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .lines(true)
+      .legacy(true);
+
+  // unquoted date-like values are inferred as timestamps, quoted ones as strings
+  auto const result = cudf::io::read_json(in_options);
+  ASSERT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::TIMESTAMP_MILLISECONDS);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::STRING);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    result.tbl->get_column(0),
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>{
+      1577836800000, 1640946600000});
+}
+
 TEST_F(JsonReaderTest, JsonExperimentalBasic)
 {
   std::string const fname = temp_env->get_temp_dir() + "JsonExperimentalBasic.json";
@@ -1323,12 +1403,11 @@ TEST_F(JsonReaderTest, JsonExperimentalLines)
   // Read test data via nested JSON reader
   auto const table = cudf::io::read_json(json_lines_options);
 
-  // Read test data via legacy, non-nested JSON lines reader
+  // Read test data in the legacy mode of the nested JSON reader
   json_lines_options.enable_legacy(true);
   auto const legacy_reader_table = cudf::io::read_json(json_lines_options);
 
-  // Verify that the data read via non-nested JSON lines reader matches the data read via nested
-  // JSON reader
+  // Verify that the data read in the legacy mode matches the data read in the default mode
   CUDF_TEST_EXPECT_TABLES_EQUAL(legacy_reader_table.tbl->view(), table.tbl->view());
 }
 
@@ -1501,12 +1580,11 @@ TEST_F(JsonReaderTest, ExperimentalLinesNoOmissions)
     // Read test data via nested JSON reader
     auto const table = cudf::io::read_json(json_lines_options);
 
-    // Read test data via legacy, non-nested JSON lines reader
+    // Read test data in the legacy mode of the nested JSON reader
     json_lines_options.enable_legacy(true);
     auto const legacy_reader_table = cudf::io::read_json(json_lines_options);
 
-    // Verify that the data read via non-nested JSON lines reader matches the data read via
-    // nested JSON reader
+    // Verify that the data read in the legacy mode matches the data read in the default mode
     CUDF_TEST_EXPECT_TABLES_EQUAL(legacy_reader_table.tbl->view(), table.tbl->view());
   }
 }
@@ -2291,4 +2369,57 @@ TEST_F(JsonReaderTest, MapTypes)
           {type_id::LIST, type_id::STRING, type_id::STRING});
 }
 
+TEST_F(JsonReaderTest, PruneColumns)
+{
+  std::string const json_string = R"({"a": 1, "b": {"c": 10, "d": "x"}, "e": [1, 2]}
+    {"a": 2, "b": {"c": 20, "d": "y"}, "e": [3]})";
+  std::map<std::string, cudf::io::schema_element> dtype_schema{
+    {"a", {dtype<int32_t>()}},
+    {"b", {data_type{cudf::type_id::STRUCT}, {{"c", {dtype<int64_t>()}}}}},
+  };
+
+  cudf::io::json_reader_options in_options =
+    cudf::io::json_reader_options::builder(
+      cudf::io::source_info{json_string.data(), json_string.size()})
+      .dtypes(dtype_schema)
+      .prune_columns(true)
+      .lines(true);
+  auto const result = cudf::io::read_json(in_options);
+
+  // only the columns in dtypes are read
+  ASSERT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.metadata.schema_info[0].name, "a");
+  EXPECT_EQ(result.metadata.schema_info[1].name, "b");
+  ASSERT_EQ(result.metadata.schema_info[1].children.size(), 1);
+  EXPECT_EQ(result.metadata.schema_info[1].children[0].name, "c");
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(0),
+                                      cudf::test::fixed_width_column_wrapper<int32_t>{1, 2});
+  cudf::test::fixed_width_column_wrapper<int64_t> c{10, 20};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(1),
+                                      cudf::test::structs_column_wrapper{{c}});
+}
+
+TEST_F(JsonReaderTest, PruneColumnsSkipsUnselectedSubtrees)
+{
+  // the unselected fields hold nested values and values of conflicting types across rows
+  std::string const json_string = R"([{"x": [{"p": 1}, {"p": 2}], "y": 1.5, "z": {"q": "a"}},
+    {"x": {"r": [1, 2]}, "y": 2.5, "z": "b"},
+    {"y": 3.5}])";
+  std::map<std::string, cudf::io::schema_element> dtype_schema{{"y", {dtype<double>()}}};
+
+  cudf::io::json_reader_options in_options =
+    cudf::io::json_reader_options::builder(
+      cudf::io::source_info{json_string.data(), json_string.size()})
+      .dtypes(dtype_schema)
+      .prune_columns(true)
+      .lines(false);
+  auto const result = cudf::io::read_json(in_options);
+
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  EXPECT_EQ(result.metadata.schema_info[0].name, "y");
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    result.tbl->get_column(0), cudf::test::fixed_width_column_wrapper<double>{1.5, 2.5, 3.5});
+}
+
 CUDF_TEST_PROGRAM_MAIN()
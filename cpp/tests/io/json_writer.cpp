@@ -463,6 +463,37 @@ TEST_F(JsonWriterTest, ChunkedNested)
   EXPECT_EQ(expected, std::string(out_buffer.data(), out_buffer.size()));
 }
 
+TEST_F(JsonWriterTest, ChunkedMatchesSingleChunk)
+{
+  constexpr auto num_rows = 100;
+  auto const strings      = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row " + std::to_string(i); });
+  auto const ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::strings_column_wrapper col1(
+    strings, strings + num_rows, cudf::test::iterators::nulls_at({3, 50}));
+  cudf::test::fixed_width_column_wrapper<int> col2(ints, ints + num_rows);
+  cudf::table_view tbl_view{{col1, col2}};
+  cudf::io::table_metadata mt{{{"str"}, {"int"}}};
+
+  auto const write = [&](cudf::size_type rows_per_chunk) {
+    std::vector<char> out_buffer;
+    auto const options =
+      cudf::io::json_writer_options_builder(cudf::io::sink_info(&out_buffer), tbl_view)
+        .include_nulls(true)
+        .metadata(mt)
+        .lines(false)
+        .na_rep("null")
+        .rows_per_chunk(rows_per_chunk)
+        .build();
+    cudf::io::write_json(
+      options, cudf::test::get_default_stream(), rmm::mr::get_current_device_resource());
+    return std::string(out_buffer.data(), out_buffer.size());
+  };
+
+  // 13 rows per chunk are rounded up to 16
+  EXPECT_EQ(write(num_rows), write(13));
+}
+
 TEST_F(JsonWriterTest, StructAllNullCombinations)
 {
   auto const_1_iter = thrust::make_constant_iterator(1);
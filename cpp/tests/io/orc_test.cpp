@@ -30,12 +30,16 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <src/io/comp/nvcomp_adapter.hpp>
+#include <src/io/orc/orc.hpp>
 
 #include <type_traits>
 
@@ -1203,6 +1207,116 @@ TEST_F(OrcReaderTest, MultipleInputs)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(OrcReaderTest, ChunkedRead)
+{
+  srand(31538);
+  auto constexpr num_rows = 10000;
+  auto const table        = create_random_fixed_table<int>(2, num_rows, true);
+
+  std::vector<char> out_buffer;
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{&out_buffer}, table->view())
+      .stripe_size_rows(1000);
+  cudf::io::write_orc(out_opts);
+
+  auto const read_chunks = [&](cudf::io::orc_reader_options const& options,
+                               std::size_t chunk_read_limit,
+                               std::size_t pass_read_limit) {
+    auto reader = cudf::io::chunked_orc_reader(chunk_read_limit, pass_read_limit, options);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    do {
+      chunks.push_back(reader.read_chunk().tbl);
+    } while (reader.has_next());
+
+    std::vector<table_view> chunk_views;
+    std::transform(chunks.cbegin(), chunks.cend(), std::back_inserter(chunk_views), [](auto& t) {
+      return t->view();
+    });
+    return std::pair{cudf::concatenate(chunk_views), chunks.size()};
+  };
+
+  auto const source = cudf::io::source_info{out_buffer.data(), out_buffer.size()};
+  {
+    auto const options = cudf::io::orc_reader_options::builder(source).build();
+
+    // No limits reads the whole file in one chunk
+    auto const [result, num_chunks] = read_chunks(options, 0, 0);
+    EXPECT_EQ(num_chunks, 1ul);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result, table->view());
+
+    auto const [out_limited, num_out_chunks] = read_chunks(options, 20000, 0);
+    EXPECT_GT(num_out_chunks, 1ul);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*out_limited, table->view());
+
+    // A limit smaller than a stripe still reads one stripe per chunk
+    auto const [pass_limited, num_pass_chunks] = read_chunks(options, 0, 1);
+    EXPECT_EQ(num_pass_chunks, 10ul);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*pass_limited, table->view());
+  }
+  {
+    auto const options =
+      cudf::io::orc_reader_options::builder(source).skip_rows(1500).num_rows(6000).build();
+    auto const expected = cudf::slice(table->view(), {1500, 7500})[0];
+
+    auto const [result, num_chunks] = read_chunks(options, 1, 0);
+    EXPECT_EQ(num_chunks, 7ul);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result, expected);
+  }
+  {
+    auto const options = cudf::io::orc_reader_options::builder(source).stripes({{1, 3, 4}}).build();
+    auto const expected =
+      cudf::concatenate(cudf::slice(table->view(), {1000, 2000, 3000, 5000}));
+
+    auto const [result, num_chunks] = read_chunks(options, 0, 1);
+    EXPECT_EQ(num_chunks, 3ul);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result, expected->view());
+  }
+}
+
+TEST_F(OrcReaderTest, FilterStripes)
+{
+  auto constexpr num_rows = 10000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto values   = random_values<float>(num_rows);
+  int32_col col0(sequence, sequence + num_rows);
+  float32_col col1(values.begin(), values.end());
+  table_view const written_table({col0, col1});
+
+  std::vector<char> out_buffer;
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{&out_buffer}, written_table)
+      .stripe_size_rows(1000);
+  cudf::io::write_orc(out_opts);
+
+  // Filtering AST - table[0] >= 8500
+  auto literal_value     = cudf::numeric_scalar<int32_t>(8500);
+  auto literal           = cudf::ast::literal(literal_value);
+  auto col_ref_0         = cudf::ast::column_reference(0);
+  auto filter_expression =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_0, literal);
+
+  auto predicate = cudf::compute_column(written_table, filter_expression);
+  auto expected  = cudf::apply_boolean_mask(written_table, *predicate);
+  EXPECT_EQ(expected->num_rows(), 1500);
+
+  auto const read_opts =
+    cudf::io::orc_reader_options::builder(
+      cudf::io::source_info{out_buffer.data(), out_buffer.size()})
+      .filter(filter_expression)
+      .build();
+  auto const result = cudf::io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  // Reading one stripe per chunk shows that only the last two stripes are read
+  auto reader            = cudf::io::chunked_orc_reader(0, 1, read_opts);
+  std::size_t num_chunks = 0;
+  do {
+    EXPECT_GT(reader.read_chunk().tbl->num_rows(), 0);
+    ++num_chunks;
+  } while (reader.has_next());
+  EXPECT_EQ(num_chunks, 2ul);
+}
+
 struct OrcWriterTestDecimal : public OrcWriterTest,
                               public ::testing::WithParamInterface<std::tuple<int, int>> {};
 
@@ -1968,6 +2082,66 @@ TEST_F(OrcWriterTest, UnorderedDictionary)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*from_sorted, *from_unsorted);
 }
 
+TEST_F(OrcWriterTest, HighCardinalityDictionary)
+{
+  // Stripes of several rowgroups, with unique strings in the first column and repeated strings
+  // in the second; the first column skips dictionary encoding after its first rowgroup
+  constexpr auto num_rows = 50000;
+  auto const unique_strings =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+  auto const repeated_strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 7); });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  str_col unique_col(unique_strings, unique_strings + num_rows, valids);
+  str_col repeated_col(repeated_strings, repeated_strings + num_rows);
+  table_view expected({unique_col, repeated_col});
+
+  std::vector<char> out_buffer;
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{&out_buffer}, expected)
+      .stripe_size_rows(20000);
+  cudf::io::write_orc(out_opts);
+
+  cudf::io::orc_reader_options in_opts = cudf::io::orc_reader_options::builder(
+    cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  auto const result = cudf::io::read_orc(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(OrcStatisticsTest, StatisticsTable)
+{
+  constexpr auto num_rows = 3000;
+  auto const values       = thrust::make_counting_iterator(0);
+  int32_col col0(values, values + num_rows, cudf::test::iterators::nulls_at({1}));
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(1, 'a' + i / 1000); });
+  str_col col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  std::vector<char> out_buffer;
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{&out_buffer}, expected)
+      .stripe_size_rows(1000);
+  cudf::io::write_orc(out_opts);
+
+  auto const result = cudf::io::read_orc_statistics(
+    cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  auto const stats = result.tbl->view();
+
+  ASSERT_EQ(stats.num_columns(), 7);
+  EXPECT_EQ(result.metadata.schema_info[0].name, "num_rows");
+  EXPECT_EQ(result.metadata.schema_info[1].name, "_col0.min");
+  EXPECT_EQ(result.metadata.schema_info[6].name, "_col1.null_count");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(0), int64_col{1000, 1000, 1000});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(1), int64_col{0, 1000, 2000});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(2), int64_col{999, 1999, 2999});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(3), int64_col{1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(4), str_col{"a", "b", "c"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(5), str_col{"a", "b", "c"});
+}
+
 TEST_F(OrcStatisticsTest, Empty)
 {
   int32_col col0{};
@@ -2111,6 +2285,162 @@ TEST_F(OrcWriterTest, BounceBufferBug)
   cudf::io::write_orc(out_opts);
 }
 
+namespace {
+
+// Thomas Wang's 64-bit hash, as in `BloomFilter.getLongHash` of ORC Java (arithmetic right shifts)
+uint64_t orc_long_hash(int64_t value)
+{
+  auto const sra = [](uint64_t key, int shift) {
+    return static_cast<uint64_t>(static_cast<int64_t>(key) >> shift);
+  };
+  auto key = static_cast<uint64_t>(value);
+  key      = ~key + (key << 21);
+  key      = key ^ sra(key, 24);
+  key      = key + (key << 3) + (key << 8);
+  key      = key ^ sra(key, 14);
+  key      = key + (key << 2) + (key << 4);
+  key      = key ^ sra(key, 28);
+  return key + (key << 31);
+}
+
+// `Murmur3.hash64` of ORC Java, used for the strings
+uint64_t orc_string_hash(std::string const& value)
+{
+  constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+  constexpr uint64_t c2 = 0x4cf5ad432745937full;
+  auto const rotl       = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+  auto const mix        = [&](uint64_t k) { return rotl(k * c1, 31) * c2; };
+  auto const load       = [&](size_t offset, size_t count) {
+    uint64_t k = 0;
+    for (auto b = count; b > 0; --b) {
+      k = (k << 8) | static_cast<uint8_t>(value[offset + b - 1]);
+    }
+    return k;
+  };
+
+  uint64_t hash         = 104729;
+  auto const num_blocks = value.size() / 8;
+  for (size_t i = 0; i < num_blocks; ++i) {
+    hash ^= mix(load(i * 8, 8));
+    hash = rotl(hash, 27) * 5 + 0x52dce729;
+  }
+  if (value.size() % 8 != 0) { hash ^= mix(load(num_blocks * 8, value.size() % 8)); }
+  hash ^= value.size();
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  return hash ^ (hash >> 33);
+}
+
+// Probes the filter as `BloomFilter.testHash` of ORC Java
+bool orc_bloom_filter_contains(cudf::io::orc::BloomFilter const& filter, uint64_t hash64)
+{
+  auto const num_bits = static_cast<int32_t>(filter.utf8bitset.size() * 8);
+  auto const hash1    = static_cast<int32_t>(hash64);
+  auto const hash2    = static_cast<int32_t>(hash64 >> 32);
+  for (uint32_t i = 1; i <= filter.numHashFunctions; ++i) {
+    auto combined_hash =
+      static_cast<int32_t>(static_cast<uint32_t>(hash1) + i * static_cast<uint32_t>(hash2));
+    if (combined_hash < 0) { combined_hash = ~combined_hash; }
+    auto const pos = combined_hash % num_bits;
+    if (((filter.utf8bitset[pos / 8] >> (pos % 8)) & 1) == 0) { return false; }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST_F(OrcWriterTest, BloomFilterStreams)
+{
+  constexpr auto num_rows         = 10000;
+  constexpr auto rows_per_stripe  = num_rows / 2;
+  constexpr auto row_index_stride = 1000;
+
+  auto const value_string = [](auto i) { return "value" + std::to_string(i); };
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(0, value_string);
+  int32_col int_col(sequence, sequence + num_rows);
+  str_col string_col(strings, strings + num_rows);
+  float32_col float_col(sequence, sequence + num_rows);
+  table_view expected({int_col, string_col, float_col});
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("strings");
+  expected_metadata.column_metadata[2].set_name("floats");
+
+  auto filepath = temp_env->get_temp_filepath("BloomFilterStreams.orc");
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(std::move(expected_metadata))
+      .compression(cudf::io::compression_type::NONE)
+      .stripe_size_rows(rows_per_stripe)
+      .row_index_stride(row_index_stride)
+      .bloom_filter_columns({"ints", "strings"})
+      .bloom_filter_fpp(0.01);
+  cudf::io::write_orc(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::orc::metadata const meta(source.get(), cudf::get_default_stream());
+  ASSERT_EQ(meta.get_num_stripes(), 2);
+  for (size_t stripe_idx = 0; stripe_idx < meta.ff.stripes.size(); ++stripe_idx) {
+    auto const& stripe = meta.ff.stripes[stripe_idx];
+    auto const buffer  = source->host_read(
+      stripe.offset + stripe.indexLength + stripe.dataLength, stripe.footerLength);
+    cudf::io::orc::StripeFooter footer;
+    cudf::io::orc::ProtobufReader(buffer->data(), buffer->size()).read(footer);
+
+    std::vector<uint32_t> bloom_filter_columns;
+    uint64_t stream_offset = 0;
+    for (auto const& stream : footer.streams) {
+      if (stream.kind == cudf::io::orc::BLOOM_FILTER_UTF8) {
+        // Bloom filters belong to the index section of the stripe
+        EXPECT_LT(stream_offset, stripe.indexLength);
+        EXPECT_GT(stream.length, 0);
+        auto const column_id = stream.column_id.value();
+        bloom_filter_columns.push_back(column_id);
+
+        auto const bf_buffer = source->host_read(stripe.offset + stream_offset, stream.length);
+        cudf::io::orc::BloomFilterIndex bf_index;
+        cudf::io::orc::ProtobufReader(bf_buffer->data(), bf_buffer->size()).read(bf_index);
+        ASSERT_EQ(bf_index.bloomFilter.size(),
+                  static_cast<size_t>(rows_per_stripe / row_index_stride));
+
+        auto const hash = [&](int row) {
+          return column_id == 1 ? orc_long_hash(row) : orc_string_hash(value_string(row));
+        };
+        for (size_t rg = 0; rg < bf_index.bloomFilter.size(); ++rg) {
+          auto const& filter = bf_index.bloomFilter[rg];
+          EXPECT_GT(filter.numHashFunctions, 0u);
+          ASSERT_GT(filter.utf8bitset.size(), 0u);
+          EXPECT_EQ(filter.utf8bitset.size() % sizeof(uint64_t), 0u);
+
+          // Every value of the row group is present, and some of the other rows' values are not
+          auto const first_row =
+            static_cast<int>(stripe_idx * rows_per_stripe + rg * row_index_stride);
+          auto num_present = 0;
+          auto num_absent  = 0;
+          for (auto row = 0; row < row_index_stride; ++row) {
+            num_present += orc_bloom_filter_contains(filter, hash(first_row + row));
+            auto const other_row = (first_row + row_index_stride + row) % num_rows;
+            num_absent += not orc_bloom_filter_contains(filter, hash(other_row));
+          }
+          EXPECT_EQ(num_present, row_index_stride);
+          EXPECT_GT(num_absent, 0);
+        }
+      }
+      stream_offset += stream.length;
+    }
+    EXPECT_EQ(bloom_filter_columns, (std::vector<uint32_t>{1, 2}));
+  }
+
+  cudf::io::orc_reader_options in_opts =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath});
+  auto result = cudf::io::read_orc(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(OrcReaderTest, SizeTypeRowsOverflow)
 {
   using cudf::test::iterators::no_nulls;
@@ -48,7 +48,9 @@
 #include <src/io/parquet/compact_protocol_reader.hpp>
 #include <src/io/parquet/parquet.hpp>
 
+#include <atomic>
 #include <fstream>
+#include <numeric>
 #include <type_traits>
 
 namespace {
@@ -1159,6 +1161,99 @@ TEST_F(ParquetChunkedReaderInputLimitConstrainedTest, MixedColumns)
   input_limit_test_read(test_filenames, tbl, 0, 1, expected_b);
 }
 
+// Datasource that counts the bytes read from a file
+class byte_counting_source : public cudf::io::datasource {
+ public:
+  explicit byte_counting_source(std::string const& filepath)
+    : _source{cudf::io::datasource::create(filepath)}
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto result = _source->host_read(offset, size);
+    bytes_read += result->size();
+    return result;
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const count = _source->host_read(offset, size, dst);
+    bytes_read += count;
+    return count;
+  }
+
+  [[nodiscard]] size_t size() const override { return _source->size(); }
+
+  std::atomic<size_t> bytes_read{0};
+
+ private:
+  std::unique_ptr<cudf::io::datasource> _source;
+};
+
+TEST_F(ParquetChunkedReaderInputLimitConstrainedTest, SingleRowGroupWithPageIndex)
+{
+  auto const filepath = temp_env->get_temp_filepath("single_row_group_page_index.parquet");
+
+  constexpr auto num_rows = 1'000'000;
+
+  auto iter1 = thrust::make_counting_iterator<int>(0);
+  cudf::test::fixed_width_column_wrapper<int> col1(iter1, iter1 + num_rows);
+
+  auto const strings  = std::vector<std::string>{"abc", "de", "fghi"};
+  auto const str_iter = cudf::detail::make_counting_transform_iterator(
+    0, [&](int32_t i) { return strings[i % strings.size()]; });
+  auto col2           = strings_col(str_iter, str_iter + num_rows);
+
+  auto tbl = cudf::table_view{{col1, col2}};
+
+  // a single uncompressed row group of several MB, with page indexes to split it by
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, tbl)
+      .compression(cudf::io::compression_type::NONE)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .row_group_size_rows(num_rows)
+      .max_page_size_rows(20'000);
+  cudf::io::write_parquet(out_opts);
+
+  constexpr size_t pass_read_limit = 1024 * 1024;
+  byte_counting_source source(filepath);
+  ASSERT_GT(source.size(), 2 * pass_read_limit);
+
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{&source}).build();
+  auto reader = cudf::io::chunked_parquet_reader(0, pass_read_limit, read_opts);
+
+  // each call of the reader sets up at most one pass, which reads all the pages of the pass
+  std::vector<size_t> pass_bytes;
+  auto const count_pass_bytes = [&](auto const& reader_call) {
+    auto const bytes_before = source.bytes_read.load();
+    auto result             = reader_call();
+    auto const bytes        = source.bytes_read.load() - bytes_before;
+    if (bytes > 0) { pass_bytes.push_back(bytes); }
+    return result;
+  };
+  std::vector<std::unique_ptr<cudf::table>> out_tables;
+  do {
+    out_tables.emplace_back(count_pass_bytes([&] { return reader.read_chunk().tbl; }));
+  } while (count_pass_bytes([&] { return reader.has_next(); }));
+
+  // the row group is read by several passes, none of which reads more than the limit
+  EXPECT_GT(pass_bytes.size(), 2u);
+  for (auto const bytes : pass_bytes) {
+    EXPECT_LE(bytes, pass_read_limit);
+  }
+  // yet all the pages are read, including the plain encoded integers
+  auto const data_bytes = std::accumulate(pass_bytes.begin(), pass_bytes.end(), size_t{0});
+  EXPECT_GE(data_bytes, num_rows * sizeof(int));
+
+  std::vector<cudf::table_view> out_tviews;
+  for (auto const& out_table : out_tables) {
+    out_tviews.emplace_back(out_table->view());
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::concatenate(out_tviews), tbl);
+}
+
 struct ParquetChunkedReaderInputLimitTest : public cudf::test::BaseFixture {};
 
 struct offset_gen {
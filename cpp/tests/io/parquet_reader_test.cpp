@@ -23,12 +23,21 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/join.hpp>
+#include <cudf/search.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+
 TEST_F(ParquetReaderTest, UserBounds)
 {
   // trying to read more rows than there are should result in
@@ -115,6 +124,27 @@ TEST_F(ParquetReaderTest, UserBounds)
   }
 }
 
+TEST_F(ParquetReaderTest, EstimateMemory)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 1000, false);
+
+  auto filepath = temp_env->get_temp_filepath("EstimateMemory.parquet");
+  cudf::io::parquet_writer_options args =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, *expected);
+  cudf::io::write_parquet(args);
+
+  auto const all_columns = cudf::io::estimate_read_parquet_memory(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}));
+  EXPECT_GE(all_columns.output_bytes, 4 * 1000 * sizeof(int));
+  EXPECT_GT(all_columns.temporary_bytes, 0);
+
+  auto const one_column = cudf::io::estimate_read_parquet_memory(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}).columns({"_col0"}));
+  EXPECT_GE(one_column.output_bytes, 1000 * sizeof(int));
+  EXPECT_LT(one_column.total(), all_columns.total());
+}
+
 TEST_F(ParquetReaderTest, UserBoundsWithNulls)
 {
   // clang-format off
@@ -325,6 +355,39 @@ TEST_F(ParquetReaderTest, ListUserBoundsWithNullsLarge)
   }
 }
 
+TEST_F(ParquetReaderTest, ListUserBoundsPlainEncoded)
+{
+  constexpr int num_rows = 2 * 10000;
+  auto colp              = make_parquet_list_list_col<int>(0, num_rows, 3, 7, true);
+  cudf::column_view col  = *colp;
+
+  // without dictionaries, the pages of the list column are decoded by the plain list kernel
+  cudf::table_view tbl({col});
+  auto filepath = temp_env->get_temp_filepath("ListUserBoundsPlainEncoded.parquet");
+  cudf::io::parquet_writer_options out_args =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, tbl)
+      .dictionary_policy(cudf::io::dictionary_policy::NEVER)
+      .row_group_size_rows(10000)
+      .max_page_size_rows(1000);
+  cudf::io::write_parquet(out_args);
+
+  std::vector<std::pair<int, int>> params{
+    {-1, -1}, {33, -1}, {999, 2}, {9900, 1001}, {12345, 678}, {19999, 1}};
+  for (auto p : params) {
+    cudf::io::parquet_reader_options read_args =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+    if (p.first >= 0) { read_args.set_skip_rows(p.first); }
+    if (p.second >= 0) { read_args.set_num_rows(p.second); }
+    auto result = cudf::io::read_parquet(read_args);
+
+    p.first  = p.first < 0 ? 0 : p.first;
+    p.second = p.second < 0 ? num_rows - p.first : p.second;
+    auto expected = cudf::slice(col, {p.first, p.first + p.second});
+
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), expected[0]);
+  }
+}
+
 TEST_F(ParquetReaderTest, ReorderedColumns)
 {
   {
@@ -1325,6 +1388,41 @@ TEST_F(ParquetReaderTest, ReorderedReadMultipleFiles)
   CUDF_TEST_EXPECT_TABLES_EQUAL(sliced[1], swapped2);
 }
 
+TEST_F(ParquetReaderTest, ReadManySmallFiles)
+{
+  constexpr auto num_files = 32;
+  constexpr auto num_rows  = 1000;
+
+  std::vector<std::string> filepaths;
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < num_files; ++i) {
+    auto values = cudf::detail::make_counting_transform_iterator(
+      0, [i](auto row) { return i * num_rows + row; });
+    auto strings = cudf::detail::make_counting_transform_iterator(
+      0, [i](auto row) { return "file " + std::to_string(i) + " row " + std::to_string(row); });
+    auto col0 = cudf::test::fixed_width_column_wrapper<int>(values, values + num_rows);
+    auto col1 = cudf::test::strings_column_wrapper(strings, strings + num_rows);
+    tables.push_back(std::make_unique<table>(table_view{{col0, col1}}));
+
+    auto const filename = "ManySmallFiles" + std::to_string(i) + ".parquet";
+    filepaths.push_back(temp_env->get_temp_filepath(filename));
+    auto const out_opts = cudf::io::parquet_writer_options::builder(
+                            cudf::io::sink_info{filepaths.back()}, tables.back()->view())
+                            .build();
+    cudf::io::write_parquet(out_opts);
+  }
+
+  std::vector<table_view> views;
+  std::transform(tables.begin(), tables.end(), std::back_inserter(views), [](auto const& tbl) {
+    return tbl->view();
+  });
+  auto const expected = cudf::concatenate(views);
+
+  auto read_opts = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepaths});
+  auto result    = cudf::io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected->view());
+}
+
 TEST_F(ParquetReaderTest, FilterSimple)
 {
   srand(31337);
@@ -1450,6 +1548,510 @@ TEST_F(ParquetReaderTest, FilterNamedExpression)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
 }
 
+// Datasource that records the byte ranges read from a file
+class read_recording_source : public cudf::io::datasource {
+ public:
+  explicit read_recording_source(std::string const& filepath)
+    : _source{cudf::io::datasource::create(filepath)}
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    record(offset, size);
+    return _source->host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    record(offset, size);
+    return _source->host_read(offset, size, dst);
+  }
+
+  [[nodiscard]] size_t size() const override { return _source->size(); }
+
+  // Returns whether any of the reads overlaps the range [begin, end)
+  bool was_read(size_t begin, size_t end)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return std::any_of(_reads.begin(), _reads.end(), [&](auto const& read) {
+      return read.first < end && begin < read.first + read.second;
+    });
+  }
+
+ private:
+  void record(size_t offset, size_t size)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _reads.emplace_back(offset, size);
+  }
+
+  std::unique_ptr<cudf::io::datasource> _source;
+  std::mutex _mutex;
+  std::vector<std::pair<size_t, size_t>> _reads;
+};
+
+TEST_F(ParquetReaderTest, FilterEqualityIn)
+{
+  constexpr auto num_rows       = 10'000;
+  constexpr auto rows_per_group = num_rows / 4;
+
+  // Interleaved values, so that the min/max statistics of the row groups overlap
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 2) * num_rows + i; });
+  auto col0      = cudf::test::fixed_width_column_wrapper<int32_t>(values, values + num_rows);
+  auto col1      = cudf::test::fixed_width_column_wrapper<int64_t>(values, values + num_rows);
+  auto const src = table_view{{col0, col1}};
+
+  // A low false positive probability, so that the filters rule out the other row groups
+  cudf::io::table_input_metadata metadata(src);
+  metadata.column_metadata[0].set_name("col0").set_bloom_filter_fpp(0.0001);
+  metadata.column_metadata[1].set_name("col1");
+
+  auto const filepath = temp_env->get_temp_filepath("FilterEqualityIn.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, src)
+      .metadata(std::move(metadata))
+      .stats_level(cudf::io::statistics_freq::STATISTICS_ROWGROUP)
+      .row_group_size_rows(rows_per_group);
+  cudf::io::write_parquet(out_opts);
+
+  // Filtering AST - table[0] IN (7600, 12503), written as an OR of equalities. Both values are
+  // within the statistics of most row groups, but are only held by the fourth and the second one
+  auto literal_value1 = cudf::numeric_scalar<int32_t>(7'600);
+  auto literal_value2 = cudf::numeric_scalar<int32_t>(num_rows + rows_per_group + 3);
+  auto literal1       = cudf::ast::literal(literal_value1);
+  auto literal2       = cudf::ast::literal(literal_value2);
+  auto col_ref_0      = cudf::ast::column_reference(0);
+  auto expr_1         = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, literal1);
+  auto expr_2         = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, literal2);
+  auto filter_expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, expr_1, expr_2);
+
+  // Expected result
+  auto predicate = cudf::compute_column(src, filter_expression);
+  auto expected  = cudf::apply_boolean_mask(src, *predicate);
+  ASSERT_EQ(expected->num_rows(), 2);
+
+  read_recording_source source(filepath);
+  cudf::io::parquet_reader_options read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{&source})
+      .filter(filter_expression);
+  auto result = cudf::io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  // The column chunks of the row groups without the values are never read
+  auto const file = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(file, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), 4);
+  for (size_t rg = 0; rg < fmd.row_groups.size(); ++rg) {
+    auto const holds_values = rg == 1 || rg == 3;
+    for (auto const& chunk : fmd.row_groups[rg].columns) {
+      auto const& chunk_meta = chunk.meta_data;
+      auto const begin       = chunk_meta.dictionary_page_offset > 0
+                                 ? chunk_meta.dictionary_page_offset
+                                 : chunk_meta.data_page_offset;
+      EXPECT_EQ(source.was_read(begin, begin + chunk_meta.total_compressed_size), holds_values)
+        << "row group " << rg;
+    }
+  }
+}
+
+TEST_F(ParquetReaderTest, FilterEqualitySharedLiteral)
+{
+  constexpr auto num_rows       = 10'000;
+  constexpr auto rows_per_group = num_rows / 4;
+
+  // Interleaved values in opposite orders, so that the min/max statistics of the row groups of
+  // both columns overlap
+  auto values0 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 2) * num_rows + i; });
+  auto values1 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return ((i + 1) % 2) * num_rows + (num_rows - 1 - i); });
+  auto col0      = cudf::test::fixed_width_column_wrapper<int32_t>(values0, values0 + num_rows);
+  auto col1      = cudf::test::fixed_width_column_wrapper<int32_t>(values1, values1 + num_rows);
+  auto const src = table_view{{col0, col1}};
+
+  cudf::io::table_input_metadata metadata(src);
+  metadata.column_metadata[0].set_name("col0").set_bloom_filter_fpp(0.0001);
+  metadata.column_metadata[1].set_name("col1").set_bloom_filter_fpp(0.0001);
+
+  auto const filepath = temp_env->get_temp_filepath("FilterEqualitySharedLiteral.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, src)
+      .metadata(std::move(metadata))
+      .stats_level(cudf::io::statistics_freq::STATISTICS_ROWGROUP)
+      .row_group_size_rows(rows_per_group);
+  cudf::io::write_parquet(out_opts);
+
+  // Filtering AST - table[0] == 12503 OR table[1] == 12503, with a single literal. The value is
+  // held by the second row group of the first column and by the third row group of the second
+  auto literal_value = cudf::numeric_scalar<int32_t>(num_rows + rows_per_group + 3);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto expr_1        = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, literal);
+  auto expr_2        = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_1, literal);
+  auto filter_expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, expr_1, expr_2);
+
+  // Expected result
+  auto predicate = cudf::compute_column(src, filter_expression);
+  auto expected  = cudf::apply_boolean_mask(src, *predicate);
+  ASSERT_EQ(expected->num_rows(), 2);
+
+  read_recording_source source(filepath);
+  cudf::io::parquet_reader_options read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{&source})
+      .filter(filter_expression);
+  auto result = cudf::io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  // Only the row groups holding the value in either column are read
+  auto const file = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(file, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), 4);
+  for (size_t rg = 0; rg < fmd.row_groups.size(); ++rg) {
+    auto const holds_value = rg == 1 || rg == 2;
+    for (auto const& chunk : fmd.row_groups[rg].columns) {
+      auto const& chunk_meta = chunk.meta_data;
+      auto const begin       = chunk_meta.dictionary_page_offset > 0
+                                 ? chunk_meta.dictionary_page_offset
+                                 : chunk_meta.data_page_offset;
+      EXPECT_EQ(source.was_read(begin, begin + chunk_meta.total_compressed_size), holds_value)
+        << "row group " << rg;
+    }
+  }
+}
+
+TEST_F(ParquetReaderTest, FilterPageIndex)
+{
+  constexpr auto num_rows = 40'000;
+  // values have a gap in the middle so that the row group statistics span values none of the pages
+  // contain
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i < num_rows / 2 ? i : i + num_rows; });
+  auto col0 = cudf::test::fixed_width_column_wrapper<int32_t>(values, values + num_rows);
+  auto col1 = cudf::test::fixed_width_column_wrapper<int64_t>(values, values + num_rows);
+  auto const src = table_view{{col0, col1}};
+
+  auto const filepath = temp_env->get_temp_filepath("FilterPageIndex.parquet");
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, src)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .max_page_size_rows(5'000)
+      .build();
+  cudf::io::write_parquet(out_opts);
+
+  auto test_filter = [&](cudf::ast::expression const& filter_expression) {
+    auto predicate = cudf::compute_column(src, filter_expression);
+    auto expected  = cudf::apply_boolean_mask(src, *predicate);
+
+    cudf::io::parquet_reader_options read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .filter(filter_expression);
+    auto result = cudf::io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+  };
+
+  // Filtering AST - table[0] == 30000, inside the gap
+  auto gap_value = cudf::numeric_scalar<int32_t>(30'000);
+  auto gap_lit   = cudf::ast::literal(gap_value);
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  test_filter(cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, gap_lit));
+
+  // Filtering AST - table[0] < 100 AND table[1] > 70000, each true on some pages but never both
+  auto lo_value  = cudf::numeric_scalar<int32_t>(100);
+  auto hi_value  = cudf::numeric_scalar<int64_t>(70'000);
+  auto lo_lit    = cudf::ast::literal(lo_value);
+  auto hi_lit    = cudf::ast::literal(hi_value);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto expr_1    = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, lo_lit);
+  auto expr_2    = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_1, hi_lit);
+  test_filter(cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, expr_1, expr_2));
+
+  // Filtering AST - table[0] == 65000, on a page in the second half
+  auto value = cudf::numeric_scalar<int32_t>(65'000);
+  auto lit   = cudf::ast::literal(value);
+  test_filter(cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, lit));
+}
+
+TEST_F(ParquetReaderTest, FilterPageIndexSkipsPages)
+{
+  // a single row group of 8 pages per column, holding both matching and non-matching pages
+  constexpr auto num_rows = 40'000;
+  auto values             = thrust::make_counting_iterator(0);
+  auto col0 = cudf::test::fixed_width_column_wrapper<int32_t>(values, values + num_rows);
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto col1 = cudf::test::fixed_width_column_wrapper<double>(values, values + num_rows, valids);
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "s" + std::to_string(i); });
+  auto col2      = cudf::test::strings_column_wrapper(strings, strings + num_rows);
+  auto const src = table_view{{col0, col1, col2}};
+
+  auto const filepath = temp_env->get_temp_filepath("FilterPageIndexSkipsPages.parquet");
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, src)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .max_page_size_rows(5'000)
+      .build();
+  cudf::io::write_parquet(out_opts);
+
+  auto const metadata = cudf::io::read_parquet_metadata(cudf::io::source_info{filepath});
+  ASSERT_EQ(metadata.num_rowgroups(), 1);
+
+  auto test_filter = [&](cudf::ast::expression const& filter_expression) {
+    auto predicate = cudf::compute_column(src, filter_expression);
+    auto expected  = cudf::apply_boolean_mask(src, *predicate);
+
+    cudf::io::parquet_reader_options read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .filter(filter_expression);
+    auto result = cudf::io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+    // The other columns are only read for the pages holding matching rows
+    read_opts.enable_late_materialization(true);
+    auto late_result = cudf::io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*late_result.tbl, *expected);
+  };
+
+  // Filtering AST - 12000 <= table[0] < 13000, only on the third page
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto lo_value  = cudf::numeric_scalar<int32_t>(12'000);
+  auto hi_value  = cudf::numeric_scalar<int32_t>(13'000);
+  auto lo_lit    = cudf::ast::literal(lo_value);
+  auto hi_lit    = cudf::ast::literal(hi_value);
+  auto expr_1    = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_0, lo_lit);
+  auto expr_2    = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, hi_lit);
+  test_filter(cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, expr_1, expr_2));
+
+  // Filtering AST - table[0] < 100 OR table[0] > 39900, on the first and the last page
+  auto first_value = cudf::numeric_scalar<int32_t>(100);
+  auto last_value  = cudf::numeric_scalar<int32_t>(39'900);
+  auto first_lit   = cudf::ast::literal(first_value);
+  auto last_lit    = cudf::ast::literal(last_value);
+  auto expr_3      = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, first_lit);
+  auto expr_4      = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, last_lit);
+  test_filter(cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, expr_3, expr_4));
+
+  // Filtering AST - table[1] < 100, on the first page of the nullable column
+  auto col_ref_1    = cudf::ast::column_reference(1);
+  auto double_value = cudf::numeric_scalar<double>(100.);
+  auto double_lit   = cudf::ast::literal(double_value);
+  test_filter(cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_1, double_lit));
+}
+
+TEST_F(ParquetReaderTest, FilterLateMaterialization)
+{
+  auto [src, filepath] = create_parquet_with_stats("FilterLateMaterialization.parquet");
+
+  auto test_filter = [&, &src = src, &filepath = filepath](
+                       cudf::ast::expression const& table_filter,
+                       cudf::ast::expression const& parquet_filter) {
+    auto predicate = cudf::compute_column(src, table_filter);
+    auto expected  = cudf::apply_boolean_mask(src, *predicate);
+
+    cudf::io::parquet_reader_options read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .filter(parquet_filter)
+        .late_materialization(true);
+    auto result = cudf::io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+  };
+
+  // Filtering AST - table[2] > 0.9 AND table[2] < -0.9, on unordered values: no rows
+  auto lo_value  = cudf::numeric_scalar<double>(0.9);
+  auto hi_value  = cudf::numeric_scalar<double>(-0.9);
+  auto lo_lit    = cudf::ast::literal(lo_value);
+  auto hi_lit    = cudf::ast::literal(hi_value);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+  auto expr_1    = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_2, lo_lit);
+  auto expr_2    = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_2, hi_lit);
+  auto expr_3    = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, expr_1, expr_2);
+  test_filter(expr_3, expr_3);
+
+  // Filtering AST - table["col_uint32"] < 150
+  auto literal_value  = cudf::numeric_scalar<uint32_t>(150);
+  auto literal        = cudf::ast::literal(literal_value);
+  auto col_name_0     = cudf::ast::column_name_reference("col_uint32");
+  auto parquet_filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_name_0, literal);
+  auto col_ref_0      = cudf::ast::column_reference(0);
+  auto table_filter   = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, literal);
+  test_filter(table_filter, parquet_filter);
+}
+
+TEST_F(ParquetReaderTest, FilterJoinBloomFilter)
+{
+  auto [src, filepath] = create_parquet_with_stats("FilterJoinBloomFilter.parquet");
+
+  column_wrapper<uint32_t> build_col{10, 500, 1234};
+  auto const filter = cudf::join_bloom_filter(table_view{{build_col}});
+
+  cudf::io::parquet_reader_options read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .join_filter(filter, {"col_uint32"});
+  auto result = cudf::io::read_parquet(read_opts);
+
+  auto const expected = cudf::filter_by_bloom(src, table_view{{src.get_column(0)}}, filter);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+  EXPECT_GE(result.tbl->num_rows(), 3);
+
+  // The key columns must be read
+  cudf::io::parquet_reader_options missing_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .columns({"col_int64"})
+      .join_filter(filter, {"col_uint32"});
+  EXPECT_THROW(cudf::io::read_parquet(missing_opts), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, FilterMembershipIndex)
+{
+  auto [src, filepath] = create_parquet_with_stats("FilterMembershipIndex.parquet");
+
+  column_wrapper<uint32_t> values{10, 500, 1234, 10};
+  auto const index = cudf::membership_index(values);
+
+  auto const matches  = index.contains(src.get_column(0));
+  auto const expected = cudf::apply_boolean_mask(src, *matches);
+  EXPECT_GE(expected->num_rows(), 3);
+
+  // The row groups are pruned with the statistics, then the rows are filtered
+  cudf::io::parquet_reader_options read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .membership_filter(index, "col_uint32");
+  auto result = cudf::io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  // The filtered column must be read
+  cudf::io::parquet_reader_options missing_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .columns({"col_int64"})
+      .membership_filter(index, "col_uint32");
+  EXPECT_THROW(cudf::io::read_parquet(missing_opts), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, MetadataCache)
+{
+  auto const filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+
+  auto read_cached = [](cudf::io::source_info const& source, std::vector<std::string> keys = {}) {
+    cudf::io::parquet_reader_options read_opts = cudf::io::parquet_reader_options::builder(source)
+                                                   .use_metadata_cache(true)
+                                                   .metadata_cache_keys(std::move(keys));
+    return cudf::io::read_parquet(read_opts);
+  };
+
+  column_wrapper<int32_t> col_1{1, 2, 3, 4, 5};
+  auto const table_1 = table_view{{col_1}};
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, table_1).build());
+  // The second read is served from the cache
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read_cached(cudf::io::source_info{filepath}).tbl->view(), table_1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read_cached(cudf::io::source_info{filepath}).tbl->view(), table_1);
+
+  // Rewriting the file changes its key
+  column_wrapper<int32_t> col_2{6, 7, 8};
+  auto const table_2 = table_view{{col_2}};
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, table_2).build());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read_cached(cudf::io::source_info{filepath}).tbl->view(), table_2);
+
+  // Buffers are only cached with user-supplied keys
+  std::vector<char> buffer;
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, table_1).build());
+  auto const buffer_source = cudf::io::source_info{buffer.data(), buffer.size()};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read_cached(buffer_source, {"buffer"}).tbl->view(), table_1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read_cached(buffer_source, {"buffer"}).tbl->view(), table_1);
+  EXPECT_THROW(read_cached(buffer_source, {"a", "b"}), cudf::logic_error);
+
+  cudf::io::clear_parquet_metadata_cache();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read_cached(buffer_source, {"buffer"}).tbl->view(), table_1);
+}
+
+TEST_F(ParquetReaderTest, ByteRange)
+{
+  auto const filepath = temp_env->get_temp_filepath("ByteRange.parquet");
+
+  constexpr auto num_rows = 50'000;
+  auto const values       = thrust::make_counting_iterator(0);
+  column_wrapper<int32_t> col(values, values + num_rows);
+  auto const expected = table_view{{col}};
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .row_group_size_rows(5'000)
+      .build());
+
+  // Consecutive byte ranges read every row group once, in order
+  auto const file_size = std::filesystem::file_size(filepath);
+  auto const split     = file_size / 3;
+  std::vector<std::unique_ptr<cudf::table>> parts;
+  for (std::size_t offset = 0; offset < file_size; offset += split) {
+    cudf::io::parquet_reader_options read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .byte_range(offset, split)
+        .use_metadata_cache(true);
+    parts.push_back(std::move(cudf::io::read_parquet(read_opts).tbl));
+  }
+  std::vector<table_view> part_views;
+  std::transform(parts.begin(), parts.end(), std::back_inserter(part_views), [](auto const& part) {
+    return part->view();
+  });
+  EXPECT_GT(part_views.front().num_rows(), 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(part_views)->view(), expected);
+
+  // A range past the row groups reads no rows
+  cudf::io::parquet_reader_options tail_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .byte_range(file_size, 0);
+  EXPECT_EQ(cudf::io::read_parquet(tail_opts).tbl->num_rows(), 0);
+
+  // A byte range is exclusive with the row selection options
+  EXPECT_THROW(cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                 .skip_rows(10)
+                 .byte_range(0, split),
+               cudf::logic_error);
+  cudf::io::clear_parquet_metadata_cache();
+}
+
+TEST_F(ParquetReaderTest, ReadStatistics)
+{
+  auto const filepath = temp_env->get_temp_filepath("ReadStatistics.parquet");
+
+  constexpr auto num_rows = 20'000;
+  auto const values       = thrust::make_counting_iterator(0);
+  column_wrapper<int32_t> col(values, values + num_rows, cudf::test::iterators::nulls_at({3}));
+  auto const expected = table_view{{col}};
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("a");
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(std::move(expected_metadata))
+      .row_group_size_rows(5'000)
+      .build());
+
+  auto const result = cudf::io::read_parquet_statistics(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}));
+  auto const stats = result.tbl->view();
+
+  ASSERT_EQ(stats.num_columns(), 5);
+  EXPECT_EQ(result.metadata.schema_info[0].name, "num_rows");
+  EXPECT_EQ(result.metadata.schema_info[1].name, "a.min");
+  EXPECT_EQ(result.metadata.schema_info[4].name, "a.size");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(0),
+                                 column_wrapper<int64_t>{5'000, 5'000, 5'000, 5'000});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(1),
+                                 column_wrapper<int32_t>{0, 5'000, 10'000, 15'000});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(2),
+                                 column_wrapper<int32_t>{4'999, 9'999, 14'999, 19'999});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats.column(3), column_wrapper<int64_t>{1, 0, 0, 0});
+  EXPECT_EQ(stats.column(4).null_count(), 0);
+}
+
 TEST_F(ParquetReaderTest, FilterMultiple1)
 {
   using T = cudf::string_view;
@@ -2187,6 +2789,59 @@ TEST_F(ParquetReaderTest, StringsWithPageStats)
   }
 }
 
+TEST_F(ParquetReaderTest, KeepDictionaries)
+{
+  constexpr int num_rows       = 10'000;
+  constexpr int row_group_rows = 2'000;
+  std::vector<std::string> const fruits{"apple", "banana", "cherry", "date", "elderberry"};
+
+  // each row group holds a different subset of the strings in its dictionary
+  auto str_iter = cudf::detail::make_counting_transform_iterator(0, [&](int i) {
+    return fruits[(i / row_group_rows + i % 3) % fruits.size()];
+  });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](int i) { return i % 13 != 0; });
+  auto const str_col = cudf::purge_nonempty_nulls(
+    cudf::test::strings_column_wrapper(str_iter, str_iter + num_rows, valids));
+  auto int_iter = thrust::make_counting_iterator(0);
+  column_wrapper<int32_t> int_col(int_iter, int_iter + num_rows);
+  cudf::table_view tbl({*str_col, int_col});
+
+  auto const filepath = temp_env->get_temp_filepath("KeepDictionaries.parquet");
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, tbl)
+      .row_group_size_rows(row_group_rows)
+      .build();
+  cudf::io::write_parquet(out_opts);
+
+  auto const check = [&](int skip_rows, int read_rows) {
+    auto read_opts = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                       .keep_dictionaries(true)
+                       .build();
+    read_opts.set_skip_rows(skip_rows);
+    read_opts.set_num_rows(read_rows);
+    auto const result = cudf::io::read_parquet(read_opts);
+    auto const expected =
+      cudf::slice(tbl, std::vector<cudf::size_type>{skip_rows, skip_rows + read_rows}).front();
+
+    auto const dictionary = result.tbl->get_column(0).view();
+    ASSERT_EQ(dictionary.type().id(), cudf::type_id::DICTIONARY32);
+    // the keys of all the row groups are merged
+    EXPECT_EQ(cudf::dictionary_column_view(dictionary).keys_size(),
+              static_cast<cudf::size_type>(fruits.size()));
+    auto const decoded = cudf::dictionary::decode(cudf::dictionary_column_view(dictionary));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.column(0), *decoded);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.column(1), result.tbl->get_column(1));
+  };
+  check(0, num_rows);
+  check(3'000, 4'000);
+
+  // without the option the strings are decoded
+  auto const result = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(tbl, result.tbl->view());
+}
+
 ///////////////////
 // metadata tests
 
@@ -22,11 +22,15 @@
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/unary.hpp>
 
+#include <cmath>
 #include <fstream>
+#include <random>
 
 using cudf::test::iterators::no_nulls;
 
@@ -387,6 +391,77 @@ TEST_F(ParquetWriterTest, PartitionedWrite)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected2, result2.tbl->view());
 }
 
+TEST_F(ParquetWriterTest, SortedPartitionedWrite)
+{
+  column_wrapper<int32_t> keys{{3, 0, 1, 2, 1, 0, 0, 5}, {1, 0, 1, 1, 1, 0, 1, 1}};
+  column_wrapper<int64_t> values{0, 1, 2, 3, 4, 5, 6, 7};
+  auto const input = table_view{{keys, values}};
+
+  auto const filepath1 = temp_env->get_temp_filepath("SortedPartitionedWrite1.parquet");
+  auto const filepath2 = temp_env->get_temp_filepath("SortedPartitionedWrite2.parquet");
+  cudf::io::parquet_writer_options const args =
+    cudf::io::parquet_writer_options::builder(
+      cudf::io::sink_info(std::vector<std::string>{filepath1, filepath2}), input)
+      .partitions({{0, 4}, {4, 4}})
+      .sorting_columns({cudf::io::sorting_column{0, true, true}});
+  cudf::io::write_parquet(args);
+
+  // the rows of each file are sorted separately, in descending order with the nulls first
+  column_wrapper<int32_t> expected_keys1{{0, 3, 2, 1}, {0, 1, 1, 1}};
+  column_wrapper<int64_t> expected_values1{1, 0, 3, 2};
+  auto const result1 = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info(filepath1)));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected_keys1, expected_values1}),
+                                result1.tbl->view());
+
+  column_wrapper<int32_t> expected_keys2{{0, 5, 1, 0}, {0, 1, 1, 1}};
+  column_wrapper<int64_t> expected_values2{5, 7, 4, 6};
+  auto const result2 = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info(filepath2)));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected_keys2, expected_values2}),
+                                result2.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, HivePartitionedDataset)
+{
+  column_wrapper<int32_t> years{{2, 1, 2, 0, 1}, {1, 1, 1, 0, 1}};
+  cudf::test::strings_column_wrapper names{"a", "b/c", "a", "x", "b/c"};
+  column_wrapper<int64_t> values{0, 1, 2, 3, 4};
+  auto const input = table_view{{years, values, names}};
+
+  cudf::io::table_input_metadata metadata(input);
+  metadata.column_metadata[0].set_name("year");
+  metadata.column_metadata[1].set_name("value");
+  metadata.column_metadata[2].set_name("name");
+  auto const options = cudf::io::parquet_writer_options::builder(cudf::io::sink_info{}, input)
+                         .metadata(std::move(metadata))
+                         .build();
+  auto const base_path = temp_env->get_temp_dir() + "HivePartitionedDataset";
+  auto const paths     = cudf::io::write_parquet_dataset(options, base_path, {0, 2});
+
+  // the null key sorts first, and the partition values are escaped
+  std::vector<std::string> const expected_paths{
+    base_path + "/year=__HIVE_DEFAULT_PARTITION__/name=x/part-0.parquet",
+    base_path + "/year=1/name=b%2Fc/part-0.parquet",
+    base_path + "/year=2/name=a/part-0.parquet"};
+  EXPECT_EQ(expected_paths, paths);
+
+  std::vector<column_wrapper<int64_t>> expected_values;
+  expected_values.emplace_back(std::initializer_list<int64_t>{3});
+  expected_values.emplace_back(std::initializer_list<int64_t>{1, 4});
+  expected_values.emplace_back(std::initializer_list<int64_t>{0, 2});
+  for (std::size_t p = 0; p < paths.size(); ++p) {
+    auto const result = cudf::io::read_parquet(
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info(paths[p])));
+    ASSERT_EQ(result.tbl->num_columns(), 1);
+    EXPECT_EQ(result.metadata.schema_info[0].name, "value");
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_values[p], result.tbl->get_column(0));
+  }
+
+  EXPECT_THROW(cudf::io::write_parquet_dataset(options, base_path, {0, 1, 2}),
+               std::invalid_argument);
+}
+
 template <typename T>
 std::string create_parquet_file(int num_cols)
 {
@@ -1623,6 +1698,170 @@ TEST_F(ParquetWriterTest, UserRequestedEncodings)
   expect_enc(11, Encoding::PLAIN_DICTIONARY);
 }
 
+TEST_F(ParquetWriterTest, AutoEncodings)
+{
+  using cudf::io::parquet::detail::Encoding;
+  constexpr int num_rows = 10000;
+
+  auto const sequence   = thrust::make_counting_iterator<int64_t>(0);
+  auto const few_values = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i % 4;
+  });
+  auto const prefixed = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "common prefix " + std::to_string(i); });
+  auto const halves = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i * 0.5;
+  });
+  auto const col0 = cudf::test::fixed_width_column_wrapper<int64_t>(sequence, sequence + num_rows);
+  auto const col1 =
+    cudf::test::fixed_width_column_wrapper<int32_t>(few_values, few_values + num_rows);
+  auto const col2  = cudf::test::strings_column_wrapper(prefixed, prefixed + num_rows);
+  auto const col3  = cudf::test::fixed_width_column_wrapper<double>(halves, halves + num_rows);
+  auto const table = table_view({col0, col1, col2, col3});
+
+  cudf::io::table_input_metadata table_metadata(table);
+  for (auto& col_meta : table_metadata.column_metadata) {
+    col_meta.set_encoding(cudf::io::column_encoding::AUTO).set_nullability(false);
+  }
+
+  auto const filepath = temp_env->get_temp_filepath("AutoEncodings.parquet");
+  cudf::io::parquet_writer_options opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, table)
+      .metadata(table_metadata);
+  cudf::io::write_parquet(opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+
+  auto const expect_enc = [&fmd](int idx, Encoding enc) {
+    EXPECT_EQ(fmd.row_groups[0].columns[idx].meta_data.encodings[0], enc);
+  };
+  // constant deltas
+  expect_enc(0, Encoding::DELTA_BINARY_PACKED);
+  // few distinct values
+  expect_enc(1, Encoding::PLAIN_DICTIONARY);
+  // long common prefixes
+  expect_enc(2, Encoding::DELTA_BYTE_ARRAY);
+  // distinct floating point values
+  expect_enc(3, Encoding::PLAIN);
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto const result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ByteStreamSplit)
+{
+  using cudf::io::column_encoding;
+  using cudf::io::parquet::detail::Encoding;
+  constexpr int num_rows = 10000;
+
+  auto const values = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return std::sin(i * 0.001) * 100;
+  });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto const col0 = cudf::test::fixed_width_column_wrapper<float>(values, values + num_rows);
+  auto const col1 =
+    cudf::test::fixed_width_column_wrapper<double>(values, values + num_rows, valids);
+  auto const col2  = cudf::test::fixed_width_column_wrapper<int32_t>(values, values + num_rows);
+  auto child       = cudf::test::fixed_width_column_wrapper<double>(values, values + num_rows);
+  auto const col3  = cudf::test::structs_column_wrapper{{child}};
+  auto const table = table_view({col0, col1, col2, col3});
+
+  cudf::io::table_input_metadata table_metadata(table);
+  for (auto& col_meta : table_metadata.column_metadata) {
+    col_meta.set_encoding(column_encoding::BYTE_STREAM_SPLIT);
+  }
+  table_metadata.column_metadata[3].child(0).set_encoding(column_encoding::BYTE_STREAM_SPLIT);
+
+  auto const filepath = temp_env->get_temp_filepath("ByteStreamSplit.parquet");
+  cudf::io::parquet_writer_options opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, table)
+      .metadata(table_metadata)
+      .compression(cudf::io::compression_type::ZSTD);
+  cudf::io::write_parquet(opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+
+  auto const has_enc = [&fmd](int idx, Encoding enc) {
+    auto const& encodings = fmd.row_groups[0].columns[idx].meta_data.encodings;
+    return std::find(encodings.begin(), encodings.end(), enc) != encodings.end();
+  };
+  EXPECT_TRUE(has_enc(0, Encoding::BYTE_STREAM_SPLIT));
+  EXPECT_TRUE(has_enc(1, Encoding::BYTE_STREAM_SPLIT));
+  // only valid for floating point columns, so the request is ignored
+  EXPECT_FALSE(has_enc(2, Encoding::BYTE_STREAM_SPLIT));
+  EXPECT_TRUE(has_enc(3, Encoding::BYTE_STREAM_SPLIT));
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto const result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table, result.tbl->view());
+
+  // read a subset of the rows
+  in_opts.set_skip_rows(1234);
+  in_opts.set_num_rows(4321);
+  auto const sliced = cudf::slice(table, {1234, 1234 + 4321});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sliced[0], cudf::io::read_parquet(in_opts).tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ColumnCompression)
+{
+  using cudf::io::compression_type;
+  using cudf::io::parquet::detail::Compression;
+  constexpr int num_rows = 10000;
+
+  auto const repeated = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i % 10;
+  });
+  auto const col = cudf::test::fixed_width_column_wrapper<int32_t>(repeated, repeated + num_rows);
+  std::mt19937_64 engine{42};
+  std::vector<int64_t> random_values(num_rows);
+  std::generate(random_values.begin(), random_values.end(), [&engine]() { return engine(); });
+  auto const random_col =
+    cudf::test::fixed_width_column_wrapper<int64_t>(random_values.begin(), random_values.end());
+  auto const table = table_view({col, col, col, random_col, col});
+
+  cudf::io::table_input_metadata table_metadata(table);
+  for (auto& col_meta : table_metadata.column_metadata) {
+    col_meta.set_encoding(cudf::io::column_encoding::PLAIN).set_nullability(false);
+  }
+  table_metadata.column_metadata[0].set_compression(compression_type::ZSTD);
+  table_metadata.column_metadata[1].set_compression(compression_type::NONE);
+  table_metadata.column_metadata[3].set_compression(compression_type::AUTO);
+  table_metadata.column_metadata[4].set_compression(compression_type::AUTO);
+
+  auto const filepath = temp_env->get_temp_filepath("ColumnCompression.parquet");
+  cudf::io::parquet_writer_options opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, table)
+      .metadata(table_metadata)
+      .compression(compression_type::SNAPPY);
+  cudf::io::write_parquet(opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+
+  auto const& columns = fmd.row_groups[0].columns;
+  EXPECT_EQ(columns[0].meta_data.codec, Compression::ZSTD);
+  EXPECT_EQ(columns[1].meta_data.codec, Compression::UNCOMPRESSED);
+  // no column codec, uses the codec of the options
+  EXPECT_EQ(columns[2].meta_data.codec, Compression::SNAPPY);
+  // random values don't compress
+  EXPECT_EQ(columns[3].meta_data.codec, Compression::UNCOMPRESSED);
+  EXPECT_NE(columns[4].meta_data.codec, Compression::UNCOMPRESSED);
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto const result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table, result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, Decimal128DeltaByteArray)
 {
   // decimal128 in cuDF maps to FIXED_LEN_BYTE_ARRAY, which is allowed by the spec to use
@@ -1995,3 +2234,58 @@ TEST_F(ParquetWriterStressTest, DeviceWriteLargeTableWithValids)
   auto custom_tbl = cudf::io::read_parquet(custom_args);
   CUDF_TEST_EXPECT_TABLES_EQUAL(custom_tbl.tbl->view(), expected->view());
 }
+
+TEST_F(ParquetWriterTest, BloomFilters)
+{
+  constexpr auto num_rows = 10000;
+
+  // Interleaved values, so that the min/max statistics of every row group cover the same range
+  auto col0_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 2) * num_rows + i; });
+  auto col1_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string((i % 2) * num_rows + i); });
+  auto col0     = cudf::test::fixed_width_column_wrapper<int32_t>(col0_data, col0_data + num_rows);
+  auto col1     = cudf::test::strings_column_wrapper(col1_data, col1_data + num_rows);
+  auto col2     = cudf::test::fixed_width_column_wrapper<int32_t>(col0_data, col0_data + num_rows);
+  auto expected = table_view{{col0, col1, col2}};
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("int32").set_bloom_filter_fpp(0.01);
+  expected_metadata.column_metadata[1].set_name("string").set_bloom_filter_fpp(0.01);
+  expected_metadata.column_metadata[2].set_name("no_filter");
+
+  auto const filepath = temp_env->get_temp_filepath("BloomFilters.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(std::move(expected_metadata))
+      .row_group_size_rows(num_rows / 4);
+  cudf::io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), 4);
+  for (auto const& rg : fmd.row_groups) {
+    for (auto col : {0, 1}) {
+      auto const& chunk_meta = rg.columns[col].meta_data;
+      ASSERT_TRUE(chunk_meta.bloom_filter_offset.has_value());
+      ASSERT_TRUE(chunk_meta.bloom_filter_length.has_value());
+      EXPECT_GT(chunk_meta.bloom_filter_length.value(), 0);
+    }
+    EXPECT_FALSE(rg.columns[2].meta_data.bloom_filter_offset.has_value());
+  }
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto const result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // A false negative in a filter would drop the row group that holds the value
+  auto const present = cudf::numeric_scalar<int32_t>(2 * num_rows / 4 + 2);
+  auto const literal = cudf::ast::literal(present);
+  auto const col_ref = cudf::ast::column_name_reference("int32");
+  auto const filter  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, literal);
+  in_opts.set_filter(filter);
+  auto const filtered = cudf::io::read_parquet(in_opts);
+  EXPECT_EQ(filtered.tbl->num_rows(), 1);
+}
@@ -240,6 +240,45 @@ TEST_F(DataChunkSourceTest, BgzipSource)
   test_source(input, *source);
 }
 
+TEST_F(DataChunkSourceTest, BgzipSourceWithIndex)
+{
+  auto const filename       = temp_env->get_temp_filepath("bgzip_source_indexed");
+  auto const index_filename = temp_env->get_temp_filepath("bgzip_source_indexed.gzi");
+  std::string input{"bananarama"};
+  input.reserve(input.size() << 23);
+  for (int i = 0; i < 22; i++) {
+    input = input + input;
+  }
+  {
+    std::ofstream output_stream{filename};
+    std::default_random_engine rng{};
+    write_bgzip(output_stream, input, rng, compression::ENABLED, eof::ADD_EOF_BLOCK);
+  }
+  cudf::io::text::build_bgzip_index(filename, index_filename);
+  {
+    std::ifstream index_stream{index_filename};
+    auto const index = cudf::io::text::detail::bgzip::read_index(index_stream);
+    ASSERT_GT(index.size(), 1);
+    for (auto const& entry : index) {
+      ASSERT_LE(entry.decompressed_offset, input.size());
+    }
+    ASSERT_EQ(index.back().decompressed_offset, input.size());
+  }
+
+  auto const source = cudf::io::text::make_source_from_bgzip_file(filename, index_filename);
+
+  test_source(input, *source);
+  {
+    // skipping across multiple chunks
+    auto reader = source->create_reader();
+    reader->skip_bytes(5);
+    auto const offset = input.size() - 1000003;
+    reader->skip_bytes(offset - 5);
+    auto const chunk = reader->get_next_chunk(100, cudf::get_default_stream());
+    ASSERT_EQ(chunk_to_host(*chunk), input.substr(offset, 100));
+  }
+}
+
 TEST_F(DataChunkSourceTest, BgzipSourceVirtualOffsets)
 {
   auto const filename = temp_env->get_temp_filepath("bgzip_source_offsets");
@@ -220,6 +220,86 @@ TEST_F(MultibyteSplitTest, DelimiterErasureOverlap)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
 }
 
+TEST_F(MultibyteSplitTest, MultipleDelimiters)
+{
+  auto delimiters = std::vector<std::string>{"\n", "\r\n"};
+  auto host_input = std::string("abc\r\ndef\n\r\nghi\r");
+
+  auto expected = strings_column_wrapper{"abc\r\n", "def\n", "\r\n", "ghi\r"};
+
+  auto source = cudf::io::text::make_source(host_input);
+  auto out    = cudf::io::text::multibyte_split(*source, delimiters);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, MultipleDelimitersSharedPrefix)
+{
+  auto delimiters = std::vector<std::string>{"<a>", "<ab>", "|"};
+  auto host_input = std::string("x<ab>y<a>z|<a<ab>");
+
+  auto expected = strings_column_wrapper{"x<ab>", "y<a>", "z|", "<a<ab>"};
+
+  auto source = cudf::io::text::make_source(host_input);
+  auto out    = cudf::io::text::multibyte_split(*source, delimiters);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, MultipleDelimitersErasure)
+{
+  auto delimiters = std::vector<std::string>{"\n", "\r\n"};
+  auto host_input = std::string("line\r\nanother line\nthird line\r\nlast");
+
+  auto expected = strings_column_wrapper{"line", "another line", "third line", "last"};
+
+  cudf::io::text::parse_options options;
+  options.strip_delimiters = true;
+  auto source              = cudf::io::text::make_source(host_input);
+  auto out                 = cudf::io::text::multibyte_split(*source, delimiters, options);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, LargeInputMultipleDelimitersMultipleRange)
+{
+  auto host_input = std::string();
+  for (auto i = 0; i < (2 * 32 * 128 * 1024); i++) {
+    host_input += (i % 3 == 0) ? "...\r\n" : "....\n";
+  }
+
+  auto delimiters = std::vector<std::string>{"\n", "\r\n"};
+  auto source     = cudf::io::text::make_source(host_input);
+
+  auto const split_range = [&](cudf::io::text::byte_range_info byte_range) {
+    cudf::io::text::parse_options options;
+    options.byte_range = byte_range;
+    return cudf::io::text::multibyte_split(*source, delimiters, options);
+  };
+  auto byte_ranges = cudf::io::text::create_byte_range_infos_consecutive(host_input.size(), 3);
+  auto out0        = split_range(byte_ranges[0]);
+  auto out1        = split_range(byte_ranges[1]);
+  auto out2        = split_range(byte_ranges[2]);
+
+  auto out_views = std::vector<cudf::column_view>({out0->view(), out1->view(), out2->view()});
+  auto out       = cudf::concatenate(out_views);
+
+  auto expected = cudf::io::text::multibyte_split(*source, delimiters);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected->view(), *out, cudf::test::debug_output_level::ALL_ERRORS);
+}
+
+TEST_F(MultibyteSplitTest, EmptyDelimiters)
+{
+  auto source = cudf::io::text::make_source(std::string("abc"));
+
+  EXPECT_THROW(cudf::io::text::multibyte_split(*source, std::vector<std::string>{}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::text::multibyte_split(*source, std::vector<std::string>{"a", ""}),
+               cudf::logic_error);
+}
+
 TEST_F(MultibyteSplitTest, HandpickedInput)
 {
   auto delimiters = "::|";
@@ -20,6 +20,7 @@
 
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -522,6 +523,53 @@ TYPED_TEST(ConditionalInnerJoinTest, TestSymmetry)
     {{0, 1, 2}}, {{1, 2, 3}}, expression_reverse, {{0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 2}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestRangePredicate)
+{
+  // right.begin <= left.point AND left.point <= right.end
+  auto point     = cudf::ast::column_reference(0);
+  auto begin     = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto end       = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto lower     = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, begin, point);
+  auto upper     = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, point, end);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower, upper);
+
+  this->test({{5, 1, 3, 7, 3}},
+             {{0, 3, 6, 8}, {3, 5, 6, 2}},
+             predicate,
+             {{1, 0}, {2, 0}, {4, 0}, {0, 1}, {2, 1}, {4, 1}});
+}
+
+TYPED_TEST(ConditionalInnerJoinTest, TestRangePredicateExclusivePointsRight)
+{
+  // left.end > right.point AND right.point > left.begin
+  auto point     = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto begin     = cudf::ast::column_reference(1);
+  auto end       = cudf::ast::column_reference(0);
+  auto upper     = cudf::ast::operation(cudf::ast::ast_operator::GREATER, end, point);
+  auto lower     = cudf::ast::operation(cudf::ast::ast_operator::GREATER, point, begin);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, upper, lower);
+
+  this->test({{3, 5, 9}, {0, 3, 5}},
+             {{5, 1, 3, 7, 0, 4}},
+             predicate,
+             {{0, 1}, {1, 5}, {2, 3}});
+}
+
+TYPED_TEST(ConditionalInnerJoinTest, TestRangePredicateNulls)
+{
+  auto point     = cudf::ast::column_reference(0);
+  auto begin     = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto end       = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto lower     = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, begin, point);
+  auto upper     = cudf::ast::operation(cudf::ast::ast_operator::LESS, point, end);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower, upper);
+
+  this->test_nulls({{{1, 2, 3, 4}, {1, 0, 1, 1}}},
+                   {{{0, 2, 3}, {1, 1, 0}}, {{4, 9, 9}, {1, 1, 1}}},
+                   predicate,
+                   {{0, 0}, {2, 0}, {2, 1}, {3, 1}});
+}
+
 TYPED_TEST(ConditionalInnerJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
@@ -557,6 +605,39 @@ TYPED_TEST(ConditionalInnerJoinTest, TestOneColumnTwoNullsNoOutputRowAllEqual)
   this->test_nulls({{{0, 1}, {0, 1}}}, {{{0, 0}, {1, 1}}}, left_zero_eq_right_zero, {});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestChunked)
+{
+  // every left row matches 10 right rows
+  auto [left_data, right_data] = gen_random_repeated_columns<TypeParam>(1000, 10, 1000, 10);
+  auto [left_wrappers, right_wrappers, left_columns, right_columns, left, right] =
+    this->parse_input(ColumnVector<TypeParam>{left_data}, ColumnVector<TypeParam>{right_data});
+  auto const stream = cudf::get_default_stream();
+
+  std::size_t constexpr max_output_rows = 1500;
+  cudf::chunked_conditional_inner_join join(left, right, left_zero_eq_right_zero, max_output_rows);
+  std::vector<cudf::size_type> left_indices;
+  std::vector<cudf::size_type> right_indices;
+  while (join.has_next()) {
+    auto const [chunk_left, chunk_right] = join.next();
+    EXPECT_LE(chunk_left->size(), max_output_rows);
+    auto const h_left  = cudf::detail::make_std_vector_sync(*chunk_left, stream);
+    auto const h_right = cudf::detail::make_std_vector_sync(*chunk_right, stream);
+    left_indices.insert(left_indices.end(), h_left.begin(), h_left.end());
+    right_indices.insert(right_indices.end(), h_right.begin(), h_right.end());
+  }
+  EXPECT_THROW(join.next(), cudf::logic_error);
+
+  auto const mr = rmm::mr::get_current_device_resource();
+  PairJoinReturn const result{std::make_unique<rmm::device_uvector<cudf::size_type>>(
+                                cudf::detail::make_device_uvector_sync(left_indices, stream, mr)),
+                              std::make_unique<rmm::device_uvector<cudf::size_type>>(
+                                cudf::detail::make_device_uvector_sync(right_indices, stream, mr))};
+  this->_compare_to_hash_join(result, this->reference_join(left, right));
+
+  cudf::chunked_conditional_inner_join small_budget(left, right, left_zero_eq_right_zero, 5);
+  EXPECT_THROW(small_budget.next(), std::overflow_error);
+};
+
 /**
  * Tests of conditional left joins.
  */
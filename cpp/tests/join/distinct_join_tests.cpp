@@ -495,3 +495,95 @@ TEST_F(DistinctJoinTest, LeftJoinWithStructsAndNulls)
   this->compare_to_reference(
     build.view(), probe.view(), gather_map, gold.view(), cudf::out_of_bounds_policy::NULLIFY);
 }
+
+TEST_F(DistinctJoinTest, LeftJoinIndices)
+{
+  column_wrapper<int32_t> col0_0({3, 1, 2, 0, 3});
+  column_wrapper<int32_t> col1_0({2, 5, 0, 4, 3});
+  auto const probe = cudf::table_view{{col0_0}};
+  auto const build = cudf::table_view{{col1_0}};
+
+  auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{build, probe};
+  auto const [build_indices, probe_indices] = distinct_join.left_join_indices();
+
+  auto constexpr none = std::numeric_limits<cudf::size_type>::min();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::column_view{cudf::device_span<cudf::size_type const>{*build_indices}},
+    column_wrapper<cudf::size_type>{4, none, 0, 2, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::column_view{cudf::device_span<cudf::size_type const>{*probe_indices}},
+    column_wrapper<cudf::size_type>{0, 1, 2, 3, 4});
+}
+
+TEST_F(DistinctJoinTest, SemiAntiJoinWithNulls)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2}};
+  strcol_wrapper col0_1({"s1", "s1", "", "s4", "s0"}, {1, 1, 0, 1, 1});
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s2", "s1"});
+  auto const probe = cudf::table_view{{col0_0, col0_1}};
+  auto const build = cudf::table_view{{col1_0, col1_1}};
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{
+      build, probe, cudf::nullable_join::YES, compare_nulls};
+
+    auto const semi = distinct_join.left_semi_join();
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view{cudf::device_span<cudf::size_type const>{*semi}},
+      column_wrapper<cudf::size_type>{0, 4});
+    auto const anti = distinct_join.left_anti_join();
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view{cudf::device_span<cudf::size_type const>{*anti}},
+      column_wrapper<cudf::size_type>{1, 2, 3});
+  }
+}
+
+TEST_F(DistinctJoinTest, EmptyBuildTableSemiAntiJoin)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2}};
+  column_wrapper<int32_t> col1_0{};
+  auto const probe = cudf::table_view{{col0_0}};
+  auto const build = cudf::table_view{{col1_0}};
+
+  auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{build, probe};
+  EXPECT_EQ(distinct_join.left_semi_join()->size(), 0);
+  auto const anti = distinct_join.left_anti_join();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<cudf::size_type const>{*anti}},
+                                 column_wrapper<cudf::size_type>{0, 1, 2});
+}
+
+TEST_F(DistinctJoinTest, FloatingPointKeysLeftJoinIndices)
+{
+  // Rows compare equal across signed zeros and NaNs, so their 64-bit hashes must agree too
+  auto constexpr nan = std::numeric_limits<double>::quiet_NaN();
+  column_wrapper<double> col0_0({0.0, -nan, 1.5, 2.5, -0.0});
+  column_wrapper<double> col1_0({nan, -0.0, 2.5, 3.5});
+  auto const probe = cudf::table_view{{col0_0}};
+  auto const build = cudf::table_view{{col1_0}};
+
+  auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{build, probe};
+  auto const [build_indices, probe_indices] = distinct_join.left_join_indices();
+
+  auto constexpr none = std::numeric_limits<cudf::size_type>::min();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::column_view{cudf::device_span<cudf::size_type const>{*build_indices}},
+    column_wrapper<cudf::size_type>{1, 0, none, 2, 1});
+}
+
+TEST_F(DistinctJoinTest, ListKeysLeftJoinIndices)
+{
+  using lcw = cudf::test::lists_column_wrapper<int32_t>;
+  lcw col0_0{{3}, {1, 2, 3}, {2, 1}, lcw{}, {1, 2}};
+  lcw col1_0{{1, 2}, {3}, lcw{}, {1, 2, 3}};
+  auto const probe = cudf::table_view{{col0_0}};
+  auto const build = cudf::table_view{{col1_0}};
+
+  auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::YES>{build, probe};
+  auto const [build_indices, probe_indices] = distinct_join.left_join_indices();
+
+  auto constexpr none = std::numeric_limits<cudf::size_type>::min();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::column_view{cudf::device_span<cudf::size_type const>{*build_indices}},
+    column_wrapper<cudf::size_type>{1, 3, none, 2, 0});
+}
@@ -26,6 +26,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/structs/utilities.hpp>
 #include <cudf/dictionary/encode.hpp>
@@ -39,6 +40,7 @@
 #include <cudf/utilities/error.hpp>
 
 #include <limits>
+#include <stdexcept>
 
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
@@ -124,6 +126,31 @@ std::unique_ptr<cudf::table> full_join(
     full_input, right_input, full_on, right_on, compare_nulls);
 }
 
+// Small enough for the partitioned joins to partition the test tables several times
+constexpr std::size_t partitioned_join_budget = 256;
+
+std::pair<std::unique_ptr<rmm::device_uvector<cudf::size_type>>,
+          std::unique_ptr<rmm::device_uvector<cudf::size_type>>>
+small_budget_inner_join(cudf::table_view const& left_keys,
+                        cudf::table_view const& right_keys,
+                        cudf::null_equality compare_nulls,
+                        rmm::mr::device_memory_resource* mr)
+{
+  return cudf::partitioned_inner_join(
+    left_keys, right_keys, partitioned_join_budget, compare_nulls, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<cudf::size_type>>,
+          std::unique_ptr<rmm::device_uvector<cudf::size_type>>>
+small_budget_left_join(cudf::table_view const& left_keys,
+                       cudf::table_view const& right_keys,
+                       cudf::null_equality compare_nulls,
+                       rmm::mr::device_memory_resource* mr)
+{
+  return cudf::partitioned_left_join(
+    left_keys, right_keys, partitioned_join_budget, compare_nulls, mr);
+}
+
 struct JoinTest : public cudf::test::BaseFixture {
   std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::table>> gather_maps_as_tables(
     cudf::column_view const& expected_left_map,
@@ -940,6 +967,385 @@ TEST_F(JoinTest, InnerJoinOnNulls)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
 
+std::pair<Table, Table> partitioned_join_tables(cudf::size_type left_num_rows,
+                                                cudf::size_type right_num_rows,
+                                                cudf::size_type num_keys)
+{
+  auto const keys = [num_keys](auto i) { return static_cast<int32_t>(i % num_keys); };
+  auto const names = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "s" + std::to_string(i % 3); });
+  auto const valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  auto const make_table = [&](cudf::size_type num_rows, int offset) {
+    auto const key_it = cudf::detail::make_counting_transform_iterator(offset, keys);
+    column_wrapper<int32_t> col0(key_it, key_it + num_rows, valid + offset);
+    strcol_wrapper col1(names + offset, names + offset + num_rows);
+    column_wrapper<int32_t> col2(key_it, key_it + num_rows);
+    CVector cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    cols.push_back(col2.release());
+    return Table(std::move(cols));
+  };
+  return {make_table(left_num_rows, 0), make_table(right_num_rows, 5)};
+}
+
+TEST_F(JoinTest, PartitionedInnerJoin)
+{
+  auto const [t0, t1] = partitioned_join_tables(500, 300, 37);
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    auto const expected = inner_join(t0, t1, {0, 1}, {0, 1}, compare_nulls);
+    auto const result =
+      join_and_gather<small_budget_inner_join>(t0, t1, {0, 1}, {0, 1}, compare_nulls);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::sort(expected->view()), *cudf::sort(result->view()));
+  }
+}
+
+TEST_F(JoinTest, PartitionedLeftJoin)
+{
+  auto const [t0, t1] = partitioned_join_tables(300, 500, 37);
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    auto const expected = left_join(t0, t1, {0, 1}, {0, 1}, compare_nulls);
+    auto const result =
+      join_and_gather<small_budget_left_join, cudf::out_of_bounds_policy::NULLIFY>(
+        t0, t1, {0, 1}, {0, 1}, compare_nulls);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::sort(expected->view()), *cudf::sort(result->view()));
+  }
+}
+
+TEST_F(JoinTest, PartitionedInnerJoinSkewedKeys)
+{
+  // a single key cannot be split into smaller partitions
+  auto const [t0, t1] = partitioned_join_tables(200, 50, 1);
+
+  auto const expected = inner_join(t0, t1, {2}, {2});
+  auto const result =
+    join_and_gather<small_budget_inner_join>(t0, t1, {2}, {2}, cudf::null_equality::EQUAL);
+  EXPECT_EQ(result->num_rows(), 200 * 50);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::sort(expected->view()), *cudf::sort(result->view()));
+}
+
+TEST_F(JoinTest, PartitionedJoinZeroBudget)
+{
+  auto const [t0, t1] = partitioned_join_tables(10, 10, 3);
+
+  EXPECT_THROW(cudf::partitioned_inner_join(t0.view(), t1.view(), 0), cudf::logic_error);
+}
+
+TEST_F(JoinTest, SortedInnerJoin)
+{
+  column_wrapper<int32_t> col0{{0, 1, 1, 2}};
+  column_wrapper<int32_t> col1{{1, 1, 2, 3}};
+
+  auto const [left_indices, right_indices] =
+    cudf::sorted_inner_join(cudf::table_view{{col0}}, cudf::table_view{{col1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*left_indices}},
+                                 column_wrapper<int32_t>{1, 1, 2, 2, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::column_view{cudf::device_span<int32_t const>{*right_indices}},
+    column_wrapper<int32_t>{0, 1, 0, 1, 2});
+}
+
+TEST_F(JoinTest, SortedLeftJoinDescendingNulls)
+{
+  // sorted descending, nulls after the valid keys
+  column_wrapper<int32_t> col0{{5, 3, 3, 1, 0}, {1, 1, 1, 1, 0}};
+  strcol_wrapper col1{"a", "b", "b", "c", "d"};
+  column_wrapper<int32_t> col2{{3, 1, 1, 0, 0}, {1, 1, 1, 0, 0}};
+  strcol_wrapper col3{"b", "c", "c", "d", "d"};
+  auto const left  = cudf::table_view{{col0, col1}};
+  auto const right = cudf::table_view{{col2, col3}};
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER,
+                                                      cudf::null_order::AFTER};
+
+  auto constexpr none = std::numeric_limits<cudf::size_type>::min();
+  {
+    auto const [left_indices, right_indices] =
+      cudf::sorted_left_join(left, right, column_order, null_precedence);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view{cudf::device_span<int32_t const>{*left_indices}},
+      column_wrapper<int32_t>{0, 1, 2, 3, 3, 4, 4});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view{cudf::device_span<int32_t const>{*right_indices}},
+      column_wrapper<int32_t>{none, 0, 0, 1, 2, 3, 4});
+  }
+  {
+    auto const [left_indices, right_indices] = cudf::sorted_left_join(
+      left, right, column_order, null_precedence, cudf::null_equality::UNEQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view{cudf::device_span<int32_t const>{*left_indices}},
+      column_wrapper<int32_t>{0, 1, 2, 3, 3, 4});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view{cudf::device_span<int32_t const>{*right_indices}},
+      column_wrapper<int32_t>{none, 0, 0, 1, 2, none});
+  }
+}
+
+TEST_F(JoinTest, SortedJoinMatchesHashJoin)
+{
+  auto const [t0, t1] = partitioned_join_tables(500, 300, 37);
+  auto const sorted0  = cudf::sort(t0.select({0, 1}));
+  auto const sorted1  = cudf::sort(t1.select({0, 1}));
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    auto const expected = inner_join(*sorted0, *sorted1, {0, 1}, {0, 1}, compare_nulls);
+    auto const [left_indices, right_indices] =
+      cudf::sorted_inner_join(*sorted0, *sorted1, {}, {}, compare_nulls);
+    auto const result = cudf::gather(*sorted0, cudf::device_span<int32_t const>{*left_indices});
+    EXPECT_EQ(result->num_rows(), expected->num_rows());
+    // the joined rows keep the sort order of the inputs
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result, *cudf::sort(result->view()));
+  }
+}
+
+TEST_F(JoinTest, SortedJoinEmptyRight)
+{
+  column_wrapper<int32_t> col0{{3, 5}};
+  column_wrapper<int32_t> col1{};
+
+  auto const [inner_left, inner_right] =
+    cudf::sorted_inner_join(cudf::table_view{{col0}}, cudf::table_view{{col1}});
+  EXPECT_EQ(inner_left->size(), 0);
+  auto const [left_indices, right_indices] =
+    cudf::sorted_left_join(cudf::table_view{{col0}}, cudf::table_view{{col1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*left_indices}},
+                                 column_wrapper<int32_t>{0, 1});
+  EXPECT_THROW(cudf::sorted_inner_join(cudf::table_view{{col0}}, cudf::table_view{{col1, col1}}),
+               cudf::logic_error);
+}
+
+TEST_F(JoinTest, AsofJoin)
+{
+  strcol_wrapper left_keys{"a", "a", "b", "c"};
+  column_wrapper<int32_t> left_on{2, 5, 4, 1};
+  strcol_wrapper right_keys{"a", "a", "b"};
+  column_wrapper<int32_t> right_on{1, 4, 6};
+  auto const left  = cudf::table_view{{left_keys}};
+  auto const right = cudf::table_view{{right_keys}};
+
+  auto constexpr none = std::numeric_limits<cudf::size_type>::min();
+  auto const backward = cudf::asof_join(left, right, left_on, right_on);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*backward}},
+                                 column_wrapper<int32_t>{0, 1, none, none});
+  auto const forward =
+    cudf::asof_join(left, right, left_on, right_on, cudf::asof_direction::FORWARD);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*forward}},
+                                 column_wrapper<int32_t>{1, none, 2, none});
+  auto const nearest =
+    cudf::asof_join(left, right, left_on, right_on, cudf::asof_direction::NEAREST);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*nearest}},
+                                 column_wrapper<int32_t>{0, 1, 2, none});
+
+  auto const tolerance = cudf::numeric_scalar<int32_t>(1);
+  auto const within    = cudf::asof_join(
+    left, right, left_on, right_on, cudf::asof_direction::NEAREST, std::cref(tolerance));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*within}},
+                                 column_wrapper<int32_t>{0, 1, none, none});
+}
+
+TEST_F(JoinTest, AsofJoinTimestampsWithoutKeys)
+{
+  using cudf::test::iterators::null_at;
+  using ts = cudf::timestamp_s;
+  cudf::test::fixed_width_column_wrapper<ts, ts::rep> left_on({5, 10, 20, 3, 7}, null_at(4));
+  cudf::test::fixed_width_column_wrapper<ts, ts::rep> right_on({0, 4, 10, 10, 12}, null_at(0));
+  auto const no_keys = cudf::table_view{};
+
+  auto constexpr none = std::numeric_limits<cudf::size_type>::min();
+  auto const backward = cudf::asof_join(no_keys, no_keys, left_on, right_on);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*backward}},
+                                 column_wrapper<int32_t>{1, 3, 4, none, none});
+  auto const forward =
+    cudf::asof_join(no_keys, no_keys, left_on, right_on, cudf::asof_direction::FORWARD);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*forward}},
+                                 column_wrapper<int32_t>{2, 2, none, 1, none});
+
+  auto const tolerance = cudf::duration_scalar<cudf::duration_s>(cudf::duration_s{2}, true);
+  auto const nearest   = cudf::asof_join(
+    no_keys, no_keys, left_on, right_on, cudf::asof_direction::NEAREST, std::cref(tolerance));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*nearest}},
+                                 column_wrapper<int32_t>{1, 3, none, 1, none});
+}
+
+TEST_F(JoinTest, ToleranceInnerJoin)
+{
+  auto constexpr nan = std::numeric_limits<double>::quiet_NaN();
+  strcol_wrapper left_keys{"a", "a", "b", "a", "b"};
+  column_wrapper<double> left_on{{1.0, 2.05, 3.0, nan, 3.0}, {1, 1, 1, 1, 0}};
+  strcol_wrapper right_keys{"a", "b", "a", "a", "b"};
+  column_wrapper<double> right_on{1.04, 3.01, 2.1, 0.95, nan};
+  auto const left  = cudf::table_view{{left_keys}};
+  auto const right = cudf::table_view{{right_keys}};
+
+  // 0.95 and 1.0 are in adjacent buckets of the tolerance
+  auto const [left_indices, right_indices] =
+    cudf::tolerance_inner_join(left, right, left_on, right_on, 0.1);
+  auto const result = cudf::sort(
+    cudf::table_view{{cudf::column_view{cudf::device_span<int32_t const>{*left_indices}},
+                      cudf::column_view{cudf::device_span<int32_t const>{*right_indices}}}});
+  column_wrapper<int32_t> expected_left{0, 0, 1, 2};
+  column_wrapper<int32_t> expected_right{0, 3, 2, 1};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result, cudf::table_view({expected_left, expected_right}));
+
+  column_wrapper<float> float_on{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+  column_wrapper<int32_t> int_on{1, 2, 3, 4, 5};
+  EXPECT_THROW(cudf::tolerance_inner_join(left, right, left_on, float_on, 0.1),
+               cudf::data_type_error);
+  EXPECT_THROW(cudf::tolerance_inner_join(left, right, int_on, int_on, 1.0),
+               cudf::data_type_error);
+  EXPECT_THROW(cudf::tolerance_inner_join(left, right, left_on, right_on, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::tolerance_inner_join(
+                 left, cudf::table_view{{right_keys, right_keys}}, left_on, right_on, 0.1),
+               cudf::logic_error);
+}
+
+TEST_F(JoinTest, AsofJoinNullKeys)
+{
+  using cudf::test::iterators::null_at;
+  column_wrapper<int32_t> left_keys({1, 2, 2}, null_at(1));
+  column_wrapper<int32_t> left_on{5, 5, 5};
+  column_wrapper<int32_t> right_keys({0, 1, 2}, null_at(0));
+  column_wrapper<int32_t> right_on{1, 2, 3};
+  auto const left  = cudf::table_view{{left_keys}};
+  auto const right = cudf::table_view{{right_keys}};
+
+  auto constexpr none = std::numeric_limits<cudf::size_type>::min();
+  auto const equal    = cudf::asof_join(left, right, left_on, right_on);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*equal}},
+                                 column_wrapper<int32_t>{1, 0, 2});
+  auto const unequal = cudf::asof_join(left,
+                                       right,
+                                       left_on,
+                                       right_on,
+                                       cudf::asof_direction::BACKWARD,
+                                       std::nullopt,
+                                       cudf::null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::column_view{cudf::device_span<int32_t const>{*unequal}},
+                                 column_wrapper<int32_t>{1, none, 2});
+}
+
+TEST_F(JoinTest, AsofJoinInvalidArguments)
+{
+  column_wrapper<int32_t> int_on{1, 2};
+  column_wrapper<int64_t> long_on{1, 2};
+  strcol_wrapper str_on{"a", "b"};
+  auto const no_keys = cudf::table_view{};
+
+  EXPECT_THROW(cudf::asof_join(no_keys, no_keys, int_on, long_on), cudf::logic_error);
+  EXPECT_THROW(cudf::asof_join(no_keys, no_keys, str_on, str_on), cudf::logic_error);
+  EXPECT_THROW(cudf::asof_join(cudf::table_view{{int_on}}, no_keys, int_on, int_on),
+               cudf::logic_error);
+
+  auto const long_tolerance = cudf::numeric_scalar<int64_t>(1);
+  EXPECT_THROW(cudf::asof_join(no_keys,
+                               no_keys,
+                               int_on,
+                               int_on,
+                               cudf::asof_direction::NEAREST,
+                               std::cref(long_tolerance)),
+               cudf::logic_error);
+  auto const negative_tolerance = cudf::numeric_scalar<int32_t>(-1);
+  EXPECT_THROW(cudf::asof_join(no_keys,
+                               no_keys,
+                               int_on,
+                               int_on,
+                               cudf::asof_direction::NEAREST,
+                               std::cref(negative_tolerance)),
+               cudf::logic_error);
+}
+
+TEST_F(JoinTest, BloomFilterContainsBuildKeys)
+{
+  auto const build_keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i * 2;
+  });
+  column_wrapper<int32_t> build_col(build_keys, build_keys + 1000);
+  strcol_wrapper build_str_col(
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); }),
+    cudf::detail::make_counting_transform_iterator(1000, [](auto i) { return std::to_string(i); }));
+  auto const build = cudf::table_view{{build_col, build_str_col}};
+
+  auto const filter = cudf::join_bloom_filter(build);
+  auto const result = filter.contains(build);
+  auto const expected = cudf::make_column_from_scalar(cudf::numeric_scalar<bool>(true), 1000);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+
+  // Few of the keys missing from the build table pass the filter
+  auto const probe_keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i * 2 + 1;
+  });
+  column_wrapper<int32_t> probe_col(probe_keys, probe_keys + 1000);
+  auto const probe    = cudf::table_view{{probe_col, build_str_col}};
+  auto const filtered = cudf::filter_by_bloom(probe, probe, filter);
+  EXPECT_LT(filtered->num_rows(), 100);
+}
+
+TEST_F(JoinTest, BloomFilterKeepsJoinMatches)
+{
+  column_wrapper<int32_t> build_col{{3, 1, 2, 0, 2}, {1, 1, 1, 0, 1}};
+  column_wrapper<int32_t> probe_col{{1, 2, 0, 10, 3, 2}, {1, 1, 0, 1, 1, 1}};
+  strcol_wrapper probe_payload{"a", "b", "c", "d", "e", "f"};
+  auto const build = cudf::table_view{{build_col}};
+  auto const probe = cudf::table_view{{probe_col}};
+
+  // Every row of the probe table with a join match passes the filter
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    auto const filter   = cudf::join_bloom_filter(build, 0.001, compare_nulls);
+    auto const filtered =
+      cudf::filter_by_bloom(cudf::table_view{{probe_col, probe_payload}}, probe, filter);
+    auto const expected_matches = cudf::left_semi_join(probe, build, compare_nulls);
+    auto const filtered_matches =
+      cudf::left_semi_join(cudf::table_view{{filtered->get_column(0)}}, build, compare_nulls);
+    EXPECT_EQ(expected_matches->size(), filtered_matches->size());
+  }
+
+  // Null keys never match when nulls are unequal
+  auto const filter = cudf::join_bloom_filter(build, 0.01, cudf::null_equality::UNEQUAL);
+  column_wrapper<int32_t> null_col{{0, 0}, {0, 0}};
+  auto const result = filter.contains(cudf::table_view{{null_col}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, column_wrapper<bool>{false, false});
+}
+
+TEST_F(JoinTest, BloomFilterKeyRange)
+{
+  column_wrapper<int32_t> col0{{3, 7, -2, 0, 5}, {1, 1, 1, 0, 1}};
+  column_wrapper<int32_t> col1{{1, 2, 3, 4, 5}};
+
+  auto const filter =
+    cudf::join_bloom_filter(cudf::table_view{{col0}}, 0.01, cudf::null_equality::UNEQUAL);
+  ASSERT_NE(filter.min_key(), nullptr);
+  ASSERT_NE(filter.max_key(), nullptr);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t> const*>(filter.min_key())->value(), -2);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t> const*>(filter.max_key())->value(), 7);
+
+  // A null key may match a null probe key, out of the range of the valid keys
+  auto const null_filter = cudf::join_bloom_filter(cudf::table_view{{col0}});
+  EXPECT_EQ(null_filter.min_key(), nullptr);
+
+  // The range is only kept for a single key column
+  auto const multi_filter = cudf::join_bloom_filter(cudf::table_view{{col0, col1}});
+  EXPECT_EQ(multi_filter.min_key(), nullptr);
+  EXPECT_EQ(multi_filter.max_key(), nullptr);
+}
+
+TEST_F(JoinTest, BloomFilterInvalidArguments)
+{
+  column_wrapper<int32_t> col0{{3, 1, 2}};
+  column_wrapper<int32_t> col1{{1, 2, 3}};
+  auto const build = cudf::table_view{{col0}};
+
+  EXPECT_THROW(cudf::join_bloom_filter(build, 0.0), cudf::logic_error);
+  EXPECT_THROW(cudf::join_bloom_filter(build, 1.0), cudf::logic_error);
+  EXPECT_THROW(cudf::join_bloom_filter(cudf::table_view{}), cudf::logic_error);
+
+  auto const filter = cudf::join_bloom_filter(build);
+  EXPECT_THROW(filter.contains(cudf::table_view{{col0, col1}}), cudf::logic_error);
+}
+
 // Empty Left Table
 TEST_F(JoinTest, EmptyLeftTableInnerJoin)
 {
@@ -1594,6 +2000,144 @@ TEST_F(JoinTest, HashJoinLargeOutputSize)
   EXPECT_EQ(col_size * col_size, output_size);
 }
 
+TEST_F(JoinTest, HashJoinSkewedBuildKeys)
+{
+  // key 7 is a heavy hitter of the build table, matched apart from the hash table
+  auto const build_keys =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i < 3000 ? 7 : i; });
+  column_wrapper<int32_t> build_col(build_keys, build_keys + 4000);
+  column_wrapper<int32_t> probe_col{{7, 3500, 7, 10, 3999, 7, 12},
+                                    {true, true, true, true, true, true, false}};
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    cudf::hash_join hash_join(build, cudf::nullable_join::YES, compare_nulls);
+    EXPECT_EQ(hash_join.inner_join_size(probe), 3 * 3000 + 2);
+    EXPECT_EQ(hash_join.left_join_size(probe), 3 * 3000 + 4);
+    EXPECT_EQ(hash_join.full_join_size(probe), 3 * 3000 + 4 + (4000 - 3000 - 2));
+
+    auto const [left_indices, right_indices] = hash_join.inner_join(probe);
+    EXPECT_EQ(left_indices->size(), 3 * 3000 + 2);
+    auto const left_keys =
+      cudf::gather(probe, cudf::device_span<int32_t const>{*left_indices})->get_column(0);
+    auto const right_keys =
+      cudf::gather(build, cudf::device_span<int32_t const>{*right_indices})->get_column(0);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(left_keys, right_keys);
+
+    auto const [full_left, full_right] = hash_join.full_join(probe);
+    EXPECT_EQ(full_left->size(), hash_join.full_join_size(probe));
+  }
+}
+
+TEST_F(JoinTest, HashJoinPackUnpack)
+{
+  // key 3 is a heavy hitter, so the packed hash join holds both of its parts
+  auto const build_keys =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i < 2000 ? 3 : i; });
+  column_wrapper<int32_t> build_col(build_keys, build_keys + 2500);
+  column_wrapper<int32_t> probe_col{{3, 2100, 5, 2499, 3}, {true, true, true, true, false}};
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+
+  cudf::hash_join hash_join(build, cudf::null_equality::UNEQUAL);
+  auto const packed = hash_join.pack();
+  cudf::hash_join unpacked(build, packed);
+
+  EXPECT_EQ(unpacked.inner_join_size(probe), hash_join.inner_join_size(probe));
+  EXPECT_EQ(unpacked.full_join_size(probe), hash_join.full_join_size(probe));
+  auto const [expected_left, expected_right] = hash_join.left_join(probe);
+  auto const [left_indices, right_indices]   = unpacked.left_join(probe);
+  auto const expected = cudf::sort(cudf::table_view{
+    {cudf::column_view{cudf::device_span<int32_t const>{*expected_left}},
+     cudf::column_view{cudf::device_span<int32_t const>{*expected_right}}}});
+  auto const result   = cudf::sort(
+    cudf::table_view{{cudf::column_view{cudf::device_span<int32_t const>{*left_indices}},
+                      cudf::column_view{cudf::device_span<int32_t const>{*right_indices}}}});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+
+  column_wrapper<int64_t> other_type_col(build_keys, build_keys + 2500);
+  EXPECT_THROW(cudf::hash_join(cudf::table_view{{other_type_col}}, packed), cudf::logic_error);
+  EXPECT_THROW(cudf::hash_join(probe, packed), cudf::logic_error);
+  EXPECT_THROW(cudf::hash_join(build, cudf::packed_hash_join{}), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinEstimateInnerJoinSize)
+{
+  // a probe row of key k in [1, 3] matches k build rows, the other keys have no match
+  column_wrapper<int32_t> build_col{1, 2, 2, 3, 3, 3};
+  auto const probe_keys =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<int32_t> probe_col(probe_keys, probe_keys + 100'000);
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+
+  auto const exact = hash_join.inner_join_size(probe);
+  // the sample rows are spread evenly, so they see each key as often as the whole table
+  auto const estimate = hash_join.estimate_inner_join_size(probe, 1000);
+  EXPECT_LE(estimate.lower_bound, exact);
+  EXPECT_GE(estimate.upper_bound, exact);
+  EXPECT_NEAR(static_cast<double>(estimate.estimate), static_cast<double>(exact), 0.05 * exact);
+
+  auto const full_sample = hash_join.estimate_inner_join_size(probe, probe.num_rows());
+  EXPECT_EQ(full_sample.estimate, exact);
+  EXPECT_EQ(full_sample.lower_bound, exact);
+  EXPECT_EQ(full_sample.upper_bound, exact);
+  EXPECT_THROW((void)hash_join.estimate_inner_join_size(probe, 0), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinEstimateMemory)
+{
+  column_wrapper<int32_t> build_col{1, 2, 2, 3, 3, 3};
+  cudf::table_view build{{build_col}};
+
+  auto const without_output = cudf::hash_join::estimate_memory(build);
+  EXPECT_GE(without_output.output_bytes, build.num_rows() * sizeof(int64_t));
+  // a small non-nullable build table needs neither a row bitmask nor heavy-hitter detection
+  EXPECT_EQ(without_output.temporary_bytes, 0);
+
+  auto const with_output = cudf::hash_join::estimate_memory(build, 100);
+  EXPECT_EQ(with_output.output_bytes - without_output.output_bytes, 2 * 100 * sizeof(int32_t));
+  EXPECT_EQ(with_output.total(), with_output.temporary_bytes + with_output.output_bytes);
+}
+
+TEST_F(JoinTest, ChunkedInnerJoin)
+{
+  // every probe row of key k matches k build rows
+  auto const build_keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    auto k = 1;
+    while (i >= k) {
+      i -= k++;
+    }
+    return k;
+  });
+  column_wrapper<int32_t> build_col(build_keys, build_keys + 55);  // keys 1 to 10
+  column_wrapper<int32_t> probe_col{1, 10, 3, 7, 7, 0, 2, 9, 10, 5};
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+
+  std::size_t constexpr max_output_rows = 16;
+  cudf::chunked_inner_join join(hash_join, probe, max_output_rows);
+  std::size_t num_output_rows = 0;
+  while (join.has_next()) {
+    auto const [left_indices, right_indices] = join.next();
+    EXPECT_LE(left_indices->size(), max_output_rows);
+    auto const left  = cudf::gather(probe, cudf::device_span<int32_t const>{*left_indices});
+    auto const right = cudf::gather(build, cudf::device_span<int32_t const>{*right_indices});
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*left, *right);
+    num_output_rows += left_indices->size();
+  }
+  EXPECT_EQ(num_output_rows, hash_join.inner_join_size(probe));
+  EXPECT_THROW(join.next(), cudf::logic_error);
+
+  cudf::chunked_inner_join small_budget(hash_join, probe, 5);
+  EXPECT_NO_THROW(small_budget.next());
+  EXPECT_THROW(small_budget.next(), std::overflow_error);
+  EXPECT_THROW(cudf::chunked_inner_join(hash_join, probe, 0), cudf::logic_error);
+}
+
 struct JoinDictionaryTest : public cudf::test::BaseFixture {};
 
 TEST_F(JoinDictionaryTest, LeftJoinNoNulls)
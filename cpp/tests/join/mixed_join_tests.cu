@@ -477,6 +477,58 @@ TYPED_TEST(MixedInnerJoinTest, BasicInequality)
              {{3, 3}});
 }
 
+struct MixedHashJoinTest : public cudf::test::BaseFixture {};
+
+TEST_F(MixedHashJoinTest, ReuseAcrossProbes)
+{
+  using column_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using index_pairs    = std::vector<std::pair<cudf::size_type, cudf::size_type>>;
+
+  auto const sorted_pairs = [](auto const& result) {
+    index_pairs pairs;
+    for (std::size_t i = 0; i < result.first->size(); ++i) {
+      pairs.emplace_back(result.first->element(i, cudf::get_default_stream()),
+                         result.second->element(i, cudf::get_default_stream()));
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  };
+
+  column_wrapper right_eq{0, 1, 3, 1};
+  column_wrapper right_cond{5, 4, 5, 7};
+  auto const predicate =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+  cudf::mixed_hash_join const right(cudf::table_view{{right_eq}}, cudf::table_view{{right_cond}});
+
+  // the left tables are probed even when they are smaller than the right ones
+  column_wrapper left_eq{1, 3, 2};
+  column_wrapper left_cond{5, 6, 1};
+  cudf::table_view const left_equality{{left_eq}};
+  cudf::table_view const left_conditional{{left_cond}};
+  auto const [size, counts] = right.inner_join_size(left_equality, left_conditional, predicate);
+  EXPECT_EQ(size, std::size_t{2});
+  auto const counts_view = cudf::column_view(
+    cudf::data_type{cudf::type_id::INT32}, counts->size(), counts->data(), nullptr, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper{1, 1, 0}, counts_view);
+  auto const output_size_data =
+    std::pair{size, cudf::device_span<cudf::size_type const>{counts->data(), counts->size()}};
+  EXPECT_EQ(
+    sorted_pairs(right.inner_join(left_equality, left_conditional, predicate, output_size_data)),
+    (index_pairs{{0, 1}, {1, 2}}));
+  EXPECT_EQ(sorted_pairs(right.left_join(left_equality, left_conditional, predicate)),
+            (index_pairs{{0, 1}, {1, 2}, {2, JoinNoneValue}}));
+  EXPECT_EQ(
+    sorted_pairs(right.full_join(left_equality, left_conditional, predicate)),
+    (index_pairs{{JoinNoneValue, 0}, {JoinNoneValue, 3}, {0, 1}, {1, 2}, {2, JoinNoneValue}}));
+
+  column_wrapper other_left_eq{0, 0};
+  column_wrapper other_left_cond{9, 5};
+  EXPECT_EQ(sorted_pairs(right.inner_join(cudf::table_view{{other_left_eq}},
+                                          cudf::table_view{{other_left_cond}},
+                                          predicate)),
+            (index_pairs{{0, 0}}));
+}
+
 /**
  * Tests of mixed left joins.
  */
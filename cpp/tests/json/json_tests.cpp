@@ -24,6 +24,8 @@
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 // reference:  https://jsonpath.herokuapp.com/
 
@@ -1056,4 +1058,48 @@ TEST_F(JsonPathTests, QueriesContainingQuotes)
   do_test(R"($.'A)", R"({"B'": 3})");
 }
 
+TEST_F(JsonPathTests, MultiplePaths)
+{
+  auto const input = cudf::test::strings_column_wrapper{
+    {R"({"a": 1, "b": [10, 20], "c": {"d": "x"}})", R"({"a": [1, 2], "c": {"d": null}})", "", "{}"},
+    {true, true, false, true}};
+  std::vector<cudf::string_scalar> json_paths;
+  for (auto const path : {"$.a", "$.b[1]", "", "$.c.d", "$.b[*]"}) {
+    json_paths.emplace_back(std::string{path});
+  }
+
+  auto const results = cudf::get_json_objects(cudf::strings_column_view(input), json_paths);
+  ASSERT_EQ(results.size(), json_paths.size());
+  // each result matches the one of the path on its own
+  for (std::size_t idx = 0; idx < json_paths.size(); ++idx) {
+    auto const expected = cudf::get_json_object(cudf::strings_column_view(input), json_paths[idx]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[idx], *expected);
+  }
+}
+
+TEST_F(JsonPathTests, LongRows)
+{
+  // rows long enough to be processed a warp at a time, with brackets, quotes and escapes inside
+  // strings that must not be mistaken for structure
+  std::string padding;
+  for (int i = 0; i < 200; ++i) {
+    padding += R"(ab[{\"}] )";
+  }
+  auto const long_row = R"({"pad": ")" + padding + R"(", "arr": [1, {"x": "]"}, [3, 4]], )" +
+                        R"("a": {"pad": [")" + padding + R"("], "b": "v"}})";
+  auto const input = cudf::test::strings_column_wrapper{long_row, R"({"a": {"b": "w"}})"};
+
+  std::vector<cudf::string_scalar> json_paths;
+  for (auto const path : {"$.a.b", "$.arr[1].x", "$.arr[2]"}) {
+    json_paths.emplace_back(std::string{path});
+  }
+  auto const results = cudf::get_json_objects(cudf::strings_column_view(input), json_paths);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[0], cudf::test::strings_column_wrapper{"v", "w"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[1],
+                                      cudf::test::strings_column_wrapper{{"]", ""}, {true, false}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *results[2], cudf::test::strings_column_wrapper{{"[3, 4]", ""}, {true, false}});
+}
+
 CUDF_TEST_PROGRAM_MAIN()
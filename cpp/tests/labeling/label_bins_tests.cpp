@@ -433,6 +433,79 @@ TEST(TestStringData, SlicedNonAsciiStringTest)
   }
 }
 
+/*
+ * Test uniform bins.
+ */
+
+template <typename T>
+struct UniformBinTestFixture : public BinTestFixture {};
+
+TYPED_TEST_SUITE(UniformBinTestFixture, NumericTypesNotBool);
+
+// Ten bins of width 10, the last one including its right edge.
+TYPED_TEST(UniformBinTestFixture, TestUniformBins)
+{
+  std::vector<TypeParam> values(101);
+  std::iota(values.begin(), values.end(), 0);
+  std::vector<cudf::size_type> labels(values.size());
+  std::transform(values.begin(), values.end(), labels.begin(), [](auto v) {
+    return std::min(static_cast<cudf::size_type>(v / 10), 9);
+  });
+  fwc_wrapper<TypeParam> input(values.begin(), values.end());
+
+  auto const result = cudf::label_bins_uniform(input, 0, 100, 10);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fwc_wrapper<cudf::size_type>(labels.begin(), labels.end()),
+                                 result->view());
+
+  auto const counts = cudf::histogram_uniform(input, 0, 100, 10);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fwc_wrapper<int64_t>{10, 10, 10, 10, 10, 10, 10, 10, 10, 11},
+                                 counts->view());
+}
+
+TEST(UniformBinTest, TestNullsNaNAndOutOfRange)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  fwc_wrapper<double> input{{-1.0, 0.0, 0.5, nan, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5},
+                            {1, 1, 1, 1, 0, 1, 1, 1, 1, 1}};
+
+  auto const result = cudf::label_bins_uniform(input, 0, 3, 3);
+  fwc_wrapper<cudf::size_type> expected{{0, 0, 0, 0, 0, 1, 2, 2, 2, 0},
+                                        {0, 1, 1, 0, 0, 1, 1, 1, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  auto const counts = cudf::histogram_uniform(input, 0, 3, 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fwc_wrapper<int64_t>{2, 1, 3}, counts->view());
+}
+
+// More bins than the per-block counts held in shared memory.
+TEST(UniformBinTest, TestManyBins)
+{
+  auto const num_bins = 20000;
+  std::vector<int32_t> values(2 * num_bins);
+  std::iota(values.begin(), values.end(), 0);
+  fwc_wrapper<int32_t> input(values.begin(), values.end());
+
+  auto const counts = cudf::histogram_uniform(input, 0, 2 * num_bins, num_bins);
+  std::vector<int64_t> const expected(num_bins, 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fwc_wrapper<int64_t>(expected.begin(), expected.end()),
+                                 counts->view());
+}
+
+TEST(UniformBinTest, TestEmptyAndInvalid)
+{
+  fwc_wrapper<float> empty{};
+  EXPECT_EQ(0, cudf::label_bins_uniform(empty, 0, 1, 4)->size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fwc_wrapper<int64_t>{0, 0, 0, 0},
+                                 cudf::histogram_uniform(empty, 0, 1, 4)->view());
+
+  fwc_wrapper<float> input{0.5};
+  EXPECT_THROW(cudf::label_bins_uniform(input, 0, 1, 0), std::invalid_argument);
+  EXPECT_THROW(cudf::label_bins_uniform(input, 1, 1, 4), std::invalid_argument);
+  EXPECT_THROW(cudf::histogram_uniform(fwc_wrapper<bool>{true}, 0, 1, 4), cudf::data_type_error);
+  EXPECT_THROW(cudf::histogram_uniform(cudf::test::strings_column_wrapper{"a"}, 0, 1, 4),
+               cudf::data_type_error);
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,8 +21,11 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/lists/set_operations.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 #include <limits>
 #include <string>
 
@@ -78,6 +81,24 @@ TEST_F(ListOverlapTest, TrivialTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *results);
 }
 
+TEST_F(ListOverlapTest, LongAndShortLists)
+{
+  using int32s_lists = cudf::test::lists_column_wrapper<int32_t>;
+
+  // A long list is searched through a hash table, short lists element by element.
+  auto const values = thrust::make_counting_iterator(0);
+  auto const lhs    = int32s_lists{int32s_lists(values, values + 100), {1, 2, 3}, {7}};
+  auto const rhs    = int32s_lists{{200, 99}, {3}, {8}};
+
+  auto const results = cudf::lists::have_overlap(lists_cv{lhs}, lists_cv{rhs});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(bools_col{1, 1, 0}, *results);
+
+  auto const short_lhs     = cudf::slice(lhs, {1, 3})[0];
+  auto const short_rhs     = cudf::slice(rhs, {1, 3})[0];
+  auto const short_results = cudf::lists::have_overlap(lists_cv{short_lhs}, lists_cv{short_rhs});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(bools_col{1, 0}, *short_results);
+}
+
 TEST_F(ListOverlapTest, FloatingPointTestsWithSignedZero)
 {
   // -0.0 and 0.0 should be considered equal.
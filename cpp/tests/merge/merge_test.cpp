@@ -25,6 +25,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/merge.hpp>
 #include <cudf/sorting.hpp>
@@ -36,6 +37,8 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 
+#include <memory>
+#include <string>
 #include <vector>
 
 template <typename T>
@@ -988,6 +991,69 @@ TEST_F(MergeTest, NestedListsofStructs)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected_tbl, *result);
 }
 
+TEST_F(MergeTest, ManyTablesStable)
+{
+  // rows of equal keys are merged in the order of the tables
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0{1, 2, 2, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1{2, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys2{0, 2, 9};
+  cudf::test::strings_column_wrapper values0{"a0", "b0", "c0", "d0"};
+  cudf::test::strings_column_wrapper values1{"a1", "b1"};
+  cudf::test::strings_column_wrapper values2{"a2", "b2", "c2"};
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_keys{};
+  cudf::test::strings_column_wrapper empty_values{};
+
+  auto result = cudf::merge({cudf::table_view{{keys0, values0}},
+                             cudf::table_view{{empty_keys, empty_values}},
+                             cudf::table_view{{keys1, values1}},
+                             cudf::table_view{{keys2, values2}}},
+                            {0},
+                            {cudf::order::ASCENDING});
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_keys{0, 1, 2, 2, 2, 2, 5, 5, 9};
+  cudf::test::strings_column_wrapper expected_values{
+    "a2", "a0", "b0", "c0", "a1", "b2", "d0", "b1", "c2"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_keys, expected_values}), *result);
+}
+
+TEST_F(MergeTest, ManyTablesWithNulls)
+{
+  auto constexpr num_tables = 16;
+  auto constexpr num_rows   = 1000;
+
+  auto const key_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto row) { return static_cast<int64_t>((row * 7919) % 701); });
+  auto const str_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto row) { return "s" + std::to_string((row * 31) % 53); });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto row) { return row % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int64_t> keys(
+    key_it, key_it + num_tables * num_rows, valids);
+  cudf::test::strings_column_wrapper strs(str_it, str_it + num_tables * num_rows);
+  auto const row_it = thrust::make_counting_iterator<int32_t>(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> rows(row_it, row_it + num_tables * num_rows);
+  auto const input = cudf::table_view{{keys, strs, rows}};
+
+  std::vector<cudf::size_type> const key_cols{0, 1};
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER,
+                                                      cudf::null_order::AFTER};
+  std::vector<std::unique_ptr<cudf::table>> sorted_tables;
+  std::vector<cudf::table_view> tables;
+  for (int i = 0; i < num_tables; ++i) {
+    auto const table = cudf::slice(input, {i * num_rows, (i + 1) * num_rows}).front();
+    sorted_tables.push_back(
+      cudf::stable_sort_by_key(table, table.select(key_cols), column_order, null_precedence));
+    tables.push_back(sorted_tables.back()->view());
+  }
+
+  // the merge is stable, so the rows of each key are in the order of the input
+  auto const result   = cudf::merge(tables, key_cols, column_order, null_precedence);
+  auto const expected = cudf::stable_sort_by_key(
+    input, input.select(key_cols), column_order, null_precedence);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+}
+
 template <typename T>
 struct FixedPointTestAllReps : public cudf::test::BaseFixture {};
 
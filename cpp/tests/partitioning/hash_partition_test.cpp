@@ -21,6 +21,9 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
@@ -30,6 +33,9 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <map>
+#include <string>
+
 using cudf::test::fixed_width_column_wrapper;
 using cudf::test::strings_column_wrapper;
 using structs_col = cudf::test::structs_column_wrapper;
@@ -234,6 +240,36 @@ TEST_F(HashPartition, CustomSeedValue)
   CUDF_TEST_EXPECT_TABLES_EQUAL(output1->view(), output2->view());
 }
 
+TEST_F(HashPartition, XXHash64)
+{
+  strings_column_wrapper strings({"a", "bb", "a", "ccc", "bb", "d", "a", "ccc", "ee", "d"});
+  auto input = cudf::table_view({strings});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0});
+
+  cudf::size_type const num_partitions = 4;
+  auto [output1, offsets1]             = cudf::hash_partition(
+    input, columns_to_hash, num_partitions, cudf::hash_id::HASH_XXHASH64);
+  auto [output2, offsets2] = cudf::hash_partition(
+    input, columns_to_hash, num_partitions, cudf::hash_id::HASH_XXHASH64);
+
+  EXPECT_EQ(static_cast<size_t>(num_partitions), offsets1.size());
+  EXPECT_EQ(offsets1, offsets2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(output1->view(), output2->view());
+
+  // Equal keys must be assigned to the same partition
+  auto const keys = cudf::test::to_host<std::string>(output1->get_column(0)).first;
+  offsets1.push_back(input.num_rows());
+  std::map<std::string, cudf::size_type> key_partitions;
+  for (cudf::size_type partition = 0; partition < num_partitions; ++partition) {
+    for (auto row = offsets1[partition]; row < offsets1[partition + 1]; ++row) {
+      auto const [it, inserted] = key_partitions.emplace(keys[row], partition);
+      EXPECT_EQ(it->second, partition);
+    }
+  }
+  EXPECT_EQ(key_partitions.size(), std::size_t{5});
+}
+
 template <typename T>
 class HashPartitionFixedWidth : public cudf::test::BaseFixture {};
 
@@ -341,6 +377,13 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls)
   run_fixed_width_test<TypeParam>(10, 1000, 10, cudf::hash_id::HASH_IDENTITY, true);
 }
 
+TYPED_TEST(HashPartitionFixedWidth, ManyPartitions)
+{
+  // above the threshold of the shared memory histograms
+  run_fixed_width_test<TypeParam>(3, 20000, 4096, cudf::hash_id::HASH_MURMUR3);
+  run_fixed_width_test<TypeParam>(3, 20000, 3000, cudf::hash_id::HASH_IDENTITY, true);
+}
+
 TEST_F(HashPartition, FixedPointColumnsToHash)
 {
   fixed_width_column_wrapper<int32_t> to_hash({1});
@@ -434,4 +477,60 @@ TEST_F(HashPartition, StructofStructWithNulls)
                                  second_result->get_column(0).view());
 }
 
+// Expects each packed partition to hold the rows of the same partition of `hash_partition`
+void expect_packed_partitions_equal(cudf::table_view const& input,
+                                    std::vector<cudf::size_type> const& columns_to_hash,
+                                    cudf::size_type num_partitions)
+{
+  auto const [partitioned, offsets] = cudf::hash_partition(input, columns_to_hash, num_partitions);
+  auto const packed = cudf::hash_partition_and_pack(input, columns_to_hash, num_partitions);
+  ASSERT_EQ(static_cast<std::size_t>(num_partitions), packed.size());
+
+  std::vector<cudf::size_type> const splits(offsets.begin() + 1, offsets.end());
+  auto const expected = cudf::split(partitioned->view(), splits);
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::sort(expected[p]), *cudf::sort(packed[p].table));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(packed[p].table, cudf::unpack(packed[p].data));
+  }
+}
+
+TEST_F(HashPartition, PackFixedWidth)
+{
+  auto const size = 1000;
+  auto keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 37; });
+  auto values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  fixed_width_column_wrapper<int32_t> key_col(keys, keys + size, nulls_at({3, 50, 999}));
+  fixed_width_column_wrapper<double> value_col(values, values + size, nulls_at({0, 1, 100, 500}));
+  fixed_width_column_wrapper<int8_t> byte_col(keys, keys + size);
+  auto const input = cudf::table_view({key_col, value_col, byte_col});
+
+  // power-of-two and other partition counts, some of them empty
+  for (cudf::size_type num_partitions : {1, 7, 8, 64}) {
+    expect_packed_partitions_equal(input, {0}, num_partitions);
+  }
+}
+
+TEST_F(HashPartition, PackStrings)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 4, 5, 6, 7, 8});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"}, null_at(2));
+  expect_packed_partitions_equal(cudf::table_view({keys, strings}), {0}, 3);
+}
+
+TEST_F(HashPartition, PackEmptyAndInvalid)
+{
+  fixed_width_column_wrapper<int32_t> empty{};
+  auto const packed = cudf::hash_partition_and_pack(cudf::table_view({empty}), {0}, 4);
+  ASSERT_EQ(packed.size(), 4);
+  for (auto const& partition : packed) {
+    EXPECT_EQ(partition.table.num_rows(), 0);
+  }
+
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3});
+  EXPECT_THROW(cudf::hash_partition_and_pack(cudf::table_view({keys}), {0}, 0),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::hash_partition_and_pack(cudf::table_view({keys}), {1}, 2), std::out_of_range);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
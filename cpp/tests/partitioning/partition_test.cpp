@@ -19,6 +19,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/partitioning.hpp>
@@ -345,3 +346,68 @@ TEST_F(PartitionTestNotTyped, NoIntegerOverflow)
 
   run_partition_test(table_to_partition, map, 2, expected_table, expected_offsets);
 }
+
+void expect_range_partitioned(cudf::table_view const& input,
+                              cudf::size_type num_partitions,
+                              double sample_fraction,
+                              std::vector<cudf::order> const& column_order)
+{
+  auto const [result, offsets] =
+    cudf::range_partition(input, {0}, num_partitions, sample_fraction, {column_order.front()});
+  ASSERT_EQ(static_cast<std::size_t>(num_partitions + 1), offsets.size());
+  EXPECT_EQ(0, offsets.front());
+  EXPECT_EQ(input.num_rows(), offsets.back());
+
+  // the partitions are ranges of the sort order: sorting each one sorts the whole table
+  std::vector<cudf::size_type> const splits(offsets.begin() + 1, offsets.end() - 1);
+  auto const partitions = cudf::split(result->view(), splits);
+  std::vector<std::unique_ptr<cudf::table>> sorted_partitions;
+  std::vector<cudf::table_view> sorted_views;
+  for (auto const& partition : partitions) {
+    sorted_partitions.push_back(cudf::sort(partition, column_order));
+    sorted_views.push_back(sorted_partitions.back()->view());
+  }
+  auto const sorted = cudf::sort(input, column_order);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sorted->view(), cudf::concatenate(sorted_views)->view());
+}
+
+TEST_F(PartitionTestNotTyped, RangePartition)
+{
+  auto const size = 10000;
+  auto keys =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 37 % 500; });
+  auto values = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> key_col(keys, keys + size);
+  fixed_width_column_wrapper<int32_t> value_col(values, values + size);
+  auto const input = cudf::table_view{{key_col, value_col}};
+
+  expect_range_partitioned(input, 8, 0.1, {cudf::order::ASCENDING, cudf::order::ASCENDING});
+  expect_range_partitioned(input, 7, 1.0, {cudf::order::DESCENDING, cudf::order::ASCENDING});
+  // more partitions than distinct keys leaves some of them empty
+  expect_range_partitioned(input, 1000, 0.01, {cudf::order::ASCENDING, cudf::order::ASCENDING});
+}
+
+TEST_F(PartitionTestNotTyped, RangePartitionStringsWithNulls)
+{
+  strings_column_wrapper keys({"d", "a", "", "c", "b", "e", "a", "f", "g", "c"},
+                              {1, 1, 0, 1, 1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int32_t> values({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  auto const input = cudf::table_view{{keys, values}};
+
+  expect_range_partitioned(input, 3, 1.0, {cudf::order::ASCENDING, cudf::order::ASCENDING});
+}
+
+TEST_F(PartitionTestNotTyped, RangePartitionEmptyAndInvalid)
+{
+  fixed_width_column_wrapper<int32_t> empty{};
+  auto const [result, offsets] = cudf::range_partition(cudf::table_view{{empty}}, {0}, 4, 0.5);
+  EXPECT_EQ(0, result->num_rows());
+  EXPECT_EQ(std::vector<cudf::size_type>(5, 0), offsets);
+
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3});
+  auto const input = cudf::table_view{{keys}};
+  EXPECT_THROW(cudf::range_partition(input, {0}, 0, 0.5), std::invalid_argument);
+  EXPECT_THROW(cudf::range_partition(input, {0}, 2, 0.0), std::invalid_argument);
+  EXPECT_THROW(cudf::range_partition(input, {0}, 2, 1.5), std::invalid_argument);
+  EXPECT_THROW(cudf::range_partition(input, {1}, 2, 0.5), std::out_of_range);
+}
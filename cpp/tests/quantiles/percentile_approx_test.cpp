@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,16 +15,19 @@
  */
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/tdigest_utilities.cuh>
 #include <cudf_test/type_list_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/quantiles.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/tdigest/tdigest_accumulator.hpp>
 #include <cudf/tdigest/tdigest_column_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -32,6 +35,8 @@
 
 #include <arrow/util/tdigest.h>
 
+#include <stdexcept>
+
 std::unique_ptr<cudf::column> arrow_percentile_approx(cudf::column_view const& _values,
                                                       int delta,
                                                       std::vector<double> const& percentages)
@@ -453,3 +458,99 @@ TEST_F(PercentileApproxTest, NullPercentiles)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
 }
+
+struct TDigestAccumulatorTest : public cudf::test::BaseFixture {};
+
+TEST_F(TDigestAccumulatorTest, BatchesMatchSingleBatch)
+{
+  auto const delta = 1000;
+
+  cudf::test::fixed_width_column_wrapper<int> labels0{0, 1, 0};
+  cudf::test::fixed_width_column_wrapper<double> values0{5, 10, 1};
+  cudf::test::fixed_width_column_wrapper<int> labels1{1, 0};
+  cudf::test::fixed_width_column_wrapper<double> values1{{0, 3}, {0, 1}};
+  cudf::test::fixed_width_column_wrapper<int> labels2{0, 1, 0, 1};
+  cudf::test::fixed_width_column_wrapper<double> values2{2, 30, 4, 20};
+
+  cudf::test::fixed_width_column_wrapper<int> all_labels{0, 1, 0, 1, 0, 0, 1, 0, 1};
+  cudf::test::fixed_width_column_wrapper<double> all_values{{5, 10, 1, 0, 3, 2, 30, 4, 20},
+                                                            {1, 1, 1, 0, 1, 1, 1, 1, 1}};
+
+  // group 2 never gets a value
+  cudf::tdigest::tdigest_accumulator batched(3, delta, 2);
+  batched.add(labels0, values0);
+  batched.add(labels1, values1);
+  EXPECT_EQ(batched.num_pending_batches(), 0);
+  batched.add(labels2, values2);
+  EXPECT_EQ(batched.num_pending_batches(), 1);
+
+  cudf::tdigest::tdigest_accumulator single(3, delta);
+  single.add(all_labels, all_values);
+
+  cudf::test::fixed_width_column_wrapper<double> percentiles{0.0, 0.25, 0.5, 0.75, 1.0};
+  auto const result = batched.percentile_approx(percentiles);
+  EXPECT_EQ(batched.num_pending_batches(), 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*single.percentile_approx(percentiles), *result);
+
+  cudf::test::fixed_width_column_wrapper<double> bounds{0.0, 1.0};
+  auto const extremes = batched.percentile_approx(bounds);
+  cudf::test::lists_column_wrapper<double> expected{{1, 5}, {10, 30}};
+  EXPECT_EQ(extremes->null_count(), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(cudf::slice(*extremes, {0, 2})[0], expected);
+}
+
+TEST_F(TDigestAccumulatorTest, MergeDigests)
+{
+  auto const delta = 1000;
+
+  cudf::test::fixed_width_column_wrapper<double> values{0, 1, 2, 3, 4, 5};
+  cudf::test::fixed_width_column_wrapper<int> keys{0, 0, 0, 1, 1, 1};
+  cudf::groupby::groupby gb(cudf::table_view({keys}));
+  std::vector<cudf::groupby::aggregation_request> requests;
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggregations;
+  aggregations.push_back(cudf::make_tdigest_aggregation<cudf::groupby_aggregation>(delta));
+  requests.push_back({values, std::move(aggregations)});
+  auto const tdigest_column = gb.aggregate(requests);
+  cudf::tdigest::tdigest_column_view tdv(*tdigest_column.second[0].results[0]);
+
+  cudf::test::fixed_width_column_wrapper<int> more_keys{1, 0};
+  cudf::test::fixed_width_column_wrapper<double> more_values{10, -10};
+
+  cudf::tdigest::tdigest_accumulator merged(2, delta);
+  merged.merge(tdv);
+  merged.add(more_keys, more_values);
+
+  cudf::test::fixed_width_column_wrapper<int> all_keys{0, 0, 0, 1, 1, 1, 1, 0};
+  cudf::test::fixed_width_column_wrapper<double> all_values{0, 1, 2, 3, 4, 5, 10, -10};
+  cudf::tdigest::tdigest_accumulator single(2, delta);
+  single.add(all_keys, all_values);
+
+  cudf::test::fixed_width_column_wrapper<double> percentiles{0.0, 0.3, 0.5, 0.9, 1.0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*single.percentile_approx(percentiles),
+                                      *merged.percentile_approx(percentiles));
+}
+
+TEST_F(TDigestAccumulatorTest, InvalidArguments)
+{
+  EXPECT_THROW(cudf::tdigest::tdigest_accumulator(0, 1000), std::invalid_argument);
+  EXPECT_THROW(cudf::tdigest::tdigest_accumulator(2, 0), std::invalid_argument);
+  EXPECT_THROW(cudf::tdigest::tdigest_accumulator(2, 1000, 0), std::invalid_argument);
+
+  cudf::tdigest::tdigest_accumulator acc(2, 1000);
+  cudf::test::fixed_width_column_wrapper<int> labels{0, 1, 2};
+  cudf::test::fixed_width_column_wrapper<double> values{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> wide_labels{0, 1, 1};
+  cudf::test::fixed_width_column_wrapper<int> null_labels{{0, 1, 1}, {1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int> valid_labels{0, 1, 1};
+  cudf::test::strings_column_wrapper strings{"a", "b", "c"};
+
+  EXPECT_THROW(acc.add(labels, values), std::invalid_argument);
+  EXPECT_THROW(acc.add(wide_labels, values), std::invalid_argument);
+  EXPECT_THROW(acc.add(null_labels, values), std::invalid_argument);
+  EXPECT_THROW(acc.add(cudf::slice(labels, {0, 2})[0], values), std::invalid_argument);
+  EXPECT_THROW(acc.add(valid_labels, strings), std::invalid_argument);
+
+  auto const empty = cudf::tdigest::detail::make_empty_tdigest_column(
+    cudf::get_default_stream(), rmm::mr::get_current_device_resource());
+  EXPECT_THROW(acc.merge(cudf::tdigest::tdigest_column_view(*empty)), std::invalid_argument);
+}
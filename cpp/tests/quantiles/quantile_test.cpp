@@ -21,7 +21,9 @@
 #include <cudf_test/type_list_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/quantiles.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
@@ -471,6 +473,112 @@ TEST_F(QuantileDictionaryTest, TestValid)
     result->view(), cudf::test::fixed_width_column_wrapper<double>{3.5, 5.5, 7.5});
 };
 
+template <typename T>
+void expect_unsorted_quantiles_match(cudf::column_view const& input, std::vector<double> const& q)
+{
+  // the sorted order of the valid values
+  auto const sorted_indices = cudf::sorted_order(
+    cudf::table_view{{input}}, {cudf::order::ASCENDING}, {cudf::null_order::AFTER});
+  auto const valid_indices =
+    cudf::slice(sorted_indices->view(), {0, input.size() - input.null_count()}).front();
+
+  for (auto const interp : {cudf::interpolation::LINEAR,
+                            cudf::interpolation::LOWER,
+                            cudf::interpolation::HIGHER,
+                            cudf::interpolation::MIDPOINT,
+                            cudf::interpolation::NEAREST}) {
+    for (auto const exact : {true, false}) {
+      auto const expected = cudf::quantile(input, q, interp, valid_indices, exact);
+      auto const actual   = cudf::quantile_unsorted(input, q, interp, exact);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected, *actual);
+    }
+  }
+}
+
+template <typename T>
+struct QuantileUnsortedTest : public cudf::test::BaseFixture {};
+
+TYPED_TEST_SUITE(QuantileUnsortedTest, TestTypes);
+
+TYPED_TEST(QuantileUnsortedTest, MatchesSortedQuantiles)
+{
+  using T = TypeParam;
+
+  std::vector<T> values(1000);
+  std::vector<bool> validity(values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i]   = static_cast<T>((i * 7919) % 113);
+    validity[i] = i % 7 != 3;
+  }
+  cudf::test::fixed_width_column_wrapper<T> input(values.begin(), values.end(), validity.begin());
+  cudf::test::fixed_width_column_wrapper<T> no_nulls(values.begin(), values.end());
+
+  // a few quantiles are selected, many quantiles sort the values
+  auto const few  = std::vector<double>{0.5, 0.01, 0.99};
+  auto const many = std::vector<double>{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0};
+  expect_unsorted_quantiles_match<T>(input, few);
+  expect_unsorted_quantiles_match<T>(input, many);
+  expect_unsorted_quantiles_match<T>(no_nulls, few);
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> single({7});
+  expect_unsorted_quantiles_match<T>(single, few);
+}
+
+TYPED_TEST(QuantileUnsortedTest, NoValidValues)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> all_nulls({1, 2, 3}, {0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<T> empty({});
+  auto const expected = cudf::test::fixed_width_column_wrapper<double>({0, 0}, {0, 0});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *cudf::quantile_unsorted(all_nulls, {0.5, 0.25}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *cudf::quantile_unsorted(empty, {0.5, 0.25}));
+  EXPECT_EQ(cudf::quantile_unsorted(all_nulls, {})->size(), 0);
+}
+
+template <typename T>
+struct QuantileUnsortedFloatTest : public cudf::test::BaseFixture {};
+
+TYPED_TEST_SUITE(QuantileUnsortedFloatTest, cudf::test::FloatingPointTypes);
+
+TYPED_TEST(QuantileUnsortedFloatTest, SpecialValues)
+{
+  using T = TypeParam;
+
+  auto const nan = std::numeric_limits<T>::quiet_NaN();
+  auto const inf = std::numeric_limits<T>::infinity();
+  cudf::test::fixed_width_column_wrapper<T> input{
+    {T{3.5}, -inf, T{-0.0}, nan, T{-2.25}, T{0.0}, inf, T{-7}, -nan, T{1}},
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 0}};
+
+  expect_unsorted_quantiles_match<T>(input, {0.0, 0.2, 0.45, 0.5, 0.7, 1.0});
+}
+
+TEST_F(QuantileDictionaryTest, TestUnsorted)
+{
+  cudf::test::dictionary_column_wrapper<int32_t> col{10, 3, 5, 1, 8, 2, 9, 4, 7, 6};
+
+  auto const result = cudf::quantile_unsorted(col, {0.25, 0.5, 0.75}, cudf::interpolation::LINEAR);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    result->view(), cudf::test::fixed_width_column_wrapper<double>{3.25, 5.5, 7.75});
+}
+
+struct QuantileUnsortedFixedPointTest : public cudf::test::BaseFixture {};
+
+TEST_F(QuantileUnsortedFixedPointTest, Decimal)
+{
+  using decimal64 = numeric::decimal64;
+  cudf::test::fixed_point_column_wrapper<int64_t> input{{125, -300, 50, 775, -25, 0},
+                                                        numeric::scale_type{-2}};
+
+  auto const result = cudf::quantile_unsorted(input, {0.5}, cudf::interpolation::LOWER);
+  auto const expected =
+    cudf::test::fixed_point_column_wrapper<int64_t>{{0}, numeric::scale_type{-2}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  EXPECT_EQ(result->type(), cudf::data_type(cudf::type_to_id<decimal64>(), -2));
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
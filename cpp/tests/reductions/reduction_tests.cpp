@@ -21,6 +21,8 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -28,8 +30,10 @@
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/scalar/scalar_batch.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -591,6 +595,39 @@ TYPED_TEST(ReductionHistogramTest, MergeHistogram)
   }
 }
 
+struct ReductionHllppTest : public cudf::test::BaseFixture {};
+
+TEST_F(ReductionHllppTest, SketchAndMerge)
+{
+  using int64_col        = cudf::test::fixed_width_column_wrapper<int64_t>;
+  auto const struct_type = cudf::data_type{cudf::type_id::STRUCT};
+  auto const hllpp_agg   = cudf::make_hllpp_aggregation<reduce_aggregation>();
+
+  auto const input  = int64_col{{1, 2, 3, 2, 1, 4, 5}, null_at(5)};
+  auto const sketch = cudf::reduce(input, *hllpp_agg, struct_type);
+  EXPECT_TRUE(sketch->is_valid());
+  auto const sketch_column = cudf::make_column_from_scalar(*sketch, 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int64_col{4}, *cudf::estimate_distinct_count(*sketch_column));
+
+  // Merging the sketches of the parts of the input gives the sketch of the whole input
+  std::vector<std::unique_ptr<cudf::column>> partials;
+  for (auto const& part : cudf::split(input, {3})) {
+    partials.push_back(
+      cudf::make_column_from_scalar(*cudf::reduce(part, *hllpp_agg, struct_type), 1));
+  }
+  auto const concatenated =
+    cudf::concatenate(std::vector<cudf::column_view>{partials[0]->view(), partials[1]->view()});
+  auto const merged = cudf::reduce(
+    *concatenated, *cudf::make_merge_hllpp_aggregation<reduce_aggregation>(), struct_type);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(static_cast<cudf::struct_scalar const&>(*sketch).view(),
+                                static_cast<cudf::struct_scalar const&>(*merged).view());
+
+  // The sketch of no values estimates zero distinct values
+  auto const empty_sketch =
+    cudf::make_column_from_scalar(*cudf::reduce(int64_col{}, *hllpp_agg, struct_type), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int64_col{0}, *cudf::estimate_distinct_count(*empty_sketch));
+}
+
 template <typename T>
 struct ReductionAnyAllTest : public ReductionTest<bool> {};
 using AnyAllTypes = cudf::test::Types<int32_t, float, bool>;
@@ -3149,4 +3186,192 @@ TEST_F(StructReductionTest, StructReductionMinMaxWithNulls)
   }
 }
 
+template <typename T>
+struct MultiReductionTest : public cudf::test::BaseFixture {};
+
+using MultiReductionTypes = cudf::test::Types<int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE(MultiReductionTest, MultiReductionTypes);
+
+namespace {
+template <typename T>
+T scalar_value(cudf::scalar const& s)
+{
+  return static_cast<cudf::numeric_scalar<T> const&>(s).value();
+}
+
+/// Compares every result of `reduce_multiple` to the result of `reduce` with the same arguments
+template <typename T>
+void expect_multiple_reductions_equal(cudf::column_view const& col,
+                                      std::vector<std::unique_ptr<reduce_aggregation>> const& aggs,
+                                      std::vector<cudf::data_type> const& output_dtypes)
+{
+  auto const results = cudf::reduce_multiple(col, aggs, output_dtypes);
+  ASSERT_EQ(results.size(), aggs.size());
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    auto const expected = cudf::reduce(col, *aggs[i], output_dtypes[i]);
+    ASSERT_EQ(results[i]->type(), expected->type());
+    ASSERT_EQ(results[i]->is_valid(), expected->is_valid());
+    if (!expected->is_valid()) { continue; }
+    switch (output_dtypes[i].id()) {
+      case cudf::type_id::BOOL8:
+        EXPECT_EQ(scalar_value<bool>(*results[i]), scalar_value<bool>(*expected));
+        break;
+      case cudf::type_id::FLOAT64:
+        EXPECT_DOUBLE_EQ(scalar_value<double>(*results[i]), scalar_value<double>(*expected));
+        break;
+      default: EXPECT_EQ(scalar_value<T>(*results[i]), scalar_value<T>(*expected));
+    }
+  }
+}
+}  // namespace
+
+TYPED_TEST(MultiReductionTest, MatchesSingleReductions)
+{
+  using T = TypeParam;
+
+  auto const values = convert_values<T>({3, -1, 4, 1, -5, 9, 2, -6, 5, 3, 5, 0});
+  auto const valids = std::vector<bool>{1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1};
+  auto const col    = construct_null_column(values, valids);
+  auto const small  = cudf::test::fixed_width_column_wrapper<T>{1, 2, 3, 2, 1};
+
+  auto const dtype   = cudf::data_type{cudf::type_to_id<T>()};
+  auto const float64 = cudf::data_type{cudf::type_id::FLOAT64};
+  auto const bool8   = cudf::data_type{cudf::type_id::BOOL8};
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_product_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_variance_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_std_aggregation<reduce_aggregation>(0));
+  aggs.push_back(cudf::make_any_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_all_aggregation<reduce_aggregation>());
+  // Not fused, reduced on its own
+  aggs.push_back(cudf::make_median_aggregation<reduce_aggregation>());
+  auto const output_dtypes = std::vector<cudf::data_type>{
+    dtype, dtype, dtype, dtype, dtype, float64, float64, float64, bool8, bool8, float64};
+
+  expect_multiple_reductions_equal<T>(col, aggs, output_dtypes);
+  expect_multiple_reductions_equal<T>(small, aggs, output_dtypes);
+
+  // Empty and all-null columns
+  auto const empty = cudf::test::fixed_width_column_wrapper<T>{};
+  expect_multiple_reductions_equal<T>(empty, aggs, output_dtypes);
+  auto const all_nulls = construct_null_column(values, std::vector<bool>(values.size(), false));
+  expect_multiple_reductions_equal<T>(all_nulls, aggs, output_dtypes);
+}
+
+TYPED_TEST(MultiReductionTest, BatchMatchesSingleReductions)
+{
+  using T = TypeParam;
+
+  auto const values = convert_values<T>({3, -1, 4, 1, -5, 9, 2, -6, 5, 3, 5, 0});
+  auto const valids = std::vector<bool>{1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1};
+  auto const col    = construct_null_column(values, valids);
+
+  auto const dtype   = cudf::data_type{cudf::type_to_id<T>()};
+  auto const float64 = cudf::data_type{cudf::type_id::FLOAT64};
+  auto const bool8   = cudf::data_type{cudf::type_id::BOOL8};
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_std_aggregation<reduce_aggregation>(0));
+  aggs.push_back(cudf::make_all_aggregation<reduce_aggregation>());
+  // Not fused, copied into the batch
+  aggs.push_back(cudf::make_median_aggregation<reduce_aggregation>());
+  auto const output_dtypes =
+    std::vector<cudf::data_type>{dtype, dtype, dtype, float64, bool8, float64};
+
+  auto const all_nulls = construct_null_column(values, std::vector<bool>(values.size(), false));
+  for (auto const& input : {cudf::column_view{col}, cudf::column_view{all_nulls}}) {
+    auto const batch = cudf::reduce_batch(input, aggs, output_dtypes);
+    ASSERT_EQ(batch.size(), static_cast<cudf::size_type>(aggs.size()));
+    std::vector<uint8_t> host(batch.size_bytes());
+    batch.copy_to_host_async(host);
+    cudf::get_default_stream().synchronize();
+
+    for (cudf::size_type i = 0; i < batch.size(); ++i) {
+      auto const expected = cudf::reduce(input, *aggs[i], output_dtypes[i]);
+      EXPECT_EQ(batch.type(i), expected->type());
+      ASSERT_EQ(batch.is_valid(host, i), expected->is_valid());
+      if (!expected->is_valid()) { continue; }
+      switch (output_dtypes[i].id()) {
+        case cudf::type_id::BOOL8:
+          EXPECT_EQ(batch.value<bool>(host, i), scalar_value<bool>(*expected));
+          break;
+        case cudf::type_id::FLOAT64:
+          EXPECT_DOUBLE_EQ(batch.value<double>(host, i), scalar_value<double>(*expected));
+          break;
+        default: EXPECT_EQ(batch.value<T>(host, i), scalar_value<T>(*expected));
+      }
+    }
+  }
+}
+
+struct MultiReductionUntypedTest : public cudf::test::BaseFixture {};
+
+TEST_F(MultiReductionUntypedTest, InvalidArguments)
+{
+  auto const col = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  auto const int32 = cudf::data_type{cudf::type_id::INT32};
+
+  EXPECT_THROW(cudf::reduce_multiple(col, aggs, std::vector<cudf::data_type>{int32}),
+               std::invalid_argument);
+  // MIN must keep the column type
+  auto const int64 = cudf::data_type{cudf::type_id::INT64};
+  EXPECT_THROW(cudf::reduce_multiple(col, aggs, std::vector<cudf::data_type>{int32, int64}),
+               cudf::logic_error);
+  aggs.push_back(nullptr);
+  EXPECT_THROW(cudf::reduce_multiple(col, aggs, std::vector<cudf::data_type>{int32, int32, int32}),
+               std::invalid_argument);
+
+  // A batch only holds fixed-width values
+  auto const strings = cudf::test::strings_column_wrapper{"a", "b"};
+  auto const string_type = cudf::data_type{cudf::type_id::STRING};
+  aggs.pop_back();
+  EXPECT_THROW(
+    cudf::reduce_batch(strings, aggs, std::vector<cudf::data_type>{string_type, string_type}),
+    cudf::data_type_error);
+}
+
+TEST_F(MultiReductionUntypedTest, ProfileTable)
+{
+  auto const ints    = cudf::test::fixed_width_column_wrapper<int32_t>{{4, 1, 7, 2}, {1, 1, 1, 0}};
+  auto const doubles = cudf::test::fixed_width_column_wrapper<double>{0.5, 2.5, -1.0, 4.0};
+  auto const strings = cudf::test::strings_column_wrapper{"b", "a", "d", "c"};
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<reduce_aggregation>());
+
+  auto const results = cudf::reduce_multiple(cudf::table_view{{ints, doubles, strings}}, aggs);
+  ASSERT_EQ(results.size(), std::size_t{3});
+  EXPECT_EQ(scalar_value<int32_t>(*results[0][0]), 1);
+  EXPECT_EQ(scalar_value<int32_t>(*results[0][1]), 7);
+  EXPECT_EQ(scalar_value<double>(*results[1][0]), -1.0);
+  EXPECT_EQ(scalar_value<double>(*results[1][1]), 4.0);
+  EXPECT_EQ(static_cast<cudf::string_scalar const&>(*results[2][0]).to_string(), "a");
+  EXPECT_EQ(static_cast<cudf::string_scalar const&>(*results[2][1]).to_string(), "d");
+
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<reduce_aggregation>());
+  auto const numeric_results = cudf::reduce_multiple(cudf::table_view{{ints, doubles}}, aggs);
+  ASSERT_EQ(numeric_results.size(), std::size_t{2});
+  EXPECT_EQ(numeric_results[0][2]->type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(scalar_value<int64_t>(*numeric_results[0][2]), 12);
+  EXPECT_DOUBLE_EQ(scalar_value<double>(*numeric_results[0][3]), 4.0);
+  EXPECT_EQ(numeric_results[1][2]->type().id(), cudf::type_id::FLOAT64);
+  EXPECT_DOUBLE_EQ(scalar_value<double>(*numeric_results[1][2]), 6.0);
+  EXPECT_DOUBLE_EQ(scalar_value<double>(*numeric_results[1][3]), 1.5);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -24,7 +24,9 @@
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/types.hpp>
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -1141,6 +1143,65 @@ TEST_F(SegmentedReductionTestUntyped, EmptyInputWithOffsets)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect_bool);
 }
 
+TEST_F(SegmentedReductionTestUntyped, SkewedSegments)
+{
+  // Short segments, empty segments and segments spanning many blocks of work, starting after the
+  // first row of the input
+  auto offsets = std::vector<cudf::size_type>{3};
+  for (auto size : {0, 1, 5, 0, 0, 2, 40000, 7, 0, 3000, 1, 1, 2049, 1024, 0, 3}) {
+    offsets.push_back(offsets.back() + size);
+  }
+  for (int i = 0; i < 3000; ++i) {
+    offsets.push_back(offsets.back() + i % 4);
+  }
+  auto const num_rows = offsets.back() + 5;
+
+  auto host_values = std::vector<int64_t>(num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    host_values[i] = (i * 7919) % 1000 - 500;
+  }
+  auto const input =
+    cudf::test::fixed_width_column_wrapper<int64_t>(host_values.begin(), host_values.end());
+
+  auto const num_segments = offsets.size() - 1;
+  auto expect_sums        = std::vector<int64_t>(num_segments);
+  auto expect_maxs        = std::vector<int64_t>(num_segments);
+  auto expect_valids      = std::vector<bool>(num_segments);
+  for (std::size_t s = 0; s < num_segments; ++s) {
+    auto const begin = host_values.begin() + offsets[s];
+    auto const end   = host_values.begin() + offsets[s + 1];
+    expect_sums[s]   = std::accumulate(begin, end, int64_t{0});
+    expect_maxs[s]   = begin == end ? 0 : *std::max_element(begin, end);
+    expect_valids[s] = begin != end;
+  }
+
+  auto const d_offsets = cudf::detail::make_device_uvector_async(
+    offsets, cudf::get_default_stream(), rmm::mr::get_current_device_resource());
+  auto const output_type = cudf::data_type{cudf::type_id::INT64};
+
+  auto const sums =
+    cudf::segmented_reduce(input,
+                           d_offsets,
+                           *cudf::make_sum_aggregation<cudf::segmented_reduce_aggregation>(),
+                           output_type,
+                           cudf::null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *sums,
+    cudf::test::fixed_width_column_wrapper<int64_t>(
+      expect_sums.begin(), expect_sums.end(), expect_valids.begin()));
+
+  auto const maxs =
+    cudf::segmented_reduce(input,
+                           d_offsets,
+                           *cudf::make_max_aggregation<cudf::segmented_reduce_aggregation>(),
+                           output_type,
+                           cudf::null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *maxs,
+    cudf::test::fixed_width_column_wrapper<int64_t>(
+      expect_maxs.begin(), expect_maxs.end(), expect_valids.begin()));
+}
+
 template <typename T>
 struct SegmentedReductionFixedPointTest : public cudf::test::BaseFixture {};
 
@@ -32,6 +32,7 @@
 #include <cudf/types.hpp>
 
 #include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
 #include <gtest/gtest.h>
@@ -288,6 +289,60 @@ TEST_F(ReplaceStringsTest, StringsLargeScale)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_wrapper);
 }
 
+// Enough old values to probe a hash table of them; the first duplicate old value wins
+TEST_F(ReplaceStringsTest, StringsManyValuesToReplace)
+{
+  constexpr int num_values = 100;
+  std::vector<std::string> values_to_replace;
+  std::vector<std::string> replacement;
+  for (int i = 0; i < num_values; ++i) {
+    values_to_replace.push_back("v" + std::to_string(i));
+    replacement.push_back("r" + std::to_string(i));
+  }
+  values_to_replace.push_back("v0");
+  replacement.push_back("dup");
+
+  cudf::test::strings_column_wrapper input_wrapper{{"v0", "x", "v99", "", "v42", "v7"},
+                                                   {1, 1, 1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper values_to_replace_wrapper{values_to_replace.begin(),
+                                                               values_to_replace.end()};
+  cudf::test::strings_column_wrapper replacement_wrapper{replacement.begin(), replacement.end()};
+
+  auto const result =
+    cudf::find_and_replace_all(input_wrapper, values_to_replace_wrapper, replacement_wrapper);
+  cudf::test::strings_column_wrapper expected_wrapper{{"r0", "x", "r99", "", "r42", "r7"},
+                                                      {1, 1, 1, 0, 1, 1}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_wrapper);
+}
+
+struct ReplacementMapTest : public cudf::test::BaseFixture {};
+
+TEST_F(ReplacementMapTest, ReuseAcrossInputs)
+{
+  auto const values = thrust::make_counting_iterator(0);
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10 != 3; });
+  auto const doubled =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 2; });
+  cudf::test::fixed_width_column_wrapper<int32_t> values_to_replace(values, values + 200);
+  cudf::test::fixed_width_column_wrapper<int32_t> replacement_values(
+    doubled, doubled + 200, valids);
+  cudf::replacement_map const map(values_to_replace, replacement_values);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> first{{1, 3, 250, 199, 0}, {1, 1, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> first_expected{{2, 0, 250, 398, 0},
+                                                                 {1, 0, 1, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*map.replace(first), first_expected);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> second{-1, 100, 13};
+  cudf::test::fixed_width_column_wrapper<int32_t> second_expected{{-1, 200, 0}, {1, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*map.replace(second), second_expected);
+
+  cudf::test::fixed_width_column_wrapper<float> mismatched{1.f, 2.f};
+  EXPECT_THROW((void)map.replace(mismatched), cudf::logic_error);
+}
+
 //// This is the main test feature
 template <class T>
 struct ReplaceTest : cudf::test::BaseFixture {
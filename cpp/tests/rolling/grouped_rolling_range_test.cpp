@@ -35,6 +35,7 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 template <typename T>
@@ -939,3 +940,110 @@ TEST_F(GroupedRollingRangeOrderByStringTest, Descending_NoParts_WithNulls)
                                    *orderby, cudf::order::DESCENDING, current_row, current_row),
                                  nullable_ints_column({3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 2, 2, 2, 2}));
 }
+
+struct GroupedRollingRangeMultiAggregationTest : cudf::test::BaseFixture {};
+
+TEST_F(GroupedRollingRangeMultiAggregationTest, MatchesSingleAggregations)
+{
+  auto const keys     = ints_column{0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2};
+  auto const asc_oby  = ints_column{{0, 0, 1, 3, 4, 7, 0, 2, 2, 9, 1, 2, 3, 4},
+                                   cudf::test::iterators::nulls_at({0, 1, 6})};
+  auto const desc_oby = ints_column{{0, 0, 7, 4, 3, 1, 0, 9, 2, 2, 4, 3, 2, 1},
+                                   cudf::test::iterators::nulls_at({0, 1, 6})};
+  auto const values_a = ints_column{{5, 1, 4, 2, 8, 6, 3, 9, 7, 1, 2, 6, 4, 3},
+                                   cudf::test::iterators::nulls_at({3, 12})};
+  auto const values_b =
+    fwcw<double>{1.5, -2.0, 3.25, 0.5, 8.0, -1.0, 2.0, 4.5, 6.0, 7.5, 1.0, 2.5, 3.0, -4.0};
+
+  auto const group_keys = cudf::table_view{{keys}};
+  auto const preceding  = cudf::range_window_bounds::get(*cudf::make_fixed_width_scalar(2));
+  auto const following  = cudf::range_window_bounds::get(*cudf::make_fixed_width_scalar(1));
+
+  std::vector<cudf::rolling_request> requests;
+  requests.push_back({values_a, 1, cudf::make_sum_aggregation<cudf::rolling_aggregation>()});
+  requests.push_back({values_a, 2, cudf::make_min_aggregation<cudf::rolling_aggregation>()});
+  requests.push_back({values_b, 1, cudf::make_max_aggregation<cudf::rolling_aggregation>()});
+  requests.push_back({values_b, 3, cudf::make_mean_aggregation<cudf::rolling_aggregation>()});
+  requests.push_back({values_a, 1, cudf::make_count_aggregation<cudf::rolling_aggregation>()});
+  requests.push_back(
+    {values_b, 1, cudf::make_collect_list_aggregation<cudf::rolling_aggregation>()});
+
+  for (auto const order : {cudf::order::ASCENDING, cudf::order::DESCENDING}) {
+    auto const& orderby = order == cudf::order::ASCENDING ? asc_oby : desc_oby;
+    auto const results  = cudf::grouped_range_rolling_window(
+      group_keys, orderby, order, preceding, following, requests);
+
+    ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(requests.size()));
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      auto const expected = cudf::grouped_range_rolling_window(group_keys,
+                                                               orderby,
+                                                               order,
+                                                               requests[i].values,
+                                                               preceding,
+                                                               following,
+                                                               requests[i].min_periods,
+                                                               *requests[i].aggregation);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, results->get_column(i));
+    }
+  }
+}
+
+TEST_F(GroupedRollingRangeMultiAggregationTest, UnboundedAndEmpty)
+{
+  auto const keys    = ints_column{0, 0, 0, 1, 1};
+  auto const orderby = ints_column{1, 2, 3, 1, 5};
+  auto const values  = ints_column{1, 2, 3, 4, 5};
+
+  auto const unbounded =
+    cudf::range_window_bounds::unbounded(cudf::data_type{cudf::type_id::INT32});
+
+  std::vector<cudf::rolling_request> requests;
+  requests.push_back({values, 1, cudf::make_sum_aggregation<cudf::rolling_aggregation>()});
+  requests.push_back({values, 1, cudf::make_max_aggregation<cudf::rolling_aggregation>()});
+  auto const results = cudf::grouped_range_rolling_window(
+    cudf::table_view{{keys}}, orderby, cudf::order::ASCENDING, unbounded, unbounded, requests);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(bigints_column{6, 6, 6, 9, 9}, results->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(ints_column{3, 3, 3, 5, 5}, results->get_column(1));
+
+  auto const empty_keys    = ints_column{};
+  auto const empty_orderby = ints_column{};
+  auto const empty_values  = ints_column{};
+  std::vector<cudf::rolling_request> empty_requests;
+  empty_requests.push_back(
+    {empty_values, 1, cudf::make_sum_aggregation<cudf::rolling_aggregation>()});
+  auto const empty_results = cudf::grouped_range_rolling_window(cudf::table_view{{empty_keys}},
+                                                                empty_orderby,
+                                                                cudf::order::ASCENDING,
+                                                                unbounded,
+                                                                unbounded,
+                                                                empty_requests);
+  EXPECT_EQ(empty_results->num_columns(), 1);
+  EXPECT_EQ(empty_results->num_rows(), 0);
+}
+
+TEST_F(GroupedRollingRangeMultiAggregationTest, InvalidRequests)
+{
+  auto const keys         = ints_column{0, 0, 1};
+  auto const orderby      = ints_column{1, 2, 3};
+  auto const values       = ints_column{1, 2, 3};
+  auto const short_values = ints_column{1, 2};
+
+  auto const bounds     = cudf::range_window_bounds::get(*cudf::make_fixed_width_scalar(1));
+  auto const group_keys = cudf::table_view{{keys}};
+
+  auto run = [&](cudf::column_view const& input, cudf::size_type min_periods, bool with_agg) {
+    std::vector<cudf::rolling_request> requests;
+    requests.push_back(
+      {input,
+       min_periods,
+       with_agg ? cudf::make_sum_aggregation<cudf::rolling_aggregation>() : nullptr});
+    return cudf::grouped_range_rolling_window(
+      group_keys, orderby, cudf::order::ASCENDING, bounds, bounds, requests);
+  };
+
+  EXPECT_THROW(run(short_values, 1, true), std::invalid_argument);
+  EXPECT_THROW(run(values, 0, true), std::invalid_argument);
+  EXPECT_THROW(run(values, 1, false), std::invalid_argument);
+  EXPECT_NO_THROW(run(values, 1, true));
+}
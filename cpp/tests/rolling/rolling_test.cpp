@@ -40,8 +40,11 @@
 
 #include <src/rolling/detail/rolling.hpp>
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 class RollingStringTest : public cudf::test::BaseFixture {};
@@ -1216,6 +1219,54 @@ TEST_F(RollingTestStrings, StringsUnsupportedOperators)
   EXPECT_NO_THROW(this->run_test_col(input, window, window, 0, rolling_operator::COUNT_ALL));
 }*/
 
+class RollingBoundedWindowTest : public cudf::test::BaseFixture {};
+
+// Large fixed windows aggregate partial results, variable windows aggregate every row
+TEST_F(RollingBoundedWindowTest, LargeFixedWindows)
+{
+  cudf::size_type num_rows = 20000;
+
+  std::vector<int32_t> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<int32_t> rng(-1000, 1000);
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  cudf::test::fixed_width_column_wrapper<int32_t> input(
+    col_data.begin(), col_data.end(), col_valid.begin());
+
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const windows{
+    {1024, 0}, {1500, 700}, {-100, 3000}, {30000, 1}};
+  for (auto const& [preceding, following] : windows) {
+    auto const preceding_it = thrust::make_constant_iterator(preceding);
+    auto const following_it = thrust::make_constant_iterator(following);
+    cudf::test::fixed_width_column_wrapper<cudf::size_type> preceding_col(
+      preceding_it, preceding_it + num_rows);
+    cudf::test::fixed_width_column_wrapper<cudf::size_type> following_col(
+      following_it, following_it + num_rows);
+
+    std::vector<std::unique_ptr<cudf::rolling_aggregation>> aggs;
+    aggs.push_back(cudf::make_sum_aggregation<cudf::rolling_aggregation>());
+    aggs.push_back(cudf::make_mean_aggregation<cudf::rolling_aggregation>());
+    aggs.push_back(cudf::make_min_aggregation<cudf::rolling_aggregation>());
+    aggs.push_back(cudf::make_max_aggregation<cudf::rolling_aggregation>());
+    aggs.push_back(cudf::make_count_aggregation<cudf::rolling_aggregation>());
+    for (auto const& agg : aggs) {
+      auto const got      = cudf::rolling_window(input, preceding, following, 100, *agg);
+      auto const expected = cudf::rolling_window(input, preceding_col, following_col, 100, *agg);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*got, *expected);
+    }
+
+    // The moments are merged instead of accumulated row by row
+    auto const variance = cudf::make_variance_aggregation<cudf::rolling_aggregation>(1);
+    auto const got      = cudf::rolling_window(input, preceding, following, 100, *variance);
+    auto const expected =
+      cudf::rolling_window(input, preceding_col, following_col, 100, *variance);
+    EXPECT_TRUE(cudf::test::detail::expect_columns_equivalent(
+      *got, *expected, cudf::test::debug_output_level::FIRST_ERROR, 1 << 16));
+  }
+}
+
 struct RollingTestUdf : public cudf::test::BaseFixture {
   const std::string cuda_func{
     R"***(
@@ -1335,6 +1386,41 @@ TEST_F(RollingTestUdf, StaticWindow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*output, expected);
 }
 
+TEST_F(RollingTestUdf, AssociativeStaticWindow)
+{
+  cudf::size_type size = 1000;
+
+  cudf::test::fixed_width_column_wrapper<int64_t> input(thrust::make_counting_iterator(0),
+                                                        thrust::make_counting_iterator(size),
+                                                        thrust::make_constant_iterator(true));
+
+  auto cuda_udf_agg = cudf::make_udf_aggregation<cudf::rolling_aggregation>(
+    cudf::udf_type::CUDA, this->cuda_func, cudf::data_type{cudf::type_id::INT64}, true);
+
+  // Windows spanning one or two blocks, a window wider than the column and a window that does
+  // not contain its row
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const windows{
+    {2, 2}, {1, 0}, {100, 50}, {7, 0}, {2000, 10}, {-3, 10}};
+  for (auto const& [preceding, following] : windows) {
+    auto start = cudf::detail::make_counting_transform_iterator(
+      0, [size, preceding = preceding, following = following](cudf::size_type row) {
+        return std::accumulate(
+          thrust::make_counting_iterator<int64_t>(std::clamp(row - preceding + 1, 0, size)),
+          thrust::make_counting_iterator<int64_t>(std::clamp(row + following + 1, 0, size)),
+          int64_t{0});
+      });
+    cudf::test::fixed_width_column_wrapper<int64_t> expected(start, start + size);
+
+    auto const output = cudf::rolling_window(input, preceding, following, 0, *cuda_udf_agg);
+
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*output, expected);
+  }
+
+  // The partial results of an associative UDF have the type of its output
+  cudf::test::fixed_width_column_wrapper<int32_t> int32_input{1, 2, 3};
+  EXPECT_THROW(cudf::rolling_window(int32_input, 2, 2, 0, *cuda_udf_agg), std::invalid_argument);
+}
+
 TEST_F(RollingTestUdf, DynamicWindow)
 {
   cudf::size_type size = 1000;
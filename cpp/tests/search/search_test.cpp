@@ -20,11 +20,17 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/search.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 struct SearchTest : public cudf::test::BaseFixture {};
 
 using cudf::numeric_scalar;
@@ -1818,6 +1824,138 @@ TEST_F(SearchTest, multi_contains_empty_input_set_string)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, membership_index_contains)
+{
+  auto const haystack = fixed_width_column_wrapper<int32_t>{{7, 3, 5, 3, 0, 9}, {1, 1, 1, 1, 0, 1}};
+  auto const needles  = fixed_width_column_wrapper<int32_t>{{3, 4, 9, 0, 7}, {1, 1, 1, 0, 1}};
+  auto const expect   = fixed_width_column_wrapper<bool>{{1, 0, 1, 0, 1}, {1, 1, 1, 0, 1}};
+
+  auto const index = cudf::membership_index(haystack);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(index.keys(), fixed_width_column_wrapper<int32_t>{3, 5, 7, 9});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.contains(needles), expect);
+
+  // the index is reused by later probes
+  auto const more = fixed_width_column_wrapper<int32_t>{5, 6};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.contains(more), fixed_width_column_wrapper<bool>{1, 0});
+}
+
+TEST_F(SearchTest, membership_index_contains_strings)
+{
+  auto const haystack = cudf::test::strings_column_wrapper{"tiger", "", "zebra", "ant", "zebra"};
+  auto const needles  = cudf::test::strings_column_wrapper{"ant", "bee", "", "zebras"};
+  auto const expect   = fixed_width_column_wrapper<bool>{1, 0, 1, 0};
+
+  auto const index = cudf::membership_index(haystack);
+  EXPECT_EQ(index.keys().size(), 4);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.contains(needles), expect);
+
+  auto const ints = fixed_width_column_wrapper<int32_t>{1};
+  EXPECT_THROW(index.contains(ints), cudf::data_type_error);
+}
+
+TEST_F(SearchTest, membership_index_intersects)
+{
+  auto const haystack = fixed_width_column_wrapper<int64_t>{10, 20, 30};
+
+  // a null bound leaves the range unbounded on that side
+  auto const lower =
+    fixed_width_column_wrapper<int64_t>{{0, 11, 21, 31, 0, 15}, {1, 1, 1, 1, 0, 1}};
+  auto const upper =
+    fixed_width_column_wrapper<int64_t>{{9, 20, 29, 40, 10, 0}, {1, 1, 1, 1, 1, 0}};
+  auto const expect = fixed_width_column_wrapper<bool>{0, 1, 0, 0, 1, 1};
+
+  auto const index = cudf::membership_index(haystack);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.intersects(lower, upper), expect);
+
+  auto const short_upper = fixed_width_column_wrapper<int64_t>{9};
+  EXPECT_THROW(index.intersects(lower, short_upper), std::invalid_argument);
+}
+
+TEST_F(SearchTest, membership_index_empty_haystack)
+{
+  auto const haystack = fixed_width_column_wrapper<float>{{1.f, 2.f}, {0, 0}};
+  auto const needles  = fixed_width_column_wrapper<float>{1.f, 2.f};
+  auto const expect   = fixed_width_column_wrapper<bool>{0, 0};
+
+  auto const index = cudf::membership_index(haystack);
+  EXPECT_EQ(index.keys().size(), 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.contains(needles), expect);
+}
+
+TEST_F(SearchTest, large_haystack_sorted_and_unsorted_values)
+{
+  // every value appears twice in a haystack large enough for the two-level search
+  auto const num_rows = 200000;
+  auto haystack_values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i / 2; });
+  fixed_width_column_wrapper<int32_t> column(haystack_values, haystack_values + num_rows);
+
+  auto const num_values = 5000;
+  for (bool const sorted : {true, false}) {
+    std::vector<int32_t> values(num_values);
+    std::vector<size_type> lower(num_values);
+    std::vector<size_type> upper(num_values);
+    for (int i = 0; i < num_values; ++i) {
+      // values below, inside and above the haystack range
+      values[i] = (sorted ? i : (i * 7919) % num_values) * 23 - 1000;
+      lower[i]  = std::clamp(values[i] * 2, 0, num_rows);
+      upper[i]  = std::clamp(values[i] * 2 + 2, 0, num_rows);
+    }
+    fixed_width_column_wrapper<int32_t> needles(values.begin(), values.end());
+
+    auto const result_lower = cudf::lower_bound({cudf::table_view{{column}}},
+                                                {cudf::table_view{{needles}}},
+                                                {cudf::order::ASCENDING},
+                                                {cudf::null_order::BEFORE});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      *result_lower, fixed_width_column_wrapper<size_type>(lower.begin(), lower.end()));
+    auto const result_upper = cudf::upper_bound({cudf::table_view{{column}}},
+                                                {cudf::table_view{{needles}}},
+                                                {cudf::order::ASCENDING},
+                                                {cudf::null_order::BEFORE});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      *result_upper, fixed_width_column_wrapper<size_type>(upper.begin(), upper.end()));
+  }
+}
+
+TEST_F(SearchTest, large_haystack_strings_descending)
+{
+  auto const num_rows = 100000;
+  auto const to_key   = [](int i) {
+    auto key = std::to_string(i);
+    return std::string(6 - key.size(), '0') + key;
+  };
+  std::vector<std::string> keys(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    keys[i] = to_key(num_rows - 1 - i);
+  }
+  cudf::test::strings_column_wrapper column(keys.begin(), keys.end());
+
+  std::vector<std::string> values;
+  std::vector<size_type> lower;
+  std::vector<size_type> upper;
+  for (int i = 0; i < 3000; ++i) {
+    auto const key = (i * 7919) % num_rows;
+    values.push_back(to_key(key));
+    lower.push_back(num_rows - 1 - key);
+    upper.push_back(num_rows - key);
+  }
+  cudf::test::strings_column_wrapper needles(values.begin(), values.end());
+
+  auto const result_lower = cudf::lower_bound({cudf::table_view{{column}}},
+                                              {cudf::table_view{{needles}}},
+                                              {cudf::order::DESCENDING},
+                                              {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result_lower, fixed_width_column_wrapper<size_type>(lower.begin(), lower.end()));
+  auto const result_upper = cudf::upper_bound({cudf::table_view{{column}}},
+                                              {cudf::table_view{{needles}}},
+                                              {cudf::order::DESCENDING},
+                                              {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result_upper, fixed_width_column_wrapper<size_type>(upper.begin(), upper.end()));
+}
+
 template <typename T>
 struct FixedPointTestAllReps : public cudf::test::BaseFixture {};
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::unique_ptr<cudf::table> merge_all_chunks(cudf::external_sorter& sorter, int& num_chunks)
+{
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (sorter.has_next()) {
+    chunks.push_back(sorter.next_chunk());
+  }
+  num_chunks = static_cast<int>(chunks.size());
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) {
+    views.push_back(chunk->view());
+  }
+  return cudf::concatenate(views);
+}
+
+}  // namespace
+
+struct ExternalSortTest : public cudf::test::BaseFixture {};
+
+TEST_F(ExternalSortTest, MatchesSort)
+{
+  auto constexpr num_batches = 4;
+  auto constexpr batch_rows  = 2000;
+
+  auto const int_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>((i * 7919) % 1000); });
+  auto const valid_it =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  auto const str_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "s" + std::to_string((i * 31) % 97); });
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(
+    int_it, int_it + num_batches * batch_rows, valid_it);
+  cudf::test::strings_column_wrapper strs(str_it, str_it + num_batches * batch_rows);
+  auto const input = cudf::table_view{{ints, strs}};
+
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER,
+                                                      cudf::null_order::BEFORE};
+  cudf::external_sorter sorter({0, 1}, column_order, null_precedence, 1024);
+  for (auto const& batch : cudf::split(input, {batch_rows, 2 * batch_rows, 3 * batch_rows})) {
+    sorter.add_batch(batch);
+  }
+  EXPECT_EQ(sorter.num_runs(), num_batches);
+
+  int num_chunks    = 0;
+  auto const result = merge_all_chunks(sorter, num_chunks);
+  EXPECT_GT(num_chunks, 1);
+  auto const expect = cudf::sort(input, column_order, null_precedence);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expect->view(), result->view());
+}
+
+TEST_F(ExternalSortTest, PayloadColumns)
+{
+  auto constexpr num_rows = 3000;
+
+  // the keys are distinct, so the order of the rows is fully determined
+  auto const key_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>((i * 7919) % num_rows); });
+  auto const value_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>((i * 7919) % num_rows) / 2; });
+  cudf::test::fixed_width_column_wrapper<double> values(value_it, value_it + num_rows);
+  cudf::test::fixed_width_column_wrapper<int64_t> keys(key_it, key_it + num_rows);
+  auto const input = cudf::table_view{{values, keys}};
+
+  cudf::external_sorter sorter({1}, {cudf::order::ASCENDING}, {}, 512);
+  for (auto const& batch : cudf::split(input, {100, 1700, 1800})) {
+    sorter.add_batch(batch);
+  }
+
+  int num_chunks    = 0;
+  auto const result = merge_all_chunks(sorter, num_chunks);
+  auto const expect = cudf::sort_by_key(input, cudf::table_view{{keys}});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expect->view(), result->view());
+}
+
+TEST_F(ExternalSortTest, EmptyBatches)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> empty{};
+  cudf::test::fixed_width_column_wrapper<int32_t> batch{3, 1, 2};
+
+  cudf::external_sorter sorter({0}, {cudf::order::ASCENDING}, {}, 1 << 20);
+  EXPECT_FALSE(sorter.has_next());
+  sorter.add_batch(cudf::table_view{{empty}});
+  sorter.add_batch(cudf::table_view{{batch}});
+  sorter.add_batch(cudf::table_view{{empty}});
+  EXPECT_EQ(sorter.num_runs(), 1);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect{1, 2, 3};
+  auto const result = sorter.next_chunk();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expect}}, result->view());
+  EXPECT_FALSE(sorter.has_next());
+}
+
+TEST_F(ExternalSortTest, InvalidArguments)
+{
+  EXPECT_THROW(cudf::external_sorter({0}, {}, {}, 1024), cudf::logic_error);
+  EXPECT_THROW(cudf::external_sorter({0}, {cudf::order::ASCENDING}, {}, 0), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2};
+  cudf::test::fixed_width_column_wrapper<int64_t> longs{1, 2};
+  cudf::external_sorter sorter({0}, {cudf::order::ASCENDING}, {}, 1024);
+  EXPECT_THROW(sorter.next_chunk(), cudf::logic_error);
+  EXPECT_THROW(sorter.add_batch(cudf::table_view{}), cudf::logic_error);
+  sorter.add_batch(cudf::table_view{{ints}});
+  EXPECT_THROW(sorter.add_batch(cudf::table_view{{longs}}), cudf::logic_error);
+
+  auto const result = sorter.next_chunk();
+  EXPECT_THROW(sorter.add_batch(cudf::table_view{{ints}}), cudf::logic_error);
+}
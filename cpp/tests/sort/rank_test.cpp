@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -919,3 +919,58 @@ TYPED_TEST(RankListAndStruct, min_desc_bottom_pct)
     2.0 / 8.0, 1.0 / 8.0, 7.0 / 8.0, 5.0 / 8.0, 7.0 / 8.0, 5.0 / 8.0, 3.0 / 8.0, 4.0 / 8.0};
   this->run_all_tests(cudf::rank_method::MIN, desc_bottom, col_rank, struct_rank, true);
 }
+
+struct RankFromSortedOrder : public cudf::test::BaseFixture {};
+
+TEST_F(RankFromSortedOrder, MatchesRank)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{5, 4, 3, 5, 8, 5, 0, 4}, nulls_at({6})};
+  auto const methods = {cudf::rank_method::FIRST,
+                        cudf::rank_method::AVERAGE,
+                        cudf::rank_method::MIN,
+                        cudf::rank_method::MAX,
+                        cudf::rank_method::DENSE};
+  for (auto const& [column_order, null_handling, null_precedence] :
+       {asc_keep, asc_top, desc_keep, desc_bottom}) {
+    auto const sorted_order =
+      cudf::stable_sorted_order(cudf::table_view{{input}}, {column_order}, {null_precedence});
+    for (auto const method : methods) {
+      for (auto const percentage : {false, true}) {
+        auto const expect =
+          cudf::rank(input, method, column_order, null_handling, null_precedence, percentage);
+        auto const result =
+          cudf::rank(input, sorted_order->view(), method, null_handling, percentage);
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect->view(), result->view());
+      }
+    }
+  }
+}
+
+TEST_F(RankFromSortedOrder, Presorted)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{1, 2, 2, 4, 5};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> sequence{0, 1, 2, 3, 4};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> min_rank{1, 2, 2, 4, 5};
+  auto result =
+    cudf::rank(input, sequence, cudf::rank_method::MIN, cudf::null_policy::INCLUDE, false);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(min_rank, result->view());
+
+  cudf::test::fixed_width_column_wrapper<double> dense_pct{0.25, 0.5, 0.5, 0.75, 1.0};
+  result = cudf::rank(input, sequence, cudf::rank_method::DENSE, cudf::null_policy::INCLUDE, true);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(dense_pct, result->view());
+}
+
+TEST_F(RankFromSortedOrder, InvalidSortedOrder)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{3, 1, 2};
+  cudf::test::fixed_width_column_wrapper<int64_t> wrong_type{1, 2, 0};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> wrong_size{1, 2};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> with_nulls{{1, 2, 0}, null_at(0)};
+
+  auto const method = cudf::rank_method::FIRST;
+  auto const nulls  = cudf::null_policy::INCLUDE;
+  EXPECT_THROW(cudf::rank(input, wrong_type, method, nulls, false), cudf::data_type_error);
+  EXPECT_THROW(cudf::rank(input, wrong_size, method, nulls, false), cudf::logic_error);
+  EXPECT_THROW(cudf::rank(input, with_nulls, method, nulls, false), cudf::logic_error);
+}
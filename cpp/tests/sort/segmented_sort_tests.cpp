@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/sorting.hpp>
 
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -338,3 +339,81 @@ TEST_F(SegmentedSortInt, Bool)
   result = cudf::stable_segmented_sorted_order(cudf::table_view({test_col}), segments);
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result->view(), expected);
 }
+
+TEST_F(SegmentedSortInt, MixedSegmentSizes)
+{
+  // segments sorted by warps, by blocks and by the sort of the large segments
+  std::vector<int> const sizes{0, 1, 2, 5, 17, 32, 33, 100, 1024, 1025, 3, 3000, 31, 700};
+  std::vector<int> offsets{0};
+  std::vector<int> segment_ids;
+  for (std::size_t s = 0; s < sizes.size(); ++s) {
+    offsets.push_back(offsets.back() + sizes[s]);
+    segment_ids.insert(segment_ids.end(), sizes[s], static_cast<int>(s));
+  }
+  auto const num_rows = offsets.back();
+
+  std::vector<double> values;
+  std::vector<std::string> strings;
+  std::vector<bool> valids;
+  for (int i = 0; i < num_rows; ++i) {
+    values.push_back(static_cast<double>((i * 7919) % 37) / 4);
+    strings.push_back(std::to_string((i * 31) % 11));
+    valids.push_back(i % 9 != 0);
+  }
+  cudf::test::fixed_width_column_wrapper<double> col0(values.begin(), values.end(), valids.begin());
+  cudf::test::strings_column_wrapper col1(strings.begin(), strings.end());
+  cudf::test::fixed_width_column_wrapper<int> ids(segment_ids.begin(), segment_ids.end());
+  column_wrapper<int> segments(offsets.begin(), offsets.end());
+  cudf::table_view keys{{col0, col1}};
+
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER,
+                                                      cudf::null_order::BEFORE};
+  auto const expected = cudf::stable_sorted_order(
+    cudf::table_view{{ids, col0, col1}},
+    {cudf::order::ASCENDING, column_order[0], column_order[1]},
+    {cudf::null_order::AFTER, null_precedence[0], null_precedence[1]});
+
+  auto result =
+    cudf::stable_segmented_sorted_order(keys, segments, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->view());
+  result = cudf::segmented_sorted_order(keys, segments, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(SegmentedSortInt, StringPrefixes)
+{
+  // strings tied on their prefixes, strings that are prefixes of others, and empty strings
+  std::vector<int> const sizes{1, 7, 32, 33, 500, 2000};
+  std::vector<int> offsets{0};
+  std::vector<int> segment_ids;
+  for (std::size_t s = 0; s < sizes.size(); ++s) {
+    offsets.push_back(offsets.back() + sizes[s]);
+    segment_ids.insert(segment_ids.end(), sizes[s], static_cast<int>(s));
+  }
+  auto const num_rows = offsets.back();
+
+  std::vector<std::string> const heads{"", "abc", "abcdefghijkl", "abcdefghijklm", "zz"};
+  std::vector<std::string> strings;
+  std::vector<bool> valids;
+  for (int i = 0; i < num_rows; ++i) {
+    strings.push_back(heads[(i * 7) % heads.size()] + std::to_string((i * 31) % 13).substr(i % 2));
+    valids.push_back(i % 11 != 0);
+  }
+  cudf::test::strings_column_wrapper col(strings.begin(), strings.end(), valids.begin());
+  cudf::test::fixed_width_column_wrapper<int> ids(segment_ids.begin(), segment_ids.end());
+  column_wrapper<int> segments(offsets.begin(), offsets.end());
+  cudf::table_view keys{{col}};
+
+  for (auto const column_order : {cudf::order::ASCENDING, cudf::order::DESCENDING}) {
+    for (auto const null_precedence : {cudf::null_order::BEFORE, cudf::null_order::AFTER}) {
+      auto const expected =
+        cudf::stable_sorted_order(cudf::table_view{{ids, col}},
+                                  {cudf::order::ASCENDING, column_order},
+                                  {cudf::null_order::AFTER, null_precedence});
+      auto const result =
+        cudf::stable_segmented_sorted_order(keys, segments, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->view());
+    }
+  }
+}
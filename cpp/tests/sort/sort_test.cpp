@@ -30,6 +30,10 @@
 #include <thrust/host_vector.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -1045,6 +1049,22 @@ TYPED_TEST(SortFixedPointTest, SortedOrderGather)
 
 struct SortCornerTest : public cudf::test::BaseFixture {};
 
+TEST_F(SortCornerTest, EstimateMemory)
+{
+  using int_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+  int_col col1{{1, 2, 3, 1, 2, 3}};
+  int_col col2{{1, 1, 1, 2, 2, 2}};
+
+  // a single column is sorted in place, through a double buffer of its values
+  auto const single = cudf::estimate_sort_memory(cudf::table_view{{col1}});
+  EXPECT_EQ(single.output_bytes, 6 * sizeof(int32_t));
+  EXPECT_EQ(single.temporary_bytes, 6 * sizeof(int32_t));
+
+  auto const multiple = cudf::estimate_sort_memory(cudf::table_view{{col1, col2}});
+  EXPECT_EQ(multiple.output_bytes, 2 * 6 * sizeof(int32_t));
+  EXPECT_EQ(multiple.temporary_bytes, 2 * 6 * sizeof(cudf::size_type));
+}
+
 TEST_F(SortCornerTest, WithEmptyStructColumn)
 {
   using int_col = cudf::test::fixed_width_column_wrapper<int32_t>;
@@ -1114,4 +1134,137 @@ TEST_F(SortDouble, InfinityAndNan)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
 
+struct SortNormalizedKeys : public cudf::test::BaseFixture {};
+
+TEST_F(SortNormalizedKeys, LongStringsWithCommonPrefix)
+{
+  auto const a15 = std::string(15, 'a');
+  auto const a16 = std::string(16, 'a');
+  auto const a19 = std::string(19, 'a');
+  cudf::test::strings_column_wrapper col0{a19 + "z", a19 + "y", "b", a19 + "z", a15, a16};
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{2, 5, 0, 1, 7, 3};
+  cudf::table_view input{{col0, col1}};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{4, 5, 1, 3, 0, 2};
+  auto got = cudf::stable_sorted_order(input);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  run_sort_test(input, expected);
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_desc{2, 3, 0, 1, 5, 4};
+  std::vector<cudf::order> column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  got = cudf::stable_sorted_order(input, column_order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, got->view());
+
+  // sliced columns
+  auto const sliced = cudf::slice(input, {1, 6}).front();
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_sliced{3, 4, 0, 2, 1};
+  got = cudf::stable_sorted_order(sliced);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sliced, got->view());
+}
+
+TEST_F(SortNormalizedKeys, FloatsWithNulls)
+{
+  auto constexpr NaN = std::numeric_limits<double>::quiet_NaN();
+  cudf::test::fixed_width_column_wrapper<double> col0{{NaN, -0.0, 0.0, -1.5, 0.0, 2.0, -NaN},
+                                                      {1, 1, 1, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{1, 2, 1, 0, 3, 0, 0};
+  cudf::table_view input{{col0, col1}};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{3, 2, 1, 5, 6, 0, 4};
+  auto got =
+    cudf::stable_sorted_order(input, {}, {cudf::null_order::AFTER, cudf::null_order::AFTER});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_desc{4, 6, 0, 5, 2, 1, 3};
+  got = cudf::stable_sorted_order(input,
+                                  {cudf::order::DESCENDING, cudf::order::ASCENDING},
+                                  {cudf::null_order::AFTER, cudf::null_order::AFTER});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, got->view());
+}
+
+TEST_F(SortNormalizedKeys, ChronoAndFixedPoint)
+{
+  using decimal64 = numeric::decimal64;
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> col0{
+    -5, 3, -5, 0, 3};
+  cudf::test::fixed_point_column_wrapper<decimal64::rep> col1{{-100, 50, -200, 0, 50},
+                                                              numeric::scale_type{-2}};
+  cudf::table_view input{{col0, col1}};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{2, 0, 3, 1, 4};
+  auto got = cudf::stable_sorted_order(input);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_desc{1, 4, 3, 0, 2};
+  got = cudf::stable_sorted_order(input, {cudf::order::DESCENDING, cudf::order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, got->view());
+}
+
+struct SortStrings : public cudf::test::BaseFixture {};
+
+TEST_F(SortStrings, PrefixesAndZeroBytes)
+{
+  std::vector<std::string> const strings{"abcdefghij",
+                                         "abcdefg",
+                                         std::string("ab\0", 3),
+                                         "",
+                                         "abcdefghi",
+                                         "ab",
+                                         std::string("abcdefg\0", 8),
+                                         "abcdefgh",
+                                         "b",
+                                         "abcdefg"};
+  cudf::test::strings_column_wrapper input(strings.begin(), strings.end());
+
+  cudf::table_view const table{{input}};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{3, 5, 2, 1, 9, 6, 7, 4, 0, 8};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, cudf::stable_sorted_order(table)->view());
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_desc{
+    8, 0, 4, 7, 6, 1, 9, 2, 5, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_desc, cudf::stable_sorted_order(table, {cudf::order::DESCENDING})->view());
+}
+
+TEST_F(SortStrings, LongCommonPrefixesWithNulls)
+{
+  auto constexpr num_rows = 3000;
+
+  // the strings share up to 100 bytes, more than the bytes sorted by the radix passes
+  std::vector<std::string> strings;
+  for (int i = 0; i < num_rows; ++i) {
+    strings.push_back(std::string((i * 7) % 101, 'x') + std::to_string((i * 7919) % 89));
+  }
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  cudf::test::strings_column_wrapper input(strings.begin(), strings.end(), valids);
+  auto const sliced = cudf::slice(input, {5, num_rows}).front();
+
+  for (auto const column_order : {cudf::order::ASCENDING, cudf::order::DESCENDING}) {
+    for (auto const null_precedence : {cudf::null_order::BEFORE, cudf::null_order::AFTER}) {
+      std::vector<cudf::size_type> expected(sliced.size());
+      std::iota(expected.begin(), expected.end(), 0);
+      auto const nulls_first = (null_precedence == cudf::null_order::BEFORE) ==
+                               (column_order == cudf::order::ASCENDING);
+      std::stable_sort(expected.begin(), expected.end(), [&](auto lhs, auto rhs) {
+        auto const lhs_null = (lhs + 5) % 13 == 0;
+        auto const rhs_null = (rhs + 5) % 13 == 0;
+        if (lhs_null or rhs_null) {
+          return nulls_first ? lhs_null and not rhs_null : rhs_null and not lhs_null;
+        }
+        auto const& lhs_str = strings[lhs + 5];
+        auto const& rhs_str = strings[rhs + 5];
+        return column_order == cudf::order::ASCENDING ? lhs_str < rhs_str : rhs_str < lhs_str;
+      });
+
+      cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_col(expected.begin(),
+                                                                           expected.end());
+      auto const got =
+        cudf::stable_sorted_order(cudf::table_view{{sliced}}, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_col, got->view());
+    }
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
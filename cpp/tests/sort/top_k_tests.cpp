@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using cudf::test::iterators::null_at;
+
+template <typename T>
+struct TopK : public cudf::test::BaseFixture {};
+
+TYPED_TEST_SUITE(TopK, cudf::test::NumericTypes);
+
+TYPED_TEST(TopK, WithNulls)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> input{{4, 1, 0, 7, 3, 7}, null_at(2)};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_desc{3, 5, 0};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_asc{1, 4, 0};
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expect_top{7, 7, 4};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_desc, *cudf::top_k_order(input, 3));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_asc, *cudf::top_k_order(input, 3, cudf::order::ASCENDING));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_top, *cudf::top_k(input, 3));
+}
+
+struct TopKMisc : public cudf::test::BaseFixture {};
+
+TEST_F(TopKMisc, KLargerThanInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{2, 9, 0, 5}, null_at(2)};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect{9, 5, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, *cudf::top_k(input, 100));
+}
+
+TEST_F(TopKMisc, ZeroK)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{2, 9, 5};
+
+  auto const result = cudf::top_k_order(input, 0);
+  EXPECT_EQ(result->size(), 0);
+  EXPECT_EQ(result->type().id(), cudf::type_id::INT32);
+}
+
+TEST_F(TopKMisc, Strings)
+{
+  cudf::test::strings_column_wrapper input{{"pear", "", "apple", "zebra", "fig"}, null_at(1)};
+
+  cudf::test::strings_column_wrapper expect{"zebra", "pear"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, *cudf::top_k(input, 2));
+}
+
+TEST_F(TopKMisc, NegativeK)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{2, 9, 5};
+  EXPECT_THROW(cudf::top_k_order(input, -1), std::invalid_argument);
+}
+
+struct TopKTable : public cudf::test::BaseFixture {};
+
+TEST_F(TopKTable, Basic)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0{1, 3, 1, 2, 1};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1{5, 0, 4, 9, 4};
+  cudf::test::strings_column_wrapper values{"a", "b", "c", "d", "e"};
+  cudf::table_view keys{{keys0, keys1}};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect{2, 4, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, *cudf::top_k_order(keys, 3));
+
+  cudf::test::strings_column_wrapper expect_values{"c", "e", "a"};
+  auto const result = cudf::top_k_by_key(cudf::table_view{{values}}, keys, 3);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expect_values}}, *result);
+
+  // descending order of the first column
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_desc{1, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expect_desc,
+    *cudf::top_k_order(keys, 2, {cudf::order::DESCENDING, cudf::order::ASCENDING}));
+}
+
+TEST_F(TopKTable, MatchesStableSortedOrder)
+{
+  auto constexpr num_rows = 10000;
+
+  // Few distinct values in the leading column, so many rows tie on the leading key bytes
+  auto const lead_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i % 3) << 40; });
+  auto const int_it =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % 997; });
+  auto const str_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(20, 'x') + std::to_string((i * 31) % 101); });
+  auto const valid_it =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  cudf::test::fixed_width_column_wrapper<int64_t> lead(lead_it, lead_it + num_rows);
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(int_it, int_it + num_rows, valid_it);
+  cudf::test::strings_column_wrapper strs(str_it, str_it + num_rows);
+
+  std::vector<std::pair<std::vector<cudf::order>, std::vector<cudf::null_order>>> const orders{
+    {{}, {}},
+    {{cudf::order::ASCENDING, cudf::order::DESCENDING, cudf::order::ASCENDING},
+     {cudf::null_order::AFTER, cudf::null_order::AFTER, cudf::null_order::AFTER}},
+    {{cudf::order::DESCENDING, cudf::order::ASCENDING, cudf::order::DESCENDING}, {}}};
+  for (auto const& keys : {cudf::table_view{{lead, ints}}, cudf::table_view{{ints, strs, lead}}}) {
+    for (auto const& [column_order, null_precedence] : orders) {
+      auto const num_columns = static_cast<std::size_t>(keys.num_columns());
+      auto const col_order =
+        column_order.empty() ? column_order
+                             : std::vector<cudf::order>(column_order.begin(),
+                                                        column_order.begin() + num_columns);
+      auto const null_prec =
+        null_precedence.empty()
+          ? null_precedence
+          : std::vector<cudf::null_order>(null_precedence.begin(),
+                                          null_precedence.begin() + num_columns);
+      auto const sorted = cudf::stable_sorted_order(keys, col_order, null_prec);
+      for (auto const k : {1, 10, 2000, num_rows - 1, num_rows, 2 * num_rows}) {
+        auto const expect = cudf::slice(sorted->view(), {0, std::min(k, num_rows)}).front();
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, *cudf::top_k_order(keys, k, col_order, null_prec));
+      }
+    }
+  }
+}
+
+TEST_F(TopKTable, NestedKeys)
+{
+  using lcw = cudf::test::lists_column_wrapper<int32_t>;
+  lcw keys0{{3, 1}, {1}, {2, 5}, {1, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1{0, 1, 2, 3};
+  cudf::table_view keys{{keys0, keys1}};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect{1, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, *cudf::top_k_order(keys, 2));
+}
+
+TEST_F(TopKTable, InvalidArguments)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0{2, 9, 5};
+  cudf::table_view keys{{keys0}};
+  EXPECT_THROW(cudf::top_k_order(keys, -1), std::invalid_argument);
+  EXPECT_THROW(cudf::top_k_order(keys, 1, {cudf::order::ASCENDING, cudf::order::ASCENDING}),
+               cudf::logic_error);
+  EXPECT_EQ(cudf::top_k_order(keys, 0)->size(), 0);
+}
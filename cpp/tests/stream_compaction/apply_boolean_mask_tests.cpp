@@ -34,6 +34,10 @@
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <string>
+#include <vector>
 
 struct ApplyBooleanMask : public cudf::test::BaseFixture {};
 
@@ -375,4 +379,124 @@ TEST_F(ApplyBooleanMask, StructOfListsFiltering)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(filtered_lists_column, expected_structs_column);
 }
 
+TEST_F(ApplyBooleanMask, MixedColumnsManyBlocks)
+{
+  // spans several blocks and several rows per thread, with runs of rows not passing the mask
+  constexpr cudf::size_type num_rows = 100'000;
+  auto const mask_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 7 != 0) && (i / 1000 % 5 != 2); });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const values = thrust::make_counting_iterator(0);
+  auto const strings =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(values, values + num_rows, validity);
+  cudf::test::fixed_width_column_wrapper<double> col2(values, values + num_rows);
+  cudf::test::fixed_width_column_wrapper<int8_t> col3(values, values + num_rows, validity);
+  cudf::test::strings_column_wrapper col4(strings, strings + num_rows, validity);
+  cudf::table_view input{{col1, col2, col3, col4}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask(mask_values, mask_values + num_rows);
+
+  std::vector<cudf::size_type> indices;
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    if (mask_values[i]) { indices.push_back(i); }
+  }
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> gather_map(indices.begin(),
+                                                                     indices.end());
+  auto const expected = cudf::gather(input, gather_map);
+
+  auto const got = cudf::apply_boolean_mask(input, boolean_mask);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(ApplyBooleanMask, DeferredSize)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col1{{1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<double> col2{10, 40, 70, 5, 2, 10};
+  cudf::table_view input{{col1, col2}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, false, true, true},
+                                                            {1, 1, 1, 1, 1, 0}};
+
+  auto deferred = cudf::apply_boolean_mask_deferred(input, boolean_mask);
+  EXPECT_EQ(deferred.capacity(), 6);
+  EXPECT_EQ(deferred.capacity_view().num_columns(), 2);
+  auto got = deferred.release();
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::apply_boolean_mask(input, boolean_mask)->view(), got->view());
+  EXPECT_EQ(got->get_column(0).null_count(), 1);
+  EXPECT_EQ(deferred.capacity(), 0);
+}
+
+TEST_F(ApplyBooleanMask, DeferredSizeEmpty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  cudf::table_view input{{col}};
+
+  auto none = cudf::apply_boolean_mask_deferred(
+                input, cudf::test::fixed_width_column_wrapper<bool>{false, false, false})
+                .release();
+  EXPECT_EQ(none->num_rows(), 0);
+
+  auto empty_mask =
+    cudf::apply_boolean_mask_deferred(input, cudf::test::fixed_width_column_wrapper<bool>{})
+      .release();
+  EXPECT_EQ(empty_mask->num_rows(), 0);
+  EXPECT_EQ(empty_mask->num_columns(), 1);
+}
+
+TEST_F(ApplyBooleanMask, DeferredSizeNonFixedWidth)
+{
+  cudf::test::strings_column_wrapper col{"a", "b"};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{true, false};
+  EXPECT_THROW(cudf::apply_boolean_mask_deferred(cudf::table_view{{col}}, boolean_mask),
+               cudf::data_type_error);
+}
+
+TEST_F(ApplyBooleanMask, SelectionVector)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col1{{1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper col2{"a", "b", "c", "d", "e", "f"};
+  cudf::table_view input{{col1, col2}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, false, true, true},
+                                                            {1, 1, 1, 1, 1, 0}};
+
+  auto const selection = cudf::make_selection_vector(boolean_mask);
+  EXPECT_EQ(selection.size(), 3);
+  EXPECT_EQ(selection.source_rows(), 6);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<cudf::size_type>{0, 2, 4},
+                                 selection.gather_map());
+
+  auto const got = cudf::materialize(input, selection);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::apply_boolean_mask(input, boolean_mask)->view(), got->view());
+
+  // only the selected rows of the columns that are read are copied
+  auto const keys = cudf::materialize(input.select({1}), selection);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::strings_column_wrapper{"a", "c", "e"},
+                                 keys->get_column(0).view());
+
+  EXPECT_THROW(cudf::materialize(cudf::slice(input, {0, 5})[0], selection), std::invalid_argument);
+}
+
+TEST_F(ApplyBooleanMask, SelectionVectorToSourceRows)
+{
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{false, true, false, true, true};
+  auto const selection = cudf::make_selection_vector(boolean_mask);
+
+  // e.g. the gather map of an outer join on the materialized rows, with a no-match marker
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> rows{2, 0, -1, 1, 3};
+  auto const view   = cudf::column_view{rows};
+  auto const source = cudf::to_source_rows(
+    cudf::device_span<cudf::size_type const>{view.data<cudf::size_type>(),
+                                             static_cast<std::size_t>(view.size())},
+    selection);
+  auto const got = cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                     static_cast<cudf::size_type>(source->size()),
+                                     source->data(),
+                                     nullptr,
+                                     0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{4, 1, -1, 3, 3}, got);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -28,6 +28,7 @@
 #include <cudf/types.hpp>
 
 #include <cmath>
+#include <stdexcept>
 
 auto constexpr null{0};  // null at current level
 auto constexpr XXX{0};   // null pushed down from parent level
@@ -1412,3 +1413,62 @@ TEST_F(DistinctKeepAny, SlicedStructsOfLists)
   auto const result_sort = cudf::sort_by_key(*result, result->select({0}));
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_sort, *result_sort);
 }
+
+struct DistinctByHash : public cudf::test::BaseFixture {};
+
+TEST_F(DistinctByHash, MatchesDistinctIndices)
+{
+  auto const col  = int32s_col{{5, null, null, 5, 5, 8, 1, 8}, nulls_at({1, 2})};
+  auto const keys = strings_col{{"all", "new", "new", "all", "", "the", "strings", "the"},
+                                null_at(4)};
+  auto const lists = lists_col{{1, 2}, {}, {}, {1, 2}, {3}, {4}, {}, {4}};
+  auto const input = cudf::table_view{{col, keys, lists}};
+
+  for (auto const keep : {KEEP_FIRST, KEEP_LAST, KEEP_NONE}) {
+    for (auto const width : {cudf::row_hash_width::BITS_64, cudf::row_hash_width::BITS_128}) {
+      auto const expected = cudf::distinct_indices(input, keep);
+      auto const result   = cudf::distinct_indices_by_hash(input, keep, width);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *result);
+
+      auto const verified = cudf::distinct_indices_by_hash(input, keep, width, true);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *verified);
+    }
+  }
+
+  // which of the equal rows is kept is unspecified
+  EXPECT_EQ(cudf::distinct_indices_by_hash(input)->size(), 5);
+}
+
+TEST_F(DistinctByHash, NaNsAndEmptyInput)
+{
+  auto const col    = floats_col{1., NaN, 2., NaN, 1.};
+  auto const result = cudf::distinct_indices_by_hash(cudf::table_view{{col}}, KEEP_FIRST);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int32s_col{0, 1, 2}, *result);
+
+  auto const empty = int32s_col{};
+  EXPECT_EQ(cudf::distinct_indices_by_hash(cudf::table_view{{empty}})->size(), 0);
+}
+
+TEST_F(DistinctByHash, StreamingDistinct)
+{
+  cudf::streaming_distinct events{2};
+
+  auto const ids1   = int32s_col{{1, 2, 1, null, 3}, null_at(3)};
+  auto const names1 = strings_col{"a", "b", "a", "c", "d"};
+  auto const first  = events.insert(cudf::table_view{{ids1, names1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int32s_col{0, 1, 3, 4}, *first);
+  EXPECT_EQ(events.size(), 4);
+
+  // grows the set past the expected number of rows
+  auto const ids2   = int32s_col{{2, null, 4, 5, 4, 6}, null_at(1)};
+  auto const names2 = strings_col{"b", "c", "e", "f", "e", "g"};
+  auto const second = events.insert(cudf::table_view{{ids2, names2}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int32s_col{2, 3, 5}, *second);
+  EXPECT_EQ(events.size(), 7);
+
+  auto const empty_ids   = int32s_col{};
+  auto const empty_names = strings_col{};
+  EXPECT_EQ(events.insert(cudf::table_view{{empty_ids, empty_names}})->size(), 0);
+
+  EXPECT_THROW(events.insert(cudf::table_view{{ids1}}), std::invalid_argument);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <string>
 #include <vector>
 
 struct StringsCaseTest : public cudf::test::BaseFixture {};
@@ -260,6 +261,28 @@ TEST_F(StringsCaseTest, LongStrings)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, cudf::slice(expected, {1, 3}).front());
 }
 
+TEST_F(StringsCaseTest, LongMultiCharStrings)
+{
+  // long enough for the warp-parallel path with ASCII-only and multi-byte chunks
+  auto const ascii = std::string("abcdefghijklmnopqrstuvwxyzABCDEFGHIJ0123456789!@#$%^&*()");
+  cudf::test::strings_column_wrapper input(
+    {ascii + "\u00df" + ascii + "\u0130" + ascii, "", ascii + ascii + "\u1e98", ascii},
+    {1, 1, 0, 1});
+  auto view = cudf::strings_column_view(input);
+
+  auto const lower = std::string("abcdefghijklmnopqrstuvwxyzabcdefghij0123456789!@#$%^&*()");
+  auto const upper = std::string("ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ0123456789!@#$%^&*()");
+  auto expected    = cudf::test::strings_column_wrapper(
+    {lower + "\u00df" + lower + "\u0069\u0307" + lower, "", "", lower}, {1, 1, 0, 1});
+  auto results = cudf::strings::to_lower(view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  expected = cudf::test::strings_column_wrapper(
+    {upper + "SS" + upper + "\u0130" + upper, "", "", upper}, {1, 1, 0, 1});
+  results = cudf::strings::to_upper(view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsCaseTest, EmptyStringsColumn)
 {
   auto const zero_size_strings_column = cudf::make_empty_column(cudf::type_id::STRING)->view();
@@ -24,6 +24,7 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <string>
 #include <vector>
 
 struct StringsCharsTest : public cudf::test::BaseFixture {};
@@ -243,6 +244,28 @@ TEST_F(StringsCharsTest, EmptyStrings)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsCharsTest, LongStrings)
+{
+  // long enough for the warp-parallel path
+  auto const alpha = std::string("abcdefghijklmnopqrstuvwxyzéABCDEFGHIJKLMNOPQRSTUVWXYZ");
+  cudf::test::strings_column_wrapper strings(
+    {alpha + alpha, alpha + "1" + alpha, std::string(100, ' '), alpha + "\u1e98" + alpha, ""},
+    {1, 1, 1, 0, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0}, {1, 1, 1, 0, 1});
+  auto results = cudf::strings::all_characters_of_type(
+    strings_view, cudf::strings::string_character_types::ALPHA);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // only the lower case characters are verified
+  expected = cudf::test::fixed_width_column_wrapper<bool>({1, 1, 0, 0, 0}, {1, 1, 1, 0, 1});
+  results  = cudf::strings::all_characters_of_type(strings_view,
+                                                  cudf::strings::string_character_types::LOWER,
+                                                  cudf::strings::string_character_types::LOWER);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsCharsTest, FilterCharTypes)
 {
   // The example strings are based on issue 5520
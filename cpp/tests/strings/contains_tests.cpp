@@ -24,11 +24,14 @@
 #include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <rmm/cuda_stream.hpp>
+
 #include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 struct StringsContainsTests : public cudf::test::BaseFixture {};
@@ -814,3 +817,108 @@ TEST_F(StringsContainsTests, ExtraLargeRegex)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
   }
 }
+
+TEST_F(StringsContainsTests, ShortAndLongPrograms)
+{
+  // short programs are evaluated with one bit per instruction, which the repeated
+  // alternatives of the same pattern exceed while matching the same strings
+  cudf::test::strings_column_wrapper input(
+    {"abc", "xabcx", "ab\nc", "aBC\n", "", "é abé", "abé\n", "12-ab", "a\nabc"},
+    {1, 1, 1, 1, 1, 1, 1, 1, 0});
+  auto const view = cudf::strings_column_view(input);
+
+  std::vector<std::string> const patterns{
+    "abc", "^ab", "c$", "^a[bB]", "[^a-z]", "ab.", "b[cé]", "\\d+-", "^$", "(a|b)+é$", "é"};
+  for (auto const& pattern : patterns) {
+    auto repeated = pattern;
+    for (int i = 0; i < 20; ++i) {
+      repeated += "|" + pattern;
+    }
+    for (auto const flags : {cudf::strings::regex_flags::DEFAULT,
+                             cudf::strings::regex_flags::MULTILINE,
+                             cudf::strings::regex_flags::DOTALL}) {
+      auto const prog      = cudf::strings::regex_program::create(pattern, flags);
+      auto const long_prog = cudf::strings::regex_program::create(repeated, flags);
+      EXPECT_GT(long_prog->instructions_count(), 64);
+
+      auto results = cudf::strings::contains_re(view, *prog);
+      auto expect  = cudf::strings::contains_re(view, *long_prog);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect, *results);
+      results = cudf::strings::matches_re(view, *prog);
+      expect  = cudf::strings::matches_re(view, *long_prog);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect, *results);
+    }
+  }
+
+  cudf::test::fixed_width_column_wrapper<bool> expect({1, 0, 1, 1, 1, 0, 1, 1, 0},
+                                                      {1, 1, 1, 1, 1, 1, 1, 1, 0});
+  auto const prog    = cudf::strings::regex_program::create("^[a\\d]|^$");
+  auto const results = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect, *results);
+}
+
+TEST_F(StringsContainsTests, RequiredLiteral)
+{
+  cudf::test::strings_column_wrapper input({"ERROR: timeout 30",
+                                            "ERROR timeout",
+                                            "WARN: timeout 30",
+                                            "xERROR timeout 1",
+                                            "",
+                                            "an ERROR, then timeout 5s",
+                                            "ERROR timeout 7"},
+                                           {1, 1, 1, 1, 1, 1, 0});
+  auto const view = cudf::strings_column_view(input);
+
+  // the word boundaries keep these patterns on the working memory path
+  auto prog = cudf::strings::regex_program::create("\\bERROR\\b.*timeout [0-9]+");
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 1, 0},
+                                                        {1, 1, 1, 1, 1, 1, 0});
+  auto results = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  expected = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0});
+  results  = cudf::strings::matches_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  // no literal is found in every match of the alternation
+  prog     = cudf::strings::regex_program::create("(ERROR|WARN)\\b");
+  expected = cudf::test::fixed_width_column_wrapper<bool>({1, 1, 1, 1, 0, 1, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0});
+  results  = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(StringsContainsTests, ReuseProgram)
+{
+  cudf::test::strings_column_wrapper input({"abc1", "xyz", "", "a1b2"}, {1, 1, 1, 0});
+  auto const view = cudf::strings_column_view(input);
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0}, {1, 1, 1, 0});
+
+  cudf::strings::regex_program_cache cache;
+  auto const prog = cache.get("[a-z]+\\d");
+  EXPECT_EQ(prog, cache.get("[a-z]+\\d"));
+  EXPECT_NE(prog, cache.get("[a-z]+\\d", cudf::strings::regex_flags::MULTILINE));
+  EXPECT_NE(prog, cache.get("[a-z]+\\d", {}, cudf::strings::capture_groups::NON_CAPTURE));
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_EQ(prog->capture(), cudf::strings::capture_groups::EXTRACT);
+
+  // the device program uploaded by the first call is reused by the later ones
+  auto results = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  rmm::cuda_stream other_stream;
+  results = cudf::strings::contains_re(view, *prog, other_stream.view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  prog->release_device_program(other_stream.view());
+  results = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  // invalid patterns are not cached
+  EXPECT_THROW(cache.get("3?+"), cudf::logic_error);
+  EXPECT_EQ(cache.size(), 3);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  results = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
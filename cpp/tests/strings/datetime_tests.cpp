@@ -303,6 +303,23 @@ TEST_F(StringsDatetimeTest, ToTimestampSingleDigits)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, is_expected);
 }
 
+TEST_F(StringsDatetimeTest, ToTimestampFixedWidthFormat)
+{
+  cudf::test::strings_column_wrapper strings({"2019-03-20T12:34:56",
+                                              "1969-12-31T23:59:59",
+                                              "",
+                                              "2024-02-29T00:00:00",
+                                              "2019-03-20T12:34:5Z"},
+                                             {1, 1, 0, 1, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::to_timestamps(
+    strings_view, cudf::data_type{cudf::type_id::TIMESTAMP_SECONDS}, "%Y-%m-%dT%H:%M:%S");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> expected(
+    {1553085296, -1, 0, 1709164800, 1553085245}, {1, 1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsDatetimeTest, IsTimestamp)
 {
   cudf::test::strings_column_wrapper strings{"2020-10-07 13:02:03 1PM +0130",
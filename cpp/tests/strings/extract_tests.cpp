@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -320,3 +320,16 @@ TEST_F(StringsExtractTests, LargeRegex)
     thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected);
 }
+
+TEST_F(StringsExtractTests, RequiredLiteral)
+{
+  cudf::test::strings_column_wrapper input(
+    {"ERROR: timeout 30", "ERROR timeout", "WARN: timeout 30", "xERROR timeout 1", "", "x"},
+    {1, 1, 1, 1, 1, 0});
+  auto const view = cudf::strings_column_view(input);
+
+  auto const prog    = cudf::strings::regex_program::create("\\bERROR\\b.*timeout ([0-9]+)");
+  auto const results = cudf::strings::extract(view, *prog);
+  cudf::test::strings_column_wrapper expected({"30", "", "", "", "", ""}, {1, 0, 0, 0, 0, 0});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*results, cudf::table_view{{expected}});
+}
@@ -22,6 +22,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
@@ -55,6 +56,72 @@ TEST_F(StringsFindMultipleTest, FindMultiple)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsFindMultipleTest, OverlappingTargets)
+{
+  auto strings      = cudf::test::strings_column_wrapper(
+    {"ushers", "she sells his shells", "hhhe", "", "héhers"}, {1, 1, 1, 1, 0});
+  auto strings_view = cudf::strings_column_view(strings);
+  auto targets      = cudf::test::strings_column_wrapper({"he", "she", "his", "hers", "", "he"});
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::find_multiple(strings_view, targets_view);
+
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW expected({LCW{2, 1, -1, 2, 0, 2},
+                LCW{1, 0, 10, -1, 0, 1},
+                LCW{2, -1, -1, -1, 0, 2},
+                LCW{-1, -1, -1, -1, 0, -1},
+                LCW{-1, -1, -1, -1, -1, -1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsFindMultipleTest, ContainsMultiple)
+{
+  std::vector<char const*> h_strings{"Héllo", "thesé", nullptr, "lease", "test strings", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto targets      = cudf::test::strings_column_wrapper({"é", "es", "", "xyz", "é"});
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::contains_multiple(strings_view, targets_view);
+  ASSERT_EQ(results->num_columns(), 5);
+
+  auto const validity = std::vector<bool>{1, 1, 0, 1, 1, 1};
+  using BCW           = cudf::test::fixed_width_column_wrapper<bool>;
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), BCW({1, 1, 0, 0, 0, 0}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), BCW({0, 1, 0, 0, 1, 0}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), BCW({1, 1, 0, 1, 1, 1}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(3), BCW({0, 0, 0, 0, 0, 0}, validity.begin()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(4), BCW({1, 1, 0, 0, 0, 0}, validity.begin()));
+}
+
+TEST_F(StringsFindMultipleTest, ContainsMultipleIndices)
+{
+  auto strings      = cudf::test::strings_column_wrapper(
+    {"she sells hers", "hello", "", "shehe", "his"}, {1, 1, 1, 1, 0});
+  auto strings_view = cudf::strings_column_view(strings);
+  auto targets      = cudf::test::strings_column_wrapper({"he", "she", "his", "hers", "sell"});
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::contains_multiple_indices(strings_view, targets_view);
+
+  using LCW           = cudf::test::lists_column_wrapper<int32_t>;
+  auto const validity = std::vector<bool>{1, 1, 1, 1, 0};
+  LCW expected({LCW{0, 1, 3, 4}, LCW{0}, LCW{}, LCW{0, 1}, LCW{}}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  // empty targets are found in every valid string
+  auto empty_targets = cudf::test::strings_column_wrapper({"x", "", "l"});
+  targets_view       = cudf::strings_column_view(empty_targets);
+  results            = cudf::strings::contains_multiple_indices(strings_view, targets_view);
+  LCW expected_empty({LCW{1, 2}, LCW{1, 2}, LCW{1}, LCW{1}, LCW{}}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_empty);
+}
+
 TEST_F(StringsFindMultipleTest, ZeroSizeStringsColumn)
 {
   auto const zero_size_strings_column = cudf::make_empty_column(cudf::type_id::STRING)->view();
@@ -79,4 +146,11 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
 
   // targets cannot have nulls
   EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
+
+  EXPECT_THROW(cudf::strings::contains_multiple(strings_view, empty_view), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::contains_multiple(strings_view, strings_view), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::contains_multiple_indices(strings_view, empty_view),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::strings::contains_multiple_indices(strings_view, strings_view),
+               cudf::logic_error);
 }
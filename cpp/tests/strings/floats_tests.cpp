@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <cstdlib>
 #include <vector>
 
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
@@ -152,6 +153,35 @@ TEST_F(StringsConvertTest, ToFloats64)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected, verbosity);
 }
 
+TEST_F(StringsConvertTest, ToFloats64CorrectlyRounded)
+{
+  std::vector<char const*> h_strings{"0.1",
+                                     "0.3",
+                                     "9007199254740993",
+                                     "1e23",
+                                     "8.41e21",
+                                     "-1.5e-10",
+                                     "2.2250738585072011e-308",
+                                     "2.4703282292062328e-324",
+                                     "4.9406564584124654e-324",
+                                     "1.7976931348623157e308",
+                                     "1.7976931348623159e308",
+                                     "3.14159265358979323846264338327950288",
+                                     "123456789012345678901234567890",
+                                     "0.000000000000000000000000000001234567890123456789"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+
+  std::vector<double> h_expected;
+  std::for_each(h_strings.begin(), h_strings.end(), [&](char const* str) {
+    h_expected.push_back(std::strtod(str, nullptr));
+  });
+
+  auto results = cudf::strings::to_floats(cudf::strings_column_view(strings),
+                                          cudf::data_type{cudf::type_id::FLOAT64});
+  cudf::test::fixed_width_column_wrapper<double> expected(h_expected.begin(), h_expected.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsConvertTest, FromFloats64)
 {
   std::vector<double> h_floats{100,
@@ -174,6 +174,66 @@ TEST_F(StringsLikeTests, MultiplePatterns)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
 
+TEST_F(StringsLikeTests, Segments)
+{
+  cudf::test::strings_column_wrapper input(
+    {"abba", "abxba", "aba", "aaa", "aa", "xaéyaz", "éaé", "ab%ba", ""});
+  auto const sv = cudf::strings_column_view(input);
+  {
+    auto const results = cudf::strings::like(sv, std::string("%ab%ba%"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {true, true, false, false, false, false, false, true, false});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("a%a%a"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, true, false, false, false, false, false});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("%a_y%z"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, false, false, true, false, false, false});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("%b\%b%"), std::string("\"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, false, false, false, false, true, false});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("%%"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {true, true, true, true, true, true, true, true, true});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+}
+
+TEST_F(StringsLikeTests, LikeAny)
+{
+  cudf::test::strings_column_wrapper input({"azaa", "ababaabba", "bbb", "xyz", "", "a_c", "abc"},
+                                           {1, 1, 1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper patterns({"%a", "b%", "%/_%"});
+  auto const sv_input    = cudf::strings_column_view(input);
+  auto const sv_patterns = cudf::strings_column_view(patterns);
+  auto const results     = cudf::strings::like_any(sv_input, sv_patterns, std::string("/"));
+  cudf::test::fixed_width_column_wrapper<bool> expected(
+    {true, true, true, false, false, true, false}, {1, 1, 1, 1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+
+  auto const empty = cudf::make_empty_column(cudf::type_id::STRING);
+  auto const none  = cudf::strings::like_any(sv_input, cudf::strings_column_view(empty->view()));
+  cudf::test::fixed_width_column_wrapper<bool> expected_none(
+    {false, false, false, false, false, false, false}, {1, 1, 1, 1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(none->view(), expected_none);
+
+  auto null_patterns = cudf::test::strings_column_wrapper({"3", ""}, {1, 0});
+  EXPECT_THROW(cudf::strings::like_any(sv_input, cudf::strings_column_view(null_patterns)),
+               cudf::logic_error);
+}
+
 TEST_F(StringsLikeTests, Empty)
 {
   cudf::test::strings_column_wrapper input({"ooo", "20%", ""});
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -440,3 +440,16 @@ TEST_F(StringsReplaceRegexTest, LargeReplaceRegex)
     thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
+
+TEST_F(StringsReplaceRegexTest, RequiredLiteral)
+{
+  cudf::test::strings_column_wrapper input(
+    {"ERROR: timeout", "an ERROR or ERROR", "WARN", "xERROR", "", "ERROR"}, {1, 1, 1, 1, 1, 0});
+  auto const view = cudf::strings_column_view(input);
+
+  auto const prog    = cudf::strings::regex_program::create("\\bERROR\\b");
+  auto const results = cudf::strings::replace_re(view, *prog, cudf::string_scalar("E"));
+  cudf::test::strings_column_wrapper expected(
+    {"E: timeout", "an E or E", "WARN", "xERROR", "", ""}, {1, 1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
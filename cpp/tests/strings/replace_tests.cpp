@@ -24,6 +24,7 @@
 #include <cudf/strings/replace.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <string>
 #include <vector>
 
 struct StringsReplaceTest : public cudf::test::BaseFixture {
@@ -515,6 +516,33 @@ TEST_F(StringsReplaceTest, ReplaceMultiLong)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceMultiTargetOrder)
+{
+  // the first of the targets starting at a position is replaced
+  auto targets      = cudf::test::strings_column_wrapper({"hers", "he", "she", ""});
+  auto targets_view = cudf::strings_column_view(targets);
+  auto repls        = cudf::test::strings_column_wrapper({"1", "2", "3", "4"});
+  auto repls_view   = cudf::strings_column_view(repls);
+
+  auto input =
+    cudf::test::strings_column_wrapper({"she sells hers", "ushers", "", "hex"}, {1, 1, 1, 0});
+  auto results =
+    cudf::strings::replace(cudf::strings_column_view(input), targets_view, repls_view);
+  auto expected = cudf::test::strings_column_wrapper({"3 sells 1", "u3rs", "", ""}, {1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // long enough for the character-parallel replace
+  std::string long_str;
+  std::string long_expected;
+  for (int i = 0; i < 20; ++i) {
+    long_str += "she sells hers ";
+    long_expected += "3 sells 1 ";
+  }
+  auto long_input = cudf::test::strings_column_wrapper({long_str});
+  results = cudf::strings::replace(cudf::strings_column_view(long_input), targets_view, repls_view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, cudf::test::strings_column_wrapper({long_expected}));
+}
+
 TEST_F(StringsReplaceTest, EmptyStringsColumn)
 {
   auto const zero_size_strings_column = cudf::make_empty_column(cudf::type_id::STRING)->view();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2024, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/split/partition.hpp>
@@ -259,6 +260,37 @@ TEST_F(StringsSplitTest, SplitRecord)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
 }
 
+TEST_F(StringsSplitTest, SplitRecordSliced)
+{
+  // delimiters crossing the 32-byte chunks of the chars column and the string boundaries
+  cudf::test::strings_column_wrapper strings({"a::b",
+                                              "ccccccccccccccccccccccccccccc::dd:::e",
+                                              "",
+                                              ":fff::gggggggggggggggggggggggggggggggggggg::",
+                                              ":h:"},
+                                             {1, 1, 0, 1, 1});
+  auto const sliced = cudf::slice(strings, {1, 5}).front();
+
+  auto result =
+    cudf::strings::split_record(cudf::strings_column_view(sliced), cudf::string_scalar("::"));
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected({LCW{"ccccccccccccccccccccccccccccc", "dd", ":e"},
+                LCW{},
+                LCW{":fff", "gggggggggggggggggggggggggggggggggggg", ""},
+                LCW{":h:"}},
+               cudf::test::iterators::null_at(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+
+  result =
+    cudf::strings::rsplit_record(cudf::strings_column_view(sliced), cudf::string_scalar("::"));
+  expected = LCW({LCW{"ccccccccccccccccccccccccccccc", "dd:", "e"},
+                  LCW{},
+                  LCW{":fff", "gggggggggggggggggggggggggggggggggggg", ""},
+                  LCW{":h:"}},
+                 cudf::test::iterators::null_at(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
 TEST_F(StringsSplitTest, SplitRecordWithMaxSplit)
 {
   std::vector<char const*> h_strings{" Héllo thesé", nullptr, "are some  ", "tést String", ""};
@@ -21,6 +21,9 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -295,3 +298,40 @@ TYPED_TEST(NaNTableViewTest, TestEqualityComparatorTwoTableNaNCase)
                        cudf::experimental::row::equality::nan_equal_physical_equality_comparator{});
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(nan_equal_expected, nan_equal_got->view());
 }
+
+TYPED_TEST(TypedTableViewTest, TestReusePreprocessedTable)
+{
+  using data_col    = cudf::test::fixed_width_column_wrapper<TypeParam>;
+  using strings_col = cudf::test::strings_column_wrapper;
+  using structs_col = cudf::test::structs_column_wrapper;
+
+  auto child0       = data_col{3, 1, 3, 2, 1};
+  auto child1       = strings_col{"b", "a", "b", "c", "d"};
+  auto const keys   = structs_col{{child0, child1}};
+  auto const input  = cudf::table_view{{keys}};
+  auto const stream = cudf::get_default_stream();
+  auto const mr     = rmm::mr::get_current_device_resource();
+
+  // A table preprocessed once is sorted several times.
+  auto const column_order = std::vector{cudf::order::DESCENDING};
+  auto const preprocessed_order =
+    cudf::experimental::row::lexicographic::preprocessed_table::create(
+      input, column_order, {}, stream);
+  auto const expected_order = cudf::sorted_order(input, column_order);
+  auto const order          = cudf::detail::sorted_order(input, preprocessed_order, stream, mr);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected_order, *order);
+  auto const stable_order =
+    cudf::detail::stable_sorted_order(input, preprocessed_order, stream, mr);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::stable_sorted_order(input, column_order), *stable_order);
+
+  auto const preprocessed_equality =
+    cudf::experimental::row::equality::preprocessed_table::create(input, stream);
+  auto const distinct = cudf::detail::distinct_indices(input,
+                                                       preprocessed_equality,
+                                                       cudf::duplicate_keep_option::KEEP_FIRST,
+                                                       cudf::null_equality::EQUAL,
+                                                       cudf::nan_equality::ALL_EQUAL,
+                                                       stream,
+                                                       mr);
+  EXPECT_EQ(distinct.size(), 4);
+}
@@ -25,6 +25,7 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <string>
 #include <vector>
 
 struct TextEditDistanceTest : public cudf::test::BaseFixture {};
@@ -57,6 +58,34 @@ TEST_F(TextEditDistanceTest, EditDistance)
   }
 }
 
+TEST_F(TextEditDistanceTest, EditDistanceLongStrings)
+{
+  auto repeat = [](std::string const& str, int count) {
+    std::string result;
+    for (int i = 0; i < count; ++i) {
+      result += str;
+    }
+    return result;
+  };
+  // strings longer than 64 characters span several machine words
+  cudf::test::strings_column_wrapper strings({repeat("x", 64),
+                                              repeat("x", 65),
+                                              repeat("abc", 30),
+                                              repeat("a", 150),
+                                              repeat("é", 100),
+                                              repeat("ab", 40)});
+  cudf::test::strings_column_wrapper targets({repeat("x", 65),
+                                              "y" + repeat("x", 64),
+                                              repeat("abd", 30),
+                                              repeat("a", 70),
+                                              repeat("e", 100),
+                                              repeat("ba", 40)});
+  auto results =
+    nvtext::edit_distance(cudf::strings_column_view(strings), cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 1, 30, 80, 100, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(TextEditDistanceTest, EditDistanceMatrix)
 {
   std::vector<char const*> h_strings{"dog", nullptr, "hog", "frog", "cat", "", "hat", "clog"};
@@ -22,6 +22,8 @@
 
 #include <nvtext/jaccard.hpp>
 
+#include <string>
+
 struct JaccardTest : public cudf::test::BaseFixture {};
 
 TEST_F(JaccardTest, Basic)
@@ -67,6 +69,38 @@ TEST_F(JaccardTest, WithNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
 }
 
+TEST_F(JaccardTest, LongStrings)
+{
+  // strings with too many substrings to be sorted in shared memory
+  auto const long1 = [] {
+    std::string str;
+    for (int i = 0; i < 200; ++i) {
+      str += "abcdefghij";
+    }
+    return str;
+  }();
+  auto const long2 = std::string(2000, 'z');
+
+  auto input1 = cudf::test::strings_column_wrapper(
+    {long1, std::string("the quick brown fox"), long1, std::string("short")});
+  auto input2 = cudf::test::strings_column_wrapper(
+    {long1, std::string("the slowest brown cat"), std::string("zzz"), long2});
+
+  auto view1 = cudf::strings_column_view(input1);
+  auto view2 = cudf::strings_column_view(input2);
+
+  auto results  = nvtext::jaccard_index(view1, view2, 5);
+  auto expected = cudf::test::fixed_width_column_wrapper<float>({1.0f, 0.103448279f, 0.f, 0.f});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  // no string of the second column has a substring
+  input2   = cudf::test::strings_column_wrapper({"abc", "abcd", "", "z"});
+  view2    = cudf::strings_column_view(input2);
+  results  = nvtext::jaccard_index(view1, view2, 5);
+  expected = cudf::test::fixed_width_column_wrapper<float>({0.f, 0.f, 0.f, 0.f});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
 TEST_F(JaccardTest, Errors)
 {
   auto input = cudf::test::strings_column_wrapper({"1", "2", "3"});
@@ -20,6 +20,7 @@
 #include <cudf_test/iterator_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -139,6 +140,68 @@ TEST_F(MinHashTest, MultiSeedWithNullInputRow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results64, expected64);
 }
 
+TEST_F(MinHashTest, Permuted)
+{
+  auto validity = cudf::test::iterators::null_at(1);
+  auto input    = cudf::test::strings_column_wrapper(
+    {"doc 1", "", "this is doc 2", "", "doc 3", "d", "this is doc 2"}, validity);
+  auto view = cudf::strings_column_view(input);
+
+  // the identity permutation returns the 32-bit hash values
+  auto seeds   = cudf::test::fixed_width_column_wrapper<uint32_t>({0, 0});
+  auto param_a = cudf::test::fixed_width_column_wrapper<uint32_t>({1, 1});
+  auto param_b = cudf::test::fixed_width_column_wrapper<uint32_t>({0, 0});
+  auto results = nvtext::minhash_permuted(
+    view, 0, cudf::column_view(param_a), cudf::column_view(param_b));
+  auto expected = nvtext::minhash(view, cudf::column_view(seeds));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+
+  auto param_a64 = cudf::test::fixed_width_column_wrapper<uint64_t>({3, 5, 7});
+  auto param_b64 = cudf::test::fixed_width_column_wrapper<uint64_t>({11, 13, 17});
+  auto results64 = nvtext::minhash64_permuted(
+    view, 0, cudf::column_view(param_a64), cudf::column_view(param_b64));
+  auto const lists = cudf::lists_column_view(results64->view());
+  EXPECT_EQ(results64->size(), view.size());
+  EXPECT_EQ(results64->null_count(), 1);
+  EXPECT_EQ(lists.child().size(), 3 * (view.size() - 1));
+
+  // the same strings have the same values and the values are below the prime
+  auto const h_values  = cudf::test::to_host<uint64_t>(lists.child()).first;
+  auto const h_offsets = cudf::test::to_host<cudf::size_type>(lists.offsets()).first;
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(h_values[h_offsets[2] + i], h_values[h_offsets[6] + i]);
+  }
+  for (auto value : h_values) {
+    EXPECT_LT(value, (1UL << 61) - 1);
+  }
+}
+
+TEST_F(MinHashTest, Bands)
+{
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  auto input =
+    LCW({LCW{1u, 2u, 3u, 4u, 9u}, LCW{}, LCW{1u, 2u, 5u, 6u, 8u}, LCW{5u, 6u, 3u, 4u}},
+        cudf::test::iterators::null_at(1));
+  auto results = nvtext::minhash_bands(cudf::lists_column_view(input), 2);
+
+  EXPECT_EQ(results->size(), 4);
+  EXPECT_EQ(results->null_count(), 1);
+  auto const lists            = cudf::lists_column_view(results->view());
+  auto const expected_offsets =
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>({0, 2, 2, 4, 6});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.offsets(), expected_offsets);
+
+  auto const h_bands = cudf::test::to_host<uint64_t>(lists.child()).first;
+  EXPECT_EQ(h_bands[0], h_bands[2]);  // [1, 2]
+  EXPECT_NE(h_bands[1], h_bands[3]);  // [3, 4] and [5, 6]
+  EXPECT_EQ(h_bands[1], h_bands[5]);  // [3, 4]
+  EXPECT_EQ(h_bands[3], h_bands[4]);  // [5, 6]
+  EXPECT_NE(h_bands[0], h_bands[1]);
+
+  auto empty = nvtext::minhash_bands(cudf::lists_column_view(LCW{}), 2);
+  EXPECT_EQ(empty->size(), 0);
+}
+
 TEST_F(MinHashTest, EmptyTest)
 {
   auto input   = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
@@ -159,6 +222,17 @@ TEST_F(MinHashTest, ErrorsTest)
   EXPECT_THROW(nvtext::minhash(view, cudf::column_view(seeds)), std::invalid_argument);
   auto seeds64 = cudf::test::fixed_width_column_wrapper<uint64_t>();
   EXPECT_THROW(nvtext::minhash64(view, cudf::column_view(seeds64)), std::invalid_argument);
+  auto params = cudf::test::fixed_width_column_wrapper<uint32_t>({1, 2});
+  EXPECT_THROW(
+    nvtext::minhash_permuted(view, 0, cudf::column_view(seeds), cudf::column_view(seeds)),
+    std::invalid_argument);
+  EXPECT_THROW(
+    nvtext::minhash_permuted(view, 0, cudf::column_view(params), cudf::column_view(seeds)),
+    std::invalid_argument);
+  auto hashes = cudf::test::lists_column_wrapper<uint32_t>({{1u, 2u}});
+  EXPECT_THROW(nvtext::minhash_bands(cudf::lists_column_view(hashes), 0), std::invalid_argument);
+  auto strings = cudf::test::lists_column_wrapper<cudf::string_view>({{"a", "b"}});
+  EXPECT_THROW(nvtext::minhash_bands(cudf::lists_column_view(strings), 1), cudf::data_type_error);
 
   std::vector<std::string> h_input(50000, "");
   input = cudf::test::strings_column_wrapper(h_input.begin(), h_input.end());
@@ -20,12 +20,18 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <nvtext/detail/subword_tokenize.hpp>
 #include <nvtext/subword_tokenize.hpp>
 
+#include <rmm/mr/device/per_device_resource.hpp>
+
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <vector>
 
 // Global environment for temporary files
@@ -208,6 +214,57 @@ TEST(TextSubwordTest, TokenizeMaxEqualsTokens)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
 
+TEST(TextSubwordTest, TokenizeInBatches)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  std::vector<char const*> const h_base{
+    "This is a test.", "", "This is a test. This is a tést.", "a", "tést this", "is a test"};
+  std::vector<char const*> h_strings;
+  for (int idx = 0; idx < 20; ++idx) {
+    h_strings.insert(h_strings.end(), h_base.begin(), h_base.end());
+  }
+  std::vector<bool> validity(h_strings.size());
+  for (std::size_t idx = 0; idx < validity.size(); ++idx) {
+    validity[idx] = idx % 7 != 4;
+  }
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(), h_strings.end(), validity.begin());
+  // a sliced input, so that the batches do not begin at the first character offset
+  auto const input = cudf::slice(strings, {5, static_cast<cudf::size_type>(h_strings.size())})[0];
+
+  auto const tokenize = [&](int64_t max_batch_bytes, bool do_truncate) {
+    return nvtext::detail::subword_tokenize(cudf::strings_column_view{input},
+                                            *vocab,
+                                            8,     // max_sequence_length
+                                            6,     // stride
+                                            true,  // do_lower_case
+                                            do_truncate,
+                                            max_batch_bytes,
+                                            cudf::get_default_stream(),
+                                            rmm::mr::get_current_device_resource());
+  };
+
+  for (auto const do_truncate : {false, true}) {
+    auto const expected = tokenize(nvtext::detail::default_max_batch_bytes, do_truncate);
+    // batches of a single row, of a few rows, and of rows longer than the batch size
+    for (int64_t const max_batch_bytes : {1, 20, 40, 100}) {
+      auto const result = tokenize(max_batch_bytes, do_truncate);
+      EXPECT_EQ(expected.nrows_tensor, result.nrows_tensor);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_token_ids->view(),
+                                     result.tensor_token_ids->view());
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_attention_mask->view(),
+                                     result.tensor_attention_mask->view());
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_metadata->view(),
+                                     result.tensor_metadata->view());
+    }
+  }
+
+  EXPECT_THROW(tokenize(0, false), cudf::logic_error);
+}
+
 TEST(TextSubwordTest, ParameterErrors)
 {
   std::vector<char const*> h_strings{"This is a test.", "This is a test. This is a tést.", "", ""};
@@ -331,6 +388,52 @@ TEST(TextSubwordTest, LoadVocabFileErrors)
   EXPECT_THROW(nvtext::load_vocabulary_file(hash_file), cudf::logic_error);
 }
 
+TEST(TextSubwordTest, LoadBinaryVocabFile)
+{
+  std::vector<char const*> h_strings{"This is a test.", "This is a tést.", "", "a"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  std::string binary_file = temp_env->get_temp_filepath("hashed_vocab.bin");
+  nvtext::write_vocabulary_file(*vocab, binary_file);
+  auto binary_vocab = nvtext::load_vocabulary_file(binary_file);
+
+  EXPECT_EQ(vocab->outer_hash_a, binary_vocab->outer_hash_a);
+  EXPECT_EQ(vocab->outer_hash_b, binary_vocab->outer_hash_b);
+  EXPECT_EQ(vocab->num_bins, binary_vocab->num_bins);
+  EXPECT_EQ(vocab->first_token_id, binary_vocab->first_token_id);
+  EXPECT_EQ(vocab->separator_token_id, binary_vocab->separator_token_id);
+  EXPECT_EQ(vocab->unknown_token_id, binary_vocab->unknown_token_id);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(vocab->table->view(), binary_vocab->table->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(vocab->bin_coefficients->view(),
+                                 binary_vocab->bin_coefficients->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(vocab->bin_offsets->view(), binary_vocab->bin_offsets->view());
+
+  auto const input = cudf::strings_column_view{strings};
+  auto expected    = nvtext::subword_tokenize(input, *vocab, 8, 6, true, false);
+  auto result      = nvtext::subword_tokenize(input, *binary_vocab, 8, 6, true, false);
+  EXPECT_EQ(expected.nrows_tensor, result.nrows_tensor);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_token_ids->view(),
+                                 result.tensor_token_ids->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_attention_mask->view(),
+                                 result.tensor_attention_mask->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_metadata->view(),
+                                 result.tensor_metadata->view());
+
+  // a truncated binary file is rejected
+  std::string truncated_file = temp_env->get_temp_filepath("truncated_vocab.bin");
+  {
+    std::ifstream infile(binary_file, std::ifstream::binary);
+    std::string contents((std::istreambuf_iterator<char>(infile)),
+                         std::istreambuf_iterator<char>());
+    std::ofstream outfile(truncated_file, std::ofstream::out | std::ofstream::binary);
+    outfile.write(contents.data(), contents.size() - 1);
+  }
+  EXPECT_THROW(nvtext::load_vocabulary_file(truncated_file), cudf::logic_error);
+}
+
 // This includes the words above and 7 special tokens:
 //  [BOS] [EOS] [UNK] [SEP] [PAD] [CLS] [MASK]
 // The data here was generated by the utility:
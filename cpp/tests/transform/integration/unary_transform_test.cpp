@@ -20,11 +20,17 @@
 #include "assert_unary.h"
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/random.hpp>
 
 #include <cudf/detail/iterator.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
+#include <cudf/utilities/jit_cache.hpp>
+
+#include <stdexcept>
+#include <vector>
 
 namespace transformation {
 struct UnaryOperationIntegrationTest : public cudf::test::BaseFixture {};
@@ -220,4 +226,71 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+TEST_F(UnaryOperationIntegrationTest, Transform_Table)
+{
+  // out = a * b + c
+  char const cuda[] =
+    "__device__ inline void f(float* output, int a, float b, float c){*output = a * b + c;}";
+
+  using int_wrapper   = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using float_wrapper = cudf::test::fixed_width_column_wrapper<float>;
+  auto const a        = int_wrapper({1, 2, 3, 4, 5}, {1, 1, 0, 1, 1});
+  auto const b        = float_wrapper({0.5, 1.5, 2.5, 3.5, 4.5});
+  auto const c        = float_wrapper({1, 1, 1, 1, 1}, {1, 1, 1, 1, 0});
+  auto const table    = cudf::table_view{{a, b, c}};
+  auto const type     = cudf::data_type{cudf::type_id::FLOAT32};
+
+  auto const result = cudf::transform(table, cuda, type, false);
+  auto const expected = float_wrapper({1.5, 4, 0, 15, 0}, {1, 1, 0, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  EXPECT_THROW(cudf::transform(cudf::table_view{}, cuda, type, false), cudf::logic_error);
+  EXPECT_THROW(cudf::transform(table, cuda, type, true, true), std::invalid_argument);
+}
+
+TEST_F(UnaryOperationIntegrationTest, Transform_Table_NullAware)
+{
+  // out = a if valid, otherwise b, and null if both are null
+  char const cuda[] = R"***(
+__device__ inline void f(int* output, bool* output_valid, int a, int b, bool a_valid, bool b_valid)
+{
+  *output       = a_valid ? a : b;
+  *output_valid = a_valid || b_valid;
+}
+)***";
+
+  auto const a = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4}, {1, 0, 1, 0});
+  auto const b = cudf::test::fixed_width_column_wrapper<int32_t>({5, 6, 7, 8}, {1, 1, 0, 0});
+
+  auto const result = cudf::transform(
+    cudf::table_view{{a, b}}, cuda, cudf::data_type{cudf::type_id::INT32}, false, true);
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>({1, 6, 3, 0}, {1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(UnaryOperationIntegrationTest, WarmupJitCache)
+{
+  char const cuda[] =
+    "__device__ inline void f(int* output,int input){*output = input*input - input;}";
+  auto const int32_type = cudf::data_type{cudf::type_id::INT32};
+
+  auto const manifest = std::vector<cudf::jit_kernel_spec>{
+    {cudf::jit_operation::TRANSFORM, cuda, false, {int32_type}, int32_type}};
+  cudf::warmup_jit_cache(manifest);
+
+  // the warmed up kernel computes the same results
+  using dtype    = int;
+  auto op        = [](dtype a) { return a * a - a; };
+  auto data_init = [](cudf::size_type row) { return row % 78; };
+  test_udf<dtype>(cuda, op, data_init, 500, false);
+
+  auto const wrong_inputs = std::vector<cudf::jit_kernel_spec>{
+    {cudf::jit_operation::TRANSFORM, cuda, false, {int32_type, int32_type}, int32_type}};
+  EXPECT_THROW(cudf::warmup_jit_cache(wrong_inputs), std::invalid_argument);
+  auto const cuda_binary_operation = std::vector<cudf::jit_kernel_spec>{
+    {cudf::jit_operation::BINARY_OPERATION, cuda, false, {int32_type, int32_type}, int32_type}};
+  EXPECT_THROW(cudf::warmup_jit_cache(cuda_binary_operation), std::invalid_argument);
+  EXPECT_THROW(cudf::set_jit_cache_limits(0, 10), std::invalid_argument);
+}
+
 }  // namespace transformation
@@ -177,6 +177,30 @@ TEST_F(OneHotEncodingTest, Strings)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got);
 }
 
+TEST_F(OneHotEncodingTest, SparseStrings)
+{
+  auto input = cudf::test::strings_column_wrapper{
+    {"hello", "rapidsai", "cudf", "hello", "cuspatial", "hello", "world", "!"},
+    {1, 1, 1, 1, 0, 1, 1, 0}};
+  auto category = cudf::test::strings_column_wrapper{{"hello", "world", ""}, {1, 1, 0}};
+
+  auto expected_rows  = cudf::test::fixed_width_column_wrapper<cudf::size_type>{0, 3, 4, 5, 6, 7};
+  auto expected_codes = cudf::test::fixed_width_column_wrapper<cudf::size_type>{0, 0, 2, 0, 1, 2};
+
+  auto const [rows, codes] = cudf::sparse_one_hot_encode(input, category);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_rows, *rows);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_codes, *codes);
+
+  auto const [empty_rows, empty_codes] =
+    cudf::sparse_one_hot_encode(input, cudf::test::strings_column_wrapper{});
+  EXPECT_EQ(empty_rows->size(), 0);
+  EXPECT_EQ(empty_codes->size(), 0);
+  EXPECT_THROW(
+    cudf::sparse_one_hot_encode(input, cudf::test::fixed_width_column_wrapper<int64_t>{1}),
+    cudf::logic_error);
+}
+
 TEST_F(OneHotEncodingTest, Dictionary)
 {
   auto input =
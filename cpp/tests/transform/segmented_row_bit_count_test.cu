@@ -37,6 +37,7 @@
 #include <thrust/transform.h>
 
 #include <numeric>
+#include <vector>
 
 // Reuse function defined in `row_bit_count_test.cu`.
 namespace row_bit_count_test {
@@ -249,3 +250,45 @@ TEST_F(SegmentedRowBitCount, EdgeCases)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *actual);
   }
 }
+
+TEST_F(SegmentedRowBitCount, FixedWidthAndNestedTable)
+{
+  // The fixed-width columns are added to the sizes without being traversed
+  auto const col0 = row_bit_count_test::build_nested_column1({1, 1, 1, 1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int64_t> const col1({1, 2, 3, 4, 5, 6},
+                                                             {1, 0, 1, 1, 0, 1});
+  auto const col2  = std::get<0>(row_bit_count_test::build_struct_column());
+  auto const input = cudf::table_view({col1, *col0, *col2});
+
+  auto constexpr segment_length = 4;
+  auto const [expected, actual] = compute_segmented_row_bit_count(input, segment_length);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *actual);
+}
+
+TEST_F(SegmentedRowBitCount, ByteCountByOffsets)
+{
+  auto const col0 = row_bit_count_test::build_nested_column1({1, 1, 1, 1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int64_t> const col1({1, 2, 3, 4, 5, 6},
+                                                             {1, 0, 1, 1, 0, 1});
+  auto const input = cudf::table_view({*col0, col1});
+
+  auto const row_sizes = cudf::test::to_host<cudf::size_type>(cudf::row_bit_count(input)->view());
+  std::vector<cudf::size_type> const offsets{0, 1, 1, 4, 6};
+  std::vector<int64_t> expected;
+  for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+    auto const bits = std::accumulate(row_sizes.first.begin() + offsets[i],
+                                      row_sizes.first.begin() + offsets[i + 1],
+                                      int64_t{0});
+    expected.push_back(cudf::util::div_rounding_up_safe<int64_t>(bits, 8));
+  }
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> const d_offsets(offsets.begin(),
+                                                                          offsets.end());
+  auto const actual = cudf::segmented_row_byte_count(
+    input, cudf::device_span<cudf::size_type const>(cudf::column_view(d_offsets)));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<int64_t>(expected.begin(), expected.end()), *actual);
+
+  auto const empty = cudf::segmented_row_byte_count(input, {});
+  EXPECT_EQ(empty->size(), 0);
+}
@@ -19,6 +19,7 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
@@ -215,6 +216,30 @@ inline auto make_data_type()
   return cudf::data_type{cudf::type_to_id<T>()};
 }
 
+struct CastNumericSimple : public cudf::test::BaseFixture {};
+
+TEST_F(CastNumericSimple, UnalignedAndPartialVectors)
+{
+  // 37 rows fill two vectors of 16 bytes and leave a few rows, and the slice is not aligned
+  auto const values = thrust::host_vector<int8_t>(
+    thrust::counting_iterator<int8_t>(-18), thrust::counting_iterator<int8_t>(19));
+  auto validity = thrust::host_vector<bool>(values.size());
+  for (std::size_t i = 0; i < validity.size(); ++i) {
+    validity[i] = i % 5 != 0;
+  }
+  auto const input = make_column<int8_t>(values, validity);
+
+  auto const to_int16 = cudf::cast(input, make_data_type<int16_t>());
+  validate_cast_result<int8_t, int16_t>(input, *to_int16);
+  auto const to_float = cudf::cast(input, make_data_type<float>());
+  validate_cast_result<int8_t, float>(input, *to_float);
+
+  auto const sliced        = cudf::slice(input, {3, 37}).front();
+  auto const sliced_result = cudf::cast(sliced, make_data_type<int32_t>());
+  auto const copy          = cudf::column(sliced);
+  validate_cast_result<int8_t, int32_t>(copy, *sliced_result);
+}
+
 struct CastTimestampsSimple : public cudf::test::BaseFixture {};
 
 TEST_F(CastTimestampsSimple, IsIdempotent)
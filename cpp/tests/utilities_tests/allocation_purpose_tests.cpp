@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+
+#include <cudf/utilities/allocation_purpose.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/failure_callback_resource_adaptor.hpp>
+#include <rmm/mr/device/limiting_resource_adaptor.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <optional>
+
+struct AllocationPurposeTest : public cudf::test::BaseFixture {};
+
+TEST_F(AllocationPurposeTest, ScopesNest)
+{
+  EXPECT_EQ(cudf::current_allocation_purpose(), cudf::allocation_purpose::UNSPECIFIED);
+  {
+    cudf::allocation_purpose_scope const outer{cudf::allocation_purpose::OUTPUT};
+    EXPECT_EQ(cudf::current_allocation_purpose(), cudf::allocation_purpose::OUTPUT);
+    {
+      cudf::allocation_purpose_scope const inner{cudf::allocation_purpose::DECOMPRESSION};
+      EXPECT_EQ(cudf::current_allocation_purpose(), cudf::allocation_purpose::DECOMPRESSION);
+    }
+    EXPECT_EQ(cudf::current_allocation_purpose(), cudf::allocation_purpose::OUTPUT);
+  }
+  EXPECT_EQ(cudf::current_allocation_purpose(), cudf::allocation_purpose::UNSPECIFIED);
+}
+
+TEST_F(AllocationPurposeTest, IsTransient)
+{
+  EXPECT_FALSE(cudf::is_transient(cudf::allocation_purpose::UNSPECIFIED));
+  EXPECT_FALSE(cudf::is_transient(cudf::allocation_purpose::OUTPUT));
+  EXPECT_TRUE(cudf::is_transient(cudf::allocation_purpose::INPUT_BUFFER));
+  EXPECT_TRUE(cudf::is_transient(cudf::allocation_purpose::DECOMPRESSION));
+  EXPECT_TRUE(cudf::is_transient(cudf::allocation_purpose::TEMPORARY));
+}
+
+namespace {
+
+struct spill_state {
+  std::optional<rmm::device_buffer> cold_data;
+  cudf::allocation_purpose failed_purpose{cudf::allocation_purpose::UNSPECIFIED};
+};
+
+bool spill_and_retry(std::size_t, void* arg)
+{
+  auto& state          = *static_cast<spill_state*>(arg);
+  state.failed_purpose = cudf::current_allocation_purpose();
+  if (not state.cold_data.has_value()) { return false; }
+  state.cold_data.reset();
+  return true;
+}
+
+}  // namespace
+
+TEST_F(AllocationPurposeTest, RetryAfterSpill)
+{
+  auto constexpr limit = std::size_t{1} << 20;
+  rmm::mr::limiting_resource_adaptor<rmm::mr::device_memory_resource> limited{
+    rmm::mr::get_current_device_resource(), limit};
+  spill_state state;
+  rmm::mr::failure_callback_resource_adaptor<decltype(limited)> mr{
+    &limited, spill_and_retry, &state};
+
+  auto const stream = cudf::get_default_stream();
+  state.cold_data.emplace(limit, stream, &mr);
+
+  cudf::allocation_purpose_scope const purpose{cudf::allocation_purpose::DECOMPRESSION};
+  rmm::device_buffer const scratch(limit / 2, stream, &mr);
+
+  EXPECT_EQ(scratch.size(), limit / 2);
+  EXPECT_FALSE(state.cold_data.has_value());
+  EXPECT_EQ(state.failed_purpose, cudf::allocation_purpose::DECOMPRESSION);
+}
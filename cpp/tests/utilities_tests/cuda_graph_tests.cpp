@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/cuda_graph.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+struct CudaGraphTest : public cudf::test::BaseFixture {};
+
+TEST_F(CudaGraphTest, ReplayReadsCurrentInput)
+{
+  rmm::cuda_stream stream;
+  auto input = cudf::column(cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3}));
+
+  cudf::cuda_graph graph;
+  std::unique_ptr<cudf::column> result;
+  graph.capture(
+    [&](auto s) { result = cudf::cast(input, cudf::data_type{cudf::type_id::FLOAT64}, s); },
+    stream.view());
+  EXPECT_TRUE(graph.is_captured());
+
+  graph.replay(stream.view());
+  stream.synchronize();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result,
+                                 cudf::test::fixed_width_column_wrapper<double>({1, 2, 3}));
+
+  std::vector<int32_t> const batch{4, 5, 6};
+  CUDF_CUDA_TRY(cudaMemcpyAsync(input.mutable_view().data<int32_t>(),
+                                batch.data(),
+                                batch.size() * sizeof(int32_t),
+                                cudaMemcpyDefault,
+                                stream.value()));
+  graph.replay(stream.view());
+  stream.synchronize();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result,
+                                 cudf::test::fixed_width_column_wrapper<double>({4, 5, 6}));
+}
+
+TEST_F(CudaGraphTest, RecaptureWithNewInput)
+{
+  rmm::cuda_stream stream;
+  auto const first  = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3});
+  auto const second = cudf::test::fixed_width_column_wrapper<int32_t>({7, 8, 9});
+
+  cudf::cuda_graph graph;
+  std::unique_ptr<cudf::column> result;
+  auto const pipeline = [&](cudf::column_view input) {
+    return [&, input](auto s) {
+      result = cudf::cast(input, cudf::data_type{cudf::type_id::INT64}, s);
+    };
+  };
+  graph.capture(pipeline(first), stream.view());
+  graph.replay(stream.view());
+  stream.synchronize();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result,
+                                 cudf::test::fixed_width_column_wrapper<int64_t>({1, 2, 3}));
+
+  // the same calls on an input of the same shape only update the instantiated graph
+  graph.capture(pipeline(second), stream.view());
+  EXPECT_EQ(graph.num_updates(), 1);
+  graph.replay(stream.view());
+  stream.synchronize();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result,
+                                 cudf::test::fixed_width_column_wrapper<int64_t>({7, 8, 9}));
+}
+
+TEST_F(CudaGraphTest, FailedCaptureKeepsStreamUsable)
+{
+  rmm::cuda_stream stream;
+  cudf::cuda_graph graph;
+  EXPECT_THROW(graph.capture([](auto) { throw std::runtime_error("failed"); }, stream.view()),
+               std::runtime_error);
+  EXPECT_FALSE(graph.is_captured());
+
+  cudaStreamCaptureStatus status{};
+  CUDF_CUDA_TRY(cudaStreamIsCapturing(stream.value(), &status));
+  EXPECT_EQ(status, cudaStreamCaptureStatusNone);
+}
+
+TEST_F(CudaGraphTest, InvalidArguments)
+{
+  cudf::cuda_graph graph;
+  EXPECT_THROW(graph.replay(cudf::get_default_stream()), std::logic_error);
+  EXPECT_THROW(graph.capture([](auto) {}, rmm::cuda_stream_legacy), std::invalid_argument);
+}
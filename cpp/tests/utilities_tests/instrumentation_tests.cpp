@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/unary.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/instrumentation.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct InstrumentationTest : public cudf::test::BaseFixture {};
+
+TEST_F(InstrumentationTest, ReportsInstrumentedCalls)
+{
+  auto const input = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3}, {1, 0, 1});
+
+  std::mutex mutex;
+  std::vector<cudf::api_event> events;
+  auto const id = cudf::register_api_event_callback([&](cudf::api_event const& event) {
+    std::lock_guard lock{mutex};
+    events.push_back(event);
+  });
+
+  cudf::api_memory_tracker tracker{rmm::mr::get_current_device_resource()};
+  auto const previous = rmm::mr::set_current_device_resource(&tracker);
+  auto const result =
+    cudf::cast(input, cudf::data_type{cudf::type_id::INT64}, cudf::get_default_stream());
+  rmm::mr::set_current_device_resource(previous);
+  cudf::flush_api_events();
+
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(std::string{events.front().name}, "cast");
+  EXPECT_EQ(events.front().input_rows, 3);
+  // 3 values and a null mask padded to 64 bytes
+  EXPECT_EQ(events.front().input_bytes, 3 * sizeof(int32_t) + 64);
+  EXPECT_GE(events.front().peak_memory_bytes, 3 * sizeof(int64_t));
+  EXPECT_GE(events.front().elapsed_ms, 0.f);
+
+  cudf::unregister_api_event_callback(id);
+  cudf::cast(input, cudf::data_type{cudf::type_id::INT64}, cudf::get_default_stream());
+  cudf::flush_api_events();
+  EXPECT_EQ(events.size(), 1);
+}
+
+TEST_F(InstrumentationTest, InvalidArguments)
+{
+  EXPECT_THROW(cudf::register_api_event_callback(nullptr), std::invalid_argument);
+  EXPECT_THROW(cudf::api_memory_tracker{nullptr}, std::invalid_argument);
+}
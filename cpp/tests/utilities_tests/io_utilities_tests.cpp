@@ -18,6 +18,7 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/table_utilities.hpp>
 
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/io/memory_resource.hpp>
 #include <cudf/io/parquet.hpp>
 
@@ -63,3 +64,21 @@ TEST(IoUtilitiesTest, HostMemoryGetAndSet)
   // reset memory resource back
   cudf::io::set_host_memory_resource(last_mr);
 }
+
+TEST(IoUtilitiesTest, ConfigDefaultHostMemoryAfterUse)
+{
+  // the default resource is created on first use and cannot be reconfigured afterwards
+  [[maybe_unused]] auto const mr = cudf::io::get_host_memory_resource();
+  EXPECT_FALSE(cudf::io::config_default_host_memory_resource({std::size_t{1024}}));
+}
+
+TEST(IoUtilitiesTest, PinnedHostVectorUsesHostMemoryResource)
+{
+  // small buffers come from the pool, large ones fall back to the upstream resource
+  for (auto const size : {std::size_t{64}, std::size_t{256} * 1024 * 1024}) {
+    cudf::detail::pinned_host_vector<uint8_t> buffer(size);
+    buffer.back() = 42;
+    EXPECT_EQ(buffer.size(), size);
+    EXPECT_EQ(buffer.back(), 42);
+  }
+}
@@ -75,3 +75,42 @@ TEST_F(LoggerTest, CustomLevel)
   cudf::logger().debug("debug");
   ASSERT_EQ(this->sink_content(), "debug\n");
 }
+
+TEST_F(LoggerTest, DisabledLevelSkipsArguments)
+{
+  int evaluations     = 0;
+  auto const argument = [&] { return ++evaluations; };
+
+  cudf::logger().set_level(spdlog::level::err);
+  CUDF_LOG_WARN("warn {}", argument());
+  EXPECT_EQ(evaluations, 0);
+  CUDF_LOG_ERROR("error {}", argument());
+  EXPECT_EQ(evaluations, 1);
+  ASSERT_EQ(this->sink_content(), "error 1\n");
+}
+
+TEST_F(LoggerTest, PerfEvents)
+{
+  auto const prev_perf_level = cudf::perf_logger().level();
+  auto const prev_perf_sinks = cudf::perf_logger().sinks();
+  std::ostringstream perf_oss;
+  cudf::perf_logger().sinks() = {std::make_shared<spdlog::sinks::ostream_sink_mt>(perf_oss)};
+  cudf::perf_logger().set_formatter(
+    std::unique_ptr<spdlog::formatter>(new spdlog::pattern_formatter("%v")));
+
+  // Off by default
+  cudf::perf_logger().set_level(spdlog::level::off);
+  EXPECT_FALSE(cudf::detail::perf_logging_enabled());
+  CUDF_LOG_PERF("test_read", "bytes={}", 1024);
+  EXPECT_EQ(perf_oss.str(), "");
+
+  cudf::perf_logger().set_level(spdlog::level::info);
+  EXPECT_TRUE(cudf::detail::perf_logging_enabled());
+  CUDF_LOG_PERF("test_read", "bytes={} passes={}", 1024, 2);
+  EXPECT_EQ(perf_oss.str(), "event=test_read bytes=1024 passes=2\n");
+  // The events do not go to the main logger
+  EXPECT_EQ(this->sink_content(), "");
+
+  cudf::perf_logger().set_level(prev_perf_level);
+  cudf::perf_logger().sinks() = prev_perf_sinks;
+}
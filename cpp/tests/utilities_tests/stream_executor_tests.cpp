@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/case.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/stream_executor.hpp>
+
+#include <memory>
+#include <stdexcept>
+
+struct StreamExecutorTest : public cudf::test::BaseFixture {};
+
+TEST_F(StreamExecutorTest, IndependentAndDependentTasks)
+{
+  auto const ints    = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3}, {1, 0, 1});
+  auto const strings = cudf::test::strings_column_wrapper({"ab", "Cd", "eF"});
+  auto const stream  = cudf::get_default_stream();
+
+  std::unique_ptr<cudf::column> casted;
+  std::unique_ptr<cudf::column> doubled;
+  std::unique_ptr<cudf::column> upper;
+  {
+    cudf::stream_executor executor(2, stream);
+    auto const cast = executor.submit([&](auto task_stream) {
+      casted = cudf::cast(ints, cudf::data_type{cudf::type_id::INT64}, task_stream);
+    });
+    executor.submit([&](auto task_stream) {
+      upper = cudf::strings::to_upper(cudf::strings_column_view{strings}, task_stream);
+    });
+    auto const twice = executor.submit(
+      [&](auto task_stream) {
+        doubled = cudf::binary_operation(*casted,
+                                         cudf::numeric_scalar<int64_t>(2, true, task_stream),
+                                         cudf::binary_operator::MUL,
+                                         cudf::data_type{cudf::type_id::INT64},
+                                         task_stream);
+      },
+      {cast});
+    EXPECT_EQ(executor.num_tasks(), 3);
+    EXPECT_EQ(executor.task_stream(twice), executor.task_stream(cast));
+    executor.join();
+  }
+
+  auto const expected_doubled =
+    cudf::test::fixed_width_column_wrapper<int64_t>({2, 4, 6}, {1, 0, 1});
+  auto const expected_upper = cudf::test::strings_column_wrapper({"AB", "CD", "EF"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*doubled, expected_doubled);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*upper, expected_upper);
+}
+
+TEST_F(StreamExecutorTest, SharedDependency)
+{
+  auto const ints = cudf::test::fixed_width_column_wrapper<int32_t>({4, 9, 16});
+
+  std::unique_ptr<cudf::column> casted;
+  std::unique_ptr<cudf::column> roots;
+  std::unique_ptr<cudf::column> absolute;
+  cudf::stream_executor executor(2);
+  auto const cast = executor.submit([&](auto stream) {
+    casted = cudf::cast(ints, cudf::data_type{cudf::type_id::FLOAT64}, stream);
+  });
+  auto const root_task = executor.submit(
+    [&](auto stream) {
+      roots = cudf::unary_operation(*casted, cudf::unary_operator::SQRT, stream);
+    },
+    {cast});
+  // the stream of `cast` is taken by `root_task`, so this task waits for it on another stream
+  auto const abs_task = executor.submit(
+    [&](auto stream) {
+      absolute = cudf::unary_operation(*casted, cudf::unary_operator::ABS, stream);
+    },
+    {cast});
+  EXPECT_NE(executor.task_stream(root_task), executor.task_stream(abs_task));
+  executor.join();
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*roots,
+                                 cudf::test::fixed_width_column_wrapper<double>({2, 3, 4}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*absolute,
+                                 cudf::test::fixed_width_column_wrapper<double>({4, 9, 16}));
+}
+
+TEST_F(StreamExecutorTest, InvalidArguments)
+{
+  EXPECT_THROW(cudf::stream_executor(0), std::invalid_argument);
+
+  cudf::stream_executor executor(1);
+  EXPECT_THROW(executor.submit([](auto) {}, {0}), std::invalid_argument);
+  EXPECT_THROW(executor.wait(0, cudf::get_default_stream()), std::invalid_argument);
+}
@@ -1,4 +1,6 @@
-# Copyright (c) 2020-2023, NVIDIA CORPORATION.
+# Copyright (c) 2020-2024, NVIDIA CORPORATION.
+
+import cudf
 
 from libcpp.string cimport string
 from libcpp.utility cimport move
@@ -10,7 +12,7 @@ from cudf._lib.cpp.io.avro cimport (
 )
 from cudf._lib.cpp.io.types cimport table_with_metadata
 from cudf._lib.cpp.types cimport size_type
-from cudf._lib.io.utils cimport make_source_info
+from cudf._lib.io.utils cimport make_source_info, update_struct_field_names
 from cudf._lib.utils cimport data_from_unique_ptr
 
 
@@ -52,4 +54,11 @@ cpdef read_avro(datasource, columns=None, skip_rows=-1, num_rows=-1):
 
     names = [info.name.decode() for info in c_result.metadata.schema_info]
 
-    return data_from_unique_ptr(move(c_result.tbl), column_names=names)
+    df = cudf.DataFrame._from_data(*data_from_unique_ptr(
+        move(c_result.tbl),
+        column_names=names
+    ))
+
+    update_struct_field_names(df, c_result.metadata.schema_info)
+
+    return df
@@ -1,6 +1,5 @@
-# Copyright (c) 2019-2022, NVIDIA CORPORATION.
+# Copyright (c) 2019-2024, NVIDIA CORPORATION.
 
-import cudf
 from cudf import _lib as libcudf
 from cudf.utils import ioutils
 
@@ -32,8 +31,6 @@ def read_avro(
     if compression is not None:
         ValueError("URL content-encoding decompression is not supported")
 
-    return cudf.DataFrame._from_data(
-        *libcudf.avro.read_avro(
-            filepath_or_buffer, columns, skiprows, num_rows
-        )
+    return libcudf.avro.read_avro(
+        filepath_or_buffer, columns, skiprows, num_rows
     )
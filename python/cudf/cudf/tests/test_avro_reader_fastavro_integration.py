@@ -647,3 +647,98 @@ def test_avro_reader_multiblock(
     actual_df = cudf.read_avro(buffer, skiprows=skip_rows, num_rows=num_rows)
 
     assert_eq(expected_df, actual_df)
+
+
+@pytest.mark.parametrize("codec", ["null", "deflate", "snappy"])
+@pytest.mark.parametrize("nullable", [True, False])
+def test_avro_reader_array(codec, nullable):
+    items = ["null", "int"] if nullable else "int"
+    schema = {
+        "name": "root",
+        "type": "record",
+        "fields": [
+            {"name": "id", "type": "long"},
+            {"name": "values", "type": {"type": "array", "items": items}},
+            {"name": "tag", "type": "string"},
+        ],
+    }
+    values = [[1, 2, 3], [], [4], [5, 6]]
+    if nullable:
+        values[3][0] = None
+    records = [
+        {"id": i, "values": v, "tag": str(i)} for i, v in enumerate(values)
+    ]
+
+    buffer = io.BytesIO()
+    fastavro.writer(buffer, schema, records, codec=codec)
+    buffer.seek(0)
+    actual = cudf.read_avro(buffer)
+
+    expected = cudf.DataFrame(
+        {
+            "id": cudf.Series(range(len(values)), dtype="int64"),
+            "values": cudf.Series(values, dtype=cudf.ListDtype("int32")),
+            "tag": [str(i) for i in range(len(values))],
+        }
+    )
+
+    assert_eq(expected, actual)
+
+
+def test_avro_reader_map():
+    schema = {
+        "name": "root",
+        "type": "record",
+        "fields": [
+            {"name": "attrs", "type": {"type": "map", "values": "long"}},
+        ],
+    }
+    attrs = [{"a": 1, "b": 2}, {}, {"c": 3}]
+    records = [{"attrs": a} for a in attrs]
+
+    actual = cudf_from_avro_util(schema, records)
+
+    expected = cudf.DataFrame(
+        {
+            "attrs": [
+                [{"key": k, "value": v} for k, v in a.items()] for a in attrs
+            ]
+        }
+    )
+
+    assert_eq(expected, actual)
+
+
+def test_avro_reader_array_of_records():
+    schema = {
+        "name": "root",
+        "type": "record",
+        "fields": [
+            {
+                "name": "points",
+                "type": {
+                    "type": "array",
+                    "items": {
+                        "type": "record",
+                        "name": "point",
+                        "fields": [
+                            {"name": "x", "type": "double"},
+                            {"name": "label", "type": ["null", "string"]},
+                        ],
+                    },
+                },
+            },
+        ],
+    }
+    points = [
+        [{"x": 1.0, "label": "a"}, {"x": 2.0, "label": None}],
+        [],
+        [{"x": 3.0, "label": "c"}],
+    ]
+    records = [{"points": p} for p in points]
+
+    actual = cudf_from_avro_util(schema, records)
+
+    expected = cudf.DataFrame({"points": points})
+
+    assert_eq(expected, actual)